@@ -127,6 +127,7 @@ int main(int argc, char** argv) {
 
     inviwo::util::OnScopeExit clearNetwork([&]() { inviwoApp.getProcessorNetwork()->clear(); });
 
+    logger.flush();
     if (auto numErrors = logCounter->getWarnCount()) {
         inviwo::log::warn("{} warnings generated during startup", numErrors);
     }
@@ -0,0 +1,393 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#ifdef WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <modules/opengl/inviwoopengl.h>
+#include <modules/opengl/openglcapabilities.h>
+#include <modules/opengl/openglmodule.h>
+#include <modules/json/json.h>
+#include <modules/json/jsonmodule.h>
+#include <modules/json/io/json/glmjsonconverter.h>
+
+#include <inviwo/core/common/defaulttohighperformancegpu.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/network/evaluationprofiler.h>
+#include <inviwo/core/network/networklock.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/workspacemanager.h>
+#include <inviwo/core/properties/cameraproperty.h>
+#include <inviwo/core/util/clock.h>
+#include <inviwo/core/util/commandlineparser.h>
+#include <inviwo/core/util/consolelogger.h>
+#include <inviwo/core/util/localetools.h>
+#include <inviwo/core/util/moduleutils.h>
+#include <inviwo/core/util/rendercontext.h>
+#include <inviwo/core/util/settings/systemsettings.h>
+
+#include <inviwo/sys/moduleloading.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include <fmt/std.h>
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+using namespace inviwo;
+
+namespace {
+
+using Frame = std::function<void()>;
+
+double toMs(Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); }
+
+size_t peakResidentMemory() {
+#ifdef WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss);  // bytes
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;  // kilobytes
+#endif
+#endif
+}
+
+/**
+ * Process events until the network and all its background jobs have finished, and the GPU has
+ * caught up, so that the time until this returns is the latency of a frame.
+ */
+void waitForNetwork(InviwoApplication& app) {
+    app.waitForPool();
+    do {  // NOLINT
+        glfwPollEvents();
+        app.processFront();
+    } while (app.getProcessorNetwork()->runningBackgroundJobs() > 0);
+
+    RenderContext::getPtr()->activateDefaultRenderContext();
+    glFinish();
+}
+
+/**
+ * Tracks the lowest amount of available video memory. Only supported by drivers that expose
+ * GL_NVX_gpu_memory_info or GL_ATI_meminfo, and measures the whole GPU not just this process.
+ */
+class VideoMemory {
+public:
+    explicit VideoMemory(OpenGLCapabilities& capabilities)
+        : capabilities_{capabilities}
+        , total_{capabilities.getTotalAvailableTextureMem()}
+        , minAvailable_{capabilities.getCurrentAvailableTextureMem()} {}
+
+    void sample() {
+        minAvailable_ = std::min(minAvailable_, capabilities_.getCurrentAvailableTextureMem());
+    }
+
+    json report() const {
+        if (total_ == 0) return nullptr;
+        return {{"total", total_}, {"peakUsed", total_ - minAvailable_}};
+    }
+
+private:
+    OpenGLCapabilities& capabilities_;
+    size_t total_;
+    size_t minAvailable_;
+};
+
+Property& findProperty(ProcessorNetwork& network, const std::string& path) {
+    if (auto* property = network.getProperty(path)) return *property;
+    throw Exception(SourceContext{}, "Could not find property '{}'", path);
+}
+
+CameraProperty& findCamera(ProcessorNetwork& network, const std::string& path) {
+    if (auto* camera = dynamic_cast<CameraProperty*>(&findProperty(network, path))) return *camera;
+    throw Exception(SourceContext{}, "Property '{}' is not a camera", path);
+}
+
+/**
+ * Translate the steps of the benchmark script into a list of frames, each frame applies its
+ * changes to the network. See README.md for the format.
+ */
+std::vector<Frame> parseSteps(const json& steps, ProcessorNetwork& network,
+                              const JSONPropertyConverter& converter) {
+    std::vector<Frame> frames;
+
+    for (const auto& step : steps) {
+        const auto repeat = step.value("repeat", size_t{1});
+        const auto begin = frames.size();
+
+        if (step.contains("set")) {
+            std::vector<std::pair<Property*, json>> changes;
+            for (const auto& [path, value] : step["set"].items()) {
+                changes.emplace_back(&findProperty(network, path), value);
+            }
+            frames.emplace_back([changes, &converter]() {
+                for (const auto& [property, value] : changes) converter.fromJSON(value, *property);
+            });
+        } else if (step.contains("property")) {
+            auto* property = &findProperty(network, step["property"].get<std::string>());
+            for (const auto& value : step.at("values")) {
+                frames.emplace_back(
+                    [property, value, &converter]() { converter.fromJSON(value, *property); });
+            }
+        } else if (step.contains("orbit")) {
+            auto* camera = &findCamera(network, step.at("camera").get<std::string>());
+            const auto& orbit = step["orbit"];
+            const auto count = orbit.value("frames", size_t{60});
+            const auto degrees = orbit.value("degrees", 360.0f);
+            const auto angle = glm::radians(degrees) / static_cast<float>(count);
+            for (size_t i = 0; i < count; ++i) {
+                frames.emplace_back([camera, angle]() {
+                    const auto axis = glm::normalize(camera->getLookUp());
+                    const auto to = camera->getLookTo();
+                    const auto dir = camera->getLookFrom() - to;
+                    camera->setLookFrom(to + glm::angleAxis(angle, axis) * dir);
+                });
+            }
+        } else if (step.contains("path")) {
+            auto* camera = &findCamera(network, step.at("camera").get<std::string>());
+            struct Key {
+                vec3 from, to, up;
+            };
+            std::vector<Key> keys;
+            for (const auto& key : step["path"]) {
+                keys.push_back({key.at("from").get<vec3>(), key.at("to").get<vec3>(),
+                                key.value("up", vec3{0.0f, 1.0f, 0.0f})});
+            }
+            // Number of interpolated frames between each pair of keys
+            const auto count = std::max(step.value("frames", size_t{1}), size_t{1});
+            for (size_t k = 0; k < keys.size(); ++k) {
+                const auto& a = keys[k];
+                const auto& b = k + 1 < keys.size() ? keys[k + 1] : keys[k];
+                const auto n = k + 1 < keys.size() ? count : size_t{1};
+                for (size_t i = 0; i < n; ++i) {
+                    const auto t = static_cast<float>(i) / static_cast<float>(n);
+                    frames.emplace_back([camera, from = glm::mix(a.from, b.from, t),
+                                         to = glm::mix(a.to, b.to, t),
+                                         up = glm::normalize(glm::mix(a.up, b.up, t))]() {
+                        camera->setLook(from, to, up);
+                    });
+                }
+            }
+        } else {
+            throw Exception(SourceContext{}, "Unknown benchmark step: {}", step.dump());
+        }
+
+        const auto end = frames.size();
+        for (size_t r = 1; r < repeat; ++r) {
+            for (size_t i = begin; i < end; ++i) frames.push_back(frames[i]);
+        }
+    }
+
+    return frames;
+}
+
+json frameStats(std::vector<double> ms) {
+    if (ms.empty()) return nullptr;
+    std::ranges::sort(ms);
+    const auto percentile = [&](double p) {
+        const auto i = static_cast<size_t>(p * static_cast<double>(ms.size() - 1) + 0.5);
+        return ms[std::min(i, ms.size() - 1)];
+    };
+    return {{"count", ms.size()},
+            {"mean", std::accumulate(ms.begin(), ms.end(), 0.0) / static_cast<double>(ms.size())},
+            {"min", ms.front()},
+            {"p50", percentile(0.50)},
+            {"p90", percentile(0.90)},
+            {"p95", percentile(0.95)},
+            {"p99", percentile(0.99)},
+            {"max", ms.back()}};
+}
+
+json processorStats(const EvaluationProfiler& profiler) {
+    json processors = json::array();
+    for (const auto& stat : profiler.getProcessorStats()) {
+        processors.push_back(
+            {{"identifier", stat.identifier},
+             {"count", stat.count},
+             {"total", toMs(stat.total)},
+             {"mean", stat.count > 0 ? toMs(stat.total) / static_cast<double>(stat.count) : 0.0},
+             {"max", toMs(stat.max)},
+             {"gpuTotal", toMs(stat.gpuTotal)},
+             {"invalidations", stat.invalidations}});
+    }
+    return processors;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    inviwo::util::configureCodePage();
+
+    inviwo::LogCentral logger;
+    inviwo::LogCentral::init(&logger);
+    auto consoleLogger = std::make_shared<inviwo::ConsoleLogger>();
+    logger.registerLogger(consoleLogger);
+
+    InviwoApplication inviwoApp(argc, argv, "Inviwo-Benchmark");
+    inviwoApp.setPostEnqueueFront([]() { glfwPostEmptyEvent(); });
+
+    auto& cmdParser = inviwoApp.getCommandLineParser();
+
+    inviwo::util::registerModules(inviwoApp.getModuleManager(),
+                                  inviwoApp.getSystemSettings().moduleSearchPaths_.get(),
+                                  cmdParser.getModuleSearchPaths());
+
+    TCLAP::ValueArg<std::string> scriptArg("b", "benchmark", "Benchmark script to run", false, "",
+                                           "benchmark json file");
+    TCLAP::ValueArg<std::string> reportArg(
+        "r", "report", "Write the results to this json file instead of to stdout", false, "",
+        "report json file");
+    TCLAP::ValueArg<std::string> traceArg(
+        "t", "trace", "Write the profiled evaluation as a Chrome trace json file", false, "",
+        "trace json file");
+    cmdParser.add(&scriptArg);
+    cmdParser.add(&reportArg);
+    cmdParser.add(&traceArg);
+
+    cmdParser.parse();
+
+    if (!cmdParser.getLoadWorkspaceFromArg()) {
+        log::error("No workspace given, use --workspace");
+        return 1;
+    }
+    const auto workspace = cmdParser.getWorkspacePath();
+
+    try {
+        auto& network = *inviwoApp.getProcessorNetwork();
+        const auto& converter =
+            util::getModuleByTypeOrThrow<JSONModule>(&inviwoApp).getJSONPropertyConverter();
+        VideoMemory videoMemory{
+            util::getModuleByTypeOrThrow<OpenGLModule>(&inviwoApp).getOpenGLCapabilities()};
+
+        json script = json::object();
+        if (scriptArg.isSet()) {
+            std::ifstream file{std::filesystem::path{scriptArg.getValue()}};
+            if (!file) {
+                throw Exception(SourceContext{}, "Could not open benchmark script {}",
+                                scriptArg.getValue());
+            }
+            script = json::parse(file);
+        }
+
+        // The load time includes the first evaluation of the network, which is also reported on
+        // its own as the first frame time
+        const Clock loadClock{};
+        Clock::duration deserializeTime{};
+        {
+            const NetworkLock lock{&network};
+            inviwoApp.getWorkspaceManager()->load(workspace, [&](SourceContext) {
+                try {
+                    throw;
+                } catch (const IgnoreException& e) {
+                    log::exception(e, "Incomplete network loading {} due to {}", workspace,
+                                   e.getMessage());
+                }
+            });
+            deserializeTime = loadClock.getElapsedTime();
+        }
+        waitForNetwork(inviwoApp);
+        const auto loadTime = loadClock.getElapsedTime();
+        videoMemory.sample();
+
+        auto frames = parseSteps(script.value("steps", json::array()), network, converter);
+        const auto warmup = std::min(script.value("warmup", size_t{0}), frames.size());
+
+        auto& profiler = *inviwoApp.getEvaluationProfiler();
+        profiler.setEnabled(true);
+
+        std::vector<double> frameTimes;
+        frameTimes.reserve(frames.size() - warmup);
+        for (size_t i = 0; i < frames.size(); ++i) {
+            if (i == warmup) profiler.clear();
+
+            const Clock frameClock{};
+            {
+                const NetworkLock lock{&network};
+                frames[i]();
+            }
+            waitForNetwork(inviwoApp);
+            if (i >= warmup) frameTimes.push_back(frameClock.getElapsedMilliseconds());
+            videoMemory.sample();
+        }
+        profiler.setEnabled(false);
+
+        if (traceArg.isSet()) {
+            profiler.writeChromeTrace(std::filesystem::path{traceArg.getValue()});
+        }
+
+        const json report = {{"workspace", workspace.generic_string()},
+                             {"loadTime", toMs(loadTime)},
+                             {"firstFrameTime", toMs(loadTime - deserializeTime)},
+                             {"frames", frameStats(std::move(frameTimes))},
+                             {"processors", processorStats(profiler)},
+                             {"memory",
+                              {{"peakResident", peakResidentMemory()},
+                               {"video", videoMemory.report()}}}};
+
+        if (reportArg.isSet()) {
+            std::ofstream file{std::filesystem::path{reportArg.getValue()}};
+            file << report.dump(4) << '\n';
+        } else {
+            std::cout << report.dump(4) << '\n';
+        }
+    } catch (const Exception& e) {
+        log::exception(e);
+        return 1;
+    } catch (const std::exception& e) {
+        log::exception(e);
+        return 1;
+    }
+
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#include <modules/opengl/inviwoopengl.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/network/workspacemanager.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/util/localetools.h>
+#include <inviwo/core/util/utilities.h>
+#include <inviwo/core/util/consolelogger.h>
+#include <inviwo/core/util/commandlineparser.h>
+#include <inviwo/core/util/rendercontext.h>
+#include <inviwo/core/util/settings/systemsettings.h>
+#include <inviwo/core/util/filesystem.h>
+
+#include <inviwo/sys/moduleloading.h>
+
+#include <fmt/std.h>
+
+using namespace inviwo;
+
+namespace {
+
+/**
+ * Process queued work until the network and all its background jobs are done, and the GPU has
+ * caught up, so that the canvases can be read back.
+ */
+void waitForNetwork(InviwoApplication& app) {
+    app.waitForPool();
+    do {  // NOLINT
+        app.processFront();
+    } while (app.getProcessorNetwork()->runningBackgroundJobs() > 0);
+
+    RenderContext::getPtr()->activateDefaultRenderContext();
+    glFinish();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    inviwo::util::configureCodePage();
+
+    inviwo::LogCentral logger;
+    inviwo::LogCentral::init(&logger);
+    auto consoleLogger = std::make_shared<inviwo::ConsoleLogger>();
+    logger.registerLogger(consoleLogger);
+
+    InviwoApplication inviwoApp(argc, argv, "Inviwo-Headless");
+    inviwoApp.printApplicationInfo();
+    inviwoApp.setProgressCallback([&](std::string_view m) {
+        logger.log("InviwoApplication", LogLevel::Info, LogAudience::User, "", "", 0, m);
+    });
+
+    auto& cmdParser = inviwoApp.getCommandLineParser();
+
+    // Remove all window system modules, the EGL module supplies the OpenGL context
+    auto filter = [](const inviwo::ModuleContainer& m) {
+        return m.identifier() == "glfw" || m.identifier().ends_with("qt") ||
+               m.identifier().starts_with("qt");
+    };
+    inviwo::util::registerModulesFiltered(inviwoApp.getModuleManager(), filter,
+                                          inviwoApp.getSystemSettings().moduleSearchPaths_.get(),
+                                          cmdParser.getModuleSearchPaths());
+
+    TCLAP::ValueArg<std::string> snapshotArg(
+        "s", "snapshot",
+        "Specify default name of each snapshot, or empty string for processor name.", false, "",
+        "Snapshot default name: UPN=Use Processor name.");
+
+    cmdParser.add(
+        &snapshotArg,
+        [&]() {
+            waitForNetwork(inviwoApp);
+            auto path = cmdParser.getOutputPath();
+            if (path.empty()) path = inviwo::filesystem::getPath(PathType::Images);
+            util::saveAllCanvases(inviwoApp.getProcessorNetwork(), path, snapshotArg.getValue());
+        },
+        1000);
+
+    // Do this after registerModules if some arguments were added
+    cmdParser.parse();
+
+    if (!cmdParser.getLoadWorkspaceFromArg()) {
+        log::error("No workspace given, specify one with --workspace");
+        return 1;
+    }
+    const auto workspace = cmdParser.getWorkspacePath();
+
+    inviwoApp.getProcessorNetwork()->lock();
+    try {
+        inviwoApp.getWorkspaceManager()->load(workspace, [&](SourceContext) {
+            try {
+                throw;
+            } catch (const IgnoreException& e) {
+                log::exception(e, "Incomplete network loading {} due to {}", workspace,
+                               e.getMessage());
+            }
+        });
+    } catch (const AbortException& e) {
+        log::exception(e, "Unable to load network {} due to {}", workspace, e.getMessage());
+        return 1;
+    } catch (const IgnoreException& e) {
+        log::exception(e, "Incomplete network loading {} due to {}", workspace, e.getMessage(),
+                       LogLevel::Error);
+        return 1;
+    }
+    inviwoApp.getProcessorNetwork()->unlock();
+
+    waitForNetwork(inviwoApp);
+    cmdParser.processCallbacks();  // run any command line callbacks from modules.
+    waitForNetwork(inviwoApp);
+
+    return 0;
+}
@@ -157,6 +157,13 @@ struct SGCTCallbacks {
                 manager.setupInteraction(win->windowHandle());
             }
         }
+        // Each node is a separate process with its own context. Log the renderer so that the GPU
+        // of every node can be checked when running several nodes on one workstation.
+        LogInfoCustom("Dome",
+                      fmt::format("{} node renders on: {}",
+                                  sgct::Engine::instance().isMaster() ? "Master" : "Client",
+                                  reinterpret_cast<const char*>(glGetString(GL_RENDERER))));
+
         GLint maxDrawBuffers = 8;
         glGetIntegerv(GL_MAX_DRAW_BUFFERS, &maxDrawBuffers);
         drawBuffers.resize(static_cast<size_t>(maxDrawBuffers), GL_NONE);
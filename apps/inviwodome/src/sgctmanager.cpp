@@ -29,6 +29,9 @@
 
 #include <inviwo/dome/sgctmanager.h>
 
+#include <inviwo/sgct/sgctsettings.h>
+#include <inviwo/sgct/sgctutil.h>
+
 #include <inviwo/core/util/rendercontext.h>
 #include <inviwo/core/util/exception.h>
 #include <inviwo/core/util/zip.h>
@@ -190,7 +193,15 @@ void SGCTManager::evaluate(const ::sgct::RenderData& renderData) {
     {
         TRACY_ZONE_SCOPED_NC("Update cameras", 0x770000);
         const auto size = renderData.window.resolution();
-        const size2_t newSize{size.x, size.y};
+        size2_t newSize{size.x, size.y};
+        if (auto* settings = app.getSettingsByType<SGCTSettings>();
+            settings && settings->foveatedRendering) {
+            const float scale = util::foveationScale(
+                glm::make_mat4(renderData.viewMatrix.values), settings->foveationDirection.get(),
+                settings->foveationAngle.get(), settings->peripheralScale.get());
+            // The copy to the SGCT frame buffer will upscale the smaller image
+            newSize = glm::max(size2_t{1}, size2_t{vec2{newSize} * scale});
+        }
         if (auto* canvas = getCanvas(); canvas != nullptr && canvas->getCanvasSize() != newSize) {
             canvas->setCanvasSize(newSize);
         }
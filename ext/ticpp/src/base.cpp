@@ -258,16 +258,33 @@ bool TiXmlBase::StringEqual(const char* p, const char* tag, bool ignoreCase) {
 
 const char* TiXmlBase::ReadText(const char* p, std::pmr::string* text, bool trimWhiteSpace,
                                 const char* endTag, bool caseInsensitive) {
-    *text = "";
+    text->clear();
+
+    // Characters that need a closer look, everything else is copied in runs
+    const auto isSpecial = [&](char c, bool whitespace) {
+        return c == '\0' || c == '&' || c == *endTag ||
+               (caseInsensitive && ToLower(c) == ToLower(*endTag)) ||
+               (whitespace && IsWhiteSpace(c));
+    };
+    const auto appendChar = [&]() {
+        int len;
+        char cArr[4] = {0, 0, 0, 0};
+        p = GetChar(p, cArr, &len);
+        text->append(cArr, len);
+    };
+
     if (!trimWhiteSpace          // certain tags always keep whitespace
         || !condenseWhiteSpace)  // if true, whitespace is always kept
     {
         // Keep all the white space.
         while (p && *p && !StringEqual(p, endTag, caseInsensitive)) {
-            int len;
-            char cArr[4] = {0, 0, 0, 0};
-            p = GetChar(p, cArr, &len);
-            text->append(cArr, len);
+            const char* start = p;
+            while (!isSpecial(*p, false)) ++p;
+            if (p != start) {
+                text->append(start, p - start);
+            } else {
+                appendChar();
+            }
         }
     } else {
         bool whitespace = false;
@@ -275,26 +292,23 @@ const char* TiXmlBase::ReadText(const char* p, std::pmr::string* text, bool trim
         // Remove leading white space:
         p = SkipWhiteSpace(p);
         while (p && *p && !StringEqual(p, endTag, caseInsensitive)) {
-            if (*p == '\r' || *p == '\n') {
-                whitespace = true;
-                ++p;
-            } else if (IsWhiteSpace(*p)) {
+            if (IsWhiteSpace(*p)) {
                 whitespace = true;
                 ++p;
+                continue;
+            }
+            // If we've found whitespace, add it before the
+            // new character. Any whitespace just becomes a space.
+            if (whitespace) {
+                (*text) += ' ';
+                whitespace = false;
+            }
+            const char* start = p;
+            while (!isSpecial(*p, true)) ++p;
+            if (p != start) {
+                text->append(start, p - start);
             } else {
-                // If we've found whitespace, add it before the
-                // new character. Any whitespace just becomes a space.
-                if (whitespace) {
-                    (*text) += ' ';
-                    whitespace = false;
-                }
-                int len;
-                char cArr[4] = {0, 0, 0, 0};
-                p = GetChar(p, cArr, &len);
-                if (len == 1)
-                    (*text) += cArr[0];  // more efficient
-                else
-                    text->append(cArr, len);
+                appendChar();
             }
         }
     }
@@ -100,10 +100,12 @@ void TiXmlDocument::LoadFile(FILE* file) {
 
     // If we have a file, assume it is all one big XML file, and read it in.
     // The document parser may decide the document ends sooner than the entire file, however.
-    std::pmr::string data{allocator};
-    data.reserve(length);
+    std::pmr::string data(static_cast<size_t>(length), '\0', allocator);
+    if (fread(data.data(), length, 1, file) != 1) {
+        throw TiXmlError(TiXmlErrorCode::TIXML_ERROR_OPENING_FILE, nullptr, nullptr);
+    }
 
-    // Subtle bug here. TinyXml did use fgets. But from the XML spec:
+    // From the XML spec:
     // 2.11 End-of-Line Handling
     // <snip>
     // <quote>
@@ -113,67 +115,19 @@ void TiXmlDocument::LoadFile(FILE* file) {
     // a single #xA character.
     // </quote>
     //
-    // It is not clear fgets does that, and certainly isn't clear it works cross platform.
-    // Generally, you expect fgets to translate from the convention of the OS to the c/unix
-    // convention, and not work generally.
-
-    /*
-    while( fgets( buf, sizeof(buf), file ) )
-    {
-            data += buf;
-    }
-    */
-
-    char* buf = new char[length + 1];
-    buf[0] = 0;
-
-    if (fread(buf, length, 1, file) != 1) {
-        delete[] buf;
-        throw TiXmlError(TiXmlErrorCode::TIXML_ERROR_OPENING_FILE, nullptr, nullptr);
-    }
-
-    const char* lastPos = buf;
-    const char* p = buf;
-
-    buf[length] = 0;
-    while (*p) {
-        assert(p < (buf + length));
-        if (*p == 0xa) {
-            // Newline character. No special rules for this. Append all the characters
-            // since the last string, and include the newline.
-            data.append(lastPos, (p - lastPos + 1));  // append, include the newline
-            ++p;                                      // move past the newline
-            lastPos = p;                              // and point to the new buffer (may be 0)
-            assert(p <= (buf + length));
-        } else if (*p == 0xd) {
-            // Carriage return. Append what we have so far, then
-            // handle moving forward in the buffer.
-            if ((p - lastPos) > 0) {
-                data.append(lastPos, p - lastPos);  // do not add the CR
-            }
-            data += (char)0xa;  // a proper newline
-
-            if (*(p + 1) == 0xa) {
-                // Carriage return - new line sequence
-                p += 2;
-                lastPos = p;
-                assert(p <= (buf + length));
+    // Normalize in place, files without any carriage returns are left untouched.
+    if (auto first = data.find('\r'); first != std::pmr::string::npos) {
+        auto out = data.begin() + first;
+        for (auto in = out; in != data.end(); ++in) {
+            if (*in == '\r') {
+                *out++ = '\n';
+                if (in + 1 != data.end() && *(in + 1) == '\n') ++in;
             } else {
-                // it was followed by something else...that is presumably characters again.
-                ++p;
-                lastPos = p;
-                assert(p <= (buf + length));
+                *out++ = *in;
             }
-        } else {
-            ++p;
         }
+        data.erase(out, data.end());
     }
-    // Handle any left over characters.
-    if (p - lastPos) {
-        data.append(lastPos, p - lastPos);
-    }
-    delete[] buf;
-    buf = nullptr;
 
     Parse(data.c_str(), nullptr, allocator);
 }
@@ -33,10 +33,10 @@ const char* TiXmlText::Parse(const char* p, TiXmlParsingData* data, allocator_ty
         p += strlen(startTag);
 
         // Keep all the white space, ignore the encoding, etc.
-        while (p && *p && !StringEqual(p, endTag, false)) {
-            value += *p;
-            ++p;
-        }
+        const char* end = std::strstr(p, endTag);
+        if (!end) end = p + std::strlen(p);
+        value.assign(p, end - p);
+        p = end;
 
         std::pmr::string dummy{alloc};
         p = ReadText(p, &dummy, false, endTag, false);
@@ -33,6 +33,7 @@
 #include <inviwo/core/util/glmutils.h>
 #include <inviwo/core/util/glmcomp.h>
 #include <inviwo/core/util/glmmatext.h>
+#include <inviwo/core/util/parallel.h>
 
 #include <glm/common.hpp>
 
@@ -42,6 +43,9 @@
 #include <span>
 #include <tuple>
 #include <cmath>
+#include <algorithm>
+#include <functional>
+#include <limits>
 
 namespace inviwo::util {
 
@@ -134,45 +138,76 @@ std::vector<Histogram1D> calculateHistograms(std::span<const T> data, const Data
 
     constexpr size_t extent = util::rank<T>::value > 0 ? util::extent<T>::value : 1;
 
-    D min(std::numeric_limits<double>::max());
-    D max(std::numeric_limits<double>::lowest());
-    D sum(0);
-    D sum2(0);
-    size_t count(0);
-
-    std::array<size_t, extent> underflow{0};
-    std::array<size_t, extent> overflow{0};
-
     auto [numbins, effectiveRange] = detail::optimalBinCount<T>(dataMap, bins);
     const D rangeMin(dataMap.dataRange.x);
     const D rangeScaleFactor(static_cast<double>(numbins - 1) / effectiveRange);
+    const I maxBin(static_cast<ptrdiff_t>(numbins) - 1);
 
-    std::array<std::vector<size_t>, extent> hists;
-    for (size_t i = 0; i < extent; ++i) {
-        hists[i].resize(numbins, 0);
-    }
-    const ptrdiff_t maxBin = static_cast<ptrdiff_t>(numbins) - 1;
+    // The bins of each chunk, with the underflow first and the overflow last, are private to the
+    // task processing it and merged in chunk order afterwards.
+    struct Partial {
+        D min{std::numeric_limits<double>::max()};
+        D max{std::numeric_limits<double>::lowest()};
+        D sum{0};
+        D sum2{0};
+        size_t count{0};
+        std::array<std::vector<size_t>, extent> hists;
+    };
+    const auto makePartial = [&]() {
+        Partial partial;
+        for (auto& hist : partial.hists) hist.resize(numbins + 2, 0);
+        return partial;
+    };
 
-    for (const auto& item : data) {
-        const auto val = static_cast<D>(item);
+    const auto map = [&](size_t first, size_t last) {
+        auto partial = makePartial();
+        for (const auto& item : data.subspan(first, last - first)) {
+            const auto val = static_cast<D>(item);
 
-        min = glm::min(min, val);
-        max = glm::max(max, val);
-        sum += val;
-        sum2 += val * val;
-        count++;
+            partial.min = glm::min(partial.min, val);
+            partial.max = glm::max(partial.max, val);
+            partial.sum += val;
+            partial.sum2 += val * val;
 
-        const auto ind = static_cast<I>((val - rangeMin) * rangeScaleFactor);
-        for (size_t channel = 0; channel < extent; ++channel) {
-            const auto v = util::glmcomp(ind, channel);
-            if (v < 0) {
-                ++underflow[channel];
-            } else if (v > maxBin) {
-                ++overflow[channel];
-            } else {
-                ++hists[channel][v];
+            // -1 is underflow and maxBin + 1 overflow, hence the bin update is branch free
+            const auto ind = glm::clamp(static_cast<I>((val - rangeMin) * rangeScaleFactor),
+                                        I{-1}, maxBin + I{1}) +
+                             I{1};
+            for (size_t channel = 0; channel < extent; ++channel) {
+                ++partial.hists[channel][static_cast<size_t>(util::glmcomp(ind, channel))];
             }
         }
+        partial.count = last - first;
+        return partial;
+    };
+    const auto reduce = [](Partial a, const Partial& b) {
+        a.min = glm::min(a.min, b.min);
+        a.max = glm::max(a.max, b.max);
+        a.sum += b.sum;
+        a.sum2 += b.sum2;
+        a.count += b.count;
+        for (size_t channel = 0; channel < extent; ++channel) {
+            std::ranges::transform(a.hists[channel], b.hists[channel], a.hists[channel].begin(),
+                                   std::plus<>{});
+        }
+        return a;
+    };
+
+    // The chunk size only depends on the data size, which keeps the result independent of the
+    // pool size, and the number of chunks bounded to limit the memory used by the partial bins.
+    constexpr size_t minGrainSize = size_t{1} << 16;
+    constexpr size_t maxChunks = 256;
+    const auto [min, max, sum, sum2, count, fullHists] = util::parallelReduce(
+        0, data.size(), makePartial(), map, reduce,
+        {.grainSize = std::max(minGrainSize, (data.size() + maxChunks - 1) / maxChunks)});
+
+    std::array<size_t, extent> underflow{0};
+    std::array<size_t, extent> overflow{0};
+    std::array<std::vector<size_t>, extent> hists;
+    for (size_t channel = 0; channel < extent; ++channel) {
+        underflow[channel] = fullHists[channel].front();
+        overflow[channel] = fullHists[channel].back();
+        hists[channel].assign(fullHists[channel].begin() + 1, fullHists[channel].end() - 1);
     }
 
     const auto dcount = static_cast<double>(count);
@@ -209,4 +244,32 @@ std::vector<Histogram1D> calculateHistograms(std::span<const T> data, const Data
     return histograms;
 }
 
+/**
+ * Calculate approximate histograms from a strided subsample of \p data, which is a lot faster than
+ * calculateHistograms for large data. The counts and statistics are the ones of the subsample.
+ *
+ * @tparam T          underlying data type, can be a scalar or glm vector type
+ * @param data
+ * @param dataMap     provides the data range used for bin positions and size
+ * @param bins        upper limit of bins to use, see calculateHistograms
+ * @param maxSamples  upper limit of values to sample from \p data
+ * @return vector of histograms, one per channel/component in \p data, or an empty vector if \p
+ *         data does not have more than \p maxSamples values, then the exact histograms are cheap.
+ */
+template <typename T>
+std::vector<Histogram1D> calculateApproximateHistograms(std::span<const T> data,
+                                                        const DataMapper& dataMap, size_t bins,
+                                                        size_t maxSamples = size_t{1} << 20) {
+    if (data.size() <= maxSamples) return {};
+
+    // An odd stride avoids only sampling some of the columns of data with power of two dimensions
+    const size_t stride = (data.size() / maxSamples) | size_t{1};
+    std::vector<T> samples;
+    samples.reserve(data.size() / stride + 1);
+    for (size_t i = 0; i < data.size(); i += stride) {
+        samples.push_back(data[i]);
+    }
+    return calculateHistograms<T>(samples, dataMap, bins);
+}
+
 }  // namespace inviwo::util
@@ -54,9 +54,13 @@ namespace inviwo {
 
 class ProcessorNetwork;
 class ProcessorNetworkEvaluator;
+class EvaluationProfiler;
+class MemoryBudget;
+class InteractionState;
 class CommandLineParser;
 
 class ResourceManager;
+class SessionCache;
 class CameraFactory;
 class DataReaderFactory;
 class DataWriterFactory;
@@ -150,6 +154,8 @@ public:
 
     ProcessorNetwork* getProcessorNetwork();
     ProcessorNetworkEvaluator* getProcessorNetworkEvaluator();
+    EvaluationProfiler* getEvaluationProfiler();
+    MemoryBudget* getMemoryBudget();
     WorkspaceManager* getWorkspaceManager();
     PropertyPresetManager* getPropertyPresetManager();
     PortInspectorManager* getPortInspectorManager();
@@ -252,6 +258,12 @@ public:
      */
     ResourceManager* getResourceManager();
 
+    /**
+     * Returns the persistent cache of values computed from data files
+     * @see SessionCache SystemSettings::sessionCache_
+     */
+    SessionCache& getSessionCache();
+
     /** @name Factories */
     ///@{
 
@@ -409,6 +421,11 @@ public:
     FileSystemObserver* getFileSystemObserver() const;
 
     TimerThread& getTimerThread();
+    /**
+     * Shared state telling if the user is currently interacting, e.g. with a camera.
+     * @see InteractionState
+     */
+    InteractionState& getInteractionState();
     const std::string& getDisplayName() const;
     virtual void printApplicationInfo();
     void postProgress(std::string_view progress) const;
@@ -486,12 +503,16 @@ protected:
     std::unique_ptr<ModuleManager> moduleManager_;
     std::unique_ptr<ProcessorNetwork> processorNetwork_;
     std::unique_ptr<ProcessorNetworkEvaluator> processorNetworkEvaluator_;
+    std::unique_ptr<EvaluationProfiler> evaluationProfiler_;
+    std::unique_ptr<MemoryBudget> memoryBudget_;
+    std::unique_ptr<SessionCache> sessionCache_;
     std::unique_ptr<WorkspaceManager> workspaceManager_;
     std::unique_ptr<PropertyPresetManager> propertyPresetManager_;
     std::unique_ptr<PortInspectorManager> portInspectorManager_;
     std::unique_ptr<detail::InviwoApplicationCallbacks> callbacks_;
 
     std::unique_ptr<TimerThread> timerThread_;
+    std::unique_ptr<InteractionState> interactionState_;  // Uses the timer thread
     LayerRamResizer* layerRamResizer_;
     std::function<void(std::string_view message, SourceContext context)> assertionHandler_;
 
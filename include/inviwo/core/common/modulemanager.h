@@ -35,6 +35,7 @@
 #include <inviwo/core/common/inviwomodulefactoryobject.h>
 #include <inviwo/core/common/runtimemoduleregistration.h>
 #include <inviwo/core/common/modulecontainer.h>
+#include <inviwo/core/util/clock.h>
 
 #include <set>
 #include <vector>
@@ -145,6 +146,18 @@ public:
      */
     std::shared_ptr<std::function<void()>> onModulesWillUnregister(std::function<void()> callback);
 
+    /**
+     * Timings recorded while registering modules. \p load is the time spent loading the module
+     * library, zero for statically linked modules, and \p create the time spent in the module
+     * constructor. A summary of the slowest modules is logged after each registration.
+     */
+    struct ModuleTiming {
+        std::string identifier;
+        Clock::duration load{};
+        Clock::duration create{};
+    };
+    const std::vector<ModuleTiming>& getModuleTimings() const { return timings_; }
+
     static std::function<bool(std::string_view)> getEnabledFilter();
     void reloadModules();
 
@@ -156,6 +169,9 @@ private:
     bool checkDependencies(const InviwoModuleFactoryObject& obj) const;
     std::vector<std::string> deregisterDependentModules(
         const std::vector<std::string>& toDeregister);
+    ModuleTiming& timing(std::string_view identifier);
+    void logTimingReport(Clock::duration modules, Clock::duration capabilities,
+                         Clock::duration callbacks) const;
 
     InviwoApplication* app_;
 
@@ -165,6 +181,9 @@ private:
     std::vector<ModuleContainer> inviwoModules_;
 
     std::function<std::filesystem::path(const InviwoModule&)> moduleLocator_;
+
+    std::vector<ModuleTiming> timings_;
+    Clock::duration librariesTime_{};
 };
 
 template <class T>
@@ -151,6 +151,13 @@ public:
      * @return true if the bitset was modified that is \p this and \p b were different
      */
     bool set(const BitSet& b);
+    /**
+     * Replace the bitset with the contents of \p b, returns true if modified. The contents of
+     * \p b are moved into the bitset, avoiding a copy.
+     *
+     * @return true if the bitset was modified that is \p this and \p b were different
+     */
+    bool set(BitSet&& b);
 
     void add(std::span<const uint32_t> span);
     void add(const std::vector<bool>& v);
@@ -337,7 +344,8 @@ public:
     BitSet operator^(const BitSet& b) const;
 
     /**
-     * compute the union of multiple \p bitsets
+     * compute the union of multiple \p bitsets. This is considerably faster than a sequence of
+     * unions since the containers of all bitsets are merged in one pass.
      */
     static BitSet fastUnion(std::span<const BitSet*> bitsets);
 
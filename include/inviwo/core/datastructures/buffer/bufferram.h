@@ -31,6 +31,7 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/datastructures/buffer/bufferrepresentation.h>
+#include <inviwo/core/datastructures/dirtyregions.h>
 #include <inviwo/core/util/formats.h>
 #include <inviwo/core/util/formatdispatching.h>
 #include <inviwo/core/util/glmvec.h>
@@ -38,6 +39,7 @@
 #include <inviwo/core/util/stdextensions.h>
 
 #include <initializer_list>
+#include <optional>
 
 namespace inviwo {
 
@@ -78,6 +80,20 @@ public:
 
     virtual std::type_index getTypeIndex() const override final;
 
+    /**
+     * Record that the elements in the region at @p offset of size @p extent were modified. Call it
+     * after modifying the data returned by getEditableRepresentation to let the converters update
+     * only that part of the other representations. Without it everything is assumed modified.
+     */
+    void addModifiedRegion(size_t offset, size_t extent);
+
+    /**
+     * The bounding box of the regions modified after @p generation, or std::nullopt if it is not
+     * known what was modified and everything has to be updated.
+     * @see addModifiedRegion DataRepresentation::getGeneration
+     */
+    std::optional<DirtyRegions<1>::Region> getModifiedRegion(size_t generation) const;
+
     /**
      * Dispatch functionality to retrieve the actual underlaying BufferRamPrecision.
      * The dispatcher takes a generic lambda as argument. Code will be instantiated for all the
@@ -135,6 +151,9 @@ protected:
     BufferRAM(BufferUsage usage = BufferUsage::Static, BufferTarget target = BufferTarget::Data);
     BufferRAM(const BufferRAM& rhs) = default;
     BufferRAM& operator=(const BufferRAM& that) = default;
+
+private:
+    DirtyRegions<1> modified_;
 };
 
 /**
@@ -35,6 +35,7 @@
 #include <inviwo/core/datastructures/representationfactorymanager.h>
 #include <inviwo/core/datastructures/nodata.h>
 #include <inviwo/core/resourcemanager/resource.h>
+#include <inviwo/core/resourcemanager/memorybudget.h>
 
 #include <inviwo/core/util/demangle.h>
 
@@ -43,13 +44,29 @@
 #include <unordered_map>
 #include <memory>
 #include <type_traits>
+#include <algorithm>
 
 namespace inviwo {
 
+namespace util::detail {
+struct DataPrefetch;
+}  // namespace util::detail
+
 /**
  * \defgroup datastructures Datastructures
  */
 
+/**
+ * \ingroup datastructures
+ * Specialize to true for a Data type whose copies should share the valid representations of the
+ * source copy-on-write instead of cloning the last valid one. A shared representation is cloned
+ * the first time one of its holders asks for it to be modified, via getEditableRepresentation or
+ * any of the setters that modify the last valid representation. Only enable this for types where
+ * representations are never modified through a const representation pointer.
+ */
+template <typename Self>
+inline constexpr bool shareRepresentationsOnCopy = false;
+
 /**
  * \ingroup datastructures
  *
@@ -89,7 +106,9 @@ namespace inviwo {
  *
  * @note Do not use the same representation in different Data objects.
  * This can cause inconsistencies since the Data objects cannot know if
- * another one has edited the representation.
+ * another one has edited the representation. Types that opt in to shareRepresentationsOnCopy
+ * share representations between copies, but still never modify a shared one.
+ * @see shareRepresentationsOnCopy
  * @see Representation and RepresentationConverter
  */
 template <typename Self, typename Repr>
@@ -99,7 +118,7 @@ public:
     using repr = Repr;
 
     virtual Data<Self, Repr>* clone() const = 0;
-    virtual ~Data() = default;
+    virtual ~Data();
 
     /**
      * Get a representation of type T. If there already is a valid representation of type T, just
@@ -107,6 +126,8 @@ public:
      * valid. It there is no representation of type T, create it from the last valid representation.
      * If there are no representations create a default representation and from that create a
      * representation of type T.
+     * A MemoryBudget only keeps the returned representation until the end of the current network
+     * evaluation, use getRepresentationShared to hold on to it for longer.
      */
     template <typename T>
     const T* getRepresentation() const;
@@ -116,7 +137,8 @@ public:
 
     /**
      * Get an editable representation. This will invalidate all other representations.
-     * They will now have to be updated from this one before use.
+     * They will now have to be updated from this one before use. If the representation is shared
+     * with a copy of this object it is cloned first.
      * @see getRepresentation and invalidateAllOther
      */
     template <typename T>
@@ -133,6 +155,14 @@ public:
     template <typename T>
     bool hasRepresentation() const;
 
+    /**
+     * Check if a specific representation type exists and is valid, i.e. can be returned by
+     * getRepresentation without any conversion. Useful to check if a prefetch has finished.
+     * @see util::prefetch
+     */
+    template <typename T>
+    bool hasValidRepresentation() const;
+
     /**
      * Check if the Data object has any representation.
      * @return true if any representation exist, false otherwise.
@@ -174,6 +204,13 @@ public:
      */
     void invalidateAllOther(const Repr* repr);
 
+    /**
+     * A counter that is bumped each time a representation is edited. Comparing it to a previously
+     * seen value tells if the data has changed, which can be used to invalidate cached results.
+     * @see DataRepresentation::getGeneration
+     */
+    size_t getGeneration() const;
+
     void updateResource(const ResourceMeta& meta) const;
 
 protected:
@@ -193,17 +230,27 @@ protected:
     void setLastAndInvalidateOther(F&& f, T&& value) {
         std::scoped_lock lock(mutex_);
         if (lastValidRepresentation_) {
+            detach(lastValidRepresentation_);
             std::invoke(std::forward<F>(f), *lastValidRepresentation_, std::forward<T>(value));
             invalidateAllOtherInternal(lastValidRepresentation_.get());
         }
     }
 
 private:
+    friend util::detail::DataPrefetch;
+
     void copyRepresentationsTo(Data<Self, Repr>* targetData) const;
     std::shared_ptr<Repr> addRepresentationInternal(std::shared_ptr<Repr> representation) const;
+    std::shared_ptr<Repr> detach(std::shared_ptr<Repr> repr) const;
+    static bool isShared(const std::shared_ptr<Repr>& repr) { return repr->holders_ > 1; }
+    static void release(const std::shared_ptr<Repr>& repr) { --repr->holders_; }
+    void adopt(const std::shared_ptr<Repr>& repr) const;
     void invalidateAllOtherInternal(const Repr* repr);
     template <typename T, typename D>
     static std::shared_ptr<T> getReprInternal(D& data);
+    template <typename T>
+    std::shared_ptr<T> touch(std::shared_ptr<T> repr) const;
+    static bool evict(const void* owner, std::type_index type);
 
     std::shared_ptr<Repr> findRepr(std::type_index idx) const {
         if (auto it = representations_.find(idx); it != representations_.end()) {
@@ -217,6 +264,8 @@ private:
     mutable std::unordered_map<std::type_index, std::shared_ptr<Repr>> representations_;
     // A pointer to the the most recently updated representation. Makes updates and creation faster.
     mutable std::shared_ptr<Repr> lastValidRepresentation_;
+    // Bumped each time a representation is edited, see DataRepresentation::getGeneration
+    mutable size_t generation_ = 0;
 
     mutable std::optional<ResourceMeta> meta_;
 };
@@ -227,6 +276,16 @@ Data<Self, Repr>::Data(const Data<Self, Repr>& rhs)
     rhs.copyRepresentationsTo(this);
 }
 
+template <typename Self, typename Repr>
+Data<Self, Repr>::~Data() {
+    if (auto* budget = MemoryBudget::getEnabled()) {
+        budget->forget(this);
+    }
+    for (const auto& elem : representations_) {
+        release(elem.second);
+    }
+}
+
 template <typename Self, typename Repr>
 Data<Self, Repr>& Data<Self, Repr>::operator=(const Data<Self, Repr>& that) {
     if (this != &that) {
@@ -249,8 +308,9 @@ std::shared_ptr<T> Data<Self, Repr>::getReprInternal(D& data) {
     }
 
     if (auto repr = data.findRepr(requestedType); repr && repr->isValid()) {
+        data.adopt(repr);
         data.lastValidRepresentation_ = repr;
-        return std::dynamic_pointer_cast<T>(repr);
+        return data.touch(std::dynamic_pointer_cast<T>(repr));
     } else {
         auto factory = RepresentationFactoryManager::getRepresentationConverterFactory<Repr>();
 
@@ -259,20 +319,33 @@ std::shared_ptr<T> Data<Self, Repr>::getReprInternal(D& data) {
             for (auto converter : package->getConverters()) {
                 const auto dstType = converter->getConverterID().second;
                 const auto srcRepr = data.lastValidRepresentation_;
+                data.adopt(srcRepr);
+
+                const auto start = BaseRepresentationConverterFactory::conversionStart();
 
-                if (auto dstRepr = data.findRepr(dstType)) {
-                    converter->update(srcRepr, dstRepr);
+                auto dstRepr = data.findRepr(dstType);
+                if (dstRepr && isShared(dstRepr)) {
+                    // Never update a representation shared with a copy, create our own instead
+                    data.representations_.erase(dstType);
+                    release(dstRepr);
+                    dstRepr.reset();
+                }
+                if (dstRepr) {
+                    converter->update(srcRepr, dstRepr, data);
                     data.lastValidRepresentation_ = dstRepr;
                     data.lastValidRepresentation_->setValid(true);
+                    data.lastValidRepresentation_->setGeneration(data.generation_);
                 } else {  // No representation found, create it
-                    dstRepr = converter->createFrom(srcRepr);
+                    dstRepr = converter->createFrom(srcRepr, data);
                     if (!dstRepr) {
                         throw ConverterException("Converter failed to create");
                     }
                     data.lastValidRepresentation_ = data.addRepresentationInternal(dstRepr);
                 }
+                BaseRepresentationConverterFactory::conversionDone(
+                    converter->getConverterID().first, dstType, start);
             }
-            return std::dynamic_pointer_cast<T>(data.lastValidRepresentation_);
+            return data.touch(std::dynamic_pointer_cast<T>(data.lastValidRepresentation_));
         } else {
             auto buff = fmt::memory_buffer();
             for (const auto& [converterId, converter] : factory->getConverters()) {
@@ -292,6 +365,42 @@ std::shared_ptr<T> Data<Self, Repr>::getReprInternal(D& data) {
     }
 };
 
+template <typename Self, typename Repr>
+template <typename T>
+std::shared_ptr<T> Data<Self, Repr>::touch(std::shared_ptr<T> repr) const {
+    if (auto* budget = MemoryBudget::getEnabled(); budget && repr) {
+        budget->touch(static_cast<const void*>(this), *repr, &Data<Self, Repr>::evict);
+    }
+    return repr;
+}
+
+template <typename Self, typename Repr>
+bool Data<Self, Repr>::evict(const void* owner, std::type_index type) {
+    const auto& data = *static_cast<const Data<Self, Repr>*>(owner);
+    const std::unique_lock lock{data.mutex_, std::try_to_lock};
+    if (!lock) return false;
+
+    auto it = data.representations_.find(type);
+    if (it == data.representations_.end()) return true;
+
+    // Someone outside holds on to it, apart from us and maybe lastValidRepresentation_
+    const bool isLast = it->second == data.lastValidRepresentation_;
+    if (it->second.use_count() > (isLast ? 2 : 1)) return false;
+
+    if (isLast) {
+        // Evicting the last valid representation is fine as long as there is another valid one
+        auto other = std::ranges::find_if(data.representations_, [&](const auto& item) {
+            return item.second != it->second && item.second->isValid();
+        });
+        if (other == data.representations_.end()) return false;
+        data.lastValidRepresentation_ = other->second;
+    }
+
+    release(it->second);
+    data.representations_.erase(it);
+    return true;
+}
+
 template <typename Self, typename Repr>
 template <typename T>
 std::shared_ptr<const T> Data<Self, Repr>::getRepresentationShared() const {
@@ -310,9 +419,12 @@ template <typename Self, typename Repr>
 template <typename T>
 T* Data<Self, Repr>::getEditableRepresentation() {
     std::scoped_lock lock(mutex_);
-    auto repr = getReprInternal<T>(*static_cast<const Self*>(this)).get();
-    invalidateAllOtherInternal(repr);
-    return repr;
+    auto repr = getReprInternal<T>(*static_cast<const Self*>(this));
+    if (isShared(lastValidRepresentation_)) {
+        repr = std::dynamic_pointer_cast<T>(detach(lastValidRepresentation_));
+    }
+    invalidateAllOtherInternal(repr.get());
+    return repr.get();
 }
 
 template <typename Self, typename Repr>
@@ -322,6 +434,14 @@ bool Data<Self, Repr>::hasRepresentation() const {
     return util::has_key(representations_, std::type_index{typeid(T)});
 }
 
+template <typename Self, typename Repr>
+template <typename T>
+bool Data<Self, Repr>::hasValidRepresentation() const {
+    std::scoped_lock lock(mutex_);
+    const auto repr = findRepr(std::type_index{typeid(T)});
+    return repr && repr->isValid();
+}
+
 template <typename Self, typename Repr>
 void Data<Self, Repr>::invalidateAllOther(const Repr* repr) {
     std::scoped_lock lock(mutex_);
@@ -330,43 +450,98 @@ void Data<Self, Repr>::invalidateAllOther(const Repr* repr) {
 template <typename Self, typename Repr>
 void Data<Self, Repr>::invalidateAllOtherInternal(const Repr* repr) {
     bool found = false;
-    for (auto& elem : representations_) {
-        if (elem.second.get() != repr) {
-            elem.second->setValid(false);
-        } else {
+    for (auto it = representations_.begin(); it != representations_.end();) {
+        if (it->second.get() == repr) {
             found = true;
-            elem.second->setValid(true);
-            lastValidRepresentation_ = elem.second;
+            it->second->setValid(true);
+            it->second->setGeneration(generation_ + 1);
+            lastValidRepresentation_ = it->second;
+            ++it;
+        } else if (isShared(it->second)) {
+            // The other holders still rely on it being valid, drop it instead
+            release(it->second);
+            it = representations_.erase(it);
+        } else {
+            it->second->setValid(false);
+            ++it;
         }
     }
     if (!found) {
         throw Exception("Called with representation not in representations.");
     }
+    ++generation_;
 }
 
 template <typename Self, typename Repr>
 void Data<Self, Repr>::clearRepresentations() {
     std::scoped_lock lock(mutex_);
+    for (const auto& elem : representations_) {
+        release(elem.second);
+    }
     representations_.clear();
 }
 
 template <typename Self, typename Repr>
 void Data<Self, Repr>::copyRepresentationsTo(Data<Self, Repr>* target) const {
     std::scoped_lock targetLock(mutex_, target->mutex_);
+    for (const auto& elem : target->representations_) {
+        release(elem.second);
+    }
     target->representations_.clear();
 
-    if (lastValidRepresentation_) {
+    target->generation_ = generation_;
+    if (!lastValidRepresentation_) return;
+
+    if constexpr (shareRepresentationsOnCopy<Self>) {
+        for (const auto& [type, repr] : representations_) {
+            if (repr->isValid()) {
+                ++repr->holders_;
+                // A shared representation has no single owner, see DataRepresentation::getOwner
+                repr->setOwner(nullptr);
+                target->representations_[type] = repr;
+            }
+        }
+        target->lastValidRepresentation_ = lastValidRepresentation_;
+    } else {
         auto rep = std::shared_ptr<Repr>(lastValidRepresentation_->clone());
         target->lastValidRepresentation_ = target->addRepresentationInternal(rep);
     }
 }
 
+template <typename Self, typename Repr>
+void Data<Self, Repr>::adopt(const std::shared_ptr<Repr>& repr) const {
+    const auto* self = static_cast<const Self*>(this);
+    if (!isShared(repr) && repr->getOwner() != self) {
+        // The copies that shared it with us are gone, take over the ownership
+        repr->setOwner(self);
+    }
+}
+
+template <typename Self, typename Repr>
+std::shared_ptr<Repr> Data<Self, Repr>::detach(std::shared_ptr<Repr> repr) const {
+    if (!isShared(repr)) return repr;
+
+    auto copy = std::shared_ptr<Repr>(repr->clone());
+    const bool last = lastValidRepresentation_ == repr;
+    addRepresentationInternal(copy);
+    if (last) {
+        lastValidRepresentation_ = copy;
+    }
+    return copy;
+}
+
 template <typename Self, typename Repr>
 std::shared_ptr<Repr> Data<Self, Repr>::addRepresentationInternal(
     std::shared_ptr<Repr> repr) const {
     repr->setValid(true);
     repr->setOwner(static_cast<const Self*>(this));
-    representations_[repr->getTypeIndex()] = repr;
+    repr->setGeneration(generation_);
+    ++repr->holders_;
+    auto& elem = representations_[repr->getTypeIndex()];
+    if (elem) {
+        release(elem);
+    }
+    elem = repr;
     if (meta_) {
         repr->updateResource(*meta_);
     }
@@ -385,6 +560,7 @@ void Data<Self, Repr>::removeRepresentation(const Repr* representation) {
 
     for (auto& elem : representations_) {
         if (elem.second.get() == representation) {
+            release(elem.second);
             representations_.erase(elem.first);
             break;
         }
@@ -421,6 +597,11 @@ void Data<Self, Repr>::removeOtherRepresentations(const Repr* representation) {
         }
     }
     std::swap(repr, representations_);
+    for (const auto& elem : repr) {
+        if (elem.second.get() != representation) {
+            release(elem.second);
+        }
+    }
 }
 
 template <typename Self, typename Repr>
@@ -429,6 +610,12 @@ bool Data<Self, Repr>::hasRepresentations() const {
     return !representations_.empty();
 }
 
+template <typename Self, typename Repr>
+size_t Data<Self, Repr>::getGeneration() const {
+    std::scoped_lock lock(mutex_);
+    return generation_;
+}
+
 template <typename Self, typename Repr>
 void Data<Self, Repr>::updateResource(const ResourceMeta& meta) const {
     meta_ = meta;
@@ -0,0 +1,187 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/data.h>
+#include <inviwo/core/datastructures/representationconverter.h>
+#include <inviwo/core/datastructures/representationconverterfactory.h>
+#include <inviwo/core/datastructures/representationfactorymanager.h>
+#include <inviwo/core/util/demangle.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/rendercontext.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <exception>
+#include <future>
+#include <memory>
+#include <stop_token>
+#include <typeindex>
+
+namespace inviwo {
+
+namespace util {
+
+namespace detail {
+
+template <typename D>
+struct PrefetchState {
+    PrefetchState(std::shared_ptr<const D> aData, std::stop_token aStop)
+        : data{std::move(aData)}, stop{std::move(aStop)} {}
+    std::shared_ptr<const D> data;
+    std::stop_token stop;
+    std::promise<void> promise;
+};
+
+/**
+ * Implementation of util::prefetch, a friend of Data to be able to lock and update it.
+ */
+struct DataPrefetch {
+    template <typename T, typename D>
+    static void convert(std::shared_ptr<PrefetchState<D>> state,
+                        const RepresentationConverter<typename D::repr>* converter,
+                        std::shared_ptr<typename D::repr> src) {
+        try {
+            const auto start = BaseRepresentationConverterFactory::conversionStart();
+
+            auto dst = converter->createFrom(src, *state->data);
+            if (!dst) throw ConverterException("Converter failed to create");
+
+            const auto [srcType, dstType] = converter->getConverterID();
+            BaseRepresentationConverterFactory::conversionDone(srcType, dstType, start);
+
+            const auto& data = *state->data;
+            {
+                std::scoped_lock lock{data.mutex_};
+                // Only use the result if the data has not been modified or converted meanwhile,
+                // otherwise we just start over from the current last valid representation
+                const auto existing = data.findRepr(dst->getTypeIndex());
+                if (data.lastValidRepresentation_ == src && src->isValid() &&
+                    !(existing && existing->isValid())) {
+                    data.lastValidRepresentation_ =
+                        data.addRepresentationInternal(std::move(dst));
+                }
+            }
+            getThreadPool().enqueueRaw([state]() { step<T>(state); });
+        } catch (...) {
+            state->promise.set_exception(std::current_exception());
+        }
+    }
+
+    template <typename T, typename D>
+    static void step(std::shared_ptr<PrefetchState<D>> state) {
+        using Repr = typename D::repr;
+        try {
+            if (state->stop.stop_requested()) {
+                state->promise.set_value();
+                return;
+            }
+            const auto& data = *state->data;
+            const RepresentationConverter<Repr>* converter = nullptr;
+            std::shared_ptr<Repr> src;
+            {
+                std::scoped_lock lock{data.mutex_};
+                const auto requestedType = std::type_index{typeid(T)};
+                if (data.representations_.empty()) {
+                    auto factory = RepresentationFactoryManager::getRepresentationFactory<Repr>();
+                    auto repr =
+                        std::shared_ptr<Repr>{factory->createOrDefault(requestedType, &data)};
+                    if (!repr) throw Exception("Failed to create default representation");
+                    data.lastValidRepresentation_ = data.addRepresentationInternal(repr);
+                }
+                if (auto repr = data.findRepr(requestedType); repr && repr->isValid()) {
+                    state->promise.set_value();
+                    return;
+                }
+
+                auto factory =
+                    RepresentationFactoryManager::getRepresentationConverterFactory<Repr>();
+                const auto lastValidType = data.lastValidRepresentation_->getTypeIndex();
+                auto package = factory->getRepresentationConverter(lastValidType, requestedType);
+                if (!package || package->getConverters().empty()) {
+                    throw ConverterException(SourceContext{},
+                                             "Found no converters, Source {}, Destination {}",
+                                             util::demangle(lastValidType.name()),
+                                             util::demangle(requestedType.name()));
+                }
+                converter = package->getConverters().front();
+                src = data.lastValidRepresentation_;
+            }
+
+            if (converter->requiresMainThread()) {
+                dispatchFrontAndForget([state, converter, src]() {
+                    rendercontext::activateDefault();
+                    convert<T>(state, converter, src);
+                });
+            } else {
+                convert<T>(state, converter, src);
+            }
+        } catch (...) {
+            state->promise.set_exception(std::current_exception());
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * \ingroup datastructures
+ * Start creating a representation of type T of @p data in the background, for example
+ * `util::prefetch<VolumeGL>(volume)` to read a volume from disk and upload it to the GPU
+ * without stalling the evaluation.
+ *
+ * The conversion path is run one converter at a time. Converters are run on the thread pool,
+ * except those that return true from RepresentationConverter::requiresMainThread, like the OpenGL
+ * upload, which are dispatched to the main thread. The data lock is only held between the steps,
+ * so the existing representations can be used while the conversion is running. Use
+ * Data::hasValidRepresentation or the returned future to find out when the representation is
+ * ready.
+ *
+ * Each step always creates a new representation, since an existing but invalid one might be
+ * updated concurrently by getRepresentation. If the data is modified while a step is running the
+ * result of that step is discarded and the prefetch starts over from the new data.
+ *
+ * A stop requested through @p stop is checked before each step. The remaining steps are then
+ * skipped and the future becomes ready, without the representation having been created.
+ *
+ * @return a future that becomes ready when @p data has a valid representation of type T, or that
+ * holds the exception thrown by a conversion.
+ */
+template <typename T, typename D>
+std::shared_future<void> prefetch(std::shared_ptr<const D> data, std::stop_token stop = {}) {
+    auto state = std::make_shared<detail::PrefetchState<D>>(std::move(data), std::move(stop));
+    auto future = state->promise.get_future().share();
+    getThreadPool().enqueueRaw([state]() { detail::DataPrefetch::step<T>(state); });
+    return future;
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -32,6 +32,7 @@
 #include <inviwo/core/util/formats.h>
 #include <inviwo/core/util/exception.h>
 #include <typeindex>
+#include <atomic>
 
 namespace inviwo {
 
@@ -46,6 +47,9 @@ public:
  * \ingroup datastructures
  * \brief Base class for all DataRepresentations \see Data
  */
+template <typename, typename>
+class Data;
+
 template <typename Owner>
 class DataRepresentation {
 public:
@@ -57,20 +61,51 @@ public:
     virtual std::type_index getTypeIndex() const = 0;
 
     void setOwner(const Owner* owner);
+    /**
+     * The Data this representation belongs to. nullptr while the representation is shared
+     * copy-on-write by several Data objects, since it then has no single owner. Code that needs
+     * the owning Data, e.g. a converter, should get it from the caller instead.
+     * @see shareRepresentationsOnCopy
+     */
     const Owner* getOwner() const;
 
     bool isValid() const;
     void setValid(bool valid);
 
+    /**
+     * The modification of the owning Data that this representation is in sync with. The Data
+     * bumps its generation every time a representation is edited, so a converter can compare the
+     * generation of the source and the destination to find what changed in between.
+     * @see DirtyRegions
+     */
+    size_t getGeneration() const;
+    void setGeneration(size_t generation);
+
     virtual void updateResource(const ResourceMeta&) const {};
 
 protected:
     DataRepresentation() = default;
-    DataRepresentation(const DataRepresentation& rhs) = default;
-    DataRepresentation& operator=(const DataRepresentation& that) = default;
+    DataRepresentation(const DataRepresentation& rhs)
+        : isValid_{rhs.isValid_}, owner_{rhs.owner_.load()}, generation_{rhs.generation_} {}
+    DataRepresentation& operator=(const DataRepresentation& that) {
+        isValid_ = that.isValid_;
+        owner_ = that.owner_.load();
+        generation_ = that.generation_;
+        return *this;
+    }
 
     bool isValid_ = true;
-    const Owner* owner_ = nullptr;
+    // Atomic since the Data objects sharing a representation update it under different locks
+    std::atomic<const Owner*> owner_{nullptr};
+    size_t generation_ = 0;
+
+private:
+    template <typename, typename>
+    friend class Data;
+
+    // The number of Data objects holding this representation. More than one means that it is
+    // shared copy-on-write and has to be cloned before being modified. Not copied by clone.
+    std::atomic<size_t> holders_{0};
 };
 
 template <typename Owner>
@@ -93,4 +128,14 @@ void DataRepresentation<Owner>::setValid(bool valid) {
     isValid_ = valid;
 }
 
+template <typename Owner>
+size_t DataRepresentation<Owner>::getGeneration() const {
+    return generation_;
+}
+
+template <typename Owner>
+void DataRepresentation<Owner>::setGeneration(size_t generation) {
+    generation_ = generation;
+}
+
 }  // namespace inviwo
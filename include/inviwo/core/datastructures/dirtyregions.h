@@ -0,0 +1,113 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <glm/common.hpp>
+
+namespace inviwo {
+
+/**
+ * \ingroup datastructures
+ * Keeps track of the regions of a representation that were modified in each generation of its
+ * owning Data. A converter updating an out of date representation can then transfer only the union
+ * of the regions modified since the generation the destination was last in sync with, instead of
+ * everything. Only the most recent generations are remembered, and a generation without any
+ * recorded region means that the whole representation was modified.
+ * @see DataRepresentation::getGeneration
+ */
+template <size_t N>
+class DirtyRegions {
+public:
+    using Index = std::conditional_t<N == 1, size_t, glm::vec<N, size_t>>;
+
+    struct Region {
+        Index offset{0};
+        Index extent{0};
+    };
+
+    static constexpr size_t maxGenerations = 16;
+
+    /**
+     * Record that @p region was modified in @p generation. Regions of the same generation are
+     * merged into their bounding box.
+     */
+    void add(size_t generation, const Region& region) {
+        if (!regions_.empty() && regions_.back().first == generation) {
+            regions_.back().second = merge(regions_.back().second, region);
+            return;
+        }
+        if (regions_.size() == maxGenerations) {
+            regions_.erase(regions_.begin());
+        }
+        regions_.emplace_back(generation, region);
+    }
+
+    /**
+     * The bounding box of all regions modified after @p generation up to and including
+     * @p current. Returns std::nullopt if any of those generations has no recorded region, in
+     * which case everything has to be updated.
+     */
+    std::optional<Region> since(size_t generation, size_t current) const {
+        if (current <= generation) return std::nullopt;
+
+        std::optional<Region> result;
+        size_t covered = 0;
+        for (const auto& [gen, region] : regions_) {
+            if (gen > generation && gen <= current) {
+                result = result ? merge(*result, region) : region;
+                ++covered;
+            }
+        }
+        if (covered != current - generation) return std::nullopt;
+        return result;
+    }
+
+    void clear() { regions_.clear(); }
+
+private:
+    static Region merge(const Region& a, const Region& b) {
+        const Index lower = glm::min(a.offset, b.offset);
+        const Index upper = glm::max(a.offset + a.extent, b.offset + b.extent);
+        return {lower, upper - lower};
+    }
+
+    std::vector<std::pair<size_t, Region>> regions_;
+};
+
+}  // namespace inviwo
@@ -38,6 +38,7 @@
 #include <string>
 #include <string_view>
 #include <memory>
+#include <optional>
 #include <filesystem>
 
 #include <fmt/std.h>
@@ -66,6 +67,7 @@ public:
     bool hasSourceFile() const;
 
     void setLoader(DiskRepresentationLoader<Repr>* loader);
+    const DiskRepresentationLoader<Repr>* getLoader() const;
 
     std::shared_ptr<Repr> createRepresentation() const;
     void updateRepresentation(std::shared_ptr<Repr> dest) const;
@@ -102,6 +104,11 @@ void DiskRepresentation<Repr, Self>::setLoader(DiskRepresentationLoader<Repr>* l
     loader_.reset(loader);
 }
 
+template <typename Repr, typename Self>
+const DiskRepresentationLoader<Repr>* DiskRepresentation<Repr, Self>::getLoader() const {
+    return loader_.get();
+}
+
 template <typename Repr, typename Self>
 std::shared_ptr<Repr> DiskRepresentation<Repr, Self>::createRepresentation() const {
     if (!loader_) throw Exception("No loader available to create representation");
@@ -114,6 +121,16 @@ void DiskRepresentation<Repr, Self>::updateRepresentation(std::shared_ptr<Repr>
     loader_->updateRepresentation(dest, *static_cast<const Self*>(this));
 }
 
+/**
+ * Identifies the data read by a DiskRepresentationLoader, the file it is read from together with
+ * a description of which part of the file and how it is read.
+ * @see DiskRepresentationLoader::getSource SessionCache
+ */
+struct DiskSource {
+    std::filesystem::path file;
+    std::string description;
+};
+
 template <typename Repr>
 class DiskRepresentationLoader {
 public:
@@ -122,6 +139,12 @@ public:
     virtual std::shared_ptr<Repr> createRepresentation(const Repr&) const = 0;
     virtual void updateRepresentation(std::shared_ptr<Repr> dest, const Repr&) const = 0;
 
+    /**
+     * The source of the loaded data, used to identify the data across sessions. Loaders that
+     * can not describe their source return std::nullopt, which is the default.
+     */
+    virtual std::optional<DiskSource> getSource() const { return std::nullopt; }
+
     static std::filesystem::path findFile(const std::filesystem::path& path) {
         if (std::filesystem::is_regular_file(path)) {
             return path;
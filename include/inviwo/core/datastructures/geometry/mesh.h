@@ -41,9 +41,12 @@
 #include <inviwo/core/io/datawriter.h>
 #include <inviwo/core/ports/datainport.h>
 #include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/util/glmvec.h>
 
 #include <utility>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <vector>
 
 namespace inviwo {
@@ -248,6 +251,14 @@ public:
      */
     bool hasBuffer(BufferType type) const;
 
+    /**
+     * The component-wise minimum and maximum of the position buffer in data space, or nullopt if
+     * there is no position buffer or it is empty. The range is computed in parallel using the
+     * thread pool and cached until the position buffer is replaced or edited through
+     * getEditableRepresentation.
+     */
+    std::optional<std::pair<dvec3, dvec3>> getPositionRange() const;
+
     BufferBase* getBuffer(size_t idx);
 
     /**
@@ -264,6 +275,11 @@ public:
     size_t getNumberOfBuffers() const;
     size_t getNumberOfIndicies() const;
 
+    /**
+     * Set the resource meta of all vertex and index buffers.
+     */
+    void updateResource(const ResourceMeta& meta) const;
+
     /**
      * \brief Append another mesh to this mesh
      *
@@ -290,6 +306,15 @@ protected:
     BufferVector buffers_;
     IndexVector indices_;
     MeshInfo meshInfo_;
+
+private:
+    struct PositionRange {
+        std::weak_ptr<const BufferBase> buffer;
+        size_t generation;
+        std::pair<dvec3, dvec3> range;
+    };
+    mutable std::mutex positionRangeMutex_;
+    mutable std::optional<PositionRange> positionRange_;
 };
 
 inline bool operator==(const Mesh::BufferInfo& a, const Mesh::BufferInfo& b) {
@@ -33,7 +33,10 @@
 #include <inviwo/core/datastructures/histogram.h>
 #include <inviwo/core/util/dispatcher.h>
 
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <span>
 #include <vector>
 #include <mutex>
 
@@ -43,7 +46,8 @@ class IVW_CORE_API HistogramCache {
 public:
     using Callback = void(const std::vector<Histogram1D>&);
 
-    enum class Progress { Done, Calculating, NoData };
+    /// Approximate means that approximate histograms were delivered and the exact ones will follow
+    enum class Progress { Done, Approximate, Calculating, NoData };
     struct Result {
         DispatcherHandle<Callback> handle = nullptr;
         Progress progress = Progress::NoData;
@@ -59,11 +63,24 @@ public:
     Result calculateHistograms(const std::function<std::vector<Histogram1D>()>& calculate,
                                const std::function<Callback>& whenDone) const;
 
+    /**
+     * Like calculateHistograms above, but \p approximate is called first to get a quick
+     * approximation of the histograms. The approximation is passed to \p whenDone as soon as it
+     * is available, and it is followed by the exact histograms once they have been calculated.
+     * If \p approximate returns an empty vector only the exact histograms are delivered.
+     */
+    Result calculateHistograms(const std::function<std::vector<Histogram1D>()>& calculate,
+                               const std::function<std::vector<Histogram1D>()>& approximate,
+                               const std::function<Callback>& whenDone) const;
+
     void forEach(const std::function<void(const Histogram1D&, size_t)>&) const;
     void discard(const std::function<std::vector<Histogram1D>()>& calculate);
+    void discard(const std::function<std::vector<Histogram1D>()>& calculate,
+                 const std::function<std::vector<Histogram1D>()>& approximate);
 
 private:
-    enum class Status { Valid, Calculating, NotSet };
+    /// Approximate means that the histograms are approximate and the exact ones are calculating
+    enum class Status { Valid, Approximate, Calculating, NotSet };
     struct State {
         std::mutex mutex;
         std::vector<Histogram1D> histograms;
@@ -74,4 +91,22 @@ private:
     std::shared_ptr<State> state_;
 };
 
+namespace util {
+
+/**
+ * Serialize @p histograms into a compact binary form, for example to store them in the
+ * SessionCache. The DataMapper of the histograms is not included.
+ */
+IVW_CORE_API std::vector<std::byte> serializeHistograms(const std::vector<Histogram1D>& histograms);
+
+/**
+ * Deserialize histograms serialized with serializeHistograms, and set their DataMapper to
+ * @p dataMap.
+ * @return the histograms or std::nullopt if @p data is not valid.
+ */
+IVW_CORE_API std::optional<std::vector<Histogram1D>> deserializeHistograms(
+    std::span<const std::byte> data, const DataMapper& dataMap);
+
+}  // namespace util
+
 }  // namespace inviwo
@@ -31,6 +31,7 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/datastructures/image/layerrepresentation.h>
+#include <inviwo/core/datastructures/dirtyregions.h>
 #include <inviwo/core/util/formats.h>
 #include <inviwo/core/util/assertion.h>
 #include <inviwo/core/util/formatdispatching.h>
@@ -38,6 +39,7 @@
 #include <inviwo/core/resourcemanager/resource.h>
 
 #include <algorithm>
+#include <optional>
 
 #include <glm/gtx/component_wise.hpp>
 #include <span>
@@ -86,6 +88,20 @@ public:
 
     static size_t posToIndex(const size2_t& pos, const size2_t& dim);
 
+    /**
+     * Record that the pixels in the region at @p offset of size @p extent were modified. Call it
+     * after modifying the data returned by getEditableRepresentation to let the converters update
+     * only that part of the other representations. Without it everything is assumed modified.
+     */
+    void addModifiedRegion(const size2_t& offset, const size2_t& extent);
+
+    /**
+     * The bounding box of the regions modified after @p generation, or std::nullopt if it is not
+     * known what was modified and everything has to be updated.
+     * @see addModifiedRegion DataRepresentation::getGeneration
+     */
+    std::optional<DirtyRegions<2>::Region> getModifiedRegion(size_t generation) const;
+
     virtual std::type_index getTypeIndex() const override final;
 
     /**
@@ -147,6 +163,9 @@ protected:
     LayerRAM(LayerType type = LayerType::Color);
     LayerRAM(const LayerRAM& rhs) = default;
     LayerRAM& operator=(const LayerRAM& that) = default;
+
+private:
+    DirtyRegions<2> modified_;
 };
 
 /**
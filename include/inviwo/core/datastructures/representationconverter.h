@@ -70,9 +70,34 @@ public:
     using ConverterID = std::pair<std::type_index, std::type_index>;
     virtual ConverterID getConverterID() const = 0;
 
+    using Owner = typename BaseRepr::ReprOwner;
+
     virtual std::shared_ptr<BaseRepr> createFrom(std::shared_ptr<const BaseRepr> source) const = 0;
     virtual void update(std::shared_ptr<const BaseRepr> source,
                         std::shared_ptr<BaseRepr> destination) const = 0;
+
+    /**
+     * Create or update a representation of @p owner, the Data being converted. This is what Data
+     * calls. Converters that need something kept in the Data rather than in the representation,
+     * e.g. the data range of a Volume, should use @p owner, since a representation shared
+     * copy-on-write has no owner of its own. The default ignores @p owner.
+     * @see DataRepresentation::getOwner
+     */
+    virtual std::shared_ptr<BaseRepr> createFrom(std::shared_ptr<const BaseRepr> source,
+                                                 const Owner&) const {
+        return createFrom(std::move(source));
+    }
+    virtual void update(std::shared_ptr<const BaseRepr> source,
+                        std::shared_ptr<BaseRepr> destination, const Owner&) const {
+        update(std::move(source), std::move(destination));
+    }
+
+    /**
+     * Converters that need a render context, or other resources only available on the main
+     * thread, should return true. Such converters are always run on the main thread by
+     * util::prefetch. Other converters may be run on the thread pool.
+     */
+    virtual bool requiresMainThread() const { return false; }
 };
 
 /**
@@ -83,6 +108,7 @@ template <typename BaseRepr, typename From, typename To>
 class RepresentationConverterType : public RepresentationConverter<BaseRepr> {
 public:
     using ConverterID = typename RepresentationConverter<BaseRepr>::ConverterID;
+    using Owner = typename RepresentationConverter<BaseRepr>::Owner;
     virtual ConverterID getConverterID() const override;
 
     virtual std::shared_ptr<BaseRepr> createFrom(
@@ -96,9 +122,33 @@ public:
                std::static_pointer_cast<To>(destination));
     };
 
+    virtual std::shared_ptr<BaseRepr> createFrom(std::shared_ptr<const BaseRepr> source,
+                                                 const Owner& owner) const override final {
+        return createFrom(std::static_pointer_cast<const From>(source), owner);
+    }
+
+    virtual void update(std::shared_ptr<const BaseRepr> source,
+                        std::shared_ptr<BaseRepr> destination,
+                        const Owner& owner) const override final {
+        update(std::static_pointer_cast<const From>(source),
+               std::static_pointer_cast<To>(destination), owner);
+    };
+
     virtual std::shared_ptr<To> createFrom(std::shared_ptr<const From> source) const = 0;
     virtual void update(std::shared_ptr<const From> source,
                         std::shared_ptr<To> destination) const = 0;
+
+    /**
+     * Override to use the Data being converted, see RepresentationConverter::createFrom
+     */
+    virtual std::shared_ptr<To> createFrom(std::shared_ptr<const From> source,
+                                           const Owner&) const {
+        return createFrom(std::move(source));
+    }
+    virtual void update(std::shared_ptr<const From> source, std::shared_ptr<To> destination,
+                        const Owner&) const {
+        update(std::move(source), std::move(destination));
+    }
 };
 
 /**
@@ -35,11 +35,15 @@
 
 #include <warn/push>
 #include <warn/ignore/all>
+#include <atomic>
+#include <chrono>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <ranges>
 #include <typeindex>
-#include <unordered_set>
 #include <unordered_map>
+#include <vector>
 #include <warn/pop>
 
 namespace inviwo {
@@ -51,13 +55,34 @@ namespace inviwo {
 class IVW_CORE_API BaseRepresentationConverterFactory {
 public:
     using BaseReprId = std::type_index;
+    using ConversionTime = std::chrono::high_resolution_clock::time_point;
     BaseRepresentationConverterFactory() = default;
     virtual ~BaseRepresentationConverterFactory() = default;
     virtual BaseReprId getBaseReprId() = 0;
+
+    /**
+     * Start timing a conversion for the EvaluationProfiler.
+     * @return the current time if a profiler is enabled, otherwise an empty time point
+     */
+    static ConversionTime conversionStart();
+    /**
+     * Report a conversion from @p source to @p destination that started at @p start, as returned
+     * by conversionStart, to the enabled EvaluationProfiler. Does nothing for an empty @p start.
+     */
+    static void conversionDone(std::type_index source, std::type_index destination,
+                               ConversionTime start);
 };
 
 /**
  * Factory for RepresentationConverters
+ *
+ * The shortest converter path between every pair of representations is precomputed into an
+ * immutable table when the table is first needed after a converter was registered or removed.
+ * Lookups read the current table through an atomic pointer without taking any lock, so they can
+ * be done from any thread, e.g. when converting many small buffers on the thread pool. Replaced
+ * tables are kept alive until the factory is destroyed since a returned package may still be in
+ * use, registration only happens when modules are loaded so that is only a few tables.
+ *
  * @see RepresentationConverter
  * @see DataRepresentation
  * @see InviwoApplication::getRepresentationConverterFactory()
@@ -69,9 +94,7 @@ class RepresentationConverterFactory : public BaseRepresentationConverterFactory
 public:
     using ConverterID = typename RepresentationConverter<BaseRepr>::ConverterID;
     using RepMap = std::unordered_map<ConverterID, RepresentationConverter<BaseRepr>*>;
-    using PackageMap =
-        std::unordered_multimap<ConverterID,
-                                std::unique_ptr<RepresentationConverterPackage<BaseRepr>>>;
+    using PackageMap = std::unordered_map<ConverterID, RepresentationConverterPackage<BaseRepr>>;
     RepresentationConverterFactory() = default;
     virtual ~RepresentationConverterFactory() = default;
 
@@ -89,14 +112,17 @@ public:
                                                                                std::type_index to);
 
 private:
-    const RepresentationConverterPackage<BaseRepr>* createConverterPackage(ConverterID id);
+    const PackageMap* getPackages();
+    PackageMap createConverterPackages() const;
 
     // converters are owned by the Module
     RepMap converters_;
 
-    // All the converter packages created locally;
+    // The current table of packages, nullptr if it needs to be recomputed
+    std::atomic<const PackageMap*> packages_{nullptr};
+    // All tables created, guarded by mutex_
     std::mutex mutex_;
-    PackageMap packages_;
+    std::vector<std::unique_ptr<const PackageMap>> tables_;
 };
 
 template <typename BaseRepr>
@@ -112,47 +138,33 @@ auto RepresentationConverterFactory<BaseRepr>::getConverters() const -> const Re
 template <typename BaseRepr>
 bool RepresentationConverterFactory<BaseRepr>::registerObject(
     RepresentationConverter<BaseRepr>* converter) {
+    std::scoped_lock lock{mutex_};
     if (!util::insert_unique(converters_, converter->getConverterID(), converter))
         throw(ConverterException("Converter with supplied ID already registered"));
 
+    packages_.store(nullptr, std::memory_order_release);
     return true;
 }
 
 template <typename BaseRepr>
 bool RepresentationConverterFactory<BaseRepr>::unRegisterObject(
     RepresentationConverter<BaseRepr>* converter) {
+    std::scoped_lock lock{mutex_};
     size_t removed = std::erase_if(
         converters_, [converter](const auto& elem) { return elem.second == converter; });
 
-    std::erase_if(packages_, [converter](const auto& elem) {
-        for (auto& conv : elem.second->getConverters()) {
-            if (conv == converter) return true;
-        }
-        return false;
-    });
-
+    packages_.store(nullptr, std::memory_order_release);
     return removed > 0;
 }
 
 template <typename BaseRepr>
 const RepresentationConverterPackage<BaseRepr>*
 RepresentationConverterFactory<BaseRepr>::getRepresentationConverter(ConverterID id) {
-    RepresentationConverterPackage<BaseRepr>* res = nullptr;
-    constexpr size_t steps = std::numeric_limits<size_t>::max();
-    {
-        std::unique_lock<std::mutex> lock(mutex_);
-        auto range = packages_.equal_range(id);
-        for (auto it = range.first; it != range.second; ++it) {
-            if (it->second->steps() < steps) {
-                res = it->second.get();
-            }
-        }
-    }
-    if (res) {
-        return res;
-    } else {
-        return createConverterPackage(id);
+    const auto* packages = getPackages();
+    if (auto it = packages->find(id); it != packages->end()) {
+        return &it->second;
     }
+    return nullptr;
 }
 
 template <typename BaseRepr>
@@ -163,81 +175,65 @@ RepresentationConverterFactory<BaseRepr>::getRepresentationConverter(std::type_i
 }
 
 template <typename BaseRepr>
-const RepresentationConverterPackage<BaseRepr>*
-RepresentationConverterFactory<BaseRepr>::createConverterPackage(ConverterID id) {
-    /* Implementation of Dijkstra's algorithm following
-     * https://en.wikipedia.org/wiki/Dijkstra's_algorithm#Pseudocode
-     */
-    std::type_index source = id.first;
-    std::type_index target = id.second;
-
-    std::unordered_set<std::type_index> verts;
-    for (auto& converter : converters_) {
-        verts.insert(converter.first.first);
-        verts.insert(converter.first.second);
+auto RepresentationConverterFactory<BaseRepr>::getPackages() -> const PackageMap* {
+    if (const auto* packages = packages_.load(std::memory_order_acquire)) {
+        return packages;
     }
 
-    std::unordered_map<std::type_index, size_t> dist;
-    std::unordered_map<std::type_index, std::type_index> prev;
-
-    dist[source] = 0;
-
-    std::unordered_set<std::type_index> Q;
-    for (const auto& v : verts) {
-        if (v != source) {
-            dist[v] = std::numeric_limits<size_t>::max();
-        }
-        Q.insert(v);
+    std::scoped_lock lock{mutex_};
+    if (const auto* packages = packages_.load(std::memory_order_acquire)) {
+        return packages;
     }
+    tables_.push_back(std::make_unique<const PackageMap>(createConverterPackages()));
+    const auto* packages = tables_.back().get();
+    packages_.store(packages, std::memory_order_release);
+    return packages;
+}
 
-    while (!Q.empty()) {
-        std::size_t steps = std::numeric_limits<size_t>::max();
-        std::type_index u = *Q.begin();
-        for (const auto& t : Q) {
-            if (dist[t] < steps) {
-                steps = dist[t];
-                u = t;
-            }
-        }
-        Q.erase(u);
-
-        if (u == target) break;
+template <typename BaseRepr>
+auto RepresentationConverterFactory<BaseRepr>::createConverterPackages() const -> PackageMap {
+    // All converters have the same cost, hence a breadth first search from each representation
+    // gives the shortest paths.
+    std::unordered_map<std::type_index, std::vector<const RepresentationConverter<BaseRepr>*>>
+        edges;
+    for (const auto& [id, converter] : converters_) {
+        edges[id.first].push_back(converter);
+        edges.try_emplace(id.second);
+    }
 
-        for (const auto& converter : converters_) {
-            if (converter.first.first == u) {
-                auto v = converter.first.second;
-                size_t alt = dist[u] + 1;
-                if (alt < dist[v]) {
-                    dist[v] = alt;
-                    prev.emplace(std::make_pair(v, u));
+    PackageMap packages;
+    std::unordered_map<std::type_index, const RepresentationConverter<BaseRepr>*> prev;
+    std::deque<std::type_index> queue;
+    for (const auto& item : edges) {
+        const auto source = item.first;
+        prev.clear();
+        queue.clear();
+        queue.push_back(source);
+        while (!queue.empty()) {
+            const auto u = queue.front();
+            queue.pop_front();
+            for (const auto* converter : edges[u]) {
+                const auto v = converter->getConverterID().second;
+                if (v != source && prev.try_emplace(v, converter).second) {
+                    queue.push_back(v);
                 }
             }
         }
-    }
-
-    std::vector<const RepresentationConverter<BaseRepr>*> S;
-    std::type_index u = target;
-    while (util::has_key(prev, u)) {
-        auto conv = converters_[ConverterID(prev.at(u), u)];
-        S.push_back(conv);
-        u = prev.at(u);
-    }
 
-    if (!S.empty() && S.back()->getConverterID().first == source &&
-        S.front()->getConverterID().second == target) {
-        auto package = std::make_unique<RepresentationConverterPackage<BaseRepr>>();
-        for (auto it = S.crbegin(); it != S.crend(); it++) {
-            package->addConverter(*it);
-        }
-        auto res = package.get();
-        {
-            std::unique_lock<std::mutex> lock(mutex_);
-            packages_.emplace(std::make_pair(package->getConverterID(), std::move(package)));
+        for (const auto& target : prev | std::views::keys) {
+            std::vector<const RepresentationConverter<BaseRepr>*> path;
+            for (auto u = target; u != source;) {
+                const auto* converter = prev.at(u);
+                path.push_back(converter);
+                u = converter->getConverterID().first;
+            }
+            auto& package = packages[ConverterID(source, target)];
+            for (const auto* converter : std::views::reverse(path)) {
+                package.addConverter(converter);
+            }
         }
-        return res;
-    } else {
-        return nullptr;
     }
+    return packages;
 }
 
 }  // namespace inviwo
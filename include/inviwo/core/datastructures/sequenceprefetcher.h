@@ -0,0 +1,149 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/dataprefetch.h>
+#include <inviwo/core/datastructures/datasequence.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * \ingroup datastructures
+ * Prefetches representations of type Repr of the elements following the current one in a
+ * DataSequence, for example the VolumeRAM of the next few time steps of a volume sequence, to
+ * make playback run at disk speed instead of stalling on each step.
+ *
+ * Call update() every time the current element changes. The direction of playback is taken from
+ * the last step, and the window of elements ahead of the current one wraps around at the ends of
+ * the sequence, like looping playback does. At most `count` prefetches are kept track of. When
+ * the direction changes or the sequence is replaced all outstanding prefetches are stopped,
+ * conversions that have not yet started are then skipped.
+ *
+ * The prefetched representations are owned by the elements, hence memory is only reclaimed by
+ * the MemoryBudget, if enabled, once they have been used.
+ * @see util::prefetch
+ */
+template <typename T, typename Repr>
+class SequencePrefetcher {
+public:
+    SequencePrefetcher() = default;
+    SequencePrefetcher(const SequencePrefetcher&) = delete;
+    SequencePrefetcher& operator=(const SequencePrefetcher&) = delete;
+    ~SequencePrefetcher() { cancel(); }
+
+    /**
+     * Prefetch the @p count elements after @p index in @p sequence, in the current direction.
+     */
+    void update(std::shared_ptr<const DataSequence<T>> sequence, size_t index, size_t count);
+
+    /**
+     * Stop all outstanding prefetches and forget the playback direction.
+     */
+    void cancel();
+
+private:
+    std::shared_ptr<const DataSequence<T>> sequence_;
+    std::optional<size_t> last_;
+    bool forward_ = true;
+    std::stop_source stop_;
+    std::vector<std::pair<size_t, std::shared_future<void>>> pending_;
+};
+
+template <typename T, typename Repr>
+void SequencePrefetcher<T, Repr>::update(std::shared_ptr<const DataSequence<T>> sequence,
+                                         size_t index, size_t count) {
+    if (sequence != sequence_) {
+        cancel();
+        sequence_ = std::move(sequence);
+    }
+    if (!sequence_ || sequence_->empty()) return;
+
+    const auto size = sequence_->size();
+    index = std::min(index, size - 1);
+
+    if (last_ && *last_ != index) {
+        bool forward = index > *last_;
+        // Stepping from the last to the first element, or the reverse, is a wrap around
+        if (*last_ == size - 1 && index == 0) {
+            forward = true;
+        } else if (*last_ == 0 && index == size - 1) {
+            forward = false;
+        }
+        if (forward != forward_) {
+            stop_.request_stop();
+            stop_ = std::stop_source{};
+            pending_.clear();
+            forward_ = forward;
+        }
+    }
+    last_ = index;
+
+    count = std::min(count, size - 1);
+    std::vector<size_t> window;
+    for (size_t i = 1; i <= count; ++i) {
+        window.push_back(forward_ ? (index + i) % size : (index + size - i) % size);
+    }
+
+    std::erase_if(pending_, [&](const auto& item) {
+        return std::ranges::find(window, item.first) == window.end() ||
+               item.second.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    });
+
+    for (const auto i : window) {
+        if (std::ranges::any_of(pending_, [&](const auto& item) { return item.first == i; })) {
+            continue;
+        }
+        auto element = (*sequence_)[i];
+        if (!element || element->template hasValidRepresentation<Repr>()) continue;
+        pending_.emplace_back(i, util::prefetch<Repr>(std::move(element), stop_.get_token()));
+    }
+}
+
+template <typename T, typename Repr>
+void SequencePrefetcher<T, Repr>::cancel() {
+    stop_.request_stop();
+    stop_ = std::stop_source{};
+    pending_.clear();
+    last_.reset();
+    forward_ = true;
+}
+
+}  // namespace inviwo
@@ -37,11 +37,29 @@
 
 #include <inviwo/core/util/glmvec.h>
 
+#include <cstdint>
+#include <memory>
+
 namespace inviwo {
 
+/**
+ * \brief A baked lookup table of a TransferFunction, usable both on the CPU and the GPU.
+ *
+ * Tables are shared by content: all lookup tables baked from transfer functions with the same
+ * primitives, type, mask, and size refer to the same Layer, and hence to the same texture. When
+ * the transfer function is edited and the table is not shared, only the texels that changed are
+ * written and marked as modified, so that the GPU representation can do a partial upload.
+ *
+ * With Type::PreIntegrated a size x size table is baked instead, where texel (sf, sb) holds the
+ * color and opacity of a ray segment going from the scalar value sf to sb, in units of one
+ * reference sampling step. The integral is approximated by ignoring self attenuation within the
+ * segment, the diagonal equals the regular lookup table.
+ */
 class IVW_CORE_API TFLookupTable {
 public:
-    explicit TFLookupTable(size_t size = 1024);
+    enum class Type : std::uint8_t { Regular, PreIntegrated };
+
+    explicit TFLookupTable(size_t size = 1024, Type type = Type::Regular);
     TFLookupTable(const TFLookupTable&) = delete;
     TFLookupTable(TFLookupTable&&) noexcept = default;
     TFLookupTable& operator=(const TFLookupTable&) = delete;
@@ -50,9 +68,16 @@ public:
 
     void setSize(size_t size);
     size_t getSize() const;
+    Type getType() const;
 
     void calculate(const TransferFunction& tf);
 
+    /**
+     * The layer holding the baked table, possibly shared with other lookup tables of the same
+     * content. Will be null until calculate has been called.
+     */
+    std::shared_ptr<const Layer> getLayer() const;
+
     template <typename T>
     const T* getRepresentation() const {
         return data_->getRepresentation<T>();
@@ -60,8 +85,9 @@ public:
 
 private:
     size_t size_;
-    std::shared_ptr<LayerRAMPrecision<vec4>> repr_;
-    std::unique_ptr<Layer> data_;
+    Type type_;
+    size_t key_;
+    std::shared_ptr<Layer> data_;
 };
 
 }  // namespace inviwo
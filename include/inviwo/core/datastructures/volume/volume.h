@@ -51,6 +51,14 @@
 namespace inviwo {
 
 class Camera;
+class Volume;
+
+/**
+ * Copies of a Volume share their representations until one of them is modified, so cloning an
+ * input volume to only change its metadata, basis or data map is cheap.
+ */
+template <>
+inline constexpr bool shareRepresentationsOnCopy<Volume> = true;
 
 /**
  * \ingroup datastructures
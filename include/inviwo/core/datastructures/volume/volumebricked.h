@@ -0,0 +1,130 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+class VolumeRAM;
+
+/**
+ * \ingroup datastructures
+ * \brief A multi-resolution bricked representation of a Volume, stored out-of-core on disk.
+ *
+ * The volume is split into a hierarchy of levels, where level 0 has the full resolution and
+ * each following level halves the resolution until a single brick covers the whole volume. Each
+ * level is split into bricks of getBrickSize() voxels per side which are stored with an apron of
+ * VolumeBricked::apron voxels, replicating the neighboring voxels, to allow for seamless
+ * interpolation across brick boundaries. The bricks are written to a temporary file which is
+ * memory mapped, hence only the bricks accessed with getBrick() will occupy memory.
+ *
+ * Brick indices are global, i.e. the bricks of level `l` start at `getLevels()[l].firstBrick`
+ * and are ordered with x fastest, then y and z within each level.
+ *
+ * The bricks are immutable, copies of the representation share the same brick storage.
+ */
+class IVW_CORE_API VolumeBricked : public VolumeRepresentation {
+public:
+    struct Level {
+        size3_t dimensions;  //!< Number of voxels of the level along each axis
+        size3_t bricks;      //!< Number of bricks of the level along each axis
+        size_t firstBrick;   //!< Global index of the first brick of the level
+    };
+
+    static constexpr size_t defaultBrickSize = 32;
+    static constexpr size_t apron = 1;
+
+    /**
+     * Create the brick hierarchy from @p volume.
+     * @throws Exception if the brick file could not be written
+     */
+    explicit VolumeBricked(const VolumeRAM& volume, size_t brickSize = defaultBrickSize);
+    VolumeBricked(const VolumeBricked& rhs) = default;
+    VolumeBricked& operator=(const VolumeBricked& that) = default;
+    virtual VolumeBricked* clone() const override;
+    virtual ~VolumeBricked() = default;
+
+    virtual std::type_index getTypeIndex() const override final;
+
+    virtual const DataFormatBase* getDataFormat() const override;
+
+    virtual void setDimensions(size3_t dimensions) override;
+    virtual const size3_t& getDimensions() const override;
+
+    virtual void setSwizzleMask(const SwizzleMask& mask) override;
+    virtual SwizzleMask getSwizzleMask() const override;
+
+    virtual void setInterpolation(InterpolationType interpolation) override;
+    virtual InterpolationType getInterpolation() const override;
+
+    virtual void setWrapping(const Wrapping3D& wrapping) override;
+    virtual Wrapping3D getWrapping() const override;
+
+    /**
+     * The number of voxels per side of a brick, excluding the apron
+     */
+    size_t getBrickSize() const;
+    /**
+     * The dimensions of a stored brick, including the apron
+     */
+    size3_t getStoredBrickDimensions() const;
+    size_t getStoredBrickSizeInBytes() const;
+
+    const std::vector<Level>& getLevels() const;
+    size_t getNumberOfBricks() const;
+    size_t getBrickIndex(size_t level, size3_t brick) const;
+
+    /**
+     * The stored voxels of brick @p index, including the apron, ordered with x fastest.
+     */
+    std::span<const std::byte> getBrick(size_t index) const;
+
+private:
+    class Storage;
+
+    const DataFormatBase* dataFormatBase_;
+    size3_t dimensions_;
+    SwizzleMask swizzleMask_;
+    InterpolationType interpolation_;
+    Wrapping3D wrapping_;
+    size_t brickSize_;
+    std::vector<Level> levels_;
+    std::shared_ptr<const Storage> storage_;
+};
+
+}  // namespace inviwo
@@ -32,13 +32,16 @@
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>
 #include <inviwo/core/datastructures/histogram.h>
+#include <inviwo/core/datastructures/dirtyregions.h>
 #include <inviwo/core/util/glmvec.h>
 #include <inviwo/core/util/formats.h>
 #include <inviwo/core/util/formatdispatching.h>
 #include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/ramdata.h>
 #include <inviwo/core/resourcemanager/resource.h>
 
 #include <glm/gtx/component_wise.hpp>
+#include <optional>
 #include <span>
 
 namespace inviwo {
@@ -90,6 +93,20 @@ public:
 
     virtual size_t getNumberOfBytes() const = 0;
 
+    /**
+     * Record that the voxels in the region at @p offset of size @p extent were modified. Call it
+     * after modifying the data returned by getEditableRepresentation to let the converters update
+     * only that part of the other representations. Without it everything is assumed modified.
+     */
+    void addModifiedRegion(const size3_t& offset, const size3_t& extent);
+
+    /**
+     * The bounding box of the regions modified after @p generation, or std::nullopt if it is not
+     * known what was modified and everything has to be updated.
+     * @see addModifiedRegion DataRepresentation::getGeneration
+     */
+    std::optional<DirtyRegions<3>::Region> getModifiedRegion(size_t generation) const;
+
     template <typename T>
     static T posToIndex(const glm::tvec3<T, glm::defaultp>& pos,
                         const glm::tvec3<T, glm::defaultp>& dim);
@@ -160,6 +177,9 @@ protected:
     VolumeRAM(VolumeRAM& rhs) = default;
     VolumeRAM& operator=(const VolumeRAM& that) = default;
     VolumeRAM& operator=(VolumeRAM&& that) = default;
+
+private:
+    DirtyRegions<3> modified_;
 };
 
 class Volume;
@@ -300,7 +320,7 @@ VolumeRAMPrecision<T>::VolumeRAMPrecision(size3_t dimensions, const SwizzleMask&
     : VolumeRAM{}
     , dimensions_{dimensions}
     , ownsDataPtr_{true}
-    , data_{std::make_unique<T[]>(glm::compMul(dimensions_))}
+    , data_{util::makeRAMData<T>(glm::compMul(dimensions_))}
     , swizzleMask_{swizzleMask}
     , interpolation_{interpolation}
     , wrapping_{wrapping} {
@@ -323,7 +343,7 @@ VolumeRAMPrecision<T>::VolumeRAMPrecision(T* data, size3_t dimensions,
     , interpolation_{interpolation}
     , wrapping_{wrapping} {
     if (!data_) {
-        data_ = std::make_unique<T[]>(glm::compMul(dimensions_));
+        data_ = util::makeRAMData<T>(glm::compMul(dimensions_));
     }
     resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0},
                                                    .format = DataFormat<T>::id(),
@@ -347,13 +367,11 @@ VolumeRAMPrecision<T>::VolumeRAMPrecision(const VolumeRAMPrecision<T>& rhs)
     : VolumeRAM{rhs}
     , dimensions_{rhs.dimensions_}
     , ownsDataPtr_{true}
-    , data_{std::make_unique<T[]>(glm::compMul(dimensions_))}
+    , data_{util::makeRAMData(rhs.getView())}
     , swizzleMask_{rhs.swizzleMask_}
     , interpolation_{rhs.interpolation_}
     , wrapping_{rhs.wrapping_} {
 
-    std::copy(rhs.getView().begin(), rhs.getView().end(), data_.get());
-
     resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0},
                                                    .format = DataFormat<T>::id(),
                                                    .desc = "VolumeRAM"});
@@ -364,8 +382,7 @@ VolumeRAMPrecision<T>& VolumeRAMPrecision<T>::operator=(const VolumeRAMPrecision
     if (this != &that) {
         VolumeRAM::operator=(that);
         auto dim = that.dimensions_;
-        auto data = std::make_unique<T[]>(dim.x * dim.y * dim.z);
-        std::copy(that.getView().begin(), that.getView().end(), data.get());
+        auto data = util::makeRAMData(that.getView());
         data_.swap(data);
         std::swap(dim, dimensions_);
         ownsDataPtr_ = true;
@@ -474,7 +491,7 @@ size_t VolumeRAMPrecision<T>::getNumberOfBytes() const {
 template <typename T>
 void VolumeRAMPrecision<T>::setDimensions(size3_t dimensions) {
     if (dimensions_ != dimensions) {
-        auto data = std::make_unique<T[]>(dimensions.x * dimensions.y * dimensions.z);
+        auto data = util::makeRAMData<T>(dimensions.x * dimensions.y * dimensions.z);
         data_.swap(data);
         dimensions_ = dimensions;
 
@@ -0,0 +1,97 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/dispatcher.h>
+#include <inviwo/core/util/timer.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace inviwo {
+
+/**
+ * \ingroup interaction
+ * Keeps track of whether the user is currently interacting with the network, i.e. moving a camera
+ * or editing a transfer function. Interaction handlers call touch() for every event they consume,
+ * and the state is considered interactive until no event has been seen for the idle delay.
+ *
+ * Processors can use this to render at a lower quality while interacting and refine the result
+ * once the interaction is over, see for example ProgressiveRefinementProperty in the basegl
+ * module. All callbacks are invoked on the front thread.
+ *
+ * @see InviwoApplication::getInteractionState
+ */
+class IVW_CORE_API InteractionState {
+public:
+    using Milliseconds = std::chrono::milliseconds;
+    static constexpr Milliseconds defaultIdleDelay{200};
+
+    explicit InteractionState(TimerThread& thread, Milliseconds idleDelay = defaultIdleDelay);
+    InteractionState(const InteractionState&) = delete;
+    InteractionState& operator=(const InteractionState&) = delete;
+    ~InteractionState();
+
+    /**
+     * Report an interaction, sets the state to interactive and restarts the idle delay.
+     */
+    void touch();
+    bool isInteracting() const;
+
+    void setIdleDelay(Milliseconds delay);
+    Milliseconds getIdleDelay() const;
+
+    /**
+     * Register a callback that is invoked with the new state every time it changes.
+     * The callback is removed when the returned handle is destroyed.
+     */
+    DispatcherHandle<void(bool)> onChange(std::function<void(bool)> callback);
+
+private:
+    void setInteracting(bool interacting);
+
+    bool interacting_;
+    Delay idle_;
+    Dispatcher<void(bool)> onChange_;
+};
+
+namespace util {
+
+/**
+ * Report an interaction to the InteractionState of the application, if there is one.
+ * @see InteractionState::touch
+ */
+IVW_CORE_API void touchInteractionState();
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -34,6 +34,10 @@
 #include <inviwo/core/util/callback.h>
 #include <inviwo/core/interaction/pickingaction.h>
 
+#include <set>
+#include <unordered_set>
+#include <utility>
+
 namespace inviwo {
 
 class PickingEvent;
@@ -77,12 +81,16 @@ public:
     bool isPickingActionRegistered(const PickingAction* action) const;
 
 private:
+    void popPickingAction();
+
     // start indexing at 1, 0 maps to black {0,0,0} and indicated no picking.
     size_t lastIndex_ = 1;
     // pickingObjects_ should be sorted on the start index.
     std::vector<std::unique_ptr<PickingAction>> pickingActions_;
-    // unusedObjects_ should be sorted on capacity.
-    std::vector<PickingAction*> unusedObjects_;
+    // all actions in pickingActions_, used or not, for constant time lookup
+    std::unordered_set<const PickingAction*> registered_;
+    // free list of unused actions ordered on capacity, for logarithmic best fit allocation
+    std::set<std::pair<size_t, const PickingAction*>> unusedObjects_;
 
     bool enabled_ = false;
     const BaseCallBack* enableCallback_ = nullptr;
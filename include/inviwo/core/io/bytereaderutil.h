@@ -31,6 +31,7 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/io/inviwofileformattypes.h>
+#include <inviwo/core/util/glmvec.h>
 
 #include <string_view>
 #include <filesystem>
@@ -46,4 +47,13 @@ void readBytesIntoBuffer(const std::filesystem::path& path, size_t offset, size_
 IVW_CORE_API void readCompressedBytesIntoBuffer(const std::filesystem::path& path, size_t offset,
                                                 size_t bytes, ByteOrder byteOrder,
                                                 size_t elementSize, void* dest);
+
+/**
+ * Read the region [@p regionOffset, @p regionOffset + @p regionDims) of an uncompressed raw
+ * volume of size @p dims stored at @p offset in the file. Only the rows of the region are read,
+ * and consecutive rows are merged into a single read when the region spans the whole x extent.
+ */
+IVW_CORE_API void readRegionIntoBuffer(const std::filesystem::path& path, size_t offset,
+                                       size3_t dims, size3_t regionOffset, size3_t regionDims,
+                                       ByteOrder byteOrder, size_t elementSize, void* dest);
 }  // namespace inviwo::util
@@ -0,0 +1,117 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/io/inviwofileformattypes.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace inviwo {
+
+class VolumeRAM;
+
+namespace util {
+
+enum class ChunkCodec : std::uint8_t { None, Deflate };
+
+IVW_CORE_API std::string_view enumToStr(ChunkCodec codec);
+inline std::string_view format_as(ChunkCodec codec) { return enumToStr(codec); }
+
+struct ChunkedVolumeSettings {
+    /// Dimensions of each chunk, chunks at the upper border of the volume are clipped.
+    size3_t chunkDimensions{64};
+    ChunkCodec codec = ChunkCodec::Deflate;
+    /// Compression level from 1, fastest, to 9, smallest.
+    int level = 1;
+    /// Group the bytes of each element by significance before compressing, which usually gives
+    /// much better compression for multi byte formats since the high bytes vary slowly.
+    bool shuffle = true;
+};
+
+/**
+ * Write the data of @p volume to a chunked raw file. The volume is split into chunks that are
+ * compressed independently and in parallel using the thread pool. The file starts with a small
+ * header followed by a table of chunk offsets, hence any chunk can be found and decoded without
+ * reading the rest of the file.
+ * @throws DataWriterException if the file could not be written.
+ * @see ChunkedVolumeFile ChunkedVolumeRAMLoader
+ */
+IVW_CORE_API void writeChunkedVolume(const std::filesystem::path& path, const VolumeRAM& volume,
+                                     const ChunkedVolumeSettings& settings = {});
+
+/**
+ * Read access to a file written by writeChunkedVolume. Only the header and the chunk table are
+ * read on construction. The data is decoded by read(), in parallel using the thread pool, and
+ * only the chunks overlapping the requested region are touched.
+ */
+class IVW_CORE_API ChunkedVolumeFile {
+public:
+    /**
+     * @throws DataReaderException if the file could not be opened or is not a chunked volume.
+     */
+    explicit ChunkedVolumeFile(const std::filesystem::path& path);
+
+    const std::filesystem::path& getPath() const;
+    size3_t getDimensions() const;
+    size3_t getChunkDimensions() const;
+    size3_t getChunkGrid() const;
+    size_t getNumberOfChunks() const;
+    size_t getElementSize() const;
+    ChunkCodec getCodec() const;
+
+    /**
+     * Decode the region [@p offset, @p offset + @p dimensions) into @p dest, which is laid out
+     * like a volume of size @p dimensions and must hold
+     * `glm::compMul(dimensions) * getElementSize()` bytes.
+     * @throws DataReaderException if the region is outside of the volume or a chunk is corrupt.
+     */
+    void read(size3_t offset, size3_t dimensions, std::span<std::byte> dest) const;
+
+private:
+    std::filesystem::path path_;
+    size3_t dimensions_;
+    size3_t chunkDimensions_;
+    size_t elementSize_;
+    ChunkCodec codec_;
+    bool shuffle_;
+    ByteOrder byteOrder_;
+    std::vector<std::uint64_t> offsets_;  // Start of each chunk, with the end of the file last
+};
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -0,0 +1,74 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/io/volumeregionloader.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <filesystem>
+#include <memory>
+
+namespace inviwo {
+
+class VolumeRAM;
+
+/**
+ * \class ChunkedVolumeRAMLoader
+ * \brief A loader of chunked raw files written by util::writeChunkedVolume. Used to create
+ * VolumeRAM representations.
+ *
+ * The chunks are decoded in parallel directly into the VolumeRAM. A subset of the volume can be
+ * loaded with createSubsetRepresentation, which only decodes the chunks overlapping the subset.
+ * @see util::ChunkedVolumeFile
+ */
+class IVW_CORE_API ChunkedVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation>,
+                                             public VolumeRegionLoader {
+public:
+    explicit ChunkedVolumeRAMLoader(const std::filesystem::path& chunkedFile);
+    virtual ChunkedVolumeRAMLoader* clone() const override;
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override;
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                      const VolumeRepresentation& src) const override;
+
+    /**
+     * Load the subset [@p offset, @p offset + @p dimensions) of the volume.
+     */
+    virtual std::shared_ptr<VolumeRAM> createSubsetRepresentation(
+        const VolumeRepresentation& src, size3_t offset, size3_t dimensions) const override;
+
+private:
+    std::filesystem::path chunkedFile_;
+};
+
+}  // namespace inviwo
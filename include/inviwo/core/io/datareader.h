@@ -42,6 +42,11 @@ namespace inviwo {
 
 class MetaDataOwner;
 
+namespace pool {
+class Stop;
+class Progress;
+}  // namespace pool
+
 /**
  * @defgroup dataio Data Reader & Writers
  */
@@ -84,6 +89,16 @@ public:
      */
     virtual std::any getOption([[maybe_unused]] std::string_view key) { return std::any{}; }
 
+    /**
+     * Whether the reader can be used from a job in the thread pool, concurrently with other
+     * readers, including other instances of the same reader. Readers that use process global
+     * state, like the global logger of a third party library, or that need the main thread must
+     * return false. The DataSource processors read on the main thread unless this returns true.
+     * By default false.
+     * @see DataReaderType::readDataAsync
+     */
+    virtual bool isThreadSafe() const { return false; }
+
     template <typename T>
     bool readsType() const {
         return canRead(std::type_index(typeid(T)));
@@ -150,6 +165,21 @@ public:
         return readData(filePath);
     };
 
+    /**
+     * Read the data from a job running in the thread pool, as done by the DataSource processors.
+     * A reader can check @p stop to abort early, in which case it should return a nullptr, and
+     * report how far it has come in the range [0.0, 1.0] to @p progress. The default
+     * implementation just calls readData, override it for formats where the reading can be split
+     * up. Implementations must not touch any UI, and should not depend on the main thread.
+     * Only called from the thread pool by readers that return true from isThreadSafe.
+     * @see PoolProcessor::dispatchOne
+     */
+    virtual std::shared_ptr<T> readDataAsync(const std::filesystem::path& filePath,
+                                             [[maybe_unused]] const pool::Stop& stop,
+                                             [[maybe_unused]] const pool::Progress& progress) {
+        return readData(filePath);
+    }
+
 protected:
     virtual bool canRead(const std::type_index& index) const override {
         return std::type_index(typeid(T)) == index;
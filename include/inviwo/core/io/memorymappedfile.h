@@ -0,0 +1,87 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+namespace inviwo {
+
+namespace util {
+
+/**
+ * \class MemoryMappedFile
+ * \brief RAII wrapper of a private memory mapping of a part of a file.
+ *
+ * The mapping is copy on write, reads are served directly from the page cache and pages are
+ * loaded on demand when first accessed, while writes only modify a private copy of the affected
+ * pages and never the file.
+ */
+class IVW_CORE_API MemoryMappedFile {
+public:
+    /**
+     * Map @p size bytes of @p path starting at @p offset, the offset does not need to be page
+     * aligned.
+     * @throws FileException if the file could not be opened or mapped.
+     */
+    MemoryMappedFile(const std::filesystem::path& path, size_t offset, size_t size);
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    MemoryMappedFile(MemoryMappedFile&& rhs) noexcept;
+    MemoryMappedFile& operator=(MemoryMappedFile&& rhs) noexcept;
+    ~MemoryMappedFile();
+
+    std::byte* data() { return static_cast<std::byte*>(base_) + shift_; }
+    const std::byte* data() const { return static_cast<const std::byte*>(base_) + shift_; }
+    size_t size() const { return size_; }
+    std::span<std::byte> view() { return {data(), size_}; }
+    std::span<const std::byte> view() const { return {data(), size_}; }
+
+    /**
+     * Check if memory mapping is supported for @p path, i.e. if it is a regular local file.
+     */
+    static bool isMappable(const std::filesystem::path& path);
+
+private:
+    void unmap();
+
+    void* base_ = nullptr;
+    size_t shift_ = 0;
+    size_t size_ = 0;
+    size_t mappedSize_ = 0;
+};
+
+}  // namespace util
+
+}  // namespace inviwo
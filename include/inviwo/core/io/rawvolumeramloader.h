@@ -33,6 +33,7 @@
 #include <inviwo/core/io/bytereaderutil.h>
 #include <inviwo/core/io/datareaderexception.h>
 #include <inviwo/core/io/inviwofileformattypes.h>
+#include <inviwo/core/io/volumeregionloader.h>
 #include <inviwo/core/datastructures/diskrepresentation.h>
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>
 
@@ -45,9 +46,17 @@ namespace inviwo {
  * \class RawVolumeRAMLoader
  * \brief A loader of raw files. Used to create VolumeRAM representations.
  * This class us used by the DatVolumeSequenceReader, IvfVolumeReader and RawVolumeReader.
+ *
+ * If the data is uncompressed and stored in the native byte order the file is memory mapped
+ * instead of read, making the load near instant and letting the data be paged in on demand.
+ * Note that the file should then not be modified while the volume is in use.
+ *
+ * Regions of uncompressed files can be read with createSubsetRepresentation without loading the
+ * rest of the volume, for example a single slice.
  */
 
-class IVW_CORE_API RawVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+class IVW_CORE_API RawVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation>,
+                                         public VolumeRegionLoader {
 public:
     RawVolumeRAMLoader(const std::filesystem::path& rawFile, size_t offset,
                        ByteOrder byteOrder, Compression compression);
@@ -57,6 +66,15 @@ public:
     virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
                                       const VolumeRepresentation& src) const override;
 
+    /**
+     * Read the region [@p offset, @p offset + @p dimensions) of the volume.
+     * @return the region, or nullptr if the file is compressed.
+     */
+    virtual std::shared_ptr<VolumeRAM> createSubsetRepresentation(
+        const VolumeRepresentation& src, size3_t offset, size3_t dimensions) const override;
+
+    virtual std::optional<DiskSource> getSource() const override;
+
 private:
     std::filesystem::path rawFile_;
     size_t offset_;
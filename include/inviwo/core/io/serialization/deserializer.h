@@ -48,11 +48,13 @@
 #include <bitset>
 #include <array>
 #include <vector>
+#include <functional>
 #include <map>
 #include <unordered_map>
 #include <filesystem>
 #include <optional>
 #include <concepts>
+#include <ranges>
 
 #include <fmt/base.h>
 
@@ -718,6 +720,63 @@ void Deserializer::deserializeRange(std::string_view key, std::string_view itemK
 }
 
 namespace detail {
+/**
+ * Find the item with @p identifier in @p container. Items are usually stored in the same order as
+ * in the container, hence the item at @p hint is checked first to avoid a linear search per item.
+ */
+template <typename C, typename GetID>
+auto findIdentifier(C& container, std::string_view identifier, size_t hint, GetID& getID) {
+    if constexpr (std::ranges::random_access_range<C>) {
+        if (hint < std::ranges::size(container)) {
+            auto it = std::ranges::begin(container) + hint;
+            if (std::invoke(getID, *it) == identifier) return it;
+        }
+    }
+    return std::ranges::find(container, identifier, getID);
+}
+
+/**
+ * The items of a container before deserialization, the ones that are not found among the
+ * deserialized items should be removed afterwards. Items are usually stored in the same order as
+ * in the container, hence each search starts after the previous match to avoid a linear search
+ * per item.
+ */
+template <typename T>
+class Remaining {
+public:
+    explicit Remaining(SerializeBase::allocator_type alloc) : items_{alloc}, found_{alloc} {}
+
+    void add(T item) {
+        items_.emplace_back(std::move(item));
+        found_.push_back(false);
+    }
+
+    template <typename U>
+    void markFound(const U& item) {
+        const auto size = items_.size();
+        for (size_t n = 0; n < size; ++n) {
+            const auto i = (next_ + n) % size;
+            if (!found_[i] && items_[i] == item) {
+                found_[i] = true;
+                next_ = i + 1;
+                return;
+            }
+        }
+    }
+
+    template <typename F>
+    void forEach(F&& func) const {
+        for (size_t i = 0; i < items_.size(); ++i) {
+            if (!found_[i]) std::invoke(func, items_[i]);
+        }
+    }
+
+private:
+    std::pmr::vector<T> items_;
+    std::pmr::vector<bool> found_;
+    size_t next_ = 0;
+};
+
 template <typename C, typename Functions>
 void reorder(Functions& f, C& list, const std::pmr::vector<std::string_view>& order) {
     size_t dst = 0;
@@ -755,16 +814,14 @@ template <typename C, typename T, typename... Funcs>
 void Deserializer::deserialize(std::string_view key, C& container, std::string_view itemKey,
                                deserializer::IdentifierFunctions<Funcs...> f) {
 
-    std::pmr::vector<std::pmr::string> toRemove(getAllocator());
+    detail::Remaining<std::pmr::string> toRemove(getAllocator());
     for (const auto& item : container) {
-        toRemove.emplace_back(f.getID(item));
+        toRemove.add(std::pmr::string{f.getID(item), getAllocator()});
     }
 
     const NodeSwitch vectorNodeSwitch(*this, key);
     if (!vectorNodeSwitch) {
-        for (auto& id : toRemove) {
-            f.onRemove(id);
-        }
+        toRemove.forEach([&](const auto& id) { f.onRemove(id); });
         return;
     }
 
@@ -775,10 +832,10 @@ void Deserializer::deserialize(std::string_view key, C& container, std::string_v
     detail::forEachChild(rootElement_, itemKey, [&](TiXmlElement& child) {
         const NodeSwitch elementNodeSwitch(*this, child, false);
         const std::string_view identifier = detail::getAttribute(child, "identifier");
-        std::erase(toRemove, identifier);
+        toRemove.markFound(identifier);
         foundIdentifiers.emplace_back(identifier);
 
-        auto it = std::ranges::find(container, identifier, f.getID);
+        auto it = detail::findIdentifier(container, identifier, index, f.getID);
         if (it != container.end()) {
             try {
                 deserialize(itemKey, *it);
@@ -797,7 +854,7 @@ void Deserializer::deserialize(std::string_view key, C& container, std::string_v
         ++index;
     });
 
-    for (const auto& identifier : toRemove) f.onRemove(identifier);
+    toRemove.forEach([&](const auto& identifier) { f.onRemove(identifier); });
 
     detail::reorder(f, container, foundIdentifiers);
 }
@@ -863,14 +920,14 @@ template <typename C, typename K, typename T, typename... Funcs>
     }
 void Deserializer::deserialize(std::string_view key, C& container, std::string_view itemKey,
                                deserializer::MapFunctions<Funcs...> f) {
-    std::pmr::vector<K> toRemove(getAllocator());
+    detail::Remaining<K> toRemove(getAllocator());
     for (const auto& item : container) {
-        toRemove.emplace_back(item.first);
+        toRemove.add(item.first);
     }
 
     const NodeSwitch vectorNodeSwitch(*this, key);
     if (!vectorNodeSwitch) {
-        for (const auto& item : toRemove) f.onRemove(item);
+        toRemove.forEach([&](const auto& item) { f.onRemove(item); });
         return;
     }
 
@@ -878,7 +935,7 @@ void Deserializer::deserialize(std::string_view key, C& container, std::string_v
         const NodeSwitch elementNodeSwitch(*this, child, false);
         const std::string_view identifier = detail::getAttribute(child, f.attributeKey);
         const K key = f.idTransform(identifier);
-        std::erase(toRemove, key);
+        toRemove.markFound(key);
 
         auto it = container.find(key);
         if (it != container.end()) {
@@ -898,7 +955,7 @@ void Deserializer::deserialize(std::string_view key, C& container, std::string_v
         }
     });
 
-    for (const auto& item : toRemove) f.onRemove(item);
+    toRemove.forEach([&](const auto& item) { f.onRemove(item); });
 }
 
 template <typename T, typename H, typename P, typename A>
@@ -0,0 +1,132 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/io/memorymappedfile.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace inviwo {
+
+class Volume;
+
+/**
+ * \ingroup io
+ * A persistent on-disk cache of values that are expensive to compute from data files, like
+ * histograms and data ranges, such that they can be reused when the same files are opened again
+ * in a later session. Every value is stored in a file of its own under a key computed from the
+ * path, size, and last modification time of the data file, together with a description of
+ * everything else that affects the value. Hence, modifying the data file results in a new key and
+ * the old value is simply never used again. Values are read back through a memory mapping.
+ *
+ * The cache is disabled by default, see SystemSettings::sessionCache_. When more than the
+ * capacity is used the least recently used values are removed.
+ * @see InviwoApplication::getSessionCache util::getSessionCache
+ */
+class IVW_CORE_API SessionCache {
+public:
+    explicit SessionCache(std::filesystem::path directory);
+    SessionCache(const SessionCache&) = delete;
+    SessionCache& operator=(const SessionCache&) = delete;
+    ~SessionCache() = default;
+
+    /**
+     * Set the capacity in bytes, 0 disables the cache. The cached values are kept on disk when
+     * disabled, use clear to remove them.
+     */
+    void setCapacity(size_t bytes);
+    size_t getCapacity() const;
+    bool isEnabled() const;
+
+    /**
+     * Compute the key for a value computed from @p file. The @p description should contain
+     * everything apart from the content of the file that affects the value.
+     * @return the key or std::nullopt if @p file is not a regular file.
+     */
+    static std::optional<std::uint64_t> key(const std::filesystem::path& file,
+                                            std::string_view description);
+
+    /**
+     * Map the value stored under @p key.
+     * @return the value or std::nullopt if there is no such value or if the cache is disabled.
+     */
+    std::optional<util::MemoryMappedFile> load(std::uint64_t key) const;
+
+    /**
+     * Store @p value under @p key, replacing any earlier value. Does nothing if the cache is
+     * disabled, failures are only logged.
+     */
+    void store(std::uint64_t key, std::span<const std::byte> value) const;
+
+    /**
+     * Remove all cached values
+     */
+    void clear() const;
+
+    const std::filesystem::path& getDirectory() const;
+
+private:
+    std::filesystem::path file(std::uint64_t key) const;
+    // Remove the least recently used values until at most the capacity is used
+    void evict() const;
+
+    std::filesystem::path directory_;
+    size_t capacity_ = 0;
+    mutable std::mutex mutex_;
+};
+
+namespace util {
+
+/**
+ * The session cache of the application, or nullptr if there is no application or if the cache is
+ * disabled.
+ */
+IVW_CORE_API SessionCache* getSessionCache();
+
+/**
+ * Compute the key for a value computed from the data of @p volume. Only volumes whose data is
+ * read from a file, and has not been modified since, can be cached. The dimensions and format of
+ * the volume are part of the key, anything else that affects the value needs to be in
+ * @p description.
+ * @return the key or std::nullopt if the value can not be cached.
+ */
+IVW_CORE_API std::optional<std::uint64_t> sessionCacheKey(const Volume& volume,
+                                                          std::string_view description);
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -0,0 +1,75 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <memory>
+
+namespace inviwo {
+
+class Volume;
+class VolumeRAM;
+class VolumeRepresentation;
+
+/**
+ * \class VolumeRegionLoader
+ * \brief Interface for volume disk loaders that can read a region of the volume without loading
+ * all of it. Implemented by the RawVolumeRAMLoader and the ChunkedVolumeRAMLoader.
+ * @see util::loadVolumeRegion
+ */
+class IVW_CORE_API VolumeRegionLoader {
+public:
+    virtual ~VolumeRegionLoader() = default;
+
+    /**
+     * Load the region [@p offset, @p offset + @p dimensions) of the volume.
+     * @return the region, or nullptr if the region can not be read on its own, for example from a
+     * compressed file.
+     */
+    virtual std::shared_ptr<VolumeRAM> createSubsetRepresentation(const VolumeRepresentation& src,
+                                                                  size3_t offset,
+                                                                  size3_t dimensions) const = 0;
+};
+
+namespace util {
+
+/**
+ * Read the region [@p offset, @p offset + @p dimensions) of @p volume directly from disk if the
+ * volume has not been loaded into RAM yet and its disk loader is a VolumeRegionLoader.
+ * @return the region, or nullptr if it has to be taken from the VolumeRAM representation instead
+ */
+IVW_CORE_API std::shared_ptr<VolumeRAM> loadVolumeRegion(const Volume& volume, size3_t offset,
+                                                         size3_t dimensions);
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -79,11 +79,21 @@ public:
     bool isLinking() const;
 
 private:
+    /**
+     * The precomputed propagation of a change in a source property. The links are ordered in
+     * evaluation order with their converters already resolved, and properties holds each
+     * property involved once, used to guard against circular links.
+     */
+    struct Propagation {
+        std::vector<ConvertibleLink> links;
+        std::vector<Property*> properties;
+    };
+
     // Cache helpers
-    std::vector<ConvertibleLink>& addToTransientCache(Property* src);
+    Propagation& addToTransientCache(Property* src);
     void transientCacheHelper(std::vector<ConvertibleLink>& links, Property* src, Property* dst,
                               const PropertyConverterManager* manager);
-    std::vector<ConvertibleLink>& getTriggeredLinksForProperty(Property* property);
+    Propagation& getTriggeredLinksForProperty(Property* property);
 
     ProcessorNetwork* network_;
 
@@ -92,7 +102,7 @@ private:
     std::unordered_map<Property*, std::vector<Property*>> directLinkCache_;
     // The transient link cache is a map with all source properties and a vector of ALL the
     // properties that they link to. Directly or indirectly.
-    std::unordered_map<Property*, std::vector<ConvertibleLink>> transientLinkCache_;
+    std::unordered_map<Property*, Propagation> transientLinkCache_;
     // A cache of all links between two processors.
     ProcessorLinkMap processorLinksCache_;
 
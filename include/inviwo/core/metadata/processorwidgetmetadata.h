@@ -47,6 +47,7 @@ protected:
     virtual void onProcessorWidgetVisibilityChange(ProcessorWidgetMetaData*){};
     virtual void onProcessorWidgetFullScreenChange(ProcessorWidgetMetaData*){};
     virtual void onProcessorWidgetOnTopChange(ProcessorWidgetMetaData*){};
+    virtual void onProcessorWidgetExposureChange(ProcessorWidgetMetaData*){};
 };
 
 class IVW_CORE_API ProcessorWidgetMetaData : public MetaData,
@@ -79,6 +80,13 @@ public:
     void setOnTop(bool onTop, const ProcessorWidgetMetaDataObserver* source = nullptr);
     bool isOnTop() const;
 
+    /**
+     * A visible widget can still be hidden from the user, e.g. when its window is minimized or
+     * it is in an inactive tab. The exposure is reported by the widget and is not serialized.
+     */
+    void setExposed(bool exposed, const ProcessorWidgetMetaDataObserver* source = nullptr);
+    bool isExposed() const;
+
     static constexpr std::string_view classIdentifier{"org.inviwo.ProcessorWidgetMetaData"};
 
 private:
@@ -87,6 +95,7 @@ private:
     bool visible_;
     bool fullScreen_;
     bool onTop_;
+    bool exposed_;
 };
 
 }  // namespace inviwo
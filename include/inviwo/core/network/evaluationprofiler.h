@@ -0,0 +1,205 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/network/processornetworkobserver.h>
+#include <inviwo/core/network/processornetworkevaluationobserver.h>
+#include <inviwo/core/processors/processorobserver.h>
+#include <inviwo/core/util/clock.h>
+
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace inviwo {
+
+class Processor;
+class ProcessorNetwork;
+class ProcessorNetworkEvaluator;
+
+/**
+ * The EvaluationProfiler records timings of the network evaluation when enabled:
+ *   * The CPU wall time of each processor evaluation, measured using Clock
+ *   * The GPU time of each processor tagged with Tags::GL, if a GPU timer factory has been
+ *     registered, the OpenGL module registers one based on ClockGL.
+ *   * Representation conversions
+ *   * Processor invalidations
+ *
+ * The recorded events can be exported as a Chrome trace / Perfetto JSON timeline, that can be
+ * opened in https://ui.perfetto.dev or chrome://tracing, and are aggregated per processor by
+ * getProcessorStats().
+ * Note that in the parallel evaluation mode the CPU time of a processor also includes the time it
+ * waited in the thread pool queue.
+ */
+class IVW_CORE_API EvaluationProfiler : public ProcessorNetworkObserver,
+                                        public ProcessorNetworkEvaluationObserver,
+                                        public ProcessorObserver {
+public:
+    static constexpr std::string_view evaluationCategory{"Evaluation"};
+    static constexpr std::string_view processCategory{"Process"};
+    static constexpr std::string_view gpuCategory{"GPU"};
+    static constexpr std::string_view conversionCategory{"Conversion"};
+    static constexpr std::string_view invalidationCategory{"Invalidation"};
+
+    struct Event {
+        std::string name;
+        std::string_view category;
+        Clock::time_point start;
+        Clock::duration duration;
+        std::thread::id thread;
+    };
+
+    struct ProcessorStats {
+        std::string identifier;
+        size_t count = 0;
+        Clock::duration total{0};
+        Clock::duration max{0};
+        Clock::duration gpuTotal{0};
+        size_t invalidations = 0;
+    };
+
+    /**
+     * Interface for measuring the GPU time of a processor.
+     * @see setGPUTimerFactory
+     */
+    class IVW_CORE_API GPUTimer {
+    public:
+        virtual ~GPUTimer() = default;
+        virtual void start() = 0;
+        virtual void stop() = 0;
+        /**
+         * Will be called at the end of the network evaluation, might block until the GPU has
+         * finished.
+         */
+        virtual Clock::duration getElapsedTime() = 0;
+    };
+    using GPUTimerFactory = std::function<std::unique_ptr<GPUTimer>()>;
+
+    EvaluationProfiler(ProcessorNetwork* network, ProcessorNetworkEvaluator* evaluator);
+    EvaluationProfiler(const EvaluationProfiler&) = delete;
+    EvaluationProfiler& operator=(const EvaluationProfiler&) = delete;
+    virtual ~EvaluationProfiler();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    /**
+     * Remove all recorded events and statistics
+     */
+    void clear();
+
+    /**
+     * Set a factory for creating GPU timers. Pass nullptr to remove it.
+     */
+    void setGPUTimerFactory(GPUTimerFactory factory);
+
+    /**
+     * Record an event. Can be called from any thread.
+     */
+    void addEvent(Event event);
+
+    /**
+     * Record a representation conversion from source to destination. Can be called from any thread.
+     */
+    void addConversion(std::string_view source, std::string_view destination,
+                       Clock::time_point start);
+
+    std::vector<Event> getEvents() const;
+
+    /**
+     * Get the aggregated statistics for each processor sorted by the total CPU time.
+     */
+    std::vector<ProcessorStats> getProcessorStats() const;
+
+    /**
+     * Write all events as a Chrome trace event JSON file.
+     */
+    void writeChromeTrace(std::ostream& os) const;
+    void writeChromeTrace(const std::filesystem::path& file) const;
+
+    /**
+     * Get the currently enabled profiler, if any. Used to record events that are not tied to the
+     * network evaluation, like representation conversions.
+     */
+    static EvaluationProfiler* getEnabled();
+
+    /**
+     * Limit the number of recorded events, older events are discarded first. The statistics are
+     * not affected by this limit.
+     */
+    void setMaxEvents(size_t maxEvents);
+
+private:
+    virtual void onProcessorNetworkDidAddProcessor(Processor* processor) override;
+    virtual void onProcessorNetworkWillRemoveProcessor(Processor* processor) override;
+
+    virtual void onProcessorNetworkEvaluationBegin() override;
+    virtual void onProcessorNetworkEvaluationEnd() override;
+
+    virtual void onProcessorInvalidationBegin(Processor* processor) override;
+    virtual void onProcessorAboutToProcess(Processor* processor) override;
+    virtual void onProcessorFinishedProcess(Processor* processor) override;
+
+    void addEventInternal(Event event);
+
+    struct Running {
+        Clock::time_point start;
+        std::unique_ptr<GPUTimer> gpuTimer;
+    };
+    struct PendingGPU {
+        std::string identifier;
+        Clock::time_point start;
+        std::unique_ptr<GPUTimer> gpuTimer;
+    };
+
+    ProcessorNetwork* network_;
+    bool enabled_;
+    GPUTimerFactory gpuTimerFactory_;
+    Clock::time_point origin_;
+    Clock::time_point evaluationStart_;
+    std::unordered_map<Processor*, Running> running_;
+    std::vector<PendingGPU> pendingGPU_;
+
+    mutable std::mutex mutex_;
+    size_t maxEvents_;
+    std::deque<Event> events_;
+    std::unordered_map<std::string, ProcessorStats> stats_;
+};
+
+}  // namespace inviwo
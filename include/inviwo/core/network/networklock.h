@@ -54,4 +54,25 @@ private:
     ProcessorNetwork* network_;
 };
 
+/**
+ * A RAII utility for batching changes to the network, @see ProcessorNetwork::beginBatch.
+ * Use when setting many properties at once, each processor is then only invalidated once and the
+ * network is evaluated once when the batch goes out of scope.
+ */
+struct IVW_CORE_API NetworkBatch {
+    NetworkBatch();
+    NetworkBatch(ProcessorNetwork* network);
+    NetworkBatch(Processor* network);
+    NetworkBatch(Property* network);
+    ~NetworkBatch();
+
+    NetworkBatch(NetworkBatch const&) = delete;
+    NetworkBatch& operator=(NetworkBatch const& that) = delete;
+    NetworkBatch(NetworkBatch&& rhs) noexcept;
+    NetworkBatch& operator=(NetworkBatch&& that);
+
+private:
+    ProcessorNetwork* network_;
+};
+
 }  // namespace inviwo
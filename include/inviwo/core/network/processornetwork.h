@@ -427,6 +427,23 @@ public:
     void unlock();
     bool islocked() const;
 
+    /**
+     * Start a batch of changes, batches can be nested. While batching, an invalidated processor
+     * only records its invalidation level and the propagation to its outports is done once per
+     * processor when the outermost batch ends. Network changed notifications are coalesced in the
+     * same way, and the network is locked so evaluation is requested once at the end.
+     * Prefer the RAII helper NetworkBatch.
+     */
+    void beginBatch();
+    void endBatch();
+    bool isBatching() const;
+
+    /**
+     * Called by Processor::invalidate, returns true if the propagation to the outports of
+     * @p processor is deferred to the end of the current batch.
+     */
+    bool deferInvalidation(Processor* processor);
+
     virtual void serialize(Serializer& s) const override;
     virtual void deserialize(Deserializer& d) override;
     bool isDeserializing() const;
@@ -484,6 +501,10 @@ private:
     static const int processorNetworkVersion_;
 
     unsigned int locked_ = 0;
+    unsigned int batching_ = 0;
+    std::vector<Processor*> deferredInvalidations_;
+    std::unordered_set<Processor*> deferredInvalidationsSet_;
+    bool deferredNetworkChanged_ = false;
     bool deserializing_ = false;
     int backgoundJobs_ = 0;
 
@@ -532,5 +553,6 @@ inline void ProcessorNetwork::unlock() {
     if (locked_ == 0) notifyObserversProcessorNetworkUnlocked();
 }
 inline bool ProcessorNetwork::islocked() const { return (locked_ != 0); }
+inline bool ProcessorNetwork::isBatching() const { return (batching_ != 0); }
 
 }  // namespace inviwo
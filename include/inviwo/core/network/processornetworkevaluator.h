@@ -34,12 +34,38 @@
 #include <inviwo/core/processors/processorobserver.h>
 #include <inviwo/core/network/processornetworkevaluationobserver.h>
 #include <inviwo/core/network/evaluationerrorhandler.h>
+#include <inviwo/core/network/processorresultcache.h>
+#include <inviwo/core/util/dynamictopologicalorder.h>
+
+#include <exception>
+#include <vector>
 
 namespace inviwo {
 
 class Processor;
 class ProcessorNetwork;
 
+/**
+ * The ProcessorNetworkEvaluator is responsible for evaluating the processors of a
+ * ProcessorNetwork in topological order whenever the network is invalidated.
+ *
+ * In EvaluationMode::Parallel the topological order is used to construct a dependency graph, and
+ * processors whose dependencies have been evaluated are dispatched to the ThreadPool if they opt
+ * in through Processor::isThreadSafe. All other processors, and all the bookkeeping like
+ * initializeResources, port onChange callbacks and observer notifications, are still run on the
+ * main thread. Hence a processor that needs the OpenGL context acts as a barrier
+ * for its predecessors only, independent branches can be processed concurrently. Processors that
+ * are connected through property links are never processed at the same time, so link evaluation
+ * on the main thread does not modify the properties of a processor that is in flight.
+ *
+ * The topological order of all processors is maintained incrementally as processors and
+ * connections are added and removed, see util::DynamicTopologicalOrder. Changes are batched and
+ * only applied when the network is evaluated, hence changes made under a NetworkLock, like loading
+ * a workspace, are resolved at once when the lock is released.
+ *
+ * Processors tagged with Tags::Deterministic are processed through the ProcessorResultCache,
+ * which restores earlier results instead of processing when the cache has a capacity.
+ */
 class IVW_CORE_API ProcessorNetworkEvaluator : public ProcessorNetworkObserver,
                                                public ProcessorObserver,
                                                public ProcessorNetworkEvaluationObservable {
@@ -50,6 +76,16 @@ public:
     virtual ~ProcessorNetworkEvaluator() = default;
     void setExceptionHandler(EvaluationErrorHandler handler);
 
+    enum class EvaluationMode {
+        Serial,   //< Process all processors on the main thread in topological order
+        Parallel  //< Process independent thread safe processors on the thread pool
+    };
+    void setEvaluationMode(EvaluationMode mode);
+    EvaluationMode getEvaluationMode() const;
+
+    ProcessorResultCache& getResultCache();
+    const ProcessorResultCache& getResultCache() const;
+
 private:
     // ProcessorNetworkObserver overrides
     virtual void onProcessorNetworkEvaluateRequest() override;
@@ -65,13 +101,32 @@ private:
 
     void requestEvaluate();
     void evaluate();
+    void evaluateSerial();
+    void evaluateParallel();
+
+    /**
+     * Initialize resources and call port onChange callbacks for an invalid processor.
+     * @return true if the processor should be processed.
+     */
+    bool prepareProcessor(Processor* processor);
+    void finishProcessor(Processor* processor, std::exception_ptr error);
+
+    /**
+     * Update the processor order and select the processors that are needed by a sink through
+     * active connections.
+     */
+    void sortProcessors();
 
     ProcessorNetwork* processorNetwork_;
-    // the sorted list of processors obtained through topological sorting
+    // the topological order of all processors, regardless of sinks and active connections
+    util::DynamicTopologicalOrder<Processor*> processorOrder_;
+    // the sorted list of processors needed by a sink
     std::vector<Processor*> processorsSorted_;
     bool needsSorting_;
     bool evaluationQueued_;
+    EvaluationMode evaluationMode_;
     EvaluationErrorHandler exceptionHandler_;
+    ProcessorResultCache resultCache_;
 };
 
 }  // namespace inviwo
@@ -0,0 +1,124 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace inviwo {
+
+class Processor;
+
+/**
+ * \ingroup network
+ * An in memory cache of the outport data of processors tagged with Tags::Deterministic, used by
+ * the ProcessorNetworkEvaluator to skip processing when a processor has been evaluated with the
+ * same input data and property state before. Toggling back and forth between property settings
+ * will then only restore the earlier results.
+ *
+ * The key of a result is the serialized state of the processor's properties together with the
+ * identity of the data on its active inports. Since the cache keeps the results alive, data that
+ * is restored keeps its identity and downstream processors will also find their results. Results
+ * are evicted in least recently used order when more than the capacity is used, the size of the
+ * data is estimated from its dimensions and format.
+ *
+ * A processor is processed as usual if it is not tagged, if the cache is disabled, or if any of
+ * its inputs or outputs can not be cached, for example images, @see Outport::getCacheableData.
+ * Processors that modify their input data or their earlier output data in place, or that set
+ * properties in process, must not be tagged.
+ */
+class IVW_CORE_API ProcessorResultCache {
+public:
+    ProcessorResultCache() = default;
+    ProcessorResultCache(const ProcessorResultCache&) = delete;
+    ProcessorResultCache& operator=(const ProcessorResultCache&) = delete;
+    ~ProcessorResultCache() = default;
+
+    /**
+     * Set the capacity in bytes, 0 disables the cache and drops all results.
+     */
+    void setCapacity(size_t bytes);
+    size_t getCapacity() const;
+    size_t getUsage() const;
+
+    /**
+     * Restore the outport data of @p processor if it has been processed with the same input data
+     * and property state before, otherwise call Processor::process and cache the result.
+     * @return true if the result was restored from the cache
+     */
+    bool process(Processor& processor);
+
+    /**
+     * Drop all results of @p processor, called when it is removed from the network.
+     */
+    void forget(const Processor* processor);
+    void clear();
+
+    /**
+     * The max number of results kept for a single processor, independent of their size.
+     */
+    static constexpr size_t maxResultsPerProcessor = 32;
+
+private:
+    struct Key {
+        size_t hash;
+        std::string state;
+        std::vector<std::shared_ptr<const void>> inputs;
+    };
+    struct Entry {
+        const Processor* processor;
+        std::string state;
+        std::vector<std::weak_ptr<const void>> inputs;
+        std::vector<std::shared_ptr<const void>> outputs;
+        size_t bytes;
+        std::uint64_t tick;
+    };
+
+    static bool makeKey(const Processor& processor, Key& key);
+    static bool matches(const Entry& entry, const Processor& processor, const Key& key);
+    void add(Processor& processor, Key key);
+    // Requires mutex_ to be locked
+    void evict(size_t capacity);
+
+    mutable std::mutex mutex_;
+    std::unordered_multimap<size_t, Entry> entries_;
+    size_t capacity_ = 0;
+    size_t usage_ = 0;
+    std::uint64_t tick_ = 0;
+};
+
+}  // namespace inviwo
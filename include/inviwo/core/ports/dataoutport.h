@@ -38,6 +38,7 @@
 #include <inviwo/core/util/document.h>
 #include <inviwo/core/util/detected.h>
 #include <inviwo/core/resourcemanager/resource.h>
+#include <inviwo/core/resourcemanager/memorybudget.h>
 
 #include <glm/fwd.hpp>
 
@@ -91,6 +92,9 @@ public:
 
     virtual bool hasData() const override;
 
+    virtual std::pair<std::shared_ptr<const void>, size_t> getCacheableData() const override;
+    virtual void setCacheableData(std::shared_ptr<const void> data) override;
+
 protected:
     std::shared_ptr<const T> data_;
 };
@@ -174,6 +178,16 @@ bool DataOutport<T>::hasData() const {
     return data_.get() != nullptr;
 }
 
+template <typename T>
+std::pair<std::shared_ptr<const void>, size_t> DataOutport<T>::getCacheableData() const {
+    return {data_, data_ ? MemoryBudget::sizeInBytes(*data_) : 0};
+}
+
+template <typename T>
+void DataOutport<T>::setCacheableData(std::shared_ptr<const void> data) {
+    setData(std::static_pointer_cast<const T>(data));
+}
+
 template <typename T>
 void DataOutport<T>::clear() {
     data_.reset();
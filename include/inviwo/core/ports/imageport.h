@@ -275,6 +275,11 @@ public:
 
     virtual Document getInfo() const override;
 
+    /**
+     * Processors render into the image of the port, so it can not be cached.
+     */
+    virtual std::pair<std::shared_ptr<const void>, size_t> getCacheableData() const override;
+
 private:
     size2_t getLargestReqDim() const;
     void pruneCache();
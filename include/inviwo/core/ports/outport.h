@@ -37,6 +37,8 @@
 
 #include <vector>
 #include <functional>
+#include <memory>
+#include <utility>
 
 namespace inviwo {
 
@@ -95,6 +97,14 @@ public:
      */
     virtual void setValid();
 
+    /**
+     * The number of times the port has been set valid, i.e. a counter that changes every time the
+     * owning processor has produced new data for the port. Useful for telling if something
+     * derived from the port data, like a port inspector image, is stale.
+     * @see setValid
+     */
+    size_t getGeneration() const;
+
     /**
      * Query if the outport has any data
      */
@@ -105,6 +115,19 @@ public:
      */
     virtual void clear() = 0;
 
+    /**
+     * Type erased access to the data of the port together with an estimate of its size in bytes,
+     * used by the ProcessorResultCache to store the results of a processor. Ports that reuse their
+     * data between evaluations, like the ImageOutport, can not be cached and return nullptr.
+     * @see setCacheableData
+     */
+    virtual std::pair<std::shared_ptr<const void>, size_t> getCacheableData() const;
+
+    /**
+     * Restore data previously returned by getCacheableData of this port.
+     */
+    virtual void setCacheableData(std::shared_ptr<const void> data);
+
 protected:
     /**
      * @note The internal isReady_ lambda function must be set by derived class, e.g.,
@@ -121,6 +144,7 @@ protected:
     StateCoordinator<bool> isReady_;
     InvalidationLevel invalidationLevel_;
     std::vector<Inport*> connectedInports_;
+    size_t generation_ = 0;
 
     CallBackList onConnectCallback_;
     CallBackList onDisconnectCallback_;
@@ -35,6 +35,7 @@
 #include <inviwo/core/util/glmvec.h>
 #include <inviwo/core/util/transparentmaps.h>
 
+#include <list>
 #include <map>
 #include <memory>
 #include <vector>
@@ -70,8 +71,21 @@ public:
     ProcessorWidget* addPortInspector(Outport* outport, ivec2 pos);
     void removePortInspector(Outport* outport);
 
+    /**
+     * Render an image of the data in @p outport using the port inspector network for the port
+     * type. The network is evaluated synchronously, so this can be expensive. The result is kept
+     * in a small least recently used cache keyed on the port and its generation, and reused until
+     * the port gets new data.
+     * @see getCachedPortInspectorImage
+     */
     std::shared_ptr<const Image> renderPortInspectorImage(Outport* outport);
 
+    /**
+     * Get the image from a previous call to renderPortInspectorImage if the port data has not
+     * changed since, otherwise a nullptr. This does not evaluate anything and is cheap to call.
+     */
+    std::shared_ptr<const Image> getCachedPortInspectorImage(const Outport* outport);
+
     void clear();
 
     virtual void serialize(Serializer& s) const override;
@@ -91,11 +105,22 @@ private:
 
     void removePortInspector(PortInspectorMap::iterator it);
 
+    struct Thumbnail {
+        std::string path;
+        size_t generation;
+        int size;
+        std::shared_ptr<const Image> image;
+    };
+    static constexpr size_t maxThumbnails = 32;
+
     PortInspectorMap portInspectors_;
     std::vector<std::unique_ptr<PortInspector>> unusedInspectors_;
 
     UnorderedStringMap<std::vector<std::string>> embeddedProcessors_;
 
+    // Most recently used first
+    std::list<Thumbnail> thumbnails_;
+
     InviwoApplication* app_;
 };
 
@@ -0,0 +1,280 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/processors/poolprocessor.h>
+#include <inviwo/core/util/threadpool.h>
+#include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/rendercontext.h>
+#include <inviwo/core/util/raiiutils.h>
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace inviwo {
+
+class AsyncProcessor;
+class InviwoApplication;
+
+/** Coroutine utilities for the AsyncProcessor */
+namespace async {
+
+namespace detail {
+
+/** The shared cancellation state of one invocation of AsyncProcessor::processAsync */
+struct IVW_CORE_API Context {
+    explicit Context(InviwoApplication* app) : app{app}, stop{false} {}
+
+    InviwoApplication* app;
+    std::atomic<bool> stop;
+
+    pool::Stop getStop() const { return pool::Stop{stop}; }
+};
+
+}  // namespace detail
+
+/**
+ * The return type of AsyncProcessor::processAsync. The coroutine is started by the processor and
+ * destroys itself when it finishes or gets canceled.
+ */
+class Task {
+public:
+    struct promise_type {
+        Task get_return_object() {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() {
+            if (onError) onError();
+        }
+
+        std::shared_ptr<detail::Context> context;
+        std::function<void()> onError;         //< Called from within a catch block
+        util::OnScopeExit onDestroy{nullptr};  //< Called when the coroutine frame is destroyed
+    };
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task(Task&& rhs) noexcept : handle_{std::exchange(rhs.handle_, {})} {}
+    Task& operator=(Task&& that) noexcept {
+        if (this != &that) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(that.handle_, {});
+        }
+        return *this;
+    }
+    ~Task() {
+        if (handle_) handle_.destroy();
+    }
+
+private:
+    friend AsyncProcessor;
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_{handle} {}
+
+    void start(std::shared_ptr<detail::Context> context, std::function<void()> onError,
+               std::function<void()> onDestroy) {
+        auto handle = std::exchange(handle_, {});
+        handle.promise().context = std::move(context);
+        handle.promise().onError = std::move(onError);
+        handle.promise().onDestroy.setAction(std::move(onDestroy));
+        handle.resume();
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+
+template <typename Job>
+constexpr bool takesStop = std::is_invocable_v<Job, pool::Stop>;
+
+template <typename Job>
+using JobResult = typename std::conditional_t<takesStop<Job>, std::invoke_result<Job, pool::Stop>,
+                                              std::invoke_result<Job>>::type;
+
+template <typename Job>
+class PoolAwaiter {
+public:
+    using Result = JobResult<Job>;
+
+    PoolAwaiter(Job job, ThreadPool::Priority priority)
+        : job_{std::move(job)}, priority_{priority} {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<Task::promise_type> handle) {
+        auto context = handle.promise().context;
+        util::getThreadPool(context->app)
+            .enqueueRaw(
+                [this, handle, context]() {
+                    if (!context->stop) {
+                        // This code will run in a background thread, use the local context
+                        RenderContext::getPtr()->activateLocalRenderContext();
+                        try {
+                            run(*context);
+                        } catch (...) {
+                            error_ = std::current_exception();
+                        }
+                    }
+                    util::dispatchFrontAndForget(context->app, [handle, context]() {
+                        if (context->stop) {
+                            handle.destroy();
+                        } else {
+                            RenderContext::getPtr()->activateDefaultRenderContext();
+                            handle.resume();
+                        }
+                    });
+                },
+                priority_);
+    }
+
+    Result await_resume() {
+        if (error_) std::rethrow_exception(error_);
+        if constexpr (!std::is_void_v<Result>) return std::move(*result_);
+    }
+
+private:
+    void run(const Context& context) {
+        if constexpr (std::is_void_v<Result>) {
+            if constexpr (takesStop<Job>) {
+                job_(context.getStop());
+            } else {
+                job_();
+            }
+        } else {
+            if constexpr (takesStop<Job>) {
+                result_.emplace(job_(context.getStop()));
+            } else {
+                result_.emplace(job_());
+            }
+        }
+    }
+
+    using Storage = std::conditional_t<std::is_void_v<Result>, bool, std::optional<Result>>;
+
+    Job job_;
+    ThreadPool::Priority priority_;
+    Storage result_{};
+    std::exception_ptr error_;
+};
+
+}  // namespace detail
+
+/**
+ * Run job in the thread pool and resume the coroutine on the main thread with the result. The job
+ * may optionally take a pool::Stop to check for cancellation. Any exception thrown by the job is
+ * rethrown in the coroutine. The local render context of the worker thread is active while the job
+ * runs, hence it can be used to create GL resources in the background.
+ */
+template <typename Job>
+auto run(Job&& job, ThreadPool::Priority priority = ThreadPool::Priority::Normal) {
+    return detail::PoolAwaiter<std::decay_t<Job>>{std::forward<Job>(job), priority};
+}
+
+/**
+ * Like async::run but for disk or network I/O, it will run with background priority to not
+ * occupy the workers needed for interactive work.
+ */
+template <typename Job>
+auto io(Job&& job) {
+    return detail::PoolAwaiter<std::decay_t<Job>>{std::forward<Job>(job),
+                                                  ThreadPool::Priority::Background};
+}
+
+}  // namespace async
+
+/**
+ * AsyncProcessor is a PoolProcessor where the work is written as a coroutine. processAsync is
+ * started on the main thread whenever the processor is processed, and can co_await work in the
+ * thread pool using async::run and async::io. The coroutine is always resumed on the main thread
+ * with the default render context active, so the code between the awaits can safely access the
+ * processor, its ports and the GL state, and there is no need for explicit done callbacks.
+ *
+ * The current coroutine is canceled when the processor is invalidated, processed again or
+ * destroyed. A canceled coroutine will not be resumed, but destroyed at its next suspension point.
+ * Long running jobs can check the pool::Stop to exit early.
+ * ```{.cpp}
+ * async::Task MyProcessor::processAsync() {
+ *     auto path = file_.get();
+ *     auto data = co_await async::io([path]() { return load(path); });
+ *     auto mesh = co_await async::run([data](pool::Stop stop) { return compute(*data, stop); });
+ *     outport_.setData(mesh);
+ *     newResults();
+ * }
+ * ```
+ * Note that lambdas given to async::run should capture by value since the coroutine might be
+ * canceled while the job is running.
+ */
+class IVW_CORE_API AsyncProcessor : public PoolProcessor {
+public:
+    AsyncProcessor(pool::Options options = pool::Options{flags::empty},
+                   const std::string& identifier = "", const std::string& displayName = "");
+    virtual ~AsyncProcessor();
+
+    /**
+     * Starts processAsync, cancelling any previous invocation.
+     */
+    virtual void process() override final;
+
+    /**
+     * Cancels the current invocation of processAsync for invalidations of InvalidOutput or higher,
+     * unless pool::Option::KeepOldResults is set. Then it will be canceled by the next process.
+     */
+    virtual void invalidate(InvalidationLevel invalidationLevel,
+                            Property* source = nullptr) override;
+
+    /**
+     * Cancel the current invocation of processAsync if any.
+     */
+    void cancel();
+
+    /**
+     * Is there a currently running invocation of processAsync.
+     */
+    bool isRunning() const;
+
+protected:
+    virtual async::Task processAsync() = 0;
+
+private:
+    std::shared_ptr<async::detail::Context> context_;
+    size_t running_;
+};
+
+}  // namespace inviwo
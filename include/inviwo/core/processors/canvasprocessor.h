@@ -69,6 +69,14 @@ public:
     bool getUseCustomDimensions() const;
     size2_t getCustomDimensions() const;
 
+    /**
+     * Scale factor, in (0, 1], applied to the size propagated to the inport in resize events. The
+     * canvas itself keeps its dimensions and stretches the smaller image to fill the window.
+     * Used to trade resolution for frame rate during interaction.
+     */
+    void setRenderScale(double scale);
+    double getRenderScale() const;
+
     void saveImageLayer();
     void saveImageLayer(const std::filesystem::path& filePath,
                         const FileExtension& extension = FileExtension());
@@ -82,7 +90,9 @@ public:
     bool isContextMenuAllowed() const;
 
     /**
-     * By default the processor will only evaluate when its canvas is visible.
+     * By default the processor will only evaluate when its canvas is visible and exposed, i.e.
+     * not minimized or in an inactive tab. Then the processor is not a sink, and processors that
+     * only it depends on are not evaluated either.
      * By setting setEvaluateWhenHidden to true, it will be evaluated regardless.
      */
     void setEvaluateWhenHidden(bool option);
@@ -98,6 +108,7 @@ protected:
     virtual void onProcessorWidgetPositionChange(ProcessorWidgetMetaData*) override;
     virtual void onProcessorWidgetDimensionChange(ProcessorWidgetMetaData*) override;
     virtual void onProcessorWidgetVisibilityChange(ProcessorWidgetMetaData*) override;
+    virtual void onProcessorWidgetExposureChange(ProcessorWidgetMetaData*) override;
 
     Canvas* getCanvas() const;
 
@@ -130,6 +141,7 @@ private:
     static size2_t calcScaledSize(size2_t size, float scale);
 
     size2_t previousImageSize_;
+    double renderScale_;
     ProcessorWidgetMetaData* widgetMetaData_;
 };
 
@@ -31,6 +31,7 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/poolutils.h>
 
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/processors/activityindicator.h>
@@ -49,72 +50,13 @@ namespace inviwo {
 
 class PoolProcessor;
 
-/** PoolProcessor utilities*/
 namespace pool {
 
-/** PoolProcessor implementation details */
 namespace detail {
-
-/** Helper class to manage state for the background jobs */
-struct State;
 template <typename Result, typename Done>
 struct StateTemplate;
-
 }  // namespace detail
 
-/**
- * A class to signal if a background calculation should stop or be aborted.
- * Generally used by the background jobs to abort a calculation early:
- * ```{.cpp}
- * auto calc = [mystate](pool::Stop stop) {
- *     for(...) {
- *         if (stop) return nullptr;
- *         // do work
- *     }
- *     return results;
- * };
- * ```
- * \see PoolProcessor
- */
-class IVW_CORE_API Stop {
-public:
-    operator bool() const noexcept { return stop_.load(); }
-
-private:
-    friend ::inviwo::pool::detail::State;
-    explicit Stop(const std::atomic<bool>& stop) : stop_{stop} {}
-    const std::atomic<bool>& stop_;  // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
-};
-
-/**
- * A class to signal the progress of a background calculation:
- * The progress reported should be in the range of [0.0, 1.0]. If the pool processor is running
- * multiple jobs the progress will automatically be normalized. Only the progress of the last
- * submitted job will be reported to the user.
- * ```{.cpp}
- * auto calc = [mystate](pool::Progress progress) {
- *     for(int i = n; i < N; ++i) {
- *         progress(i, N);
- *         // do work
- *     }
- *     return results;
- * };
- * ```
- * \see PoolProcessor
- */
-class IVW_CORE_API Progress {
-public:
-    void operator()(float progress) const noexcept;
-    void operator()(double progress) const noexcept;
-    void operator()(size_t i, size_t max) const noexcept;
-
-private:
-    friend ::inviwo::pool::detail::State;
-    Progress(detail::State& state, size_t id) : state_{state}, id_{id} {}
-    detail::State& state_;
-    const size_t id_;
-};
-
 /**
  * Settings for the PoolProcessor
  * \see PoolProcessor
@@ -129,7 +71,12 @@ enum class Option {
     DelayDispatch = 1 << 2, 
     /// Delay invalidation of outports until the job is finished. This
     /// will override the default processor invalidation.
-    DelayInvalidation = 1 << 3 
+    DelayInvalidation = 1 << 3,
+    /// Jobs are started before any other queued work, use for jobs the user is waiting on.
+    Interactive = 1 << 4,
+    /// Jobs are started after all other queued work, and only run on a limited number of
+    /// workers. Checking the pool::Stop will run any waiting interactive jobs first.
+    Background = 1 << 5
 };
 
 }  // namespace pool
@@ -261,7 +208,8 @@ public:
     /**
      * Overrides Processor::invalidate to customize the invalidation behavior
      * We generally only want to invalidate the dependent processor when we put data on our
-     * outports.
+     * outports. An invalidation of InvalidOutput or higher will also cancel any running jobs,
+     * and those of all dependent pool processors, unless pool::Option::KeepOldResults is set.
      */
     virtual void invalidate(InvalidationLevel invalidationLevel,
                             Property* source = nullptr) override;
@@ -287,6 +235,18 @@ public:
      *  \see pool::Option::DelayInvalidation
      */
     bool delayInvalidation() const { return options_.contains(pool::Option::DelayInvalidation); }
+    /**
+     * The thread pool priority of the jobs
+     * \see pool::Option::Interactive, pool::Option::Background
+     */
+    ThreadPool::Priority priority() const;
+
+protected:
+    /**
+     * Call handleError and store the error message. Must be called from within a catch block on
+     * the main thread.
+     */
+    void reportError();
 
 private:
     friend ::inviwo::pool::detail::State;
@@ -319,6 +279,9 @@ private:
 
     Delay& getDelay();
 
+    // A MemoryBudget hold if a budget is enabled, see MemoryBudget::hold
+    static std::shared_ptr<void> holdMemory();
+
     pool::Options options_;
     std::vector<std::shared_ptr<pool::detail::State>> states_;
     util::OnScopeExit notifyRemainingJobsFinish_;
@@ -340,8 +303,10 @@ struct IVW_CORE_API State {
     std::vector<std::atomic<float>> progress;
     std::future<void> progressUpdate;
     size_t nJobs;
+    ThreadPool* yieldTo = nullptr;  //< Pool to run interactive tasks from when checking stop
+    std::shared_ptr<void> memoryHold;  //< Keeps representations used by the jobs alive
 
-    Stop getStop() { return Stop(stop); }
+    Stop getStop() { return Stop(stop, yieldTo); }
 
     void setProgress(size_t id, float progress);
 
@@ -407,8 +372,7 @@ inline void PoolProcessor::callDone(
                 state->done(results);
             }
         } catch (...) {
-            p.error_ = p.handleError();
-            p.isReady_.update();
+            p.reportError();
         }
     };
 
@@ -550,9 +514,14 @@ inline void PoolProcessor::setupProgress() {
 template <typename Result, typename Done>
 inline std::shared_ptr<pool::detail::StateTemplate<Result, Done>> PoolProcessor::makeState(
     size_t count, Done&& done) {
-    return std::make_shared<pool::detail::StateTemplate<Result, Done>>(
+    auto state = std::make_shared<pool::detail::StateTemplate<Result, Done>>(
         std::dynamic_pointer_cast<PoolProcessor>(shared_from_this()), count,
         std::forward<Done>(done));
+    if (priority() == ThreadPool::Priority::Background) {
+        state->yieldTo = &util::getThreadPool(getInviwoApplication());
+    }
+    state->memoryHold = holdMemory();
+    return state;
 }
 
 template <typename Result, typename Job>
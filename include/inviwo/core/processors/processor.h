@@ -314,6 +314,21 @@ public:
      */
     virtual void doIfNotReady() {}
 
+    /**
+     * Whether process can be called on a worker thread, concurrently with other processors, when
+     * the ProcessorNetworkEvaluator uses EvaluationMode::Parallel. Override to return true only if
+     * process does not need an OpenGL context and does not modify any properties, since that would
+     * update widgets, evaluate links and invalidate other processors from the worker thread.
+     * Reading inports and setting data on outports is fine. By default false.
+     *
+     * While such a processor is processing, the evaluator does not start any processor that is
+     * connected to it through property links, so links are never evaluated into a processor that
+     * is in flight. Code that can run concurrently, like other thread pool jobs, must not modify
+     * its properties either.
+     * @see ProcessorNetworkEvaluator
+     */
+    virtual bool isThreadSafe() const { return false; }
+
     /**
      * Called by the network after Processor::process has been called.
      * This will set the following to valid
@@ -457,9 +472,17 @@ protected:
     void setInportsChanged(bool changed);
 
 private:
+    friend ProcessorNetwork;
+
     void addPortInternal(Inport* port, std::string_view portGroup);
     void addPortInternal(Outport* port, std::string_view portGroup);
 
+    /**
+     * Invalidate all outports, which will invalidate all dependent processors. Called from
+     * invalidate or at the end of a network batch, @see ProcessorNetwork::beginBatch
+     */
+    void propagateInvalidation();
+
     std::string identifier_;
     std::string displayName_;
     std::vector<Inport*> inports_;
@@ -133,6 +133,10 @@ public:
     static constexpr Tag CPU{"CPU"};
     static constexpr Tag PY{"PY"};
 
+    // The outport data only depends on the properties and the inport data, and is newly created
+    // in every process. Such processors can have their results cached, @see ProcessorResultCache
+    static constexpr Tag Deterministic{"Deterministic"};
+
     friend inline bool operator==(const Tags& lhs, const Tags& rhs) {
         return lhs.tags_ == rhs.tags_;
     }
@@ -48,6 +48,13 @@ public:
     virtual bool isVisible() const;
     virtual void setVisible(bool visible);
 
+    /**
+     * Is the widget visible and actually shown to the user, i.e. not minimized or in an inactive
+     * tab. Widgets that can detect this should report it using setExposed.
+     */
+    virtual bool isExposed() const;
+    virtual void setExposed(bool exposed);
+
     virtual glm::ivec2 getDimensions() const;
     virtual void setDimensions(ivec2);
 
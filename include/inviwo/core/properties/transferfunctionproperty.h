@@ -254,6 +254,20 @@ public:
     size_t getLookUpTableSize() const { return lookup_.getSize(); }
     void setLookUpTableSize(size_t size) { return lookup_.setSize(size); }
 
+    /**
+     * The pre-integrated lookup table of the transfer function, a 2D table indexed by the
+     * scalar values at the front and back of a ray segment. Only baked on first use.
+     * @see TFLookupTable::Type::PreIntegrated
+     */
+    template <typename T>
+    const T* getPreIntegratedRepresentation() {
+        if (invalidPreIntegrated_) {
+            preIntegrated_.calculate(tf_);
+            invalidPreIntegrated_ = false;
+        }
+        return preIntegrated_.getRepresentation<T>();
+    }
+
     virtual TransferFunctionProperty& setCurrentStateAsDefault() override;
     TransferFunctionProperty& setDefault(const TransferFunction& tf);
     virtual TransferFunctionProperty& resetToDefaultState() override;
@@ -281,8 +295,10 @@ private:
     ValueWrapper<HistogramSelection> histogramSelection_;
 
     TFLookupTable lookup_;
+    TFLookupTable preIntegrated_;
     TFData data_;
     bool invalidLookup_;
+    bool invalidPreIntegrated_;
 };
 
 }  // namespace inviwo
@@ -0,0 +1,204 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/network/processornetworkevaluationobserver.h>
+#include <inviwo/core/util/dispatcher.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+namespace inviwo {
+
+class ProcessorNetworkEvaluator;
+
+/**
+ * \ingroup resourcemanager
+ * Keeps the memory used by data representations within a budget by evicting the least recently
+ * used representations that can be recreated.
+ *
+ * Representation types are registered with the pool they allocate from, the core registers the
+ * RAM representations and the OpenGL module the GL representations. Every time Data returns a
+ * representation of a registered type it is recorded here together with its size. When a network
+ * evaluation has finished, representations that were not used in that evaluation are evicted in
+ * least recently used order until each pool is within its budget.
+ *
+ * A representation is only evicted if the Data has another valid representation to recreate it
+ * from, e.g. a VolumeRAM when there is a VolumeDisk, or the VolumeGL of a time step that was not
+ * rendered. Representations that are shared outside of the Data, for example through
+ * Data::getRepresentationShared, are never evicted. Raw pointers returned by
+ * Data::getRepresentation are only safe to use until the end of the evaluation, or until a
+ * handle returned by hold() is released. Anything that keeps a representation for longer, e.g. a
+ * VolumeSampler, should hold it through a shared_ptr.
+ *
+ * @see ResourceManager
+ */
+class IVW_CORE_API MemoryBudget : public ProcessorNetworkEvaluationObserver {
+public:
+    enum class Pool : std::uint8_t { RAM, GL };
+    static constexpr std::array<std::string_view, 2> names = {"RAM", "GL"};
+
+    /**
+     * Try to remove the representation of @p type from the Data @p owner.
+     * @return true if the representation is no longer there, false if it has to be kept.
+     */
+    using Evict = bool (*)(const void* owner, std::type_index type);
+
+    explicit MemoryBudget(ProcessorNetworkEvaluator* evaluator);
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+    virtual ~MemoryBudget();
+
+    /**
+     * Set the budget of @p pool in bytes, 0 means unlimited. The budget is enabled as long as
+     * any pool has a limit.
+     */
+    void setBudget(Pool pool, size_t bytes);
+    size_t getBudget(Pool pool) const;
+    size_t getUsage(Pool pool) const;
+    /**
+     * @return the fraction of the budget used for @p pool, or 0 if the pool is unlimited.
+     */
+    double getPressure(Pool pool) const;
+
+    template <typename T>
+    void registerRepresentation(Pool pool) {
+        registerRepresentation(std::type_index{typeid(T)}, pool);
+    }
+    void registerRepresentation(std::type_index type, Pool pool);
+    void unregisterRepresentation(std::type_index type);
+
+    /**
+     * Record a use of the representation of @p type in @p owner. Called by Data.
+     */
+    template <typename Repr>
+    void touch(const void* owner, const Repr& repr, Evict evict) {
+        touch(owner, repr.getTypeIndex(), sizeInBytes(repr), evict);
+    }
+    void touch(const void* owner, std::type_index type, size_t bytes, Evict evict);
+
+    /**
+     * Remove all records of @p owner. Called when a Data is destroyed.
+     */
+    void forget(const void* owner);
+
+    /**
+     * Evict representations until all pools are within budget. Representations used after the
+     * start of the current network evaluation, or protected by a hold, are kept.
+     * @return the number of bytes evicted
+     */
+    size_t enforce();
+
+    /**
+     * Keep representations used since the start of the current network evaluation, or later, from
+     * being evicted until the returned handle is destroyed. Taken by PoolProcessor for each
+     * dispatch since its jobs can use raw representation pointers after the evaluation has ended.
+     */
+    std::shared_ptr<void> hold();
+
+    /**
+     * The enabled budget if there is one, used by Data to only pay for the bookkeeping when
+     * needed.
+     */
+    static MemoryBudget* getEnabled();
+
+    /**
+     * Called after each enforce, and when a budget changes.
+     */
+    std::shared_ptr<std::function<void()>> onChange(std::function<void()> callback);
+
+    template <typename Repr>
+    static size_t sizeInBytes(const Repr& repr) {
+        if constexpr (requires {
+                          repr.getDimensions().length();
+                          repr.getDataFormat()->getSizeInBytes();
+                      }) {
+            size_t size = repr.getDataFormat()->getSizeInBytes();
+            const auto& dims = repr.getDimensions();
+            for (decltype(dims.length()) i = 0; i < dims.length(); ++i) size *= dims[i];
+            return size;
+        } else if constexpr (requires {
+                                 repr.getSize();
+                                 repr.getDataFormat()->getSizeInBytes();
+                             }) {
+            return repr.getSize() * repr.getDataFormat()->getSizeInBytes();
+        } else {
+            return 0;
+        }
+    }
+
+private:
+    virtual void onProcessorNetworkEvaluationBegin() override;
+    virtual void onProcessorNetworkEvaluationEnd() override;
+
+    void updateEnabled();
+    // Requires mutex_ to be locked
+    size_t evict(Pool pool);
+
+    struct Entry {
+        Pool pool;
+        size_t bytes;
+        std::uint64_t tick;
+        Evict evict;
+    };
+    struct KeyHash {
+        size_t operator()(const std::pair<const void*, std::type_index>& key) const {
+            return std::hash<const void*>{}(key.first) ^ (key.second.hash_code() << 1);
+        }
+    };
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::type_index, Pool> types_;
+    std::unordered_map<std::pair<const void*, std::type_index>, Entry, KeyHash> entries_;
+    std::array<size_t, 2> budget_{0, 0};
+    std::array<size_t, 2> usage_{0, 0};
+    std::uint64_t tick_ = 0;
+    std::uint64_t evaluationStart_ = 0;
+
+    // The evaluation start of each live hold, shared with the handles since they can outlive us
+    struct Holds {
+        std::mutex mutex;
+        std::multiset<std::uint64_t> ticks;
+    };
+    std::shared_ptr<Holds> holds_;
+    Dispatcher<void()> onChange_;
+};
+
+}  // namespace inviwo
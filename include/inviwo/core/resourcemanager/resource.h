@@ -62,8 +62,14 @@ struct IVW_CORE_API RAM {
     auto operator<=>(const RAM&) const = default;
     static constexpr std::string_view name = "RAM";
 };
+/**
+ * Texture and buffer names are allocated independently by OpenGL, so the same key can refer to
+ * both a texture and a buffer, @p kind tells them apart.
+ */
 struct IVW_CORE_API GL {
+    enum class Kind : std::uint8_t { Texture, Buffer };
     unsigned int key;
+    Kind kind = Kind::Texture;
     auto operator<=>(const GL&) const = default;
     static constexpr std::string_view name = "GL";
 };
@@ -114,7 +120,8 @@ struct std::hash<inviwo::resource::RAM> {
 template <>
 struct std::hash<inviwo::resource::GL> {
     size_t operator()(const inviwo::resource::GL& item) const {
-        return std::hash<decltype(item.key)>{}(item.key);
+        return std::hash<decltype(item.key)>{}(item.key) ^
+               (static_cast<size_t>(item.kind) << (sizeof(size_t) * 8 - 1));
     }
 };
 template <>
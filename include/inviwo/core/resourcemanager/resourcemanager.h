@@ -35,9 +35,13 @@
 #include <inviwo/core/util/foreacharg.h>
 #include <inviwo/core/util/stdextensions.h>
 
+#include <array>
+#include <string>
 #include <unordered_map>
 #include <tuple>
+#include <utility>
 #include <variant>
+#include <vector>
 
 namespace inviwo {
 
@@ -60,13 +64,17 @@ public:
         auto it = std::ranges::find(group, key, &std::pair<Key, Resource>::first);
         if (it == group.end()) {
             notifyWillAddResource(gi, group.size(), resource);
+            bytes_[gi] += resource.sizeInBytes();
             group.emplace_back(key, std::move(resource));
             notifyDidAddResource(gi, group.size() - 1, group.back().second);
         } else {
             notifyWillUpdateResource(gi, std::distance(group.begin(), it), it->second);
+            bytes_[gi] -= it->second.sizeInBytes();
+            bytes_[gi] += resource.sizeInBytes();
             it->second = std::move(resource);
             notifyDidUpdateResource(gi, std::distance(group.begin(), it), it->second);
         }
+        checkWarningThreshold(gi);
     }
 
     template <typename Key>
@@ -90,6 +98,7 @@ public:
         if (it != group.end()) {
             notifyWillRemoveResource(gi, std::distance(group.begin(), it), it->second);
             Resource resource{std::move(it->second)};
+            bytes_[gi] -= resource.sizeInBytes();
             it = group.erase(it);
             notifyDidRemoveResource(gi, std::distance(group.begin(), it), resource);
             return resource;
@@ -108,19 +117,24 @@ public:
                           getGroup(groupIndex));
     }
 
-#include <warn/push>
-#include <warn/ignore/unused-but-set-variable>
     size_t totalByteSize(size_t groupIndex) const {
-        static constexpr auto byteSize = [](const auto& elem) { return elem.second.sizeInBytes(); };
-        static constexpr auto sum = [](const auto& vec) {
-            return std::transform_reduce(vec->begin(), vec->end(), size_t{0}, std::plus<>(),
-                                         byteSize);
-        };
-        return std::visit(util::overloaded{[](std::monostate) -> size_t { return 0; },
-                                           [](const auto& list) -> size_t { return sum(list); }},
-                          getGroup(groupIndex));
+        return groupIndex < bytes_.size() ? bytes_[groupIndex] : 0;
     }
-#include <warn/pop>
+
+    /**
+     * The number of bytes of @p groupIndex used by each processor, largest first. Resources are
+     * attributed to a processor through the port path in their ResourceMeta. Resources without
+     * meta, i.e. not (yet) set on an outport, are collected under an empty identifier.
+     */
+    std::vector<std::pair<std::string, size_t>> bytesPerProcessor(size_t groupIndex) const;
+
+    /**
+     * Log a warning, including the largest users, when the resources of @p groupIndex use more
+     * than @p bytes. The warning is not repeated until the usage has gone below the threshold
+     * again. 0 disables the warning.
+     */
+    void setWarningThreshold(size_t groupIndex, size_t bytes);
+    size_t getWarningThreshold(size_t groupIndex) const;
 
     const Resource* get(size_t groupIndex, size_t index) const {
         return std::visit(
@@ -145,7 +159,14 @@ public:
             data_);
     }
 
+    template <typename Key>
+    static constexpr size_t groupIndex() {
+        return util::index_of<Key, Keys>();
+    }
+
 private:
+    void checkWarningThreshold(size_t groupIndex);
+
     auto getGroup(size_t groupIndex) const -> Var {
         Var v{};
         util::for_each_in_tuple(
@@ -168,12 +189,10 @@ private:
         return std::get<std::vector<std::pair<Key, Resource>>>(data_);
     }
 
-    template <typename Key>
-    static constexpr size_t groupIndex() {
-        return util::index_of<Key, Keys>();
-    }
-
     Data data_;
+    std::array<size_t, std::tuple_size_v<Keys>> bytes_{};
+    std::array<size_t, std::tuple_size_v<Keys>> warningThreshold_{};
+    std::array<bool, std::tuple_size_v<Keys>> warned_{};
 };
 
 }  // namespace inviwo
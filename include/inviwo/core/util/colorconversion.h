@@ -34,6 +34,7 @@
 
 #include <string>
 #include <string_view>
+#include <span>
 #include <cmath>
 
 namespace inviwo::color {
@@ -480,4 +481,41 @@ constexpr uvec3 darker(const uvec3& rgb, float factor = 2.0f) {
     return uvec3{darker(vec3{rgb} / 255.0f, factor) * 255.0f};
 }
 
+/**
+ * Color space conversions that can be applied in bulk, see convert()
+ */
+enum class Conversion {
+    RgbToHsv,    ///< rgb2hsv()
+    HsvToRgb,    ///< hsv2rgb()
+    RgbToHsl,    ///< rgb2hsl()
+    HslToRgb,    ///< hsl2rgb()
+    RgbToXYZ,    ///< rgb2XYZ()
+    XYZToRgb,    ///< XYZ2rgb()
+    RgbToLab,    ///< rgb2lab()
+    LabToRgb,    ///< lab2rgb()
+    RgbToYCbCr,  ///< rgb2ycbcr()
+    YCbCrToRgb   ///< ycbcr2rgb()
+};
+
+/**
+ * \brief Apply \p conversion to all colors of \p src and write the results to \p dst
+ *
+ * Gives the same results as calling the per-color function on each value, up to float rounding.
+ * The colors are transposed into blocks of separate channels where the conversion is done without
+ * branches, which lets the compiler vectorize it. Large spans are split over the thread pool.
+ * \p src and \p dst may be the same span to convert in place, but must not otherwise overlap.
+ *
+ * @param conversion the color spaces to convert between
+ * @param src colors to convert
+ * @param dst destination of the converted colors, same size as \p src
+ * @throw Exception if the sizes of \p src and \p dst differ
+ */
+IVW_CORE_API void convert(Conversion conversion, std::span<const vec3> src, std::span<vec3> dst);
+
+/**
+ * \overload void convert(Conversion, std::span<const vec3>, std::span<vec3>)
+ * Convert \p colors in place.
+ */
+IVW_CORE_API void convert(Conversion conversion, std::span<vec3> colors);
+
 }  // namespace inviwo::color
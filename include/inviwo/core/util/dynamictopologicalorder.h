@@ -0,0 +1,305 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace inviwo::util {
+
+/**
+ * Maintains a topological order of a directed acyclic graph under insertion and removal of
+ * nodes and edges, without re-sorting the whole graph on every change.
+ *
+ * Edge insertions are batched: added edges are kept pending until update() is called. If only a
+ * few edges are pending, they are inserted one at a time using the dynamic topological sort of
+ * Pearce and Kelly, which only reorders the nodes between the end points of the new edge. If many
+ * edges are pending, e.g. after loading a workspace, the order is instead rebuilt once in linear
+ * time. Node and edge removals never invalidate a topological order and are applied directly.
+ *
+ * Parallel edges are allowed and reference counted. If an inserted edge would close a cycle the
+ * edge is kept, the nodes of the cycle are left in unspecified order, and the order is rebuilt in
+ * each update() until the cycle has been removed.
+ *
+ * @see D. J. Pearce, P. H. J. Kelly, "A dynamic topological sort algorithm for directed acyclic
+ * graphs", ACM Journal of Experimental Algorithmics, 2007.
+ */
+template <typename T, typename Hash = std::hash<T>>
+class DynamicTopologicalOrder {
+public:
+    DynamicTopologicalOrder() = default;
+
+    /**
+     * Add a node last in the order. Does nothing if the node is already added.
+     */
+    void addNode(const T& node) {
+        if (nodes_.contains(node)) return;
+        nodes_.try_emplace(node, Node{order_.size(), {}, {}});
+        order_.push_back(node);
+        valid_.push_back(true);
+    }
+
+    /**
+     * Remove a node and all its edges, including pending ones.
+     */
+    void removeNode(const T& node) {
+        auto it = nodes_.find(node);
+        if (it == nodes_.end()) return;
+
+        for (const auto& [succ, count] : it->second.out) nodes_.at(succ).in.erase(node);
+        for (const auto& [pred, count] : it->second.in) nodes_.at(pred).out.erase(node);
+        std::erase_if(pending_, [&](const auto& e) { return e.first == node || e.second == node; });
+
+        valid_[it->second.ord] = false;
+        ++holes_;
+        nodes_.erase(it);
+    }
+
+    /**
+     * Add an edge from @p from to @p to, meaning that @p from has to come before @p to. Nodes are
+     * added if needed. The order is updated lazily in the next call to update().
+     */
+    void addEdge(const T& from, const T& to) {
+        addNode(from);
+        addNode(to);
+        pending_.emplace_back(from, to);
+    }
+
+    /**
+     * Remove one instance of the edge from @p from to @p to.
+     */
+    void removeEdge(const T& from, const T& to) {
+        if (auto it = std::ranges::find(pending_, std::pair{from, to}); it != pending_.end()) {
+            pending_.erase(it);
+            return;
+        }
+        auto fit = nodes_.find(from);
+        auto tit = nodes_.find(to);
+        if (fit == nodes_.end() || tit == nodes_.end()) return;
+
+        if (auto oit = fit->second.out.find(to); oit != fit->second.out.end()) {
+            if (--oit->second == 0) {
+                fit->second.out.erase(oit);
+                tit->second.in.erase(from);
+            } else {
+                --tit->second.in[from];
+            }
+        }
+    }
+
+    bool contains(const T& node) const { return nodes_.contains(node); }
+    size_t size() const { return nodes_.size(); }
+    bool empty() const { return nodes_.empty(); }
+
+    /**
+     * All successors of @p node, excluding pending edges.
+     */
+    template <typename Func>
+    void forEachSuccessor(const T& node, Func&& func) const {
+        if (auto it = nodes_.find(node); it != nodes_.end()) {
+            for (const auto& item : it->second.out) func(item.first);
+        }
+    }
+
+    /**
+     * Apply all pending changes and return the nodes in topological order.
+     */
+    const std::vector<T>& update() {
+        if (cyclic_) {
+            for (const auto& [from, to] : pending_) insert(from, to);
+            pending_.clear();
+            rebuild();
+        } else if (!pending_.empty()) {
+            if (pending_.size() * rebuildFactor > nodes_.size()) {
+                for (const auto& [from, to] : pending_) insert(from, to);
+                pending_.clear();
+                rebuild();
+            } else {
+                auto pending = std::move(pending_);
+                pending_.clear();
+                for (const auto& [from, to] : pending) {
+                    insert(from, to);
+                    if (!reorder(from, to)) {
+                        rebuild();
+                    }
+                }
+            }
+        }
+        if (holes_ > 0) compact();
+        return order_;
+    }
+
+private:
+    /// A batch larger than size() / rebuildFactor is resolved by rebuilding the order
+    static constexpr size_t rebuildFactor = 8;
+
+    struct Node {
+        size_t ord;
+        std::unordered_map<T, size_t, Hash> out;
+        std::unordered_map<T, size_t, Hash> in;
+    };
+
+    void insert(const T& from, const T& to) {
+        ++nodes_.at(from).out[to];
+        ++nodes_.at(to).in[from];
+    }
+
+    /**
+     * Pearce-Kelly reordering after inserting the edge x -> y.
+     * @return false if the edge closes a cycle.
+     */
+    bool reorder(const T& x, const T& y) {
+        const auto ub = nodes_.at(x).ord;
+        const auto lb = nodes_.at(y).ord;
+        if (lb > ub) return true;
+        if (lb == ub) return false;
+
+        std::vector<T> forward;
+        std::vector<T> backward;
+        std::unordered_set<T, Hash> visited;
+        std::vector<T> stack;
+
+        // Nodes reachable from y that are ordered before x
+        stack.push_back(y);
+        visited.insert(y);
+        while (!stack.empty()) {
+            auto n = std::move(stack.back());
+            stack.pop_back();
+            forward.push_back(n);
+            for (const auto& item : nodes_.at(n).out) {
+                const auto ord = nodes_.at(item.first).ord;
+                if (ord == ub) return false;
+                if (ord < ub && visited.insert(item.first).second) stack.push_back(item.first);
+            }
+        }
+
+        // Nodes that reach x that are ordered after y
+        stack.push_back(x);
+        visited.insert(x);
+        while (!stack.empty()) {
+            auto n = std::move(stack.back());
+            stack.pop_back();
+            backward.push_back(n);
+            for (const auto& item : nodes_.at(n).in) {
+                const auto ord = nodes_.at(item.first).ord;
+                if (ord > lb && visited.insert(item.first).second) stack.push_back(item.first);
+            }
+        }
+
+        const auto byOrd = [&](const T& a, const T& b) {
+            return nodes_.at(a).ord < nodes_.at(b).ord;
+        };
+        std::ranges::sort(forward, byOrd);
+        std::ranges::sort(backward, byOrd);
+
+        std::vector<size_t> slots;
+        slots.reserve(forward.size() + backward.size());
+        for (const auto& n : backward) slots.push_back(nodes_.at(n).ord);
+        for (const auto& n : forward) slots.push_back(nodes_.at(n).ord);
+        std::ranges::sort(slots);
+
+        auto slot = slots.begin();
+        for (const auto& n : backward) assign(n, *slot++);
+        for (const auto& n : forward) assign(n, *slot++);
+        return true;
+    }
+
+    void assign(const T& node, size_t ord) {
+        nodes_.at(node).ord = ord;
+        order_[ord] = node;
+    }
+
+    /**
+     * Kahn's algorithm, seeded in the current order to keep the result as stable as possible.
+     */
+    void rebuild() {
+        std::vector<T> order;
+        order.reserve(nodes_.size());
+        std::unordered_map<T, size_t, Hash> degree;
+        std::deque<T> ready;
+        for (size_t i = 0; i < order_.size(); ++i) {
+            if (!valid_[i]) continue;
+            const auto& node = nodes_.at(order_[i]);
+            if (node.in.empty()) {
+                ready.push_back(order_[i]);
+            } else {
+                degree[order_[i]] = node.in.size();
+            }
+        }
+        while (!ready.empty()) {
+            auto n = std::move(ready.front());
+            ready.pop_front();
+            for (const auto& item : nodes_.at(n).out) {
+                if (--degree[item.first] == 0) ready.push_back(item.first);
+            }
+            order.push_back(std::move(n));
+        }
+        cyclic_ = order.size() != nodes_.size();
+        if (cyclic_) {
+            // A cycle, append the remaining nodes in their previous order
+            for (size_t i = 0; i < order_.size(); ++i) {
+                if (valid_[i] && degree.contains(order_[i]) && degree[order_[i]] != 0) {
+                    order.push_back(order_[i]);
+                }
+            }
+        }
+        setOrder(std::move(order));
+    }
+
+    void compact() {
+        std::vector<T> order;
+        order.reserve(nodes_.size());
+        for (size_t i = 0; i < order_.size(); ++i) {
+            if (valid_[i]) order.push_back(std::move(order_[i]));
+        }
+        setOrder(std::move(order));
+    }
+
+    void setOrder(std::vector<T> order) {
+        order_ = std::move(order);
+        valid_.assign(order_.size(), true);
+        holes_ = 0;
+        for (size_t i = 0; i < order_.size(); ++i) nodes_.at(order_[i]).ord = i;
+    }
+
+    std::unordered_map<T, Node, Hash> nodes_;
+    std::vector<T> order_;
+    std::vector<bool> valid_;
+    size_t holes_ = 0;
+    std::vector<std::pair<T, T>> pending_;
+    bool cyclic_ = false;
+};
+
+}  // namespace inviwo::util
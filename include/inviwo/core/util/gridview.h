@@ -0,0 +1,107 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/glm.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace inviwo {
+
+template <typename T>
+class VolumeRAMPrecision;
+template <typename T>
+class LayerRAMPrecision;
+
+namespace util {
+
+/**
+ * A non-owning, typed N-dimensional view of the data of a VolumeRAMPrecision or
+ * LayerRAMPrecision. Accessing a value through the view is a plain index computation, unlike the
+ * virtual getAsDVec4 / setFromDVec4 family of VolumeRAM and LayerRAM that converts through
+ * double. Use it together with a format dispatch to write per voxel loops that only pay for the
+ * dispatch once.
+ * @see gridView forEachVoxelValueParallel
+ */
+template <typename T, size_t N>
+class GridView {
+public:
+    using value_type = std::remove_cv_t<T>;
+    using Index = Vector<N, size_t>;
+
+    constexpr GridView(std::span<T> data, const Index& dims) noexcept
+        : data_{data}, dims_{dims}, im_{dims} {}
+
+    constexpr operator GridView<const T, N>() const noexcept { return {data_, dims_}; }
+
+    constexpr T& operator[](const Index& pos) const noexcept { return data_[im_(pos)]; }
+
+    template <typename... Is>
+        requires(sizeof...(Is) == N)
+    constexpr T& operator()(Is... is) const noexcept {
+        return data_[im_(static_cast<size_t>(is)...)];
+    }
+
+    constexpr const Index& getDimensions() const noexcept { return dims_; }
+    constexpr std::span<T> data() const noexcept { return data_; }
+    constexpr size_t size() const noexcept { return data_.size(); }
+    constexpr auto begin() const noexcept { return data_.begin(); }
+    constexpr auto end() const noexcept { return data_.end(); }
+
+private:
+    std::span<T> data_;
+    Index dims_;
+    IndexMapper<N, size_t> im_;
+};
+
+template <typename T>
+GridView<T, 3> gridView(VolumeRAMPrecision<T>& volume) {
+    return {volume.getView(), volume.getDimensions()};
+}
+template <typename T>
+GridView<const T, 3> gridView(const VolumeRAMPrecision<T>& volume) {
+    return {volume.getView(), volume.getDimensions()};
+}
+template <typename T>
+GridView<T, 2> gridView(LayerRAMPrecision<T>& layer) {
+    return {layer.getView(), layer.getDimensions()};
+}
+template <typename T>
+GridView<const T, 2> gridView(const LayerRAMPrecision<T>& layer) {
+    return {layer.getView(), layer.getDimensions()};
+}
+
+}  // namespace util
+
+}  // namespace inviwo
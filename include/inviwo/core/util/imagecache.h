@@ -36,6 +36,7 @@
 
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 namespace inviwo {
 
@@ -43,6 +44,11 @@ class Image;
 
 /**
  * \class ImageCache
+ * Keeps resized versions of a master image. Large reductions are not done from the master
+ * directly, instead a chain of mip levels, each half the size of the previous one, is created on
+ * demand and kept until the master changes. An image is then resampled from the smallest level
+ * that is still at least as large, which is less work and, since each step halves the size, also
+ * avoids the aliasing of a single bilinear copy on the GPU.
  */
 class IVW_CORE_API ImageCache {
 public:
@@ -72,9 +78,18 @@ public:
     size_t size() const;
 
 private:
+    /**
+     * The image to resample from for @p dimensions, the master or one of its mip levels. Creates
+     * and updates the levels needed.
+     */
+    const Image& source(size2_t dimensions) const;
+
     mutable bool valid_;
     std::shared_ptr<const Image> master_;  // non-owning reference.
 
+    mutable std::vector<std::shared_ptr<Image>> levels_;
+    mutable size_t validLevels_ = 0;  // number of levels that are up to date with the master
+
     using Cache = std::unordered_map<glm::size2_t, std::shared_ptr<Image>>;
     mutable Cache cache_;
 };
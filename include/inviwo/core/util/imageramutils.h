@@ -31,9 +31,11 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/util/glmvec.h>
+#include <inviwo/core/util/colorconversion.h>
 #include <inviwo/core/datastructures/image/image.h>
 #include <inviwo/core/datastructures/image/layer.h>
 #include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/util/gridview.h>
 
 #include <memory>
 #include <vector>
@@ -98,6 +100,71 @@ void forEachPixelParallel(const LayerRAM& layer, C callback, size_t jobs = 0) {
     forEachPixelParallel(layer.getDimensions(), callback, jobs);
 }
 
+/**
+ * Dispatch once on the format of @p layer and call @p callback with a reference to the value of
+ * each pixel, as its actual type, and its position. This avoids the virtual, double converting
+ * per pixel accessors of LayerRAM in hot loops. The callback is instantiated for each format
+ * matching @p Predicate, the default is all formats.
+ * \code{.cpp}
+ * util::forEachPixelValue(*layerRam, [&](const auto& value, const size2_t& pos) { ... });
+ * \endcode
+ * @see GridView
+ */
+template <template <class> class Predicate = dispatching::filter::All, typename C>
+void forEachPixelValue(const LayerRAM& layer, C callback) {
+    layer.dispatch<void, Predicate>([&](const auto* ramprecision) {
+        const auto view = util::gridView(*ramprecision);
+        forEachPixel(view.getDimensions(), [&](const size2_t& pos) { callback(view[pos], pos); });
+    });
+}
+
+/**
+ * Mutable version of forEachPixelValue, @p callback gets a non-const reference to each value.
+ */
+template <template <class> class Predicate = dispatching::filter::All, typename C>
+void forEachPixelValue(LayerRAM& layer, C callback) {
+    layer.dispatch<void, Predicate>([&](auto* ramprecision) {
+        const auto view = util::gridView(*ramprecision);
+        forEachPixel(view.getDimensions(), [&](const size2_t& pos) { callback(view[pos], pos); });
+    });
+}
+
+/**
+ * Parallel version of forEachPixelValue, @p callback has to be safe to call from several threads.
+ * @see forEachPixelValue
+ */
+template <template <class> class Predicate = dispatching::filter::All, typename C>
+void forEachPixelValueParallel(const LayerRAM& layer, C callback, size_t jobs = 0) {
+    layer.dispatch<void, Predicate>([&](const auto* ramprecision) {
+        const auto view = util::gridView(*ramprecision);
+        forEachPixelParallel(
+            view.getDimensions(), [&](const size2_t& pos) { callback(view[pos], pos); }, jobs);
+    });
+}
+
+/**
+ * Mutable parallel version of forEachPixelValue, @p callback has to be safe to call from several
+ * threads.
+ * @see forEachPixelValue
+ */
+template <template <class> class Predicate = dispatching::filter::All, typename C>
+void forEachPixelValueParallel(LayerRAM& layer, C callback, size_t jobs = 0) {
+    layer.dispatch<void, Predicate>([&](auto* ramprecision) {
+        const auto view = util::gridView(*ramprecision);
+        forEachPixelParallel(
+            view.getDimensions(), [&](const size2_t& pos) { callback(view[pos], pos); }, jobs);
+    });
+}
+
+/**
+ * Convert the color of each pixel of @p layer in place using color::convert(), in parallel over the
+ * thread pool. The first three channels are converted and a fourth channel is left as is. Integer
+ * formats are normalized to [0,1] before, and clamped to [0,1] after the conversion. Conversions
+ * into color spaces outside of the unit cube, like Lab and XYZ, hence need a floating point layer.
+ * @throw Exception if the layer has less than three channels
+ */
+IVW_CORE_API void convertColors(LayerRAM& layer, color::Conversion conversion);
+
 IVW_CORE_API void flipLayerVertical(Layer& layer);
 IVW_CORE_API void flipLayerHorizontal(Layer& layer);
 
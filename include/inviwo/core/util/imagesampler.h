@@ -63,7 +63,7 @@ public:
      */
     ImageSampler(const Layer* layer)
         : SpatialSampler<ReturnType>(*layer)
-        , layer_(layer->getRepresentation<LayerRAM>())
+        , layer_(layer->getRepresentationShared<LayerRAM>())
         , dims_(layer->getDimensions())
         , sharedImage_(nullptr) {}
 
@@ -134,7 +134,8 @@ private:
         auto p = glm::clamp(pos, size2_t(0), dims_ - size2_t(1));
         return static_cast<ReturnType>(layer_->getAsDVec4(p));
     }
-    const LayerRAM* layer_;
+    // Held shared so that a MemoryBudget does not evict it while the sampler is alive
+    std::shared_ptr<const LayerRAM> layer_;
     size2_t dims_;
 
     std::shared_ptr<const Image> sharedImage_;
@@ -186,6 +187,7 @@ protected:
     virtual bool withinBoundsDataSpace(const dvec3& pos) const override;
 
     ReturnType getPixel(const size2_t& pos) const;
+    std::shared_ptr<const LayerRAM> ram_;
     const DataType* data_;
     size2_t dims_;
     util::IndexMapper2D ic_;
@@ -196,7 +198,8 @@ protected:
 template <typename ReturnType, typename DataType>
 TemplateImageSampler<ReturnType, DataType>::TemplateImageSampler(const Layer* layer)
     : SpatialSampler<ReturnType>(*layer)
-    , data_(static_cast<const DataType*>(layer->getRepresentation<LayerRAM>()->getData()))
+    , ram_(layer->getRepresentationShared<LayerRAM>())
+    , data_(static_cast<const DataType*>(ram_->getData()))
     , dims_(layer->getDimensions())
     , ic_(dims_)
     , sharedImage_(nullptr) {
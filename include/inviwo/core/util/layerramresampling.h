@@ -0,0 +1,73 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+namespace inviwo {
+
+class LayerRAM;
+
+namespace util {
+
+/**
+ * Filters for resampling layers with util::resample
+ */
+enum class ResamplingFilter {
+    Nearest,  ///< nearest neighbor
+    Box,      ///< average of all covered samples, like a moving average
+    Linear,   ///< tent filter, bilinear when up sampling
+    Lanczos   ///< three lobed Lanczos window, sharper but can over- and undershoot
+};
+
+enum class ConsiderAspectRatio { No, Yes };
+
+/**
+ * \brief Resample the data of @p src into @p dst using @p filter
+ *
+ * Works directly on the data of the LayerRAMPrecision, without converting the format. The filter
+ * is separable and applied first along x and then along y, both passes in parallel over the
+ * thread pool. When down sampling the filter is widened to cover all source samples, so that
+ * there is no aliasing. Samples outside of the source are clamped to the edge. For integer formats
+ * the result is rounded and clamped to the range of the type. Both layers keep their dimensions.
+ *
+ * @param src the layer to resample
+ * @param dst the destination, with the wanted dimensions
+ * @param filter the filter to use for resampling
+ * @param aspectRatio If ConsiderAspectRatio::Yes, the aspect ratio of @p src is kept and the
+ *        result is centered in @p dst, the pixels outside of it are set to zero.
+ * @return false if the formats of @p src and @p dst differ or one of them is empty
+ */
+IVW_CORE_API bool resample(const LayerRAM& src, LayerRAM& dst, ResamplingFilter filter,
+                           ConsiderAspectRatio aspectRatio = ConsiderAspectRatio::No);
+
+}  // namespace util
+
+}  // namespace inviwo
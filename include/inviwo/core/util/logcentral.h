@@ -39,6 +39,7 @@
 #include <string>
 #include <string_view>
 #include <vector>
+#include <memory>
 
 #include <fmt/base.h>
 
@@ -120,7 +121,7 @@ public:
 class IVW_CORE_API LogCentral : public Singleton<LogCentral>, public Logger {
 public:
     LogCentral();
-    virtual ~LogCentral() = default;
+    virtual ~LogCentral();
 
     void setVerbosity(LogVerbosity verbosity);
     LogVerbosity getVerbosity();
@@ -142,17 +143,52 @@ public:
     void setMessageBreakLevel(MessageBreakLevel level);
     MessageBreakLevel getMessageBreakLevel() const;
 
+    /**
+     * \brief Dispatch messages to the registered loggers from a background thread.
+     * In asynchronous mode log() only copies the message into a lock-free queue and returns, a
+     * background thread then forwards the messages to the loggers in order. This avoids
+     * serializing threads that log heavily. Stack traces and message breaks are still handled
+     * on the calling thread. If the queue is full the calling thread waits for the background
+     * thread to catch up. Should only be toggled while no other threads are logging.
+     * @see flush
+     */
+    void setAsynchronous(bool asynchronous);
+    bool isAsynchronous() const;
+
+    /**
+     * \brief Block until all messages logged so far have been dispatched to the loggers.
+     * Does nothing in synchronous mode.
+     */
+    void flush();
+
+    /**
+     * \brief Limit the number of info and warning messages from each call site.
+     * At most \p messagesPerSecond messages from the same file and line are forwarded to
+     * the loggers each second, the rest are dropped and the number of dropped messages is
+     * reported the next time the call site logs. Errors are never dropped. 0 means unlimited.
+     */
+    void setRateLimit(size_t messagesPerSecond);
+    size_t getRateLimit() const;
+
 private:
     friend Singleton<LogCentral>;
     static LogCentral* instance_;
 
+    void dispatch(std::string_view source, LogLevel level, LogAudience audience,
+                  std::string_view file, std::string_view function, int line,
+                  std::string_view msg);
+
+    struct State;
+
     LogVerbosity logVerbosity_;
 #include <warn/push>
 #include <warn/ignore/dll-interface>
     std::vector<std::weak_ptr<Logger>> loggers_;
+    std::unique_ptr<State> state_;
 #include <warn/pop>
     bool logStacktrace_ = false;
     MessageBreakLevel breakLevel_ = MessageBreakLevel::Off;
+    size_t rateLimit_ = 0;
 };
 
 namespace log {
@@ -214,14 +250,13 @@ inline void report(LogLevel level, std::string_view message,
 }
 
 namespace detail {
-inline void report(LogLevel level, SourceContext context, fmt::string_view format,
-                   fmt::format_args&& args) {
-    ::inviwo::log::report(level, context, fmt::vformat(format, args));
-}
-inline void report(Logger& logger, LogLevel level, SourceContext context, fmt::string_view format,
-                   fmt::format_args&& args) {
-    ::inviwo::log::report(logger, level, context, fmt::vformat(format, args));
-}
+/**
+ * Formats the message into a stack buffer, avoiding heap allocations for short messages
+ */
+IVW_CORE_API void report(LogLevel level, SourceContext context, fmt::string_view format,
+                         fmt::format_args&& args);
+IVW_CORE_API void report(Logger& logger, LogLevel level, SourceContext context,
+                         fmt::string_view format, fmt::format_args&& args);
 }  // namespace detail
 
 template <typename... Args>
@@ -0,0 +1,241 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/poolutils.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace inviwo {
+
+namespace util {
+
+/**
+ * Settings for util::parallelFor and util::parallelReduce
+ */
+struct ParallelSettings {
+    /// Number of indices in each task. If zero, the range is split into 4 * pool size tasks.
+    size_t grainSize = 0;
+    /// If given, tasks that have not yet started will be skipped once stop is set.
+    std::optional<pool::Stop> stop = std::nullopt;
+    /// If given, reports the fraction of finished tasks. Only called from the calling thread.
+    std::optional<pool::Progress> progress = std::nullopt;
+};
+
+namespace detail {
+
+inline size_t parallelGrainSize(size_t size, size_t grainSize, size_t poolSize) {
+    if (grainSize > 0) return grainSize;
+    const size_t jobs = std::max<size_t>(1, 4 * poolSize);
+    return std::max<size_t>(1, (size + jobs - 1) / jobs);
+}
+
+/**
+ * Call func(chunk) for chunk in [0, chunks) using the thread pool, and wait for all of them to
+ * finish. The chunks are claimed one at a time through a shared counter, both by helper tasks in
+ * the thread pool and by the calling thread itself. The caller only ever runs its own chunks, never
+ * unrelated queued tasks, and only waits for chunks that are already running on other threads.
+ * Hence it is safe to call from within a task running in the thread pool, and from the main
+ * thread without risking to run long queued jobs there.
+ */
+template <typename Func>
+void parallelChunks(size_t chunks, const ParallelSettings& settings, Func&& func) {
+    const auto reportProgress = [&](size_t done) {
+        if (settings.progress) (*settings.progress)(done, chunks);
+    };
+
+    if (chunks <= 1 || util::getPoolSize() == 0) {
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            if (settings.stop && *settings.stop) return;
+            func(chunk);
+            reportProgress(chunk + 1);
+        }
+        return;
+    }
+
+    // Helper tasks can start after we have returned, so they only keep the shared state. The
+    // function and the settings are only accessed for a claimed chunk, which we wait for.
+    struct State {
+        std::atomic<size_t> next = 0;
+        std::atomic<bool> failed = false;
+        std::mutex mutex;
+        std::condition_variable condition;
+        size_t done = 0;
+        std::exception_ptr error;
+    };
+    auto state = std::make_shared<State>();
+
+    const auto work = [chunks, &settings, &func](State& s) {
+        for (auto chunk = s.next++; chunk < chunks; chunk = s.next++) {
+            std::exception_ptr error;
+            if (!s.failed && !(settings.stop && *settings.stop)) {
+                try {
+                    func(chunk);
+                } catch (...) {
+                    s.failed = true;
+                    error = std::current_exception();
+                }
+            }
+            {
+                const std::scoped_lock lock{s.mutex};
+                if (error && !s.error) s.error = error;
+                ++s.done;
+            }
+            s.condition.notify_all();
+        }
+    };
+
+    auto& pool = util::getThreadPool();
+    const auto helpers = std::min(chunks - 1, pool.getSize());
+    for (size_t i = 0; i < helpers; ++i) {
+        pool.enqueueRaw([state, chunks, work]() {
+            if (state->next < chunks) work(*state);
+        });
+    }
+
+    work(*state);
+
+    std::unique_lock lock{state->mutex};
+    for (size_t reported = 0;;) {
+        state->condition.wait(lock, [&]() { return state->done > reported; });
+        reported = state->done;
+        lock.unlock();
+        reportProgress(reported);
+        lock.lock();
+        if (reported == chunks) break;
+    }
+    if (state->error) std::rethrow_exception(state->error);
+}
+
+}  // namespace detail
+
+/**
+ * Split the index range [begin, end) into chunks and call callback for each chunk using the
+ * Inviwo thread pool. The function returns once all chunks have been processed. If the pool size
+ * is zero everything is executed in the calling thread. Exceptions thrown by the callback are
+ * rethrown in the calling thread, remaining chunks are then skipped.
+ *
+ * @param begin first index of the range
+ * @param end one past the last index of the range
+ * @param callback is either called as `callback(size_t first, size_t last)` once for each chunk,
+ *        or as `callback(size_t index)` for each index in the range.
+ * @param settings grain size, stop token and progress reporting. If the stop token is set the
+ *        function will return without processing the remaining chunks.
+ *
+ * ```{.cpp}
+ * util::parallelFor(0, data.size(), [&](size_t i) { data[i] = f(i); }, {.grainSize = 1024});
+ * ```
+ */
+template <typename Callback>
+void parallelFor(size_t begin, size_t end, Callback&& callback,
+                 const ParallelSettings& settings = {}) {
+    static_assert(std::is_invocable_v<Callback, size_t, size_t> ||
+                      std::is_invocable_v<Callback, size_t>,
+                  "callback must be invocable as callback(first, last) or callback(index)");
+    if (begin >= end) return;
+
+    const size_t size = end - begin;
+    const size_t grain = detail::parallelGrainSize(size, settings.grainSize, util::getPoolSize());
+    const size_t chunks = (size + grain - 1) / grain;
+
+    detail::parallelChunks(chunks, settings, [&](size_t chunk) {
+        const size_t first = begin + chunk * grain;
+        const size_t last = std::min(end, first + grain);
+        if constexpr (std::is_invocable_v<Callback, size_t, size_t>) {
+            callback(first, last);
+        } else {
+            for (size_t i = first; i < last; ++i) callback(i);
+        }
+    });
+}
+
+/**
+ * Split the index range [begin, end) into chunks, call map(first, last) for each chunk using the
+ * Inviwo thread pool, and then combine the partial results in the calling thread.
+ * The partial results are always reduced from left to right in chunk order:
+ * `reduce(...reduce(reduce(init, map(chunk0)), map(chunk1))..., map(chunkN))`
+ * The chunk boundaries only depend on the grain size, hence specifying a grain size will give
+ * reproducible results, also for non associative operations like floating point addition,
+ * independent of the pool size.
+ *
+ * @param begin first index of the range
+ * @param end one past the last index of the range
+ * @param init the initial value of the reduction
+ * @param map called as `map(size_t first, size_t last) -> T` for each chunk
+ * @param reduce called as `reduce(T a, T b) -> T` to combine the partial results
+ * @param settings grain size, stop token and progress reporting. If the stop token is set, the
+ *        chunks that have not been processed will not be part of the reduction.
+ *
+ * ```{.cpp}
+ * auto sum = util::parallelReduce(0, data.size(), 0.0,
+ *     [&](size_t first, size_t last) {
+ *         return std::accumulate(data.begin() + first, data.begin() + last, 0.0);
+ *     },
+ *     std::plus<>{}, {.grainSize = 4096});
+ * ```
+ */
+template <typename T, typename Map, typename Reduce>
+T parallelReduce(size_t begin, size_t end, T init, Map&& map, Reduce&& reduce,
+                 const ParallelSettings& settings = {}) {
+    static_assert(std::is_invocable_r_v<T, Map, size_t, size_t>,
+                  "map must be invocable as map(first, last) -> T");
+    if (begin >= end) return init;
+
+    const size_t size = end - begin;
+    const size_t grain = detail::parallelGrainSize(size, settings.grainSize, util::getPoolSize());
+    const size_t chunks = (size + grain - 1) / grain;
+
+    std::vector<std::optional<T>> partials(chunks);
+    detail::parallelChunks(chunks, settings, [&](size_t chunk) {
+        const size_t first = begin + chunk * grain;
+        const size_t last = std::min(end, first + grain);
+        partials[chunk].emplace(map(first, last));
+    });
+
+    T result = std::move(init);
+    for (auto& partial : partials) {
+        if (partial) result = reduce(std::move(result), std::move(*partial));
+    }
+    return result;
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -59,4 +59,35 @@ PMRUnique<T> pmr_make_unique(std::pmr::polymorphic_allocator<std::byte> alloc, A
     return PMRUnique<T>(alloc.new_object<T>(std::forward<Args>(args)...), PMRDeleter{alloc});
 }
 
+/**
+ * \brief Marks a scope in which temporaries can be allocated from a thread local arena.
+ *
+ * Each thread has its own monotonic arena, hence allocating from it involves no locking and no
+ * contention between pool jobs. Deallocation is a no-op, all memory is reclaimed at once when the
+ * outermost ArenaScope of the thread ends. The ProcessorNetworkEvaluator opens a scope for each
+ * network evaluation and for each processor processed on the thread pool.
+ *
+ * Memory from the arena must not outlive the scope, i.e. it should only be used for temporaries,
+ * never for data that is put into outports or kept in members.
+ * @see arenaResource
+ */
+class IVW_CORE_API ArenaScope {
+public:
+    ArenaScope();
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope(ArenaScope&&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ArenaScope& operator=(ArenaScope&&) = delete;
+    ~ArenaScope();
+};
+
+/**
+ * \brief The arena of the calling thread if it is inside an ArenaScope, otherwise the default
+ * memory resource. Use with std::pmr containers for temporaries:
+ * @code
+ *     std::pmr::vector<size_t> indices{util::arenaResource()};
+ * @endcode
+ */
+IVW_CORE_API std::pmr::memory_resource* arenaResource();
+
 }  // namespace inviwo::util
@@ -0,0 +1,124 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/threadpool.h>
+
+#include <atomic>
+#include <cstddef>
+
+namespace inviwo {
+
+/** PoolProcessor utilities, also used by util::parallelFor and util::parallelReduce */
+namespace pool {
+
+/** PoolProcessor implementation details */
+namespace detail {
+
+/** Helper class to manage state for the background jobs */
+struct State;
+
+}  // namespace detail
+
+}  // namespace pool
+
+namespace async::detail {
+struct Context;
+}  // namespace async::detail
+
+namespace pool {
+
+/**
+ * A class to signal if a background calculation should stop or be aborted.
+ * Generally used by the background jobs to abort a calculation early:
+ * ```{.cpp}
+ * auto calc = [mystate](pool::Stop stop) {
+ *     for(...) {
+ *         if (stop) return nullptr;
+ *         // do work
+ *     }
+ *     return results;
+ * };
+ * ```
+ * For jobs dispatched with pool::Option::Background every check is also a preemption point,
+ * queued interactive jobs will be run on the calling thread before returning.
+ * \see PoolProcessor
+ */
+class IVW_CORE_API Stop {
+public:
+    operator bool() const noexcept {
+        if (yieldTo_) {
+            while (yieldTo_->tryRunInteractiveTask()) {}
+        }
+        return stop_.load();
+    }
+
+private:
+    friend ::inviwo::pool::detail::State;
+    friend ::inviwo::async::detail::Context;
+    explicit Stop(const std::atomic<bool>& stop, ThreadPool* yieldTo = nullptr)
+        : stop_{stop}, yieldTo_{yieldTo} {}
+    const std::atomic<bool>& stop_;  // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+    ThreadPool* yieldTo_;
+};
+
+/**
+ * A class to signal the progress of a background calculation:
+ * The progress reported should be in the range of [0.0, 1.0]. If the pool processor is running
+ * multiple jobs the progress will automatically be normalized. Only the progress of the last
+ * submitted job will be reported to the user.
+ * ```{.cpp}
+ * auto calc = [mystate](pool::Progress progress) {
+ *     for(int i = n; i < N; ++i) {
+ *         progress(i, N);
+ *         // do work
+ *     }
+ *     return results;
+ * };
+ * ```
+ * \see PoolProcessor
+ */
+class IVW_CORE_API Progress {
+public:
+    void operator()(float progress) const noexcept;
+    void operator()(double progress) const noexcept;
+    void operator()(size_t i, size_t max) const noexcept;
+
+private:
+    friend ::inviwo::pool::detail::State;
+    Progress(detail::State& state, size_t id) : state_{state}, id_{id} {}
+    detail::State& state_;
+    const size_t id_;
+};
+
+}  // namespace pool
+
+}  // namespace inviwo
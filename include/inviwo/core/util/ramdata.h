@@ -0,0 +1,106 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace inviwo {
+
+namespace util {
+
+namespace detail {
+
+/// Arrays of at least this many bytes are initialized in parallel by makeRAMData
+constexpr size_t largeRAMDataSize = size_t{16} << 20;
+
+template <typename T>
+constexpr bool isPlainRAMData = std::is_trivially_default_constructible_v<T> &&
+                                std::is_trivially_copyable_v<T>;
+
+/**
+ * Zero the bytes using the thread pool, after asking the OS to use transparent huge pages for the
+ * range where available
+ */
+IVW_CORE_API void zeroRAMData(void* data, size_t bytes);
+
+/**
+ * Copy the bytes using the thread pool, after asking the OS to use transparent huge pages for the
+ * range where available
+ */
+IVW_CORE_API void copyRAMData(void* dst, const void* src, size_t bytes);
+
+}  // namespace detail
+
+/**
+ * Allocate a value initialized array for the data of a RAM representation. Large arrays of plain
+ * types are not touched by the allocating thread, instead they are zeroed in parallel by the thread
+ * pool. With the first-touch policy of the OS the pages then end up on the NUMA nodes of the
+ * threads that process them in parallel kernels, rather than all on node of the allocating thread.
+ * The array can be freed using delete[] like any other data of a RAM representation.
+ */
+template <typename T>
+std::unique_ptr<T[]> makeRAMData(size_t size) {
+    if constexpr (detail::isPlainRAMData<T>) {
+        if (size * sizeof(T) >= detail::largeRAMDataSize) {
+            auto data = std::make_unique_for_overwrite<T[]>(size);
+            detail::zeroRAMData(data.get(), size * sizeof(T));
+            return data;
+        }
+    }
+    return std::make_unique<T[]>(size);
+}
+
+/**
+ * Allocate an array holding a copy of source, large arrays are copied in parallel.
+ * @see makeRAMData(size_t)
+ */
+template <typename T>
+std::unique_ptr<T[]> makeRAMData(std::span<const T> source) {
+    if constexpr (detail::isPlainRAMData<T>) {
+        if (source.size_bytes() >= detail::largeRAMDataSize) {
+            auto data = std::make_unique_for_overwrite<T[]>(source.size());
+            detail::copyRAMData(data.get(), source.data(), source.size_bytes());
+            return data;
+        }
+    }
+    auto data = std::make_unique<T[]>(source.size());
+    std::copy(source.begin(), source.end(), data.get());
+    return data;
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -32,6 +32,7 @@
 #include <inviwo/core/util/settings/settings.h>
 #include <inviwo/core/properties/optionproperty.h>
 #include <inviwo/core/properties/boolproperty.h>
+#include <inviwo/core/properties/buttonproperty.h>
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/properties/stringproperty.h>
 #include <inviwo/core/properties/multifileproperty.h>
@@ -50,6 +51,7 @@ public:
     SystemSettings(InviwoApplication* app);
     virtual ~SystemSettings();
     IntSizeTProperty poolSize_;
+    BoolProperty parallelEvaluation_;
     BoolProperty enablePortInspectors_;
     IntProperty portInspectorSize_;
     BoolProperty enableTouchProperty_;
@@ -57,12 +59,20 @@ public:
     BoolProperty enablePickingProperty_;
     BoolProperty enableSoundProperty_;
     BoolProperty logStackTraceProperty_;
+    BoolProperty asynchronousLogging_;
+    IntSizeTProperty logRateLimit_;
     MultiFileProperty moduleSearchPaths_;
     BoolProperty runtimeModuleReloading_;
     OptionProperty<MessageBreakLevel> breakOnMessage_;
     BoolProperty breakOnException_;
     BoolProperty stackTraceInException_;
     BoolProperty enableResourceTracking_;
+    IntSizeTProperty ramBudget_;
+    IntSizeTProperty glBudget_;
+    IntSizeTProperty glMemoryWarning_;
+    IntSizeTProperty resultCache_;
+    IntSizeTProperty sessionCache_;
+    ButtonProperty clearSessionCache_;
 
     BoolProperty redirectCout_;
     BoolProperty redirectCerr_;
@@ -59,7 +59,14 @@ THE SOFTWARE.
 #pragma once
 
 #include <inviwo/core/common/inviwocoredefine.h>
-
+#include <inviwo/core/util/foreach.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <vector>
 #include <map>
 #include <stack>
 #include <string>
@@ -84,11 +91,93 @@ public:
 
 using TokenQueue = std::queue<std::unique_ptr<TokenBase>>;
 
+/**
+ * An expression compiled into a flat list of instructions for evaluation on the CPU, created by
+ * Calculator::compile. The instructions operate on registers holding a block of values each, so
+ * that every instruction becomes a tight loop over a block which the compiler can vectorize.
+ * Constant sub expressions are folded at compile time.
+ */
+class IVW_CORE_API Program {
+public:
+    static constexpr size_t blockSize = 256;
+
+    enum class Op : std::uint8_t { Add, Sub, Mul, Div, Pow };
+    /**
+     * An operand refers to a work register, one of the inputs, or a constant. Constants are
+     * stored in registers following the work registers, initialized by createRegisters.
+     */
+    struct Operand {
+        enum class Kind : std::uint8_t { Register, Input, Constant };
+        Kind kind;
+        std::uint32_t index;
+    };
+    struct Instruction {
+        Op op;
+        Operand lhs;
+        Operand rhs;
+        std::uint32_t dst;
+    };
+
+    /**
+     * The names of the variables used by the expression, in the order they are expected by
+     * evaluate. Variables that are not used by the expression are not included.
+     */
+    const std::vector<std::string>& getInputs() const { return inputs_; }
+    const std::vector<Instruction>& getInstructions() const { return instructions_; }
+
+    /**
+     * Create the scratch registers needed by evaluate, each thread needs its own set.
+     */
+    std::vector<double> createRegisters() const;
+
+    /**
+     * Evaluate the program for @p count values, at most blockSize.
+     * @param inputs pointers to @p count values for each of the inputs
+     * @param count the number of values to evaluate
+     * @param result output of @p count values
+     * @param registers scratch registers from createRegisters
+     */
+    void evaluate(std::span<const double* const> inputs, size_t count, double* result,
+                  std::span<double> registers) const;
+
+    /**
+     * Evaluate the program for a single set of @p inputs.
+     */
+    double operator()(std::span<const double> inputs) const;
+
+    /**
+     * Evaluate the program for @p count values using the thread pool.
+     * @param count the number of values to evaluate
+     * @param load callback `void(size_t input, size_t offset, std::span<double> dst)` that should
+     *     fill dst with the values of input starting at offset. Called concurrently.
+     * @param store callback `void(size_t offset, std::span<const double> src)` receiving the
+     *     results starting at offset. Called concurrently for different ranges.
+     */
+    template <typename Load, typename Store>
+    void evaluate(size_t count, Load&& load, Store&& store) const;
+
+private:
+    friend class Calculator;
+
+    std::vector<std::string> inputs_;
+    std::vector<Instruction> instructions_;
+    std::vector<double> constants_;
+    std::uint32_t numRegisters_ = 0;
+    Operand result_{Operand::Kind::Register, 0};
+};
+
 class IVW_CORE_API Calculator {
 public:
     static double calculate(std::string expression, std::map<std::string, double>& vars);
     static std::string shaderCode(std::string expression, std::map<std::string, double>& vars,
                                   std::map<std::string, std::string>& symbols);
+    /**
+     * Compile the expression for evaluation on the CPU. Names found in @p vars are treated as
+     * constants, names in @p inputs become inputs of the Program.
+     * @throws Exception if the expression is invalid or refers to an unknown variable
+     */
+    static Program compile(std::string expression, const std::map<std::string, double>& vars,
+                           const std::vector<std::string>& inputs);
 
 private:
     inline static bool isvariablechar(char c) { return isalpha(c) || c == '_'; }
@@ -121,5 +210,34 @@ private:
     }
 };
 
+template <typename Load, typename Store>
+void Program::evaluate(size_t count, Load&& load, Store&& store) const {
+    const size_t blocks = (count + blockSize - 1) / blockSize;
+    if (blocks == 0) return;
+    const size_t jobs = std::min(blocks, std::max(size_t{1}, 4 * util::getPoolSize()));
+
+    util::forEachParallel(
+        std::views::iota(size_t{0}, jobs),
+        [&](size_t job) {
+            auto registers = createRegisters();
+            std::vector<double> values(inputs_.size() * blockSize);
+            std::vector<const double*> pointers(inputs_.size());
+            std::array<double, blockSize> result;
+
+            for (size_t block = blocks * job / jobs; block < blocks * (job + 1) / jobs; ++block) {
+                const size_t offset = block * blockSize;
+                const size_t size = std::min(blockSize, count - offset);
+                for (size_t i = 0; i < inputs_.size(); ++i) {
+                    const std::span<double> dst{values.data() + i * blockSize, size};
+                    load(i, offset, dst);
+                    pointers[i] = dst.data();
+                }
+                evaluate(pointers, size, result.data(), registers);
+                store(offset, std::span<const double>{result.data(), size});
+            }
+        },
+        jobs);
+}
+
 }  // namespace shuntingyard
 }  // namespace inviwo
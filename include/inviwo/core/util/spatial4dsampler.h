@@ -34,6 +34,12 @@
 #include <inviwo/core/datastructures/coordinatetransformer.h>
 #include <inviwo/core/datastructures/datatraits.h>
 
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
 namespace inviwo {
 
 class IVW_CORE_API Spatial4DSamplerBase {
@@ -59,6 +65,35 @@ public:
                               CoordinateSpace space = CoordinateSpace::Data) const;
     virtual bool withinBounds(const vec4& pos, CoordinateSpace space = CoordinateSpace::Data) const;
 
+    /**
+     * Sample at @p pos, given in data space, if it is within bounds, otherwise return
+     * std::nullopt. Same as calling withinBounds followed by sample.
+     */
+    std::optional<ReturnType> sampleIfWithinBounds(const dvec4& pos) const;
+
+    /**
+     * Sample each of @p positions into the corresponding element of @p results, which needs to be
+     * at least as large. Subsequent positions close in time are cheaper to sample than random
+     * ones, which makes this suitable for sampling along path lines.
+     */
+    void sampleMultiple(std::span<const dvec4> positions, std::span<ReturnType> results,
+                        CoordinateSpace space = CoordinateSpace::Data) const;
+
+    /**
+     * Whether the sampler only keeps a window of its time range in memory. Such a sampler can
+     * only be sampled within the time range returned by the last call to requestTimeWindow.
+     */
+    virtual bool isStreaming() const { return false; }
+
+    /**
+     * Make the data needed to sample the time range from @p range.x towards @p range.y
+     * resident. The window may be extended further in the same direction. Must not be called
+     * concurrently with sampling.
+     * @return the time range that can be sampled. It covers @p range unless that reaches past
+     * the end of the data. The default implementation covers all time.
+     */
+    virtual dvec2 requestTimeWindow(const dvec2& range) const;
+
     const SpatialCoordinateTransformer& getCoordinateTransformer() const;
     mat4 getModelMatrix() const;
     mat4 getWorldMatrix() const;
@@ -66,6 +101,11 @@ public:
 protected:
     virtual ReturnType sampleDataSpace(const dvec4& pos) const = 0;
     virtual bool withinBoundsDataSpace(const dvec4& pos) const = 0;
+    /**
+     * Sample the data space @p positions, calls sampleDataSpace for each position by default.
+     */
+    virtual void sampleMultipleDataSpace(std::span<const dvec4> positions,
+                                         std::span<ReturnType> results) const;
 
     std::shared_ptr<const SpatialEntity> spatialEntity_;
 };
@@ -137,6 +177,45 @@ bool Spatial4DSampler<ReturnType>::withinBounds(const vec4& pos, CoordinateSpace
     return withinBounds(static_cast<dvec4>(pos), space);
 }
 
+template <typename ReturnType>
+auto Spatial4DSampler<ReturnType>::sampleIfWithinBounds(const dvec4& pos) const
+    -> std::optional<ReturnType> {
+    if (!withinBoundsDataSpace(pos)) return std::nullopt;
+    return sampleDataSpace(pos);
+}
+
+template <typename ReturnType>
+void Spatial4DSampler<ReturnType>::sampleMultiple(std::span<const dvec4> positions,
+                                                  std::span<ReturnType> results,
+                                                  CoordinateSpace space) const {
+    if (space == CoordinateSpace::Data) {
+        sampleMultipleDataSpace(positions, results.first(positions.size()));
+        return;
+    }
+
+    const auto m =
+        spatialEntity_->getCoordinateTransformer().getMatrix(space, CoordinateSpace::Data);
+    std::vector<dvec4> dataPositions(positions.size());
+    std::ranges::transform(positions, dataPositions.begin(), [&](const dvec4& pos) {
+        const auto p = m * vec4(static_cast<vec3>(pos), 1.0f);
+        return dvec4(vec3(p) / p.w, pos.w);
+    });
+    sampleMultipleDataSpace(dataPositions, results.first(positions.size()));
+}
+
+template <typename ReturnType>
+void Spatial4DSampler<ReturnType>::sampleMultipleDataSpace(std::span<const dvec4> positions,
+                                                           std::span<ReturnType> results) const {
+    for (size_t i = 0; i < positions.size(); ++i) {
+        results[i] = sampleDataSpace(positions[i]);
+    }
+}
+
+template <typename ReturnType>
+dvec2 Spatial4DSampler<ReturnType>::requestTimeWindow(const dvec2&) const {
+    return {-std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()};
+}
+
 template <typename ReturnType>
 const SpatialCoordinateTransformer& Spatial4DSampler<ReturnType>::getCoordinateTransformer() const {
     return spatialEntity_->getCoordinateTransformer();
@@ -32,6 +32,8 @@
 #include <inviwo/core/datastructures/spatialdata.h>
 #include <inviwo/core/datastructures/datatraits.h>
 
+#include <optional>
+
 namespace inviwo {
 
 /**
@@ -66,6 +68,12 @@ public:
     bool withinBounds(const dvec2& pos, CoordinateSpace space) const;
     bool withinBounds(const vec2& pos, CoordinateSpace space) const;
 
+    /**
+     * Sample at @p pos if it is within bounds, otherwise return std::nullopt. Same as calling
+     * withinBounds followed by sample, but @p pos is only transformed to data space once.
+     */
+    std::optional<ReturnType> sampleIfWithinBounds(const dvec3& pos) const;
+
     mat3 getBasis() const;
     mat4 getModelMatrix() const;
     mat4 getWorldMatrix() const;
@@ -217,6 +225,18 @@ bool SpatialSampler<ReturnType>::withinBounds(const dvec3& pos, CoordinateSpace
     }
 }
 
+template <typename ReturnType>
+auto SpatialSampler<ReturnType>::sampleIfWithinBounds(const dvec3& pos) const
+    -> std::optional<ReturnType> {
+    auto dataPos = pos;
+    if (space_ != CoordinateSpace::Data) {
+        const auto p = transform_ * dvec4(pos, 1.0);
+        dataPos = dvec3(p) / p.w;
+    }
+    if (!withinBoundsDataSpace(dataPos)) return std::nullopt;
+    return sampleDataSpace(dataPos);
+}
+
 template <typename ReturnType>
 const SpatialCoordinateTransformer& SpatialSampler<ReturnType>::getCoordinateTransformer() const {
     return spatialEntity_.getCoordinateTransformer();
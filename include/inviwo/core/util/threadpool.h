@@ -62,9 +62,11 @@
 #include <warn/ignore/all>
 #include <vector>
 #include <queue>
+#include <deque>
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <shared_mutex>
 #include <condition_variable>
 #include <future>
 #include <functional>
@@ -74,8 +76,26 @@
 
 namespace inviwo {
 
+/**
+ * A work-stealing thread pool. Each worker has its own task queue. Tasks enqueued from a worker
+ * thread, i.e. nested tasks, are put in the queue of that worker and are processed newest first
+ * by the worker itself. Tasks enqueued from other threads are distributed over the workers in a
+ * round-robin fashion. An idle worker will steal the oldest task from the other workers. This
+ * avoids having all threads contend on a single queue lock for fine grained tasks.
+ *
+ * Tasks can also be given a Priority. Interactive tasks are always picked before any other
+ * queued task, Background tasks only after all other tasks. At most getBackgroundLimit()
+ * workers will run Background tasks at the same time, so some workers are always available for
+ * interactive and normal work even when the pool is flooded with long running batch tasks.
+ */
 class IVW_CORE_API ThreadPool {
 public:
+    enum class Priority {
+        Interactive,  //< Run before any other queued task
+        Normal,       //< The default
+        Background    //< Run after all other tasks, on at most getBackgroundLimit() workers
+    };
+
     ThreadPool(
         size_t threads, std::function<void()> onThreadStart = []() {},
         std::function<void()> onThreadStop = []() {});
@@ -91,7 +111,32 @@ public:
     /**
      * Enqueue a plain functor. The functor may not throw exceptions.
      */
-    void enqueueRaw(std::function<void()> f);
+    void enqueueRaw(std::function<void()> f, Priority priority = Priority::Normal);
+
+    /**
+     * Run one queued task, if any, on the calling thread. This can be used to do useful work while
+     * waiting for nested tasks, instead of blocking a worker thread.
+     * @return true if a task was run, false if there were no queued tasks.
+     */
+    bool tryRunTask();
+
+    /**
+     * Run one queued Interactive task, if any, on the calling thread. Long running tasks can call
+     * this at suitable points to yield to interactive work.
+     * @return true if a task was run, false if there were no queued interactive tasks.
+     */
+    bool tryRunInteractiveTask();
+
+    /**
+     * Set the number of workers that will not run Background tasks, default is 1. Background
+     * tasks will always be able to use at least one worker.
+     */
+    void setReservedWorkers(size_t reserved);
+    size_t getReservedWorkers() const;
+    /**
+     * The maximum number of workers that will run Background tasks at the same time.
+     */
+    size_t getBackgroundLimit() const;
 
     size_t trySetSize(size_t size);
     size_t getSize() const;
@@ -102,7 +147,7 @@ private:
     enum class State {
         Free,     //< Worker is waiting for tasks.
         Working,  //< Worker is running a task.
-        Stop,     //< Stop after all tasks are done.
+        Stop,     //< Stop once there are no more tasks to run in the pool.
         Abort,    //< Stop as soon as possible, no matter if there are more tasks.
         Done      //< Worker is waiting to be joined.
     };
@@ -116,13 +161,47 @@ private:
         ~Worker();
 
         std::atomic<State> state;  //< State of the worker
+        ThreadPool* pool;
+        std::mutex mutex;                         //< Guards tasks and accepting
+        std::deque<std::function<void()>> tasks;  //< Owner pops from the back, thieves the front
+        bool accepting;                           //< False once the worker has decided to exit
         std::thread thread;
     };
+
+    // Add the task to a queue, false if there is no worker that would run it
+    bool push(std::function<void()>& task, Priority priority);
+    bool pop(Worker* self, std::function<void()>& task);
+    bool popInteractive(std::function<void()>& task);
+    bool popBackground(std::function<void()>& task);
+    bool hasRunnableTasks() const;
+    void updateBackgroundLimit();
+    void notify();
+    Worker* getCurrentWorker() const;
+
     // need to keep track of threads so we can join them
     std::vector<std::unique_ptr<Worker>> workers;
+    // guards the workers vector, stealing and enqueueing takes a shared lock.
+    mutable std::shared_mutex workers_mutex;
 
-    // the task queue
+    // tasks that could not be assigned to a worker, i.e. when the workers are stopping
     std::queue<std::function<void()>> tasks;
+    std::atomic<size_t> queued;
+
+    // prioritized tasks, guarded by the queue_mutex
+    std::queue<std::function<void()>> interactive;
+    std::atomic<size_t> interactiveQueued;
+    std::queue<std::function<void()>> background;
+    std::atomic<size_t> backgroundQueued;
+    std::atomic<size_t> backgroundRunning;
+    std::atomic<size_t> backgroundLimit;
+    std::atomic<size_t> reservedWorkers;
+
+    // total number of queued tasks, in the workers queues and in the tasks queue
+    std::atomic<size_t> pending;
+    std::atomic<size_t> sleeping;
+    // number of workers that have not exited, decremented under the queue_mutex
+    std::atomic<size_t> live;
+    std::atomic<size_t> next;
 
     // synchronization
     std::mutex queue_mutex;
@@ -142,14 +221,8 @@ auto ThreadPool::enqueue(F&& f, Args&&... args) -> std::future<std::invoke_resul
         std::bind(std::forward<F>(f), std::forward<Args>(args)...));
 
     std::future<return_type> res = task->get_future();
-
-    if (workers.empty()) {
-        (*task)();  // No worker threads, just run the task.
-    } else {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-        tasks.emplace([task]() { (*task)(); });
-    }
-    condition.notify_one();
+    // The packaged_task will store any exceptions in the future, so this will not throw.
+    enqueueRaw([task]() { (*task)(); });
     return res;
 }
 
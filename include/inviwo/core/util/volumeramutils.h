@@ -32,6 +32,7 @@
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/gridview.h>
 
 #include <vector>
 #include <future>
@@ -96,6 +97,62 @@ void forEachVoxelParallel(const VolumeRAM& v, C callback, size_t jobs = 0) {
     forEachVoxelParallel(v.getDimensions(), callback, jobs);
 }
 
+/**
+ * Dispatch once on the format of @p volume and call @p callback with a reference to the value of
+ * each voxel, as its actual type, and its position. This avoids the virtual, double converting
+ * per voxel accessors of VolumeRAM in hot loops. The callback is instantiated for each format
+ * matching @p Predicate, the default is all formats.
+ * \code{.cpp}
+ * util::forEachVoxelValue(*volumeRam, [&](const auto& value, const size3_t& pos) { ... });
+ * \endcode
+ * @see GridView
+ */
+template <template <class> class Predicate = dispatching::filter::All, typename C>
+void forEachVoxelValue(const VolumeRAM& volume, C callback) {
+    volume.dispatch<void, Predicate>([&](const auto* ramprecision) {
+        const auto view = util::gridView(*ramprecision);
+        forEachVoxel(view.getDimensions(), [&](const size3_t& pos) { callback(view[pos], pos); });
+    });
+}
+
+/**
+ * Mutable version of forEachVoxelValue, @p callback gets a non-const reference to each value.
+ */
+template <template <class> class Predicate = dispatching::filter::All, typename C>
+void forEachVoxelValue(VolumeRAM& volume, C callback) {
+    volume.dispatch<void, Predicate>([&](auto* ramprecision) {
+        const auto view = util::gridView(*ramprecision);
+        forEachVoxel(view.getDimensions(), [&](const size3_t& pos) { callback(view[pos], pos); });
+    });
+}
+
+/**
+ * Parallel version of forEachVoxelValue, @p callback has to be safe to call from several threads.
+ * @see forEachVoxelValue
+ */
+template <template <class> class Predicate = dispatching::filter::All, typename C>
+void forEachVoxelValueParallel(const VolumeRAM& volume, C callback, size_t jobs = 0) {
+    volume.dispatch<void, Predicate>([&](const auto* ramprecision) {
+        const auto view = util::gridView(*ramprecision);
+        forEachVoxelParallel(
+            view.getDimensions(), [&](const size3_t& pos) { callback(view[pos], pos); }, jobs);
+    });
+}
+
+/**
+ * Mutable parallel version of forEachVoxelValue, @p callback has to be safe to call from several
+ * threads.
+ * @see forEachVoxelValue
+ */
+template <template <class> class Predicate = dispatching::filter::All, typename C>
+void forEachVoxelValueParallel(VolumeRAM& volume, C callback, size_t jobs = 0) {
+    volume.dispatch<void, Predicate>([&](auto* ramprecision) {
+        const auto view = util::gridView(*ramprecision);
+        forEachVoxelParallel(
+            view.getDimensions(), [&](const size3_t& pos) { callback(view[pos], pos); }, jobs);
+    });
+}
+
 }  // namespace util
 
 }  // namespace inviwo
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/glmconvert.h>
 #include <inviwo/core/util/indexmapper.h>
 
 #include <inviwo/core/util/interpolation.h>
@@ -48,6 +49,13 @@ class VolumeSampler : public SpatialSampler<ReturnType> {
 public:
     VolumeSampler(std::shared_ptr<const Volume> vol, CoordinateSpace space = CoordinateSpace::Data);
     VolumeSampler(const Volume& vol, CoordinateSpace space = CoordinateSpace::Data);
+    /**
+     * Sample @p ram, which holds the data of @p vol but does not need to be one of its
+     * representations, e.g. a VolumeRAM loaded directly from a VolumeDisk. The sampler keeps
+     * both @p vol and @p ram alive.
+     */
+    VolumeSampler(std::shared_ptr<const VolumeRAM> ram, std::shared_ptr<const Volume> vol,
+                  CoordinateSpace space = CoordinateSpace::Data);
     VolumeSampler& operator=(const VolumeSampler&) = default;
 
     virtual ~VolumeSampler() = default;
@@ -57,9 +65,19 @@ protected:
     virtual bool withinBoundsDataSpace(const dvec3& pos) const override;
     ReturnType getVoxel(const size3_t& pos) const;
 
+    // Trilinear interpolation with the voxel type known at compile time, this avoids a virtual
+    // VolumeRAM::getAsDVecN call for each of the eight voxels of every sample
+    using Interpolator = ReturnType (*)(const void* data, size3_t dims, const dvec3& pos);
+    template <typename T>
+    static ReturnType interpolate(const void* data, size3_t dims, const dvec3& pos);
+
     std::shared_ptr<const Volume> volume_;
+    // Held shared so that a MemoryBudget does not evict it while the sampler is alive
+    std::shared_ptr<const VolumeRAM> ownedRam_;
     const VolumeRAM* ram_;
+    const void* data_;
     size3_t dims_;
+    Interpolator interpolator_;
 };
 
 template <size_t N = 4>
@@ -74,32 +92,56 @@ VolumeSampler<ReturnType>::VolumeSampler(std::shared_ptr<const Volume> vol, Coor
 template <typename ReturnType>
 VolumeSampler<ReturnType>::VolumeSampler(const Volume& vol, CoordinateSpace space)
     : SpatialSampler<ReturnType>(vol, space)
-    , ram_(vol.getRepresentation<VolumeRAM>())
-    , dims_(vol.getDimensions()) {}
+    , ownedRam_(vol.getRepresentationShared<VolumeRAM>())
+    , ram_(ownedRam_.get())
+    , data_(ram_->getData())
+    , dims_(vol.getDimensions())
+    , interpolator_{ram_->dispatch<Interpolator>(
+          []<typename T>(const VolumeRAMPrecision<T>*) -> Interpolator {
+              return &VolumeSampler::interpolate<T>;
+          })} {}
 
 template <typename ReturnType>
-auto VolumeSampler<ReturnType>::sampleDataSpace(const dvec3& pos) const -> ReturnType {
-    if (!withinBoundsDataSpace(pos)) {
-        return ReturnType(0.0);
-    }
-    const dvec3 samplePos = pos * dvec3(dims_ - size3_t(1));
+VolumeSampler<ReturnType>::VolumeSampler(std::shared_ptr<const VolumeRAM> ram,
+                                         std::shared_ptr<const Volume> vol, CoordinateSpace space)
+    : SpatialSampler<ReturnType>(*vol, space)
+    , volume_(std::move(vol))
+    , ownedRam_(std::move(ram))
+    , ram_(ownedRam_.get())
+    , data_(ram_->getData())
+    , dims_(ram_->getDimensions())
+    , interpolator_{ram_->dispatch<Interpolator>(
+          []<typename T>(const VolumeRAMPrecision<T>*) -> Interpolator {
+              return &VolumeSampler::interpolate<T>;
+          })} {}
+
+template <typename ReturnType>
+template <typename T>
+auto VolumeSampler<ReturnType>::interpolate(const void* data, size3_t dims, const dvec3& pos)
+    -> ReturnType {
+    const auto* voxels = static_cast<const T*>(data);
+    const auto dimsM1 = dims - size3_t(1);
+    const dvec3 samplePos = pos * dvec3(dimsM1);
     const size3_t indexPos = size3_t(samplePos);
     const dvec3 interpolants = samplePos - dvec3(indexPos);
+    const util::IndexMapper3D im(dims);
 
     ReturnType samples[8];
-    samples[0] = getVoxel(indexPos);
-    samples[1] = getVoxel(indexPos + size3_t(1, 0, 0));
-    samples[2] = getVoxel(indexPos + size3_t(0, 1, 0));
-    samples[3] = getVoxel(indexPos + size3_t(1, 1, 0));
-
-    samples[4] = getVoxel(indexPos + size3_t(0, 0, 1));
-    samples[5] = getVoxel(indexPos + size3_t(1, 0, 1));
-    samples[6] = getVoxel(indexPos + size3_t(0, 1, 1));
-    samples[7] = getVoxel(indexPos + size3_t(1, 1, 1));
-
+    for (size_t i = 0; i < 8; ++i) {
+        const size3_t offset{i & 1u, (i >> 1) & 1u, (i >> 2) & 1u};
+        samples[i] = util::glm_convert<ReturnType>(voxels[im(glm::min(indexPos + offset, dimsM1))]);
+    }
     return Interpolation<ReturnType, double>::trilinear(samples, interpolants);
 }
 
+template <typename ReturnType>
+auto VolumeSampler<ReturnType>::sampleDataSpace(const dvec3& pos) const -> ReturnType {
+    if (!withinBoundsDataSpace(pos)) {
+        return ReturnType(0.0);
+    }
+    return interpolator_(data_, dims_, pos);
+}
+
 template <>
 inline double VolumeSampler<double>::getVoxel(const size3_t& pos) const {
     const auto p = glm::clamp(pos, size3_t(0), dims_ - size3_t(1));
@@ -34,6 +34,12 @@
 #include <inviwo/core/util/spatial4dsampler.h>
 #include <inviwo/core/util/volumesampler.h>
 
+#include <future>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
 namespace inviwo {
 
 class IVW_CORE_API VolumeSequenceSampler : public Spatial4DSampler<dvec3> {
@@ -42,14 +48,18 @@ class IVW_CORE_API VolumeSequenceSampler : public Spatial4DSampler<dvec3> {
         double duration_;
         double timestamp_;
         std::shared_ptr<const Volume> volume_;
-        VolumeSampler<dvec4> sampler_;
+        // Empty while the time step is not resident, only when streaming
+        std::optional<VolumeSampler<dvec4>> sampler_;
 
-        Wrapper(std::shared_ptr<const Volume> volume)
+        Wrapper(std::shared_ptr<const Volume> volume, bool resident)
             : next_()
             , duration_(std::numeric_limits<double>::infinity())
             , timestamp_(std::numeric_limits<double>::infinity())
             , volume_(volume)
-            , sampler_(volume) {
+            , sampler_() {
+            if (resident) {
+                sampler_.emplace(volume_);
+            }
             if (volume_->hasMetaData<DoubleMetaData>("timestamp")) {
                 timestamp_ = volume_->getMetaData<DoubleMetaData>("timestamp")->get();
             }
@@ -62,22 +72,55 @@ class IVW_CORE_API VolumeSequenceSampler : public Spatial4DSampler<dvec3> {
     };
 
 public:
+    /**
+     * @param volumeSequence the time steps to sample
+     * @param allowLooping wrap times outside of the sequence around, not supported when streaming
+     * @param streamingWindow the number of time steps to keep in memory, at least two. 0 keeps
+     *     all of them. When streaming, the RAM of the time steps in the window is loaded directly
+     *     from their VolumeDisk when possible, such that it is released again once the window
+     *     moves on. The next window is loaded in the background.
+     * @see requestTimeWindow
+     */
     VolumeSequenceSampler(std::shared_ptr<const VolumeSequence> volumeSequence,
-                          bool allowLooping = true);
+                          bool allowLooping = true, size_t streamingWindow = 0);
     virtual ~VolumeSequenceSampler();
 
-    void setAllowedLooping(bool allowed = true) { allowLooping_ = allowed; }
+    void setAllowedLooping(bool allowed = true) { allowLooping_ = allowed && windowSize_ == 0; }
+
+    virtual bool isStreaming() const override { return windowSize_ > 0; }
+    virtual dvec2 requestTimeWindow(const dvec2& range) const override;
 
 protected:
     virtual dvec3 sampleDataSpace(const dvec4& pos) const;
     virtual bool withinBoundsDataSpace(const dvec4& pos) const;
+    virtual void sampleMultipleDataSpace(std::span<const dvec4> positions,
+                                         std::span<dvec3> results) const override;
 
 private:
+    /**
+     * Map @p t into the time range of the sequence, wrapping it around when looping.
+     * @return std::nullopt if @p t is outside of the range and looping is not allowed.
+     */
+    std::optional<double> wrapTime(double t) const;
+    /**
+     * Find the last time step starting at or before @p t. The time step @p hint, and the ones
+     * next to it, are checked before searching the whole sequence.
+     */
+    size_t findTimestep(double t, size_t hint) const;
+    dvec3 sampleTimestep(size_t index, const dvec3& pos, double t) const;
+
     std::vector<std::shared_ptr<Wrapper>> wrappers_;
+    // The timestamps of wrappers_, kept contiguous for fast lookups
+    std::vector<double> timestamps_;
 
     bool allowLooping_;
     dvec2 timeRange_;
     double totDuration_;
+
+    size_t windowSize_;
+    mutable dvec2 window_;
+    mutable std::vector<std::pair<size_t, std::shared_future<std::shared_ptr<const VolumeRAM>>>>
+        pending_;
 };
 
 }  // namespace inviwo
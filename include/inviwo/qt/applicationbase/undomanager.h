@@ -36,6 +36,8 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <QObject>
 
@@ -81,6 +83,21 @@ public:
 private:
     using DiffType = std::vector<std::pmr::string>::iterator::difference_type;
 
+    /**
+     * The difference between two consecutive states. The states share the first `prefix` and the
+     * last `suffix` characters, only the differing middle parts are stored.
+     */
+    struct Delta {
+        size_t prefix;
+        size_t suffix;
+        std::pmr::string before;
+        std::pmr::string after;
+    };
+    static std::optional<Delta> makeDelta(std::string_view before, std::string_view after);
+    static std::shared_ptr<const std::pmr::string> applyDelta(std::string_view state,
+                                                              const Delta& delta,
+                                                              std::string_view middle);
+
     void updateActions();
 
     ProcessorNetwork* network_;
@@ -91,7 +108,8 @@ private:
     size_t triggerId_ = 0;
     bool isRestoring = false;
     DiffType head_ = -1;
-    std::vector<std::shared_ptr<const std::pmr::string>> undoBuffer_;
+    std::shared_ptr<const std::pmr::string> current_;  // The state at head_
+    std::vector<Delta> deltas_;                        // deltas_[i] goes from state i to i + 1
 
     QAction* undoAction_;
     QAction* redoAction_;
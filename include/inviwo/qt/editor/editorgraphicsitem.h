@@ -38,6 +38,8 @@
 #include <QGraphicsSceneHelpEvent>
 #include <warn/pop>
 
+class QPainter;
+
 namespace inviwo {
 
 class NetworkEditor;
@@ -69,6 +71,14 @@ static constexpr double connection = 1.0;
 static constexpr double link = 0.0;
 }  // namespace depth
 
+namespace lod {
+// Scale below which items skip labels and decorations and paint simplified shapes. When zoomed
+// out that far on a large network the text is unreadable anyway.
+static constexpr double simplified = 0.5;
+
+IVW_QTEDITOR_API bool isSimplified(const QPainter& p);
+}  // namespace lod
+
 class Port;
 
 class IVW_QTEDITOR_API EditorGraphicsItem : public QGraphicsRectItem {
@@ -66,6 +66,7 @@ class InviwoDockWidget;
 class InviwoEditMenu;
 class InviwoAboutWindow;
 class ResourceManagerDockWidget;
+class EvaluationProfilerDockWidget;
 class FileAssociations;
 class ToolsMenu;
 class TextLabelOverlay;
@@ -254,6 +255,7 @@ private:
     SettingsWidget* settings_;
     ProcessorTreeWidget* processorTreeWidget_;
     ResourceManagerDockWidget* resourceManagerDockWidget_;
+    EvaluationProfilerDockWidget* evaluationProfilerDockWidget_;
     PropertyListWidget* propertyListWidget_;
     HelpWidget* helpWidget_;
 
@@ -45,6 +45,8 @@
 #include <QGraphicsScene>
 #include <QGraphicsItem>
 #include <QTimer>
+#include <QElapsedTimer>
+#include <QPointer>
 #include <QThread>
 #include <QPointF>
 #include <QGraphicsSceneHelpEvent>
@@ -52,6 +54,7 @@
 #include <warn/pop>
 
 #include <filesystem>
+#include <vector>
 
 namespace inviwo {
 
@@ -149,6 +152,14 @@ public:
 
     void showLinkDialog(Processor* processor1, Processor* processor2);
 
+    /**
+     * Repaint @p item together with all other pending items, at most every repaintInterval ms.
+     * Items outside of all views are skipped, they pick up their state when they get exposed.
+     * Used to coalesce the status and progress updates of processors.
+     */
+    void scheduleRepaint(ProcessorGraphicsItem* item);
+    static constexpr int repaintInterval = 250;
+
     static constexpr std::string_view name{"NetworkEditor"};
 
 protected:
@@ -226,6 +237,7 @@ private:
     virtual void drawForeground(QPainter* painter, const QRectF& rect) override;
 
     void deleteItems(QList<QGraphicsItem*> items);
+    void repaintPending();
 
     using ProcessorMap = std::map<Processor*, ProcessorGraphicsItem*>;
     using ConnectionMap = std::map<PortConnection, ConnectionGraphicsItem*>;
@@ -256,6 +268,10 @@ private:
     bool adjustSceneToChange_;
 
     std::shared_ptr<std::function<void()>> onShowCounts_;
+
+    std::vector<QPointer<ProcessorGraphicsItem>> pendingRepaints_;
+    QTimer repaintTimer_;
+    QElapsedTimer lastRepaint_;
 };
 
 template <typename T>
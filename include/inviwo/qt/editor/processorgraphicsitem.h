@@ -197,6 +197,7 @@ protected:
 private:
     void delayedUpdate();
     void updateStatus(bool running = false);
+    void updateLabels();
 
     Processor* processor_;
     ProcessorMetaData* processorMeta_;
@@ -240,6 +241,7 @@ private:
     std::optional<float> progress_;
     std::optional<float> currentProgress_;
     bool dirty_;
+    bool labelsDirty_;
     RateLimitier<250, decltype([](QGraphicsItem* p) { p->update(); })> limitedUpdate_;
 };
 
@@ -32,14 +32,20 @@
 #include <inviwo/qt/editor/inviwoqteditordefine.h>
 #include <modules/qtwidgets/inviwodockwidget.h>
 
+#include <functional>
+#include <memory>
+
 class QTreeView;
+class QTreeWidget;
 class QCheckBox;
+class QTimer;
 
 namespace inviwo {
 struct Resource;
 class ResourceManager;
 
 class ResourceManagerItemModel;
+class ResourceManagerObserver;
 
 /**
  * \class ResourceManagerDockWidget
@@ -48,12 +54,22 @@ class ResourceManagerItemModel;
 class IVW_QTEDITOR_API ResourceManagerDockWidget : public InviwoDockWidget {
 public:
     ResourceManagerDockWidget(QWidget* parent, ResourceManager& manager);
+    virtual ~ResourceManagerDockWidget();
 
 private:
+    /**
+     * Rebuild the list of resource usage per processor, see ResourceManager::bytesPerProcessor
+     */
+    void updateProcessors();
+
     ResourceManager& manager_;
     ResourceManagerItemModel* model_;
     QTreeView* view_;
+    QTreeWidget* processors_;
+    QTimer* processorsTimer_;
+    std::unique_ptr<ResourceManagerObserver> processorsObserver_;
     std::shared_ptr<std::function<void()>> callback_;
+    std::shared_ptr<std::function<void()>> budgetCallback_;
 };
 
 }  // namespace inviwo
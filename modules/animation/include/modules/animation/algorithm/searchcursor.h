@@ -0,0 +1,91 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <algorithm>  // for partition_point
+#include <cstddef>    // for size_t
+#include <iterator>   // for distance, next
+
+namespace inviwo {
+
+namespace animation {
+
+/**
+ * Remembers the position of the last lookup into a sorted range. During playback consecutive
+ * lookups almost always end up in the same or in the following interval, hence those two are
+ * checked first and only if neither matches do we fall back to a binary search. The cursor is
+ * only a hint, the result is always the same as for the corresponding std algorithm.
+ */
+class SearchCursor {
+public:
+    /**
+     * Same as std::partition_point(begin, end, pred), pred has to be true for all elements
+     * before the partition point and false for all after it.
+     */
+    template <typename Iterator, typename Pred>
+    Iterator partitionPoint(Iterator begin, Iterator end, Pred pred) {
+        const auto size = static_cast<size_t>(std::distance(begin, end));
+        const auto isPoint = [&](size_t i) {
+            return i <= size && (i == 0 || pred(*std::next(begin, i - 1))) &&
+                   (i == size || !pred(*std::next(begin, i)));
+        };
+        if (isPoint(pos_)) return std::next(begin, pos_);
+        if (isPoint(pos_ + 1)) return std::next(begin, ++pos_);
+
+        auto it = std::partition_point(begin, end, pred);
+        pos_ = static_cast<size_t>(std::distance(begin, it));
+        return it;
+    }
+
+    /**
+     * Same as std::upper_bound(begin, end, value, comp)
+     */
+    template <typename Iterator, typename T, typename Compare>
+    Iterator upperBound(Iterator begin, Iterator end, const T& value, Compare comp) {
+        return partitionPoint(begin, end, [&](const auto& elem) { return !comp(value, elem); });
+    }
+
+    /**
+     * Same as std::lower_bound(begin, end, value, comp)
+     */
+    template <typename Iterator, typename T, typename Compare>
+    Iterator lowerBound(Iterator begin, Iterator end, const T& value, Compare comp) {
+        return partitionPoint(begin, end, [&](const auto& elem) { return comp(elem, value); });
+    }
+
+    void reset() { pos_ = 0; }
+
+private:
+    size_t pos_ = 0;
+};
+
+}  // namespace animation
+
+}  // namespace inviwo
@@ -82,6 +82,16 @@ public:
     void pause();
     /// Render the animation into an image sequence
     void render();
+    /**
+     * Render only the frames [beginFrame, endFrame) of the image sequence, out of the
+     * getRenderFrameCount() frames of a full render. Used to split a render over several
+     * processes that each render a part. The recorders are told where the part starts so that
+     * the parts can be joined afterwards.
+     * @see RecorderOptions
+     */
+    void render(int beginFrame, int endFrame);
+    /// The number of frames of a full render, given by the render window and renderFPS
+    int getRenderFrameCount() const;
     // Pause and reset to start
     void stop();
 
@@ -33,6 +33,7 @@
 #include <inviwo/core/common/inviwomodule.h>                // for InviwoModule
 #include <inviwo/core/io/serialization/ticpp.h>             // for TxElement
 #include <inviwo/core/io/serialization/versionconverter.h>  // for VersionConverter
+#include <inviwo/core/util/commandlineparser.h>             // for CommandLineArgHolder
 #include <modules/animation/animationmanager.h>             // for AnimationManager
 #include <modules/animation/animationsupplier.h>            // for AnimationSupplier
 #include <modules/animation/demo/democontroller.h>          // for DemoController
@@ -110,6 +111,9 @@ private:
     animation::WorkspaceAnimations
         animations_;  /// Used by Animation Editor and stored with workspace.
     animation::DemoController demoController_;
+
+    TCLAP::ValueArg<std::string> renderArg_;
+    CommandLineArgHolder renderArgHolder_;
 };
 
 }  // namespace inviwo
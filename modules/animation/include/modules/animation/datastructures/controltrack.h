@@ -30,6 +30,7 @@
 
 #include <modules/animation/animationmoduledefine.h>  // for IVW_MODULE_ANIMATI...
 
+#include <modules/animation/algorithm/searchcursor.h>                  // for SearchCursor
 #include <modules/animation/datastructures/animationstate.h>           // for AnimationState
 #include <modules/animation/datastructures/animationtime.h>            // for Seconds
 #include <modules/animation/datastructures/basetrack.h>                // for BaseTrack<>::key_type
@@ -64,6 +65,9 @@ public:
 
     virtual AnimationTimeState operator()(Seconds from, Seconds to,
                                           AnimationState state) const override;
+
+private:
+    mutable SearchCursor cursor_;  ///< Position of the last sequence lookup
 };
 
 }  // namespace animation
@@ -36,6 +36,7 @@
 #include <inviwo/core/properties/property.h>                         // for Property, PropertyTr...
 #include <inviwo/core/util/assertion.h>                              // for IVW_ASSERT
 #include <inviwo/core/util/exception.h>                              // for Exception
+#include <modules/animation/algorithm/searchcursor.h>                // for SearchCursor
 #include <modules/animation/datastructures/animationstate.h>         // for AnimationState, Anim...
 #include <modules/animation/datastructures/animationtime.h>          // for Seconds
 #include <modules/animation/datastructures/basetrack.h>              // for BaseTrack
@@ -43,7 +44,6 @@
 #include <modules/animation/datastructures/valuekeyframesequence.h>  // for DefaultInterpolation...
 #include <modules/animation/interpolation/interpolation.h>           // for InterpolationTyped
 
-#include <algorithm>    // for upper_bound
 #include <iterator>     // for prev
 #include <memory>       // for unique_ptr, make_unique
 #include <string>       // for operator+, string
@@ -290,6 +290,7 @@ protected:
 private:
     Prop* property_;  ///< non-owning reference
     ProcessorNetwork* network_;
+    mutable SearchCursor cursor_;  ///< Position of the last sequence lookup
 };
 
 template <typename Prop, typename Key, typename Seq>
@@ -411,8 +412,8 @@ AnimationTimeState PropertyTrack<Prop, Key, Seq>::operator()(Seconds from, Secon
     if (!this->isEnabled() || this->empty()) return {to, state};
 
     // 'it' will be the first seq. with a first time larger then 'to'.
-    auto it = std::upper_bound(this->begin(), this->end(), to,
-                               [](const auto& a, const auto& b) { return a < b; });
+    auto it = cursor_.upperBound(this->begin(), this->end(), to,
+                                 [](const auto& a, const auto& b) { return a < b; });
 
     if (it == this->begin()) {
         if (from > it->getFirstTime()) {  // case 1
@@ -59,6 +59,10 @@ struct IVW_MODULE_ANIMATION_API RecorderOptions {
     int frameRate = 25;
     int expectedNumberOfFrames = 1000;
     std::string sourceName = "";
+    /// Index of the first recorded frame when only a part of a render is recorded
+    int firstFrame = 0;
+    /// True if only a part of the frames is recorded, @see AnimationController::render
+    bool part = false;
 };
 
 class IVW_MODULE_ANIMATION_API RecorderFactory {
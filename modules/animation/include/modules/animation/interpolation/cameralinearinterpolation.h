@@ -31,6 +31,7 @@
 #include <modules/animation/animationmoduledefine.h>  // for IVW_MODULE_ANIMATION_API
 
 #include <inviwo/core/algorithm/easing.h>
+#include <modules/animation/algorithm/searchcursor.h>         // for SearchCursor
 #include <modules/animation/datastructures/animationtime.h>   // for Seconds
 #include <modules/animation/datastructures/camerakeyframe.h>  // for CameraKeyframe, CameraKeyfr...
 #include <modules/animation/interpolation/interpolation.h>    // for InterpolationTyped
@@ -77,6 +78,9 @@ public:
     virtual void operator()(const std::vector<std::unique_ptr<CameraKeyframe>>& keys, Seconds from,
                             Seconds to, Easing easing,
                             CameraKeyframe::value_type& out) const override;
+
+private:
+    mutable SearchCursor cursor_;
 };
 
 }  // namespace animation
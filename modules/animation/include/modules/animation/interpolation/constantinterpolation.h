@@ -29,6 +29,7 @@
 #pragma once
 
 #include <modules/animation/animationmoduledefine.h>
+#include <modules/animation/algorithm/searchcursor.h>
 #include <modules/animation/interpolation/interpolation.h>
 
 #include <inviwo/core/util/defaultvalues.h>
@@ -68,6 +69,9 @@ public:
     // keys should be sorted by time
     virtual void operator()(const std::vector<std::unique_ptr<Key>>& keys, Seconds from, Seconds to,
                             Easing easing, Result& out) const override;
+
+private:
+    mutable SearchCursor cursor_;
 };
 
 template <typename Key, typename Result>
@@ -112,7 +116,7 @@ void ConstantInterpolation<Key, Result>::operator()(const std::vector<std::uniqu
                                                     Result& out) const {
 
     if (to > from) {
-        auto it = std::upper_bound(
+        auto it = cursor_.upperBound(
             keys.begin(), keys.end(), to,
             [](const auto& time, const auto& key) { return time < key->getTime(); });
 
@@ -123,7 +127,7 @@ void ConstantInterpolation<Key, Result>::operator()(const std::vector<std::uniqu
         }
 
     } else {
-        auto it = std::lower_bound(
+        auto it = cursor_.lowerBound(
             keys.begin(), keys.end(), to,
             [](const auto& key, const auto& time) { return key->getTime() < time; });
 
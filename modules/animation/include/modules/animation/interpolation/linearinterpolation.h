@@ -29,6 +29,7 @@
 #pragma once
 
 #include <modules/animation/animationmoduledefine.h>
+#include <modules/animation/algorithm/searchcursor.h>
 #include <modules/animation/interpolation/interpolation.h>
 #include <inviwo/core/io/serialization/serialization.h>
 
@@ -68,6 +69,9 @@ public:
      */
     virtual void operator()(const std::vector<std::unique_ptr<Key>>& keys, Seconds from, Seconds to,
                             Easing easing, Result& out) const override;
+
+private:
+    mutable SearchCursor cursor_;
 };
 
 template <typename Key, typename Result>
@@ -105,9 +109,9 @@ void LinearInterpolation<Key, Result>::operator()(const std::vector<std::unique_
     using VT = typename Key::value_type;
     using DT = typename util::same_extent<VT, double>::type;
 
-    auto it = std::upper_bound(keys.begin(), keys.end(), to, [](const auto& time, const auto& key) {
-        return time < key->getTime();
-    });
+    auto it = cursor_.upperBound(
+        keys.begin(), keys.end(), to,
+        [](const auto& time, const auto& key) { return time < key->getTime(); });
 
     const auto& v1 = (*std::prev(it))->getValue();
     const auto& t1 = (*std::prev(it))->getTime();
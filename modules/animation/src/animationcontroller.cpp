@@ -74,7 +74,7 @@
 #include <modules/animation/factories/recorderfactory.h>
 #include <modules/animation/factories/recorderfactories.h>
 
-#include <algorithm>      // for max, copy_if, find_if, min
+#include <algorithm>      // for max, clamp, copy_if, find_if, min
 #include <chrono>         // for milliseconds, duration
 #include <cstdlib>        // for abs, size_t
 #include <iomanip>        // for operator<<, setfill, setw
@@ -375,7 +375,18 @@ void AnimationController::tick() {
     eval(currentTime_, newTime);
 }
 
-void AnimationController::render() {
+void AnimationController::render() { render(0, getRenderFrameCount()); }
+
+int AnimationController::getRenderFrameCount() const {
+    const Seconds firstTime = (renderWindowMode.get() == 0) ? animation_->getFirstTime()
+                                                            : Seconds(renderWindow.get()[0]);
+    const Seconds lastTime = (renderWindowMode.get() == 0) ? animation_->getLastTime()
+                                                           : Seconds(renderWindow.get()[1]);
+    return std::max(
+        2, static_cast<int>((lastTime - firstTime) / Seconds{1.0 / renderFPS.get()}));
+}
+
+void AnimationController::render(int beginFrame, int endFrame) {
     auto start = std::chrono::high_resolution_clock::now();
 
     auto network = app_->getProcessorNetwork();
@@ -398,8 +409,10 @@ void AnimationController::render() {
                                                                 : Seconds(renderWindow.get()[0]);
         const Seconds lastTime = (renderWindowMode.get() == 0) ? animation_->getLastTime()
                                                                : Seconds(renderWindow.get()[1]);
-        const int numFrames =
-            std::max(2, static_cast<int>((lastTime - firstTime) / Seconds{1.0 / renderFPS.get()}));
+        const int numFrames = getRenderFrameCount();
+        beginFrame = std::clamp(beginFrame, 0, numFrames);
+        endFrame = std::clamp(endFrame, beginFrame, numFrames);
+        const bool part = beginFrame != 0 || endFrame != numFrames;
 
         std::vector<std::function<void()>> recordingFunctors;
         const auto& recorderFactories = manager_->getRecorderFactories();
@@ -414,7 +427,9 @@ void AnimationController::render() {
                                 {.dimensions = imageExporter->getImage()->getDimensions(),
                                  .frameRate = static_cast<int>(framesPerSecond.get()),
                                  .expectedNumberOfFrames = numFrames,
-                                 .sourceName = p->getIdentifier()});
+                                 .sourceName = p->getIdentifier(),
+                                 .firstFrame = beginFrame,
+                                 .part = part});
 
                             recordingFunctors.emplace_back(
                                 [recorder = std::move(recorder), imageExporter]() {
@@ -436,7 +451,7 @@ void AnimationController::render() {
                             [exporter, writer = exportWriter_.get(),
                              dir = exportOutputDirectory_.get(), base,
                              overwrite = exportOverwrite_ ? Overwrite::Yes : Overwrite::No,
-                             counter = size_t{0}, digits]() mutable {
+                             counter = static_cast<size_t>(beginFrame), digits]() mutable {
                                 auto name = fmt::format("{}{:0{}}", base, counter, digits);
                                 exporter->exportFile(dir, name, {writer}, overwrite);
                                 ++counter;
@@ -452,7 +467,7 @@ void AnimationController::render() {
         }
 
         // render frames
-        for (int currentFrame = 0; currentFrame < numFrames; ++currentFrame) {
+        for (int currentFrame = beginFrame; currentFrame < endFrame; ++currentFrame) {
             // Evaluate animation
             Seconds newTime = firstTime + (lastTime - firstTime) / (numFrames - 1) * currentFrame;
             eval(currentTime_, newTime);
@@ -480,8 +495,9 @@ void AnimationController::render() {
                            std::chrono::high_resolution_clock::now() - start)
                            .count();
 
-        log::info("Rendered {} frames in {:.3f} seconds, {:.3f} per frame", numFrames, seconds,
-                  seconds / numFrames);
+        const auto renderedFrames = std::max(endFrame - beginFrame, 1);
+        log::info("Rendered {} frames in {:.3f} seconds, {:.3f} per frame", renderedFrames,
+                  seconds, seconds / renderedFrames);
 
     } catch (const Exception& e) {
         log::report(LogLevel::Error, "Rendering aborted");
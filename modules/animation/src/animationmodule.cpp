@@ -76,14 +76,18 @@
 #include <modules/animation/interpolation/interpolation.h>                 // for InterpolationT...
 #include <modules/animation/interpolation/linearinterpolation.h>           // for LinearInterpol...
 #include <modules/animation/workspaceanimations.h>                         // for WorkspaceAnima...
+#include <modules/animation/mainanimation.h>                               // for MainAnimation
 #include <modules/animation/factories/imagerecorderfactory.h>
 
-#include <cstddef>     // for size_t
-#include <functional>  // for __base
-#include <map>         // for map
-#include <string>      // for string, basic_...
-#include <tuple>       // for tuple
-#include <vector>      // for vector
+#include <charconv>      // for from_chars
+#include <cstddef>       // for size_t
+#include <functional>    // for __base
+#include <map>           // for map
+#include <string>        // for string, basic_...
+#include <string_view>   // for string_view
+#include <system_error>  // for errc
+#include <tuple>         // for tuple
+#include <vector>        // for vector
 
 #include <glm/common.hpp>        // for clamp, max, min
 #include <glm/gtc/type_ptr.hpp>  // for value_ptr
@@ -102,12 +106,53 @@ class DemoController;
 class MainAnimation;
 }  // namespace animation
 
+namespace {
+
+void renderMainAnimation(animation::AnimationController& controller, std::string_view arg) {
+    if (arg == "all") {
+        controller.render();
+        return;
+    }
+
+    const auto [partStr, partsStr] = util::splitByFirst(arg, '/');
+    int part = 0;
+    int parts = 0;
+    const auto [pend, perr] =
+        std::from_chars(partStr.data(), partStr.data() + partStr.size(), part);
+    const auto [nend, nerr] =
+        std::from_chars(partsStr.data(), partsStr.data() + partsStr.size(), parts);
+    if (perr != std::errc{} || nerr != std::errc{} || parts <= 0 || part < 0 || part >= parts) {
+        log::error("Invalid renderAnimation argument: '{}', expected 'all' or 'k/n'", arg);
+        return;
+    }
+
+    const auto frames = controller.getRenderFrameCount();
+    const auto begin = frames * part / parts;
+    const auto end = frames * (part + 1) / parts;
+    log::info("Rendering part {} of {}: frames [{}, {}) of {}", part, parts, begin, end, frames);
+    controller.render(begin, end);
+}
+
+}  // namespace
+
 AnimationModule::AnimationModule(InviwoApplication* app)
     : InviwoModule(app, "Animation")
     , animation::AnimationSupplier(manager_)
     , manager_(app)
     , animations_(app, manager_, *this)
-    , demoController_(app) {
+    , demoController_(app)
+    , renderArg_{"",
+                 "renderAnimation",
+                 "Render the main animation after the workspace has been loaded. Use 'all' to "
+                 "render all the frames or 'k/n' to only render part k of n, k in [0, n). The "
+                 "latter is used to split a render over several processes.",
+                 false,
+                 "",
+                 "all|k/n"}
+    , renderArgHolder_{app, renderArg_, [this]() {
+                           renderMainAnimation(getMainAnimation().getController(),
+                                               renderArg_.getValue());
+                       }} {
 
     using namespace animation;
 
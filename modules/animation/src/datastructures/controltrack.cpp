@@ -37,9 +37,8 @@
 #include <modules/animation/datastructures/controlkeyframesequence.h>  // for ControlKeyframeSeq...
 #include <modules/animation/datastructures/keyframesequence.h>         // for operator<
 
-#include <algorithm>  // for upper_bound
-#include <chrono>     // for operator<, operator>
-#include <iterator>   // for prev
+#include <chrono>    // for operator<, operator>
+#include <iterator>  // for prev
 
 namespace inviwo {
 
@@ -65,7 +64,7 @@ AnimationTimeState ControlTrack::operator()(Seconds from, Seconds to, AnimationS
 
     // 'it' will be the first seq. with a first time larger than 'to'.
     auto it =
-        std::upper_bound(begin(), end(), to, [](const auto& a, const auto& b) { return a < b; });
+        cursor_.upperBound(begin(), end(), to, [](const auto& a, const auto& b) { return a < b; });
 
     if (it == begin()) {
         if (from > it->getFirstTime()) {  // case 1
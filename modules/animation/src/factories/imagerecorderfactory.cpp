@@ -93,13 +93,13 @@ namespace {
 class ImageRecorder : public Recorder {
 public:
     ImageRecorder(InviwoApplication* app, const std::filesystem::path& dir, std::string_view format,
-                  std::shared_ptr<DataWriterType<Layer>> writer)
+                  std::shared_ptr<DataWriterType<Layer>> writer, size_t firstFrame)
         : Recorder{}
         , app_{app}
         , dir_{dir}
         , format_{format}
         , writer_{std::move(writer)}
-        , count_{1} {}
+        , count_{firstFrame + 1} {}
 
     virtual ~ImageRecorder() = default;
     virtual void record(const Layer& layer) override;
@@ -183,7 +183,8 @@ std::unique_ptr<Recorder> ImageRecorderFactory::create(const RecorderOptions& op
                               writer_.getSelectedValue().extension_);
     replaceInString(format, "UPN", opts.sourceName);
 
-    return std::make_unique<ImageRecorder>(app_, outputDirectory_.get(), format, std::move(writer));
+    return std::make_unique<ImageRecorder>(app_, outputDirectory_.get(), format, std::move(writer),
+                                           static_cast<size_t>(opts.firstFrame));
 }
 
 }  // namespace inviwo::animation
@@ -36,10 +36,9 @@
 #include <modules/animation/datastructures/camerakeyframe.h>  // for CameraKeyframe, CameraKeyfr...
 #include <modules/animation/interpolation/interpolation.h>    // for Interpolation
 
-#include <algorithm>  // for upper_bound
-#include <chrono>     // for operator-, operator<, opera...
-#include <iterator>   // for prev
-#include <ratio>      // for ratio
+#include <chrono>    // for operator-, operator<, opera...
+#include <iterator>  // for prev
+#include <ratio>     // for ratio
 
 #include <glm/common.hpp>                    // for mix
 #include <glm/detail/qualifier.hpp>          // for defaultp
@@ -75,9 +74,9 @@ void CameraLinearInterpolation::operator()(const std::vector<std::unique_ptr<Cam
                                            Seconds /*from*/, Seconds to, Easing easing,
                                            CameraKeyframe::value_type& out) const {
 
-    auto it = std::upper_bound(keys.begin(), keys.end(), to, [](const auto& time, const auto& key) {
-        return time < key->getTime();
-    });
+    auto it = cursor_.upperBound(
+        keys.begin(), keys.end(), to,
+        [](const auto& time, const auto& key) { return time < key->getTime(); });
 
     const auto& v1 = *(*std::prev(it));
     const auto& t1 = (*std::prev(it))->getTime();
@@ -177,6 +177,33 @@ TEST(AnimationTests, ConstantInterpolation) {
     EXPECT_EQ(1.0f, floatProperty.get());
 }
 
+TEST(AnimationTests, LongSequenceInterpolation) {
+
+    FloatProperty floatProperty("float", "Float", 0.0f, 0.0f, 1000.0f);
+
+    PropertyTrack<FloatProperty, ValueKeyframe<float>> floatTrack(&floatProperty, nullptr);
+
+    std::vector<std::unique_ptr<ValueKeyframe<float>>> fseq;
+    for (int i = 0; i < 100; ++i) {
+        fseq.push_back(std::make_unique<ValueKeyframe<float>>(Seconds{i}, 2.0f * i));
+    }
+    auto sequence = std::make_unique<KeyframeSequenceTyped<ValueKeyframe<float>>>(
+        std::move(fseq), std::make_unique<LinearInterpolation<ValueKeyframe<float>>>());
+    floatTrack.add(std::move(sequence));
+
+    const auto check = [&](double from, double to) {
+        floatTrack(Seconds{from}, Seconds{to}, AnimationState::Playing);
+        EXPECT_FLOAT_EQ(static_cast<float>(2.0 * to), floatProperty.get()) << "at " << to;
+    };
+
+    // Forward playback, the lookups should be served by the cached position
+    for (double t = 0.25; t < 99.0; t += 0.25) check(t - 0.25, t);
+    // Backward playback
+    for (double t = 98.75; t > 0.0; t -= 0.25) check(t + 0.25, t);
+    // Random jumps, falls back to a binary search
+    for (double t : {50.5, 3.5, 97.25, 97.5, 12.0, 0.5, 60.75}) check(0.0, t);
+}
+
 TEST(AnimationTests, AnimationTest) {
 
     FloatProperty floatProperty("float", "Float", 0.0f, 0.0f, 100.0f);
@@ -0,0 +1,13 @@
+# Inviwo module dependencies for current module
+# List modules on the format "Inviwo<ModuleName>Module"
+set(dependencies
+    InviwoDataFrameModule
+)
+
+# By calling set(EnableByDefault ON) the module will be set to enabled 
+# when initially being added to CMake. Default OFF.
+
+find_package(Arrow QUIET CONFIG)
+if(Arrow_FOUND)
+    set(EnableByDefault ON)
+endif()
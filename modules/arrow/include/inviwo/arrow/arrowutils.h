@@ -0,0 +1,92 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/arrow/arrowmoduledefine.h>
+
+#include <inviwo/core/util/sourcecontext.h>
+
+#include <memory>
+#include <source_location>
+#include <utility>
+
+#include <arrow/result.h>
+#include <arrow/status.h>
+
+namespace arrow {
+class Table;
+}
+
+namespace inviwo {
+
+class DataFrame;
+
+namespace util {
+
+/**
+ * Create a DataFrame from an Arrow table. Numerical and boolean columns become TemplateColumns,
+ * string and dictionary encoded string columns become CategoricalColumns, and fixed size lists of
+ * two to four numerical values become glm vector columns. Null values are stored as NaN in floating
+ * point columns and as zero otherwise. Columns of other types are skipped with a warning.
+ * Units stored in the "unit" field metadata are restored.
+ */
+IVW_MODULE_ARROW_API std::shared_ptr<DataFrame> toDataFrame(const arrow::Table& table);
+
+/**
+ * Create an Arrow table from a DataFrame, the index column is not included. The arrays of the
+ * table refer directly to the column buffers of @p dataFrame, and are only valid as long as the
+ * columns are not modified. Categorical columns are stored as dictionary encoded strings.
+ * @see toDataFrame
+ */
+IVW_MODULE_ARROW_API std::shared_ptr<arrow::Table> toArrowTable(const DataFrame& dataFrame);
+
+/**
+ * Throw an exception of type E if @p status is not ok
+ */
+template <typename E>
+void arrowCheck(const arrow::Status& status,
+                SourceContext context = std::source_location::current()) {
+    if (!status.ok()) {
+        throw E(context, "Arrow: {}", status.ToString());
+    }
+}
+
+/**
+ * Return the value of @p result or throw an exception of type E if it holds an error
+ */
+template <typename E, typename T>
+T arrowCheck(arrow::Result<T> result, SourceContext context = std::source_location::current()) {
+    arrowCheck<E>(result.status(), context);
+    return std::move(result).ValueUnsafe();
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -0,0 +1,64 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/arrow/arrowmoduledefine.h>
+
+#include <inviwo/core/io/datareader.h>
+
+#include <filesystem>
+#include <memory>
+
+namespace inviwo {
+
+class DataFrame;
+
+/**
+ * \class FeatherReader
+ * \ingroup dataio
+ * \brief Reader for Arrow IPC files, including Feather V1 and V2, into a DataFrame.
+ * The file is memory mapped, uncompressed column buffers are copied straight from the page cache.
+ * @see util::toDataFrame
+ */
+class IVW_MODULE_ARROW_API FeatherReader : public DataReaderType<DataFrame> {
+public:
+    FeatherReader();
+    FeatherReader(const FeatherReader&) = default;
+    FeatherReader(FeatherReader&&) noexcept = default;
+    FeatherReader& operator=(const FeatherReader&) = default;
+    FeatherReader& operator=(FeatherReader&&) noexcept = default;
+    virtual FeatherReader* clone() const override;
+    virtual ~FeatherReader() = default;
+
+    using DataReaderType<DataFrame>::readData;
+    virtual std::shared_ptr<DataFrame> readData(const std::filesystem::path& filePath) override;
+};
+
+}  // namespace inviwo
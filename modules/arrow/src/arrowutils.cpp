@@ -0,0 +1,341 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/arrow/arrowutils.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/datastructures/unitsystem.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/formats.h>
+#include <inviwo/core/util/glmutils.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/dataframe/datastructures/column.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <arrow/api.h>
+#include <fmt/format.h>
+
+namespace inviwo {
+
+namespace {
+
+template <typename T>
+constexpr T nullValue() {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::numeric_limits<T>::quiet_NaN();
+    } else {
+        return T{0};
+    }
+}
+
+Unit getUnit(const arrow::Field& field) {
+    if (const auto& metadata = field.metadata()) {
+        if (const auto i = metadata->FindKey("unit"); i >= 0) {
+            return units::unit_from_string(metadata->value(i));
+        }
+    }
+    return Unit{};
+}
+
+template <typename T>
+void addNumeric(DataFrame& df, std::string_view header, Unit unit,
+                const arrow::ChunkedArray& column) {
+    using ArrayType = typename arrow::CTypeTraits<T>::ArrayType;
+
+    std::vector<T> data;
+    data.reserve(static_cast<size_t>(column.length()));
+    for (const auto& chunk : column.chunks()) {
+        const auto& array = static_cast<const ArrayType&>(*chunk);
+        const auto offset = data.size();
+        data.insert(data.end(), array.raw_values(), array.raw_values() + array.length());
+        if (array.null_count() > 0) {
+            for (int64_t i = 0; i < array.length(); ++i) {
+                if (array.IsNull(i)) data[offset + static_cast<size_t>(i)] = nullValue<T>();
+            }
+        }
+    }
+    df.addColumn<T>(header, std::move(data), unit);
+}
+
+void addBoolean(DataFrame& df, std::string_view header, const arrow::ChunkedArray& column) {
+    // Buffers of bool are not supported, use unsigned char instead.
+    std::vector<std::uint8_t> data;
+    data.reserve(static_cast<size_t>(column.length()));
+    for (const auto& chunk : column.chunks()) {
+        const auto& array = static_cast<const arrow::BooleanArray&>(*chunk);
+        for (int64_t i = 0; i < array.length(); ++i) {
+            data.push_back(array.IsValid(i) && array.Value(i) ? 1 : 0);
+        }
+    }
+    df.addColumn<std::uint8_t>(header, std::move(data));
+}
+
+template <typename ArrayType>
+void addStrings(DataFrame& df, std::string_view header, const arrow::ChunkedArray& column) {
+    auto add = df.addCategoricalColumn(header)->addMany();
+    for (const auto& chunk : column.chunks()) {
+        const auto& array = static_cast<const ArrayType&>(*chunk);
+        for (int64_t i = 0; i < array.length(); ++i) {
+            add(array.IsValid(i) ? array.GetView(i) : std::string_view{});
+        }
+    }
+}
+
+bool addDictionary(DataFrame& df, std::string_view header, const arrow::ChunkedArray& column) {
+    const auto& type = static_cast<const arrow::DictionaryType&>(*column.type());
+    if (type.value_type()->id() != arrow::Type::STRING) return false;
+
+    auto add = df.addCategoricalColumn(header)->addMany();
+    for (const auto& chunk : column.chunks()) {
+        const auto& array = static_cast<const arrow::DictionaryArray&>(*chunk);
+        const auto& dictionary = static_cast<const arrow::StringArray&>(*array.dictionary());
+        for (int64_t i = 0; i < array.length(); ++i) {
+            add(array.IsValid(i) ? dictionary.GetView(array.GetValueIndex(i))
+                                 : std::string_view{});
+        }
+    }
+    return true;
+}
+
+const DataFormatBase* formatFromArrow(const arrow::DataType& type, size_t components) {
+    switch (type.id()) {
+        case arrow::Type::INT8:
+            return DataFormatBase::get(NumericType::SignedInteger, components, 8);
+        case arrow::Type::INT16:
+            return DataFormatBase::get(NumericType::SignedInteger, components, 16);
+        case arrow::Type::INT32:
+            return DataFormatBase::get(NumericType::SignedInteger, components, 32);
+        case arrow::Type::INT64:
+            return DataFormatBase::get(NumericType::SignedInteger, components, 64);
+        case arrow::Type::UINT8:
+            return DataFormatBase::get(NumericType::UnsignedInteger, components, 8);
+        case arrow::Type::UINT16:
+            return DataFormatBase::get(NumericType::UnsignedInteger, components, 16);
+        case arrow::Type::UINT32:
+            return DataFormatBase::get(NumericType::UnsignedInteger, components, 32);
+        case arrow::Type::UINT64:
+            return DataFormatBase::get(NumericType::UnsignedInteger, components, 64);
+        case arrow::Type::FLOAT:
+            return DataFormatBase::get(NumericType::Float, components, 32);
+        case arrow::Type::DOUBLE:
+            return DataFormatBase::get(NumericType::Float, components, 64);
+        default:
+            return nullptr;
+    }
+}
+
+bool addFixedSizeList(DataFrame& df, std::string_view header, Unit unit,
+                      const arrow::ChunkedArray& column) {
+    const auto& type = static_cast<const arrow::FixedSizeListType&>(*column.type());
+    const auto components = static_cast<size_t>(type.list_size());
+    if (components < 2 || components > 4) return false;
+    const auto* format = formatFromArrow(*type.value_type(), components);
+    if (!format) return false;
+
+    dispatching::singleDispatch<void, dispatching::filter::Vecs>(
+        format->getId(), [&]<typename V>() {
+            using ArrayType = typename arrow::CTypeTraits<util::value_type_t<V>>::ArrayType;
+
+            std::vector<V> data(static_cast<size_t>(column.length()));
+            size_t row = 0;
+            for (const auto& chunk : column.chunks()) {
+                const auto& array = static_cast<const arrow::FixedSizeListArray&>(*chunk);
+                const auto& values = static_cast<const ArrayType&>(*array.values());
+                std::memcpy(data.data() + row, values.raw_values() + array.value_offset(0),
+                            static_cast<size_t>(array.length()) * sizeof(V));
+                for (int64_t i = 0; i < array.length(); ++i) {
+                    if (array.IsNull(i)) {
+                        data[row + static_cast<size_t>(i)] = V{nullValue<util::value_type_t<V>>()};
+                    }
+                }
+                row += static_cast<size_t>(array.length());
+            }
+            df.addColumn<V>(header, std::move(data), unit);
+        });
+    return true;
+}
+
+/**
+ * Arrow buffer referring to the memory of a column buffer, which is kept alive as long as any
+ * array uses it.
+ */
+class ColumnBuffer : public arrow::Buffer {
+public:
+    ColumnBuffer(std::shared_ptr<const BufferBase> owner, const void* data, size_t size)
+        : arrow::Buffer{static_cast<const std::uint8_t*>(data), static_cast<int64_t>(size)}
+        , owner_{std::move(owner)} {}
+
+private:
+    std::shared_ptr<const BufferBase> owner_;
+};
+
+std::shared_ptr<arrow::Array> toArrowArray(const Column& column) {
+    if (column.getColumnType() == ColumnType::Categorical) {
+        const auto& categorical = static_cast<const CategoricalColumn&>(column);
+        const auto& ids = categorical.getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+
+        arrow::StringBuilder builder;
+        util::arrowCheck<DataWriterException>(builder.AppendValues(categorical.getCategories()));
+        std::shared_ptr<arrow::Array> dictionary;
+        util::arrowCheck<DataWriterException>(builder.Finish(&dictionary));
+
+        auto indices = std::make_shared<arrow::Int32Array>(
+            static_cast<int64_t>(ids.size()),
+            arrow::Buffer::FromVector(std::vector<std::int32_t>(ids.begin(), ids.end())));
+
+        return util::arrowCheck<DataWriterException>(arrow::DictionaryArray::FromArrays(
+            arrow::dictionary(arrow::int32(), arrow::utf8()), indices, dictionary));
+    }
+
+    auto buffer = column.getBuffer();
+    return buffer->getRepresentation<BufferRAM>()->dispatch<std::shared_ptr<arrow::Array>>(
+        [&]<typename T>(const BufferRAMPrecision<T>* ram) -> std::shared_ptr<arrow::Array> {
+            using Scalar = util::value_type_t<T>;
+            using ArrayType = typename arrow::CTypeTraits<Scalar>::ArrayType;
+
+            const auto size = ram->getSize();
+            auto data = std::make_shared<ColumnBuffer>(buffer, ram->getDataTyped(),
+                                                       size * sizeof(T));
+            if constexpr (util::extent_v<T> == 1) {
+                return std::make_shared<ArrayType>(static_cast<int64_t>(size), data);
+            } else {
+                constexpr auto components = static_cast<int32_t>(util::extent_v<T>);
+                auto values = std::make_shared<ArrayType>(
+                    static_cast<int64_t>(size * util::extent_v<T>), data);
+                return std::make_shared<arrow::FixedSizeListArray>(
+                    arrow::fixed_size_list(arrow::CTypeTraits<Scalar>::type_singleton(),
+                                           components),
+                    static_cast<int64_t>(size), values);
+            }
+        });
+}
+
+}  // namespace
+
+std::shared_ptr<DataFrame> util::toDataFrame(const arrow::Table& table) {
+    auto df = std::make_shared<DataFrame>();
+
+    for (int i = 0; i < table.num_columns(); ++i) {
+        const auto& field = *table.field(i);
+        const auto& column = *table.column(i);
+        const auto& header = field.name();
+        const auto unit = getUnit(field);
+
+        bool supported = true;
+        switch (column.type()->id()) {
+            case arrow::Type::INT8:
+                addNumeric<std::int8_t>(*df, header, unit, column);
+                break;
+            case arrow::Type::INT16:
+                addNumeric<std::int16_t>(*df, header, unit, column);
+                break;
+            case arrow::Type::INT32:
+                addNumeric<std::int32_t>(*df, header, unit, column);
+                break;
+            case arrow::Type::INT64:
+                addNumeric<std::int64_t>(*df, header, unit, column);
+                break;
+            case arrow::Type::UINT8:
+                addNumeric<std::uint8_t>(*df, header, unit, column);
+                break;
+            case arrow::Type::UINT16:
+                addNumeric<std::uint16_t>(*df, header, unit, column);
+                break;
+            case arrow::Type::UINT32:
+                addNumeric<std::uint32_t>(*df, header, unit, column);
+                break;
+            case arrow::Type::UINT64:
+                addNumeric<std::uint64_t>(*df, header, unit, column);
+                break;
+            case arrow::Type::FLOAT:
+                addNumeric<float>(*df, header, unit, column);
+                break;
+            case arrow::Type::DOUBLE:
+                addNumeric<double>(*df, header, unit, column);
+                break;
+            case arrow::Type::BOOL:
+                addBoolean(*df, header, column);
+                break;
+            case arrow::Type::STRING:
+                addStrings<arrow::StringArray>(*df, header, column);
+                break;
+            case arrow::Type::LARGE_STRING:
+                addStrings<arrow::LargeStringArray>(*df, header, column);
+                break;
+            case arrow::Type::DICTIONARY:
+                supported = addDictionary(*df, header, column);
+                break;
+            case arrow::Type::FIXED_SIZE_LIST:
+                supported = addFixedSizeList(*df, header, unit, column);
+                break;
+            default:
+                supported = false;
+                break;
+        }
+        if (!supported) {
+            log::warn("Skipping column '{}' with unsupported type {}", header,
+                      column.type()->ToString());
+        }
+    }
+
+    df->updateIndexBuffer();
+    return df;
+}
+
+std::shared_ptr<arrow::Table> util::toArrowTable(const DataFrame& dataFrame) {
+    std::vector<std::shared_ptr<arrow::Field>> fields;
+    std::vector<std::shared_ptr<arrow::Array>> arrays;
+
+    for (const auto& column : dataFrame) {
+        if (column->getColumnType() == ColumnType::Index) continue;
+
+        auto array = toArrowArray(*column);
+        std::shared_ptr<const arrow::KeyValueMetadata> metadata;
+        if (const auto unit = column->getUnit(); unit != Unit{}) {
+            metadata = arrow::key_value_metadata({"unit"}, {fmt::to_string(unit)});
+        }
+        fields.push_back(arrow::field(column->getHeader(), array->type(), true, metadata));
+        arrays.push_back(std::move(array));
+    }
+
+    return arrow::Table::Make(arrow::schema(fields), arrays);
+}
+
+}  // namespace inviwo
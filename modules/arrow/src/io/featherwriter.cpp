@@ -0,0 +1,85 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/arrow/io/featherwriter.h>
+
+#include <inviwo/arrow/arrowutils.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/util/fileextension.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+
+#include <arrow/buffer.h>
+#include <arrow/io/file.h>
+#include <arrow/io/memory.h>
+#include <arrow/ipc/feather.h>
+#include <arrow/table.h>
+
+namespace inviwo {
+
+namespace {
+
+void write(const DataFrame& dataFrame, arrow::io::OutputStream& stream) {
+    // Keep the file uncompressed so that it can be memory mapped when reading
+    auto properties = arrow::ipc::feather::WriteProperties::Defaults();
+    properties.compression = arrow::Compression::UNCOMPRESSED;
+
+    const auto table = util::toArrowTable(dataFrame);
+    util::arrowCheck<DataWriterException>(
+        arrow::ipc::feather::WriteTable(*table, &stream, properties));
+    util::arrowCheck<DataWriterException>(stream.Close());
+}
+
+}  // namespace
+
+FeatherWriter::FeatherWriter() : DataWriterType<DataFrame>() {
+    addExtension(FileExtension("feather", "Feather (Arrow IPC)"));
+    addExtension(FileExtension("arrow", "Arrow IPC"));
+}
+
+FeatherWriter* FeatherWriter::clone() const { return new FeatherWriter(*this); }
+
+void FeatherWriter::writeData(const DataFrame* data, const std::filesystem::path& filePath) const {
+    checkOverwrite(filePath);
+
+    auto stream = util::arrowCheck<DataWriterException>(
+        arrow::io::FileOutputStream::Open(filePath.string()));
+    write(*data, *stream);
+}
+
+std::unique_ptr<std::vector<unsigned char>> FeatherWriter::writeDataToBuffer(
+    const DataFrame* data, std::string_view) const {
+    auto stream = util::arrowCheck<DataWriterException>(arrow::io::BufferOutputStream::Create());
+    write(*data, *stream);
+
+    const auto buffer = util::arrowCheck<DataWriterException>(stream->Finish());
+    return std::make_unique<std::vector<unsigned char>>(buffer->data(),
+                                                        buffer->data() + buffer->size());
+}
+
+}  // namespace inviwo
@@ -0,0 +1,69 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/arrow/io/parquetreader.h>
+
+#include <inviwo/arrow/arrowutils.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/util/fileextension.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+
+#include <arrow/table.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/properties.h>
+
+namespace inviwo {
+
+ParquetReader::ParquetReader() : DataReaderType<DataFrame>() {
+    addExtension(FileExtension("parquet", "Apache Parquet"));
+}
+
+ParquetReader* ParquetReader::clone() const { return new ParquetReader(*this); }
+
+std::shared_ptr<DataFrame> ParquetReader::readData(const std::filesystem::path& filePath) {
+    const auto localPath = downloadAndCacheIfUrl(filePath);
+    checkExists(localPath);
+
+    parquet::arrow::FileReaderBuilder builder;
+    util::arrowCheck<DataReaderException>(builder.OpenFile(localPath.string(), true));
+
+    // Decode the columns in parallel using the arrow thread pool
+    auto properties = parquet::default_arrow_reader_properties();
+    properties.set_use_threads(true);
+
+    std::unique_ptr<parquet::arrow::FileReader> reader;
+    util::arrowCheck<DataReaderException>(builder.properties(properties)->Build(&reader));
+
+    std::shared_ptr<arrow::Table> table;
+    util::arrowCheck<DataReaderException>(reader->ReadTable(&table));
+
+    return util::toDataFrame(*table);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,88 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/arrow/io/parquetwriter.h>
+
+#include <inviwo/arrow/arrowutils.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/util/fileextension.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+
+#include <arrow/buffer.h>
+#include <arrow/io/file.h>
+#include <arrow/io/memory.h>
+#include <arrow/memory_pool.h>
+#include <arrow/table.h>
+#include <parquet/arrow/writer.h>
+#include <parquet/properties.h>
+
+namespace inviwo {
+
+namespace {
+
+constexpr int64_t rowGroupSize = 1024 * 1024;
+
+void write(const DataFrame& dataFrame, std::shared_ptr<arrow::io::OutputStream> stream) {
+    // Store the arrow schema to keep dictionary encoded columns and the units of the columns
+    const auto arrowProperties = parquet::ArrowWriterProperties::Builder().store_schema()->build();
+
+    const auto table = util::toArrowTable(dataFrame);
+    util::arrowCheck<DataWriterException>(parquet::arrow::WriteTable(
+        *table, arrow::default_memory_pool(), stream, rowGroupSize,
+        parquet::default_writer_properties(), arrowProperties));
+    util::arrowCheck<DataWriterException>(stream->Close());
+}
+
+}  // namespace
+
+ParquetWriter::ParquetWriter() : DataWriterType<DataFrame>() {
+    addExtension(FileExtension("parquet", "Apache Parquet"));
+}
+
+ParquetWriter* ParquetWriter::clone() const { return new ParquetWriter(*this); }
+
+void ParquetWriter::writeData(const DataFrame* data, const std::filesystem::path& filePath) const {
+    checkOverwrite(filePath);
+
+    auto stream = util::arrowCheck<DataWriterException>(
+        arrow::io::FileOutputStream::Open(filePath.string()));
+    write(*data, stream);
+}
+
+std::unique_ptr<std::vector<unsigned char>> ParquetWriter::writeDataToBuffer(
+    const DataFrame* data, std::string_view) const {
+    auto stream = util::arrowCheck<DataWriterException>(arrow::io::BufferOutputStream::Create());
+    write(*data, stream);
+
+    const auto buffer = util::arrowCheck<DataWriterException>(stream->Finish());
+    return std::make_unique<std::vector<unsigned char>>(buffer->data(),
+                                                        buffer->data() + buffer->size());
+}
+
+}  // namespace inviwo
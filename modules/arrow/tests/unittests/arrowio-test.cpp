@@ -0,0 +1,100 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/arrow/io/featherreader.h>
+#include <inviwo/arrow/io/featherwriter.h>
+#include <inviwo/arrow/io/parquetreader.h>
+#include <inviwo/arrow/io/parquetwriter.h>
+#include <inviwo/core/datastructures/unitsystem.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+
+namespace inviwo {
+
+namespace {
+
+std::shared_ptr<DataFrame> createDataFrame() {
+    auto df = std::make_shared<DataFrame>();
+    df->addColumn<float>("float", std::vector<float>{1.0f, 2.5f, -3.0f},
+                         units::unit_from_string("m"));
+    df->addColumn<int>("int", std::vector<int>{1, 2, 3});
+    df->addColumn<vec3>("vec3", std::vector<vec3>{vec3{1.0f}, vec3{2.0f}, vec3{3.0f}});
+    auto adder = df->addCategoricalColumn("category")->addMany();
+    for (auto str : {"a", "b", "a"}) {
+        adder(str);
+    }
+    df->updateIndexBuffer();
+    return df;
+}
+
+void expectEqual(const DataFrame& expected, const DataFrame& result) {
+    ASSERT_EQ(expected.getNumberOfColumns(), result.getNumberOfColumns());
+    ASSERT_EQ(expected.getNumberOfRows(), result.getNumberOfRows());
+    for (size_t i = 0; i < expected.getNumberOfColumns(); ++i) {
+        const auto& a = *expected.getColumn(i);
+        const auto& b = *result.getColumn(i);
+        EXPECT_EQ(a.getHeader(), b.getHeader());
+        EXPECT_EQ(a.getColumnType(), b.getColumnType());
+        EXPECT_EQ(a.getUnit(), b.getUnit()) << a.getHeader();
+        for (size_t row = 0; row < expected.getNumberOfRows(); ++row) {
+            EXPECT_EQ(a.getAsString(row), b.getAsString(row)) << a.getHeader() << " row " << row;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(ArrowIO, featherRoundTrip) {
+    const auto df = createDataFrame();
+    util::TempFileHandle tmpFile("", ".feather");
+    FeatherWriter writer{};
+    writer.setOverwrite(Overwrite::Yes);
+    writer.writeData(df.get(), tmpFile.getFileName());
+
+    const auto result = FeatherReader{}.readData(tmpFile.getFileName());
+    expectEqual(*df, *result);
+}
+
+TEST(ArrowIO, parquetRoundTrip) {
+    const auto df = createDataFrame();
+    util::TempFileHandle tmpFile("", ".parquet");
+    ParquetWriter writer{};
+    writer.setOverwrite(Overwrite::Yes);
+    writer.writeData(df.get(), tmpFile.getFileName());
+
+    const auto result = ParquetReader{}.readData(tmpFile.getFileName());
+    expectEqual(*df, *result);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,85 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/assimp/assimpmoduledefine.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+namespace inviwo {
+
+class Mesh;
+
+/**
+ * An on-disk cache of imported meshes in a simple native binary format, a cached mesh can be read
+ * back with a few bulk reads instead of parsing and post-processing the source file again. A mesh
+ * is stored under a key computed from the path, size, and modification time of the source file
+ * together with the post-processing flags used, hence editing the file or changing the flags
+ * results in a new key. Only meshes with float32 vec3/vec4 buffers and uint32 indices, i.e. what
+ * the AssimpReader creates, can be cached. Loading and storing different keys is thread safe.
+ * @see AssimpReader::setMeshCache
+ */
+class IVW_MODULE_ASSIMP_API AssimpMeshCache {
+public:
+    explicit AssimpMeshCache(std::filesystem::path directory);
+
+    /**
+     * Compute the key for the mesh imported from @p file using the post-processing @p flags
+     * @return the key, or 0 if the file can not be inspected
+     */
+    std::uint64_t key(const std::filesystem::path& file, unsigned int flags) const;
+
+    /**
+     * Read the mesh stored under @p key
+     * @return the mesh, or nullptr if there is no usable cached mesh.
+     */
+    std::shared_ptr<Mesh> load(std::uint64_t key) const;
+
+    /**
+     * Store @p mesh under @p key. Failures are only logged.
+     */
+    void store(const Mesh& mesh, std::uint64_t key) const;
+
+    /**
+     * Remove all cached meshes
+     */
+    void clear() const;
+
+    const std::filesystem::path& getDirectory() const;
+
+private:
+    std::filesystem::path file(std::uint64_t key) const;
+
+    std::filesystem::path directory_;
+};
+
+}  // namespace inviwo
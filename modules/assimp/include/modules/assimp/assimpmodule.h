@@ -33,12 +33,19 @@
 
 #include <inviwo/core/common/inviwomodule.h>  // for InviwoModule
 
+#include <memory>  // for shared_ptr
+
 namespace inviwo {
 class InviwoApplication;
+class AssimpMeshCache;
 
 class IVW_MODULE_ASSIMP_API AssimpModule : public InviwoModule {
 public:
     AssimpModule(InviwoApplication* app);
+    virtual ~AssimpModule();
+
+private:
+    std::shared_ptr<AssimpMeshCache> meshCache_;
 };
 
 }  // namespace inviwo
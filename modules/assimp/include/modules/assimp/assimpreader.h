@@ -40,6 +40,8 @@
 
 namespace inviwo {
 
+class AssimpMeshCache;
+
 enum class AssimpLogLevel : int { None, Error, Warn, Info, Debug };  // increased verbosity
 
 /**
@@ -47,6 +49,11 @@ enum class AssimpLogLevel : int { None, Error, Warn, Info, Debug };  // increase
  * \brief Inviwo Module Assimp
  *
  *  A GeometryReader (DataReaderType<Geometry>) using the Assimp Library.
+ *
+ *  Supported options, see setOption:
+ *   * "FixInvalidData" (bool) see setFixInvalidDataFlag
+ *   * "PostProcessFlags" (unsigned int) see setPostProcessFlags
+ *   * "LogLevel" (LogVerbosity) see setLogLevel
  */
 class IVW_MODULE_ASSIMP_API AssimpReader : public DataReaderType<Mesh> {
 public:
@@ -62,6 +69,29 @@ public:
     void setFixInvalidDataFlag(bool enable);
     bool getFixInvalidDataFlag() const;
 
+    /**
+     * The assimp post-processing steps (aiPostProcessSteps) used by default. Triangulation,
+     * smooth normals, vertex joining, and pre-transformed vertices.
+     */
+    static unsigned int defaultPostProcessFlags();
+
+    /**
+     * Set the assimp post-processing steps (aiPostProcessSteps) applied after import. Expensive
+     * steps like aiProcess_JoinIdenticalVertices or aiProcess_GenSmoothNormals can be skipped
+     * for large models that don't need them. aiProcess_FindInvalidData is added when the fix
+     * invalid data flag is set. Since the scene graph is ignored, the flags should keep
+     * aiProcess_PreTransformVertices.
+     */
+    void setPostProcessFlags(unsigned int flags);
+    unsigned int getPostProcessFlags() const;
+
+    /**
+     * Reuse meshes from @p cache when the same file is imported again with the same flags, and
+     * add newly imported meshes to it. Caching is disabled when @p cache is nullptr, the default.
+     */
+    void setMeshCache(std::shared_ptr<const AssimpMeshCache> cache);
+    const std::shared_ptr<const AssimpMeshCache>& getMeshCache() const;
+
     virtual std::shared_ptr<Mesh> readData(const std::filesystem::path& filePath) override;
 
     virtual bool setOption(std::string_view key, std::any value) override;
@@ -74,6 +104,8 @@ private:
     bool fixInvalidData_;  //!< if true, the imported data will be checked for invalid data, e.g.
                            //!< invalid normals or UV coords, which might be fixed or removed by
                            //!< Assimp
+    unsigned int postProcessFlags_;
+    std::shared_ptr<const AssimpMeshCache> meshCache_;
 };
 
 }  // namespace inviwo
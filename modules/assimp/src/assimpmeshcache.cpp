@@ -0,0 +1,243 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/assimp/assimpmeshcache.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>          // for Buffer, IndexBuffer
+#include <inviwo/core/datastructures/buffer/bufferram.h>       // for BufferRAM
+#include <inviwo/core/datastructures/geometry/geometrytype.h>  // for BufferType, DrawType
+#include <inviwo/core/datastructures/geometry/mesh.h>          // for Mesh
+#include <inviwo/core/util/constexprhash.h>                    // for constexpr_hash
+#include <inviwo/core/util/formats.h>                          // for DataFormatId
+#include <inviwo/core/util/glmvec.h>                           // for vec3, vec4
+#include <inviwo/core/util/logcentral.h>                       // for log::warn
+
+#include <fstream>       // for ifstream, ofstream
+#include <functional>    // for hash
+#include <optional>      // for optional, nullopt
+#include <system_error>  // for error_code
+#include <thread>        // for this_thread
+#include <utility>       // for move
+#include <vector>        // for vector
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::uint32_t magic = 0x4d415649;  // "IVAM"
+constexpr std::uint32_t version = 1;
+
+struct Header {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t key;
+    std::uint32_t buffers;
+    std::uint32_t indexBuffers;
+};
+
+struct BufferHeader {
+    std::int32_t type;
+    std::int32_t location;
+    std::uint32_t components;
+    std::uint32_t reserved;
+    std::uint64_t size;
+};
+
+struct IndexHeader {
+    std::int32_t drawType;
+    std::int32_t connectivity;
+    std::uint64_t size;
+};
+
+// Read @p size values, if the @p fileSize bytes long file has that many left
+template <typename T>
+std::optional<std::vector<T>> readVector(std::istream& in, std::uint64_t size,
+                                         std::uint64_t fileSize) {
+    const auto pos = in.tellg();
+    if (pos < 0 || static_cast<std::uint64_t>(pos) > fileSize ||
+        size > (fileSize - static_cast<std::uint64_t>(pos)) / sizeof(T)) {
+        return std::nullopt;
+    }
+    std::vector<T> data(size);
+    in.read(reinterpret_cast<char*>(data.data()),
+            static_cast<std::streamsize>(data.size() * sizeof(T)));
+    if (!in) return std::nullopt;
+    return data;
+}
+
+template <typename T>
+void write(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+}  // namespace
+
+AssimpMeshCache::AssimpMeshCache(std::filesystem::path directory)
+    : directory_{std::move(directory)} {}
+
+std::uint64_t AssimpMeshCache::key(const std::filesystem::path& file, unsigned int flags) const {
+    std::error_code ec;
+    const auto path = std::filesystem::weakly_canonical(file, ec);
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec) return 0;
+    const auto time = std::filesystem::last_write_time(path, ec);
+    if (ec) return 0;
+
+    return util::constexpr_hash(fmt::format("{}\n{}\n{}\n{}\n{}", version, path.generic_string(),
+                                            size, time.time_since_epoch().count(), flags));
+}
+
+std::shared_ptr<Mesh> AssimpMeshCache::load(std::uint64_t key) const {
+    const auto path = file(key);
+    std::ifstream in{path, std::ios::binary};
+    if (!in) return nullptr;
+    std::error_code ec;
+    const std::uint64_t fileSize = std::filesystem::file_size(path, ec);
+    if (ec) return nullptr;
+
+    const auto mesh = [&]() -> std::shared_ptr<Mesh> {
+        Header header{};
+        in.read(reinterpret_cast<char*>(&header), sizeof(Header));
+        if (!in || header.magic != magic || header.version != version || header.key != key) {
+            return nullptr;
+        }
+
+        auto result = std::make_shared<Mesh>();
+        for (std::uint32_t i = 0; i < header.buffers && in; ++i) {
+            BufferHeader bh{};
+            in.read(reinterpret_cast<char*>(&bh), sizeof(BufferHeader));
+            if (!in) return nullptr;
+            const Mesh::BufferInfo info{static_cast<BufferType>(bh.type), bh.location};
+            if (bh.components == 3) {
+                auto data = readVector<vec3>(in, bh.size, fileSize);
+                if (!data) return nullptr;
+                result->addBuffer(info, util::makeBuffer(std::move(*data)));
+            } else if (bh.components == 4) {
+                auto data = readVector<vec4>(in, bh.size, fileSize);
+                if (!data) return nullptr;
+                result->addBuffer(info, util::makeBuffer(std::move(*data)));
+            } else {
+                return nullptr;
+            }
+        }
+        for (std::uint32_t i = 0; i < header.indexBuffers && in; ++i) {
+            IndexHeader ih{};
+            in.read(reinterpret_cast<char*>(&ih), sizeof(IndexHeader));
+            if (!in) return nullptr;
+            auto data = readVector<std::uint32_t>(in, ih.size, fileSize);
+            if (!data) return nullptr;
+            result->addIndices(Mesh::MeshInfo{static_cast<DrawType>(ih.drawType),
+                                            static_cast<ConnectivityType>(ih.connectivity)},
+                             util::makeIndexBuffer(std::move(*data)));
+        }
+        return in ? result : nullptr;
+    }();
+
+    if (!mesh) {
+        // A truncated, corrupt or outdated file, remove it so it will be replaced
+        in.close();
+        std::filesystem::remove(path, ec);
+    }
+    return mesh;
+}
+
+void AssimpMeshCache::store(const Mesh& mesh, std::uint64_t key) const {
+    std::vector<std::pair<BufferHeader, const BufferRAM*>> buffers;
+    for (const auto& [info, buffer] : mesh.getBuffers()) {
+        const auto* ram = buffer->getRepresentation<BufferRAM>();
+        const auto id = ram->getDataFormat()->getId();
+        if (id != DataFormatId::Vec3Float32 && id != DataFormatId::Vec4Float32) return;
+        buffers.emplace_back(BufferHeader{static_cast<std::int32_t>(info.type), info.location,
+                                          id == DataFormatId::Vec3Float32 ? 3u : 4u, 0,
+                                          static_cast<std::uint64_t>(ram->getSize())},
+                             ram);
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    if (ec) {
+        log::warn("Unable to create mesh cache {:?g}: {}", directory_, ec.message());
+        return;
+    }
+
+    const Header header{magic, version, key, static_cast<std::uint32_t>(buffers.size()),
+                        static_cast<std::uint32_t>(mesh.getIndexBuffers().size())};
+
+    // Write to a temporary file and rename it so that other running instances, or other threads
+    // importing the same file, never read a partially written mesh
+    const auto path = file(key);
+    auto tmp = path;
+    tmp += fmt::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+        std::ofstream out{tmp, std::ios::binary | std::ios::trunc};
+        write(out, header);
+        for (const auto& [bh, ram] : buffers) {
+            write(out, bh);
+            out.write(static_cast<const char*>(ram->getData()),
+                      static_cast<std::streamsize>(bh.size * bh.components * sizeof(float)));
+        }
+        for (const auto& [info, indices] : mesh.getIndexBuffers()) {
+            const auto& data = indices->getRAMRepresentation()->getDataContainer();
+            write(out, IndexHeader{static_cast<std::int32_t>(info.dt),
+                                   static_cast<std::int32_t>(info.ct),
+                                   static_cast<std::uint64_t>(data.size())});
+            out.write(reinterpret_cast<const char*>(data.data()),
+                      static_cast<std::streamsize>(data.size() * sizeof(std::uint32_t)));
+        }
+        if (!out) {
+            log::warn("Unable to write cached mesh {:?g}", tmp);
+            out.close();
+            std::filesystem::remove(tmp, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) std::filesystem::remove(tmp, ec);
+}
+
+void AssimpMeshCache::clear() const {
+    std::error_code ec;
+    const auto removed = std::filesystem::remove_all(directory_, ec);
+    if (ec) {
+        log::warn("Unable to clear mesh cache {:?g}: {}", directory_, ec.message());
+    } else {
+        log::info("Removed {} cached meshes", removed > 0 ? removed - 1 : 0);
+    }
+}
+
+const std::filesystem::path& AssimpMeshCache::getDirectory() const { return directory_; }
+
+std::filesystem::path AssimpMeshCache::file(std::uint64_t key) const {
+    return directory_ / fmt::format("{:016x}.ivmesh", key);
+}
+
+}  // namespace inviwo
@@ -31,14 +31,20 @@
 
 #include <inviwo/core/common/inviwomodule.h>  // for InviwoModule
 #include <inviwo/core/io/datareader.h>        // for DataReader
+#include <inviwo/core/util/filesystem.h>      // for getPath, PathType
+#include <modules/assimp/assimpmeshcache.h>   // for AssimpMeshCache
 #include <modules/assimp/assimpreader.h>      // for AssimpReader
+#include <modules/assimp/assimpsettings.h>    // for AssimpSettings
 
-#include <memory>  // for make_unique
+#include <memory>  // for make_unique, make_shared
 
 namespace inviwo {
 class InviwoApplication;
 
-AssimpModule::AssimpModule(InviwoApplication* app) : InviwoModule(app, "assimp") {
+AssimpModule::AssimpModule(InviwoApplication* app)
+    : InviwoModule(app, "assimp")
+    , meshCache_{
+          std::make_shared<AssimpMeshCache>(filesystem::getPath(PathType::Cache) / "assimp")} {
     // Add a directory to the search path of the Shadermanager
     // ShaderManager::getPtr()->addShaderSearchPath(getPath(ModulePath::GLSL));
 
@@ -51,7 +57,17 @@ AssimpModule::AssimpModule(InviwoApplication* app) : InviwoModule(app, "assimp")
     // registerProperty<assimpProperty>();
 
     // Readers and writes
-    registerDataReader(std::make_unique<AssimpReader>());
+    auto reader = std::make_unique<AssimpReader>();
+    auto settings = std::make_unique<AssimpSettings>();
+    // Readers are cloned from the registered one, hence they will all share the cache
+    const auto updateCache = [r = reader.get(), s = settings.get(), cache = meshCache_]() {
+        r->setMeshCache(s->meshCache_.get() ? cache : nullptr);
+    };
+    updateCache();
+    settings->meshCache_.onChange(updateCache);
+    settings->clearMeshCache_.onChange([cache = meshCache_]() { cache->clear(); });
+    registerSettings(std::move(settings));
+    registerDataReader(std::move(reader));
     // registerDataWriter(new assimpWriter());
 
     // Data converters
@@ -79,4 +95,6 @@ AssimpModule::AssimpModule(InviwoApplication* app) : InviwoModule(app, "assimp")
     // registerResource(Resource* resource);
 }
 
+AssimpModule::~AssimpModule() = default;
+
 }  // namespace inviwo
@@ -28,6 +28,7 @@
  *********************************************************************************/
 
 #include <modules/assimp/assimpreader.h>
+#include <modules/assimp/assimpmeshcache.h>
 
 #include <inviwo/core/datastructures/buffer/buffer.h>                   // for Buffer, IndexBuffer
 #include <inviwo/core/datastructures/buffer/bufferram.h>                // for Vec3BufferRAM
@@ -40,6 +41,7 @@
 #include <inviwo/core/util/fileextension.h>                             // for FileExtension
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, vec4
 #include <inviwo/core/util/logcentral.h>                                // for LogVerbosity, Log...
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 #include <inviwo/core/util/stringconversion.h>                          // for splitStringView
 
 #include <warn/push>
@@ -61,15 +63,17 @@
 
 #include <warn/pop>
 
-#include <algorithm>      // for max
+#include <algorithm>      // for max, transform, fill_n
 #include <array>          // for array, array<>::v...
 #include <cstdint>        // for uint32_t
-#include <cstring>        // for strlen
+#include <cstring>        // for strlen, memcpy
 #include <ctime>          // for size_t, clock
+#include <limits>         // for numeric_limits
 #include <string>         // for basic_string<>::v...
-#include <type_traits>    // for remove_extent_t
+#include <type_traits>    // for remove_extent_t, is_same_v
 #include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
+#include <utility>        // for move
 #include <vector>         // for vector
 #include <fmt/format.h>
 #include <fmt/std.h>
@@ -103,11 +107,52 @@ public:
     }
 };
 
+namespace {
+
+// Number of vertices or faces converted in each task
+constexpr size_t verticesPerTask = 1 << 16;
+
+vec3 toGLM(const aiVector3D& v) { return vec3(v.x, v.y, v.z); }
+vec4 toGLM(const aiColor4D& c) { return vec4(c.r, c.g, c.b, c.a); }
+
+/**
+ * Copy @p count assimp vectors/colors to @p dst, which is a plain memcpy when assimp uses floats
+ * since the types then have the same layout.
+ */
+template <typename Src, typename Dst>
+void copyAttribute(const Src* src, size_t count, Dst* dst) {
+    if constexpr (std::is_same_v<ai_real, float> && sizeof(Src) == sizeof(Dst)) {
+        std::memcpy(dst, src, count * sizeof(Dst));
+    } else {
+        std::transform(src, src + count, dst, [](const Src& v) { return toGLM(v); });
+    }
+}
+
+/**
+ * The number of indices of every face in @p m if all faces have the same size, otherwise 0.
+ */
+size_t facesOfSameSize(const aiMesh& m) {
+    switch (m.mPrimitiveTypes) {
+        case aiPrimitiveType_POINT:
+            return 1;
+        case aiPrimitiveType_LINE:
+            return 2;
+        case aiPrimitiveType_TRIANGLE:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+}  // namespace
+
 AssimpReader::AssimpReader()
     : DataReaderType<Mesh>()
     , logLevel_(AssimpLogLevel::Warn)
     , verboseLog_(false)
-    , fixInvalidData_(false) {
+    , fixInvalidData_(false)
+    , postProcessFlags_(defaultPostProcessFlags())
+    , meshCache_{} {
     aiString str{};
     Assimp::Importer importer{};
 
@@ -138,7 +183,45 @@ void AssimpReader::setFixInvalidDataFlag(bool enable) { fixInvalidData_ = enable
 
 bool AssimpReader::getFixInvalidDataFlag() const { return fixInvalidData_; }
 
+unsigned int AssimpReader::defaultPostProcessFlags() {
+    // + `aiProcess_PreTransformVertices` considers all potential transformations within scene
+    // graphs
+    // + `aiProcess_ImproveCacheLocality` does not work for non-triangular meshes (n-gons) even when
+    //   a triangulation is enforced
+    // + `aiProcess_OptimizeGraph` is incompatible to aiProcess_PreTransformVertices
+    //
+    // @see aiPrimitiveType (https://github.com/assimp/assimp/blob/master/include/assimp/mesh.h)
+    return aiProcess_JoinIdenticalVertices | aiProcess_Triangulate | aiProcess_GenSmoothNormals |
+           aiProcess_PreTransformVertices | aiProcess_ValidateDataStructure |
+           aiProcess_RemoveRedundantMaterials | aiProcess_OptimizeMeshes | aiProcess_SortByPType;
+}
+
+void AssimpReader::setPostProcessFlags(unsigned int flags) { postProcessFlags_ = flags; }
+
+unsigned int AssimpReader::getPostProcessFlags() const { return postProcessFlags_; }
+
+void AssimpReader::setMeshCache(std::shared_ptr<const AssimpMeshCache> cache) {
+    meshCache_ = std::move(cache);
+}
+
+const std::shared_ptr<const AssimpMeshCache>& AssimpReader::getMeshCache() const {
+    return meshCache_;
+}
+
 std::shared_ptr<Mesh> AssimpReader::readData(const std::filesystem::path& filePath) {
+    // set flags for postprocessing in Assimp, see defaultPostProcessFlags()
+    unsigned int flags = postProcessFlags_;
+    if (fixInvalidData_) {
+        flags |= aiProcess_FindInvalidData;
+    }
+
+    const auto cacheKey = meshCache_ ? meshCache_->key(filePath, flags) : std::uint64_t{0};
+    if (cacheKey != 0) {
+        if (auto mesh = meshCache_->load(cacheKey)) {
+            return mesh;
+        }
+    }
+
     Assimp::Importer importer;
 
     std::clock_t start_readmetadata = std::clock();
@@ -170,23 +253,6 @@ std::shared_ptr<Mesh> AssimpReader::readData(const std::filesystem::path& filePa
         }
     }
 
-    // set flags for postprocessing in Assimp
-    // + `aiProcess_PreTransformVertices` considers all potential transformations within scene
-    // graphs
-    // + `aiProcess_ImproveCacheLocality` does not work for non-triangular meshes (n-gons) even when
-    //   a triangulation is enforced
-    // + `aiProcess_OptimizeGraph` is incompatible to aiProcess_PreTransformVertices
-    //
-    // @see aiPrimitiveType (https://github.com/assimp/assimp/blob/master/include/assimp/mesh.h)
-    unsigned int flags = aiProcess_JoinIdenticalVertices | aiProcess_Triangulate |
-                         aiProcess_GenSmoothNormals | aiProcess_PreTransformVertices |
-                         aiProcess_ValidateDataStructure | aiProcess_RemoveRedundantMaterials |
-                         aiProcess_OptimizeMeshes | aiProcess_SortByPType;
-
-    if (fixInvalidData_) {
-        flags |= aiProcess_FindInvalidData;
-    }
-
     const aiScene* scene = importer.ReadFile(filePath.string(), flags);
 
     std::clock_t start_convert = std::clock();
@@ -212,7 +278,6 @@ std::shared_ptr<Mesh> AssimpReader::readData(const std::filesystem::path& filePa
     // fill texture and color channels with garbage/padding data if the channel count differs
     // between meshes
 
-    uint32_t vertex_offset = 0;
     size_t color_channels = 0;
     size_t texture_channels = 0;
     bool use_normals = true;
@@ -251,53 +316,35 @@ std::shared_ptr<Mesh> AssimpReader::readData(const std::filesystem::path& filePa
         }
     }
 
-    // create Inviwo's data structures for the model
-    auto mesh = std::make_shared<Mesh>();
-
-    auto prep = std::make_shared<Vec3BufferRAM>();
-    auto pbuff = std::make_shared<Buffer<vec3>>(prep);
-
-    std::shared_ptr<Vec3BufferRAM> nrep;
-    std::shared_ptr<Buffer<vec3>> nbuff;
-
-    if (use_normals) {
-        nrep = std::make_shared<Vec3BufferRAM>();
-        nbuff = std::make_shared<Buffer<vec3>>(nrep);
+    const size_t numMeshes = size_t{scene->mNumMeshes};
+    std::vector<size_t> vertexOffsets(numMeshes + 1, 0);
+    for (size_t i = 0; i < numMeshes; ++i) {
+        vertexOffsets[i + 1] = vertexOffsets[i] + size_t{scene->mMeshes[i]->mNumVertices};
+    }
+    const size_t numVertices = vertexOffsets.back();
+    if (numVertices > size_t{std::numeric_limits<uint32_t>::max()}) {
+        throw DataReaderException(SourceContext{}, "too many vertices ({}) in {}", numVertices,
+                                  filePath);
     }
 
-    std::array<std::shared_ptr<Buffer<vec4>>, AI_MAX_NUMBER_OF_COLOR_SETS> cbuff;
-    std::array<std::shared_ptr<Vec4BufferRAM>, AI_MAX_NUMBER_OF_COLOR_SETS> crep;
-
+    // Allocate all buffers up front, each mesh is then converted in parallel into its own range
+    // of the buffers
+    std::vector<vec3> positions(numVertices);
+    std::vector<vec3> normals(use_normals ? numVertices : 0);
+    std::array<std::vector<vec4>, AI_MAX_NUMBER_OF_COLOR_SETS> colors;
     for (size_t i = 0; i < color_channels; ++i) {
-        crep[i] = std::make_shared<Vec4BufferRAM>();
-        cbuff[i] = std::make_shared<Buffer<vec4>>(crep[i]);
+        colors[i].resize(numVertices);
     }
-
-    std::array<std::shared_ptr<Buffer<vec3>>, AI_MAX_NUMBER_OF_TEXTURECOORDS> tbuff;
-    std::array<std::shared_ptr<Vec3BufferRAM>, AI_MAX_NUMBER_OF_TEXTURECOORDS> trep;
-
+    std::array<std::vector<vec3>, AI_MAX_NUMBER_OF_TEXTURECOORDS> texCoords;
     for (size_t i = 0; i < texture_channels; ++i) {
-        trep[i] = std::make_shared<Vec3BufferRAM>();
-        tbuff[i] = std::make_shared<Buffer<vec3>>(trep[i]);
+        texCoords[i].resize(numVertices);
     }
+    std::vector<std::vector<uint32_t>> indices(numMeshes);
 
-    // iterate over the meshes and fill the data structures
-    for (size_t i = 0; i < size_t{scene->mNumMeshes}; ++i) {
-        aiMesh* m = scene->mMeshes[i];
-
-        // positions
-        for (size_t j = 0; j < m->mNumVertices; ++j) {
-            aiVector3D v = m->mVertices[j];
-            prep->add(vec3(v.x, v.y, v.z));
-        }
-
-        // normals
-        if (use_normals) {
-            for (size_t j = 0; j < m->mNumVertices; ++j) {
-                aiVector3D n = m->mNormals[j];
-                nrep->add(vec3(n.x, n.y, n.z));
-            }
-        }
+    const auto convertMesh = [&](size_t i) {
+        const aiMesh* m = scene->mMeshes[i];
+        const size_t offset = vertexOffsets[i];
+        const size_t count = size_t{m->mNumVertices};
 
         // colors
         vec4 padding_color(0.6, 0.6, 0.6, 1.0);
@@ -324,78 +371,101 @@ std::shared_ptr<Mesh> AssimpReader::readData(const std::filesystem::path& filePa
                     padding_color = dcol;
                 }
             }
+        }
+        const vec4 material_influence_color = padding_color * material_influence;
+
+        // Large meshes are split further into chunks of vertices
+        util::parallelFor(
+            0, count,
+            [&](size_t first, size_t last) {
+                const size_t n = last - first;
+                copyAttribute(m->mVertices + first, n, positions.data() + offset + first);
+                if (use_normals) {
+                    copyAttribute(m->mNormals + first, n, normals.data() + offset + first);
+                }
 
-            vec4 material_influence_color = padding_color * material_influence;
-
-            for (size_t l = 0; l < size_t{m->GetNumColorChannels()}; ++l) {
-                for (size_t j = 0; j < size_t{m->mNumVertices}; ++j) {
-                    aiColor4D c = m->mColors[l][j];
-                    crep[l]->add(vec4(c.r, c.g, c.b, c.a) * (1.0f - material_influence) +
-                                 material_influence_color);
+                for (size_t l = 0; l < size_t{m->GetNumColorChannels()}; ++l) {
+                    auto* dst = colors[l].data() + offset + first;
+                    copyAttribute(m->mColors[l] + first, n, dst);
+                    if (use_materials) {
+                        std::for_each(dst, dst + n, [&](vec4& c) {
+                            c = c * (1.0f - material_influence) + material_influence_color;
+                        });
+                    }
                 }
-            }
-        } else {
-            for (size_t l = 0; l < size_t{m->GetNumColorChannels()}; ++l) {
-                for (size_t j = 0; j < size_t{m->mNumVertices}; ++j) {
-                    aiColor4D c = m->mColors[l][j];
-                    crep[l]->add(vec4(c.r, c.g, c.b, c.a));
+                // fill not existing color channels with padding data
+                for (size_t l = size_t{m->GetNumColorChannels()}; l < color_channels; ++l) {
+                    std::fill_n(colors[l].data() + offset + first, n, padding_color);
                 }
-            }
-        }
 
-        // fill not existing color channels with padding data
-        for (size_t l = size_t{m->GetNumColorChannels()}; l < color_channels; ++l) {
-            for (size_t j = 0; j < size_t{m->mNumVertices}; ++j) {
-                crep[l]->add(padding_color);
-            }
-        }
-
-        // texture coordinates
-        for (size_t l = 0; l < m->GetNumUVChannels(); ++l) {
-            for (size_t j = 0; j < m->mNumVertices; ++j) {
-                aiVector3D t = m->mTextureCoords[l][j];
-                trep[l]->add(vec3(t.x, t.y, t.z));
-            }
-        }
-
-        for (size_t l = size_t{m->GetNumUVChannels()}; l < texture_channels; ++l) {
-            for (size_t j = 0; j < size_t{m->mNumVertices}; ++j) {
-                trep[l]->add(vec3(0.0, 0.0, 0.0));
-            }
-        }
+                // texture coordinates, not existing channels are already zero
+                for (size_t l = 0; l < size_t{m->GetNumUVChannels()}; ++l) {
+                    copyAttribute(m->mTextureCoords[l] + first, n,
+                                  texCoords[l].data() + offset + first);
+                }
+            },
+            {.grainSize = verticesPerTask});
 
         // indices
-        std::vector<uint32_t> indices;
-        for (size_t j = 0; j < m->mNumFaces; ++j) {
-            aiFace face = m->mFaces[j];
-            for (size_t k = 0; k < face.mNumIndices; ++k) {
-                indices.push_back(vertex_offset + face.mIndices[k]);
+        const auto vertex_offset = static_cast<uint32_t>(offset);
+        auto& meshIndices = indices[i];
+        const auto indicesPerFace = facesOfSameSize(*m);
+        if (indicesPerFace > 0) {
+            meshIndices.resize(size_t{m->mNumFaces} * indicesPerFace);
+            util::parallelFor(
+                0, size_t{m->mNumFaces},
+                [&](size_t first, size_t last) {
+                    auto* dst = meshIndices.data() + first * indicesPerFace;
+                    for (size_t j = first; j < last; ++j) {
+                        const aiFace& face = m->mFaces[j];
+                        for (size_t k = 0; k < indicesPerFace; ++k) {
+                            *dst++ = vertex_offset + face.mIndices[k];
+                        }
+                    }
+                },
+                {.grainSize = verticesPerTask});
+        } else {
+            for (size_t j = 0; j < m->mNumFaces; ++j) {
+                const aiFace& face = m->mFaces[j];
+                for (size_t k = 0; k < face.mNumIndices; ++k) {
+                    meshIndices.push_back(vertex_offset + face.mIndices[k]);
+                }
             }
         }
-        mesh->addIndices(Mesh::MeshInfo(getDrawType(m->mPrimitiveTypes), ConnectivityType::None),
-                         util::makeIndexBuffer(std::move(indices)));
+    };
+    util::parallelFor(0, numMeshes, convertMesh, {.grainSize = 1});
 
-        vertex_offset += m->mNumVertices;
+    // create Inviwo's data structures for the model
+    auto mesh = std::make_shared<Mesh>();
+
+    for (size_t i = 0; i < numMeshes; ++i) {
+        mesh->addIndices(Mesh::MeshInfo(getDrawType(scene->mMeshes[i]->mPrimitiveTypes),
+                                        ConnectivityType::None),
+                         util::makeIndexBuffer(std::move(indices[i])));
     }
 
     // add the data to the mesh
-    mesh->addBuffer(Mesh::BufferInfo(BufferType::PositionAttrib), pbuff);
+    mesh->addBuffer(Mesh::BufferInfo(BufferType::PositionAttrib),
+                    util::makeBuffer(std::move(positions)));
 
     if (use_normals) {
-        mesh->addBuffer(Mesh::BufferInfo(BufferType::NormalAttrib), nbuff);
+        mesh->addBuffer(Mesh::BufferInfo(BufferType::NormalAttrib),
+                        util::makeBuffer(std::move(normals)));
     }
 
     // use additional unused attribute locations for extra color channels and texture coords
     int auxLocation = static_cast<int>(BufferType::Unknown);
     for (size_t i = 0; i < color_channels; ++i) {
         int location = (i == 0 ? static_cast<int>(BufferType::ColorAttrib) : auxLocation++);
-        mesh->addBuffer(Mesh::BufferInfo(BufferType::ColorAttrib, location), cbuff[i]);
+        mesh->addBuffer(Mesh::BufferInfo(BufferType::ColorAttrib, location),
+                        util::makeBuffer(std::move(colors[i])));
     }
 
     // texture coords
     for (size_t i = 0; i < texture_channels; ++i) {
         int location = (i == 0 ? static_cast<int>(BufferType::TexCoordAttrib) : auxLocation++);
-        mesh->addBuffer(Mesh::BufferInfo(BufferType::TexCoordAttrib, location), tbuff[i]);
+        mesh->addBuffer(Mesh::BufferInfo(BufferType::TexCoordAttrib, location),
+                        util::makeBuffer(std::move(texCoords[i])));
     }
 
     std::clock_t now = std::clock();
@@ -409,6 +479,10 @@ std::shared_ptr<Mesh> AssimpReader::readData(const std::filesystem::path& filePa
         Assimp::DefaultLogger::kill();
     }
 
+    if (cacheKey != 0) {
+        meshCache_->store(*mesh, cacheKey);
+    }
+
     return mesh;
 }
 
@@ -416,6 +490,10 @@ bool AssimpReader::setOption(std::string_view key, std::any value) {
     if (auto* fix = std::any_cast<bool>(&value); fix && key == "FixInvalidData") {
         setFixInvalidDataFlag(*fix);
         return true;
+    } else if (auto* flags = std::any_cast<unsigned int>(&value);
+               flags && key == "PostProcessFlags") {
+        setPostProcessFlags(*flags);
+        return true;
     } else if (auto* level = std::any_cast<LogVerbosity>(&value); level && key == "LogLevel") {
         switch (*level) {
             case LogVerbosity::Error:
@@ -440,6 +518,8 @@ bool AssimpReader::setOption(std::string_view key, std::any value) {
 std::any AssimpReader::getOption(std::string_view key) {
     if (key == "FixInvalidData") {
         return getFixInvalidDataFlag();
+    } else if (key == "PostProcessFlags") {
+        return getPostProcessFlags();
     } else if (key == "LogLevel") {
         switch (getLogLevel()) {
             case AssimpLogLevel::Error:
@@ -35,14 +35,14 @@
 #include <inviwo/core/util/glm.h>                     // for isfinite
 #include <inviwo/core/util/glmcomp.h>                 // for glmcomp
 #include <inviwo/core/util/glmconvert.h>              // for glm_convert
-#include <inviwo/core/util/glmutils.h>                // for is_floating_point, flat_extent
+#include <inviwo/core/util/glmutils.h>                // for is_floating_point, flat_extent_v
 #include <inviwo/core/util/glmvec.h>                  // for dvec4
+#include <inviwo/core/util/parallel.h>                // for parallelReduce
 #include <modules/base/algorithm/algorithmoptions.h>  // for IgnoreSpecialValues, IgnoreSpecialV...
 
-#include <algorithm>    // for max, min
+#include <array>        // for array
 #include <cstddef>      // for size_t
-#include <numeric>      // for accumulate
-#include <type_traits>  // for enable_if
+#include <type_traits>  // for is_floating_point_v
 #include <utility>      // for pair
 
 #include <glm/common.hpp>  // for max, min
@@ -78,48 +78,74 @@ IVW_MODULE_BASE_API std::pair<dvec4, dvec4> bufferMinMax(
 
 namespace detail {
 
-// Specialization for double, float, half
-template <typename ValueType,
-          typename std::enable_if<util::is_floating_point<ValueType>::value, int>::type = 0>
-std::pair<dvec4, dvec4> dataMinMax(const ValueType* data, size_t size,
-                                   IgnoreSpecialValues ignore = IgnoreSpecialValues::No) {
-    using Res = std::pair<ValueType, ValueType>;
-    Res minmax{DataFormat<ValueType>::max(), DataFormat<ValueType>::lowest()};
-
-    if (ignore == IgnoreSpecialValues::Yes) {
-        minmax = std::accumulate(
-            data, data + size, minmax, [](const Res& mm, const ValueType& v) -> Res {
-                Res res(mm);
-                for (size_t i = 0; i < util::flat_extent<ValueType>::value; ++i) {
-                    if (util::isfinite(util::glmcomp(v, i))) {
-                        util::glmcomp(res.first, i) =
-                            std::min(util::glmcomp(mm.first, i), util::glmcomp(v, i));
-                        util::glmcomp(res.second, i) =
-                            std::max(util::glmcomp(mm.second, i), util::glmcomp(v, i));
-                    }
-                }
-                return res;
-            });
+/// Number of values in each task of the parallel min/max computation
+constexpr size_t minMaxGrainSize = size_t{1} << 16;
+
+template <typename P>
+bool minMaxIsFinite(P v) {
+    if constexpr (std::is_floating_point_v<P>) {
+        return v - v == P{0};  // false for both infinities and NaN, and easy to vectorize
     } else {
-        minmax = std::accumulate(data, data + size, minmax,
-                                 [](const Res& mm, const ValueType& v) -> Res {
-                                     return {glm::min(mm.first, v), glm::max(mm.second, v)};
-                                 });
+        return util::isfinite(v);
     }
+}
 
-    return {util::glm_convert<dvec4>(minmax.first), util::glm_convert<dvec4>(minmax.second)};
+/**
+ * Branch free component-wise min and max of [data, data + size). The values are handled as an
+ * array of primitives using several accumulators for each component, the fixed size inner loop
+ * lets the compiler keep the accumulators in SIMD registers. There are no special values to ignore
+ * for integer types.
+ */
+template <typename ValueType, bool ignoreSpecial>
+std::pair<ValueType, ValueType> dataMinMaxRange(const ValueType* data, size_t size) {
+    using P = util::value_type_t<ValueType>;
+    constexpr size_t extent = util::flat_extent_v<ValueType>;
+    constexpr size_t lanes = extent * 16;
+    constexpr bool checkFinite = ignoreSpecial && util::is_floating_point<P>::value;
+
+    std::array<P, lanes> mins;
+    std::array<P, lanes> maxs;
+    mins.fill(DataFormat<P>::max());
+    maxs.fill(DataFormat<P>::lowest());
+
+    const auto update = [&](size_t lane, P v) {
+        const bool valid = !checkFinite || minMaxIsFinite(v);
+        mins[lane] = valid && v < mins[lane] ? v : mins[lane];
+        maxs[lane] = valid && maxs[lane] < v ? v : maxs[lane];
+    };
+
+    // Since lanes is a multiple of extent, lane j always holds component j % extent
+    const auto* values = reinterpret_cast<const P*>(data);
+    const size_t count = size * extent;
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes) {
+        for (size_t j = 0; j < lanes; ++j) update(j, values[i + j]);
+    }
+    for (size_t j = 0; i + j < count; ++j) update(j, values[i + j]);
+
+    std::pair<ValueType, ValueType> minmax{DataFormat<ValueType>::max(),
+                                           DataFormat<ValueType>::lowest()};
+    for (size_t j = 0; j < lanes; ++j) {
+        auto& min = util::glmcomp(minmax.first, j % extent);
+        auto& max = util::glmcomp(minmax.second, j % extent);
+        min = mins[j] < min ? mins[j] : min;
+        max = max < maxs[j] ? maxs[j] : max;
+    }
+    return minmax;
 }
-// Specialization for integer types. They do not have special values
-template <typename ValueType,
-          typename std::enable_if<!util::is_floating_point<ValueType>::value, int>::type = 0>
-std::pair<dvec4, dvec4> dataMinMax(const ValueType* data, size_t size,
-                                   IgnoreSpecialValues = IgnoreSpecialValues::No) {
+
+template <typename ValueType, bool ignoreSpecial>
+std::pair<dvec4, dvec4> dataMinMax(const ValueType* data, size_t size) {
     using Res = std::pair<ValueType, ValueType>;
-    Res minmax{DataFormat<ValueType>::max(), DataFormat<ValueType>::lowest()};
-    minmax =
-        std::accumulate(data, data + size, minmax, [](const Res& mm, const ValueType& v) -> Res {
-            return {glm::min(mm.first, v), glm::max(mm.second, v)};
-        });
+    const auto minmax = util::parallelReduce(
+        0, size, Res{DataFormat<ValueType>::max(), DataFormat<ValueType>::lowest()},
+        [&](size_t first, size_t last) {
+            return dataMinMaxRange<ValueType, ignoreSpecial>(data + first, last - first);
+        },
+        [](const Res& a, const Res& b) -> Res {
+            return {glm::min(a.first, b.first), glm::max(a.second, b.second)};
+        },
+        {.grainSize = minMaxGrainSize});
 
     return {util::glm_convert<dvec4>(minmax.first), util::glm_convert<dvec4>(minmax.second)};
 }
@@ -128,6 +154,7 @@ std::pair<dvec4, dvec4> dataMinMax(const ValueType* data, size_t size,
 
 /**
  * Compute component-wise minimum and maximum values scalar and glm::vec types.
+ * Large arrays are split into chunks that are processed in parallel using the thread pool.
  *
  * @param data pointer to values
  * @param size of data
@@ -137,7 +164,12 @@ std::pair<dvec4, dvec4> dataMinMax(const ValueType* data, size_t size,
 template <typename ValueType>
 std::pair<dvec4, dvec4> dataMinMax(const ValueType* data, size_t size,
                                    IgnoreSpecialValues ignore = IgnoreSpecialValues::No) {
-    return detail::dataMinMax<ValueType>(data, size, ignore);
+    constexpr bool hasSpecialValues = util::is_floating_point<ValueType>::value;
+    if (hasSpecialValues && ignore == IgnoreSpecialValues::Yes) {
+        return detail::dataMinMax<ValueType, true>(data, size);
+    } else {
+        return detail::dataMinMax<ValueType, false>(data, size);
+    }
 }
 
 }  // namespace util
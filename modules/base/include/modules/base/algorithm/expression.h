@@ -0,0 +1,126 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
+
+#include <inviwo/core/util/exception.h>     // for Exception
+#include <inviwo/core/util/glmcomp.h>       // for glmcomp
+#include <inviwo/core/util/shuntingyard.h>  // for Calculator, Program
+
+#include <algorithm>    // for transform, find_if
+#include <cstddef>      // for size_t
+#include <functional>   // for function
+#include <map>          // for map
+#include <span>         // for span
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace inviwo {
+
+namespace util {
+
+/**
+ * A named variable of an expression, referring to one channel of a RAM representation, i.e.
+ * VolumeRAM, LayerRAM, or BufferRAM.
+ */
+template <typename Repr>
+struct ExpressionVariable {
+    std::string name;
+    const Repr* repr;
+    size_t channel;
+};
+
+namespace detail {
+
+template <typename RAMPrecision>
+auto expressionView(const RAMPrecision* ram) {
+    if constexpr (requires { ram->getView(); }) {
+        return ram->getView();
+    } else {
+        return std::span{ram->getDataContainer()};
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Evaluate @p expression for each element of the representations in @p variables and write the
+ * results to @p dst. The expression is compiled into a shuntingyard::Program which is evaluated
+ * in blocks over the thread pool. Only the variables used in the expression are read. All used
+ * representations must have the same number of elements as @p dst.
+ * @throws Exception if the expression is invalid or the sizes do not match
+ */
+template <typename Repr, typename T>
+void evaluateExpression(std::string_view expression,
+                        std::span<const ExpressionVariable<Repr>> variables, std::span<T> dst) {
+    using Loader = std::function<void(size_t, std::span<double>)>;
+
+    std::vector<std::string> names;
+    for (const auto& variable : variables) names.push_back(variable.name);
+    const auto program =
+        shuntingyard::Calculator::compile(std::string{expression}, std::map<std::string, double>{},
+                                          names);
+
+    std::vector<Loader> loaders;
+    for (const auto& name : program.getInputs()) {
+        const auto& variable = *std::ranges::find(variables, name, &ExpressionVariable<Repr>::name);
+        loaders.push_back(variable.repr->template dispatch<Loader>(
+            [&](const auto* ram) -> Loader {
+                const auto view = detail::expressionView(ram);
+                if (view.size() != dst.size()) {
+                    throw Exception(SourceContext{},
+                                    "Size mismatch for '{}', got {} elements expected {}",
+                                    variable.name, view.size(), dst.size());
+                }
+                return [view, channel = variable.channel](size_t offset, std::span<double> values) {
+                    const auto src = view.subspan(offset, values.size());
+                    std::ranges::transform(src, values.begin(), [&](const auto& value) {
+                        return static_cast<double>(util::glmcomp(value, channel));
+                    });
+                };
+            }));
+    }
+
+    program.evaluate(
+        dst.size(),
+        [&](size_t input, size_t offset, std::span<double> values) {
+            loaders[input](offset, values);
+        },
+        [&](size_t offset, std::span<const double> result) {
+            std::ranges::transform(result, dst.begin() + offset,
+                                   [](double value) { return static_cast<T>(value); });
+        });
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -38,10 +38,11 @@
 #include <inviwo/core/util/glmvec.h>                    // for i64vec2, size2_t
 #include <inviwo/core/util/indexmapper.h>               // for IndexMapper
 #include <inviwo/core/util/logcentral.h>                // for LogCentral
+#include <inviwo/core/util/parallel.h>                  // for parallelFor
 #include <inviwo/core/util/stringconversion.h>          // for toString
 
 #include <stdlib.h>   // for size_t, abs
-#include <algorithm>  // for min
+#include <algorithm>  // for min, copy
 #include <cmath>      // for sqrt
 #include <string>     // for operator+, basic_string, string
 #include <vector>     // for vector
@@ -50,12 +51,6 @@
 #include <glm/matrix.hpp>  // for transpose
 #include <glm/vec2.hpp>    // for vec<>::(anonymous), operator*, opera...
 
-#ifdef IVW_USE_OPENMP
-#include <thread>
-
-#include <omp.h>
-#endif
-
 namespace inviwo {
 
 namespace util {
@@ -112,10 +107,6 @@ void util::layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
                                      Predicate predicate, ValueTransform valueTransform,
                                      ProgressCallback callback) {
 
-#ifdef IVW_USE_OPENMP
-    omp_set_num_threads(std::thread::hardware_concurrency());
-#endif
-
     using int64 = glm::int64;
 
     auto square = [](auto a) { return a * a; };
@@ -168,12 +159,13 @@ void util::layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
         return predicate(src[srcInd(x / sm.x, y / sm.y)]);
     };
 
-// first pass, forward and backward scan along x
-// result: min distance in x direction
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 y = 0; y < dstDim.y; ++y) {
+    // The lines scanned in each pass are independent and are processed in parallel using the
+    // thread pool. The x pass is split along y, and the y pass along x.
+
+    // first pass, forward and backward scan along x
+    // result: min distance in x direction
+    util::parallelFor(0, static_cast<size_t>(dstDim.y), [&](size_t yi) {
+        const auto y = static_cast<int64>(yi);
         // forward
         U dist = static_cast<U>(dstDim.x);
         for (int64 x = 0; x < dstDim.x; ++x) {
@@ -195,53 +187,63 @@ void util::layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
             }
             dst[dstInd(x, y)] = std::min<U>(dst[dstInd(x, y)], squareVoxelSize.x * square(dist));
         }
-    }
+    });
 
     // second pass, scan y direction
     // for each voxel v(x,y,z) find min_i(data(x,i,z) + (y - i)^2), 0 <= i < dimY
     // result: min distance in x and y direction
     callback(0.45);
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel
-#endif
-    {
-        std::vector<U> buff;
-        buff.resize(dstDim.y);
-#ifdef IVW_USE_OPENMP
-#pragma omp for
-#endif
-        for (int64 x = 0; x < dstDim.x; ++x) {
+    // The columns are copied in tiles of a few columns at a time such that the strided reads and
+    // writes use whole cache lines.
+    constexpr int64 tileWidth = 16;
+    util::parallelFor(0, static_cast<size_t>(dstDim.x), [&](size_t first, size_t last) {
+        std::vector<U> tile(static_cast<size_t>(tileWidth * dstDim.y));
+        std::vector<U> column(static_cast<size_t>(dstDim.y));
+        for (auto x0 = static_cast<int64>(first); x0 < static_cast<int64>(last); x0 += tileWidth) {
+            const auto width = std::min(tileWidth, static_cast<int64>(last) - x0);
 
             // cache column data into temporary buffer
             for (int64 y = 0; y < dstDim.y; ++y) {
-                buff[y] = dst[dstInd(x, y)];
+                for (int64 i = 0; i < width; ++i) {
+                    tile[i * dstDim.y + y] = dst[dstInd(x0 + i, y)];
+                }
             }
 
-            for (int64 y = 0; y < dstDim.y; ++y) {
-                auto d = buff[y];
-                if (d != U(0)) {
-                    const auto rMax = static_cast<int64>(std::sqrt(d * invSquareVoxelSize.y)) + 1;
-                    const auto rStart = std::min(rMax, y - 1);
-                    const auto rEnd = std::min(rMax, dstDim.y - y);
-                    for (int64 n = -rStart; n < rEnd; ++n) {
-                        const auto w = buff[y + n] + squareVoxelSize.y * square(n);
-                        if (w < d) d = w;
+            for (int64 i = 0; i < width; ++i) {
+                const U* buff = tile.data() + i * dstDim.y;
+                for (int64 y = 0; y < dstDim.y; ++y) {
+                    auto d = buff[y];
+                    if (d != U(0)) {
+                        const auto rMax =
+                            static_cast<int64>(std::sqrt(d * invSquareVoxelSize.y)) + 1;
+                        const auto rStart = std::min(rMax, y - 1);
+                        const auto rEnd = std::min(rMax, dstDim.y - y);
+                        for (int64 n = -rStart; n < rEnd; ++n) {
+                            const auto w = buff[y + n] + squareVoxelSize.y * square(n);
+                            if (w < d) d = w;
+                        }
                     }
+                    column[y] = d;
+                }
+                std::copy(column.begin(), column.end(), tile.begin() + i * dstDim.y);
+            }
+
+            for (int64 y = 0; y < dstDim.y; ++y) {
+                for (int64 i = 0; i < width; ++i) {
+                    dst[dstInd(x0 + i, y)] = tile[i * dstDim.y + y];
                 }
-                dst[dstInd(x, y)] = d;
             }
         }
-    }
+    });
 
     // scale data
     callback(0.9);
-    const int64 layerSize = dstDim.x * dstDim.y;
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 i = 0; i < layerSize; ++i) {
-        dst[i] = valueTransform(dst[i]);
-    }
+    const auto layerSize = static_cast<size_t>(dstDim.x * dstDim.y);
+    util::parallelFor(0, layerSize, [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            dst[i] = valueTransform(dst[i]);
+        }
+    });
     callback(1.0);
 }
 
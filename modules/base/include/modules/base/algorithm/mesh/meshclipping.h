@@ -52,6 +52,16 @@ namespace detail {
 using InterpolateFunctor = std::function<std::uint32_t(
     const std::vector<uint32_t>&, const std::vector<float>&, std::optional<vec3>)>;
 
+/**
+ * A new vertex on the edge between the vertices @p lo and @p hi, lo < hi, at lo * (1 - weight) +
+ * hi * weight.
+ */
+struct EdgeVertex {
+    std::uint32_t lo;
+    std::uint32_t hi;
+    float weight;
+};
+
 /**
  * Compute barycentric coordinates/weights for
  * point p (which is inside the polygon) with respect to polygons of vertices (v)
@@ -71,6 +81,25 @@ IVW_MODULE_BASE_API std::optional<glm::u32vec2> sutherlandHodgman(
     glm::u32vec3 triangle, const Plane& plane, const std::vector<vec3>& positions,
     std::vector<std::uint32_t>& indices, const InterpolateFunctor& addInterpolatedVertex);
 
+/**
+ * Clip the triangles of @p indices using the signed plane @p distances of each vertex, in
+ * parallel. Triangles that are completely inside are kept as they are. New vertices are welded,
+ * i.e. every cut edge results in a single new vertex that is shared by all triangles using that
+ * edge. The new vertices are appended to @p newVertices and get the indices firstNewVertex +
+ * position in newVertices.
+ * @param meshInfo the draw type must be triangles with connectivity None or Strip
+ * @param indices of the triangles to clip
+ * @param distances signed distance to the plane of each vertex, inside if >= 0
+ * @param firstNewVertex index of the first new vertex, i.e. the current number of vertices
+ * @param outIndices the clipped triangles are appended as a triangle list
+ * @param newVertices the new vertices on cut edges are appended
+ * @returns the new edges on the plane, to use for capping the hole
+ */
+IVW_MODULE_BASE_API std::vector<glm::u32vec2> clipTriangles(
+    const Mesh::MeshInfo& meshInfo, const std::vector<std::uint32_t>& indices,
+    const std::vector<float>& distances, std::uint32_t firstNewVertex,
+    std::vector<std::uint32_t>& outIndices, std::vector<EdgeVertex>& newVertices);
+
 IVW_MODULE_BASE_API void removeDuplicateEdges(std::vector<glm::u32vec2>& cuts,
                                               const std::vector<vec3>& positions, float eps);
 
@@ -81,6 +110,8 @@ IVW_MODULE_BASE_API std::vector<std::vector<std::uint32_t>> gatherLoops(
 
 /**
  * Clip mesh against plane using Sutherland-Hodgman.
+ * Triangles, with connectivity None or Strip, are clipped in parallel and new vertices are welded
+ * such that each cut edge only results in one new vertex.
  * If holes should be closed, the input mesh must be manifold.
  * Vertex attributes are interpolated. Floating types use linear interpolation, integer types use
  * nearest. Connectivity types loop and fan are not handled.
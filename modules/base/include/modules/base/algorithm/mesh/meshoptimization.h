@@ -0,0 +1,80 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <memory>   // for unique_ptr
+#include <span>     // for span
+#include <vector>   // for vector
+
+namespace inviwo {
+
+class Mesh;
+
+namespace meshutil {
+
+/**
+ * Reorder the triangles of an indexed triangle list to improve the hit rate of the GPU
+ * post-transform vertex cache, using the linear-speed algorithm by Tom Forsyth. The result holds
+ * the same triangles with the same winding, only their order is changed.
+ *
+ * @param indices triangle list with three indices per triangle, a trailing partial triangle is
+ *        dropped
+ * @param vertexCount number of vertices, all indices have to be smaller than this
+ * @param cacheSize size of the emulated LRU cache
+ * @throws Exception if an index is out of range
+ */
+IVW_MODULE_BASE_API std::vector<std::uint32_t> optimizeVertexCache(
+    std::span<const std::uint32_t> indices, size_t vertexCount, size_t cacheSize = 32);
+
+/**
+ * The average number of cache misses per triangle (ACMR) when drawing the triangle list
+ * with a FIFO post-transform vertex cache of the given size. Ranges from 0.5 for an ideal mesh
+ * to 3 when no vertex is reused.
+ */
+IVW_MODULE_BASE_API double averageCacheMissRatio(std::span<const std::uint32_t> indices,
+                                                 size_t cacheSize = 16);
+
+/**
+ * Create a copy of the mesh that renders faster. The triangle lists are reordered using
+ * optimizeVertexCache, then the vertices in all buffers are reordered in the order they are first
+ * used by the index buffers to improve the vertex fetch locality. Vertices not used by any index
+ * buffer are kept, in their original order, after the used ones. Meshes without index buffers are
+ * returned unchanged.
+ * @throws Exception if the vertex buffers have different sizes
+ */
+IVW_MODULE_BASE_API std::unique_ptr<Mesh> optimizeVertexOrder(const Mesh& mesh);
+
+}  // namespace meshutil
+
+}  // namespace inviwo
@@ -42,10 +42,14 @@
 
 #include <inviwo/core/util/zip.h>
 #include <inviwo/core/util/imagesampler.h>
+#include <inviwo/core/util/parallel.h>
 
 #include <random>
 #include <numbers>
 #include <bit>
+#include <array>
+#include <cstdint>
+#include <span>
 
 namespace inviwo {
 
@@ -196,6 +200,118 @@ void randomSequence(std::span<T> data, Rand& randomNumberGenerator = Rand(),
     std::generate(data.begin(), data.end(), [&]() { return distribution(randomNumberGenerator); });
 }
 
+/**
+ * Counter based random number generator Philox4x32-10, see Salmon et al. "Parallel Random
+ * Numbers: As Easy as 1, 2, 3" (SC 2011). Instead of advancing an internal state, each call maps
+ * a 128 bit counter to four 32 bit random numbers using a key derived from the seed. Hence any
+ * element of the sequence can be computed directly, which makes it possible to fill data in
+ * parallel and get the same result independent of the number of threads.
+ * The generator is stateless and can be shared between threads.
+ */
+class Philox4x32 {
+public:
+    using Block = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+    static constexpr int rounds = 10;
+
+    constexpr explicit Philox4x32(std::uint64_t seed = 0)
+        : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)} {}
+    constexpr explicit Philox4x32(Key key) : key_{key} {}
+
+    /**
+     * Returns the four random numbers for @p counter.
+     */
+    constexpr Block operator()(Block counter) const {
+        auto key = key_;
+        for (int i = 0; i < rounds; ++i) {
+            counter = round(counter, key);
+            key[0] += 0x9E3779B9u;
+            key[1] += 0xBB67AE85u;
+        }
+        return counter;
+    }
+
+    /**
+     * Returns the four random numbers at position @p index of the sequence @p stream. Use
+     * different streams to get independent sequences from the same seed.
+     */
+    constexpr Block operator()(std::uint64_t index, std::uint64_t stream = 0) const {
+        return (*this)(Block{static_cast<std::uint32_t>(index),
+                             static_cast<std::uint32_t>(index >> 32),
+                             static_cast<std::uint32_t>(stream),
+                             static_cast<std::uint32_t>(stream >> 32)});
+    }
+
+private:
+    static constexpr Block round(const Block& c, const Key& k) {
+        const std::uint64_t p0 = std::uint64_t{0xD2511F53u} * c[0];
+        const std::uint64_t p1 = std::uint64_t{0xCD9E8D57u} * c[2];
+        return {static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k[0],
+                static_cast<std::uint32_t>(p1), static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k[1],
+                static_cast<std::uint32_t>(p0)};
+    }
+
+    Key key_;
+};
+
+namespace detail {
+
+/// The number of 32 bit random numbers used for each value of type T
+template <typename T>
+constexpr size_t randomWords() {
+    return std::is_same_v<T, float> ? 1 : 2;
+}
+
+/**
+ * Map the random numbers starting at @p offset of @p block to a value in [min, max) for
+ * floating point types and [min, max] for integral types. Integral values use 64 random bits,
+ * the modulo bias is hence at most 2^-32 for 32 bit types.
+ */
+template <typename T>
+constexpr T fromRandomWords(const Philox4x32::Block& block, size_t offset, T min, T max) {
+    if constexpr (std::is_same_v<T, float>) {
+        const float t = static_cast<float>(block[offset] >> 8) * 0x1.0p-24f;
+        return min + t * (max - min);
+    } else {
+        const std::uint64_t bits =
+            (std::uint64_t{block[offset]} << 32) | std::uint64_t{block[offset + 1]};
+        if constexpr (std::is_floating_point_v<T>) {
+            const T t = static_cast<T>(bits >> 11) * static_cast<T>(0x1.0p-53);
+            return min + t * (max - min);
+        } else {
+            const auto span = static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min) + 1;
+            return static_cast<T>(static_cast<std::uint64_t>(min) +
+                                  (span == 0 ? bits : bits % span));
+        }
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Fills a span of type T with random numbers in the range [\p min, \p max] using the counter
+ * based generator \p rng, in parallel using the Inviwo thread pool. Element i only depends on
+ * the seed, \p stream, and i, making the result reproducible independent of the number of threads.
+ */
+template <typename T>
+void randomSequence(std::span<T> data, const Philox4x32& rng, T min, T max,
+                    std::uint64_t stream = 0) {
+    static_assert(std::is_arithmetic_v<T>, "T must be an arithmetic type");
+    constexpr size_t words = detail::randomWords<T>();
+    constexpr size_t perBlock = 4 / words;
+    util::parallelFor(
+        0, data.size(),
+        [&](size_t first, size_t last) {
+            for (size_t i = first; i < last;) {
+                const auto block = rng(i / perBlock, stream);
+                for (size_t j = i % perBlock; j < perBlock && i < last; ++j, ++i) {
+                    data[i] = detail::fromRandomWords<T>(block, j * words, min, max);
+                }
+            }
+        },
+        {.grainSize = 16384});
+}
+
 /**
  * Generate a LayerRAMPrecision<T> with white noise based using a given random number
  * generator and distribution.
@@ -246,6 +362,25 @@ std::shared_ptr<Layer> randomLayer(size2_t dims, Rand& randomNumberGenerator = R
     return layer;
 }
 
+/**
+ * Generate a Layer with white noise in the range [\p min, \p max] using the counter based
+ * generator \p rng, using \p stream to select the sequence. The layer is filled in parallel, with
+ * the same result for any number of threads.
+ */
+template <typename T>
+std::shared_ptr<Layer> randomLayer(size2_t dims, const Philox4x32& rng, T min, T max,
+                                   std::uint64_t stream = 0) {
+    auto layerRam = std::make_shared<LayerRAMPrecision<T>>(LayerReprConfig{
+        .dimensions = dims,
+        .swizzleMask = swizzlemasks::defaultData(1),
+    });
+    randomSequence(layerRam->getView(), rng, min, max, stream);
+
+    auto layer = std::make_shared<Layer>(layerRam);
+    layer->dataMap.dataRange = dvec2{min, max};
+    return layer;
+}
+
 /**
  * Generate an Volume with white noise based using C++ a given random number generator and
  * distribution.
@@ -272,19 +407,34 @@ std::shared_ptr<Volume> randomVolume(size3_t dims, Rand& randomNumberGenerator =
 }
 
 /**
- * Generate a Layer with perlin noise, a cloud like noise using the sum of several white noise
- * layers with different frequencies
- * @param dims Size of the output layer
- * @param persistence controls the amplitude used in the different frequencies
- * @param startLevel controls the min level used. The level is determining the frequency to use
- * in each white noise layer as 2^level
- * @param endLevel controlsthe max level used.
- * @param randomNumberGenerator the Random number generator to use, defaults to the Mersenne Twister
- * engine (std::mt19937)
+ * Generate a Volume with white noise in the range [\p min, \p max] using the counter based
+ * generator \p rng. The volume is filled in parallel, with the same result for any number of
+ * threads.
  */
-template <typename Rand = std::mt19937>
+template <typename T>
+std::shared_ptr<Volume> randomVolume(size3_t dims, const Philox4x32& rng, T min, T max) {
+    auto volumeRam = std::make_shared<VolumeRAMPrecision<T>>(VolumeReprConfig{
+        .dimensions = dims,
+        .swizzleMask = swizzlemasks::defaultData(1),
+    });
+
+    randomSequence(volumeRam->getView(), rng, min, max);
+
+    auto volume = std::make_shared<Volume>(volumeRam);
+    volume->dataMap.dataRange = dvec2{min, max};
+    volume->dataMap.valueRange = volume->dataMap.dataRange;
+    return volume;
+}
+
+namespace detail {
+
+/**
+ * Sum up the white noise levels given by @p randomLevel(layerSize, amplitude, level), in
+ * parallel over the rows of the output.
+ */
+template <typename RandomLevel>
 std::shared_ptr<Layer> perlinNoise(size2_t dims, float persistence, size_t startLevel,
-                                   size_t endLevel, Rand& randomNumberGenerator = Rand()) {
+                                   size_t endLevel, RandomLevel randomLevel) {
     const auto size = std::bit_ceil(std::max(dims.x, dims.y));
     std::vector<std::shared_ptr<Layer>> levels;
     std::vector<TemplateImageSampler<float, float>> samplers;
@@ -293,8 +443,7 @@ std::shared_ptr<Layer> perlinNoise(size2_t dims, float persistence, size_t start
     float currentPersistance = 1;
     while (currentSize <= size && iterations--) {
         size2_t layerSize{static_cast<size_t>(currentSize)};
-        auto dist = std::uniform_real_distribution<float>(-currentPersistance, currentPersistance);
-        auto randomLayer = util::randomLayer<float>(layerSize, randomNumberGenerator, dist);
+        auto randomLayer = randomLevel(layerSize, currentPersistance, levels.size());
         samplers.push_back(TemplateImageSampler<float, float>(randomLayer.get()));
         levels.push_back(randomLayer);
         currentSize *= 2;
@@ -309,7 +458,7 @@ std::shared_ptr<Layer> perlinNoise(size2_t dims, float persistence, size_t start
     auto data = layerRam->getView();
     float repri = 1.0f / size;
     util::IndexMapper2D index(dims);
-    for (size_t y = 0; y < dims.y; y++) {
+    util::parallelFor(0, dims.y, [&](size_t y) {
         for (size_t x = 0; x < dims.x; x++) {
             float v = 0;
             float X = x * repri;
@@ -320,10 +469,50 @@ std::shared_ptr<Layer> perlinNoise(size2_t dims, float persistence, size_t start
             v = (v + 1.0f) / 2.0f;
             data[index(x, dims.y - 1 - y)] = glm::clamp(v, 0.0f, 1.0f);
         }
-    }
+    });
     return std::make_shared<Layer>(layerRam);
 }
 
+}  // namespace detail
+
+/**
+ * Generate a Layer with perlin noise, a cloud like noise using the sum of several white noise
+ * layers with different frequencies
+ * @param dims Size of the output layer
+ * @param persistence controls the amplitude used in the different frequencies
+ * @param startLevel controls the min level used. The level is determining the frequency to use
+ * in each white noise layer as 2^level
+ * @param endLevel controlsthe max level used.
+ * @param randomNumberGenerator the Random number generator to use, defaults to the Mersenne Twister
+ * engine (std::mt19937)
+ */
+template <typename Rand = std::mt19937>
+    requires(!std::is_same_v<std::remove_cv_t<Rand>, Philox4x32>)
+std::shared_ptr<Layer> perlinNoise(size2_t dims, float persistence, size_t startLevel,
+                                   size_t endLevel, Rand& randomNumberGenerator = Rand()) {
+    return detail::perlinNoise(
+        dims, persistence, startLevel, endLevel,
+        [&](size2_t layerSize, float amplitude, size_t) {
+            auto dist = std::uniform_real_distribution<float>(-amplitude, amplitude);
+            return util::randomLayer<float>(layerSize, randomNumberGenerator, dist);
+        });
+}
+
+/**
+ * Generate a Layer with perlin noise using the counter based generator \p rng, with one stream
+ * for each white noise level. Both the white noise and the sum are computed in parallel, with the
+ * same result for any number of threads.
+ * @see perlinNoise(size2_t, float, size_t, size_t, Rand&)
+ */
+inline std::shared_ptr<Layer> perlinNoise(size2_t dims, float persistence, size_t startLevel,
+                                          size_t endLevel, const Philox4x32& rng) {
+    return detail::perlinNoise(dims, persistence, startLevel, endLevel,
+                               [&](size2_t layerSize, float amplitude, size_t level) {
+                                   return util::randomLayer<float>(layerSize, rng, -amplitude,
+                                                                   amplitude, level);
+                               });
+}
+
 /**
  * Generate a Layer with sparse noise based on the perlin noise algorith.
  * @see http://devmag.org.za/2009/05/03/poisson-disk-sampling/
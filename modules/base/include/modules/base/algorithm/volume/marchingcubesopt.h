@@ -31,7 +31,7 @@
 
 #include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
 
-#include <inviwo/core/util/glmvec.h>  // for size3_t, vec4
+#include <inviwo/core/util/glmvec.h>  // for size3_t, vec4, dvec2
 
 #include <array>          // for array
 #include <bitset>         // for bitset
@@ -44,6 +44,41 @@
 namespace inviwo {
 class Mesh;
 class Volume;
+class VolumeRAM;
+
+namespace marching {
+/**
+ * \brief The value range of blocks of cells in a volume.
+ *
+ * Used by util::marchingCubesOpt to skip the blocks that can not intersect the iso surface.
+ * Computing the ranges needs a pass over the whole volume, but the result does not depend on the
+ * iso-value and can be reused as long as the volume does not change.
+ */
+class IVW_MODULE_BASE_API BlockRanges {
+public:
+    /// Number of cells along each side of a block
+    static constexpr size_t blockSize = 8;
+
+    explicit BlockRanges(const VolumeRAM& volume);
+
+    /// The dimensions of the volume the ranges were computed for
+    size3_t getDimensions() const { return dimensions_; }
+    /// The number of blocks along each axis
+    size3_t getBlocks() const { return blocks_; }
+
+    /// Check if the value range of the voxels of @p block contains @p iso
+    bool contains(const size3_t& block, double iso) const {
+        const auto& range = ranges_[(block.z * blocks_.y + block.y) * blocks_.x + block.x];
+        return range.x <= iso && iso <= range.y;
+    }
+
+private:
+    size3_t dimensions_;
+    size3_t blocks_;
+    std::vector<dvec2> ranges_;
+};
+
+}  // namespace marching
 
 namespace util {
 
@@ -51,7 +86,9 @@ namespace util {
  * Extracts an iso surface from a volume using the Marching Cubes algorithm
  *
  * Note: Shares interface with util::marchingcbes and util::marchingtetrahedron
- * This is an optimized version of util::marchingcubes
+ * This is an optimized version of util::marchingcubes. The volume is split into slabs along z
+ * that are extracted in parallel using the thread pool, the vertices on the planes shared by two
+ * slabs are welded such that the surface stays connected across the slab boundaries.
  *
  * @param volume the scalar volume
  * @param iso iso-value for the extracted surface
@@ -60,15 +97,19 @@ namespace util {
  * iso-value is 'outside' of the surface)
  * @param enclose whether to create surface where the iso surface intersects the volume boundaries
  * @param progressCallback if set, will be called will executing with the current progress in the
- * interval [0,1], useful for progress bars
+ * interval [0,1], useful for progress bars. Might be called from any thread, but never
+ * concurrently.
  * @param maskingCallback optional callback to test whether current cell should be evaluated or not
- * (return true to include current cell)
+ * (return true to include current cell). Will be called concurrently from several threads.
+ * @param blockRanges optional value ranges of @p volume, if given the blocks that do not contain
+ * the iso-value are skipped.
  */
 
 IVW_MODULE_BASE_API std::shared_ptr<Mesh> marchingCubesOpt(
     std::shared_ptr<const Volume> volume, double iso, const vec4& color, bool invert, bool enclose,
     std::function<void(float)> progressCallback = nullptr,
-    std::function<bool(const size3_t&)> maskingCallback = nullptr);
+    std::function<bool(const size3_t&)> maskingCallback = nullptr,
+    const marching::BlockRanges* blockRanges = nullptr);
 }  // namespace util
 
 namespace marching {
@@ -38,6 +38,7 @@
 #include <inviwo/core/util/glmvec.h>             // for i64vec3, size3_t
 #include <inviwo/core/util/indexmapper.h>        // for IndexMapper
 #include <inviwo/core/util/logcentral.h>         // for LogCentral
+#include <inviwo/core/util/parallel.h>           // for parallelFor
 #include <inviwo/core/util/stringconversion.h>   // for toString
 
 #include <cstdlib>    // for size_t, abs
@@ -50,12 +51,6 @@
 #include <glm/matrix.hpp>  // for transpose
 #include <glm/vec3.hpp>    // for vec<>::(anonymous), operator*, ope...
 
-#ifdef IVW_USE_OPENMP
-#include <thread>
-
-#include <omp.h>
-#endif
-
 namespace inviwo {
 class VolumeRAM;
 template <typename T>
@@ -116,10 +111,6 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
                                       Predicate predicate, ValueTransform valueTransform,
                                       ProgressCallback progress) {
 
-#ifdef IVW_USE_OPENMP
-    omp_set_num_threads(static_cast<int>(std::thread::hardware_concurrency()));
-#endif
-
     using int64 = glm::int64;
 
     auto square = [](auto a) { return a * a; };
@@ -172,12 +163,13 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
         return predicate(src[srcInd(x / sm.x, y / sm.y, z / sm.z)]);
     };
 
-// first pass, forward and backward scan along x
-// result: min distance in x direction
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 z = 0; z < dstDim.z; ++z) {
+    // The lines scanned in each pass are independent and are processed in parallel using the
+    // thread pool. The x and y passes are split along z, and the z pass along y.
+
+    // first pass, forward and backward scan along x
+    // result: min distance in x direction
+    util::parallelFor(0, static_cast<size_t>(dstDim.z), [&](size_t zi) {
+        const auto z = static_cast<int64>(zi);
         for (int64 y = 0; y < dstDim.y; ++y) {
             // forward
             U dist = static_cast<U>(dstDim.x);
@@ -202,22 +194,16 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
                     std::min<U>(dst[dstInd(x, y, z)], squareVoxelSize.x * square(dist));
             }
         }
-    }
+    });
 
     // second pass, scan y direction
     // for each voxel v(x,y,z) find min_i(data(x,i,z) + (y - i)^2), 0 <= i < dimY
     // result: min distance in x and y direction
     progress(0.3);
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel
-#endif
-    {
+    util::parallelFor(0, static_cast<size_t>(dstDim.z), [&](size_t first, size_t last) {
         std::vector<U> buff;
         buff.resize(dstDim.y);
-#ifdef IVW_USE_OPENMP
-#pragma omp for
-#endif
-        for (int64 z = 0; z < dstDim.z; ++z) {
+        for (auto z = static_cast<int64>(first); z < static_cast<int64>(last); ++z) {
             for (int64 x = 0; x < dstDim.x; ++x) {
 
                 // cache column data into temporary buffer
@@ -241,22 +227,16 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
                 }
             }
         }
-    }
+    });
 
     // third pass, scan z direction
     // for each voxel v(x,y,z) find min_i(data(x,y,i) + (z - i)^2), 0 <= i < dimZ
     // result: min distance in x and y direction
     progress(0.6);
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel
-#endif
-    {
+    util::parallelFor(0, static_cast<size_t>(dstDim.y), [&](size_t first, size_t last) {
         std::vector<U> buff;
         buff.resize(dstDim.z);
-#ifdef IVW_USE_OPENMP
-#pragma omp for
-#endif
-        for (int64 y = 0; y < dstDim.y; ++y) {
+        for (auto y = static_cast<int64>(first); y < static_cast<int64>(last); ++y) {
             for (int64 x = 0; x < dstDim.x; ++x) {
 
                 // cache column data into temporary buffer
@@ -280,17 +260,16 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
                 }
             }
         }
-    }
+    });
 
     // scale data
     progress(0.9);
-    const int64 volSize = dstDim.x * dstDim.y * dstDim.z;
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 i = 0; i < volSize; ++i) {
-        dst[i] = valueTransform(dst[i]);
-    }
+    const auto volSize = static_cast<size_t>(dstDim.x * dstDim.y * dstDim.z);
+    util::parallelFor(0, volSize, [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            dst[i] = valueTransform(dst[i]);
+        }
+    });
     progress(1.0);
 }
 // NOLINTEND(readability-function-cognitive-complexity)
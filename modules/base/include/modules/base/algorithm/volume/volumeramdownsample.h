@@ -32,7 +32,9 @@
 #include <modules/base/basemoduledefine.h>
 #include <inviwo/core/util/glmvec.h>
 
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace inviwo {
 
@@ -52,6 +54,21 @@ IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeStridedDownsample(const Vol
 IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeAveragedDownsample(const VolumeRAM* in,
                                                                         size3_t strides);
 
+/**
+ * Create a mipmap pyramid of @p volume. Each level halves the dimensions of the previous one,
+ * rounding up, until a single voxel remains or @p maxLevels levels have been created. Voxels
+ * outside of an odd sized level are clamped to the border, i.e. the same layout as the levels of
+ * a VolumeBricked. The input volume is not part of the result, element 0 is the first
+ * downsampled level.
+ *
+ * All levels are created in tiled passes where each tile of the source is reduced through
+ * several levels while it is still in cache. The tiles are processed in parallel on the thread
+ * pool.
+ */
+IVW_MODULE_BASE_API std::vector<std::shared_ptr<VolumeRAM>> volumePyramid(
+    const VolumeRAM* in, DownsamplingMode mode = DownsamplingMode::Averaged,
+    size_t maxLevels = std::numeric_limits<size_t>::max());
+
 }  // namespace util
 
 }  // namespace inviwo
@@ -0,0 +1,94 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/util/glmmat.h>       // for mat4
+#include <inviwo/core/util/glmvec.h>       // for size3_t, vec3
+#include <inviwo/core/util/indexmapper.h>  // for IndexMapper3D
+
+#include <algorithm>  // for min
+#include <cstddef>    // for size_t
+
+#include <glm/geometric.hpp>  // for length
+
+namespace inviwo::util {
+
+/**
+ * The rows of a 7-point stencil centered on one row of a volume. Rows outside of the volume are
+ * clamped to the border.
+ */
+template <typename T>
+struct StencilRow {
+    size_t offset;  //!< Linear index of the first voxel of the center row
+    const T* center;
+    const T* ym;
+    const T* yp;
+    const T* zm;
+    const T* zp;
+};
+
+/**
+ * Evaluate a 7-point stencil for all voxels in the slices [zFirst, zLast) of a volume with
+ * dimensions @p dims. The kernel is called as `kernel(row, x, xm, xp)` where `xm` and `xp` are
+ * the indices of the x neighbors of `x` in the row, clamped to the border. The first and last
+ * voxel of every row are peeled out of the loop so the interior loop only uses contiguous
+ * offsets and can be vectorized.
+ */
+template <typename T, typename Kernel>
+void forEachStencil(const T* data, size3_t dims, size_t zFirst, size_t zLast, Kernel&& kernel) {
+    const util::IndexMapper3D im{dims};
+    const auto last = dims - size3_t{1};
+    for (size_t z = zFirst; z < zLast; ++z) {
+        const size_t zm = z > 0 ? z - 1 : 0;
+        const size_t zp = std::min(z + 1, last.z);
+        for (size_t y = 0; y < dims.y; ++y) {
+            const size_t ym = y > 0 ? y - 1 : 0;
+            const size_t yp = std::min(y + 1, last.y);
+            const StencilRow<T> row{im(0, y, z),        data + im(0, y, z),  data + im(0, ym, z),
+                                    data + im(0, yp, z), data + im(0, y, zm), data + im(0, y, zp)};
+
+            kernel(row, size_t{0}, size_t{0}, std::min(size_t{1}, last.x));
+            for (size_t x = 1; x < last.x; ++x) {
+                kernel(row, x, x - 1, x + 1);
+            }
+            if (last.x > 0) kernel(row, last.x, last.x - 1, last.x);
+        }
+    }
+}
+
+/**
+ * World space distance between neighboring voxels along each voxel axis
+ */
+inline vec3 voxelSpacing(const mat4& indexToWorld) {
+    return vec3{glm::length(vec3{indexToWorld[0]}), glm::length(vec3{indexToWorld[1]}),
+                glm::length(vec3{indexToWorld[2]})};
+}
+
+}  // namespace inviwo::util
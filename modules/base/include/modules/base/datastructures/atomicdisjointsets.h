@@ -0,0 +1,115 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/util/assertion.h>  // for IVW_ASSERT
+
+#include <atomic>       // for atomic_ref, memory_order_relaxed
+#include <cstdint>      // for uint32_t
+#include <span>         // for span
+#include <type_traits>  // for is_unsigned
+#include <utility>      // for swap
+
+namespace inviwo {
+
+/**
+ * Lock-free disjoint sets on top of an external array of parent indices, that can be used
+ * concurrently from multiple threads. An element is a root if it is its own parent. Unions always
+ * link the root with the larger index to the root with the smaller index using a compare and swap,
+ * and find uses path halving. Hence the root of a set is always its smallest element.
+ *
+ * Since the sets are only ever merged, relaxed atomic operations are sufficient. The caller has to
+ * synchronize, e.g. by waiting for all tasks, before relying on the final state.
+ * @see DisjointSets for the single threaded version with weighted unions.
+ */
+template <typename T = std::uint32_t>
+class AtomicDisjointSets {
+public:
+    static_assert(std::is_unsigned_v<T>, "T must be an unsigned type");
+
+    /**
+     * Use @p parents as storage, elements have to be initialized using makeSet before use.
+     */
+    explicit AtomicDisjointSets(std::span<T> parents) : parents_{parents} {}
+
+    /**
+     * Make @p x a set with one member. Must not be called concurrently with operations on @p x.
+     */
+    void makeSet(T x) { parents_[x] = x; }
+
+    /**
+     * Returns the root of the set of element @p x.
+     */
+    T find(T x) const {
+        IVW_ASSERT(x < parents_.size(), "x should be less than size");
+        T parent = load(x);
+        while (parent != x) {
+            const T grandParent = load(parent);
+            if (grandParent != parent) {
+                // path halving, failure only means that some other thread already updated it
+                std::atomic_ref<T>{parents_[x]}.compare_exchange_weak(parent, grandParent,
+                                                                      std::memory_order_relaxed);
+            }
+            x = grandParent;
+            parent = load(x);
+        }
+        return x;
+    }
+
+    /**
+     * Join the sets of element @p r and @p s. Returns true if the sets were joined or false if
+     * they already were in the same set.
+     */
+    bool join(T r, T s) {
+        while (true) {
+            r = find(r);
+            s = find(s);
+            if (r == s) return false;
+            if (r < s) std::swap(r, s);
+            // link r to s if r still is a root, otherwise some other thread changed the sets
+            T expected = r;
+            if (std::atomic_ref<T>{parents_[r]}.compare_exchange_strong(
+                    expected, s, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    bool isRoot(T x) const { return load(x) == x; }
+
+    size_t size() const { return parents_.size(); }
+
+private:
+    T load(T x) const { return std::atomic_ref<T>{parents_[x]}.load(std::memory_order_relaxed); }
+
+    std::span<T> parents_;
+};
+
+}  // namespace inviwo
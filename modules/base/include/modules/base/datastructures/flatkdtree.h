@@ -0,0 +1,375 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/util/assertion.h>  // for IVW_ASSERT
+#include <inviwo/core/util/glmvec.h>     // for vec
+#include <inviwo/core/util/parallel.h>   // for parallelFor
+
+#include <algorithm>    // for nth_element, sort, min, max
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t, uint8_t
+#include <limits>       // for numeric_limits
+#include <numeric>      // for iota
+#include <span>         // for span
+#include <type_traits>  // for is_floating_point_v
+#include <utility>      // for pair
+#include <vector>       // for vector
+
+#include <glm/common.hpp>    // for min, max
+#include <glm/gtc/vec1.hpp>  // for vec
+
+namespace inviwo {
+
+/**
+ * A balanced kd-tree that is built once from a set of points and then only queried. In contrast
+ * to KDTree there are no nodes allocated, the tree is implicit in a set of flat arrays: The points
+ * are permuted such that each node covers a contiguous range, the range is split at its median
+ * along the axis of largest extent, and all leaves are on the same level holding at most
+ * bucketSize points. The split planes are stored in heap order, with the children of node i at
+ * 2i+1 and 2i+2. The points are stored one array per component, such that the distances of a
+ * whole leaf bucket are computed in a tight loop the compiler can vectorize.
+ *
+ * The levels of the tree are built in parallel using the Inviwo thread pool, and there are
+ * batched versions of all queries that evaluate the queries in parallel and write the results
+ * into caller provided buffers. Points are referred to using their index in the input, ties in
+ * the distance are always resolved to the point with the smallest index, making all results
+ * independent of the layout of the tree.
+ *
+ * ```{.cpp}
+ * const FlatKDTree<3> tree{points};
+ * std::vector<FlatKDTree<3>::Index> closest(queries.size());
+ * tree.nearest(queries, closest);
+ * ```
+ * @see KDTree for a tree that supports incremental insertion and removal
+ */
+template <size_t N, typename P = float>
+class FlatKDTree {
+public:
+    static_assert(N > 0 && N <= 4, "N must be in [1,4]");
+    static_assert(std::is_floating_point_v<P>, "P must be a floating point type");
+
+    using Point = glm::vec<N, P, glm::defaultp>;
+    using Index = std::uint32_t;
+    /// Used for missing results in kNearest
+    static constexpr Index invalid = std::numeric_limits<Index>::max();
+    /// The maximum number of points in each leaf
+    static constexpr size_t bucketSize = 16;
+
+    FlatKDTree() = default;
+    explicit FlatKDTree(std::span<const Point> points);
+
+    size_t size() const { return indices_.size(); }
+    bool empty() const { return indices_.empty(); }
+
+    /**
+     * Returns the index of the closest point to @p pos, or invalid if the tree is empty.
+     */
+    Index nearest(const Point& pos) const;
+
+    /**
+     * Find the indices.size() closest points to @p pos, sorted by increasing distance.
+     * @param pos the query position
+     * @param indices output, the indices of the closest points
+     * @param dist2 output, the squared distances of the closest points, has to be of the same
+     *        size as @p indices
+     * @return the number of points found, i.e. min(indices.size(), size()). The remaining
+     *         entries are set to invalid and the maximum distance.
+     */
+    size_t kNearest(const Point& pos, std::span<Index> indices, std::span<P> dist2) const;
+
+    /**
+     * Append the indices of all points within @p radius of @p pos to @p result, in increasing
+     * order.
+     */
+    void withinRadius(const Point& pos, P radius, std::vector<Index>& result) const;
+
+    /**
+     * Batched version of nearest. Evaluates the queries in parallel.
+     * @param queries the query positions
+     * @param result output for the index of the closest point to each query, has to be of the
+     *        same size as @p queries
+     */
+    void nearest(std::span<const Point> queries, std::span<Index> result) const;
+
+    /**
+     * Batched version of kNearest. Evaluates the queries in parallel. The results of query i are
+     * written to the entries [i * k, (i + 1) * k) of @p indices and @p dist2, which both have
+     * to be of size queries.size() * k.
+     */
+    void kNearest(std::span<const Point> queries, size_t k, std::span<Index> indices,
+                  std::span<P> dist2) const;
+
+    /**
+     * Batched version of withinRadius. Evaluates the queries in parallel. The result is given in
+     * compressed form, the indices of the points within @p radius of query i are found in the
+     * entries [offsets[i], offsets[i + 1]) of @p indices. Both vectors are resized as needed.
+     */
+    void withinRadius(std::span<const Point> queries, P radius, std::vector<size_t>& offsets,
+                      std::vector<Index>& indices) const;
+
+private:
+    void split(size_t node, size_t begin, size_t end, std::span<const Point> points,
+               std::vector<Index>& perm);
+
+    template <typename Visit>
+    void scanLeaf(size_t begin, size_t end, const Point& pos, Visit& visit) const;
+
+    template <typename Visit, typename Bound>
+    void traverse(size_t node, size_t level, size_t begin, size_t end, const Point& pos,
+                  Visit& visit, const Bound& bound) const;
+
+    template <typename Visit, typename Bound>
+    void traverse(const Point& pos, Visit& visit, const Bound& bound) const {
+        traverse(0, 0, 0, indices_.size(), pos, visit, bound);
+    }
+
+    size_t depth_ = 0;
+    std::vector<P> splits_;
+    std::vector<std::uint8_t> axes_;
+    std::array<std::vector<P>, N> coords_;
+    std::vector<Index> indices_;
+};
+
+template <size_t N, typename P>
+FlatKDTree<N, P>::FlatKDTree(std::span<const Point> points) {
+    IVW_ASSERT(points.size() < invalid, "Too many points");
+    const size_t size = points.size();
+    // The leaves get at most ceil(size / 2^depth) points
+    while (((size + (size_t{1} << depth_) - 1) >> depth_) > bucketSize) ++depth_;
+
+    const size_t nodes = (size_t{1} << depth_) - 1;
+    splits_.resize(nodes);
+    axes_.resize(nodes);
+
+    std::vector<Index> perm(size);
+    std::iota(perm.begin(), perm.end(), Index{0});
+
+    // Build one level at a time, all the nodes of a level cover disjoint ranges
+    std::vector<std::pair<size_t, size_t>> ranges{{0, size}};
+    std::vector<std::pair<size_t, size_t>> next;
+    for (size_t level = 0; level < depth_; ++level) {
+        const size_t first = ranges.size() - 1;
+        util::parallelFor(
+            0, ranges.size(),
+            [&](size_t i) { split(first + i, ranges[i].first, ranges[i].second, points, perm); },
+            {.grainSize = 1});
+
+        next.clear();
+        for (const auto& [begin, end] : ranges) {
+            const size_t mid = begin + (end - begin) / 2;
+            next.emplace_back(begin, mid);
+            next.emplace_back(mid, end);
+        }
+        std::swap(ranges, next);
+    }
+
+    indices_ = std::move(perm);
+    for (auto& coords : coords_) coords.resize(size);
+    util::parallelFor(
+        0, size,
+        [&](size_t i) {
+            for (size_t k = 0; k < N; ++k) coords_[k][i] = points[indices_[i]][k];
+        },
+        {.grainSize = 4096});
+}
+
+template <size_t N, typename P>
+void FlatKDTree<N, P>::split(size_t node, size_t begin, size_t end, std::span<const Point> points,
+                             std::vector<Index>& perm) {
+    // Split along the axis with the largest extent
+    Point lower{std::numeric_limits<P>::max()};
+    Point upper{std::numeric_limits<P>::lowest()};
+    for (size_t i = begin; i < end; ++i) {
+        lower = glm::min(lower, points[perm[i]]);
+        upper = glm::max(upper, points[perm[i]]);
+    }
+    std::uint8_t axis = 0;
+    for (std::uint8_t k = 1; k < N; ++k) {
+        if (upper[k] - lower[k] > upper[axis] - lower[axis]) axis = k;
+    }
+
+    const size_t mid = begin + (end - begin) / 2;
+    std::nth_element(perm.begin() + begin, perm.begin() + mid, perm.begin() + end,
+                     [&](Index a, Index b) { return points[a][axis] < points[b][axis]; });
+    axes_[node] = axis;
+    splits_[node] = points[perm[mid]][axis];
+}
+
+template <size_t N, typename P>
+template <typename Visit>
+void FlatKDTree<N, P>::scanLeaf(size_t begin, size_t end, const Point& pos, Visit& visit) const {
+    IVW_ASSERT(end - begin <= bucketSize, "Leaf bucket too large");
+    const size_t count = end - begin;
+    std::array<P, bucketSize> dist2{};
+    for (size_t k = 0; k < N; ++k) {
+        const P* coords = coords_[k].data() + begin;
+        const P p = pos[k];
+        for (size_t i = 0; i < count; ++i) {
+            const P delta = coords[i] - p;
+            dist2[i] += delta * delta;
+        }
+    }
+    for (size_t i = 0; i < count; ++i) visit(indices_[begin + i], dist2[i]);
+}
+
+template <size_t N, typename P>
+template <typename Visit, typename Bound>
+void FlatKDTree<N, P>::traverse(size_t node, size_t level, size_t begin, size_t end,
+                                const Point& pos, Visit& visit, const Bound& bound) const {
+    if (level == depth_) {
+        scanLeaf(begin, end, pos, visit);
+        return;
+    }
+
+    // Points equal to the split value can end up on either side, hence the <= when pruning
+    const size_t mid = begin + (end - begin) / 2;
+    const P delta = pos[axes_[node]] - splits_[node];
+    const size_t left = 2 * node + 1;
+    const size_t right = left + 1;
+    if (delta < P{0}) {
+        traverse(left, level + 1, begin, mid, pos, visit, bound);
+        if (delta * delta <= bound()) traverse(right, level + 1, mid, end, pos, visit, bound);
+    } else {
+        traverse(right, level + 1, mid, end, pos, visit, bound);
+        if (delta * delta <= bound()) traverse(left, level + 1, begin, mid, pos, visit, bound);
+    }
+}
+
+template <size_t N, typename P>
+auto FlatKDTree<N, P>::nearest(const Point& pos) const -> Index {
+    P best = std::numeric_limits<P>::max();
+    Index bestIndex = invalid;
+    auto visit = [&](Index index, P dist2) {
+        if (dist2 < best || (dist2 == best && index < bestIndex)) {
+            best = dist2;
+            bestIndex = index;
+        }
+    };
+    traverse(pos, visit, [&]() { return best; });
+    return bestIndex;
+}
+
+template <size_t N, typename P>
+size_t FlatKDTree<N, P>::kNearest(const Point& pos, std::span<Index> indices,
+                                  std::span<P> dist2) const {
+    IVW_ASSERT(indices.size() == dist2.size(), "indices and dist2 should be of the same size");
+    const size_t k = indices.size();
+    std::fill(indices.begin(), indices.end(), invalid);
+    std::fill(dist2.begin(), dist2.end(), std::numeric_limits<P>::max());
+    if (k == 0) return 0;
+
+    // The results are kept sorted, with the current k:th closest point last
+    size_t count = 0;
+    auto visit = [&](Index index, P d2) {
+        if (count == k && (d2 > dist2[k - 1] || (d2 == dist2[k - 1] && index > indices[k - 1]))) {
+            return;
+        }
+        size_t i = std::min(count, k - 1);
+        while (i > 0 && (d2 < dist2[i - 1] || (d2 == dist2[i - 1] && index < indices[i - 1]))) {
+            dist2[i] = dist2[i - 1];
+            indices[i] = indices[i - 1];
+            --i;
+        }
+        dist2[i] = d2;
+        indices[i] = index;
+        count = std::min(count + 1, k);
+    };
+    traverse(pos, visit, [&]() { return dist2[k - 1]; });
+    return count;
+}
+
+template <size_t N, typename P>
+void FlatKDTree<N, P>::withinRadius(const Point& pos, P radius, std::vector<Index>& result) const {
+    const P radius2 = radius * radius;
+    const auto first = result.size();
+    auto visit = [&](Index index, P dist2) {
+        if (dist2 <= radius2) result.push_back(index);
+    };
+    traverse(pos, visit, [&]() { return radius2; });
+    std::sort(result.begin() + first, result.end());
+}
+
+template <size_t N, typename P>
+void FlatKDTree<N, P>::nearest(std::span<const Point> queries, std::span<Index> result) const {
+    IVW_ASSERT(queries.size() == result.size(), "queries and result should be of the same size");
+    util::parallelFor(
+        0, queries.size(), [&](size_t i) { result[i] = nearest(queries[i]); },
+        {.grainSize = 256});
+}
+
+template <size_t N, typename P>
+void FlatKDTree<N, P>::kNearest(std::span<const Point> queries, size_t k,
+                                std::span<Index> indices, std::span<P> dist2) const {
+    IVW_ASSERT(indices.size() == queries.size() * k, "indices should be of size queries * k");
+    IVW_ASSERT(dist2.size() == queries.size() * k, "dist2 should be of size queries * k");
+    util::parallelFor(
+        0, queries.size(),
+        [&](size_t i) { kNearest(queries[i], indices.subspan(i * k, k), dist2.subspan(i * k, k)); },
+        {.grainSize = 256});
+}
+
+template <size_t N, typename P>
+void FlatKDTree<N, P>::withinRadius(std::span<const Point> queries, P radius,
+                                    std::vector<size_t>& offsets,
+                                    std::vector<Index>& indices) const {
+    const P radius2 = radius * radius;
+
+    // First count the matches of each query, then fill in the indices in a second pass
+    offsets.assign(queries.size() + 1, 0);
+    util::parallelFor(
+        0, queries.size(),
+        [&](size_t i) {
+            size_t count = 0;
+            auto visit = [&](Index, P dist2) {
+                if (dist2 <= radius2) ++count;
+            };
+            traverse(queries[i], visit, [&]() { return radius2; });
+            offsets[i + 1] = count;
+        },
+        {.grainSize = 256});
+    for (size_t i = 0; i < queries.size(); ++i) offsets[i + 1] += offsets[i];
+
+    indices.resize(offsets.back());
+    util::parallelFor(
+        0, queries.size(),
+        [&](size_t i) {
+            auto out = indices.begin() + offsets[i];
+            auto visit = [&](Index index, P dist2) {
+                if (dist2 <= radius2) *out++ = index;
+            };
+            traverse(queries[i], visit, [&]() { return radius2; });
+            std::sort(indices.begin() + offsets[i], indices.begin() + offsets[i + 1]);
+        },
+        {.grainSize = 256});
+}
+
+}  // namespace inviwo
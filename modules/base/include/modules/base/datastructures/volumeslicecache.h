@@ -0,0 +1,78 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
+
+#include <inviwo/core/datastructures/geometry/geometrytype.h>  // for CartesianCoordinateAxis
+
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr, weak_ptr
+#include <vector>   // for vector
+
+namespace inviwo {
+class Volume;
+class VolumeRAM;
+
+/**
+ * \class VolumeSliceCache
+ * \brief A small least recently used cache of axis aligned volume slices read directly from disk.
+ *
+ * Slices are read with util::loadVolumeRegion, so only volumes that are not loaded into RAM yet
+ * and whose disk loader can read regions are served. For any other volume get returns nullptr and
+ * the slice should be taken from the VolumeRAM representation. The cache is cleared when a
+ * different volume is used.
+ */
+class IVW_MODULE_BASE_API VolumeSliceCache {
+public:
+    explicit VolumeSliceCache(size_t capacity = 8);
+
+    /**
+     * Get slice @p slice along @p axis of @p volume.
+     * @return a VolumeRAM that is one voxel thick along @p axis, or nullptr if the slice can not
+     * be read from disk.
+     */
+    std::shared_ptr<const VolumeRAM> get(const std::shared_ptr<const Volume>& volume,
+                                         CartesianCoordinateAxis axis, size_t slice);
+    void clear();
+
+private:
+    struct Entry {
+        CartesianCoordinateAxis axis;
+        size_t slice;
+        std::shared_ptr<const VolumeRAM> ram;
+    };
+
+    size_t capacity_;
+    std::weak_ptr<const Volume> volume_;
+    std::vector<Entry> entries_;  // most recently used first
+};
+
+}  // namespace inviwo
@@ -32,8 +32,10 @@
 #include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
 
 #include <inviwo/core/datastructures/volume/volume.h>  // for DataWriterType
+#include <inviwo/core/io/chunkedvolumefile.h>          // for ChunkedVolumeSettings
 #include <inviwo/core/io/datawriter.h>                 // for Overwrite, Overwrite::No, DataWrit...
 
+#include <any>          // for any
 #include <string_view>  // for string_view
 
 namespace inviwo {
@@ -45,6 +47,14 @@ namespace inviwo {
  * Supports writing a single volume to disk. Creates one main file ([name].ivf) and one raw file
  * ([name].raw or [name]xx.raw.gz if zlib compression is available).
  *
+ * With the "Chunked" option the data is instead written to a chunked file ([name].ivc), where
+ * every chunk is compressed independently. Such files are compressed and decoded in parallel, and
+ * subsets can be loaded without decoding the whole volume, see util::writeChunkedVolume.
+ * The ivf file then contains `<Chunked content="1" />`. Available options:
+ *  * "Chunked" (bool) write a chunked file, default false
+ *  * "ChunkDimensions" (size3_t) dimensions of each chunk, default 64^3
+ *  * "CompressionLevel" (int) 1 (fast) to 9 (small), default 1
+ *
  * The output structure of the ivf file is:
  * \verbatim
 <?xml version="1.0" ?>
@@ -96,6 +106,13 @@ public:
     virtual ~IvfVolumeWriter() = default;
 
     virtual void writeData(const Volume* data, const std::filesystem::path& filePath) const;
+
+    virtual bool setOption(std::string_view key, std::any value) override;
+    virtual std::any getOption(std::string_view key) const override;
+
+private:
+    bool chunked_ = false;
+    util::ChunkedVolumeSettings chunkedSettings_;
 };
 
 /**
@@ -154,6 +171,15 @@ namespace util {
 IVW_MODULE_BASE_API void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath,
                                         Overwrite overwrite = Overwrite::Yes);
 
+/**
+ * Write @p data as an ivf file ([name].ivf) with its data in a chunked file ([name].ivc).
+ * @see util::writeChunkedVolume inviwo::IvfVolumeReader
+ */
+IVW_MODULE_BASE_API void writeChunkedIvfVolume(const Volume& data,
+                                               const std::filesystem::path& filePath,
+                                               const ChunkedVolumeSettings& chunked = {},
+                                               Overwrite overwrite = Overwrite::Yes);
+
 /**
  * \brief Writes a volume sequence to disk
  *
@@ -0,0 +1,96 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/util/glmmat.h>  // for mat4
+
+#include <array>    // for array
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t, uint64_t, int32_t
+
+namespace inviwo::ivm {
+
+/**
+ * The layout of the native Inviwo binary mesh format (.ivm) used by IvmMeshWriter and
+ * IvmMeshReader. All values are stored in native byte order.
+ *
+ * The file starts with a FileHeader followed by a list of chunks. Every chunk starts with a
+ * ChunkHeader followed by `ChunkHeader::size` bytes of payload, unknown chunk types are skipped
+ * which lets later versions add chunks without breaking older readers. Buffer and index chunks
+ * start with a description of the data followed by padding up to the next multiple of
+ * `alignment` in the file, and then the raw data blob. Hence the blobs have the same layout on
+ * disk as in a BufferRAM and can be copied directly from a memory mapping of the file.
+ */
+
+constexpr std::uint32_t magic = 0x004d5649;  // "IVM\0"
+constexpr std::uint32_t version = 1;
+constexpr std::size_t alignment = 64;
+
+enum class ChunkType : std::uint32_t { Mesh = 1, Buffer = 2, Indices = 3 };
+
+struct FileHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t chunks;
+};
+
+struct ChunkHeader {
+    ChunkType type;
+    std::uint32_t reserved;
+    std::uint64_t size;
+};
+
+struct MeshChunk {
+    mat4 modelMatrix;
+    mat4 worldMatrix;
+};
+
+struct BufferChunk {
+    std::int32_t type;            //!< BufferType
+    std::int32_t location;        //!< attribute location
+    std::int32_t usage;           //!< BufferUsage
+    std::int32_t target;          //!< BufferTarget
+    std::array<char, 32> format;  //!< Name of the DataFormat, zero terminated
+    std::uint64_t size;           //!< number of elements
+    std::uint64_t offset;         //!< offset of the data from the start of the chunk payload
+};
+
+struct IndexChunk {
+    std::int32_t drawType;      //!< DrawType
+    std::int32_t connectivity;  //!< ConnectivityType
+    std::int32_t usage;         //!< BufferUsage
+    std::int32_t reserved;
+    std::uint64_t size;    //!< number of uint32 indices
+    std::uint64_t offset;  //!< offset of the data from the start of the chunk payload
+};
+
+constexpr std::size_t padding(std::size_t pos) { return (alignment - pos % alignment) % alignment; }
+
+}  // namespace inviwo::ivm
@@ -0,0 +1,63 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
+
+#include <inviwo/core/datastructures/geometry/mesh.h>  // for DataReaderType
+#include <inviwo/core/io/datareader.h>                 // for DataReaderType
+
+#include <memory>  // for shared_ptr
+
+namespace inviwo {
+
+/**
+ * \ingroup dataio
+ * \brief Reader for the native Inviwo binary mesh format (.ivm)
+ *
+ * The file is memory mapped when possible and the data blobs are copied directly, and in
+ * parallel, into the BufferRAM representations without any parsing or conversion. Hence reading
+ * is mostly limited by the disk throughput, even for meshes of several GB.
+ * @see IvmMeshWriter ivm::FileHeader
+ */
+class IVW_MODULE_BASE_API IvmMeshReader : public DataReaderType<Mesh> {
+public:
+    IvmMeshReader();
+    IvmMeshReader(const IvmMeshReader& rhs) = default;
+    IvmMeshReader(IvmMeshReader&& rhs) = default;
+    IvmMeshReader& operator=(const IvmMeshReader& that) = default;
+    IvmMeshReader& operator=(IvmMeshReader&& that) = default;
+    virtual IvmMeshReader* clone() const override;
+    virtual ~IvmMeshReader() = default;
+
+    virtual std::shared_ptr<Mesh> readData(const std::filesystem::path& filePath) override;
+};
+
+}  // namespace inviwo
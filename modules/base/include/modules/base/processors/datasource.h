@@ -31,7 +31,7 @@
 
 #include <modules/base/basemoduledefine.h>
 #include <inviwo/core/common/factoryutil.h>
-#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/poolprocessor.h>
 #include <inviwo/core/properties/fileproperty.h>
 #include <inviwo/core/properties/buttonproperty.h>
 #include <inviwo/core/io/datareaderfactory.h>
@@ -125,10 +125,14 @@ void updateFilenameFilters(const DataReaderFactory& rf, FileProperty& filePath,
 /**
  * A base class for simple source processors.
  * Two functions to customize the behavior are available, dataLoaded and dataDeserialized.
+ * If the reader is thread safe, see DataReader::isThreadSafe, the data is read in the thread pool
+ * using DataReaderType::readDataAsync, hence loading does not block the UI, and several sources in
+ * a workspace will load in parallel. Other readers are used on the main thread. transform,
+ * dataLoaded and dataDeserialized are always called on the main thread once the data is read.
  */
 template <typename DataType, typename PortType = DataOutport<DataType>,
           typename ReaderType = DataType>
-class DataSource : public Processor {
+class DataSource : public PoolProcessor {
 public:
     /**
      * Construct a DataSource
@@ -152,7 +156,9 @@ public:
 
 protected:
     void load();
+    void setLoaded(std::shared_ptr<ReaderType> result);
     void handleError(std::string_view error);
+    virtual std::string handleError() override;
 
     // Called to transform the loaded data of ReaderType to the DataType expected by the port
     virtual std::shared_ptr<DataType> transform(std::shared_ptr<ReaderType> data);
@@ -166,13 +172,14 @@ protected:
     PortType port_;
     std::string error_;
     bool deserialized_ = false;
+    bool loaded_ = false;
 };
 
 template <typename DataType, typename PortType, typename ReaderType>
 DataSource<DataType, PortType, ReaderType>::DataSource(DataReaderFactory* rf,
                                                        const std::filesystem::path& aFilePath,
                                                        std::string_view content)
-    : Processor()
+    : PoolProcessor(pool::Option::Background)
     , filePath{"filename", "File", aFilePath, content}
     , extensions{"reader", "Data Reader"}
     , reload{"reload", "Reload data",
@@ -210,6 +217,7 @@ DataSource<DataType, PortType, ReaderType>::DataSource(DataReaderFactory* rf,
     });
     filePath.onChange([this]() {
         error_.clear();
+        deserialized_ = false;
         util::updateReaderFromFile(filePath, extensions);
         isReady_.update();
     });
@@ -221,9 +229,9 @@ DataSource<DataType, PortType, ReaderType>::DataSource(DataReaderFactory* rf,
 
 template <typename DataType, typename PortType, typename ReaderType>
 void DataSource<DataType, PortType, ReaderType>::process() {
-    if (filePath.isModified() || reload.isModified()) {
+    // A load that was canceled by an invalidation has to be restarted
+    if (filePath.isModified() || reload.isModified() || !loaded_) {
         load();
-        deserialized_ = false;
     }
 }
 
@@ -235,6 +243,18 @@ void DataSource<DataType, PortType, ReaderType>::handleError(std::string_view er
     log::report(LogLevel::Error, error_);
 }
 
+template <typename DataType, typename PortType, typename ReaderType>
+std::string DataSource<DataType, PortType, ReaderType>::handleError() {
+    try {
+        throw;
+    } catch (const DataReaderException& e) {
+        handleError(fmt::format("Could not load: {}.\n{}", filePath.get(), e.getMessage()));
+    } catch (...) {
+        error_ = PoolProcessor::handleError();
+    }
+    return error_;
+}
+
 template <typename DataType, typename PortType, typename ReaderType>
 std::shared_ptr<DataType> DataSource<DataType, PortType, ReaderType>::transform(
     std::shared_ptr<ReaderType> data) {
@@ -253,24 +273,44 @@ void DataSource<DataType, PortType, ReaderType>::load() {
     if (filePath.get().empty()) return;
 
     const auto sext = extensions.getSelectedValue();
-    if (auto reader =
+    if (std::shared_ptr<DataReaderType<ReaderType>> reader =
             rf_->template getReaderForTypeAndExtension<ReaderType>(sext, filePath.get())) {
-        try {
-            auto data = transform(reader->readData(filePath.get()));
-            port_.setData(data);
-            if (deserialized_) {
-                dataDeserialized(data);
-            } else {
-                dataLoaded(data);
+        loaded_ = false;
+        if (reader->isThreadSafe()) {
+            dispatchOne(
+                [reader, path = filePath.get()](pool::Stop stop, pool::Progress progress) {
+                    return reader->readDataAsync(path, stop, progress);
+                },
+                [this](std::shared_ptr<ReaderType> result) {
+                    setLoaded(std::move(result));
+                    newResults();
+                });
+        } else {
+            stopJobs();
+            try {
+                setLoaded(reader->readData(filePath.get()));
+            } catch (const DataReaderException& e) {
+                handleError(fmt::format("Could not load: {}.\n{}", filePath.get(), e.getMessage()));
             }
-        } catch (const DataReaderException& e) {
-            handleError(fmt::format("Could not load: {}.\n{}", filePath.get(), e.getMessage()));
         }
     } else {
         handleError(fmt::format("Could not find a data reader for file: {}", filePath.get()));
     }
 }
 
+template <typename DataType, typename PortType, typename ReaderType>
+void DataSource<DataType, PortType, ReaderType>::setLoaded(std::shared_ptr<ReaderType> result) {
+    auto data = transform(std::move(result));
+    port_.setData(data);
+    if (deserialized_) {
+        dataDeserialized(data);
+    } else {
+        dataLoaded(data);
+    }
+    deserialized_ = false;
+    loaded_ = true;
+}
+
 template <typename DataType, typename PortType, typename ReaderType>
 void DataSource<DataType, PortType, ReaderType>::deserialize(Deserializer& d) {
     Processor::deserialize(d);
@@ -41,6 +41,8 @@
 #include <inviwo/core/ports/dataoutport.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/network/processornetworkevaluationobserver.h>
+#include <inviwo/core/network/processornetworkobserver.h>
+#include <inviwo/core/processors/processorobserver.h>
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/io/datawriterfactory.h>
 #include <inviwo/core/io/datareaderfactory.h>
@@ -54,6 +56,7 @@
 
 #include <filesystem>
 #include <optional>
+#include <unordered_map>
 
 #include <fmt/std.h>
 
@@ -65,6 +68,50 @@ IVW_MODULE_BASE_API std::string cacheState(Processor* p, ProcessorNetwork& net,
                                            const std::filesystem::path& refPath,
                                            std::pmr::string& xml);
 
+/**
+ * Computes the cache key of a processor from the state of all processors upstream of it, without
+ * serializing the whole upstream network every time. The state hash of each processor is kept
+ * until one of its properties is modified, and the hashes combined along the upstream connections
+ * are kept until a processor or connection upstream changes. Fetching the key of an unmodified
+ * network is hence O(1), and a modification only rehashes the modified processor.
+ * @see cacheState for the full serialization, which is still used to write the workspace of a
+ * cached file.
+ */
+class IVW_MODULE_BASE_API CacheStateTracker : public ProcessorNetworkObserver,
+                                              public ProcessorObserver {
+public:
+    explicit CacheStateTracker(Processor* owner);
+    CacheStateTracker(const CacheStateTracker&) = delete;
+    CacheStateTracker& operator=(const CacheStateTracker&) = delete;
+    virtual ~CacheStateTracker() = default;
+
+    /**
+     * The key of the owner, any paths are hashed relative to @p refPath if it is not empty.
+     */
+    std::string key(const std::filesystem::path& refPath);
+
+private:
+    struct Hashes {
+        std::optional<size_t> state;
+        std::optional<size_t> combined;
+    };
+
+    Hashes& hashes(Processor* processor);
+    size_t state(Processor* processor);
+    size_t combined(Processor* processor);
+    void invalidateDownstream(Processor* processor);
+
+    virtual void onAboutPropertyChange(Property* property) override;
+    virtual void onProcessorNetworkWillRemoveProcessor(Processor* processor) override;
+    virtual void onProcessorNetworkDidAddConnection(const PortConnection& connection) override;
+    virtual void onProcessorNetworkDidRemoveConnection(const PortConnection& connection) override;
+
+    Processor* owner_;
+    ProcessorNetwork* network_ = nullptr;
+    std::filesystem::path refPath_;
+    std::unordered_map<Processor*, Hashes> hashes_;
+};
+
 template <typename... Types>
 void updateFilenameFilters(const DataReaderFactory& rf, const DataWriterFactory& wf,
                            OptionProperty<FileExtension>& extensions) {
@@ -117,7 +164,7 @@ public:
     virtual const std::string& loadedKey() const = 0;
 
 protected:
-    void writeXML() const;
+    void writeXML();
 
     BoolProperty enabled_;
     DirectoryProperty cacheDir_;
@@ -127,6 +174,7 @@ protected:
     bool isCached_ = false;
     std::string key_;
     std::pmr::string xml_;
+    detail::CacheStateTracker tracker_;
 };
 
 template <typename DataType>
@@ -52,6 +52,7 @@ public:
     virtual ~MeshColorFromNormals() = default;
 
     virtual void process() override;
+    virtual bool isThreadSafe() const override { return true; }
 
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
@@ -61,7 +61,7 @@ public:
     static const ProcessorInfo processorInfo_;
 
 private:
-    enum class Type { ToPoints, ToLines };
+    enum class Type { ToPoints, ToLines, Optimize };
 
     MeshFlatMultiInport inport_;
     DataOutport<std::vector<std::shared_ptr<Mesh>>> outport_;
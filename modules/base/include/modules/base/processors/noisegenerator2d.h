@@ -50,6 +50,7 @@ namespace inviwo {
  */
 class IVW_MODULE_BASE_API NoiseGenerator2D : public Processor {
     enum class NoiseType { Random, Perlin, PoissonDisk, HaltonSequence };
+    enum class Generator { MersenneTwister, Philox };
 
 public:
     NoiseGenerator2D();
@@ -76,8 +77,9 @@ protected:
     IntSizeTProperty haltonYBase_;
 
     CompositeProperty randomness_;
-    BoolProperty useSameSeed_;  ///< Use the same seed for each call to process.
-    IntProperty seed_;          ///<  The seed used to initialize the random sequence
+    OptionProperty<Generator> generator_;  ///< The random number generator to use
+    BoolProperty useSameSeed_;             ///< Use the same seed for each call to process.
+    IntProperty seed_;                     ///<  The seed used to initialize the random sequence
 
     LayerInformationProperty information_;
     BasisProperty basis_;
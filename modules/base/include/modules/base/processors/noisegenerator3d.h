@@ -51,6 +51,7 @@ namespace inviwo {
 
 class IVW_MODULE_BASE_API NoiseGenerator3D : public Processor {
     enum class NoiseType { Random, HaltonSequence };
+    enum class Generator { MersenneTwister, Philox };
 
 public:
     NoiseGenerator3D();
@@ -76,6 +77,7 @@ private:
     IntSizeTProperty haltonZBase_;
 
     CompositeProperty randomness_;
+    OptionProperty<Generator> generator_;
     BoolProperty useSameSeed_;
     IntProperty seed_;
 
@@ -51,6 +51,7 @@
 #include <memory>       // for shared_ptr
 #include <string>       // for operator==, operator+, string
 #include <string_view>  // for operator==
+#include <vector>       // for vector
 
 #include <fmt/core.h>    // for format, format_to, basic_string_view
 #include <glm/fwd.hpp>   // for uvec3
@@ -77,12 +78,16 @@ public:
     virtual void process() override;
 
 protected:
+    /// Lazily computed block value ranges of a volume, reused while only the iso-value changes
+    class BlockRangesCache;
+
     void updateColors();
     vec4 getColor(size_t i) const;
 
     DataInport<Volume, 0, true> volume_;
     DataOutport<DataSequence<Mesh>> outport_;
     std::vector<std::shared_ptr<Mesh>> meshes_;
+    std::vector<std::shared_ptr<BlockRangesCache>> blockRanges_;
 
     OptionProperty<Method> method_;
     FloatProperty isoValue_;
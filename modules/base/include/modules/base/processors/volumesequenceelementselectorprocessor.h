@@ -31,8 +31,12 @@
 
 #include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
 
+#include <inviwo/core/datastructures/sequenceprefetcher.h>           // for SequencePrefetcher
 #include <inviwo/core/datastructures/volume/volume.h>                // for DataInport
+#include <inviwo/core/datastructures/volume/volumeram.h>             // for VolumeRAM
 #include <inviwo/core/processors/processorinfo.h>                    // for ProcessorInfo
+#include <inviwo/core/properties/boolcompositeproperty.h>            // for BoolCompositeProperty
+#include <inviwo/core/properties/ordinalproperty.h>                  // for IntSizeTProperty
 #include <inviwo/core/util/glmvec.h>                                 // for uvec3
 #include <modules/base/processors/vectorelementselectorprocessor.h>  // for VectorElementSelecto...
 
@@ -45,8 +49,15 @@ public:
     VolumeSequenceElementSelectorProcessor();
     virtual ~VolumeSequenceElementSelectorProcessor() = default;
 
+    virtual void process() override;
+
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
+
+private:
+    BoolCompositeProperty prefetch_;
+    IntSizeTProperty prefetchCount_;
+    SequencePrefetcher<Volume, VolumeRAM> prefetcher_;
 };
 
 }  // namespace inviwo
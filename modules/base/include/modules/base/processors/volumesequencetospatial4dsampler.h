@@ -31,12 +31,13 @@
 
 #include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
 
-#include <inviwo/core/ports/dataoutport.h>         // for DataOutport
-#include <inviwo/core/ports/volumeport.h>          // for VolumeSequenceInport
-#include <inviwo/core/processors/processor.h>      // for Processor
-#include <inviwo/core/processors/processorinfo.h>  // for ProcessorInfo
-#include <inviwo/core/properties/boolproperty.h>   // for BoolProperty
-#include <inviwo/core/util/spatial4dsampler.h>     // for Spatial4DSampler
+#include <inviwo/core/ports/dataoutport.h>           // for DataOutport
+#include <inviwo/core/ports/volumeport.h>            // for VolumeSequenceInport
+#include <inviwo/core/processors/processor.h>        // for Processor
+#include <inviwo/core/processors/processorinfo.h>    // for ProcessorInfo
+#include <inviwo/core/properties/boolproperty.h>     // for BoolProperty
+#include <inviwo/core/properties/ordinalproperty.h>  // for IntSizeTProperty
+#include <inviwo/core/util/spatial4dsampler.h>       // for Spatial4DSampler
 
 #include <string>  // for operator+, string
 
@@ -59,6 +60,7 @@ private:
     DataOutport<Spatial4DSampler<dvec3>> sampler_;
 
     BoolProperty allowLooping_;
+    IntSizeTProperty streamingWindow_;
 };
 
 }  // namespace inviwo
@@ -45,6 +45,7 @@
 #include <inviwo/core/properties/transferfunctionproperty.h>   // for TransferFunctionProperty
 #include <inviwo/core/util/staticstring.h>                     // for operator+
 #include <modules/base/datastructures/imagereusecache.h>       // for ImageReuseCache
+#include <modules/base/datastructures/volumeslicecache.h>      // for VolumeSliceCache
 
 #include <functional>   // for __base
 #include <string>       // for operator==
@@ -102,6 +103,7 @@ private:
     EventProperty gestureShiftSlice_;
 
     ImageReuseCache imageCache_;
+    VolumeSliceCache sliceCache_;
 };
 
 }  // namespace inviwo
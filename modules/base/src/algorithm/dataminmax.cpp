@@ -37,12 +37,19 @@
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
+#include <inviwo/core/io/sessioncache.h>                                // for SessionCache
 #include <inviwo/core/util/glmvec.h>                                    // for dvec4
 #include <modules/base/algorithm/algorithmoptions.h>                    // for IgnoreSpecialValues
 
+#include <array>          // for array
+#include <cstring>        // for memcpy
 #include <memory>         // for unique_ptr
+#include <optional>       // for optional
+#include <span>           // for span
 #include <unordered_set>  // for unordered_set
 
+#include <fmt/format.h>  // for format
+
 namespace inviwo {
 
 std::pair<dvec4, dvec4> util::volumeMinMax(const VolumeRAM* volume, IgnoreSpecialValues ignore) {
@@ -66,7 +73,24 @@ std::pair<dvec4, dvec4> util::bufferMinMax(const BufferRAM* buffer, IgnoreSpecia
 }
 
 std::pair<dvec4, dvec4> util::volumeMinMax(const Volume* volume, IgnoreSpecialValues ignore) {
-    return util::volumeMinMax(volume->getRepresentation<VolumeRAM>(), ignore);
+    // The range of volumes read from disk is kept in the session cache when it is enabled
+    auto* cache = util::getSessionCache();
+    const auto description = fmt::format("minmax {}", ignore == IgnoreSpecialValues::Yes);
+    const auto key = cache ? util::sessionCacheKey(*volume, description) : std::nullopt;
+    std::array<dvec4, 2> minMax{};
+    if (key) {
+        if (const auto mapped = cache->load(*key); mapped && mapped->size() == sizeof(minMax)) {
+            std::memcpy(minMax.data(), mapped->data(), sizeof(minMax));
+            return {minMax[0], minMax[1]};
+        }
+    }
+
+    const auto [min, max] = util::volumeMinMax(volume->getRepresentation<VolumeRAM>(), ignore);
+    if (key) {
+        minMax = {min, max};
+        cache->store(*key, std::as_bytes(std::span{minMax}));
+    }
+    return {min, max};
 }
 
 std::pair<dvec4, dvec4> util::layerMinMax(const Layer* layer, IgnoreSpecialValues ignore) {
@@ -43,11 +43,12 @@
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, vec4
 #include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
 #include <inviwo/core/util/interpolation.h>                             // for Interpolation
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 
-#include <algorithm>      // for min
+#include <algorithm>      // for min, transform
+#include <cstdint>        // for uint32_t
+#include <numeric>        // for iota
 #include <type_traits>    // for remove_extent_t
-#include <unordered_map>  // for unordered_map
-#include <unordered_set>  // for unordered_set
 #include <vector>         // for vector
 
 #include <glm/common.hpp>        // for mix
@@ -59,6 +60,9 @@ class Mesh;
 
 namespace {
 
+// Number of rows of cells processed by each task
+constexpr size_t bandHeight = 64;
+
 constexpr auto dispatcher = []<typename T>(const LayerRepresentation* in, size_t channel,
                                            double isoValue, vec4 color) -> std::shared_ptr<Mesh> {
     static const std::vector<std::vector<int>> caseTable = {
@@ -72,9 +76,6 @@ constexpr auto dispatcher = []<typename T>(const LayerRepresentation* in, size_t
         std::vector<int>({0, 3, 3, 2}),              // case 7
         std::vector<int>({0, 3, 0, 1, 1, 2, 2, 3})};
 
-    auto mesh = std::make_shared<BasicMesh>();
-    auto indices = mesh->addIndexBuffer(DrawType::Lines, ConnectivityType::None);
-
     channel = std::min(channel, util::extent<T>::value - 1);
 
     const LayerRAMPrecision<T>* ram = dynamic_cast<const LayerRAMPrecision<T>*>(in);
@@ -86,54 +87,94 @@ constexpr auto dispatcher = []<typename T>(const LayerRepresentation* in, size_t
 
     if (dim.x == 0 || dim.y == 0) return nullptr;
 
-    double vals[4];
-    vec3 outPos[4];
-    vec3 outPosScale =
+    const vec3 outPosScale =
         vec3(1.0f / static_cast<float>(dim.x - 1), 1.0f / static_cast<float>(dim.y - 1), 1);
-    util::IndexMapper2D index(dim);
-    for (size_t y = 0; y < dim.y - 1; y++) {
-        for (size_t x = 0; x < dim.x - 1; x++) {
-            auto idx = index(x, y);
-            vals[0] = util::glm_convert<double>(util::glmcomp(data[idx], channel));
-            vals[1] = util::glm_convert<double>(util::glmcomp(data[idx + 1], channel));
-            vals[2] = util::glm_convert<double>(util::glmcomp(data[idx + 1 + dim.x], channel));
-            vals[3] = util::glm_convert<double>(util::glmcomp(data[idx + dim.x], channel));
-
-            int theCase = 0;
-            theCase += vals[0] < isoValue ? 0 : 1;
-            theCase += vals[1] < isoValue ? 0 : 2;
-            theCase += vals[2] < isoValue ? 0 : 4;
-            theCase += vals[3] < isoValue ? 0 : 8;
-
-            if (theCase == 0 || theCase == 15) {
-                continue;
-            } else if (theCase == 5 || theCase == 10) {
-                auto m = (vals[0] + vals[1] + vals[2] + vals[3]) * 0.25;
-                bool inside = m >= isoValue;
-                if (theCase == 5) {
-                    theCase = inside ? 5 : 8;
-                } else {
-                    theCase = !inside ? 5 : 8;
+    const util::IndexMapper2D index(dim);
+    const auto value = [&](size_t x, size_t y) {
+        return util::glm_convert<double>(util::glmcomp(data[index(x, y)], channel));
+    };
+
+    // Each cell only depends on its own four corners, so the rows of cells are split into bands
+    // that are processed in parallel. Concatenating the segments of the bands in order gives the
+    // same mesh as a single sweep over all cells, hence no stitching is needed along the seams.
+    const size_t rows = dim.y - 1;
+    const size_t bands = (rows + bandHeight - 1) / bandHeight;
+    std::vector<std::vector<vec3>> positions(bands);
+    util::parallelFor(0, bands, [&](size_t band) {
+        auto& out = positions[band];
+        const size_t yBegin = band * bandHeight;
+        const size_t yEnd = std::min(rows, yBegin + bandHeight);
+
+        // Convert each sample once, keeping the two rows of samples of the current row of cells
+        std::vector<double> lower(dim.x);
+        std::vector<double> upper(dim.x);
+        for (size_t x = 0; x < dim.x; x++) lower[x] = value(x, yBegin);
+
+        double vals[4];
+        vec3 outPos[4];
+        for (size_t y = yBegin; y < yEnd; y++) {
+            for (size_t x = 0; x < dim.x; x++) upper[x] = value(x, y + 1);
+
+            for (size_t x = 0; x < dim.x - 1; x++) {
+                vals[0] = lower[x];
+                vals[1] = lower[x + 1];
+                vals[2] = upper[x + 1];
+                vals[3] = upper[x];
+
+                int theCase = 0;
+                theCase += vals[0] < isoValue ? 0 : 1;
+                theCase += vals[1] < isoValue ? 0 : 2;
+                theCase += vals[2] < isoValue ? 0 : 4;
+                theCase += vals[3] < isoValue ? 0 : 8;
+
+                if (theCase == 0 || theCase == 15) {
+                    continue;
+                } else if (theCase == 5 || theCase == 10) {
+                    auto m = (vals[0] + vals[1] + vals[2] + vals[3]) * 0.25;
+                    bool inside = m >= isoValue;
+                    if (theCase == 5) {
+                        theCase = inside ? 5 : 8;
+                    } else {
+                        theCase = !inside ? 5 : 8;
+                    }
+                } else if (theCase > 7) {
+                    theCase = 15 - theCase;
                 }
-            } else if (theCase > 7) {
-                theCase = 15 - theCase;
-            }
 
-            outPos[0] = vec3(x, y, 0) * outPosScale;
-            outPos[1] = vec3(x + 1, y, 0) * outPosScale;
-            outPos[2] = vec3(x + 1, y + 1, 0) * outPosScale;
-            outPos[3] = vec3(x, y + 1, 0) * outPosScale;
-
-            auto& edges = caseTable[theCase];
-            for (size_t i = 0; i < edges.size(); i += 2) {
-                auto t = (isoValue - vals[edges[i]]) / (vals[edges[i + 1]] - vals[edges[i]]);
-                auto p = Interpolation<vec3, float>::linear(outPos[edges[i]], outPos[edges[i + 1]],
-                                                            static_cast<float>(t));
-                indices->add(mesh->addVertex(p, p, p, color));
+                outPos[0] = vec3(x, y, 0) * outPosScale;
+                outPos[1] = vec3(x + 1, y, 0) * outPosScale;
+                outPos[2] = vec3(x + 1, y + 1, 0) * outPosScale;
+                outPos[3] = vec3(x, y + 1, 0) * outPosScale;
+
+                auto& edges = caseTable[theCase];
+                for (size_t i = 0; i < edges.size(); i += 2) {
+                    auto t = (isoValue - vals[edges[i]]) / (vals[edges[i + 1]] - vals[edges[i]]);
+                    out.push_back(Interpolation<vec3, float>::linear(
+                        outPos[edges[i]], outPos[edges[i + 1]], static_cast<float>(t)));
+                }
             }
+            std::swap(lower, upper);
         }
+    });
+
+    std::vector<size_t> offsets(bands + 1, 0);
+    for (size_t band = 0; band < bands; ++band) {
+        offsets[band + 1] = offsets[band] + positions[band].size();
     }
 
+    std::vector<BasicMesh::Vertex> vertices(offsets.back());
+    util::parallelFor(0, bands, [&](size_t band) {
+        std::ranges::transform(positions[band], vertices.begin() + offsets[band],
+                               [&](const vec3& p) { return BasicMesh::Vertex{p, p, p, color}; });
+    });
+
+    auto mesh = std::make_shared<BasicMesh>();
+    auto indices = mesh->addIndexBuffer(DrawType::Lines, ConnectivityType::None);
+    mesh->addVertices(vertices);
+    auto& indexData = indices->getDataContainer();
+    indexData.resize(vertices.size());
+    std::iota(indexData.begin(), indexData.end(), std::uint32_t{0});
+
     return mesh;
 };
 
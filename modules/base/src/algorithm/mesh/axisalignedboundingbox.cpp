@@ -31,12 +31,9 @@
 
 #include <inviwo/core/datastructures/camera/camera.h>          // for mat4
 #include <inviwo/core/datastructures/coordinatetransformer.h>  // for SpatialCoordinateTransformer
-#include <inviwo/core/datastructures/geometry/geometrytype.h>  // for BufferType, BufferType::Po...
 #include <inviwo/core/datastructures/geometry/mesh.h>          // for Mesh
 #include <inviwo/core/util/glmvec.h>                           // for vec3, vec4
-#include <modules/base/algorithm/dataminmax.h>                 // for bufferMinMax
 
-#include <algorithm>    // for find_if
 #include <limits>       // for numeric_limits
 #include <type_traits>  // for remove_extent_t
 
@@ -68,16 +65,10 @@ std::pair<vec3, vec3> axisAlignedBoundingBox(const Mesh& mesh) {
     vec3 worldMin(std::numeric_limits<float>::max());
     vec3 worldMax(std::numeric_limits<float>::lowest());
 
-    const auto& buffers = mesh.getBuffers();
-    auto it = std::find_if(buffers.begin(), buffers.end(), [](const auto& buff) {
-        return buff.first.type == BufferType::PositionAttrib;
-    });
-    if (it != buffers.end() && it->second->getSize() > 0) {
-        auto minmax = util::bufferMinMax(it->second.get());
-
+    if (const auto minmax = mesh.getPositionRange()) {
         mat4 trans = mesh.getCoordinateTransformer().getDataToWorldMatrix();
-        worldMin = glm::min(worldMin, vec3(trans * vec4(vec3(minmax.first), 1.f)));
-        worldMax = glm::max(worldMax, vec3(trans * vec4(vec3(minmax.second), 1.f)));
+        worldMin = glm::min(worldMin, vec3(trans * vec4(vec3(minmax->first), 1.f)));
+        worldMax = glm::max(worldMax, vec3(trans * vec4(vec3(minmax->second), 1.f)));
     } else {
         // No vertices, use same values for min/max
         worldMin = worldMax = mesh.getOffset();
@@ -43,8 +43,10 @@
 #include <inviwo/core/util/glmutils.h>                                  // for same_extent
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, vec2, vec4
 #include <inviwo/core/util/logcentral.h>                                // for LogCentral, LogWa...
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 
-#include <algorithm>      // for transform, find_if
+#include <algorithm>      // for transform, find_if, none_of
+#include <array>          // for array
 #include <cstddef>        // for size_t
 #include <iterator>       // for back_insert_iterator
 #include <numeric>        // for accumulate, iota
@@ -52,6 +54,7 @@
 #include <string_view>    // for string_view
 #include <tuple>          // for make_tuple, tuple...
 #include <type_traits>    // for remove_extent_t
+#include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
 #include <utility>        // for pair
 
@@ -142,6 +145,132 @@ std::optional<glm::u32vec2> sutherlandHodgman(glm::u32vec3 triangle, const Plane
     }
 }
 
+std::vector<glm::u32vec2> clipTriangles(const Mesh::MeshInfo& meshInfo,
+                                        const std::vector<std::uint32_t>& indices,
+                                        const std::vector<float>& distances,
+                                        std::uint32_t firstNewVertex,
+                                        std::vector<std::uint32_t>& outIndices,
+                                        std::vector<EdgeVertex>& newVertices) {
+    if (indices.size() < 3) return {};
+
+    const bool strip = meshInfo.ct == ConnectivityType::Strip;
+    if (meshInfo.dt != DrawType::Triangles || (!strip && meshInfo.ct != ConnectivityType::None)) {
+        throw Exception("Cannot clip, need triangle connectivity Strip or None");
+    }
+    const size_t nTriangles = strip ? indices.size() - 2 : indices.size() / 3;
+    const auto triangle = [&](size_t t) -> glm::u32vec3 {
+        if (strip) {
+            return {indices[t], indices[t & 1 ? t + 2 : t + 1], indices[t & 1 ? t + 1 : t + 2]};
+        } else {
+            return {indices[3 * t], indices[3 * t + 1], indices[3 * t + 2]};
+        }
+    };
+
+    // Cut edges are identified by the (sorted) indices of their two vertices. While clipping in
+    // parallel the new vertices are only referred to by their edge keys and resolved afterwards.
+    const auto edgeKey = [](std::uint32_t a, std::uint32_t b) {
+        return a < b ? (std::uint64_t{a} << 32) | b : (std::uint64_t{b} << 32) | a;
+    };
+    struct Chunk {
+        std::vector<std::uint32_t> indices;
+        std::vector<std::pair<size_t, std::uint64_t>> newVertices;  // position in indices, key
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> cuts;
+    };
+
+    constexpr size_t trianglesPerChunk = size_t{1} << 16;
+    std::vector<Chunk> chunks((nTriangles + trianglesPerChunk - 1) / trianglesPerChunk);
+
+    util::parallelFor(
+        0, chunks.size(),
+        [&](size_t c) {
+            auto& chunk = chunks[c];
+            const auto begin = c * trianglesPerChunk;
+            const auto end = std::min(nTriangles, begin + trianglesPerChunk);
+            chunk.indices.reserve(3 * (end - begin));
+
+            for (size_t t = begin; t < end; ++t) {
+                const auto tri = triangle(t);
+                const glm::bvec3 inside{distances[tri[0]] >= 0.0f, distances[tri[1]] >= 0.0f,
+                                        distances[tri[2]] >= 0.0f};
+                if (glm::all(inside)) {  // Unchanged triangle
+                    chunk.indices.insert(chunk.indices.end(), {tri[0], tri[1], tri[2]});
+                    continue;
+                } else if (!glm::any(inside)) {
+                    continue;
+                }
+
+                // Same traversal as in sutherlandHodgman, a vertex is either an existing index
+                // or the key of a cut edge.
+                std::array<std::pair<bool, std::uint64_t>, 4> polygon{};
+                std::array<std::uint64_t, 2> cut{};
+                size_t nPolygon = 0;
+                size_t nCut = 0;
+                for (size_t i = 0; i < 3; ++i) {
+                    const auto j = (i + 1) % 3;
+                    if (inside[i] != inside[j]) {
+                        const auto key = edgeKey(tri[i], tri[j]);
+                        polygon[nPolygon++] = {true, key};
+                        cut[nCut++] = key;
+                    }
+                    if (inside[j]) polygon[nPolygon++] = {false, tri[j]};
+                }
+
+                const auto add = [&](size_t i) {
+                    const auto [isNew, value] = polygon[i];
+                    if (isNew) chunk.newVertices.emplace_back(chunk.indices.size(), value);
+                    chunk.indices.push_back(isNew ? 0 : static_cast<std::uint32_t>(value));
+                };
+                add(0);
+                add(1);
+                add(2);
+                if (nPolygon == 4) {
+                    add(0);
+                    add(2);
+                    add(3);
+                }
+                if (nCut == 2) chunk.cuts.emplace_back(cut[0], cut[1]);
+            }
+        },
+        {.grainSize = 1});
+
+    // Weld, i.e. create one new vertex per cut edge
+    std::unordered_map<std::uint64_t, std::uint32_t> welded;
+    for (auto& chunk : chunks) {
+        for (const auto& [pos, key] : chunk.newVertices) {
+            const auto [it, inserted] = welded.try_emplace(
+                key, firstNewVertex + static_cast<std::uint32_t>(newVertices.size()));
+            if (inserted) {
+                const auto lo = static_cast<std::uint32_t>(key >> 32);
+                const auto hi = static_cast<std::uint32_t>(key & 0xffffffff);
+                newVertices.push_back({lo, hi, distances[lo] / (distances[lo] - distances[hi])});
+            }
+            chunk.indices[pos] = it->second;
+        }
+    }
+
+    std::vector<glm::u32vec2> newEdges;
+    for (const auto& chunk : chunks) {
+        for (const auto& [a, b] : chunk.cuts) {
+            newEdges.emplace_back(welded[a], welded[b]);
+        }
+    }
+
+    std::vector<size_t> offsets(chunks.size() + 1, outIndices.size());
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        offsets[c + 1] = offsets[c] + chunks[c].indices.size();
+    }
+    outIndices.resize(offsets.back());
+    util::parallelFor(
+        0, chunks.size(),
+        [&](size_t c) {
+            std::copy(chunks[c].indices.begin(), chunks[c].indices.end(),
+                      outIndices.begin() + offsets[c]);
+        },
+        {.grainSize = 1});
+
+    return newEdges;
+}
+
 void removeDuplicateEdges(std::vector<glm::u32vec2>& cuts, const std::vector<vec3>& positions,
                           float eps) {
 
@@ -507,65 +636,99 @@ std::shared_ptr<Mesh> clipMeshAgainstPlane(const Mesh& mesh, const Plane& worldS
     clippedMesh->setWorldMatrix(mesh.getWorldMatrix());
     clippedMesh->copyMetaDataFrom(mesh);
 
-    std::vector<detail::InterpolateFunctor> interpolateFunctors;
+    // Each buffer can either add one interpolated vertex at a time or many vertices on cut edges
+    using BulkInterpolateFunctor = std::function<void(const std::vector<detail::EdgeVertex>&)>;
+    std::vector<std::pair<detail::InterpolateFunctor, BulkInterpolateFunctor>> interpolateFunctors;
     std::shared_ptr<BufferRAMPrecision<vec3, BufferTarget::Data>> posBuffer;
 
     for (const auto& item : mesh.getBuffers()) {
         const auto& bufferType = item.first;
         const auto& inBuffer = item.second;
-        auto functor =
-            inBuffer->getRepresentation<BufferRAM>()->dispatch<detail::InterpolateFunctor>(
-                [&clippedMesh, bufferType, &posBuffer](auto inRam) -> detail::InterpolateFunctor {
-                    using PB = util::PrecisionType<decltype(inRam)>;
-                    using ValueType = util::PrecisionValueType<decltype(inRam)>;
-                    using T = typename util::same_extent<ValueType, float>::type;
-
-                    static const auto mix = [](const PB& buffer,
-                                               const std::vector<uint32_t>& indices,
-                                               const std::vector<float>& weights) {
-                        return static_cast<ValueType>(std::inner_product(
-                            indices.begin(), indices.end(), weights.begin(), T{0}, std::plus<T>{},
-                            detail::BufferAccess<PB, T>{buffer}));
-                    };
-                    (void)mix;
-
-                    auto outRam =
-                        std::make_shared<BufferRAMPrecision<ValueType, PB::target>>(*inRam);
-                    auto outBuffer = std::make_shared<Buffer<ValueType, PB::target>>(outRam);
-                    clippedMesh->addBuffer(bufferType, outBuffer);
-
-                    if constexpr (std::is_same_v<ValueType, vec3> &&
-                                  PB::target == BufferTarget::Data) {
-                        if (bufferType == BufferType::NormalAttrib) {
-                            return [outRam](const std::vector<uint32_t>& indices,
-                                            const std::vector<float>& weights,
-                                            std::optional<vec3> normal) {
-                                outRam->add(normal ? *normal : mix(*outRam, indices, weights));
-                                return static_cast<uint32_t>(outRam->getSize() - 1);
-                            };
-                        } else if (bufferType == BufferType::PositionAttrib) {
-                            posBuffer = outRam;
-                        }
-                    }
-
-                    if constexpr (DataFormat<ValueType>::numtype == NumericType::Float) {
-                        return [outRam](const std::vector<uint32_t>& indices,
-                                        const std::vector<float>& weights, std::optional<vec3>) {
-                            outRam->add(mix(*outRam, indices, weights));
-                            return static_cast<uint32_t>(outRam->getSize() - 1);
+        auto functors =
+            inBuffer->getRepresentation<BufferRAM>()
+                ->dispatch<std::pair<detail::InterpolateFunctor, BulkInterpolateFunctor>>(
+                    [&clippedMesh, bufferType, &posBuffer](auto inRam)
+                        -> std::pair<detail::InterpolateFunctor, BulkInterpolateFunctor> {
+                        using PB = util::PrecisionType<decltype(inRam)>;
+                        using ValueType = util::PrecisionValueType<decltype(inRam)>;
+                        using T = typename util::same_extent<ValueType, float>::type;
+
+                        static const auto mix = [](const PB& buffer,
+                                                   const std::vector<uint32_t>& indices,
+                                                   const std::vector<float>& weights) {
+                            return static_cast<ValueType>(std::inner_product(
+                                indices.begin(), indices.end(), weights.begin(), T{0},
+                                std::plus<T>{}, detail::BufferAccess<PB, T>{buffer}));
                         };
-                    } else {  // Only interpolate floating point buffers;
-                        return [outRam](const std::vector<uint32_t>& indices,
-                                        const std::vector<float>& weights, std::optional<vec3>) {
-                            const auto it = std::max_element(weights.begin(), weights.end());
-                            const auto index = std::distance(weights.begin(), it);
-
-                            outRam->add(static_cast<ValueType>((*outRam)[indices[index]]));
-                            return static_cast<uint32_t>(outRam->getSize() - 1);
+                        (void)mix;
+
+                        auto outRam =
+                            std::make_shared<BufferRAMPrecision<ValueType, PB::target>>(*inRam);
+                        auto outBuffer = std::make_shared<Buffer<ValueType, PB::target>>(outRam);
+                        clippedMesh->addBuffer(bufferType, outBuffer);
+
+                        // Append the vertices on cut edges in parallel
+                        const auto bulk = [outRam](
+                                              const std::vector<detail::EdgeVertex>& vertices) {
+                            auto& data = outRam->getDataContainer();
+                            const auto offset = data.size();
+                            data.resize(offset + vertices.size());
+                            util::parallelFor(
+                                0, vertices.size(),
+                                [&](size_t i) {
+                                    const auto& v = vertices[i];
+                                    if constexpr (DataFormat<ValueType>::numtype ==
+                                                  NumericType::Float) {
+                                        data[offset + i] = static_cast<ValueType>(
+                                            static_cast<T>(data[v.lo]) * (1.0f - v.weight) +
+                                            static_cast<T>(data[v.hi]) * v.weight);
+                                    } else {
+                                        data[offset + i] = data[v.weight <= 0.5f ? v.lo : v.hi];
+                                    }
+                                },
+                                {.grainSize = 4096});
                         };
-                    }
-                });
-        interpolateFunctors.push_back(functor);
+
+                        if constexpr (std::is_same_v<ValueType, vec3> &&
+                                      PB::target == BufferTarget::Data) {
+                            if (bufferType == BufferType::NormalAttrib) {
+                                return {[outRam](const std::vector<uint32_t>& indices,
+                                                 const std::vector<float>& weights,
+                                                 std::optional<vec3> normal) {
+                                            outRam->add(normal ? *normal
+                                                               : mix(*outRam, indices, weights));
+                                            return static_cast<uint32_t>(outRam->getSize() - 1);
+                                        },
+                                        bulk};
+                            } else if (bufferType == BufferType::PositionAttrib) {
+                                posBuffer = outRam;
+                            }
+                        }
+
+                        if constexpr (DataFormat<ValueType>::numtype == NumericType::Float) {
+                            return {[outRam](const std::vector<uint32_t>& indices,
+                                             const std::vector<float>& weights,
+                                             std::optional<vec3>) {
+                                        outRam->add(mix(*outRam, indices, weights));
+                                        return static_cast<uint32_t>(outRam->getSize() - 1);
+                                    },
+                                    bulk};
+                        } else {  // Only interpolate floating point buffers;
+                            return {[outRam](const std::vector<uint32_t>& indices,
+                                             const std::vector<float>& weights,
+                                             std::optional<vec3>) {
+                                        const auto it =
+                                            std::max_element(weights.begin(), weights.end());
+                                        const auto index = std::distance(weights.begin(), it);
+
+                                        outRam->add(
+                                            static_cast<ValueType>((*outRam)[indices[index]]));
+                                        return static_cast<uint32_t>(outRam->getSize() - 1);
+                                    },
+                                    bulk};
+                        }
+                    });
+        interpolateFunctors.push_back(functors);
     }
 
     const detail::InterpolateFunctor addInterpolatedVertex =
@@ -573,7 +736,7 @@ std::shared_ptr<Mesh> clipMeshAgainstPlane(const Mesh& mesh, const Plane& worldS
                                const std::vector<float>& weights,
                                std::optional<vec3> normal) -> uint32_t {
         uint32_t res = 0;
-        for (auto& fun : interpolateFunctors) res = fun(indices, weights, normal);
+        for (auto& fun : interpolateFunctors) res = fun.first(indices, weights, normal);
         return res;
     };
 
@@ -584,22 +747,50 @@ std::shared_ptr<Mesh> clipMeshAgainstPlane(const Mesh& mesh, const Plane& worldS
     const auto& positions = posBuffer->getDataContainer();
     std::vector<glm::u32vec2> newEdges;
 
-    for (const auto& item : mesh.getIndexBuffers()) {
-        const auto meshInfo = item.first;
-        const auto indexBuffer = item.second;
-        const auto& indices = indexBuffer->getRAMRepresentation()->getDataContainer();
+    // The signed distance of all the original vertices, only needed for triangles
+    const auto distances = [&]() {
+        std::vector<float> res;
+        const auto isTriangles = [](const Mesh::MeshInfo& info) {
+            return info.dt == DrawType::Triangles && (info.ct == ConnectivityType::None ||
+                                                      info.ct == ConnectivityType::Strip);
+        };
+        if (!isTriangles(mesh.getDefaultMeshInfo()) &&
+            std::none_of(mesh.getIndexBuffers().begin(), mesh.getIndexBuffers().end(),
+                         [&](const auto& item) { return isTriangles(item.first); })) {
+            return res;
+        }
+        res.resize(positions.size());
+        util::parallelFor(
+            0, positions.size(), [&](size_t i) { res[i] = plane.distance(positions[i]); },
+            {.grainSize = 1 << 16});
+        return res;
+    }();
 
-        auto edges = detail::clipIndices(meshInfo, clippedMesh, indices, plane, positions,
-                                         addInterpolatedVertex);
-        newEdges.insert(newEdges.end(), edges.begin(), edges.end());
+    const auto clip = [&](const Mesh::MeshInfo& meshInfo, const std::vector<uint32_t>& indices) {
+        if (meshInfo.dt == DrawType::Triangles && (meshInfo.ct == ConnectivityType::None ||
+                                                   meshInfo.ct == ConnectivityType::Strip)) {
+            auto outIndices =
+                clippedMesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::None);
+            std::vector<detail::EdgeVertex> vertices;
+            auto edges = detail::clipTriangles(meshInfo, indices, distances,
+                                               static_cast<std::uint32_t>(positions.size()),
+                                               outIndices->getDataContainer(), vertices);
+            for (auto& fun : interpolateFunctors) fun.second(vertices);
+            newEdges.insert(newEdges.end(), edges.begin(), edges.end());
+        } else {
+            auto edges = detail::clipIndices(meshInfo, clippedMesh, indices, plane, positions,
+                                             addInterpolatedVertex);
+            newEdges.insert(newEdges.end(), edges.begin(), edges.end());
+        }
+    };
+
+    for (const auto& item : mesh.getIndexBuffers()) {
+        clip(item.first, item.second->getRAMRepresentation()->getDataContainer());
     }
     if (mesh.getIndexBuffers().empty()) {
-        const auto meshInfo = mesh.getDefaultMeshInfo();
         std::vector<uint32_t> indices(mesh.getBuffer(0)->getSize());
         std::iota(indices.begin(), indices.end(), 0);
-        auto edges = detail::clipIndices(meshInfo, clippedMesh, indices, plane, positions,
-                                         addInterpolatedVertex);
-        newEdges.insert(newEdges.end(), edges.begin(), edges.end());
+        clip(mesh.getDefaultMeshInfo(), indices);
     }
 
     if (capClippedHoles && !newEdges.empty()) {
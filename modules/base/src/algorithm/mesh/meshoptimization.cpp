@@ -0,0 +1,259 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/algorithm/mesh/meshoptimization.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>          // for IndexBuffer
+#include <inviwo/core/datastructures/buffer/bufferram.h>       // for BufferRAM
+#include <inviwo/core/datastructures/geometry/geometrytype.h>  // for ConnectivityType, DrawType
+#include <inviwo/core/datastructures/geometry/mesh.h>          // for Mesh
+#include <inviwo/core/util/exception.h>                        // for Exception
+
+#include <algorithm>    // for max_element, find
+#include <array>        // for array
+#include <cmath>        // for pow, sqrt
+#include <limits>       // for numeric_limits
+#include <type_traits>  // for remove_cvref_t
+
+namespace inviwo {
+
+namespace meshutil {
+
+namespace {
+
+// Scoring constants from Tom Forsyth, "Linear-Speed Vertex Cache Optimisation"
+constexpr float cacheDecayPower = 1.5f;
+constexpr float lastTriangleScore = 0.75f;
+constexpr float valenceBoostScale = 2.0f;
+
+float vertexScore(int cachePosition, std::uint32_t remaining, size_t cacheSize) {
+    // A vertex without remaining triangles will never be used again
+    if (remaining == 0) return -1.0f;
+
+    float score = 0.0f;
+    if (cachePosition >= 3) {
+        const auto scale = 1.0f / static_cast<float>(cacheSize - 3);
+        score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scale, cacheDecayPower);
+    } else if (cachePosition >= 0) {
+        // The vertices of the last triangle, using them again right away does not help as much
+        score = lastTriangleScore;
+    }
+    // Prefer vertices with few remaining triangles to get rid of lone triangles early
+    return score + valenceBoostScale / std::sqrt(static_cast<float>(remaining));
+}
+
+}  // namespace
+
+std::vector<std::uint32_t> optimizeVertexCache(std::span<const std::uint32_t> indices,
+                                               size_t vertexCount, size_t cacheSize) {
+    cacheSize = std::max<size_t>(cacheSize, 4);
+    const size_t triangleCount = indices.size() / 3;
+
+    // The triangles using each vertex, the remaining ones are kept first in each range
+    std::vector<std::uint32_t> remaining(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+        if (indices[i] >= vertexCount) {
+            throw Exception(SourceContext{}, "Index {} out of range, the vertex count is {}",
+                            indices[i], vertexCount);
+        }
+        ++remaining[indices[i]];
+    }
+    std::vector<size_t> offsets(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        offsets[v + 1] = offsets[v] + remaining[v];
+    }
+    std::vector<std::uint32_t> triangles(triangleCount * 3);
+    {
+        std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < triangleCount * 3; ++i) {
+            triangles[fill[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+        }
+    }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScores(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        vertexScores[v] = vertexScore(-1, remaining[v], cacheSize);
+    }
+
+    const auto triangleScore = [&](size_t t) {
+        return vertexScores[indices[3 * t]] + vertexScores[indices[3 * t + 1]] +
+               vertexScores[indices[3 * t + 2]];
+    };
+
+    std::vector<float> triangleScores(triangleCount);
+    std::vector<bool> added(triangleCount, false);
+    size_t best = std::numeric_limits<size_t>::max();
+    float bestScore = -1.0f;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        triangleScores[t] = triangleScore(t);
+        if (triangleScores[t] > bestScore) {
+            bestScore = triangleScores[t];
+            best = t;
+        }
+    }
+
+    std::vector<std::uint32_t> result;
+    result.reserve(triangleCount * 3);
+    std::vector<std::uint32_t> cache;
+    std::vector<std::uint32_t> newCache;
+    cache.reserve(cacheSize + 3);
+    newCache.reserve(cacheSize + 3);
+    size_t cursor = 0;
+
+    for (size_t n = 0; n < triangleCount; ++n) {
+        if (best == std::numeric_limits<size_t>::max()) {
+            // None of the vertices in the cache has any triangles left, take the next one in
+            // the input order
+            while (added[cursor]) ++cursor;
+            best = cursor;
+        }
+
+        const size_t t = best;
+        added[t] = true;
+        const std::array<std::uint32_t, 3> tri{indices[3 * t], indices[3 * t + 1],
+                                               indices[3 * t + 2]};
+        result.insert(result.end(), tri.begin(), tri.end());
+
+        newCache.clear();
+        for (const auto v : tri) {
+            if (std::find(newCache.begin(), newCache.end(), v) != newCache.end()) continue;
+            newCache.push_back(v);
+
+            const auto first = triangles.begin() + offsets[v];
+            const auto last = first + remaining[v];
+            std::iter_swap(std::find(first, last, static_cast<std::uint32_t>(t)), last - 1);
+            --remaining[v];
+        }
+        for (const auto v : cache) {
+            if (std::find(tri.begin(), tri.end(), v) == tri.end()) newCache.push_back(v);
+        }
+
+        // Vertices pushed out of the cache also need their score updated
+        for (size_t i = 0; i < newCache.size(); ++i) {
+            const auto v = newCache[i];
+            cachePosition[v] = i < cacheSize ? static_cast<int>(i) : -1;
+            vertexScores[v] = vertexScore(cachePosition[v], remaining[v], cacheSize);
+        }
+
+        best = std::numeric_limits<size_t>::max();
+        bestScore = -1.0f;
+        for (const auto v : newCache) {
+            for (size_t i = offsets[v]; i < offsets[v] + remaining[v]; ++i) {
+                const auto candidate = triangles[i];
+                triangleScores[candidate] = triangleScore(candidate);
+                if (triangleScores[candidate] > bestScore) {
+                    bestScore = triangleScores[candidate];
+                    best = candidate;
+                }
+            }
+        }
+
+        newCache.resize(std::min(newCache.size(), cacheSize));
+        std::swap(cache, newCache);
+    }
+
+    return result;
+}
+
+double averageCacheMissRatio(std::span<const std::uint32_t> indices, size_t cacheSize) {
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) return 0.0;
+
+    const size_t vertexCount = *std::max_element(indices.begin(), indices.end()) + size_t{1};
+    // The miss count when each vertex last entered the cache, zero if it never did
+    std::vector<size_t> entered(vertexCount, 0);
+    size_t misses = 0;
+    for (const auto v : indices.first(triangleCount * 3)) {
+        if (entered[v] == 0 || misses - entered[v] >= cacheSize) {
+            entered[v] = ++misses;
+        }
+    }
+    return static_cast<double>(misses) / static_cast<double>(triangleCount);
+}
+
+std::unique_ptr<Mesh> optimizeVertexOrder(const Mesh& mesh) {
+    auto res = std::unique_ptr<Mesh>(mesh.clone());
+    if (res->getNumberOfBuffers() == 0 || res->getNumberOfIndicies() == 0) return res;
+
+    const size_t vertexCount = res->getBuffer(0)->getSize();
+    for (const auto& [info, buffer] : res->getBuffers()) {
+        if (buffer->getSize() != vertexCount) {
+            throw Exception(SourceContext{},
+                            "All vertex buffers must have the same size, found {} and {}",
+                            vertexCount, buffer->getSize());
+        }
+    }
+
+    for (const auto& [info, indexBuffer] : res->getIndexBuffers()) {
+        if (info.dt == DrawType::Triangles && info.ct == ConnectivityType::None) {
+            auto& indices = indexBuffer->getEditableRAMRepresentation()->getDataContainer();
+            indices = optimizeVertexCache(indices, vertexCount);
+        }
+    }
+
+    // Number the vertices in the order they are first used
+    constexpr auto unused = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint32_t> remap(vertexCount, unused);
+    std::uint32_t next = 0;
+    for (const auto& [info, indexBuffer] : res->getIndexBuffers()) {
+        for (const auto i : indexBuffer->getRAMRepresentation()->getDataContainer()) {
+            if (i >= vertexCount) {
+                throw Exception(SourceContext{}, "Index {} out of range, the vertex count is {}",
+                                i, vertexCount);
+            }
+            if (remap[i] == unused) remap[i] = next++;
+        }
+    }
+    for (auto& i : remap) {
+        if (i == unused) i = next++;
+    }
+
+    for (const auto& [info, indexBuffer] : res->getIndexBuffers()) {
+        for (auto& i : indexBuffer->getEditableRAMRepresentation()->getDataContainer()) {
+            i = remap[i];
+        }
+    }
+    for (const auto& [info, buffer] : res->getBuffers()) {
+        buffer->getEditableRepresentation<BufferRAM>()->dispatch<void>([&](auto br) {
+            auto& data = br->getDataContainer();
+            std::remove_cvref_t<decltype(data)> permuted(data.size());
+            for (size_t v = 0; v < data.size(); ++v) {
+                permuted[remap[v]] = data[v];
+            }
+            data.swap(permuted);
+        });
+    }
+
+    return res;
+}
+
+}  // namespace meshutil
+
+}  // namespace inviwo
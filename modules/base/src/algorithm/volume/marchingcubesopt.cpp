@@ -38,11 +38,15 @@
 #include <inviwo/core/datastructures/volume/volume.h>                   // IWYU pragma: keep
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
 #include <inviwo/core/util/assertion.h>                                 // for IVW_ASSERT
+#include <inviwo/core/util/exception.h>                                 // for Exception
 #include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
 #include <inviwo/core/util/glmconvert.h>                                // for glm_convert
+#include <inviwo/core/util/glmfmt.h>                                    // IWYU pragma: keep
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, vec4
 #include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 #include <inviwo/core/util/stdextensions.h>                             // for make_array, contains
+#include <inviwo/core/util/threadutil.h>                                // for getPoolSize
 #include <modules/base/algorithm/volume/surfaceextraction.h>            // for encloseSurfce
 #include <modules/base/datastructures/disjointsets.h>                   // for DisjointSets
 
@@ -50,14 +54,18 @@
 #include <bitset>         // for bitset, __bitset<...
 #include <cstdint>        // for uint32_t
 #include <iterator>       // for distance, back_in...
+#include <limits>         // for numeric_limits
+#include <mutex>          // for mutex, scoped_lock
+#include <ranges>         // for sort, transform
 #include <type_traits>    // for remove_extent_t
 #include <unordered_set>  // for unordered_set
 #include <utility>        // for pair
+#include <vector>         // for vector
 
 #include <glm/common.hpp>                // for max
 #include <glm/ext/scalar_constants.hpp>  // for epsilon
 #include <glm/geometric.hpp>             // for normalize, cross
-#include <glm/gtx/component_wise.hpp>    // for compAdd
+#include <glm/gtx/component_wise.hpp>    // for compAdd, compMul
 #include <glm/gtx/norm.hpp>              // for length2
 #include <glm/gtx/normal.hpp>            // for triangleNormal
 #include <glm/vec2.hpp>                  // for vec<>::(anonymous)
@@ -270,7 +278,7 @@ class VCache {
 public:
     enum CacheName { xCacheCurr, xCacheNext, yCacheCurr, yCacheNext, zCacheCurr, zCacheNext };
     enum CachePosName { xCurr0, xCurr1, xNext0, xNext1, yCurr, yNext, zCurr, zNext };
-    VCache(const size2_t& dim) : cIm{dim} {
+    VCache(const size2_t& dim, size_t zStart) : cIm{dim}, zStart_{zStart} {
         cache[xCacheCurr].resize(dim.x * dim.y);
         cache[xCacheNext].resize(dim.x * dim.y);
         cache[yCacheCurr].resize(dim.x * dim.y);
@@ -282,28 +290,28 @@ public:
     std::pair<size_t, bool> find(const size3_t& ind, int edge, const size_t& val) {
         switch (edge) {
             case 0:
-                if (ind.z == 0 && ind.y == 0) {
+                if (ind.z == zStart_ && ind.y == 0) {
                     cache[xCacheCurr][cIm(pos[xCurr0], ind.y)] = val;
                     return {val, true};
                 } else {
                     return {cache[xCacheCurr][cIm(pos[xCurr0], ind.y)], false};
                 }
             case 1:
-                if (ind.z == 0) {
+                if (ind.z == zStart_) {
                     cache[yCacheCurr][cIm(pos[yCurr] + 1, ind.y)] = val;
                     return {val, true};
                 } else {
                     return {cache[yCacheCurr][cIm(pos[yCurr] + 1, ind.y)], false};
                 }
             case 2:
-                if (ind.z == 0) {
+                if (ind.z == zStart_) {
                     cache[xCacheCurr][cIm(pos[xCurr1], ind.y + 1)] = val;
                     return {val, true};
                 } else {
                     return {cache[xCacheCurr][cIm(pos[xCurr1], ind.y + 1)], false};
                 }
             case 3:
-                if (ind.z == 0 && ind.x == 0) {
+                if (ind.z == zStart_ && ind.x == 0) {
                     cache[yCacheCurr][cIm(pos[yCurr], ind.y)] = val;
                     return {val, true};
                 } else {
@@ -381,87 +389,138 @@ public:
 
 private:
     util::IndexMapper2D cIm;
+    size_t zStart_;
     std::array<std::vector<size_t>, 6> cache;
     std::array<size_t, 8> pos;
 };
 
-struct OffsetIndexMasks {
-    OffsetIndexMasks(int next, int curr, size3_t off)
-        : nextMask{next}, currMask{curr}, offset{off} {}
-    const int nextMask;
-    const int currMask;
-    const size3_t offset;
-};
-
+/**
+ * Evaluate the iso test for a whole z layer of the volume. Kept as a plain loop over contiguous
+ * memory without any branches such that the compiler can vectorize it.
+ */
 template <typename T, typename IsoTest>
+void classify(const T* src, size_t size, const IsoTest& test, unsigned char* dst) {
+    for (size_t i = 0; i < size; ++i) {
+        dst[i] = static_cast<unsigned char>(test(src[i]));
+    }
+}
+
+/**
+ * Computes the case index of consecutive cells along a row from two classified z layers, the
+ * corners shared with the previous cell are reused.
+ */
 class Index {
 public:
-    Index(const T* src, const util::IndexMapper3D& im, const IsoTest& test)
-        : offsets0_{[&]() {
-            std::array<size_t, 4> tmp;
-            std::transform(oim_.begin(), oim_.end(), tmp.begin(),
-                           [&](const auto& item) { return im(item.offset); });
-            return tmp;
-        }()}
-        , offsets1_{[&]() {
-            std::array<size_t, 4> tmp;
-            std::transform(oim_.begin(), oim_.end(), tmp.begin(), [&](const auto& item) {
-                return im(item.offset + size3_t{1, 0, 0});
-            });
-            return tmp;
-        }()}
-        , src_{src}
-        , test_{test} {}
-
-    void init(const size_t& gridIndex) {
-        int next = 0;
-        for (int v = 0; v < 4; ++v) {
-            const auto val = src_[gridIndex + offsets0_[v]];
-            if (test_(val)) {
-                next |= 1 << oim_[v].nextMask;
-            }
-        }
-        next_ = next;
+    explicit Index(size_t dimX) : dimX_{dimX} {}
+
+    void init(const unsigned char* lower, const unsigned char* upper, size_t x) {
+        lower_ = lower;
+        upper_ = upper;
+        next_ = lower_[x] | lower_[x + dimX_] << 3 | upper_[x] << 4 | upper_[x + dimX_] << 7;
     }
 
-    void update(const size_t& gridIndex) {
-        int curr = next_;
-        int next = 0;
-        for (int v = 0; v < 4; ++v) {
-            const auto val = src_[gridIndex + offsets1_[v]];
-            if (test_(val)) {
-                next |= 1 << oim_[v].nextMask;
-                curr |= 1 << oim_[v].currMask;
-            }
-        }
-        next_ = next;
-        curr_ = curr;
+    void update(size_t x) {
+        const int l0 = lower_[x + 1];
+        const int l1 = lower_[x + 1 + dimX_];
+        const int u0 = upper_[x + 1];
+        const int u1 = upper_[x + 1 + dimX_];
+        curr_ = next_ | l0 << 1 | l1 << 2 | u0 << 5 | u1 << 6;
+        next_ = l0 | l1 << 3 | u0 << 4 | u1 << 7;
     }
 
-    operator size_t() { return curr_; }
+    operator size_t() const { return curr_; }
 
 private:
-    static const std::array<OffsetIndexMasks, 4> oim_;
-    const std::array<size_t, 4> offsets0_;
-    const std::array<size_t, 4> offsets1_;
-
-    const T* src_;
-    const IsoTest& test_;
-    int next_;
-    int curr_;
+    size_t dimX_;
+    const unsigned char* lower_ = nullptr;
+    const unsigned char* upper_ = nullptr;
+    int next_ = 0;
+    int curr_ = 0;
 };
 
-template <typename T, typename IsoTest>
-const std::array<OffsetIndexMasks, 4> Index<T, IsoTest>::oim_ = {
-    {{0, 1, {0, 0, 0}}, {3, 2, {0, 1, 0}}, {4, 5, {0, 0, 1}}, {7, 6, {0, 1, 1}}}};
+/**
+ * Key identifying the vertex on a cell edge in the bottom (edges 0-3) or top (edges 8-11) plane
+ * of a cell, used to find the vertices shared between two slabs.
+ */
+size_t planeKey(const size3_t& ind, int edge, size_t dimX) {
+    // x offset, y offset, and direction of the edge
+    static constexpr std::array<std::array<size_t, 3>, 4> planeEdges{
+        {{0, 0, 0}, {1, 0, 1}, {0, 1, 0}, {0, 0, 1}}};
+    const auto& e = planeEdges[edge & 3];
+    return ((ind.y + e[1]) * dimX + ind.x + e[0]) * 2 + e[2];
+}
+
+/**
+ * The part of the surface extracted from a range of z layers. The vertices on the first and last
+ * plane of the slab are shared with the neighbouring slabs and are welded when merging.
+ */
+struct Slab {
+    std::vector<vec3> positions;
+    std::vector<vec3> normals;
+    std::vector<uint32_t> indices;
+    // plane key and local vertex index of the vertices on the first and last plane
+    std::vector<std::pair<size_t, uint32_t>> bottom;
+    std::vector<std::pair<size_t, uint32_t>> top;
+    // local vertex index and the index of the matching vertex in the previous slab
+    std::vector<std::pair<uint32_t, uint32_t>> welds;
+    std::vector<uint32_t> remap;
+    size_t vertexOffset = 0;
+    size_t indexOffset = 0;
+};
 
 }  // namespace
 
+namespace marching {
+
+BlockRanges::BlockRanges(const VolumeRAM& volume)
+    : dimensions_{volume.getDimensions()}
+    , blocks_{(dimensions_ - size3_t{1} + size3_t{blockSize - 1}) / size3_t{blockSize}}
+    , ranges_(glm::compMul(blocks_)) {
+
+    volume.dispatch<void, dispatching::filter::Scalars>([&](auto ram) {
+        const auto* src = ram->getDataTyped();
+        const util::IndexMapper3D im(dimensions_);
+
+        // Block b holds cells [b * blockSize, (b + 1) * blockSize), i.e. the voxels up to and
+        // including (b + 1) * blockSize
+        util::parallelFor(0, blocks_.z, [&](size_t bz) {
+            for (size_t by = 0; by < blocks_.y; ++by) {
+                for (size_t bx = 0; bx < blocks_.x; ++bx) {
+                    const size3_t block{bx, by, bz};
+                    const auto lower = glm::min(block * blockSize, dimensions_ - size3_t{1});
+                    const auto upper =
+                        glm::min(block * blockSize + size3_t{blockSize}, dimensions_ - size3_t{1});
+                    auto min = src[im(lower)];
+                    auto max = min;
+                    for (size_t z = lower.z; z <= upper.z; ++z) {
+                        for (size_t y = lower.y; y <= upper.y; ++y) {
+                            const auto* row = src + im(lower.x, y, z);
+                            for (size_t x = 0; x <= upper.x - lower.x; ++x) {
+                                min = std::min(min, row[x]);
+                                max = std::max(max, row[x]);
+                            }
+                        }
+                    }
+                    ranges_[(bz * blocks_.y + by) * blocks_.x + bx] = {
+                        util::glm_convert<double>(min), util::glm_convert<double>(max)};
+                }
+            }
+        });
+    });
+}
+
+}  // namespace marching
+
 namespace util {
 std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, double iso,
                                        const vec4& color, bool invert, bool enclose,
                                        std::function<void(float)> progressCallback,
-                                       std::function<bool(const size3_t&)> maskingCallback) {
+                                       std::function<bool(const size3_t&)> maskingCallback,
+                                       const marching::BlockRanges* blockRanges) {
+    if (blockRanges && blockRanges->getDimensions() != volume->getDimensions()) {
+        throw Exception(SourceContext{}, "Block ranges computed for a volume of size {}, got {}",
+                        blockRanges->getDimensions(), volume->getDimensions());
+    }
 
     auto indexBuffer = std::make_shared<IndexBuffer>();
     auto vertexBuffer = std::make_shared<Buffer<vec3>>();
@@ -510,54 +569,204 @@ std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, dou
             return r0 + t * (r1 - r0);
         };
 
-        VCache vcache(size2_t{dim.x, dim.y});
-        Index<T, decltype(isoTest)> index(src, im, isoTest);
-        size3_t ind;
-        dvec3 pos;
-
         const float err =
             static_cast<float>(4.0 * glm::epsilon<double>() * glm::epsilon<double>() * dr.x * dr.y);
 
-        for (ind.z = 0, pos.z = 0.0; ind.z < dim1.z; ++ind.z, pos.z += dr.z) {
-            vcache.incZ();
-            for (ind.y = 0, pos.y = 0.0; ind.y < dim1.y; ++ind.y, pos.y += dr.y) {
-                ind.x = 0;
-                const auto cInd = im(ind);
-                vcache.incY();
-                index.init(cInd);
-                for (pos.x = 0.0; ind.x < dim1.x; ++ind.x, pos.x += dr.x) {
-                    index.update(cInd + ind.x);
-                    if (index == 0 || index == 255) continue;
-                    if (maskingCallback && !maskingCallback(ind)) continue;
-
-                    std::array<size_t, 12> inds;
-                    for (const auto edge : cube.caseEdges[index]) {
-                        const auto c = vcache.find(ind, edge, positions.size());
-                        inds[edge] = c.first;
-                        if (c.second) {
-                            const auto vertex = interpolate(ind, pos, edge);
-                            positions.emplace_back(vertex);
-                            normals.emplace_back(0.0f, 0.0f, 0.0f);
-                        }
+        // Split the volume into slabs of z layers that are extracted in parallel.
+        const size_t layerSize = dim.x * dim.y;
+        const size_t jobs = 4 * std::max<size_t>(1, util::getPoolSize());
+        const size_t slabSize = std::max<size_t>(8, (dim1.z + jobs - 1) / jobs);
+        std::vector<Slab> slabs((dim1.z + slabSize - 1) / slabSize);
+
+        std::mutex progressMutex;
+        size_t layersDone = 0;
+        const auto reportProgress = [&]() {
+            if (!progressCallback) return;
+            const std::scoped_lock lock{progressMutex};
+            ++layersDone;
+            progressCallback(static_cast<float>(layersDone) / static_cast<float>(dim.z - 1));
+        };
+
+        // Flag the blocks of cells that might intersect the iso surface, and the rows and layers
+        // of blocks that have any such block. Without block ranges every block is visited.
+        const size_t blockSize = marching::BlockRanges::blockSize;
+        const size3_t blocks = (dim1 + size3_t{blockSize - 1}) / size3_t{blockSize};
+        std::vector<char> activeBlocks(glm::compMul(blocks), 1);
+        std::vector<char> activeRows(blocks.y * blocks.z, 1);
+        std::vector<char> activeLayers(blocks.z, 1);
+        if (blockRanges) {
+            const auto tiso = util::glm_convert<double>(util::glm_convert<T>(iso));
+            const util::IndexMapper3D bim(blocks);
+            for (size_t z = 0; z < blocks.z; ++z) {
+                activeLayers[z] = 0;
+                for (size_t y = 0; y < blocks.y; ++y) {
+                    activeRows[z * blocks.y + y] = 0;
+                    for (size_t x = 0; x < blocks.x; ++x) {
+                        const bool active = blockRanges->contains(size3_t{x, y, z}, tiso);
+                        activeBlocks[bim(x, y, z)] = active;
+                        activeRows[z * blocks.y + y] |= active;
+                        activeLayers[z] |= active;
                     }
-                    for (const auto& tri : cube.caseTriangles[index]) {
-                        const auto side0 = positions[inds[tri[1]]] - positions[inds[tri[0]]];
-                        const auto side1 = positions[inds[tri[2]]] - positions[inds[tri[0]]];
-                        auto n = glm::cross(side0, side1);
-                        if (glm::length2(n) < err) {
-                            continue;  // triangle is so small area is 0.
+                }
+            }
+        }
+
+        const auto extract = [&](size_t slabIndex) {
+            auto& slab = slabs[slabIndex];
+            const size_t zStart = slabIndex * slabSize;
+            const size_t zEnd = std::min(zStart + slabSize, dim1.z);
+            const bool weldBottom = zStart != 0;
+            const bool weldTop = zEnd != dim1.z;
+
+            VCache vcache(size2_t{dim.x, dim.y}, zStart);
+            Index index{dim.x};
+            std::vector<unsigned char> lower(layerSize);
+            std::vector<unsigned char> upper(layerSize);
+            size_t upperZ = std::numeric_limits<size_t>::max();
+
+            // Skipped cells can not have any vertices, hence the caches are still valid for the
+            // next processed cell even though they are not updated for the skipped ones.
+            size3_t ind;
+            dvec3 pos;
+            for (ind.z = zStart; ind.z < zEnd; ++ind.z) {
+                const size_t bz = ind.z / blockSize;
+                if (!activeLayers[bz]) {
+                    reportProgress();
+                    continue;
+                }
+                pos.z = static_cast<double>(ind.z) * dr.z;
+                if (upperZ == ind.z) {
+                    std::swap(lower, upper);
+                } else {
+                    classify(src + ind.z * layerSize, layerSize, isoTest, lower.data());
+                }
+                classify(src + (ind.z + 1) * layerSize, layerSize, isoTest, upper.data());
+                upperZ = ind.z + 1;
+                vcache.incZ();
+                for (ind.y = 0; ind.y < dim1.y; ++ind.y) {
+                    const size_t by = ind.y / blockSize;
+                    if (!activeRows[bz * blocks.y + by]) continue;
+                    pos.y = static_cast<double>(ind.y) * dr.y;
+                    vcache.incY();
+                    const auto* lowerRow = lower.data() + ind.y * dim.x;
+                    const auto* upperRow = upper.data() + ind.y * dim.x;
+                    for (ind.x = 0; ind.x < dim1.x;) {
+                        const size_t bx = ind.x / blockSize;
+                        const size_t xEnd = std::min((bx + 1) * blockSize, dim1.x);
+                        if (!activeBlocks[(bz * blocks.y + by) * blocks.x + bx]) {
+                            ind.x = xEnd;
+                            continue;
                         }
-                        n = glm::normalize(n);
-                        for (int v = 0; v < 3; ++v) {
-                            indices.push_back(static_cast<uint32_t>(inds[tri[v]]));
-                            normals[inds[tri[v]]] += n;
+                        index.init(lowerRow, upperRow, ind.x);
+                        for (; ind.x < xEnd; ++ind.x) {
+                            pos.x = static_cast<double>(ind.x) * dr.x;
+                            index.update(ind.x);
+                            if (index == 0 || index == 255) continue;
+                            if (maskingCallback && !maskingCallback(ind)) continue;
+
+                            std::array<size_t, 12> inds;
+                            for (const auto edge : cube.caseEdges[index]) {
+                                const auto c = vcache.find(ind, edge, slab.positions.size());
+                                inds[edge] = c.first;
+                                if (c.second) {
+                                    const auto local = static_cast<uint32_t>(slab.positions.size());
+                                    if (weldBottom && edge < 4 && ind.z == zStart) {
+                                        slab.bottom.emplace_back(planeKey(ind, edge, dim.x), local);
+                                    } else if (weldTop && edge >= 8 && ind.z + 1 == zEnd) {
+                                        slab.top.emplace_back(planeKey(ind, edge, dim.x), local);
+                                    }
+                                    const auto vertex = interpolate(ind, pos, edge);
+                                    slab.positions.emplace_back(vertex);
+                                    slab.normals.emplace_back(0.0f, 0.0f, 0.0f);
+                                }
+                            }
+                            for (const auto& tri : cube.caseTriangles[index]) {
+                                const auto& p0 = slab.positions[inds[tri[0]]];
+                                const auto side0 = slab.positions[inds[tri[1]]] - p0;
+                                const auto side1 = slab.positions[inds[tri[2]]] - p0;
+                                auto n = glm::cross(side0, side1);
+                                if (glm::length2(n) < err) {
+                                    continue;  // triangle is so small area is 0.
+                                }
+                                n = glm::normalize(n);
+                                for (int v = 0; v < 3; ++v) {
+                                    slab.indices.push_back(static_cast<uint32_t>(inds[tri[v]]));
+                                    slab.normals[inds[tri[v]]] += n;
+                                }
+                            }
+                            vcache.incX(cube.caseIncrements[index]);
                         }
                     }
-                    vcache.incX(cube.caseIncrements[index]);
+                }
+                reportProgress();
+            }
+        };
+        util::parallelFor(0, slabs.size(), extract, {.grainSize = 1});
+
+        // Match the vertices on the first plane of each slab with the ones on the last plane of
+        // the previous slab, and find where each slab ends up in the merged buffers.
+        size_t nVertices = 0;
+        size_t nIndices = 0;
+        for (size_t s = 0; s < slabs.size(); ++s) {
+            auto& slab = slabs[s];
+            if (s > 0) {
+                auto& prev = slabs[s - 1];
+                std::ranges::sort(prev.top);
+                std::ranges::sort(slab.bottom);
+                auto it = prev.top.begin();
+                for (const auto& [key, local] : slab.bottom) {
+                    it = std::lower_bound(it, prev.top.end(), std::pair{key, uint32_t{0}});
+                    if (it != prev.top.end() && it->first == key) {
+                        slab.welds.emplace_back(local, it->second);
+                    }
                 }
             }
-            if (progressCallback) {
-                progressCallback(static_cast<float>(ind.z + 1) / static_cast<float>(dim.z - 1));
+            slab.vertexOffset = nVertices;
+            slab.indexOffset = nIndices;
+            nVertices += slab.positions.size() - slab.welds.size();
+            nIndices += slab.indices.size();
+        }
+
+        positions.resize(nVertices);
+        normals.resize(nVertices);
+        indices.resize(nIndices);
+
+        static constexpr auto welded = std::numeric_limits<uint32_t>::max();
+        util::parallelFor(
+            0, slabs.size(),
+            [&](size_t s) {
+                auto& slab = slabs[s];
+                slab.remap.assign(slab.positions.size(), 0);
+                for (const auto& weld : slab.welds) {
+                    slab.remap[weld.first] = welded;
+                }
+                auto next = static_cast<uint32_t>(slab.vertexOffset);
+                for (size_t i = 0; i < slab.positions.size(); ++i) {
+                    if (slab.remap[i] == welded) continue;
+                    slab.remap[i] = next;
+                    positions[next] = slab.positions[i];
+                    normals[next] = slab.normals[i];
+                    ++next;
+                }
+            },
+            {.grainSize = 1});
+
+        util::parallelFor(
+            0, slabs.size(),
+            [&](size_t s) {
+                auto& slab = slabs[s];
+                for (const auto& [local, prev] : slab.welds) {
+                    slab.remap[local] = slabs[s - 1].remap[prev];
+                }
+                std::ranges::transform(slab.indices, indices.begin() + slab.indexOffset,
+                                       [&](uint32_t i) { return slab.remap[i]; });
+            },
+            {.grainSize = 1});
+
+        // A welded vertex gets contributions to its normal from both slabs
+        for (const auto& slab : slabs) {
+            for (const auto local : slab.welds | std::views::keys) {
+                normals[slab.remap[local]] += slab.normals[local];
             }
         }
 
@@ -38,11 +38,11 @@
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAMPrecision
 #include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
+#include <inviwo/core/util/glmmat.h>                                    // for mat3, dmat3
 #include <inviwo/core/util/glmutils.h>                                  // for Vector
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, dvec2
-#include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
-#include <inviwo/core/util/templatesampler.h>                           // for TemplateVolumeSam...
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxel
+#include <inviwo/core/util/parallel.h>                                  // for parallelReduce
+#include <modules/base/algorithm/volume/volumestencil.h>                // for forEachStencil
 
 #include <stdlib.h>       // for abs
 #include <algorithm>      // for max, min
@@ -54,7 +54,9 @@
 #include <unordered_set>  // for unordered_set
 
 #include <glm/common.hpp>  // for mix
+#include <glm/mat3x3.hpp>  // for operator*, mat
 #include <glm/mat4x4.hpp>  // for operator*, mat
+#include <glm/matrix.hpp>  // for inverse
 #include <glm/vec3.hpp>    // for operator/, operator*
 #include <glm/vec4.hpp>    // for operator*, operator+
 
@@ -70,58 +72,54 @@ std::unique_ptr<Volume> divergenceVolume(const Volume& volume) {
     auto newVolumeRep = std::make_shared<VolumeRAMPrecision<float>>(volume.getDimensions());
     newVolume->addRepresentation(newVolumeRep);
 
-    const auto m = newVolume->getCoordinateTransformer().getDataToWorldMatrix();
-
-    const auto a = m * vec4(0, 0, 0, 1);
-    const auto b = m * vec4(1.0f / vec3(volume.getDimensions() - size3_t(1)), 1);
-    const auto spacing = b - a;
-
-    const vec3 ox(spacing.x, 0, 0);
-    const vec3 oy(0, spacing.y, 0);
-    const vec3 oz(0, 0, spacing.z);
+    // Maps derivatives along the voxel axes to derivatives along the world axes
+    const auto indexToWorld = volume.getCoordinateTransformer().getIndexToWorldMatrix();
+    const mat3 worldToIndex = glm::inverse(mat3{indexToWorld});
 
     volume.getRepresentation<VolumeRAM>()->dispatch<void, dispatching::filter::Vec3s>(
-        [&](auto vol) {
-            using DataType = util::PrecisionValueType<decltype(vol)>;
-            using ComponentType = util::value_type_t<DataType>;
-            using SampleType =
-                typename std::conditional_t<std::is_same<float, ComponentType>::value, vec3, dvec3>;
-            using Sampler = TemplateVolumeSampler<SampleType, DataType>;
-            ;
-
-            util::IndexMapper3D index(volume.getDimensions());
-            auto data = newVolumeRep->getDataTyped();
-            float minV = std::numeric_limits<float>::max();
-            float maxV = std::numeric_limits<float>::lowest();
-
-            const Sampler sampler{volume, CoordinateSpace::World};
-
-            util::forEachVoxel(*vol, [&](const size3_t& pos) {
-                const vec3 world{m *
-                                 vec4(vec3(pos) / vec3(volume.getDimensions() - size3_t(1)), 1)};
-
-                const auto Fxp = static_cast<vec3>(sampler.sample(world + ox));
-                const auto Fxm = static_cast<vec3>(sampler.sample(world - ox));
-                const auto Fyp = static_cast<vec3>(sampler.sample(world + oy));
-                const auto Fym = static_cast<vec3>(sampler.sample(world - oy));
-                const auto Fzp = static_cast<vec3>(sampler.sample(world + oz));
-                const auto Fzm = static_cast<vec3>(sampler.sample(world - oz));
-
-                const vec3 Fx = (Fxp - Fxm) / (2.0f * spacing.x);
-                const vec3 Fy = (Fyp - Fym) / (2.0f * spacing.y);
-                const vec3 Fz = (Fzp - Fzm) / (2.0f * spacing.z);
-
-                const float d = Fx.x + Fy.y + Fz.z;
-
-                minV = std::min(minV, d);
-                maxV = std::max(maxV, d);
-
-                data[index(pos)] = d;
-            });
-
-            auto range = std::max(std::abs(minV), std::abs(maxV));
-            newVolume->dataMap.dataRange = dvec2(-range, range);
-            newVolume->dataMap.valueRange = dvec2(minV, maxV);
+        [&]<typename DataType>(const VolumeRAMPrecision<DataType>* vol) {
+            constexpr bool isFloat = std::is_same_v<float, util::value_type_t<DataType>>;
+            using SampleType = std::conditional_t<isFloat, vec3, dvec3>;
+            using MatType = std::conditional_t<isFloat, mat3, dmat3>;
+            using Real = typename SampleType::value_type;
+
+            const auto dims = vol->getDimensions();
+            const auto* src = vol->getDataTyped();
+            auto* dst = newVolumeRep->getDataTyped();
+            const MatType toWorld{worldToIndex};
+
+            const auto range = util::parallelReduce(
+                0, dims.z, dvec2{std::numeric_limits<double>::max(),
+                                 std::numeric_limits<double>::lowest()},
+                [&](size_t first, size_t last) {
+                    float minV = std::numeric_limits<float>::max();
+                    float maxV = std::numeric_limits<float>::lowest();
+                    util::forEachStencil(
+                        src, dims, first, last,
+                        [&](const util::StencilRow<DataType>& row, size_t x, size_t xm, size_t xp) {
+                            const auto Fi = static_cast<SampleType>(row.center[xp]) -
+                                            static_cast<SampleType>(row.center[xm]);
+                            const auto Fj = static_cast<SampleType>(row.yp[x]) -
+                                            static_cast<SampleType>(row.ym[x]);
+                            const auto Fk = static_cast<SampleType>(row.zp[x]) -
+                                            static_cast<SampleType>(row.zm[x]);
+                            // Columns are the derivatives along the world x, y, and z axes
+                            const MatType D = MatType{Fi, Fj, Fk} * toWorld * Real{0.5};
+
+                            const auto d = static_cast<float>(D[0].x + D[1].y + D[2].z);
+
+                            minV = std::min(minV, d);
+                            maxV = std::max(maxV, d);
+
+                            dst[row.offset + x] = d;
+                        });
+                    return dvec2{minV, maxV};
+                },
+                [](dvec2 a, dvec2 b) { return dvec2{std::min(a.x, b.x), std::max(a.y, b.y)}; });
+
+            const auto absMax = std::max(std::abs(range.x), std::abs(range.y));
+            newVolume->dataMap.dataRange = dvec2(-absMax, absMax);
+            newVolume->dataMap.valueRange = range;
             newVolume->dataMap.valueAxis.name = "divergence";
             newVolume->dataMap.valueAxis.unit = volume.dataMap.valueAxis.unit / volume.axes[0].unit;
         });
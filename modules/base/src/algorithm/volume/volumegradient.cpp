@@ -37,13 +37,14 @@
 #include <inviwo/core/datastructures/unitsystem.h>                      // for Axis, Unit
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAMPrecision
-#include <inviwo/core/util/glmutils.h>                                  // for Vector
+#include <inviwo/core/util/glmcomp.h>                                   // for glmcomp
+#include <inviwo/core/util/glmmat.h>                                    // for mat3, dmat3
+#include <inviwo/core/util/glmutils.h>                                  // for extent_v
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, dvec2
-#include <inviwo/core/util/indexmapper.h>                               // for IndexMapper3D
-#include <inviwo/core/util/spatialsampler.h>                            // for SpatialSampler<>:...
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxelParallel
-#include <inviwo/core/util/volumesampler.h>                             // for VolumeDoubleSampler
+#include <inviwo/core/util/parallel.h>                                  // for parallelReduce
+#include <modules/base/algorithm/volume/volumestencil.h>                // for forEachStencil
 
+#include <algorithm>      // for max
 #include <array>          // for array
 #include <functional>     // for __base
 #include <limits>         // for numeric_limits
@@ -54,7 +55,9 @@
 
 #include <glm/common.hpp>              // for mix, max, abs
 #include <glm/gtx/component_wise.hpp>  // for compMax
+#include <glm/mat3x3.hpp>              // for operator*, mat
 #include <glm/mat4x4.hpp>              // for operator*, mat
+#include <glm/matrix.hpp>              // for inverse, transpose
 #include <glm/vec3.hpp>                // for operator-, operator/
 #include <glm/vec4.hpp>                // for operator*, operator+
 
@@ -71,37 +74,41 @@ std::shared_ptr<Volume> gradientVolume(std::shared_ptr<const Volume> volume, int
     auto newVolumeRep = std::make_shared<VolumeRAMPrecision<vec3>>(volume->getDimensions());
     newVolume->addRepresentation(newVolumeRep);
 
-    auto m = newVolume->getCoordinateTransformer().getDataToWorldMatrix();
+    // Maps derivatives along the voxel axes to derivatives along the world axes
+    const auto indexToWorld = volume->getCoordinateTransformer().getIndexToWorldMatrix();
+    const dmat3 toWorld = glm::transpose(glm::inverse(dmat3{mat3{indexToWorld}}));
 
-    const auto a = m * vec4(0, 0, 0, 1);
-    const auto b = m * vec4(1.0f / vec3(volume->getDimensions() - size3_t(1)), 1);
-    const auto spacing = b - a;
-
-    const vec3 ox(spacing.x, 0, 0);
-    const vec3 oy(0, spacing.y, 0);
-    const vec3 oz(0, 0, spacing.z);
-
-    VolumeSampler sampler{volume, CoordinateSpace::World};
-
-    util::IndexMapper3D index(volume->getDimensions());
     auto data = newVolumeRep->getDataTyped();
-
-    const dvec3 spacing2 = spacing * 2.0;
-    float max = std::numeric_limits<float>::lowest();
-    auto func = [&](const size3_t& pos) {
-        const vec3 world{m * vec4(vec3(pos) / vec3(volume->getDimensions() - size3_t(1)), 1)};
-
-        const auto g = static_cast<vec3>(
-            dvec3{(sampler.sample(world + ox) - sampler.sample(world - ox))[channel],
-                  (sampler.sample(world + oy) - sampler.sample(world - oy))[channel],
-                  (sampler.sample(world + oz) - sampler.sample(world - oz))[channel]} /
-            spacing2);
-
-        data[index(pos)] = g;
-        max = glm::max(max, glm::compMax(glm::abs(g)));
-    };
-
-    util::forEachVoxelParallel(*volume->getRepresentation<VolumeRAM>(), func);
+    const auto max = volume->getRepresentation<VolumeRAM>()->dispatch<float>(
+        [&]<typename DataType>(const VolumeRAMPrecision<DataType>* vol) {
+            const auto dims = vol->getDimensions();
+            const auto* src = vol->getDataTyped();
+            // Channels that are not in the data are zero
+            const auto c = static_cast<size_t>(channel);
+            const auto comp = [&](const DataType& v) {
+                return c < util::extent_v<DataType> ? static_cast<double>(util::glmcomp(v, c))
+                                                    : 0.0;
+            };
+
+            return util::parallelReduce(
+                0, dims.z, 0.0f,
+                [&](size_t first, size_t last) {
+                    float max = 0.0f;
+                    util::forEachStencil(
+                        src, dims, first, last,
+                        [&](const util::StencilRow<DataType>& row, size_t x, size_t xm, size_t xp) {
+                            const dvec3 gi{comp(row.center[xp]) - comp(row.center[xm]),
+                                           comp(row.yp[x]) - comp(row.ym[x]),
+                                           comp(row.zp[x]) - comp(row.zm[x])};
+                            const auto g = static_cast<vec3>(toWorld * gi * 0.5);
+
+                            data[row.offset + x] = g;
+                            max = glm::max(max, glm::compMax(glm::abs(g)));
+                        });
+                    return max;
+                },
+                [](float a, float b) { return std::max(a, b); });
+        });
 
     newVolume->dataMap.dataRange = dvec2(-max, max);
     newVolume->dataMap.valueRange = dvec2(-max, max);
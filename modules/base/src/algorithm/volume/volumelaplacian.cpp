@@ -39,12 +39,10 @@
 #include <inviwo/core/util/formatdispatching.h>                         // for dispatch, All
 #include <inviwo/core/util/formats.h>                                   // for DataFormat
 #include <inviwo/core/util/glmcomp.h>                                   // for glmcomp
-#include <inviwo/core/util/glmmat.h>                                    // for dmat4
 #include <inviwo/core/util/glmutils.h>                                  // for same_extent
 #include <inviwo/core/util/glmvec.h>                                    // for dvec3, dvec2, siz...
-#include <inviwo/core/util/indexmapper.h>                               // for IndexMapper3D
-#include <inviwo/core/util/templatesampler.h>                           // for TemplateVolumeSam...
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxelParallel
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor, para...
+#include <modules/base/algorithm/volume/volumestencil.h>                // for forEachStencil
 
 #include <functional>     // for __base
 #include <unordered_map>  // for unordered_map
@@ -56,8 +54,8 @@
 #include <memory>         // for shared_ptr, share...
 #include <type_traits>    // for remove_extent_t
 #include <unordered_set>  // for unordered_set
+#include <utility>        // for pair
 
-#include <glm/gtx/matrix_operation.hpp>  // for diagonal3x3
 #include <glm/mat3x3.hpp>                // for mat
 #include <glm/mat4x4.hpp>                // for operator*, mat
 #include <glm/vec3.hpp>                  // for operator-, operator+
@@ -92,77 +90,75 @@ std::shared_ptr<Volume> util::volumeLaplacian(std::shared_ptr<const Volume> volu
             newVolume->dataMap.valueAxis.unit =
                 volume->dataMap.valueAxis.unit / volume->axes[0].unit / volume->axes[0].unit;
 
-            const dmat4 m{volume->getCoordinateTransformer().getDataToWorldMatrix()};
-            const auto a = m * dvec4(0, 0, 0, 1);
-            const auto b = m * dvec4(dvec3(1.0) / dvec3(volume->getDimensions() - size3_t(1)), 1);
-            const auto spacing = dvec3(b - a);
-
-            const auto o = glm::diagonal3x3(spacing);
-
-            using Sampler = TemplateVolumeSampler<SampleType, DataType>;
-            const Sampler s(volume, CoordinateSpace::World);
-
-            const util::IndexMapper3D index{volume->getDimensions()};
-
-            const auto resDim = dvec3(1.0) / dvec3(volume->getDimensions() - size3_t(1));
+            const auto spacing = dvec3{util::voxelSpacing(
+                volume->getCoordinateTransformer().getIndexToWorldMatrix())};
             const auto resSpace2 = dvec3(1.0) / (spacing * spacing);
 
-            auto minval(std::numeric_limits<double>::max());
-            auto maxval(std::numeric_limits<double>::lowest());
-
+            const auto* src = srcRAM->getDataTyped();
             auto newData = dstRAM->getView();
-            auto func = [&](const size3_t& pos) {
-                const dvec3 world{m * dvec4((dvec3(pos) + dvec3(0.5)) * resDim, 1.0)};
-
-                const auto center = 2.0 * s.sample(world);
-                const auto D2x =
-                    (s.sample(world + o[0]) + center - s.sample(world - o[0])) * resSpace2.x;
-                const auto D2y =
-                    (s.sample(world + o[1]) + center - s.sample(world - o[1])) * resSpace2.y;
-                const auto D2z =
-                    (s.sample(world + o[2]) + center - s.sample(world - o[2])) * resSpace2.z;
-                const auto laplacian = center + D2x + D2y + D2z;
-
-                if constexpr (1 < util::extent_v<DataType>) {
-                    minval = glm::min(minval, glm::compMin(laplacian));
-                    maxval = glm::max(maxval, glm::compMax(laplacian));
-                } else {
-                    minval = glm::min(minval, laplacian);
-                    maxval = glm::max(maxval, laplacian);
-                }
-
-                newData[index(pos)] = static_cast<DstType>(laplacian);
-            };
-
-            util::forEachVoxelParallel(dims, func);
+
+            const auto range = util::parallelReduce(
+                0, dims.z,
+                std::pair{std::numeric_limits<double>::max(),
+                          std::numeric_limits<double>::lowest()},
+                [&](size_t first, size_t last) {
+                    auto minval(std::numeric_limits<double>::max());
+                    auto maxval(std::numeric_limits<double>::lowest());
+                    util::forEachStencil(
+                        src, dims, first, last,
+                        [&](const util::StencilRow<DataType>& row, size_t x, size_t xm, size_t xp) {
+                            const auto center = 2.0 * static_cast<SampleType>(row.center[x]);
+                            const auto D2x = (static_cast<SampleType>(row.center[xp]) - center +
+                                              static_cast<SampleType>(row.center[xm])) *
+                                             resSpace2.x;
+                            const auto D2y = (static_cast<SampleType>(row.yp[x]) - center +
+                                              static_cast<SampleType>(row.ym[x])) *
+                                             resSpace2.y;
+                            const auto D2z = (static_cast<SampleType>(row.zp[x]) - center +
+                                              static_cast<SampleType>(row.zm[x])) *
+                                             resSpace2.z;
+                            const auto laplacian = D2x + D2y + D2z;
+
+                            if constexpr (1 < util::extent_v<DataType>) {
+                                minval = glm::min(minval, glm::compMin(laplacian));
+                                maxval = glm::max(maxval, glm::compMax(laplacian));
+                            } else {
+                                minval = glm::min(minval, laplacian);
+                                maxval = glm::max(maxval, laplacian);
+                            }
+
+                            newData[row.offset + x] = static_cast<DstType>(laplacian);
+                        });
+                    return std::pair{minval, maxval};
+                },
+                [](const auto& a, const auto& b) {
+                    return std::pair{std::min(a.first, b.first), std::max(a.second, b.second)};
+                });
 
             // Make range symmetric
-            auto rangeMax = std::max(std::abs(minval), std::abs(maxval));
+            auto rangeMax = std::max(std::abs(range.first), std::abs(range.second));
 
             switch (postProcessing) {
                 case VolumeLaplacianPostProcessing::Normalized:
-                    util::forEachVoxelParallel(dims, [&](const size3_t& pos) {
-                        newData[index(pos)] =
-                            (newData[index(pos)] + DstType{static_cast<float>(rangeMax)}) /
-                            DstType{static_cast<float>(2.0 * rangeMax)};
+                    util::parallelFor(0, newData.size(), [&](size_t i) {
+                        newData[i] = (newData[i] + DstType{static_cast<float>(rangeMax)}) /
+                                     DstType{static_cast<float>(2.0 * rangeMax)};
                     });
                     newVolume->dataMap.dataRange = dvec2(0.0, 1.0);
                     newVolume->dataMap.valueRange = dvec2(0.0, 1.0);
                     break;
                 case VolumeLaplacianPostProcessing::SignNormalized:
-                    util::forEachVoxelParallel(dims, [&](const size3_t& pos) {
-                        newData[index(pos)] =
-                            (newData[index(pos)] + DstType{static_cast<float>(rangeMax)}) /
-                                DstType{static_cast<float>(rangeMax)} -
-                            DstType{1.0f};
+                    util::parallelFor(0, newData.size(), [&](size_t i) {
+                        newData[i] = (newData[i] + DstType{static_cast<float>(rangeMax)}) /
+                                         DstType{static_cast<float>(rangeMax)} -
+                                     DstType{1.0f};
                     });
                     newVolume->dataMap.dataRange = dvec2(-1.0, 1.0);
                     newVolume->dataMap.valueRange = dvec2(-1.0, 1.0);
                     break;
                 case VolumeLaplacianPostProcessing::Scaled:
-                    util::forEachVoxelParallel(dims, [&](const size3_t& pos) {
-                        newData[index(pos)] =
-                            newData[index(pos)] * DstType{static_cast<float>(scale)};
+                    util::parallelFor(0, newData.size(), [&](size_t i) {
+                        newData[i] = newData[i] * DstType{static_cast<float>(scale)};
                     });
                     newVolume->dataMap.dataRange = dvec2(-rangeMax * scale, rangeMax * scale);
                     newVolume->dataMap.valueRange = dvec2(-rangeMax * scale, rangeMax * scale);
@@ -31,22 +31,72 @@
 
 #include <inviwo/core/datastructures/volume/volumeram.h>  // for VolumeRAM
 #include <inviwo/core/util/formatdispatching.h>           // for PrecisionValueType
+#include <inviwo/core/util/glmconvert.h>                  // for glm_convert
 #include <inviwo/core/util/glmutils.h>                    // for same_extent
 #include <inviwo/core/util/glmvec.h>                      // for size3_t
 #include <inviwo/core/util/indexmapper.h>                 // for IndexMapper, IndexMapper3D
+#include <inviwo/core/util/parallel.h>                    // for parallelFor
 
-#include <cstddef>  // for size_t
+#include <algorithm>  // for min
+#include <cstddef>    // for size_t
 
 #include <glm/vec2.hpp>  // for operator*
 #include <glm/vec3.hpp>  // for operator*, vec<>::(anonymous)
 #include <glm/vec4.hpp>  // for operator*
-
-#ifdef IVW_USE_OPENMP
-#include <omp.h>
-#endif
+#include <glm/gtx/component_wise.hpp>  // for compMul
 
 namespace inviwo::util {
 
+namespace {
+
+// Each tile covers 2^pyramidTileLevels voxels along each axis of the level a pass starts from,
+// which is reduced through pyramidTileLevels levels before moving on to the next tile.
+constexpr size_t pyramidTileLevels = 5;
+constexpr size_t pyramidTileSize = size_t{1} << pyramidTileLevels;
+
+size3_t halfDims(size3_t dims) { return glm::max((dims + size3_t{1}) / size3_t{2}, size3_t{1}); }
+
+// Downsample the voxels [lower, upper) of dst from src, voxels outside of src are clamped to the
+// border
+template <typename T>
+void downsampleRegion(const T* src, size3_t srcDims, T* dst, size3_t dstDims, size3_t lower,
+                      size3_t upper, DownsamplingMode mode) {
+    using P = util::same_extent_t<T, double>;
+
+    const util::IndexMapper3D srcIm{srcDims};
+    const util::IndexMapper3D dstIm{dstDims};
+    const auto last = srcDims - size3_t{1};
+    for (size_t z = lower.z; z < upper.z; ++z) {
+        const size_t z0 = 2 * z;
+        const size_t z1 = std::min(z0 + 1, last.z);
+        for (size_t y = lower.y; y < upper.y; ++y) {
+            const size_t y0 = 2 * y;
+            const size_t y1 = std::min(y0 + 1, last.y);
+            if (mode == DownsamplingMode::Strided) {
+                for (size_t x = lower.x; x < upper.x; ++x) {
+                    dst[dstIm(x, y, z)] = src[srcIm(2 * x, y0, z0)];
+                }
+                continue;
+            }
+            for (size_t x = lower.x; x < upper.x; ++x) {
+                const size_t x0 = 2 * x;
+                const size_t x1 = std::min(x0 + 1, last.x);
+                const P sum = util::glm_convert<P>(src[srcIm(x0, y0, z0)]) +
+                              util::glm_convert<P>(src[srcIm(x1, y0, z0)]) +
+                              util::glm_convert<P>(src[srcIm(x0, y1, z0)]) +
+                              util::glm_convert<P>(src[srcIm(x1, y1, z0)]) +
+                              util::glm_convert<P>(src[srcIm(x0, y0, z1)]) +
+                              util::glm_convert<P>(src[srcIm(x1, y0, z1)]) +
+                              util::glm_convert<P>(src[srcIm(x0, y1, z1)]) +
+                              util::glm_convert<P>(src[srcIm(x1, y1, z1)]);
+                dst[dstIm(x, y, z)] = util::glm_convert<T>(sum / 8.0);
+            }
+        }
+    }
+}
+
+}  // namespace
+
 std::shared_ptr<VolumeRAM> volumeDownsample(const VolumeRAM* volume, size3_t strides,
                                             DownsamplingMode mode) {
     switch (mode) {
@@ -76,11 +126,7 @@ std::shared_ptr<VolumeRAM> volumeStridedDownsample(const VolumeRAM* volume, size
             const util::IndexMapper3D sourceMapper(srcDims);
             const util::IndexMapper3D destMapper(destDims);
 
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-            for (long long z_ = 0; z_ < static_cast<long long>(destDims.z); ++z_) {
-                const auto z = static_cast<size_t>(z_);  // OpenMP requires signed integral type
+            util::parallelFor(0, destDims.z, [&](size_t z) {
                 for (size_t y = 0; y < destDims.y; ++y) {
                     for (size_t x = 0; x < destDims.x; ++x) {
                         const size_t px{x * strides.x};
@@ -90,7 +136,7 @@ std::shared_ptr<VolumeRAM> volumeStridedDownsample(const VolumeRAM* volume, size
                         dst[destMapper(x, y, z)] = src[sourceMapper(px, py, pz)];
                     }
                 }
-            }
+            });
             return destVol;
         });
 }
@@ -116,11 +162,7 @@ std::shared_ptr<VolumeRAM> volumeAveragedDownsample(const VolumeRAM* volume, siz
             const util::IndexMapper3D destMapper(destDims);
             const double samplesInv = 1.0 / static_cast<double>(glm::compMul(strides));
 
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-            for (long long z_ = 0; z_ < static_cast<long long>(destDims.z); ++z_) {
-                const auto z = static_cast<size_t>(z_);  // OpenMP requires signed integral type
+            util::parallelFor(0, destDims.z, [&](size_t z) {
                 for (size_t y = 0; y < destDims.y; ++y) {
                     for (size_t x = 0; x < destDims.x; ++x) {
                         const size_t px{x * strides.x};
@@ -140,10 +182,59 @@ std::shared_ptr<VolumeRAM> volumeAveragedDownsample(const VolumeRAM* volume, siz
                         dst[destMapper(x, y, z)] = static_cast<ValueType>(val * samplesInv);
                     }
                 }
-            }
+            });
 
             return destVol;
         });
 }
 
+std::vector<std::shared_ptr<VolumeRAM>> volumePyramid(const VolumeRAM* volume,
+                                                      DownsamplingMode mode, size_t maxLevels) {
+    return volume->dispatch<std::vector<std::shared_ptr<VolumeRAM>>>(
+        [&]<typename T>(const VolumeRAMPrecision<T>* srcVol) {
+            std::vector<std::shared_ptr<VolumeRAM>> result;
+            std::vector<T*> levels;
+            std::vector<size3_t> dims{srcVol->getDimensions()};
+
+            while (result.size() < maxLevels && dims.back() != size3_t{1}) {
+                dims.push_back(halfDims(dims.back()));
+                auto level = std::make_shared<VolumeRAMPrecision<T>>(
+                    dims.back(), srcVol->getSwizzleMask(), srcVol->getInterpolation(),
+                    srcVol->getWrapping());
+                levels.push_back(level->getDataTyped());
+                result.push_back(std::move(level));
+            }
+
+            // Level 0 is the input volume
+            const auto source = [&](size_t l) -> const T* {
+                return l == 0 ? srcVol->getDataTyped() : levels[l - 1];
+            };
+
+            // Every pass reduces the tiles of the base level through up to pyramidTileLevels
+            // levels, the last level of a pass becomes the base of the next pass
+            for (size_t base = 0; base < levels.size(); base += pyramidTileLevels) {
+                const size_t passLevels = std::min(pyramidTileLevels, levels.size() - base);
+                const auto tiles = (dims[base] + size3_t{pyramidTileSize - 1}) / pyramidTileSize;
+                const util::IndexMapper3D tileIm{tiles};
+
+                util::parallelFor(
+                    0, glm::compMul(tiles),
+                    [&](size_t index) {
+                        const auto tile = tileIm(index);
+                        for (size_t i = 1; i <= passLevels; ++i) {
+                            const size_t l = base + i;
+                            const auto size = size3_t{pyramidTileSize >> i};
+                            const auto lower = tile * size;
+                            const auto upper = glm::min(lower + size, dims[l]);
+                            downsampleRegion(source(l - 1), dims[l - 1], levels[l - 1], dims[l],
+                                             lower, upper, mode);
+                        }
+                    },
+                    {.grainSize = 1});
+            }
+
+            return result;
+        });
+}
+
 }  // namespace inviwo::util
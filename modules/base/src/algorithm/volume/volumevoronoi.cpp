@@ -37,113 +37,97 @@
 #include <inviwo/core/util/glmmat.h>                      // for mat4
 #include <inviwo/core/util/glmvec.h>                      // for vec3, size3_t, vec4, dvec2
 #include <inviwo/core/util/indexmapper.h>                 // for IndexMapper, IndexMapper3D
-#include <inviwo/core/util/volumeramutils.h>              // for forEachVoxelParallel
-#include <inviwo/core/util/zip.h>                         // for zip, zipper
+#include <inviwo/core/util/parallel.h>                    // for parallelFor
+#include <modules/base/datastructures/flatkdtree.h>       // for FlatKDTree
 
-#include <algorithm>    // for max_element, min_element
-#include <array>        // for array<>::value_type, array
+#include <algorithm>    // for max, minmax_element
+#include <cmath>        // for sqrt
 #include <cstddef>      // for size_t
-#include <functional>   // for __base
+#include <limits>       // for numeric_limits
 #include <string>       // for string
 #include <string_view>  // for string_view
-#include <type_traits>  // for remove_extent_t, integral_constant
+#include <utility>      // for pair, move
+#include <vector>       // for vector
 
-#include <glm/geometric.hpp>  // for dot
-#include <glm/gtx/norm.hpp>   // for length2
-#include <glm/mat4x4.hpp>     // for operator*
-#include <glm/vec3.hpp>       // for operator-, operator*
-#include <glm/vec4.hpp>       // for operator*, operator+
+#include <glm/mat3x3.hpp>  // for operator*
+#include <glm/mat4x4.hpp>  // for operator*
+#include <glm/vec3.hpp>    // for operator-, operator*
+#include <glm/vec4.hpp>    // for operator*, operator+
 
 namespace inviwo {
 namespace util {
 
 namespace detail {
-template <Wrapping X, Wrapping Y, Wrapping Z>
-auto distance2(const vec3& a, const vec3& b, const mat3& dataToModelMatrix) {
-    auto delta = b - a;
 
-    if constexpr (X == Wrapping::Repeat) {
-        if (delta.x > 0.5f) delta.x -= 1.0f;
-        if (delta.x < -0.5f) delta.x += 1.0f;
-    }
-
-    if constexpr (Y == Wrapping::Repeat) {
-        if (delta.y > 0.5f) delta.y -= 1.0f;
-        if (delta.y < -0.5f) delta.y += 1.0f;
-    }
-
-    if constexpr (Z == Wrapping::Repeat) {
-        if (delta.z > 0.5f) delta.z -= 1.0f;
-        if (delta.z < -0.5f) delta.z += 1.0f;
-    }
-
-    return glm::length2(dataToModelMatrix * delta);
-}
-
-template <typename Index, typename Functor, Index... Is>
-constexpr auto build_array_impl(Functor&& func, std::integer_sequence<Index, Is...>) noexcept {
-    return std::array{func(std::integral_constant<Index, Is>{})...};
-}
-
-template <std::size_t N, typename Index = size_t, typename Functor>
-constexpr auto build_array(Functor&& func) noexcept {
-    return build_array_impl<Index>(std::forward<Functor>(func),
-                                   std::make_integer_sequence<Index, N>());
-}
-
-}  // namespace detail
-
-template <Wrapping X, Wrapping Y, Wrapping Z>
+/**
+ * Find the closest seed for each voxel using a kd-tree. For repeating axes the seeds are also
+ * added shifted by one period in each direction. For weighted seeds the power distance
+ * |x - p|^2 - w^2 is turned into a euclidean distance in 4D by placing each seed at the height
+ * sqrt(W - w^2), with W the largest squared weight, and the voxels at height zero.
+ */
+template <size_t K>
 void voronoiSegmentationImpl(
     const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
     const std::vector<std::pair<unsigned short, vec3>>& seedPointsWithIndices,
+    const Wrapping3D& wrapping, const std::vector<float>& weights,
     VolumeRAMPrecision<unsigned short>& voronoiVolumeRep) {
 
-    auto volumeIndices = voronoiVolumeRep.getDataTyped();
-    util::IndexMapper3D index(volumeDimensions);
-
     // We can ignore any translations
     const auto d2m = mat3{dataToModelMatrix};
 
-    util::forEachVoxelParallel(volumeDimensions, [&](const size3_t& voxelPos) {
-        const auto dataVoxelPos = vec3{indexToDataMatrix * vec4{voxelPos, 1.0f}};
-        const auto it =
-            std::min_element(seedPointsWithIndices.cbegin(), seedPointsWithIndices.cend(),
-                             [&](const auto& p1, const auto& p2) {
-                                 return detail::distance2<X, Y, Z>(p1.second, dataVoxelPos, d2m) <
-                                        detail::distance2<X, Y, Z>(p2.second, dataVoxelPos, d2m);
-                             });
-        volumeIndices[index(voxelPos)] = it->first;
-    });
-}
+    float maxWeight2 = 0.0f;
+    for (const auto w : weights) maxWeight2 = std::max(maxWeight2, w * w);
+
+    std::vector<ivec3> periods;
+    const auto range = [&](size_t axis) {
+        return wrapping[axis] == Wrapping::Repeat ? ivec2{-1, 1} : ivec2{0, 0};
+    };
+    for (int z = range(2).x; z <= range(2).y; ++z) {
+        for (int y = range(1).x; y <= range(1).y; ++y) {
+            for (int x = range(0).x; x <= range(0).y; ++x) {
+                periods.emplace_back(x, y, z);
+            }
+        }
+    }
 
-template <Wrapping X, Wrapping Y, Wrapping Z>
-void weightedVoronoiSegmentationImpl(
-    const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
-    const std::vector<std::pair<unsigned short, vec3>>& seedPointsWithIndices,
-    const std::vector<float>& weights, VolumeRAMPrecision<unsigned short>& voronoiVolumeRep) {
+    // The tree resolves ties to the smallest point index, since the copies of each seed are
+    // consecutive that will be the first seed in the input, like a linear search would give.
+    using Tree = FlatKDTree<K, float>;
+    std::vector<typename Tree::Point> seeds;
+    std::vector<unsigned short> seedIndices;
+    seeds.reserve(seedPointsWithIndices.size() * periods.size());
+    seedIndices.reserve(seedPointsWithIndices.size() * periods.size());
+    for (size_t i = 0; i < seedPointsWithIndices.size(); ++i) {
+        const auto& [seedIndex, dataPos] = seedPointsWithIndices[i];
+        for (const auto& period : periods) {
+            const auto modelPos = d2m * (dataPos + vec3{period});
+            auto& seed = seeds.emplace_back();
+            for (size_t k = 0; k < 3; ++k) seed[k] = modelPos[k];
+            if constexpr (K == 4) {
+                seed[3] = std::sqrt(std::max(0.0f, maxWeight2 - weights[i] * weights[i]));
+            }
+            seedIndices.push_back(seedIndex);
+        }
+    }
+    const Tree tree{seeds};
 
     auto volumeIndices = voronoiVolumeRep.getDataTyped();
-    util::IndexMapper3D index(volumeDimensions);
-
-    // We can ignore any translations
-    const auto d2m = mat3{dataToModelMatrix};
-
-    util::forEachVoxelParallel(volumeDimensions, [&](const size3_t& voxelPos) {
-        const auto dataVoxelPos = vec3{indexToDataMatrix * vec4{voxelPos, 1.0f}};
-        auto zipped = util::zip(seedPointsWithIndices, weights);
-
-        const auto&& [posWithIndex, weight] =
-            *std::min_element(zipped.begin(), zipped.end(), [&](auto&& i1, auto&& i2) {
-                auto&& [p1, w1] = i1;
-                auto&& [p2, w2] = i2;
-                return detail::distance2<X, Y, Z>(p1.second, dataVoxelPos, d2m) - w1 * w1 <
-                       detail::distance2<X, Y, Z>(p2.second, dataVoxelPos, d2m) - w2 * w2;
-            });
-        volumeIndices[index(voxelPos)] = posWithIndex.first;
+    const util::IndexMapper3D index(volumeDimensions);
+    util::parallelFor(0, volumeDimensions.z, [&](size_t z) {
+        typename Tree::Point pos{0.0f};
+        for (size_t y = 0; y < volumeDimensions.y; ++y) {
+            for (size_t x = 0; x < volumeDimensions.x; ++x) {
+                const size3_t voxelPos{x, y, z};
+                const auto modelPos = d2m * vec3{indexToDataMatrix * vec4{voxelPos, 1.0f}};
+                for (size_t k = 0; k < 3; ++k) pos[k] = modelPos[k];
+                volumeIndices[index(voxelPos)] = seedIndices[tree.nearest(pos)];
+            }
+        }
     });
 }
 
+}  // namespace detail
+
 std::shared_ptr<Volume> voronoiSegmentation(
     const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
     const std::vector<std::pair<uint32_t, vec3>>& seedPointsWithIndices, const Wrapping3D& wrapping,
@@ -195,61 +179,13 @@ std::shared_ptr<Volume> voronoiSegmentation(
                    });
 
     if (weights.has_value()) {
-        using Functor = void (*)(const size3_t, const mat4&, const mat4&,
-                                 const std::vector<std::pair<unsigned short, vec3>>&,
-                                 const std::vector<float>&, VolumeRAMPrecision<unsigned short>&);
-
-        constexpr auto table = detail::build_array<3>([&](auto x) constexpr {
-            return detail::build_array<3>([&](auto y) constexpr {
-                return detail::build_array<3>([&](auto z) constexpr -> Functor {
-                    return [](const size3_t dim, const mat4& i2d, const mat4& d2m,
-                              const std::vector<std::pair<unsigned short, vec3>>& sp,
-                              const std::vector<float>& w,
-                              VolumeRAMPrecision<unsigned short>& volRep) {
-                        using XT = decltype(x);
-                        using YT = decltype(y);
-                        using ZT = decltype(z);
-                        constexpr auto X = static_cast<Wrapping>(XT::value);
-                        constexpr auto Y = static_cast<Wrapping>(YT::value);
-                        constexpr auto Z = static_cast<Wrapping>(ZT::value);
-                        weightedVoronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp, w, volRep);
-                    };
-                });
-            });
-        });
-
-        table[static_cast<size_t>(wrapping[0])][static_cast<size_t>(wrapping[1])]
-             [static_cast<size_t>(wrapping[2])](volumeDimensions, indexToDataMatrix,
-                                                dataToModelMatrix, dataSeedPointsWithIndices,
-                                                *weights, *voronoiVolumeRep);
-
+        detail::voronoiSegmentationImpl<4>(volumeDimensions, indexToDataMatrix,
+                                           dataToModelMatrix, dataSeedPointsWithIndices, wrapping,
+                                           *weights, *voronoiVolumeRep);
     } else {
-        using Functor = void (*)(const size3_t, const mat4&, const mat4&,
-                                 const std::vector<std::pair<unsigned short, vec3>>&,
-                                 VolumeRAMPrecision<unsigned short>&);
-
-        constexpr auto table = detail::build_array<3>([&](auto x) constexpr {
-            return detail::build_array<3>([&](auto y) constexpr {
-                return detail::build_array<3>([&](auto z) constexpr -> Functor {
-                    return [](const size3_t dim, const mat4& i2d, const mat4& d2m,
-                              const std::vector<std::pair<unsigned short, vec3>>& sp,
-                              VolumeRAMPrecision<unsigned short>& volRep) {
-                        using XT = decltype(x);
-                        using YT = decltype(y);
-                        using ZT = decltype(z);
-                        constexpr auto X = static_cast<Wrapping>(XT::value);
-                        constexpr auto Y = static_cast<Wrapping>(YT::value);
-                        constexpr auto Z = static_cast<Wrapping>(ZT::value);
-                        voronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp, volRep);
-                    };
-                });
-            });
-        });
-
-        table[static_cast<size_t>(wrapping[0])][static_cast<size_t>(wrapping[1])]
-             [static_cast<size_t>(wrapping[2])](volumeDimensions, indexToDataMatrix,
-                                                dataToModelMatrix, dataSeedPointsWithIndices,
-                                                *voronoiVolumeRep);
+        detail::voronoiSegmentationImpl<3>(volumeDimensions, indexToDataMatrix,
+                                           dataToModelMatrix, dataSeedPointsWithIndices, wrapping,
+                                           {}, *voronoiVolumeRep);
     }
 
     return voronoiVolume;
@@ -67,6 +67,8 @@
 #include <modules/base/io/datvolumewriter.h>          // for DatVolumeWriter
 #include <modules/base/io/ivfvolumereader.h>          // for IvfVolumeReader
 #include <modules/base/io/ivfvolumewriter.h>          // for IvfVolumeWriter
+#include <modules/base/io/ivmmeshreader.h>            // for IvmMeshReader
+#include <modules/base/io/ivmmeshwriter.h>            // for IvmMeshWriter
 #include <modules/base/io/stlwriter.h>                // for StlWriter
 #include <modules/base/io/wavefrontwriter.h>          // for WaveFrontWriter
 // Processors
@@ -141,6 +143,7 @@
 #include <modules/base/processors/volumecurlcpuprocessor.h>                  // for VolumeCurlCP...
 #include <modules/base/processors/volumedivergencecpuprocessor.h>            // for VolumeDiverg...
 #include <modules/base/processors/volumeexport.h>                            // for VolumeExport
+#include <modules/base/processors/volumeexpression.h>                        // for VolumeExpres...
 #include <modules/base/processors/volumegradientcpuprocessor.h>              // for VolumeGradie...
 #include <modules/base/processors/volumehistogram2d.h>                       // for VolumeHistog...
 #include <modules/base/processors/volumeinformation.h>                       // for VolumeInform...
@@ -282,6 +285,7 @@ BaseModule::BaseModule(InviwoApplication* app) : InviwoModule(app, "Base") {
     registerProcessor<VolumeDivergenceCPUProcessor>();
     registerProcessor<VolumeDownsample>();
     registerProcessor<VolumeExport>();
+    registerProcessor<VolumeExpression>();
     registerProcessor<VolumeGradientCPUProcessor>();
     registerProcessor<VolumeInformation>();
     registerProcessor<VolumeLaplacianProcessor>();
@@ -344,7 +348,9 @@ BaseModule::BaseModule(InviwoApplication* app) : InviwoModule(app, "Base") {
     registerDataWriter(std::make_unique<StlWriter>());
     registerDataWriter(std::make_unique<BinarySTLWriter>());
     registerDataWriter(std::make_unique<WaveFrontWriter>());
+    registerDataWriter(std::make_unique<IvmMeshWriter>());
     registerDataReader(std::make_unique<AmiraMeshReader>());
+    registerDataReader(std::make_unique<IvmMeshReader>());
     registerDataReader(std::make_unique<AmiraVolumeReader>());
 
     registerDataVisualizer(std::make_unique<ImageInformationVisualizer>(app));
@@ -0,0 +1,84 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/datastructures/volumeslicecache.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>      // for Volume
+#include <inviwo/core/datastructures/volume/volumedisk.h>  // for VolumeDisk
+#include <inviwo/core/datastructures/volume/volumeram.h>   // for VolumeRAM
+#include <inviwo/core/io/volumeregionloader.h>             // for loadVolumeRegion
+#include <inviwo/core/util/glmvec.h>                       // for size3_t
+
+#include <algorithm>  // for find_if, rotate
+#include <cstddef>    // for ptrdiff_t
+
+namespace inviwo {
+
+VolumeSliceCache::VolumeSliceCache(size_t capacity) : capacity_{capacity} {}
+
+std::shared_ptr<const VolumeRAM> VolumeSliceCache::get(const std::shared_ptr<const Volume>& volume,
+                                                       CartesianCoordinateAxis axis,
+                                                       size_t slice) {
+    // Slices read earlier are stale once the volume has been loaded or edited
+    if (!volume || volume_.lock() != volume || volume->hasValidRepresentation<VolumeRAM>() ||
+        !volume->hasValidRepresentation<VolumeDisk>()) {
+        clear();
+        volume_ = volume;
+    }
+
+    auto it = std::find_if(entries_.begin(), entries_.end(), [&](const Entry& entry) {
+        return entry.axis == axis && entry.slice == slice;
+    });
+    if (it != entries_.end()) {
+        std::rotate(entries_.begin(), it, it + 1);
+        return entries_.front().ram;
+    }
+
+    if (!volume) return nullptr;
+
+    const auto dim = static_cast<size_t>(axis);
+    size3_t offset{0};
+    size3_t dims = volume->getDimensions();
+    if (slice >= dims[dim]) return nullptr;
+    offset[dim] = slice;
+    dims[dim] = 1;
+
+    auto ram = util::loadVolumeRegion(*volume, offset, dims);
+    if (!ram) return nullptr;
+
+    entries_.insert(entries_.begin(), Entry{axis, slice, ram});
+    if (entries_.size() > capacity_) {
+        entries_.erase(entries_.begin() + static_cast<std::ptrdiff_t>(capacity_), entries_.end());
+    }
+    return ram;
+}
+
+void VolumeSliceCache::clear() { entries_.clear(); }
+
+}  // namespace inviwo
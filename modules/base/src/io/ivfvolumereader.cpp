@@ -39,6 +39,7 @@
 #include <inviwo/core/datastructures/unitsystem.h>
 #include <inviwo/core/io/datareader.h>
 #include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/io/chunkedvolumeramloader.h>
 #include <inviwo/core/io/inviwofileformattypes.h>
 #include <inviwo/core/io/serialization/deserializer.h>            // for Deserializer
 #include <inviwo/core/io/serialization/serializationexception.h>  // for SerializationException
@@ -195,6 +196,8 @@ std::shared_ptr<VolumeSequence> readIvfFile(const std::filesystem::path& filePat
     d.deserialize("ByteOffset", byteOffset);
     d.deserialize("ByteOrder", byteOrder);
     d.deserialize("Compression", compression);
+    bool chunked = false;
+    d.deserialize("Chunked", chunked);
 
     std::string formatFlag;
     const DataFormatBase* format = nullptr;
@@ -242,9 +245,12 @@ std::shared_ptr<VolumeSequence> readIvfFile(const std::filesystem::path& filePat
 
         auto volumeDisk = std::make_shared<VolumeDisk>(fileDirectory / path, dimensions, format,
                                                        swizzleMask, interpolation, wrapping);
-        auto loader = std::make_unique<RawVolumeRAMLoader>(fileDirectory / path, byteOffset,
-                                                           byteOrder, compression);
-        volumeDisk->setLoader(loader.release());
+        if (chunked) {
+            volumeDisk->setLoader(new ChunkedVolumeRAMLoader(fileDirectory / path));
+        } else {
+            volumeDisk->setLoader(new RawVolumeRAMLoader(fileDirectory / path, byteOffset,
+                                                         byteOrder, compression));
+        }
         volume->addRepresentation(volumeDisk);
     }
 
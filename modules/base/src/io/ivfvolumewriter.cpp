@@ -38,6 +38,7 @@
 #include <inviwo/core/datastructures/unitsystem.h>
 #include <inviwo/core/io/inviwofileformattypes.h>
 #include <inviwo/core/io/bytewriterutil.h>
+#include <inviwo/core/io/chunkedvolumefile.h>
 #include <inviwo/core/io/datawriter.h>                // for DataWriterType
 #include <inviwo/core/io/datawriterexception.h>       // for DataWriterException
 #include <inviwo/core/io/serialization/serializer.h>  // for Serializer
@@ -80,7 +81,36 @@ IvfVolumeWriter& IvfVolumeWriter::operator=(IvfVolumeWriter&& that) noexcept = d
 IvfVolumeWriter* IvfVolumeWriter::clone() const { return new IvfVolumeWriter(*this); }
 
 void IvfVolumeWriter::writeData(const Volume* volume, const std::filesystem::path& filePath) const {
-    util::writeIvfVolume(*volume, filePath, getOverwrite());
+    if (chunked_) {
+        util::writeChunkedIvfVolume(*volume, filePath, chunkedSettings_, getOverwrite());
+    } else {
+        util::writeIvfVolume(*volume, filePath, getOverwrite());
+    }
+}
+
+bool IvfVolumeWriter::setOption(std::string_view key, std::any value) {
+    if (auto* chunked = std::any_cast<bool>(&value); chunked && key == "Chunked") {
+        chunked_ = *chunked;
+        return true;
+    } else if (auto* dims = std::any_cast<size3_t>(&value); dims && key == "ChunkDimensions") {
+        chunkedSettings_.chunkDimensions = *dims;
+        return true;
+    } else if (auto* level = std::any_cast<int>(&value); level && key == "CompressionLevel") {
+        chunkedSettings_.level = *level;
+        return true;
+    }
+    return false;
+}
+
+std::any IvfVolumeWriter::getOption(std::string_view key) const {
+    if (key == "Chunked") {
+        return chunked_;
+    } else if (key == "ChunkDimensions") {
+        return chunkedSettings_.chunkDimensions;
+    } else if (key == "CompressionLevel") {
+        return chunkedSettings_.level;
+    }
+    return std::any{};
 }
 
 IvfVolumeSequenceWriter::IvfVolumeSequenceWriter() : DataWriterType<VolumeSequence>() {
@@ -109,10 +139,13 @@ void IvfVolumeSequenceWriter::writeData(const VolumeSequence* volumes,
 
 namespace util {
 
-void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath,
-                    Overwrite overwrite) {
-    const Compression compression = Compression::Enabled;
-    const std::string_view extension = compression == Compression::Enabled ? "raw.gz" : "raw";
+namespace {
+
+void writeIvfVolumeImpl(const Volume& data, const std::filesystem::path& filePath,
+                        Overwrite overwrite, const ChunkedVolumeSettings* chunked) {
+    const Compression compression = chunked ? Compression::Disabled : Compression::Enabled;
+    const std::string_view extension =
+        chunked ? "ivc" : (compression == Compression::Enabled ? "raw.gz" : "raw");
     const auto rawPath = filesystem::replaceFileExtension(filePath, extension);
 
     DataWriter::checkOverwrite(filePath, overwrite);
@@ -133,6 +166,7 @@ void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath,
     s.serialize("ByteOffset", 0u);
     s.serialize("ByteOrder", ByteOrder::LittleEndian);
     s.serialize("Compression", compression);
+    if (chunked) s.serialize("Chunked", true);
     s.serialize("BasisAndOffset", data.getModelMatrix());
     s.serialize("WorldTransform", data.getWorldMatrix());
     s.serialize("Dimension", data.getDimensions());
@@ -156,8 +190,25 @@ void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath,
 
     s.writeFile();
 
-    const size_t bytes = glm::compMul(vr->getDimensions()) * vr->getDataFormat()->getSizeInBytes();
-    util::writeBytes(rawPath, vr->getData(), bytes, compression);
+    if (chunked) {
+        util::writeChunkedVolume(rawPath, *vr, *chunked);
+    } else {
+        const size_t bytes =
+            glm::compMul(vr->getDimensions()) * vr->getDataFormat()->getSizeInBytes();
+        util::writeBytes(rawPath, vr->getData(), bytes, compression);
+    }
+}
+
+}  // namespace
+
+void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath,
+                    Overwrite overwrite) {
+    writeIvfVolumeImpl(data, filePath, overwrite, nullptr);
+}
+
+void writeChunkedIvfVolume(const Volume& data, const std::filesystem::path& filePath,
+                           const ChunkedVolumeSettings& chunked, Overwrite overwrite) {
+    writeIvfVolumeImpl(data, filePath, overwrite, &chunked);
 }
 
 namespace {
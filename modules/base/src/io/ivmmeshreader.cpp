@@ -0,0 +1,202 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/io/ivmmeshreader.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>          // for Buffer, IndexBuffer
+#include <inviwo/core/datastructures/buffer/bufferram.h>       // for BufferRAMPrecision
+#include <inviwo/core/datastructures/geometry/geometrytype.h>  // for BufferType, DrawType
+#include <inviwo/core/datastructures/geometry/mesh.h>          // for Mesh
+#include <inviwo/core/io/datareader.h>                         // for DataReaderType
+#include <inviwo/core/io/datareaderexception.h>                // for DataReaderException
+#include <inviwo/core/io/memorymappedfile.h>                   // for MemoryMappedFile
+#include <inviwo/core/util/fileextension.h>                    // for FileExtension
+#include <inviwo/core/util/formatdispatching.h>                // for singleDispatch
+#include <inviwo/core/util/formats.h>                          // for DataFormatBase
+#include <inviwo/core/util/parallel.h>                         // for parallelFor
+#include <modules/base/io/ivmmeshformat.h>                     // for FileHeader, ChunkHeader
+
+#include <algorithm>    // for min, find
+#include <cstddef>      // for byte
+#include <cstring>      // for memcpy
+#include <fstream>      // for ifstream
+#include <span>         // for span
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include <fmt/std.h>
+
+namespace inviwo {
+
+namespace {
+
+template <typename T>
+T get(std::span<const std::byte> data, std::uint64_t offset) {
+    if (offset > data.size() || data.size() - offset < sizeof(T)) {
+        throw DataReaderException(SourceContext{}, "Unexpected end of file at offset {}", offset);
+    }
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    return value;
+}
+
+std::span<const std::byte> blob(std::span<const std::byte> payload, std::uint64_t offset,
+                                std::uint64_t bytes) {
+    if (offset > payload.size() || payload.size() - offset < bytes) {
+        throw DataReaderException(SourceContext{}, "Data outside of its chunk");
+    }
+    return payload.subspan(offset, bytes);
+}
+
+/**
+ * Copy in chunks in parallel, when reading from a memory mapping this also means that the pages
+ * are loaded from disk in parallel.
+ */
+void copyBlob(std::span<const std::byte> src, void* dst) {
+    constexpr size_t grain = size_t{1} << 24;
+    util::parallelFor(
+        0, (src.size() + grain - 1) / grain,
+        [&](size_t i) {
+            const auto first = i * grain;
+            std::memcpy(static_cast<std::byte*>(dst) + first, src.data() + first,
+                        std::min(grain, src.size() - first));
+        },
+        {.grainSize = 1});
+}
+
+template <typename T, BufferTarget Target>
+std::shared_ptr<BufferBase> createBuffer(std::span<const std::byte> data, size_t size,
+                                         BufferUsage usage) {
+    auto ram = std::make_shared<BufferRAMPrecision<T, Target>>(size, usage);
+    copyBlob(data, ram->getData());
+    return std::make_shared<Buffer<T, Target>>(ram);
+}
+
+std::shared_ptr<Mesh> readIvm(std::span<const std::byte> data) {
+    const auto header = get<ivm::FileHeader>(data, 0);
+    if (header.magic != ivm::magic) {
+        throw DataReaderException(SourceContext{}, "Not an ivm mesh file");
+    }
+    if (header.version > ivm::version) {
+        throw DataReaderException(SourceContext{}, "Unsupported ivm version {}, expected {}",
+                                  header.version, ivm::version);
+    }
+
+    auto mesh = std::make_shared<Mesh>();
+    std::uint64_t pos = sizeof(ivm::FileHeader);
+    for (std::uint64_t chunk = 0; chunk < header.chunks; ++chunk) {
+        const auto chunkHeader = get<ivm::ChunkHeader>(data, pos);
+        pos += sizeof(ivm::ChunkHeader);
+        if (pos > data.size() || data.size() - pos < chunkHeader.size) {
+            throw DataReaderException(SourceContext{}, "Unexpected end of file in chunk {}",
+                                      chunk);
+        }
+        const auto payload = data.subspan(pos, chunkHeader.size);
+        pos += chunkHeader.size;
+
+        switch (chunkHeader.type) {
+            case ivm::ChunkType::Mesh: {
+                const auto info = get<ivm::MeshChunk>(payload, 0);
+                mesh->setModelMatrix(info.modelMatrix);
+                mesh->setWorldMatrix(info.worldMatrix);
+                break;
+            }
+            case ivm::ChunkType::Buffer: {
+                const auto info = get<ivm::BufferChunk>(payload, 0);
+                const auto name = std::string_view{
+                    info.format.data(),
+                    std::find(info.format.begin(), info.format.end(), '\0')};
+                const auto* format = DataFormatBase::get(name);
+                const auto usage = static_cast<BufferUsage>(info.usage);
+                const auto bytes = blob(payload, info.offset, info.size * format->getSizeInBytes());
+
+                auto buffer = dispatching::singleDispatch<std::shared_ptr<BufferBase>,
+                                                          dispatching::filter::All>(
+                    format->getId(), [&]<typename T>() {
+                        if (static_cast<BufferTarget>(info.target) == BufferTarget::Index) {
+                            return createBuffer<T, BufferTarget::Index>(bytes, info.size, usage);
+                        } else {
+                            return createBuffer<T, BufferTarget::Data>(bytes, info.size, usage);
+                        }
+                    });
+                mesh->addBuffer(Mesh::BufferInfo{static_cast<BufferType>(info.type), info.location},
+                                buffer);
+                break;
+            }
+            case ivm::ChunkType::Indices: {
+                const auto info = get<ivm::IndexChunk>(payload, 0);
+                const auto bytes = blob(payload, info.offset, info.size * sizeof(std::uint32_t));
+                auto indices = std::static_pointer_cast<IndexBuffer>(
+                    createBuffer<std::uint32_t, BufferTarget::Index>(
+                        bytes, info.size, static_cast<BufferUsage>(info.usage)));
+                mesh->addIndices(Mesh::MeshInfo{static_cast<DrawType>(info.drawType),
+                                                static_cast<ConnectivityType>(info.connectivity)},
+                                 indices);
+                break;
+            }
+            default:
+                // Unknown chunks are from a later version and safe to skip
+                break;
+        }
+    }
+    return mesh;
+}
+
+}  // namespace
+
+IvmMeshReader::IvmMeshReader() : DataReaderType<Mesh>() {
+    addExtension(FileExtension("ivm", "Inviwo binary mesh file format"));
+}
+
+IvmMeshReader* IvmMeshReader::clone() const { return new IvmMeshReader(*this); }
+
+std::shared_ptr<Mesh> IvmMeshReader::readData(const std::filesystem::path& filePath) {
+    const auto localPath = downloadAndCacheIfUrl(filePath);
+    checkExists(localPath);
+
+    const auto size = static_cast<size_t>(std::filesystem::file_size(localPath));
+    if (size < sizeof(ivm::FileHeader)) {
+        throw DataReaderException(SourceContext{}, "Not an ivm mesh file: {}", localPath);
+    }
+
+    if (util::MemoryMappedFile::isMappable(localPath)) {
+        const util::MemoryMappedFile file{localPath, 0, size};
+        return readIvm(file.view());
+    } else {
+        std::vector<std::byte> data(size);
+        auto in = open(localPath, std::ios_base::in | std::ios_base::binary);
+        in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(size));
+        if (!in) {
+            throw DataReaderException(SourceContext{}, "Unable to read {}", localPath);
+        }
+        return readIvm(data);
+    }
+}
+
+}  // namespace inviwo
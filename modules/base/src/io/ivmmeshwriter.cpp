@@ -0,0 +1,143 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/io/ivmmeshwriter.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>          // for BufferBase, IndexBuffer
+#include <inviwo/core/datastructures/buffer/bufferram.h>       // for BufferRAM
+#include <inviwo/core/datastructures/geometry/geometrytype.h>  // for BufferType, DrawType
+#include <inviwo/core/datastructures/geometry/mesh.h>          // for Mesh
+#include <inviwo/core/io/datawriter.h>                         // for DataWriterType
+#include <inviwo/core/io/datawriterexception.h>                // for DataWriterException
+#include <inviwo/core/util/fileextension.h>                    // for FileExtension
+#include <inviwo/core/util/formats.h>                          // for DataFormatBase
+#include <modules/base/io/ivmmeshformat.h>                     // for FileHeader, ChunkHeader
+
+#include <algorithm>  // for copy
+#include <array>      // for array
+#include <cstdint>    // for uint64_t
+#include <fstream>    // for ofstream
+#include <sstream>    // for stringstream
+#include <utility>    // for move
+
+namespace inviwo {
+
+IvmMeshWriter::IvmMeshWriter() : DataWriterType<Mesh>() {
+    addExtension(FileExtension("ivm", "Inviwo binary mesh file format"));
+}
+
+IvmMeshWriter* IvmMeshWriter::clone() const { return new IvmMeshWriter(*this); }
+
+void IvmMeshWriter::writeData(const Mesh* data, const std::filesystem::path& filePath) const {
+    auto f = open(filePath, std::ios_base::out | std::ios_base::binary);
+    writeData(data, f);
+}
+
+std::unique_ptr<std::vector<unsigned char>> IvmMeshWriter::writeDataToBuffer(
+    const Mesh* data, std::string_view /*fileExtension*/) const {
+    std::stringstream ss(std::ios_base::out | std::ios_base::binary);
+    writeData(data, ss);
+    auto stringdata = std::move(ss).str();
+    return std::make_unique<std::vector<unsigned char>>(stringdata.begin(), stringdata.end());
+}
+
+void IvmMeshWriter::writeData(const Mesh* data, std::ostream& os) const {
+    std::uint64_t pos = 0;
+    const auto write = [&](const void* ptr, std::uint64_t bytes) {
+        os.write(static_cast<const char*>(ptr), static_cast<std::streamsize>(bytes));
+        pos += bytes;
+    };
+    const auto pad = [&]() {
+        static constexpr std::array<char, ivm::alignment> zeros{};
+        write(zeros.data(), ivm::padding(pos));
+    };
+    // A chunk with a description followed by an aligned data blob, see ivm::BufferChunk
+    const auto writeBlob = [&](ivm::ChunkType type, auto description, const void* blob,
+                               std::uint64_t bytes) {
+        const auto payload = pos + sizeof(ivm::ChunkHeader);
+        const auto descriptionEnd = payload + sizeof(description);
+        description.offset = descriptionEnd + ivm::padding(descriptionEnd) - payload;
+        const auto payloadEnd = payload + description.offset + bytes;
+        const ivm::ChunkHeader header{type, 0, payloadEnd + ivm::padding(payloadEnd) - payload};
+        write(&header, sizeof(header));
+        write(&description, sizeof(description));
+        pad();
+        write(blob, bytes);
+        pad();
+    };
+
+    const auto& buffers = data->getBuffers();
+    const auto& indexBuffers = data->getIndexBuffers();
+
+    const ivm::FileHeader fileHeader{ivm::magic, ivm::version,
+                                     1 + buffers.size() + indexBuffers.size()};
+    write(&fileHeader, sizeof(fileHeader));
+
+    const ivm::MeshChunk mesh{data->getModelMatrix(), data->getWorldMatrix()};
+    const ivm::ChunkHeader meshHeader{ivm::ChunkType::Mesh, 0, sizeof(mesh)};
+    write(&meshHeader, sizeof(meshHeader));
+    write(&mesh, sizeof(mesh));
+
+    for (const auto& [info, buffer] : buffers) {
+        const auto* ram = buffer->getRepresentation<BufferRAM>();
+        const auto* format = ram->getDataFormat();
+        ivm::BufferChunk description{static_cast<std::int32_t>(info.type),
+                                     info.location,
+                                     static_cast<std::int32_t>(buffer->getBufferUsage()),
+                                     static_cast<std::int32_t>(buffer->getBufferTarget()),
+                                     {},
+                                     static_cast<std::uint64_t>(ram->getSize()),
+                                     0};
+        const auto name = format->getString();
+        if (name.size() >= description.format.size()) {
+            throw DataWriterException(SourceContext{}, "Unsupported buffer format {}", name);
+        }
+        std::copy(name.begin(), name.end(), description.format.begin());
+        writeBlob(ivm::ChunkType::Buffer, description, ram->getData(),
+                  ram->getSize() * format->getSizeInBytes());
+    }
+
+    for (const auto& [info, indices] : indexBuffers) {
+        const auto* ram = indices->getRAMRepresentation();
+        const ivm::IndexChunk description{static_cast<std::int32_t>(info.dt),
+                                          static_cast<std::int32_t>(info.ct),
+                                          static_cast<std::int32_t>(indices->getBufferUsage()),
+                                          0,
+                                          static_cast<std::uint64_t>(ram->getSize()),
+                                          0};
+        writeBlob(ivm::ChunkType::Indices, description, ram->getData(),
+                  ram->getSize() * sizeof(std::uint32_t));
+    }
+
+    if (!os) {
+        throw DataWriterException(SourceContext{}, "Error writing mesh");
+    }
+}
+
+}  // namespace inviwo
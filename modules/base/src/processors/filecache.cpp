@@ -34,12 +34,70 @@
 #include <inviwo/core/links/propertylink.h>
 
 #include <inviwo/core/io/serialization/ticpp.h>
+#include <inviwo/core/util/hashcombine.h>
 
 #include <unordered_set>
 #include <memory_resource>
 
 namespace inviwo {
 
+namespace {
+
+// Remove the processor meta data, like positions, and paths that do not affect the state
+void removeVolatileState(TiXmlElement* root, const std::filesystem::path& refPath) {
+    const auto remove = [](TiXmlElement* elem, const auto& check, const auto& self) -> void {
+        TiXmlElement* child = elem->FirstChildElement();
+        while (child) {
+            auto* curr = child;
+            child = child->NextSiblingElement();
+
+            if (check(curr, elem)) {
+                elem->RemoveChild(curr);
+            } else {
+                self(curr, check, self);
+            }
+        }
+    };
+    remove(
+        root,
+        [](TiXmlElement* current, TiXmlElement*) -> bool {
+            return current->Value() == "MetaDataItem" &&
+                   current->Attribute("type")
+                       .transform([](std::string_view value) {
+                           return value == "org.inviwo.ProcessorMetaData";
+                       })
+                       .value_or(false);
+        },
+        remove);
+
+    // remove all ivwdataRelativePath paths
+    remove(
+        root,
+        [](TiXmlElement* current, TiXmlElement*) -> bool {
+            return current->Value() == "ivwdataRelativePath";
+        },
+        remove);
+
+    if (!refPath.empty()) {
+        // remove absolutePath if we have workspaceRelativePaths
+        remove(
+            root,
+            [](TiXmlElement* current, TiXmlElement* parent) -> bool {
+                if (current->Value() == "absolutePath") {
+                    if (auto* rp = parent->FirstChildElement("workspaceRelativePath")) {
+                        return rp->Attribute("content")
+                            .transform([](std::string_view value) { return !value.empty(); })
+                            .value_or(false);
+                    }
+                }
+                return false;
+            },
+            remove);
+    }
+}
+
+}  // namespace
+
 namespace detail {
 
 std::string cacheState(Processor* processor, ProcessorNetwork& net,
@@ -97,60 +155,105 @@ std::string cacheState(Processor* processor, ProcessorNetwork& net,
             link.getDestination()->getPath(nested.addAttribute("dst"));
         });
 
-    const auto remove = [](TiXmlElement* elem, const auto& check, const auto& self) -> void {
-        TiXmlElement* child = elem->FirstChildElement();
-        while (child) {
-            auto* curr = child;
-            child = child->NextSiblingElement();
+    removeVolatileState(s.doc().RootElement(), refPath);
 
-            if (check(curr, elem)) {
-                elem->RemoveChild(curr);
-            } else {
-                self(curr, check, self);
-            }
-        }
-    };
-    remove(
-        s.doc().RootElement(),
-        [](TiXmlElement* current, TiXmlElement*) -> bool {
-            return current->Value() == "MetaDataItem" &&
-                   current->Attribute("type")
-                       .transform([](std::string_view value) {
-                           return value == "org.inviwo.ProcessorMetaData";
-                       })
-                       .value_or(false);
-        },
-        remove);
+    xml.clear();
+    s.write(xml);
 
-    // remove all ivwdataRelativePath paths
-    remove(
-        s.doc().RootElement(),
-        [](TiXmlElement* current, TiXmlElement*) -> bool {
-            return current->Value() == "ivwdataRelativePath";
-        },
-        remove);
+    return {fmt::format("{:016X}", std::hash<std::string_view>{}(xml))};
+}
 
-    if (!refPath.empty()) {
-        // remove absolutePath if we have workspaceRelativePaths
-        remove(
-            s.doc().RootElement(),
-            [](TiXmlElement* current, TiXmlElement* parent) -> bool {
-                if (current->Value() == "absolutePath") {
-                    if (auto* rp = parent->FirstChildElement("workspaceRelativePath")) {
-                        return rp->Attribute("content")
-                            .transform([](std::string_view value) { return !value.empty(); })
-                            .value_or(false);
-                    }
-                }
-                return false;
-            },
-            remove);
+CacheStateTracker::CacheStateTracker(Processor* owner) : owner_{owner} {}
+
+std::string CacheStateTracker::key(const std::filesystem::path& refPath) {
+    auto* network = owner_->getNetwork();
+    if (network_ != network) {
+        if (network_) network_->removeObserver(this);
+        network_ = network;
+        if (network_) network_->addObserver(this);
+        hashes_.clear();
     }
+    if (refPath_ != refPath) {
+        refPath_ = refPath;
+        hashes_.clear();
+    }
+    return fmt::format("{:016X}", combined(owner_));
+}
 
-    xml.clear();
+auto CacheStateTracker::hashes(Processor* processor) -> Hashes& {
+    auto [it, inserted] = hashes_.try_emplace(processor);
+    if (inserted) processor->ProcessorObservable::addObserver(this);
+    return it->second;
+}
+
+size_t CacheStateTracker::state(Processor* processor) {
+    if (auto hash = hashes(processor).state) return *hash;
+
+    std::pmr::monotonic_buffer_resource mbr{1024 * 8};
+    Serializer s{refPath_, SerializeConstants::InviwoWorkspace, &mbr};
+    s.setWorkspaceSaveMode(WorkspaceSaveMode::Undo);
+    s.serialize("Processor", *processor);
+    removeVolatileState(s.doc().RootElement(), refPath_);
+    std::pmr::string xml{&mbr};
     s.write(xml);
 
-    return {fmt::format("{:016X}", std::hash<std::string_view>{}(xml))};
+    const auto hash = std::hash<std::string_view>{}(xml);
+    hashes(processor).state = hash;
+    return hash;
+}
+
+size_t CacheStateTracker::combined(Processor* processor) {
+    if (auto hash = hashes(processor).combined) return *hash;
+
+    // The state of the caching processor itself does not affect the cached data
+    size_t hash = processor == owner_ ? 0 : state(processor);
+    for (auto* inport : processor->getInports()) {
+        util::hash_combine(hash, inport->getIdentifier());
+        for (auto* outport : inport->getConnectedOutports()) {
+            util::hash_combine(hash, outport->getIdentifier());
+            util::hash_combine(hash, combined(outport->getProcessor()));
+        }
+    }
+    // The recursion might have rehashed the map, look the entry up again
+    hashes(processor).combined = hash;
+    return hash;
+}
+
+void CacheStateTracker::invalidateDownstream(Processor* processor) {
+    auto it = hashes_.find(processor);
+    // A processor without a combined hash has no downstream processors with one either
+    if (it == hashes_.end() || !it->second.combined) return;
+    it->second.combined.reset();
+
+    for (auto* outport : processor->getOutports()) {
+        for (auto* inport : outport->getConnectedInports()) {
+            invalidateDownstream(inport->getProcessor());
+        }
+    }
+}
+
+void CacheStateTracker::onAboutPropertyChange(Property* property) {
+    // A nullptr means a change that does not affect the outcome, like the visibility
+    if (!property) return;
+    if (auto* processor = property->getOwner()->getProcessor()) {
+        if (auto it = hashes_.find(processor); it != hashes_.end()) {
+            it->second.state.reset();
+            invalidateDownstream(processor);
+        }
+    }
+}
+
+void CacheStateTracker::onProcessorNetworkWillRemoveProcessor(Processor* processor) {
+    invalidateDownstream(processor);
+    hashes_.erase(processor);
+}
+
+void CacheStateTracker::onProcessorNetworkDidAddConnection(const PortConnection& connection) {
+    invalidateDownstream(connection.getInport()->getProcessor());
+}
+
+void CacheStateTracker::onProcessorNetworkDidRemoveConnection(const PortConnection& connection) {
+    invalidateDownstream(connection.getInport()->getProcessor());
 }
 
 }  // namespace detail
@@ -165,7 +268,8 @@ CacheBase::CacheBase(InviwoApplication* app)
     , refDir_{"refDir", "Reference Dir",
               "Any paths are hashed relative to this path, "
               "instead of the absolute path, if set"_help}
-    , currentKey_{"key", "Hashed State", "", InvalidationLevel::Valid} {
+    , currentKey_{"key", "Hashed State", "", InvalidationLevel::Valid}
+    , tracker_{this} {
 
     isReady_.setUpdate([this]() {
         if (getInports().empty()) return true;
@@ -185,7 +289,7 @@ CacheBase::CacheBase(InviwoApplication* app)
 void CacheBase::onProcessorNetworkEvaluationBegin() {
     if (isValid()) return;
 
-    key_ = detail::cacheState(this, *getNetwork(), refDir_.get(), xml_);
+    key_ = tracker_.key(refDir_.get());
     currentKey_.set(key_);
 
     const auto isCached = hasCache(key_) && enabled_;
@@ -206,8 +310,8 @@ bool CacheBase::isConnectionActive(Inport* inport, Outport*) const {
 }
 
 void CacheBase::invalidate(InvalidationLevel invalidationLevel, Property* modifiedProperty) {
-    if (auto* net = getNetwork()) {
-        auto key = detail::cacheState(this, *net, refDir_.get(), xml_);
+    if (getNetwork()) {
+        auto key = tracker_.key(refDir_.get());
         if (modifiedProperty == nullptr && key == loadedKey()) {
             return;
         }
@@ -216,8 +320,9 @@ void CacheBase::invalidate(InvalidationLevel invalidationLevel, Property* modifi
     Processor::invalidate(invalidationLevel, modifiedProperty);
 }
 
-void CacheBase::writeXML() const {
+void CacheBase::writeXML() {
     if (!cacheDir_.get().empty()) {
+        detail::cacheState(this, *getNetwork(), refDir_.get(), xml_);
         if (auto f = std::ofstream(cacheDir_.get() / fmt::format("{}.inv", key_))) {
             f << xml_;
         } else {
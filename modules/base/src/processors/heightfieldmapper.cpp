@@ -45,7 +45,9 @@
 #include <inviwo/core/properties/optionproperty.h>                      // for OptionPropertyOption
 #include <inviwo/core/properties/ordinalproperty.h>                     // for FloatProperty
 #include <inviwo/core/util/formats.h>                                   // for DataFormatBase
+#include <inviwo/core/util/glmconvert.h>                                // for glm_convert_no...
 #include <inviwo/core/util/glmvec.h>                                    // for size2_t, dvec2
+#include <inviwo/core/util/imageramutils.h>                             // for forEachPixelValue
 #include <inviwo/core/util/logcentral.h>                                // for LogCentral
 
 #include <algorithm>      // for copy, max, max_el...
@@ -158,41 +160,11 @@ void HeightFieldMapper::process() {
         const float* srcData = static_cast<const float*>(srcLayer->getData());
         std::copy(srcData, srcData + dim.x * dim.y, data);
     } else {
-        switch (numInputChannels) {
-            case 2:
-                for (unsigned int y = 0; y < dim.y; ++y) {
-                    for (unsigned int x = 0; x < dim.x; ++x) {
-                        data[y * dim.x + x] =
-                            static_cast<float>(srcLayer->getAsNormalizedDVec2(glm::uvec2(x, y)).r);
-                    }
-                }
-                break;
-            case 3:
-                for (unsigned int y = 0; y < dim.y; ++y) {
-                    for (unsigned int x = 0; x < dim.x; ++x) {
-                        data[y * dim.x + x] =
-                            static_cast<float>(srcLayer->getAsNormalizedDVec3(glm::uvec2(x, y)).r);
-                    }
-                }
-                break;
-            case 4:
-                for (unsigned int y = 0; y < dim.y; ++y) {
-                    for (unsigned int x = 0; x < dim.x; ++x) {
-                        data[y * dim.x + x] =
-                            static_cast<float>(srcLayer->getAsNormalizedDVec4(glm::uvec2(x, y)).r);
-                    }
-                }
-                break;
-            case 1:
-            default:
-                for (unsigned int y = 0; y < dim.y; ++y) {
-                    for (unsigned int x = 0; x < dim.x; ++x) {
-                        data[y * dim.x + x] =
-                            static_cast<float>(srcLayer->getAsNormalizedDouble(glm::uvec2(x, y)));
-                    }
-                }
-                break;
-        }
+        // use the normalized first channel of the input
+        util::forEachPixelValue(*srcLayer, [&](const auto& value, const size2_t& pos) {
+            data[pos.y * dim.x + pos.x] =
+                static_cast<float>(util::glm_convert_normalized<double>(value));
+        });
     }
 
     // rescale data set
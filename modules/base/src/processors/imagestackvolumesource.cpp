@@ -55,9 +55,9 @@
 #include <inviwo/core/util/glmconvert.h>                        // for glm_convert_norma...
 #include <inviwo/core/util/glmvec.h>                            // for vec3, dvec2, size2_t
 #include <inviwo/core/util/logcentral.h>                        // for LogCentral, LogPr...
+#include <inviwo/core/util/parallel.h>                          // for parallelFor
 #include <inviwo/core/util/raiiutils.h>                         // for OnScopeExit, OnSc...
 #include <inviwo/core/util/statecoordinator.h>                  // for StateCoordinator
-#include <inviwo/core/util/zip.h>                               // for zipper, enumerate
 #include <modules/base/properties/basisproperty.h>              // for BasisProperty
 #include <modules/base/properties/volumeinformationproperty.h>  // for VolumeInformation...
 
@@ -201,6 +201,7 @@ std::shared_ptr<Volume> ImageStackVolumeSource::load() {
                         filePattern_.getFilePatternPath());
     }
 
+    const auto firstSlice = static_cast<size_t>(std::distance(slices.begin(), first));
     const auto referenceLayer = first->second->readData(first->first);
 
     // Call getRepresentation here to enforce creating a ram representation.
@@ -244,19 +245,19 @@ std::shared_ptr<Volume> ImageStackVolumeSource::load() {
                 }
             };
 
-            for (auto&& elem : util::enumerate(slices)) {
-                const auto slice = elem.first();
-                const auto file = elem.second().first;
-                auto* reader = elem.second().second.get();
+            // Each slice has its own reader, so the slices can be decoded concurrently. Only the
+            // layers of the slices being processed by the thread pool are kept in memory.
+            util::parallelFor(0, slices.size(), [&](size_t slice) {
+                const auto& [file, reader] = slices[slice];
                 if (!reader) {
                     fill(slice);
-                    continue;
+                    return;
                 }
 
-                const auto layer = read(file, reader);
+                const auto layer = slice == firstSlice ? referenceLayer : read(file, reader.get());
                 if (!layer) {
                     fill(slice);
-                    continue;
+                    return;
                 }
                 const auto* layerRAM = layer->template getRepresentation<LayerRAM>();
 
@@ -266,14 +267,14 @@ std::shared_ptr<Volume> ImageStackVolumeSource::load() {
                     log::warn("Unsupported integer bit depth: {}, for image: {}",
                               format->getPrecision(), file);
                     fill(slice);
-                    continue;
+                    return;
                 }
 
                 if (layerRAM->getDimensions() != layerDims) {
                     log::warn("Unexpected dimensions: {}, expected: {}, for image: {}",
                               layer->getDimensions(), layerDims, file);
                     fill(slice);
-                    continue;
+                    return;
                 }
                 layerRAM->template dispatch<void, FloatOrIntMax32>([&](auto layerpr) {
                     const auto data = layerpr->getDataTyped();
@@ -281,7 +282,7 @@ std::shared_ptr<Volume> ImageStackVolumeSource::load() {
                         data, data + sliceOffset, volData + slice * sliceOffset,
                         [](auto value) { return util::glm_convert_normalized<ValueType>(value); });
                 });
-            }
+            });
 
             auto volume = std::make_shared<Volume>(volumeRAM);
             volume->dataMap.dataRange =
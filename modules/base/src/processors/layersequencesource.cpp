@@ -47,12 +47,15 @@
 #include <inviwo/core/util/fileextension.h>                    // for FileExtension, operator==
 #include <inviwo/core/util/filesystem.h>                       // for fileExists, getDirectoryC...
 #include <inviwo/core/util/logcentral.h>                       // for LogCentral, LogProcessorE...
+#include <inviwo/core/util/parallel.h>                         // for parallelFor
 #include <inviwo/core/util/statecoordinator.h>                 // for StateCoordinator
 #include <inviwo/core/util/staticstring.h>                     // for operator+
 #include <modules/base/processors/datasource.h>                // for updateFilenameFilters
 #include <modules/base/properties/basisproperty.h>             // for BasisProperty
 #include <modules/base/properties/layerinformationproperty.h>  // for VolumeInformationProperty
 
+#include <vector>                                              // for vector
+
 namespace inviwo {
 
 // The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
@@ -195,35 +198,41 @@ void LayerSequenceSource::loadFile(bool deserialize) {
 void LayerSequenceSource::loadFolder(bool deserialize) {
     if (folder_.get().empty()) return;
 
-    layers_ = std::make_shared<LayerSequence>();
-
-    auto files = filesystem::getDirectoryContents(folder_.get());
-    for (auto f : files) {
+    std::vector<std::filesystem::path> files;
+    for (auto f : filesystem::getDirectoryContents(folder_.get())) {
         auto file = folder_.get() / f;
         if (filesystem::wildcardStringMatch(filter_, file.generic_string())) {
-            try {
-                if (auto reader1 = rf_->getReaderForTypeAndExtension<Layer>(file)) {
-                    auto layer = reader1->readData(file, this);
-                    layers_->push_back(layer);
+            files.push_back(std::move(file));
+        }
+    }
 
-                } else if (auto reader2 = rf_->getReaderForTypeAndExtension<LayerSequence>(file)) {
-                    auto layers = reader2->readData(file, this);
-                    for (auto layer : *layers) {
-                        layers_->push_back(layer);
-                    }
-                } else {
-                    log::error("Could not find a data reader for file: {}", file);
-                    layers_.reset();
-                    loadingFailed_ = true;
-                    isReady_.update();
-                }
-            } catch (const DataReaderException& e) {
-                log::exception(e);
-                layers_.reset();
-                loadingFailed_ = true;
-                isReady_.update();
+    // Each file gets its own reader, so the files can be decoded concurrently
+    std::vector<std::vector<std::shared_ptr<Layer>>> loaded(files.size());
+    try {
+        util::parallelFor(0, files.size(), [&](size_t i) {
+            const auto& file = files[i];
+            if (auto reader1 = rf_->getReaderForTypeAndExtension<Layer>(file)) {
+                loaded[i].push_back(reader1->readData(file, this));
+            } else if (auto reader2 = rf_->getReaderForTypeAndExtension<LayerSequence>(file)) {
+                auto layers = reader2->readData(file, this);
+                loaded[i].assign(layers->begin(), layers->end());
+            } else {
+                throw DataReaderException(SourceContext{},
+                                          "Could not find a data reader for file: {}", file);
+            }
+        });
+
+        layers_ = std::make_shared<LayerSequence>();
+        for (auto& layers : loaded) {
+            for (auto& layer : layers) {
+                layers_->push_back(std::move(layer));
             }
         }
+    } catch (const DataReaderException& e) {
+        log::exception(e);
+        layers_.reset();
+        loadingFailed_ = true;
+        isReady_.update();
     }
 
     if (layers_ && !layers_->empty()) {
@@ -29,18 +29,19 @@
 
 #include <modules/base/processors/meshconverterprocessor.h>
 
-#include <inviwo/core/datastructures/geometry/mesh.h>   // for Mesh
-#include <inviwo/core/ports/dataoutport.h>              // for DataOutport
-#include <inviwo/core/ports/inportiterable.h>           // for InportIterable<>::const_iterator
-#include <inviwo/core/ports/meshport.h>                 // for MeshFlatMultiInport
-#include <inviwo/core/ports/outportiterable.h>          // for OutportIterableImpl<>::const_iter...
-#include <inviwo/core/processors/processor.h>           // for Processor
-#include <inviwo/core/processors/processorinfo.h>       // for ProcessorInfo
-#include <inviwo/core/processors/processorstate.h>      // for CodeState, CodeState::Stable
-#include <inviwo/core/processors/processortags.h>       // for Tags, Tags::CPU
-#include <inviwo/core/properties/optionproperty.h>      // for OptionPropertyOption, OptionProperty
-#include <inviwo/core/util/staticstring.h>              // for operator+
-#include <modules/base/algorithm/mesh/meshconverter.h>  // for toLineMesh, toPointMesh
+#include <inviwo/core/datastructures/geometry/mesh.h>      // for Mesh
+#include <inviwo/core/ports/dataoutport.h>                 // for DataOutport
+#include <inviwo/core/ports/inportiterable.h>              // for InportIterable<>::const_iterator
+#include <inviwo/core/ports/meshport.h>                    // for MeshFlatMultiInport
+#include <inviwo/core/ports/outportiterable.h>             // for OutportIterableImpl<>::const_it...
+#include <inviwo/core/processors/processor.h>              // for Processor
+#include <inviwo/core/processors/processorinfo.h>          // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>         // for CodeState, CodeState::Stable
+#include <inviwo/core/processors/processortags.h>          // for Tags, Tags::CPU
+#include <inviwo/core/properties/optionproperty.h>         // for OptionPropertyOption, OptionPro...
+#include <inviwo/core/util/staticstring.h>                 // for operator+
+#include <modules/base/algorithm/mesh/meshconverter.h>     // for toLineMesh, toPointMesh
+#include <modules/base/algorithm/mesh/meshoptimization.h>  // for optimizeVertexOrder
 
 #include <type_traits>  // for remove_extent_t
 #include <utility>      // for move
@@ -56,7 +57,8 @@ const ProcessorInfo MeshConverterProcessor::processorInfo_{
     "Mesh Operation",            // Category
     CodeState::Stable,           // Code state
     Tags::CPU,                   // Tags
-    "Convert a mesh into either a point mesh or a line mesh."_help,
+    R"(Convert a mesh into either a point mesh or a line mesh, or reorder the triangles and
+    vertices of the mesh for faster rendering.)"_unindentHelp,
 };
 const ProcessorInfo& MeshConverterProcessor::getProcessorInfo() const { return processorInfo_; }
 
@@ -66,8 +68,10 @@ MeshConverterProcessor::MeshConverterProcessor()
     , outport_("outport", "Transformed meshes"_help)
     , type_{"type",
             "Type",
-            "Conversion type, lines or points."_help,
-            {{"lines", "To Lines", Type::ToLines}, {"points", "To Points", Type::ToPoints}},
+            "Conversion type, lines, points, or optimized for the GPU vertex cache."_help,
+            {{"lines", "To Lines", Type::ToLines},
+             {"points", "To Points", Type::ToPoints},
+             {"optimize", "Optimize Vertex Order", Type::Optimize}},
             0} {
 
     addPort(inport_);
@@ -92,6 +96,10 @@ void MeshConverterProcessor::process() {
                     }
                     break;
                 }
+                case Type::Optimize: {
+                    meshes->emplace_back(meshutil::optimizeVertexOrder(*mesh));
+                    break;
+                }
             }
         }
     }
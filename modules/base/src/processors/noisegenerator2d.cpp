@@ -38,6 +38,7 @@
 #include <modules/base/algorithm/randomutils.h>
 
 #include <bit>
+#include <cstdint>
 
 namespace inviwo {
 class Image;
@@ -51,7 +52,8 @@ const ProcessorInfo NoiseGenerator2D::processorInfo_{
     Tags::CPU | Tag("Layer") | Tag("Noise"),  // Tags
     R"(
     A processor to generate a noise layer.
-    Using the Mersenne Twister 19937 generator to generate random numbers.
+    Using the Mersenne Twister 19937 generator to generate random numbers, or optionally the
+    counter based Philox generator, which fills the layer in parallel.
         
     ![Image Of Noise Types](file:~modulePath~/docs/images/noise_types.png)
     
@@ -98,6 +100,12 @@ NoiseGenerator2D::NoiseGenerator2D()
     , haltonYBase_("haltonYBase", "Base for y values", 3, 2, 32)
 
     , randomness_("randomness", "Randomness", "Random number generation settings"_help)
+    , generator_("generator", "Generator",
+                 "The random number generator. Philox is a counter based generator that is "
+                 "evaluated in parallel, giving the same result for any number of threads. "
+                 "Poisson disk sampling is sequential and always uses the Mersenne Twister."_help,
+                 {{"mersenneTwister", "Mersenne Twister", Generator::MersenneTwister},
+                  {"philox", "Philox (parallel)", Generator::Philox}})
     , useSameSeed_("useSameSeed", "Use same seed",
                    "Use the same seed for each call to process."_help, true)
     , seed_("seed", "Seed", "The seed used to initialize the random sequence"_help, 1,
@@ -127,7 +135,7 @@ NoiseGenerator2D::NoiseGenerator2D()
     type_.onChange(typeOnChange);
 
     addProperty(randomness_);
-    randomness_.addProperties(useSameSeed_, seed_);
+    randomness_.addProperties(generator_, useSameSeed_, seed_);
     useSameSeed_.onChange([&]() { seed_.setVisible(useSameSeed_.get()); });
 
     size_.onChange([&]() {
@@ -144,17 +152,24 @@ void NoiseGenerator2D::process() {
     if (useSameSeed_.get()) {
         mt_.seed(seed_.get());
     }
+    const util::Philox4x32 philox{useSameSeed_.get() ? static_cast<std::uint64_t>(seed_.get())
+                                                     : (std::uint64_t{rd_()} << 32) | rd_()};
+    const bool parallel = generator_.get() == Generator::Philox;
 
     std::uniform_real_distribution<float> r(range_.get().x, range_.get().y);
     std::shared_ptr<Layer> layer;
 
     switch (type_.get()) {
         case NoiseType::Random:
-            layer = util::randomLayer<float>(size_.get(), mt_, r);
+            layer = parallel ? util::randomLayer<float>(size_.get(), philox, range_.get().x,
+                                                        range_.get().y)
+                             : util::randomLayer<float>(size_.get(), mt_, r);
             break;
         case NoiseType::Perlin:
-            layer = util::perlinNoise(size_.get(), persistence_.get(), levels_.get().x,
-                                      levels_.get().y, mt_);
+            layer = parallel ? util::perlinNoise(size_.get(), persistence_.get(),
+                                                 levels_.get().x, levels_.get().y, philox)
+                             : util::perlinNoise(size_.get(), persistence_.get(),
+                                                 levels_.get().x, levels_.get().y, mt_);
             break;
         case NoiseType::PoissonDisk:
             layer = util::poissonDisk(size_.get(), poissonDotsAlongX_.get(),
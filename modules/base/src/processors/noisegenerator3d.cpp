@@ -43,8 +43,9 @@
 #include <inviwo/core/util/glmvec.h>                   // for size3_t
 #include <inviwo/core/util/staticstring.h>             // for operator+
 #include <inviwo/core/util/zip.h>                      // for zipper
-#include <modules/base/algorithm/randomutils.h>        // for haltonSequence, randomVolume
+#include <modules/base/algorithm/randomutils.h>        // for Philox4x32, haltonSequence, rand...
 
+#include <cstdint>      // for uint64_t
 #include <memory>       // for shared_ptr, shared_ptr<>::element_...
 #include <type_traits>  // for remove_extent_t
 
@@ -63,7 +64,8 @@ const ProcessorInfo NoiseGenerator3D::processorInfo_{
     Tags::CPU | Tag("Volume"),      // Tags
     R"(
     A processor that generates noise volumes using the Mersenne Twister 19937 generator
-    for random number generation.
+    for random number generation. Optionally the counter based Philox generator can be used,
+    which fills the volume in parallel and gives the same result for any number of threads.
     
     ![Image Of Noise Types](file:~modulePath~/docs/images/noise_types.png)
     
@@ -95,6 +97,9 @@ NoiseGenerator3D::NoiseGenerator3D()
     , haltonZBase_("haltonZBase", "Base for z values", 5, 2, 32)
 
     , randomness_("randomness", "Randomness")
+    , generator_("generator", "Generator",
+                 {{"mersenneTwister", "Mersenne Twister", Generator::MersenneTwister},
+                  {"philox", "Philox (parallel)", Generator::Philox}})
     , useSameSeed_("useSameSeed", "Use same seed", true)
     , seed_("seed", "Seed", 1, 0, 1000)
     , rd_()
@@ -122,6 +127,7 @@ NoiseGenerator3D::NoiseGenerator3D()
     type_.onChange(typeOnChange);
 
     addProperty(randomness_);
+    randomness_.addProperty(generator_);
     randomness_.addProperty(useSameSeed_);
     randomness_.addProperty(seed_);
     useSameSeed_.onChange([&]() { seed_.setVisible(useSameSeed_.get()); });
@@ -140,7 +146,15 @@ void NoiseGenerator3D::process() {
 
     switch (type_.get()) {
         case NoiseType::Random:
-            vol = util::randomVolume<float>(size_.get(), mt_, r);
+            if (generator_.get() == Generator::Philox) {
+                const util::Philox4x32 philox{
+                    useSameSeed_.get() ? static_cast<std::uint64_t>(seed_.get())
+                                       : (std::uint64_t{rd_()} << 32) | rd_()};
+                vol = util::randomVolume<float>(size_.get(), philox, range_.get().x,
+                                                range_.get().y);
+            } else {
+                vol = util::randomVolume<float>(size_.get(), mt_, r);
+            }
             break;
         case NoiseType::HaltonSequence:
             vol =
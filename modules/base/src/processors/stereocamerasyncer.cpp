@@ -54,7 +54,9 @@ const ProcessorInfo StereoCameraSyncer::processorInfo_{
     "Camera",                         // Category
     CodeState::Experimental,          // Code state
     Tags::None,                       // Tags,
-    "A processor linking a left and right camera"_help,
+    "A processor linking a left and right camera. Link the left and right cameras to the camera "
+    "and right camera of a Mesh Renderer in stereo mode to render both eyes in a single "
+    "evaluation of the network."_help,
 };
 const ProcessorInfo& StereoCameraSyncer::getProcessorInfo() const { return processorInfo_; }
 
@@ -37,6 +37,7 @@
 #include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
+#include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
 #include <inviwo/core/ports/datainport.h>                               // for DataInport
 #include <inviwo/core/ports/dataoutport.h>                              // for DataOutport
 #include <inviwo/core/ports/inportiterable.h>                           // for InportIterable<>:...
@@ -66,7 +67,9 @@
 #include <cstddef>        // for size_t
 #include <iterator>       // for distance
 #include <limits>         // for numeric_limits<>:...
+#include <mutex>          // for mutex, scoped_lock
 #include <numeric>        // for accumulate
+#include <optional>       // for optional
 #include <tuple>          // for tuple_element<>::...
 #include <type_traits>    // for remove_extent_t
 #include <unordered_map>  // for unordered_map
@@ -81,6 +84,27 @@
 
 namespace inviwo {
 
+class SurfaceExtraction::BlockRangesCache {
+public:
+    explicit BlockRangesCache(std::shared_ptr<const Volume> volume) : volume_{std::move(volume)} {}
+
+    const Volume* getVolume() const { return volume_.get(); }
+
+    /// Computes the ranges the first time they are needed, might be called from any thread
+    const marching::BlockRanges& get() {
+        const std::scoped_lock lock{mutex_};
+        if (!ranges_) {
+            ranges_.emplace(*volume_->getRepresentation<VolumeRAM>());
+        }
+        return *ranges_;
+    }
+
+private:
+    std::shared_ptr<const Volume> volume_;
+    std::mutex mutex_;
+    std::optional<marching::BlockRanges> ranges_;
+};
+
 const ProcessorInfo SurfaceExtraction::processorInfo_{
     "org.inviwo.SurfaceExtraction",  // Class identifier
     "Surface Extraction",            // Display name
@@ -91,7 +115,8 @@ const ProcessorInfo SurfaceExtraction::processorInfo_{
 const ProcessorInfo& SurfaceExtraction::getProcessorInfo() const { return processorInfo_; }
 
 SurfaceExtraction::SurfaceExtraction()
-    : PoolProcessor(pool::Option::KeepOldResults | pool::Option::DelayDispatch)
+    : PoolProcessor(pool::Option::KeepOldResults | pool::Option::DelayDispatch |
+                    pool::Option::Interactive)
     , volume_("volume")
     , outport_("mesh")
     , method_("method", "Method",
@@ -135,9 +160,18 @@ SurfaceExtraction::~SurfaceExtraction() = default;
 
 void SurfaceExtraction::process() {
 
-    const auto computeSurface = [this](vec4 color, std::shared_ptr<const Volume> vol) {
-        return [vol, color, method = method_.get(), iso = isoValue_.get(),
-                invert = invertIso_.get(),
+    // Keep the block ranges of the volumes that did not change, they only depend on the volume
+    const auto size = static_cast<size_t>(std::distance(volume_.begin(), volume_.end()));
+    blockRanges_.resize(size);
+    for (auto [i, vol] : util::enumerate(volume_)) {
+        if (!blockRanges_[i] || blockRanges_[i]->getVolume() != vol.get()) {
+            blockRanges_[i] = std::make_shared<BlockRangesCache>(vol);
+        }
+    }
+
+    const auto computeSurface = [this](size_t i, vec4 color, std::shared_ptr<const Volume> vol) {
+        return [vol, color, ranges = blockRanges_[i], method = method_.get(),
+                iso = isoValue_.get(), invert = invertIso_.get(),
                 enclose = encloseSurface_.get()](pool::Progress progress) -> std::shared_ptr<Mesh> {
             RenderContext::getPtr()->activateLocalRenderContext();
 
@@ -145,7 +179,8 @@ void SurfaceExtraction::process() {
                 case Method::MarchingCubes:
                     return util::marchingcubes(vol, iso, color, invert, enclose, progress);
                 case Method::MarchingCubesOpt:
-                    return util::marchingCubesOpt(vol, iso, color, invert, enclose, progress);
+                    return util::marchingCubesOpt(vol, iso, color, invert, enclose, progress,
+                                                  nullptr, &ranges->get());
                 case Method::MarchingTetrahedron:
                 default:
                     return util::marchingtetrahedron(vol, iso, color, invert, enclose, progress);
@@ -184,16 +219,15 @@ void SurfaceExtraction::process() {
         };
     };
 
-    const auto size = static_cast<size_t>(std::distance(volume_.begin(), volume_.end()));
     if (colors_.size() < size) updateColors();
 
     const bool stateChange = method_.isModified() || isoValue_.isModified() ||
                              invertIso_.isModified() || encloseSurface_.isModified();
 
     if (stateChange || size != meshes_.size()) {  // Need to recompute all...
-        std::vector<decltype(computeSurface(vec4{}, std::shared_ptr<const Volume>{}))> jobs;
+        std::vector<decltype(computeSurface(0, vec4{}, std::shared_ptr<const Volume>{}))> jobs;
         for (auto [i, vol] : util::enumerate(volume_)) {
-            jobs.push_back(computeSurface(getColor(i), vol));
+            jobs.push_back(computeSurface(i, getColor(i), vol));
         }
         dispatchMany(jobs, [this](std::vector<std::shared_ptr<Mesh>> result) {
             meshes_ = result;
@@ -209,7 +243,7 @@ void SurfaceExtraction::process() {
             const auto data = item.second;
 
             if (portChanged) {
-                jobs.push_back(computeSurface(getColor(i), data));
+                jobs.push_back(computeSurface(i, getColor(i), data));
                 inds.push_back(i);
             } else if (colors_[i]->isModified()) {
                 jobs.push_back(changeColor(getColor(i), meshes_[i]));
@@ -48,7 +48,7 @@ const ProcessorInfo VolumeCurlCPUProcessor::processorInfo_{
     "Volume Curl",                        // Display name
     "Volume Operation",                   // Category
     CodeState::Stable,                    // Code state
-    Tags::CPU,                            // Tags
+    Tags::CPU | Tags::Deterministic,      // Tags
 };
 const ProcessorInfo& VolumeCurlCPUProcessor::getProcessorInfo() const { return processorInfo_; }
 
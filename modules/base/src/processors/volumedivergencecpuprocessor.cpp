@@ -48,7 +48,7 @@ const ProcessorInfo VolumeDivergenceCPUProcessor::processorInfo_{
     "Volume Divergence",                        // Display name
     "Volume Operation",                         // Category
     CodeState::Stable,                          // Code state
-    Tags::CPU,                                  // Tags
+    Tags::CPU | Tags::Deterministic,            // Tags
 };
 const ProcessorInfo& VolumeDivergenceCPUProcessor::getProcessorInfo() const {
     return processorInfo_;
@@ -0,0 +1,115 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/processors/volumeexpression.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>              // for Volume
+#include <inviwo/core/datastructures/volume/volumeram.h>           // for VolumeRAM
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>  // for VolumeRAMPrecision
+#include <inviwo/core/processors/processorstate.h>                 // for CodeState
+#include <inviwo/core/processors/processortags.h>                  // for Tags
+#include <inviwo/core/util/formats.h>                              // for DataFloat32
+#include <inviwo/core/util/glmfmt.h>                               // IWYU pragma: keep
+#include <inviwo/core/util/zip.h>                                  // for enumerate
+#include <modules/base/algorithm/dataminmax.h>                     // for volumeMinMax
+#include <modules/base/algorithm/expression.h>                     // for evaluateExpression
+
+#include <memory>  // for shared_ptr
+#include <span>    // for span
+#include <vector>  // for vector
+
+#include <fmt/format.h>  // for format
+
+namespace inviwo {
+
+const ProcessorInfo VolumeExpression::processorInfo_{
+    "org.inviwo.VolumeExpression",  // Class identifier
+    "Volume Expression",            // Display name
+    "Volume Operation",             // Category
+    CodeState::Experimental,        // Code state
+    Tags::CPU | Tag{"Volume"},      // Tags
+    R"(Computes a scalar float32 volume by evaluating an expression for each voxel of the
+    input volumes. The first channel of input `i` is available as the variable `vi` (`v1`,
+    `v2`, ...) and channel `c` as `vi_c` (`v1_0`, `v1_1`, ...). The expression supports
+    `+`, `-`, `*`, `/`, and `^`. See VolumeCombiner for a GPU version.
+    )"_unindentHelp,
+};
+
+const ProcessorInfo& VolumeExpression::getProcessorInfo() const { return processorInfo_; }
+
+VolumeExpression::VolumeExpression()
+    : Processor{}
+    , inports_{VolumeInport{"volume1", "First input volume, `v1`"_help},
+               VolumeInport{"volume2", "Second input volume, `v2` (optional)"_help},
+               VolumeInport{"volume3", "Third input volume, `v3` (optional)"_help},
+               VolumeInport{"volume4", "Fourth input volume, `v4` (optional)"_help}}
+    , outport_{"outport", "Scalar float32 volume with the result of the expression"_help}
+    , expression_{"expression", "Expression",
+                  "The expression to evaluate, i.e. `(v1 - v2) ^ 2`"_help, "v1"} {
+
+    for (auto& inport : inports_) addPort(inport);
+    for (auto& inport : std::span(inports_.begin() + 1, 3)) inport.setOptional(true);
+    addPort(outport_);
+
+    addProperty(expression_);
+}
+
+void VolumeExpression::process() {
+    const auto first = inports_[0].getData();
+
+    std::vector<util::ExpressionVariable<VolumeRAM>> variables;
+    for (auto&& [i, inport] : util::enumerate(inports_)) {
+        if (!inport.hasData()) continue;
+        const auto volume = inport.getData();
+        if (volume->getDimensions() != first->getDimensions()) {
+            throw Exception(SourceContext{}, "Dimension mismatch, volume {} is {} expected {}",
+                            i + 1, volume->getDimensions(), first->getDimensions());
+        }
+        const auto* ram = volume->getRepresentation<VolumeRAM>();
+        variables.push_back({fmt::format("v{}", i + 1), ram, 0});
+        for (size_t c = 0; c < volume->getDataFormat()->getComponents(); ++c) {
+            variables.push_back({fmt::format("v{}_{}", i + 1, c), ram, c});
+        }
+    }
+
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(first->getDimensions());
+    util::evaluateExpression<VolumeRAM>(expression_.get(), variables, ram->getView());
+
+    auto volume =
+        std::make_shared<Volume>(*first, noData, VolumeConfig{.format = DataFloat32::get()});
+    volume->addRepresentation(ram);
+    const auto [min, max] = util::volumeMinMax(ram.get());
+    volume->dataMap.dataRange = dvec2{min.x, max.x};
+    volume->dataMap.valueRange = dvec2{min.x, max.x};
+    volume->dataMap.valueAxis.name = expression_.get();
+
+    outport_.setData(volume);
+}
+
+}  // namespace inviwo
@@ -47,7 +47,7 @@ const ProcessorInfo VolumeGradientCPUProcessor::processorInfo_{
     "Volume Gradient",                        // Display name
     "Volume Operation",                       // Category
     CodeState::Experimental,                  // Code state
-    Tags::CPU,                                // Tags
+    Tags::CPU | Tags::Deterministic,          // Tags
 };
 const ProcessorInfo& VolumeGradientCPUProcessor::getProcessorInfo() const { return processorInfo_; }
 
@@ -32,6 +32,8 @@
 #include <inviwo/core/processors/processorinfo.h>                    // for ProcessorInfo
 #include <inviwo/core/processors/processorstate.h>                   // for CodeState, CodeState...
 #include <inviwo/core/processors/processortags.h>                    // for Tags, Tags::CPU
+#include <inviwo/core/algorithm/markdown.h>                          // for operator""_help
+#include <inviwo/core/properties/boolcompositeproperty.h>            // for BoolCompositeProperty
 #include <inviwo/core/properties/ordinalproperty.h>                  // for IntSizeTProperty
 #include <inviwo/core/util/glmvec.h>                                 // for uvec3
 #include <modules/base/processors/vectorelementselectorprocessor.h>  // for VectorElementSelecto...
@@ -54,9 +56,36 @@ const ProcessorInfo& VolumeSequenceElementSelectorProcessor::getProcessorInfo()
     return processorInfo_;
 }
 VolumeSequenceElementSelectorProcessor::VolumeSequenceElementSelectorProcessor()
-    : VectorElementSelectorProcessor<Volume>() {
+    : VectorElementSelectorProcessor<Volume>()
+    , prefetch_{"prefetch", "Prefetch",
+                "Read the next time steps from disk in the background, in the direction of "
+                "playback, so that stepping through the sequence does not stall on loading"_help,
+                true, InvalidationLevel::Valid}
+    , prefetchCount_{"prefetchCount", "Time Steps",
+                     "Number of time steps ahead of the current one to prefetch"_help,
+                     2,
+                     {1, ConstraintBehavior::Immutable},
+                     {16, ConstraintBehavior::Ignore},
+                     1,
+                     InvalidationLevel::Valid} {
     timeStep_.index_.autoLinkToProperty<VolumeSequenceElementSelectorProcessor>(
         "timeStep.selectedSequenceIndex");
+
+    prefetch_.addProperty(prefetchCount_);
+    addProperty(prefetch_);
+    prefetch_.getBoolProperty()->onChange([this]() {
+        if (!prefetch_.isChecked()) prefetcher_.cancel();
+    });
+}
+
+void VolumeSequenceElementSelectorProcessor::process() {
+    VectorElementSelectorProcessor<Volume>::process();
+
+    if (prefetch_.isChecked() && inport_.hasData()) {
+        prefetcher_.update(inport_.getData(), timeStep_.index_.get() - 1, prefetchCount_.get());
+    } else {
+        prefetcher_.cancel();
+    }
 }
 
 }  // namespace inviwo
@@ -29,6 +29,7 @@
 
 #include <modules/base/processors/volumesequencetospatial4dsampler.h>
 
+#include <inviwo/core/algorithm/markdown.h>          // for operator""_help
 #include <inviwo/core/ports/dataoutport.h>           // for DataOutport
 #include <inviwo/core/ports/outportiterable.h>       // for OutportIterableImpl<>::const_iterator
 #include <inviwo/core/ports/volumeport.h>            // for VolumeSequenceInport
@@ -37,6 +38,7 @@
 #include <inviwo/core/processors/processorstate.h>   // for CodeState, CodeState::Experimental
 #include <inviwo/core/processors/processortags.h>    // for Tags, Tags::None
 #include <inviwo/core/properties/boolproperty.h>     // for BoolProperty
+#include <inviwo/core/properties/ordinalproperty.h>  // for IntSizeTProperty
 #include <inviwo/core/util/spatial4dsampler.h>       // for Spatial4DSampler
 #include <inviwo/core/util/volumesequencesampler.h>  // for VolumeSequenceSampler
 
@@ -64,16 +66,24 @@ VolumeSequenceToSpatial4DSampler::VolumeSequenceToSpatial4DSampler()
     : Processor()
     , volumeSequence_("volumeSequence")
     , sampler_("sampler")
-    , allowLooping_("allowLooping", "Allow Looping", true) {
+    , allowLooping_("allowLooping", "Allow Looping", true)
+    , streamingWindow_("streamingWindow", "Streaming Window",
+                       "Number of time steps to keep in memory at once, 0 keeps all of them. "
+                       "A streaming sampler loads the time steps around the current integration "
+                       "front, and prefetches the following ones, while lines are traced. "
+                       "Looping is not supported when streaming."_help,
+                       util::ordinalCount(size_t{0}, size_t{64})) {
     addPort(volumeSequence_);
     addPort(sampler_);
 
     addProperty(allowLooping_);
+    addProperty(streamingWindow_);
+    allowLooping_.readonlyDependsOn(streamingWindow_, [](const auto& p) { return p.get() > 0; });
 }
 
 void VolumeSequenceToSpatial4DSampler::process() {
-    auto sampler =
-        std::make_shared<VolumeSequenceSampler>(volumeSequence_.getData(), allowLooping_.get());
+    auto sampler = std::make_shared<VolumeSequenceSampler>(
+        volumeSequence_.getData(), allowLooping_.get(), streamingWindow_.get());
     sampler_.setData(sampler);
 }
 
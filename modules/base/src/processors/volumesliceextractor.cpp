@@ -60,6 +60,7 @@
 #include <inviwo/core/util/staticstring.h>                              // for operator+
 #include <inviwo/core/util/document.h>                                  // for Document
 #include <modules/base/datastructures/imagereusecache.h>                // for ImageReuseCache
+#include <modules/base/datastructures/volumeslicecache.h>                // for VolumeSliceCache
 
 #include <algorithm>      // for copy
 #include <cstddef>        // for size_t
@@ -84,6 +85,8 @@ const ProcessorInfo VolumeSliceExtractor::processorInfo_{
     R"(
 Extracts an axis aligned 2D slice from an input volume. The input data will be renormalized to either 
 [0,1] for floating point values or [0, max] of the data format using the data mapper of the volume.
+If the volume has not been loaded yet and is stored in an uncompressed raw or chunked file only the
+slice is read from disk, the most recently used slices are kept in a cache.
 )"_unindentHelp};
 const ProcessorInfo& VolumeSliceExtractor::getProcessorInfo() const { return processorInfo_; }
 
@@ -189,8 +192,8 @@ size2_t sliceDimensions(const size3_t volumeDims, CartesianCoordinateAxis axis)
     }
 }
 
-Wrapping2D getWrapping(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
-    const auto wrapping = v->getOwner()->getWrapping();
+Wrapping2D getWrapping(const Volume& volume, CartesianCoordinateAxis axis) {
+    const auto wrapping = volume.getWrapping();
     switch (axis) {
         default:
             return {{wrapping[2], wrapping[1]}};
@@ -203,8 +206,8 @@ Wrapping2D getWrapping(const VolumeRepresentation* v, CartesianCoordinateAxis ax
     }
 }
 
-mat2 getBasis(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
-    const mat3 basis = v->getOwner()->getBasis();
+mat2 getBasis(const Volume& volume, CartesianCoordinateAxis axis) {
+    const mat3 basis = volume.getBasis();
     switch (axis) {
         default:
             return mat2(vec2(basis[2][2], basis[2][1]), vec2(basis[1][2], basis[1][1]));
@@ -217,8 +220,8 @@ mat2 getBasis(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
     }
 }
 
-vec2 getOffset(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
-    const vec3 offset = v->getOwner()->getOffset();
+vec2 getOffset(const Volume& volume, CartesianCoordinateAxis axis) {
+    const vec3 offset = volume.getOffset();
     switch (axis) {
         default:
             return vec2(offset.z, offset.y);
@@ -232,6 +235,7 @@ vec2 getOffset(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
 }
 
 struct SliceState {
+    const Volume* volume;
     CartesianCoordinateAxis axis;
     size_t slice;
     ImageReuseCache* cache;
@@ -255,9 +259,9 @@ std::shared_ptr<Image> extractSliceInternal(const VolumeRAMPrecision<T>* vrpreci
     auto layerrep = res.second;
     auto layerdata = layerrep->getDataTyped();
     layerrep->setSwizzleMask(state.tf ? swizzlemasks::rgba : vrprecision->getSwizzleMask());
-    layerrep->setWrapping(getWrapping(vrprecision, state.axis));
-    sliceImage->getColorLayer()->setBasis(mat3(getBasis(vrprecision, state.axis)));
-    sliceImage->getColorLayer()->setOffset(vec3(getOffset(vrprecision, state.axis), 0.0f));
+    layerrep->setWrapping(getWrapping(*state.volume, state.axis));
+    sliceImage->getColorLayer()->setBasis(mat3(getBasis(*state.volume, state.axis)));
+    sliceImage->getColorLayer()->setOffset(vec3(getOffset(*state.volume, state.axis), 0.0f));
 
     switch (state.axis) {
         case CartesianCoordinateAxis::X: {
@@ -315,7 +319,7 @@ std::shared_ptr<Image> extractSlice(const VolumeRAMPrecision<T>* vrprecision,
 
     if (useTF) {
         using D = glm::vec<4, V>;
-        auto mapData = [&dm = vrprecision->getOwner()->dataMap, tf = state.tf,
+        auto mapData = [&dm = state.volume->dataMap, tf = state.tf,
                         channel = state.channel, offset = state.alphaOffset](T value) {
             auto sample = tf->sample(
                 glm::clamp(dm.mapFromDataToNormalized(util::glmcomp(value, channel)), 0.0, 1.0));
@@ -325,7 +329,7 @@ std::shared_ptr<Image> extractSlice(const VolumeRAMPrecision<T>* vrprecision,
         return extractSliceInternal<T, D>(vrprecision, state, mapData);
     } else {
         using D = util::same_extent_t<T, V>;
-        auto mapData = [&dm = vrprecision->getOwner()->dataMap](T value) {
+        auto mapData = [&dm = state.volume->dataMap](T value) {
             return util::glm_convert_normalized<D>(glm::clamp(dm.mapFromDataToNormalized(value),
                                                               util::same_extent_t<T, double>(0.0),
                                                               util::same_extent_t<T, double>(1.0)));
@@ -369,40 +373,46 @@ void VolumeSliceExtractor::process() {
             break;
     }
 
-    detail::SliceState state{sliceAlongAxis_,      static_cast<size_t>(sliceNumber_.get() - 1),
-                             &imageCache_,         flipHorizontal_,
-                             flipVertical_,        &transferFunction_.get(),
-                             tfAlphaOffset_.get(), channel_.get()};
+    // A volume that is still on disk only has to read the requested slice
+    const auto slice = static_cast<size_t>(sliceNumber_.get() - 1);
+    const auto sliceRAM = sliceCache_.get(vol, sliceAlongAxis_, slice);
+    const VolumeRAM* ram = sliceRAM ? sliceRAM.get() : vol->getRepresentation<VolumeRAM>();
+
+    detail::SliceState state{vol.get(),
+                             sliceAlongAxis_,
+                             sliceRAM ? size_t{0} : slice,
+                             &imageCache_,
+                             flipHorizontal_,
+                             flipVertical_,
+                             &transferFunction_.get(),
+                             tfAlphaOffset_.get(),
+                             channel_.get()};
 
     std::shared_ptr<Image> image;
 
     switch (format_.get()) {
         case OutputFormat::UInt8:
-            image = vol->getRepresentation<VolumeRAM>()
-                        ->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
-                            [&](const auto* vrprecision) {
-                                using T = util::PrecisionValueType<decltype(vrprecision)>;
-                                return detail::extractSlice<T, std::uint8_t>(vrprecision, state,
-                                                                             tfGroup_.isChecked());
-                            });
+            image = ram->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
+                [&](const auto* vrprecision) {
+                    using T = util::PrecisionValueType<decltype(vrprecision)>;
+                    return detail::extractSlice<T, std::uint8_t>(vrprecision, state,
+                                                                 tfGroup_.isChecked());
+                });
             break;
         case OutputFormat::Float32:
-            image = vol->getRepresentation<VolumeRAM>()
-                        ->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
-                            [&](const auto* vrprecision) {
-                                using T = util::PrecisionValueType<decltype(vrprecision)>;
-                                return detail::extractSlice<T, float>(vrprecision, state,
-                                                                      tfGroup_.isChecked());
-                            });
+            image = ram->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
+                [&](const auto* vrprecision) {
+                    using T = util::PrecisionValueType<decltype(vrprecision)>;
+                    return detail::extractSlice<T, float>(vrprecision, state,
+                                                          tfGroup_.isChecked());
+                });
             break;
         case OutputFormat::AsInput:
         default:
-            image =
-                vol->getRepresentation<VolumeRAM>()
-                    ->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
-                        [&](const auto* vrprecision) {
-                            return detail::extractSlice(vrprecision, state, tfGroup_.isChecked());
-                        });
+            image = ram->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
+                [&](const auto* vrprecision) {
+                    return detail::extractSlice(vrprecision, state, tfGroup_.isChecked());
+                });
             break;
     }
 
@@ -34,6 +34,7 @@
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
+#include <inviwo/core/io/volumeregionloader.h>                          // for loadVolumeRegion
 #include <inviwo/core/network/networklock.h>                            // for NetworkLock
 #include <inviwo/core/ports/volumeport.h>                               // for VolumeInport, Vol...
 #include <inviwo/core/processors/processor.h>                           // for Processor
@@ -115,10 +116,21 @@ VolumeSubset::VolumeSubset()
 
 VolumeSubset::~VolumeSubset() = default;
 
+namespace {
+
+std::shared_ptr<VolumeRAM> subset(const Volume& volume, size3_t dim, size3_t offset) {
+    // A file that is not loaded yet only has to read the subset
+    if (auto region = util::loadVolumeRegion(volume, offset, dim)) {
+        return region;
+    }
+    return VolumeRAMSubSet::apply(volume.getRepresentation<VolumeRAM>(), dim, offset);
+}
+
+}  // namespace
+
 void VolumeSubset::process() {
     if (enabled_.get()) {
-        const auto vol = inport_.getData()->getRepresentation<VolumeRAM>();
-        const size3_t inputDims = vol->getDimensions();
+        const size3_t inputDims = inport_.getData()->getDimensions();
         const size3_t offset{
             glm::min(size3_t{rangeX_.get().x, rangeY_.get().x, rangeZ_.get().x}, inputDims)};
         const size3_t dim = size3_t{rangeX_.get().y, rangeY_.get().y, rangeZ_.get().y} - offset;
@@ -127,7 +139,7 @@ void VolumeSubset::process() {
             outport_.setData(inport_.getData());
         } else {
             auto volume = std::make_shared<Volume>(*inport_.getData(), NoData{});
-            volume->addRepresentation(VolumeRAMSubSet::apply(vol, dim, offset));
+            volume->addRepresentation(subset(*inport_.getData(), dim, offset));
 
             if (adjustBasisAndOffset_.get()) {
                 vec3 volOffset = inport_.getData()->getOffset();
@@ -31,7 +31,9 @@
 #pragma comment(linker, "/SUBSYSTEM:CONSOLE")
 #endif
 
+#include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/util/logcentral.h>
 #include <modules/base/algorithm/volume/volumegeneration.h>
 
 #include <modules/base/algorithm/volume/marchingcubes.h>
@@ -46,6 +48,12 @@
 
 using namespace inviwo;
 
+// The second argument is the number of threads in the pool, zero runs everything serially
+static void setPoolSize(benchmark::State& state) {
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(1)));
+    state.counters["Threads"] = static_cast<double>(state.range(1));
+}
+
 static void SphereOld(benchmark::State& state) {
     auto v = std::shared_ptr<Volume>(
         util::makeSphericalVolume(size3_t{static_cast<size_t>(state.range(0))}));
@@ -65,6 +73,8 @@ static void SphereNew(benchmark::State& state) {
     auto v = std::shared_ptr<Volume>(
         util::makeSphericalVolume(size3_t{static_cast<size_t>(state.range(0))}));
 
+    setPoolSize(state);
+
     for (auto _ : state) {
         auto mesh = util::marchingCubesOpt(v, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
         state.counters["Vertices"] = static_cast<double>(mesh->getBuffer(0)->getSize());
@@ -95,6 +105,8 @@ static void RippleNew(benchmark::State& state) {
     auto v = std::shared_ptr<Volume>(
         util::makeRippleVolume(size3_t{static_cast<size_t>(state.range(0))}));
 
+    setPoolSize(state);
+
     for (auto _ : state) {
         auto mesh = util::marchingCubesOpt(v, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
         state.counters["Vertices"] = static_cast<double>(mesh->getBuffer(0)->getSize());
@@ -137,10 +149,14 @@ static void MiniNew(benchmark::State& state) {
 }
 
 BENCHMARK(SphereOld)->RangeMultiplier(2)->Range(8, 8 << 5);
-BENCHMARK(SphereNew)->RangeMultiplier(2)->Range(8, 8 << 6);
+BENCHMARK(SphereNew)
+    ->ArgsProduct({benchmark::CreateRange(8, 8 << 7, 2), {0, 4, 8}})
+    ->Unit(benchmark::kMillisecond);
 
 BENCHMARK(RippleOld)->RangeMultiplier(2)->Range(8, 8 << 4);
-BENCHMARK(RippleNew)->RangeMultiplier(2)->Range(8, 8 << 5);
+BENCHMARK(RippleNew)
+    ->ArgsProduct({benchmark::CreateRange(8, 8 << 7, 2), {0, 4, 8}})
+    ->Unit(benchmark::kMillisecond);
 
 // BENCHMARK(MiniOld)->RangeMultiplier(2)->Range(8, 8 << 5);
 // BENCHMARK(MiniNew)->RangeMultiplier(2)->Range(8, 8 << 5);
@@ -150,6 +166,15 @@ BENCHMARK(RippleNew)->RangeMultiplier(2)->Range(8, 8 << 5);
 
 // BENCHMARK(SphereNew)->Arg(5);
 
-BENCHMARK_MAIN();
+int main(int argc, char** argv) {
+    LogCentral::init();
+    InviwoApplication app("Inviwo-Benchmark-MarchingCubes");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
 
 #include <warn/pop>
@@ -0,0 +1,86 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/dataminmax.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace inviwo {
+
+TEST(DataMinMax, scalar) {
+    // Larger than a task and not a multiple of the number of accumulators
+    std::vector<int> data(util::detail::minMaxGrainSize * 3 + 7);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<int>((i * 7919) % 10007) - 5000;
+    }
+    data[12345] = -6000;
+    data.back() = 6000;
+
+    const auto [min, max] = util::dataMinMax(data.data(), data.size());
+    EXPECT_EQ(min, dvec4(-6000, 0, 0, 0));
+    EXPECT_EQ(max, dvec4(6000, 0, 0, 0));
+}
+
+TEST(DataMinMax, vector) {
+    std::vector<vec3> data(1001);
+    for (size_t i = 0; i < data.size(); ++i) {
+        const auto v = static_cast<float>(i);
+        data[i] = vec3{v, -v, 2.0f * v};
+    }
+
+    const auto [min, max] = util::dataMinMax(data.data(), data.size());
+    EXPECT_EQ(min, dvec4(0, -1000, 0, 0));
+    EXPECT_EQ(max, dvec4(1000, 0, 2000, 0));
+}
+
+TEST(DataMinMax, specialValues) {
+    std::vector<double> data(100, 1.0);
+    data[3] = -2.0;
+    data[50] = 3.0;
+    data[10] = std::numeric_limits<double>::quiet_NaN();
+    data[20] = std::numeric_limits<double>::infinity();
+    data[30] = -std::numeric_limits<double>::infinity();
+
+    const auto [min, max] = util::dataMinMax(data.data(), data.size(), IgnoreSpecialValues::Yes);
+    EXPECT_EQ(min.x, -2.0);
+    EXPECT_EQ(max.x, 3.0);
+
+    const auto [minAll, maxAll] = util::dataMinMax(data.data(), data.size());
+    EXPECT_TRUE(std::isinf(minAll.x) && minAll.x < 0.0);
+    EXPECT_TRUE(std::isinf(maxAll.x) && maxAll.x > 0.0);
+}
+
+}  // namespace inviwo
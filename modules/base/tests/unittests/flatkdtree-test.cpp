@@ -0,0 +1,155 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/datastructures/flatkdtree.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+using Tree = FlatKDTree<3, float>;
+
+std::vector<Tree::Point> randomPoints(size_t count, std::mt19937& rng) {
+    // Round to a coarse grid to get plenty of points at equal distances
+    std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+    std::vector<Tree::Point> points(count);
+    for (auto& p : points) {
+        for (size_t k = 0; k < 3; ++k) p[k] = std::floor(dist(rng) * 10.0f) / 10.0f;
+    }
+    return points;
+}
+
+std::vector<std::pair<float, Tree::Index>> sortedByDistance(const std::vector<Tree::Point>& points,
+                                                            const Tree::Point& pos) {
+    std::vector<std::pair<float, Tree::Index>> result;
+    for (Tree::Index i = 0; i < points.size(); ++i) {
+        float dist2 = 0.0f;
+        for (size_t k = 0; k < 3; ++k) dist2 += (points[i][k] - pos[k]) * (points[i][k] - pos[k]);
+        result.emplace_back(dist2, i);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+}  // namespace
+
+TEST(FlatKDTree, empty) {
+    const Tree tree{};
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.nearest(Tree::Point{0.5f}), Tree::invalid);
+
+    std::vector<Tree::Index> indices(3);
+    std::vector<float> dist2(3);
+    EXPECT_EQ(tree.kNearest(Tree::Point{0.5f}, indices, dist2), 0);
+    EXPECT_EQ(indices[0], Tree::invalid);
+}
+
+TEST(FlatKDTree, matchesLinearSearch) {
+    std::mt19937 rng{0};
+    std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+
+    for (const size_t size : {1, 16, 17, 100, 2000}) {
+        const auto points = randomPoints(size, rng);
+        const Tree tree{points};
+        EXPECT_EQ(tree.size(), size);
+
+        for (size_t q = 0; q < 100; ++q) {
+            const Tree::Point pos{dist(rng), dist(rng), dist(rng)};
+            const auto expected = sortedByDistance(points, pos);
+
+            EXPECT_EQ(tree.nearest(pos), expected[0].second);
+
+            std::vector<Tree::Index> indices(5);
+            std::vector<float> dist2(5);
+            const auto found = tree.kNearest(pos, indices, dist2);
+            ASSERT_EQ(found, std::min<size_t>(5, size));
+            for (size_t i = 0; i < found; ++i) {
+                EXPECT_EQ(indices[i], expected[i].second);
+                EXPECT_FLOAT_EQ(dist2[i], expected[i].first);
+            }
+
+            std::vector<Tree::Index> within;
+            tree.withinRadius(pos, 0.25f, within);
+            std::vector<Tree::Index> expectedWithin;
+            for (const auto& [d2, i] : expected) {
+                if (d2 <= 0.25f * 0.25f) expectedWithin.push_back(i);
+            }
+            std::sort(expectedWithin.begin(), expectedWithin.end());
+            EXPECT_EQ(within, expectedWithin);
+        }
+    }
+}
+
+TEST(FlatKDTree, batchedQueries) {
+    std::mt19937 rng{1};
+    const auto points = randomPoints(1000, rng);
+    const auto queries = randomPoints(300, rng);
+    const Tree tree{points};
+
+    std::vector<Tree::Index> nearest(queries.size());
+    tree.nearest(queries, nearest);
+
+    constexpr size_t k = 4;
+    std::vector<Tree::Index> indices(queries.size() * k);
+    std::vector<float> dist2(queries.size() * k);
+    tree.kNearest(queries, k, indices, dist2);
+
+    std::vector<size_t> offsets;
+    std::vector<Tree::Index> within;
+    tree.withinRadius(queries, 0.1f, offsets, within);
+    ASSERT_EQ(offsets.size(), queries.size() + 1);
+    EXPECT_EQ(offsets.back(), within.size());
+
+    for (size_t q = 0; q < queries.size(); ++q) {
+        EXPECT_EQ(nearest[q], tree.nearest(queries[q]));
+
+        std::vector<Tree::Index> single(k);
+        std::vector<float> singleDist2(k);
+        tree.kNearest(queries[q], single, singleDist2);
+        EXPECT_TRUE(std::equal(single.begin(), single.end(), indices.begin() + q * k));
+
+        std::vector<Tree::Index> singleWithin;
+        tree.withinRadius(queries[q], 0.1f, singleWithin);
+        EXPECT_TRUE(std::equal(singleWithin.begin(), singleWithin.end(),
+                               within.begin() + offsets[q], within.begin() + offsets[q + 1]));
+    }
+}
+
+}  // namespace inviwo
@@ -0,0 +1,113 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/io/ivmmeshreader.h>
+#include <modules/base/io/ivmmeshwriter.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/io/datareaderexception.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace inviwo {
+
+TEST(IvmMesh, RoundTrip) {
+    Mesh mesh;
+    mesh.setModelMatrix(mat4{2.0f});
+    mesh.addBuffer(BufferType::PositionAttrib,
+                   util::makeBuffer(std::vector<vec3>{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}}));
+    mesh.addBuffer(Mesh::BufferInfo{BufferType::TexCoordAttrib, 7},
+                   util::makeBuffer(std::vector<u16vec2>{{1, 2}, {3, 4}, {5, 6}}));
+    mesh.addIndices(Mesh::MeshInfo{DrawType::Triangles, ConnectivityType::None},
+                    util::makeIndexBuffer(std::vector<std::uint32_t>{0, 1, 2}));
+    mesh.addIndices(Mesh::MeshInfo{DrawType::Lines, ConnectivityType::Strip},
+                    util::makeIndexBuffer(std::vector<std::uint32_t>{2, 0}));
+
+    const auto path = std::filesystem::temp_directory_path() / "inviwo-ivmmesh-test.ivm";
+    IvmMeshWriter writer;
+    writer.setOverwrite(Overwrite::Yes);
+    writer.writeData(&mesh, path);
+
+    IvmMeshReader reader;
+    const auto read = reader.readData(path);
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(read->getModelMatrix(), mesh.getModelMatrix());
+    ASSERT_EQ(read->getNumberOfBuffers(), size_t{2});
+    ASSERT_EQ(read->getNumberOfIndicies(), size_t{2});
+
+    const auto& [posInfo, pos] = read->getBuffers()[0];
+    EXPECT_EQ(posInfo.type, BufferType::PositionAttrib);
+    ASSERT_EQ(pos->getDataFormat(), DataFormat<vec3>::get());
+    EXPECT_EQ(static_cast<const Buffer<vec3>&>(*pos).getRAMRepresentation()->getDataContainer(),
+              (std::vector<vec3>{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}}));
+
+    const auto& [texInfo, tex] = read->getBuffers()[1];
+    EXPECT_EQ(texInfo.location, 7);
+    ASSERT_EQ(tex->getDataFormat(), DataFormat<u16vec2>::get());
+    EXPECT_EQ(
+        static_cast<const Buffer<u16vec2>&>(*tex).getRAMRepresentation()->getDataContainer(),
+        (std::vector<u16vec2>{{1, 2}, {3, 4}, {5, 6}}));
+
+    const auto& [lineInfo, lines] = read->getIndexBuffers()[1];
+    EXPECT_EQ(lineInfo.dt, DrawType::Lines);
+    EXPECT_EQ(lineInfo.ct, ConnectivityType::Strip);
+    EXPECT_EQ(lines->getRAMRepresentation()->getDataContainer(),
+              (std::vector<std::uint32_t>{2, 0}));
+}
+
+TEST(IvmMesh, RejectsTruncatedFile) {
+    Mesh mesh;
+    mesh.addBuffer(BufferType::PositionAttrib,
+                   util::makeBuffer(std::vector<vec3>(1000, vec3{1.0f})));
+
+    IvmMeshWriter writer;
+    const auto bytes = writer.writeDataToBuffer(&mesh, "ivm");
+
+    const auto path = std::filesystem::temp_directory_path() / "inviwo-ivmmesh-truncated.ivm";
+    {
+        std::ofstream out{path, std::ios::binary};
+        out.write(reinterpret_cast<const char*>(bytes->data()),
+                  static_cast<std::streamsize>(bytes->size() / 2));
+    }
+    IvmMeshReader reader;
+    EXPECT_THROW(reader.readData(path), DataReaderException);
+    std::filesystem::remove(path);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,86 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/image/layercontour.h>
+
+#include <inviwo/core/datastructures/geometry/typedmesh.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/util/glmvec.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <memory>
+
+#include <glm/geometric.hpp>
+
+namespace inviwo {
+
+TEST(LayerContour, circle) {
+    // Large enough to be split into several bands of rows
+    const size2_t dim{300, 400};
+    const vec2 center{150.0f, 210.0f};
+    const float radius = 120.0f;
+
+    LayerRAMPrecision<float> layer(dim);
+    auto* data = layer.getDataTyped();
+    const util::IndexMapper2D index(dim);
+    for (size_t y = 0; y < dim.y; ++y) {
+        for (size_t x = 0; x < dim.x; ++x) {
+            data[index(x, y)] = glm::distance(vec2(x, y), center);
+        }
+    }
+
+    const auto mesh = std::dynamic_pointer_cast<BasicMesh>(computeLayerContour(&layer, 0, radius));
+    ASSERT_TRUE(mesh);
+
+    const auto& positions = mesh->getTypedDataContainer<buffertraits::PositionsBuffer>();
+    ASSERT_GT(positions.size(), 0u);
+    EXPECT_EQ(positions.size() % 2, 0u);
+    ASSERT_EQ(mesh->getNumberOfIndicies(), 1u);
+    const auto& indices = mesh->getIndices(0)->getRAMRepresentation()->getDataContainer();
+    ASSERT_EQ(indices.size(), positions.size());
+
+    const vec2 scale{vec2(dim) - 1.0f};
+    for (size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_EQ(indices[i], i);
+        const vec2 pos = vec2(positions[i]) * scale;
+        EXPECT_NEAR(glm::distance(pos, center), radius, 0.05f);
+    }
+
+    // The segments are concatenated in the same order regardless of the threading
+    const auto again =
+        std::dynamic_pointer_cast<BasicMesh>(computeLayerContour(&layer, 0, radius));
+    EXPECT_EQ(again->getTypedDataContainer<buffertraits::PositionsBuffer>(), positions);
+}
+
+}  // namespace inviwo
@@ -33,9 +33,12 @@
 #include <warn/pop>
 
 #include <cmath>
+#include <map>
+#include <utility>
 
 #include <inviwo/core/datastructures/geometry/mesh.h>
 #include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
 #include <modules/base/algorithm/volume/volumegeneration.h>
 
 #include <modules/base/algorithm/volume/marchingcubes.h>
@@ -336,4 +339,41 @@ TEST(Marchingcubes, sphere) {
     */
 }
 
+TEST(Marchingcubes, watertight) {
+    // Large enough to be split into several slabs, the sphere crosses the slab boundaries
+    auto v = std::shared_ptr<Volume>(util::makeSphericalVolume(size3_t{64}));
+    auto mesh = util::marchingCubesOpt(v, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
+    auto& ind = getBufferIndexData(*mesh, 0);
+    ASSERT_FALSE(ind.empty());
+
+    // In a closed surface every edge is shared by exactly two triangles, which only holds if the
+    // vertices on the slab boundaries are welded.
+    std::map<std::pair<uint32_t, uint32_t>, int> edges;
+    for (size_t i = 0; i < ind.size(); i += 3) {
+        for (size_t j = 0; j < 3; ++j) {
+            const auto a = ind[i + j];
+            const auto b = ind[i + (j + 1) % 3];
+            ++edges[std::minmax(a, b)];
+        }
+    }
+    for (const auto& [edge, count] : edges) {
+        EXPECT_EQ(count, 2) << "Edge " << edge.first << " - " << edge.second;
+    }
+}
+
+TEST(Marchingcubes, blockRanges) {
+    auto v = std::shared_ptr<Volume>(util::makeSphericalVolume(size3_t{40, 30, 50}));
+    const marching::BlockRanges ranges{*v->getRepresentation<VolumeRAM>()};
+
+    // Skipping the blocks outside of the iso-value range should not change the surface at all
+    for (const auto iso : {0.2, 0.5, 0.9}) {
+        auto mesh1 = util::marchingCubesOpt(v, iso, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
+        auto mesh2 = util::marchingCubesOpt(v, iso, {0.5f, 0.0f, 0.0f, 1.0f}, false, false,
+                                            nullptr, nullptr, &ranges);
+        EXPECT_FALSE(getBufferIndexData(*mesh1, 0).empty());
+        EXPECT_EQ(getBufferIndexData(*mesh1, 0), getBufferIndexData(*mesh2, 0));
+        EXPECT_EQ(getBufferData<vec3>(*mesh1, 0), getBufferData<vec3>(*mesh2, 0));
+    }
+}
+
 }  // namespace inviwo
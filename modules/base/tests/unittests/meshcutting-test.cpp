@@ -116,6 +116,31 @@ TEST(MeshCutting, SutherlandHodgman) {
     EXPECT_FLOAT_EQ(positions[4][1], 0.0f);
 }
 
+TEST(MeshCutting, ClipTrianglesWeldsEdges) {
+    // A quad split along the diagonal 0-2, cut by the plane y = 0
+    const std::vector<std::uint32_t> indices{0, 1, 2, 0, 2, 3};
+    const std::vector<float> distances{-1.0f, -1.0f, 1.0f, 1.0f};
+    const Mesh::MeshInfo meshInfo{DrawType::Triangles, ConnectivityType::None};
+
+    std::vector<std::uint32_t> outIndices;
+    std::vector<meshutil::detail::EdgeVertex> newVertices;
+    const auto newEdges = meshutil::detail::clipTriangles(meshInfo, indices, distances, 4,
+                                                          outIndices, newVertices);
+
+    // The shared diagonal should only give one new vertex
+    ASSERT_EQ(newVertices.size(), 3);
+    for (const auto& v : newVertices) {
+        EXPECT_LT(v.lo, v.hi);
+        EXPECT_FLOAT_EQ(v.weight, 0.5f);
+    }
+
+    ASSERT_EQ(outIndices.size(), 9);
+    EXPECT_EQ(outIndices[2], outIndices[3]);
+
+    ASSERT_EQ(newEdges.size(), 2);
+    EXPECT_EQ(newEdges[0][1], newEdges[1][0]);
+}
+
 TEST(MeshCutting, GatherLoops) {
     const std::vector<vec3> positions{vec3{-1, -1, 0}, vec3{1, -1, 0}, vec3{0, 1, 0}};
     std::vector<glm::u32vec2> edges{{0, 1}, {1, 2}, {2, 0}};
@@ -0,0 +1,129 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/mesh/meshoptimization.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/util/exception.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+namespace inviwo {
+
+namespace {
+
+// A grid of quads, two triangles each, with the triangles in random order
+std::vector<std::uint32_t> shuffledGrid(std::uint32_t size) {
+    std::vector<std::array<std::uint32_t, 3>> triangles;
+    for (std::uint32_t y = 0; y < size; ++y) {
+        for (std::uint32_t x = 0; x < size; ++x) {
+            const auto a = y * (size + 1) + x;
+            const auto c = a + size + 1;
+            triangles.push_back({a, a + 1, c});
+            triangles.push_back({a + 1, c + 1, c});
+        }
+    }
+    std::shuffle(triangles.begin(), triangles.end(), std::mt19937{42});
+
+    std::vector<std::uint32_t> indices;
+    for (const auto& tri : triangles) indices.insert(indices.end(), tri.begin(), tri.end());
+    return indices;
+}
+
+// Rotate the triangles to start with the smallest index, keeping the winding, and sort them
+std::vector<std::array<std::uint32_t, 3>> canonical(const std::vector<std::uint32_t>& indices) {
+    std::vector<std::array<std::uint32_t, 3>> triangles;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        std::array<std::uint32_t, 3> tri{indices[i], indices[i + 1], indices[i + 2]};
+        std::rotate(tri.begin(), std::min_element(tri.begin(), tri.end()), tri.end());
+        triangles.push_back(tri);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+}  // namespace
+
+TEST(MeshOptimization, VertexCacheKeepsTriangles) {
+    const auto indices = shuffledGrid(50);
+    const auto optimized = meshutil::optimizeVertexCache(indices, 51 * 51);
+
+    EXPECT_EQ(canonical(indices), canonical(optimized));
+    EXPECT_LT(meshutil::averageCacheMissRatio(optimized),
+              0.5 * meshutil::averageCacheMissRatio(indices));
+}
+
+TEST(MeshOptimization, VertexCacheIndexOutOfRange) {
+    const std::vector<std::uint32_t> indices{0, 1, 3};
+    EXPECT_THROW(meshutil::optimizeVertexCache(indices, 3), Exception);
+}
+
+TEST(MeshOptimization, VertexOrder) {
+    std::vector<vec3> positions;
+    for (std::uint32_t i = 0; i < 51 * 51; ++i) positions.emplace_back(i, 2 * i, 3 * i);
+    const auto indices = shuffledGrid(50);
+
+    Mesh mesh;
+    mesh.addBuffer(BufferType::PositionAttrib, util::makeBuffer(std::vector<vec3>(positions)));
+    mesh.addIndices(Mesh::MeshInfo{DrawType::Triangles, ConnectivityType::None},
+                    util::makeIndexBuffer(std::vector<std::uint32_t>(indices)));
+
+    const auto optimized = meshutil::optimizeVertexOrder(mesh);
+    ASSERT_EQ(size_t{1}, optimized->getNumberOfIndicies());
+
+    const auto& newPositions = static_cast<const Buffer<vec3>*>(optimized->getBuffer(0))
+                                   ->getRAMRepresentation()
+                                   ->getDataContainer();
+    const auto& newIndices = optimized->getIndices(0)->getRAMRepresentation()->getDataContainer();
+    ASSERT_EQ(positions.size(), newPositions.size());
+    ASSERT_EQ(indices.size(), newIndices.size());
+
+    // Map the new indices back to the old ones through the positions
+    std::vector<std::uint32_t> mapped;
+    for (const auto i : newIndices) mapped.push_back(static_cast<std::uint32_t>(newPositions[i].x));
+    EXPECT_EQ(canonical(indices), canonical(mapped));
+
+    // The vertices are numbered in the order they are first used
+    std::uint32_t next = 0;
+    for (const auto i : newIndices) {
+        ASSERT_LE(i, next);
+        if (i == next) ++next;
+    }
+}
+
+}  // namespace inviwo
@@ -0,0 +1,91 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/randomutils.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace inviwo {
+
+TEST(Philox4x32, knownAnswers) {
+    // Test vectors from the Random123 reference implementation
+    using Block = util::Philox4x32::Block;
+    using Key = util::Philox4x32::Key;
+
+    EXPECT_EQ(util::Philox4x32{Key{0u, 0u}}(Block{0u, 0u, 0u, 0u}),
+              (Block{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+    EXPECT_EQ(util::Philox4x32{Key{0xffffffffu, 0xffffffffu}}(
+                  Block{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}),
+              (Block{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}));
+    EXPECT_EQ(util::Philox4x32{Key{0xa4093822u, 0x299f31d0u}}(
+                  Block{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}),
+              (Block{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}));
+}
+
+TEST(Philox4x32, randomSequenceIsIndexedBySeedAndPosition) {
+    const util::Philox4x32 rng{42};
+
+    std::vector<float> all(1000);
+    util::randomSequence<float>(all, rng, -1.0f, 1.0f);
+    for (const auto v : all) {
+        EXPECT_GE(v, -1.0f);
+        EXPECT_LE(v, 1.0f);
+    }
+
+    // Filling a sub range in a separate call gives the same values as the first part
+    std::vector<float> part(37);
+    util::randomSequence<float>(part, rng, -1.0f, 1.0f);
+    for (size_t i = 0; i < part.size(); ++i) EXPECT_EQ(part[i], all[i]);
+
+    std::vector<float> other(all.size());
+    util::randomSequence<float>(other, rng, -1.0f, 1.0f, 1);
+    EXPECT_NE(other, all);
+}
+
+TEST(Philox4x32, randomIntegersCoverRange) {
+    const util::Philox4x32 rng{7};
+    std::vector<int> values(10000);
+    util::randomSequence<int>(values, rng, -3, 3);
+
+    std::vector<int> counts(7, 0);
+    for (const auto v : values) {
+        ASSERT_GE(v, -3);
+        ASSERT_LE(v, 3);
+        ++counts[v + 3];
+    }
+    for (const auto count : counts) EXPECT_GT(count, 1000);
+}
+
+}  // namespace inviwo
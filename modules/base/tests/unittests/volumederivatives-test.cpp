@@ -0,0 +1,115 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/volume/volumecurl.h>
+#include <modules/base/algorithm/volume/volumedivergence.h>
+#include <modules/base/algorithm/volume/volumegradient.h>
+#include <modules/base/algorithm/volume/volumelaplacian.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <memory>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size3_t dims{9, 8, 7};
+
+// A volume with one world unit between neighboring voxels, filled with f(index)
+template <typename T, typename F>
+std::shared_ptr<Volume> makeVolume(F f) {
+    auto ram = std::make_shared<VolumeRAMPrecision<T>>(dims);
+    const util::IndexMapper3D im{dims};
+    for (size_t i = 0; i < dims.x * dims.y * dims.z; ++i) {
+        ram->getDataTyped()[i] = f(vec3{im(i)});
+    }
+    auto volume = std::make_shared<Volume>(ram);
+    volume->setBasis(mat3{vec3{dims.x, 0, 0}, vec3{0, dims.y, 0}, vec3{0, 0, dims.z}});
+    return volume;
+}
+
+template <typename T, typename Check>
+void forEachInterior(const Volume& volume, Check check) {
+    const auto* data =
+        static_cast<const VolumeRAMPrecision<T>*>(volume.getRepresentation<VolumeRAM>())
+            ->getDataTyped();
+    const util::IndexMapper3D im{dims};
+    for (size_t z = 1; z + 1 < dims.z; ++z) {
+        for (size_t y = 1; y + 1 < dims.y; ++y) {
+            for (size_t x = 1; x + 1 < dims.x; ++x) {
+                check(data[im(x, y, z)]);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(VolumeDerivatives, gradient) {
+    const auto volume =
+        makeVolume<float>([](vec3 p) { return 2.0f * p.x - 3.0f * p.y + 0.5f * p.z; });
+    const auto gradient = util::gradientVolume(volume, 0);
+    forEachInterior<vec3>(*gradient, [](vec3 g) {
+        EXPECT_FLOAT_EQ(g.x, 2.0f);
+        EXPECT_FLOAT_EQ(g.y, -3.0f);
+        EXPECT_FLOAT_EQ(g.z, 0.5f);
+    });
+}
+
+TEST(VolumeDerivatives, curl) {
+    const auto volume = makeVolume<vec3>([](vec3 p) { return vec3{-p.y, p.x, p.y}; });
+    const auto curl = util::curlVolume(*volume);
+    forEachInterior<vec3>(*curl, [](vec3 c) {
+        EXPECT_FLOAT_EQ(c.x, 1.0f);
+        EXPECT_FLOAT_EQ(c.y, 0.0f);
+        EXPECT_FLOAT_EQ(c.z, 2.0f);
+    });
+}
+
+TEST(VolumeDerivatives, divergence) {
+    const auto volume = makeVolume<vec3>([](vec3 p) { return vec3{p.x, 2.0f * p.y, -p.z}; });
+    const auto divergence = util::divergenceVolume(*volume);
+    forEachInterior<float>(*divergence, [](float d) { EXPECT_FLOAT_EQ(d, 2.0f); });
+}
+
+TEST(VolumeDerivatives, laplacian) {
+    const auto volume = makeVolume<float>([](vec3 p) { return p.x * p.x + p.y * p.z; });
+    const auto laplacian =
+        util::volumeLaplacian(volume, util::VolumeLaplacianPostProcessing::None, 1.0);
+    forEachInterior<float>(*laplacian, [](float l) { EXPECT_FLOAT_EQ(l, 2.0f); });
+}
+
+}  // namespace inviwo
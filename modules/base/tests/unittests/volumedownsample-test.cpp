@@ -0,0 +1,107 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/volume/volumeramdownsample.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+// Straightforward 2x box filter with the voxels outside of the source clamped to the border
+std::vector<float> reference(const std::vector<float>& src, size3_t srcDims, size3_t dstDims) {
+    std::vector<float> dst(dstDims.x * dstDims.y * dstDims.z);
+    const util::IndexMapper3D srcIm{srcDims};
+    const util::IndexMapper3D dstIm{dstDims};
+    for (size_t z = 0; z < dstDims.z; ++z) {
+        for (size_t y = 0; y < dstDims.y; ++y) {
+            for (size_t x = 0; x < dstDims.x; ++x) {
+                double sum = 0.0;
+                for (size_t i = 0; i < 8; ++i) {
+                    const size3_t p{std::min(2 * x + (i & 1), srcDims.x - 1),
+                                    std::min(2 * y + ((i >> 1) & 1), srcDims.y - 1),
+                                    std::min(2 * z + ((i >> 2) & 1), srcDims.z - 1)};
+                    sum += src[srcIm(p)];
+                }
+                dst[dstIm(x, y, z)] = static_cast<float>(sum / 8.0);
+            }
+        }
+    }
+    return dst;
+}
+
+}  // namespace
+
+TEST(VolumeDownsample, pyramidMatchesReference) {
+    // Spans several tiles and has odd dimensions on every level
+    const size3_t dims{75, 37, 3};
+    VolumeRAMPrecision<float> volume{dims};
+    auto* data = volume.getDataTyped();
+    std::vector<float> level(data, data + dims.x * dims.y * dims.z);
+    for (size_t i = 0; i < level.size(); ++i) {
+        level[i] = static_cast<float>((i * 7919) % 1009);
+        data[i] = level[i];
+    }
+
+    const auto pyramid = util::volumePyramid(&volume);
+    ASSERT_EQ(pyramid.size(), 7);
+    EXPECT_EQ(pyramid.front()->getDimensions(), size3_t(38, 19, 2));
+    EXPECT_EQ(pyramid.back()->getDimensions(), size3_t(1, 1, 1));
+
+    size3_t levelDims = dims;
+    for (const auto& ram : pyramid) {
+        const auto dstDims = ram->getDimensions();
+        level = reference(level, levelDims, dstDims);
+        levelDims = dstDims;
+
+        const auto* result =
+            static_cast<const VolumeRAMPrecision<float>*>(ram.get())->getDataTyped();
+        for (size_t i = 0; i < level.size(); ++i) {
+            ASSERT_FLOAT_EQ(result[i], level[i]) << "at index " << i;
+        }
+    }
+}
+
+TEST(VolumeDownsample, pyramidMaxLevels) {
+    VolumeRAMPrecision<unsigned char> volume{size3_t{64, 64, 64}};
+    const auto pyramid = util::volumePyramid(&volume, util::DownsamplingMode::Strided, 2);
+    ASSERT_EQ(pyramid.size(), 2);
+    EXPECT_EQ(pyramid[1]->getDimensions(), size3_t(16, 16, 16));
+}
+
+}  // namespace inviwo
@@ -36,6 +36,13 @@
 #include <inviwo/core/datastructures/volume/volumeram.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/zip.h>
+
+#include <limits>
+#include <optional>
+#include <random>
+
+#include <glm/gtx/norm.hpp>
 
 namespace inviwo {
 
@@ -246,4 +253,61 @@ TEST(VolumeVoronoi, Voronoi_ThreeSeedPoints_PartitionsVolumeInThree) {
     }
 }
 
+TEST(VolumeVoronoi, Voronoi_ManySeedPoints_MatchesLinearSearch) {
+    std::mt19937 rand{0};
+    std::uniform_real_distribution<float> dis{0.0f, 1.0f};
+
+    Entity entity{size3_t{12, 10, 8}};
+    const auto& ct = entity.getCoordinateTransformer();
+    const auto i2d = ct.getIndexToDataMatrix();
+    const auto d2m = ct.getDataToModelMatrix();
+    const auto m2d = glm::inverse(d2m);
+    const auto dim = entity.getDimensions();
+    const util::IndexMapper3D im(dim);
+
+    // Seed points spread over the volume, given in model space
+    std::vector<std::pair<uint32_t, vec3>> seedPoints;
+    std::vector<float> weights;
+    for (uint32_t i = 0; i < 200; ++i) {
+        const vec3 dataPos{dis(rand), dis(rand), dis(rand)};
+        seedPoints.emplace_back(i + 1, vec3{d2m * vec4{dataPos, 1.0f}});
+        weights.push_back(dis(rand));
+    }
+
+    const auto wrapping = Wrapping3D{Wrapping::Repeat, Wrapping::Clamp, Wrapping::Repeat};
+    for (const bool weighted : {false, true}) {
+        auto volumeVoronoi = util::voronoiSegmentation(
+            dim, i2d, d2m, seedPoints, wrapping,
+            weighted ? std::optional{weights} : std::optional<std::vector<float>>{});
+        const auto data = static_cast<const VolumeRAMPrecision<unsigned short>*>(
+                              volumeVoronoi->getRepresentation<VolumeRAM>())
+                              ->getDataTyped();
+
+        for (size_t z = 0; z < dim.z; z++) {
+            for (size_t y = 0; y < dim.y; y++) {
+                for (size_t x = 0; x < dim.x; x++) {
+                    const auto voxel = vec3{i2d * vec4{vec3{x, y, z}, 1.0f}};
+                    float best = std::numeric_limits<float>::max();
+                    uint32_t expected = 0;
+                    for (const auto& [i, seed] : util::enumerate(seedPoints)) {
+                        auto delta = voxel - vec3{m2d * vec4{seed.second, 1.0f}};
+                        for (const size_t axis : {size_t{0}, size_t{2}}) {
+                            if (delta[axis] > 0.5f) delta[axis] -= 1.0f;
+                            if (delta[axis] < -0.5f) delta[axis] += 1.0f;
+                        }
+                        const auto dist = glm::length2(mat3{d2m} * delta) -
+                                          (weighted ? weights[i] * weights[i] : 0.0f);
+                        if (dist < best) {
+                            best = dist;
+                            expected = seed.first;
+                        }
+                    }
+                    EXPECT_EQ(expected, data[im(x, y, z)]) << "pos " << x << ", " << y << ", "
+                                                           << z << " weighted " << weighted;
+                }
+            }
+        }
+    }
+}
+
 }  // namespace inviwo
@@ -0,0 +1,59 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Owned by the HeightFieldProcessor
+// Generates the corners of a regular grid of quad patches covering the height field without any
+// vertex buffer. The patches are refined by heightfield.tesc and heightfield.tese.
+
+#include "utils/structs.glsl"
+
+uniform GeometryParameters geometry;
+
+uniform sampler2D inportHeightfield;
+uniform float heightScale = 1.0f;
+
+uniform uvec2 patches = uvec2(1u);
+// Maps texture coordinates to the data space of the terrain
+uniform mat4 patchToData = mat4(1.0);
+
+out vec4 worldPosition_vs;
+out vec2 texCoord_vs;
+
+const uvec2 corners[4] = uvec2[4](uvec2(0u, 0u), uvec2(1u, 0u), uvec2(1u, 1u), uvec2(0u, 1u));
+
+void main() {
+    uint patchIndex = uint(gl_VertexID) / 4u;
+    uvec2 patchPos = uvec2(patchIndex % patches.x, patchIndex / patches.x);
+    texCoord_vs = vec2(patchPos + corners[uint(gl_VertexID) % 4u]) / vec2(patches);
+
+    float height = textureLod(inportHeightfield, texCoord_vs, 0.0).r;
+    vec4 pos = patchToData * vec4(texCoord_vs, 0.0, 1.0) +
+               vec4(0.0, 0.0, height * heightScale, 0.0);
+    worldPosition_vs = geometry.dataToWorld * pos;
+}
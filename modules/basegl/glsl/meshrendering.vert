@@ -39,6 +39,21 @@ uniform vec4 overrideColor;
 
 uniform bool pickingEnabled = false;
 
+#ifdef MESH_BATCHING
+// Per mesh transforms of batched meshes, see MeshBatchGL
+layout(location = 15) in uint in_DrawId;
+
+struct DrawParameters {
+    mat4 dataToWorld;
+    mat4 dataToWorldNormalMatrix;
+};
+layout(std430, binding = 0) readonly buffer DrawParametersBuffer {
+    DrawParameters drawParameters[];
+};
+
+uniform bool batched = false;
+#endif
+
 out vec4 worldPosition_;
 out vec3 normal_;
 out vec3 viewNormal_;
@@ -53,8 +68,16 @@ void main() {
     color_ = in_Color;
 #endif
     texCoord_ = in_TexCoord;
-    worldPosition_ = geometry.dataToWorld * in_Vertex;
-    normal_ = geometry.dataToWorldNormalMatrix * normalize(in_Normal);
+    mat4 dataToWorld = geometry.dataToWorld;
+    mat3 normalMatrix = geometry.dataToWorldNormalMatrix;
+#ifdef MESH_BATCHING
+    if (batched) {
+        dataToWorld = drawParameters[in_DrawId].dataToWorld;
+        normalMatrix = mat3(drawParameters[in_DrawId].dataToWorldNormalMatrix);
+    }
+#endif
+    worldPosition_ = dataToWorld * in_Vertex;
+    normal_ = normalMatrix * normalize(in_Normal);
     viewNormal_ = transpose(mat3(camera.viewToWorld)) * normal_;
     gl_Position = camera.worldToClip * worldPosition_;
     pickColor_ = vec4(pickingIndexToColor(in_PickId), pickingEnabled ? 1.0 : 0.0);
@@ -38,6 +38,10 @@
 #include "utils/shading.glsl"
 #include "utils/raycastgeometry.glsl"
 
+#if defined(EMPTY_SPACE_SKIPPING)
+#include "utils/emptyspaceskipping.glsl"
+#endif
+
 uniform VolumeParameters volumeParameters;
 uniform sampler3D volume;
 
@@ -67,17 +71,26 @@ uniform sampler2D transferFunction2;
 uniform sampler2D transferFunction3;
 uniform sampler2D transferFunction4;
 
-#define ERT_THRESHOLD 0.99  // threshold for early ray termination
+// progressive refinement, see ProgressiveRefinementProperty
+uniform float samplingRateScale = 1.0;
+uniform float rayOffset = 0.5;
+
+#if defined(EMPTY_SPACE_SKIPPING)
+uniform sampler3D occupancy;
+uniform OccupancyParameters occupancyParameters;
+#endif
+
+uniform float ertThreshold = 0.99;  // threshold for early ray termination
 
 vec4 rayTraversal(vec3 entryPoint, vec3 exitPoint, vec2 texCoords, float backgroundDepth) {
     vec4 result = vec4(0.0);
     vec3 rayDirection = exitPoint - entryPoint;
     float tEnd = length(rayDirection);
-    float tIncr = min(
-        tEnd, tEnd / (raycaster.samplingRate * length(rayDirection * volumeParameters.dimensions)));
+    float tIncr = min(tEnd, tEnd / (raycaster.samplingRate * samplingRateScale *
+                                    length(rayDirection * volumeParameters.dimensions)));
     float samples = ceil(tEnd / tIncr);
     tIncr = tEnd / samples;
-    float t = 0.5f * tIncr;
+    float t = rayOffset * tIncr;
     rayDirection = normalize(rayDirection);
     float tDepth = -1.0;
     mat4 color;
@@ -103,6 +116,10 @@ vec4 rayTraversal(vec3 entryPoint, vec3 exitPoint, vec2 texCoords, float backgro
     while (t < tEnd) {
         samplePos = entryPoint + t * rayDirection;
         voxel = getNormalizedVoxel(volume, volumeParameters, samplePos);
+#if defined(EMPTY_SPACE_SKIPPING)
+        // channels that are transparent in the current macro cell are not classified
+        vec4 channelOccupancy = getOccupancy(occupancy, occupancyParameters, samplePos);
+#endif
 
         // macro defined in MultichannelRaycaster::initializeResources()
         // sets colors;
@@ -116,6 +133,9 @@ vec4 rayTraversal(vec3 entryPoint, vec3 exitPoint, vec2 texCoords, float backgro
             vec3 worldSpacePosition = (volumeParameters.textureToWorld * vec4(samplePos, 1.0)).xyz;
             gradients = COMPUTE_ALL_GRADIENTS(voxel, volume, volumeParameters, samplePos);
             for (int i = 0; i < NUMBER_OF_CHANNELS; ++i) {
+#if defined(SKIP_TRANSPARENT_CHANNELS)
+                if (color[i].a <= 0.0) continue;
+#endif
                 color[i].rgb =
                     APPLY_LIGHTING(lighting, color[i].rgb, color[i].rgb, vec3(1.0),
                                    worldSpacePosition, normalize(-gradients[i]), toCameraDir);
@@ -125,9 +145,21 @@ vec4 rayTraversal(vec3 entryPoint, vec3 exitPoint, vec2 texCoords, float backgro
         }
 
         // early ray termination
-        if (result.a > ERT_THRESHOLD) {
+        if (result.a > ertThreshold) {
             t = tEnd;
         } else {
+#if defined(EMPTY_SPACE_SKIPPING) && !defined(PLANES_ENABLED)
+            // jump to the last sample of a macro cell that is empty for all channels
+            float tSkip = skipEmptySpace(occupancy, occupancyParameters, entryPoint, rayDirection,
+                                         t, tIncr);
+#if defined(BACKGROUND_AVAILABLE)
+            // the background is composited at the first sample behind it
+            if (bgTDepth > t) {
+                tSkip = min(tSkip, t + (ceil((bgTDepth - t) / tIncr) - 1.0) * tIncr);
+            }
+#endif // BACKGROUND_AVAILABLE
+            t = max(t, tSkip);
+#endif // EMPTY_SPACE_SKIPPING
             t += tIncr;
         }
     }
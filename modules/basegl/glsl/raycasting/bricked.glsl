@@ -0,0 +1,128 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifndef IVW_BRICKED_GLSL
+#define IVW_BRICKED_GLSL
+
+#include "utils/structs.glsl"
+#include "utils/sampler3d.glsl"
+
+// Sampling of a bricked volume cached in a BrickPoolGL. The bricks are stored in the slots of a
+// 3D texture atlas and the page table maps each brick to its slot + 1, or 0 when the brick is not
+// resident. Every brick that is asked for is marked in the feedback buffer, which is read back
+// by the BrickPoolGL to decide which bricks to upload, while missing bricks are replaced by the
+// closest resident brick of a coarser level. The coarsest level is always resident.
+
+#if !defined MAX_BRICK_LEVELS
+#define MAX_BRICK_LEVELS 16
+#endif
+
+#if !defined BRICK_APRON
+#define BRICK_APRON 1
+#endif
+
+struct BrickLevel {
+    vec3 dimensions;  // Number of voxels of the level
+    ivec3 bricks;     // Number of bricks of the level
+    int firstBrick;   // Global index of the first brick of the level
+};
+
+layout(std430, binding = 0) readonly buffer BrickPageTable {
+    uint brickPageTable[];
+};
+
+layout(std430, binding = 1) buffer BrickFeedback {
+    uint brickFeedback[];
+};
+
+uniform BrickLevel brickLevels[MAX_BRICK_LEVELS];
+uniform int brickLevelCount = 1;
+uniform int brickSize = 32;
+uniform ivec3 brickSlots;
+uniform vec3 brickAtlasReciprocalDimensions;
+
+// Consecutive samples along a ray mostly hit the same bricks, only mark a brick when it changes
+uint brickLastRequested = 0xFFFFFFFFu;
+uint brickLastUsed = 0xFFFFFFFFu;
+
+void markBrick(uint brick, inout uint last) {
+    if (brick != last) {
+        atomicOr(brickFeedback[brick >> 5u], 1u << (brick & 31u));
+        last = brick;
+    }
+}
+
+// Map a position in texture space to the atlas, using the brick at level or a coarser one
+vec3 getBrickedAtlasPosition(vec3 samplePos, int level) {
+    for (int l = clamp(level, 0, brickLevelCount - 1); l < brickLevelCount; ++l) {
+        vec3 voxel = clamp(samplePos, 0.0, 1.0) * brickLevels[l].dimensions;
+        ivec3 brick = min(ivec3(voxel) / brickSize, brickLevels[l].bricks - 1);
+        uint index = uint(brickLevels[l].firstBrick + brick.x +
+                          brickLevels[l].bricks.x * (brick.y + brickLevels[l].bricks.y * brick.z));
+
+        if (l == level) {
+            markBrick(index, brickLastRequested);
+        }
+
+        uint slot = brickPageTable[index];
+        if (slot != 0u) {
+            if (l != level) {
+                markBrick(index, brickLastUsed);
+            }
+            slot -= 1u;
+            uvec3 slots = uvec3(brickSlots);
+            vec3 slotPos =
+                vec3(slot % slots.x, (slot / slots.x) % slots.y, slot / (slots.x * slots.y));
+            vec3 local = voxel - vec3(brick * brickSize) + float(BRICK_APRON);
+            return (slotPos * float(brickSize + 2 * BRICK_APRON) + local) *
+                   brickAtlasReciprocalDimensions;
+        }
+    }
+    // Not reachable since the coarsest level is always resident
+    return vec3(0.0);
+}
+
+vec4 getNormalizedBrickedVoxel(sampler3D atlas, VolumeParameters volumeParams, vec3 samplePos,
+                               int level) {
+    return getNormalizedVoxel(atlas, volumeParams, getBrickedAtlasPosition(samplePos, level));
+}
+
+// World space gradient using central differences, @see gradientCentralDiff
+vec3 getBrickedGradient(sampler3D atlas, VolumeParameters volumeParams, vec3 samplePos,
+                        int level, int channel) {
+    vec3 cDs;
+    for (int i = 0; i < 3; ++i) {
+        vec3 h = volumeParams.textureSpaceGradientSpacing[i];
+        cDs[i] = getNormalizedBrickedVoxel(atlas, volumeParams, samplePos + h, level)[channel] -
+                 getNormalizedBrickedVoxel(atlas, volumeParams, samplePos - h, level)[channel];
+    }
+    return cDs / (2.0 * volumeParams.worldSpaceGradientSpacing);
+}
+
+#endif  // IVW_BRICKED_GLSL
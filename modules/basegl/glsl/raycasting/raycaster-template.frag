@@ -53,6 +53,9 @@ layout(location = 1) out vec4 PickingData;
 
 uniform ImageParameters outportParameters;
 uniform float samplingRate = 2.0;
+// progressive refinement, see ProgressiveRefinementProperty
+uniform float samplingRateScale = 1.0;
+uniform float rayOffset = 0.5;
 
 #pragma IVW_SHADER_SEGMENT_PLACEHOLDER_UNIFORM
 
@@ -86,12 +89,13 @@ void main() {
     }
 
     // The step size in texture space
-    float rayStep = calcStep(rayLength, rayDirection, samplingRate, volumeParameters.dimensions);
+    float rayStep = calcStep(rayLength, rayDirection, samplingRate * samplingRateScale,
+                              volumeParameters.dimensions);
 
     vec3 cameraDir = calcCameraDir(entryPoint, exitPoint, volumeParameters.textureToWorld);
 
     // Current position along the ray
-    float rayPosition = 0.5 * rayStep;
+    float rayPosition = rayOffset * rayStep;
     // Current sample position in texture spcase
     vec3 samplePosition = entryPoint + rayPosition * rayDirection;
 
@@ -0,0 +1,222 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Owned by the TubeRendering Processor
+// Vertex pulling version of tuberendering.vert/.geom. Each line segment is drawn as one instance
+// of a 14 vertex triangle strip covering the prismoid around the segment. The vertex data is read
+// directly from the mesh buffers bound as shader storage buffers.
+
+#include "utils/structs.glsl"
+#include "utils/pickingutils.glsl"
+
+#ifdef HAS_ADJACENCY
+#define SIZE 4u
+#define BEGIN 1u
+#define END 2u
+#else
+#define SIZE 2u
+#define BEGIN 0u
+#define END 1u
+#endif
+
+layout(std430, binding = 0) readonly buffer PositionBuffer { float positions[]; };
+layout(std430, binding = 1) readonly buffer ColorBuffer { vec4 colors[]; };
+layout(std430, binding = 2) readonly buffer RadiiBuffer { float radii[]; };
+layout(std430, binding = 3) readonly buffer PickingBuffer { uint picking[]; };
+layout(std430, binding = 4) readonly buffer ScalarMetaBuffer { float scalarMeta[]; };
+layout(std430, binding = 5) readonly buffer IndexBuffer { uint indices[]; };
+
+uniform GeometryParameters geometry;
+uniform CameraParameters camera;
+
+uniform vec4 defaultColor = vec4(1, 0, 0, 1);
+uniform float defaultRadius = 0.1f;
+uniform sampler2D metaColor;
+
+uniform bool hasIndices = false;
+uniform uint positionComponents = 3u;
+// Elements between consecutive segments, 1 for strips, otherwise SIZE
+uniform uint segmentStride = SIZE;
+uniform uint numSegments = 0u;
+// Blocks of up to 2^lodLevels consecutive strip segments that are shorter than lodPixels on
+// screen are drawn as a single segment
+uniform uint lodLevels = 0u;
+uniform float lodPixels = 1.0;
+uniform vec2 viewport = vec2(1.0);
+
+out vec4 color_;
+flat out vec4 pickColor_;
+out vec3 worldPos_;
+out vec3 startPos_;
+out vec3 endPos_;
+out vec3 gEndplanes[2];
+out float radius_;
+
+// Prismoid corners of the triangle strip, corners 0-3 are around the start and 4-7 around the
+// end, see tuberendering.geom. The order gives the same front faces as the geometry shader.
+const uint corners[14] = uint[14](5u, 4u, 6u, 7u, 3u, 4u, 0u, 5u, 1u, 6u, 2u, 3u, 1u, 0u);
+
+uint vertexIndex(uint element) { return hasIndices ? indices[element] : element; }
+
+vec3 worldPosition(uint vertex) {
+    uint i = vertex * positionComponents;
+    vec4 pos = vec4(positions[i], positions[i + 1u],
+                    positionComponents > 2u ? positions[i + 2u] : 0.0, 1.0);
+    return (geometry.dataToWorld * pos).xyz;
+}
+
+float screenLength(vec3 a, vec3 b) {
+    vec4 ca = camera.worldToClip * vec4(a, 1.0);
+    vec4 cb = camera.worldToClip * vec4(b, 1.0);
+    // Never merge segments crossing the near plane
+    if (ca.w <= 0.0 || cb.w <= 0.0) return 1.0e30;
+    return length((ca.xy / ca.w - cb.xy / cb.w) * 0.5 * viewport);
+}
+
+void cull() {
+    // All vertices at the same point outside of the view, nothing is rasterized
+    gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+    color_ = vec4(0.0);
+    pickColor_ = vec4(0.0);
+    worldPos_ = vec3(0.0);
+    startPos_ = vec3(0.0);
+    endPos_ = vec3(0.0);
+    gEndplanes[0] = vec3(0.0);
+    gEndplanes[1] = vec3(0.0);
+    radius_ = 0.0;
+}
+
+vec4 vertexColor(uint vertex) {
+#if defined(HAS_SCALARMETA) && defined(USE_SCALARMETACOLOR) && !defined(FORCE_COLOR)
+    return texture(metaColor, vec2(scalarMeta[vertex], 0.5));
+#elif defined(HAS_COLOR) && !defined(FORCE_COLOR)
+    return colors[vertex];
+#else
+    return defaultColor;
+#endif
+}
+
+float vertexRadius(uint vertex) {
+#if defined(HAS_RADII) && !defined(FORCE_RADIUS)
+    return radii[vertex];
+#else
+    return defaultRadius;
+#endif
+}
+
+// v should be normalized
+vec3 findOrthogonalVector(vec3 v) {
+    vec3 A = normalize((camera.viewToWorld * vec4(1,0,0,0)).xyz);
+    if (abs(dot(v,A)) > 0.5) {
+        return cross(v,A);
+    } else {
+        vec3 B = normalize((camera.viewToWorld * vec4(0,0,1,0)).xyz);
+        return cross(v,B);
+    }
+}
+
+void main() {
+    uint segment = uint(gl_InstanceID);
+    uint first = segment * segmentStride;
+    // Number of consecutive strip segments drawn by this instance
+    uint count = 1u;
+
+    if (segmentStride == 1u && lodLevels > 0u) {
+        // Use the largest merged block containing this segment. All segments of the block find
+        // the same block, the first one draws it and the others are culled.
+        for (uint level = lodLevels; level > 0u; --level) {
+            uint blockBegin = segment & ~((1u << level) - 1u);
+            uint blockEnd = min(blockBegin + (1u << level), numSegments);
+            if (blockEnd - blockBegin < 2u) continue;
+            vec3 a = worldPosition(vertexIndex(blockBegin + BEGIN));
+            vec3 b = worldPosition(vertexIndex(blockEnd - 1u + END));
+            if (screenLength(a, b) < lodPixels) {
+                if (segment != blockBegin) {
+                    cull();
+                    return;
+                }
+                count = blockEnd - blockBegin;
+                break;
+            }
+        }
+    }
+
+    uint beginVertex = vertexIndex(first + BEGIN);
+    uint endVertex = vertexIndex(first + (count - 1u) * segmentStride + END);
+
+    vec3 startPos = worldPosition(beginVertex);
+    vec3 endPos = worldPosition(endVertex);
+    if (startPos == endPos) {  // zero size segment
+        cull();
+        return;
+    }
+
+#ifdef HAS_ADJACENCY
+    vec3 prevPos = worldPosition(vertexIndex(first));
+    vec3 nextPos = worldPosition(vertexIndex(first + (count - 1u) * segmentStride + END + 1u));
+#else
+    vec3 prevPos = startPos;
+    vec3 nextPos = endPos;
+#endif
+
+    vec3 prevDir = startPos - prevPos;
+    vec3 tubeDir = normalize(endPos - startPos);
+    vec3 nextDir = nextPos - endPos;
+    vec3 capNormals[2];
+    capNormals[0] = normalize(tubeDir + (prevDir != vec3(0) ? normalize(prevDir) : prevDir));
+    capNormals[1] = normalize(tubeDir + (nextDir != vec3(0) ? normalize(nextDir) : nextDir));
+
+    uint corner = corners[gl_VertexID];
+    uint cap = corner <= 3u ? 0u : 1u;
+    uint vertex = cap == 0u ? beginVertex : endVertex;
+    float radius = vertexRadius(vertex);
+
+    vec3 radialDir = findOrthogonalVector(tubeDir);
+    vec3 k = radius * normalize(cross(radialDir, capNormals[cap]));
+    vec3 i = radius * normalize(cross(k, capNormals[cap]));
+    // The corners go i + k, i - k, -i - k, -i + k around each cap
+    uint c = corner % 4u;
+    vec3 pos = (cap == 0u ? startPos : endPos) + (c <= 1u ? i : -i) +
+               (c == 0u || c == 3u ? k : -k);
+
+    uint pickID = 0u;
+#if defined(HAS_PICKING)
+    pickID = picking[beginVertex];
+#endif
+
+    gl_Position = camera.worldToClip * vec4(pos, 1.0);
+    color_ = vertexColor(vertex);
+    pickColor_ = vec4(pickingIndexToColor(pickID), pickID == 0u ? 0.0 : 1.0);
+    worldPos_ = pos;
+    startPos_ = startPos;
+    endPos_ = endPos;
+    gEndplanes[0] = capNormals[0];
+    gEndplanes[1] = capNormals[1];
+    radius_ = radius;
+}
@@ -0,0 +1,59 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Single stage alternative to volume_gpu.vert + volume_gpu.geom. Each instance of the image
+// plane is routed to its slice of the layered framebuffer by writing gl_Layer directly from the
+// vertex shader, which requires GL_ARB_shader_viewport_layer_array or GL_AMD_vertex_shader_layer.
+
+#include "utils/structs.glsl"
+
+uniform VolumeParameters volumeParameters;
+
+out vec4 texCoord_;
+out vec4 dataposition_;
+out vec4 worldPos_;
+
+void main() {
+    float reciprocalz = 1.0 / (volumeParameters.dimensions.z - 1.0);
+
+    texCoord_.xy = in_TexCoord.xy;
+    texCoord_.z = (gl_InstanceID * volumeParameters.reciprocalDimensions.z)
+        + (0.5 * volumeParameters.reciprocalDimensions.z);
+    texCoord_.w = 1.0;
+
+    dataposition_.xy = in_TexCoord.xy - volumeParameters.reciprocalDimensions.xy * 0.5;
+    dataposition_.xy /= 1.0 - volumeParameters.reciprocalDimensions.xy;
+    dataposition_.z = gl_InstanceID * reciprocalz;
+    dataposition_.w = 1.0;
+
+    worldPos_ = volumeParameters.textureToWorld * texCoord_;
+
+    gl_Layer = gl_InstanceID;
+    gl_Position = in_Vertex;
+}
@@ -45,6 +45,13 @@ void main() {
 #else
     float v = 1.0f;
 #endif
-    FragData0 =
-        vec4(gradientCentralDiff(vec4(1.0f), volume, volumeParameters, texCoord_.xyz, channel), v);
+    vec3 gradient = gradientCentralDiff(vec4(1.0f), volume, volumeParameters, texCoord_.xyz,
+                                        channel);
+#ifdef PACKED_GRADIENT
+    // store the normalized direction mapped to [0, 1] for an unsigned normalized texture
+    float len = length(gradient);
+    FragData0 = vec4(len > 0.0 ? gradient / len * 0.5 + 0.5 : vec3(0.5), 1.0);
+#else
+    FragData0 = vec4(gradient, v);
+#endif
 }
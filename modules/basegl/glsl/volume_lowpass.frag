@@ -30,33 +30,31 @@
 #include "utils/structs.glsl"
 #include "utils/sampler3d.glsl"
 
+// One separable pass of the low pass filter, applied along direction. The full 3D filter is
+// evaluated as three consecutive passes along x, y, and z.
+
 uniform sampler3D volume;
 uniform VolumeParameters volumeParameters;
 uniform int kernelSize;
+uniform vec3 direction;  // step between samples in texture coordinates
 
 uniform float sigmaSq2;
-uniform float a;
 
 in vec4 texCoord_;
 
 void main() {
-    int k2 = kernelSize / 2;
-    vec4 value = vec4(0,0,0,0);
-    float tot_weight = 0;
-    for(int z = -k2;z < k2;z++) {
-        for(int y = -k2;y < k2;y++) {
-            for(int x = -k2;x < k2;x++){
-                float w = 1.0;
+    float center = float(kernelSize - 1) * 0.5;
+    vec4 value = vec4(0);
+    float totWeight = 0.0;
+    for (int i = 0; i < kernelSize; ++i) {
+        float x = float(i) - center;
+        float w = 1.0;
 #ifdef GAUSSIAN
-                float l = x*x + y*y + z*z;
-                w = a * exp(-l / sigmaSq2);
+        w = exp(-(x * x) / sigmaSq2);
 #endif
-                value += w*getVoxel(volume, volumeParameters, texCoord_.xyz + vec3(x,y,z)*volumeParameters.reciprocalDimensions);
-                tot_weight += w;
-            }
-        }
+        value += w * getVoxel(volume, volumeParameters, texCoord_.xyz + x * direction);
+        totWeight += w;
     }
-    vec4 voxel = value / tot_weight;
-   
-    FragData0 = voxel;
-}
\ No newline at end of file
+
+    FragData0 = value / totWeight;
+}
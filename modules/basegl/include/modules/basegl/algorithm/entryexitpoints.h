@@ -34,9 +34,12 @@
 #include <inviwo/core/datastructures/image/image.h>  // for Image
 #include <inviwo/core/util/dispatcher.h>             // for Dispatcher
 #include <inviwo/core/util/glmmat.h>                 // for mat4
+#include <inviwo/core/util/glmvec.h>                 // for size2_t
 
 #include <functional>  // for function
-#include <memory>      // for shared_ptr, unique_ptr
+#include <memory>      // for shared_ptr, unique_ptr, weak_ptr
+#include <mutex>       // for mutex
+#include <vector>      // for vector
 
 namespace inviwo {
 
@@ -172,6 +175,57 @@ private:
     Dispatcher<void()> onReloadCallback_;
 };
 
+/**
+ * \class EntryExitPointsCache
+ * \brief Entry and exit points shared between processors
+ *
+ * Several raycasters often use the same camera and bounding geometry. The cache lets processors
+ * that create entry and exit points reuse the images of each other instead of rendering the same
+ * mesh again. Only weak references are kept, the entries are owned by the processors that render
+ * them. The owner may update the key of an entry in place after rendering new content into it.
+ */
+class IVW_MODULE_BASEGL_API EntryExitPointsCache {
+public:
+    struct IVW_MODULE_BASEGL_API Key {
+        std::weak_ptr<const Mesh> mesh;
+        mat4 viewMatrix{1.0f};
+        mat4 projectionMatrix{1.0f};
+        size2_t dimensions{0};
+        CapNearClip capNearClip = CapNearClip::No;
+        IncludeNormals includeNormals = IncludeNormals::No;
+
+        /**
+         * Keys match if they refer to the same, still existing, mesh and all other members are
+         * equal.
+         */
+        bool matches(const Key& other) const;
+    };
+    struct Entry {
+        Key key;
+        std::shared_ptr<Image> entryPoints;
+        std::shared_ptr<Image> exitPoints;
+    };
+
+    /**
+     * Find an entry matching @p key, returns nullptr if there is none.
+     */
+    std::shared_ptr<Entry> find(const Key& key);
+
+    /**
+     * Make @p entry available to other processors for as long as it exists.
+     */
+    void add(const std::shared_ptr<Entry>& entry);
+
+    /**
+     * The cache shared by all processors.
+     */
+    static EntryExitPointsCache& shared();
+
+private:
+    std::mutex mutex_;
+    std::vector<std::weak_ptr<Entry>> entries_;
+};
+
 }  // namespace algorithm
 
 }  // namespace inviwo
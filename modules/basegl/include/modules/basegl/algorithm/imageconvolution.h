@@ -43,22 +43,41 @@ namespace inviwo {
 class Image;
 class Layer;
 
+/**
+ * Convolution of image layers on the GPU. Separable kernels, including kernels given as a full
+ * 2D matrix that factor into a row and a column vector, are applied as two 1D passes costing
+ * kw + kh instead of kw * kh samples per pixel.
+ */
 class IVW_MODULE_BASEGL_API ImageConvolution {
 public:
     template <typename Callback>
     ImageConvolution(Callback C) : ImageConvolution() {
         shader_.onReload(C);
+        separableShader_.onReload(C);
     }
-    ImageConvolution() : shader_("img_convolution.frag", Shader::Build::No) {}
+    ImageConvolution()
+        : shader_("img_convolution.frag", Shader::Build::No)
+        , separableShader_("img_convolution_separable.frag", Shader::Build::No) {}
     virtual ~ImageConvolution() {}
 
     std::shared_ptr<Image> convolution(const Layer& layer, std::function<float(vec2)> kernelWeight,
                                        const float& kernelScale, ivec2 kernelSize);
+    /**
+     * Convolve @p layer with the @p kw x @p kh @p kernel, stored row by row. Kernels that are
+     * separable are detected and applied as two 1D passes.
+     */
     std::shared_ptr<Image> convolution(const Layer& layer, int kw, int kh,
                                        const std::vector<float>& kernel, const float& kernelScale);
 
     std::shared_ptr<Image> convolution_separable(const Layer& layer, std::function<float(float)>,
                                                  int kernelSize, const float& kernelScale);
+    /**
+     * Convolve @p layer with the outer product of @p horizontal and @p vertical
+     */
+    std::shared_ptr<Image> convolution_separable(const Layer& layer,
+                                                 const std::vector<float>& horizontal,
+                                                 const std::vector<float>& vertical,
+                                                 const float& kernelScale);
 
     std::shared_ptr<Image> gaussianLowpass(const Layer& layer, int kernelSize);
     std::shared_ptr<Image> gaussianLowpass(const Layer& layer, float sigma);
@@ -67,7 +86,14 @@ public:
     std::shared_ptr<Image> lowpass(const Layer& layer, int kernelSize);
 
 protected:
+    std::shared_ptr<Image> convolution1D(const Layer& layer, ivec2 direction,
+                                         const std::vector<float>& kernel,
+                                         const float& kernelScale);
+
     Shader shader_;
+    Shader separableShader_;
+    ivec2 kernelDims_{0};
+    int separableKernelSize_ = 0;
 };
 
 }  // namespace inviwo
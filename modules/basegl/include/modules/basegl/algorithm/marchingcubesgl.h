@@ -0,0 +1,90 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
+
+#include <inviwo/core/util/glmvec.h>              // for vec4
+#include <modules/opengl/buffer/bufferobject.h>  // for BufferObject
+#include <modules/opengl/shader/shader.h>        // for Shader
+
+#include <memory>  // for shared_ptr
+
+namespace inviwo {
+
+class Mesh;
+class Volume;
+
+/**
+ * \brief Extracts iso surfaces from volumes on the GPU using Marching Cubes in compute shaders.
+ *
+ * The volume is read from its VolumeGL representation and the resulting vertex and index buffers
+ * are written directly into BufferGL representations, avoiding any round trip of the volume or
+ * the surface through the CPU. The same case tables as util::marchingCubesOpt are used, hence the
+ * surfaces have the same triangles and orientation. Unlike the CPU version the vertices are not
+ * shared between triangles, and normals are computed from the gradient of the volume.
+ *
+ * The extraction runs in two passes. The first one only counts the triangles, which is the only
+ * value read back to the CPU and is used to allocate the buffers. In the second pass each work
+ * group reserves room for its triangles with a single atomic operation and writes them.
+ *
+ * Requires compute shader support, see isSupportedByGPU().
+ */
+class IVW_MODULE_BASEGL_API MarchingCubesGL {
+public:
+    MarchingCubesGL();
+    MarchingCubesGL(const MarchingCubesGL&) = delete;
+    MarchingCubesGL& operator=(const MarchingCubesGL&) = delete;
+    ~MarchingCubesGL();
+
+    static bool isSupportedByGPU();
+
+    /**
+     * Extract the iso surface of the first channel of @p volume.
+     * @param volume the scalar volume
+     * @param iso iso-value for the extracted surface, in the data range of the volume
+     * @param color the color of the resulting surface
+     * @param invert flips the surface orientation (useful when values greater than the iso-value
+     *        are 'outside' of the surface)
+     * @return a mesh with position, texture coordinate, color and normal buffers, and a triangle
+     *         index buffer. All buffers only have BufferGL representations.
+     */
+    std::shared_ptr<Mesh> extract(const Volume& volume, double iso, const vec4& color,
+                                  bool invert);
+
+private:
+    Shader countShader_;
+    Shader extractShader_;
+    BufferObject caseOffsets_;
+    BufferObject caseTriangles_;
+    BufferObject counter_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,107 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
+
+#include <inviwo/core/util/glmmat.h>  // for mat4
+#include <inviwo/core/util/glmvec.h>  // for vec3, vec2
+
+#include <array>    // for array
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <limits>   // for numeric_limits
+#include <span>     // for span
+#include <vector>   // for vector
+
+namespace inviwo {
+
+/**
+ * \brief Level of detail octree for point clouds.
+ *
+ * Each node of the octree holds a spatially uniform subset of at most nodeCapacity of its points,
+ * chosen by keeping one point per cell of a regular grid over the node. The remaining points are
+ * passed on to the eight children. Rendering a node together with all its ancestors hence gives
+ * an approximation of the subtree with a point spacing of about Node::spacing.
+ *
+ * The points of each node are stored as a contiguous range of getIndices() in depth first order,
+ * such that every subtree is contiguous as well. Rendering all points thus is a single range, and
+ * select() merges the ranges of neighboring nodes.
+ */
+class IVW_MODULE_BASEGL_API PointLOD {
+public:
+    static constexpr size_t defaultNodeCapacity = 8192;
+    static constexpr std::uint32_t noChild = std::numeric_limits<std::uint32_t>::max();
+    /// Keeps coincident points from being subdivided forever
+    static constexpr size_t maxDepth = 21;
+
+    struct Node {
+        vec3 min;                               //!< lower corner of the cubic bounds
+        float size;                             //!< edge length of the cubic bounds
+        float spacing;                          //!< approximate point spacing, 0 for leaves
+        std::uint32_t first;                    //!< first index of the points of the node
+        std::uint32_t count;                    //!< number of points of the node
+        std::uint32_t subtreeCount;             //!< number of points of the node and below
+        std::array<std::uint32_t, 8> children;  //!< node indices, or noChild if empty
+    };
+
+    struct Range {
+        std::uint32_t first;
+        std::uint32_t count;
+    };
+
+    /**
+     * Build the octree for @p positions, given in data space.
+     */
+    explicit PointLOD(std::span<const vec3> positions, size_t nodeCapacity = defaultNodeCapacity);
+
+    /**
+     * Select the nodes where the point spacing projected to the screen is at most @p maxError
+     * pixels, or the leaves, and cull the nodes outside of the view frustum.
+     * @param dataToClip  transform from data to clip space
+     * @param viewport    size of the viewport in pixels
+     * @param maxError    the maximum projected point spacing in pixels
+     * @return ranges of getIndices() to render, in increasing order
+     */
+    std::vector<Range> select(const mat4& dataToClip, vec2 viewport, float maxError) const;
+
+    const std::vector<std::uint32_t>& getIndices() const;
+    const std::vector<Node>& getNodes() const;
+
+private:
+    std::uint32_t build(std::span<std::uint32_t> ids, std::span<const vec3> positions, vec3 min,
+                        float size, size_t depth);
+
+    size_t nodeCapacity_;
+    std::vector<std::uint32_t> indices_;
+    std::vector<Node> nodes_;
+};
+
+}  // namespace inviwo
@@ -38,7 +38,7 @@
 #include <inviwo/core/processors/processorinfo.h>      // for ProcessorInfo
 #include <inviwo/core/properties/boolproperty.h>       // for BoolProperty
 #include <inviwo/core/properties/cameraproperty.h>     // for CameraProperty
-#include <modules/basegl/algorithm/entryexitpoints.h>  // for EntryExitPointsHelper
+#include <modules/basegl/algorithm/entryexitpoints.h>  // for EntryExitPointsHelper, Entr...
 
 #include <functional>  // for function
 #include <memory>      // for shared_ptr
@@ -46,7 +46,6 @@
 namespace inviwo {
 
 class Deserializer;
-class ImageGL;
 
 class IVW_MODULE_BASEGL_API EntryExitPoints : public Processor {
 public:
@@ -70,8 +69,10 @@ private:
     algorithm::EntryExitPointsHelper entryExitHelper_;
     std::shared_ptr<std::function<void()>> onReloadCallback_;
 
-    ImageGL* entryImg_ = nullptr;
-    ImageGL* exitImg_ = nullptr;
+    // The entry and exit points rendered by this processor, shared with others through the
+    // EntryExitPointsCache, and the entry of another processor currently in use, if any.
+    std::shared_ptr<algorithm::EntryExitPointsCache::Entry> result_;
+    std::shared_ptr<algorithm::EntryExitPointsCache::Entry> shared_;
 };
 
 }  // namespace inviwo
@@ -40,8 +40,11 @@
 #include <inviwo/core/properties/optionproperty.h>          // for OptionPropertyInt
 #include <inviwo/core/properties/ordinalproperty.h>         // for FloatProperty
 #include <inviwo/core/properties/simplelightingproperty.h>  // for SimpleLightingProperty
+#include <modules/opengl/buffer/bufferobjectarray.h>        // for BufferObjectArray
 #include <modules/opengl/shader/shader.h>                   // for Shader
 
+#include <memory>  // for unique_ptr
+
 namespace inviwo {
 
 namespace HeightFieldShading {
@@ -54,9 +57,15 @@ enum Type {
 
 /**
  * \brief Maps a heightfield onto a geometry and renders it to an image.
+ *
+ * In the Tessellation mode the input geometry is only used for placement. The terrain is instead
+ * generated on the GPU from a grid of patches that is refined based on the screen space size of
+ * each patch edge, which avoids building a mesh with one vertex per height sample.
  */
 class IVW_MODULE_BASEGL_API HeightFieldProcessor : public Processor {
 public:
+    enum class Mode { MeshDisplacement, Tessellation };
+
     HeightFieldProcessor();
     ~HeightFieldProcessor();
 
@@ -77,6 +86,8 @@ private:
 
     FloatProperty heightScale_;             //!< scaling factor for the input heightfield
     OptionPropertyInt terrainShadingMode_;  //!< shading mode for coloring the heightfield
+    OptionProperty<Mode> mode_;             //!< displace the input meshes or tessellate
+    FloatProperty triangleSize_;            //!< target triangle edge length in pixels
 
     CameraProperty camera_;
     CameraTrackball trackball_;
@@ -84,6 +95,9 @@ private:
     SimpleLightingProperty lightingProperty_;
 
     Shader shader_;
+    Shader tessellationShader_;
+    bool tessellationAvailable_;
+    std::unique_ptr<BufferObjectArray> vao_;
 };
 
 }  // namespace inviwo
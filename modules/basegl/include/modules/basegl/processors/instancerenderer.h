@@ -35,8 +35,11 @@
 #include <inviwo/core/ports/meshport.h>                     // for MeshInport
 #include <inviwo/core/processors/processor.h>               // for Processor
 #include <inviwo/core/processors/processorinfo.h>           // for ProcessorInfo
+#include <inviwo/core/properties/boolproperty.h>            // for BoolProperty
 #include <inviwo/core/properties/cameraproperty.h>          // for CameraProperty
+#include <inviwo/core/properties/compositeproperty.h>       // for CompositeProperty
 #include <inviwo/core/properties/listproperty.h>            // for ListProperty
+#include <inviwo/core/properties/ordinalproperty.h>         // for FloatProperty
 #include <inviwo/core/properties/propertyownerobserver.h>   // for PropertyOwnerObserver
 #include <inviwo/core/properties/simplelightingproperty.h>  // for SimpleLightingProperty
 #include <inviwo/core/properties/stringproperty.h>          // for StringProperty
@@ -62,12 +65,15 @@ class StringShaderResource;
 namespace detail {
 /**
  * Helper class for the InstanceRenderer to manage construction, destruction, binding, and setting
- * of uniforms for dynamically created ports.
+ * of uniforms for dynamically created ports. For instanced rendering the port data is instead
+ * uploaded to a shader storage buffer and indexed by the instance in the shader.
  */
 struct IVW_MODULE_BASEGL_API DynPort {
     DynPort(InstanceRenderer* theRenderer, std::unique_ptr<Inport> aPort,
             std::function<std::optional<size_t>()> aSize, std::function<void(Shader&, size_t)> aSet,
-            std::function<void(ShaderObject&)> aAddUniform);
+            std::function<void(ShaderObject&)> aAddUniform,
+            std::function<void(ShaderObject&, GLuint)> aAddInstanceData,
+            std::function<void(GLuint)> aBindInstanceData);
 
     DynPort(const DynPort&) = delete;
     DynPort& operator=(const DynPort&) = delete;
@@ -80,6 +86,10 @@ struct IVW_MODULE_BASEGL_API DynPort {
     std::function<std::optional<size_t>()> size;
     std::function<void(Shader&, size_t)> set;
     std::function<void(ShaderObject&)> addUniform;
+    /// Declare the port data as a storage buffer at the given binding point
+    std::function<void(ShaderObject&, GLuint)> addInstanceData;
+    /// Upload any changes of the port data and bind the storage buffer to the binding point
+    std::function<void(GLuint)> bindInstanceData;
 };
 
 struct IVW_MODULE_BASEGL_API DynUniform {
@@ -118,6 +128,16 @@ public:
     std::optional<mat4> render(bool enableBoundingBoxCalc);
 
 private:
+    void addSegments(ShaderObject& so, bool instanced) const;
+    void buildInstanced();
+    /**
+     * Draw all instances using instanced draw calls. If frustum culling or levels of detail are
+     * used, a compute pass first compacts the visible instances of each level into a list, and
+     * the draw calls are issued indirectly using the number of instances found.
+     */
+    void renderInstanced(const Mesh& mesh, size_t nInstances);
+    void cullInstances(const Mesh& mesh, size_t nInstances, size_t nLods);
+
     void onDidAddProperty(Property* property, size_t index) override;
     void onWillRemoveProperty(Property* property, size_t index) override;
 
@@ -133,6 +153,7 @@ private:
     static std::vector<std::unique_ptr<Property>> uniformPrefabs();
 
     MeshInport inport_;
+    MeshFlatMultiInport lodMeshes_;
     ImageInport background_;
     ImageOutport outport_;
 
@@ -149,8 +170,22 @@ private:
     StringProperty commonCode_;
     std::array<StringProperty, 5> transforms_;
 
+    CompositeProperty performance_;
+    BoolProperty gpuInstancing_;
+    BoolProperty frustumCulling_;
+    FloatProperty lodDistance_;
+
     std::shared_ptr<StringShaderResource> vert_;
     std::shared_ptr<StringShaderResource> frag_;
+    std::shared_ptr<StringShaderResource> cull_;
     Shader shader_;
+    Shader instancedShader_;
+    Shader cullShader_;
+    bool instancingAvailable_;
+    bool cullingAvailable_;
+
+    std::unique_ptr<BufferObject> visibleInstances_;
+    std::unique_ptr<BufferObject> lodCounts_;
+    std::unique_ptr<BufferObject> drawCommands_;
 };
 }  // namespace inviwo
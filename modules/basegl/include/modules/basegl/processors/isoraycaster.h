@@ -31,16 +31,19 @@
 
 #include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
 
-#include <inviwo/core/ports/imageport.h>                      // for ImageInport, ImageOutport
-#include <inviwo/core/ports/volumeport.h>                     // for VolumeInport
-#include <inviwo/core/processors/processor.h>                 // for Processor
-#include <inviwo/core/processors/processorinfo.h>             // for ProcessorInfo
-#include <inviwo/core/properties/cameraproperty.h>            // for CameraProperty
-#include <inviwo/core/properties/optionproperty.h>            // for OptionPropertyInt
-#include <inviwo/core/properties/ordinalproperty.h>           // for FloatVec4Property
-#include <inviwo/core/properties/simplelightingproperty.h>    // for SimpleLightingProperty
-#include <inviwo/core/properties/simpleraycastingproperty.h>  // for SimpleRaycastingProperty
-#include <modules/opengl/shader/shader.h>                     // for Shader
+#include <inviwo/core/ports/imageport.h>                              // for ImageInport, ImageOu...
+#include <inviwo/core/ports/volumeport.h>                             // for VolumeInport
+#include <inviwo/core/processors/processor.h>                         // for Processor
+#include <inviwo/core/processors/processorinfo.h>                     // for ProcessorInfo
+#include <inviwo/core/properties/boolproperty.h>                      // for BoolProperty
+#include <inviwo/core/properties/cameraproperty.h>                    // for CameraProperty
+#include <inviwo/core/properties/optionproperty.h>                    // for OptionPropertyInt
+#include <inviwo/core/properties/ordinalproperty.h>                   // for FloatVec4Property
+#include <inviwo/core/properties/simplelightingproperty.h>            // for SimpleLightingProperty
+#include <inviwo/core/properties/simpleraycastingproperty.h>          // for SimpleRaycastingProp...
+#include <modules/basegl/properties/progressiverefinementproperty.h>  // for ProgressiveRefineme...
+#include <modules/basegl/rendering/gradientvolumegl.h>                // for GradientVolumeGL
+#include <modules/opengl/shader/shader.h>                             // for Shader
 
 namespace inviwo {
 class Deserializer;
@@ -59,6 +62,8 @@ public:
 
 protected:
     virtual void process() override;
+    bool usePrecomputedGradients() const;
+
     Shader shader_;
 
 private:
@@ -73,10 +78,12 @@ private:
     OptionPropertyInt channel_;
 
     SimpleRaycastingProperty raycasting_;
+    BoolProperty precomputedGradients_;
+    ProgressiveRefinementProperty refinement_;
     CameraProperty camera_;
     SimpleLightingProperty lighting_;
 
-private:
+    GradientVolumeGL gradientVolume_;
 };
 
 }  // namespace inviwo
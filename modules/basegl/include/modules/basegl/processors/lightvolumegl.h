@@ -39,6 +39,7 @@
 #include <inviwo/core/processors/processor.h>                  // for Processor
 #include <inviwo/core/processors/processorinfo.h>              // for ProcessorInfo
 #include <inviwo/core/properties/boolproperty.h>               // for BoolProperty
+#include <inviwo/core/properties/ordinalproperty.h>            // for IntProperty
 #include <inviwo/core/properties/optionproperty.h>             // for OptionPropertyInt
 #include <inviwo/core/properties/transferfunctionproperty.h>   // for TransferFunctionProperty
 #include <inviwo/core/util/formats.h>                          // for DataUInt8, DataFormatId
@@ -114,6 +115,7 @@ private:
     OptionPropertyInt volumeSizeOption_;
     TransferFunctionProperty transferFunction_;
     BoolProperty floatPrecision_;
+    IntProperty slicesPerFrame_;
 
     Shader propagationShader_;
     Shader mergeShader_;
@@ -136,6 +138,12 @@ private:
     vec3 lightPos_;
     LightSourceType lightType_;
     bool calculatedOnes_;
+
+    // Something affecting the illumination has changed since the last propagation started
+    bool propagationInvalid_ = true;
+    bool reattachMerge_ = true;
+    // The next slice to propagate, non-zero while a propagation is spread over several frames
+    size_t nextSlice_ = 0;
 };
 
 }  // namespace inviwo
@@ -42,6 +42,7 @@
 #include <inviwo/core/properties/optionproperty.h>          // for OptionPropertyInt
 #include <inviwo/core/properties/ordinalproperty.h>         // for FloatVec4Property
 #include <inviwo/core/properties/simplelightingproperty.h>  // for SimpleLightingProperty
+#include <modules/opengl/rendering/meshbatchgl.h>           // for MeshBatchGL
 #include <modules/opengl/shader/shader.h>                   // for Shader
 
 namespace inviwo {
@@ -62,17 +63,23 @@ public:
     virtual void process() override;
 
 protected:
+    void render(ImageOutport& outport, const CameraProperty& camera);
+
     MeshFlatMultiInport inport_;
     ImageInport imageInport_;
     ImageOutport outport_;
+    ImageOutport rightOutport_;
 
     CameraProperty camera_;
+    BoolProperty stereo_;
+    CameraProperty rightCamera_;
 
     CompositeProperty meshProperties_;
     OptionPropertyInt cullFace_;
     BoolProperty enableDepthTest_;
     BoolProperty overrideColorBuffer_;
     FloatVec4Property overrideColor_;
+    BoolProperty batchMeshes_;
 
     SimpleLightingProperty lightingProperty_;
     CameraTrackball trackball_;
@@ -84,6 +91,8 @@ protected:
     BoolProperty viewNormalsLayer_;
 
     Shader shader_;
+    MeshBatchGL batch_;
+    bool batchValid_;
 };
 
 }  // namespace inviwo
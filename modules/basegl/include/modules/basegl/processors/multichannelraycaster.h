@@ -31,19 +31,24 @@
 
 #include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
 
-#include <inviwo/core/ports/imageport.h>                      // for ImageInport, ImageOutport
-#include <inviwo/core/ports/volumeport.h>                     // for VolumeInport
-#include <inviwo/core/processors/processor.h>                 // for Processor
-#include <inviwo/core/processors/processorinfo.h>             // for ProcessorInfo
-#include <inviwo/core/properties/cameraproperty.h>            // for CameraProperty
-#include <inviwo/core/properties/compositeproperty.h>         // for CompositeProperty
-#include <inviwo/core/properties/simplelightingproperty.h>    // for SimpleLightingProperty
-#include <inviwo/core/properties/simpleraycastingproperty.h>  // for SimpleRaycastingProperty
-#include <inviwo/core/properties/transferfunctionproperty.h>  // for TransferFunctionProperty
-#include <inviwo/core/properties/volumeindicatorproperty.h>   // for VolumeIndicatorProperty
-#include <modules/opengl/shader/shader.h>                     // for Shader
-
-#include <array>  // for array
+#include <inviwo/core/ports/imageport.h>                              // for ImageInport, ImageOu...
+#include <inviwo/core/ports/volumeport.h>                             // for VolumeInport
+#include <inviwo/core/processors/processor.h>                         // for Processor
+#include <inviwo/core/processors/processorinfo.h>                     // for ProcessorInfo
+#include <inviwo/core/properties/boolproperty.h>                      // for BoolProperty
+#include <inviwo/core/properties/cameraproperty.h>                    // for CameraProperty
+#include <inviwo/core/properties/compositeproperty.h>                 // for CompositeProperty
+#include <inviwo/core/properties/ordinalproperty.h>                   // for FloatProperty
+#include <inviwo/core/properties/simplelightingproperty.h>            // for SimpleLightingProperty
+#include <inviwo/core/properties/simpleraycastingproperty.h>          // for SimpleRaycastingProp...
+#include <inviwo/core/properties/transferfunctionproperty.h>          // for TransferFunctionProp...
+#include <inviwo/core/properties/volumeindicatorproperty.h>           // for VolumeIndicatorProperty
+#include <modules/basegl/properties/progressiverefinementproperty.h>  // for ProgressiveRefineme...
+#include <modules/basegl/rendering/emptyspaceskippinggl.h>            // for EmptySpaceSkippingGL
+#include <modules/opengl/shader/shader.h>                             // for Shader
+
+#include <array>   // for array
+#include <bitset>  // for bitset
 
 namespace inviwo {
 class Deserializer;
@@ -63,6 +68,13 @@ public:
     virtual void deserialize(Deserializer& d) override;
 
 private:
+    bool useEmptySpaceSkipping() const;
+    /**
+     * The channels whose transfer function has any non-transparent primitive. The other channels
+     * are not classified at all in the shader.
+     */
+    std::bitset<4> visibleChannels() const;
+
     Shader shader_;
 
     VolumeInport volumePort_;
@@ -75,9 +87,15 @@ private:
     std::array<TransferFunctionProperty, 4> tfs_;
 
     SimpleRaycastingProperty raycasting_;
+    FloatProperty earlyRayTermination_;
+    BoolProperty emptySpaceSkipping_;
+    ProgressiveRefinementProperty refinement_;
     CameraProperty camera_;
     SimpleLightingProperty lighting_;
     VolumeIndicatorProperty positionIndicator_;
+
+    EmptySpaceSkippingGL emptySpace_;
+    std::bitset<4> visibleChannels_;  // The visible channels the shader was built for
 };
 
 }  // namespace inviwo
@@ -49,6 +49,7 @@
 #include <modules/basegl/util/periodicitygl.h>
 #include <modules/basegl/util/sphereconfig.h>
 #include <modules/basegl/util/meshtexturing.h>
+#include <modules/basegl/util/pointlodgl.h>
 
 #include <cstddef>
 
@@ -108,6 +109,7 @@ private:
     UniformLabelAtlasGL labels_;
     PeriodicityGL periodic_;
     MeshTexturing texture_;
+    PointLODGL lod_;
 
     CameraProperty camera_;
     CameraTrackball trackball_;
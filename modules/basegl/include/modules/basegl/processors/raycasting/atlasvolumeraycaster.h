@@ -31,22 +31,23 @@
 
 #include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEG...
 
-#include <inviwo/core/datastructures/representationconverter.h>          // for RepresentationCo...
-#include <inviwo/core/datastructures/representationconverterfactory.h>   // for RepresentationCo...
-#include <inviwo/core/processors/processorinfo.h>                        // for ProcessorInfo
-#include <inviwo/core/util/zip.h>                                        // for zipper
-#include <modules/basegl/processors/raycasting/volumeraycasterbase.h>    // for VolumeRaycasterBase
-#include <modules/basegl/shadercomponents/atlascomponent.h>              // for AtlasComponent
-#include <modules/basegl/shadercomponents/backgroundcomponent.h>         // for BackgroundComponent
-#include <modules/basegl/shadercomponents/cameracomponent.h>             // for CameraComponent
-#include <modules/basegl/shadercomponents/entryexitcomponent.h>          // for EntryExitComponent
-#include <modules/basegl/shadercomponents/isotfcomponent.h>              // for IsoTFComponent
-#include <modules/basegl/shadercomponents/lightcomponent.h>              // for LightComponent
-#include <modules/basegl/shadercomponents/positionindicatorcomponent.h>  // for PositionIndicato...
-#include <modules/basegl/shadercomponents/raycastingcomponent.h>         // for RaycastingComponent
-#include <modules/basegl/shadercomponents/sampletransformcomponent.h>    // for SampleTransformC...
-#include <modules/basegl/shadercomponents/timecomponent.h>               // for TimeComponent
-#include <modules/basegl/shadercomponents/volumecomponent.h>             // for VolumeComponent
+#include <inviwo/core/datastructures/representationconverter.h>              // for Representatio...
+#include <inviwo/core/datastructures/representationconverterfactory.h>       // for Representatio...
+#include <inviwo/core/processors/processorinfo.h>                            // for ProcessorInfo
+#include <inviwo/core/util/zip.h>                                            // for zipper
+#include <modules/basegl/processors/raycasting/volumeraycasterbase.h>        // for VolumeRaycast...
+#include <modules/basegl/shadercomponents/atlascomponent.h>                  // for AtlasComponent
+#include <modules/basegl/shadercomponents/backgroundcomponent.h>             // for BackgroundCom...
+#include <modules/basegl/shadercomponents/cameracomponent.h>                 // for CameraComponent
+#include <modules/basegl/shadercomponents/entryexitcomponent.h>              // for EntryExitComp...
+#include <modules/basegl/shadercomponents/isotfcomponent.h>                  // for IsoTFComponent
+#include <modules/basegl/shadercomponents/lightcomponent.h>                  // for LightComponent
+#include <modules/basegl/shadercomponents/positionindicatorcomponent.h>      // for PositionIndic...
+#include <modules/basegl/shadercomponents/progressiverefinementcomponent.h>  // for ProgressiveRe...
+#include <modules/basegl/shadercomponents/raycastingcomponent.h>             // for RaycastingCom...
+#include <modules/basegl/shadercomponents/sampletransformcomponent.h>        // for SampleTransfo...
+#include <modules/basegl/shadercomponents/timecomponent.h>                   // for TimeComponent
+#include <modules/basegl/shadercomponents/volumecomponent.h>                 // for VolumeComponent
 
 #include <array>          // for array
 #include <memory>         // for unique_ptr
@@ -66,6 +67,8 @@ public:
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
 
+    virtual void process() override;
+
 private:
     TimeComponent time_;
     VolumeComponent volume_;
@@ -78,6 +81,7 @@ private:
     PositionIndicatorComponent positionIndicator_;
     SampleTransformComponent sampleTransform_;
     AtlasComponent atlas_;
+    ProgressiveRefinementComponent refinement_;
 };
 
 }  // namespace inviwo
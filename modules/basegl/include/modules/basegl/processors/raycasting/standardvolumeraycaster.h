@@ -31,20 +31,21 @@
 
 #include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEG...
 
-#include <inviwo/core/datastructures/representationconverter.h>          // for RepresentationCo...
-#include <inviwo/core/datastructures/representationconverterfactory.h>   // for RepresentationCo...
-#include <inviwo/core/processors/processorinfo.h>                        // for ProcessorInfo
-#include <inviwo/core/util/zip.h>                                        // for zipper
-#include <modules/basegl/processors/raycasting/volumeraycasterbase.h>    // for VolumeRaycasterBase
-#include <modules/basegl/shadercomponents/backgroundcomponent.h>         // for BackgroundComponent
-#include <modules/basegl/shadercomponents/cameracomponent.h>             // for CameraComponent
-#include <modules/basegl/shadercomponents/entryexitcomponent.h>          // for EntryExitComponent
-#include <modules/basegl/shadercomponents/isotfcomponent.h>              // for IsoTFComponent
-#include <modules/basegl/shadercomponents/lightcomponent.h>              // for LightComponent
-#include <modules/basegl/shadercomponents/positionindicatorcomponent.h>  // for PositionIndicato...
-#include <modules/basegl/shadercomponents/raycastingcomponent.h>         // for RaycastingComponent
-#include <modules/basegl/shadercomponents/sampletransformcomponent.h>    // for SampleTransformC...
-#include <modules/basegl/shadercomponents/volumecomponent.h>             // for VolumeComponent
+#include <inviwo/core/datastructures/representationconverter.h>           // for RepresentationCo...
+#include <inviwo/core/datastructures/representationconverterfactory.h>    // for RepresentationCo...
+#include <inviwo/core/processors/processorinfo.h>                         // for ProcessorInfo
+#include <inviwo/core/util/zip.h>                                         // for zipper
+#include <modules/basegl/processors/raycasting/volumeraycasterbase.h>     // for VolumeRaycasterBase
+#include <modules/basegl/shadercomponents/backgroundcomponent.h>          // for BackgroundComponent
+#include <modules/basegl/shadercomponents/cameracomponent.h>              // for CameraComponent
+#include <modules/basegl/shadercomponents/emptyspaceskippingcomponent.h>  // for EmptySpaceSki...
+#include <modules/basegl/shadercomponents/entryexitcomponent.h>           // for EntryExitComponent
+#include <modules/basegl/shadercomponents/isotfcomponent.h>               // for IsoTFComponent
+#include <modules/basegl/shadercomponents/lightcomponent.h>               // for LightComponent
+#include <modules/basegl/shadercomponents/positionindicatorcomponent.h>   // for PositionIndicato...
+#include <modules/basegl/shadercomponents/raycastingcomponent.h>          // for RaycastingComponent
+#include <modules/basegl/shadercomponents/sampletransformcomponent.h>     // for SampleTransformC...
+#include <modules/basegl/shadercomponents/volumecomponent.h>              // for VolumeComponent
 
 #include <array>          // for array
 #include <memory>         // for unique_ptr
@@ -70,6 +71,7 @@ private:
     BackgroundComponent background_;
     IsoTFComponent<1> isoTF_;
     RaycastingComponent raycasting_;
+    EmptySpaceSkippingComponent emptySpace_;
     CameraComponent camera_;
     LightComponent light_;
     PositionIndicatorComponent positionIndicator_;
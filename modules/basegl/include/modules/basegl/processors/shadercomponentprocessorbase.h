@@ -80,6 +80,12 @@ protected:
     virtual void initializeResources() override;
     virtual void process() override;
 
+    /**
+     * Draw using all the registered components into the currently active render target.
+     * Used by process(), derived classes can override process() to customize the render target.
+     */
+    void render();
+
     /**
      * Handle any error while using the raycasting components.
      * Override to customize error handling.
@@ -36,20 +36,24 @@
 #include <inviwo/core/ports/meshport.h>                     // for MeshFlatMultiInport
 #include <inviwo/core/processors/processor.h>               // for Processor
 #include <inviwo/core/processors/processorinfo.h>           // for ProcessorInfo
+#include <inviwo/core/properties/boolproperty.h>            // for BoolProperty
 #include <inviwo/core/properties/cameraproperty.h>          // for CameraProperty
 #include <inviwo/core/properties/optionproperty.h>          // for OptionProperty
 #include <inviwo/core/properties/simplelightingproperty.h>  // for SimpleLightingPro...
 
 #include <modules/basegl/datastructures/meshshadercache.h>  // for MeshShaderCache
+#include <modules/basegl/rendering/glyphcullinggl.h>        // for GlyphCullingGL
 #include <modules/basegl/util/meshbnlgl.h>
 #include <modules/basegl/util/uniformlabelatlasgl.h>
 #include <modules/basegl/util/periodicitygl.h>
 #include <modules/basegl/util/sphereconfig.h>
 #include <modules/basegl/util/glyphclipping.h>
 #include <modules/basegl/util/meshtexturing.h>
+#include <modules/basegl/util/pointlodgl.h>
 
 namespace inviwo {
 
+class Mesh;
 class Shader;
 
 /**
@@ -72,6 +76,8 @@ public:
 
 private:
     void configureShader(Shader& shader);
+    Shader& activateShader(const Mesh& mesh);
+    bool useSimpleDraw() const;
 
     enum class RenderMode {
         EntireMesh,  //!< render all vertices of the input mesh as glyphs
@@ -83,6 +89,8 @@ private:
     ImageOutport outport_;
 
     OptionProperty<RenderMode> renderMode_;
+    BoolProperty culling_;
+    PointLODGL lod_;
     MeshBnLGL bnl_;
     GlyphClipping clip_;
     SphereConfig config_;
@@ -95,6 +103,7 @@ private:
     SimpleLightingProperty lighting_;
 
     MeshShaderCache shaders_;
+    GlyphCullingGL glyphCulling_;
 };
 
 }  // namespace inviwo
@@ -39,17 +39,21 @@
 #include <inviwo/core/properties/boolproperty.h>              // for BoolProperty
 #include <inviwo/core/properties/cameraproperty.h>            // for CameraProperty
 #include <inviwo/core/properties/compositeproperty.h>         // for CompositeProperty
+#include <inviwo/core/properties/optionproperty.h>            // for OptionProperty
 #include <inviwo/core/properties/ordinalproperty.h>           // for FloatProperty, FloatVec4Pro...
 #include <inviwo/core/properties/simplelightingproperty.h>    // for SimpleLightingProperty
 #include <inviwo/core/properties/transferfunctionproperty.h>  // for TransferFunctionProperty
 #include <modules/basegl/datastructures/meshshadercache.h>    // for MeshShaderCache::Requirement
 #include <modules/opengl/shader/shadertype.h>                 // for ShaderType
 
+#include <memory>   // for unique_ptr
 #include <string>   // for string
 #include <utility>  // for pair
 #include <vector>   // for vector
 
 namespace inviwo {
+class BufferObjectArray;
+class Mesh;
 class Shader;
 
 class IVW_MODULE_BASEGL_API TubeRendering : public Processor {
@@ -57,14 +61,21 @@ public:
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
     TubeRendering();
-    virtual ~TubeRendering() = default;
+    virtual ~TubeRendering();
 
     virtual void process() override;
 
     virtual void initializeResources() override;
 
+    enum class Mode { GeometryShader, VertexPulling };
+
 protected:
     void configureShader(Shader& shader);
+    /**
+     * Draw the line segments of @p mesh reading the vertex data directly from the buffers
+     * instead of expanding the segments in a geometry shader. Requires OpenGL 4.3.
+     */
+    void drawPulling(const Mesh& mesh, Shader& shader, bool adjacency);
 
     MeshFlatMultiInport inport_;
     ImageInport imageInport_;
@@ -78,6 +89,9 @@ protected:
     BoolProperty useMetaColor_;
     TransferFunctionProperty metaColor_;
 
+    OptionProperty<Mode> mode_;
+    FloatProperty lodPixels_;
+
     CameraProperty camera_;
     CameraTrackball trackball_;
     SimpleLightingProperty lighting_;
@@ -85,6 +99,10 @@ protected:
     std::vector<MeshShaderCache::Requirement> shaderRequirements_;
     MeshShaderCache adjacencyShaders_;
     MeshShaderCache shaders_;
+    std::vector<std::pair<ShaderType, std::string>> pullingShaderItems_;
+    MeshShaderCache pullingAdjacencyShaders_;
+    MeshShaderCache pullingShaders_;
+    std::unique_ptr<BufferObjectArray> vao_;
 };
 
 }  // namespace inviwo
@@ -55,6 +55,10 @@ class Volume;
  * post-processing of the output data stored in the outport. Furthermore, it is possible to
  * be notified of inport changes by overwriting VolumeGLProcessor::afterInportChanged().
  *
+ * All slices are rendered in one instanced draw call. When the driver supports writing gl_Layer
+ * from the vertex shader the geometry shader stage is skipped. The fragment shader receives the
+ * same inputs (texCoord_, dataposition_, worldPos_) in both cases.
+ *
  * \see ImageGLProcessor
  */
 class IVW_MODULE_BASEGL_API VolumeGLProcessor : public Processor {
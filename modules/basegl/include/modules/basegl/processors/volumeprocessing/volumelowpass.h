@@ -36,10 +36,21 @@
 #include <inviwo/core/properties/boolproperty.h>                           // for BoolProperty
 #include <inviwo/core/properties/ordinalproperty.h>                        // for FloatProperty
 #include <modules/basegl/processors/volumeprocessing/volumeglprocessor.h>  // for VolumeGLProcessor
+#include <modules/opengl/buffer/framebufferobject.h>                       // for FrameBufferObject
+
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr
 
 namespace inviwo {
 class TextureUnitContainer;
+class Volume;
 
+/**
+ * \brief Low pass filter of a volume using either constant or Gaussian weights.
+ *
+ * Both kernels are separable and are applied as three 1D passes along x, y, and z, which costs
+ * 3k instead of k^3 samples per voxel for a kernel of size k.
+ */
 class IVW_MODULE_BASEGL_API VolumeLowPass : public VolumeGLProcessor {
 public:
     VolumeLowPass();
@@ -48,18 +59,24 @@ public:
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
 
+    virtual void process() override;
+
 protected:
-    virtual void preProcess(TextureUnitContainer& cont) override;
     virtual void postProcess() override;
 
     virtual void initializeResources() override;
 
 private:
+    void filter(const Volume& source, Volume& destination, FrameBufferObject& fbo, size_t axis);
+
     IntProperty kernelSize_;
 
     BoolCompositeProperty useGaussianWeights_;
     FloatProperty sigma_;
     BoolProperty updateDataRange_;
+
+    std::shared_ptr<Volume> intermediate_;
+    FrameBufferObject intermediateFbo_;
 };
 
 }  // namespace inviwo
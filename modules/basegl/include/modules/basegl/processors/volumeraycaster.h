@@ -31,18 +31,22 @@
 
 #include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
 
-#include <inviwo/core/ports/imageport.h>                     // for ImageInport, ImageOutport
-#include <inviwo/core/ports/volumeport.h>                    // for VolumeInport
-#include <inviwo/core/processors/poolprocessor.h>            // for PoolProcessor
-#include <inviwo/core/processors/processorinfo.h>            // for ProcessorInfo
-#include <inviwo/core/properties/cameraproperty.h>           // for CameraProperty
-#include <inviwo/core/properties/eventproperty.h>            // for EventProperty
-#include <inviwo/core/properties/isotfproperty.h>            // for IsoTFProperty
-#include <inviwo/core/properties/optionproperty.h>           // for OptionPropertyInt
-#include <inviwo/core/properties/raycastingproperty.h>       // for RaycastingProperty
-#include <inviwo/core/properties/simplelightingproperty.h>   // for SimpleLightingProperty
-#include <inviwo/core/properties/volumeindicatorproperty.h>  // for VolumeIndicatorProperty
-#include <modules/opengl/shader/shader.h>                    // for Shader
+#include <inviwo/core/ports/imageport.h>                              // for ImageInport, ImageOu...
+#include <inviwo/core/ports/volumeport.h>                             // for VolumeInport
+#include <inviwo/core/processors/poolprocessor.h>                     // for PoolProcessor
+#include <inviwo/core/processors/processorinfo.h>                     // for ProcessorInfo
+#include <inviwo/core/properties/boolproperty.h>                      // for BoolProperty
+#include <inviwo/core/properties/cameraproperty.h>                    // for CameraProperty
+#include <inviwo/core/properties/eventproperty.h>                     // for EventProperty
+#include <inviwo/core/properties/isotfproperty.h>                     // for IsoTFProperty
+#include <inviwo/core/properties/optionproperty.h>                    // for OptionPropertyInt
+#include <inviwo/core/properties/raycastingproperty.h>                // for RaycastingProperty
+#include <inviwo/core/properties/simplelightingproperty.h>            // for SimpleLightingProperty
+#include <inviwo/core/properties/volumeindicatorproperty.h>           // for VolumeIndicatorProperty
+#include <modules/basegl/properties/progressiverefinementproperty.h>  // for ProgressiveRefineme...
+#include <modules/basegl/rendering/emptyspaceskippinggl.h>            // for EmptySpaceSkippingGL
+#include <modules/basegl/rendering/gradientvolumegl.h>                // for GradientVolumeGL
+#include <modules/opengl/shader/shader.h>                             // for Shader
 
 namespace inviwo {
 class Deserializer;
@@ -63,9 +67,11 @@ public:
 
 protected:
     virtual void process() override;
-    void raycast(const Volume& volume);
+    void raycast(const Volume& volume, const ProgressiveRefinementProperty::Frame& frame);
 
     void toggleShading(Event*);
+    bool useEmptySpaceSkipping() const;
+    bool usePrecomputedGradients() const;
 
     Shader shader_;
     VolumeInport volumePort_;
@@ -77,11 +83,17 @@ protected:
     OptionPropertyInt channel_;
     RaycastingProperty raycasting_;
     IsoTFProperty isotfComposite_;
+    BoolProperty emptySpaceSkipping_;
+    BoolProperty precomputedGradients_;
+    ProgressiveRefinementProperty refinement_;
 
     CameraProperty camera_;
     SimpleLightingProperty lighting_;
     VolumeIndicatorProperty positionIndicator_;
     EventProperty toggleShading_;
+
+    EmptySpaceSkippingGL emptySpace_;
+    GradientVolumeGL gradientVolume_;
 };
 
 }  // namespace inviwo
@@ -0,0 +1,133 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
+
+#include <inviwo/core/properties/boolcompositeproperty.h>  // for BoolCompositeProperty
+#include <inviwo/core/properties/invalidationlevel.h>      // for InvalidationLevel
+#include <inviwo/core/properties/ordinalproperty.h>        // for FloatProperty, IntSizeTProperty
+#include <inviwo/core/util/dispatcher.h>                   // for DispatcherHandle
+#include <inviwo/core/util/glmvec.h>                       // for size2_t
+#include <modules/opengl/openglutils.h>                    // for BlendModeState, GlBoolState
+
+#include <cstddef>      // for size_t
+#include <optional>     // for optional
+#include <string_view>  // for string_view
+
+namespace inviwo {
+class ImageOutport;
+class Processor;
+class Shader;
+
+/**
+ * \ingroup properties
+ * Progressive refinement for raycasters. While the user is interacting, see InteractionState,
+ * frames are rendered with a reduced sampling rate. Once the interaction is over the full sampling
+ * rate is used and a number of refinement frames, each with a different offset of the first sample
+ * along the ray, are averaged into the output image. This removes the wood grain artifacts of a
+ * low sampling rate without the cost of a higher one.
+ *
+ * Usage in a processor:
+ * @code
+ * const auto frame = refinement_.beginFrame(*this, outport_);
+ * {
+ *     ProgressiveRefinementProperty::Target target{outport_, frame};
+ *     shader_.activate();
+ *     refinement_.setUniforms(shader_, frame);
+ *     ...
+ *     shader_.deactivate();
+ * }
+ * refinement_.endFrame(*this, frame);
+ * @endcode
+ * The shader is expected to have the uniforms `float samplingRateScale`, which scales the
+ * sampling rate, and `float rayOffset`, the position of the first sample in units of the step.
+ */
+class IVW_MODULE_BASEGL_API ProgressiveRefinementProperty : public BoolCompositeProperty {
+public:
+    virtual std::string_view getClassIdentifier() const override;
+    static constexpr std::string_view classIdentifier{"org.inviwo.ProgressiveRefinementProperty"};
+
+    struct Frame {
+        size_t index;             //!< 0 for the first frame after a change
+        bool interactive;         //!< true if rendered during interaction
+        float samplingRateScale;  //!< factor to apply to the sampling rate
+        float rayOffset;          //!< offset of the first sample in units of the ray step
+    };
+
+    /**
+     * Activates the outport as render target for a frame. The first frame clears the target,
+     * later frames are blended into the previous result with a weight of 1 / (index + 1) such
+     * that the output becomes the average of all frames. The blend and depth test state are
+     * restored and the target deactivated on destruction.
+     */
+    class IVW_MODULE_BASEGL_API Target {
+    public:
+        Target(ImageOutport& outport, const Frame& frame);
+        Target(const Target&) = delete;
+        Target& operator=(const Target&) = delete;
+        ~Target();
+
+    private:
+        std::optional<utilgl::BlendModeState> blend_;
+        std::optional<utilgl::GlBoolState> depthTest_;
+    };
+
+    ProgressiveRefinementProperty(
+        std::string_view identifier, std::string_view displayName, bool checked = false,
+        InvalidationLevel invalidationLevel = InvalidationLevel::InvalidOutput);
+    ProgressiveRefinementProperty(const ProgressiveRefinementProperty& rhs);
+    virtual ProgressiveRefinementProperty* clone() const override;
+    virtual ~ProgressiveRefinementProperty();
+
+    /**
+     * Determine the frame to render for @p processor. Any changed inport, modified property,
+     * resized outport or the end of an interaction restarts the refinement.
+     */
+    Frame beginFrame(const Processor& processor, const ImageOutport& outport);
+    /**
+     * Schedule the next refinement frame of @p processor, if any.
+     */
+    void endFrame(Processor& processor, const Frame& frame);
+
+    void setUniforms(Shader& shader, const Frame& frame) const;
+
+    FloatProperty interactionSamplingRate_;
+    IntSizeTProperty refinementFrames_;
+
+private:
+    void onInteraction(bool interacting);
+
+    size_t nextFrame_;
+    bool interactive_;
+    size2_t dimensions_;
+    DispatcherHandle<void(bool)> interactionHandle_;
+};
+
+}  // namespace inviwo
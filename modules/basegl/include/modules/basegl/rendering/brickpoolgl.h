@@ -0,0 +1,123 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
+
+#include <inviwo/core/util/glmvec.h>             // for size3_t
+#include <modules/opengl/buffer/bufferobject.h>  // for BufferObject
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t, uint64_t
+#include <memory>       // for shared_ptr
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace inviwo {
+
+class Shader;
+class Texture3D;
+class TextureUnitContainer;
+class VolumeBricked;
+
+/**
+ * \brief A GPU cache for the bricks of a VolumeBricked.
+ *
+ * Resident bricks are stored in the slots of a 3D texture atlas, and a page table maps each brick
+ * of the volume to its slot. While rendering, shaders using "raycasting/bricked.glsl" mark every
+ * brick they want to sample in a feedback buffer and fall back to coarser levels for bricks that
+ * are not resident. update() reads back that feedback, uploads the missing bricks, coarsest
+ * first, and evicts the least recently used bricks when the pool is full. Bricks used in the last
+ * frame are never evicted, so if the pool is too small the rendering will settle at a coarser
+ * level instead of thrashing. The single brick of the coarsest level is always resident.
+ *
+ * Only one bricked volume can be bound to a shader at a time since the page table and feedback
+ * buffers use fixed binding points.
+ */
+class IVW_MODULE_BASEGL_API BrickPoolGL {
+public:
+    static constexpr size_t defaultCapacity = size_t{512} * 1024 * 1024;
+
+    BrickPoolGL();
+    BrickPoolGL(const BrickPoolGL&) = delete;
+    BrickPoolGL& operator=(const BrickPoolGL&) = delete;
+    ~BrickPoolGL();
+
+    /**
+     * Set the volume to cache using at most @p capacityInBytes of GPU memory for the atlas. The
+     * pool is reset if the volume or the capacity changed.
+     */
+    void setVolume(std::shared_ptr<const VolumeBricked> volume, size_t capacityInBytes);
+    const VolumeBricked* getVolume() const;
+
+    /**
+     * Read back the feedback of the last rendering and upload at most @p maxUploads of the
+     * requested bricks that are missing.
+     * @return true if there are requested bricks that are still missing.
+     */
+    bool update(size_t maxUploads);
+
+    /**
+     * Bind the atlas to a texture unit and set the uniforms and buffers used by
+     * "raycasting/bricked.glsl". The atlas sampler will be named @p name.
+     */
+    void bind(Shader& shader, TextureUnitContainer& cont, std::string_view name) const;
+
+    size_t getSlots() const;
+    size_t getResidentBricks() const;
+
+    static constexpr GLuint pageTableBinding = 0;
+    static constexpr GLuint feedbackBinding = 1;
+    static constexpr size_t maxLevels = 16;
+
+private:
+    struct Slot {
+        std::uint32_t brick;
+        std::uint64_t lastUsed;
+    };
+    static constexpr std::uint32_t noBrick = ~std::uint32_t{0};
+
+    void upload(size_t brick, size_t slot);
+
+    std::shared_ptr<const VolumeBricked> volume_;
+    size_t capacity_;
+    size3_t slotDims_;
+    std::unique_ptr<Texture3D> atlas_;
+
+    std::vector<std::uint32_t> pageTable_;  // brick -> slot + 1, 0 if not resident
+    std::vector<std::uint32_t> feedback_;   // one bit per brick
+    std::vector<Slot> slots_;
+    std::uint64_t frame_;
+
+    BufferObject pageTableBuffer_;
+    BufferObject feedbackBuffer_;
+};
+
+}  // namespace inviwo
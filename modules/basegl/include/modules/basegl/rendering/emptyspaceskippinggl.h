@@ -0,0 +1,144 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
+
+#include <inviwo/core/util/glmvec.h>       // for size3_t, vec3
+#include <modules/opengl/shader/shader.h>  // for Shader
+
+#include <cstddef>      // for size_t
+#include <memory>       // for unique_ptr
+#include <span>         // for span
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace inviwo {
+
+class IsoTFProperty;
+class Texture3D;
+class TextureUnitContainer;
+class TransferFunctionProperty;
+class Volume;
+
+/**
+ * \brief Macro cell grids for empty space skipping in volume raycasting.
+ *
+ * The volume is divided into macro cells of cellSize^3 voxels. A min/max grid holding the range
+ * of the normalized values of all channels in each cell, including the neighboring voxels used for
+ * interpolation, is computed on the GPU whenever the volume changes. From it an occupancy grid is
+ * derived, also on the GPU, whenever the transfer functions or the isovalues change. A cell is
+ * occupied if any value in its range has a non-zero opacity or if the range contains an isovalue.
+ * Raycasters using "utils/emptyspaceskipping.glsl" can then jump over the samples in cells that
+ * are not occupied without changing the result.
+ *
+ * For multichannel rendering the occupancy grid can hold one transfer function for each of up to
+ * four channels, stored in the corresponding component of the occupancy texel. This makes it
+ * possible to also skip the classification of channels that are empty in a cell.
+ *
+ * Requires compute shader support, see isSupportedByGPU().
+ */
+class IVW_MODULE_BASEGL_API EmptySpaceSkippingGL {
+public:
+    static constexpr size_t defaultCellSize = 8;
+
+    explicit EmptySpaceSkippingGL(size_t cellSize = defaultCellSize);
+    EmptySpaceSkippingGL(const EmptySpaceSkippingGL&) = delete;
+    EmptySpaceSkippingGL& operator=(const EmptySpaceSkippingGL&) = delete;
+    ~EmptySpaceSkippingGL();
+
+    static bool isSupportedByGPU();
+
+    /**
+     * Force a recomputation of the min/max grid in the next update, i.e. when the volume data
+     * has changed. Changing the volume or the channel is detected automatically.
+     */
+    void invalidateGrid();
+    /**
+     * Force a recomputation of the occupancy in the next update, i.e. when the transfer
+     * function or isovalues have changed.
+     */
+    void invalidateOccupancy();
+
+    /**
+     * Recompute the min/max grid of @p volume and the occupancy of @p channel if needed.
+     * @param volume            the rendered volume, needs a GL representation
+     * @param channel           the rendered channel
+     * @param isotf             the transfer function and isovalues used for rendering
+     * @param transferFunction  consider the opacity of the transfer function
+     * @param isovalues         consider the isovalues
+     */
+    void update(const Volume& volume, size_t channel, IsoTFProperty& isotf, bool transferFunction,
+                bool isovalues);
+
+    /**
+     * Recompute the min/max grid of @p volume and the occupancy if needed. Component i of the
+     * occupancy grid holds the occupancy of channel i using the transfer function @p tfs[i].
+     * @param volume  the rendered volume, needs a GL representation
+     * @param tfs     the transfer function of each rendered channel, at most four
+     */
+    void update(const Volume& volume, std::span<TransferFunctionProperty> tfs);
+
+    /**
+     * Bind the occupancy grid to a texture unit as the sampler @p name and set the corresponding
+     * `<name>Parameters` OccupancyParameters uniform used by "utils/emptyspaceskipping.glsl".
+     */
+    void bind(Shader& shader, TextureUnitContainer& cont, std::string_view name) const;
+
+    size_t getCellSize() const;
+    size3_t getGridDimensions() const;
+
+private:
+    void updateGrid(const Volume& volume);
+    void computeGrid(const Volume& volume);
+    void computeOccupancy(std::span<TransferFunctionProperty* const> tfs,
+                          const std::vector<float>& isovalues);
+
+    size_t cellSize_;
+    Shader minMaxShader_;
+    Shader occupancyShader_;
+
+    std::unique_ptr<Texture3D> min_;
+    std::unique_ptr<Texture3D> max_;
+    std::unique_ptr<Texture3D> occupancy_;
+    vec3 scale_;
+
+    size_t maxIsovalues_;
+    size_t shaderChannels_;
+
+    const Volume* volume_;
+    std::vector<int> channels_;
+    bool transferFunction_;
+    bool isovalues_;
+    bool gridValid_;
+    bool occupancyValid_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,125 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
+
+#include <inviwo/core/util/glmmat.h>       // for mat4
+#include <modules/opengl/shader/shader.h>  // for Shader
+
+#include <cstddef>  // for size_t
+#include <memory>   // for unique_ptr
+#include <vector>   // for vector
+
+namespace inviwo {
+
+class BufferObject;
+class LayerGL;
+class Mesh;
+class Texture2D;
+
+/**
+ * \brief GPU frustum and occlusion culling of spherical glyphs.
+ *
+ * Each vertex of a mesh is treated as a sphere, using the PositionAttrib buffer and either the
+ * RadiiAttrib buffer or a fixed radius. Culling is done in a compute shader which writes
+ * compacted index buffers and indirect draw commands, so the number of visible glyphs never has
+ * to be read back to the CPU.
+ *
+ * Occlusion culling uses a two pass scheme to stay conservative also when the camera moves:
+ *   1. Draw the glyphs that were visible in the previous frame, draw(id, mesh, List::Visible).
+ *   2. Build a hierarchical depth buffer from the resulting depth, updateDepth(depth).
+ *   3. Test all glyphs against the view frustum and the depth buffer, cull(id, mesh, ...).
+ *   4. Draw the glyphs that are visible now but were not drawn in the first pass,
+ *      draw(id, mesh, List::Revealed).
+ *
+ * The state of each mesh, identified by @p id, is kept between frames. Requires compute shader
+ * support, see isSupportedByGPU().
+ */
+class IVW_MODULE_BASEGL_API GlyphCullingGL {
+public:
+    enum class List {
+        Visible,  //!< glyphs that were visible in the previous cull()
+        Revealed  //!< glyphs that became visible in the last cull()
+    };
+
+    GlyphCullingGL();
+    GlyphCullingGL(const GlyphCullingGL&) = delete;
+    GlyphCullingGL& operator=(const GlyphCullingGL&) = delete;
+    ~GlyphCullingGL();
+
+    static bool isSupportedByGPU();
+    /**
+     * Check if the glyphs of @p mesh can be culled, it needs a PositionAttrib buffer of 32-bit
+     * floats with two to four components and a 32-bit float RadiiAttrib buffer, if any.
+     */
+    static bool isCullable(const Mesh& mesh);
+
+    /**
+     * Draw @p list of the glyphs of mesh @p id as points with the currently active shader.
+     */
+    void draw(size_t id, const Mesh& mesh, List list) const;
+
+    /**
+     * Build the hierarchical depth buffer used for occlusion culling from @p depth. Needs to be
+     * called every frame before cull(), until the first call only frustum culling is done.
+     */
+    void updateDepth(const LayerGL& depth);
+
+    /**
+     * Cull the glyphs of mesh @p id against the view frustum and the depth buffer.
+     * @param id           identifies the mesh between frames
+     * @param mesh         a mesh for which isCullable() is true
+     * @param worldToClip  the view projection matrix of the camera
+     * @param radius       the radius used for all glyphs unless @p useRadii is true
+     * @param useRadii     use the radii of the RadiiAttrib buffer
+     */
+    void cull(size_t id, const Mesh& mesh, const mat4& worldToClip, float radius, bool useRadii);
+
+private:
+    struct State {
+        const Mesh* mesh = nullptr;
+        size_t glyphs = 0;
+        std::unique_ptr<BufferObject> visibility;
+        std::unique_ptr<BufferObject> visible;
+        std::unique_ptr<BufferObject> revealed;
+        std::unique_ptr<BufferObject> commands;
+    };
+    State& getState(size_t id, const Mesh& mesh);
+
+    Shader pyramidShader_;
+    Shader cullShader_;
+    std::unique_ptr<Texture2D> pyramid_;
+    int levels_;
+    bool hasDepth_;
+    std::vector<State> states_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,102 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
+
+#include <modules/opengl/buffer/framebufferobject.h>  // for FrameBufferObject
+#include <modules/opengl/shader/shader.h>             // for Shader
+
+#include <cstddef>      // for size_t
+#include <memory>       // for unique_ptr
+#include <string_view>  // for string_view
+
+namespace inviwo {
+
+class Texture3D;
+class TextureUnitContainer;
+class Volume;
+
+/**
+ * \brief A precomputed gradient volume for volume raycasting.
+ *
+ * The gradient of one channel is computed on the GPU using central differences with the shader of
+ * the VolumeGradientProcessor, and stored in a packed RGB10A2 texture of the same size as the
+ * volume. Only the direction of the gradient is kept, which is all that is needed for shading, at
+ * 4 bytes per voxel. Raycasters can then get the gradient with a single texture fetch instead of
+ * six. The gradient is only recomputed when the volume or the channel changes.
+ *
+ * Call addShaderDefines after the regular gradient defines, to make COMPUTE_GRADIENT and
+ * COMPUTE_GRADIENT_FOR_CHANNEL of "utils/gradients.glsl" sample the gradient volume.
+ */
+class IVW_MODULE_BASEGL_API GradientVolumeGL {
+public:
+    GradientVolumeGL();
+    GradientVolumeGL(const GradientVolumeGL&) = delete;
+    GradientVolumeGL& operator=(const GradientVolumeGL&) = delete;
+    ~GradientVolumeGL();
+
+    /**
+     * Force a recomputation of the gradients in the next update, i.e. when the volume data has
+     * changed. Changing the volume or the channel is detected automatically.
+     */
+    void invalidate();
+
+    /**
+     * Recompute the gradients of @p channel of @p volume if needed.
+     * @param volume   the rendered volume, needs a GL representation
+     * @param channel  the channel to compute the gradient of
+     */
+    void update(const Volume& volume, size_t channel);
+
+    /**
+     * Bind the gradient volume to a texture unit as the sampler "gradientVolume".
+     */
+    void bind(Shader& shader, TextureUnitContainer& cont) const;
+
+    /**
+     * Replace the gradient computation of @p shader by lookups in the gradient volume if
+     * @p enable is true, otherwise leave the defines as they are.
+     */
+    static void addShaderDefines(Shader& shader, bool enable);
+
+private:
+    void compute(const Volume& volume);
+
+    Shader shader_;
+    FrameBufferObject fbo_;
+    std::unique_ptr<Texture3D> gradients_;
+
+    const Volume* volume_;
+    size_t channel_;
+    bool valid_;
+};
+
+}  // namespace inviwo
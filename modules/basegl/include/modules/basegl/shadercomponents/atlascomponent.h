@@ -31,7 +31,7 @@
 #include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
 
 #include "inviwo/core/util/colorbrewer-generated.h"                    // for Family, operator<<
-#include <inviwo/core/datastructures/image/layer.h>                    // for Layer
+#include <inviwo/core/datastructures/bitset.h>                         // for BitSet
 #include <inviwo/core/interaction/pickingmapper.h>                     // for PickingMapper
 #include <inviwo/core/ports/volumeport.h>                              // for VolumeInport
 #include <inviwo/core/properties/buttongroupproperty.h>                // for ButtonGroupProperty
@@ -41,8 +41,10 @@
 #include <inviwo/core/util/staticstring.h>                             // for operator+
 #include <modules/basegl/shadercomponents/shadercomponent.h>           // for ShaderComponent
 #include <modules/brushingandlinking/ports/brushingandlinkingports.h>  // for BrushingAndLinking...
+#include <modules/opengl/buffer/bufferobject.h>                        // for BufferObject
 
 #include <functional>   // for __base
+#include <memory>       // for unique_ptr
 #include <string>       // for operator==, string
 #include <string_view>  // for operator==, string...
 #include <tuple>        // for tuple
@@ -61,6 +63,8 @@ class TimeComponent;
 /**
  * Adds a atlas Volume inport, a BrushingAndLinking inport, and related functionality to do
  * segmented or "atlas" volume raycasting.
+ * The colors of the segments are kept in a shader storage buffer, `{atlas}Colors`, with two colors
+ * per segment. Changes in selection, highlight, and filtering only update the affected segments.
  */
 class IVW_MODULE_BASEGL_API AtlasComponent : public ShaderComponent {
 public:
@@ -82,6 +86,9 @@ private:
     enum class ColoringGroup { All, Selected, Unselected, Filtered, Unfiltered, Zero };
     enum class ColoringAction { None, SetColor, SetAlpha, SetScheme };
 
+    void updateColors(uint32_t segment, uint32_t nSegments);
+    void uploadColors(const BitSet& modified);
+
     VolumeInport atlas_;
     BrushingAndLinkingInport brushing_;
 
@@ -102,7 +109,13 @@ private:
     ButtonGroupProperty coloringApply_;
     ColoringAction coloringAction_;
 
-    Layer colors_;
+    // Two colors per segment, mirrored by colorsBuffer_
+    std::vector<vec4> colors_;
+    std::unique_ptr<BufferObject> colorsBuffer_;
+    // The brushing state the colors were last computed for
+    BitSet selected_;
+    BitSet highlighted_;
+    BitSet filtered_;
     std::string color_;
     PickingMapper picking_;
     int minSegmentId_;
@@ -0,0 +1,89 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
+
+#include <inviwo/core/ports/volumeport.h>                     // for VolumeInport
+#include <inviwo/core/properties/compositeproperty.h>         // for CompositeProperty
+#include <inviwo/core/properties/ordinalproperty.h>           // for IntProperty, IntSizeTProperty
+#include <modules/basegl/rendering/brickpoolgl.h>             // for BrickPoolGL
+#include <modules/basegl/shadercomponents/shadercomponent.h>  // for ShaderComponent
+
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <tuple>        // for tuple
+#include <vector>       // for vector
+
+namespace inviwo {
+class Inport;
+class Property;
+class Shader;
+class TextureUnitContainer;
+
+/**
+ * Adds a Volume inport and samples it from a BrickPoolGL holding the bricks of its VolumeBricked
+ * representation, instead of from a single 3D texture. This makes it possible to render volumes
+ * larger than the available GPU memory, see BrickPoolGL and "raycasting/bricked.glsl".
+ * Like the VolumeComponent it samples the volume into `<name>Voxel` and `<name>VoxelPrev`, computes
+ * the gradient of `channel` into `<name>Gradient` and `<name>GradientPrev`, and sets the
+ * `<name>Parameters` uniforms.
+ *
+ * The bricks requested while rendering are uploaded in update(), which has to be called after
+ * each rendering.
+ */
+class IVW_MODULE_BASEGL_API BrickedVolumeComponent : public ShaderComponent {
+public:
+    BrickedVolumeComponent(std::string_view name, Document help = {});
+
+    virtual std::string_view getName() const override;
+    virtual void process(Shader& shader, TextureUnitContainer& cont) override;
+    virtual std::vector<std::tuple<Inport*, std::string>> getInports() override;
+    virtual std::vector<Property*> getProperties() override;
+    virtual std::vector<Segment> getSegments() override;
+
+    /**
+     * Upload the bricks that were requested in the last rendering.
+     * @return true if any bricks were uploaded, i.e. the rendering should be updated.
+     */
+    bool update();
+
+    VolumeInport volumePort;
+
+    CompositeProperty bricking;
+    IntProperty finestLevel;
+    IntSizeTProperty poolSize;
+    IntSizeTProperty uploadsPerFrame;
+
+private:
+    BrickPoolGL pool_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,78 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
+
+#include <inviwo/core/ports/volumeport.h>                     // for VolumeInport
+#include <inviwo/core/properties/boolproperty.h>              // for BoolProperty
+#include <modules/basegl/rendering/emptyspaceskippinggl.h>    // for EmptySpaceSkippingGL
+#include <modules/basegl/shadercomponents/shadercomponent.h>  // for ShaderComponent
+
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace inviwo {
+class IsoTFProperty;
+class Property;
+class RaycastingComponent;
+class Shader;
+class TextureUnitContainer;
+
+/**
+ * Skips the samples in macro cells of the volume that are fully transparent under the transfer
+ * function and isovalues, see EmptySpaceSkippingGL. The occupancy grid is bound to the
+ * `occupancy` sampler with `occupancyParameters`. When a sample is found in an empty cell
+ * `rayPosition` and `samplePosition` are moved to the last sample inside that cell, before the
+ * volume is sampled. This keeps the previous voxel values, used for the isosurfaces, exact.
+ * Skipping is disabled when `PLANES_ENABLED` is defined since the planes are drawn at the samples.
+ */
+class IVW_MODULE_BASEGL_API EmptySpaceSkippingComponent : public ShaderComponent {
+public:
+    EmptySpaceSkippingComponent(VolumeInport& volume, RaycastingComponent& raycasting,
+                                IsoTFProperty& isotf);
+
+    virtual std::string_view getName() const override;
+    virtual void process(Shader& shader, TextureUnitContainer& cont) override;
+    virtual std::vector<Property*> getProperties() override;
+    virtual std::vector<Segment> getSegments() override;
+
+    BoolProperty emptySpaceSkipping;
+
+private:
+    bool enabled() const;
+
+    VolumeInport& volume_;
+    RaycastingComponent& raycasting_;
+    IsoTFProperty& isotf_;
+    EmptySpaceSkippingGL grid_;
+};
+
+}  // namespace inviwo
@@ -40,6 +40,7 @@
 
 namespace inviwo {
 class Inport;
+class Processor;
 class Shader;
 class TextureUnitContainer;
 
@@ -50,10 +51,16 @@ class TextureUnitContainer;
  * setup and the `rayLength` and `rayDirection` calculated.
  * If the entry port has an extra color layer with surface normals, the `surfaceNormal` will be set
  * and `useSurfaceNormals` will be true.
+ *
+ * When constructed with a processor the ports are optional. If they are not connected the entry and
+ * exit points are instead computed in the shader by intersecting the view ray with the texture
+ * space unit cube of the volume, using the `camera` and `volumeParameters` uniforms. Equivalent to
+ * using the entry and exit points of a cube proxy geometry with the near plane capped.
  */
 class IVW_MODULE_BASEGL_API EntryExitComponent : public ShaderComponent {
 public:
     EntryExitComponent();
+    explicit EntryExitComponent(Processor& processor);
 
     virtual std::string_view getName() const override;
 
@@ -63,6 +70,11 @@ public:
 
     virtual std::vector<Segment> getSegments() override;
 
+    /**
+     * True if the entry and exit points are computed in the shader
+     */
+    bool usesAnalyticEntryExit() const;
+
 private:
     ImageInport entryPort_;
     ImageInport exitPort_;
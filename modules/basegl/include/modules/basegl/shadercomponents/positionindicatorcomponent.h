@@ -43,7 +43,8 @@ class TextureUnitContainer;
 
 /**
  * Adds a VolumeIndicatorProperty property and bind it to the `positionindicator`
- * VolumeIndicatorParameters uniform. When enabled it composites the planes into the `result`.
+ * VolumeIndicatorParameters uniform. When enabled it composites the planes into the `result`
+ * and defines `PLANES_ENABLED`.
  */
 class IVW_MODULE_BASEGL_API PositionIndicatorComponent : public ShaderComponent {
 public:
@@ -53,6 +54,8 @@ public:
 
     virtual void process(Shader& shader, TextureUnitContainer&) override;
 
+    virtual void initializeResources(Shader& shader) override;
+
     virtual std::vector<Property*> getProperties() override;
 
     virtual std::vector<Segment> getSegments() override;
@@ -0,0 +1,75 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
+
+#include <modules/basegl/properties/progressiverefinementproperty.h>  // for ProgressiveRefineme...
+#include <modules/basegl/shadercomponents/shadercomponent.h>          // for ShaderComponent
+
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace inviwo {
+class ImageOutport;
+class Processor;
+class Property;
+class Shader;
+class TextureUnitContainer;
+
+/**
+ * Adds progressive refinement to a raycaster based on the raycaster template, i.e. a reduced
+ * sampling rate during interaction and jittered refinement frames afterwards.
+ * The processor has to call beginFrame before rendering, render into a
+ * ProgressiveRefinementProperty::Target, and call endFrame afterwards.
+ * @see ProgressiveRefinementProperty
+ */
+class IVW_MODULE_BASEGL_API ProgressiveRefinementComponent : public ShaderComponent {
+public:
+    ProgressiveRefinementComponent();
+    virtual ~ProgressiveRefinementComponent() = default;
+
+    virtual std::string_view getName() const override;
+
+    virtual void process(Shader& shader, TextureUnitContainer& cont) override;
+
+    virtual std::vector<Property*> getProperties() override;
+
+    const ProgressiveRefinementProperty::Frame& beginFrame(const Processor& processor,
+                                                           const ImageOutport& outport);
+    void endFrame(Processor& processor);
+
+    ProgressiveRefinementProperty refinement;
+
+private:
+    ProgressiveRefinementProperty::Frame frame_;
+};
+
+}  // namespace inviwo
@@ -30,6 +30,7 @@
 
 #include <modules/basegl/baseglmoduledefine.h>  // for IVW_MODULE_BASEGL_API
 
+#include <inviwo/core/properties/boolproperty.h>              // for BoolProperty
 #include <inviwo/core/properties/optionproperty.h>            // for OptionPropertyInt
 #include <inviwo/core/properties/raycastingproperty.h>        // for RaycastingProperty
 #include <modules/basegl/shadercomponents/shadercomponent.h>  // for ShaderComponent
@@ -50,7 +51,9 @@ class TextureUnitContainer;
 
 /**
  * The voxel data from `<volume>Voxel[channel]` will be classified using the transferfunction and
- * isovalues from the IsoTFProperty, and composited into `result`.
+ * isovalues from the IsoTFProperty, and composited into `result`. With pre-integration enabled the
+ * segment between `<volume>VoxelPrev[channel]` and `<volume>Voxel[channel]` is classified using
+ * the pre-integrated lookup table of the transfer function instead.
  */
 class IVW_MODULE_BASEGL_API RaycastingComponent : public ShaderComponent {
 public:
@@ -68,11 +71,17 @@ public:
 
     bool setUsedChannels(size_t channels);
 
+    size_t getChannel() const;
+    const RaycastingProperty& getRaycastingProperty() const;
+
 private:
+    bool usePreIntegration() const;
+
     std::string volume_;
     IsoTFProperty& isotf_;
 
     OptionPropertyInt channel_;
+    BoolProperty preIntegration_;
     RaycastingProperty raycasting_;
 };
 
@@ -0,0 +1,91 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/basegl/baseglmoduledefine.h>
+
+#include <inviwo/core/properties/boolcompositeproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/util/dispatcher.h>
+#include <inviwo/core/util/glmmat.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace inviwo {
+
+class BufferObject;
+class Mesh;
+class PointLOD;
+
+/**
+ * \brief Level of detail rendering of point meshes during interaction.
+ *
+ * A PointLOD octree is built in the background for each mesh with more than
+ * PointLOD::defaultNodeCapacity points. While the user is interacting, see InteractionState,
+ * draw() renders only the octree nodes needed for the requested screen space error. When the
+ * interaction is over the owning processor is invalidated to render the full mesh again.
+ */
+class IVW_MODULE_BASEGL_API PointLODGL {
+public:
+    PointLODGL();
+    PointLODGL(const PointLODGL&) = delete;
+    PointLODGL& operator=(const PointLODGL&) = delete;
+    ~PointLODGL();
+
+    /**
+     * True if level of detail rendering is enabled and the user is interacting.
+     */
+    bool isActive() const;
+
+    /**
+     * Draw the vertices of mesh @p id as points with the currently active shader using the octree
+     * of @p mesh, if isActive(). Starts building the octree in the background if needed, also when
+     * not interacting, such that it is available once the interaction starts.
+     * @return false if nothing was drawn, the mesh has to be drawn as usual then.
+     */
+    bool draw(size_t id, const std::shared_ptr<const Mesh>& mesh, const mat4& worldToClip,
+              size2_t viewport);
+
+    BoolCompositeProperty lod;
+    FloatProperty maxError;
+
+private:
+    struct Entry;
+    void onInteraction(bool interacting);
+
+    std::shared_ptr<std::vector<Entry>> entries_;
+    bool used_;
+    DispatcherHandle<void(bool)> interactionHandle_;
+};
+
+}  // namespace inviwo
@@ -58,7 +58,8 @@
 #include <string_view>  // for string_view
 #include <type_traits>  // for remove_extent_t
 #include <utility>      // for pair
-#include <vector>       // for vector
+#include <mutex>        // for scoped_lock
+#include <vector>       // for vector, erase_if
 
 #include <glm/geometric.hpp>                    // for cross, dot, normalize
 #include <glm/gtx/handed_coordinate_space.hpp>  // for rightHanded
@@ -519,6 +520,34 @@ std::shared_ptr<Shader> EntryExitPointsHelper::createNearClipShader(IncludeNorma
     }
 }
 
+bool EntryExitPointsCache::Key::matches(const Key& other) const {
+    return !mesh.expired() && !mesh.owner_before(other.mesh) && !other.mesh.owner_before(mesh) &&
+           viewMatrix == other.viewMatrix && projectionMatrix == other.projectionMatrix &&
+           dimensions == other.dimensions && capNearClip == other.capNearClip &&
+           includeNormals == other.includeNormals;
+}
+
+auto EntryExitPointsCache::find(const Key& key) -> std::shared_ptr<Entry> {
+    const std::scoped_lock lock{mutex_};
+    for (const auto& item : entries_) {
+        if (auto entry = item.lock(); entry && entry->key.matches(key)) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+void EntryExitPointsCache::add(const std::shared_ptr<Entry>& entry) {
+    const std::scoped_lock lock{mutex_};
+    std::erase_if(entries_, [](const std::weak_ptr<Entry>& item) { return item.expired(); });
+    entries_.push_back(entry);
+}
+
+EntryExitPointsCache& EntryExitPointsCache::shared() {
+    static EntryExitPointsCache cache;
+    return cache;
+}
+
 }  // namespace algorithm
 
 }  // namespace inviwo
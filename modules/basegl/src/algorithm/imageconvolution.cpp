@@ -42,10 +42,14 @@
 #include <modules/opengl/texture/textureunit.h>                         // for TextureUnitContainer
 #include <modules/opengl/texture/textureutils.h>                        // for activateTarget
 
-#include <cmath>          // for exp
+#include <algorithm>      // for max_element
+#include <cmath>          // for exp, abs
+#include <iterator>       // for distance
+#include <optional>       // for optional, nullopt
 #include <string>         // for to_string, string
 #include <type_traits>    // for remove_extent_t
 #include <unordered_set>  // for unordered_set
+#include <utility>        // for pair, move
 
 #include <glm/ext/scalar_constants.hpp>  // for pi
 #include <glm/vec2.hpp>                  // for vec<>::(anonymous)
@@ -104,7 +108,7 @@ std::shared_ptr<Image> ImageConvolution::convolution(const Layer& layer,
     for (int j = 0; j < kernelSize.y; j++) {
         for (int i = 0; i < kernelSize.x; i++) {
             vec2 p = vec2(i, j) - kernelCenter;
-            kernel[i + j * kernelSize.y] = kernelWeight(p);
+            kernel[i + j * kernelSize.x] = kernelWeight(p);
         }
     }
 
@@ -122,17 +126,82 @@ std::shared_ptr<Image> ImageConvolution::convolution_separable(
         kernel[i] = kernelWeight(p);
     }
 
-    auto hori = convolution(layer, kernelSize, 1, kernel, kernelScale);
-    return convolution(*hori->getColorLayer(), 1, kernelSize, kernel, kernelScale);
+    return convolution_separable(layer, kernel, kernel, kernelScale);
 }
 
+std::shared_ptr<Image> ImageConvolution::convolution_separable(
+    const Layer& layer, const std::vector<float>& horizontal, const std::vector<float>& vertical,
+    const float& kernelScale) {
+
+    if (horizontal.size() <= 1 && vertical.size() <= 1) {
+        return convolution(layer, 1, 1, {horizontal.front() * vertical.front()}, kernelScale);
+    } else if (horizontal.size() <= 1) {
+        std::vector<float> kernel = vertical;
+        for (auto& w : kernel) w *= horizontal.front();
+        return convolution1D(layer, ivec2{0, 1}, kernel, kernelScale);
+    } else if (vertical.size() <= 1) {
+        std::vector<float> kernel = horizontal;
+        for (auto& w : kernel) w *= vertical.front();
+        return convolution1D(layer, ivec2{1, 0}, kernel, kernelScale);
+    }
+
+    // The scale is applied once, in the second pass
+    auto hori = convolution1D(layer, ivec2{1, 0}, horizontal, 1.0f);
+    return convolution1D(*hori->getColorLayer(), ivec2{0, 1}, vertical, kernelScale);
+}
+
+namespace {
+
+/**
+ * Try to factor the row-major @p kw x @p kh @p kernel into the outer product of a horizontal
+ * and a vertical vector, i.e. check that it has rank one.
+ */
+std::optional<std::pair<std::vector<float>, std::vector<float>>> factorKernel(
+    int kw, int kh, const std::vector<float>& kernel) {
+    const auto maxIt = std::max_element(kernel.begin(), kernel.end(), [](float a, float b) {
+        return std::abs(a) < std::abs(b);
+    });
+    const float pivot = *maxIt;
+    if (pivot == 0.0f) return std::nullopt;
+
+    const auto pivotIndex = static_cast<int>(std::distance(kernel.begin(), maxIt));
+    const int pi = pivotIndex % kw;
+    const int pj = pivotIndex / kw;
+
+    std::vector<float> horizontal(kw);
+    std::vector<float> vertical(kh);
+    for (int i = 0; i < kw; ++i) horizontal[i] = kernel[i + pj * kw];
+    for (int j = 0; j < kh; ++j) vertical[j] = kernel[pi + j * kw] / pivot;
+
+    const float tolerance = 1e-5f * std::abs(pivot);
+    for (int j = 0; j < kh; ++j) {
+        for (int i = 0; i < kw; ++i) {
+            if (std::abs(kernel[i + j * kw] - horizontal[i] * vertical[j]) > tolerance) {
+                return std::nullopt;
+            }
+        }
+    }
+    return std::pair{std::move(horizontal), std::move(vertical)};
+}
+
+}  // namespace
+
 std::shared_ptr<Image> ImageConvolution::convolution(const Layer& layer, int kw, int kh,
                                                      const std::vector<float>& kernel,
                                                      const float& kernelScale) {
-    shader_.getFragmentShaderObject()->addShaderDefine("KERNELWIDTH", std::to_string(kw));
-    shader_.getFragmentShaderObject()->addShaderDefine("KERNELHEIGHT", std::to_string(kh));
-    shader_.getFragmentShaderObject()->addShaderDefine("KERNELSIZE", std::to_string(kw * kh));
-    shader_.build();
+    if (kw > 1 && kh > 1) {
+        if (auto factors = factorKernel(kw, kh, kernel)) {
+            return convolution_separable(layer, factors->first, factors->second, kernelScale);
+        }
+    }
+
+    if (kernelDims_ != ivec2{kw, kh} || !shader_.isReady()) {
+        shader_.getFragmentShaderObject()->addShaderDefine("KERNELWIDTH", std::to_string(kw));
+        shader_.getFragmentShaderObject()->addShaderDefine("KERNELHEIGHT", std::to_string(kh));
+        shader_.getFragmentShaderObject()->addShaderDefine("KERNELSIZE", std::to_string(kw * kh));
+        shader_.build();
+        kernelDims_ = ivec2{kw, kh};
+    }
 
     auto outImage = std::make_shared<Image>(std::make_shared<Layer>(
         layer.getDimensions(), layer.getDataFormat(),
@@ -158,4 +227,40 @@ std::shared_ptr<Image> ImageConvolution::convolution(const Layer& layer, int kw,
     return outImage;
 }
 
+std::shared_ptr<Image> ImageConvolution::convolution1D(const Layer& layer, ivec2 direction,
+                                                       const std::vector<float>& kernel,
+                                                       const float& kernelScale) {
+    const auto size = static_cast<int>(kernel.size());
+    if (separableKernelSize_ != size || !separableShader_.isReady()) {
+        separableShader_.getFragmentShaderObject()->addShaderDefine("KERNELSIZE",
+                                                                    std::to_string(size));
+        separableShader_.build();
+        separableKernelSize_ = size;
+    }
+
+    auto outImage = std::make_shared<Image>(std::make_shared<Layer>(
+        layer.getDimensions(), layer.getDataFormat(),
+        LayerType::Color,  // always treat as color, even if picking or depth
+        layer.getSwizzleMask()));
+
+    TextureUnitContainer cont;
+
+    utilgl::activateTarget(*outImage);
+    separableShader_.activate();
+
+    utilgl::bindAndSetUniforms(separableShader_, cont,
+                               *layer.getRepresentation<LayerGL>()->getTexture(), "tex");
+
+    separableShader_.setUniform("kernel", kernel);
+    separableShader_.setUniform("kernelScale", kernelScale);
+    separableShader_.setUniform("direction", vec2(direction));
+    separableShader_.setUniform("reciprocalDimensions", vec2(1) / vec2(layer.getDimensions()));
+
+    utilgl::singleDrawImagePlaneRect();
+    separableShader_.deactivate();
+    utilgl::deactivateCurrentTarget();
+
+    return outImage;
+}
+
 }  // namespace inviwo
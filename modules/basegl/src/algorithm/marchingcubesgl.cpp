@@ -0,0 +1,178 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/algorithm/marchingcubesgl.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>          // for Buffer, IndexBuffer
+#include <inviwo/core/datastructures/geometry/geometrytype.h>  // for BufferType, DrawType
+#include <inviwo/core/datastructures/geometry/mesh.h>          // for Mesh
+#include <inviwo/core/datastructures/volume/volume.h>          // for Volume
+#include <inviwo/core/util/formats.h>                          // for DataFormat, DataFormatId
+#include <modules/base/algorithm/volume/marchingcubesopt.h>    // for Config
+#include <modules/opengl/buffer/buffergl.h>                    // for BufferGL
+#include <modules/opengl/glformats.h>                          // for GLFormats
+#include <modules/opengl/inviwoopengl.h>                       // for glDispatchCompute, glMemory...
+#include <modules/opengl/openglcapabilities.h>                 // for OpenGLCapabilities
+#include <modules/opengl/openglutils.h>                        // for Activate
+#include <modules/opengl/texture/textureunit.h>                // for TextureUnitContainer
+#include <modules/opengl/volume/volumeutils.h>                 // for bindAndSetUniforms
+
+#include <array>    // for array
+#include <cstdint>  // for uint32_t
+#include <utility>  // for pair
+#include <vector>   // for vector
+
+#include <glm/vector_relational.hpp>  // for all, greaterThan
+
+namespace inviwo {
+
+namespace {
+
+// Has to match local_size_x, _y, and _z of the compute shader
+constexpr uvec3 groupSize{4, 4, 4};
+
+// The triangles of case i are caseTriangles[caseOffsets[i]] to caseTriangles[caseOffsets[i + 1]],
+// the three edges of each triangle are packed into 4 bits each.
+std::pair<std::vector<std::uint32_t>, std::vector<std::uint32_t>> createCaseTables() {
+    const marching::Config config{};
+    std::vector<std::uint32_t> offsets{0};
+    std::vector<std::uint32_t> triangles;
+    for (const auto& tris : config.caseTriangles) {
+        for (const auto& tri : tris) {
+            triangles.push_back(static_cast<std::uint32_t>(tri[0] | tri[1] << 4 | tri[2] << 8));
+        }
+        offsets.push_back(static_cast<std::uint32_t>(triangles.size()));
+    }
+    return {std::move(offsets), std::move(triangles)};
+}
+
+BufferObject createStorage(size_t sizeInBytes) {
+    return BufferObject{sizeInBytes, GLFormats::get(DataFormatId::UInt32), GL_DYNAMIC_DRAW,
+                        GL_SHADER_STORAGE_BUFFER};
+}
+
+template <typename T, BufferTarget Target = BufferTarget::Data>
+std::pair<std::shared_ptr<Buffer<T, Target>>, GLuint> createBuffer(size_t size) {
+    auto buffer = std::make_shared<Buffer<T, Target>>(BufferUsage::Static);
+    auto bufferGL =
+        std::make_shared<BufferGL>(size, DataFormat<T>::get(), BufferUsage::Static, Target);
+    const auto id = bufferGL->getId();
+    buffer->addRepresentation(bufferGL);
+    return {buffer, id};
+}
+
+}  // namespace
+
+MarchingCubesGL::MarchingCubesGL()
+    : countShader_{{{ShaderType::Compute, "compute/marchingcubes.comp"}}, Shader::Build::No}
+    , extractShader_{{{ShaderType::Compute, "compute/marchingcubes.comp"}}, Shader::Build::No}
+    , caseOffsets_{createStorage(257 * sizeof(std::uint32_t))}
+    , caseTriangles_{createStorage(0)}
+    , counter_{createStorage(sizeof(std::uint32_t))} {
+
+    extractShader_.getComputeShaderObject()->addShaderDefine("EXTRACT");
+
+    const auto [offsets, triangles] = createCaseTables();
+    caseOffsets_.upload(offsets);
+    caseTriangles_.upload(triangles);
+}
+
+MarchingCubesGL::~MarchingCubesGL() = default;
+
+bool MarchingCubesGL::isSupportedByGPU() { return OpenGLCapabilities::isComputeShadersSupported(); }
+
+std::shared_ptr<Mesh> MarchingCubesGL::extract(const Volume& volume, double iso, const vec4& color,
+                                               bool invert) {
+    const size3_t dims = volume.getDimensions();
+    const uvec3 cells{glm::max(dims, size3_t{1}) - size3_t{1}};
+    const uvec3 numGroups{(cells + groupSize - uvec3{1}) / groupSize};
+
+    // The shader compares values normalized to [0,1] using the data range of the volume
+    const auto& range = volume.dataMap.dataRange;
+    const auto normalizedIso = static_cast<float>((iso - range.x) / (range.y - range.x));
+
+    const auto run = [&](Shader& shader) {
+        if (!shader.isReady()) shader.build();
+        const utilgl::Activate activateShader{&shader};
+
+        TextureUnitContainer units;
+        utilgl::bindAndSetUniforms(shader, units, volume, "volume");
+        shader.setUniform("iso", normalizedIso);
+        shader.setUniform("invert", invert);
+        shader.setUniform("cells", ivec3{cells});
+        shader.setUniform("color", color);
+
+        constexpr std::array<std::uint32_t, 1> zero{0};
+        counter_.upload(zero);
+        caseOffsets_.bindBase(0);
+        caseTriangles_.bindBase(1);
+        counter_.bindBase(2);
+        if (glm::all(glm::greaterThan(cells, uvec3{0}))) {
+            glDispatchCompute(numGroups.x, numGroups.y, numGroups.z);
+        }
+    };
+
+    run(countShader_);
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    std::uint32_t triangles = 0;
+    counter_.download(&triangles);
+
+    const size_t vertices = 3 * static_cast<size_t>(triangles);
+    auto [positions, positionsId] = createBuffer<vec3>(vertices);
+    auto [texCoords, texCoordsId] = createBuffer<vec3>(vertices);
+    auto [colors, colorsId] = createBuffer<vec4>(vertices);
+    auto [normals, normalsId] = createBuffer<vec3>(vertices);
+    auto [indices, indicesId] = createBuffer<std::uint32_t, BufferTarget::Index>(vertices);
+
+    if (triangles > 0) {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, positionsId);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, texCoordsId);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, colorsId);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 6, normalsId);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 7, indicesId);
+        run(extractShader_);
+        glMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT |
+                        GL_BUFFER_UPDATE_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+        for (GLuint binding = 3; binding < 8; ++binding) {
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+        }
+    }
+
+    auto mesh = std::make_shared<Mesh>();
+    mesh->setModelMatrix(volume.getModelMatrix());
+    mesh->setWorldMatrix(volume.getWorldMatrix());
+    mesh->addIndices({DrawType::Triangles, ConnectivityType::None}, indices);
+    mesh->addBuffer(BufferType::PositionAttrib, positions);
+    mesh->addBuffer(BufferType::TexCoordAttrib, texCoords);
+    mesh->addBuffer(BufferType::ColorAttrib, colors);
+    mesh->addBuffer(BufferType::NormalAttrib, normals);
+    return mesh;
+}
+
+}  // namespace inviwo
@@ -66,6 +66,7 @@
 #include <modules/basegl/processors/imageprocessing/imagelowpass.h>                 // for Ima...
 #include <modules/basegl/processors/imageprocessing/imagecolormapping.h>            // for Ima...
 #include <modules/basegl/processors/imageprocessing/imagemixer.h>                   // for Ima...
+#include <modules/basegl/processors/imageprocessing/imagemulticompositeprocessorgl.h>  // for I...
 #include <modules/basegl/processors/imageprocessing/imagenormalizationprocessor.h>  // for Ima...
 #include <modules/basegl/processors/imageprocessing/imageoverlaygl.h>               // for Ima...
 #include <modules/basegl/processors/imageprocessing/imageresample.h>                // for Ima...
@@ -92,14 +93,16 @@
 #include <modules/basegl/processors/multichannelraycaster.h>                   // for Mul...
 #include <modules/basegl/processors/pointrenderer.h>                           // for Poi...
 #include <modules/basegl/processors/raycasting/atlasvolumeraycaster.h>         // for Atl...
+#include <modules/basegl/processors/raycasting/brickedvolumeraycaster.h>       // for Bri...
 #include <modules/basegl/processors/raycasting/multichannelvolumeraycaster.h>  // for Mul...
 #include <modules/basegl/processors/raycasting/sphericalvolumeraycaster.h>     // for Sph...
 #include <modules/basegl/processors/raycasting/standardvolumeraycaster.h>      // for Sta...
 #include <modules/basegl/processors/raycasting/texturedisosurfacerenderer.h>
-#include <modules/basegl/processors/redgreenprocessor.h>  // for Red...
-#include <modules/basegl/processors/sphererenderer.h>     // for Sph...
-#include <modules/basegl/processors/splitimage.h>         // for Spl...
-#include <modules/basegl/processors/tuberendering.h>      // for Tub...
+#include <modules/basegl/processors/redgreenprocessor.h>    // for Red...
+#include <modules/basegl/processors/sphererenderer.h>       // for Sph...
+#include <modules/basegl/processors/splitimage.h>           // for Spl...
+#include <modules/basegl/processors/surfaceextractiongl.h>  // for Sur...
+#include <modules/basegl/processors/tuberendering.h>        // for Tub...
 #include <modules/basegl/processors/volumemasker.h>
 #include <modules/basegl/processors/volumeprocessing/vectormagnitudeprocessor.h>  // for Vec...
 #include <modules/basegl/processors/volumeprocessing/volume2dmapping.h>
@@ -117,6 +120,7 @@
 #include <modules/basegl/processors/volumeraycaster.h>                                // for Vol...
 #include <modules/basegl/processors/volumeslicegl.h>                                  // for Vol...
 #include <modules/basegl/properties/linesettingsproperty.h>                           // for Lin...
+#include <modules/basegl/properties/progressiverefinementproperty.h>                  // for Pro...
 #include <modules/basegl/properties/splitterproperty.h>                               // for Spl...
 #include <modules/basegl/properties/stipplingproperty.h>                              // for Sti...
 // Autogenerated
@@ -135,11 +139,13 @@ BaseGLModule::BaseGLModule(InviwoApplication* app) : InviwoModule(app, "BaseGL")
     basegl::addShaderResources(ShaderManager::getPtr(), {getPath(ModulePath::GLSL)});
 
     registerProperty<LineSettingsProperty>();
+    registerProperty<ProgressiveRefinementProperty>();
     registerProperty<SplitterProperty>();
     registerProperty<StipplingProperty>();
 
     registerProcessor<AtlasVolumeRaycaster>();
     registerProcessor<AxisAlignedCutPlane>();
+    registerProcessor<BrickedVolumeRaycaster>();
     registerProcessor<Background>();
     registerProcessor<CubeRenderer>();
     registerProcessor<DrawLines>();
@@ -165,6 +171,7 @@ BaseGLModule::BaseGLModule(InviwoApplication* app) : InviwoModule(app, "BaseGL")
     registerProcessor<SphericalVolumeRaycaster>();
     registerProcessor<SplitImage>();
     registerProcessor<StandardVolumeRaycaster>();
+    registerProcessor<SurfaceExtractionGL>();
     registerProcessor<TubeRendering>();
     registerProcessor<VolumeRaycaster>();
     registerProcessor<VolumeSliceGL>();
@@ -186,6 +193,7 @@ BaseGLModule::BaseGLModule(InviwoApplication* app) : InviwoModule(app, "BaseGL")
     registerProcessor<ImageLayoutGL>();
     registerProcessor<ImageLowPass>();
     registerProcessor<ImageMixer>();
+    registerProcessor<ImageMultiCompositeProcessorGL>();
     registerProcessor<ImageNormalizationProcessor>();
     registerProcessor<ImageOverlayGL>();
     registerProcessor<ImageResample>();
@@ -0,0 +1,180 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/datastructures/pointlod.h>
+
+#include <inviwo/core/util/indexmapper.h>  // for IndexMapper3D
+
+#include <algorithm>  // for partition, max, ranges::any_of
+#include <cmath>      // for cbrt, sqrt
+#include <numeric>    // for iota
+#include <utility>    // for pair, swap
+
+#include <glm/gtx/component_wise.hpp>  // for compMax
+
+namespace inviwo {
+
+PointLOD::PointLOD(std::span<const vec3> positions, size_t nodeCapacity)
+    : nodeCapacity_{std::max(nodeCapacity, size_t{1})}, indices_{}, nodes_{} {
+    if (positions.empty()) return;
+
+    vec3 lower{std::numeric_limits<float>::max()};
+    vec3 upper{std::numeric_limits<float>::lowest()};
+    for (const auto& p : positions) {
+        lower = glm::min(lower, p);
+        upper = glm::max(upper, p);
+    }
+    const auto size = std::max(glm::compMax(upper - lower), std::numeric_limits<float>::min());
+
+    std::vector<std::uint32_t> ids(positions.size());
+    std::iota(ids.begin(), ids.end(), std::uint32_t{0});
+    indices_.reserve(positions.size());
+    build(ids, positions, lower, size, 0);
+}
+
+std::uint32_t PointLOD::build(std::span<std::uint32_t> ids, std::span<const vec3> positions,
+                              vec3 min, float size, size_t depth) {
+    const auto index = static_cast<std::uint32_t>(nodes_.size());
+    Node node{min, size, 0.0f, static_cast<std::uint32_t>(indices_.size()), 0,
+              static_cast<std::uint32_t>(ids.size()), {}};
+    node.children.fill(noChild);
+    nodes_.push_back(node);
+
+    if (ids.size() <= nodeCapacity_ || depth >= maxDepth) {
+        indices_.insert(indices_.end(), ids.begin(), ids.end());
+        nodes_[index].count = static_cast<std::uint32_t>(ids.size());
+        return index;
+    }
+
+    // Keep the first point of each cell of a grid of about nodeCapacity cells, moving them to the
+    // front of ids
+    const auto grid = std::max(size_t{1}, static_cast<size_t>(std::cbrt(nodeCapacity_)));
+    const util::IndexMapper3D im{size3_t{grid}};
+    std::vector<bool> occupied(grid * grid * grid, false);
+    size_t count = 0;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const auto pos = (positions[ids[i]] - min) / size * static_cast<float>(grid);
+        const auto cell = im(size3_t{glm::clamp(pos, vec3{0.0f}, vec3{grid - 1})});
+        if (!occupied[cell]) {
+            occupied[cell] = true;
+            std::swap(ids[i], ids[count++]);
+        }
+    }
+    indices_.insert(indices_.end(), ids.begin(), ids.begin() + count);
+    nodes_[index].count = static_cast<std::uint32_t>(count);
+    nodes_[index].spacing = size / static_cast<float>(grid);
+
+    // Distribute the remaining points to the octants
+    const auto half = size * 0.5f;
+    const auto mid = min + half;
+    const auto split = [&](std::span<std::uint32_t> span, int axis) {
+        const auto it = std::partition(span.begin(), span.end(), [&](std::uint32_t id) {
+            return positions[id][axis] < mid[axis];
+        });
+        const auto n = static_cast<size_t>(it - span.begin());
+        return std::pair{span.first(n), span.subspan(n)};
+    };
+    std::array<std::span<std::uint32_t>, 8> octants;
+    const auto xs = split(ids.subspan(count), 0);
+    for (size_t x = 0; x < 2; ++x) {
+        const auto ys = split(x == 0 ? xs.first : xs.second, 1);
+        for (size_t y = 0; y < 2; ++y) {
+            const auto zs = split(y == 0 ? ys.first : ys.second, 2);
+            octants[x + 2 * y] = zs.first;
+            octants[x + 2 * y + 4] = zs.second;
+        }
+    }
+
+    for (size_t i = 0; i < octants.size(); ++i) {
+        if (octants[i].empty()) continue;
+        const vec3 offset{i & 1u, (i >> 1) & 1u, (i >> 2) & 1u};
+        const auto child = build(octants[i], positions, min + offset * half, half, depth + 1);
+        nodes_[index].children[i] = child;
+    }
+    return index;
+}
+
+auto PointLOD::select(const mat4& dataToClip, vec2 viewport, float maxError) const
+    -> std::vector<Range> {
+    std::vector<Range> ranges;
+    if (nodes_.empty()) return ranges;
+
+    const auto row = [&](int i) {
+        return vec4{dataToClip[0][i], dataToClip[1][i], dataToClip[2][i], dataToClip[3][i]};
+    };
+    const std::array<vec4, 6> planes{row(3) + row(0), row(3) - row(0), row(3) + row(1),
+                                     row(3) - row(1), row(3) + row(2), row(3) - row(2)};
+    // Pixels per unit of length at w = 1, and the largest change of w per unit of length
+    const auto pixels = 0.5f * std::max(glm::length(vec3{row(0)}) * viewport.x,
+                                        glm::length(vec3{row(1)}) * viewport.y);
+    const auto wRate = glm::length(vec3{row(3)});
+
+    const auto add = [&](std::uint32_t first, std::uint32_t count) {
+        if (count == 0) return;
+        if (!ranges.empty() && ranges.back().first + ranges.back().count == first) {
+            ranges.back().count += count;
+        } else {
+            ranges.push_back({first, count});
+        }
+    };
+
+    std::vector<std::uint32_t> stack{0};
+    while (!stack.empty()) {
+        const auto& node = nodes_[stack.back()];
+        stack.pop_back();
+
+        const auto radius = node.size * 0.5f * std::sqrt(3.0f);
+        const vec4 center{node.min + node.size * 0.5f, 1.0f};
+        if (std::ranges::any_of(planes, [&](const vec4& plane) {
+                return glm::dot(plane, center) < -radius * glm::length(vec3{plane});
+            })) {
+            continue;
+        }
+
+        add(node.first, node.count);
+
+        // Refine using the smallest w of the bounding sphere, i.e. the largest projection
+        const auto w = glm::dot(row(3), center) - radius * wRate;
+        const bool refine =
+            node.spacing > 0.0f && (w <= 0.0f || node.spacing * pixels / w > maxError);
+        if (!refine) continue;
+
+        // Push in reverse to visit the children in depth first order
+        for (auto child = node.children.rbegin(); child != node.children.rend(); ++child) {
+            if (*child != noChild) stack.push_back(*child);
+        }
+    }
+    return ranges;
+}
+
+const std::vector<std::uint32_t>& PointLOD::getIndices() const { return indices_; }
+
+auto PointLOD::getNodes() const -> const std::vector<Node>& { return nodes_; }
+
+}  // namespace inviwo
@@ -31,6 +31,7 @@
 
 #include <inviwo/core/algorithm/boundingbox.h>                 // for boundingBox
 #include <inviwo/core/algorithm/markdown.h>                    // for operator""_help, operator"...
+#include <inviwo/core/datastructures/camera/camera.h>          // for Camera
 #include <inviwo/core/datastructures/geometry/geometrytype.h>  // for BufferType, BufferType::No...
 #include <inviwo/core/datastructures/image/image.h>            // for Image
 #include <inviwo/core/datastructures/image/imagetypes.h>       // for LayerType, LayerType::Color
@@ -49,6 +50,7 @@
 #include <modules/basegl/algorithm/entryexitpoints.h>          // for CapNearClip, EntryExitPoin...
 #include <modules/opengl/image/imagegl.h>                      // for ImageGL
 
+#include <memory>       // for shared_ptr, make_shared
 #include <string>       // for string
 #include <string_view>  // for string_view
 #include <type_traits>  // for remove_extent_t
@@ -65,7 +67,8 @@ const ProcessorInfo EntryExitPoints::processorInfo_{
     Tags::GL,                      // Tags
     R"(Computes the entry and exit points of a triangle mesh from the camera position
     in texture space. The output color will be zero if no intersection is found,
-    otherwise.)"_unindentHelp};
+    otherwise. Processors with the same camera and mesh share their entry and exit points instead of
+    rendering them again.)"_unindentHelp};
 
 const ProcessorInfo& EntryExitPoints::getProcessorInfo() const { return processorInfo_; }
 
@@ -89,41 +92,67 @@ EntryExitPoints::EntryExitPoints()
     addPort(exitPort_, "ImagePortGroup1");
     addProperties(capNearClipping_, camera_, trackball_);
 
-    onReloadCallback_ =
-        entryExitHelper_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
+    onReloadCallback_ = entryExitHelper_.onReload([this]() {
+        // The shaders changed, so our previous result can no longer be reused
+        if (result_) result_->key = {};
+        invalidate(InvalidationLevel::InvalidResources);
+    });
 }
 
 EntryExitPoints::~EntryExitPoints() = default;
 
 void EntryExitPoints::process() {
-    auto entry = entryPort_.getEditableData();
-
-    if (inport_.getData()->hasBuffer(BufferType::NormalAttrib) &&
-        entry->getNumberOfColorLayers() != 2) {
-
-        entry = std::make_shared<Image>(entry->getDimensions(), DataVec4UInt16::get());
-        // Add a layer for the normals
-        entry->addColorLayer(
-            std::make_shared<Layer>(entry->getDimensions(), DataVec4Int8::get(), LayerType::Color));
-        entryPort_.setData(entry);
-        entryImg_ = entry->getEditableRepresentation<ImageGL>();
-    } else if (!inport_.getData()->hasBuffer(BufferType::NormalAttrib) &&
-               entry->getNumberOfColorLayers() != 1) {
-
-        entry = std::make_shared<Image>(entry->getDimensions(), DataVec4UInt16::get());
-        entryPort_.setData(entry);
-        entryImg_ = entry->getEditableRepresentation<ImageGL>();
-    } else if (!entryImg_ || !entryImg_->isValid()) {
-        entryImg_ = entry->getEditableRepresentation<ImageGL>();
+    using Cache = algorithm::EntryExitPointsCache;
+
+    const auto mesh = inport_.getData();
+    const Cache::Key key{
+        .mesh = mesh,
+        .viewMatrix = camera_.get().getViewMatrix(),
+        .projectionMatrix = camera_.get().getProjectionMatrix(),
+        .dimensions = entryPort_.getDimensions(),
+        .capNearClip = capNearClipping_ ? algorithm::CapNearClip::Yes : algorithm::CapNearClip::No,
+        .includeNormals = mesh->hasBuffer(BufferType::NormalAttrib)
+                              ? algorithm::IncludeNormals::Yes
+                              : algorithm::IncludeNormals::No};
+
+    // Reuse the entry and exit points of any processor with the same camera and mesh
+    if (auto cached = Cache::shared().find(key)) {
+        shared_ = cached != result_ ? cached : nullptr;
+        entryPort_.setData(std::shared_ptr<const Image>{cached->entryPoints});
+        exitPort_.setData(std::shared_ptr<const Image>{cached->exitPoints});
+        return;
     }
-    if (!exitImg_ || !exitImg_->isValid()) {
-        exitImg_ = exitPort_.getEditableData()->getEditableRepresentation<ImageGL>();
+    shared_.reset();
+
+    // Don't overwrite our previous result if other processors are still using it
+    if (!result_ || result_.use_count() > 1) {
+        result_ = std::make_shared<Cache::Entry>();
+        Cache::shared().add(result_);
+    }
+
+    const size_t colorLayers = key.includeNormals == algorithm::IncludeNormals::Yes ? 2 : 1;
+    auto& entry = result_->entryPoints;
+    if (!entry || entry->getDimensions() != key.dimensions ||
+        entry->getNumberOfColorLayers() != colorLayers) {
+        entry = std::make_shared<Image>(key.dimensions, DataVec4UInt16::get());
+        if (colorLayers == 2) {
+            // Add a layer for the normals
+            entry->addColorLayer(std::make_shared<Layer>(key.dimensions, DataVec4Int8::get(),
+                                                         LayerType::Color));
+        }
     }
+    auto& exit = result_->exitPoints;
+    if (!exit || exit->getDimensions() != key.dimensions) {
+        exit = std::make_shared<Image>(key.dimensions, DataVec4UInt16::get());
+    }
+
+    entryExitHelper_(*entry->getEditableRepresentation<ImageGL>(),
+                     *exit->getEditableRepresentation<ImageGL>(), camera_.get(), *mesh,
+                     key.capNearClip, key.includeNormals);
+    result_->key = key;
 
-    const bool addNormals = inport_.getData()->hasBuffer(BufferType::NormalAttrib);
-    entryExitHelper_(*entryImg_, *exitImg_, camera_.get(), *inport_.getData(),
-                     capNearClipping_ ? algorithm::CapNearClip::Yes : algorithm::CapNearClip::No,
-                     addNormals ? algorithm::IncludeNormals::Yes : algorithm::IncludeNormals::No);
+    entryPort_.setData(std::shared_ptr<const Image>{entry});
+    exitPort_.setData(std::shared_ptr<const Image>{exit});
 }
 
 }  // namespace inviwo
@@ -43,9 +43,12 @@
 #include <inviwo/core/properties/invalidationlevel.h>  // for InvalidationLevel, InvalidationLev...
 #include <inviwo/core/properties/optionproperty.h>     // for OptionPropertyOption, OptionProper...
 #include <inviwo/core/properties/ordinalproperty.h>    // for ordinalLength, OrdinalPropertyState
+#include <modules/opengl/buffer/bufferobjectarray.h>   // for BufferObjectArray
 #include <modules/opengl/geometry/meshgl.h>            // for MeshGL
+#include <modules/opengl/openglcapabilities.h>         // for OpenGLCapabilities
 #include <modules/opengl/rendering/meshdrawergl.h>     // for MeshDrawerGL::DrawObject, MeshDraw...
 #include <modules/opengl/shader/shader.h>              // for Shader, Shader::Build
+#include <modules/opengl/shader/shadertype.h>          // for ShaderType
 #include <modules/opengl/shader/shaderutils.h>         // for addShaderDefines, setShaderUniforms
 #include <modules/opengl/texture/textureunit.h>        // for TextureUnit
 #include <modules/opengl/texture/textureutils.h>       // for bindColorTexture, activateTargetAn...
@@ -66,6 +69,13 @@ const ProcessorInfo HeightFieldProcessor::processorInfo_{
     Tags::GL,                          // Tags
     R"(
         Maps a height field onto a geometry and renders it to an image.
+
+        In the Tessellation mode (requires OpenGL 4.0) the terrain is generated on the GPU
+        instead, from a grid of patches covering the xy-extent of each input mesh, or the unit
+        square if there is none. Each patch is refined such that the generated triangles are
+        about "Triangle Size" pixels large on screen, and the normals are derived from the
+        height field. Large height fields can then be rendered interactively without
+        building a mesh with one vertex per height sample.
         
         ![](file:~modulePath~/docs/images/heightfield-network.png)
         
@@ -75,6 +85,19 @@ const ProcessorInfo HeightFieldProcessor::processorInfo_{
 
 const ProcessorInfo& HeightFieldProcessor::getProcessorInfo() const { return processorInfo_; }
 
+namespace {
+
+// Height samples covered by each patch, at most the guaranteed minimum GL_MAX_TESS_GEN_LEVEL
+constexpr size_t patchTexels = 64;
+
+mat4 patchToData(const Mesh& mesh) {
+    if (!mesh.findBuffer(BufferType::PositionAttrib).first) return mat4{1.0f};
+    return glm::inverse(mesh.getCoordinateTransformer().getDataToWorldMatrix()) *
+           util::boundingBox(mesh);
+}
+
+}  // namespace
+
 HeightFieldProcessor::HeightFieldProcessor()
     : Processor()
     , inport_{"geometry", "Input geometry which is modified by the height field"_help}
@@ -96,20 +119,42 @@ HeightFieldProcessor::HeightFieldProcessor()
            {"shadingColorTex", "Color Texture", HeightFieldShading::ColorTexture},
            {"shadingHeightField", "Heightfield Texture", HeightFieldShading::HeightField}},
           0)
+    , mode_{"mode", "Mode",
+            R"(
+        Mesh Displacement moves the vertices of the input meshes by the height field.
+        Tessellation generates the terrain on the GPU with a screen space level of detail, and
+        only uses the input meshes for placement.)"_unindentHelp,
+            {{"meshDisplacement", "Mesh Displacement", Mode::MeshDisplacement},
+             {"tessellation", "Tessellation", Mode::Tessellation}},
+            0}
+    , triangleSize_{"triangleSize", "Triangle Size",
+                    util::ordinalScale(8.0f, 64.0f)
+                        .setMin(1.0f)
+                        .set("Target length in pixels of the generated triangle edges"_help)}
     , camera_("camera", "Camera", util::boundingBox(inport_))
     , trackball_(&camera_)
     , lightingProperty_("lighting", "Lighting", &camera_)
-    , shader_("heightfield.vert", "heightfield.frag", Shader::Build::No) {
-    addPort(inport_);
+    , shader_("heightfield.vert", "heightfield.frag", Shader::Build::No)
+    , tessellationShader_{{{ShaderType::Vertex, "heightfieldpatch.vert"},
+                           {ShaderType::TessellationControl, "heightfield.tesc"},
+                           {ShaderType::TessellationEvaluation, "heightfield.tese"},
+                           {ShaderType::Fragment, "heightfield.frag"}},
+                          Shader::Build::No}
+    , tessellationAvailable_{false} {
+    addPort(inport_).setOptional(true);
     addPort(inportHeightfield_).setOptional(true);
     addPort(inportTexture_).setOptional(true);
     addPort(inportNormalMap_).setOptional(true);
     addPort(imageInport_).setOptional(true);
     addPort(outport_);
 
-    addProperties(heightScale_, terrainShadingMode_, camera_, lightingProperty_, trackball_);
+    addProperties(heightScale_, terrainShadingMode_, mode_, triangleSize_, camera_,
+                  lightingProperty_, trackball_);
+    triangleSize_.visibilityDependsOn(
+        mode_, [](const auto& p) { return p.getSelectedValue() == Mode::Tessellation; });
 
     shader_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
+    tessellationShader_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
 }
 
 HeightFieldProcessor::~HeightFieldProcessor() = default;
@@ -117,12 +162,20 @@ HeightFieldProcessor::~HeightFieldProcessor() = default;
 void HeightFieldProcessor::initializeResources() {
     utilgl::addShaderDefines(shader_, lightingProperty_);
     shader_.build();
+
+    tessellationAvailable_ = OpenGLCapabilities::getOpenGLVersion() >= 400;
+    if (tessellationAvailable_) {
+        utilgl::addShaderDefines(tessellationShader_, lightingProperty_);
+        tessellationShader_.build();
+    }
 }
 
 void HeightFieldProcessor::process() {
     utilgl::activateTargetAndClearOrCopySource(outport_, imageInport_);
 
-    shader_.activate();
+    const bool tessellate = mode_ == Mode::Tessellation && tessellationAvailable_;
+    auto& shader = tessellate ? tessellationShader_ : shader_;
+    shader.activate();
 
     // bind input textures
     TextureUnit heightFieldUnit, colorTexUnit, normalTexUnit;
@@ -147,22 +200,52 @@ void HeightFieldProcessor::process() {
         utilgl::bindColorTexture(inportNormalMap_, normalTexUnit.getEnum());
     }
 
-    shader_.setUniform("inportHeightfield", heightFieldUnit.getUnitNumber());
-    shader_.setUniform("inportTexture", colorTexUnit.getUnitNumber());
-    shader_.setUniform("inportNormalMap", normalTexUnit.getUnitNumber());
-    shader_.setUniform("terrainShadingMode", terrainShadingMode);
-    shader_.setUniform("normalMapping", (normalMapping ? 1 : 0));
-
-    utilgl::setUniforms(shader_, camera_, lightingProperty_, heightScale_);
-
-    for (auto mesh : inport_) {
-        utilgl::setShaderUniforms(shader_, *mesh, "geometry");
-        MeshDrawerGL::DrawObject drawer{mesh->getRepresentation<MeshGL>(),
-                                        mesh->getDefaultMeshInfo()};
-        drawer.draw();
+    shader.setUniform("inportHeightfield", heightFieldUnit.getUnitNumber());
+    shader.setUniform("inportTexture", colorTexUnit.getUnitNumber());
+    shader.setUniform("inportNormalMap", normalTexUnit.getUnitNumber());
+    shader.setUniform("terrainShadingMode", terrainShadingMode);
+    shader.setUniform("normalMapping", (normalMapping ? 1 : 0));
+
+    utilgl::setUniforms(shader, camera_, lightingProperty_, heightScale_);
+
+    if (tessellate) {
+        const size2_t dims = inportHeightfield_.isReady()
+                                 ? inportHeightfield_.getData()->getDimensions()
+                                 : size2_t{1};
+        const uvec2 patches{glm::max((dims + size2_t{patchTexels - 1}) / patchTexels, size2_t{1})};
+        shader.setUniform("patches", patches);
+        shader.setUniform("texelSize", vec2{1.0f} / vec2{dims});
+        shader.setUniform("viewport", vec2{outport_.getDimensions()});
+        shader.setUniform("triangleSize", triangleSize_.get());
+        shader.setUniform("maxTessLevel", static_cast<float>(patchTexels));
+
+        // The patch corners are generated from gl_VertexID, no vertex buffers are needed
+        if (!vao_) vao_ = std::make_unique<BufferObjectArray>();
+        vao_->bind();
+        glPatchParameteri(GL_PATCH_VERTICES, 4);
+        const auto draw = [&](const Mesh& mesh) {
+            utilgl::setShaderUniforms(shader, mesh, "geometry");
+            shader.setUniform("patchToData", patchToData(mesh));
+            glDrawArrays(GL_PATCHES, 0, static_cast<GLsizei>(4 * patches.x * patches.y));
+        };
+        if (inport_.hasData()) {
+            for (auto mesh : inport_) {
+                draw(*mesh);
+            }
+        } else {
+            draw(Mesh{});
+        }
+        vao_->unbind();
+    } else {
+        for (auto mesh : inport_) {
+            utilgl::setShaderUniforms(shader, *mesh, "geometry");
+            MeshDrawerGL::DrawObject drawer{mesh->getRepresentation<MeshGL>(),
+                                            mesh->getDefaultMeshInfo()};
+            drawer.draw();
+        }
     }
 
-    shader_.deactivate();
+    shader.deactivate();
     utilgl::deactivateCurrentTarget();
     TextureUnit::setZeroUnit();
 }
@@ -0,0 +1,73 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/processors/imageprocessing/imagemulticompositeprocessorgl.h>
+
+#include <inviwo/core/algorithm/markdown.h>               // for operator""_unindentHelp
+#include <inviwo/core/datastructures/image/imagetypes.h>  // for ImageType, ImageType::ColorDept...
+#include <inviwo/core/ports/imageport.h>                  // for ImageMultiInport, ImageOutport
+#include <inviwo/core/processors/processor.h>             // for Processor
+#include <inviwo/core/processors/processorinfo.h>         // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>        // for CodeState, CodeState::Experim...
+#include <inviwo/core/processors/processortags.h>         // for Tags, Tags::GL
+#include <modules/opengl/image/imagecompositor.h>         // for ImageCompositor
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo ImageMultiCompositeProcessorGL::processorInfo_{
+    "org.inviwo.ImageMultiCompositeProcessorGL",  // Class identifier
+    "Image Multi Composite",                      // Display name
+    "Image Operation",                            // Category
+    CodeState::Experimental,                      // Code state
+    Tags::GL,                                     // Tags
+    R"(Performs a depth-based compositing of all connected images. Up to 16 images, fewer
+    on hardware with a small number of texture units, are composited in a single pass.
+    Images with equal depth are blended in the order they are connected, later on top.
+    )"_unindentHelp,
+};
+const ProcessorInfo& ImageMultiCompositeProcessorGL::getProcessorInfo() const {
+    return processorInfo_;
+}
+
+ImageMultiCompositeProcessorGL::ImageMultiCompositeProcessorGL()
+    : Processor()
+    , inport_("inport", "Images to composite"_help)
+    , outport_("outport", "The composited image"_help)
+    , compositor_{} {
+
+    addPort(inport_);
+    addPort(outport_);
+}
+
+void ImageMultiCompositeProcessorGL::process() {
+    compositor_.composite(inport_, outport_, ImageType::ColorDepthPicking);
+}
+
+}  // namespace inviwo
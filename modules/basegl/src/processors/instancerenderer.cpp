@@ -40,6 +40,7 @@
 #include <inviwo/core/processors/processorinfo.h>      // for ProcessorInfo
 #include <inviwo/core/processors/processorstate.h>     // for CodeState, CodeState::Stable
 #include <inviwo/core/processors/processortags.h>      // for Tags, Tags::GL
+#include <inviwo/core/properties/boolproperty.h>       // for BoolProperty
 #include <inviwo/core/properties/cameraproperty.h>     // for CameraProperty
 #include <inviwo/core/properties/compositeproperty.h>  // for CompositeProperty
 #include <inviwo/core/properties/invalidationlevel.h>  // for InvalidationLevel, Invalidatio...
@@ -61,6 +62,7 @@
 #include <inviwo/core/util/foreacharg.h>                   // for forEachArg
 #include <modules/opengl/geometry/meshgl.h>                // for MeshGL
 #include <modules/opengl/inviwoopengl.h>                   // for GL_DEPTH_TEST, GL_ONE_MINUS_SR...
+#include <modules/opengl/openglcapabilities.h>             // for OpenGLCapabilities
 #include <modules/opengl/openglutils.h>                    // for BlendModeState, GlBoolState
 #include <modules/opengl/rendering/meshdrawergl.h>         // for MeshDrawerGL::DrawObject, Mesh...
 #include <modules/opengl/shader/shader.h>                  // for Shader, Shader::Build
@@ -73,6 +75,10 @@
 #include <modules/opengl/buffer/buffergl.h>
 
 #include <algorithm>    // for for_each, min_element
+#include <cstddef>      // for offsetof
+#include <cstring>      // for memcmp
+#include <limits>       // for numeric_limits
+#include <span>         // for span, as_bytes
 #include <string>       // for basic_string, operator==, string
 #include <string_view>  // for string_view, operator==
 #include <utility>      // for move, pair, swap
@@ -108,6 +114,11 @@ const ProcessorInfo InstanceRenderer::processorInfo_{
             }
         
         How the uniforms are applied in the shader can be specified in a set of properties.
+
+        With GPU instancing enabled (requires OpenGL 4.3) the vector data is instead uploaded
+        to shader storage buffers and all instances are drawn with a single instanced draw call
+        per index buffer. The instances can then optionally be frustum culled and assigned a
+        level of detail by a compute pass, see the Performance properties.
         
         Example network:
         [basegl/instance_renderer.inv](file:~modulePath~/data/workspaces/instance_renderer.inv)
@@ -125,14 +136,15 @@ constexpr ShaderSegment::Placeholder commonCode{"#pragma IVW_SHADER_SEGMENT_PLAC
                                                 "commoncode"};
 constexpr ShaderSegment::Placeholder setupVert{"#pragma IVW_SHADER_SEGMENT_PLACEHOLDER_SETUP",
                                                "setup"};
+constexpr ShaderSegment::Placeholder instance{"#pragma IVW_SHADER_SEGMENT_PLACEHOLDER_INSTANCE",
+                                              "instance"};
+constexpr ShaderSegment::Placeholder functions{"#pragma IVW_SHADER_SEGMENT_PLACEHOLDER_FUNCTIONS",
+                                               "functions"};
 }  // namespace irplaceholder
 
 namespace {
 
-constexpr std::string_view vertexShader = util::trim(R"(
-#include "utils/pickingutils.glsl"
-#include "utils/structs.glsl"
-
+constexpr std::string_view helperFunctions = util::trim(R"(
 mat4 rotate(vec3 axis, float angle) {
   axis = normalize(axis);
   float s = sin(angle);
@@ -155,6 +167,13 @@ mat4 scale(vec3 scale) {
     0.0, 0.0, 0.0,     1.0
   );
 }
+)");
+
+constexpr std::string_view vertexShader = util::trim(R"(
+#include "utils/pickingutils.glsl"
+#include "utils/structs.glsl"
+
+#pragma IVW_SHADER_SEGMENT_PLACEHOLDER_FUNCTIONS
 
 layout(location = 7) in uint in_PickId;
 
@@ -172,6 +191,8 @@ flat out vec4 picking;
 #pragma IVW_SHADER_SEGMENT_PLACEHOLDER_SETUP
  
 void main() {
+#pragma IVW_SHADER_SEGMENT_PLACEHOLDER_INSTANCE
+
 #pragma IVW_SHADER_SEGMENT_PLACEHOLDER_COMMONCODE
 
 #pragma IVW_SHADER_SEGMENT_PLACEHOLDER_TRANSFORMS
@@ -180,6 +201,73 @@ void main() {
 }
 )");
 
+// Transforms the corners of the bounding box of the mesh for each instance and writes the index
+// of each instance that intersects the view frustum to the list of its level of detail.
+constexpr std::string_view cullShader = util::trim(R"(
+#include "utils/structs.glsl"
+
+#pragma IVW_SHADER_SEGMENT_PLACEHOLDER_FUNCTIONS
+
+uniform GeometryParameters geometry;
+uniform CameraParameters camera;
+
+#pragma IVW_SHADER_SEGMENT_PLACEHOLDER_UNIFORM
+
+layout(std430, binding = 0) writeonly buffer VisibleInstances { uint visibleInstances[]; };
+layout(std430, binding = LOD_COUNTS_BINDING) buffer LodCounts { uint lodCounts[]; };
+
+uniform uint numInstances = 0u;
+uniform uint numLods = 1u;
+uniform float lodDistance = 0.0;
+uniform bool frustumCulling = true;
+// Maps the unit cube to the bounding box of the mesh in data space
+uniform mat4 meshBox = mat4(1.0);
+
+#pragma IVW_SHADER_SEGMENT_PLACEHOLDER_SETUP
+
+layout(local_size_x = 64) in;
+
+void main() {
+    uint instanceIndex = gl_GlobalInvocationID.x;
+    if (instanceIndex >= numInstances) return;
+
+#pragma IVW_SHADER_SEGMENT_PLACEHOLDER_INSTANCE
+
+    // The culling only considers positions, the other vertex attributes get default values
+    vec4 in_Color = vec4(1.0);
+    vec3 in_Normal = vec3(0.0, 0.0, 1.0);
+    vec3 in_TexCoord = vec3(0.0);
+    uint in_PickId = 0u;
+    vec4 worldPosition;
+
+    uint outside = 63u;
+    vec3 center = vec3(0.0);
+    for (int corner = 0; corner < 8; ++corner) {
+        vec4 in_Vertex = meshBox * vec4(corner & 1, (corner >> 1) & 1, (corner >> 2) & 1, 1.0);
+
+#pragma IVW_SHADER_SEGMENT_PLACEHOLDER_COMMONCODE
+
+#pragma IVW_SHADER_SEGMENT_PLACEHOLDER_TRANSFORMS
+
+        vec4 clip = camera.worldToClip * worldPosition;
+        outside &= (clip.x < -clip.w ? 1u : 0u) | (clip.x > clip.w ? 2u : 0u) |
+                   (clip.y < -clip.w ? 4u : 0u) | (clip.y > clip.w ? 8u : 0u) |
+                   (clip.z < -clip.w ? 16u : 0u) | (clip.z > clip.w ? 32u : 0u);
+        center += worldPosition.xyz / worldPosition.w;
+    }
+    // All corners outside of the same plane
+    if (frustumCulling && outside != 0u) return;
+
+    uint lod = 0u;
+    float dist = distance(center / 8.0, camera.position);
+    if (lodDistance > 0.0 && dist >= lodDistance) {
+        lod = min(uint(log2(dist / lodDistance)) + 1u, numLods - 1u);
+    }
+    uint slot = atomicAdd(lodCounts[lod], 1u);
+    visibleInstances[lod * numInstances + slot] = instanceIndex;
+}
+)");
+
 constexpr std::string_view fragmentShader = util::trim(R"(
 #include "utils/shading.glsl"
 
@@ -206,6 +294,86 @@ void main() {
 }
 )");
 
+/**
+ * Keeps the data of a vector port in a shader storage buffer. Only consecutive runs of blocks
+ * that changed since the last update are uploaded, and nothing if the port data is the same.
+ */
+class InstanceBuffer {
+public:
+    static constexpr size_t blockSize = 4096;
+
+    template <typename T>
+    void update(const std::shared_ptr<const std::vector<T>>& data) {
+        if (data.get() == last_ && !owner_.expired()) return;
+        owner_ = data;
+        last_ = data.get();
+
+        // std430 pads a vec3 to the size of a vec4 and the columns of a mat3 likewise
+        if constexpr (std::is_same_v<T, vec3>) {
+            upload(pad<vec4>(*data, [](const vec3& v) { return vec4{v, 0.0f}; }));
+        } else if constexpr (std::is_same_v<T, mat3>) {
+            upload(pad<glm::mat3x4>(*data, [](const mat3& m) { return glm::mat3x4{m}; }));
+        } else {
+            upload(std::as_bytes(std::span{*data}));
+        }
+    }
+
+    void bind(GLuint binding) const {
+        if (buffer_) buffer_->bindBase(binding);
+    }
+
+private:
+    template <typename P, typename T>
+    std::span<const std::byte> pad(const std::vector<T>& data, auto&& convert) {
+        padded_.resize(data.size() * sizeof(P));
+        auto* dst = reinterpret_cast<P*>(padded_.data());
+        std::ranges::transform(data, dst, convert);
+        return padded_;
+    }
+
+    void upload(std::span<const std::byte> bytes) {
+        if (bytes.empty()) return;
+
+        if (!buffer_ || shadow_.size() != bytes.size()) {
+            if (!buffer_) {
+                buffer_ = std::make_unique<BufferObject>(
+                    bytes.size(), GLFormats::get(DataUInt8::id()), GL_DYNAMIC_DRAW,
+                    GL_SHADER_STORAGE_BUFFER);
+            }
+            buffer_->upload(bytes.data(), static_cast<GLsizeiptr>(bytes.size()),
+                            BufferObject::SizePolicy::ResizeToFit);
+            shadow_.assign(bytes.begin(), bytes.end());
+            return;
+        }
+
+        const auto nBlocks = (bytes.size() + blockSize - 1) / blockSize;
+        const auto changed = [&](size_t block) {
+            const auto begin = block * blockSize;
+            const auto size = std::min(blockSize, bytes.size() - begin);
+            return std::memcmp(bytes.data() + begin, shadow_.data() + begin, size) != 0;
+        };
+        std::optional<size_t> runStart;
+        for (size_t block = 0; block <= nBlocks; ++block) {
+            if (block < nBlocks && changed(block)) {
+                if (!runStart) runStart = block;
+            } else if (runStart) {
+                const auto begin = *runStart * blockSize;
+                const auto end = std::min(block * blockSize, bytes.size());
+                buffer_->upload(bytes.data() + begin, static_cast<GLintptr>(begin),
+                                static_cast<GLsizeiptr>(end - begin));
+                std::memcpy(shadow_.data() + begin, bytes.data() + begin, end - begin);
+                runStart.reset();
+            }
+        }
+    }
+
+    std::unique_ptr<BufferObject> buffer_;
+    std::vector<std::byte> shadow_;
+    std::vector<std::byte> padded_;
+    const void* last_ = nullptr;
+    std::weak_ptr<const void> owner_;
+};
+
 }  // namespace
 
 namespace detail {
@@ -213,12 +381,16 @@ namespace detail {
 DynPort::DynPort(InstanceRenderer* theRenderer, std::unique_ptr<Inport> aPort,
                  std::function<std::optional<size_t>()> aSize,
                  std::function<void(Shader&, size_t)> aSet,
-                 std::function<void(ShaderObject&)> aAddUniform)
+                 std::function<void(ShaderObject&)> aAddUniform,
+                 std::function<void(ShaderObject&, GLuint)> aAddInstanceData,
+                 std::function<void(GLuint)> aBindInstanceData)
     : renderer{theRenderer}
     , port{std::move(aPort)}
     , size{aSize}
     , set{aSet}
-    , addUniform{aAddUniform} {
+    , addUniform{aAddUniform}
+    , addInstanceData{aAddInstanceData}
+    , bindInstanceData{aBindInstanceData} {
 
     renderer->addPort(*port);
 }
@@ -228,7 +400,9 @@ DynPort::DynPort(DynPort&& rhs)
     , port{nullptr}
     , size{std::move(rhs.size)}
     , set{std::move(rhs.set)}
-    , addUniform{std::move(rhs.addUniform)} {
+    , addUniform{std::move(rhs.addUniform)}
+    , addInstanceData{std::move(rhs.addInstanceData)}
+    , bindInstanceData{std::move(rhs.bindInstanceData)} {
     std::swap(rhs.renderer, renderer);
     std::swap(rhs.port, port);
 }
@@ -240,6 +414,8 @@ DynPort& DynPort::operator=(DynPort&& that) {
         std::swap(that.size, size);
         std::swap(that.set, set);
         std::swap(that.addUniform, addUniform);
+        std::swap(that.addInstanceData, addInstanceData);
+        std::swap(that.bindInstanceData, bindInstanceData);
     }
     return *this;
 }
@@ -270,9 +446,27 @@ DynPort createDynPortManager(InstanceRenderer* theRenderer, std::string_view ide
             irplaceholder::uniform, u->get(),
             fmt::format("uniform {0} {1} = {0}(0);", utilgl::glslTypeName<T>(), u->get())});
     };
+    auto addInstanceData = [u = uniform](ShaderObject& so, GLuint binding) {
+        so.addSegment(ShaderSegment{
+            irplaceholder::uniform, u->get(),
+            fmt::format("layout(std430, binding = {2}) readonly buffer {1}Buffer {{ {0} {1}Data[]; "
+                        "}};\n{0} {1};",
+                        utilgl::glslTypeName<T>(), u->get(), binding)});
+        so.addSegment(ShaderSegment{irplaceholder::instance, u->get(),
+                                    fmt::format("{0} = {0}Data[instanceIndex];", u->get())});
+    };
+    auto bindInstanceData = [p = port.get(),
+                             buffer = std::make_shared<InstanceBuffer>()](GLuint binding) {
+        if (auto data = p->getData()) {
+            buffer->update(data);
+        }
+        buffer->bind(binding);
+    };
 
-    return DynPort{theRenderer, std::move(port), std::move(size), std::move(set),
-                   std::move(addUniform)};
+    return DynPort{theRenderer,           std::move(port),
+                   std::move(size),       std::move(set),
+                   std::move(addUniform), std::move(addInstanceData),
+                   std::move(bindInstanceData)};
 }
 
 DynUniform::DynUniform(std::function<void(Shader&, TextureUnitContainer&)> aSetAndBind,
@@ -297,6 +491,9 @@ DynUniform& DynUniform::operator=(DynUniform&& that) {
 InstanceRenderer::InstanceRenderer()
     : Processor()
     , inport_("mesh", "Mesh to be drawn multiple times"_help)
+    , lodMeshes_("lodMeshes", R"(
+        Optional meshes used as levels of detail, ordered from the most to the least detailed.
+        Level zero is always the mesh of the main inport. Requires GPU instancing.)"_unindentHelp)
     , background_("background", "Background image (optional)"_help)
     , outport_("image", "The rendered image"_help)
     , uniforms_{"uniforms",
@@ -363,11 +560,39 @@ InstanceRenderer::InstanceRenderer()
                     "vec4(pickingIndexToColor(in_PickId), 1.0). Expects a vec4."_help,
                     "vec4(pickingIndexToColor(in_PickId), 1.0)",
                     InvalidationLevel::InvalidResources, PropertySemantics::Multiline}}}
+    , performance_{"performance", "Performance",
+                   "Settings controlling how the instances are drawn"_help}
+    , gpuInstancing_{"gpuInstancing", "GPU Instancing",
+                     R"(
+        Upload the vector data to shader storage buffers and draw all instances with instanced
+        draw calls instead of one draw call per instance. Falls back to per instance drawing if
+        OpenGL 4.3 is not available.)"_unindentHelp,
+                     true, InvalidationLevel::InvalidResources}
+    , frustumCulling_{"frustumCulling", "Frustum Culling",
+                      R"(
+        Skip instances whose transformed mesh bounding box is outside of the view frustum.
+        The culling is done on the GPU and does not preserve the order of the instances,
+        which can affect the blending of transparent instances.)"_unindentHelp,
+                      false}
+    , lodDistance_{"lodDistance", "LOD Distance",
+                   R"(
+        Camera distance at which the first level of detail mesh is used. Each doubling of
+        the distance selects the next level. Zero disables the selection.)"_unindentHelp,
+                   1.0f,
+                   {0.0f, ConstraintBehavior::Immutable},
+                   {100.0f, ConstraintBehavior::Ignore}}
     , vert_{std::make_shared<StringShaderResource>("InstanceRenderer.vert", vertexShader)}
     , frag_{std::make_shared<StringShaderResource>("InstanceRenderer.frag", fragmentShader)}
-    , shader_{{{ShaderType::Vertex, vert_}, {ShaderType::Fragment, frag_}}, Shader::Build::No} {
+    , cull_{std::make_shared<StringShaderResource>("InstanceRenderer.comp", cullShader)}
+    , shader_{{{ShaderType::Vertex, vert_}, {ShaderType::Fragment, frag_}}, Shader::Build::No}
+    , instancedShader_{{{ShaderType::Vertex, vert_}, {ShaderType::Fragment, frag_}},
+                       Shader::Build::No}
+    , cullShader_{{{ShaderType::Compute, cull_}}, Shader::Build::No}
+    , instancingAvailable_{false}
+    , cullingAvailable_{false} {
 
     addPorts(inport_);
+    addPort(lodMeshes_).setOptional(true);
     addPort(background_).setOptional(true);
     addPort(outport_);
 
@@ -375,8 +600,11 @@ InstanceRenderer::InstanceRenderer()
     for (auto& transform : transforms_) {
         addProperty(transform);
     }
-    addProperties(camera_, lightingProperty_, trackball_);
-    shader_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
+    performance_.addProperties(gpuInstancing_, frustumCulling_, lodDistance_);
+    addProperties(performance_, camera_, lightingProperty_, trackball_);
+    for (auto* shader : {&shader_, &instancedShader_, &cullShader_}) {
+        shader->onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
+    }
 
     uniforms_.PropertyOwnerObservable::addObserver(this);
     ports_.PropertyOwnerObservable::addObserver(this);
@@ -575,22 +803,37 @@ void InstanceRenderer::onDidRemovePort(Property* /*property*/, size_t index) {
     }
 }
 
-void InstanceRenderer::initializeResources() {
-    utilgl::addShaderDefines(shader_, lightingProperty_);
+void InstanceRenderer::addSegments(ShaderObject& so, bool instanced) const {
+    so.clearSegments();
 
-    auto* vso = shader_.getVertexShaderObject();
-    vso->clearSegments();
+    so.addSegment(ShaderSegment{irplaceholder::functions, "functions", helperFunctions});
 
-    vso->addSegment(
+    so.addSegment(
         ShaderSegment{irplaceholder::setupVert, setupVert_.getIdentifier(), setupVert_.get()});
 
-    vso->addSegment(
+    so.addSegment(
         ShaderSegment{irplaceholder::commonCode, commonCode_.getIdentifier(), commonCode_.get()});
 
-    std::for_each(vecPorts_.begin(), vecPorts_.end(), [&](auto& port) { port.addUniform(*vso); });
+    if (instanced) {
+        // binding point 0 is reserved for the list of visible instances
+        GLuint binding = 1;
+        for (auto& port : vecPorts_) {
+            port.addInstanceData(so, binding++);
+        }
+    } else {
+        std::for_each(vecPorts_.begin(), vecPorts_.end(),
+                      [&](auto& port) { port.addUniform(so); });
+    }
 
     std::for_each(dynUniforms_.begin(), dynUniforms_.end(),
-                  [&](auto& uniform) { uniform.addUniform(*vso); });
+                  [&](auto& uniform) { uniform.addUniform(so); });
+}
+
+void InstanceRenderer::initializeResources() {
+    utilgl::addShaderDefines(shader_, lightingProperty_);
+
+    auto* vso = shader_.getVertexShaderObject();
+    addSegments(*vso, false);
 
     size_t prio = 100;
     for (auto& transform : transforms_) {
@@ -604,6 +847,70 @@ void InstanceRenderer::initializeResources() {
     shader_.setTransformFeedbackVaryings(feedbackVaryings, GL_INTERLEAVED_ATTRIBS);
 
     shader_.build();
+
+    buildInstanced();
+}
+
+void InstanceRenderer::buildInstanced() {
+    instancingAvailable_ = false;
+    cullingAvailable_ = false;
+    if (!gpuInstancing_ || OpenGLCapabilities::getOpenGLVersion() < 430) return;
+
+    // One storage buffer per port, plus the visible instances and the level counts
+    const auto requiredBlocks = static_cast<GLint>(vecPorts_.size() + 2);
+    GLint maxVertexBlocks = 0;
+    GLint maxComputeBlocks = 0;
+    glGetIntegerv(GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS, &maxVertexBlocks);
+    glGetIntegerv(GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS, &maxComputeBlocks);
+    if (maxVertexBlocks < requiredBlocks - 1) return;
+
+    utilgl::addShaderDefines(instancedShader_, lightingProperty_);
+    auto* vso = instancedShader_.getVertexShaderObject();
+    addSegments(*vso, true);
+    vso->addSegment(ShaderSegment{irplaceholder::uniform, "visibleInstances", R"(
+layout(std430, binding = 0) readonly buffer VisibleInstances { uint visibleInstances[]; };
+uniform bool useVisibleInstances = false;
+uniform uint visibleOffset = 0u;)",
+                                  0});
+    vso->addSegment(ShaderSegment{irplaceholder::instance, "instanceIndex",
+                                  "uint instanceIndex = useVisibleInstances ? "
+                                  "visibleInstances[visibleOffset + uint(gl_InstanceID)] : "
+                                  "uint(gl_InstanceID);",
+                                  0});
+    size_t prio = 100;
+    for (auto& transform : transforms_) {
+        vso->addSegment(ShaderSegment{
+            irplaceholder::transforms, transform.getIdentifier(),
+            fmt::format("{} = {};", transform.getIdentifier(), transform.get()), prio});
+        prio += 100;
+    }
+
+    try {
+        instancedShader_.build();
+        instancingAvailable_ = true;
+    } catch (const Exception& e) {
+        log::warn("GPU instancing disabled, failed to build the instanced shader: {}",
+                  e.getMessage());
+        return;
+    }
+
+    if (maxComputeBlocks < requiredBlocks) return;
+
+    auto* cso = cullShader_.getComputeShaderObject();
+    addSegments(*cso, true);
+    cso->addShaderDefine("LOD_COUNTS_BINDING", fmt::to_string(vecPorts_.size() + 1));
+    const auto& worldPosition = transforms_[2];
+    cso->addSegment(ShaderSegment{
+        irplaceholder::transforms, worldPosition.getIdentifier(),
+        fmt::format("{} = {};", worldPosition.getIdentifier(), worldPosition.get())});
+
+    try {
+        cullShader_.build();
+        cullingAvailable_ = true;
+    } catch (const Exception& e) {
+        log::warn("Instance culling disabled, failed to build the culling shader: {}",
+                  e.getMessage());
+    }
 }
 
 namespace {
@@ -683,6 +990,39 @@ void forEach(const MeshGL& meshGL, Shader& shader, auto& ports, size_t nInstance
     }
 }
 
+/**
+ * Layout of DrawElementsIndirectCommand. The first four members also match the layout of
+ * DrawArraysIndirectCommand where the fourth member is the base instance.
+ */
+struct DrawCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint first;
+    GLint baseVertex;
+    GLuint baseInstance;
+};
+
+/**
+ * Call the callback with the draw mode, the index buffer (nullptr for array draws), and number of
+ * elements for each draw call needed to render the mesh.
+ */
+void forEachDraw(const MeshGL& meshGL, auto&& callback) {
+    if (meshGL.empty()) return;
+
+    const std::size_t numIndexBuffers = meshGL.getIndexBufferCount();
+    for (std::size_t ib = 0; ib < numIndexBuffers; ++ib) {
+        const auto* indexBuffer = meshGL.getIndexBuffer(ib);
+        if (indexBuffer->getSize() == 0) continue;
+        const auto meshInfo = meshGL.getMeshInfoForIndexBuffer(ib);
+        callback(MeshDrawerGL::getGLDrawMode(meshInfo), indexBuffer,
+                 static_cast<GLsizei>(indexBuffer->getSize()));
+    }
+    if (numIndexBuffers == 0) {
+        callback(MeshDrawerGL::getGLDrawMode(meshGL.getDefaultMeshInfo()), nullptr,
+                 static_cast<GLsizei>(meshGL.getBufferGL(0)->getSize()));
+    }
+}
+
 mat4 calculateBoundingBox(std::span<const vec4> data) {
     using Pair = std::pair<vec4, vec4>;
     const auto minMax = std::accumulate(data.begin(), data.end(),
@@ -707,6 +1047,14 @@ std::optional<mat4> InstanceRenderer::render(bool enableBoundingBoxCalc) {
     if (nInstances == 0) return std::nullopt;
 
     const auto& mesh = *inport_.getData();
+
+    const auto nLods = 1 + lodMeshes_.getVectorData().size();
+    if (!enableBoundingBoxCalc && instancingAvailable_ &&
+        nInstances * nLods <= std::numeric_limits<GLuint>::max()) {
+        renderInstanced(mesh, nInstances);
+        return std::nullopt;
+    }
+
     const auto& meshGL = *mesh.getRepresentation<MeshGL>();
 
     utilgl::Activate activate{&shader_};
@@ -751,4 +1099,143 @@ std::optional<mat4> InstanceRenderer::render(bool enableBoundingBoxCalc) {
     return std::nullopt;
 }
 
+void InstanceRenderer::cullInstances(const Mesh& mesh, size_t nInstances, size_t nLods) {
+    const auto countsBytes = static_cast<GLsizeiptr>(nLods * sizeof(GLuint));
+    const auto visibleBytes = static_cast<GLsizeiptr>(nLods * nInstances * sizeof(GLuint));
+    if (!visibleInstances_) {
+        visibleInstances_ =
+            std::make_unique<BufferObject>(visibleBytes, GLFormats::get(DataUInt32::id()),
+                                           GL_DYNAMIC_COPY, GL_SHADER_STORAGE_BUFFER);
+        lodCounts_ = std::make_unique<BufferObject>(countsBytes, GLFormats::get(DataUInt32::id()),
+                                                    GL_DYNAMIC_COPY, GL_SHADER_STORAGE_BUFFER);
+    }
+    visibleInstances_->setSizeInBytes(visibleBytes);
+    const std::vector<GLuint> zeros(nLods, 0);
+    lodCounts_->upload(zeros.data(), countsBytes);
+
+    utilgl::Activate activate{&cullShader_};
+    utilgl::setUniforms(cullShader_, camera_);
+    utilgl::setShaderUniforms(cullShader_, mesh, "geometry");
+
+    TextureUnitContainer units;
+    for (auto& uniform : dynUniforms_) {
+        uniform.setAndBind(cullShader_, units);
+    }
+    GLuint binding = 1;
+    for (auto& port : vecPorts_) {
+        port.bindInstanceData(binding++);
+    }
+    visibleInstances_->bindBase(0);
+    lodCounts_->bindBase(binding);
+
+    cullShader_.setUniform("meshBox",
+                           glm::inverse(mesh.getCoordinateTransformer().getDataToWorldMatrix()) *
+                               util::boundingBox(mesh));
+    cullShader_.setUniform("numInstances", static_cast<GLuint>(nInstances));
+    cullShader_.setUniform("numLods", static_cast<GLuint>(nLods));
+    cullShader_.setUniform("lodDistance", nLods > 1 ? lodDistance_.get() : 0.0f);
+    cullShader_.setUniform("frustumCulling", frustumCulling_.get());
+
+    glDispatchCompute(static_cast<GLuint>((nInstances + 63) / 64), 1, 1);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+}
+
+void InstanceRenderer::renderInstanced(const Mesh& mesh, size_t nInstances) {
+    auto lods = lodMeshes_.getVectorData();
+    lods.insert(lods.begin(), inport_.getData());
+
+    const bool cull =
+        cullingAvailable_ && (frustumCulling_ || (lods.size() > 1 && lodDistance_ > 0.0f));
+    const auto nLods = cull ? lods.size() : size_t{1};
+    if (cull) {
+        cullInstances(mesh, nInstances, nLods);
+    }
+
+    utilgl::Activate activate{&instancedShader_};
+    utilgl::GlBoolState depthTest(GL_DEPTH_TEST, true);
+    utilgl::BlendModeState blendModeStateGL(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    utilgl::setUniforms(instancedShader_, camera_, lightingProperty_);
+
+    TextureUnitContainer units;
+    for (auto& uniform : dynUniforms_) {
+        uniform.setAndBind(instancedShader_, units);
+    }
+    GLuint binding = 1;
+    for (auto& port : vecPorts_) {
+        port.bindInstanceData(binding++);
+    }
+    instancedShader_.setUniform("useVisibleInstances", cull);
+
+    if (!cull) {
+        const auto& meshGL = *mesh.getRepresentation<MeshGL>();
+        utilgl::setShaderUniforms(instancedShader_, mesh, "geometry");
+        utilgl::Enable<MeshGL> enable{&meshGL};
+        const auto instances = static_cast<GLsizei>(nInstances);
+        forEachDraw(meshGL, [&](GLenum mode, const BufferGL* indexBuffer, GLsizei count) {
+            if (indexBuffer) {
+                indexBuffer->bind();
+                glDrawElementsInstanced(mode, count, indexBuffer->getFormatType(), nullptr,
+                                        instances);
+            } else {
+                glDrawArraysInstanced(mode, 0, count, instances);
+            }
+        });
+        return;
+    }
+
+    // One indirect draw per index buffer and level of detail. The instance counts are copied from
+    // the result of the culling pass without a round trip to the CPU.
+    std::vector<DrawCommand> commands;
+    std::vector<size_t> commandLods;
+    for (size_t lod = 0; lod < nLods; ++lod) {
+        forEachDraw(*lods[lod]->getRepresentation<MeshGL>(),
+                    [&](GLenum, const BufferGL*, GLsizei count) {
+                        commands.push_back({static_cast<GLuint>(count), 0, 0, 0, 0});
+                        commandLods.push_back(lod);
+                    });
+    }
+    if (commands.empty()) return;
+
+    const auto commandBytes = static_cast<GLsizeiptr>(commands.size() * sizeof(DrawCommand));
+    if (!drawCommands_) {
+        drawCommands_ =
+            std::make_unique<BufferObject>(commandBytes, GLFormats::get(DataUInt32::id()),
+                                           GL_DYNAMIC_DRAW, GL_DRAW_INDIRECT_BUFFER);
+    }
+    drawCommands_->upload(commands.data(), commandBytes);
+
+    glBindBuffer(GL_COPY_READ_BUFFER, lodCounts_->getId());
+    glBindBuffer(GL_COPY_WRITE_BUFFER, drawCommands_->getId());
+    for (size_t command = 0; command < commandLods.size(); ++command) {
+        const auto readOffset = commandLods[command] * sizeof(GLuint);
+        const auto writeOffset =
+            command * sizeof(DrawCommand) + offsetof(DrawCommand, instanceCount);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                            static_cast<GLintptr>(readOffset), static_cast<GLintptr>(writeOffset),
+                            sizeof(GLuint));
+    }
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    visibleInstances_->bindBase(0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, drawCommands_->getId());
+    size_t command = 0;
+    for (size_t lod = 0; lod < nLods; ++lod) {
+        const auto& meshGL = *lods[lod]->getRepresentation<MeshGL>();
+        utilgl::setShaderUniforms(instancedShader_, *lods[lod], "geometry");
+        instancedShader_.setUniform("visibleOffset", static_cast<GLuint>(lod * nInstances));
+        utilgl::Enable<MeshGL> enable{&meshGL};
+        forEachDraw(meshGL, [&](GLenum mode, const BufferGL* indexBuffer, GLsizei) {
+            const auto* offset = reinterpret_cast<const void*>(command++ * sizeof(DrawCommand));
+            if (indexBuffer) {
+                indexBuffer->bind();
+                glDrawElementsIndirect(mode, indexBuffer->getFormatType(), offset);
+            } else {
+                glDrawArraysIndirect(mode, offset);
+            }
+        });
+    }
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
 }  // namespace inviwo
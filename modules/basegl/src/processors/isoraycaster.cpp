@@ -29,29 +29,33 @@
 
 #include <modules/basegl/processors/isoraycaster.h>
 
-#include <inviwo/core/algorithm/boundingbox.h>                // for boundingBox
-#include <inviwo/core/datastructures/image/imagetypes.h>      // for ImageType, ImageType::Color...
-#include <inviwo/core/io/serialization/versionconverter.h>    // for renamePort
-#include <inviwo/core/ports/imageport.h>                      // for ImageInport, ImageOutport
-#include <inviwo/core/ports/volumeport.h>                     // for VolumeInport
-#include <inviwo/core/processors/processor.h>                 // for Processor
-#include <inviwo/core/processors/processorinfo.h>             // for ProcessorInfo
-#include <inviwo/core/processors/processorstate.h>            // for CodeState, CodeState::Stable
-#include <inviwo/core/processors/processortags.h>             // for Tags, Tags::GL
-#include <inviwo/core/properties/cameraproperty.h>            // for CameraProperty
-#include <inviwo/core/properties/invalidationlevel.h>         // for InvalidationLevel, Invalida...
-#include <inviwo/core/properties/optionproperty.h>            // for OptionPropertyInt, OptionPr...
-#include <inviwo/core/properties/ordinalproperty.h>           // for FloatVec4Property
-#include <inviwo/core/properties/propertysemantics.h>         // for PropertySemantics, Property...
-#include <inviwo/core/properties/simplelightingproperty.h>    // for SimpleLightingProperty
-#include <inviwo/core/properties/simpleraycastingproperty.h>  // for SimpleRaycastingProperty
-#include <inviwo/core/util/formats.h>                         // for DataFormatBase
-#include <inviwo/core/util/glmvec.h>                          // for vec4
-#include <modules/opengl/shader/shader.h>                     // for Shader, Shader::Build
-#include <modules/opengl/shader/shaderutils.h>                // for addShaderDefines, addShader...
-#include <modules/opengl/texture/textureunit.h>               // for TextureUnitContainer
-#include <modules/opengl/texture/textureutils.h>              // for bindAndSetUniforms, activat...
-#include <modules/opengl/volume/volumeutils.h>                // for bindAndSetUniforms
+#include <inviwo/core/algorithm/boundingbox.h>                        // for boundingBox
+#include <inviwo/core/datastructures/image/imagetypes.h>              // for ImageType, ImageType...
+#include <inviwo/core/datastructures/volume/volume.h>                 // for Volume
+#include <inviwo/core/io/serialization/versionconverter.h>            // for renamePort
+#include <inviwo/core/ports/imageport.h>                              // for ImageInport, ImageOu...
+#include <inviwo/core/ports/volumeport.h>                             // for VolumeInport
+#include <inviwo/core/processors/processor.h>                         // for Processor
+#include <inviwo/core/processors/processorinfo.h>                     // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>                    // for CodeState, CodeState...
+#include <inviwo/core/processors/processortags.h>                     // for Tags, Tags::GL
+#include <inviwo/core/properties/boolproperty.h>                      // for BoolProperty
+#include <inviwo/core/properties/cameraproperty.h>                    // for CameraProperty
+#include <inviwo/core/properties/invalidationlevel.h>                 // for InvalidationLevel, I...
+#include <inviwo/core/properties/optionproperty.h>                    // for OptionPropertyInt, O...
+#include <inviwo/core/properties/ordinalproperty.h>                   // for FloatVec4Property
+#include <inviwo/core/properties/propertysemantics.h>                 // for PropertySemantics, P...
+#include <inviwo/core/properties/simplelightingproperty.h>            // for SimpleLightingProperty
+#include <inviwo/core/properties/simpleraycastingproperty.h>          // for SimpleRaycastingProp...
+#include <inviwo/core/util/formats.h>                                 // for DataFormatBase
+#include <inviwo/core/util/glmvec.h>                                  // for vec4
+#include <modules/basegl/properties/progressiverefinementproperty.h>  // for ProgressiveRefineme...
+#include <modules/basegl/rendering/gradientvolumegl.h>                // for GradientVolumeGL
+#include <modules/opengl/shader/shader.h>                             // for Shader, Shader::Build
+#include <modules/opengl/shader/shaderutils.h>                        // for addShaderDefines, ad...
+#include <modules/opengl/texture/textureunit.h>                       // for TextureUnitContainer
+#include <modules/opengl/texture/textureutils.h>                      // for bindAndSetUniforms, ...
+#include <modules/opengl/volume/volumeutils.h>                        // for bindAndSetUniforms
 
 #include <cstddef>      // for size_t
 #include <functional>   // for __base
@@ -85,6 +89,13 @@ ISORaycaster::ISORaycaster()
     , surfaceColor_("surfaceColor", "Surface Color", vec4(1, 1, 1, 1))
     , channel_("channel", "Render Channel")
     , raycasting_("raycasting", "Raycasting")
+    , precomputedGradients_("precomputedGradients", "Precompute Gradients",
+                            "Compute the gradients of the rendered channel once, using central "
+                            "differences, and look them up during raycasting instead of "
+                            "recomputing them for every sample. Uses an additional 4 bytes per "
+                            "voxel of GPU memory."_help,
+                            false, InvalidationLevel::InvalidResources)
+    , refinement_("progressiveRefinement", "Progressive Refinement")
     , camera_("camera", "Camera", util::boundingBox(volumePort_))
     , lighting_("lighting", "Lighting", &camera_) {
     shader_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
@@ -115,12 +126,16 @@ ISORaycaster::ISORaycaster()
         }
     });
 
+    volumePort_.onChange([this]() { gradientVolume_.invalidate(); });
+
     backgroundPort_.onConnect([&]() { this->invalidate(InvalidationLevel::InvalidResources); });
     backgroundPort_.onDisconnect([&]() { this->invalidate(InvalidationLevel::InvalidResources); });
 
     addProperty(surfaceColor_);
     addProperty(channel_);
     addProperty(raycasting_);
+    addProperty(precomputedGradients_);
+    addProperty(refinement_);
     addProperty(camera_);
     addProperty(lighting_);
 
@@ -137,15 +152,25 @@ void ISORaycaster::initializeResources() {
     utilgl::addShaderDefines(shader_, camera_);
     utilgl::addShaderDefines(shader_, lighting_);
     utilgl::addShaderDefinesBGPort(shader_, backgroundPort_);
+    GradientVolumeGL::addShaderDefines(shader_, usePrecomputedGradients());
     shader_.build();
 }
 
 void ISORaycaster::process() {
-    utilgl::activateAndClearTarget(outport_);
+    const auto frame = refinement_.beginFrame(*this, outport_);
+    const bool precomputedGradients = usePrecomputedGradients();
+    if (precomputedGradients) {
+        gradientVolume_.update(*volumePort_.getData(), static_cast<size_t>(channel_.get()));
+    }
+
+    const ProgressiveRefinementProperty::Target target{outport_, frame};
     shader_.activate();
 
     TextureUnitContainer units;
     utilgl::bindAndSetUniforms(shader_, units, volumePort_);
+    if (precomputedGradients) {
+        gradientVolume_.bind(shader_, units);
+    }
     utilgl::bindAndSetUniforms(shader_, units, entryPort_, ImageType::ColorDepthPicking);
     utilgl::bindAndSetUniforms(shader_, units, exitPort_, ImageType::ColorDepth);
     if (backgroundPort_.hasData()) {
@@ -154,10 +179,17 @@ void ISORaycaster::process() {
 
     utilgl::setUniforms(shader_, outport_, camera_, lighting_, raycasting_, channel_,
                         surfaceColor_);
+    refinement_.setUniforms(shader_, frame);
 
     utilgl::singleDrawImagePlaneRect();
     shader_.deactivate();
-    utilgl::deactivateCurrentTarget();
+    refinement_.endFrame(*this, frame);
+}
+
+bool ISORaycaster::usePrecomputedGradients() const {
+    const auto& mode = raycasting_.gradientComputationMode_.get();
+    return precomputedGradients_ && mode != "none" && mode != "precomputedXYZ" &&
+           mode != "precomputedYZW";
 }
 
 void ISORaycaster::deserialize(Deserializer& d) {
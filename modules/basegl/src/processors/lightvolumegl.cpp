@@ -29,6 +29,8 @@
 
 #include <modules/basegl/processors/lightvolumegl.h>
 
+#include <inviwo/core/algorithm/markdown.h>                             // for operator""_help
+#include <inviwo/core/common/inviwoapplication.h>                       // for dispatchFront
 #include <inviwo/core/datastructures/coordinatetransformer.h>           // for StructuredCoordin...
 #include <inviwo/core/datastructures/image/layer.h>                     // for Layer
 #include <inviwo/core/datastructures/light/baselightsource.h>           // for LightSourceType
@@ -48,6 +50,7 @@
 #include <inviwo/core/properties/boolproperty.h>                        // for BoolProperty
 #include <inviwo/core/properties/invalidationlevel.h>                   // for InvalidationLevel
 #include <inviwo/core/properties/optionproperty.h>                      // for OptionPropertyInt
+#include <inviwo/core/properties/ordinalproperty.h>                     // for IntProperty
 #include <inviwo/core/properties/transferfunctionproperty.h>            // for TransferFunctionP...
 #include <inviwo/core/util/formats.h>                                   // for DataFormatBase
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, vec4
@@ -65,6 +68,8 @@
 #include <modules/opengl/volume/volumegl.h>                             // for VolumeGL
 #include <modules/opengl/volume/volumeutils.h>                          // for setShaderUniforms
 
+#include <algorithm>      // for min
+#include <array>          // for array
 #include <cmath>          // for acos, M_PI
 #include <cstddef>        // for size_t
 #include <functional>     // for __base
@@ -146,6 +151,11 @@ LightVolumeGL::LightVolumeGL()
     , volumeSizeOption_("volumeSizeOption", "Light Volume Size")
     , transferFunction_("transferFunction", "Transfer function", &inport_)
     , floatPrecision_("floatPrecision", "Float Precision", false)
+    , slicesPerFrame_("slicesPerFrame", "Slices per Frame",
+                      "Number of slices to propagate per evaluation, 0 propagates all slices at "
+                      "once. Smaller values spread the propagation over several frames, the "
+                      "output is updated once all slices have been propagated"_help,
+                      0, {0, ConstraintBehavior::Immutable}, {256, ConstraintBehavior::Ignore})
     , propagationShader_("lighting/lightpropagation.vert", "lighting/lightpropagation.geom",
                          "lighting/lightpropagation.frag")
     , mergeShader_("lighting/lightvolumeblend.vert", "lighting/lightvolumeblend.geom",
@@ -168,6 +178,7 @@ LightVolumeGL::LightVolumeGL()
     volumeSizeOption_.addOption("1", "Full of incoming volume", 1);
     volumeSizeOption_.addOption("1/2", "Half of incoming volume", 2);
     volumeSizeOption_.addOption("1/4", "Quarter of incoming volume", 4);
+    volumeSizeOption_.addOption("1/8", "Eighth of incoming volume", 8);
     volumeSizeOption_.setSelectedIndex(1);
     volumeSizeOption_.setCurrentStateAsDefault();
     volumeSizeOption_.onChange([this]() { volumeSizeOptionChanged(); });
@@ -175,18 +186,33 @@ LightVolumeGL::LightVolumeGL()
     addProperty(transferFunction_);
     floatPrecision_.onChange([this]() { floatPrecisionChanged(); });
     addProperty(floatPrecision_);
+    addProperty(slicesPerFrame_);
 
-    propagationShader_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
-    mergeShader_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
+    propagationShader_.onReload([this]() {
+        propagationInvalid_ = true;
+        invalidate(InvalidationLevel::InvalidResources);
+    });
+    mergeShader_.onReload([this]() {
+        propagationInvalid_ = true;
+        invalidate(InvalidationLevel::InvalidResources);
+    });
 
     supportColoredLightChanged();
 }
 
 void LightVolumeGL::process() {
+    bool lightChanged = false;
     bool lightColorChanged = false;
+    const std::array<mat4, 2> permutation{propParams_[0].axisPermutation,
+                                          propParams_[1].axisPermutation};
 
     if (lightSource_.isChanged()) {
+        const auto lightDir = lightDir_;
+        const auto lightPos = lightPos_;
+        const auto lightType = lightType_;
         lightColorChanged = lightSourceChanged();
+        lightChanged = lightColorChanged || lightDir != lightDir_ || lightPos != lightPos_ ||
+                       lightType != lightType_;
     }
 
     bool reattach = false;
@@ -194,6 +220,29 @@ void LightVolumeGL::process() {
     if (internalVolumesInvalid_ || lightColorChanged || inport_.isChanged()) {
         reattach = volumeChanged(lightColorChanged);
     }
+    if (inport_.isChanged()) {
+        volume_->setModelMatrix(inport_.getData()->getModelMatrix());
+        volume_->setWorldMatrix(inport_.getData()->getWorldMatrix());
+    }
+    reattachMerge_ = reattachMerge_ || reattach;
+
+    if (reattach || lightChanged || inport_.isChanged() || transferFunction_.isModified()) {
+        propagationInvalid_ = true;
+    }
+
+    if (nextSlice_ == 0) {
+        // Nothing affecting the illumination has changed, i.e. a camera or head light update
+        // that did not move the light relative to the volume
+        if (!propagationInvalid_) return;
+        propagationInvalid_ = false;
+    } else if (reattach || permutation[0] != propParams_[0].axisPermutation ||
+               permutation[1] != propParams_[1].axisPermutation) {
+        // The propagation in progress can not be continued, start over
+        nextSlice_ = 0;
+        propagationInvalid_ = false;
+    }
+    // Otherwise we continue the propagation in progress, and any further change will be handled
+    // by another propagation once it is done
 
     auto* outVolumeGL = volume_->getEditableRepresentation<VolumeGL>();
     const TextureUnit volUnit;
@@ -222,6 +271,11 @@ void LightVolumeGL::process() {
         const utilgl::Enable<MeshGL> enable(rect);
         const utilgl::DepthFuncState depth(GL_ALWAYS);
 
+        const size_t sliceEnd =
+            slicesPerFrame_ > 0
+                ? std::min(volumeDimOut_.z, nextSlice_ + static_cast<size_t>(slicesPerFrame_))
+                : volumeDimOut_.z;
+
         // Perform propagation passes
         for (int i = 0; i < 2; ++i) {
             propParams_[i].fbo.activate();
@@ -244,9 +298,10 @@ void LightVolumeGL::process() {
                                               propParams_[i].permutedLightDirection);
             }
 
-            for (unsigned int z = 0; z < volumeDimOut_.z; ++z) {
+            for (size_t z = nextSlice_; z < sliceEnd; ++z) {
                 glFramebufferTexture3DEXT(GL_FRAMEBUFFER_EXT, GL_COLOR_ATTACHMENT0_EXT,
-                                          GL_TEXTURE_3D, propParams_[i].tex.getID(), 0, z);
+                                          GL_TEXTURE_3D, propParams_[i].tex.getID(), 0,
+                                          static_cast<GLint>(z));
                 propagationShader_.setUniform("sliceNum_", static_cast<GLint>(z));
                 glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
                 glFlush();
@@ -254,9 +309,21 @@ void LightVolumeGL::process() {
 
             propParams_[i].fbo.deactivate();
         }
+        nextSlice_ = sliceEnd < volumeDimOut_.z ? sliceEnd : 0;
     }
 
     propagationShader_.deactivate();
+
+    if (nextSlice_ != 0 || propagationInvalid_) {
+        // Continue with the remaining slices, or the next propagation, in the next frame
+        dispatchFront([weakSelf = weak_from_this()]() {
+            if (auto self = weakSelf.lock()) {
+                self->invalidate(InvalidationLevel::InvalidOutput);
+            }
+        });
+        if (nextSlice_ != 0) return;
+    }
+
     mergeShader_.activate();
     mergeShader_.setUniform("lightVolume_", lightVolUnit[0].getUnitNumber());
     mergeShader_.setUniform("lightVolumeSec_", lightVolUnit[1].getUnitNumber());
@@ -269,7 +336,8 @@ void LightVolumeGL::process() {
     mergeFBO_.activate();
     glViewport(0, 0, static_cast<GLsizei>(volumeDimOut_.x), static_cast<GLsizei>(volumeDimOut_.y));
 
-    if (reattach) mergeFBO_.attachColorTexture(outVolumeGL->getTexture().get(), 0);
+    if (reattachMerge_) mergeFBO_.attachColorTexture(outVolumeGL->getTexture().get(), 0);
+    reattachMerge_ = false;
 
     utilgl::multiDrawImagePlaneRect(static_cast<int>(volumeDimOut_.z));
     mergeShader_.deactivate();
@@ -413,6 +481,7 @@ void LightVolumeGL::volumeSizeOptionChanged() {
 }
 
 void LightVolumeGL::supportColoredLightChanged() {
+    propagationInvalid_ = true;
     propagationShader_.getFragmentShaderObject()->setShaderDefine("SUPPORT_LIGHT_COLOR",
                                                                   supportColoredLight_);
 
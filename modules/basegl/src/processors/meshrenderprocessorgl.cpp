@@ -52,6 +52,7 @@
 #include <modules/opengl/geometry/meshgl.h>            // for MeshGL
 #include <modules/opengl/inviwoopengl.h>               // for GL_BACK, GL_DEPTH_TEST, GL_FRONT
 #include <modules/opengl/openglutils.h>                // for BlendModeState, CullFaceState, GlB...
+#include <modules/opengl/rendering/meshbatchgl.h>      // for MeshBatchGL
 #include <modules/opengl/rendering/meshdrawergl.h>     // for MeshDrawerGL::DrawObject, MeshDraw...
 #include <modules/opengl/shader/shader.h>              // for Shader, Shader::Build
 #include <modules/opengl/shader/shaderobject.h>        // for ShaderObject
@@ -84,7 +85,15 @@ MeshRenderProcessorGL::MeshRenderProcessorGL()
     , imageInport_("imageInport", "Background image (optional)"_help)
     , outport_("image",
                "Output image containing the rendered mesh and the optional input image"_help)
+    , rightOutport_("rightImage", "Output image for the right eye, only used in stereo mode"_help)
     , camera_("camera", "Camera", util::boundingBox(inport_))
+    , stereo_("stereo", "Stereo",
+              "Also render the meshes using the right camera into the right image outport. Both "
+              "eyes are rendered in the same evaluation, sharing the upstream work, the mesh "
+              "uploads and the batches, instead of evaluating two copies of the network. Use "
+              "a Stereo Camera Syncer to link the cameras."_help,
+              false, InvalidationLevel::InvalidResources)
+    , rightCamera_("rightCamera", "Right Camera", util::boundingBox(inport_))
     , meshProperties_("geometry", "Geometry Rendering Properties")
     , cullFace_("cullFace", "Cull Face",
                 {{"culldisable", "Disable", GL_NONE},
@@ -97,6 +106,12 @@ MeshRenderProcessorGL::MeshRenderProcessorGL()
     , overrideColorBuffer_("overrideColorBuffer", "Override Color Buffer", false,
                            InvalidationLevel::InvalidResources)
     , overrideColor_("overrideColor", "Override Color", util::ordinalColor(0.75f, 0.75f, 0.75f))
+    , batchMeshes_("batchMeshes", "Batch Meshes",
+                   "Draw meshes sharing the same vertex layout with a single multi draw call, "
+                   "which reduces the CPU overhead for many small meshes. Requires OpenGL 4.3 "
+                   "and means copying the meshes into shared buffers whenever the input "
+                   "changes."_help,
+                   true, InvalidationLevel::InvalidResources)
     , lightingProperty_("lighting", "Lighting", &camera_)
     , trackball_(&camera_)
     , layers_("layers", "Output Layers")
@@ -111,16 +126,21 @@ MeshRenderProcessorGL::MeshRenderProcessorGL()
     , viewNormalsLayer_("viewNormalsLayer", "Normals (View space)",
                         "Toggle output of view space normals"_help, false,
                         InvalidationLevel::InvalidResources)
-    , shader_("meshrendering.vert", "meshrendering.frag", Shader::Build::No) {
+    , shader_("meshrendering.vert", "meshrendering.frag", Shader::Build::No)
+    , batch_{}
+    , batchValid_{false} {
 
     addPort(inport_);
     addPort(imageInport_).setOptional(true);
     addPort(outport_);
+    addPort(rightOutport_);
 
-    addProperties(camera_, meshProperties_, lightingProperty_, trackball_, layers_);
+    addProperties(camera_, stereo_, rightCamera_, meshProperties_, lightingProperty_, trackball_,
+                  layers_);
+    rightCamera_.visibilityDependsOn(stereo_, [](const BoolProperty& p) { return p.get(); });
 
     meshProperties_.addProperties(cullFace_, enableDepthTest_, overrideColorBuffer_,
-                                  overrideColor_);
+                                  overrideColor_, batchMeshes_);
 
     overrideColor_.setSemantics(PropertySemantics::Color)
         .visibilityDependsOn(overrideColorBuffer_, [](const BoolProperty p) { return p.get(); });
@@ -139,6 +159,8 @@ void MeshRenderProcessorGL::initializeResources() {
     auto frag = shader_.getFragmentShaderObject();
 
     vert->setShaderDefine("OVERRIDE_COLOR_BUFFER", overrideColorBuffer_);
+    vert->setShaderDefine("MESH_BATCHING", batchMeshes_ && MeshBatchGL::isSupported());
+    batchValid_ = false;
     frag->setShaderDefine("COLOR_LAYER", colorLayer_);
 
     // first two layers (color and picking) are reserved
@@ -152,37 +174,69 @@ void MeshRenderProcessorGL::initializeResources() {
     frag->setShaderDefine("VIEW_NORMALS_LAYER", viewNormalsLayer_);
     if (viewNormalsLayer_) frag->addOutDeclaration("view_normals_out", layerID++);
 
-    // get a hold of the current output data
-    auto prevData = outport_.getData();
-    auto numLayers = static_cast<std::size_t>(layerID - 1);  // Don't count picking
-    if (prevData->getNumberOfColorLayers() != numLayers) {
-        // create new image with matching number of layers
-        auto image = std::make_shared<Image>(prevData->getDimensions(), prevData->getDataFormat());
-        // update number of layers
-        for (auto i = image->getNumberOfColorLayers(); i < numLayers; ++i) {
-            image->addColorLayer(std::shared_ptr<Layer>(image->getColorLayer(0)->clone()));
+    const auto numLayers = static_cast<std::size_t>(layerID - 1);  // Don't count picking
+    const auto updateLayers = [&](ImageOutport& outport) {
+        // get a hold of the current output data
+        auto prevData = outport.getData();
+        if (prevData->getNumberOfColorLayers() != numLayers) {
+            // create new image with matching number of layers
+            auto image =
+                std::make_shared<Image>(prevData->getDimensions(), prevData->getDataFormat());
+            // update number of layers
+            for (auto i = image->getNumberOfColorLayers(); i < numLayers; ++i) {
+                image->addColorLayer(std::shared_ptr<Layer>(image->getColorLayer(0)->clone()));
+            }
+            outport.setData(image);
         }
-        outport_.setData(image);
-    }
+    };
+    updateLayers(outport_);
+    if (stereo_) updateLayers(rightOutport_);
 
     shader_.build();
 }
 
 void MeshRenderProcessorGL::process() {
-    utilgl::activateTargetAndClearOrCopySource(outport_, imageInport_);
+    if (batchMeshes_ && MeshBatchGL::isSupported() && (!batchValid_ || inport_.isChanged())) {
+        batch_.build(inport_.getVectorData());
+        batchValid_ = true;
+    }
+
+    render(outport_, camera_);
+    if (stereo_) render(rightOutport_, rightCamera_);
+}
+
+void MeshRenderProcessorGL::render(ImageOutport& outport, const CameraProperty& camera) {
+    utilgl::activateTargetAndClearOrCopySource(outport, imageInport_);
     shader_.activate();
 
     utilgl::GlBoolState depthTest(GL_DEPTH_TEST, enableDepthTest_);
     utilgl::CullFaceState culling(cullFace_);
     utilgl::BlendModeState blendModeStateGL(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-    utilgl::setUniforms(shader_, camera_, lightingProperty_, overrideColor_);
-    for (auto mesh : inport_) {
-        utilgl::setShaderUniforms(shader_, *mesh, "geometry");
-        shader_.setUniform("pickingEnabled", meshutil::hasPickIDBuffer(mesh.get()));
-        MeshDrawerGL::DrawObject drawer{mesh->getRepresentation<MeshGL>(),
-                                        mesh->getDefaultMeshInfo()};
+    utilgl::setUniforms(shader_, lightingProperty_, overrideColor_);
+    utilgl::setShaderUniforms(shader_, camera, "camera");
+
+    const auto draw = [&](const Mesh& mesh) {
+        utilgl::setShaderUniforms(shader_, mesh, "geometry");
+        shader_.setUniform("pickingEnabled", meshutil::hasPickIDBuffer(&mesh));
+        MeshDrawerGL::DrawObject drawer{mesh.getRepresentation<MeshGL>(),
+                                        mesh.getDefaultMeshInfo()};
         drawer.draw();
+    };
+
+    if (batchMeshes_ && MeshBatchGL::isSupported()) {
+        shader_.setUniform("batched", true);
+        batch_.draw([&](const Mesh& mesh) {
+            shader_.setUniform("pickingEnabled", meshutil::hasPickIDBuffer(&mesh));
+        });
+        shader_.setUniform("batched", false);
+        for (const auto& mesh : batch_.getUnbatched()) {
+            draw(*mesh);
+        }
+    } else {
+        for (auto mesh : inport_) {
+            draw(*mesh);
+        }
     }
 
     shader_.deactivate();
@@ -29,35 +29,40 @@
 
 #include <modules/basegl/processors/multichannelraycaster.h>
 
-#include <inviwo/core/algorithm/boundingbox.h>                // for boundingBox
-#include <inviwo/core/datastructures/histogram.h>             // for HistogramSelection
-#include <inviwo/core/datastructures/image/imagetypes.h>      // for ImageType, ImageType::Color...
-#include <inviwo/core/io/serialization/deserializer.h>        // for Deserializer
-#include <inviwo/core/io/serialization/ticpp.h>               // for TxElement
-#include <inviwo/core/io/serialization/versionconverter.h>    // for getElement, renamePort, Nod...
-#include <inviwo/core/ports/imageport.h>                      // for ImageInport, ImageOutport
-#include <inviwo/core/ports/volumeport.h>                     // for VolumeInport
-#include <inviwo/core/processors/processor.h>                 // for Processor
-#include <inviwo/core/processors/processorinfo.h>             // for ProcessorInfo
-#include <inviwo/core/processors/processorstate.h>            // for CodeState, CodeState::Exper...
-#include <inviwo/core/processors/processortags.h>             // for Tags, Tags::GL
-#include <inviwo/core/properties/compositeproperty.h>         // for CompositeProperty
-#include <inviwo/core/properties/invalidationlevel.h>         // for InvalidationLevel, Invalida...
-#include <inviwo/core/properties/transferfunctionproperty.h>  // for TransferFunctionProperty
-#include <inviwo/core/util/formats.h>                         // for DataFormatBase
-#include <inviwo/core/util/stringconversion.h>                // for StrBuffer
-#include <inviwo/core/util/zip.h>                             // for enumerate, zipIterator, zipper
-#include <modules/opengl/shader/shader.h>                     // for Shader, Shader::Build
-#include <modules/opengl/shader/shaderobject.h>               // for ShaderObject
-#include <modules/opengl/shader/shaderutils.h>                // for addShaderDefines, addShader...
-#include <modules/opengl/texture/textureunit.h>               // for TextureUnitContainer
-#include <modules/opengl/texture/textureutils.h>              // for bindAndSetUniforms, activat...
-#include <modules/opengl/volume/volumeutils.h>                // for bindAndSetUniforms
+#include <inviwo/core/algorithm/boundingbox.h>                        // for boundingBox
+#include <inviwo/core/datastructures/histogram.h>                     // for HistogramSelection
+#include <inviwo/core/datastructures/tfprimitive.h>                   // for TFPrimitive
+#include <inviwo/core/datastructures/image/imagetypes.h>              // for ImageType, ImageType...
+#include <inviwo/core/io/serialization/deserializer.h>                // for Deserializer
+#include <inviwo/core/io/serialization/ticpp.h>                       // for TxElement
+#include <inviwo/core/io/serialization/versionconverter.h>            // for getElement, renamePo...
+#include <inviwo/core/ports/imageport.h>                              // for ImageInport, ImageOu...
+#include <inviwo/core/ports/volumeport.h>                             // for VolumeInport
+#include <inviwo/core/processors/processor.h>                         // for Processor
+#include <inviwo/core/processors/processorinfo.h>                     // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>                    // for CodeState, CodeState...
+#include <inviwo/core/processors/processortags.h>                     // for Tags, Tags::GL
+#include <inviwo/core/properties/compositeproperty.h>                 // for CompositeProperty
+#include <inviwo/core/properties/invalidationlevel.h>                 // for InvalidationLevel, I...
+#include <inviwo/core/properties/transferfunctionproperty.h>          // for TransferFunctionProp...
+#include <inviwo/core/util/formats.h>                                 // for DataFormatBase
+#include <inviwo/core/util/stringconversion.h>                        // for StrBuffer
+#include <inviwo/core/util/zip.h>                                     // for enumerate, zipIterat...
+#include <modules/basegl/properties/progressiverefinementproperty.h>  // for ProgressiveRefineme...
+#include <modules/basegl/rendering/emptyspaceskippinggl.h>            // for EmptySpaceSkippingGL
+#include <modules/opengl/shader/shader.h>                             // for Shader, Shader::Build
+#include <modules/opengl/shader/shaderobject.h>                       // for ShaderObject
+#include <modules/opengl/shader/shaderutils.h>                        // for addShaderDefines, ad...
+#include <modules/opengl/texture/textureunit.h>                       // for TextureUnitContainer
+#include <modules/opengl/texture/textureutils.h>                      // for bindAndSetUniforms, ...
+#include <modules/opengl/volume/volumeutils.h>                        // for bindAndSetUniforms
 
+#include <algorithm>    // for any_of
 #include <bitset>       // for bitset<>::reference
 #include <cstddef>      // for size_t
 #include <functional>   // for __base, function
 #include <memory>       // for shared_ptr
+#include <span>         // for span
 #include <string>       // for string
 #include <string_view>  // for string_view
 #include <type_traits>  // for remove_extent_t
@@ -90,9 +95,24 @@ MultichannelRaycaster::MultichannelRaycaster()
             {"transferFunction3", "Channel 3", &volumePort_},
             {"transferFunction4", "Channel 4", &volumePort_}}}
     , raycasting_("raycaster", "Raycasting")
+    , earlyRayTermination_("earlyRayTermination", "Early Ray Termination",
+                           "Stop the ray traversal once the accumulated opacity exceeds this "
+                           "threshold. Lower values are faster but cut off more of the "
+                           "volume."_help,
+                           0.99f, {0.5f, ConstraintBehavior::Immutable},
+                           {1.0f, ConstraintBehavior::Immutable}, 0.001f)
+    , emptySpaceSkipping_("emptySpaceSkipping", "Empty Space Skipping",
+                          "Skip the regions of the volume that are fully transparent under all "
+                          "transfer functions, and the classification and shading of channels "
+                          "that are transparent in the current region. Only used with transfer "
+                          "function classification and requires compute shaders."_help,
+                          true, InvalidationLevel::InvalidResources)
+    , refinement_("progressiveRefinement", "Progressive Refinement")
     , camera_("camera", "Camera", util::boundingBox(volumePort_))
     , lighting_("lighting", "Lighting", &camera_)
-    , positionIndicator_("positionindicator", "Position Indicator") {
+    , positionIndicator_("positionindicator", "Position Indicator")
+    , emptySpace_{}
+    , visibleChannels_{} {
 
     transferFunctions_.addProperties(tfs_[0], tfs_[1], tfs_[2], tfs_[3]);
     for (auto&& [i, tf] : util::enumerate(tfs_)) {
@@ -112,9 +132,21 @@ MultichannelRaycaster::MultichannelRaycaster()
 
     backgroundPort_.setOptional(true);
 
-    addProperties(raycasting_, camera_, lighting_, positionIndicator_, transferFunctions_);
+    addProperties(raycasting_, earlyRayTermination_, emptySpaceSkipping_, refinement_, camera_,
+                  lighting_, positionIndicator_, transferFunctions_);
 
-    volumePort_.onChange([this]() { initializeResources(); });
+    volumePort_.onChange([this]() {
+        emptySpace_.invalidateGrid();
+        initializeResources();
+    });
+    for (auto& tf : tfs_) {
+        tf.onChange([this]() {
+            emptySpace_.invalidateOccupancy();
+            if (visibleChannels() != visibleChannels_) {
+                invalidate(InvalidationLevel::InvalidResources);
+            }
+        });
+    }
 
     backgroundPort_.onConnect([&]() { this->invalidate(InvalidationLevel::InvalidResources); });
     backgroundPort_.onDisconnect([&]() { this->invalidate(InvalidationLevel::InvalidResources); });
@@ -135,40 +167,84 @@ void MultichannelRaycaster::initializeResources() {
 
         shader_.getFragmentShaderObject()->addShaderDefine("NUMBER_OF_CHANNELS",
                                                            fmt::format("{}", channels));
+        // Channels with a fully transparent transfer function are never classified, and with
+        // empty space skipping neither are the channels that are transparent in the current cell
+        const bool emptySpaceSkipping = useEmptySpaceSkipping();
+        visibleChannels_ = visibleChannels();
         StrBuffer str;
         for (size_t i = 0; i < channels; ++i) {
-            str.append(
-                "color[{0}] = APPLY_CHANNEL_CLASSIFICATION(transferFunction{1}, voxel, {0});", i,
-                i + 1);
+            if (!visibleChannels_[i]) {
+                str.append("color[{0}] = vec4(0.0);", i);
+            } else if (emptySpaceSkipping) {
+                str.append(
+                    "color[{0}] = channelOccupancy[{0}] > 0.0 ? "
+                    "APPLY_CHANNEL_CLASSIFICATION(transferFunction{1}, voxel, {0}) : vec4(0.0);",
+                    i, i + 1);
+            } else {
+                str.append(
+                    "color[{0}] = APPLY_CHANNEL_CLASSIFICATION(transferFunction{1}, voxel, {0});",
+                    i, i + 1);
+            }
         }
-        shader_.getFragmentShaderObject()->addShaderDefine("SAMPLE_CHANNELS", str.view());
+        auto* fso = shader_.getFragmentShaderObject();
+        fso->addShaderDefine("SAMPLE_CHANNELS", str.view());
+        fso->setShaderDefine("EMPTY_SPACE_SKIPPING", emptySpaceSkipping);
+        // Transparent samples only contribute to the rendering for isosurface compositing
+        const auto& compositing = raycasting_.compositingMode_.get();
+        fso->setShaderDefine("SKIP_TRANSPARENT_CHANNELS",
+                             compositing != "iso" && compositing != "ison");
 
         shader_.build();
     }
 }
 
 void MultichannelRaycaster::process() {
-    utilgl::activateAndClearTarget(outport_);
+    const auto frame = refinement_.beginFrame(*this, outport_);
+    const size_t channels = volumePort_.getData()->getDataFormat()->getComponents();
+    const bool emptySpaceSkipping = useEmptySpaceSkipping();
+    if (emptySpaceSkipping) {
+        emptySpace_.update(*volumePort_.getData(), std::span{tfs_.data(), channels});
+    }
+
+    const ProgressiveRefinementProperty::Target target{outport_, frame};
     shader_.activate();
 
     TextureUnitContainer units;
     utilgl::bindAndSetUniforms(shader_, units, volumePort_);
+    if (emptySpaceSkipping) {
+        emptySpace_.bind(shader_, units, "occupancy");
+    }
     utilgl::bindAndSetUniforms(shader_, units, entryPort_, ImageType::ColorDepthPicking);
     utilgl::bindAndSetUniforms(shader_, units, exitPort_, ImageType::ColorDepth);
     if (backgroundPort_.hasData()) {
         utilgl::bindAndSetUniforms(shader_, units, backgroundPort_, ImageType::ColorDepthPicking);
     }
 
-    size_t channels = volumePort_.getData()->getDataFormat()->getComponents();
     for (size_t channel = 0; channel < channels; channel++) {
         utilgl::bindAndSetUniforms(shader_, units, tfs_[channel]);
     }
     utilgl::setUniforms(shader_, outport_, camera_, lighting_, raycasting_, positionIndicator_);
+    shader_.setUniform("ertThreshold", earlyRayTermination_.get());
+    refinement_.setUniforms(shader_, frame);
 
     utilgl::singleDrawImagePlaneRect();
 
     shader_.deactivate();
-    utilgl::deactivateCurrentTarget();
+    refinement_.endFrame(*this, frame);
+}
+
+bool MultichannelRaycaster::useEmptySpaceSkipping() const {
+    return emptySpaceSkipping_ && EmptySpaceSkippingGL::isSupportedByGPU() &&
+           raycasting_.classificationMode_.get() == "transfer-function";
+}
+
+std::bitset<4> MultichannelRaycaster::visibleChannels() const {
+    std::bitset<4> visible;
+    for (auto&& [i, tf] : util::enumerate(tfs_)) {
+        visible[i] = std::any_of(tf.get().begin(), tf.get().end(),
+                                 [](const TFPrimitive& p) { return p.getAlpha() > 0.0f; });
+    }
+    return visible;
 }
 
 void MultichannelRaycaster::deserialize(Deserializer& d) {
@@ -41,6 +41,7 @@
 #include <inviwo/core/properties/invalidationlevel.h>  // for InvalidationLevel, InvalidationLev...
 #include <inviwo/core/properties/ordinalproperty.h>    // for FloatProperty
 #include <inviwo/core/properties/propertysemantics.h>  // for PropertySemantics, PropertySemanti...
+#include <inviwo/core/util/glmmat.h>                   // for mat4
 #include <inviwo/core/util/glmvec.h>                   // for vec4
 #include <modules/opengl/geometry/meshgl.h>            // for MeshGL
 #include <modules/opengl/inviwoopengl.h>               // for GL_ONE_MINUS_SRC_ALPHA, GL_POINT
@@ -114,6 +115,7 @@ PointRenderer::PointRenderer()
     , labels_{}
     , periodic_{}
     , texture_{"pointTexture", "Texture to apply to points"_help}
+    , lod_{}
     , camera_{"camera", "Camera", util::boundingBox(inport_)}
     , trackball_{&camera_}
 
@@ -149,9 +151,9 @@ PointRenderer::PointRenderer()
     config_.radius.set(8);
     config_.radius.setCurrentStateAsDefault();
 
-    addProperties(renderMode_, depthTest_, config_.config, labels_.labels, texture_.texture,
-                  bnl_.highlight, bnl_.select, bnl_.filter, periodic_.periodicity, camera_,
-                  trackball_);
+    addProperties(renderMode_, depthTest_, lod_.lod, config_.config, labels_.labels,
+                  texture_.texture, bnl_.highlight, bnl_.select, bnl_.filter,
+                  periodic_.periodicity, camera_, trackball_);
 }
 
 void PointRenderer::initializeResources() {
@@ -180,7 +182,14 @@ void PointRenderer::process() {
     const utilgl::GlBoolState pointSprite(GL_PROGRAM_POINT_SIZE, true);
     const utilgl::GlBoolState depthTest(GL_DEPTH_TEST, depthTest_);
 
-    for (const auto& mesh : inport_) {
+    // Level of detail relies on drawing the vertices of the mesh once each
+    const bool useLOD =
+        renderMode_.get() == RenderMode::EntireMesh && !periodic_.periodicity.isChecked();
+    const mat4 worldToClip = camera_.projectionMatrix() * camera_.viewMatrix();
+
+    const auto meshes = inport_.getVectorData();
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        const auto& mesh = meshes[i];
         auto& shader = shaders_.getShader(*mesh);
         shader.activate();
 
@@ -190,6 +199,11 @@ void PointRenderer::process() {
                                            2.0f / outport_.getDimensions().y));
         utilgl::setShaderUniforms(shader, *mesh, "geometry");
 
+        if (useLOD && lod_.draw(i, mesh, worldToClip, outport_.getDimensions())) {
+            shader.deactivate();
+            continue;
+        }
+
         MeshDrawerGL::DrawObject drawer(*mesh);
         switch (renderMode_.get()) {
             case RenderMode::PointsOnly: {
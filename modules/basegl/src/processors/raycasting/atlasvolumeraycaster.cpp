@@ -29,22 +29,23 @@
 
 #include <modules/basegl/processors/raycasting/atlasvolumeraycaster.h>
 
-#include <inviwo/core/algorithm/boundingbox.h>                          // for boundingBox
-#include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
-#include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
-#include <inviwo/core/ports/volumeport.h>                               // for VolumeInport
-#include <inviwo/core/processors/processorinfo.h>                       // for ProcessorInfo
-#include <inviwo/core/processors/processorstate.h>                      // for CodeState, CodeSt...
-#include <inviwo/core/processors/processortags.h>                       // for Tag, Tags, Tags::GL
-#include <inviwo/core/properties/invalidationlevel.h>                   // for InvalidationLevel
-#include <inviwo/core/properties/isotfproperty.h>                       // for IsoTFProperty
-#include <inviwo/core/util/formats.h>                                   // for DataFormatBase
-#include <inviwo/core/util/zip.h>                                       // for zipper
-#include <modules/basegl/processors/raycasting/volumeraycasterbase.h>   // for VolumeRaycasterBase
-#include <modules/basegl/shadercomponents/cameracomponent.h>            // for CameraComponent
-#include <modules/basegl/shadercomponents/isotfcomponent.h>             // for IsoTFComponent
-#include <modules/basegl/shadercomponents/raycastingcomponent.h>        // for RaycastingComponent
-#include <modules/basegl/shadercomponents/volumecomponent.h>            // for VolumeComponent
+#include <inviwo/core/algorithm/boundingbox.h>                               // for boundingBox
+#include <inviwo/core/datastructures/representationconverter.h>              // for Representatio...
+#include <inviwo/core/datastructures/representationconverterfactory.h>       // for Representatio...
+#include <inviwo/core/ports/volumeport.h>                                    // for VolumeInport
+#include <inviwo/core/processors/processorinfo.h>                            // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>                           // for CodeState, Co...
+#include <inviwo/core/processors/processortags.h>                            // for Tag, Tags, Ta...
+#include <inviwo/core/properties/invalidationlevel.h>                        // for InvalidationL...
+#include <inviwo/core/properties/isotfproperty.h>                            // for IsoTFProperty
+#include <inviwo/core/util/formats.h>                                        // for DataFormatBase
+#include <inviwo/core/util/zip.h>                                            // for zipper
+#include <modules/basegl/processors/raycasting/volumeraycasterbase.h>        // for VolumeRaycast...
+#include <modules/basegl/shadercomponents/cameracomponent.h>                 // for CameraComponent
+#include <modules/basegl/shadercomponents/isotfcomponent.h>                  // for IsoTFComponent
+#include <modules/basegl/shadercomponents/progressiverefinementcomponent.h>  // for ProgressiveRe...
+#include <modules/basegl/shadercomponents/raycastingcomponent.h>             // for RaycastingCom...
+#include <modules/basegl/shadercomponents/volumecomponent.h>                 // for VolumeComponent
 
 #include <array>        // for array
 #include <functional>   // for __base, function
@@ -88,7 +89,8 @@ AtlasVolumeRaycaster::AtlasVolumeRaycaster(std::string_view identifier,
     , light_{&camera_.camera}
     , positionIndicator_{}
     , sampleTransform_{}
-    , atlas_{this, "color", &time_} {
+    , atlas_{this, "color", &time_}
+    , refinement_{} {
 
     volume_.volumePort.onChange([this]() {
         if (volume_.volumePort.hasData()) {
@@ -98,7 +100,16 @@ AtlasVolumeRaycaster::AtlasVolumeRaycaster(std::string_view identifier,
     });
 
     registerComponents(volume_, entryExit_, isoTF_, atlas_, background_, sampleTransform_,
-                       raycasting_, camera_, light_, positionIndicator_, time_);
+                       raycasting_, camera_, light_, positionIndicator_, time_, refinement_);
+}
+
+void AtlasVolumeRaycaster::process() {
+    const auto& frame = refinement_.beginFrame(*this, outport_);
+    {
+        const ProgressiveRefinementProperty::Target target{outport_, frame};
+        render();
+    }
+    refinement_.endFrame(*this);
 }
 
 }  // namespace inviwo
@@ -0,0 +1,114 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/processors/raycasting/brickedvolumeraycaster.h>
+
+#include <inviwo/core/algorithm/boundingbox.h>                         // for boundingBox
+#include <inviwo/core/common/inviwoapplication.h>                      // for dispatchFront
+#include <inviwo/core/ports/volumeport.h>                              // for VolumeInport
+#include <inviwo/core/processors/processorinfo.h>                      // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>                     // for CodeState, CodeSt...
+#include <inviwo/core/processors/processorstatus.h>                    // for ProcessorStatus
+#include <inviwo/core/processors/processortags.h>                      // for Tag, Tags::GL, Tags
+#include <inviwo/core/properties/invalidationlevel.h>                  // for InvalidationLevel
+#include <inviwo/core/properties/isotfproperty.h>                      // for IsoTFProperty
+#include <inviwo/core/util/formats.h>                                  // for DataFormatBase
+#include <modules/basegl/processors/raycasting/volumeraycasterbase.h>  // for VolumeRaycasterBase
+#include <modules/opengl/openglcapabilities.h>                         // for OpenGLCapabilities
+
+#include <memory>  // for weak_ptr
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo BrickedVolumeRaycaster::processorInfo_{
+    "org.inviwo.BrickedVolumeRaycaster",                           // Class identifier
+    "Bricked Volume Raycaster",                                    // Display name
+    "Volume Rendering",                                            // Category
+    CodeState::Experimental,                                       // Code state
+    Tags::GL | Tag{"Volume"} | Tag{"Raycaster"} | Tag{"Bricked"},  // Tags
+    R"(Processor for visualizing volumes larger than the GPU memory by means of volume
+    raycasting. The volume is split into a multi-resolution hierarchy of bricks stored on disk
+    and only the bricks that the rays actually sample are uploaded into a fixed size GPU
+    brick pool. Missing bricks are rendered using coarser levels and the image is refined
+    progressively as the requested bricks are uploaded. Only one channel of the volume will be
+    used. Besides the volume data, entry and exit point locations of the bounding box are
+    required. These can be created with the EntryExitPoints processor. The camera properties
+    between these two processors need to be linked. Requires OpenGL 4.3 or Shader Storage
+    Buffer Objects.)"_unindentHelp,
+};
+
+const ProcessorInfo& BrickedVolumeRaycaster::getProcessorInfo() const { return processorInfo_; }
+
+BrickedVolumeRaycaster::BrickedVolumeRaycaster(std::string_view identifier,
+                                               std::string_view displayName)
+    : VolumeRaycasterBase(identifier, displayName)
+    , volume_{"volume", "input volume (Only one channel will be rendered)"_help}
+    , entryExit_{}
+    , background_{*this}
+    , isoTF_{volume_.volumePort}
+    , raycasting_{volume_.getName(), isoTF_.isotfs[0]}
+    , camera_{"camera", util::boundingBox(volume_.volumePort)}
+    , light_{&camera_.camera}
+    , positionIndicator_{}
+    , sampleTransform_{} {
+
+    volume_.volumePort.onChange([this]() {
+        if (volume_.volumePort.hasData()) {
+            const auto channels = volume_.volumePort.getData()->getDataFormat()->getComponents();
+            raycasting_.setUsedChannels(channels);
+        }
+    });
+
+    if (!OpenGLCapabilities::isShaderStorageBuffersSupported()) {
+        isReady_.setUpdate([]() -> ProcessorStatus {
+            return {ProcessorStatus::Error,
+                    "OpenGL v4.3 or Shader Storage Buffer Objects "
+                    "(ARB_shader_storage_buffer_object) is required."};
+        });
+    }
+
+    registerComponents(volume_, entryExit_, background_, raycasting_, isoTF_, camera_, light_,
+                       positionIndicator_, sampleTransform_);
+}
+
+void BrickedVolumeRaycaster::process() {
+    VolumeRaycasterBase::process();
+
+    if (volume_.update()) {
+        // Render again to show the uploaded bricks and to request the next ones
+        dispatchFront([weakSelf = weak_from_this()]() {
+            if (auto self = weakSelf.lock()) {
+                self->invalidate(InvalidationLevel::InvalidOutput);
+            }
+        });
+    }
+}
+
+}  // namespace inviwo
@@ -64,9 +64,10 @@ const ProcessorInfo MultiChannelVolumeRaycaster::processorInfo_{
     CodeState::Experimental,                      // Code state
     Tags::GL | Tag{"Volume"} | Tag{"Raycaster"},  // Tags
     R"(Processor for visualizing volumetric data by means of volume raycasting. Each channel of the
-    volume uses a different transfer function. Besides the volume data, entry and exit point
-    locations of the bounding box are required. These can be created with the EntryExitPoints
-    processor. The camera properties between these two processors need to be linked.)"_unindentHelp,
+    volume uses a different transfer function. Entry and exit point locations of the bounding
+    geometry can be created with the EntryExitPoints processor, the camera properties between these
+    two processors need to be linked. If they are not connected the rays are intersected with the
+    bounding box of the volume instead.)"_unindentHelp,
 };
 const ProcessorInfo& MultiChannelVolumeRaycaster::getProcessorInfo() const {
     return processorInfo_;
@@ -77,7 +78,7 @@ MultiChannelVolumeRaycaster::MultiChannelVolumeRaycaster(std::string_view identi
     : VolumeRaycasterBase(identifier, displayName)
     , volume_{"volume", VolumeComponent::Gradients::All,
               "input volume, each channel rendered with its own TF"_help}
-    , entryExit_{}
+    , entryExit_{*this}
     , background_{*this}
     , isoTFs_{volume_.volumePort}
     , raycasting_{volume_.getName(),
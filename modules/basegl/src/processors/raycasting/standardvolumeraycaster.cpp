@@ -61,9 +61,10 @@ const ProcessorInfo StandardVolumeRaycaster::processorInfo_{
     CodeState::Experimental,                      // Code state
     Tags::GL | Tag{"Volume"} | Tag{"Raycaster"},  // Tags
     R"(Processor for visualizing volumetric data by means of volume raycasting. Only one channel of
-    the volume will be used. Besides the volume data, entry and exit point locations of the
-    bounding box are required. These can be created with the EntryExitPoints processor. The camera 
-    properties between these two processors need to be linked.)"_unindentHelp,
+    the volume will be used. Entry and exit point locations of the bounding geometry can be created
+    with the EntryExitPoints processor, the camera properties between these two processors need to
+    be linked. If they are not connected the rays are intersected with the bounding box of the
+    volume instead.)"_unindentHelp,
 };
 
 const ProcessorInfo& StandardVolumeRaycaster::getProcessorInfo() const { return processorInfo_; }
@@ -73,10 +74,11 @@ StandardVolumeRaycaster::StandardVolumeRaycaster(std::string_view identifier,
     : VolumeRaycasterBase(identifier, displayName)
     , volume_{"volume", VolumeComponent::Gradients::Single,
               "input volume (Only one channel will be rendered)"_help}
-    , entryExit_{}
+    , entryExit_{*this}
     , background_{*this}
     , isoTF_{volume_.volumePort}
     , raycasting_{volume_.getName(), isoTF_.isotfs[0]}
+    , emptySpace_{volume_.volumePort, raycasting_, isoTF_.isotfs[0]}
     , camera_{"camera", util::boundingBox(volume_.volumePort)}
     , light_{&camera_.camera}
     , positionIndicator_{}
@@ -89,8 +91,8 @@ StandardVolumeRaycaster::StandardVolumeRaycaster(std::string_view identifier,
         }
     });
 
-    registerComponents(volume_, entryExit_, background_, raycasting_, isoTF_, camera_, light_,
-                       positionIndicator_, sampleTransform_);
+    registerComponents(volume_, entryExit_, background_, raycasting_, emptySpace_, isoTF_, camera_,
+                       light_, positionIndicator_, sampleTransform_);
 }
 
 }  // namespace inviwo
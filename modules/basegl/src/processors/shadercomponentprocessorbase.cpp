@@ -110,6 +110,11 @@ void ShaderComponentProcessorBase::initializeResources() {
 
 void ShaderComponentProcessorBase::process() {
     utilgl::activateAndClearTarget(outport_);
+    render();
+    utilgl::deactivateCurrentTarget();
+}
+
+void ShaderComponentProcessorBase::render() {
     shader_.activate();
 
     TextureUnitContainer units;
@@ -126,7 +131,6 @@ void ShaderComponentProcessorBase::process() {
     utilgl::singleDrawImagePlaneRect();
 
     shader_.deactivate();
-    utilgl::deactivateCurrentTarget();
 }
 
 void ShaderComponentProcessorBase::handleError(std::string_view action,
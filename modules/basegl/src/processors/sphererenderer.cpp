@@ -31,9 +31,13 @@
 
 #include <inviwo/core/datastructures/geometry/geometrytype.h>  // for BufferType, DrawType
 #include <inviwo/core/datastructures/geometry/mesh.h>          // for Mesh::MeshInfo, Mesh
+#include <inviwo/core/datastructures/image/image.h>            // for Image
+#include <inviwo/core/datastructures/image/layer.h>            // for Layer
 #include <inviwo/core/util/glmvec.h>                           // for size2_t, vec4
 #include <inviwo/core/util/staticstring.h>                     // for operator+
+#include <modules/basegl/util/pointlodgl.h>                    // for PointLODGL
 #include <modules/opengl/geometry/meshgl.h>                    // for MeshGL
+#include <modules/opengl/image/layergl.h>                      // for LayerGL
 #include <modules/opengl/openglutils.h>                        // for BlendModeState
 #include <modules/opengl/rendering/meshdrawergl.h>             // for MeshDrawerGL, Mesh...
 #include <modules/opengl/shader/shader.h>                      // for Shader
@@ -76,6 +80,13 @@ SphereRenderer::SphereRenderer()
                   "render only input meshes marked as points or everything"_help,
                   {{"entireMesh", "Entire Mesh", RenderMode::EntireMesh},
                    {"pointsOnly", "Points Only", RenderMode::PointsOnly}}}
+    , culling_{"culling", "GPU Culling",
+               "Skip spheres outside of the view frustum or hidden behind other spheres or the "
+               "background image, on the GPU. The spheres visible in the previous frame are drawn "
+               "first and their depth is used to cull the remaining ones. Only used when "
+               "rendering the entire mesh without periodicity."_help,
+               true}
+    , lod_{}
     , bnl_{}
     , clip_{}
     , config_{}
@@ -111,9 +122,9 @@ SphereRenderer::SphereRenderer()
     addPort(labels_.strings);
     addPort(outport_);
 
-    addProperties(renderMode_, config_.config, labels_.labels, texture_.texture, bnl_.highlight,
-                  bnl_.select, bnl_.filter, periodic_.periodicity, clip_.clipping, camera_,
-                  lighting_, trackball_);
+    addProperties(renderMode_, culling_, lod_.lod, config_.config, labels_.labels,
+                  texture_.texture, bnl_.highlight, bnl_.select, bnl_.filter,
+                  periodic_.periodicity, clip_.clipping, camera_, lighting_, trackball_);
 }
 
 void SphereRenderer::initializeResources() {
@@ -127,6 +138,23 @@ void SphereRenderer::configureShader(Shader& shader) {
     shader.build();
 }
 
+Shader& SphereRenderer::activateShader(const Mesh& mesh) {
+    auto& shader = shaders_.getShader(mesh);
+    shader.activate();
+
+    utilgl::setUniforms(shader, camera_, lighting_, config_, clip_, bnl_, periodic_, labels_,
+                        texture_);
+    shader.setUniform("viewport", vec4(0.0f, 0.0f, 2.0f / outport_.getDimensions().x,
+                                       2.0f / outport_.getDimensions().y));
+
+    utilgl::setShaderUniforms(shader, mesh, "geometry");
+    return shader;
+}
+
+bool SphereRenderer::useSimpleDraw() const {
+    return renderMode_ == RenderMode::EntireMesh && !periodic_.periodicity.isChecked();
+}
+
 void SphereRenderer::process() {
     utilgl::BlendModeState blendModeStateGL(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     utilgl::activateTargetAndClearOrCopySource(outport_, imageInport_);
@@ -137,16 +165,28 @@ void SphereRenderer::process() {
     TextureUnitContainer cont;
     utilgl::bind(cont, bnl_, labels_, config_, texture_);
 
-    for (const auto& mesh : inport_) {
-        auto& shader = shaders_.getShader(*mesh);
-        shader.activate();
+    // Culling and level of detail rely on drawing the vertices of the mesh once each
+    const bool simple = useSimpleDraw();
+    const bool culling =
+        simple && culling_ && !lod_.isActive() && GlyphCullingGL::isSupportedByGPU();
+    const auto meshes = inport_.getVectorData();
+    const mat4 worldToClip = camera_.projectionMatrix() * camera_.viewMatrix();
 
-        utilgl::setUniforms(shader, camera_, lighting_, config_, clip_, bnl_, periodic_, labels_,
-                            texture_);
-        shader.setUniform("viewport", vec4(0.0f, 0.0f, 2.0f / outport_.getDimensions().x,
-                                           2.0f / outport_.getDimensions().y));
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        const auto& mesh = meshes[i];
+        auto& shader = activateShader(*mesh);
 
-        utilgl::setShaderUniforms(shader, *mesh, "geometry");
+        if (simple && lod_.draw(i, mesh, worldToClip, outport_.getDimensions())) {
+            shader.deactivate();
+            continue;
+        }
+
+        if (culling && GlyphCullingGL::isCullable(*mesh)) {
+            // Draw the spheres that were visible in the previous frame
+            glyphCulling_.draw(i, *mesh, GlyphCullingGL::List::Visible);
+            shader.deactivate();
+            continue;
+        }
 
         MeshDrawerGL::DrawObject drawer(*mesh);
         switch (renderMode_) {
@@ -162,6 +202,22 @@ void SphereRenderer::process() {
         shader.deactivate();
     }
 
+    if (culling) {
+        // Cull against the depth of the background and of the spheres drawn so far
+        glyphCulling_.updateDepth(
+            *outport_.getData()->getDepthLayer()->getRepresentation<LayerGL>());
+        for (size_t i = 0; i < meshes.size(); ++i) {
+            const auto& mesh = *meshes[i];
+            if (!GlyphCullingGL::isCullable(mesh)) continue;
+
+            glyphCulling_.cull(i, mesh, worldToClip, config_.radius,
+                               !config_.overrideRadius && mesh.hasBuffer(BufferType::RadiiAttrib));
+            auto& shader = activateShader(mesh);
+            glyphCulling_.draw(i, mesh, GlyphCullingGL::List::Revealed);
+            shader.deactivate();
+        }
+    }
+
     utilgl::deactivateCurrentTarget();
 }
 
@@ -0,0 +1,100 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/processors/surfaceextractiongl.h>
+
+#include <inviwo/core/processors/processorstate.h>           // for CodeState, CodeState::Exp...
+#include <inviwo/core/processors/processortags.h>            // for Tags, Tags::GL
+#include <inviwo/core/properties/propertysemantics.h>        // for PropertySemantics
+#include <modules/base/algorithm/volume/marchingcubesopt.h>  // for marchingCubesOpt
+
+#include <algorithm>  // for max, min
+#include <limits>     // for numeric_limits
+#include <memory>     // for shared_ptr, make_shared
+#include <vector>     // for vector
+
+namespace inviwo {
+
+const ProcessorInfo SurfaceExtractionGL::processorInfo_{
+    "org.inviwo.SurfaceExtractionGL",  // Class identifier
+    "Surface Extraction GL",           // Display name
+    "Mesh Creation",                   // Category
+    CodeState::Experimental,           // Code state
+    Tags::GL,                          // Tags
+    R"(
+Extracts iso surfaces from the input volumes using Marching Cubes in a compute shader. The
+volumes are read directly from the GPU and the resulting meshes only live on the GPU, which makes
+it possible to change the iso-value interactively also for large volumes. Falls back to the
+optimized CPU Marching Cubes if compute shaders are not supported.
+)"_unindentHelp};
+
+const ProcessorInfo& SurfaceExtractionGL::getProcessorInfo() const { return processorInfo_; }
+
+SurfaceExtractionGL::SurfaceExtractionGL()
+    : Processor()
+    , volume_("volume", "Scalar volumes, only the first channel is used"_help)
+    , outport_("mesh", "One mesh for each input volume"_help)
+    , isoValue_("iso", "ISO Value", "Iso-value in the data range of the volumes"_help, 0.5f,
+                {0.0f, ConstraintBehavior::Ignore}, {1.0f, ConstraintBehavior::Ignore},
+                0.01f)
+    , invertIso_("invert", "Invert ISO",
+                 "Flip the surface orientation, i.e. values greater than the iso-value are "
+                 "considered outside"_help,
+                 false)
+    , color_("color", "Color", util::ordinalColor(vec4{1.0f})) {
+
+    addPorts(volume_, outport_);
+    addProperties(isoValue_, invertIso_, color_);
+
+    volume_.onChange([this]() {
+        if (!volume_.hasData()) return;
+        auto min = std::numeric_limits<double>::max();
+        auto max = std::numeric_limits<double>::lowest();
+        for (const auto& volume : volume_) {
+            min = std::min(min, volume->dataMap.dataRange.x);
+            max = std::max(max, volume->dataMap.dataRange.y);
+        }
+        isoValue_.setMinValue(static_cast<float>(min));
+        isoValue_.setMaxValue(static_cast<float>(max));
+    });
+}
+
+void SurfaceExtractionGL::process() {
+    std::vector<std::shared_ptr<Mesh>> meshes;
+    for (const auto& volume : volume_) {
+        if (MarchingCubesGL::isSupportedByGPU()) {
+            meshes.push_back(marchingCubes_.extract(*volume, isoValue_, color_, invertIso_));
+        } else {
+            meshes.push_back(util::marchingCubesOpt(volume, isoValue_, color_, invertIso_, false));
+        }
+    }
+    outport_.setData(std::make_shared<DataSequence<Mesh>>(std::move(meshes)));
+}
+
+}  // namespace inviwo
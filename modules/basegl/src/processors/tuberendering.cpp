@@ -38,6 +38,7 @@ https://prideout.net/blog/old/blog/index.html@p=61.html
 #include <modules/basegl/processors/tuberendering.h>
 
 #include <inviwo/core/algorithm/boundingbox.h>                 // for boundingBox
+#include <inviwo/core/algorithm/markdown.h>                    // for operator""_help
 #include <inviwo/core/datastructures/geometry/geometrytype.h>  // for BufferType, ConnectivityType
 #include <inviwo/core/datastructures/geometry/mesh.h>          // for Mesh, Mesh::MeshInfo
 #include <inviwo/core/ports/imageport.h>                       // for BaseImageInport, ImageInport
@@ -52,11 +53,15 @@ https://prideout.net/blog/old/blog/index.html@p=61.html
 #include <inviwo/core/properties/compositeproperty.h>          // for CompositeProperty
 #include <inviwo/core/properties/invalidationlevel.h>          // for InvalidationLevel, Invalid...
 #include <inviwo/core/properties/propertysemantics.h>          // for PropertySemantics, Propert...
-#include <inviwo/core/util/glmvec.h>                           // for vec4
+#include <inviwo/core/util/formats.h>                          // for DataFormatId, NumericType
+#include <inviwo/core/util/glmvec.h>                           // for vec4, vec2
 #include <inviwo/core/util/iterrange.h>                        // for iter_range
 #include <modules/basegl/datastructures/meshshadercache.h>     // for MeshShaderCache::Requirement
+#include <modules/opengl/buffer/buffergl.h>                    // for BufferGL
+#include <modules/opengl/buffer/bufferobjectarray.h>           // for BufferObjectArray
 #include <modules/opengl/geometry/meshgl.h>                    // for MeshGL
 #include <modules/opengl/inviwoopengl.h>                       // for GL_BACK, GL_DEPTH_TEST
+#include <modules/opengl/openglcapabilities.h>                 // for OpenGLCapabilities
 #include <modules/opengl/openglutils.h>                        // for CullFaceState, GlBoolState
 #include <modules/opengl/rendering/meshdrawergl.h>             // for MeshDrawerGL::DrawObject
 #include <modules/opengl/shader/shader.h>                      // for Shader
@@ -66,11 +71,14 @@ https://prideout.net/blog/old/blog/index.html@p=61.html
 #include <modules/opengl/texture/textureunit.h>                // for TextureUnitContainer
 #include <modules/opengl/texture/textureutils.h>               // for activateTargetAndClearOrCo...
 
+#include <array>        // for array
 #include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
 #include <functional>   // for __base, function
 #include <map>          // for __map_iterator, map, opera...
 #include <memory>       // for shared_ptr
 #include <string_view>  // for string_view
+#include <utility>      // for pair
 
 namespace inviwo {
 
@@ -84,6 +92,55 @@ const ProcessorInfo TubeRendering::processorInfo_{
 };
 const ProcessorInfo& TubeRendering::getProcessorInfo() const { return processorInfo_; }
 
+namespace {
+
+// Merge at most 2^6 consecutive strip segments when using the screen space simplification
+constexpr std::uint32_t lodLevels = 6;
+
+// Shader storage bindings of the buffers in tuberenderingpulling.vert
+constexpr std::array<std::pair<BufferType, GLuint>, 5> pullingBindings{{
+    {BufferType::PositionAttrib, 0},
+    {BufferType::ColorAttrib, 1},
+    {BufferType::RadiiAttrib, 2},
+    {BufferType::PickingAttrib, 3},
+    {BufferType::ScalarMetaAttrib, 4},
+}};
+constexpr GLuint pullingIndexBinding = 5;
+
+/**
+ * The vertex pulling shader reads the buffers as raw arrays, hence they need to match the types
+ * used in the shader.
+ */
+bool canPull(const Mesh& mesh) {
+    if (OpenGLCapabilities::getOpenGLVersion() < 430) return false;
+    for (const auto& [type, binding] : pullingBindings) {
+        const auto buffer = mesh.findBuffer(type).first;
+        if (!buffer) {
+            if (type == BufferType::PositionAttrib) return false;
+            continue;
+        }
+        const auto* format = buffer->getDataFormat();
+        const auto components = format->getComponents();
+        const bool valid = [&]() {
+            switch (type) {
+                case BufferType::PositionAttrib:
+                    return format->getNumericType() == NumericType::Float &&
+                           format->getPrecision() == 32 && components >= 2;
+                case BufferType::ColorAttrib:
+                    return format->getId() == DataFormatId::Vec4Float32;
+                case BufferType::PickingAttrib:
+                    return format->getId() == DataFormatId::UInt32;
+                default:
+                    return format->getId() == DataFormatId::Float32;
+            }
+        }();
+        if (!valid) return false;
+    }
+    return true;
+}
+
+}  // namespace
+
 TubeRendering::TubeRendering()
     : Processor()
     , inport_("mesh")
@@ -99,6 +156,10 @@ TubeRendering::TubeRendering()
     , useMetaColor_("useMetaColor", "Use meta color mapping", false,
                     InvalidationLevel::InvalidResources)
     , metaColor_("metaColor", "Meta Color Mapping")
+    , mode_("mode", "Mode",
+            {{"geometryShader", "Geometry Shader", Mode::GeometryShader},
+             {"vertexPulling", "Vertex Pulling", Mode::VertexPulling}})
+    , lodPixels_("lodPixels", "Merge Segments Below (px)", 0.0f, 0.0f, 10.0f, 0.1f)
     , camera_("camera", "Camera", util::boundingBox(inport_))
     , trackball_(&camera_)
     , lighting_("lighting", "Lighting", &camera_)
@@ -122,7 +183,24 @@ TubeRendering::TubeRendering()
     , shaders_{shaderItems_, shaderRequirements_, [&](Shader& shader) -> void {
                    shader.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
                    configureShader(shader);
-               }} {
+               }}
+    , pullingShaderItems_{{{ShaderType::Vertex, "tuberenderingpulling.vert"},
+                           {ShaderType::Fragment, "tuberendering.frag"}}}
+    , pullingAdjacencyShaders_{pullingShaderItems_, shaderRequirements_,
+                               [&](Shader& shader) -> void {
+                                   shader.onReload([this]() {
+                                       invalidate(InvalidationLevel::InvalidResources);
+                                   });
+                                   for (auto& obj : shader.getShaderObjects()) {
+                                       obj.addShaderDefine("HAS_ADJACENCY");
+                                   }
+                                   configureShader(shader);
+                               }}
+    , pullingShaders_{pullingShaderItems_, shaderRequirements_, [&](Shader& shader) -> void {
+                          shader.onReload(
+                              [this]() { invalidate(InvalidationLevel::InvalidResources); });
+                          configureShader(shader);
+                      }} {
 
     addPort(inport_);
     addPort(imageInport_).setOptional(true);
@@ -130,9 +208,23 @@ TubeRendering::TubeRendering()
 
     tubeProperties_.addProperties(forceRadius_, defaultRadius_, forceColor_, defaultColor_,
                                   useMetaColor_, metaColor_);
-    addProperties(tubeProperties_, camera_, lighting_, trackball_);
+    addProperties(tubeProperties_, mode_, lodPixels_, camera_, lighting_, trackball_);
+
+    mode_.setHelp(
+        "Geometry Shader expands each segment into a prismoid in a geometry shader. Vertex "
+        "Pulling instead reads the mesh buffers directly in the vertex shader, which scales "
+        "better to large line sets. It requires OpenGL 4.3 and 32 bit float positions, "
+        "otherwise the geometry shader is used."_help);
+    lodPixels_.setHelp(
+        "Vertex Pulling only. Consecutive segments of line strips that together are shorter "
+        "than this on screen are drawn as one segment, zero disables the simplification."_help);
+    lodPixels_.visibilityDependsOn(mode_, [](const auto& p) {
+        return p.getSelectedValue() == Mode::VertexPulling;
+    });
 }
 
+TubeRendering::~TubeRendering() = default;
+
 void TubeRendering::initializeResources() {
     for (auto& item : adjacencyShaders_.getShaders()) {
         configureShader(item.second);
@@ -140,6 +232,12 @@ void TubeRendering::initializeResources() {
     for (auto& item : shaders_.getShaders()) {
         configureShader(item.second);
     }
+    for (auto& item : pullingAdjacencyShaders_.getShaders()) {
+        configureShader(item.second);
+    }
+    for (auto& item : pullingShaders_.getShaders()) {
+        configureShader(item.second);
+    }
 }
 
 void TubeRendering::configureShader(Shader& shader) {
@@ -207,6 +305,15 @@ void TubeRendering::process() {
     };
 
     for (const auto& mesh : inport_) {
+        if (mode_ == Mode::VertexPulling && canPull(*mesh)) {
+            if (hasAnyLine(*mesh, hasLineAdjacency)) {
+                drawPulling(*mesh, pullingAdjacencyShaders_.getShader(*mesh), true);
+            }
+            if (hasAnyLine(*mesh, hasLine)) {
+                drawPulling(*mesh, pullingShaders_.getShader(*mesh), false);
+            }
+            continue;
+        }
         if (hasAnyLine(*mesh, hasLineAdjacency)) {
             draw(*mesh, adjacencyShaders_.getShader(*mesh), hasLineAdjacency);
         }
@@ -217,4 +324,70 @@ void TubeRendering::process() {
     utilgl::deactivateCurrentTarget();
 }
 
+void TubeRendering::drawPulling(const Mesh& mesh, Shader& shader, bool adjacency) {
+    if (!vao_) vao_ = std::make_unique<BufferObjectArray>();
+
+    shader.activate();
+    TextureUnitContainer units;
+    utilgl::bindAndSetUniforms(shader, units, metaColor_);
+    utilgl::setUniforms(shader, camera_, lighting_, defaultColor_, defaultRadius_);
+    utilgl::setShaderUniforms(shader, mesh, "geometry");
+    shader.setUniform("viewport", vec2{outport_.getDimensions()});
+    shader.setUniform("lodLevels", lodPixels_.get() > 0.0f ? lodLevels : std::uint32_t{0});
+    shader.setUniform("lodPixels", lodPixels_.get());
+
+    for (const auto& [type, binding] : pullingBindings) {
+        if (const auto buffer = mesh.findBuffer(type).first) {
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding,
+                             buffer->getRepresentation<BufferGL>()->getId());
+        }
+    }
+    const auto positions = mesh.findBuffer(BufferType::PositionAttrib).first;
+    shader.setUniform("positionComponents",
+                      static_cast<std::uint32_t>(positions->getDataFormat()->getComponents()));
+
+    utilgl::GlBoolState depthTest(GL_DEPTH_TEST, true);
+    vao_->bind();
+
+    const std::size_t size = adjacency ? 4 : 2;
+    const auto draw = [&](Mesh::MeshInfo mi, const IndexBuffer* indices) {
+        const bool valid = mi.dt == DrawType::Lines &&
+                           (adjacency ? (mi.ct == ConnectivityType::StripAdjacency ||
+                                         mi.ct == ConnectivityType::Adjacency)
+                                      : (mi.ct == ConnectivityType::None ||
+                                         mi.ct == ConnectivityType::Strip));
+        if (!valid) return;
+
+        const std::size_t elements = indices ? indices->getSize() : positions->getSize();
+        if (elements < size) return;
+        const bool strip =
+            mi.ct == ConnectivityType::Strip || mi.ct == ConnectivityType::StripAdjacency;
+        const std::size_t stride = strip ? 1 : size;
+        const std::size_t segments = strip ? elements - size + 1 : elements / size;
+
+        if (indices) {
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, pullingIndexBinding,
+                             indices->getRepresentation<BufferGL>()->getId());
+        }
+        shader.setUniform("hasIndices", indices != nullptr);
+        shader.setUniform("segmentStride", static_cast<std::uint32_t>(stride));
+        shader.setUniform("numSegments", static_cast<std::uint32_t>(segments));
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 14, static_cast<GLsizei>(segments));
+    };
+
+    if (mesh.getNumberOfIndicies() > 0) {
+        for (std::size_t i = 0; i < mesh.getNumberOfIndicies(); ++i) {
+            draw(mesh.getIndexMeshInfo(i), mesh.getIndices(i));
+        }
+    } else {
+        draw(mesh.getDefaultMeshInfo(), nullptr);
+    }
+
+    vao_->unbind();
+    for (GLuint binding = 0; binding <= pullingIndexBinding; ++binding) {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+    }
+    shader.deactivate();
+}
+
 }  // namespace inviwo
@@ -40,7 +40,9 @@
 #include <inviwo/core/util/glmvec.h>                                    // for size3_t
 #include <modules/opengl/buffer/framebufferobject.h>                    // for FrameBufferObject
 #include <modules/opengl/inviwoopengl.h>                                // for glViewport, GLsizei
+#include <modules/opengl/openglcapabilities.h>                          // for OpenGLCapabilities
 #include <modules/opengl/shader/shader.h>                               // for Shader, Shader::B...
+#include <modules/opengl/shader/shaderobject.h>                         // for ShaderObject
 #include <modules/opengl/shader/shadertype.h>                           // for ShaderType, Shade...
 #include <modules/opengl/shader/shaderutils.h>                          // for findShaderResource
 #include <modules/opengl/texture/textureunit.h>                         // for TextureUnitContainer
@@ -49,6 +51,7 @@
 #include <modules/opengl/volume/volumeutils.h>                          // for bindAndSetUniforms
 
 #include <functional>     // for __base
+#include <optional>       // for optional, nullopt
 #include <string_view>    // for string_view
 #include <type_traits>    // for remove_extent_t
 #include <unordered_map>  // for unordered_map
@@ -60,6 +63,38 @@
 namespace inviwo {
 class ShaderResource;
 
+namespace {
+
+/**
+ * Extension allowing gl_Layer to be written from the vertex shader, if any is supported
+ */
+std::optional<std::string_view> vertexLayerExtension() {
+    for (const auto* ext : {"GL_ARB_shader_viewport_layer_array", "GL_AMD_vertex_shader_layer"}) {
+        if (OpenGLCapabilities::isExtensionSupported(ext)) return ext;
+    }
+    return std::nullopt;
+}
+
+/**
+ * Skip the geometry shader stage when the slice can be selected in the vertex shader
+ */
+Shader volumeShader(std::shared_ptr<const ShaderResource> fragmentShader) {
+    static const auto extension = vertexLayerExtension();
+    if (extension) {
+        Shader shader{{{ShaderType::Vertex, utilgl::findShaderResource("volume_gpu_layer.vert")},
+                       {ShaderType::Fragment, fragmentShader}},
+                      Shader::Build::No};
+        shader.getVertexShaderObject()->addShaderExtension(*extension, true);
+        return shader;
+    }
+    return Shader{{{ShaderType::Vertex, utilgl::findShaderResource("volume_gpu.vert")},
+                   {ShaderType::Geometry, utilgl::findShaderResource("volume_gpu.geom")},
+                   {ShaderType::Fragment, fragmentShader}},
+                  Shader::Build::No};
+}
+
+}  // namespace
+
 VolumeGLProcessor::VolumeGLProcessor(std::shared_ptr<const ShaderResource> fragmentShader,
                                      bool buildShader)
     : Processor()
@@ -67,12 +102,10 @@ VolumeGLProcessor::VolumeGLProcessor(std::shared_ptr<const ShaderResource> fragm
     , outport_("outputVolume", "Output volume"_help)
     , dataFormat_(nullptr)
     , internalInvalid_(true)
-    , shader_({{ShaderType::Vertex, utilgl::findShaderResource("volume_gpu.vert")},
-               {ShaderType::Geometry, utilgl::findShaderResource("volume_gpu.geom")},
-               {ShaderType::Fragment, fragmentShader}},
-              buildShader ? Shader::Build::Yes : Shader::Build::No)
+    , shader_(volumeShader(fragmentShader))
     , fbo_() {
     addPorts(inport_, outport_);
+    if (buildShader) shader_.build();
 
     inport_.onChange([this]() {
         markInvalid();
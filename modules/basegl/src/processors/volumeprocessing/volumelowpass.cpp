@@ -31,6 +31,7 @@
 
 #include <inviwo/core/algorithm/markdown.h>                                // for operator""_help
 #include <inviwo/core/datastructures/datamapper.h>                         // for DataMapper
+#include <inviwo/core/datastructures/volume/volume.h>                      // for Volume
 #include <inviwo/core/ports/volumeport.h>                                  // for VolumeInport
 #include <inviwo/core/processors/processorinfo.h>                          // for ProcessorInfo
 #include <inviwo/core/processors/processorstate.h>                         // for CodeState, Cod...
@@ -48,10 +49,14 @@
 #include <modules/basegl/processors/volumeprocessing/volumeglprocessor.h>  // for VolumeGLProcessor
 #include <modules/opengl/shader/shader.h>                                  // for Shader
 #include <modules/opengl/shader/shaderobject.h>                            // for ShaderObject
+#include <modules/opengl/inviwoopengl.h>                                   // for glViewport
 #include <modules/opengl/shader/shaderutils.h>                             // for setUniforms
+#include <modules/opengl/texture/textureunit.h>                            // for TextureUnitCon...
+#include <modules/opengl/texture/textureutils.h>                           // for multiDrawImage...
+#include <modules/opengl/volume/volumegl.h>                                // for VolumeGL
+#include <modules/opengl/volume/volumeutils.h>                             // for bindAndSetUnif...
 
 #include <algorithm>    // for max, min
-#include <cmath>        // for M_PI
 #include <cstddef>      // for size_t
 #include <functional>   // for __base
 #include <memory>       // for shared_ptr
@@ -60,12 +65,11 @@
 #include <string_view>  // for string_view
 #include <type_traits>  // for remove_extent_t
 #include <utility>      // for pair
-#include <numbers>
 
+#include <glm/vec3.hpp>  // for vec, vec<>::(a...
 #include <glm/vec4.hpp>  // for vec, vec<>::(a...
 
 namespace inviwo {
-class TextureUnitContainer;
 
 const ProcessorInfo VolumeLowPass::processorInfo_{
     "org.inviwo.VolumeLowPass",  // Class identifier
@@ -107,14 +111,56 @@ VolumeLowPass::VolumeLowPass()
 
 VolumeLowPass::~VolumeLowPass() {}
 
-void VolumeLowPass::preProcess(TextureUnitContainer&) {
+void VolumeLowPass::process() {
+    const auto& input = *inport_.getData();
+    if (internalInvalid_) {
+        internalInvalid_ = false;
+        volume_ = std::make_shared<Volume>(input.config().updateFrom({.format = dataFormat_}));
+        intermediate_ = std::make_shared<Volume>(volume_->config());
+        outport_.setData(volume_);
+
+        fbo_.activate();
+        fbo_.attachColorTexture(volume_->getEditableRepresentation<VolumeGL>()->getTexture().get(),
+                                0);
+        fbo_.deactivate();
+        intermediateFbo_.activate();
+        intermediateFbo_.attachColorTexture(
+            intermediate_->getEditableRepresentation<VolumeGL>()->getTexture().get(), 0);
+        intermediateFbo_.deactivate();
+    }
+
+    shader_.activate();
     utilgl::setUniforms(shader_, kernelSize_);
+    shader_.setUniform("sigmaSq2", 2.0f * sigma_.get() * sigma_.get());
+
+    // Ping-pong between the output and the intermediate volume, one axis at a time
+    filter(input, *volume_, fbo_, 0);
+    filter(*volume_, *intermediate_, intermediateFbo_, 1);
+    filter(*intermediate_, *volume_, fbo_, 2);
+
+    shader_.deactivate();
+
+    postProcess();
+}
+
+void VolumeLowPass::filter(const Volume& source, Volume& destination, FrameBufferObject& fbo,
+                           size_t axis) {
+    TextureUnitContainer cont;
+    utilgl::bindAndSetUniforms(shader_, cont, source, "volume");
+
+    const size3_t dim{source.getDimensions()};
+    vec3 direction{0.0f};
+    direction[axis] = 1.0f / static_cast<float>(dim[axis]);
+    shader_.setUniform("direction", direction);
 
-    float sigmaSq2 = 2.0f * sigma_.get() * sigma_.get();
-    float a = 1.0f / (sigmaSq2 * std::numbers::pi_v<float>);
+    // We always need to ask for an editable representation
+    // this will invalidate any other representations
+    destination.getEditableRepresentation<VolumeGL>();
 
-    shader_.setUniform("sigmaSq2", sigmaSq2);
-    shader_.setUniform("a", a);
+    fbo.activate();
+    glViewport(0, 0, static_cast<GLsizei>(dim.x), static_cast<GLsizei>(dim.y));
+    utilgl::multiDrawImagePlaneRect(static_cast<int>(dim.z));
+    fbo.deactivate();
 }
 
 void VolumeLowPass::postProcess() {
@@ -46,6 +46,7 @@
 #include <inviwo/core/processors/processorinfo.h>                       // for ProcessorInfo
 #include <inviwo/core/processors/processorstate.h>                      // for CodeState, CodeSt...
 #include <inviwo/core/processors/processortags.h>                       // for Tags
+#include <inviwo/core/properties/boolproperty.h>                        // for BoolProperty
 #include <inviwo/core/properties/cameraproperty.h>                      // for CameraProperty
 #include <inviwo/core/properties/eventproperty.h>                       // for EventProperty
 #include <inviwo/core/properties/invalidationlevel.h>                   // for InvalidationLevel
@@ -59,6 +60,9 @@
 #include <inviwo/core/util/formats.h>                                   // for DataFormatBase
 #include <inviwo/core/util/sourcecontext.h>                             // for SourceContext
 #include <inviwo/core/util/stringconversion.h>                          // for toString
+#include <modules/basegl/properties/progressiverefinementproperty.h>    // for ProgressiveRef...
+#include <modules/basegl/rendering/emptyspaceskippinggl.h>              // for EmptySpaceSkip...
+#include <modules/basegl/rendering/gradientvolumegl.h>                  // for GradientVolumeGL
 #include <modules/opengl/image/layergl.h>                               // for LayerGL
 #include <modules/opengl/inviwoopengl.h>                                // for glFinish
 #include <modules/opengl/shader/shader.h>                               // for Shader, Shader::B...
@@ -116,6 +120,18 @@ VolumeRaycaster::VolumeRaycaster()
                std::vector<OptionPropertyIntOption>{{"Channel 1", "Channel 1", 0}}, size_t{0})
     , raycasting_("raycaster", "Raycasting")
     , isotfComposite_("isotfComposite", "TF & Isovalues", &volumePort_)
+    , emptySpaceSkipping_("emptySpaceSkipping", "Empty Space Skipping",
+                          "Skip the samples in regions of the volume that are fully transparent "
+                          "under the current transfer function and isovalues. Only used with "
+                          "transfer function classification and requires compute shaders."_help,
+                          true, InvalidationLevel::InvalidResources)
+    , precomputedGradients_("precomputedGradients", "Precompute Gradients",
+                            "Compute the gradients of the rendered channel once, using central "
+                            "differences, and look them up during raycasting instead of "
+                            "recomputing them for every sample. Uses an additional 4 bytes per "
+                            "voxel of GPU memory."_help,
+                            false, InvalidationLevel::InvalidResources)
+    , refinement_("progressiveRefinement", "Progressive Refinement")
     , camera_("camera", "Camera", util::boundingBox(volumePort_))
     , lighting_("lighting", "Lighting", &camera_)
     , positionIndicator_("positionindicator", "Position Indicator")
@@ -142,6 +158,12 @@ VolumeRaycaster::VolumeRaycaster()
     updateTFHistSel();
     channel_.onChange(updateTFHistSel);
 
+    volumePort_.onChange([this]() {
+        emptySpace_.invalidateGrid();
+        gradientVolume_.invalidate();
+    });
+    isotfComposite_.onChange([this]() { emptySpace_.invalidateOccupancy(); });
+
     volumePort_.onChange([this]() {
         if (volumePort_.hasData()) {
             size_t channels = volumePort_.getData()->getDataFormat()->getComponents();
@@ -176,6 +198,9 @@ VolumeRaycaster::VolumeRaycaster()
     addProperty(channel_);
     addProperty(raycasting_);
     addProperty(isotfComposite_);
+    addProperty(emptySpaceSkipping_);
+    addProperty(precomputedGradients_);
+    addProperty(refinement_);
 
     addProperty(camera_);
     addProperty(lighting_);
@@ -189,10 +214,14 @@ void VolumeRaycaster::initializeResources() {
     utilgl::addDefines(shader_, raycasting_, isotfComposite_, camera_, lighting_,
                        positionIndicator_);
     utilgl::addShaderDefinesBGPort(shader_, backgroundPort_);
+    shader_.getFragmentShaderObject()->setShaderDefine("EMPTY_SPACE_SKIPPING",
+                                                       useEmptySpaceSkipping());
+    GradientVolumeGL::addShaderDefines(shader_, usePrecomputedGradients());
     shader_.build();
 }
 
 void VolumeRaycaster::process() {
+    const auto frame = refinement_.beginFrame(*this, outport_);
     if (volumePort_.isChanged()) {
         dispatchOne(
             [volume = volumePort_.getData()]() {
@@ -200,25 +229,44 @@ void VolumeRaycaster::process() {
                 glFinish();
                 return volume;
             },
-            [this](std::shared_ptr<const Volume> volume) {
-                raycast(*volume);
+            [this, frame](std::shared_ptr<const Volume> volume) {
+                raycast(*volume, frame);
                 newResults();
             });
     } else {
-        raycast(*volumePort_.getData());
+        raycast(*volumePort_.getData(), frame);
     }
 }
 
-void VolumeRaycaster::raycast(const Volume& volume) {
+void VolumeRaycaster::raycast(const Volume& volume,
+                              const ProgressiveRefinementProperty::Frame& frame) {
     if (!volume.getRep<kind::GL>()) {
         throw Exception("Could not find VolumeGL representation");
     }
-    utilgl::activateAndClearTarget(outport_);
+    const bool emptySpaceSkipping = useEmptySpaceSkipping();
+    if (emptySpaceSkipping) {
+        using enum RaycastingProperty::RenderingType;
+        emptySpace_.update(volume, static_cast<size_t>(channel_.get()), isotfComposite_,
+                           raycasting_.renderingType_.get() != Isosurface,
+                           raycasting_.renderingType_.get() != Dvr);
+    }
+    const bool precomputedGradients = usePrecomputedGradients();
+    if (precomputedGradients) {
+        gradientVolume_.update(volume, static_cast<size_t>(channel_.get()));
+    }
+
+    const ProgressiveRefinementProperty::Target target{outport_, frame};
     shader_.activate();
 
     TextureUnitContainer units;
     utilgl::bindAndSetUniforms(shader_, units, volume, "volume");
     utilgl::bindAndSetUniforms(shader_, units, isotfComposite_);
+    if (emptySpaceSkipping) {
+        emptySpace_.bind(shader_, units, "occupancy");
+    }
+    if (precomputedGradients) {
+        gradientVolume_.bind(shader_, units);
+    }
     utilgl::bindAndSetUniforms(shader_, units, entryPort_, ImageType::ColorDepthPicking);
     utilgl::bindAndSetUniforms(shader_, units, exitPort_, ImageType::ColorDepth);
     if (backgroundPort_.hasData()) {
@@ -235,11 +283,12 @@ void VolumeRaycaster::raycast(const Volume& volume) {
 
     utilgl::setUniforms(shader_, outport_, camera_, lighting_, raycasting_, positionIndicator_,
                         channel_, isotfComposite_);
+    refinement_.setUniforms(shader_, frame);
 
     utilgl::singleDrawImagePlaneRect();
 
     shader_.deactivate();
-    utilgl::deactivateCurrentTarget();
+    refinement_.endFrame(*this, frame);
 }
 
 void VolumeRaycaster::toggleShading(Event*) {
@@ -250,6 +299,18 @@ void VolumeRaycaster::toggleShading(Event*) {
     }
 }
 
+bool VolumeRaycaster::useEmptySpaceSkipping() const {
+    return emptySpaceSkipping_ && EmptySpaceSkippingGL::isSupportedByGPU() &&
+           raycasting_.classification_.get() == RaycastingProperty::Classification::TF;
+}
+
+bool VolumeRaycaster::usePrecomputedGradients() const {
+    using enum RaycastingProperty::GradientComputation;
+    const auto mode = raycasting_.gradientComputation_.get();
+    return precomputedGradients_ && mode != None && mode != PrecomputedXYZ &&
+           mode != PrecomputedYZW;
+}
+
 // override to do member renaming.
 void VolumeRaycaster::deserialize(Deserializer& d) {
     util::renamePort(d, {{&entryPort_, "entry-points"}, {&exitPort_, "exit-points"}});
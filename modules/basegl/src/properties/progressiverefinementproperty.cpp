@@ -0,0 +1,191 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/properties/progressiverefinementproperty.h>
+
+#include <inviwo/core/common/inviwoapplication.h>          // for InviwoApplication, dispatchF...
+#include <inviwo/core/interaction/interactionstate.h>      // for InteractionState
+#include <inviwo/core/ports/imageport.h>                   // for ImageOutport
+#include <inviwo/core/ports/inport.h>                      // for Inport
+#include <inviwo/core/processors/processor.h>              // for Processor
+#include <inviwo/core/properties/boolcompositeproperty.h>  // for BoolCompositeProperty
+#include <inviwo/core/properties/invalidationlevel.h>      // for InvalidationLevel
+#include <inviwo/core/properties/ordinalproperty.h>        // for FloatProperty, IntSizeTProperty
+#include <inviwo/core/properties/property.h>               // for Property
+#include <inviwo/core/properties/propertyowner.h>          // for PropertyOwner
+#include <modules/opengl/inviwoopengl.h>                   // for glBlendColor, GL_CONSTANT_ALPHA
+#include <modules/opengl/openglutils.h>                    // for BlendModeState, GlBoolState
+#include <modules/opengl/shader/shader.h>                  // for Shader
+#include <modules/opengl/texture/textureutils.h>           // for activateTarget, deactivateCu...
+
+#include <algorithm>  // for any_of
+#include <cmath>      // for fmod
+
+namespace inviwo {
+
+namespace {
+
+// Position of the first sample of refinement frame k. The first frame uses the center as without
+// refinement, the following ones fill the step evenly using the golden ratio sequence.
+float rayOffset(size_t k) {
+    constexpr double goldenRatioConjugate = 0.6180339887498949;
+    return static_cast<float>(std::fmod(0.5 + static_cast<double>(k) * goldenRatioConjugate, 1.0));
+}
+
+}  // namespace
+
+std::string_view ProgressiveRefinementProperty::getClassIdentifier() const {
+    return classIdentifier;
+}
+
+ProgressiveRefinementProperty::ProgressiveRefinementProperty(std::string_view identifier,
+                                                             std::string_view displayName,
+                                                             bool checked,
+                                                             InvalidationLevel invalidationLevel)
+    : BoolCompositeProperty{identifier, displayName,
+                            "Render with a lower sampling rate while interacting and average "
+                            "a number of refinement frames with full sampling rate afterwards"_help,
+                            checked, invalidationLevel}
+    , interactionSamplingRate_{"interactionSamplingRate", "Interaction Sampling Rate",
+                               util::ordinalScale(0.25f, 1.0f)
+                                   .set("Fraction of the sampling rate to use while the camera or "
+                                        "transfer function is changing"_help)}
+    , refinementFrames_{"refinementFrames", "Refinement Frames",
+                        util::ordinalCount(size_t{8}, size_t{64})
+                            .setMin(size_t{1})
+                            .set("Number of frames with jittered sample positions to average once "
+                                 "the interaction is over"_help)}
+    , nextFrame_{0}
+    , interactive_{false}
+    , dimensions_{0}
+    , interactionHandle_{} {
+
+    addProperties(interactionSamplingRate_, refinementFrames_);
+
+    if (auto* app = InviwoApplication::getPtr()) {
+        interactionHandle_ = app->getInteractionState().onChange(
+            [this](bool interacting) { onInteraction(interacting); });
+    }
+}
+
+ProgressiveRefinementProperty::ProgressiveRefinementProperty(
+    const ProgressiveRefinementProperty& rhs)
+    : BoolCompositeProperty{rhs}
+    , interactionSamplingRate_{rhs.interactionSamplingRate_}
+    , refinementFrames_{rhs.refinementFrames_}
+    , nextFrame_{0}
+    , interactive_{false}
+    , dimensions_{0}
+    , interactionHandle_{} {
+
+    addProperties(interactionSamplingRate_, refinementFrames_);
+
+    if (auto* app = InviwoApplication::getPtr()) {
+        interactionHandle_ = app->getInteractionState().onChange(
+            [this](bool interacting) { onInteraction(interacting); });
+    }
+}
+
+ProgressiveRefinementProperty* ProgressiveRefinementProperty::clone() const {
+    return new ProgressiveRefinementProperty(*this);
+}
+
+ProgressiveRefinementProperty::~ProgressiveRefinementProperty() = default;
+
+auto ProgressiveRefinementProperty::beginFrame(const Processor& processor,
+                                               const ImageOutport& outport) -> Frame {
+    const auto dimensions = outport.getDimensions();
+    if (!isChecked()) {
+        nextFrame_ = 0;
+        interactive_ = false;
+        dimensions_ = dimensions;
+        return {0, false, 1.0f, 0.5f};
+    }
+
+    const bool changed =
+        interactive_ || dimensions != dimensions_ ||
+        std::ranges::any_of(processor.getInports(), [](Inport* p) { return p->isChanged(); }) ||
+        std::ranges::any_of(processor.getPropertiesRecursive(),
+                            [](Property* p) { return p->isModified(); });
+    dimensions_ = dimensions;
+
+    auto* app = InviwoApplication::getPtr();
+    interactive_ = changed && app && app->getInteractionState().isInteracting();
+    if (interactive_) {
+        nextFrame_ = 0;
+        return {0, true, interactionSamplingRate_.get(), 0.5f};
+    }
+
+    if (changed) nextFrame_ = 0;
+    const auto index = nextFrame_++;
+    return {index, false, 1.0f, rayOffset(index)};
+}
+
+void ProgressiveRefinementProperty::endFrame(Processor& processor, const Frame& frame) {
+    if (!isChecked() || frame.interactive || frame.index + 1 >= refinementFrames_.get()) return;
+
+    dispatchFront([weakProcessor = processor.weak_from_this()]() {
+        if (auto p = weakProcessor.lock()) {
+            p->invalidate(InvalidationLevel::InvalidOutput);
+        }
+    });
+}
+
+void ProgressiveRefinementProperty::setUniforms(Shader& shader, const Frame& frame) const {
+    shader.setUniform("samplingRateScale", frame.samplingRateScale);
+    shader.setUniform("rayOffset", frame.rayOffset);
+}
+
+void ProgressiveRefinementProperty::onInteraction(bool interacting) {
+    // Render the first full quality frame once the interaction is over
+    if (interacting || !interactive_) return;
+    if (auto* processor = getOwner() ? getOwner()->getProcessor() : nullptr) {
+        processor->invalidate(InvalidationLevel::InvalidOutput);
+    }
+}
+
+ProgressiveRefinementProperty::Target::Target(ImageOutport& outport, const Frame& frame) {
+    if (frame.index == 0) {
+        utilgl::activateAndClearTarget(outport);
+    } else {
+        utilgl::activateTarget(outport);
+        depthTest_.emplace(GL_DEPTH_TEST, false);
+        blend_.emplace(GL_CONSTANT_ALPHA, GL_ONE_MINUS_CONSTANT_ALPHA);
+        const auto weight = 1.0f / static_cast<float>(frame.index + 1);
+        glBlendColor(weight, weight, weight, weight);
+    }
+}
+
+ProgressiveRefinementProperty::Target::~Target() {
+    blend_.reset();
+    depthTest_.reset();
+    utilgl::deactivateCurrentTarget();
+}
+
+}  // namespace inviwo
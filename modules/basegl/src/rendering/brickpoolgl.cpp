@@ -0,0 +1,212 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/rendering/brickpoolgl.h>
+
+#include <inviwo/core/datastructures/volume/volumebricked.h>  // for VolumeBricked
+#include <inviwo/core/util/exception.h>                       // for Exception
+#include <inviwo/core/util/indexmapper.h>                     // for IndexMapper3D
+#include <inviwo/core/util/stringconversion.h>                // for StrBuffer
+#include <modules/opengl/glformats.h>                         // for GLFormats
+#include <modules/opengl/inviwoopengl.h>                      // for GL_SHADER_STORAGE_BUFFER
+#include <modules/opengl/shader/shader.h>                     // for Shader
+#include <modules/opengl/texture/texture3d.h>                 // for Texture3D
+#include <modules/opengl/texture/textureunit.h>               // for TextureUnit, TextureUnit...
+#include <modules/opengl/texture/textureutils.h>              // for bindTexture
+
+#include <algorithm>   // for clamp, sort, fill, min
+#include <bit>         // for countr_zero
+#include <cmath>       // for cbrt
+#include <functional>  // for greater
+
+#include <glm/gtx/component_wise.hpp>  // for compMul
+
+namespace inviwo {
+
+BrickPoolGL::BrickPoolGL()
+    : volume_{}
+    , capacity_{0}
+    , slotDims_{0}
+    , atlas_{}
+    , pageTable_{}
+    , feedback_{}
+    , slots_{}
+    , frame_{0}
+    , pageTableBuffer_{0, GLFormats::getGLFormat(GL_UNSIGNED_INT, 1), GL_DYNAMIC_DRAW,
+                       GL_SHADER_STORAGE_BUFFER}
+    , feedbackBuffer_{0, GLFormats::getGLFormat(GL_UNSIGNED_INT, 1), GL_DYNAMIC_READ,
+                      GL_SHADER_STORAGE_BUFFER} {}
+
+BrickPoolGL::~BrickPoolGL() = default;
+
+void BrickPoolGL::setVolume(std::shared_ptr<const VolumeBricked> volume, size_t capacityInBytes) {
+    if (volume == volume_ && capacityInBytes == capacity_) return;
+
+    volume_ = std::move(volume);
+    capacity_ = capacityInBytes;
+    atlas_.reset();
+    pageTable_.clear();
+    feedback_.clear();
+    slots_.clear();
+    frame_ = 0;
+
+    if (!volume_) return;
+
+    if (volume_->getLevels().size() > maxLevels) {
+        throw Exception(SourceContext{}, "Bricked volume has {} levels, at most {} are supported",
+                        volume_->getLevels().size(), maxLevels);
+    }
+
+    const auto storedDims = volume_->getStoredBrickDimensions();
+    GLint maxTextureSize = 0;
+    glGetIntegerv(GL_MAX_3D_TEXTURE_SIZE, &maxTextureSize);
+    const auto maxSlots = std::max(size_t{1}, static_cast<size_t>(maxTextureSize) / storedDims.x);
+    const auto count = std::max(size_t{1}, capacity_ / volume_->getStoredBrickSizeInBytes());
+    const auto side = std::clamp(static_cast<size_t>(std::cbrt(static_cast<double>(count))),
+                                 size_t{1}, maxSlots);
+    slotDims_ = size3_t{side, side, std::clamp(count / (side * side), size_t{1}, maxSlots)};
+
+    atlas_ = std::make_unique<Texture3D>(slotDims_ * storedDims,
+                                         GLFormats::get(volume_->getDataFormatId()), GL_LINEAR,
+                                         volume_->getSwizzleMask());
+    atlas_->initialize(nullptr);
+
+    pageTable_.assign(volume_->getNumberOfBricks(), 0);
+    feedback_.assign((volume_->getNumberOfBricks() + 31) / 32, 0);
+    slots_.assign(glm::compMul(slotDims_), Slot{noBrick, 0});
+
+    // The coarsest level is a single brick, keep it in the first slot so there is always
+    // something to fall back to.
+    upload(volume_->getNumberOfBricks() - 1, 0);
+    slots_[0].lastUsed = ~std::uint64_t{0};
+
+    pageTableBuffer_.upload(pageTable_, BufferObject::SizePolicy::ResizeToFit);
+    feedbackBuffer_.upload(feedback_, BufferObject::SizePolicy::ResizeToFit);
+}
+
+const VolumeBricked* BrickPoolGL::getVolume() const { return volume_.get(); }
+
+bool BrickPoolGL::update(size_t maxUploads) {
+    if (!volume_) return false;
+
+    ++frame_;
+    feedbackBuffer_.download(feedback_.data());
+
+    std::vector<std::uint32_t> missing;
+    for (size_t word = 0; word < feedback_.size(); ++word) {
+        for (auto bits = feedback_[word]; bits != 0; bits &= bits - 1) {
+            const auto brick = static_cast<std::uint32_t>(word * 32 + std::countr_zero(bits));
+            if (const auto slot = pageTable_[brick]; slot != 0) {
+                slots_[slot - 1].lastUsed = std::max(slots_[slot - 1].lastUsed, frame_);
+            } else {
+                missing.push_back(brick);
+            }
+        }
+    }
+
+    std::ranges::fill(feedback_, 0u);
+    feedbackBuffer_.upload(feedback_);
+
+    if (missing.empty()) return false;
+
+    // Bricks of coarser levels have higher indices, load them first for a progressive refinement
+    std::ranges::sort(missing, std::greater<>{});
+
+    // Only evict bricks that were not used in this frame, least recently used first
+    std::vector<size_t> candidates;
+    for (size_t i = 0; i < slots_.size(); ++i) {
+        if (slots_[i].lastUsed < frame_) candidates.push_back(i);
+    }
+    std::ranges::sort(candidates, {}, [&](size_t i) { return slots_[i].lastUsed; });
+
+    const auto uploads = std::min({maxUploads, missing.size(), candidates.size()});
+    for (size_t i = 0; i < uploads; ++i) {
+        upload(missing[i], candidates[i]);
+    }
+    if (uploads > 0) {
+        pageTableBuffer_.upload(pageTable_);
+    }
+    return uploads > 0;
+}
+
+void BrickPoolGL::upload(size_t brick, size_t slot) {
+    auto& current = slots_[slot];
+    if (current.brick != noBrick) pageTable_[current.brick] = 0;
+
+    const auto dims = volume_->getStoredBrickDimensions();
+    const auto pos = util::IndexMapper3D{slotDims_}(slot) * dims;
+    const auto data = volume_->getBrick(brick);
+
+    atlas_->bind();
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage3D(GL_TEXTURE_3D, 0, static_cast<GLint>(pos.x), static_cast<GLint>(pos.y),
+                    static_cast<GLint>(pos.z), static_cast<GLsizei>(dims.x),
+                    static_cast<GLsizei>(dims.y), static_cast<GLsizei>(dims.z),
+                    atlas_->getFormat(), atlas_->getDataType(), data.data());
+    LGL_ERROR;
+
+    current = Slot{static_cast<std::uint32_t>(brick), frame_};
+    pageTable_[brick] = static_cast<std::uint32_t>(slot + 1);
+}
+
+void BrickPoolGL::bind(Shader& shader, TextureUnitContainer& cont, std::string_view name) const {
+    if (!volume_) throw Exception("No bricked volume set");
+
+    TextureUnit unit;
+    utilgl::bindTexture(*atlas_, unit);
+    shader.setUniform(name, unit.getUnitNumber());
+    cont.push_back(std::move(unit));
+
+    StrBuffer buff;
+    const auto& levels = volume_->getLevels();
+    shader.setUniform("brickLevelCount", static_cast<int>(levels.size()));
+    for (size_t i = 0; i < levels.size(); ++i) {
+        shader.setUniform(buff.replace("brickLevels[{}].dimensions", i),
+                          vec3(levels[i].dimensions));
+        shader.setUniform(buff.replace("brickLevels[{}].bricks", i), ivec3(levels[i].bricks));
+        shader.setUniform(buff.replace("brickLevels[{}].firstBrick", i),
+                          static_cast<int>(levels[i].firstBrick));
+    }
+    shader.setUniform("brickSize", static_cast<int>(volume_->getBrickSize()));
+    shader.setUniform("brickSlots", ivec3(slotDims_));
+    shader.setUniform("brickAtlasReciprocalDimensions",
+                      vec3(1.0f) / vec3(atlas_->getDimensions()));
+
+    pageTableBuffer_.bindBase(pageTableBinding);
+    feedbackBuffer_.bindBase(feedbackBinding);
+}
+
+size_t BrickPoolGL::getSlots() const { return slots_.size(); }
+
+size_t BrickPoolGL::getResidentBricks() const {
+    return static_cast<size_t>(
+        std::ranges::count_if(slots_, [](const Slot& s) { return s.brick != noBrick; }));
+}
+
+}  // namespace inviwo
@@ -0,0 +1,239 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/rendering/emptyspaceskippinggl.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>         // for Volume
+#include <inviwo/core/properties/isotfproperty.h>             // for IsoTFProperty
+#include <inviwo/core/properties/transferfunctionproperty.h>  // for TransferFunctionProperty
+#include <inviwo/core/util/exception.h>                       // for Exception
+#include <inviwo/core/util/sourcecontext.h>                   // for SourceContext
+#include <inviwo/core/util/formats.h>                         // for DataFormatId
+#include <inviwo/core/util/stringconversion.h>                // for StrBuffer
+#include <modules/opengl/glformats.h>                         // for GLFormats
+#include <modules/opengl/inviwoopengl.h>                      // for glDispatchCompute, glMemoryB...
+#include <modules/opengl/openglcapabilities.h>                // for OpenGLCapabilities
+#include <modules/opengl/openglutils.h>                       // for Activate
+#include <modules/opengl/shader/shaderobject.h>               // for ShaderObject
+#include <modules/opengl/texture/texture3d.h>                 // for Texture3D
+#include <modules/opengl/texture/textureunit.h>               // for TextureUnit, TextureUnitCont...
+#include <modules/opengl/texture/textureutils.h>              // for bindTexture
+#include <modules/opengl/volume/volumeutils.h>                // for bindAndSetUniforms
+
+#include <algorithm>  // for max
+#include <numeric>    // for iota
+
+namespace inviwo {
+
+namespace {
+
+// Has to match local_size_x, _y, and _z of the compute shaders
+constexpr uvec3 groupSize{4, 4, 4};
+
+void dispatch(size3_t dims) {
+    const uvec3 numGroups{(uvec3{dims} + groupSize - uvec3{1}) / groupSize};
+    glDispatchCompute(numGroups.x, numGroups.y, numGroups.z);
+}
+
+}  // namespace
+
+EmptySpaceSkippingGL::EmptySpaceSkippingGL(size_t cellSize)
+    : cellSize_{std::max(cellSize, size_t{1})}
+    , minMaxShader_{{{ShaderType::Compute, "compute/minmaxgrid.comp"}}, Shader::Build::No}
+    , occupancyShader_{{{ShaderType::Compute, "compute/occupancygrid.comp"}}, Shader::Build::No}
+    , min_{}
+    , max_{}
+    , occupancy_{}
+    , scale_{1.0f}
+    , maxIsovalues_{1}
+    , shaderChannels_{1}
+    , volume_{nullptr}
+    , channels_{}
+    , transferFunction_{true}
+    , isovalues_{true}
+    , gridValid_{false}
+    , occupancyValid_{false} {}
+
+EmptySpaceSkippingGL::~EmptySpaceSkippingGL() = default;
+
+bool EmptySpaceSkippingGL::isSupportedByGPU() {
+    return OpenGLCapabilities::isComputeShadersSupported();
+}
+
+void EmptySpaceSkippingGL::invalidateGrid() { gridValid_ = false; }
+
+void EmptySpaceSkippingGL::invalidateOccupancy() { occupancyValid_ = false; }
+
+void EmptySpaceSkippingGL::update(const Volume& volume, size_t channel, IsoTFProperty& isotf,
+                                  bool transferFunction, bool isovalues) {
+    updateGrid(volume);
+
+    const std::vector<int> channels{static_cast<int>(channel)};
+    if (channels_ != channels || transferFunction_ != transferFunction ||
+        isovalues_ != isovalues) {
+        channels_ = channels;
+        transferFunction_ = transferFunction;
+        isovalues_ = isovalues;
+        occupancyValid_ = false;
+    }
+
+    if (!occupancyValid_) {
+        TransferFunctionProperty* tf = &isotf.tf_;
+        computeOccupancy({&tf, 1}, isovalues_ ? isotf.isovalues_.get().getVectorsf().first
+                                              : std::vector<float>{});
+        occupancyValid_ = true;
+    }
+}
+
+void EmptySpaceSkippingGL::update(const Volume& volume, std::span<TransferFunctionProperty> tfs) {
+    if (tfs.empty() || tfs.size() > 4) {
+        throw Exception(SourceContext{}, "Expected one to four transfer functions, got {}",
+                        tfs.size());
+    }
+    updateGrid(volume);
+
+    std::vector<int> channels(tfs.size());
+    std::iota(channels.begin(), channels.end(), 0);
+    if (channels_ != channels || !transferFunction_ || isovalues_) {
+        channels_ = std::move(channels);
+        transferFunction_ = true;
+        isovalues_ = false;
+        occupancyValid_ = false;
+    }
+
+    if (!occupancyValid_) {
+        std::vector<TransferFunctionProperty*> tfPtrs;
+        for (auto& tf : tfs) tfPtrs.push_back(&tf);
+        computeOccupancy(tfPtrs, {});
+        occupancyValid_ = true;
+    }
+}
+
+void EmptySpaceSkippingGL::updateGrid(const Volume& volume) {
+    if (volume_ != &volume) {
+        volume_ = &volume;
+        gridValid_ = false;
+    }
+    if (!gridValid_) {
+        computeGrid(volume);
+        gridValid_ = true;
+        occupancyValid_ = false;
+    }
+}
+
+void EmptySpaceSkippingGL::computeGrid(const Volume& volume) {
+    const auto dims = volume.getDimensions();
+    const auto gridDims = (dims + size3_t{cellSize_ - 1}) / size3_t{cellSize_};
+
+    if (!occupancy_ || occupancy_->getDimensions() != gridDims) {
+        const auto create = [&](DataFormatId format) {
+            auto texture =
+                std::make_unique<Texture3D>(gridDims, GLFormats::get(format), GL_NEAREST);
+            texture->initialize(nullptr);
+            return texture;
+        };
+        min_ = create(DataFormatId::Vec4Float32);
+        max_ = create(DataFormatId::Vec4Float32);
+        occupancy_ = create(DataFormatId::Vec4UInt8);
+    }
+    scale_ = vec3{dims} / static_cast<float>(cellSize_);
+
+    if (!minMaxShader_.isReady()) minMaxShader_.build();
+    const utilgl::Activate activateShader{&minMaxShader_};
+
+    TextureUnitContainer units;
+    utilgl::bindAndSetUniforms(minMaxShader_, units, volume, "volume");
+    minMaxShader_.setUniform("cellSize", static_cast<int>(cellSize_));
+
+    glBindImageTexture(0, min_->getID(), 0, GL_TRUE, 0, GL_WRITE_ONLY, min_->getInternalFormat());
+    glBindImageTexture(1, max_->getID(), 0, GL_TRUE, 0, GL_WRITE_ONLY, max_->getInternalFormat());
+    dispatch(gridDims);
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+}
+
+void EmptySpaceSkippingGL::computeOccupancy(std::span<TransferFunctionProperty* const> tfs,
+                                            const std::vector<float>& isovalues) {
+    auto* cso = occupancyShader_.getComputeShaderObject();
+    // The isovalues and transfer functions are stored in uniform arrays which need a fixed size
+    if (isovalues.size() > maxIsovalues_) {
+        maxIsovalues_ = isovalues.size();
+        cso->addShaderDefine("MAX_ISOVALUE_COUNT", StrBuffer{"{}", maxIsovalues_});
+        occupancyShader_.invalidate();
+    }
+    if (tfs.size() != shaderChannels_) {
+        shaderChannels_ = tfs.size();
+        cso->addShaderDefine("CHANNEL_COUNT", StrBuffer{"{}", shaderChannels_});
+        occupancyShader_.invalidate();
+    }
+    if (!occupancyShader_.isReady()) occupancyShader_.build();
+    const utilgl::Activate activateShader{&occupancyShader_};
+
+    TextureUnitContainer units;
+    StrBuffer buff;
+    for (size_t i = 0; i < tfs.size(); ++i) {
+        TextureUnit unit;
+        utilgl::bindTexture(*tfs[i], unit);
+        occupancyShader_.setUniform(buff.replace("transferFunctions[{}]", i), unit);
+        units.push_back(std::move(unit));
+    }
+    occupancyShader_.setUniform("channels", channels_);
+    occupancyShader_.setUniform("useTransferFunction", transferFunction_);
+    occupancyShader_.setUniform("isovalueCount", static_cast<int>(isovalues.size()));
+    if (!isovalues.empty()) {
+        occupancyShader_.setUniform("isovalues", isovalues);
+    }
+
+    glBindImageTexture(0, min_->getID(), 0, GL_TRUE, 0, GL_READ_ONLY, min_->getInternalFormat());
+    glBindImageTexture(1, max_->getID(), 0, GL_TRUE, 0, GL_READ_ONLY, max_->getInternalFormat());
+    glBindImageTexture(2, occupancy_->getID(), 0, GL_TRUE, 0, GL_WRITE_ONLY,
+                       occupancy_->getInternalFormat());
+    dispatch(occupancy_->getDimensions());
+    glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+}
+
+void EmptySpaceSkippingGL::bind(Shader& shader, TextureUnitContainer& cont,
+                                std::string_view name) const {
+    if (!occupancy_) throw Exception("The occupancy grid has not been computed");
+
+    TextureUnit unit;
+    utilgl::bindTexture(*occupancy_, unit);
+    shader.setUniform(name, unit);
+    cont.push_back(std::move(unit));
+
+    StrBuffer buff;
+    shader.setUniform(buff.replace("{}Parameters.scale", name), scale_);
+}
+
+size_t EmptySpaceSkippingGL::getCellSize() const { return cellSize_; }
+
+size3_t EmptySpaceSkippingGL::getGridDimensions() const {
+    return occupancy_ ? occupancy_->getDimensions() : size3_t{0};
+}
+
+}  // namespace inviwo
@@ -0,0 +1,229 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/rendering/glyphcullinggl.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>          // for BufferBase
+#include <inviwo/core/datastructures/geometry/geometrytype.h>  // for BufferType
+#include <inviwo/core/datastructures/geometry/mesh.h>          // for Mesh
+#include <inviwo/core/util/formats.h>                          // for DataFormatId, NumericType
+#include <inviwo/core/util/glmvec.h>                           // for size2_t, uvec2
+#include <modules/opengl/buffer/buffergl.h>                    // for BufferGL
+#include <modules/opengl/buffer/bufferobject.h>                // for BufferObject
+#include <modules/opengl/geometry/meshgl.h>                    // for MeshGL
+#include <modules/opengl/glformats.h>                          // for GLFormats
+#include <modules/opengl/image/layergl.h>                      // for LayerGL
+#include <modules/opengl/inviwoopengl.h>                       // for glDispatchCompute, glMemory...
+#include <modules/opengl/openglcapabilities.h>                 // for OpenGLCapabilities
+#include <modules/opengl/openglutils.h>                        // for Activate
+#include <modules/opengl/texture/texture2d.h>                  // for Texture2D
+#include <modules/opengl/texture/textureunit.h>                // for TextureUnit
+#include <modules/opengl/texture/textureutils.h>               // for bindTexture
+
+#include <array>    // for array
+#include <cmath>    // for log2, floor
+#include <cstdint>  // for uint32_t
+
+#include <glm/gtx/component_wise.hpp>  // for compMax
+
+namespace inviwo {
+
+namespace {
+
+// Has to match the local sizes of the compute shaders
+constexpr GLuint pyramidGroupSize = 8;
+constexpr GLuint cullGroupSize = 256;
+
+// Matches the layout of DrawElementsIndirectCommand in the OpenGL specification
+struct DrawCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance;
+};
+constexpr std::array<DrawCommand, 2> emptyCommands{DrawCommand{0, 1, 0, 0, 0},
+                                                   DrawCommand{0, 1, 0, 0, 0}};
+
+std::unique_ptr<BufferObject> createBuffer(size_t sizeInBytes) {
+    return std::make_unique<BufferObject>(sizeInBytes, GLFormats::get(DataFormatId::UInt32),
+                                          GL_DYNAMIC_DRAW, GL_SHADER_STORAGE_BUFFER);
+}
+
+void bindStorage(GLuint index, const BufferBase& buffer) {
+    const auto& obj = buffer.getRepresentation<BufferGL>()->getBufferObject();
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, obj->getId());
+}
+
+}  // namespace
+
+GlyphCullingGL::GlyphCullingGL()
+    : pyramidShader_{{{ShaderType::Compute, "compute/depthpyramid.comp"}}, Shader::Build::No}
+    , cullShader_{{{ShaderType::Compute, "compute/glyphculling.comp"}}, Shader::Build::No}
+    , pyramid_{}
+    , levels_{0}
+    , hasDepth_{false}
+    , states_{} {}
+
+GlyphCullingGL::~GlyphCullingGL() = default;
+
+bool GlyphCullingGL::isSupportedByGPU() { return OpenGLCapabilities::isComputeShadersSupported(); }
+
+bool GlyphCullingGL::isCullable(const Mesh& mesh) {
+    const auto [positions, loc] = mesh.findBuffer(BufferType::PositionAttrib);
+    if (!positions || positions->getDataFormat()->getNumericType() != NumericType::Float ||
+        positions->getDataFormat()->getPrecision() != 32 ||
+        positions->getDataFormat()->getComponents() < 2) {
+        return false;
+    }
+    const auto [radii, radiiLoc] = mesh.findBuffer(BufferType::RadiiAttrib);
+    return !radii || radii->getDataFormat()->getId() == DataFormatId::Float32;
+}
+
+auto GlyphCullingGL::getState(size_t id, const Mesh& mesh) -> State& {
+    if (states_.size() <= id) states_.resize(id + 1);
+    auto& state = states_[id];
+
+    const auto glyphs = mesh.getBuffer(BufferType::PositionAttrib)->getSize();
+    if (state.mesh != &mesh || state.glyphs != glyphs) {
+        state.mesh = &mesh;
+        state.glyphs = glyphs;
+        // Nothing has been drawn yet, i.e. everything visible will be revealed in the next cull
+        const std::vector<std::uint32_t> zeros(glyphs, 0);
+        state.visibility = createBuffer(glyphs * sizeof(std::uint32_t));
+        state.visibility->upload(zeros);
+        state.visible = createBuffer(glyphs * sizeof(std::uint32_t));
+        state.revealed = createBuffer(glyphs * sizeof(std::uint32_t));
+        state.commands = createBuffer(sizeof(emptyCommands));
+        state.commands->upload(emptyCommands);
+    }
+    return state;
+}
+
+void GlyphCullingGL::draw(size_t id, const Mesh& mesh, List list) const {
+    if (id >= states_.size() || states_[id].mesh != &mesh) return;
+    const auto& state = states_[id];
+    const auto& indices = list == List::Visible ? state.visible : state.revealed;
+    const auto offset = list == List::Visible ? 0 : sizeof(DrawCommand);
+
+    const auto* meshGL = mesh.getRepresentation<MeshGL>();
+    meshGL->enable();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indices->getId());
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, state.commands->getId());
+    glDrawElementsIndirect(GL_POINTS, GL_UNSIGNED_INT, reinterpret_cast<const void*>(offset));
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    meshGL->disable();
+}
+
+void GlyphCullingGL::updateDepth(const LayerGL& depth) {
+    const auto dims = depth.getDimensions();
+    if (!pyramid_ || pyramid_->getDimensions() != dims) {
+        pyramid_ = std::make_unique<Texture2D>(dims, GLFormats::get(DataFormatId::Float32),
+                                               GL_NEAREST);
+        pyramid_->initialize(nullptr);
+
+        levels_ = 1 + static_cast<int>(std::floor(std::log2(glm::compMax(dims))));
+        pyramid_->bind();
+        for (int level = 1; level < levels_; ++level) {
+            const auto size = glm::max(dims >> size2_t{static_cast<size_t>(level)}, size2_t{1});
+            glTexImage2D(GL_TEXTURE_2D, level, GL_R32F, static_cast<GLsizei>(size.x),
+                         static_cast<GLsizei>(size.y), 0, GL_RED, GL_FLOAT, nullptr);
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels_ - 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+        pyramid_->unbind();
+    }
+
+    if (!pyramidShader_.isReady()) pyramidShader_.build();
+    const utilgl::Activate activateShader{&pyramidShader_};
+
+    TextureUnit unit;
+    for (int level = 0; level < levels_; ++level) {
+        if (level == 0) {
+            utilgl::bindTexture(*depth.getTexture(), unit);
+        } else {
+            utilgl::bindTexture(*pyramid_, unit);
+        }
+        pyramidShader_.setUniform("source", unit);
+        pyramidShader_.setUniform("sourceLevel", level == 0 ? 0 : level - 1);
+
+        const auto size = glm::max(dims >> size2_t{static_cast<size_t>(level)}, size2_t{1});
+        glBindImageTexture(0, pyramid_->getID(), level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+        const auto groups = (uvec2{size} + uvec2{pyramidGroupSize - 1}) / pyramidGroupSize;
+        glDispatchCompute(groups.x, groups.y, 1);
+        glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+    }
+    hasDepth_ = true;
+}
+
+void GlyphCullingGL::cull(size_t id, const Mesh& mesh, const mat4& worldToClip, float radius,
+                          bool useRadii) {
+    auto& state = getState(id, mesh);
+    if (state.glyphs == 0) return;
+
+    if (!cullShader_.isReady()) cullShader_.build();
+    const utilgl::Activate activateShader{&cullShader_};
+
+    const auto* positions = mesh.getBuffer(BufferType::PositionAttrib);
+    const auto* radii = useRadii ? mesh.getBuffer(BufferType::RadiiAttrib) : nullptr;
+
+    state.commands->upload(emptyCommands);
+    bindStorage(0, *positions);
+    bindStorage(1, radii ? *radii : *positions);
+    state.visibility->bindBase(2);
+    state.visible->bindBase(3);
+    state.revealed->bindBase(4);
+    state.commands->bindBase(5);
+
+    cullShader_.setUniform("glyphCount", static_cast<std::uint32_t>(state.glyphs));
+    cullShader_.setUniform("positionComponents",
+                           static_cast<int>(positions->getDataFormat()->getComponents()));
+    cullShader_.setUniform("hasRadii", radii != nullptr);
+    cullShader_.setUniform("radius", radius);
+    cullShader_.setUniform("dataToWorld", mesh.getCoordinateTransformer().getDataToWorldMatrix());
+    cullShader_.setUniform("worldToClip", worldToClip);
+
+    TextureUnit unit;
+    cullShader_.setUniform("useOcclusion", hasDepth_);
+    if (hasDepth_) {
+        utilgl::bindTexture(*pyramid_, unit);
+        cullShader_.setUniform("depthPyramid", unit);
+        cullShader_.setUniform("depthPyramidLevels", levels_);
+    }
+
+    const auto groups = static_cast<GLuint>((state.glyphs + cullGroupSize - 1) / cullGroupSize);
+    glDispatchCompute(groups, 1, 1);
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT |
+                    GL_SHADER_STORAGE_BARRIER_BIT);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, 0);
+}
+
+}  // namespace inviwo
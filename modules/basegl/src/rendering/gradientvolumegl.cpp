@@ -0,0 +1,122 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/rendering/gradientvolumegl.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>  // for Volume
+#include <inviwo/core/util/exception.h>                // for Exception
+#include <inviwo/core/util/glmvec.h>                   // for size3_t
+#include <modules/opengl/inviwoopengl.h>               // for glViewport, GLsizei
+#include <modules/opengl/openglutils.h>                // for Activate
+#include <modules/opengl/shader/shaderobject.h>        // for ShaderObject
+#include <modules/opengl/shader/shadertype.h>          // for ShaderType
+#include <modules/opengl/shader/shaderutils.h>         // for findShaderResource
+#include <modules/opengl/texture/texture3d.h>          // for Texture3D
+#include <modules/opengl/texture/textureunit.h>        // for TextureUnit, TextureUnitContainer
+#include <modules/opengl/texture/textureutils.h>       // for bindTexture, multiDrawImagePlaneRect
+#include <modules/opengl/volume/volumeutils.h>         // for bindAndSetUniforms
+
+namespace inviwo {
+
+GradientVolumeGL::GradientVolumeGL()
+    : shader_{{{ShaderType::Vertex, utilgl::findShaderResource("volume_gpu.vert")},
+               {ShaderType::Geometry, utilgl::findShaderResource("volume_gpu.geom")},
+               {ShaderType::Fragment, utilgl::findShaderResource("volume_gradient.frag")}},
+              Shader::Build::No}
+    , fbo_{}
+    , gradients_{}
+    , volume_{nullptr}
+    , channel_{0}
+    , valid_{false} {
+    shader_.getFragmentShaderObject()->addShaderDefine("PACKED_GRADIENT");
+}
+
+GradientVolumeGL::~GradientVolumeGL() = default;
+
+void GradientVolumeGL::invalidate() { valid_ = false; }
+
+void GradientVolumeGL::update(const Volume& volume, size_t channel) {
+    if (volume_ != &volume || channel_ != channel) {
+        volume_ = &volume;
+        channel_ = channel;
+        valid_ = false;
+    }
+    if (!valid_) {
+        compute(volume);
+        valid_ = true;
+    }
+}
+
+void GradientVolumeGL::compute(const Volume& volume) {
+    const size3_t dims = volume.getDimensions();
+    if (!gradients_ || gradients_->getDimensions() != dims) {
+        gradients_ = std::make_unique<Texture3D>(dims, GL_RGBA, GL_RGB10_A2,
+                                                 GL_UNSIGNED_INT_2_10_10_10_REV, GL_LINEAR);
+        gradients_->initialize(nullptr);
+        fbo_.activate();
+        fbo_.attachColorTexture(gradients_.get(), 0);
+        fbo_.deactivate();
+    }
+
+    if (!shader_.isReady()) shader_.build();
+    const utilgl::Activate activateShader{&shader_};
+
+    TextureUnitContainer units;
+    utilgl::bindAndSetUniforms(shader_, units, volume, "volume");
+    shader_.setUniform("channel", static_cast<int>(channel_));
+
+    const utilgl::Activate activateFbo{&fbo_};
+    glViewport(0, 0, static_cast<GLsizei>(dims.x), static_cast<GLsizei>(dims.y));
+    utilgl::multiDrawImagePlaneRect(static_cast<int>(dims.z));
+}
+
+void GradientVolumeGL::bind(Shader& shader, TextureUnitContainer& cont) const {
+    if (!gradients_) throw Exception(SourceContext{}, "The gradient volume has not been computed");
+
+    TextureUnit unit;
+    utilgl::bindTexture(*gradients_, unit);
+    shader.setUniform("gradientVolume", unit);
+    cont.push_back(std::move(unit));
+}
+
+void GradientVolumeGL::addShaderDefines(Shader& shader, bool enable) {
+    auto* fso = shader.getFragmentShaderObject();
+    if (enable) {
+        fso->addShaderDefine("GRADIENT_VOLUME");
+        fso->addShaderDefine("COMPUTE_GRADIENT(voxel, volume, volumeParams, samplePos)",
+                             "gradientPrecomputedVolume(samplePos)");
+        fso->addShaderDefine(
+            "COMPUTE_GRADIENT_FOR_CHANNEL(voxel, volume, volumeParams, samplePos, channel)",
+            "gradientPrecomputedVolume(samplePos)");
+    } else {
+        fso->removeShaderDefine("GRADIENT_VOLUME");
+    }
+}
+
+}  // namespace inviwo
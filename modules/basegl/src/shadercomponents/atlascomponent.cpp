@@ -31,9 +31,6 @@
 
 #include <inviwo/core/datastructures/bitset.h>                          // for BitSet, BitSet::B...
 #include <inviwo/core/datastructures/datamapper.h>                      // for DataMapper
-#include <inviwo/core/datastructures/image/imagetypes.h>                // for InterpolationType
-#include <inviwo/core/datastructures/image/layer.h>                     // for Layer
-#include <inviwo/core/datastructures/image/layerram.h>                  // for LayerRAMPrecision
 #include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/tfprimitive.h>                     // for TFPrimitive
@@ -55,7 +52,6 @@
 #include <inviwo/core/util/colorbrewer.h>                               // for getColormap, getF...
 #include <inviwo/core/util/formats.h>                                   // for DataFormat
 #include <inviwo/core/util/glmvec.h>                                    // for vec4, vec3, size2_t
-#include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
 #include <inviwo/core/util/staticstring.h>                              // for operator+
 #include <inviwo/core/util/stdextensions.h>                             // for any_of, ref
 #include <inviwo/core/util/stringconversion.h>                          // for trim
@@ -63,13 +59,14 @@
 #include <modules/basegl/shadercomponents/shadercomponent.h>            // for ShaderComponent::...
 #include <modules/basegl/shadercomponents/timecomponent.h>              // for TimeComponent
 #include <modules/brushingandlinking/ports/brushingandlinkingports.h>   // for BrushingAndLinkin...
-#include <modules/opengl/image/layergl.h>                               // for LayerGL
+#include <modules/opengl/buffer/bufferobject.h>                         // for BufferObject
+#include <modules/opengl/glformats.h>                                   // for GLFormats
+#include <modules/opengl/inviwoopengl.h>                                // for GLintptr, GLsizeiptr
 #include <modules/opengl/shader/shader.h>                               // for Shader
-#include <modules/opengl/texture/texture2d.h>                           // for Texture2D
 #include <modules/opengl/texture/textureutils.h>                        // for bindAndSetUniforms
 #include <modules/opengl/volume/volumeutils.h>                          // for bindAndSetUniforms
 
-#include <algorithm>      // for clamp, fill_n
+#include <algorithm>      // for clamp
 #include <array>          // for array
 #include <cstddef>        // for size_t
 #include <cstdint>        // for uint32_t
@@ -80,15 +77,15 @@
 #include <type_traits>    // for remove_extent_t
 #include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
+#include <utility>        // for pair
 
-#include <fmt/core.h>                  // for format
-#include <fmt/format.h>                // for operator""_a, udl...
-#include <glm/common.hpp>              // for mix
-#include <glm/fwd.hpp>                 // for uint8
-#include <glm/gtx/component_wise.hpp>  // for compMul
-#include <glm/vec2.hpp>                // for vec<>::(anonymous)
-#include <glm/vec3.hpp>                // for operator*, operator+
-#include <glm/vec4.hpp>                // for vec
+#include <fmt/core.h>      // for format
+#include <fmt/format.h>    // for operator""_a, udl...
+#include <glm/common.hpp>  // for mix
+#include <glm/fwd.hpp>     // for uint8
+#include <glm/vec2.hpp>    // for vec<>::(anonymous)
+#include <glm/vec3.hpp>    // for operator*, operator+
+#include <glm/vec4.hpp>    // for vec
 
 namespace inviwo {
 class Inport;
@@ -96,6 +93,9 @@ class TextureUnitContainer;
 
 namespace {
 
+// Binding point of the shader storage buffer with the segment colors
+constexpr GLuint colorsBinding = 0;
+
 OrdinalPropertyState<float> ordinalAlpha(
     const float& value, InvalidationLevel invalidationLevel = InvalidationLevel::InvalidOutput) {
     return {value,
@@ -180,16 +180,12 @@ AtlasComponent::AtlasComponent(Processor* p, std::string_view color, TimeCompone
                           [&]() { coloringAction_ = ColoringAction::SetScheme; }},
                      }}
     , coloringAction_{ColoringAction::None}
-    , colors_{size2_t{64, 2},     DataFormat<vec4>::get(),    LayerType::Color,
-              swizzlemasks::rgba, InterpolationType::Nearest, wrapping2d::clampAll}
+    , colors_{}
+    , colorsBuffer_{}
     , color_{color}
     , picking_{p, 0, [this](PickingEvent* e) { onPickingEvent(e); }}
     , minSegmentId_{0}
-    , time_{time} {
-
-    auto lrp = static_cast<LayerRAMPrecision<vec4>*>(colors_.getEditableRepresentation<LayerRAM>());
-    std::fill_n(lrp->getDataTyped(), glm::compMul(lrp->getDimensions()), vec4(1.0));
-}
+    , time_{time} {}
 
 std::string_view AtlasComponent::getName() const { return atlas_.getIdentifier(); }
 
@@ -296,68 +292,112 @@ void AtlasComponent::process(Shader& shader, TextureUnitContainer& cont) {
     const auto colorProps =
         util::ref<Property>(tf_, selectionColor_, selectionAlpha_, selectionMix_, filteredColor_,
                             filteredAlpha_, filteredMix_);
-    if (colors_.getDimensions().x != nSegments || brushing_.isChanged() ||
-        util::any_of(colorProps, &Property::isModified)) {
-
-        colors_.setDimensions(size2_t{nSegments, 2});
-        util::IndexMapper2D im(colors_.getDimensions());
-
-        auto indexCheck = [&](uint32_t i, std::string_view type) {
-            const auto ii = static_cast<int32_t>(i);
-            if (ii < minSegmentId_ || ii >= minSegmentId_ + static_cast<int32_t>(nSegments)) {
-                throw Exception(SourceContext{},
-                                "Found {} index {} outside of expected range [{},{}]", type, ii,
-                                minSegmentId_, minSegmentId_ + nSegments - 1);
-            }
-        };
 
-        auto lrp =
-            static_cast<LayerRAMPrecision<vec4>*>(colors_.getEditableRepresentation<LayerRAM>())
-                ->getDataTyped();
-
-        for (uint32_t i = 0; i < nSegments; ++i) {
-            auto color = tf_->sample(static_cast<double>(i) / (nSegments - 1));
-            lrp[im(i, 0)] = color;
-            lrp[im(i, 1)] = color;
+    const auto indexCheck = [&](const BitSet& indices, std::string_view type) {
+        if (indices.empty()) return;
+        const auto first = static_cast<int32_t>(indices.min());
+        const auto last = static_cast<int32_t>(indices.max());
+        if (first < minSegmentId_ || last >= minSegmentId_ + static_cast<int32_t>(nSegments)) {
+            throw Exception(SourceContext{}, "Found {} index {} outside of expected range [{},{}]",
+                            type, first < minSegmentId_ ? first : last, minSegmentId_,
+                            minSegmentId_ + nSegments - 1);
         }
+    };
 
-        auto mix = util::overloaded{
-            [&](auto i, const FloatVec3Property& color, const FloatProperty& mix,
-                const FloatProperty& alpha) {
-                return vec4{glm::mix(color.get(), vec3{lrp[im(i, 0)]}, mix.get()), alpha.get()};
-            },
-            [&](auto i, const vec3& color, const FloatProperty& mix, const FloatProperty& alpha) {
-                return vec4{glm::mix(color, vec3{lrp[im(i, 0)]}, mix.get()), alpha.get()};
-            }};
-
-        for (auto i : brushing_.getSelectedIndices()) {
-            indexCheck(i, "selection");
-            i -= minSegmentId_;
-            lrp[im(i, 0)] = mix(i, selectionColor_, selectionMix_, selectionAlpha_);
-            lrp[im(i, 1)] = mix(i, vec3{1.0, 1.0, 1.0}, selectionMix_, selectionAlpha_);
+    if (!colorsBuffer_ || colors_.size() != 2 * size_t{nSegments} ||
+        util::any_of(colorProps, &Property::isModified)) {
+        // Recompute and upload all colors
+        selected_ = brushing_.getSelectedIndices();
+        highlighted_ = brushing_.getHighlightedIndices();
+        filtered_ = brushing_.getFilteredIndices();
+        indexCheck(selected_, "selection");
+        indexCheck(highlighted_, "highlight");
+        indexCheck(filtered_, "filter");
+
+        colors_.resize(2 * size_t{nSegments});
+        for (uint32_t i = 0; i < nSegments; ++i) {
+            updateColors(i, nSegments);
         }
 
-        for (auto i : brushing_.getHighlightedIndices()) {
-            indexCheck(i, "highlight");
-            i -= minSegmentId_;
-            lrp[im(i, 0)] = mix(i, selectionColor_, selectionMix_, selectionAlpha_);
-            lrp[im(i, 1)] = mix(i, vec3{1.0, 1.0, 1.0}, selectionMix_, selectionAlpha_);
+        if (!colorsBuffer_) {
+            colorsBuffer_ = std::make_unique<BufferObject>(
+                colors_.size() * sizeof(vec4), GLFormats::get(DataFormatId::Vec4Float32),
+                GL_DYNAMIC_DRAW, GL_SHADER_STORAGE_BUFFER);
         }
-
-        for (auto i : brushing_.getFilteredIndices()) {
-            indexCheck(i, "filter");
-            i -= minSegmentId_;
-            lrp[im(i, 0)] = mix(i, filteredColor_, filteredMix_, filteredAlpha_);
-            lrp[im(i, 1)] = lrp[im(i, 0)];
+        colorsBuffer_->upload(colors_, BufferObject::SizePolicy::ResizeToFit);
+    } else if (brushing_.isChanged()) {
+        // Only update the segments whose brushing state has changed
+        auto modified = selected_ ^ brushing_.getSelectedIndices();
+        modified |= highlighted_ ^ brushing_.getHighlightedIndices();
+        modified |= filtered_ ^ brushing_.getFilteredIndices();
+        indexCheck(modified, "brushing");
+
+        selected_ = brushing_.getSelectedIndices();
+        highlighted_ = brushing_.getHighlightedIndices();
+        filtered_ = brushing_.getFilteredIndices();
+
+        for (auto i : modified) {
+            updateColors(static_cast<uint32_t>(i - minSegmentId_), nSegments);
         }
+        uploadColors(modified);
     }
-    utilgl::bindAndSetUniforms(shader, cont, *colors_.getRepresentation<LayerGL>()->getTexture(),
-                               fmt::format("{0}Colors", getName()));
+    colorsBuffer_->bindBase(colorsBinding);
 
     time_->setRunning(!brushing_.getSelectedIndices().empty() ||
                       !brushing_.getHighlightedIndices().empty());
 }
 
+void AtlasComponent::updateColors(uint32_t segment, uint32_t nSegments) {
+    const auto id = static_cast<uint32_t>(segment + minSegmentId_);
+    const auto mix = [](const vec3& color, const FloatProperty& mix, const FloatProperty& alpha,
+                        const vec4& current) {
+        return vec4{glm::mix(color, vec3{current}, mix.get()), alpha.get()};
+    };
+
+    const auto base = tf_->sample(static_cast<double>(segment) / (nSegments - 1));
+    vec4 color1 = base;
+    vec4 color2 = base;
+    if (selected_.contains(id)) {
+        color1 = mix(selectionColor_, selectionMix_, selectionAlpha_, color1);
+        color2 = mix(vec3{1.0, 1.0, 1.0}, selectionMix_, selectionAlpha_, color1);
+    }
+    if (highlighted_.contains(id)) {
+        color1 = mix(selectionColor_, selectionMix_, selectionAlpha_, color1);
+        color2 = mix(vec3{1.0, 1.0, 1.0}, selectionMix_, selectionAlpha_, color1);
+    }
+    if (filtered_.contains(id)) {
+        color1 = mix(filteredColor_, filteredMix_, filteredAlpha_, color1);
+        color2 = color1;
+    }
+    colors_[2 * size_t{segment}] = color1;
+    colors_[2 * size_t{segment} + 1] = color2;
+}
+
+void AtlasComponent::uploadColors(const BitSet& modified) {
+    // Segments closer than this are uploaded together to reduce the number of uploads
+    constexpr uint32_t maxGap = 256;
+
+    const auto upload = [&](uint32_t begin, uint32_t end) {
+        const auto offset = 2 * size_t{begin};
+        const auto size = 2 * size_t{end - begin};
+        colorsBuffer_->upload(colors_.data() + offset,
+                              static_cast<GLintptr>(offset * sizeof(vec4)),
+                              static_cast<GLsizeiptr>(size * sizeof(vec4)));
+    };
+
+    std::optional<std::pair<uint32_t, uint32_t>> range;
+    for (auto id : modified) {
+        const auto segment = static_cast<uint32_t>(id - minSegmentId_);
+        if (range && segment <= range->second + maxGap) {
+            range->second = segment + 1;
+        } else {
+            if (range) upload(range->first, range->second);
+            range = std::pair{segment, segment + 1};
+        }
+    }
+    if (range) upload(range->first, range->second);
+}
+
 void AtlasComponent::onPickingEvent(PickingEvent* e) {
     const auto id = static_cast<uint32_t>(e->getPickedId() + minSegmentId_);
 
@@ -418,31 +458,35 @@ namespace {
 constexpr std::string_view uniforms = util::trim(R"(
 uniform VolumeParameters {atlas}Parameters;
 uniform sampler3D {atlas};
-uniform sampler2D {atlas}Colors;
+layout(std430, binding = {binding}) readonly buffer {atlas}ColorsBuffer {{
+    vec4 {atlas}Colors[];
+}};
 uniform uint {atlas}PickingStart;
 uniform uint {atlas}Size;
 )");
 
 constexpr std::string_view first = util::trim(R"(
 float {atlas}Segment = getNormalizedVoxel({atlas}, {atlas}Parameters, samplePosition).x;
-vec4 {atlas}Color1 = texture({atlas}Colors, vec2({atlas}Segment, 0.25));
-vec4 {atlas}Color2 = texture({atlas}Colors, vec2({atlas}Segment, 0.75));
+uint {atlas}Index = min(uint({atlas}Segment * {atlas}Size + 0.5), {atlas}Size);
+vec4 {atlas}Color1 = {atlas}Colors[2 * {atlas}Index];
+vec4 {atlas}Color2 = {atlas}Colors[2 * {atlas}Index + 1];
 {color} = highlight({color}, {atlas}Color1, {atlas}Color2, time);
 
 if (picking.a == 0.0 && {color}.a > 0.0 && {atlas}Color1.a > 0.0) {{
-    uint pid = {atlas}PickingStart + int({atlas}Segment * {atlas}Size + 0.5);
+    uint pid = {atlas}PickingStart + {atlas}Index;
     picking = vec4(pickingIndexToColor(pid), 1.0);
 }}
 )");
 
 constexpr std::string_view loop = util::trim(R"(
 {atlas}Segment = getNormalizedVoxel({atlas}, {atlas}Parameters, samplePosition).x;
-{atlas}Color1 = texture({atlas}Colors, vec2({atlas}Segment, 0.25));
-{atlas}Color2 = texture({atlas}Colors, vec2({atlas}Segment, 0.75));
+{atlas}Index = min(uint({atlas}Segment * {atlas}Size + 0.5), {atlas}Size);
+{atlas}Color1 = {atlas}Colors[2 * {atlas}Index];
+{atlas}Color2 = {atlas}Colors[2 * {atlas}Index + 1];
 {color} = highlight({color}, {atlas}Color1, {atlas}Color2, time);
 
 if (picking.a == 0.0 && {color}.a > 0.0 && {atlas}Color1.a > 0.0) {{
-    uint pid = {atlas}PickingStart + int({atlas}Segment * {atlas}Size + 0.5);
+    uint pid = {atlas}PickingStart + {atlas}Index;
     picking = vec4(pickingIndexToColor(pid), 1.0);
 }}
 )");
@@ -454,7 +498,8 @@ auto AtlasComponent::getSegments() -> std::vector<Segment> {
 
     return {
         {R"(#include "utils/pickingutils.glsl")", placeholder::include, 800},
-        {fmt::format(uniforms, "atlas"_a = getName()), placeholder::uniform, 800},
+        {fmt::format(uniforms, "atlas"_a = getName(), "binding"_a = colorsBinding),
+         placeholder::uniform, 800},
         {fmt::format(first, "atlas"_a = getName(), "color"_a = color_), placeholder::first, 800},
         {fmt::format(loop, "atlas"_a = getName(), "color"_a = color_), placeholder::loop, 800}};
 }
@@ -79,7 +79,10 @@ uniform sampler2D {bg}Picking;
 uniform sampler2D {bg}Depth;
 )");
 
+// The background is composited at the first sample behind it. Samples are not necessarily evenly
+// spaced since empty space might be skipped, so keep track of whether it has been composited.
 constexpr std::string_view setup = util::trim(R"(
+bool {bg}Composited = false;
 vec4 {bg}ColorVal = texture({bg}Color, texCoords);
 vec4 {bg}PickingVal = texture({bg}Picking, texCoords);
 depth = texture({bg}Depth, texCoords).x;
@@ -89,21 +92,18 @@ float {bg}RayDepth =
 if ({bg}RayDepth <= 0) {comp}
 )");
 
-constexpr std::string_view first = util::trim(R"(
-if ({bg}RayDepth > 0 && {bg}RayDepth <= rayPosition) {comp}
-)");
-
 constexpr std::string_view loop = util::trim(R"(
-if ({bg}RayDepth > rayPosition - rayStep  && {bg}RayDepth <= rayPosition) {comp}
+if (!{bg}Composited && {bg}RayDepth <= rayPosition) {comp}
 )");
 
 constexpr std::string_view post = util::trim(R"(
 // composite background if lying beyond the last volume sample
-if ({bg}RayDepth > rayLength - rayStep * 0.5) {comp}
+if (!{bg}Composited) {comp}
 )");
 
 constexpr std::string_view composite = util::trim(R"(
 {{
+    {bg}Composited = true;
     if (rayDepth == -1.0 && {bg}ColorVal.a > 0.0) rayDepth = {bg}RayDepth;
     if (picking.a == 0.0 && {bg}PickingVal.a > 0.0) picking = {bg}PickingVal;
     result.rgb = result.rgb + (1.0 - result.a) * {bg}ColorVal.a * {bg}ColorVal.rgb;
@@ -119,7 +119,7 @@ auto BackgroundComponent::getSegments() -> std::vector<Segment> {
     if (background_.isConnected()) {
         return {{fmt::format(uniforms, "bg"_a = getName()), placeholder::uniform, 900},
                 {fmt::format(setup, "bg"_a = getName(), "comp"_a = comp), placeholder::setup, 900},
-                {fmt::format(first, "bg"_a = getName(), "comp"_a = comp), placeholder::first, 900},
+                {fmt::format(loop, "bg"_a = getName(), "comp"_a = comp), placeholder::first, 900},
                 {fmt::format(loop, "bg"_a = getName(), "comp"_a = comp), placeholder::loop, 900},
                 {fmt::format(post, "bg"_a = getName(), "comp"_a = comp), placeholder::post, 900}};
     } else {
@@ -0,0 +1,146 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/shadercomponents/brickedvolumecomponent.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>         // for Volume
+#include <inviwo/core/datastructures/volume/volumebricked.h>  // for VolumeBricked
+#include <inviwo/core/ports/volumeport.h>                     // for VolumeInport
+#include <inviwo/core/properties/constraintbehavior.h>        // for ConstraintBehavior
+#include <inviwo/core/properties/invalidationlevel.h>         // for InvalidationLevel
+#include <inviwo/core/util/stringconversion.h>                // for trim, StrBuffer
+#include <modules/basegl/shadercomponents/shadercomponent.h>  // for ShaderComponent::Segment
+#include <modules/opengl/shader/shader.h>                     // for Shader
+#include <modules/opengl/volume/volumeutils.h>                // for setShaderUniforms
+
+#include <fmt/core.h>    // for format
+#include <fmt/format.h>  // for compile_string_to_view, FMT...
+
+namespace inviwo {
+
+BrickedVolumeComponent::BrickedVolumeComponent(std::string_view name, Document help)
+    : ShaderComponent()
+    , volumePort{name, std::move(help)}
+    , bricking{"bricking", "Bricking"}
+    , finestLevel{"finestLevel",
+                  "Finest Level",
+                  "The finest resolution level to render, 0 is the full resolution. Coarser "
+                  "levels are used for bricks that are not resident yet"_help,
+                  0,
+                  {0, ConstraintBehavior::Immutable},
+                  {static_cast<int>(BrickPoolGL::maxLevels) - 1, ConstraintBehavior::Immutable}}
+    , poolSize{"poolSize",
+               "Brick Pool Size (MB)",
+               "GPU memory used to cache bricks"_help,
+               BrickPoolGL::defaultCapacity / (1024 * 1024),
+               {1, ConstraintBehavior::Immutable},
+               {16'384, ConstraintBehavior::Ignore}}
+    , uploadsPerFrame{"uploadsPerFrame",
+                      "Uploads per Frame",
+                      "Maximum number of bricks to upload after each rendering"_help,
+                      64,
+                      {1, ConstraintBehavior::Immutable},
+                      {1024, ConstraintBehavior::Ignore},
+                      1,
+                      InvalidationLevel::Valid} {
+
+    bricking.addProperties(finestLevel, poolSize, uploadsPerFrame);
+}
+
+std::string_view BrickedVolumeComponent::getName() const { return volumePort.getIdentifier(); }
+
+void BrickedVolumeComponent::process(Shader& shader, TextureUnitContainer& cont) {
+    const auto volume = volumePort.getData();
+    pool_.setVolume(volume->getRepresentationShared<VolumeBricked>(),
+                    poolSize.get() * 1024 * 1024);
+    pool_.bind(shader, cont, getName());
+
+    utilgl::setShaderUniforms(shader, *volume, StrBuffer{"{}Parameters", getName()});
+    shader.setUniform(StrBuffer{"{}Level", getName()}, finestLevel.get());
+}
+
+bool BrickedVolumeComponent::update() { return pool_.update(uploadsPerFrame.get()); }
+
+std::vector<std::tuple<Inport*, std::string>> BrickedVolumeComponent::getInports() {
+    return {{&volumePort, std::string{"volumes"}}};
+}
+
+std::vector<Property*> BrickedVolumeComponent::getProperties() { return {&bricking}; }
+
+namespace {
+
+constexpr std::string_view uniforms = util::trim(R"(
+uniform VolumeParameters {0}Parameters;
+uniform sampler3D {0};
+uniform int {0}Level = 0;
+)");
+
+constexpr std::string_view voxelFirst = util::trim(R"(
+vec4 {0}Voxel = getNormalizedBrickedVoxel({0}, {0}Parameters, samplePosition, {0}Level);
+vec4 {0}VoxelPrev = {0}Voxel;
+)");
+
+constexpr std::string_view voxel = util::trim(R"(
+{0}VoxelPrev = {0}Voxel;
+{0}Voxel = getNormalizedBrickedVoxel({0}, {0}Parameters, samplePosition, {0}Level);
+)");
+
+constexpr std::string_view gradientFirst = util::trim(R"(
+vec3 {0}GradientPrev = vec3(0);
+vec3 {0}Gradient = vec3(0);
+#if defined(GRADIENTS_ENABLED)
+{0}Gradient = useSurfaceNormals ? -texture(surfaceNormal, texCoords).xyz :
+    normalize(getBrickedGradient({0}, {0}Parameters, samplePosition, {0}Level, channel));
+if (!useSurfaceNormals) {{
+    {0}Gradient *= sign({0}Voxel[channel] / (1.0 - {0}Parameters.formatScaling) - {0}Parameters.formatOffset);
+}}
+#endif
+)");
+
+constexpr std::string_view gradient = util::trim(R"(
+#if defined(GRADIENTS_ENABLED)
+{0}GradientPrev = {0}Gradient;
+{0}Gradient = normalize(getBrickedGradient({0}, {0}Parameters, samplePosition, {0}Level, channel));
+{0}Gradient *= sign({0}Voxel[channel] / (1.0 - {0}Parameters.formatScaling) - {0}Parameters.formatOffset);
+#endif
+)");
+
+}  // namespace
+
+auto BrickedVolumeComponent::getSegments() -> std::vector<Segment> {
+    return {
+        {std::string{R"(#include "raycasting/bricked.glsl")"}, placeholder::include, 400},
+        {fmt::format(FMT_STRING(uniforms), getName()), placeholder::uniform, 400},
+        {fmt::format(FMT_STRING(voxelFirst), getName()), placeholder::first, 400},
+        {fmt::format(FMT_STRING(voxel), getName()), placeholder::loop, 400},
+        {fmt::format(FMT_STRING(gradientFirst), getName()), placeholder::first, 410},
+        {fmt::format(FMT_STRING(gradient), getName()), placeholder::loop, 410}};
+}
+
+}  // namespace inviwo
@@ -0,0 +1,118 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/shadercomponents/emptyspaceskippingcomponent.h>
+
+#include <inviwo/core/ports/volumeport.h>                         // for VolumeInport
+#include <inviwo/core/properties/invalidationlevel.h>             // for InvalidationLevel
+#include <inviwo/core/properties/isotfproperty.h>                 // for IsoTFProperty
+#include <inviwo/core/properties/raycastingproperty.h>            // for RaycastingProperty
+#include <inviwo/core/util/stringconversion.h>                    // for trim
+#include <modules/basegl/shadercomponents/raycastingcomponent.h>  // for RaycastingComponent
+
+#include <string>  // for string
+
+#include <fmt/core.h>  // for format
+
+namespace inviwo {
+
+EmptySpaceSkippingComponent::EmptySpaceSkippingComponent(VolumeInport& volume,
+                                                         RaycastingComponent& raycasting,
+                                                         IsoTFProperty& isotf)
+    : ShaderComponent()
+    , emptySpaceSkipping{"emptySpaceSkipping", "Empty Space Skipping",
+                         "Skip the samples in regions of the volume that are fully transparent "
+                         "under the current transfer function and isovalues. "
+                         "Requires compute shaders."_help,
+                         true, InvalidationLevel::InvalidResources}
+    , volume_{volume}
+    , raycasting_{raycasting}
+    , isotf_{isotf}
+    , grid_{} {
+
+    volume_.onChange([this]() { grid_.invalidateGrid(); });
+    isotf_.onChange([this]() { grid_.invalidateOccupancy(); });
+}
+
+std::string_view EmptySpaceSkippingComponent::getName() const { return "occupancy"; }
+
+bool EmptySpaceSkippingComponent::enabled() const {
+    return emptySpaceSkipping && EmptySpaceSkippingGL::isSupportedByGPU();
+}
+
+void EmptySpaceSkippingComponent::process(Shader& shader, TextureUnitContainer& cont) {
+    if (!enabled()) return;
+
+    if (auto volume = volume_.getData()) {
+        using enum RaycastingProperty::RenderingType;
+        const auto renderingType = raycasting_.getRaycastingProperty().renderingType_.get();
+        grid_.update(*volume, raycasting_.getChannel(), isotf_, renderingType != Isosurface,
+                     renderingType != Dvr);
+        // the grids are computed using other shaders
+        shader.activate();
+        grid_.bind(shader, cont, getName());
+    }
+}
+
+std::vector<Property*> EmptySpaceSkippingComponent::getProperties() {
+    return {&emptySpaceSkipping};
+}
+
+namespace {
+
+constexpr std::string_view uniforms = util::trim(R"(
+uniform sampler3D {0};
+uniform OccupancyParameters {0}Parameters;
+)");
+
+constexpr std::string_view skip = util::trim(R"(
+#if !defined(PLANES_ENABLED)
+{{
+    float {0}Skip = skipEmptySpace({0}, {0}Parameters, entryPoint, rayDirection,
+                                   rayPosition - rayStep, rayStep);
+    if ({0}Skip > rayPosition) {{
+        rayPosition = {0}Skip;
+        if (rayPosition >= rayLength) break;
+        samplePosition = entryPoint + rayPosition * rayDirection;
+    }}
+}}
+#endif
+)");
+
+}  // namespace
+
+auto EmptySpaceSkippingComponent::getSegments() -> std::vector<Segment> {
+    if (!enabled()) return {};
+
+    return {{std::string{R"(#include "utils/emptyspaceskipping.glsl")"}, placeholder::include, 300},
+            {fmt::format(uniforms, getName()), placeholder::uniform, 300},
+            {fmt::format(skip, getName()), placeholder::loop, 300}};
+}
+
+}  // namespace inviwo
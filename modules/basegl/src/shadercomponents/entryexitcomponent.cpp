@@ -35,6 +35,8 @@
 #include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/ports/imageport.h>                                // for ImageInport
+#include <inviwo/core/processors/processor.h>                           // for Processor
+#include <inviwo/core/properties/invalidationlevel.h>                   // for InvalidationLevel
 #include <inviwo/core/util/stringconversion.h>                          // for trim
 #include <modules/basegl/shadercomponents/shadercomponent.h>            // for ShaderComponent::...
 #include <modules/opengl/image/layergl.h>                               // for LayerGL
@@ -62,9 +64,33 @@ EntryExitComponent::EntryExitComponent()
                 "exit point positions of input volume "
                 "(image generated by EntryExitPoints processor)"_help) {}
 
+EntryExitComponent::EntryExitComponent(Processor& processor) : EntryExitComponent() {
+    entryPort_.setOptional(true);
+    exitPort_.setOptional(true);
+    entryPort_.setHelp(
+        "Optional entry point locations of input volume (image generated by EntryExitPoints "
+        "processor). If not connected, the ray is intersected with the volume bounding box."_help);
+    exitPort_.setHelp(
+        "Optional exit point positions of input volume (image generated by EntryExitPoints "
+        "processor). If not connected, the ray is intersected with the volume bounding box."_help);
+
+    for (auto* port : {&entryPort_, &exitPort_}) {
+        port->onConnect([&]() { processor.invalidate(InvalidationLevel::InvalidResources); });
+        port->onDisconnect([&]() { processor.invalidate(InvalidationLevel::InvalidResources); });
+    }
+}
+
 std::string_view EntryExitComponent::getName() const { return "entryexit"; }
 
+bool EntryExitComponent::usesAnalyticEntryExit() const {
+    return entryPort_.isOptional() && (!entryPort_.isConnected() || !exitPort_.isConnected());
+}
+
 void EntryExitComponent::process(Shader& shader, TextureUnitContainer& cont) {
+    if (usesAnalyticEntryExit()) {
+        shader.setUniform("useSurfaceNormals", false);
+        return;
+    }
     utilgl::bindAndSetUniforms(shader, cont, entryPort_, ImageType::ColorDepthPicking);
     utilgl::bindAndSetUniforms(shader, cont, exitPort_, ImageType::ColorDepthPicking);
     if (auto surfaceNormals = entryPort_.getData()->getColorLayer(1)) {
@@ -107,10 +133,52 @@ float rayLength = length(exitPoint - entryPoint);
 vec3 rayDirection = normalize(exitPoint - entryPoint);
 )");
 
+// Intersect the view ray with the [0,1]^3 cube in texture space. The ray is clamped to the near
+// and far planes, which corresponds to capping the near clip plane.
+constexpr std::string_view analyticSetup = util::trim(R"(
+vec3 entryPoint = vec3(0.0);
+vec3 exitPoint = vec3(0.0);
+float entryPointDepth = 1.0;
+float exitPointDepth = 1.0;
+{
+    vec4 rayNear = camera.clipToWorld * vec4(2.0 * texCoords - 1.0, -1.0, 1.0);
+    vec4 rayFar = camera.clipToWorld * vec4(2.0 * texCoords - 1.0, 1.0, 1.0);
+    vec3 origin = (volumeParameters.worldToTexture * vec4(rayNear.xyz / rayNear.w, 1.0)).xyz;
+    vec3 dir = (volumeParameters.worldToTexture * vec4(rayFar.xyz / rayFar.w, 1.0)).xyz - origin;
+
+    vec3 t0 = (vec3(0.0) - origin) / dir;
+    vec3 t1 = (vec3(1.0) - origin) / dir;
+    vec3 tMin = min(t0, t1);
+    vec3 tMax = max(t0, t1);
+    float tEntry = max(max(tMin.x, tMin.y), max(tMin.z, 0.0));
+    float tExit = min(min(tMax.x, tMax.y), min(tMax.z, 1.0));
+
+    if (tEntry < tExit) {
+        entryPoint = origin + tEntry * dir;
+        exitPoint = origin + tExit * dir;
+        mat4 textureToClip = camera.worldToClip * volumeParameters.textureToWorld;
+        vec4 entryClip = textureToClip * vec4(entryPoint, 1.0);
+        vec4 exitClip = textureToClip * vec4(exitPoint, 1.0);
+        entryPointDepth = 0.5 * entryClip.z / entryClip.w + 0.5;
+        exitPointDepth = 0.5 * exitClip.z / exitClip.w + 0.5;
+    }
+}
+
+// The length of the ray in texture space
+float rayLength = length(exitPoint - entryPoint);
+
+// The normalized direction of the ray
+vec3 rayDirection = normalize(exitPoint - entryPoint);
+)");
+
 };  // namespace
 
 auto EntryExitComponent::getSegments() -> std::vector<Segment> {
     using namespace fmt::literals;
+    if (usesAnalyticEntryExit()) {
+        return {{std::string{surfaceNormalUniforms}, placeholder::uniform, 102},
+                {std::string{analyticSetup}, placeholder::setup, 100}};
+    }
     return {{fmt::format(uniforms, entryPort_.getIdentifier()), placeholder::uniform, 100},
             {fmt::format(uniforms, exitPort_.getIdentifier()), placeholder::uniform, 101},
             {std::string{surfaceNormalUniforms}, placeholder::uniform, 102},
@@ -33,7 +33,7 @@
 #include <inviwo/core/properties/volumeindicatorproperty.h>   // for VolumeIndicatorProperty
 #include <inviwo/core/util/stringconversion.h>                // for StrBuffer, trim
 #include <modules/basegl/shadercomponents/shadercomponent.h>  // for ShaderComponent::Segment
-#include <modules/opengl/shader/shaderutils.h>                // for setUniforms
+#include <modules/opengl/shader/shaderutils.h>                // for setUniforms, addShaderDefines
 
 #include <string>       // for string
 #include <string_view>  // for string_view
@@ -56,6 +56,10 @@ void PositionIndicatorComponent::process(Shader& shader, TextureUnitContainer&)
     utilgl::setUniforms(shader, positionIndicator_);
 }
 
+void PositionIndicatorComponent::initializeResources(Shader& shader) {
+    utilgl::addShaderDefines(shader, positionIndicator_);
+}
+
 std::vector<Property*> PositionIndicatorComponent::getProperties() { return {&positionIndicator_}; }
 
 namespace {
@@ -0,0 +1,62 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/shadercomponents/progressiverefinementcomponent.h>
+
+#include <modules/basegl/properties/progressiverefinementproperty.h>  // for ProgressiveRefineme...
+
+namespace inviwo {
+
+ProgressiveRefinementComponent::ProgressiveRefinementComponent()
+    : ShaderComponent()
+    , refinement{"progressiveRefinement", "Progressive Refinement"}
+    , frame_{0, false, 1.0f, 0.5f} {}
+
+std::string_view ProgressiveRefinementComponent::getName() const {
+    return refinement.getIdentifier();
+}
+
+void ProgressiveRefinementComponent::process(Shader& shader, TextureUnitContainer&) {
+    refinement.setUniforms(shader, frame_);
+}
+
+std::vector<Property*> ProgressiveRefinementComponent::getProperties() { return {&refinement}; }
+
+auto ProgressiveRefinementComponent::beginFrame(const Processor& processor,
+                                                const ImageOutport& outport)
+    -> const ProgressiveRefinementProperty::Frame& {
+    frame_ = refinement.beginFrame(processor, outport);
+    return frame_;
+}
+
+void ProgressiveRefinementComponent::endFrame(Processor& processor) {
+    refinement.endFrame(processor, frame_);
+}
+
+}  // namespace inviwo
@@ -29,6 +29,7 @@
 
 #include <modules/basegl/shadercomponents/raycastingcomponent.h>
 
+#include <inviwo/core/algorithm/markdown.h>                   // for operator""_help
 #include <inviwo/core/datastructures/histogram.h>             // for HistogramSelection
 #include <inviwo/core/properties/isotfproperty.h>             // for IsoTFProperty
 #include <inviwo/core/properties/isovalueproperty.h>          // for IsoValueProperty
@@ -42,6 +43,8 @@
 #include <modules/opengl/shader/shader.h>                     // for Shader
 #include <modules/opengl/shader/shaderobject.h>               // for ShaderObject
 #include <modules/opengl/shader/shaderutils.h>                // for setShaderDefines
+#include <modules/opengl/texture/textureunit.h>               // for TextureUnit, TextureUnitCon...
+#include <modules/opengl/image/layergl.h>                     // IWYU pragma: keep
 
 #include <bitset>       // for bitset<>::reference
 #include <iterator>     // for move_iterator, make_move_it...
@@ -52,7 +55,6 @@
 
 namespace inviwo {
 class Property;
-class TextureUnitContainer;
 
 namespace {
 
@@ -65,9 +67,18 @@ RaycastingComponent::RaycastingComponent(std::string_view volume, IsoTFProperty&
     , volume_{volume}
     , isotf_{isotf}
     , channel_("channel", "Render Channel", channelsList, 0)
+    , preIntegration_("preIntegration", "Pre-Integration",
+                      "Classify each ray segment using a pre-integrated transfer function "
+                      "table, reduces artifacts of sharp transfer functions at low sampling "
+                      "rates"_help,
+                      false, InvalidationLevel::InvalidResources)
     , raycasting_("raycaster", "Raycasting") {
 
     raycasting_.insertProperty(0, channel_);
+    raycasting_.addProperty(preIntegration_);
+    preIntegration_.visibilityDependsOn(raycasting_.classification_, [](const auto& p) {
+        return p.get() == RaycastingProperty::Classification::TF;
+    });
     raycasting_.compositing_.setVisible(false);
 
     auto updateTFHistSel = [this]() {
@@ -81,9 +92,17 @@ RaycastingComponent::RaycastingComponent(std::string_view volume, IsoTFProperty&
 
 std::string_view RaycastingComponent::getName() const { return raycasting_.getIdentifier(); }
 
-void RaycastingComponent::process(Shader& shader, TextureUnitContainer&) {
+void RaycastingComponent::process(Shader& shader, TextureUnitContainer& cont) {
     shader.setUniform("samplingRate", raycasting_.samplingRate_.get());
     shader.setUniform("channel", static_cast<int>(channel_.getSelectedIndex()));
+
+    if (usePreIntegration()) {
+        if (auto* table = isotf_.tf_.getPreIntegratedRepresentation<LayerGL>()) {
+            TextureUnit& unit = cont.emplace_back();
+            table->bindTexture(unit.getEnum());
+            shader.setUniform(fmt::format("{}PreIntegrated", isotf_.tf_.getIdentifier()), unit);
+        }
+    }
 }
 void RaycastingComponent::initializeResources(Shader& shader) {
     auto fso = shader.getFragmentShaderObject();
@@ -119,6 +138,17 @@ bool RaycastingComponent::setUsedChannels(size_t channels) {
     return true;
 }
 
+size_t RaycastingComponent::getChannel() const { return channel_.getSelectedIndex(); }
+
+const RaycastingProperty& RaycastingComponent::getRaycastingProperty() const {
+    return raycasting_;
+}
+
+bool RaycastingComponent::usePreIntegration() const {
+    return preIntegration_ &&
+           raycasting_.classification_.get() == RaycastingProperty::Classification::TF;
+}
+
 namespace {
 
 constexpr std::string_view iso = util::trim(R"(
@@ -139,6 +169,11 @@ constexpr std::string_view classify = util::trim(R"(
 color{color} = texture({tf}, vec2({volume}Voxel[{channel}], 0.5));
 )");
 
+constexpr std::string_view classifyPreIntegrated = util::trim(R"(
+color{color} = texture({tf}PreIntegrated,
+                       vec2({volume}VoxelPrev[{channel}], {volume}Voxel[{channel}]));
+)");
+
 constexpr std::string_view shadeAndComposite = util::trim(R"(
 if (color{color}.a > 0) {{
     shadingParams.colors = defaultMaterialColors(color{color}.rgb);
@@ -179,6 +214,11 @@ auto RaycastingComponent::getSegments() -> std::vector<Segment> {
     const auto gradient = fmt::format("{}Gradient", volume_);
     const auto gradientPrev = fmt::format("{}GradientPrev", volume_);
 
+    if (usePreIntegration()) {
+        segments.push_back({fmt::format("uniform sampler2D {}PreIntegrated;", tf),
+                            placeholder::uniform, 1050 + 1});
+    }
+
     std::vector<Segment> isoSegments{
         {fmt::format(iso, "volume"_a = volume_, "gradient"_a = gradient,
                      "gradientPrev"_a = gradientPrev, "isoparams"_a = isoparam,
@@ -196,8 +236,8 @@ auto RaycastingComponent::getSegments() -> std::vector<Segment> {
         {fmt::format(classify, "volume"_a = volume_, "tf"_a = tf, "channel"_a = "channel",
                      "color"_a = ""),
          placeholder::first, 700},
-        {fmt::format(classify, "volume"_a = volume_, "tf"_a = tf, "channel"_a = "channel",
-                     "color"_a = ""),
+        {fmt::format(usePreIntegration() ? classifyPreIntegrated : classify, "volume"_a = volume_,
+                     "tf"_a = tf, "channel"_a = "channel", "color"_a = ""),
          placeholder::loop, 700},
 
         {fmt::format(shadeAndComposite, "volume"_a = volume_, "gradient"_a = gradient,
@@ -289,7 +329,12 @@ auto MultiRaycastingComponent::getSegments() -> std::vector<Segment> {
         const auto gradient = fmt::format("{}AllGradients[{}]", volume_, i);
         const auto gradientPrev = fmt::format("{}AllGradientsPrev[{}]", volume_, i);
 
-        std::vector<Segment> isoSegments{
+        if (usePreIntegration()) {
+        segments.push_back({fmt::format("uniform sampler2D {}PreIntegrated;", tf),
+                            placeholder::uniform, 1050 + 1});
+    }
+
+    std::vector<Segment> isoSegments{
             {fmt::format(iso, "volume"_a = volume_, "gradient"_a = gradient,
                          "gradientPrev"_a = gradientPrev, "isoparams"_a = isoparam,
                          "channel"_a = i),
@@ -0,0 +1,152 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/basegl/util/pointlodgl.h>
+
+#include <inviwo/core/algorithm/markdown.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/interaction/interactionstate.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/util/threadutil.h>
+#include <modules/basegl/datastructures/pointlod.h>
+#include <modules/opengl/buffer/bufferobject.h>
+#include <modules/opengl/geometry/meshgl.h>
+#include <modules/opengl/glformats.h>
+
+namespace inviwo {
+
+struct PointLODGL::Entry {
+    const Mesh* mesh = nullptr;
+    size_t points = 0;
+    std::shared_ptr<const PointLOD> octree;
+    std::unique_ptr<BufferObject> indices;
+};
+
+PointLODGL::PointLODGL()
+    : lod{"lod", "Level of Detail",
+          "Render a spatially uniform subset of the points of large meshes while interacting, "
+          "and all points once the interaction is over"_help,
+          true}
+    , maxError{"maxError", "Max Screen Space Error",
+               util::ordinalLength(2.0f, 32.0f)
+                   .setMin(0.1f)
+                   .set("The largest allowed distance between the rendered points in pixels "
+                        "while interacting"_help)}
+    , entries_{std::make_shared<std::vector<Entry>>()}
+    , used_{false}
+    , interactionHandle_{} {
+
+    lod.addProperties(maxError);
+
+    if (auto* app = InviwoApplication::getPtr()) {
+        interactionHandle_ = app->getInteractionState().onChange(
+            [this](bool interacting) { onInteraction(interacting); });
+    }
+}
+
+PointLODGL::~PointLODGL() = default;
+
+bool PointLODGL::isActive() const {
+    const auto* app = InviwoApplication::getPtr();
+    return lod.isChecked() && app && app->getInteractionState().isInteracting();
+}
+
+bool PointLODGL::draw(size_t id, const std::shared_ptr<const Mesh>& mesh, const mat4& worldToClip,
+                      size2_t viewport) {
+    if (!lod.isChecked()) return false;
+    const auto* positions = mesh->getBuffer(BufferType::PositionAttrib);
+    if (!positions || positions->getSize() <= PointLOD::defaultNodeCapacity) return false;
+
+    auto& entries = *entries_;
+    if (entries.size() <= id) entries.resize(id + 1);
+    auto& entry = entries[id];
+
+    if (entry.mesh != mesh.get() || entry.points != positions->getSize()) {
+        entry = Entry{mesh.get(), positions->getSize(), nullptr, nullptr};
+
+        // Make sure the data is available on the CPU before building the octree in the background
+        const auto* ram = positions->getRepresentation<BufferRAM>();
+        util::dispatchPool([mesh, ram, id, weak = std::weak_ptr{entries_}]() {
+            std::vector<vec3> points(ram->getSize());
+            for (size_t i = 0; i < points.size(); ++i) {
+                points[i] = vec3{ram->getAsDVec3(i)};
+            }
+            auto octree = std::make_shared<const PointLOD>(points);
+
+            util::dispatchFrontAndForget([weak, mesh, id, octree = std::move(octree)]() {
+                auto entries = weak.lock();
+                if (!entries || entries->size() <= id || (*entries)[id].mesh != mesh.get()) return;
+                (*entries)[id].octree = octree;
+            });
+        });
+    }
+    if (!entry.octree || !isActive()) return false;
+
+    if (!entry.indices) {
+        const auto& indices = entry.octree->getIndices();
+        entry.indices = std::make_unique<BufferObject>(
+            indices.size() * sizeof(std::uint32_t), GLFormats::get(DataFormatId::UInt32),
+            GL_STATIC_DRAW, GL_ELEMENT_ARRAY_BUFFER);
+        entry.indices->upload(indices);
+    }
+
+    const auto dataToClip = worldToClip * mesh->getCoordinateTransformer().getDataToWorldMatrix();
+    const auto ranges = entry.octree->select(dataToClip, vec2{viewport}, maxError);
+
+    std::vector<GLsizei> counts;
+    std::vector<const void*> offsets;
+    for (const auto& range : ranges) {
+        counts.push_back(static_cast<GLsizei>(range.count));
+        offsets.push_back(reinterpret_cast<const void*>(range.first * sizeof(std::uint32_t)));
+    }
+
+    const auto* meshGL = mesh->getRepresentation<MeshGL>();
+    meshGL->enable();
+    entry.indices->bind();
+    glMultiDrawElements(GL_POINTS, counts.data(), GL_UNSIGNED_INT, offsets.data(),
+                        static_cast<GLsizei>(counts.size()));
+    entry.indices->unbind();
+    meshGL->disable();
+
+    used_ = true;
+    return true;
+}
+
+void PointLODGL::onInteraction(bool interacting) {
+    // Render all points once the interaction is over
+    if (interacting || !used_) return;
+    used_ = false;
+    if (auto* processor = lod.getOwner() ? lod.getOwner()->getProcessor() : nullptr) {
+        processor->invalidate(InvalidationLevel::InvalidOutput);
+    }
+}
+
+}  // namespace inviwo
@@ -0,0 +1,121 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/rendercontext.h>
+#include <inviwo/sys/moduleregistration.h>
+#include <modules/base/algorithm/dataminmax.h>
+#include <modules/base/algorithm/volume/volumegeneration.h>
+#include <modules/basegl/algorithm/dataminmaxgl.h>
+#include <modules/opengl/volume/volumegl.h>
+
+#include <benchmark/benchmark.h>
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <warn/push>
+#include <warn/ignore/unused-function>
+
+using namespace inviwo;
+
+template <typename T>
+static std::shared_ptr<Volume> makeVolume(benchmark::State& state) {
+    const size3_t dims{static_cast<size_t>(state.range(0))};
+    state.counters["Voxels"] = benchmark::Counter(static_cast<double>(glm::compMul(dims)),
+                                                  benchmark::Counter::kIsIterationInvariantRate);
+    return std::shared_ptr<Volume>(util::makeSphericalVolume<T>(dims));
+}
+
+// The second argument is the number of threads in the pool, zero runs everything serially
+template <typename T>
+static void MinMaxRAM(benchmark::State& state) {
+    auto volume = makeVolume<T>(state);
+    const auto* ram = volume->getRepresentation<VolumeRAM>();
+
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(1)));
+    state.counters["Threads"] = static_cast<double>(state.range(1));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(util::volumeMinMax(ram, IgnoreSpecialValues::Yes));
+    }
+}
+
+// The volume is uploaded to the GPU before the measurement starts
+template <typename T>
+static void MinMaxGL(benchmark::State& state) {
+    if (!utilgl::DataMinMaxGL::isSuppportedByGPU()) {
+        state.SkipWithError("Compute shaders not supported");
+        return;
+    }
+    auto volume = makeVolume<T>(state);
+    const auto* gl = volume->getRepresentation<VolumeGL>();
+    utilgl::DataMinMaxGL minMaxGL;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(minMaxGL.minMax(*gl));
+    }
+}
+
+BENCHMARK(MinMaxRAM<unsigned char>)
+    ->ArgsProduct({benchmark::CreateRange(32, 512, 2), {0, 4, 8}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(MinMaxRAM<float>)
+    ->ArgsProduct({benchmark::CreateRange(32, 512, 2), {0, 4, 8}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(MinMaxGL<unsigned char>)
+    ->RangeMultiplier(2)
+    ->Range(32, 512)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(MinMaxGL<float>)->RangeMultiplier(2)->Range(32, 512)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    {
+        LogCentral::init();
+        InviwoApplication app(argc, argv, "Inviwo-Benchmark-DataMinMax");
+        app.registerModules(inviwo::getModuleList());
+        RenderContext::getPtr()->activateDefaultRenderContext();
+
+        benchmark::Initialize(&argc, argv);
+        if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+        benchmark::RunSpecifiedBenchmarks();
+        benchmark::Shutdown();
+    }
+    glfwTerminate();
+    return 0;
+}
+
+#include <warn/pop>
@@ -0,0 +1,159 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/rendercontext.h>
+#include <inviwo/sys/moduleregistration.h>
+#include <modules/base/algorithm/volume/volumegeneration.h>
+#include <modules/opengl/image/layergl.h>
+#include <modules/opengl/inviwoopengl.h>
+#include <modules/opengl/volume/volumegl.h>
+
+#include <benchmark/benchmark.h>
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <warn/push>
+#include <warn/ignore/unused-function>
+
+using namespace inviwo;
+
+// Every iteration invalidates the destination representation by editing the source one outside
+// of the timed region, so that each measurement includes a full conversion. glFinish makes sure
+// the asynchronous part of the transfer is accounted for.
+
+template <typename T>
+static std::shared_ptr<Volume> makeVolume(benchmark::State& state) {
+    const size3_t dims{static_cast<size_t>(state.range(0))};
+    state.counters["Voxels"] = benchmark::Counter(static_cast<double>(glm::compMul(dims)),
+                                                  benchmark::Counter::kIsIterationInvariantRate);
+    return std::shared_ptr<Volume>(util::makeSphericalVolume<T>(dims));
+}
+
+template <typename T>
+static std::shared_ptr<Layer> makeLayer(benchmark::State& state) {
+    const size2_t dims{static_cast<size_t>(state.range(0))};
+    state.counters["Pixels"] = benchmark::Counter(static_cast<double>(glm::compMul(dims)),
+                                                  benchmark::Counter::kIsIterationInvariantRate);
+    return std::make_shared<Layer>(std::make_shared<LayerRAMPrecision<T>>(dims));
+}
+
+template <typename Data, typename From, typename To>
+static void convert(benchmark::State& state, Data& data) {
+    data.template getRepresentation<To>();
+    glFinish();
+    for (auto _ : state) {
+        state.PauseTiming();
+        data.template getEditableRepresentation<From>();
+        glFinish();
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(data.template getRepresentation<To>());
+        glFinish();
+    }
+}
+
+template <typename T>
+static void VolumeUpload(benchmark::State& state) {
+    auto volume = makeVolume<T>(state);
+    convert<Volume, VolumeRAM, VolumeGL>(state, *volume);
+}
+
+template <typename T>
+static void VolumeDownload(benchmark::State& state) {
+    auto volume = makeVolume<T>(state);
+    convert<Volume, VolumeGL, VolumeRAM>(state, *volume);
+}
+
+template <typename T>
+static void LayerUpload(benchmark::State& state) {
+    auto layer = makeLayer<T>(state);
+    convert<Layer, LayerRAM, LayerGL>(state, *layer);
+}
+
+template <typename T>
+static void LayerDownload(benchmark::State& state) {
+    auto layer = makeLayer<T>(state);
+    convert<Layer, LayerGL, LayerRAM>(state, *layer);
+}
+
+BENCHMARK(VolumeUpload<unsigned char>)
+    ->RangeMultiplier(2)
+    ->Range(32, 512)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(VolumeUpload<float>)->RangeMultiplier(2)->Range(32, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(VolumeDownload<unsigned char>)
+    ->RangeMultiplier(2)
+    ->Range(32, 512)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(VolumeDownload<float>)
+    ->RangeMultiplier(2)
+    ->Range(32, 512)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(LayerUpload<glm::u8vec4>)
+    ->RangeMultiplier(4)
+    ->Range(256, 4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(LayerUpload<float>)->RangeMultiplier(4)->Range(256, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(LayerDownload<glm::u8vec4>)
+    ->RangeMultiplier(4)
+    ->Range(256, 4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(LayerDownload<float>)
+    ->RangeMultiplier(4)
+    ->Range(256, 4096)
+    ->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    {
+        LogCentral::init();
+        InviwoApplication app(argc, argv, "Inviwo-Benchmark-Representations");
+        app.registerModules(inviwo::getModuleList());
+        RenderContext::getPtr()->activateDefaultRenderContext();
+
+        benchmark::Initialize(&argc, argv);
+        if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+        benchmark::RunSpecifiedBenchmarks();
+        benchmark::Shutdown();
+    }
+    glfwTerminate();
+    return 0;
+}
+
+#include <warn/pop>
@@ -0,0 +1,171 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/basegl/datastructures/pointlod.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <glm/gtx/transform.hpp>
+
+namespace inviwo {
+
+namespace {
+
+std::vector<vec3> randomPoints(size_t count) {
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+    std::vector<vec3> points(count);
+    for (auto& p : points) p = vec3{dist(gen), dist(gen), dist(gen)};
+    return points;
+}
+
+// Maps [0,1]^3 to the clip space cube
+const mat4 unitToClip = glm::translate(vec3{-1.0f}) * glm::scale(vec3{2.0f});
+
+std::vector<bool> selectedPoints(const PointLOD& lod, const std::vector<PointLOD::Range>& ranges,
+                                 size_t count) {
+    std::vector<bool> selected(count, false);
+    for (const auto& range : ranges) {
+        for (auto i = range.first; i < range.first + range.count; ++i) {
+            selected[lod.getIndices()[i]] = true;
+        }
+    }
+    return selected;
+}
+
+}  // namespace
+
+TEST(PointLOD, DepthFirstRanges) {
+    const auto points = randomPoints(20000);
+    const PointLOD lod{points, 64};
+
+    // Every point is stored exactly once
+    auto indices = lod.getIndices();
+    std::ranges::sort(indices);
+    std::vector<std::uint32_t> expected(points.size());
+    std::iota(expected.begin(), expected.end(), std::uint32_t{0});
+    EXPECT_EQ(expected, indices);
+
+    const auto& nodes = lod.getNodes();
+    ASSERT_FALSE(nodes.empty());
+    EXPECT_EQ(0u, nodes.front().first);
+    EXPECT_EQ(points.size(), nodes.front().subtreeCount);
+    EXPECT_GT(nodes.size(), size_t{8});
+
+    // The points of a node are directly followed by the subtrees of its children, in order
+    for (const auto& node : nodes) {
+        EXPECT_LE(node.count, 64u);
+        auto next = node.first + node.count;
+        for (auto child : node.children) {
+            if (child == PointLOD::noChild) continue;
+            EXPECT_EQ(next, nodes[child].first);
+            next += nodes[child].subtreeCount;
+        }
+        EXPECT_EQ(node.first + node.subtreeCount, next);
+    }
+}
+
+TEST(PointLOD, ZeroErrorSelectsAll) {
+    const auto points = randomPoints(20000);
+    const PointLOD lod{points, 64};
+
+    const auto ranges = lod.select(unitToClip, vec2{512.0f}, 0.0f);
+    ASSERT_EQ(size_t{1}, ranges.size());
+    EXPECT_EQ(0u, ranges.front().first);
+    EXPECT_EQ(points.size(), ranges.front().count);
+
+    // A larger error selects fewer points
+    const auto coarse = lod.select(unitToClip, vec2{512.0f}, 64.0f);
+    ASSERT_FALSE(coarse.empty());
+    EXPECT_EQ(0u, coarse.front().first);
+    EXPECT_LT(coarse.back().first + coarse.back().count, points.size());
+}
+
+TEST(PointLOD, FrustumCulling) {
+    const auto points = randomPoints(20000);
+    const PointLOD lod{points, 64};
+
+    // Only x in [0, 0.5] is within the view
+    const mat4 halfToClip = glm::translate(vec3{-1.0f}) * glm::scale(vec3{4.0f, 2.0f, 2.0f});
+    const auto ranges = lod.select(halfToClip, vec2{512.0f}, 0.0f);
+
+    for (size_t i = 1; i < ranges.size(); ++i) {
+        EXPECT_LT(ranges[i - 1].first + ranges[i - 1].count, ranges[i].first);
+    }
+
+    const auto selected = selectedPoints(lod, ranges, points.size());
+    size_t visible = 0;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (points[i].x < 0.5f) {
+            ++visible;
+            EXPECT_TRUE(selected[i]) << "Point " << i << " at x = " << points[i].x;
+        }
+    }
+    const auto count = std::count(selected.begin(), selected.end(), true);
+    EXPECT_LT(static_cast<size_t>(count), points.size());
+    EXPECT_GE(static_cast<size_t>(count), visible);
+
+    // Nothing is selected when everything is outside
+    const mat4 outside = glm::translate(vec3{10.0f, 0.0f, 0.0f}) * unitToClip;
+    EXPECT_TRUE(lod.select(outside, vec2{512.0f}, 0.0f).empty());
+}
+
+TEST(PointLOD, CoincidentPoints) {
+    const std::vector<vec3> points(1000, vec3{0.25f, 0.5f, 0.75f});
+    const PointLOD lod{points, 8};
+
+    const auto& nodes = lod.getNodes();
+    // One point is kept per level, the rest end up in the leaf at the maximum depth
+    ASSERT_EQ(PointLOD::maxDepth + 1, nodes.size());
+    std::vector<size_t> depth(nodes.size(), 0);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        for (auto child : nodes[i].children) {
+            if (child != PointLOD::noChild) depth[child] = depth[i] + 1;
+        }
+    }
+    EXPECT_EQ(PointLOD::maxDepth, *std::ranges::max_element(depth));
+    EXPECT_EQ(points.size() - PointLOD::maxDepth, nodes.back().count);
+    EXPECT_EQ(points.size(), lod.getIndices().size());
+
+    const auto ranges = lod.select(unitToClip, vec2{512.0f}, 0.0f);
+    ASSERT_EQ(size_t{1}, ranges.size());
+    EXPECT_EQ(points.size(), ranges.front().count);
+}
+
+}  // namespace inviwo
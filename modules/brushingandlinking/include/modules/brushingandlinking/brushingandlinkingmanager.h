@@ -31,17 +31,20 @@
 
 #include <modules/brushingandlinking/brushingandlinkingmoduledefine.h>  // for IVW_MODULE_BRUSHI...
 
-#include <inviwo/core/datastructures/bitset.h>                         // for BitSet
-#include <inviwo/core/io/serialization/serializable.h>                 // for Serializable
-#include <inviwo/core/properties/invalidationlevel.h>                  // for InvalidationLevel
-#include <modules/brushingandlinking/datastructures/brushingaction.h>  // for BrushingTarget, hash
-#include <modules/brushingandlinking/datastructures/indexlist.h>       // for IndexList
+#include <inviwo/core/datastructures/bitset.h>                            // for BitSet
+#include <inviwo/core/io/serialization/serializable.h>                    // for Serializable
+#include <inviwo/core/properties/invalidationlevel.h>                     // for InvalidationLevel
+#include <modules/brushingandlinking/datastructures/brushingaction.h>     // for BrushingTarget, ...
+#include <modules/brushingandlinking/datastructures/brushingchangeset.h>  // for BrushingChangeSet
+#include <modules/brushingandlinking/datastructures/indexlist.h>          // for IndexList
 
 #include <algorithm>      // for find
 #include <array>          // for array
 #include <cstddef>        // for size_t
-#include <cstdint>        // for uint32_t
+#include <cstdint>        // for uint32_t, uint64_t
+#include <deque>          // for deque
 #include <functional>     // for function
+#include <optional>       // for optional
 #include <string_view>    // for string_view
 #include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
@@ -322,6 +325,33 @@ public:
     const BitSet& getSelectedIndices(BrushingTarget target = BrushingTarget::Row) const;
     const BitSet& getHighlightedIndices(BrushingTarget target = BrushingTarget::Row) const;
 
+    /**
+     * Returns the version of the brushing state. The version increases with every change of any
+     * action or target. Store it after updating from the state to later query the changes made
+     * since then using getChanges. Versions are unique across all managers.
+     */
+    std::uint64_t getVersion() const;
+
+    /**
+     * Returns the indices that were added to and removed from the selection of \p action and
+     * \p target since \p version, see getVersion. Only a limited number of changes are kept, if
+     * the changes since \p version are no longer available, for example since the manager was
+     * connected to a different parent or deserialized in between, std::nullopt is returned and
+     * the caller has to fall back to reading the full set using getIndices.
+     *
+     * @code
+     *  if (auto changes = manager.getChanges(BrushingAction::Select, BrushingTarget::Row,
+     *                                        version_)) {
+     *      for (auto [begin, end] : changes->ranges()) { ... patch buffer ... }
+     *  } else {
+     *      ... update from manager.getSelectedIndices() ...
+     *  }
+     *  version_ = manager.getVersion();
+     * @endcode
+     */
+    std::optional<BrushingChangeSet> getChanges(BrushingAction action, BrushingTarget target,
+                                                std::uint64_t version) const;
+
     /**
      * register a parent manager for the propagation of brushing actions
      */
@@ -398,6 +428,8 @@ private:
     void addChild(BrushingAndLinkingManager* child);
     void removeChild(BrushingAndLinkingManager* child);
     const BitSet* getBitSet(BrushingAction action, BrushingTarget target) const;
+    void recordChange(BrushingAction action, BrushingTarget target, BitSet changed);
+    void resetChanges();
 
     InvalidationLevel getInvalidationLevel(const BrushingTarget& target,
                                            BrushingModifications mods) const;
@@ -421,6 +453,25 @@ private:
 
     std::function<void(BrushingAction, BrushingTarget, const BitSet&, std::string_view)>
         onBrushCallback_;
+
+    /**
+     * Log of changes, only maintained by the top-most manager which holds the brushing state.
+     * Each change stores the symmetric difference between the previous and the new state. Since
+     * these compose with xor, the change set since any logged version is the xor of the
+     * subsequent changes.
+     */
+    struct ChangeLog {
+        struct Change {
+            std::uint64_t version;
+            BitSet changed;
+        };
+        std::uint64_t validSince = 0;  ///< changes after this version are all in the log
+        std::deque<Change> changes;
+    };
+    static constexpr size_t maxLoggedChanges = 32;
+    std::array<std::unordered_map<BrushingTarget, ChangeLog>, BrushingActions.size()> changeLog_;
+    std::uint64_t version_ = 0;
+    std::uint64_t validSince_ = 0;  ///< no changes are available for versions before this
 };
 
 }  // namespace inviwo
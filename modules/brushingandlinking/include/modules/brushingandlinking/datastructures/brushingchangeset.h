@@ -0,0 +1,69 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/brushingandlinking/brushingandlinkingmoduledefine.h>  // for IVW_MODULE_BRUSHI...
+
+#include <inviwo/core/datastructures/bitset.h>  // for BitSet
+
+#include <cstdint>  // for uint32_t, uint64_t
+#include <utility>  // for pair
+#include <vector>   // for vector
+
+namespace inviwo {
+
+/**
+ * Difference between two states of the indices of a brushing action and target, as returned by
+ * BrushingAndLinkingManager::getChanges. Allows processors to update only the parts of their
+ * state, e.g. a GPU buffer, that correspond to indices that actually changed instead of
+ * re-reading the full set.
+ */
+struct IVW_MODULE_BRUSHINGANDLINKING_API BrushingChangeSet {
+    BrushingChangeSet() = default;
+    /**
+     * Create a change set from the symmetric difference \p changed of two states and the
+     * resulting state \p current
+     */
+    BrushingChangeSet(const BitSet& changed, const BitSet& current);
+
+    bool empty() const;
+    //! all indices that changed, i.e. the union of added and removed
+    BitSet changed() const;
+    /**
+     * Returns the changed indices as consecutive half-open ranges [begin, end) in increasing
+     * order, suitable for patching spans of a buffer indexed by the brushing indices.
+     */
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> ranges() const;
+
+    BitSet added;    ///< indices not in the old state but in the new one
+    BitSet removed;  ///< indices in the old state but not in the new one
+};
+
+}  // namespace inviwo
@@ -56,11 +56,13 @@ public:
     void clear();
 
     /**
-     * Update the indexlist with source \p src and \p indices, if \p indices are different
+     * Update the indexlist with source \p src and \p indices, if \p indices are different.
+     * If the indices of \p src only grow, the union is updated in place, otherwise it is
+     * recomputed on the next access using BitSet::fastUnion.
      *
      * @return true if the indexlist was modified that is \p this and \p indices were different
      */
-    bool set(std::string_view src, const BitSet& indices);
+    bool set(std::string_view src, BitSet indices);
     bool contains(uint32_t idx) const;
 
     const BitSet& getIndices() const;
@@ -31,18 +31,20 @@
 
 #include <modules/brushingandlinking/brushingandlinkingmoduledefine.h>  // for IVW_MODULE_BRUSHI...
 
-#include <inviwo/core/datastructures/bitset.h>                         // for BitSet
-#include <inviwo/core/ports/inport.h>                                  // for Inport
-#include <inviwo/core/ports/outport.h>                                 // for Outport
-#include <inviwo/core/ports/porttraits.h>                              // for PortTraits
-#include <inviwo/core/properties/invalidationlevel.h>                  // for InvalidationLevel
-#include <inviwo/core/util/document.h>                                 // for Document
-#include <inviwo/core/util/glmvec.h>                                   // for uvec3
-#include <modules/brushingandlinking/brushingandlinkingmanager.h>      // for BrushingTargetsIn...
-#include <modules/brushingandlinking/datastructures/brushingaction.h>  // for BrushingTarget
+#include <inviwo/core/datastructures/bitset.h>                            // for BitSet
+#include <inviwo/core/ports/inport.h>                                     // for Inport
+#include <inviwo/core/ports/outport.h>                                    // for Outport
+#include <inviwo/core/ports/porttraits.h>                                 // for PortTraits
+#include <inviwo/core/properties/invalidationlevel.h>                     // for InvalidationLevel
+#include <inviwo/core/util/document.h>                                    // for Document
+#include <inviwo/core/util/glmvec.h>                                      // for uvec3
+#include <modules/brushingandlinking/brushingandlinkingmanager.h>         // for BrushingTargetsI...
+#include <modules/brushingandlinking/datastructures/brushingaction.h>     // for BrushingTarget
+#include <modules/brushingandlinking/datastructures/brushingchangeset.h>  // for BrushingChangeSet
 
 #include <cstddef>      // for size_t
-#include <cstdint>      // for uint32_t
+#include <cstdint>      // for uint32_t, uint64_t
+#include <optional>     // for optional
 #include <string>       // for string
 #include <string_view>  // for string_view
 #include <vector>       // for vector
@@ -200,6 +202,19 @@ public:
     const BitSet& getSelectedIndices(BrushingTarget target = BrushingTarget::Row) const;
     const BitSet& getHighlightedIndices(BrushingTarget target = BrushingTarget::Row) const;
 
+    /**
+     * Returns the version of the brushing state, see BrushingAndLinkingManager::getVersion
+     */
+    std::uint64_t getVersion() const;
+    /**
+     * Returns the indices added to and removed from the selection of \p action and \p target
+     * since \p version or std::nullopt if the changes are no longer available.
+     *
+     * \see BrushingAndLinkingManager::getChanges
+     */
+    std::optional<BrushingChangeSet> getChanges(BrushingAction action, BrushingTarget target,
+                                                std::uint64_t version) const;
+
     // clang-format off
     [[deprecated("use getIndices() or getSelectedIndices() with a column target instead")]] const BitSet& getSelectedColumns() const;
     // clang-format on
@@ -45,6 +45,7 @@
 #include <modules/brushingandlinking/datastructures/indexlist.h>       // for IndexList
 #include <modules/brushingandlinking/ports/brushingandlinkingports.h>  // for BrushingAndLinking...
 
+#include <atomic>       // for atomic
 #include <stack>        // for stack
 #include <string>       // for string
 #include <tuple>        // for tuple_element<>::type
@@ -55,6 +56,15 @@
 
 namespace inviwo {
 
+namespace {
+
+std::uint64_t nextVersion() {
+    static std::atomic<std::uint64_t> version{0};
+    return ++version;
+}
+
+}  // namespace
+
 BrushingAndLinkingManager::BrushingAndLinkingManager(
     BrushingAndLinkingInport* inport,
     std::vector<BrushingTargetsInvalidationLevel> invalidationLevels)
@@ -83,13 +93,26 @@ void BrushingAndLinkingManager::brush(BrushingAction action, BrushingTarget targ
 
     const int actionIdx = getActionIndex(action);
 
-    const bool changed =
-        std::visit(util::overloaded{[&](BitSetTargets& map) { return map[target].set(indices); },
-                                    [&](IndexListTargets& map) {
-                                        auto it = map.try_emplace(target, IndexList());
-                                        return it.first->second.set(source, indices);
-                                    }},
-                   selections_[actionIdx]);
+    // Only the top-most manager holds the brushing state and keeps track of the changes
+    const bool logChanges = !parent_;
+    const bool changed = std::visit(
+        util::overloaded{[&](BitSetTargets& map) {
+                             auto& bitset = map[target];
+                             if (!logChanges) return bitset.set(indices);
+                             BitSet diff = bitset ^ indices;
+                             if (!bitset.set(indices)) return false;
+                             recordChange(action, target, std::move(diff));
+                             return true;
+                         },
+                         [&](IndexListTargets& map) {
+                             auto& list = map.try_emplace(target, IndexList()).first->second;
+                             if (!logChanges) return list.set(source, indices);
+                             const BitSet previous = list.getIndices();
+                             if (!list.set(source, indices)) return false;
+                             recordChange(action, target, previous ^ list.getIndices());
+                             return true;
+                         }},
+        selections_[actionIdx]);
 
     if (onBrushCallback_) {
         std::invoke(onBrushCallback_, action, target, indices, source);
@@ -202,8 +225,11 @@ void BrushingAndLinkingManager::clearIndices(BrushingAction action, BrushingTarg
     while (!stack.empty()) {
         auto node = stack.top();
         stack.pop();
+        const BitSet* previous = node->parent_ ? nullptr : node->getBitSet(action, target);
+        BitSet diff = previous ? *previous : BitSet{};
         if (clearMap(node->selections_)) {
             node->modifications_[target] |= fromAction(action);
+            if (!node->parent_) node->recordChange(action, target, std::move(diff));
             changed = true;
         }
         for (auto c : node->children_) {
@@ -347,6 +373,38 @@ const BitSet& BrushingAndLinkingManager::getHighlightedIndices(BrushingTarget ta
     return getIndices(BrushingAction::Highlight, target);
 }
 
+std::uint64_t BrushingAndLinkingManager::getVersion() const {
+    if (parent_) {
+        return std::max(parent_->getVersion(), validSince_);
+    }
+    return std::max(version_, validSince_);
+}
+
+std::optional<BrushingChangeSet> BrushingAndLinkingManager::getChanges(
+    BrushingAction action, BrushingTarget target, std::uint64_t version) const {
+    // The state was replaced after version, for example by connecting to another parent
+    if (version < validSince_) return std::nullopt;
+
+    if (parent_) {
+        return parent_->getChanges(action, target, version);
+    }
+
+    const auto& logs = changeLog_[getActionIndex(action)];
+    auto it = logs.find(target);
+    if (it == logs.end()) return BrushingChangeSet{};
+    const auto& log = it->second;
+    if (version < log.validSince) return std::nullopt;
+
+    BitSet changed;
+    for (const auto& change : log.changes) {
+        if (change.version > version) {
+            changed ^= change.changed;
+        }
+    }
+    if (changed.empty()) return BrushingChangeSet{};
+    return BrushingChangeSet{changed, getIndices(action, target)};
+}
+
 bool BrushingAndLinkingManager::isFiltered(uint32_t idx, BrushingTarget target) const {
     return contains(idx, BrushingAction::Filter, target);
 }
@@ -377,6 +435,7 @@ void BrushingAndLinkingManager::setParent(BrushingAndLinkingManager* parent) {
     }
 
     parent_ = parent;
+    resetChanges();
     if (parent_) {
         parent_->addChild(this);
 
@@ -443,6 +502,7 @@ void BrushingAndLinkingManager::serialize(Serializer& s) const {
 }
 
 void BrushingAndLinkingManager::deserialize(Deserializer& d) {
+    resetChanges();
     for (auto&& [action, targetmap] : util::zip(BrushingActions, selections_)) {
         if (std::holds_alternative<BitSetTargets>(targetmap)) {
             auto& map = std::get<BitSetTargets>(targetmap);
@@ -545,7 +605,12 @@ void BrushingAndLinkingManager::removeChild(BrushingAndLinkingManager* child) {
             for (auto&& [action, targetmap] : util::zip(BrushingActions, selections_)) {
                 if (std::holds_alternative<IndexListTargets>(targetmap)) {
                     for (auto& elem : std::get<IndexListTargets>(targetmap)) {
+                        BitSet diff = parent_ ? BitSet{} : elem.second.getIndices();
                         if (elem.second.removeSources({inport->getPath()})) {
+                            if (!parent_) {
+                                diff ^= elem.second.getIndices();
+                                recordChange(action, elem.first, std::move(diff));
+                            }
                             // inform parent manager
                             propagate(action, elem.first);
                         }
@@ -575,6 +640,24 @@ const BitSet* BrushingAndLinkingManager::getBitSet(BrushingAction action,
                       selections_[getActionIndex(action)]);
 }
 
+void BrushingAndLinkingManager::recordChange(BrushingAction action, BrushingTarget target,
+                                             BitSet changed) {
+    version_ = nextVersion();
+    auto& log = changeLog_[getActionIndex(action)][target];
+    log.changes.push_back({version_, std::move(changed)});
+    if (log.changes.size() > maxLoggedChanges) {
+        log.validSince = log.changes.front().version;
+        log.changes.pop_front();
+    }
+}
+
+void BrushingAndLinkingManager::resetChanges() {
+    for (auto& logs : changeLog_) {
+        logs.clear();
+    }
+    validSince_ = nextVersion();
+}
+
 InvalidationLevel BrushingAndLinkingManager::getInvalidationLevel(
     const BrushingTarget& target, BrushingModifications mods) const {
     InvalidationLevel invalidationLevel(InvalidationLevel::Valid);
@@ -0,0 +1,55 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/brushingandlinking/datastructures/brushingchangeset.h>
+
+#include <inviwo/core/datastructures/bitset.h>  // for BitSet
+
+namespace inviwo {
+
+BrushingChangeSet::BrushingChangeSet(const BitSet& changed, const BitSet& current)
+    : added{changed & current}, removed{changed - current} {}
+
+bool BrushingChangeSet::empty() const { return added.empty() && removed.empty(); }
+
+BitSet BrushingChangeSet::changed() const { return added | removed; }
+
+std::vector<std::pair<std::uint32_t, std::uint32_t>> BrushingChangeSet::ranges() const {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> result;
+    for (const auto idx : changed()) {
+        if (!result.empty() && result.back().second == idx) {
+            ++result.back().second;
+        } else {
+            result.emplace_back(idx, idx + 1);
+        }
+    }
+    return result;
+}
+
+}  // namespace inviwo
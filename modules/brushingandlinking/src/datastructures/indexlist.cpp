@@ -40,9 +40,15 @@
 
 namespace inviwo {
 
-bool IndexList::empty() const { return indices_.empty(); }
+bool IndexList::empty() const {
+    update();
+    return indices_.empty();
+}
 
-size_t IndexList::size() const { return indices_.size(); }
+size_t IndexList::size() const {
+    update();
+    return indices_.size();
+}
 
 void IndexList::clear() {
     indices_.clear();
@@ -55,24 +61,31 @@ const BitSet& IndexList::getIndices() const {
     return indices_;
 }
 
-bool IndexList::set(std::string_view src, const BitSet& indices) {
-    const std::string source(src);
-    auto it = indicesBySource_.find(source);
+bool IndexList::set(std::string_view src, BitSet indices) {
+    auto it = indicesBySource_.find(src);
 
     if (it == indicesBySource_.end()) {
         if (indices.empty()) return false;
 
-        indicesBySource_.emplace(std::make_pair(source, indices));
-    } else {
-        if (it->second == indices) return false;
+        // Adding indices can be merged into the current union, no need to recompute it
+        if (!indicesDirty_) indices_ |= indices;
+        indicesBySource_.emplace(std::string{src}, std::move(indices));
+        return true;
+    }
+
+    if (it->second == indices) return false;
 
-        if (indices.empty()) {
-            indicesBySource_.erase(it);
+    if (indices.empty()) {
+        indicesBySource_.erase(it);
+        indicesDirty_ = true;
+    } else {
+        if (!indicesDirty_ && it->second.isSubsetOf(indices)) {
+            indices_ |= indices;
         } else {
-            it->second = indices;
+            indicesDirty_ = true;
         }
+        it->second = std::move(indices);
     }
-    indicesDirty_ = true;
     return true;
 }
 
@@ -152,6 +152,13 @@ const BitSet& BrushingAndLinkingInport::getHighlightedIndices(BrushingTarget tar
     return manager_.getIndices(BrushingAction::Highlight, target);
 }
 
+std::uint64_t BrushingAndLinkingInport::getVersion() const { return manager_.getVersion(); }
+
+std::optional<BrushingChangeSet> BrushingAndLinkingInport::getChanges(
+    BrushingAction action, BrushingTarget target, std::uint64_t version) const {
+    return manager_.getChanges(action, target, version);
+}
+
 const BitSet& BrushingAndLinkingInport::getSelectedColumns() const {
     return manager_.getIndices(BrushingAction::Select, BrushingTarget::Column);
 }
@@ -87,6 +87,13 @@ IVW_MODULE_CIMG_API std::shared_ptr<VolumeRAM> loadVolume(const std::filesystem:
                                                           size3_t dims);
 IVW_MODULE_CIMG_API void updateVolume(VolumeRAM& volume, const std::filesystem::path& filePath);
 
+/**
+ * Decode the pages of a multi-page TIFF file straight into @p volume, which has to match the
+ * dimensions and format given by getTIFFHeader. The pages are decoded in parallel using the
+ * thread pool, with one file handle per task.
+ **/
+IVW_MODULE_CIMG_API void readTIFFStack(const std::filesystem::path& filePath, VolumeRAM& volume);
+
 IVW_MODULE_CIMG_API void saveLayer(const LayerRAM& layer, const std::filesystem::path& filePath);
 IVW_MODULE_CIMG_API void saveLayer(const LayerRAM& layer, std::vector<unsigned char>& dst,
                                    std::string_view extension);
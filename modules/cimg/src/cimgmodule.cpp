@@ -34,6 +34,7 @@
 #include <inviwo/core/datastructures/image/layerram.h>  // for LayerRamResizer
 #include <inviwo/core/io/datareader.h>                  // for DataReader
 #include <inviwo/core/io/datawriter.h>                  // for DataWriter
+#include <inviwo/core/util/layerramresampling.h>        // for resample, ResamplingFilter
 #include <inviwo/core/util/logcentral.h>                // for LogCentral
 #include <modules/cimg/cimglayerreader.h>               // for CImgLayerReader
 #include <modules/cimg/cimglayerwriter.h>               // for CImgLayerWriter
@@ -48,7 +49,10 @@ namespace inviwo {
 
 class CIMGLayerRamResizer : public LayerRamResizer {
     virtual bool resize(const LayerRAM& src, LayerRAM& dst) const override {
-        return cimgutil::rescaleLayerRamToLayerRam(&src, &dst);
+        const auto filter = src.getInterpolation() == InterpolationType::Nearest
+                                ? util::ResamplingFilter::Nearest
+                                : util::ResamplingFilter::Linear;
+        return util::resample(src, dst, filter, util::ConsiderAspectRatio::Yes);
     }
 };
 
@@ -47,6 +47,7 @@
 #include <inviwo/core/util/formats.h>                                   // for DataFormatId, Dat...
 #include <inviwo/core/util/glmutils.h>                                  // for extent, rank
 #include <inviwo/core/util/glmvec.h>                                    // for uvec2, size3_t
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 #include <inviwo/core/util/raiiutils.h>                                 // for OnScopeExit, OnSc...
 #include <inviwo/core/util/safecstr.h>                                  // for SafeCStr
 #include <inviwo/core/util/sourcecontext.h>                             // for SourceContext
@@ -54,6 +55,7 @@
 #include <modules/cimg/cimgsavebuffer.h>                                // for saveCImgToBuffer
 
 #include <algorithm>      // for min
+#include <cstddef>        // for byte
 #include <cstdint>        // for uint16_t, uint32_t
 #include <cstring>        // for size_t, memcpy
 #include <functional>     // for __base
@@ -61,6 +63,7 @@
 #include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
 #include <utility>        // for move
+#include <vector>         // for vector
 
 #include <fmt/std.h>
 #if not defined(__clang__) and defined(__GNUC__)
@@ -491,6 +494,120 @@ std::string getOpenEXRVersion() {
 #endif
 }
 
+#ifdef cimg_use_tiff
+namespace {
+
+TIFF* openTIFF(const std::filesystem::path& filename) {
+    TIFF* tif = TIFFOpen(filename.string().c_str(), "r");
+    if (!tif) {
+        throw DataReaderException(SourceContext{}, "Error could not open input file: {}", filename);
+    }
+    return tif;
+}
+
+bool isContiguous(TIFF* tif) {
+    std::uint16_t planarConfig = PLANARCONFIG_CONTIG;
+    TIFFGetFieldDefaulted(tif, TIFFTAG_PLANARCONFIG, &planarConfig);
+    return planarConfig == PLANARCONFIG_CONTIG;
+}
+
+// Decode the current directory of tif into slice, flipping the rows since the image is up-side-down
+void readTIFFDirectory(TIFF* tif, size2_t dims, size_t bytesPerPixel, std::byte* slice) {
+    std::uint32_t width = 0, height = 0;
+    std::uint16_t samplesPerPixel = 1, bitsPerSample = 8;
+    TIFFGetFieldDefaulted(tif, TIFFTAG_IMAGEWIDTH, &width);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_IMAGELENGTH, &height);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_SAMPLESPERPIXEL, &samplesPerPixel);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_BITSPERSAMPLE, &bitsPerSample);
+    if (size2_t{width, height} != dims) {
+        throw DataReaderException("Volume size missmatch");
+    }
+    if (size_t{samplesPerPixel} * bitsPerSample != 8 * bytesPerPixel || !isContiguous(tif)) {
+        throw DataReaderException("Volume format missmatch");
+    }
+
+    const size_t rowBytes = dims.x * bytesPerPixel;
+    const auto row = [&](size_t y) { return slice + (dims.y - 1 - y) * rowBytes; };
+
+    if (TIFFIsTiled(tif)) {
+        std::uint32_t tileWidth = 0, tileHeight = 0;
+        TIFFGetField(tif, TIFFTAG_TILEWIDTH, &tileWidth);
+        TIFFGetField(tif, TIFFTAG_TILELENGTH, &tileHeight);
+        const size_t tileRowBytes = tileWidth * bytesPerPixel;
+        std::vector<std::byte> tile(static_cast<size_t>(TIFFTileSize(tif)));
+
+        for (std::uint32_t y = 0; y < height; y += tileHeight) {
+            for (std::uint32_t x = 0; x < width; x += tileWidth) {
+                if (TIFFReadTile(tif, tile.data(), x, y, 0, 0) < 0) {
+                    throw DataReaderException("Error reading TIFF tile");
+                }
+                const size_t rows = std::min(tileHeight, height - y);
+                const size_t columnBytes = std::min(tileWidth, width - x) * bytesPerPixel;
+                for (size_t r = 0; r < rows; ++r) {
+                    std::memcpy(row(y + r) + x * bytesPerPixel, tile.data() + r * tileRowBytes,
+                                columnBytes);
+                }
+            }
+        }
+    } else {
+        std::uint32_t rowsPerStrip = height;
+        TIFFGetFieldDefaulted(tif, TIFFTAG_ROWSPERSTRIP, &rowsPerStrip);
+        rowsPerStrip = std::min(rowsPerStrip, height);
+        std::vector<std::byte> strip(static_cast<size_t>(TIFFStripSize(tif)));
+
+        for (std::uint32_t y = 0; y < height; y += rowsPerStrip) {
+            if (TIFFReadEncodedStrip(tif, TIFFComputeStrip(tif, y, 0), strip.data(), -1) < 0) {
+                throw DataReaderException("Error reading TIFF strip");
+            }
+            const size_t rows = std::min(rowsPerStrip, height - y);
+            for (size_t r = 0; r < rows; ++r) {
+                std::memcpy(row(y + r), strip.data() + r * rowBytes, rowBytes);
+            }
+        }
+    }
+}
+
+}  // namespace
+#endif
+
+void readTIFFStack(const std::filesystem::path& filePath, VolumeRAM& volume) {
+#ifdef cimg_use_tiff
+    {
+        TIFF* tif = openTIFF(filePath);
+        util::OnScopeExit closeFile([tif]() { TIFFClose(tif); });
+        if (!isContiguous(tif)) {
+            // Separate color planes are left to CImg
+            updateVolume(volume, filePath);
+            return;
+        }
+    }
+
+    const auto dims = volume.getDimensions();
+    const auto bytesPerPixel = volume.getDataFormat()->getSizeInBytes();
+    const auto sliceBytes = dims.x * dims.y * bytesPerPixel;
+    auto* data = static_cast<std::byte*>(volume.getData());
+
+    // Every task opens its own handle and decodes a consecutive range of directories straight
+    // into the volume, hence at most one file handle per thread is open at a time.
+    util::parallelFor(0, dims.z, [&](size_t first, size_t last) {
+        TIFF* tif = openTIFF(filePath);
+        util::OnScopeExit closeFile([tif]() { TIFFClose(tif); });
+
+        if (!TIFFSetDirectory(tif, static_cast<tdir_t>(first))) {
+            throw DataReaderException("Volume size missmatch");
+        }
+        for (size_t z = first; z < last; ++z) {
+            if (z != first && !TIFFReadDirectory(tif)) {
+                throw DataReaderException("Volume size missmatch");
+            }
+            readTIFFDirectory(tif, dims, bytesPerPixel, data + z * sliceBytes);
+        }
+    });
+#else
+    updateVolume(volume, filePath);
+#endif
+}
+
 TIFFHeader getTIFFHeader(const std::filesystem::path& filename) {
 #ifdef cimg_use_tiff
     TIFF* tif = TIFFOpen(filename.string().c_str(), "r");
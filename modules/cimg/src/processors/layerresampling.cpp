@@ -31,9 +31,31 @@
 
 #include <inviwo/core/datastructures/image/layerram.h>
 #include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/layerramresampling.h>
+
+#include <optional>
 
 namespace inviwo {
 
+namespace {
+
+std::optional<util::ResamplingFilter> nativeFilter(cimgutil::InterpolationType type) {
+    switch (type) {
+        case cimgutil::InterpolationType::Nearest:
+            return util::ResamplingFilter::Nearest;
+        case cimgutil::InterpolationType::Moving:
+            return util::ResamplingFilter::Box;
+        case cimgutil::InterpolationType::Linear:
+            return util::ResamplingFilter::Linear;
+        case cimgutil::InterpolationType::Lanczos:
+            return util::ResamplingFilter::Lanczos;
+        default:
+            return std::nullopt;
+    }
+}
+
+}  // namespace
+
 // The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
 const ProcessorInfo LayerResampling::processorInfo_{
     "org.inviwo.LayerResampling",  // Class identifier
@@ -116,9 +138,15 @@ void LayerResampling::process() {
 
         const auto sourceLayerRam = inport_.getData()->getRepresentation<LayerRAM>();
         auto destLayerRam = layer->getEditableRepresentation<LayerRAM>();
-        if (!cimgutil::rescaleLayerRamToLayerRam(sourceLayerRam, destLayerRam,
-                                                 interpolationMode_.get(),
-                                                 cimgutil::ConsiderAspectRatio::No)) {
+        bool success = false;
+        if (const auto filter = nativeFilter(interpolationMode_.get())) {
+            success = util::resample(*sourceLayerRam, *destLayerRam, *filter);
+        } else {  // Cubic and grid interpolation are only available through CImg
+            success = cimgutil::rescaleLayerRamToLayerRam(sourceLayerRam, destLayerRam,
+                                                          interpolationMode_.get(),
+                                                          cimgutil::ConsiderAspectRatio::No);
+        }
+        if (!success) {
             throw Exception("Rescaling layer failed.");
         }
 
@@ -40,7 +40,7 @@
 #include <inviwo/core/util/filesystem.h>                             // for fileExists, addBasePath
 #include <inviwo/core/util/formats.h>                                // for DataFormatBase
 #include <inviwo/core/util/glmvec.h>                                 // for vec3, dvec2, size3_t
-#include <modules/cimg/cimgutils.h>                                  // for TIFFHeader, loadTIFF...
+#include <modules/cimg/cimgutils.h>                                  // for TIFFHeader, readTIFF...
 
 #include <type_traits>  // for remove_extent_t
 
@@ -98,7 +98,8 @@ std::shared_ptr<VolumeRepresentation> TIFFStackVolumeRAMLoader::createRepresenta
     const VolumeRepresentation& src) const {
     const auto fileName = findFile(sourceFile_);
 
-    auto volumeRAM = cimgutil::loadVolume(fileName, src.getDataFormat(), src.getDimensions());
+    auto volumeRAM = createVolumeRAM(src.getDimensions(), src.getDataFormat());
+    cimgutil::readTIFFStack(fileName, *volumeRAM);
     volumeRAM->setWrapping(src.getWrapping());
     volumeRAM->setInterpolation(src.getInterpolation());
     volumeRAM->setSwizzleMask(src.getSwizzleMask());
@@ -110,7 +111,7 @@ void TIFFStackVolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepres
     auto volumeDst = std::static_pointer_cast<VolumeRAM>(dest);
 
     const auto fileName = findFile(sourceFile_);
-    cimgutil::updateVolume(*volumeDst, fileName);
+    cimgutil::readTIFFStack(fileName, *volumeDst);
     volumeDst->setWrapping(src.getWrapping());
     volumeDst->setInterpolation(src.getInterpolation());
     volumeDst->setSwizzleMask(src.getSwizzleMask());
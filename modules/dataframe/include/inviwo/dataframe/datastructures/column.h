@@ -29,7 +29,8 @@
 
 #pragma once
 
-#include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFR...
+#include <inviwo/dataframe/dataframemoduledefine.h>        // for IVW_MODULE_DATAFR...
+#include <inviwo/dataframe/datastructures/columnbuffer.h>  // for ColumnBuffer, RowSelection
 
 #include <inviwo/core/datastructures/buffer/buffer.h>                   // for Buffer, makeBuffer
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>       // for BufferRAMPrecision
@@ -44,6 +45,7 @@
 #include <inviwo/core/util/iterrange.h>                                 // for as_range, iter_range
 #include <inviwo/core/util/sourcecontext.h>                             // for SourceContext
 #include <inviwo/core/util/transformiterator.h>                         // for TransformIterator
+#include <inviwo/core/util/transparentmaps.h>                           // for UnorderedStringMap
 #include <modules/base/algorithm/algorithmoptions.h>                    // for IgnoreSpecialValues
 #include <modules/base/algorithm/dataminmax.h>                          // for bufferMinMax
 
@@ -55,6 +57,7 @@
 #include <limits>         // for numeric_limits
 #include <map>            // for map
 #include <memory>         // for shared_ptr, make_...
+#include <mutex>          // for mutex
 #include <optional>       // for optional, nullopt
 #include <ostream>        // for operator<<, basic...
 #include <string>         // for string, char_traits
@@ -94,6 +97,27 @@ public:
     virtual Column* clone() const = 0;
     virtual Column* clone(std::span<const std::uint32_t> rowSelection) const = 0;
 
+    /**
+     * Create a view of the rows @p rowSelection of the source buffer without copying any data. The
+     * rows are copied on the first access to the buffer of the view, reading single values with
+     * for example getAsDouble() or getAsString() does not copy anything. The source buffer must
+     * not be modified while there are views of it.
+     * @param rowSelection rows of getSourceBuffer() the view will hold
+     * @see getSourceBuffer, getRowSelection
+     */
+    virtual Column* createView(RowSelection rowSelection) const = 0;
+
+    /**
+     * The rows of getSourceBuffer() selected by this column if it is a view that has not been
+     * materialized yet, or nullptr otherwise.
+     */
+    virtual RowSelection getRowSelection() const = 0;
+    /**
+     * The buffer holding the data of this column, or for a view that has not been materialized
+     * the buffer it is a view of. Unlike getBuffer(), this never copies any data.
+     */
+    virtual std::shared_ptr<const BufferBase> getSourceBuffer() const = 0;
+
     virtual ColumnType getColumnType() const = 0;
 
     virtual const std::string& getHeader() const = 0;
@@ -176,12 +200,41 @@ public:
 
     virtual std::string getAsString(size_t idx) const = 0;
 
+    /**
+     * Returns the data of the column as floats normalized to [0, 1] using getRange(). Values
+     * outside of the range are clamped, if the range is empty all values are 0.5. The buffer is
+     * computed on first use and kept until the column is modified, so all users of the same
+     * column, for example several linked plots, share one buffer and hence one GPU
+     * representation of it.
+     * @throw Exception if the column does not hold scalar values
+     */
+    std::shared_ptr<const Buffer<float>> getNormalizedBuffer() const;
+
 protected:
     Column() = default;
     Column(const Column&) = default;
     Column(Column&&) = default;  // NOLINT
     Column& operator=(const Column&) = default;
     Column& operator=(Column&&) = default;  // NOLINT
+
+    /**
+     * Discard the buffer of getNormalizedBuffer(). Needs to be called by all functions that can
+     * modify the data or the range of the column, including non-const access to the buffer.
+     */
+    void invalidateNormalizedBuffer();
+
+private:
+    // Copies of a column need to compute their own normalized buffer
+    struct IVW_MODULE_DATAFRAME_API NormalizedCache {
+        NormalizedCache() = default;
+        NormalizedCache(const NormalizedCache&);
+        NormalizedCache& operator=(const NormalizedCache&);
+        ~NormalizedCache() = default;
+
+        std::mutex mutex;
+        std::shared_ptr<const Buffer<float>> buffer;
+    };
+    mutable NormalizedCache normalized_;
 };
 
 /**
@@ -213,6 +266,10 @@ public:
 
     virtual TemplateColumn* clone() const override;
     virtual TemplateColumn* clone(std::span<const std::uint32_t> rowSelection) const override;
+    virtual TemplateColumn* createView(RowSelection rowSelection) const override;
+
+    virtual RowSelection getRowSelection() const override;
+    virtual std::shared_ptr<const BufferBase> getSourceBuffer() const override;
 
     virtual ~TemplateColumn() = default;
 
@@ -294,7 +351,7 @@ protected:
     std::string header_;
     Unit unit_;
     std::optional<dvec2> range_;
-    std::shared_ptr<Buffer<T>> buffer_;
+    detail::ColumnBuffer<T> buffer_;
 };
 
 class IVW_MODULE_DATAFRAME_API IndexColumn : public TemplateColumn<std::uint32_t> {
@@ -310,6 +367,7 @@ public:
 
     virtual IndexColumn* clone() const override;
     virtual IndexColumn* clone(std::span<const std::uint32_t> rowSelection) const override;
+    virtual IndexColumn* createView(RowSelection rowSelection) const override;
 
     virtual ~IndexColumn() = default;
 
@@ -322,6 +380,26 @@ inline auto categoricalTransform(const std::vector<std::string>& table) {
 }
 }  // namespace detail
 
+/**
+ * \brief The categories of a CategoricalColumn and the code of each category.
+ *
+ * The dictionary is shared between copies and views of a column and only copied when one of them
+ * adds a new category. Columns sharing a dictionary use the same codes for the same categories.
+ */
+struct IVW_MODULE_DATAFRAME_API CategoricalDictionary {
+    /**
+     * Return the code of @p category, adding it if it is not in the dictionary
+     */
+    std::uint32_t add(std::string_view category);
+    /**
+     * Return the code of @p category if it is in the dictionary
+     */
+    std::optional<std::uint32_t> find(std::string_view category) const;
+
+    std::vector<std::string> categories;
+    UnorderedStringMap<std::uint32_t> codes;
+};
+
 /**
  * \brief Specialized data column representing categorical values, i.e. strings.
  * Categorical values are internally mapped to a number representation.
@@ -330,6 +408,7 @@ inline auto categoricalTransform(const std::vector<std::string>& table) {
  *    The data column "blue", "blue", "red", "yellow" might internally be represented
  *    by 0, 0, 1, 2.
  *    The original string values can be accessed using CategoricalColumn::get(index, true)
+ * The codes are stored in a uint32 buffer and the categories in a CategoricalDictionary.
  *
  * \see CategoricalColumn::get()
  * @ingroup datastructures
@@ -358,6 +437,10 @@ public:
 
     virtual CategoricalColumn* clone() const override;
     virtual CategoricalColumn* clone(std::span<const std::uint32_t> rowSelection) const override;
+    virtual CategoricalColumn* createView(RowSelection rowSelection) const override;
+
+    virtual RowSelection getRowSelection() const override;
+    virtual std::shared_ptr<const BufferBase> getSourceBuffer() const override;
 
     virtual ~CategoricalColumn() = default;
 
@@ -440,10 +523,27 @@ public:
      */
     void append(const std::vector<std::string>& data);
 
+    /**
+     * \brief Append the already tokenized categorical values in \p data
+     *
+     * The values are encoded in parallel with a dictionary per chunk, which are then merged into
+     * the dictionary of the column in order. The categories are added in the order they first
+     * appear, the same as when adding the values one at a time.
+     * @param data    categorical values, only referenced during the call
+     */
+    void append(std::span<const std::string_view> data);
+
     /**
      * Returns the unique set of categorical values.
      */
-    const std::vector<std::string>& getCategories() const { return lookUpTable_; }
+    const std::vector<std::string>& getCategories() const { return dictionary_->categories; }
+
+    /**
+     * Returns the dictionary mapping categories to the codes stored in the buffer
+     */
+    const std::shared_ptr<const CategoricalDictionary>& getDictionary() const {
+        return dictionary_;
+    }
 
     /**
      * \brief Returns column contents as list of categorical values
@@ -521,13 +621,16 @@ private:
     };
 
     virtual std::uint32_t addOrGetID(std::string_view str);
+    /**
+     * The dictionary of the column for adding categories, copied first if it is shared
+     */
+    CategoricalDictionary& editableDictionary();
 
     std::string header_;
     Unit unit_;
     std::optional<dvec2> range_;
-    std::shared_ptr<Buffer<std::uint32_t>> buffer_;
-    std::vector<std::string> lookUpTable_;
-    std::map<std::string, std::uint32_t, std::less<>> lookupMap_;
+    detail::ColumnBuffer<std::uint32_t> buffer_;
+    std::shared_ptr<const CategoricalDictionary> dictionary_;
 };
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -552,7 +655,7 @@ TemplateColumn<T>::TemplateColumn(const TemplateColumn& rhs)
     : header_(rhs.getHeader())
     , unit_(rhs.unit_)
     , range_(rhs.range_)
-    , buffer_(std::shared_ptr<Buffer<T>>(rhs.buffer_->clone())) {}
+    , buffer_(rhs.buffer_) {}
 
 template <typename T>
 TemplateColumn<T>::TemplateColumn(TemplateColumn<T>&& rhs)
@@ -567,14 +670,7 @@ TemplateColumn<T>::TemplateColumn(const TemplateColumn& rhs,
     : header_(rhs.getHeader())
     , unit_(rhs.unit_)
     , range_(rhs.range_)
-    , buffer_(std::make_shared<Buffer<T>>(rowSelection.size())) {
-
-    const auto& src = rhs.getTypedBuffer()->getRAMRepresentation()->getDataContainer();
-    auto& dst = buffer_->getEditableRAMRepresentation()->getDataContainer();
-    for (size_t i = 0; i < rowSelection.size(); ++i) {
-        dst[i] = src[rowSelection[i]];
-    }
-}
+    , buffer_(rhs.buffer_.copy(rowSelection)) {}
 
 template <typename T>
 TemplateColumn<T>& TemplateColumn<T>::operator=(const TemplateColumn<T>& rhs) {
@@ -582,7 +678,8 @@ TemplateColumn<T>& TemplateColumn<T>::operator=(const TemplateColumn<T>& rhs) {
         header_ = rhs.getHeader();
         unit_ = rhs.unit_;
         range_ = rhs.range_;
-        buffer_ = std::shared_ptr<Buffer<T>>(rhs.buffer_->clone());
+        buffer_ = rhs.buffer_;
+        invalidateNormalizedBuffer();
     }
     return *this;
 }
@@ -594,6 +691,7 @@ TemplateColumn<T>& TemplateColumn<T>::operator=(TemplateColumn<T>&& rhs) {
         unit_ = rhs.unit_;
         range_ = rhs.range_;
         buffer_ = std::move(rhs.buffer_);
+        invalidateNormalizedBuffer();
     }
     return *this;
 }
@@ -608,6 +706,23 @@ TemplateColumn<T>* TemplateColumn<T>::clone(std::span<const std::uint32_t> rowSe
     return new TemplateColumn(*this, rowSelection);
 }
 
+template <typename T>
+TemplateColumn<T>* TemplateColumn<T>::createView(RowSelection rowSelection) const {
+    auto view = new TemplateColumn(header_, nullptr, unit_, range_);
+    view->buffer_ = buffer_.select(std::move(rowSelection));
+    return view;
+}
+
+template <typename T>
+RowSelection TemplateColumn<T>::getRowSelection() const {
+    return buffer_.rows();
+}
+
+template <typename T>
+std::shared_ptr<const BufferBase> TemplateColumn<T>::getSourceBuffer() const {
+    return buffer_.source();
+}
+
 template <typename T>
 ColumnType TemplateColumn<T>::getColumnType() const {
     return ColumnType::Ordinal;
@@ -636,6 +751,7 @@ void TemplateColumn<T>::setUnit(Unit unit) {
 template <typename T>
 void TemplateColumn<T>::setCustomRange(std::optional<dvec2> range) {
     range_ = range;
+    invalidateNormalizedBuffer();
 }
 
 template <typename T>
@@ -645,7 +761,7 @@ std::optional<dvec2> TemplateColumn<T>::getCustomRange() const {
 
 template <typename T>
 dvec2 TemplateColumn<T>::getDataRange() const {
-    const auto [min, max] = util::bufferMinMax(buffer_.get(), IgnoreSpecialValues::Yes);
+    const auto [min, max] = util::bufferMinMax(buffer_.buffer().get(), IgnoreSpecialValues::Yes);
     return {*std::min_element(glm::value_ptr(min), glm::value_ptr(min) + util::extent_v<T>),
             *std::max_element(glm::value_ptr(max), glm::value_ptr(max) + util::extent_v<T>)};
 }
@@ -661,6 +777,7 @@ dvec2 TemplateColumn<T>::getRange() const {
 
 template <typename T>
 void TemplateColumn<T>::add(const T& value) {
+    invalidateNormalizedBuffer();
     buffer_->getEditableRAMRepresentation()->add(value);
 }
 
@@ -707,11 +824,13 @@ void add(Buffer<T>* /*buffer*/, std::string_view value) {
 
 template <typename T>
 void TemplateColumn<T>::add(std::string_view value) {
-    detail::add<T>(buffer_.get(), value);
+    invalidateNormalizedBuffer();
+    detail::add<T>(buffer_.buffer().get(), value);
 }
 
 template <typename T>
 void TemplateColumn<T>::append(const Column& col) {
+    invalidateNormalizedBuffer();
     if (auto srccol = dynamic_cast<const TemplateColumn<T>*>(&col)) {
         buffer_->getEditableRAMRepresentation()->append(
             srccol->buffer_->getRAMRepresentation()->getDataContainer());
@@ -722,30 +841,31 @@ void TemplateColumn<T>::append(const Column& col) {
 
 template <typename T>
 void TemplateColumn<T>::set(size_t idx, const T& value) {
+    invalidateNormalizedBuffer();
     buffer_->getEditableRAMRepresentation()->set(idx, value);
 }
 
 template <typename T>
 T TemplateColumn<T>::get(size_t idx) const {
-    auto val = buffer_->getRAMRepresentation()->getDataContainer()[idx];
-    return val;
+    return buffer_.get(idx);
 }
 
 template <typename T>
 double TemplateColumn<T>::getAsDouble(size_t idx) const {
-    auto val = buffer_->getRAMRepresentation()->getDataContainer()[idx];
+    auto val = buffer_.get(idx);
     return util::glm_convert<double>(val);
 }
 
 template <typename T>
 void TemplateColumn<T>::setBuffer(std::shared_ptr<Buffer<T>> buffer) {
-    buffer_ = buffer;
+    invalidateNormalizedBuffer();
+    buffer_ = detail::ColumnBuffer<T>{std::move(buffer)};
 }
 
 template <typename T>
 std::string TemplateColumn<T>::getAsString(size_t idx) const {
     std::ostringstream ss;
-    ss << buffer_->getRAMRepresentation()->get(idx);
+    ss << buffer_.get(idx);
     return ss.str();
 }
 
@@ -756,36 +876,38 @@ T TemplateColumn<T>::operator[](const size_t idx) const {
 
 template <typename T>
 std::shared_ptr<BufferBase> TemplateColumn<T>::getBuffer() {
-    return buffer_;
+    invalidateNormalizedBuffer();
+    return buffer_.buffer();
 }
 
 template <typename T>
 std::shared_ptr<const BufferBase> TemplateColumn<T>::getBuffer() const {
-    return buffer_;
+    return buffer_.buffer();
 }
 
 template <typename T>
 std::shared_ptr<Buffer<T>> TemplateColumn<T>::getTypedBuffer() {
-    return buffer_;
+    invalidateNormalizedBuffer();
+    return buffer_.buffer();
 }
 
 template <typename T>
 std::shared_ptr<const Buffer<T>> TemplateColumn<T>::getTypedBuffer() const {
-    return buffer_;
+    return buffer_.buffer();
 }
 
 template <typename T>
 size_t TemplateColumn<T>::getSize() const {
-    return buffer_->getSize();
+    return buffer_.size();
 }
 
 inline auto CategoricalColumn::begin() const -> ConstIterator {
-    return util::TransformIterator(detail::categoricalTransform(lookUpTable_),
+    return util::TransformIterator(detail::categoricalTransform(dictionary_->categories),
                                    buffer_->getRAMRepresentation()->getDataContainer().begin());
 }
 
 inline auto CategoricalColumn::end() const -> ConstIterator {
-    return util::TransformIterator(detail::categoricalTransform(lookUpTable_),
+    return util::TransformIterator(detail::categoricalTransform(dictionary_->categories),
                                    buffer_->getRAMRepresentation()->getDataContainer().end());
 }
 
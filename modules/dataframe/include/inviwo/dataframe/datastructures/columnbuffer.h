@@ -0,0 +1,180 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFR...
+
+#include <inviwo/core/datastructures/buffer/buffer.h>              // for Buffer, makeBuffer
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>  // for BufferRAMPrecision
+
+#include <algorithm>  // for transform
+#include <atomic>     // for atomic, memory_order
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t
+#include <memory>     // for shared_ptr
+#include <mutex>      // for mutex, scoped_lock
+#include <span>       // for span
+#include <utility>    // for move
+#include <vector>     // for vector
+
+namespace inviwo {
+
+/**
+ * Shared list of selected rows of a column view
+ */
+using RowSelection = std::shared_ptr<const std::vector<std::uint32_t>>;
+
+namespace detail {
+
+/**
+ * @brief The buffer of a column, or a view of selected rows of another buffer
+ *
+ * A view only holds the source buffer and the row selection. The selected rows are copied into a
+ * buffer of its own the first time the buffer is accessed, reading single values does not need
+ * that. Copying a view gives another view of the same rows, while copying a buffer clones it.
+ * The source buffer must not be modified while there are views of it.
+ */
+template <typename T>
+class ColumnBuffer {
+public:
+    explicit ColumnBuffer(std::shared_ptr<Buffer<T>> buffer) : buffer_{std::move(buffer)} {}
+    ColumnBuffer(std::shared_ptr<const Buffer<T>> source, RowSelection rows)
+        : source_{std::move(source)}, rows_{std::move(rows)}, isView_{true} {}
+
+    ColumnBuffer(const ColumnBuffer& rhs) : isView_{rhs.isView()} {
+        if (isView_) {
+            source_ = rhs.source_;
+            rows_ = rhs.rows_;
+        } else {
+            buffer_ = std::shared_ptr<Buffer<T>>(rhs.buffer_->clone());
+        }
+    }
+    ColumnBuffer(ColumnBuffer&& rhs) noexcept
+        : buffer_{std::move(rhs.buffer_)}
+        , source_{std::move(rhs.source_)}
+        , rows_{std::move(rhs.rows_)}
+        , isView_{rhs.isView()} {}
+    ColumnBuffer& operator=(const ColumnBuffer& rhs) {
+        if (this != &rhs) {
+            ColumnBuffer tmp{rhs};
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+    ColumnBuffer& operator=(ColumnBuffer&& rhs) noexcept {
+        if (this != &rhs) {
+            buffer_ = std::move(rhs.buffer_);
+            source_ = std::move(rhs.source_);
+            rows_ = std::move(rhs.rows_);
+            isView_.store(rhs.isView(), std::memory_order_release);
+        }
+        return *this;
+    }
+    ~ColumnBuffer() = default;
+
+    /**
+     * Create a view of @p rows of the source buffer
+     * @see source
+     */
+    ColumnBuffer select(RowSelection rows) const { return ColumnBuffer{source(), std::move(rows)}; }
+
+    /**
+     * Create a new buffer holding @p rows of this column
+     */
+    std::shared_ptr<Buffer<T>> copy(std::span<const std::uint32_t> rows) const {
+        std::vector<T> data(rows.size());
+        if (isView()) {
+            const auto& src = source_->getRAMRepresentation()->getDataContainer();
+            std::transform(rows.begin(), rows.end(), data.begin(),
+                           [&](std::uint32_t row) { return src[(*rows_)[row]]; });
+        } else {
+            const auto& src = buffer_->getRAMRepresentation()->getDataContainer();
+            std::transform(rows.begin(), rows.end(), data.begin(),
+                           [&](std::uint32_t row) { return src[row]; });
+        }
+        return util::makeBuffer(std::move(data));
+    }
+
+    /**
+     * The buffer of the column, a view gets materialized on first access.
+     */
+    const std::shared_ptr<Buffer<T>>& buffer() const {
+        if (isView_.load(std::memory_order_acquire)) {
+            std::scoped_lock lock{mutex_};
+            if (isView_.load(std::memory_order_relaxed)) {
+                const auto& src = source_->getRAMRepresentation()->getDataContainer();
+                std::vector<T> data(rows_->size());
+                std::transform(rows_->begin(), rows_->end(), data.begin(),
+                               [&](std::uint32_t row) { return src[row]; });
+                buffer_ = util::makeBuffer(std::move(data));
+                isView_.store(false, std::memory_order_release);
+            }
+        }
+        return buffer_;
+    }
+    Buffer<T>* operator->() const { return buffer().get(); }
+
+    bool isView() const { return isView_.load(std::memory_order_acquire); }
+
+    /**
+     * The buffer holding the data of the column, for a view this is the unselected buffer it is
+     * a view of.
+     */
+    std::shared_ptr<const Buffer<T>> source() const { return isView() ? source_ : buffer(); }
+    /**
+     * The rows of source() selected by a view, or nullptr if the column holds its own data.
+     */
+    RowSelection rows() const { return isView() ? rows_ : nullptr; }
+
+    size_t size() const { return isView() ? rows_->size() : buffer_->getSize(); }
+
+    /**
+     * Read a single value without materializing a view
+     */
+    T get(size_t idx) const {
+        if (isView()) {
+            return source_->getRAMRepresentation()->getDataContainer()[(*rows_)[idx]];
+        } else {
+            return buffer_->getRAMRepresentation()->getDataContainer()[idx];
+        }
+    }
+
+private:
+    mutable std::shared_ptr<Buffer<T>> buffer_;
+    // The source and rows of a view are kept after materialization for concurrent readers
+    std::shared_ptr<const Buffer<T>> source_;
+    RowSelection rows_;
+    mutable std::atomic<bool> isView_{false};
+    mutable std::mutex mutex_;
+};
+
+}  // namespace detail
+
+}  // namespace inviwo
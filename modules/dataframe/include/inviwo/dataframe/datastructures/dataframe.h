@@ -97,6 +97,13 @@ public:
 
     DataFrame(const DataFrame& rhs);
     DataFrame(const DataFrame& rhs, std::span<const std::uint32_t> rowSelection);
+    /**
+     * Create a DataFrame of the rows @p rowSelection of @p rhs where each column is a view of the
+     * corresponding column in @p rhs. No data is copied until the buffer of a column is accessed,
+     * @p rhs must not be modified while the views exist.
+     * @see Column::createView
+     */
+    DataFrame(const DataFrame& rhs, RowSelection rowSelection);
     DataFrame(const DataFrame& rhs, std::span<const std::string> columnSelection);
     DataFrame(const DataFrame& rhs, std::span<const std::string> columnSelection,
               std::span<const std::uint32_t> rowSelection);
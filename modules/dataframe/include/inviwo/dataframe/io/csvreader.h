@@ -47,6 +47,10 @@
 namespace inviwo {
 class DataFrame;
 
+namespace util {
+struct ParallelSettings;
+}  // namespace util
+
 /**
  * \class CSVReader
  * \ingroup dataio
@@ -141,6 +145,21 @@ public:
      */
     virtual std::shared_ptr<DataFrame> readData(const std::filesystem::path& fileName) override;
 
+    /**
+     * Same as readData but the parsing of the rows can be canceled using @p stop, and the progress
+     * is reported to @p progress.
+     * @return a DataFrame containing the CSV data or nullptr if canceled
+     * @see DataReaderType::readDataAsync
+     */
+    virtual std::shared_ptr<DataFrame> readDataAsync(const std::filesystem::path& fileName,
+                                                     const pool::Stop& stop,
+                                                     const pool::Progress& progress) override;
+
+    /**
+     * The reader only uses its own state, so several files can be read concurrently.
+     */
+    virtual bool isThreadSafe() const override { return true; }
+
     /**
      * read a CSV file from a input stream, e.g. a std::ifstream. In case
      * file streams are used, the file must have be opened prior calling this function.
@@ -219,9 +238,16 @@ private:
         size_t nCol, const std::vector<std::pair<std::string_view, size_t>>& rows,
         size_t sampleRows) const;
 
-    std::vector<std::function<void(std::string_view, size_t, size_t)>> addColumns(
-        DataFrame& df, const std::vector<TypeCounts>& types,
-        const std::vector<std::string>& headers) const;
+    struct ColumnParser;
+
+    std::vector<ColumnParser> addColumns(DataFrame& df, const std::vector<TypeCounts>& types,
+                                         const std::vector<std::string>& headers) const;
+
+    std::shared_ptr<DataFrame> readFile(const std::filesystem::path& fileName,
+                                        const util::ParallelSettings& settings) const;
+
+    std::shared_ptr<DataFrame> readContent(std::string_view content,
+                                           const util::ParallelSettings& settings) const;
 
     bool skipRow(std::string_view row, size_t lineNumber, bool filterOnHeader) const;
 
@@ -35,6 +35,7 @@
 #include <inviwo/dataframe/datastructures/dataframe.h>  // for DataFrame
 #include <modules/json/json.h>
 
+#include <iosfwd>  // for istream
 #include <string>  // for string
 
 namespace inviwo {
@@ -92,6 +93,18 @@ IVW_MODULE_DATAFRAME_API void to_json(json& j, const DataFrame& df);
  */
 IVW_MODULE_DATAFRAME_API void from_json(const json& j, DataFrame& df);
 
+/**
+ * Reads a DataFrame in the layout described in from_json(const json&, DataFrame&) directly from a
+ * stream without building a json object of the whole document. The stream is parsed twice, first
+ * to find the columns and their types, then to append the values straight into the typed columns,
+ * which keeps the memory use close to the size of the resulting DataFrame. The stream therefore
+ * has to be seekable.
+ *
+ * @throws JSONConversionException if the input is ill-formatted or unsupported
+ * \see from_json(const json&, DataFrame&)
+ */
+IVW_MODULE_DATAFRAME_API void parseDataFrame(std::istream& stream, DataFrame& df);
+
 IVW_MODULE_DATAFRAME_API void to_json(json& j, const DataFrameInport& port);
 IVW_MODULE_DATAFRAME_API void from_json(const json& j, DataFrameInport& port);
 
@@ -31,6 +31,7 @@
 
 #include <inviwo/dataframe/dataframemoduledefine.h>
 #include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/boolproperty.h>
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/ports/datainport.h>
 #include <inviwo/core/ports/dataoutport.h>
@@ -55,6 +56,7 @@ private:
     DataInport<DataFrame> dataFrame_;
     BufferOutport outport_;
     ColumnOptionProperty selectedColumn_;
+    BoolProperty normalize_;
 };
 
 }  // namespace inviwo
@@ -43,6 +43,7 @@
 #include <cstdint>        // for uint32_t
 #include <memory>         // for shared_ptr, share...
 #include <string>         // for string
+#include <string_view>    // for string_view
 #include <type_traits>    // for remove_extent_t
 #include <unordered_set>  // for unordered_set
 #include <vector>         // for vector
@@ -198,6 +199,10 @@ std::vector<std::uint32_t> selectRows(std::shared_ptr<const Column> col, Pred pr
  * \brief apply the \p filters to each row of column \p col and return the row indices where
  * any of the filters evaluates to true.
  *
+ * The filters are evaluated for the whole column at a time. Filters with a
+ * dataframefilters::ItemFilter::range are tested without calling the filter function, string
+ * filters are only called once for each category of a categorical column.
+ *
  * @param col     column containing data for filtering
  * @param filters predicate to check values from \p col
  * @return list of row indices where rows satisfy all \p filters
@@ -220,6 +225,30 @@ IVW_MODULE_DATAFRAME_API std::vector<std::uint32_t> selectRows(const DataFrame&
 
 IVW_MODULE_DATAFRAME_API std::string createToolTipForRow(const DataFrame& dataframe, size_t rowId);
 
+/**
+ * The name of the expression variable referring to the column with the given @p header. Characters
+ * other than letters, digits, and underscores are replaced by underscores and a leading digit is
+ * prefixed with an underscore, i.e. "Sepal Length" becomes "Sepal_Length".
+ */
+IVW_MODULE_DATAFRAME_API std::string expressionVariable(std::string_view header);
+
+/**
+ * \brief create a column by evaluating \p expression for each row of \p dataframe.
+ *
+ * All non-categorical columns are available as variables, named by expressionVariable(). Each
+ * component of a multi-component column is available as `<name>_<component>`. The expression is
+ * evaluated in parallel, see util::evaluateExpression.
+ *
+ * @param dataframe  source of the variables
+ * @param header     header of the new column
+ * @param expression the expression to evaluate, i.e. `(x - y) ^ 2`
+ * @return a new double column with one value per row of \p dataframe
+ * @throws Exception if the expression is invalid or refers to an unknown column
+ */
+IVW_MODULE_DATAFRAME_API std::shared_ptr<Column> createDerivedColumn(const DataFrame& dataframe,
+                                                                     std::string_view header,
+                                                                     std::string_view expression);
+
 #include <warn/push>
 #include <warn/ignore/conversion>
 template <typename Pred>
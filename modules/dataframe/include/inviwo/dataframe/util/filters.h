@@ -48,6 +48,20 @@ enum class StringComp { Equal, NotEqual, Regex, RegexPartial };
 
 enum class NumberComp { Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual };
 
+/**
+ * Inclusive range [@p min, @p max] of values, or its complement if @p invert is true.
+ */
+template <typename T>
+struct ValueRange {
+    T min;
+    T max;
+    bool invert;
+
+    bool operator()(T value) const {
+        return invert ? (value < min || value > max) : (value >= min && value <= max);
+    }
+};
+
 /**
  * Predicate functor for filtering items in a specific column of a row. Column indices are
  * zero-based.
@@ -58,6 +72,7 @@ enum class NumberComp { Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual
 struct ItemFilter {
     using FilterFunc = std::variant<std::function<bool(std::string_view)>,
                                     std::function<bool(std::int64_t)>, std::function<bool(double)>>;
+    using Range = std::variant<std::monostate, ValueRange<std::int64_t>, ValueRange<double>>;
 
     /**
      * Predicate function for filtering a column. The data item of @c ItemFilter::column is
@@ -68,6 +83,12 @@ struct ItemFilter {
     FilterFunc filter;
     int column;  //!< zero-based column index
     bool filterOnHeader;
+    /**
+     * Optional equivalent of @c filter as a value range of the same type. It lets an entire
+     * column be tested without calling @c filter for each item. Filters without a range, for
+     * example regular expressions, have to call @c filter.
+     */
+    Range range = {};
 };
 
 /// create an item filter matching strings with @p match based on @p op
@@ -52,6 +52,7 @@
 #include <inviwo/dataframe/io/jsondataframewriter.h>
 #include <inviwo/dataframe/io/xmlwriter.h>                          // for XMLWriter
 #include <inviwo/dataframe/processors/csvsource.h>                  // for CSVSource
+#include <inviwo/dataframe/processors/dataframederivedcolumn.h>     // for DataFrameDerivedCo...
 #include <inviwo/dataframe/processors/dataframeexporter.h>          // for DataFrameExporter
 #include <inviwo/dataframe/processors/dataframefilter.h>            // for DataFrameFilter
 #include <inviwo/dataframe/processors/dataframefloat32converter.h>  // for DataFrameFloat32Conv...
@@ -104,6 +105,7 @@ DataFrameModule::DataFrameModule(InviwoApplication* app)
 
     // Processors
     registerProcessor<CSVSource>();
+    registerProcessor<DataFrameDerivedColumn>();
     registerProcessor<DataFrameFilter>();
     registerProcessor<DataFrameJoin>();
     registerProcessor<DataFrameSource>();
@@ -35,11 +35,16 @@
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/unitsystem.h>                      // for Unit
 #include <inviwo/core/util/exception.h>                                 // for Exception, RangeE...
+#include <inviwo/core/util/formatdispatching.h>                         // for Scalars
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 #include <inviwo/core/util/glmvec.h>                                    // for dvec2
 #include <inviwo/core/util/sourcecontext.h>                             // for SourceContext
 #include <inviwo/core/util/stdextensions.h>                             // for transform
 #include <inviwo/core/util/zip.h>
 
+#include <algorithm>      // for min, transform
+#include <iterator>       // for back_inserter
+#include <mutex>          // for scoped_lock
 #include <sstream>        // for basic_stringbuf<>...
 #include <unordered_map>  // for unordered_map
 
@@ -47,6 +52,44 @@
 
 namespace inviwo {
 
+Column::NormalizedCache::NormalizedCache(const NormalizedCache&) {}
+
+Column::NormalizedCache& Column::NormalizedCache::operator=(const NormalizedCache&) {
+    std::scoped_lock lock{mutex};
+    buffer.reset();
+    return *this;
+}
+
+std::shared_ptr<const Buffer<float>> Column::getNormalizedBuffer() const {
+    std::scoped_lock lock{normalized_.mutex};
+    if (!normalized_.buffer) {
+        const dvec2 range = getRange();
+        const double extent = range.y - range.x;
+        normalized_.buffer =
+            getBuffer()
+                ->getRepresentation<BufferRAM>()
+                ->dispatch<std::shared_ptr<const Buffer<float>>, dispatching::filter::Scalars>(
+                    [&](auto ram) {
+                        const auto& src = ram->getDataContainer();
+                        std::vector<float> data(src.size(), 0.5f);
+                        if (extent > 0.0) {
+                            util::parallelFor(0, src.size(), [&](size_t i) {
+                                const double v = (static_cast<double>(src[i]) - range.x) / extent;
+                                data[i] = static_cast<float>(std::clamp(v, 0.0, 1.0));
+                            });
+                        }
+                        return std::shared_ptr<const Buffer<float>>{
+                            util::makeBuffer(std::move(data))};
+                    });
+    }
+    return normalized_.buffer;
+}
+
+void Column::invalidateNormalizedBuffer() {
+    std::scoped_lock lock{normalized_.mutex};
+    normalized_.buffer.reset();
+}
+
 IndexColumn::IndexColumn(std::string_view header, std::shared_ptr<Buffer<std::uint32_t>> buffer)
     : TemplateColumn<std::uint32_t>(header, buffer) {}
 
@@ -60,6 +103,11 @@ IndexColumn* IndexColumn::clone() const { return new IndexColumn(*this); }
 IndexColumn* IndexColumn::clone(std::span<const std::uint32_t> rowSelection) const {
     return new IndexColumn(*this, rowSelection);
 }
+IndexColumn* IndexColumn::createView(RowSelection rowSelection) const {
+    auto view = new IndexColumn(header_, nullptr);
+    view->buffer_ = buffer_.select(std::move(rowSelection));
+    return view;
+}
 
 ColumnType IndexColumn::getColumnType() const { return ColumnType::Index; }
 
@@ -69,7 +117,8 @@ CategoricalColumn::CategoricalColumn(std::string_view header,
     : header_{header}
     , unit_{unit}
     , range_{range}
-    , buffer_{std::make_shared<Buffer<std::uint32_t>>(0)} {
+    , buffer_{std::make_shared<Buffer<std::uint32_t>>(0)}
+    , dictionary_{std::make_shared<CategoricalDictionary>()} {
     append(values);
 }
 
@@ -80,45 +129,38 @@ CategoricalColumn::CategoricalColumn(std::string_view header, std::vector<type>
     , unit_{unit}
     , range_{range}
     , buffer_{util::makeBuffer(std::move(data))}
-    , lookUpTable_{std::move(lookup)} {
-
-    for (auto&& [i, str] : util::enumerate<type>(lookUpTable_)) {
-        lookupMap_[str] = i;
-    }
-}
+    , dictionary_{[&]() {
+        auto dictionary = std::make_shared<CategoricalDictionary>();
+        dictionary->categories = std::move(lookup);
+        for (auto&& [i, str] : util::enumerate<type>(dictionary->categories)) {
+            dictionary->codes.try_emplace(str, i);
+        }
+        return dictionary;
+    }()} {}
 
 CategoricalColumn::CategoricalColumn(const CategoricalColumn& rhs)
     : header_{rhs.header_}
     , unit_{rhs.unit_}
     , range_{rhs.range_}
-    , buffer_{std::shared_ptr<Buffer<std::uint32_t>>(rhs.buffer_->clone())}
-    , lookUpTable_{rhs.lookUpTable_}
-    , lookupMap_{rhs.lookupMap_} {}
+    , buffer_{rhs.buffer_}
+    , dictionary_{rhs.dictionary_} {}
 
 CategoricalColumn::CategoricalColumn(const CategoricalColumn& rhs,
                                      std::span<const std::uint32_t> rowSelection)
     : header_{rhs.header_}
     , unit_{rhs.unit_}
     , range_{rhs.range_}
-    , buffer_{std::make_shared<Buffer<std::uint32_t>>(rowSelection.size())}
-    , lookUpTable_{rhs.lookUpTable_}
-    , lookupMap_{rhs.lookupMap_} {
-
-    const auto& src = rhs.buffer_->getRAMRepresentation()->getDataContainer();
-    auto& dst = buffer_->getEditableRAMRepresentation()->getDataContainer();
-    for (size_t i = 0; i < rowSelection.size(); ++i) {
-        dst[i] = src[rowSelection[i]];
-    }
-}
+    , buffer_{rhs.buffer_.copy(rowSelection)}
+    , dictionary_{rhs.dictionary_} {}
 
 CategoricalColumn& CategoricalColumn::operator=(const CategoricalColumn& rhs) {
     if (this != &rhs) {
         header_ = rhs.getHeader();
         unit_ = rhs.unit_;
         range_ = rhs.range_;
-        buffer_ = std::shared_ptr<Buffer<std::uint32_t>>(rhs.buffer_->clone());
-        lookUpTable_ = rhs.lookUpTable_;
-        lookupMap_ = rhs.lookupMap_;
+        buffer_ = rhs.buffer_;
+        dictionary_ = rhs.dictionary_;
+        invalidateNormalizedBuffer();
     }
     return *this;
 }
@@ -129,8 +171,8 @@ CategoricalColumn& CategoricalColumn::operator=(CategoricalColumn&& rhs) {
         unit_ = rhs.unit_;
         range_ = rhs.range_;
         buffer_ = std::move(rhs.buffer_);
-        lookUpTable_ = std::move(rhs.lookUpTable_);
-        lookupMap_ = std::move(rhs.lookupMap_);
+        dictionary_ = std::move(rhs.dictionary_);
+        invalidateNormalizedBuffer();
     }
     return *this;
 }
@@ -141,6 +183,19 @@ CategoricalColumn* CategoricalColumn::clone(std::span<const std::uint32_t> rowSe
     return new CategoricalColumn(*this, rowSelection);
 }
 
+CategoricalColumn* CategoricalColumn::createView(RowSelection rowSelection) const {
+    auto view = new CategoricalColumn(header_, {}, unit_, range_);
+    view->dictionary_ = dictionary_;
+    view->buffer_ = buffer_.select(std::move(rowSelection));
+    return view;
+}
+
+RowSelection CategoricalColumn::getRowSelection() const { return buffer_.rows(); }
+
+std::shared_ptr<const BufferBase> CategoricalColumn::getSourceBuffer() const {
+    return buffer_.source();
+}
+
 ColumnType CategoricalColumn::getColumnType() const { return ColumnType::Categorical; }
 
 const std::string& CategoricalColumn::getHeader() const { return header_; }
@@ -151,7 +206,10 @@ Unit CategoricalColumn::getUnit() const { return unit_; }
 
 void CategoricalColumn::setUnit(Unit unit) { unit_ = unit; }
 
-void CategoricalColumn::setCustomRange(std::optional<dvec2> range) { range_ = range; }
+void CategoricalColumn::setCustomRange(std::optional<dvec2> range) {
+    range_ = range;
+    invalidateNormalizedBuffer();
+}
 
 std::optional<dvec2> CategoricalColumn::getCustomRange() const { return range_; }
 
@@ -169,24 +227,28 @@ dvec2 CategoricalColumn::getRange() const {
     }
 }
 
-size_t CategoricalColumn::getSize() const { return buffer_->getSize(); }
+size_t CategoricalColumn::getSize() const { return buffer_.size(); }
 
 void CategoricalColumn::set(size_t idx, std::string_view str) {
+    invalidateNormalizedBuffer();
     auto id = addOrGetID(str);
     buffer_->getEditableRAMRepresentation()->set(idx, id);
 }
 
 void CategoricalColumn::set(size_t idx, std::uint32_t id) {
-    if (id >= lookUpTable_.size()) {
+    invalidateNormalizedBuffer();
+    if (id >= dictionary_->categories.size()) {
         throw RangeException(SourceContext{}, "Invalid categorical index: {}", id);
     }
     buffer_->getEditableRAMRepresentation()->set(idx, id);
 }
 
-const std::string& CategoricalColumn::get(size_t idx) const { return lookUpTable_[getId(idx)]; }
+const std::string& CategoricalColumn::get(size_t idx) const {
+    return dictionary_->categories[getId(idx)];
+}
 
 std::uint32_t CategoricalColumn::getId(size_t idx) const {
-    return buffer_->getRAMRepresentation()->get(idx);
+    return buffer_.get(idx);
 }
 
 double CategoricalColumn::getAsDouble(size_t idx) const { return static_cast<double>(getId(idx)); }
@@ -195,28 +257,39 @@ std::string CategoricalColumn::getAsString(size_t idx) const { return get(idx);
 
 std::vector<std::string> CategoricalColumn::getValues() const {
     const auto& data = buffer_->getRAMRepresentation()->getDataContainer();
-    return util::transform(data, [&](auto idx) { return lookUpTable_[idx]; });
+    return util::transform(data, [&](auto idx) { return dictionary_->categories[idx]; });
 }
 
 void CategoricalColumn::add(std::string_view value) {
+    invalidateNormalizedBuffer();
     auto id = addOrGetID(value);
     buffer_->getEditableRAMRepresentation()->add(id);
 }
 
 CategoricalColumn::AddMany CategoricalColumn::addMany() {
+    invalidateNormalizedBuffer();
     auto rep = buffer_->getEditableRAMRepresentation();
     return AddMany{this, rep};
 }
 
 void CategoricalColumn::append(const Column& col) {
     if (col.getSize() == 0) return;
+    invalidateNormalizedBuffer();
 
     if (auto srccol = dynamic_cast<const CategoricalColumn*>(&col)) {
         auto& values = buffer_->getEditableRAMRepresentation()->getDataContainer();
-
-        for (auto idx : srccol->buffer_->getRAMRepresentation()->getDataContainer()) {
-            const auto& value = srccol->lookUpTable_[idx];
-            values.push_back(addOrGetID(value));
+        const auto& src = srccol->buffer_->getRAMRepresentation()->getDataContainer();
+
+        if (srccol->dictionary_ == dictionary_) {
+            values.insert(values.end(), src.begin(), src.end());
+        } else {
+            // Look up each category once instead of once per row
+            const auto codes =
+                util::transform(srccol->dictionary_->categories,
+                                [&](const std::string& cat) { return addOrGetID(cat); });
+            values.reserve(values.size() + src.size());
+            std::ranges::transform(src, std::back_inserter(values),
+                                   [&](std::uint32_t code) { return codes[code]; });
         }
 
     } else {
@@ -226,6 +299,7 @@ void CategoricalColumn::append(const Column& col) {
 
 void CategoricalColumn::append(const std::vector<std::string>& data) {
     if (data.empty()) return;
+    invalidateNormalizedBuffer();
 
     auto& values = buffer_->getEditableRAMRepresentation()->getDataContainer();
     values.reserve(values.size() + data.size());
@@ -234,27 +308,91 @@ void CategoricalColumn::append(const std::vector<std::string>& data) {
     }
 }
 
+void CategoricalColumn::append(std::span<const std::string_view> data) {
+    if (data.empty()) return;
+    invalidateNormalizedBuffer();
+
+    auto& values = buffer_->getEditableRAMRepresentation()->getDataContainer();
+    const auto offset = values.size();
+    values.resize(offset + data.size());
+
+    // Encode each chunk with codes of a local dictionary, keeping the order of first appearance
+    constexpr size_t chunkSize = 1 << 16;
+    const size_t chunks = (data.size() + chunkSize - 1) / chunkSize;
+    std::vector<std::vector<std::string_view>> local(chunks);
+    util::parallelFor(0, chunks, [&](size_t chunk) {
+        std::unordered_map<std::string_view, std::uint32_t> codes;
+        const auto end = std::min(data.size(), (chunk + 1) * chunkSize);
+        for (size_t i = chunk * chunkSize; i < end; ++i) {
+            auto [it, inserted] =
+                codes.try_emplace(data[i], static_cast<std::uint32_t>(local[chunk].size()));
+            if (inserted) local[chunk].push_back(data[i]);
+            values[offset + i] = it->second;
+        }
+    });
+
+    // Merge the local dictionaries in chunk order and remap the local codes
+    std::vector<std::vector<std::uint32_t>> remap(chunks);
+    for (auto&& [categories, codes] : util::zip(local, remap)) {
+        codes = util::transform(categories, [&](std::string_view cat) { return addOrGetID(cat); });
+    }
+    util::parallelFor(0, data.size(), [&](size_t i) {
+        auto& code = values[offset + i];
+        code = remap[i / chunkSize][code];
+    });
+}
+
 std::uint32_t CategoricalColumn::addCategory(std::string_view cat) { return addOrGetID(cat); }
 
 glm::uint32_t CategoricalColumn::addOrGetID(std::string_view str) {
-    if (auto it = lookupMap_.find(str); it != lookupMap_.end()) {
+    if (auto code = dictionary_->find(str)) {
+        return *code;
+    } else {
+        return editableDictionary().add(str);
+    }
+}
+
+CategoricalDictionary& CategoricalColumn::editableDictionary() {
+    if (dictionary_.use_count() > 1) {
+        dictionary_ = std::make_shared<CategoricalDictionary>(*dictionary_);
+    }
+    // The dictionary is only shared as const with other columns
+    return const_cast<CategoricalDictionary&>(*dictionary_);
+}
+
+std::uint32_t CategoricalDictionary::add(std::string_view category) {
+    if (auto it = codes.find(category); it != codes.end()) {
         return it->second;
     } else {
-        lookUpTable_.emplace_back(str);
-        auto ind = static_cast<std::uint32_t>(lookUpTable_.size() - 1);
-        lookupMap_.emplace(str, ind);
-        return ind;
+        const auto code = static_cast<std::uint32_t>(categories.size());
+        categories.emplace_back(category);
+        codes.try_emplace(categories.back(), code);
+        return code;
     }
 }
 
-std::shared_ptr<BufferBase> CategoricalColumn::getBuffer() { return buffer_; }
+std::optional<std::uint32_t> CategoricalDictionary::find(std::string_view category) const {
+    if (auto it = codes.find(category); it != codes.end()) {
+        return it->second;
+    } else {
+        return std::nullopt;
+    }
+}
 
-std::shared_ptr<const BufferBase> CategoricalColumn::getBuffer() const { return buffer_; }
+std::shared_ptr<BufferBase> CategoricalColumn::getBuffer() {
+    invalidateNormalizedBuffer();
+    return buffer_.buffer();
+}
 
-std::shared_ptr<Buffer<std::uint32_t>> CategoricalColumn::getTypedBuffer() { return buffer_; }
+std::shared_ptr<const BufferBase> CategoricalColumn::getBuffer() const { return buffer_.buffer(); }
+
+std::shared_ptr<Buffer<std::uint32_t>> CategoricalColumn::getTypedBuffer() {
+    invalidateNormalizedBuffer();
+    return buffer_.buffer();
+}
 
 std::shared_ptr<const Buffer<std::uint32_t>> CategoricalColumn::getTypedBuffer() const {
-    return buffer_;
+    return buffer_.buffer();
 }
 
 std::string_view enumToStr(ColumnType type) {
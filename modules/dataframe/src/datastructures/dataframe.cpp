@@ -45,6 +45,7 @@
 #include <algorithm>      // for max, remove_if
 #include <iterator>       // for begin, end
 #include <numeric>        // for iota
+#include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
 #include <utility>        // for move
 
@@ -85,6 +86,27 @@ DataFrame::DataFrame(const DataFrame& rhs, std::span<const std::uint32_t> rowSel
     }
 }
 
+DataFrame::DataFrame(const DataFrame& rhs, RowSelection rowSelection)
+    : MetaDataOwner{rhs}, columns_{} {
+    // Columns that already are views select from their source rows, compose the selections once
+    // per source selection since all columns of a view typically share it.
+    std::unordered_map<const std::vector<std::uint32_t>*, RowSelection> composed;
+    for (const auto& col : rhs.columns_) {
+        if (auto sourceRows = col->getRowSelection()) {
+            auto [it, inserted] = composed.try_emplace(sourceRows.get());
+            if (inserted) {
+                auto rows = std::make_shared<std::vector<std::uint32_t>>(rowSelection->size());
+                std::ranges::transform(*rowSelection, rows->begin(),
+                                       [&](std::uint32_t row) { return (*sourceRows)[row]; });
+                it->second = std::move(rows);
+            }
+            columns_.emplace_back(col->createView(it->second));
+        } else {
+            columns_.emplace_back(col->createView(rowSelection));
+        }
+    }
+}
+
 DataFrame::DataFrame(const DataFrame& rhs, std::span<const std::string> columnSelection)
     : MetaDataOwner{rhs}, columns_{} {
     for (const auto& col : columnSelection) {
@@ -35,10 +35,12 @@
 #include <inviwo/core/datastructures/unitsystem.h>                      // for Unit
 #include <inviwo/core/io/datareader.h>                                  // for DataReaderType
 #include <inviwo/core/io/datareaderexception.h>                         // for DataReaderException
+#include <inviwo/core/io/memorymappedfile.h>                            // for MemoryMappedFile
 #include <inviwo/core/util/detected.h>                                  // for alwaysFalse
 #include <inviwo/core/util/fileextension.h>                             // for FileExtension
 #include <inviwo/core/util/filesystem.h>                                // for skipByteOrderMark
 #include <inviwo/core/util/logcentral.h>                                // for LogCentral
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 #include <inviwo/core/util/raiiutils.h>                                 // for OnScopeExit, OnSc...
 #include <inviwo/core/util/safecstr.h>                                  // for SafeCStr
 #include <inviwo/core/util/sourcecontext.h>                             // for SourceContext
@@ -58,6 +60,7 @@
 #include <functional>     // for function, __base
 #include <iterator>       // for istreambuf_iterator
 #include <limits>         // for numeric_limits
+#include <numeric>        // for accumulate
 #include <optional>       // for optional, nullopt
 #include <regex>          // for regex_match, smatch
 #include <sstream>        // for basic_stringbuf<>...
@@ -241,7 +244,35 @@ std::any CSVReader::getOption(std::string_view key) {
 }
 
 std::shared_ptr<DataFrame> CSVReader::readData(const std::filesystem::path& fileName) {
-    auto file = openAndCacheIfUrl(fileName);
+    return readFile(fileName, util::ParallelSettings{});
+}
+
+std::shared_ptr<DataFrame> CSVReader::readDataAsync(const std::filesystem::path& fileName,
+                                                    const pool::Stop& stop,
+                                                    const pool::Progress& progress) {
+    return readFile(fileName, {.stop = stop, .progress = progress});
+}
+
+std::shared_ptr<DataFrame> CSVReader::readFile(const std::filesystem::path& fileName,
+                                               const util::ParallelSettings& settings) const {
+    const auto localPath = downloadAndCacheIfUrl(fileName);
+    checkExists(localPath);
+
+    if (util::MemoryMappedFile::isMappable(localPath)) {
+        const auto size = static_cast<size_t>(std::filesystem::file_size(localPath));
+        if (size == 0) {
+            throw DataReaderException(SourceContext{}, "Emtpy file: {}", fileName);
+        }
+        // Parse straight from the page cache instead of copying the whole file into a string
+        const util::MemoryMappedFile file{localPath, 0, size};
+        std::string_view content{reinterpret_cast<const char*>(file.data()), file.size()};
+        if (content.starts_with("\xef\xbb\xbf")) {
+            content.remove_prefix(3);
+        }
+        return readContent(content, settings);
+    }
+
+    auto file = open(localPath);
 
     file.seekg(0, std::ios::end);
     std::streampos len = file.tellg();
@@ -251,7 +282,10 @@ std::shared_ptr<DataFrame> CSVReader::readData(const std::filesystem::path& file
         throw DataReaderException(SourceContext{}, "Emtpy file: {}", fileName);
     }
 
-    return readData(file);
+    filesystem::skipByteOrderMark(file);
+    const std::string content{std::istreambuf_iterator<char>(file),
+                              std::istreambuf_iterator<char>()};
+    return readContent(content, settings);
 }
 
 namespace util {
@@ -427,8 +461,94 @@ std::string_view stripQuotes(std::string_view str) {
     return str;
 };
 
+/*
+ * Split str into rows, equivalent to parse(str, "\n", ...) but in parallel. First the quotes and
+ * newlines of each chunk are counted, which gives the quote state and line number at the start of
+ * every chunk. Then all chunks are scanned for the newlines outside of quotes.
+ */
+std::vector<std::pair<std::string_view, size_t>> splitRows(std::string_view str) {
+    if (str.empty()) return {};
+
+    constexpr size_t chunkSize = 1 << 20;
+    const size_t nChunks = (str.size() + chunkSize - 1) / chunkSize;
+    const auto chunk = [&](size_t i) { return str.substr(i * chunkSize, chunkSize); };
+
+    struct Counts {
+        size_t quotes = 0;
+        size_t lines = 0;
+    };
+    std::vector<Counts> counts(nChunks);
+    util::parallelFor(0, nChunks, [&](size_t i) {
+        const auto c = chunk(i);
+        counts[i].quotes = static_cast<size_t>(std::count(c.begin(), c.end(), '"'));
+        counts[i].lines = static_cast<size_t>(std::count(c.begin(), c.end(), '\n'));
+    });
+
+    // Position of every newline outside of quotes and the line number of the row following it
+    std::vector<std::vector<std::pair<size_t, size_t>>> breaks(nChunks);
+    std::vector<Counts> starts(nChunks);
+    for (size_t i = 1; i < nChunks; ++i) {
+        starts[i].quotes = starts[i - 1].quotes + counts[i - 1].quotes;
+        starts[i].lines = starts[i - 1].lines + counts[i - 1].lines;
+    }
+    util::parallelFor(0, nChunks, [&](size_t i) {
+        const auto c = chunk(i);
+        bool quoted = starts[i].quotes % 2 != 0;
+        size_t line = starts[i].lines + 1;
+        for (size_t pos = 0; pos < c.size(); ++pos) {
+            if (c[pos] == '"') {
+                quoted = !quoted;
+            } else if (c[pos] == '\n') {
+                ++line;
+                if (!quoted) breaks[i].emplace_back(i * chunkSize + pos, line);
+            }
+        }
+    });
+
+    std::vector<std::pair<std::string_view, size_t>> rows;
+    rows.reserve(std::accumulate(breaks.begin(), breaks.end(), size_t{1},
+                                 [](size_t sum, const auto& b) { return sum + b.size(); }));
+    size_t first = 0;
+    size_t line = 1;
+    for (const auto& chunkBreaks : breaks) {
+        for (const auto& [pos, nextLine] : chunkBreaks) {
+            rows.emplace_back(util::trim(str.substr(first, pos - first)), line);
+            first = pos + 1;
+            line = nextLine;
+        }
+    }
+    if (nChunks > 0 && (starts.back().quotes + counts.back().quotes) % 2 != 0) {
+        throw DataReaderException(SourceContext{}, "Detected unmatched quote starting on line: {}",
+                                  line);
+    }
+    rows.emplace_back(util::trim(str.substr(first)), line);
+
+    return rows;
+}
+
 }  // namespace util
 
+/**
+ * Destination of the values of a column. Numerical values are parsed in parallel straight into the
+ * data container of the column, categorical values are first collected and then encoded in bulk.
+ */
+struct CSVReader::ColumnParser {
+    template <typename T>
+    struct Numeric {
+        std::vector<T>* data;
+        EmptyField emptyField;
+    };
+    struct Categorical {
+        CategoricalColumn* column;
+        bool stripQuotes;
+        std::vector<std::string_view> cells;
+    };
+
+    std::variant<Numeric<std::uint32_t>, Numeric<int>, Numeric<float>, Numeric<double>,
+                 Categorical>
+        target;
+};
+
 std::vector<CSVReader::TypeCounts> CSVReader::findCellTypes(
     size_t nCol, const std::vector<std::pair<std::string_view, size_t>>& rows,
     size_t sampleRows) const {
@@ -471,64 +591,70 @@ std::vector<CSVReader::TypeCounts> CSVReader::findCellTypes(
     return counts;
 }
 
+namespace {
+
 template <typename T, bool index = false>
-std::function<void(std::string_view, size_t, size_t)> addColumn(DataFrame& df,
-                                                                std::string_view header, Unit unit,
-                                                                CSVReader::EmptyField emptyField,
-                                                                bool cLocale) {
-    auto& data = [&]() -> decltype(auto) {
-        if constexpr (index && std::is_same_v<T, std::uint32_t>) {
-            df.getIndexColumn()->setHeader(header);
-            df.getIndexColumn()->setUnit(unit);
-            return df.getIndexColumn()
-                ->getTypedBuffer()
-                ->getEditableRAMRepresentation()
-                ->getDataContainer();
-        } else {
-            return df.addColumn<T>(header, 0, unit)
-                ->getTypedBuffer()
-                ->getEditableRAMRepresentation()
-                ->getDataContainer();
-        }
-    }();
-    return [&data, cLocale, emptyField](std::string_view str, size_t line, size_t col) {
-        if (str.empty()) {
-            switch (emptyField) {
-                case CSVReader::EmptyField::Throw:
-                    throw DataReaderException(SourceContext{}, "Empty field on line {}, column {}",
-                                              line, col);
-                case CSVReader::EmptyField::NanOrZero:
-                    if constexpr (std::is_floating_point_v<T>) {
-                        data.push_back(std::numeric_limits<T>::quiet_NaN());
-                    } else {
-                        data.emplace_back();
-                    }
-                    break;
-                case CSVReader::EmptyField::EmptyOrZero:
-                    data.emplace_back();
-                    break;
-                default:
-                    data.emplace_back();
-                    break;
-            }
-        } else if (auto val = util::toNumber<T>(str, cLocale)) {
-            data.push_back(*val);
-        } else {
-            throw DataReaderException(SourceContext{}, "Invalid format on line {}, column {}", line,
-                                      col);
+std::vector<T>* addColumn(DataFrame& df, std::string_view header, Unit unit) {
+    if constexpr (index && std::is_same_v<T, std::uint32_t>) {
+        df.getIndexColumn()->setHeader(header);
+        df.getIndexColumn()->setUnit(unit);
+        return &df.getIndexColumn()
+                    ->getTypedBuffer()
+                    ->getEditableRAMRepresentation()
+                    ->getDataContainer();
+    } else {
+        return &df.addColumn<T>(header, 0, unit)
+                    ->getTypedBuffer()
+                    ->getEditableRAMRepresentation()
+                    ->getDataContainer();
+    }
+}
+
+template <typename T>
+void parseCell(std::string_view str, size_t line, size_t col, CSVReader::EmptyField emptyField,
+               bool cLocale, T& dst) {
+    if (str.empty()) {
+        switch (emptyField) {
+            case CSVReader::EmptyField::Throw:
+                throw DataReaderException(SourceContext{}, "Empty field on line {}, column {}",
+                                          line, col);
+            case CSVReader::EmptyField::NanOrZero:
+                if constexpr (std::is_floating_point_v<T>) {
+                    dst = std::numeric_limits<T>::quiet_NaN();
+                } else {
+                    dst = T{};
+                }
+                break;
+            case CSVReader::EmptyField::EmptyOrZero:
+                dst = T{};
+                break;
+            default:
+                dst = T{};
+                break;
         }
-    };
+    } else if (auto val = util::toNumber<T>(str, cLocale)) {
+        dst = *val;
+    } else {
+        throw DataReaderException(SourceContext{}, "Invalid format on line {}, column {}", line,
+                                  col);
+    }
 }
 
-std::vector<std::function<void(std::string_view, size_t, size_t)>> CSVReader::addColumns(
+}  // namespace
+
+std::vector<CSVReader::ColumnParser> CSVReader::addColumns(
     DataFrame& df, const std::vector<TypeCounts>& typeCounts,
     const std::vector<std::string>& headers) const {
 
-    const bool cLocale = locale_ == "C";
     std::regex re{unitRegexp_};
     std::smatch m;
 
-    std::vector<std::function<void(std::string_view, size_t, size_t)>> appenders;
+    const auto categorical = [&](std::string_view header) {
+        return ColumnParser{
+            ColumnParser::Categorical{df.addCategoricalColumn(header).get(), stripQuotes_, {}}};
+    };
+
+    std::vector<ColumnParser> parsers;
     for (auto&& [counts, header] : util::zip(typeCounts, headers)) {
         auto headerCopy = header;
         Unit unit{};
@@ -541,36 +667,25 @@ std::vector<std::function<void(std::string_view, size_t, size_t)>> CSVReader::ad
         }
 
         if (counts.index) {
-            appenders.push_back(addColumn<std::uint32_t, true>(
-                df, headerCopy, unit, CSVReader::EmptyField::Throw, cLocale));
-        } else if (stripQuotes_ && counts.string > 0) {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back([f = col->addMany()](std::string_view str, size_t, size_t) {
-                f(util::stripQuotes(str));
-            });
+            parsers.push_back({ColumnParser::Numeric<std::uint32_t>{
+                addColumn<std::uint32_t, true>(df, headerCopy, unit), EmptyField::Throw}});
         } else if (counts.string > 0) {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back(
-                [f = col->addMany()](std::string_view str, size_t, size_t) { f(str); });
+            parsers.push_back(categorical(header));
         } else if (doublePrecision_ && counts.real > 0) {
-            appenders.push_back(addColumn<double>(df, headerCopy, unit, emptyField_, cLocale));
+            parsers.push_back({ColumnParser::Numeric<double>{
+                addColumn<double>(df, headerCopy, unit), emptyField_}});
         } else if (!doublePrecision_ && counts.real > 0) {
-            appenders.push_back(addColumn<float>(df, headerCopy, unit, emptyField_, cLocale));
+            parsers.push_back({ColumnParser::Numeric<float>{
+                addColumn<float>(df, headerCopy, unit), emptyField_}});
         } else if (counts.integer > 0) {
-            appenders.push_back(addColumn<int>(df, headerCopy, unit, emptyField_, cLocale));
-        } else if (stripQuotes_) {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back([f = col->addMany()](std::string_view str, size_t, size_t) {
-                f(util::stripQuotes(str));
-            });
+            parsers.push_back(
+                {ColumnParser::Numeric<int>{addColumn<int>(df, headerCopy, unit), emptyField_}});
         } else {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back(
-                [f = col->addMany()](std::string_view str, size_t, size_t) { f(str); });
+            parsers.push_back(categorical(header));
         }
     }
 
-    return appenders;
+    return parsers;
 }
 
 bool CSVReader::skipRow(std::string_view row, size_t lineNumber, bool filterOnHeader) const {
@@ -642,6 +757,13 @@ bool CSVReader::skipRow(std::string_view row, size_t lineNumber, bool filterOnHe
 std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
     filesystem::skipByteOrderMark(stream);
 
+    const std::string content{std::istreambuf_iterator<char>(stream),
+                              std::istreambuf_iterator<char>()};
+    return readContent(content, util::ParallelSettings{});
+}
+
+std::shared_ptr<DataFrame> CSVReader::readContent(std::string_view content,
+                                                  const util::ParallelSettings& settings) const {
     util::OnScopeExit cleanup{nullptr};
     if (!config::charconv || locale_ != "C") {
         // We need to use the C locale here to force use of decimal "."
@@ -653,19 +775,18 @@ std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
         cleanup.setAction([prev]() { std::setlocale(LC_ALL, prev.c_str()); });
     }
 
-    std::string content{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
     std::string_view trimmed{content};
     if (auto pos = trimmed.find_last_not_of(" \f\n\r\t\v"); pos != std::string_view::npos) {
         trimmed = trimmed.substr(0, pos + 1);
     }
 
-    std::vector<std::pair<std::string_view, size_t>> rows;
-    util::parse(trimmed, "\n", std::nullopt, std::nullopt,
-                [&](std::string_view line, [[maybe_unused]] size_t index, size_t lineNumber) {
-                    if (!skipRow(line, lineNumber, true)) {
-                        rows.emplace_back(line, lineNumber);
-                    }
-                });
+    const bool hasFilters = !filters_.includeRows.empty() || !filters_.excludeRows.empty() ||
+                            !filters_.includeItems.empty() || !filters_.excludeItems.empty();
+
+    auto rows = util::splitRows(trimmed);
+    if (hasFilters) {
+        std::erase_if(rows, [&](const auto& row) { return skipRow(row.first, row.second, true); });
+    }
 
     if (rows.empty()) {
         throw DataReaderException("No data");
@@ -698,15 +819,56 @@ std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
             throw Exception("Unable to use first column as index, invalid data found");
         }
     }
-    const auto appenders = addColumns(*df, types, headers);
+    auto parsers = addColumns(*df, types, headers);
+
+    // The filters are user provided functions, only call them from this thread
+    if (hasFilters) {
+        std::erase_if(rows, [&](const auto& row) { return skipRow(row.first, row.second, false); });
+    }
+
+    for (auto& parser : parsers) {
+        std::visit(util::overloaded{
+                       [&]<typename T>(ColumnParser::Numeric<T>& numeric) {
+                           numeric.data->resize(rows.size());
+                       },
+                       [&](ColumnParser::Categorical& categorical) {
+                           categorical.cells.resize(rows.size());
+                       }},
+                   parser.target);
+    }
+
+    const bool cLocale = locale_ == "C";
+    util::parallelFor(
+        0, rows.size(),
+        [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                const auto& [row, lineNumber] = rows[i];
+                util::parse(
+                    row, delimiters_, headers.size(), lineNumber,
+                    [&, l = lineNumber](std::string_view cell, size_t index,
+                                        [[maybe_unused]] size_t part) {
+                        std::visit(util::overloaded{
+                                       [&]<typename T>(ColumnParser::Numeric<T>& numeric) {
+                                           parseCell(cell, l, index + 1, numeric.emptyField,
+                                                     cLocale, (*numeric.data)[i]);
+                                       },
+                                       [&](ColumnParser::Categorical& categorical) {
+                                           categorical.cells[i] =
+                                               categorical.stripQuotes ? util::stripQuotes(cell)
+                                                                       : cell;
+                                       }},
+                                   parsers[index].target);
+                    });
+            }
+        },
+        {.grainSize = 4096, .stop = settings.stop, .progress = settings.progress});
+
+    if (settings.stop && *settings.stop) return nullptr;
 
-    for (const auto& [row, lineNumber] : rows) {
-        if (!skipRow(row, lineNumber, false)) {
-            util::parse(row, delimiters_, headers.size(), lineNumber,
-                        [&, l = lineNumber](std::string_view cell, size_t index,
-                                            [[maybe_unused]] size_t part) {
-                            appenders[index](cell, l, index + 1);
-                        });
+    for (auto& parser : parsers) {
+        if (auto* categorical = std::get_if<ColumnParser::Categorical>(&parser.target)) {
+            categorical->column->append(categorical->cells);
+            categorical->cells = {};
         }
     }
 
@@ -85,7 +85,7 @@ void CSVWriter::writeData(const DataFrame* dataFrame, std::ostream& file) const
         if ((col->getColumnType() == ColumnType::Index) && !exportIndexCol) {
             continue;
         }
-        const auto components = col->getBuffer()->getDataFormat()->getComponents();
+        const auto components = col->getSourceBuffer()->getDataFormat()->getComponents();
         if (components > 1 && separateVectorTypesIntoColumns) {
             for (size_t k = 0; k < components; k++) {
                 oj = fmt::format("{0}{1} {2}{3: [}{0}", citation, col->getHeader(),
@@ -102,37 +102,41 @@ void CSVWriter::writeData(const DataFrame* dataFrame, std::ostream& file) const
         if ((col->getColumnType() == ColumnType::Index) && !exportIndexCol) {
             continue;
         }
-        auto df = col->getBuffer()->getDataFormat();
+        // Read views of selected rows through their source buffer instead of materializing them
+        auto df = col->getSourceBuffer()->getDataFormat();
+        auto rows = col->getRowSelection();
+        auto row = [rows](size_t index) -> size_t { return rows ? (*rows)[index] : index; };
         if (auto cc = dynamic_cast<const CategoricalColumn*>(col.get())) {
             printers.push_back([cc, citation](std::ostream& os, size_t index) {
                 os << citation << cc->getAsString(index) << citation;
             });
         } else if (df->getComponents() == 1) {
-            col->getBuffer()
+            col->getSourceBuffer()
                 ->getRepresentation<BufferRAM>()
-                ->dispatch<void, dispatching::filter::Scalars>([&printers](auto br) {
-                    printers.push_back([br](std::ostream& os, size_t index) {
-                        os << br->getDataContainer()[index];
+                ->dispatch<void, dispatching::filter::Scalars>([&printers, row](auto br) {
+                    printers.push_back([br, row](std::ostream& os, size_t index) {
+                        os << br->getDataContainer()[row(index)];
                     });
                 });
         } else if (df->getComponents() > 1 && separateVectorTypesIntoColumns) {
-            col->getBuffer()
+            col->getSourceBuffer()
                 ->getRepresentation<BufferRAM>()
-                ->dispatch<void, dispatching::filter::Vecs>([&printers, this](auto br) {
+                ->dispatch<void, dispatching::filter::Vecs>([&printers, row, this](auto br) {
                     using ValueType = util::PrecisionValueType<decltype(br)>;
-                    printers.push_back([br, this](std::ostream& os, size_t index) {
+                    printers.push_back([br, row, this](std::ostream& os, size_t index) {
                         auto oj = util::make_ostream_joiner(os, delimiter);
+                        const auto& value = br->getDataContainer()[row(index)];
                         for (size_t i = 0; i < util::flat_extent<ValueType>::value; ++i) {
-                            oj = br->getDataContainer()[index][i];
+                            oj = value[i];
                         }
                     });
                 });
         } else {
-            col->getBuffer()
+            col->getSourceBuffer()
                 ->getRepresentation<BufferRAM>()
-                ->dispatch<void, dispatching::filter::Vecs>([&printers, citation](auto br) {
-                    printers.push_back([br, citation](std::ostream& os, size_t index) {
-                        os << citation << br->getDataContainer()[index] << citation;
+                ->dispatch<void, dispatching::filter::Vecs>([&printers, row, citation](auto br) {
+                    printers.push_back([br, row, citation](std::ostream& os, size_t index) {
+                        os << citation << br->getDataContainer()[row(index)] << citation;
                     });
                 });
         }
@@ -33,7 +33,7 @@
 #include <inviwo/core/util/fileextension.h>             // for FileExtension
 #include <inviwo/core/util/sourcecontext.h>             // for SourceContext
 #include <inviwo/dataframe/datastructures/dataframe.h>  // for DataFrame
-#include <inviwo/dataframe/jsondataframeconversion.h>   // IWYU pragma: keep
+#include <inviwo/dataframe/jsondataframeconversion.h>   // for parseDataFrame
 #include <modules/json/json.h>
 
 #include <fstream>  // for basic_ifstream, ios, istream, str...
@@ -62,11 +62,15 @@ std::shared_ptr<DataFrame> JSONDataFrameReader::readData(const std::filesystem::
 }
 
 std::shared_ptr<DataFrame> JSONDataFrameReader::readData(std::istream& stream) const {
-    json j;
-    stream >> j;
     auto dataFrame = std::make_shared<DataFrame>();
-    *dataFrame = j;
-
+    if (stream.tellg() != std::istream::pos_type(-1)) {
+        // Parse straight into the columns, avoids keeping the whole document in memory
+        parseDataFrame(stream, *dataFrame);
+    } else {
+        json j;
+        stream >> j;
+        *dataFrame = j;
+    }
     return dataFrame;
 }
 
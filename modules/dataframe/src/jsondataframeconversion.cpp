@@ -36,6 +36,7 @@
 #include <inviwo/core/util/exception.h>                                 // for SourceContext
 #include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
 #include <inviwo/core/util/formats.h>                                   // for DataFormatBase
+#include <inviwo/core/util/stdextensions.h>                             // for overloaded
 #include <inviwo/core/util/stringconversion.h>                          // for toString
 #include <inviwo/core/util/zip.h>
 #include <inviwo/dataframe/datastructures/column.h>     // for TemplateColumn
@@ -51,6 +52,7 @@
 #include <type_traits>    // for remove_extent_t
 #include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
+#include <variant>        // for variant, visit
 #include <vector>         // for vector
 #include <limits>
 
@@ -261,6 +263,202 @@ void createColumnsFromTypes(const json& j, DataFrame& df) {
     }
 }
 
+/**
+ * SAX handler for the layout of from_json. It is used in two passes over the same input, see
+ * parseDataFrame. The header pass records the columns, the types, the number of rows and the type
+ * of the first non-null value of each column. The data pass appends the index and the row values
+ * to the columns of the DataFrame through the appenders.
+ */
+class DataFrameSax {
+public:
+    enum class Pass { Header, Data };
+    enum class Section { Other, Columns, Types, Index, Data };
+    using Value =
+        std::variant<std::nullptr_t, bool, std::int64_t, std::uint64_t, double, std::string_view>;
+
+    explicit DataFrameSax(Pass pass) : pass{pass} {}
+
+    bool null() { return value(nullptr, json::value_t::null); }
+    bool boolean(bool val) { return value(val, json::value_t::boolean); }
+    bool number_integer(json::number_integer_t val) {
+        return value(std::int64_t{val}, json::value_t::number_integer);
+    }
+    bool number_unsigned(json::number_unsigned_t val) {
+        return value(std::uint64_t{val}, json::value_t::number_unsigned);
+    }
+    bool number_float(json::number_float_t val, const json::string_t&) {
+        return value(double{val}, json::value_t::number_float);
+    }
+    bool string(json::string_t& val) { return value(std::string_view{val}, json::value_t::string); }
+    bool binary(json::binary_t&) {
+        throw JSONConversionException("Binary elements are unsupported");
+    }
+
+    bool start_object(size_t) {
+        if (depth == 0) {
+            isObject = true;
+        } else if (section == Section::Data && depth >= 3) {
+            throw JSONConversionException(
+                "Object (unordered set of name/value pairs) is unsupported");
+        }
+        ++depth;
+        return true;
+    }
+    bool key(json::string_t& key) {
+        if (depth == 1) {
+            ++keys;
+            section = key == "columns" ? Section::Columns
+                      : key == "types" ? Section::Types
+                      : key == "index" ? Section::Index
+                      : key == "data"  ? Section::Data
+                                       : Section::Other;
+            if (section != Section::Other) found[sectionIndex()] = Found::Value;
+        }
+        return true;
+    }
+    bool end_object() {
+        --depth;
+        return true;
+    }
+    bool start_array(size_t) {
+        if (depth == 0) return false;  // Only objects are supported, stop parsing
+        if (depth == 1 && section != Section::Other) {
+            found[sectionIndex()] = Found::Array;
+        } else if (depth == 2 && section == Section::Data) {
+            column = 0;
+        } else if (depth == 3 && section == Section::Data) {
+            throw JSONConversionException("Array (ordered collection of values) is unsupported");
+        }
+        ++depth;
+        return true;
+    }
+    bool end_array() {
+        --depth;
+        if (depth == 2 && section == Section::Data) endRow();
+        return true;
+    }
+    bool parse_error(size_t position, const std::string& lastToken, const json::exception& e) {
+        throw JSONConversionException(SourceContext{}, "Invalid JSON at position {} ('{}'): {}",
+                                      position, lastToken, e.what());
+    }
+
+    enum class Found { No, Value, Array };
+    bool isFound(Section s) const { return found[static_cast<size_t>(s) - 1] != Found::No; }
+    bool isArray(Section s) const { return found[static_cast<size_t>(s) - 1] == Found::Array; }
+
+    Pass pass;
+    bool isObject = false;
+    size_t keys = 0;
+    std::array<Found, 4> found{Found::No, Found::No, Found::No, Found::No};
+
+    // Header pass results
+    std::vector<std::string> columns;
+    std::vector<std::string> types;
+    std::vector<json::value_t> valueTypes;
+    size_t rows = 0;
+    size_t indices = 0;
+    size_t minRowSize = std::numeric_limits<size_t>::max();
+    size_t maxRowSize = 0;
+
+    // Data pass targets
+    std::vector<IndexColumn::type>* index = nullptr;
+    std::vector<std::function<void(const Value&)>> appenders;
+
+private:
+    size_t sectionIndex() const { return static_cast<size_t>(section) - 1; }
+
+    bool value(const Value& val, json::value_t type) {
+        if (depth == 0) return false;  // Only objects are supported, stop parsing
+
+        if (depth == 2 && section == Section::Columns && pass == Pass::Header) {
+            if (type != json::value_t::string) {
+                throw JSONConversionException(R"(expected column header 'string' in "columns")");
+            }
+            columns.emplace_back(std::get<std::string_view>(val));
+        } else if (depth == 2 && section == Section::Types && pass == Pass::Header) {
+            if (type != json::value_t::string) {
+                throw JSONConversionException(R"(expected data type 'string' in "types")");
+            }
+            types.emplace_back(std::get<std::string_view>(val));
+        } else if (depth == 2 && section == Section::Index) {
+            if (pass == Pass::Header) {
+                ++indices;
+            } else {
+                index->push_back(std::visit(
+                    util::overloaded{
+                        [](std::nullptr_t) -> IndexColumn::type {
+                            throw JSONConversionException(R"(expected numbers in "index")");
+                        },
+                        [](std::string_view) -> IndexColumn::type {
+                            throw JSONConversionException(R"(expected numbers in "index")");
+                        },
+                        [](auto v) { return static_cast<IndexColumn::type>(v); }},
+                    val));
+            }
+        } else if (depth == 2 && section == Section::Data) {
+            throw JSONConversionException(R"(the rows in "data" must be arrays)");
+        } else if (depth == 3 && section == Section::Data) {
+            if (pass == Pass::Header) {
+                if (column >= valueTypes.size()) valueTypes.resize(column + 1, json::value_t::null);
+                if (valueTypes[column] == json::value_t::null) valueTypes[column] = type;
+            } else {
+                if (column >= appenders.size()) {
+                    throw JSONConversionException(SourceContext{},
+                                                  "row {} has more than {} values", rows,
+                                                  appenders.size());
+                }
+                appenders[column](val);
+            }
+            ++column;
+        }
+        return true;
+    }
+
+    void endRow() {
+        minRowSize = std::min(minRowSize, column);
+        maxRowSize = std::max(maxRowSize, column);
+        if (pass == Pass::Data && column != appenders.size()) {
+            throw JSONConversionException(SourceContext{}, "row {} has {} values, expected {}",
+                                          rows, column, appenders.size());
+        }
+        ++rows;
+    }
+
+    size_t depth = 0;
+    Section section = Section::Other;
+    size_t column = 0;
+};
+
+template <typename T>
+std::function<void(const DataFrameSax::Value&)> numberAppender(std::vector<T>& data,
+                                                               std::string_view header) {
+    return [&data, header = std::string{header}](const DataFrameSax::Value& val) {
+        data.push_back(std::visit(util::overloaded{[](std::nullptr_t) {
+                                                       return std::numeric_limits<T>::quiet_NaN();
+                                                   },
+                                                   [&](std::string_view) -> T {
+                                                       throw JSONConversionException(
+                                                           SourceContext{},
+                                                           "expected a number in column '{}'",
+                                                           header);
+                                                   },
+                                                   [](auto v) { return static_cast<T>(v); }},
+                                  val));
+    };
+}
+
+std::function<void(const DataFrameSax::Value&)> categoricalAppender(CategoricalColumn& column) {
+    return [addValue = column.addMany(),
+            header = column.getHeader()](const DataFrameSax::Value& val) {
+        if (const auto* str = std::get_if<std::string_view>(&val)) {
+            addValue(*str);
+        } else {
+            throw JSONConversionException(SourceContext{}, "expected a string in column '{}'",
+                                          header);
+        }
+    };
+}
+
 }  // namespace
 
 void to_json(json& j, const DataFrame& df) {
@@ -346,6 +544,99 @@ void from_json(const json& j, DataFrame& df) {
     df.updateIndexBuffer();
 }
 
+void parseDataFrame(std::istream& stream, DataFrame& df) {
+    const auto start = stream.tellg();
+    if (start == std::istream::pos_type(-1)) {
+        throw JSONConversionException("parseDataFrame requires a seekable stream");
+    }
+
+    DataFrameSax header{DataFrameSax::Pass::Header};
+    json::sax_parse(stream, &header);
+
+    if (!header.isObject || header.keys == 0) {
+        // Only support object types, i.e. {key: value}
+        return;
+    }
+
+    using Section = DataFrameSax::Section;
+    if (!header.isArray(Section::Columns)) {
+        throw JSONConversionException(R"("JSON object must contain a "columns" array)");
+    }
+    if (!header.isArray(Section::Data)) {
+        throw JSONConversionException(R"(JSON object must contain "data" array)");
+    }
+    if (header.isFound(Section::Index)) {
+        if (!header.isArray(Section::Index)) {
+            throw JSONConversionException(R"("index" must be an array)");
+        }
+        if (header.indices != header.rows) {
+            throw JSONConversionException(SourceContext{},
+                                          "number of indices ({}) differs from number of rows ({})",
+                                          header.indices, header.rows);
+        }
+    }
+    if (header.isFound(Section::Types)) {
+        if (!header.isArray(Section::Types)) {
+            throw JSONConversionException(R"("types" must be an array)");
+        }
+        if (header.types.size() != header.columns.size()) {
+            throw JSONConversionException(
+                SourceContext{}, "number of types ({}) differs from number of columns ({})",
+                header.types.size(), header.columns.size());
+        }
+    }
+    if (header.rows > 0 && (header.minRowSize != header.columns.size() ||
+                            header.maxRowSize != header.columns.size())) {
+        throw JSONConversionException(SourceContext{},
+                                      "all rows in data must have {} values, one per column",
+                                      header.columns.size());
+    }
+
+    if (header.isFound(Section::Types)) {
+        for (auto&& [columnHeader, type] : util::zip(header.columns, header.types)) {
+            if (type == categoricalTypeStr) {
+                df.addCategoricalColumn(columnHeader, 0u);
+            } else {
+                df.addColumn(createColumn(type, columnHeader));
+            }
+        }
+    } else {
+        header.valueTypes.resize(header.columns.size(), json::value_t::null);
+        for (auto&& [columnHeader, type] : util::zip(header.columns, header.valueTypes)) {
+            // A column with only null values is assumed to be float
+            const auto valueType = type == json::value_t::null ? json::value_t::number_float : type;
+            addDataFrameColumnHelper(valueType, columnHeader, df);
+        }
+    }
+
+    DataFrameSax data{DataFrameSax::Pass::Data};
+    data.index =
+        &df.getIndexColumn()->getTypedBuffer()->getEditableRAMRepresentation()->getDataContainer();
+    data.index->reserve(header.indices);
+
+    for (auto colIndex : std::ranges::iota_view(size_t{1}, df.getNumberOfColumns())) {
+        auto column = df.getColumn(colIndex);
+        if (column->getColumnType() == ColumnType::Categorical) {
+            data.appenders.push_back(
+                categoricalAppender(*static_cast<CategoricalColumn*>(column.get())));
+        } else {
+            column->getBuffer()
+                ->getEditableRepresentation<BufferRAM>()
+                ->dispatch<void, dispatching::filter::Scalars>([&](auto buffer) {
+                    auto& container = buffer->getDataContainer();
+                    container.reserve(header.rows);
+                    data.appenders.push_back(numberAppender(container, column->getHeader()));
+                });
+        }
+    }
+
+    stream.clear();
+    stream.seekg(start);
+    json::sax_parse(stream, &data);
+
+    df.updateIndexBuffer();
+}
+
 void to_json(json& j, const DataFrameInport& port) {
     if (auto data = port.getData()) {
         j = *data;
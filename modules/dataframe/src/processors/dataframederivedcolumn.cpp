@@ -0,0 +1,82 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/processors/dataframederivedcolumn.h>
+
+#include <inviwo/core/processors/processorstate.h>      // for CodeState, CodeState...
+#include <inviwo/core/processors/processortags.h>       // for Tags
+#include <inviwo/dataframe/datastructures/dataframe.h>  // for DataFrame, DataFrame...
+#include <inviwo/dataframe/util/dataframeutil.h>        // for createDerivedColumn
+
+#include <memory>  // for make_shared, shared_ptr
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo DataFrameDerivedColumn::processorInfo_{
+    "org.inviwo.DataFrameDerivedColumn",  // Class identifier
+    "DataFrame Derived Column",           // Display name
+    "DataFrame",                          // Category
+    CodeState::Experimental,              // Code state
+    "CPU, DataFrame",                     // Tags
+    R"(Adds a column to a DataFrame computed from an expression of the other columns. The
+    columns are referred to by their header where characters other than letters, digits, and
+    underscores are replaced by underscores, i.e. `Sepal Length` becomes `Sepal_Length`.
+    The expression supports `+`, `-`, `*`, `/`, and `^`.
+    )"_unindentHelp,
+};
+const ProcessorInfo& DataFrameDerivedColumn::getProcessorInfo() const { return processorInfo_; }
+
+DataFrameDerivedColumn::DataFrameDerivedColumn()
+    : Processor()
+    , inport_("inport", "Input DataFrame"_help)
+    , outport_("outport", "Copy of the input DataFrame with the derived column added"_help)
+    , header_("header", "Column Header", "Header of the derived column"_help, "derived")
+    , expression_("expression", "Expression",
+                  "The expression to evaluate for each row, i.e. `(x - y) ^ 2`"_help, "") {
+
+    addPort(inport_);
+    addPort(outport_);
+    addProperties(header_, expression_);
+}
+
+void DataFrameDerivedColumn::process() {
+    if (expression_.get().empty()) {
+        outport_.setData(inport_.getData());
+        return;
+    }
+
+    auto dataFrame = std::make_shared<DataFrame>(*inport_.getData());
+    dataFrame->addColumn(
+        dataframe::createDerivedColumn(*dataFrame, header_.get(), expression_.get()));
+    dataFrame->updateIndexBuffer();
+    outport_.setData(dataFrame);
+}
+
+}  // namespace inviwo
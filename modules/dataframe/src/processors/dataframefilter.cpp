@@ -57,7 +57,8 @@
 #include <cstdint>      // for uint32_t
 #include <memory>       // for make_shared, share...
 #include <type_traits>  // for enable_if<>::type
-#include <utility>      // for declval
+#include <utility>      // for declval, move
+#include <vector>       // for vector
 
 #include <flags/flags.h>  // for operator|, flags
 #include <glm/vec2.hpp>   // for vec, vec<>::(anony...
@@ -153,7 +154,8 @@ void DataFrameFilter::process() {
         rows = b.toVector();
     }
 
-    outport_.setData(std::make_shared<DataFrame>(*df, rows));
+    outport_.setData(std::make_shared<DataFrame>(
+        *df, std::make_shared<const std::vector<std::uint32_t>>(std::move(rows))));
 }
 
 namespace detail {
@@ -46,15 +46,24 @@ DataFrameToBuffer::DataFrameToBuffer()
     : Processor{}
     , dataFrame_{"dataFrame", ""_help}
     , outport_{"outport", "column buffer"_help}
-    , selectedColumn_{"selectedColumn", "Selected Column", dataFrame_} {
+    , selectedColumn_{"selectedColumn", "Selected Column", dataFrame_}
+    , normalize_{"normalize", "Normalize",
+                 "Output the column as floats normalized to [0, 1] using the column range. The "
+                 "normalized buffer is cached in the column and shared with all other users of "
+                 "it."_help,
+                 false} {
 
     addPorts(dataFrame_, outport_);
-    addProperties(selectedColumn_);
+    addProperties(selectedColumn_, normalize_);
 }
 
 void DataFrameToBuffer::process() {
     const auto col = dataFrame_.getData()->getColumn(selectedColumn_.getSelectedValue());
-    outport_.setData(col->getBuffer());
+    if (normalize_) {
+        outport_.setData(col->getNormalizedBuffer());
+    } else {
+        outport_.setData(col->getBuffer());
+    }
 }
 
 }  // namespace inviwo
@@ -52,11 +52,13 @@
 #include <inviwo/core/util/glmconvert.h>                                // for glm_convert
 #include <inviwo/core/util/glmvec.h>                                    // for size2_t, vec3, dvec4
 #include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 #include <inviwo/core/util/staticstring.h>                              // for operator+
 #include <inviwo/core/util/stringconversion.h>                          // for toString
 #include <inviwo/dataframe/datastructures/column.h>                     // for TemplateColumn
 #include <inviwo/dataframe/datastructures/dataframe.h>                  // for DataFrame
 
+#include <algorithm>      // for copy_n
 #include <cmath>          // for sqrt
 #include <cstddef>        // for size_t
 #include <memory>         // for shared_ptr, uniqu...
@@ -65,6 +67,7 @@
 #include <type_traits>    // for remove_extent_t
 #include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
+#include <vector>         // for vector
 
 #include <fmt/core.h>            // for format
 #include <glm/fwd.hpp>           // for u32
@@ -207,8 +210,9 @@ void ImageToDataFrame::process() {
                 const auto im = util::IndexMapper2D(dims);
                 const auto data = lr->getDataTyped();
 
-                size2_t pos;
-                for (pos.y = 0; pos.y < dims.y; pos.y++) {
+                // Every row of pixels is written to its own range of rows in the DataFrame
+                util::parallelFor(0, dims.y, [&](size_t y) {
+                    size2_t pos{0, y};
                     for (pos.x = 0; pos.x < dims.x; pos.x++) {
                         const auto idx = im(pos);
                         const auto v = util::glm_convert<dvec4>(data[idx]);
@@ -235,7 +239,7 @@ void ImageToDataFrame::process() {
                         row[idx] = static_cast<int>(pos.y);
                         col[idx] = static_cast<int>(pos.x);
                     }
-                }
+                });
             });
 
             outport_.setData(dataFrame);
@@ -247,16 +251,19 @@ void ImageToDataFrame::process() {
                 using ValueType = util::PrecisionValueType<decltype(lr)>;
                 const auto im = util::IndexMapper2D(dims);
                 const auto data = lr->getDataTyped();
-                for (size_t j = range_.getStart(); j < range_.getEnd(); ++j) {
-                    auto& row = dataFrame->addColumn<ValueType>(toString(j), dims.x)
-                                    ->getTypedBuffer()
-                                    ->getEditableRAMRepresentation()
-                                    ->getDataContainer();
-
-                    for (size_t i = 0; i < dims.x; ++i) {
-                        row[i] = data[im(i, j)];
-                    }
+                const auto start = range_.getStart();
+                std::vector<ValueType*> rows;
+                for (size_t j = start; j < range_.getEnd(); ++j) {
+                    rows.push_back(dataFrame->addColumn<ValueType>(toString(j), dims.x)
+                                       ->getTypedBuffer()
+                                       ->getEditableRAMRepresentation()
+                                       ->getDataContainer()
+                                       .data());
                 }
+                // The rows are contiguous in memory
+                util::parallelFor(0, rows.size(), [&](size_t j) {
+                    std::copy_n(data + im(0, start + j), dims.x, rows[j]);
+                });
             });
 
             outport_.setData(dataFrame);
@@ -268,16 +275,20 @@ void ImageToDataFrame::process() {
                 using ValueType = util::PrecisionValueType<decltype(lr)>;
                 const auto im = util::IndexMapper2D(dims);
                 const auto data = lr->getDataTyped();
-                for (size_t i = range_.getStart(); i < range_.getEnd(); ++i) {
-                    auto& col = dataFrame->addColumn<ValueType>(toString(i), dims.y)
-                                    ->getTypedBuffer()
-                                    ->getEditableRAMRepresentation()
-                                    ->getDataContainer();
-
-                    for (size_t j = 0; j < dims.y; ++i) {
-                        col[j] = data[im(i, j)];
-                    }
+                const auto start = range_.getStart();
+                std::vector<ValueType*> cols;
+                for (size_t i = start; i < range_.getEnd(); ++i) {
+                    cols.push_back(dataFrame->addColumn<ValueType>(toString(i), dims.y)
+                                       ->getTypedBuffer()
+                                       ->getEditableRAMRepresentation()
+                                       ->getDataContainer()
+                                       .data());
                 }
+                util::parallelFor(0, cols.size(), [&](size_t i) {
+                    for (size_t j = 0; j < dims.y; ++j) {
+                        cols[i][j] = data[im(start + i, j)];
+                    }
+                });
             });
             outport_.setData(dataFrame);
             break;
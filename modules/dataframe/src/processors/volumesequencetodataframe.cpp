@@ -35,6 +35,7 @@
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>       // IWYU pragma: keep
 #include <inviwo/core/ports/datainport.h>                               // for DataInport
 #include <inviwo/core/ports/dataoutport.h>                              // for DataOutport
 #include <inviwo/core/ports/outport.h>                                  // for Outport
@@ -47,12 +48,13 @@
 #include <inviwo/core/properties/invalidationlevel.h>                   // for InvalidationLevel
 #include <inviwo/core/properties/ordinalproperty.h>                     // for FloatProperty
 #include <inviwo/core/util/exception.h>                                 // for Exception
+#include <inviwo/core/util/formatdispatching.h>                         // for Floats
 #include <inviwo/core/util/formats.h>                                   // for DataFormatBase
+#include <inviwo/core/util/glmcomp.h>                                   // for glmcomp
 #include <inviwo/core/util/glmvec.h>                                    // for vec2, size3_t, uvec3
-#include <inviwo/core/util/indexmapper.h>                               // for IndexMapper3D
 #include <inviwo/core/util/logcentral.h>                                // for LogCentral
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 #include <inviwo/core/util/sourcecontext.h>                             // for SourceContext
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxelParallel
 #include <inviwo/dataframe/datastructures/column.h>                     // for TemplateColumn
 #include <inviwo/dataframe/datastructures/dataframe.h>                  // for DataFrame
 
@@ -214,10 +216,15 @@ void VolumeSequenceToDataFrame::process() {
 
     const auto& dims = data[0].second->getDimensions();
     const size_t size = dims.x * dims.y * dims.z;
-    const auto indexMapper = util::IndexMapper3D(dims);
 
-    auto dataFrame = std::make_shared<DataFrame>(static_cast<std::uint32_t>(
-        reduce_.get() || omitOutliers_.get() ? filteredIDs_.size() : size));
+    // When filtering, row i of the DataFrame holds voxel ids[i]
+    const bool filtered = reduce_.get() || omitOutliers_.get();
+    const std::vector<size_t> ids =
+        filtered ? std::vector<size_t>(filteredIDs_.begin(), filteredIDs_.end())
+                 : std::vector<size_t>{};
+    const size_t rows = filtered ? ids.size() : size;
+
+    auto dataFrame = std::make_shared<DataFrame>(static_cast<std::uint32_t>(rows));
 
     for (auto&& [port, volume] : data) {
         const auto numericType = volume->getDataFormat()->getNumericType();
@@ -230,19 +237,19 @@ void VolumeSequenceToDataFrame::process() {
         const auto numCh = volume->getDataFormat()->getComponents();
         for (size_t c = 0; c < numCh; c++) {
             auto identifier = port->getProcessor()->getIdentifier();
-            auto col = dataFrame->addColumn<float>(
-                identifier, reduce_.get() || omitOutliers_.get() ? filteredIDs_.size() : size);
+            auto col = dataFrame->addColumn<float>(identifier, rows);
             channelBuffer_.push_back(
                 &col->getTypedBuffer()->getEditableRAMRepresentation()->getDataContainer());
         }
 
-        util::forEachVoxelParallel(*volumeRAM, [&, this](const size3_t& pos) {
-            const auto idx = indexMapper(pos);
-            if (filteredIDs_.find(idx) == filteredIDs_.end()) return;
-            const auto v = volumeRAM->getAsDVec4(pos);
-            for (size_t c = 0; c < numCh; c++) {
-                (*channelBuffer_[c])[idx] = float(v[c]);
-            }
+        volumeRAM->dispatch<void, dispatching::filter::Floats>([&](auto vr) {
+            const auto src = vr->getDataTyped();
+            util::parallelFor(0, rows, [&](size_t row) {
+                const auto& v = src[filtered ? ids[row] : row];
+                for (size_t c = 0; c < numCh; c++) {
+                    (*channelBuffer_[c])[row] = static_cast<float>(util::glmcomp(v, c));
+                }
+            });
         });
     }
     outport_.setData(dataFrame);
@@ -52,11 +52,13 @@
 #include <inviwo/core/util/glmutils.h>                                  // for Matrix
 #include <inviwo/core/util/glmvec.h>                                    // for size3_t, dvec3
 #include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 #include <inviwo/core/util/staticstring.h>                              // for operator+
 #include <inviwo/core/util/stringconversion.h>                          // for toString
 #include <inviwo/dataframe/datastructures/column.h>                     // for TemplateColumn
 #include <inviwo/dataframe/datastructures/dataframe.h>                  // for DataFrame
 
+#include <algorithm>      // for copy_n
 #include <cmath>          // for sqrt
 #include <cstddef>        // for size_t
 #include <memory>         // for shared_ptr, uniqu...
@@ -65,6 +67,7 @@
 #include <type_traits>    // for remove_extent_t
 #include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
+#include <vector>         // for vector
 
 #include <fmt/core.h>                  // for format
 #include <glm/gtc/type_precision.hpp>  // for u32
@@ -75,6 +78,26 @@
 
 namespace inviwo {
 
+namespace {
+
+/**
+ * Add @p count columns of @p size rows each, named by @p name(line). Returns pointers to the data
+ * of the columns, the columns can then be filled in parallel.
+ */
+template <typename T, typename Name>
+std::vector<T*> addLineColumns(DataFrame& dataFrame, size_t count, size_t size, Name&& name) {
+    std::vector<T*> lines;
+    lines.reserve(count);
+    for (size_t line = 0; line < count; ++line) {
+        auto col = dataFrame.addColumn<T>(name(line), size);
+        lines.push_back(
+            col->getTypedBuffer()->getEditableRAMRepresentation()->getDataContainer().data());
+    }
+    return lines;
+}
+
+}  // namespace
+
 // The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
 const ProcessorInfo VolumeToDataFrame::processorInfo_{
     "org.inviwo.VolumeToDataFrame",  // Class identifier
@@ -124,11 +147,12 @@ VolumeToDataFrame::VolumeToDataFrame()
 
 void VolumeToDataFrame::process() {
     const auto volume = inport_.getData();
+    const size3_t start{rangeX_.getStart(), rangeY_.getStart(), rangeZ_.getStart()};
+    const size3_t extent = size3_t{rangeX_.getEnd(), rangeY_.getEnd(), rangeZ_.getEnd()} - start;
+
     switch (mode_.get()) {
         case Mode::Analytics: {
-            const auto size = (rangeX_.getEnd() - rangeX_.getStart()) *
-                              (rangeY_.getEnd() - rangeY_.getStart()) *
-                              (rangeZ_.getEnd() - rangeZ_.getStart());
+            const auto size = extent.x * extent.y * extent.z;
 
             auto dataFrame = std::make_shared<DataFrame>(static_cast<glm::u32>(size));
             std::vector<std::vector<float>*> channelBuffer_;
@@ -173,11 +197,13 @@ void VolumeToDataFrame::process() {
                 const auto im = util::IndexMapper3D(vr->getDimensions());
                 using ValueType = util::PrecisionValueType<decltype(vr)>;
                 const auto data = vr->getDataTyped();
-                auto i = 0;
-                size3_t ind;
-                for (ind.z = rangeZ_.getStart(); ind.z < rangeZ_.getEnd(); ind.z++) {
-                    for (ind.y = rangeY_.getStart(); ind.y < rangeY_.getEnd(); ind.y++) {
-                        for (ind.x = rangeX_.getStart(); ind.x < rangeX_.getEnd(); ind.x++) {
+
+                // Every slice fills its own consecutive range of rows
+                util::parallelFor(0, extent.z, [&](size_t slice) {
+                    auto i = slice * extent.y * extent.x;
+                    size3_t ind{0, 0, start.z + slice};
+                    for (ind.y = start.y; ind.y < start.y + extent.y; ind.y++) {
+                        for (ind.x = start.x; ind.x < start.x + extent.x; ind.x++) {
                             const auto v = util::glm_convert<dvec4>(data[im(ind)]);
                             double m = 0.0;
                             for (size_t c = 0; c < DataFormat<ValueType>::comp; c++) {
@@ -198,91 +224,81 @@ void VolumeToDataFrame::process() {
                             ++i;
                         }
                     }
-                }
+                });
             });
             outport_.setData(dataFrame);
             break;
         }
         case Mode::XDir: {
-            const auto size = rangeX_.getEnd() - rangeY_.getStart();
+            const auto size = extent.x;
             auto dataFrame = std::make_shared<DataFrame>(static_cast<glm::u32>(size));
 
-            volume->getRepresentation<VolumeRAM>()->dispatch<void>([this, dataFrame,
-                                                                    size](const auto vr) {
+            volume->getRepresentation<VolumeRAM>()->dispatch<void>([&](const auto vr) {
                 using ValueType = util::PrecisionValueType<decltype(vr)>;
                 const auto im = util::IndexMapper3D(vr->getDimensions());
                 const auto data = vr->getDataTyped();
-                size3_t ind;
-                for (ind.z = rangeZ_.getStart(); ind.z < rangeZ_.getEnd(); ind.z++) {
-                    for (ind.y = rangeY_.getStart(); ind.y < rangeY_.getEnd(); ind.y++) {
-                        const std::string name = "y:" + toString(ind.y) + " z:" + toString(ind.z);
-                        auto col = dataFrame->addColumn<ValueType>(name, size);
-                        auto& line = col->getTypedBuffer()
-                                         ->getEditableRAMRepresentation()
-                                         ->getDataContainer();
-                        size_t i = 0;
-                        for (ind.x = rangeX_.getStart(); ind.x < rangeX_.getEnd(); ind.x++) {
-                            line[i++] = data[im(ind)];
-                        }
-                    }
-                }
+                auto lines = addLineColumns<ValueType>(
+                    *dataFrame, extent.y * extent.z, size, [&](size_t line) {
+                        return fmt::format("y:{} z:{}", start.y + line % extent.y,
+                                           start.z + line / extent.y);
+                    });
+                // The x lines are contiguous in memory
+                util::parallelFor(0, lines.size(), [&](size_t line) {
+                    const size3_t ind{start.x, start.y + line % extent.y,
+                                      start.z + line / extent.y};
+                    std::copy_n(data + im(ind), size, lines[line]);
+                });
             });
 
             outport_.setData(dataFrame);
             break;
         }
         case Mode::YDir: {
-            const auto size = rangeY_.getEnd() - rangeY_.getStart();
+            const auto size = extent.y;
             auto dataFrame = std::make_shared<DataFrame>(static_cast<glm::u32>(size));
 
-            volume->getRepresentation<VolumeRAM>()->dispatch<void>(
-                [this, dataFrame, size](const auto vr) {
-                    using ValueType = util::PrecisionValueType<decltype(vr)>;
-                    const auto im = util::IndexMapper3D(vr->getDimensions());
-                    const auto data = vr->getDataTyped();
-                    size3_t ind;
-                    for (ind.x = rangeX_.getStart(); ind.x < rangeX_.getEnd(); ind.x++) {
-                        for (ind.z = rangeZ_.getStart(); ind.z < rangeZ_.getEnd(); ind.z++) {
-                            auto col = dataFrame->addColumn<ValueType>(
-                                "x:" + toString(ind.x) + " z:" + toString(ind.z), size);
-                            auto& line = col->getTypedBuffer()
-                                             ->getEditableRAMRepresentation()
-                                             ->getDataContainer();
-                            size_t i = 0;
-                            for (ind.y = rangeY_.getStart(); ind.y < rangeY_.getEnd(); ind.y++) {
-                                line[i++] = data[im(ind)];
-                            }
-                        }
+            volume->getRepresentation<VolumeRAM>()->dispatch<void>([&](const auto vr) {
+                using ValueType = util::PrecisionValueType<decltype(vr)>;
+                const auto im = util::IndexMapper3D(vr->getDimensions());
+                const auto data = vr->getDataTyped();
+                auto lines = addLineColumns<ValueType>(
+                    *dataFrame, extent.x * extent.z, size, [&](size_t line) {
+                        return fmt::format("x:{} z:{}", start.x + line / extent.z,
+                                           start.z + line % extent.z);
+                    });
+                util::parallelFor(0, lines.size(), [&](size_t line) {
+                    size3_t ind{start.x + line / extent.z, 0, start.z + line % extent.z};
+                    for (size_t i = 0; i < size; ++i) {
+                        ind.y = start.y + i;
+                        lines[line][i] = data[im(ind)];
                     }
                 });
+            });
 
             outport_.setData(dataFrame);
             break;
         }
         case Mode::ZDir: {
-            const auto size = rangeZ_.getEnd() - rangeZ_.getStart();
+            const auto size = extent.z;
             auto dataFrame = std::make_shared<DataFrame>(static_cast<glm::u32>(size));
 
-            volume->getRepresentation<VolumeRAM>()->dispatch<void>(
-                [this, dataFrame, size](const auto vr) {
-                    using ValueType = util::PrecisionValueType<decltype(vr)>;
-                    const auto im = util::IndexMapper3D(vr->getDimensions());
-                    const auto data = vr->getDataTyped();
-                    size3_t ind;
-                    for (ind.x = rangeX_.getStart(); ind.x < rangeX_.getEnd(); ind.x++) {
-                        for (ind.y = rangeY_.getStart(); ind.y < rangeY_.getEnd(); ind.y++) {
-                            auto col = dataFrame->addColumn<ValueType>(
-                                "x:" + toString(ind.x) + " y:" + toString(ind.y), size);
-                            auto& line = col->getTypedBuffer()
-                                             ->getEditableRAMRepresentation()
-                                             ->getDataContainer();
-                            size_t i = 0;
-                            for (ind.z = rangeZ_.getStart(); ind.z < rangeZ_.getEnd(); ind.z++) {
-                                line[i++] = data[im(ind)];
-                            }
-                        }
+            volume->getRepresentation<VolumeRAM>()->dispatch<void>([&](const auto vr) {
+                using ValueType = util::PrecisionValueType<decltype(vr)>;
+                const auto im = util::IndexMapper3D(vr->getDimensions());
+                const auto data = vr->getDataTyped();
+                auto lines = addLineColumns<ValueType>(
+                    *dataFrame, extent.x * extent.y, size, [&](size_t line) {
+                        return fmt::format("x:{} y:{}", start.x + line / extent.y,
+                                           start.y + line % extent.y);
+                    });
+                util::parallelFor(0, lines.size(), [&](size_t line) {
+                    size3_t ind{start.x + line / extent.y, start.y + line % extent.y, 0};
+                    for (size_t i = 0; i < size; ++i) {
+                        ind.z = start.z + i;
+                        lines[line][i] = data[im(ind)];
                     }
                 });
+            });
 
             outport_.setData(dataFrame);
             break;
@@ -29,7 +29,6 @@
 
 #include <inviwo/dataframe/util/dataframeutil.h>
 
-#include <inviwo/core/datastructures/bitset.h>                          // for BitSet
 #include <inviwo/core/datastructures/buffer/buffer.h>                   // for BufferBase, Buffer
 #include <inviwo/core/datastructures/buffer/bufferram.h>                // for BufferRAM
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>       // for BufferRAMPrecision
@@ -41,7 +40,8 @@
 #include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
 #include <inviwo/core/util/formats.h>                                   // for DataFormatBase
 #include <inviwo/core/util/glmvec.h>                                    // for ivec2
-#include <inviwo/core/util/iterrange.h>                                 // for iter_range, as_range
+#include <inviwo/core/util/hashcombine.h>                               // for hash_combine
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 #include <inviwo/core/util/sourcecontext.h>                             // for SourceContext
 #include <inviwo/core/util/stdextensions.h>                             // for transform, contains
 #include <inviwo/core/util/stringconversion.h>                          // for toLower
@@ -50,13 +50,22 @@
 #include <inviwo/dataframe/datastructures/column.h>                     // for CategoricalColumn
 #include <inviwo/dataframe/datastructures/dataframe.h>                  // for DataFrame
 #include <inviwo/dataframe/util/filters.h>                              // for ItemFilter, Filters
+#include <modules/base/algorithm/expression.h>                          // for evaluateExpression
 
 #include <algorithm>      // for any_of
+#include <array>          // for array
+#include <bit>            // for countr_zero, popcount
+#include <cctype>         // for isalnum, isdigit
+#include <cstdint>        // for uint64_t, uint32_t
 #include <functional>     // for function
-#include <iterator>       // for distance
+#include <iterator>       // for distance, back_inserter
+#include <limits>         // for numeric_limits
 #include <map>            // for operator==, map
+#include <numeric>        // for iota, transform_reduce, exclusive_scan
 #include <optional>       // for optional
+#include <span>           // for span
 #include <string_view>    // for string_view, oper...
+#include <type_traits>    // for is_integral_v, is_floating_point_v
 #include <unordered_map>  // for operator==, unord...
 #include <utility>        // for move, pair
 #include <variant>        // for visit
@@ -217,97 +226,212 @@ void columnCheck(const DataFrame& left, const DataFrame& right,
     }
 }
 
-template <typename T, bool firstMatchOnly, typename Cont>
-std::vector<std::vector<std::uint32_t>> matchingRows(const Cont& left, const Cont& right) {
-    std::unordered_map<T, std::vector<std::uint32_t>> matches;
-    for (auto&& [r, value] : util::enumerate<std::uint32_t>(right)) {
-        if constexpr (firstMatchOnly) {
-            if (matches.find(value) == matches.end()) {
-                matches[value].push_back(r);
+constexpr std::uint32_t noMatch = std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * A pair of key columns to join on. Categorical keys are compared by category index. The
+ * categories of the right column are mapped to the ones of the left column, so that equal
+ * strings get equal indices. Categories missing in the left column are mapped to noMatch.
+ */
+struct JoinKey {
+    const Column& left;
+    const Column& right;
+    std::vector<std::uint32_t> categoryMap;
+};
+
+std::span<const std::uint32_t> categoryIndices(const Column& col) {
+    return dynamic_cast<const CategoricalColumn&>(col)
+        .getTypedBuffer()
+        ->getRAMRepresentation()
+        ->getDataContainer();
+}
+
+std::vector<JoinKey> joinKeys(const DataFrame& left, const DataFrame& right,
+                              const std::vector<std::pair<std::string, std::string>>& keyColumns) {
+    std::vector<JoinKey> keys;
+    for (const auto& [leftName, rightName] : keyColumns) {
+        const auto& leftCol = *left.getColumn(leftName);
+        const auto& rightCol = *right.getColumn(rightName);
+        std::vector<std::uint32_t> categoryMap;
+        if (leftCol.getColumnType() == ColumnType::Categorical) {
+            const auto& leftCategories = dynamic_cast<const CategoricalColumn&>(leftCol);
+            const auto& rightCategories = dynamic_cast<const CategoricalColumn&>(rightCol);
+            if (leftCategories.getDictionary() == rightCategories.getDictionary()) {
+                // Columns sharing a dictionary, like a data frame joined with a view of itself,
+                // already use the same codes
+                categoryMap.resize(rightCategories.getCategories().size());
+                std::iota(categoryMap.begin(), categoryMap.end(), std::uint32_t{0});
+            } else {
+                for (const auto& category : rightCategories.getCategories()) {
+                    categoryMap.push_back(
+                        leftCategories.getDictionary()->find(category).value_or(noMatch));
+                }
             }
-        } else {
-            matches[value].push_back(r);
         }
+        keys.push_back(JoinKey{leftCol, rightCol, std::move(categoryMap)});
     }
-    std::vector<std::vector<std::uint32_t>> rows(std::distance(left.begin(), left.end()));
-    for (auto&& [i, key] : util::enumerate<std::uint32_t>(left)) {
-        rows[i] = matches[key];
-    }
-    return rows;
+    return keys;
 }
 
 /**
- * \brief for each row in leftCol return a list of matching row indices in rightCol
+ * Combined hash of all keys of each row, computed a column at a time
  */
-template <bool firstMatchOnly = false>
-std::vector<std::vector<std::uint32_t>> getMatchingRows(std::shared_ptr<const Column> leftCol,
-                                                        std::shared_ptr<const Column> rightCol) {
-    if (auto catCol1 = dynamic_cast<const CategoricalColumn*>(leftCol.get())) {
-        // need to match values of categorical columns instead of indices stored in buffer
-        auto catCol2 = dynamic_cast<const CategoricalColumn*>(rightCol.get());
-        IVW_ASSERT(catCol2, "right column is not categorical");
-
-        return matchingRows<std::string_view, firstMatchOnly>(*catCol1, *catCol2);
-    } else {
-        using retval = std::vector<std::vector<std::uint32_t>>;
-
-        return leftCol->getBuffer()->getRepresentation<BufferRAM>()->dispatch<retval>(
-            [rightBuffer = rightCol->getBuffer()](auto typedBuf) {
+std::vector<std::size_t> hashKeys(const std::vector<JoinKey>& keys, bool rightSide, size_t rows) {
+    std::vector<std::size_t> hashes(rows, 0);
+    const auto combine = [&](auto values, auto keyOf) {
+        util::parallelFor(
+            0, rows, [&](size_t i) { util::hash_combine(hashes[i], keyOf(values[i])); },
+            {.grainSize = 4096});
+    };
+    for (const auto& key : keys) {
+        const auto& col = rightSide ? key.right : key.left;
+        if (col.getColumnType() == ColumnType::Categorical) {
+            if (rightSide) {
+                combine(categoryIndices(col),
+                        [&map = key.categoryMap](std::uint32_t i) { return map[i]; });
+            } else {
+                combine(categoryIndices(col), std::identity{});
+            }
+        } else {
+            col.getBuffer()->getRepresentation<BufferRAM>()->dispatch<void>([&](auto typedBuf) {
                 using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
-
-                const auto& left = typedBuf->getDataContainer();
-                const auto& right = static_cast<const BufferRAMPrecision<ValueType>*>(
-                                        rightBuffer->getRepresentation<BufferRAM>())
-                                        ->getDataContainer();
-
-                return matchingRows<ValueType, firstMatchOnly>(left, right);
+                combine(std::span<const ValueType>{typedBuf->getDataContainer()}, std::identity{});
             });
+        }
+    }
+    return hashes;
+}
+
+/**
+ * Clear @p equal for the @p rows of the left data frame whose key differs from the one of their
+ * candidate row in the right data frame
+ */
+void compareKeys(const JoinKey& key, std::span<const std::uint32_t> rows,
+                 std::span<const std::uint32_t> candidates, std::vector<std::uint8_t>& equal) {
+    const auto compare = [&](auto left, auto right, auto rightKey) {
+        util::parallelFor(
+            0, rows.size(),
+            [&](size_t i) {
+                if (!(left[rows[i]] == rightKey(right[candidates[rows[i]]]))) equal[i] = 0;
+            },
+            {.grainSize = 4096});
+    };
+
+    if (key.left.getColumnType() == ColumnType::Categorical) {
+        compare(categoryIndices(key.left), categoryIndices(key.right),
+                [&map = key.categoryMap](std::uint32_t i) { return map[i]; });
+    } else {
+        key.left.getBuffer()->getRepresentation<BufferRAM>()->dispatch<void>([&](auto typedBuf) {
+            using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
+            const auto& right = static_cast<const BufferRAMPrecision<ValueType>*>(
+                                    key.right.getBuffer()->getRepresentation<BufferRAM>())
+                                    ->getDataContainer();
+            compare(std::span<const ValueType>{typedBuf->getDataContainer()},
+                    std::span<const ValueType>{right}, std::identity{});
+        });
     }
 }
 
-std::vector<std::vector<std::uint32_t>> getMatchingRows(
+/**
+ * \brief for each row in @p left return the first row in @p right with matching keys, or noMatch
+ *
+ * A radix partitioned hash join. The rows of @p right are partitioned on their key hash and one
+ * hash table per partition is built in parallel, mapping a hash to a chain of rows in increasing
+ * order. The rows of @p left then probe the tables in parallel. Candidates are verified one key
+ * column at a time, and rows whose candidate only matched the hash move on along the chain.
+ */
+std::vector<std::uint32_t> firstMatchingRows(
     const DataFrame& left, const DataFrame& right,
     const std::vector<std::pair<std::string, std::string>>& keyColumns) {
 
-    auto indexCol1 = left.getColumn(keyColumns.front().first);
-    auto indexCol2 = right.getColumn(keyColumns.front().second);
-
-    auto rows = detail::getMatchingRows(indexCol1, indexCol2);
-    // narrow down row selection by filtering with remaining keys
-    for (auto&& [leftName, rightName] : util::as_range(keyColumns.begin() + 1, keyColumns.end())) {
-        auto leftCol = left.getColumn(leftName);
-        auto rightCol = right.getColumn(rightName);
-
-        if (auto catCol1 = dynamic_cast<const CategoricalColumn*>(leftCol.get())) {
-            auto catCol2 = dynamic_cast<const CategoricalColumn*>(rightCol.get());
-            IVW_ASSERT(catCol2, "right column is not categorical");
-
-            auto valuesLeftIt = catCol1->begin();
-            auto valuesRightIt = catCol2->begin();
-            for (auto&& [i, rowMatches] : util::enumerate<std::uint32_t>(rows)) {
-                std::erase_if(rowMatches, [key = *(valuesLeftIt + i), valuesRightIt](auto row) {
-                    return key != *(valuesRightIt + row);
-                });
+    constexpr int partitionBits = 6;
+    constexpr size_t numPartitions = size_t{1} << partitionBits;
+    constexpr size_t chunkSize = size_t{1} << 16;
+    const auto partitionOf = [](std::size_t hash) {
+        // Fibonacci hashing, the hash of integral keys is often just the value
+        return static_cast<size_t>((static_cast<std::uint64_t>(hash) * 0x9e3779b97f4a7c15ull) >>
+                                   (64 - partitionBits));
+    };
+
+    const auto keys = joinKeys(left, right, keyColumns);
+    const auto leftHashes = hashKeys(keys, false, left.getNumberOfRows());
+    const auto rightHashes = hashKeys(keys, true, right.getNumberOfRows());
+    if (rightHashes.empty()) return std::vector<std::uint32_t>(leftHashes.size(), noMatch);
+
+    // Radix partition the right rows, keeping them in increasing order within each partition
+    const size_t numChunks = (rightHashes.size() + chunkSize - 1) / chunkSize;
+    std::vector<size_t> offsets(numChunks * numPartitions, 0);
+    util::parallelFor(0, numChunks, [&](size_t chunk) {
+        const auto end = std::min(rightHashes.size(), (chunk + 1) * chunkSize);
+        for (size_t row = chunk * chunkSize; row < end; ++row) {
+            ++offsets[partitionOf(rightHashes[row]) * numChunks + chunk];
+        }
+    });
+    std::exclusive_scan(offsets.begin(), offsets.end(), offsets.begin(), size_t{0});
+    std::vector<std::uint32_t> partitioned(rightHashes.size());
+    util::parallelFor(0, numChunks, [&](size_t chunk) {
+        std::array<size_t, numPartitions> pos;
+        for (size_t p = 0; p < numPartitions; ++p) pos[p] = offsets[p * numChunks + chunk];
+        const auto end = std::min(rightHashes.size(), (chunk + 1) * chunkSize);
+        for (size_t row = chunk * chunkSize; row < end; ++row) {
+            partitioned[pos[partitionOf(rightHashes[row])]++] = static_cast<std::uint32_t>(row);
+        }
+    });
+
+    struct Chain {
+        std::uint32_t first;
+        std::uint32_t last;
+    };
+    std::vector<std::unordered_map<std::size_t, Chain>> tables(numPartitions);
+    std::vector<std::uint32_t> next(rightHashes.size(), noMatch);
+    util::parallelFor(
+        0, numPartitions,
+        [&](size_t p) {
+            const auto begin = offsets[p * numChunks];
+            const auto end =
+                p + 1 < numPartitions ? offsets[(p + 1) * numChunks] : partitioned.size();
+            auto& table = tables[p];
+            table.reserve(end - begin);
+            for (auto row : std::span{partitioned}.subspan(begin, end - begin)) {
+                auto [it, inserted] = table.try_emplace(rightHashes[row], Chain{row, row});
+                if (!inserted) {
+                    next[it->second.last] = row;
+                    it->second.last = row;
+                }
             }
-        } else {
-            leftCol->getBuffer()->getRepresentation<BufferRAM>()->dispatch<void>(
-                [&rows, rightBuffer = rightCol->getBuffer()](auto typedBuf) {
-                    using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
-
-                    const auto& left = typedBuf->getDataContainer();
-                    const auto& right = static_cast<const BufferRAMPrecision<ValueType>*>(
-                                            rightBuffer->getRepresentation<BufferRAM>())
-                                            ->getDataContainer();
+        },
+        {.grainSize = 1});
+
+    std::vector<std::uint32_t> candidates(leftHashes.size(), noMatch);
+    util::parallelFor(
+        0, leftHashes.size(),
+        [&](size_t row) {
+            const auto& table = tables[partitionOf(leftHashes[row])];
+            if (auto it = table.find(leftHashes[row]); it != table.end()) {
+                candidates[row] = it->second.first;
+            }
+        },
+        {.grainSize = 4096});
 
-                    for (auto&& [i, rowMatches] : util::enumerate(rows)) {
-                        std::erase_if(rowMatches, [key = left[i], &right](auto row) {
-                            return key != right[row];
-                        });
-                    }
-                });
+    std::vector<std::uint32_t> pending;
+    for (auto&& [row, candidate] : util::enumerate<std::uint32_t>(candidates)) {
+        if (candidate != noMatch) pending.push_back(row);
+    }
+    while (!pending.empty()) {
+        std::vector<std::uint8_t> equal(pending.size(), 1);
+        for (const auto& key : keys) {
+            compareKeys(key, pending, candidates, equal);
         }
+        std::vector<std::uint32_t> remaining;
+        for (auto&& [row, isEqual] : util::zip(pending, equal)) {
+            if (isEqual) continue;
+            candidates[row] = next[candidates[row]];
+            if (candidates[row] != noMatch) remaining.push_back(row);
+        }
+        pending = std::move(remaining);
     }
-    return rows;
+
+    return candidates;
 }
 
 void addColumns(std::shared_ptr<DataFrame> dst, const DataFrame& srcDataFrame,
@@ -339,18 +463,35 @@ void addColumns(std::shared_ptr<DataFrame> dst, const DataFrame& srcDataFrame,
         if (skipKeyCol && util::contains(keyColumns, srcCol->getHeader())) continue;
 
         if (auto c = dynamic_cast<CategoricalColumn*>(srcCol.get())) {
-            auto data = util::transform(rows, [range = c->values()](auto v) {
-                return v.has_value() ? *(range.begin() + v.value()) : "undefined";
-            });
-            dst->addCategoricalColumn(c->getHeader(), data);
+            // gather the category indices directly instead of going through the strings
+            auto lookup = c->getCategories();
+            const auto undefined = [&]() {
+                if (std::ranges::all_of(rows, [](const auto& row) { return row.has_value(); })) {
+                    return std::uint32_t{0};
+                }
+                const auto it = std::ranges::find(lookup, "undefined");
+                if (it != lookup.end()) return static_cast<std::uint32_t>(it - lookup.begin());
+                lookup.emplace_back("undefined");
+                return static_cast<std::uint32_t>(lookup.size() - 1);
+            }();
+            const auto src = categoryIndices(*c);
+            std::vector<std::uint32_t> data(rows.size());
+            util::parallelFor(
+                0, rows.size(),
+                [&](size_t i) { data[i] = rows[i] ? src[*rows[i]] : undefined; },
+                {.grainSize = 4096});
+            dst->addColumn(std::make_shared<CategoricalColumn>(c->getHeader(), std::move(data),
+                                                               std::move(lookup)));
         } else {
             srcCol->getBuffer()->getRepresentation<BufferRAM>()->dispatch<void>(
-                [dst, srcCol, header = srcCol->getHeader(), rows](auto typedBuf) {
+                [&, header = srcCol->getHeader()](auto typedBuf) {
                     using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
-                    auto dstData =
-                        util::transform(rows, [&src = typedBuf->getDataContainer()](auto v) {
-                            return v.has_value() ? src[v.value()] : ValueType{0};
-                        });
+                    const auto& src = typedBuf->getDataContainer();
+                    std::vector<ValueType> dstData(rows.size());
+                    util::parallelFor(
+                        0, rows.size(),
+                        [&](size_t i) { dstData[i] = rows[i] ? src[*rows[i]] : ValueType{0}; },
+                        {.grainSize = 4096});
                     dst->addColumn(header, std::move(dstData));
                 });
         }
@@ -361,30 +502,7 @@ void addColumns(std::shared_ptr<DataFrame> dst, const DataFrame& srcDataFrame,
 
 std::shared_ptr<DataFrame> innerJoin(const DataFrame& left, const DataFrame& right,
                                      const std::pair<std::string, std::string>& keyColumn) {
-    detail::columnCheck(left, right, {keyColumn}, "dataframe::innerJoin"_sl);
-
-    auto indexCol1 = left.getColumn(keyColumn.first);
-    auto indexCol2 = right.getColumn(keyColumn.second);
-
-    std::vector<std::uint32_t> rowsLeft;
-    std::vector<std::uint32_t> rowsRight;
-    for (auto&& [i, rowIndices] :
-         util::enumerate<std::uint32_t>(detail::getMatchingRows<true>(indexCol1, indexCol2))) {
-        if (!rowIndices.empty()) {
-            rowsLeft.push_back(i);
-            rowsRight.push_back(rowIndices.front());
-        }
-    }
-
-    IVW_ASSERT(rowsLeft.size() == rowsRight.size(), "incorrect number of matching row indices");
-
-    auto dataframe = std::make_shared<DataFrame>();
-    dataframe->dropColumn(0);
-    dataframe->addColumn(std::shared_ptr<Column>(left.getIndexColumn()->clone(rowsLeft)));
-    detail::addColumns(dataframe, left, rowsLeft, {keyColumn.first}, false);
-    detail::addColumns(dataframe, right, rowsRight, {keyColumn.second}, true);
-
-    return dataframe;
+    return innerJoin(left, right, std::vector{keyColumn});
 }
 
 std::shared_ptr<DataFrame> innerJoin(
@@ -399,11 +517,11 @@ std::shared_ptr<DataFrame> innerJoin(
 
     std::vector<std::uint32_t> rowsLeft;
     std::vector<std::uint32_t> rowsRight;
-    for (auto&& [i, rowIndices] :
-         util::enumerate<std::uint32_t>(detail::getMatchingRows(left, right, keyColumns))) {
-        if (!rowIndices.empty()) {
+    for (auto&& [i, row] :
+         util::enumerate<std::uint32_t>(detail::firstMatchingRows(left, right, keyColumns))) {
+        if (row != detail::noMatch) {
             rowsLeft.push_back(i);
-            rowsRight.push_back(rowIndices.front());
+            rowsRight.push_back(row);
         }
     }
 
@@ -427,30 +545,7 @@ std::shared_ptr<DataFrame> innerJoin(
 
 std::shared_ptr<DataFrame> leftJoin(const DataFrame& left, const DataFrame& right,
                                     const std::pair<std::string, std::string>& keyColumn) {
-    detail::columnCheck(left, right, {keyColumn}, "dataframe::leftJoin"_sl);
-
-    auto indexCol1 = left.getColumn(keyColumn.first);
-    auto indexCol2 = right.getColumn(keyColumn.second);
-
-    auto rows = util::transform(
-        detail::getMatchingRows<true>(indexCol1, indexCol2),
-        [](const std::vector<std::uint32_t>& rowIndices) -> std::optional<std::uint32_t> {
-            if (rowIndices.empty()) {
-                return {};
-            } else {
-                return rowIndices.front();
-            }
-        });
-
-    IVW_ASSERT(indexCol1->getSize() == rows.size(), "incorrect number of matching row indices");
-
-    auto dataframe = std::make_shared<DataFrame>();
-    dataframe->dropColumn(0);
-    dataframe->addColumn(std::shared_ptr<Column>(left.getIndexColumn()->clone()));
-    detail::addColumns(dataframe, left, {keyColumn.first}, false);
-    detail::addColumns(dataframe, right, rows, {keyColumn.second}, true);
-
-    return dataframe;
+    return leftJoin(left, right, std::vector{keyColumn});
 }
 
 std::shared_ptr<DataFrame> leftJoin(
@@ -463,15 +558,16 @@ std::shared_ptr<DataFrame> leftJoin(
 
     detail::columnCheck(left, right, keyColumns, "dataframe::leftJoin"_sl);
 
-    auto rows = util::transform(
-        detail::getMatchingRows(left, right, keyColumns),
-        [](const std::vector<std::uint32_t>& rowIndices) -> std::optional<std::uint32_t> {
-            if (rowIndices.empty()) {
-                return {};
-            } else {
-                return rowIndices.front();
-            }
-        });
+    auto rows = util::transform(detail::firstMatchingRows(left, right, keyColumns),
+                                [](std::uint32_t row) -> std::optional<std::uint32_t> {
+                                    if (row == detail::noMatch) {
+                                        return {};
+                                    } else {
+                                        return row;
+                                    }
+                                });
+
+    IVW_ASSERT(left.getNumberOfRows() == rows.size(), "incorrect number of matching row indices");
 
     std::vector<std::string> leftKeys;
     std::transform(keyColumns.begin(), keyColumns.end(), std::back_inserter(leftKeys),
@@ -569,95 +665,140 @@ std::shared_ptr<DataFrame> combineDataFrames(std::vector<std::shared_ptr<DataFra
     return newDataFrame;
 }
 
-#include <warn/push>
-#include <warn/ignore/conversion>
-std::vector<std::uint32_t> selectRows(const Column& col,
-                                      const std::vector<dataframefilters::ItemFilter>& filters) {
-    if (filters.empty()) return {};
+namespace {
+
+/**
+ * Bit mask with one bit for each row of a column. Filters are evaluated a column at a time into
+ * masks that are then combined with bitwise operations.
+ */
+using RowMask = std::vector<std::uint64_t>;
+constexpr size_t rowMaskBits = 64;
+
+RowMask createRowMask(size_t rows) { return RowMask((rows + rowMaskBits - 1) / rowMaskBits, 0); }
+
+/**
+ * Set the bits of all rows where @p pred is true. Each word of the mask is built from a block of
+ * consecutive values without branches, which lets the compiler vectorize the inner loop. Only
+ * predicates known to be thread safe should be evaluated in @p parallel.
+ */
+template <typename T, typename Pred>
+void markRows(std::span<const T> values, RowMask& mask, Pred pred, bool parallel) {
+    const auto markWords = [&](size_t first, size_t last) {
+        for (size_t word = first; word < last; ++word) {
+            const size_t begin = word * rowMaskBits;
+            const size_t end = std::min(begin + rowMaskBits, values.size());
+            std::uint64_t bits = 0;
+            for (size_t i = begin; i < end; ++i) {
+                bits |= static_cast<std::uint64_t>(pred(values[i])) << (i - begin);
+            }
+            mask[word] |= bits;
+        }
+    };
+    if (parallel) {
+        util::parallelFor(0, mask.size(), markWords, {.grainSize = 1024});
+    } else {
+        markWords(0, mask.size());
+    }
+}
+
+/**
+ * Mark the rows matching @p filter where the predicate of the filter takes a @p F. Each value is
+ * converted to @p F first, just as when calling ItemFilter::filter. The value range of the filter
+ * is used if there is one, otherwise ItemFilter::filter is called for each row.
+ */
+template <typename F, typename T>
+void markRows(std::span<const T> values, const dataframefilters::ItemFilter& filter,
+              RowMask& mask) {
+    const auto* func = std::get_if<std::function<bool(F)>>(&filter.filter);
+    if (!func) return;
+
+    if (const auto* range = std::get_if<filters::ValueRange<F>>(&filter.range)) {
+        markRows(values, mask, [r = *range](T v) { return r(static_cast<F>(v)); }, true);
+    } else {
+        markRows(values, mask, [func](T v) { return (*func)(static_cast<F>(v)); }, false);
+    }
+}
 
+void markRows(const Column& col, const dataframefilters::ItemFilter& filter, RowMask& mask) {
     if (col.getColumnType() == ColumnType::Categorical) {
+        const auto* func = std::get_if<std::function<bool(std::string_view)>>(&filter.filter);
+        if (!func) return;
+
+        // Match each category once instead of every row
         const auto& catCol = dynamic_cast<const CategoricalColumn&>(col);
-        std::vector<std::uint32_t> rows;
-        for (auto&& [row, value] : util::enumerate<std::uint32_t>(catCol.values())) {
-            auto test = util::overloaded{
-                [v = value](const std::function<bool(std::string_view)>& func) { return func(v); },
-                [](const std::function<bool(int64_t)>&) { return false; },
-                [](const std::function<bool(double)>&) { return false; }};
-            auto op = [&](const auto& f) { return std::visit(test, f.filter); };
-            if (std::any_of(filters.begin(), filters.end(), op)) {
-                rows.push_back(row);
+        std::vector<std::uint8_t> matches;
+        std::ranges::transform(catCol.getCategories(), std::back_inserter(matches),
+                               [&](const std::string& category) { return (*func)(category); });
+        const auto& indices =
+            catCol.getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+        markRows(std::span<const std::uint32_t>{indices}, mask,
+                 [&](std::uint32_t index) { return matches[index]; }, true);
+    } else {
+        const auto* ram = col.getBuffer()->getRepresentation<BufferRAM>();
+        ram->dispatch<void, dispatching::filter::Scalars>([&](auto typedBuf) {
+            using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
+            const std::span<const ValueType> values{typedBuf->getDataContainer()};
+            if constexpr (std::is_integral_v<ValueType>) {
+                markRows<std::int64_t>(values, filter, mask);
+            } else if constexpr (std::is_floating_point_v<ValueType>) {
+                markRows<double>(values, filter, mask);
             }
+        });
+    }
+}
+
+std::vector<std::uint32_t> maskToRows(const RowMask& mask) {
+    std::vector<std::uint32_t> rows;
+    rows.reserve(std::transform_reduce(mask.begin(), mask.end(), size_t{0}, std::plus<>{},
+                                       [](std::uint64_t bits) { return std::popcount(bits); }));
+    for (size_t word = 0; word < mask.size(); ++word) {
+        for (auto bits = mask[word]; bits != 0; bits &= bits - 1) {
+            rows.push_back(
+                static_cast<std::uint32_t>(word * rowMaskBits + std::countr_zero(bits)));
         }
-        return rows;
-    } else {
-        return col.getBuffer()
-            ->getRepresentation<BufferRAM>()
-            ->dispatch<std::vector<std::uint32_t>, dispatching::filter::Scalars>(
-                [filters](auto typedBuf) {
-                    using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
-                    std::vector<std::uint32_t> rows;
-                    for (auto&& [row, value] :
-                         util::enumerate<std::uint32_t>(typedBuf->getDataContainer())) {
-                        auto test = util::overloaded{
-                            [&v = value](
-                                [[maybe_unused]] const std::function<bool(std::int64_t)>& func) {
-                                if constexpr (std::is_integral_v<ValueType>) {
-                                    return func(static_cast<std::int64_t>(v));
-                                } else {
-                                    (void)v;
-                                    return false;
-                                }
-                            },
-                            [v = value]([[maybe_unused]] const std::function<bool(double)>& func) {
-                                if constexpr (std::is_floating_point_v<ValueType>) {
-                                    return func(v);
-                                } else {
-                                    (void)v;
-                                    return false;
-                                }
-                            },
-                            [](const std::function<bool(std::string_view)>&) { return false; }};
-                        auto op = [&](const auto& f) { return std::visit(test, f.filter); };
-                        if (std::any_of(filters.begin(), filters.end(), op)) {
-                            rows.push_back(row);
-                        }
-                    }
-                    return rows;
-                });
     }
+    return rows;
+}
+
+}  // namespace
+
+std::vector<std::uint32_t> selectRows(const Column& col,
+                                      const std::vector<dataframefilters::ItemFilter>& filters) {
+    if (filters.empty()) return {};
+
+    auto mask = createRowMask(col.getSize());
+    for (const auto& filter : filters) {
+        markRows(col, filter, mask);
+    }
+    return maskToRows(mask);
 }
-#include <warn/pop>
 
 std::vector<std::uint32_t> selectRows(const DataFrame& dataframe,
                                       dataframefilters::Filters filters) {
     const int colCount = static_cast<int>(dataframe.getNumberOfColumns());
-    std::unordered_map<int, dataframefilters::Filters> filterCols;
-    for (auto& f : filters.include) {
-        if (f.column >= 0 && f.column < colCount) filterCols[f.column].include.push_back(f);
-    }
-    for (auto& f : filters.exclude) {
-        if (f.column >= 0 && f.column < colCount) filterCols[f.column].exclude.push_back(f);
-    }
-    if (filterCols.empty()) {
+    const auto validColumn = [&](const dataframefilters::ItemFilter& f) {
+        return f.column >= 0 && f.column < colCount;
+    };
+    if (std::ranges::none_of(filters.include, validColumn) &&
+        std::ranges::none_of(filters.exclude, validColumn)) {
         auto seq = util::sequence<std::uint32_t>(
             0, static_cast<std::uint32_t>(dataframe.getNumberOfRows()), 1);
         return {seq.begin(), seq.end()};
     }
 
-    if (filterCols.size() == 1) {
-        const auto& col = *dataframe.getColumn(filterCols.begin()->first).get();
-        return (BitSet(selectRows(col, filterCols.begin()->second.include)) -
-                BitSet(selectRows(col, filterCols.begin()->second.exclude)))
-            .toVector();
+    const auto rows = dataframe.getNumberOfRows();
+    auto include = createRowMask(rows);
+    auto exclude = createRowMask(rows);
+    for (const auto& f : filters.include) {
+        if (validColumn(f)) markRows(*dataframe.getColumn(f.column), f, include);
+    }
+    for (const auto& f : filters.exclude) {
+        if (validColumn(f)) markRows(*dataframe.getColumn(f.column), f, exclude);
     }
-    BitSet include;
-    BitSet exclude;
-    for (auto&& [colIndex, f] : filterCols) {
-        const auto& col = *dataframe.getColumn(colIndex).get();
-        include.add(selectRows(col, f.include));
-        exclude.add(selectRows(col, f.exclude));
+    for (auto&& [inc, exc] : util::zip(include, exclude)) {
+        inc &= ~exc;
     }
-    return (include - exclude).toVector();
+    return maskToRows(include);
 }
 
 std::string createToolTipForRow(const DataFrame& dataframe, size_t rowId) {
@@ -674,6 +815,34 @@ std::string createToolTipForRow(const DataFrame& dataframe, size_t rowId) {
     return doc;
 }
 
+std::string expressionVariable(std::string_view header) {
+    std::string name;
+    if (!header.empty() && std::isdigit(static_cast<unsigned char>(header.front()))) name += '_';
+    std::ranges::transform(header, std::back_inserter(name), [](char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+    });
+    return name;
+}
+
+std::shared_ptr<Column> createDerivedColumn(const DataFrame& dataframe, std::string_view header,
+                                            std::string_view expression) {
+    std::vector<util::ExpressionVariable<BufferRAM>> variables;
+    for (const auto& col : dataframe) {
+        if (col->getColumnType() == ColumnType::Categorical) continue;
+        const auto name = expressionVariable(col->getHeader());
+        const auto* ram = col->getBuffer()->getRepresentation<BufferRAM>();
+        variables.push_back({name, ram, 0});
+        for (size_t c = 0; c < ram->getDataFormat()->getComponents(); ++c) {
+            variables.push_back({fmt::format("{}_{}", name, c), ram, c});
+        }
+    }
+
+    std::vector<double> values(dataframe.getNumberOfRows());
+    util::evaluateExpression<BufferRAM>(expression, variables, std::span{values});
+
+    return std::make_shared<TemplateColumn<double>>(header, std::move(values));
+}
+
 }  // namespace dataframe
 
 }  // namespace inviwo
@@ -32,7 +32,9 @@
 #include <stdlib.h>    // for size_t, abs
 #include <algorithm>   // for max
 #include <functional>  // for __base, equal_to, greater, greater_equal, less, less_equal, not_eq...
+#include <limits>      // for numeric_limits
 #include <regex>       // for regex, regex_match, regex_search
+#include <utility>     // for move
 
 namespace inviwo {
 
@@ -64,24 +66,58 @@ ItemFilter stringMatch(int column, filters::StringComp op, std::string_view matc
 
 namespace detail {
 
+/**
+ * Create an item filter using @p comp and the value range equivalent to it. Every comparison is
+ * expressed as a range, or the complement of one, with the unbounded side set to the lowest or
+ * highest value of @p T.
+ */
+template <typename T, typename Comp>
+ItemFilter numberComparison(int column, filters::NumberComp op, T value, T epsilon, Comp comp) {
+    constexpr T lowest = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                               : std::numeric_limits<T>::lowest();
+    constexpr T highest = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                                : std::numeric_limits<T>::max();
+
+    const auto range = [&]() -> ValueRange<T> {
+        switch (op) {
+            case filters::NumberComp::Equal:
+                return {value - epsilon, value + epsilon, false};
+            case filters::NumberComp::NotEqual:
+                return {value - epsilon, value + epsilon, true};
+            case filters::NumberComp::Less:
+                return {value, highest, true};
+            case filters::NumberComp::LessEqual:
+                return {lowest, value, false};
+            case filters::NumberComp::Greater:
+                return {lowest, value, true};
+            case filters::NumberComp::GreaterEqual:
+                return {value, highest, false};
+            default:
+                return {value - epsilon, value + epsilon, false};
+        }
+    }();
+
+    return ItemFilter{std::function<bool(T)>(std::move(comp)), column, false, range};
+}
+
 template <typename T>
 ItemFilter epsilonComparison(int column, filters::NumberComp op, T value, T epsilon) {
-    auto createFilter = [v = value, column](auto comp) {
-        return ItemFilter{std::function<bool(T)>([v, comp](T value) { return comp(value, v); }),
-                          column, false};
+    auto createFilter = [&](auto comp) {
+        return numberComparison<T>(column, op, value, epsilon,
+                                   [v = value, comp](T value) { return comp(value, v); });
     };
 
     switch (op) {
         case filters::NumberComp::Equal:
-            return ItemFilter{std::function<bool(T)>([v = value, eps = epsilon](T value) {
-                                  return std::abs(value - v) <= eps;
-                              }),
-                              column, false};
+            return numberComparison<T>(column, op, value, epsilon,
+                                       [v = value, eps = epsilon](T value) {
+                                           return std::abs(value - v) <= eps;
+                                       });
         case filters::NumberComp::NotEqual:
-            return ItemFilter{std::function<bool(T)>([v = value, eps = epsilon](T value) {
-                                  return std::abs(value - v) > eps;
-                              }),
-                              column, false};
+            return numberComparison<T>(column, op, value, epsilon,
+                                       [v = value, eps = epsilon](T value) {
+                                           return std::abs(value - v) > eps;
+                                       });
         case filters::NumberComp::Less:
             return createFilter(std::less<T>());
         case filters::NumberComp::LessEqual:
@@ -91,10 +127,10 @@ ItemFilter epsilonComparison(int column, filters::NumberComp op, T value, T epsi
         case filters::NumberComp::GreaterEqual:
             return createFilter(std::greater_equal<T>());
         default:
-            return ItemFilter{std::function<bool(T)>([v = value, eps = epsilon](T value) {
-                                  return std::abs(value - v) <= eps;
-                              }),
-                              column, false};
+            return numberComparison<T>(column, filters::NumberComp::Equal, value, epsilon,
+                                       [v = value, eps = epsilon](T value) {
+                                           return std::abs(value - v) <= eps;
+                                       });
     }
 }
 
@@ -102,16 +138,15 @@ template <typename T>
 ItemFilter rangeComparison(int column, T min, T max) {
     return ItemFilter{
         std::function<bool(T)>([min, max](T value) { return (value >= min) && (value <= max); }),
-        column, false};
+        column, false, ValueRange<T>{min, max, false}};
 }
 
 }  // namespace detail
 
 ItemFilter intMatch(int column, filters::NumberComp op, std::int64_t value) {
-    auto createFilter = [v = value, column](auto comp) {
-        return ItemFilter{std::function<bool(std::int64_t)>(
-                              [v, comp](std::int64_t value) { return comp(value, v); }),
-                          column, false};
+    auto createFilter = [&](auto comp) {
+        return detail::numberComparison<std::int64_t>(
+            column, op, value, 0, [v = value, comp](std::int64_t value) { return comp(value, v); });
     };
 
     switch (op) {
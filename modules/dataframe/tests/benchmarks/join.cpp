@@ -257,6 +257,38 @@ static void SelectRowsDataFrame(benchmark::State& st) {
     }
 }
 
+template <bool leftJoin>
+void Join(benchmark::State& st) {
+    const auto rows = static_cast<int>(st.range(0));
+    const auto left = createDataFrame(rows, rows);
+    const auto right = createDataFrame(rows, rows);
+    const std::pair<std::string, std::string> key{"col1", "col1"};
+
+    for (auto _ : st) {
+        auto result = leftJoin ? dataframe::leftJoin(*left, *right, key)
+                               : dataframe::innerJoin(*left, *right, key);
+        benchmark::DoNotOptimize(result);
+    }
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+template <bool leftJoin>
+void JoinMultiKey(benchmark::State& st) {
+    const auto rows = static_cast<int>(st.range(0));
+    // keep the individual keys small enough to match, but not the combination of them
+    const auto left = createDataFrame(rows, 1024);
+    const auto right = createDataFrame(rows, 1024);
+    const std::vector<std::pair<std::string, std::string>> keys{
+        {"col1", "col1"}, {"col2", "col2"}, {"col3", "col3"}};
+
+    for (auto _ : st) {
+        auto result = leftJoin ? dataframe::leftJoin(*left, *right, keys)
+                               : dataframe::innerJoin(*left, *right, keys);
+        benchmark::DoNotOptimize(result);
+    }
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
 }  // namespace
 
 // BENCHMARK(MatchingRowsPrev)->RangeMultiplier(2)->Range(8, lenRight);
@@ -267,4 +299,21 @@ static void SelectRowsDataFrame(benchmark::State& st) {
 // BENCHMARK(SelectRows)->RangeMultiplier(2)->Range(64, lenRight);
 BENCHMARK(SelectRowsDataFrame)->RangeMultiplier(2)->Range(64, lenRight);
 
+BENCHMARK(Join<false>)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(Join<true>)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(JoinMultiKey<false>)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(JoinMultiKey<true>)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
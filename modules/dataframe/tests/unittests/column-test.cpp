@@ -263,4 +263,24 @@ TEST(ColumnFilter, IntRange) {
     EXPECT_EQ(expected, result) << "Filter result does not match";
 }
 
+TEST(ColumnTest, NormalizedBuffer) {
+    TemplateColumn<int> col("int", std::vector<int>{0, 5, 10, 20});
+
+    const auto normalized = col.getNormalizedBuffer();
+    const std::vector<float> expected = {0.0f, 0.25f, 0.5f, 1.0f};
+    EXPECT_EQ(expected, normalized->getRAMRepresentation()->getDataContainer());
+    EXPECT_EQ(normalized, col.getNormalizedBuffer()) << "Normalized buffer should be cached";
+
+    col.setCustomRange(dvec2{0.0, 10.0});
+    const auto clamped = col.getNormalizedBuffer();
+    EXPECT_NE(normalized, clamped) << "Changing the range should discard the cached buffer";
+    EXPECT_EQ(1.0f, clamped->getRAMRepresentation()->getDataContainer()[3]);
+
+    col.add(10);
+    EXPECT_EQ(size_t{5}, col.getNormalizedBuffer()->getSize());
+
+    TemplateColumn<int> constant("constant", std::vector<int>{3, 3});
+    EXPECT_EQ(0.5f, constant.getNormalizedBuffer()->getRAMRepresentation()->getDataContainer()[0]);
+}
+
 }  // namespace inviwo
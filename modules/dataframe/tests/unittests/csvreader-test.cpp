@@ -37,6 +37,7 @@
 #include <inviwo/dataframe/datastructures/dataframe.h>
 #include <inviwo/core/io/datareaderexception.h>
 
+#include <fstream>
 #include <sstream>
 
 namespace inviwo {
@@ -217,6 +218,28 @@ TEST(CSVdata, byteOrderMark) {
     EXPECT_EQ("1", value) << "Column 1";
 }
 
+TEST(CSVdata, largeFile) {
+    // Rows with quoted line breaks spanning several parse chunks of a memory mapped file
+    util::TempFileHandle tmpFile("", ".csv");
+    constexpr int rows = 200000;
+    {
+        std::ofstream file{tmpFile.getFileName(), std::ios::binary};
+        file << "Index,Text\n";
+        for (int i = 0; i < rows; ++i) {
+            file << i << ",\"line " << i << "\nnext\"\n";
+        }
+    }
+
+    CSVReader reader;
+    reader.setStripQuotes(true);
+    auto dataframe = reader.readData(tmpFile.getFileName());
+
+    ASSERT_EQ(3, dataframe->getNumberOfColumns()) << "column count does not match";
+    ASSERT_EQ(rows, dataframe->getNumberOfRows()) << "row count does not match";
+    EXPECT_EQ("199999", dataframe->getColumn(1)->getAsString(rows - 1)) << "Column 1";
+    EXPECT_EQ("line 123456\nnext", dataframe->getColumn(2)->getAsString(123456)) << "Column 2";
+}
+
 TEST(CSVheader, withHeader) {
     const std::string data = "1,2,3\n4,5,6";
     std::istringstream ss("First Col,Second Col,Third Col\n" + data);
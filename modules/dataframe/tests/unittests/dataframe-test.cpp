@@ -125,6 +125,30 @@ TEST(DataFrameTests, AddCategoricalColumnData) {
     EXPECT_EQ(expected, result) << "Categories after append are not correct";
 }
 
+TEST(DataFrameTests, CategoricalBulkAppend) {
+    std::vector<std::string> strings;
+    for (size_t i = 0; i < 200'000; ++i) {
+        strings.push_back(fmt::format("cat{}", (i * 7919) % 1013));
+    }
+    const std::vector<std::string_view> tokens(strings.begin(), strings.end());
+
+    CategoricalColumn single{"single"};
+    for (const auto& str : strings) single.add(str);
+    CategoricalColumn bulk{"bulk"};
+    bulk.append(tokens);
+
+    EXPECT_EQ(single.getCategories(), bulk.getCategories()) << "Category order differs";
+    EXPECT_EQ(single.getTypedBuffer()->getRAMRepresentation()->getDataContainer(),
+              bulk.getTypedBuffer()->getRAMRepresentation()->getDataContainer());
+
+    CategoricalColumn copy{bulk};
+    EXPECT_EQ(bulk.getDictionary(), copy.getDictionary()) << "Copies should share dictionary";
+    copy.add("new");
+    EXPECT_NE(bulk.getDictionary(), copy.getDictionary());
+    EXPECT_EQ(1013, bulk.getCategories().size());
+    EXPECT_EQ(1014, copy.getCategories().size());
+}
+
 TEST(DataFrameTests, AddColumnFromBuffer) {
     const std::string colname = "FloatCol";
 
@@ -167,6 +191,34 @@ TEST(DataFrameTests, RowAccess) {
     EXPECT_EQ(5, intcol->get(rowIndex));
 }
 
+TEST(DataFrameTests, RowSelectionView) {
+    DataFrame dataframe;
+    dataframe.addColumnFromBuffer("FloatCol",
+                                  util::makeBuffer(std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f}));
+    dataframe.addCategoricalColumn("CatCol", {"a", "b", "c", "d"});
+    dataframe.updateIndexBuffer();
+
+    const DataFrame view{dataframe, std::make_shared<const std::vector<std::uint32_t>>(
+                                        std::vector<std::uint32_t>{3, 1, 2})};
+    ASSERT_EQ(3, view.getNumberOfRows());
+    ASSERT_TRUE(view.getColumn(1)->getRowSelection());
+    EXPECT_EQ(dataframe.getColumn(1)->getBuffer(), view.getColumn(1)->getSourceBuffer());
+    EXPECT_EQ(4.0, view.getColumn(1)->getAsDouble(0));
+    EXPECT_EQ("b", view.getColumn(2)->getAsString(1));
+
+    const DataFrame chained{view, std::make_shared<const std::vector<std::uint32_t>>(
+                                      std::vector<std::uint32_t>{2, 0})};
+    ASSERT_EQ(2, chained.getNumberOfRows());
+    EXPECT_EQ(dataframe.getColumn(1)->getBuffer(), chained.getColumn(1)->getSourceBuffer());
+    EXPECT_EQ("c", chained.getColumn(2)->getAsString(0));
+    EXPECT_EQ("d", chained.getColumn(2)->getAsString(1));
+
+    const auto& floats = chained.getColumn(1)->getContainer<float>();
+    EXPECT_EQ((std::vector<float>{3.0f, 4.0f}), floats);
+    EXPECT_FALSE(chained.getColumn(1)->getRowSelection());
+    EXPECT_EQ(4.0, view.getColumn(1)->getAsDouble(0)) << "Materializing changed the source";
+}
+
 TEST(DataFrameFilter, NoFilter) {
     DataFrame dataframe;
     dataframe.addColumnFromBuffer("FloatCol",
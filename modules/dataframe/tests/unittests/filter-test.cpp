@@ -0,0 +1,133 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2020-2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/dataframe/datastructures/column.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/util/dataframeutil.h>
+#include <inviwo/dataframe/util/filters.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+DataFrame createDataFrame() {
+    DataFrame df;
+    df.addColumnFromBuffer("int", util::makeBuffer(std::vector<int>{-2, -1, 0, 1, 2, 3}));
+    df.addColumnFromBuffer(
+        "double", util::makeBuffer(std::vector<double>{
+                      0.5, std::numeric_limits<double>::quiet_NaN(), 1.5, 2.0, 2.5, 3.0}));
+    df.addCategoricalColumn("cat", std::vector<std::string>{"a", "b", "a", "c", "b", "a"});
+    df.updateIndexBuffer();
+    return df;
+}
+
+// Reference result from calling the filter function of each item
+std::vector<std::uint32_t> callFilters(const Column& col,
+                                       const std::vector<dataframefilters::ItemFilter>& filters) {
+    std::vector<std::uint32_t> rows;
+    for (std::uint32_t row = 0; row < col.getSize(); ++row) {
+        const bool match = std::any_of(filters.begin(), filters.end(), [&](const auto& f) {
+            if (auto* func = std::get_if<std::function<bool(std::int64_t)>>(&f.filter)) {
+                return (*func)(static_cast<std::int64_t>(col.getAsDouble(row)));
+            } else if (auto* func = std::get_if<std::function<bool(double)>>(&f.filter)) {
+                return (*func)(col.getAsDouble(row));
+            }
+            return false;
+        });
+        if (match) rows.push_back(row);
+    }
+    return rows;
+}
+
+}  // namespace
+
+TEST(DataFrameFilter, RangesMatchFilterFunctions) {
+    const auto df = createDataFrame();
+    const auto& intCol = *df.getColumn("int");
+    const auto& doubleCol = *df.getColumn("double");
+
+    for (auto op : {filters::NumberComp::Equal, filters::NumberComp::NotEqual,
+                    filters::NumberComp::Less, filters::NumberComp::LessEqual,
+                    filters::NumberComp::Greater, filters::NumberComp::GreaterEqual}) {
+        for (std::int64_t value : {std::numeric_limits<std::int64_t>::lowest(), std::int64_t{-1},
+                                   std::int64_t{1}, std::numeric_limits<std::int64_t>::max()}) {
+            const std::vector filters{dataframefilters::intMatch(1, op, value)};
+            EXPECT_EQ(callFilters(intCol, filters), dataframe::selectRows(intCol, filters))
+                << "int filter " << static_cast<int>(op) << " " << value;
+        }
+        for (double value : {-1.0, 1.5, 2.75, std::numeric_limits<double>::infinity()}) {
+            const std::vector filters{dataframefilters::doubleMatch(2, op, value)};
+            EXPECT_EQ(callFilters(doubleCol, filters), dataframe::selectRows(doubleCol, filters))
+                << "double filter " << static_cast<int>(op) << " " << value;
+        }
+    }
+}
+
+TEST(DataFrameFilter, Categorical) {
+    const auto df = createDataFrame();
+    const auto& col = *df.getColumn("cat");
+
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 2, 5}),
+              dataframe::selectRows(
+                  col, {dataframefilters::stringMatch(3, filters::StringComp::Equal, "a")}));
+    EXPECT_EQ((std::vector<std::uint32_t>{1, 3, 4}),
+              dataframe::selectRows(
+                  col, {dataframefilters::stringMatch(3, filters::StringComp::Regex, "[bc]")}));
+    EXPECT_TRUE(dataframe::selectRows(col, {dataframefilters::intRange(3, 0, 10)}).empty());
+}
+
+TEST(DataFrameFilter, IncludeExclude) {
+    const auto df = createDataFrame();
+
+    dataframefilters::Filters filters;
+    EXPECT_EQ(df.getNumberOfRows(), dataframe::selectRows(df, filters).size());
+
+    filters.include.push_back(dataframefilters::intRange(1, 0, 3));
+    filters.include.push_back(dataframefilters::stringMatch(3, filters::StringComp::Equal, "b"));
+    filters.exclude.push_back(dataframefilters::doubleRange(2, 2.5, 3.0));
+    EXPECT_EQ((std::vector<std::uint32_t>{1, 2, 3}), dataframe::selectRows(df, filters));
+}
+
+}  // namespace inviwo
@@ -39,6 +39,7 @@
 
 #include <algorithm>
 #include <ranges>
+#include <sstream>
 
 namespace inviwo {
 
@@ -162,4 +163,65 @@ TEST(JSONConversion, DataFrameToDataFrame) {
     EXPECT_TRUE(isMatching) << "Converted DataFrame does not match source DataFrame";
 }
 
+TEST(JSONConversion, StreamToDataFrame) {
+    // the types are written after the data since json objects sort their keys
+    const std::vector<double> sepalLength{5.1, 4.9, 4.7};
+    const std::vector<std::int64_t> count{-1, 2, 3};
+    const std::vector<std::string> species{"setosa", "virginica", "setosa"};
+
+    DataFrame dataframe;
+    dataframe.addColumn("sepalLength", sepalLength);
+    dataframe.addColumn("count", count);
+    dataframe.addCategoricalColumn("species", species);
+    dataframe.updateIndexBuffer();
+
+    const json j = dataframe;
+    std::istringstream stream{j.dump()};
+
+    DataFrame result;
+    parseDataFrame(stream, result);
+
+    ASSERT_EQ(dataframe.getNumberOfColumns(), result.getNumberOfColumns());
+    ASSERT_EQ(dataframe.getNumberOfRows(), result.getNumberOfRows());
+    for (auto&& [col, resultCol] : util::zip(dataframe, result)) {
+        EXPECT_EQ(col->getHeader(), resultCol->getHeader());
+        EXPECT_EQ(col->getColumnType(), resultCol->getColumnType());
+        EXPECT_EQ(col->getBuffer()->getDataFormat()->getId(),
+                  resultCol->getBuffer()->getDataFormat()->getId());
+        for (auto row : std::ranges::iota_view{size_t{0}, result.getNumberOfRows()}) {
+            EXPECT_EQ(col->getAsString(row), resultCol->getAsString(row));
+        }
+    }
+}
+
+TEST(JSONConversion, StreamInferTypes) {
+    std::istringstream stream{IVW_UNINDENT(R"(
+        {
+            "columns": [ "a", "b", "c" ],
+            "data": [
+                [ null, -1, "x" ],
+                [ 2.5, 4, "y" ]
+            ]
+        }
+    )")};
+
+    DataFrame result;
+    parseDataFrame(stream, result);
+
+    ASSERT_EQ(4, result.getNumberOfColumns());
+    ASSERT_EQ(2, result.getNumberOfRows());
+    EXPECT_EQ(DataFormatId::Float32, result.getColumn(1)->getBuffer()->getDataFormat()->getId());
+    EXPECT_EQ(DataFormatId::Int32, result.getColumn(2)->getBuffer()->getDataFormat()->getId());
+    EXPECT_EQ(ColumnType::Categorical, result.getColumn(3)->getColumnType());
+    EXPECT_EQ("nan", result.getColumn(1)->getAsString(0));
+    EXPECT_EQ(-1.0, result.getColumn(2)->getAsDouble(0));
+    EXPECT_EQ("y", result.getColumn(3)->getAsString(1));
+}
+
+TEST(JSONConversion, StreamRowSizeMismatch) {
+    std::istringstream stream{R"({"columns": ["a", "b"], "data": [[1, 2], [3]]})"};
+    DataFrame result;
+    EXPECT_THROW(parseDataFrame(stream, result), JSONConversionException);
+}
+
 }  // namespace inviwo
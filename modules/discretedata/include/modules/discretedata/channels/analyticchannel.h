@@ -54,6 +54,12 @@ class AnalyticChannel : public DataChannel<T, N> {
 public:
     static_assert(sizeof(Vec) == sizeof(T) * N, "Size and type do not agree with the vector type.");
     using Function = typename std::function<void(Vec&, ind)>;
+    /**
+     * Generator for a range of consecutive indices, called as f(dest, start, count) writing
+     * dest[0] to dest[count - 1]. Being a plain loop over the range it can be vectorized by the
+     * compiler, unlike calling a Function for each index.
+     */
+    using BlockFunction = typename std::function<void(Vec*, ind, ind)>;
 
 public:
     /**
@@ -69,6 +75,20 @@ public:
         , numElements_(numElements)
         , dataFunction_(dataFunction) {}
 
+    /**
+     * \brief Direct construction from a block generator
+     * @param blockFunction Data generator, mapping of a linear index range to Vec[count]
+     * @param numElements Total number of indexed positions
+     * @param name Name associated with the channel
+     * @param definedOn GridPrimitive the data is defined on, default: 0D vertices
+     */
+    AnalyticChannel(BlockFunction blockFunction, ind numElements, const std::string& name,
+                    GridPrimitive definedOn = GridPrimitive::Vertex)
+        : DataChannel<T, N>(name, definedOn)
+        , numElements_(numElements)
+        , dataFunction_([blockFunction](Vec& dest, ind index) { blockFunction(&dest, index, 1); })
+        , blockFunction_(std::move(blockFunction)) {}
+
     virtual ~AnalyticChannel() = default;
 
 public:
@@ -85,6 +105,22 @@ public:
         dataFunction_(destVec, index);
     }
 
+    /**
+     * \brief Bulk point access, constant
+     * Uses the block generator if available, otherwise the function is called for each index.
+     * @param dest Position to write to, expect write of count * NumComponents many T
+     * @param start Linear index of the first point
+     * @param count Number of points
+     */
+    void fillRaw(T* dest, ind start, ind count) const override {
+        Vec* destVec = reinterpret_cast<Vec*>(dest);
+        if (blockFunction_) {
+            blockFunction_(destVec, start, count);
+        } else {
+            for (ind i = 0; i < count; ++i) dataFunction_(destVec[i], start + i);
+        }
+    }
+
 protected:
     virtual CachedGetter<AnalyticChannel>* newIterator() override {
         return new CachedGetter<AnalyticChannel>(this);
@@ -93,6 +129,7 @@ protected:
 public:
     ind numElements_;
     Function dataFunction_;
+    BlockFunction blockFunction_;
 };
 
 }  // namespace discretedata
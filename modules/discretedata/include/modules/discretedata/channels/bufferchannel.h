@@ -36,6 +36,8 @@
 #include <modules/discretedata/channels/channelgetter.h>
 #include <modules/discretedata/channels/buffergetter.h>
 
+#include <span>
+
 namespace inviwo {
 namespace discretedata {
 
@@ -100,6 +102,17 @@ public:
 
     const std::vector<T>& data() const { return buffer_; }
 
+    /**
+     * \brief Contiguous view of all points, no copy
+     * @tparam VecNT Element type of the view
+     */
+    template <typename VecNT = DefaultVec>
+    std::span<const VecNT> view() const {
+        static_assert(sizeof(VecNT) == sizeof(T) * N,
+                      "Size and type do not agree with the vector type.");
+        return {reinterpret_cast<const VecNT*>(buffer_.data()), static_cast<size_t>(size())};
+    }
+
     /**
      * \brief Indexed point access
      * @param index Linear point index
@@ -156,6 +169,16 @@ protected:
         memcpy(dest, &buffer_[index * N], sizeof(T) * N);
     }
 
+    /**
+     * \brief Bulk point access, constant, a single copy of the contiguous range
+     * @param dest Position to write to, expect write of count * NumComponents many T
+     * @param start Linear index of the first point
+     * @param count Number of points
+     */
+    virtual void fillRaw(T* dest, ind start, ind count) const override {
+        memcpy(dest, &buffer_[start * N], sizeof(T) * N * count);
+    }
+
     /**
      * \brief Vector containing the buffer data
      * Resizeable only by DataSet. Handle with care:
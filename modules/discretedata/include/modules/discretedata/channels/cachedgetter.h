@@ -35,6 +35,10 @@
 #include <modules/discretedata/channels/channelgetter.h>
 #include <modules/discretedata/channels/datachannel.h>
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
 namespace inviwo {
 namespace discretedata {
 
@@ -44,32 +48,40 @@ struct CachedGetter : public ChannelGetter<typename Parent::value_type, Parent::
     static constexpr int num_comp = Parent::num_comp;
 
     CachedGetter(Parent* parent)
-        : ChannelGetter<value_type, num_comp>(), dataIndex(-1), parent_{parent} {}
+        : ChannelGetter<value_type, num_comp>(), dataStart(0), dataCount(0), parent_{parent} {}
     virtual ~CachedGetter() = default;
     virtual CachedGetter* clone() const override { return new CachedGetter(parent_); }
 
     virtual value_type* get(ind index) override {
         assert(this->parent_ && "No channel to iterate is set.");
 
-        // Is the data up to date?
-        if (dataIndex != index) {
-            this->parent_->fill(data, index);
-            dataIndex = index;
+        // Is the data up to date? Fetch a whole block at once to amortize the virtual calls
+        // of the channel when iterating.
+        if (index < dataStart || index >= dataStart + dataCount) {
+            dataStart = index;
+            dataCount = std::max(ind{1}, std::min(blockSize, parent_->size() - index));
+            data.resize(static_cast<size_t>(dataCount * num_comp));
+            this->parent_->fill(reinterpret_cast<std::array<value_type, num_comp>*>(data.data()),
+                                dataStart, dataCount);
         }
 
         // Always return data.
         // If the iterator is changed and dereferenced, the pointer becomes invalid.
-        return data.data();
+        return &data[(index - dataStart) * num_comp];
     }
 
 protected:
     virtual Channel* parent() const override { return parent_; }
 
-    //! Memory is invalidated on iteration
-    std::array<value_type, num_comp> data;
+    //! Number of elements fetched at once
+    static constexpr ind blockSize = 256;
+
+    //! Memory is invalidated when iterating past the cached range
+    std::vector<value_type> data;
 
-    //! Index that is currently pointed to
-    ind dataIndex;
+    //! Range of indices that is currently cached
+    ind dataStart;
+    ind dataCount;
 
     Parent* parent_;
 };
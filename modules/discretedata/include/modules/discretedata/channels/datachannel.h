@@ -47,6 +47,16 @@ public:
 
 protected:
     virtual void fillRaw(T* dest, ind index) const = 0;
+    /**
+     * \brief Copy \p count consecutive elements starting at \p start, expects a write of
+     * count * NumComponents many T. Falls back to element wise access, override for sources with
+     * faster bulk access.
+     */
+    virtual void fillRaw(T* dest, ind start, ind count) const {
+        for (ind i = 0; i < count; ++i) {
+            fillRaw(dest + i * N, start + i);
+        }
+    }
     virtual ChannelGetter<T, N>* newIterator() = 0;
 };
 
@@ -106,6 +116,21 @@ public:
         fill(dest, index);
     }
 
+    /**
+     * \brief Bulk point access, copy \p count consecutive elements starting at \p start.
+     * Only a single virtual call for the whole range, prefer over fill(VecNT&, ind) in loops.
+     * Thread safe.
+     * @param dest Position to write to, expect VecNT[count]
+     * @param start Linear index of the first point
+     * @param count Number of points to copy
+     */
+    template <typename VecNT>
+    void fill(VecNT* dest, ind start, ind count) const {
+        static_assert(sizeof(VecNT) == sizeof(T) * N,
+                      "Size and type do not agree with the vector type.");
+        this->fillRaw(reinterpret_cast<T*>(dest), start, count);
+    }
+
     template <typename VecNT = DefaultVec>
     iterator<VecNT> begin() {
         return iterator<VecNT>(this->newIterator(), 0);
@@ -247,10 +272,17 @@ void DataChannel<T, N>::computeMinMax() const {
     this->fill(minT, 0);
     this->fill(maxT, 0);
 
-    for (const Vec& val : this->all<Vec>()) {
-        for (ind dim = 0; dim < N; ++dim) {
-            minT[dim] = std::min(minT[dim], val[dim]);
-            maxT[dim] = std::max(maxT[dim], val[dim]);
+    // fetch the values in blocks to avoid a virtual call per element
+    constexpr ind blockSize = 1024;
+    std::vector<Vec> block(static_cast<size_t>(std::min(blockSize, this->size())));
+    for (ind start = 0; start < this->size(); start += blockSize) {
+        const ind count = std::min(blockSize, this->size() - start);
+        this->fill(block.data(), start, count);
+        for (ind i = 0; i < count; ++i) {
+            for (ind dim = 0; dim < N; ++dim) {
+                minT[dim] = std::min(minT[dim], block[i][dim]);
+                maxT[dim] = std::max(maxT[dim], block[i][dim]);
+            }
         }
     }
 
@@ -0,0 +1,386 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/discretedata/discretedatamoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/parallel.h>
+
+#include <modules/discretedata/channels/datachannel.h>
+#include <modules/discretedata/connectivity/structuredgrid.h>
+#include <modules/discretedata/connectivity/periodicgrid.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace inviwo {
+namespace discretedata {
+
+/**
+ * \brief Point location in the cells of a curvilinear StructuredGrid or PeriodicGrid
+ *
+ * Cells are treated as multilinear quads (2D) or hexahedra (3D). A query first walks the grid
+ * from a hint cell towards the point, which takes only a few steps for coherent queries such as
+ * the consecutive samples of an integral line. If the walk does not end up in a cell containing
+ * the point, a bounding volume hierarchy over the cell bounds is searched instead.
+ * Periodic dimensions of a PeriodicGrid are wrapped around while walking.
+ */
+template <ind N>
+class CellLocator {
+public:
+    static_assert(N == 2 || N == 3, "Only 2D and 3D grids are supported.");
+    using Vec = glm::vec<N, double>;
+    static constexpr ind NumCorners = ind{1} << N;
+
+    struct Location {
+        ind cell;
+        //! Multilinear coordinates of the point within the cell, in [0,1]^N
+        Vec local;
+    };
+
+    /**
+     * \brief Build the location index
+     * @param grid Grid to locate points in, expected to be of dimension N
+     * @param positions Vertex positions of the grid
+     */
+    template <typename T>
+    CellLocator(std::shared_ptr<const StructuredGrid> grid, const DataChannel<T, N>& positions);
+
+    /**
+     * \brief Find the cell containing pos
+     * @param pos Position to locate
+     * @param hint Cell to start walking from, e.g. the cell of the previous query. Pass -1 to
+     * only use the bounding volume hierarchy.
+     * @return The containing cell and the local coordinates of pos, std::nullopt if pos is
+     * outside of the grid.
+     */
+    std::optional<Location> locate(const Vec& pos, ind hint = -1) const;
+
+    //! Linear indices of the corner vertices of a cell, bit d of the corner index steps in dim d
+    std::array<ind, NumCorners> getCorners(ind cell) const;
+
+    //! Multilinear interpolation weights of the corners at the given local coordinates
+    static std::array<double, NumCorners> getWeights(const Vec& local);
+
+    const std::shared_ptr<const StructuredGrid>& getGrid() const { return grid_; }
+    ind getNumCells() const { return numCells_; }
+
+    //! Maximum number of cells visited when walking from a hint before searching the hierarchy
+    static constexpr ind maxWalkSteps = 16;
+
+private:
+    struct Node {
+        Vec min;
+        Vec max;
+        //! First cell in cellOrder_ for leaves, index of the second child for inner nodes
+        ind offset;
+        //! Number of cells for leaves, zero for inner nodes
+        ind count;
+    };
+    static constexpr ind leafSize = 4;
+
+    std::optional<Location> walk(const Vec& pos, ind cell) const;
+    std::optional<Location> search(const Vec& pos) const;
+
+    /**
+     * Invert the multilinear map of the cell with a few Newton steps. Returns false if the
+     * Jacobian is degenerate. The result can lie outside of [0,1]^N if pos is not in the cell.
+     */
+    bool toLocal(ind cell, const Vec& pos, Vec& local) const;
+    static bool isInside(const Vec& local);
+
+    ind build(ind first, ind last, const std::vector<Vec>& mins, const std::vector<Vec>& maxs,
+              std::vector<Vec>& centers);
+
+    std::shared_ptr<const StructuredGrid> grid_;
+    std::array<ind, N> cellsPerDim_;
+    std::array<ind, N> cellStrides_;
+    std::array<ind, N> vertexStrides_;
+    std::array<bool, N> periodic_;
+    ind numCells_ = 0;
+    std::vector<Vec> positions_;
+    std::vector<Node> nodes_;
+    std::vector<ind> cellOrder_;
+};
+
+template <ind N>
+template <typename T>
+CellLocator<N>::CellLocator(std::shared_ptr<const StructuredGrid> grid,
+                            const DataChannel<T, N>& positions)
+    : grid_{std::move(grid)} {
+    if (!grid_ || static_cast<ind>(grid_->getDimension()) != N) {
+        throw Exception(SourceContext{}, "CellLocator expects a {}D structured grid", N);
+    }
+
+    const auto* periodicGrid = dynamic_cast<const PeriodicGrid*>(grid_.get());
+    ind cells = 1;
+    ind verts = 1;
+    for (ind dim = 0; dim < N; ++dim) {
+        cellsPerDim_[dim] = grid_->getNumCellsInDimension(dim);
+        cellStrides_[dim] = cells;
+        vertexStrides_[dim] = verts;
+        periodic_[dim] = periodicGrid && periodicGrid->isPeriodic(dim);
+        cells *= cellsPerDim_[dim];
+        verts *= cellsPerDim_[dim] + 1;
+    }
+    numCells_ = cells;
+
+    if (positions.size() != verts) {
+        throw Exception(SourceContext{}, "Expected {} vertex positions, got {}", verts,
+                        positions.size());
+    }
+
+    // Copy the positions once, the queries touch them in random order.
+    std::vector<std::array<T, N>> raw(static_cast<size_t>(verts));
+    positions.fill(raw.data(), 0, verts);
+    positions_.resize(raw.size());
+    std::transform(raw.begin(), raw.end(), positions_.begin(), [](const auto& p) {
+        Vec v;
+        for (ind dim = 0; dim < N; ++dim) v[dim] = static_cast<double>(p[dim]);
+        return v;
+    });
+
+    std::vector<Vec> mins(static_cast<size_t>(numCells_));
+    std::vector<Vec> maxs(static_cast<size_t>(numCells_));
+    std::vector<Vec> centers(static_cast<size_t>(numCells_));
+    util::parallelFor(size_t{0}, static_cast<size_t>(numCells_), [&](size_t cell) {
+        const auto corners = getCorners(static_cast<ind>(cell));
+        Vec lo{std::numeric_limits<double>::max()};
+        Vec hi{std::numeric_limits<double>::lowest()};
+        for (ind corner : corners) {
+            lo = glm::min(lo, positions_[corner]);
+            hi = glm::max(hi, positions_[corner]);
+        }
+        mins[cell] = lo;
+        maxs[cell] = hi;
+        centers[cell] = 0.5 * (lo + hi);
+    });
+
+    cellOrder_.resize(static_cast<size_t>(numCells_));
+    for (ind cell = 0; cell < numCells_; ++cell) cellOrder_[cell] = cell;
+    nodes_.reserve(static_cast<size_t>(2 * (numCells_ / leafSize + 1)));
+    if (numCells_ > 0) build(0, numCells_, mins, maxs, centers);
+}
+
+template <ind N>
+ind CellLocator<N>::build(ind first, ind last, const std::vector<Vec>& mins,
+                          const std::vector<Vec>& maxs, std::vector<Vec>& centers) {
+    const ind nodeIndex = static_cast<ind>(nodes_.size());
+    nodes_.push_back({Vec{std::numeric_limits<double>::max()},
+                      Vec{std::numeric_limits<double>::lowest()}, first, last - first});
+
+    Vec centerMin{std::numeric_limits<double>::max()};
+    Vec centerMax{std::numeric_limits<double>::lowest()};
+    for (ind i = first; i < last; ++i) {
+        const ind cell = cellOrder_[i];
+        nodes_[nodeIndex].min = glm::min(nodes_[nodeIndex].min, mins[cell]);
+        nodes_[nodeIndex].max = glm::max(nodes_[nodeIndex].max, maxs[cell]);
+        centerMin = glm::min(centerMin, centers[cell]);
+        centerMax = glm::max(centerMax, centers[cell]);
+    }
+    if (last - first <= leafSize) return nodeIndex;
+
+    // Median split along the longest extent of the cell centers.
+    const Vec extent = centerMax - centerMin;
+    ind axis = 0;
+    for (ind dim = 1; dim < N; ++dim) {
+        if (extent[dim] > extent[axis]) axis = dim;
+    }
+    const ind mid = first + (last - first) / 2;
+    std::nth_element(cellOrder_.begin() + first, cellOrder_.begin() + mid,
+                     cellOrder_.begin() + last,
+                     [&](ind a, ind b) { return centers[a][axis] < centers[b][axis]; });
+
+    build(first, mid, mins, maxs, centers);
+    const ind second = build(mid, last, mins, maxs, centers);
+    nodes_[nodeIndex].offset = second;
+    nodes_[nodeIndex].count = 0;
+    return nodeIndex;
+}
+
+template <ind N>
+auto CellLocator<N>::getCorners(ind cell) const -> std::array<ind, NumCorners> {
+    ind base = 0;
+    for (ind dim = 0; dim < N; ++dim) {
+        base += ((cell / cellStrides_[dim]) % cellsPerDim_[dim]) * vertexStrides_[dim];
+    }
+    std::array<ind, NumCorners> corners;
+    for (ind corner = 0; corner < NumCorners; ++corner) {
+        corners[corner] = base;
+        for (ind dim = 0; dim < N; ++dim) {
+            if (corner & (ind{1} << dim)) corners[corner] += vertexStrides_[dim];
+        }
+    }
+    return corners;
+}
+
+template <ind N>
+auto CellLocator<N>::getWeights(const Vec& local) -> std::array<double, NumCorners> {
+    std::array<double, NumCorners> weights;
+    for (ind corner = 0; corner < NumCorners; ++corner) {
+        double w = 1.0;
+        for (ind dim = 0; dim < N; ++dim) {
+            w *= (corner & (ind{1} << dim)) ? local[dim] : 1.0 - local[dim];
+        }
+        weights[corner] = w;
+    }
+    return weights;
+}
+
+template <ind N>
+bool CellLocator<N>::toLocal(ind cell, const Vec& pos, Vec& local) const {
+    std::array<Vec, NumCorners> p;
+    const auto corners = getCorners(cell);
+    for (ind corner = 0; corner < NumCorners; ++corner) p[corner] = positions_[corners[corner]];
+
+    local = Vec{0.5};
+    for (int iteration = 0; iteration < 12; ++iteration) {
+        Vec x{0.0};
+        glm::mat<N, N, double> jacobian{0.0};
+        for (ind corner = 0; corner < NumCorners; ++corner) {
+            double w = 1.0;
+            Vec dw{1.0};
+            for (ind dim = 0; dim < N; ++dim) {
+                const bool upper = corner & (ind{1} << dim);
+                const double f = upper ? local[dim] : 1.0 - local[dim];
+                w *= f;
+                for (ind other = 0; other < N; ++other) {
+                    dw[other] *= (other == dim) ? (upper ? 1.0 : -1.0) : f;
+                }
+            }
+            x += w * p[corner];
+            for (ind dim = 0; dim < N; ++dim) jacobian[dim] += dw[dim] * p[corner];
+        }
+
+        const double det = glm::determinant(jacobian);
+        if (std::abs(det) < std::numeric_limits<double>::min()) return false;
+        const Vec delta = glm::inverse(jacobian) * (pos - x);
+        local += delta;
+
+        double change = 0.0;
+        for (ind dim = 0; dim < N; ++dim) change = std::max(change, std::abs(delta[dim]));
+        if (change < 1e-10) break;
+        // Far outside, the direction is all the walk needs.
+        if (change > 1e3) break;
+    }
+    return true;
+}
+
+template <ind N>
+bool CellLocator<N>::isInside(const Vec& local) {
+    constexpr double eps = 1e-8;
+    for (ind dim = 0; dim < N; ++dim) {
+        if (local[dim] < -eps || local[dim] > 1.0 + eps) return false;
+    }
+    return true;
+}
+
+template <ind N>
+auto CellLocator<N>::walk(const Vec& pos, ind cell) const -> std::optional<Location> {
+    ind previous = -1;
+    for (ind step = 0; step < maxWalkSteps; ++step) {
+        Vec local;
+        if (!toLocal(cell, pos, local)) return std::nullopt;
+        if (isInside(local)) return Location{cell, glm::clamp(local, Vec{0.0}, Vec{1.0})};
+
+        // Step over the face that is violated the most.
+        ind axis = 0;
+        double violation = 0.0;
+        for (ind dim = 0; dim < N; ++dim) {
+            const double v = std::max(-local[dim], local[dim] - 1.0);
+            if (v > violation) {
+                violation = v;
+                axis = dim;
+            }
+        }
+        const ind index = (cell / cellStrides_[axis]) % cellsPerDim_[axis];
+        ind next = index + (local[axis] < 0.0 ? -1 : 1);
+        if (next < 0 || next >= cellsPerDim_[axis]) {
+            if (!periodic_[axis]) return std::nullopt;
+            next = (next + cellsPerDim_[axis]) % cellsPerDim_[axis];
+        }
+        const ind neighbor = cell + (next - index) * cellStrides_[axis];
+        // Oscillating between two cells, the point is in a gap or a concave boundary region.
+        if (neighbor == previous) return std::nullopt;
+        previous = cell;
+        cell = neighbor;
+    }
+    return std::nullopt;
+}
+
+template <ind N>
+auto CellLocator<N>::search(const Vec& pos) const -> std::optional<Location> {
+    if (nodes_.empty()) return std::nullopt;
+
+    constexpr double eps = 1e-12;
+    const auto contains = [&](const Node& node) {
+        for (ind dim = 0; dim < N; ++dim) {
+            if (pos[dim] < node.min[dim] - eps || pos[dim] > node.max[dim] + eps) return false;
+        }
+        return true;
+    };
+
+    std::array<ind, 64> stack;
+    ind top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const Node& node = nodes_[stack[--top]];
+        if (!contains(node)) continue;
+
+        if (node.count == 0) {
+            stack[top++] = node.offset;
+            stack[top++] = static_cast<ind>(&node - nodes_.data()) + 1;
+            continue;
+        }
+        for (ind i = node.offset; i < node.offset + node.count; ++i) {
+            Vec local;
+            if (toLocal(cellOrder_[i], pos, local) && isInside(local)) {
+                return Location{cellOrder_[i], glm::clamp(local, Vec{0.0}, Vec{1.0})};
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+template <ind N>
+auto CellLocator<N>::locate(const Vec& pos, ind hint) const -> std::optional<Location> {
+    if (hint >= 0 && hint < numCells_) {
+        if (auto location = walk(pos, hint)) return location;
+    }
+    return search(pos);
+}
+
+}  // namespace discretedata
+}  // namespace inviwo
@@ -219,10 +219,11 @@ std::shared_ptr<const BufferChannel<T, N>> DataSet::getAsBuffer(const std::strin
     // Check for nullptr inside.
     if (bufferChannel) return bufferChannel;
 
-    // Copy data over.
+    // Copy data over in one go.
     BufferChannel<T, N>* buffer = new BufferChannel<T, N>(dataChannel->size(), name, definedOn);
-    for (ind element = 0; element < dataChannel->size(); ++element)
-        dataChannel->fill(buffer->template get<std::array<T, N>>(element), element);
+    if (dataChannel->size() > 0) {
+        dataChannel->fill(&buffer->template get<std::array<T, N>>(0), 0, dataChannel->size());
+    }
 
     buffer->copyMetaDataFrom(*dataChannel.get());
 
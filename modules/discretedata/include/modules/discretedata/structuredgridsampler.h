@@ -0,0 +1,180 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/discretedata/discretedatamoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+#include <inviwo/core/datastructures/spatialdata.h>
+#include <inviwo/core/util/spatialsampler.h>
+
+#include <modules/discretedata/dataset.h>
+#include <modules/discretedata/connectivity/celllocator.h>
+
+namespace inviwo {
+namespace discretedata {
+
+/**
+ * \brief Multilinear interpolation of vertex data on a curvilinear StructuredGrid or PeriodicGrid
+ *
+ * Exposed as a SpatialSampler so that the integral line tracers of the vectorfieldvisualization
+ * module can trace directly on the grid, without resampling to a volume. Points are located with
+ * a CellLocator, each thread starts walking from the cell of its previous sample. Positions are
+ * given in data space, the grid positions are used as is.
+ */
+template <ind N>
+class StructuredGridSampler : public SpatialSampler<glm::vec<N, double>> {
+public:
+    using Vec = glm::vec<N, double>;
+
+    /**
+     * @param locator Cell locator of the grid the data is defined on
+     * @param data Vertex data to interpolate, N components per vertex
+     */
+    template <typename T>
+    StructuredGridSampler(std::shared_ptr<const CellLocator<N>> locator,
+                          const DataChannel<T, N>& data);
+
+    /**
+     * Build a locator from the positions channel of the data set and sample the given channel.
+     * Throws an Exception if a channel is missing or the grid is not an N-dimensional
+     * StructuredGrid.
+     */
+    StructuredGridSampler(const DataSet& dataSet, const std::string& positions,
+                          const std::string& data);
+
+    virtual ~StructuredGridSampler() = default;
+
+    const std::shared_ptr<const CellLocator<N>>& getLocator() const { return locator_; }
+
+protected:
+    virtual Vec sampleDataSpace(const dvec3& pos) const override;
+    virtual bool withinBoundsDataSpace(const dvec3& pos) const override;
+
+private:
+    template <typename T>
+    StructuredGridSampler(std::shared_ptr<const SpatialIdentity> identity,
+                          std::shared_ptr<const CellLocator<N>> locator,
+                          const DataChannel<T, N>& data);
+
+    std::optional<typename CellLocator<N>::Location> locate(const dvec3& pos) const;
+    static std::shared_ptr<const CellLocator<N>> createLocator(const DataSet& dataSet,
+                                                               const std::string& positions);
+    static std::shared_ptr<const DataChannel<double, N>> getChannel(const DataSet& dataSet,
+                                                                    const std::string& name);
+
+    std::shared_ptr<const SpatialIdentity> identity_;
+    std::shared_ptr<const CellLocator<N>> locator_;
+    std::vector<Vec> data_;
+};
+
+template <ind N>
+template <typename T>
+StructuredGridSampler<N>::StructuredGridSampler(std::shared_ptr<const CellLocator<N>> locator,
+                                                const DataChannel<T, N>& data)
+    : StructuredGridSampler(std::make_shared<SpatialIdentity>(), std::move(locator), data) {}
+
+template <ind N>
+StructuredGridSampler<N>::StructuredGridSampler(const DataSet& dataSet,
+                                                const std::string& positions,
+                                                const std::string& data)
+    : StructuredGridSampler(createLocator(dataSet, positions), *getChannel(dataSet, data)) {}
+
+template <ind N>
+template <typename T>
+StructuredGridSampler<N>::StructuredGridSampler(std::shared_ptr<const SpatialIdentity> identity,
+                                                std::shared_ptr<const CellLocator<N>> locator,
+                                                const DataChannel<T, N>& data)
+    : SpatialSampler<Vec>(*identity), identity_{std::move(identity)}, locator_{std::move(locator)} {
+    const ind size = data.size();
+    if (!locator_ || size != locator_->getGrid()->getNumElements(GridPrimitive::Vertex)) {
+        throw Exception(SourceContext{}, "Data channel '{}' does not match the grid",
+                        data.getName());
+    }
+    std::vector<std::array<T, N>> raw(static_cast<size_t>(size));
+    data.fill(raw.data(), 0, size);
+    data_.resize(raw.size());
+    std::transform(raw.begin(), raw.end(), data_.begin(), [](const auto& v) {
+        Vec res;
+        for (ind dim = 0; dim < N; ++dim) res[dim] = static_cast<double>(v[dim]);
+        return res;
+    });
+}
+
+template <ind N>
+auto StructuredGridSampler<N>::createLocator(const DataSet& dataSet, const std::string& positions)
+    -> std::shared_ptr<const CellLocator<N>> {
+    auto grid = dataSet.getGrid<StructuredGrid>();
+    if (!grid) throw Exception(SourceContext{}, "Data set does not have a structured grid");
+    return std::make_shared<CellLocator<N>>(grid, *getChannel(dataSet, positions));
+}
+
+template <ind N>
+auto StructuredGridSampler<N>::getChannel(const DataSet& dataSet, const std::string& name)
+    -> std::shared_ptr<const DataChannel<double, N>> {
+    auto channel = dataSet.getAsBuffer<double, N>(name);
+    if (!channel) {
+        throw Exception(SourceContext{}, "No {}D channel of type double named '{}'", N, name);
+    }
+    return channel;
+}
+
+template <ind N>
+auto StructuredGridSampler<N>::locate(const dvec3& pos) const
+    -> std::optional<typename CellLocator<N>::Location> {
+    // Consecutive samples of one thread usually belong to the same integral line.
+    thread_local std::pair<const void*, ind> hint{nullptr, -1};
+    if (hint.first != this) hint = {this, -1};
+
+    auto location = locator_->locate(Vec{pos}, hint.second);
+    if (location) hint.second = location->cell;
+    return location;
+}
+
+template <ind N>
+auto StructuredGridSampler<N>::sampleDataSpace(const dvec3& pos) const -> Vec {
+    const auto location = locate(pos);
+    if (!location) return Vec{0.0};
+
+    const auto corners = locator_->getCorners(location->cell);
+    const auto weights = CellLocator<N>::getWeights(location->local);
+    Vec res{0.0};
+    for (ind corner = 0; corner < CellLocator<N>::NumCorners; ++corner) {
+        res += weights[corner] * data_[corners[corner]];
+    }
+    return res;
+}
+
+template <ind N>
+bool StructuredGridSampler<N>::withinBoundsDataSpace(const dvec3& pos) const {
+    return locate(pos).has_value();
+}
+
+}  // namespace discretedata
+}  // namespace inviwo
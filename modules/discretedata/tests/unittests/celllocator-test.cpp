@@ -0,0 +1,132 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/discretedata/dataset.h>
+#include <modules/discretedata/structuredgridsampler.h>
+#include <modules/discretedata/channels/analyticchannel.h>
+#include <modules/discretedata/connectivity/celllocator.h>
+#include <modules/discretedata/connectivity/periodicgrid.h>
+
+#include <cmath>
+#include <numbers>
+
+namespace inviwo {
+namespace discretedata {
+
+TEST(CellLocation, CurvilinearGrid) {
+    const std::vector<ind> size = {6, 5, 4};
+    auto grid = std::make_shared<StructuredGrid>(GridPrimitive::Volume, size);
+    const ind numVerts = grid->getNumElements(GridPrimitive::Vertex);
+
+    const auto vertexIndex = [&](ind idx) {
+        const auto index = StructuredGrid::indexFromLinear(idx, {7, 6, 5});
+        return dvec3{index[0], index[1], index[2]};
+    };
+    // Smoothly warped, but every cell stays convex.
+    AnalyticChannel<double, 3, dvec3> positions(
+        [&](dvec3& pos, ind idx) {
+            const dvec3 ijk = vertexIndex(idx);
+            pos = {ijk.x + 0.2 * std::sin(ijk.y), ijk.y + 0.1 * ijk.x,
+                   1.5 * ijk.z + 0.1 * std::sin(ijk.x + ijk.y)};
+        },
+        numVerts, "Position");
+    AnalyticChannel<double, 3, dvec3> index([&](dvec3& v, ind idx) { v = vertexIndex(idx); },
+                                            numVerts, "Index");
+
+    auto locator = std::make_shared<CellLocator<3>>(grid, positions);
+    StructuredGridSampler<3> sampler(locator, index);
+
+    const dvec3 local{0.3, 0.6, 0.2};
+    const auto weights = CellLocator<3>::getWeights(local);
+    for (ind cell = 0; cell < locator->getNumCells(); ++cell) {
+        const auto corners = locator->getCorners(cell);
+        dvec3 pos{0.0};
+        for (ind corner = 0; corner < CellLocator<3>::NumCorners; ++corner) {
+            dvec3 p;
+            positions.fill(p, corners[corner]);
+            pos += weights[corner] * p;
+        }
+
+        // Found from the hierarchy and from walking across the grid.
+        for (ind hint : {ind{-1}, ind{0}, locator->getNumCells() - 1}) {
+            const auto location = locator->locate(pos, hint);
+            ASSERT_TRUE(location.has_value());
+            EXPECT_EQ(location->cell, cell);
+            EXPECT_NEAR(location->local.x, local.x, 1e-8);
+            EXPECT_NEAR(location->local.y, local.y, 1e-8);
+            EXPECT_NEAR(location->local.z, local.z, 1e-8);
+        }
+
+        const dvec3 value = sampler.sample(pos);
+        const dvec3 expected = vertexIndex(corners[0]) + local;
+        EXPECT_NEAR(value.x, expected.x, 1e-8);
+        EXPECT_NEAR(value.y, expected.y, 1e-8);
+        EXPECT_NEAR(value.z, expected.z, 1e-8);
+    }
+
+    EXPECT_FALSE(locator->locate(dvec3{-1.0, -1.0, -1.0}).has_value());
+    EXPECT_FALSE(sampler.withinBounds(dvec3{100.0, 0.5, 0.5}));
+}
+
+TEST(CellLocation, PeriodicGrid) {
+    // An annulus, periodic in the angle. The last vertex ring coincides with the first one.
+    const ind numAngles = 16;
+    const ind numRadii = 3;
+    auto grid = std::make_shared<PeriodicGrid>(GridPrimitive::Face,
+                                               std::vector<ind>{numAngles, numRadii},
+                                               std::vector<bool>{true, false});
+    AnalyticChannel<double, 2, dvec2> positions(
+        [&](dvec2& pos, ind idx) {
+            const double angle = 2.0 * std::numbers::pi *
+                                 static_cast<double>(idx % (numAngles + 1)) /
+                                 static_cast<double>(numAngles);
+            const double radius = 1.0 + static_cast<double>(idx / (numAngles + 1));
+            pos = radius * dvec2{std::cos(angle), std::sin(angle)};
+        },
+        (numAngles + 1) * (numRadii + 1), "Position");
+    CellLocator<2> locator(grid, positions);
+
+    // Just below the seam, only reachable from cell 0 by wrapping around.
+    const double angle = -0.5 * std::numbers::pi / static_cast<double>(numAngles);
+    const auto location = locator.locate(1.5 * dvec2{std::cos(angle), std::sin(angle)}, 0);
+    ASSERT_TRUE(location.has_value());
+    EXPECT_EQ(location->cell, numAngles - 1);
+    EXPECT_NEAR(location->local.x, 0.5, 1e-8);
+
+    EXPECT_FALSE(locator.locate(dvec2{0.0}, 0).has_value());
+    EXPECT_FALSE(locator.locate(dvec2{5.0, 0.0}).has_value());
+}
+
+}  // namespace discretedata
+}  // namespace inviwo
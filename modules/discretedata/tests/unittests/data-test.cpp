@@ -148,5 +148,62 @@ TEST(CreatingCopyingIndexing, DataChannels) {
     }
 }
 
+TEST(BulkAccess, DataChannels) {
+    const ind numElements = 1000;
+
+    std::vector<float> data;
+    for (ind idx = 0; idx < numElements; ++idx) {
+        data.push_back(1.0f);
+        data.push_back(static_cast<float>(idx));
+        data.push_back(static_cast<float>(idx * idx));
+    }
+    BufferFloat buffer(data, "Buffer");
+
+    AnalyticChannel<float, 3, glm::vec3> analytic(
+        [](glm::vec3& dest, ind idx) {
+            dest = glm::vec3(1.0f, static_cast<float>(idx), static_cast<float>(idx * idx));
+        },
+        numElements, "Analytic");
+
+    AnalyticChannel<float, 3, glm::vec3> block(
+        AnalyticChannel<float, 3, glm::vec3>::BlockFunction(
+            [](glm::vec3* dest, ind start, ind count) {
+                for (ind i = 0; i < count; ++i) {
+                    const auto idx = static_cast<float>(start + i);
+                    dest[i] = glm::vec3(1.0f, idx, idx * idx);
+                }
+            }),
+        numElements, "Block");
+
+    const ind start = 10;
+    const ind count = 500;
+    for (const DataChannel<float, 3>* channel :
+         {static_cast<const DataChannel<float, 3>*>(&buffer),
+          static_cast<const DataChannel<float, 3>*>(&analytic),
+          static_cast<const DataChannel<float, 3>*>(&block)}) {
+        std::vector<glm::vec3> values(count);
+        channel->fill(values.data(), start, count);
+        for (ind i = 0; i < count; ++i) {
+            EXPECT_EQ(values[i], buffer.get<glm::vec3>(start + i)) << channel->getName();
+        }
+    }
+
+    // the iterators of analytic channels fetch blocks of values
+    ind idx = 0;
+    for (auto it = block.begin<glm::vec3>(); it != block.end<glm::vec3>(); ++it, ++idx) {
+        EXPECT_EQ(*it, buffer.get<glm::vec3>(idx));
+    }
+    EXPECT_EQ(idx, numElements);
+
+    EXPECT_EQ(buffer.view<glm::vec3>().size(), static_cast<size_t>(numElements));
+    EXPECT_EQ(buffer.view<glm::vec3>()[42], buffer.get<glm::vec3>(42));
+
+    glm::vec3 min, max;
+    block.getMinMax(min, max);
+    const float last = static_cast<float>(numElements - 1);
+    EXPECT_EQ(min, glm::vec3(1.0f, 0.0f, 0.0f));
+    EXPECT_EQ(max, glm::vec3(1.0f, last, last * last));
+}
+
 }  // namespace discretedata
 }  // namespace inviwo
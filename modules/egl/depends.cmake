@@ -0,0 +1,7 @@
+#--------------------------------------------------------------------
+# Dependencies for current module
+set(dependencies
+    InviwoOpenGLModule
+)
+
+set(aliases OpenGLSupplier)
@@ -0,0 +1,90 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/egl/eglmoduledefine.h>  // for IVW_MODULE_EGL_API
+
+#include <inviwo/core/datastructures/image/imagetypes.h>  // for LayerType
+#include <inviwo/core/util/canvas.h>                      // for Canvas::ContextID, Canvas
+
+#include <memory>  // for unique_ptr, shared_ptr
+#include <string>  // for string
+
+namespace inviwo {
+
+class Image;
+
+/**
+ * A canvas without any window, holding an OpenGL context on an EGL display and a minimal pbuffer
+ * surface. All EGL canvases share objects with the first one created. It is used for the default
+ * render context and for the contexts of background threads when running without a windowing
+ * system, images are never displayed but read back from the canvas processors.
+ * The EGL types are all opaque pointers and are stored as such here to avoid including the EGL
+ * platform headers, which pull in X11 on some platforms.
+ * @see EGLModule
+ */
+class IVW_MODULE_EGL_API CanvasEGL : public Canvas {
+public:
+    /**
+     * @throws Exception if the display has not been initialized or the context could not be
+     * created.
+     */
+    explicit CanvasEGL(const std::string& title = "Background");
+    virtual ~CanvasEGL();
+
+    virtual void render(std::shared_ptr<const Image>, LayerType layerType = LayerType::Color,
+                        size_t idx = 0) override;
+    virtual void update() override;
+    virtual void activate() override;
+
+    virtual std::unique_ptr<Canvas> createHiddenCanvas() override;
+    virtual ContextID activeContext() const override;
+    virtual ContextID contextId() const override;
+    virtual void releaseContext() override;
+
+    /**
+     * Open and initialize the EGL display used by all EGL canvases. With the
+     * EGL_EXT_device_enumeration and EGL_EXT_platform_device extensions the display of GPU
+     * @p device is used, which needs no X server. Otherwise it falls back to the default display.
+     * @throws Exception if EGL could not be initialized or has no suitable OpenGL config.
+     */
+    static void initializeDisplay(int device = 0);
+    static void terminateDisplay();
+
+private:
+    void* context_;
+    void* surface_;
+
+    static void* display_;
+    static void* config_;
+    static void* sharedContext_;
+};
+
+}  // namespace inviwo
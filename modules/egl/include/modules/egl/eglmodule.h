@@ -0,0 +1,64 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/egl/eglmoduledefine.h>  // for IVW_MODULE_EGL_API
+
+#include <inviwo/core/common/inviwomodule.h>                         // for InviwoModule
+#include <inviwo/core/network/processornetworkevaluationobserver.h>  // for ProcessorNetworkEval...
+
+#include <memory>  // for unique_ptr
+
+namespace inviwo {
+class CanvasEGL;
+class ContextHolder;
+class InviwoApplication;
+
+/**
+ * Supplies OpenGL through EGL without any windowing system, for batch rendering on machines
+ * without an X server. The GPU is selected by the environment variable INVIWO_EGL_DEVICE, an index
+ * into the EGL devices, defaulting to the first one. Canvases get no widgets, their content is
+ * read back for example with the snapshot command line argument.
+ */
+class IVW_MODULE_EGL_API EGLModule : public InviwoModule,
+                                     public ProcessorNetworkEvaluationObserver {
+public:
+    EGLModule(InviwoApplication* app);
+    virtual ~EGLModule();
+
+    virtual void onProcessorNetworkEvaluationBegin() override;
+    virtual void onProcessorNetworkEvaluationEnd() override;
+
+private:
+    ContextHolder* holder_ = nullptr;
+    std::unique_ptr<CanvasEGL> sharedCanvas_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,179 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/egl/canvasegl.h>
+
+#include <inviwo/core/common/inviwoapplication.h>  // for dispatchFront
+#include <inviwo/core/util/exception.h>            // for Exception
+#include <inviwo/core/util/logcentral.h>           // for log
+#include <inviwo/core/util/rendercontext.h>        // for CanvasContextHolder, RenderContext
+#include <inviwo/core/util/sourcecontext.h>        // for SourceContext
+
+#include <algorithm>  // for clamp
+#include <array>      // for array
+#include <future>     // for future
+
+#define EGL_NO_X11
+#include <EGL/egl.h>     // for eglMakeCurrent, eglCreateContext
+#include <EGL/eglext.h>  // for EGL_PLATFORM_DEVICE_EXT, PFNEGLQUERYDEVICESEXTPROC
+
+namespace inviwo {
+
+void* CanvasEGL::display_ = nullptr;
+void* CanvasEGL::config_ = nullptr;
+void* CanvasEGL::sharedContext_ = nullptr;
+
+namespace {
+
+EGLDisplay deviceDisplay(int device) {
+    const auto queryDevices =
+        reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+    const auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+        eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (!queryDevices || !getPlatformDisplay) return EGL_NO_DISPLAY;
+
+    std::array<EGLDeviceEXT, 16> devices{};
+    EGLint count = 0;
+    if (!queryDevices(static_cast<EGLint>(devices.size()), devices.data(), &count) || count == 0) {
+        return EGL_NO_DISPLAY;
+    }
+    const auto index = std::clamp(device, 0, count - 1);
+    if (index != device) {
+        log::warn("EGL device {} not found, using device {} of {}", device, index, count);
+    }
+    return getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, devices[index], nullptr);
+}
+
+}  // namespace
+
+void CanvasEGL::initializeDisplay(int device) {
+    if (display_) return;
+
+    EGLDisplay display = deviceDisplay(device);
+    if (display == EGL_NO_DISPLAY) display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (display == EGL_NO_DISPLAY) throw Exception(SourceContext{}, "No EGL display found");
+
+    EGLint major = 0;
+    EGLint minor = 0;
+    if (!eglInitialize(display, &major, &minor)) {
+        throw Exception(SourceContext{}, "Unable to initialize EGL (error {:#x})", eglGetError());
+    }
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        eglTerminate(display);
+        throw Exception(SourceContext{}, "EGL display does not support OpenGL");
+    }
+
+    const std::array<EGLint, 15> configAttribs = {EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                                                  EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                                                  EGL_RED_SIZE, 8,
+                                                  EGL_GREEN_SIZE, 8,
+                                                  EGL_BLUE_SIZE, 8,
+                                                  EGL_ALPHA_SIZE, 8,
+                                                  EGL_DEPTH_SIZE, 24,
+                                                  EGL_NONE};
+    EGLConfig config = nullptr;
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(display, configAttribs.data(), &config, 1, &numConfigs) ||
+        numConfigs == 0) {
+        eglTerminate(display);
+        throw Exception(SourceContext{}, "No EGL config with OpenGL pbuffer support found");
+    }
+
+    log::info("EGL {}.{} ({})", major, minor, eglQueryString(display, EGL_VENDOR));
+    display_ = display;
+    config_ = config;
+}
+
+void CanvasEGL::terminateDisplay() {
+    if (!display_) return;
+    eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglTerminate(display_);
+    display_ = nullptr;
+    config_ = nullptr;
+    sharedContext_ = nullptr;
+}
+
+CanvasEGL::CanvasEGL(const std::string& title)
+    : Canvas(), context_{EGL_NO_CONTEXT}, surface_{EGL_NO_SURFACE} {
+    if (!display_) throw Exception(SourceContext{}, "The EGL display is not initialized");
+
+    context_ = eglCreateContext(display_, config_, sharedContext_, nullptr);
+    if (context_ == EGL_NO_CONTEXT) {
+        throw Exception(SourceContext{}, "Could not create EGL context (error {:#x})",
+                        eglGetError());
+    }
+    const std::array<EGLint, 5> surfaceAttribs = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+    surface_ = eglCreatePbufferSurface(display_, config_, surfaceAttribs.data());
+    if (surface_ == EGL_NO_SURFACE) {
+        eglDestroyContext(display_, context_);
+        throw Exception(SourceContext{}, "Could not create EGL pbuffer surface (error {:#x})",
+                        eglGetError());
+    }
+
+    if (!sharedContext_) sharedContext_ = context_;
+
+    RenderContext::getPtr()->registerContext(contextId(), title,
+                                             std::make_unique<CanvasContextHolder>(this));
+}
+
+CanvasEGL::~CanvasEGL() {
+    RenderContext::getPtr()->unRegisterContext(contextId());
+    if (display_) {
+        if (eglGetCurrentContext() == context_) {
+            eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        }
+        eglDestroySurface(display_, surface_);
+        eglDestroyContext(display_, context_);
+    }
+    if (context_ == sharedContext_) sharedContext_ = nullptr;
+    RenderContext::getPtr()->activateDefaultRenderContext();
+}
+
+void CanvasEGL::render(std::shared_ptr<const Image>, LayerType, size_t) {}
+
+void CanvasEGL::update() {}
+
+void CanvasEGL::activate() { eglMakeCurrent(display_, surface_, surface_, context_); }
+
+std::unique_ptr<Canvas> CanvasEGL::createHiddenCanvas() {
+    auto res = dispatchFront([&]() { return std::make_unique<CanvasEGL>("Background"); });
+    return res.get();
+}
+
+Canvas::ContextID CanvasEGL::activeContext() const {
+    return static_cast<ContextID>(eglGetCurrentContext());
+}
+
+Canvas::ContextID CanvasEGL::contextId() const { return static_cast<ContextID>(context_); }
+
+void CanvasEGL::releaseContext() {
+    eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,113 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/egl/eglmodule.h>
+
+#include <inviwo/core/common/inviwoapplication.h>           // for InviwoApplication
+#include <inviwo/core/common/inviwomodule.h>                // for InviwoModule
+#include <inviwo/core/common/modulemanager.h>               // for ModuleManager
+#include <inviwo/core/network/processornetworkevaluator.h>  // for ProcessorNetworkEvaluator
+#include <inviwo/core/util/exception.h>                     // for ModuleInitException
+#include <inviwo/core/util/logcentral.h>                    // for log
+#include <inviwo/core/util/rendercontext.h>                 // for RenderContext, ContextHolder
+#include <inviwo/core/util/sourcecontext.h>                 // for SourceContext
+#include <modules/egl/canvasegl.h>                          // for CanvasEGL
+#include <modules/opengl/canvasgl.h>                        // for CanvasGL
+#include <modules/opengl/inviwoopengl.h>                    // for glFinish
+#include <modules/opengl/openglcapabilities.h>              // for OpenGLCapabilities
+#include <modules/opengl/sharedopenglresources.h>           // for SharedOpenGLResources
+
+#include <charconv>  // for from_chars
+#include <cstdlib>   // for getenv
+#include <cstring>   // for strlen
+
+namespace inviwo {
+
+namespace {
+
+int deviceIndex() {
+    int device = 0;
+    if (const char* env = std::getenv("INVIWO_EGL_DEVICE")) {
+        const auto [ptr, ec] = std::from_chars(env, env + std::strlen(env), device);
+        if (ec != std::errc{}) {
+            log::warn("Invalid INVIWO_EGL_DEVICE '{}', using device 0", env);
+            device = 0;
+        }
+    }
+    return device;
+}
+
+}  // namespace
+
+EGLModule::EGLModule(InviwoApplication* app) : InviwoModule(app, "EGL") {
+    if (!app->getModuleManager().getModulesByAlias("OpenGLSupplier").empty()) {
+        throw ModuleInitException(
+            "EGL could not be initialized because an other OpenGLSupplier is already used for "
+            "OpenGL context.");
+    }
+
+    try {
+        CanvasEGL::initializeDisplay(deviceIndex());
+        sharedCanvas_ = std::make_unique<CanvasEGL>(app->getDisplayName());
+    } catch (const Exception& e) {
+        CanvasEGL::terminateDisplay();
+        throw ModuleInitException(e.getMessage(), e.getContext());
+    }
+    sharedCanvas_->activate();
+    holder_ = RenderContext::getPtr()->setDefaultRenderContext(sharedCanvas_.get());
+
+    OpenGLCapabilities::initializeGLEW();
+    if (!glFenceSync) {  // Make sure we have setup the opengl function pointers.
+        throw ModuleInitException("Unable to initiate OpenGL");
+    }
+    CanvasGL::defaultGLState();
+
+    app->getProcessorNetworkEvaluator()->addObserver(this);
+}
+
+EGLModule::~EGLModule() {
+    SharedOpenGLResources::getPtr()->reset();
+    if (holder_ == RenderContext::getPtr()->getDefaultRenderContext()) {
+        RenderContext::getPtr()->setDefaultRenderContext(nullptr);
+    }
+    sharedCanvas_.reset();
+    CanvasEGL::terminateDisplay();
+}
+
+void EGLModule::onProcessorNetworkEvaluationBegin() {
+    RenderContext::getPtr()->activateDefaultRenderContext();
+}
+
+void EGLModule::onProcessorNetworkEvaluationEnd() {
+    // Nothing is displayed, but results are read back right after an evaluation, for example for
+    // snapshots, so make sure the GPU is done.
+    glFinish();
+}
+
+}  // namespace inviwo
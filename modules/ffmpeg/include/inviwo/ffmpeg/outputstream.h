@@ -40,6 +40,7 @@
 
 #include <functional>
 #include <optional>
+#include <string>
 
 extern "C" {
 #include <libavutil/avutil.h>
@@ -58,6 +59,14 @@ struct IVW_MODULE_FFMPEG_API OutputStream : NoMoveCopy {
         int height = 1080;
         int frameRate = 25;
         int64_t bitRate = 400000;
+        /// Number of encoder threads, 0 lets the codec decide
+        int threads = 0;
+        /// Name of a specific encoder to use, for example "h264_nvenc". If empty or not available
+        /// the default encoder for the codec is used.
+        std::string encoder{};
+        /// Tune the encoder for streaming: no B-frames, a key frame every second, and encoder
+        /// specific low latency settings where available.
+        bool lowLatency = false;
     };
 
     OutputStream(Format& format, Options opts);
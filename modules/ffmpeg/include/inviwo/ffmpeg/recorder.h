@@ -40,12 +40,19 @@
 #include <queue>
 #include <vector>
 #include <filesystem>
+#include <future>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
 #include <exception>
 
 namespace inviwo::ffmpeg {
 
+/**
+ * Encodes frames into a movie file in a pipeline. The calling thread only copies the image data
+ * into a frame, the color conversion to the codec pixel format is done in the thread pool, and the
+ * encoding in a separate worker thread.
+ */
 class IVW_MODULE_FFMPEG_API Recorder {
 public:
     enum class Mode { Time, Evaluation };
@@ -60,19 +67,28 @@ public:
     /**
      * Copies the image data in layer into a ffmpeg frames and enques that for encoding
      * The layer will not be used after the return of the function.
+     * In Mode::Evaluation this will block while there are maxQueueSize frames waiting to be
+     * encoded, in Mode::Time the frame is dropped instead.
      */
     void queueFrame(const LayerRAM& layer);
 
+    static constexpr size_t maxQueueSize = 30;
+
 private:
     void run();
+    Frame convert(Frame source);
+    Frame takeFrame(std::vector<Frame>& unused, enum AVPixelFormat format);
+    void recycle(Frame frame);
 
     Mode mode;
     Format out;
     OutputStream stream;
     Packet pkt;
 
-    std::queue<Frame> queue_;
+    std::queue<std::future<Frame>> queue_;
+    std::vector<Frame> unusedSource_;
     std::vector<Frame> unused_;
+    std::vector<std::unique_ptr<SwScale>> scalers_;
     std::mutex mutex_;
     std::condition_variable condition_;
     std::atomic<bool> stop_;
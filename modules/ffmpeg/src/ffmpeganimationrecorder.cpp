@@ -34,6 +34,8 @@
 
 #include <inviwo/core/util/stringconversion.h>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 #include <fmt/std.h>
 #include <fmt/chrono.h>
@@ -165,12 +167,20 @@ std::unique_ptr<animation::Recorder> FFmpegRecorderFactory::create(
     replaceInString(name, "UPN", opts.sourceName);
     file.replace_filename(name);
 
+    if (opts.part) {
+        // Number the parts by their first frame so that they sort in order
+        const auto digits =
+            std::max(fmt::formatted_size("{}", opts.expectedNumberOfFrames), size_t{4});
+        file.replace_filename(fmt::format("{}_{:0{}}{}", file.stem().string(), opts.firstFrame,
+                                          digits, file.extension().string()));
+    }
+
     if (!overwrite_ && std::filesystem::is_regular_file(file)) {
         throw Exception(SourceContext{}, "File already exists: {}", file);
     }
 
     return std::make_unique<FFmpegRecorder>(
-        file_.get(), format,
+        file, format,
         ffmpeg::OutputStream::Options{.codecId = codec_.getSelectedValue(),
                                       .width = static_cast<int>(opts.dimensions.x),
                                       .height = static_cast<int>(opts.dimensions.y),
@@ -29,11 +29,13 @@
 
 #include <inviwo/ffmpeg/ffmpegmodule.h>
 #include <inviwo/ffmpeg/processors/movieexport.h>
+#include <inviwo/ffmpeg/processors/streamingcanvas.h>
 #include <inviwo/ffmpeg/ffmpeganimationrecorder.h>
 
 #include <array>
 
 extern "C" {
+#include <libavformat/avformat.h>
 #include <libavutil/log.h>
 }
 
@@ -86,8 +88,11 @@ FFmpegModule::FFmpegModule(InviwoApplication* app)
 
     // Processors
     registerProcessor<MovieExport>();
+    registerProcessor<StreamingCanvas>();
 
     av_log_set_callback(ffmpeg_log_callback);
+    // Needed by the network protocols used by the StreamingCanvas
+    avformat_network_init();
 
     registerRecorderFactory(std::make_unique<FFmpegRecorderFactory>());
 }
@@ -35,14 +35,36 @@
 extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
+#include <libavutil/opt.h>
 #include <libswscale/swscale.h>
 }
 
+#include <string_view>
+
 namespace inviwo::ffmpeg {
 
+namespace {
+
+const AVCodec* findEncoder(const Format& format, const OutputStream::Options& opts) {
+    if (!opts.encoder.empty()) {
+        if (const auto* encoder = avcodec_find_encoder_by_name(opts.encoder.c_str())) {
+            return encoder;
+        }
+        log::warn("Could not find encoder '{}', using the default encoder", opts.encoder);
+    }
+    const CodecID codecId =
+        opts.codecId ? opts.codecId : format.outputFormat().defaultVideoCodec();
+    if (const auto* encoder = avcodec_find_encoder(codecId.id)) {
+        return encoder;
+    }
+    throw Exception(SourceContext{}, "Could not find encoder for '{}'", codecId.name());
+}
+
+}  // namespace
+
 OutputStream::OutputStream(Format& format, Options opts)
     : sourceFormat{opts.sourceFormat}
-    , codec{opts.codecId ? opts.codecId : format.outputFormat().defaultVideoCodec()}
+    , codec{findEncoder(format, opts)}
     , stream{format.newStream()}
     , tmpFrame{std::nullopt}
     , scaler{std::nullopt} {
@@ -63,6 +85,10 @@ OutputStream::OutputStream(Format& format, Options opts)
 
     codec.ctx->gop_size = 12; /* emit one intra frame every twelve frames at most */
 
+    /* let the codec use frame and/or slice threading if it supports it */
+    codec.ctx->thread_count = opts.threads;
+    codec.ctx->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
     codec.ctx->pix_fmt = AV_PIX_FMT_YUV420P;  // seems many codecs handle this one?
 
     if (codec.ctx->codec_id == AV_CODEC_ID_MPEG2VIDEO) {
@@ -78,6 +104,17 @@ OutputStream::OutputStream(Format& format, Options opts)
         codec.ctx->mb_decision = 2;
     }
 
+    if (opts.lowLatency) {
+        codec.ctx->max_b_frames = 0;
+        codec.ctx->gop_size = opts.frameRate;
+        codec.ctx->flags |= AV_CODEC_FLAG_LOW_DELAY;
+        // The private options differ between encoders, ignore the ones that do not exist
+        const bool nvenc = std::string_view{codec.ctx->codec->name}.ends_with("_nvenc");
+        if (codec.ctx->priv_data) {
+            av_opt_set(codec.ctx->priv_data, "tune", nvenc ? "ull" : "zerolatency", 0);
+        }
+    }
+
     /* Some formats want stream headers to be separate. */
     if (format.ctx->oformat->flags & AVFMT_GLOBALHEADER) {
         codec.ctx->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
@@ -0,0 +1,164 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/ffmpeg/processors/streamingcanvas.h>
+
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/interaction/events/resizeevent.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <inviwo/ffmpeg/outputstream.h>
+#include <inviwo/ffmpeg/wrap/outputformat.h>
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+}
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo StreamingCanvas::processorInfo_{
+    "org.inviwo.StreamingCanvas",                // Class identifier
+    "Streaming Canvas",                          // Display name
+    "Data Output",                               // Category
+    CodeState::Experimental,                     // Code state
+    Tags::CPU | Tag("Export") | Tag("FFmpeg"),  // Tags
+    R"(Streams the input image as a live video over the network.
+    The default address sends a mpegts stream over udp to the local host, it can be viewed using
+    for example `ffplay -fflags nobuffer udp://127.0.0.1:8090`. Frames are encoded in time mode,
+    the last image is repeated at the given frame rate and new images are dropped if the encoder
+    can not keep up. Note that a tcp address with `listen=1` will block the encoder until a client
+    connects.)"_unindentHelp};
+
+const ProcessorInfo& StreamingCanvas::getProcessorInfo() const { return processorInfo_; }
+
+StreamingCanvas::StreamingCanvas()
+    : Processor{}
+    , inport_{"inport", "Image to stream"_help}
+    , url_{"url", "URL",
+           "Address to stream to, any ffmpeg protocol like tcp, udp, or srt can be used"_help,
+           "udp://127.0.0.1:8090?pkt_size=1316"}
+    , format_{"format", "Format",
+              "Short name of the container format, mpegts works with most protocols"_help,
+              "mpegts"}
+    , encoder_{"encoder",
+               "Encoder",
+               "Video encoder, falls back to the default encoder if not available"_help,
+               {{"h264_nvenc", "NVENC H.264", "h264_nvenc"},
+                {"hevc_nvenc", "NVENC HEVC", "hevc_nvenc"},
+                {"libx264", "x264", "libx264"},
+                {"default", "Default", ""}},
+               0}
+    , dimensions_{"dimensions",
+                  "Dimensions",
+                  "The size of the streamed video"_help,
+                  size2_t(1280, 720),
+                  {size2_t(16, 16), ConstraintBehavior::Immutable},
+                  {size2_t(8192, 8192), ConstraintBehavior::Ignore},
+                  size2_t(2, 2),
+                  InvalidationLevel::Valid}
+    , frameRate_{"frameRate", "Frame Rate",
+                 util::ordinalCount<int>(30, 120).setMin(1).set(
+                     "How many frames to stream per second"_help)}
+    , bitRate_{"bitRate", "Bit Rate",
+               util::ordinalCount<int>(8'000'000, 100'000'000)
+                   .setMin(100'000)
+                   .set("How many bits to spend per second"_help)}
+    , start_{"start", "Start"}
+    , stop_{"stop", "Stop"}
+    , previousDimensions_{dimensions_} {
+
+    addPorts(inport_);
+    addProperties(url_, format_, encoder_, dimensions_, frameRate_, bitRate_, start_, stop_);
+
+    dimensions_.onChange([this]() { resizeSource(); });
+    inport_.onConnect([this]() { resizeSource(); });
+}
+
+StreamingCanvas::~StreamingCanvas() = default;
+
+void StreamingCanvas::resizeSource() {
+    ResizeEvent resizeEvent{dimensions_, previousDimensions_};
+    previousDimensions_ = dimensions_;
+    inport_.propagateEvent(&resizeEvent);
+}
+
+void StreamingCanvas::process() {
+    auto img = inport_.getData();
+    const auto dims = img->getDimensions();
+
+    // The encoder has a fixed size, restart the stream when the input size changes
+    const auto* ctx = recorder ? recorder->getStream().codec.ctx : nullptr;
+    const bool resized = ctx && size2_t(ctx->width, ctx->height) != dims;
+
+    if (start_.isModified() || resized) {
+        recorder.reset();
+        try {
+            recorder = std::make_unique<ffmpeg::Recorder>(
+                url_.get(), ffmpeg::OutputFormat(format_.get()), ffmpeg::Recorder::Mode::Time,
+                ffmpeg::OutputStream::Options{.width = static_cast<int>(dims.x),
+                                              .height = static_cast<int>(dims.y),
+                                              .frameRate = frameRate_,
+                                              .bitRate = bitRate_,
+                                              .encoder = encoder_.getSelectedValue(),
+                                              .lowLatency = true});
+        } catch (const Exception& e) {
+            log::exception(e);
+            return;
+        }
+
+        if (!resized) notifyObserversStartBackgroundWork(this, 1);
+
+        log::info("Streaming to: {}", url_.get());
+        log::info("  - Format:   {}", recorder->getFormat().outputFormat().desc());
+        log::info("  - Encoder:  {}", recorder->getStream().codec.ctx->codec->name);
+    }
+
+    if (recorder) {
+        try {
+            recorder->queueFrame(*img->getColorLayer()->getRepresentation<LayerRAM>());
+        } catch (const Exception& e) {
+            log::exception(e);
+            recorder.reset();
+        } catch (const std::exception& e) {
+            log::exception(e);
+            recorder.reset();
+        } catch (...) {
+            log::exception();
+            recorder.reset();
+        }
+    }
+
+    if (stop_.isModified()) {
+        recorder.reset();
+        notifyObserversFinishBackgroundWork(this, 1);
+    }
+}
+
+}  // namespace inviwo
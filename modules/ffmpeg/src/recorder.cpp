@@ -33,10 +33,14 @@
 #include <inviwo/core/util/logcentral.h>
 #include <inviwo/core/util/indexmapper.h>
 
+#include <chrono>
+#include <optional>
+
 extern "C" {
 
 #include <libavformat/avformat.h>
 #include <libavcodec/avcodec.h>
+#include <libswscale/swscale.h>
 }
 
 namespace inviwo::ffmpeg {
@@ -96,6 +100,11 @@ Recorder::~Recorder() {
     stop_ = true;
     condition_.notify_all();
     worker.join();
+    // Wait for any conversions still running in the thread pool, they refer to this
+    while (!queue_.empty()) {
+        queue_.front().wait();
+        queue_.pop();
+    }
     if (eptr) {
         std::rethrow_exception(eptr);
     }
@@ -105,67 +114,132 @@ const OutputStream& Recorder::getStream() { return stream; }
 const Format& Recorder::getFormat() { return out; }
 
 void Recorder::queueFrame(const LayerRAM& layer) {
-    std::optional<Frame> frame;
+    std::optional<Frame> source;
     {
         std::unique_lock<std::mutex> lock(mutex_);
 
+        if (mode == Mode::Evaluation) {
+            condition_.wait(lock, [&]() { return eptr || queue_.size() < maxQueueSize; });
+        }
+
         if (eptr) {
             std::rethrow_exception(std::exchange(eptr, nullptr));
         }
 
-        if (!unused_.empty()) {
-            frame.emplace(std::move(unused_.back()));
-            unused_.pop_back();
-        } else if (queue_.size() < 30) {
-            frame.emplace(stream.codec.ctx->pix_fmt, stream.codec.ctx->width,
-                          stream.codec.ctx->height);
+        if (queue_.size() < maxQueueSize) {
+            source.emplace(takeFrame(unusedSource_, stream.sourceFormat));
         } else {
             log::info("Queue saturated");
         }
     }
 
-    if (frame) {
+    if (source) {
+        const int width = stream.codec.ctx->width;
+        const int height = stream.codec.ctx->height;
+        if (static_cast<int>(layer.getDimensions().x) != width ||
+            static_cast<int>(layer.getDimensions().y) != height) {
+            throw inviwo::Exception(SourceContext{},
+                                    "Video dimensions do not match, expected: {}x{} got: {}x{}",
+                                    width, height, layer.getDimensions().x,
+                                    layer.getDimensions().y);
+        }
+
+        // when we pass a frame to the encoder, it may keep a reference to it internally; make
+        // sure we do not overwrite it here
+        source->makeWritable();
+        auto* pict = source->frame;
+
         // this requires that .sourceFormat = AV_PIX_FMT_RGBA,
-        stream.fillFrame(*frame, [&](AVFrame* pict, int width, int height) {
-            if (static_cast<int>(layer.getDimensions().x) != width ||
-                static_cast<int>(layer.getDimensions().y) != height) {
-                throw inviwo::Exception(
-                    SourceContext{}, "Video dimensions do not match, expected: {}x{} got: {}x{}",
-                    width, height, layer.getDimensions().x, layer.getDimensions().y);
+        if (layer.getDataFormat()->getId() == DataFormatId::Vec4UInt8) {
+            auto* data = static_cast<const glm::tvec4<uint8_t>*>(layer.getData());
+            util::IndexMapper2D im{layer.getDimensions()};
+
+            for (int y = 0; y < height; y++) {
+                auto rowStart = glm::value_ptr(data[im(0, y)]);
+                std::copy(rowStart, rowStart + 4 * width,
+                          &pict->data[0][(height - y - 1) * pict->linesize[0]]);
             }
-
-            if (layer.getDataFormat()->getId() == DataFormatId::Vec4UInt8) {
-                auto* data = static_cast<const glm::tvec4<uint8_t>*>(layer.getData());
-                util::IndexMapper2D im{layer.getDimensions()};
+        } else {
+            layer.dispatch<void>([&](auto* rep) {
+                auto* data = rep->getDataTyped();
+                util::IndexMapper2D im{rep->getDimensions()};
 
                 for (int y = 0; y < height; y++) {
-                    auto rowStart = glm::value_ptr(data[im(0, y)]);
-                    std::copy(rowStart, rowStart + 4 * width,
-                              &pict->data[0][(height - y - 1) * pict->linesize[0]]);
-                }
-            } else {
-                layer.dispatch<void>([&](auto* rep) {
-                    auto* data = rep->getDataTyped();
-                    util::IndexMapper2D im{rep->getDimensions()};
-
-                    for (int y = 0; y < height; y++) {
-                        for (int x = 0; x < width; x++) {
-                            auto pix =
-                                util::glm_convert_normalized<glm::tvec4<uint8_t>>(data[im(x, y)]);
-                            std::copy(glm::value_ptr(pix), glm::value_ptr(pix) + 4,
-                                      &pict->data[0][(height - y - 1) * pict->linesize[0] + x * 4]);
-                        }
+                    for (int x = 0; x < width; x++) {
+                        auto pix =
+                            util::glm_convert_normalized<glm::tvec4<uint8_t>>(data[im(x, y)]);
+                        std::copy(glm::value_ptr(pix), glm::value_ptr(pix) + 4,
+                                  &pict->data[0][(height - y - 1) * pict->linesize[0] + x * 4]);
                     }
-                });
-            }
-        });
+                }
+            });
+        }
+
+        // The color conversion runs in the thread pool, the futures are queued in order so the
+        // worker encodes the frames in the order they were queued.
+        auto converted = util::dispatchPool(
+            [this, frame = std::move(*source)]() mutable { return convert(std::move(frame)); });
 
         {
             std::unique_lock<std::mutex> lock(mutex_);
-            queue_.push(std::move(*frame));
+            queue_.push(std::move(converted));
         }
     }
-    condition_.notify_one();
+    condition_.notify_all();
+}
+
+Frame Recorder::convert(Frame source) {
+    if (stream.codec.ctx->pix_fmt == stream.sourceFormat) {
+        return source;
+    }
+
+    std::unique_ptr<SwScale> scaler;
+    Frame dst;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!scalers_.empty()) {
+            scaler = std::move(scalers_.back());
+            scalers_.pop_back();
+        }
+        dst = takeFrame(unused_, stream.codec.ctx->pix_fmt);
+    }
+    if (!scaler) {
+        // Each concurrent conversion needs its own context
+        scaler = std::make_unique<SwScale>(stream.codec.ctx->width, stream.codec.ctx->height,
+                                           stream.sourceFormat, stream.codec.ctx->width,
+                                           stream.codec.ctx->height, stream.codec.ctx->pix_fmt,
+                                           SWS_BICUBIC, nullptr, nullptr, nullptr);
+    }
+
+    dst.makeWritable();
+    scaler->scale(source.frame->data, source.frame->linesize, 0, stream.codec.ctx->height,
+                  dst.frame->data, dst.frame->linesize);
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        scalers_.push_back(std::move(scaler));
+        unusedSource_.push_back(std::move(source));
+    }
+    return dst;
+}
+
+Frame Recorder::takeFrame(std::vector<Frame>& unused, enum AVPixelFormat format) {
+    if (!unused.empty()) {
+        auto frame = std::move(unused.back());
+        unused.pop_back();
+        return frame;
+    }
+    return Frame{format, stream.codec.ctx->width, stream.codec.ctx->height};
+}
+
+void Recorder::recycle(Frame frame) {
+    if (!frame) return;
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (frame.frame->format == stream.sourceFormat) {
+        unusedSource_.push_back(std::move(frame));
+    } else {
+        unused_.push_back(std::move(frame));
+    }
 }
 
 void Recorder::run() {
@@ -194,43 +268,56 @@ void Recorder::run() {
 
         const auto start = clock::now();
 
+        const auto isReady = [](const std::future<Frame>& f) {
+            return f.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+        };
+
         if (mode == Mode::Time) {
             const std::chrono::microseconds frameTime{1'000'000 / frameRate};
 
             auto next = start;
 
             while (!stop_) {
+                std::optional<std::future<Frame>> converted;
                 {
                     std::unique_lock<std::mutex> lock(mutex_);
                     condition_.wait_until(lock, next, [&]() {
-                        return stop_ || !queue_.empty() || clock::now() > next;
+                        return stop_ || (!queue_.empty() && isReady(queue_.front())) ||
+                               clock::now() > next;
                     });
 
-                    if (!queue_.empty()) {
-                        if (frame) unused_.emplace_back(std::move(frame));
-                        frame = std::move(queue_.front());
+                    if (!queue_.empty() && isReady(queue_.front())) {
+                        converted.emplace(std::move(queue_.front()));
                         queue_.pop();
                     }
                 }
+                condition_.notify_all();
 
-                frame.frame->pts = frameCount++;
-                writeFrame(out, stream.codec, stream.stream, frame, pkt);
+                if (converted) {
+                    recycle(std::exchange(frame, converted->get()));
+                }
+                if (frame) {
+                    frame.frame->pts = frameCount++;
+                    writeFrame(out, stream.codec, stream.stream, frame, pkt);
+                }
                 next += frameTime;
             }
 
         } else if (mode == Mode::Evaluation) {
-            while (!stop_) {
+            // Encode all the queued frames, also the ones queued before we were stopped
+            while (true) {
+                std::future<Frame> converted;
                 {
                     std::unique_lock<std::mutex> lock(mutex_);
                     condition_.wait(lock, [&]() { return stop_ || !queue_.empty(); });
 
-                    if (!queue_.empty()) {
-                        if (frame) unused_.emplace_back(std::move(frame));
-                        frame = std::move(queue_.front());
-                        queue_.pop();
-                    }
+                    if (queue_.empty()) break;
+                    converted = std::move(queue_.front());
+                    queue_.pop();
                 }
+                condition_.notify_all();
 
+                recycle(std::exchange(frame, converted.get()));
                 frame.frame->pts = frameCount++;
                 writeFrame(out, stream.codec, stream.stream, frame, pkt);
             }
@@ -249,6 +336,7 @@ void Recorder::run() {
     } catch (...) {
         std::unique_lock<std::mutex> lock(mutex_);
         eptr = std::current_exception();
+        condition_.notify_all();
     }
 }
 
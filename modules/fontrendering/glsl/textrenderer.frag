@@ -28,12 +28,20 @@
  *********************************************************************************/
 
 uniform sampler2D tex;
-uniform vec4 color = vec4(0, 0, 0, 1);
+// the glyph atlas holds signed distances instead of coverage, with the glyph edge at 0.5
+uniform bool distanceField = false;
 
 in vec2 texCoord;
+in vec4 color;
 
 void main(void) {
-    vec4 dst = vec4(texture(tex, texCoord).r) * color;
+    float value = texture(tex, texCoord).r;
+    if (distanceField) {
+        // anti-alias the edge over about one pixel in screen space
+        float width = max(0.7 * fwidth(value), 1.0e-4);
+        value = smoothstep(0.5 - width, 0.5 + width, value);
+    }
+    vec4 dst = vec4(value) * color;
     FragData0 = dst;
     PickingData = vec4(0.0);
     gl_FragDepth = 0.0;
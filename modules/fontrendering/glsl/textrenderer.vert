@@ -28,15 +28,13 @@
  *********************************************************************************/
 #include "utils/structs.glsl"
 
-uniform GeometryParameters geometry_;
-uniform mat4 texCoordTransform = mat4(1);
-
 out vec2 texCoord;
+out vec4 color;
 
 void main(void) {
-// transform input coords from [-1,1] to [0,1]
-    vec4 vertex = vec4(in_Vertex.xyz * 0.5 + 0.5, in_Vertex.w);
-    // move vertices to screen coords
-    gl_Position = geometry_.dataToWorld * vertex;
-    texCoord = (texCoordTransform * vec4(in_TexCoord, 1.0)).xy;
+    // vertices are given in normalized device coordinates and the texture coordinates refer to
+    // the glyph atlas, all glyphs of a batch are rendered with a single draw call
+    gl_Position = in_Vertex;
+    texCoord = in_TexCoord.xy;
+    color = in_Color;
 }
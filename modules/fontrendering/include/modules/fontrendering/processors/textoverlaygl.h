@@ -93,6 +93,7 @@ private:
 
     TextRenderer textRenderer_;
     std::vector<TextTextureObject> textObjects_;
+    std::vector<std::string> renderedTexts_;  ///< The text in each of the textObjects_
     TextureQuadRenderer textureRenderer_;
 };
 
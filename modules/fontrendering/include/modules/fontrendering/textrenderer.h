@@ -31,7 +31,9 @@
 
 #include <modules/fontrendering/fontrenderingmoduledefine.h>  // for IVW_MODULE_FONTRENDERI...
 
+#include <inviwo/core/datastructures/buffer/buffer.h>              // for Buffer
 #include <inviwo/core/util/glmvec.h>                               // for vec4, ivec2, size2_t
+#include <inviwo/core/util/transparentmaps.h>                      // for UnorderedStringMap
 #include <modules/fontrendering/datastructures/textboundingbox.h>  // for TextBoundingBox
 #include <modules/fontrendering/util/fontutils.h>                  // for getFont, FontType, Fon...
 #include <modules/opengl/buffer/framebufferobject.h>               // for FrameBufferObject
@@ -56,6 +58,7 @@ typedef struct FT_FaceRec_* FT_Face;
 namespace inviwo {
 
 class FontSettings;
+class Mesh;
 class Shader;
 struct TexAtlasEntry;
 class Texture2D;
@@ -111,9 +114,19 @@ struct TextTextureObject {
  * ──────────────────────────────────────────────────────────────── Top line (of subsequent line)
  * \endverbatim
  *
+ * By default glyphs are rasterized into a bitmap atlas for each font size. With
+ * Rasterization::DistanceField the glyphs are instead stored once as signed distance fields at a
+ * fixed base size, and the same atlas is used for all font sizes and shared by all text renderers.
+ * The glyph edges then stay sharp when the text is rendered at large or continuously changing
+ * sizes, at the cost of slightly rounder corners at small sizes.
  */
 class IVW_MODULE_FONTRENDERING_API TextRenderer {
 public:
+    enum class Rasterization {
+        Bitmap,        //!< coverage bitmaps rasterized for each font size (default)
+        DistanceField  //!< size independent signed distance fields, shared between renderers
+    };
+
     TextRenderer(const std::filesystem::path& fontPath = font::getFont(font::FontType::Default,
                                                                        font::FullPath::Yes));
     TextRenderer(const TextRenderer& rhs) = delete;
@@ -250,6 +263,13 @@ public:
     void setFontSize(int val);
     int getFontSize() const { return fontSize_; }
 
+    /**
+     * \brief select how glyphs are rasterized into the glyph atlas
+     * \see Rasterization
+     */
+    void setRasterization(Rasterization rasterization);
+    Rasterization getRasterization() const { return rasterization_; }
+
     /**
      * \brief sets the line spacing relative to the font size (default 0.2 = 20%)
      *
@@ -299,6 +319,22 @@ protected:
         std::tuple<std::string, std::string, int>;  // holds font family, style, and size
     using GlyphMap = std::map<unsigned int, GlyphEntry>;
 
+    struct GlyphQuad {
+        ivec2 pos;          //!< top-left corner relative to the pen origin, y pointing down
+        ivec2 size;         //!< size in pixel
+        ivec2 texAtlasPos;  //!< position in texture atlas
+        ivec2 texSize;      //!< size in texture atlas, differs from size for distance fields
+    };
+
+    /**
+     * The glyph quads and bounding box of a string, only depends on the font and line height
+     * so it can be reused for every render call of the same string.
+     */
+    struct TextLayout {
+        TextBoundingBox bbox;
+        std::vector<GlyphQuad> quads;
+    };
+
     struct FontCache {
         std::shared_ptr<Texture2D> glyphTex;
         GlyphMap glyphMap;
@@ -308,6 +344,12 @@ protected:
         std::vector<int> lineHeights;
     };
 
+    // cached layouts of recently used strings for the line height below
+    struct LayoutCache {
+        UnorderedStringMap<TextLayout> layouts;
+        int lineHeight = 0;
+    };
+
     double getFontAscender() const;
     double getFontDescender() const;
 
@@ -326,29 +368,75 @@ protected:
 
     void uploadGlyph(FontCache& fc, unsigned int glyph);
 
+    /**
+     * \brief load and render the glyph into the glyph slot of the font face, either as bitmap at
+     * the current font size or as distance field at the base size
+     */
+    bool loadGlyph(unsigned int glyph);
+
+    /**
+     * \brief scale the metrics of a distance field glyph from the base size to the font size
+     */
+    GlyphEntry scaleGlyph(const GlyphEntry& glyph) const;
+
     FontCache& getFontCache();
 
+    /**
+     * \brief get the layout of the given string using the glyphs of the font cache, it will be
+     * created if it is not cached yet.
+     */
+    const TextLayout& getLayout(FontCache& fc, std::string_view str);
+    TextLayout createLayout(FontCache& fc, std::string_view str);
+
+    /**
+     * \brief add the quads of the layout to the batch using the given pen position and scaling
+     * from pixel to normalized device coordinates.
+     */
+    void addToBatch(const TextLayout& layout, const vec2& posf, const vec2& scaling,
+                    const vec2& texDims, const vec4& color);
+    /**
+     * \brief render all quads added to the batch with a single draw call and clear the batch
+     */
+    void renderBatch(FontCache& fc);
+
     void createDefaultGlyphAtlas();
     std::shared_ptr<Texture2D> createAtlasTexture(FontCache& fc);
 
     FontFamilyStyle getFontTuple() const;
+    /**
+     * \brief the key of the glyph atlas, equal to the font tuple for bitmaps and with a size of 0
+     * for the size independent distance fields
+     */
+    FontFamilyStyle getAtlasKey() const;
+
+    static std::unordered_map<FontFamilyStyle, std::weak_ptr<FontCache>>& sharedDistanceFields();
 
     std::string_view::const_iterator validateString(std::string_view str) const;
 
     static constexpr char lf = '\n';   // Line Feed Ascii for std::endl, \n
     static constexpr char tab = '\t';  // Tab Ascii
 
-    std::unordered_map<FontFamilyStyle, FontCache> glyphAtlas_;
+    std::unordered_map<FontFamilyStyle, std::shared_ptr<FontCache>> glyphAtlas_;
+    std::unordered_map<FontFamilyStyle, LayoutCache> layouts_;
 
     FT_Library fontlib_;
     FT_Face fontface_;
 
     int fontSize_;        //<! font size in pixel
     double lineSpacing_;  //!< spacing between two lines in percent (default = 0.2)
+    Rasterization rasterization_;
 
     static constexpr int glyphMargin_ = 2;  //<! margin around glyphs in font cache
+    static constexpr size_t maxCachedLayouts_ = 4096;  //<! max number of layouts per font cache
+    static constexpr int distanceFieldSize_ = 64;      //<! base font size of distance fields
     std::shared_ptr<Shader> shader_;
 
+    // batch of glyph quads, two triangles per glyph
+    std::shared_ptr<Buffer<vec2>> batchPositions_;
+    std::shared_ptr<Buffer<vec2>> batchTexCoords_;
+    std::shared_ptr<Buffer<vec4>> batchColors_;
+    std::shared_ptr<Mesh> batch_;
+
     FrameBufferObject fbo_;
     std::shared_ptr<Texture2D>
         currTexture_;  //<! 2D texture handle which was used previously in renderToTexture()
@@ -197,6 +197,9 @@ void TextOverlayGL::updateCache() {
     textRenderer_.setFontSize(font_.fontSize_.get());
     textRenderer_.setLineSpacing(font_.lineSpacing_.get());
 
+    // Only texts that changed have to be rendered again, unless the appearance changed
+    const bool renderAll = color_.isModified() || font_.isModified();
+
     auto store = fmt::dynamic_format_arg_store<fmt::format_context>();
     for (auto item : args_) {
         if (auto sp = dynamic_cast<const StringProperty*>(item)) {
@@ -209,7 +212,8 @@ void TextOverlayGL::updateCache() {
     }
 
     textObjects_.resize(texts_.size());
-    for (auto&& [item, tex] : util::zip(texts_, textObjects_)) {
+    renderedTexts_.resize(texts_.size());
+    for (auto&& [item, tex, rendered] : util::zip(texts_, textObjects_, renderedTexts_)) {
         if (auto tp = dynamic_cast<const TextOverlayProperty*>(item)) {
             std::string text;
             try {
@@ -221,7 +225,9 @@ void TextOverlayGL::updateCache() {
                     tp->getPath(), tp->text.get());
                 text = "<Invalid Format!>";
             }
+            if (!renderAll && tex.texture && text == rendered) continue;
             tex = util::createTextTextureObject(textRenderer_, text, color_.get(), tex.texture);
+            rendered = std::move(text);
         }
     }
 }
@@ -30,13 +30,14 @@
 
 #include <modules/fontrendering/textrenderer.h>
 
-#include <inviwo/core/datastructures/camera/camera.h>  // for mat4
-#include <inviwo/core/util/exception.h>                // for Exception, FileException
-#include <inviwo/core/util/glmvec.h>                   // for ivec2, vec2, size2_t
-#include <inviwo/core/util/logcentral.h>               // for LogCentral
-#include <inviwo/core/util/sourcecontext.h>            // for SourceContext
-#include <inviwo/core/util/stdextensions.h>            // for hash
-#include <inviwo/core/util/zip.h>                      // for get, zip, zipIterator
+#include <inviwo/core/datastructures/buffer/bufferram.h>  // for BufferRAMPrecision
+#include <inviwo/core/datastructures/geometry/mesh.h>     // for Mesh
+#include <inviwo/core/util/exception.h>                   // for Exception, FileException
+#include <inviwo/core/util/glmvec.h>                      // for ivec2, vec2, size2_t
+#include <inviwo/core/util/logcentral.h>                  // for LogCentral
+#include <inviwo/core/util/sourcecontext.h>               // for SourceContext
+#include <inviwo/core/util/stdextensions.h>               // for hash
+#include <inviwo/core/util/zip.h>                         // for get, zip, zipIterator
 #include <inviwo/core/util/safecstr.h>
 #include <modules/fontrendering/datastructures/fontsettings.h>     // for FontSettings
 #include <modules/fontrendering/datastructures/texatlasentry.h>    // for TexAtlasEntry
@@ -46,7 +47,6 @@
 #include <modules/opengl/inviwoopengl.h>                           // for glTexSubImage2D, GL_RED
 #include <modules/opengl/openglutils.h>                            // for ViewportState, DepthMa...
 #include <modules/opengl/shader/shader.h>                          // for Shader
-#include <modules/opengl/sharedopenglresources.h>                  // for SharedOpenGLResources
 #include <modules/opengl/texture/texture2d.h>                      // for Texture2D
 #include <modules/opengl/texture/textureunit.h>                    // for TextureUnit
 
@@ -59,18 +59,14 @@
 #include <string_view>  // for string_view
 #include <type_traits>  // for remove_extent_t, is_co...
 
-#include <freetype/freetype.h>           // for FT_FaceRec_, FT_GlyphS...
-#include <freetype/fterrors.h>           // for FT_Err_Unknown_File_Fo...
-#include <freetype/ftimage.h>            // for FT_Bitmap, FT_Vector
-#include <glm/common.hpp>                // for max, min
-#include <glm/detail/setup.hpp>          // for size_t
-#include <glm/ext/matrix_transform.hpp>  // for scale, translate
-#include <glm/gtx/transform.hpp>         // for scale, translate
-#include <glm/mat4x4.hpp>                // for operator*, mat
-#include <glm/vec3.hpp>                  // for vec<>::(anonymous)
-#include <glm/vec4.hpp>                  // for operator*, operator+
-#include <utf8cpp/utf8/checked.h>        // for iterator
-#include <utf8cpp/utf8/core.h>           // for find_invalid
+#include <freetype/freetype.h>     // for FT_FaceRec_, FT_GlyphS...
+#include <freetype/fterrors.h>     // for FT_Err_Unknown_File_Fo...
+#include <freetype/ftimage.h>      // for FT_Bitmap, FT_Vector
+#include <glm/common.hpp>          // for max, min, round
+#include <glm/detail/setup.hpp>    // for size_t
+#include <glm/vec4.hpp>            // for operator*, operator+
+#include <utf8cpp/utf8/checked.h>  // for iterator
+#include <utf8cpp/utf8/core.h>     // for find_invalid
 
 #include <fmt/std.h>
 
@@ -80,7 +76,19 @@
 namespace inviwo {
 
 TextRenderer::TextRenderer(const std::filesystem::path& fontPath)
-    : fontface_(nullptr), fontSize_(10), lineSpacing_(0.2), shader_{getShader()} {
+    : fontface_(nullptr)
+    , fontSize_(10)
+    , lineSpacing_(0.2)
+    , rasterization_(Rasterization::Bitmap)
+    , shader_{getShader()}
+    , batchPositions_{std::make_shared<Buffer<vec2>>()}
+    , batchTexCoords_{std::make_shared<Buffer<vec2>>()}
+    , batchColors_{std::make_shared<Buffer<vec4>>()}
+    , batch_{std::make_shared<Mesh>()} {
+
+    batch_->addBuffer(BufferType::PositionAttrib, batchPositions_);
+    batch_->addBuffer(BufferType::TexCoordAttrib, batchTexCoords_);
+    batch_->addBuffer(BufferType::ColorAttrib, batchColors_);
 
     if (FT_Init_FreeType(&fontlib_)) {
         throw Exception("Could not initialize FreeType library");
@@ -95,11 +103,17 @@ TextRenderer::TextRenderer(const std::filesystem::path& fontPath)
 
 TextRenderer::TextRenderer(TextRenderer&& rhs) noexcept
     : glyphAtlas_(std::move(rhs.glyphAtlas_))
+    , layouts_(std::move(rhs.layouts_))
     , fontlib_(rhs.fontlib_)
     , fontface_(rhs.fontface_)
     , fontSize_(rhs.fontSize_)
     , lineSpacing_(rhs.lineSpacing_)
+    , rasterization_(rhs.rasterization_)
     , shader_(std::move(rhs.shader_))
+    , batchPositions_(std::move(rhs.batchPositions_))
+    , batchTexCoords_(std::move(rhs.batchTexCoords_))
+    , batchColors_(std::move(rhs.batchColors_))
+    , batch_(std::move(rhs.batch_))
     , fbo_(std::move(rhs.fbo_))
     , currTexture_(std::move(rhs.currTexture_)) {
     rhs.fontlib_ = nullptr;
@@ -113,11 +127,17 @@ TextRenderer& TextRenderer::operator=(TextRenderer&& rhs) noexcept {
         }
 
         glyphAtlas_ = std::move(rhs.glyphAtlas_);
+        layouts_ = std::move(rhs.layouts_);
         fontlib_ = rhs.fontlib_;
         fontface_ = rhs.fontface_;
         fontSize_ = rhs.fontSize_;
         lineSpacing_ = rhs.lineSpacing_;
+        rasterization_ = rhs.rasterization_;
         shader_ = std::move(rhs.shader_);
+        batchPositions_ = std::move(rhs.batchPositions_);
+        batchTexCoords_ = std::move(rhs.batchTexCoords_);
+        batchColors_ = std::move(rhs.batchColors_);
+        batch_ = std::move(rhs.batch_);
         fbo_ = std::move(rhs.fbo_);
         currTexture_ = std::move(rhs.currTexture_);
 
@@ -164,8 +184,37 @@ std::string_view::const_iterator TextRenderer::validateString(std::string_view s
 TextBoundingBox TextRenderer::computeBoundingBox(std::string_view str) {
     if (str.empty()) return {};  // empty string, return empty bounding box
 
+    return getLayout(getFontCache(), str).bbox;
+}
+
+const TextRenderer::TextLayout& TextRenderer::getLayout(FontCache& fc, std::string_view str) {
+    // the layouts are kept per font size, since distance field font caches serve all sizes
+    auto& lc = layouts_[getFontTuple()];
+
+    // the layouts depend on the line height, which is not part of the key
+    if (lc.lineHeight != getLineHeight()) {
+        lc.layouts.clear();
+        lc.lineHeight = getLineHeight();
+    }
+
+    if (auto it = lc.layouts.find(str); it != lc.layouts.end()) {
+        return it->second;
+    }
+    if (lc.layouts.size() >= maxCachedLayouts_) {
+        lc.layouts.clear();
+    }
+    return lc.layouts.emplace(std::string{str}, createLayout(fc, str)).first->second;
+}
+
+TextRenderer::TextLayout TextRenderer::createLayout(FontCache& fc, std::string_view str) {
+    if (str.empty()) return {};
+
+    TextLayout layout;
+
     // the pen position defines where the current glyph is positioned
     ivec2 penPos(0, getBaseLineOffset());
+    // the pen position used for the quads, relative to the origin of the first baseline
+    ivec2 glyphPos{0};
 
     // textual bounding box contains at least one line, calculate height of first line
     // For most fonts descender is negative (see FreeType documentation for details)
@@ -176,8 +225,6 @@ TextBoundingBox TextRenderer::computeBoundingBox(std::string_view str) {
     ivec2 glyphsTopLeft(std::numeric_limits<int>::max(), getBaseLineOffset());
     ivec2 glyphsBottomRight(std::numeric_limits<int>::min());
 
-    auto& fc = getFontCache();
-
     // the vertical offset is increased for each additional line
     int verticalOffset = 0;
 
@@ -193,20 +240,26 @@ TextBoundingBox TextRenderer::computeBoundingBox(std::string_view str) {
         if (!p.first) {
             // glyph not found, skip it
             penPos += p.second.advance;
+            glyphPos += p.second.advance;
             continue;
         }
 
-        GlyphEntry& glyph = p.second;
+        const GlyphEntry glyph =
+            rasterization_ == Rasterization::DistanceField ? scaleGlyph(p.second) : p.second;
 
         if (charCode == lf) {
             verticalOffset += getLineHeight();
             // reset pen position to begin of the next line
             penPos.x = 0;
             penPos.y += glyph.advance.y;
+            glyphPos.x = 0;
+            glyphPos.y += glyph.advance.y;
             continue;
         } else if (charCode == tab) {
             penPos += glyph.advance;
             penPos.x += (4 * glyph.size.x);  // 4 times glyph character width
+            glyphPos += glyph.advance;
+            glyphPos.x += (4 * glyph.size.x);
 
             glyphsBottomRight.x = std::max(glyphsBottomRight.x, penPos.x);
             textBoxExtent.x = std::max(textBoxExtent.x, penPos.x);
@@ -220,8 +273,13 @@ TextBoundingBox TextRenderer::computeBoundingBox(std::string_view str) {
         glyphsTopLeft = glm::min(glyphsTopLeft, pos);
         glyphsBottomRight = glm::max(glyphsBottomRight, pos + glyph.size);
 
+        layout.quads.push_back(
+            {ivec2(glyphPos.x + glyph.bearing.x, verticalOffset - glyphPos.y - glyph.bearing.y),
+             glyph.size, glyph.texAtlasPos, p.second.size});
+
         // advance pen to next glyph
         penPos += glyph.advance;
+        glyphPos += glyph.advance;
 
         // textual bounding box only considers maximum pen position
         textBoxExtent.x = std::max(textBoxExtent.x, penPos.x);
@@ -234,78 +292,62 @@ TextBoundingBox TextRenderer::computeBoundingBox(std::string_view str) {
     ivec2 glyphsBottomLeft(glyphsTopLeft.x, textBoxExtent.y - glyphsBottomRight.y);
     ivec2 glyphsExtent(glyphsBottomRight - glyphsTopLeft);
 
-    return {textBoxExtent, glyphsBottomLeft, glyphsExtent, getBaseLineOffset()};
+    layout.bbox = {textBoxExtent, glyphsBottomLeft, glyphsExtent, getBaseLineOffset()};
+    return layout;
 }
 
-void TextRenderer::render(std::string_view str, const vec2& posf, const vec2& scaling,
-                          const vec4& color) {
-
-    auto& fc = getFontCache();
-
-    TextureUnit texUnit;
-    texUnit.activate();
-    fc.glyphTex->bind();
-
-    const vec2 texDims(fc.glyphTex->getDimensions());
-
-    shader_->activate();
-    shader_->setUniform("tex", texUnit);
-    shader_->setUniform("color", color);
-
-    auto rect = SharedOpenGLResources::getPtr()->imagePlaneRect();
-    utilgl::Enable<MeshGL> enable(rect);
-
-    ivec2 glyphPos{0};
-    int verticalOffset = 0;
-
-    // check input string for invalid utf8 encoding
-    auto end = validateString(str);
+void TextRenderer::addToBatch(const TextLayout& layout, const vec2& posf, const vec2& scaling,
+                              const vec2& texDims, const vec4& color) {
+    auto& positions = batchPositions_->getEditableRAMRepresentation()->getDataContainer();
+    auto& texCoords = batchTexCoords_->getEditableRAMRepresentation()->getDataContainer();
+    auto& colors = batchColors_->getEditableRAMRepresentation()->getDataContainer();
 
-    for (utf8::iterator it{str.begin(), str.begin(), end};
-         it != utf8::iterator{end, str.begin(), end}; ++it) {
-        const uint32_t charCode = *it;
+    positions.reserve(positions.size() + 6 * layout.quads.size());
+    texCoords.reserve(texCoords.size() + 6 * layout.quads.size());
+    colors.insert(colors.end(), 6 * layout.quads.size(), color);
 
-        auto p = requestGlyph(fc, charCode);
-        if (!p.first) {
-            // glyph not found, skip it
-            glyphPos += p.second.advance;
-            continue;
-        }
+    for (const auto& quad : layout.quads) {
+        // top-left and bottom-right corners, y is pointing up in normalized device coordinates
+        const vec2 p0{posf.x + quad.pos.x * scaling.x, posf.y - quad.pos.y * scaling.y};
+        const vec2 p1{p0 + vec2(quad.size.x, -quad.size.y) * scaling};
+        const vec2 t0{vec2(quad.texAtlasPos) / texDims};
+        const vec2 t1{vec2(quad.texAtlasPos + quad.texSize) / texDims};
 
-        GlyphEntry& glyph = p.second;
-
-        if (charCode == lf) {
-            verticalOffset += getLineHeight();
-            glyphPos.x = 0;
-            glyphPos.y += glyph.advance.y;
-            continue;
-        } else if (charCode == tab) {
-            glyphPos += glyph.advance;
-            glyphPos.x += (4 * glyph.size.x);  // 4 times glyph character width
-            continue;
-        }
+        positions.insert(positions.end(),
+                         {p0, {p1.x, p0.y}, {p0.x, p1.y}, {p1.x, p0.y}, p1, {p0.x, p1.y}});
+        texCoords.insert(texCoords.end(),
+                         {t0, {t1.x, t0.y}, {t0.x, t1.y}, {t1.x, t0.y}, t1, {t0.x, t1.y}});
+    }
+}
 
-        // compute floating point position
-        vec3 pos(posf, 0.f);
-        pos.x += (glyphPos.x + glyph.bearing.x) * scaling.x;
-        pos.y -= (verticalOffset - glyphPos.y - glyph.bearing.y) * scaling.y;
+void TextRenderer::renderBatch(FontCache& fc) {
+    const auto count = batchPositions_->getSize();
+    if (count > 0) {
+        TextureUnit texUnit;
+        texUnit.activate();
+        fc.glyphTex->bind();
 
-        // Translate quad to correct position and render
-        const mat4 dataToWorld(
-            glm::translate(pos) *
-            glm::scale(vec3(glyph.size.x * scaling.x, -glyph.size.y * scaling.y, 1.f)));
+        shader_->activate();
+        shader_->setUniform("tex", texUnit);
+        shader_->setUniform("distanceField", rasterization_ == Rasterization::DistanceField);
 
-        const mat4 texTransform(glm::translate(vec3(vec2(glyph.texAtlasPos) / texDims, 0.0f)) *
-                                glm::scale(vec3(vec2(glyph.size) / texDims, 1.0f)));
+        const utilgl::Enable<MeshGL> enable(batch_->getRepresentation<MeshGL>());
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(count));
 
-        shader_->setUniform("geometry_.dataToWorld", dataToWorld);
-        shader_->setUniform("texCoordTransform", texTransform);
+        shader_->deactivate();
+    }
 
-        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    batchPositions_->getEditableRAMRepresentation()->clear();
+    batchTexCoords_->getEditableRAMRepresentation()->clear();
+    batchColors_->getEditableRAMRepresentation()->clear();
+}
 
-        glyphPos += glyph.advance;
-    }
-    shader_->deactivate();
+void TextRenderer::render(std::string_view str, const vec2& posf, const vec2& scaling,
+                          const vec4& color) {
+    auto& fc = getFontCache();
+    const auto& layout = getLayout(fc, str);
+    addToBatch(layout, posf, scaling, vec2(fc.glyphTex->getDimensions()), color);
+    renderBatch(fc);
 }
 
 void TextRenderer::render(std::string_view str, float x, float y, const vec2& scale,
@@ -394,18 +436,21 @@ void TextRenderer::renderToTexture(std::shared_ptr<Texture2D> texture,
     auto state = setupRenderState(
         texture, clearTexture ? std::optional<vec4>{vec4{0.0}} : std::optional<vec4>{});
 
-    for (auto&& elem : util::zip(origin, size, str)) {
-        // set up viewport
-        ivec2 pos(get<0>(elem));
-        ivec2 dim(get<1>(elem));
-        utilgl::ViewportState viewport(pos.x, pos.y, dim.x, dim.y);
+    // render all strings with a single draw call into the whole texture
+    const ivec2 texDims(texture->getDimensions());
+    utilgl::ViewportState viewport(0, 0, texDims.x, texDims.y);
+    const vec2 scale(2.f / vec2(texDims));
 
-        // render text into texture
-        vec2 scale(2.f / vec2(dim));
-        // adjust text position, i.e. the pen position, to match the first baseline
-        vec2 textPos(computeBoundingBox(get<2>(elem)).glyphPenOffset);
-        render(get<2>(elem), vec2(-1.0f, 1.0f) - textPos * scale, scale, color);
+    auto& fc = getFontCache();
+    const vec2 glyphTexDims(fc.glyphTex->getDimensions());
+    for (auto&& elem : util::zip(origin, size, str)) {
+        const auto& layout = getLayout(fc, get<2>(elem));
+        // top-left corner of the sub region, adjusted to match the first baseline
+        const vec2 topLeft(vec2(get<0>(elem).x, get<0>(elem).y + get<1>(elem).y) * scale - 1.0f);
+        addToBatch(layout, topLeft - vec2(layout.bbox.glyphPenOffset) * scale, scale,
+                   glyphTexDims, color);
     }
+    renderBatch(fc);
 }
 
 void TextRenderer::renderToTexture(std::shared_ptr<Texture2D> texture,
@@ -414,17 +459,21 @@ void TextRenderer::renderToTexture(std::shared_ptr<Texture2D> texture,
     auto state = setupRenderState(
         texture, clearTexture ? std::optional<vec4>{vec4{0.0}} : std::optional<vec4>{});
 
-    for (auto& elem : entries) {
-        // set up viewport
-        utilgl::ViewportState viewport(elem.texPos.x, elem.texPos.y, elem.texExtent.x,
-                                       elem.texExtent.y);
+    // render all entries with a single draw call into the whole texture
+    const ivec2 texDims(texture->getDimensions());
+    utilgl::ViewportState viewport(0, 0, texDims.x, texDims.y);
+    const vec2 scale(2.f / vec2(texDims));
 
-        // render text into texture
-        vec2 scale(2.f / vec2(elem.texExtent));
-        // adjust text position, i.e. the pen position, to match the first baseline
-        vec2 textPos(computeBoundingBox(elem.value).glyphPenOffset);
-        render(elem.value, vec2(-1.0f, 1.0f) - textPos * scale, scale, elem.color);
+    auto& fc = getFontCache();
+    const vec2 glyphTexDims(fc.glyphTex->getDimensions());
+    for (auto& elem : entries) {
+        const auto& layout = getLayout(fc, elem.value);
+        // top-left corner of the entry, adjusted to match the first baseline
+        const vec2 topLeft(vec2(elem.texPos.x, elem.texPos.y + elem.texExtent.y) * scale - 1.0f);
+        addToBatch(layout, topLeft - vec2(layout.bbox.glyphPenOffset) * scale, scale,
+                   glyphTexDims, elem.color);
     }
+    renderBatch(fc);
 }
 
 void TextRenderer::clear(std::shared_ptr<Texture2D> texture, vec4 color) {
@@ -446,6 +495,14 @@ void TextRenderer::setFontSize(int val) {
     }
 }
 
+void TextRenderer::setRasterization(Rasterization rasterization) {
+    if (rasterization_ != rasterization) {
+        rasterization_ = rasterization;
+        // the cached layouts refer to glyphs in the atlases of the previous rasterization
+        layouts_.clear();
+    }
+}
+
 void TextRenderer::setLineSpacing(double lineSpacing) { lineSpacing_ = lineSpacing; }
 
 double TextRenderer::getLineSpacing() const { return lineSpacing_; }
@@ -486,7 +543,7 @@ std::pair<bool, TextRenderer::GlyphEntry> TextRenderer::requestGlyph(FontCache&
 
 std::pair<bool, TextRenderer::GlyphEntry> TextRenderer::addGlyph(FontCache& fc,
                                                                  unsigned int glyph) {
-    if (FT_Load_Char(fontface_, glyph, FT_LOAD_RENDER)) {
+    if (!loadGlyph(glyph)) {
         log::warn("FreeType: could not load char: '{}' ({:#X})", static_cast<char>(glyph), glyph);
         return std::make_pair(false, GlyphEntry());
     }
@@ -547,41 +604,66 @@ void TextRenderer::uploadGlyph(FontCache& fc, unsigned int glyph) {
         return;
     }
 
-    if (FT_Load_Char(fontface_, glyph, FT_LOAD_RENDER)) return;
+    if (!loadGlyph(glyph)) return;
 
     const auto& elem = it->second;
     glTexSubImage2D(GL_TEXTURE_2D, 0, elem.texAtlasPos.x, elem.texAtlasPos.y, elem.size.x,
                     elem.size.y, GL_RED, GL_UNSIGNED_BYTE, fontface_->glyph->bitmap.buffer);
 }
 
+bool TextRenderer::loadGlyph(unsigned int glyph) {
+    if (rasterization_ == Rasterization::Bitmap) {
+        return FT_Load_Char(fontface_, glyph, FT_LOAD_RENDER) == 0;
+    }
+
+    // the glyph slot keeps the rendered distance field when the size is reset afterwards
+    FT_Set_Pixel_Sizes(fontface_, 0, distanceFieldSize_);
+    const bool loaded = FT_Load_Char(fontface_, glyph, FT_LOAD_DEFAULT) == 0 &&
+                        FT_Render_Glyph(fontface_->glyph, FT_RENDER_MODE_SDF) == 0;
+    FT_Set_Pixel_Sizes(fontface_, 0, fontSize_);
+    return loaded;
+}
+
+TextRenderer::GlyphEntry TextRenderer::scaleGlyph(const GlyphEntry& glyph) const {
+    const auto scale = static_cast<float>(fontSize_) / static_cast<float>(distanceFieldSize_);
+    const auto scaled = [&](const ivec2& v) { return ivec2(glm::round(vec2(v) * scale)); };
+    return {scaled(glyph.advance), scaled(glyph.size), scaled(glyph.bearing), glyph.texAtlasPos};
+}
+
 TextRenderer::FontCache& TextRenderer::getFontCache() {
-    const auto font = getFontTuple();
+    const auto font = getAtlasKey();
 
     auto fontCacheIt = glyphAtlas_.find(font);
     if (fontCacheIt == glyphAtlas_.end()) {
         // texture atlas doesn't exist for the current font/style/size combination
         //
-        // create a new atlas texture
+        // reuse the distance field atlas of another text renderer or create a new atlas texture
+        if (rasterization_ == Rasterization::DistanceField) {
+            if (auto fc = sharedDistanceFields()[font].lock()) {
+                glyphAtlas_.emplace(font, std::move(fc));
+            }
+        }
         createDefaultGlyphAtlas();
         fontCacheIt = glyphAtlas_.find(font);
         if (fontCacheIt == glyphAtlas_.end()) {
             throw Exception("Could not create font atlas");
         }
     }
-    return fontCacheIt->second;
+    return *fontCacheIt->second;
 }
 
 void TextRenderer::createDefaultGlyphAtlas() {
-    if (glyphAtlas_.find(getFontTuple()) != glyphAtlas_.end()) {
+    if (glyphAtlas_.find(getAtlasKey()) != glyphAtlas_.end()) {
         // glyph atlas already exists
         return;
     }
 
-    FontCache fc;
+    auto fcPtr = std::make_shared<FontCache>();
+    auto& fc = *fcPtr;
 
     // create glyphs for all ascii characters between 32 and 128
     for (unsigned int c = 32u; c < 128u; ++c) {
-        if (FT_Load_Char(fontface_, c, FT_LOAD_RENDER)) {
+        if (!loadGlyph(c)) {
             log::warn("FreeType: could not load char: '{}' ({:#X})", static_cast<char>(c), c);
             continue;
         }
@@ -597,7 +679,7 @@ void TextRenderer::createDefaultGlyphAtlas() {
 
     // upload all glyphs
     for (unsigned int c = 32u; c < 128u; ++c) {
-        if (FT_Load_Char(fontface_, c, FT_LOAD_RENDER)) {
+        if (!loadGlyph(c)) {
             continue;
         }
 
@@ -614,7 +696,10 @@ void TextRenderer::createDefaultGlyphAtlas() {
     }
 
     // insert font cache into global map
-    glyphAtlas_.insert({getFontTuple(), std::move(fc)});
+    if (rasterization_ == Rasterization::DistanceField) {
+        sharedDistanceFields()[getAtlasKey()] = fcPtr;
+    }
+    glyphAtlas_.emplace(getAtlasKey(), std::move(fcPtr));
 }
 
 std::shared_ptr<Texture2D> TextRenderer::createAtlasTexture(FontCache& fc) {
@@ -707,6 +792,17 @@ TextRenderer::FontFamilyStyle TextRenderer::getFontTuple() const {
                            fontSize_);
 }
 
+TextRenderer::FontFamilyStyle TextRenderer::getAtlasKey() const {
+    return std::make_tuple(std::string(fontface_->family_name), std::string(fontface_->style_name),
+                           rasterization_ == Rasterization::DistanceField ? 0 : fontSize_);
+}
+
+std::unordered_map<TextRenderer::FontFamilyStyle, std::weak_ptr<TextRenderer::FontCache>>&
+TextRenderer::sharedDistanceFields() {
+    static std::unordered_map<FontFamilyStyle, std::weak_ptr<FontCache>> fontCaches;
+    return fontCaches;
+}
+
 void TextRenderer::configure(const FontSettings& settings) {
     setFont(settings.getFontFace());
     setFontSize(settings.getFontSize());
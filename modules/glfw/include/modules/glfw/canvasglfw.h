@@ -110,6 +110,7 @@ public:
     std::function<void(ivec2)> onPositionChange;
     std::function<void(ivec2)> onWindowSizeChange;
     std::function<void(ivec2)> onFramebufferSizeChange;
+    std::function<void(bool)> onIconifyChange;
 
 protected:
     void setFullScreen(bool fullscreen);
@@ -148,6 +148,12 @@ CanvasGLFW::CanvasGLFW(const std::string& title, uvec2 dimensions)
             canvas->onPositionChange(ivec2(x, y));
         }
     });
+    glfwSetWindowIconifyCallback(glWindow_, [](GLFWwindow* window, int iconified) {
+        auto canvas = getCanvasGLFW(window);
+        if (canvas->onIconifyChange) {
+            canvas->onIconifyChange(iconified == GLFW_TRUE);
+        }
+    });
 }
 
 CanvasGLFW::~CanvasGLFW() {
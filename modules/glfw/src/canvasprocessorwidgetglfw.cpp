@@ -55,6 +55,9 @@ CanvasProcessorWidgetGLFW::CanvasProcessorWidgetGLFW(Processor* p)
 
     canvas_->onPositionChange = [this](ivec2 pos) { CanvasProcessorWidget::setPosition(pos); };
     canvas_->onFramebufferSizeChange = [this](ivec2) { propagateResizeEvent(); };
+    canvas_->onIconifyChange = [this](bool iconified) {
+        CanvasProcessorWidget::setExposed(!iconified);
+    };
 }
 
 CanvasProcessorWidgetGLFW::~CanvasProcessorWidgetGLFW() { updateVisible(false); }
@@ -38,6 +38,9 @@
 #include <modules/base/algorithm/dataminmax.h>
 
 #include <algorithm>
+#include <functional>
+#include <numeric>
+#include <span>
 
 namespace inviwo {
 
@@ -48,6 +51,64 @@ H5::Group load(const std::filesystem::path& filename, const std::string& path) {
     H5::H5File hdfFile(filename.generic_string(), H5F_ACC_RDONLY);
     return hdfFile.openGroup(path);
 }
+
+constexpr size_t maxChunkCacheSize = size_t{512} * 1024 * 1024;
+
+size_t nextPrime(size_t n) {
+    const auto isPrime = [](size_t v) {
+        if (v < 2) return false;
+        for (size_t i = 2; i * i <= v; ++i) {
+            if (v % i == 0) return false;
+        }
+        return true;
+    };
+    while (!isPrime(n)) ++n;
+    return n;
+}
+
+/*
+ * The default chunk cache of HDF5 is 1 MB, which for large chunked datasets means that a chunk
+ * gets decompressed once for every row of the selection that passes through it. Size the cache
+ * to fit all the chunks touched by one slice along the slowest changing dimension of the
+ * hyperslab, that way every chunk is only read and decompressed once.
+ */
+H5::DSetAccPropList chunkCacheAccess(const H5::DataSet& dataset, std::span<const hsize_t> start,
+                                     std::span<const hsize_t> count,
+                                     std::span<const hsize_t> stride) {
+    auto access = dataset.getAccessPlist();
+
+    const auto create = dataset.getCreatePlist();
+    if (create.getLayout() != H5D_CHUNKED) return access;
+
+    const auto rank = static_cast<int>(start.size());
+    std::vector<hsize_t> chunk(rank);
+    create.getChunk(rank, chunk.data());
+
+    size_t chunks = 1;
+    for (int i = 1; i < rank; ++i) {
+        if (count[i] == 0) return access;
+        const auto first = start[i] / chunk[i];
+        const auto last = (start[i] + (count[i] - 1) * stride[i]) / chunk[i];
+        chunks *= static_cast<size_t>(std::min(count[i], last - first + 1));
+    }
+    const auto chunkBytes = std::accumulate(chunk.begin(), chunk.end(),
+                                            size_t{dataset.getDataType().getSize()},
+                                            std::multiplies<size_t>());
+
+    size_t slots = 0;
+    size_t bytes = 0;
+    double w0 = 0.0;
+    access.getChunkCache(slots, bytes, w0);
+
+    const auto wanted = std::min(chunks * chunkBytes, maxChunkCacheSize);
+    if (wanted > bytes) {
+        const auto cachedChunks = std::max(wanted / chunkBytes, size_t{1});
+        // Chunks are never written, so they can be evicted as soon as they are fully read
+        access.setChunkCache(nextPrime(100 * cachedChunks), wanted, 1.0);
+    }
+    return access;
+}
+
 }  // namespace
 
 Handle::Handle(const std::filesystem::path& filename)
@@ -130,7 +191,7 @@ std::shared_ptr<Volume> Handle::getVolumeAtPathAsType(const Path& path,
     auto dataset = data_.openDataSet(path);
     ::inviwo::util::OnScopeExit closedataset{[&]() { dataset.close(); }};
 
-    const H5::DataSpace dataSpace = dataset.getSpace();
+    H5::DataSpace dataSpace = dataset.getSpace();
     const size_t rank = dataSpace.getSimpleExtentNdims();
     if (selection.size() != rank) {
         throw Exception("Selection not of the same rank as the data");
@@ -162,8 +223,9 @@ std::shared_ptr<Volume> Handle::getVolumeAtPathAsType(const Path& path,
 
     for (size_t i = 0; i < rank; ++i) {
         start[i] = selection[i].start;
-        count[i] =
-            static_cast<hsize_t>((selection[i].end - selection[i].start) / selection[i].stride);
+        count[i] = static_cast<hsize_t>(
+            (selection[i].end - selection[i].start + selection[i].stride - 1) /
+            selection[i].stride);
         stride[i] = selection[i].stride;
 
         if (count[i] > 1) {
@@ -174,6 +236,12 @@ std::shared_ptr<Volume> Handle::getVolumeAtPathAsType(const Path& path,
         }
     }
 
+    // Reopen the dataset with a chunk cache that fits the selection, only the selected hyperslab
+    // is then read from the file.
+    const auto access = chunkCacheAccess(dataset, start, count, stride);
+    dataset.close();
+    dataset = data_.openDataSet(path, access);
+    dataSpace = dataset.getSpace();
     dataSpace.selectHyperslab(H5S_SELECT_SET, count.data(), start.data(), stride.data(), nullptr);
 
     H5::DataSpace memorySpace(3, memoryDimensions.data());
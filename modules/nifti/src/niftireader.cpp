@@ -40,7 +40,9 @@
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>       // for createVolumeRAM
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>     // for VolumeRepresentation
 #include <inviwo/core/io/datareader.h>                                  // for DataReaderType
+#include <inviwo/core/io/bytereaderutil.h>                              // for reverseByteOrder
 #include <inviwo/core/io/datareaderexception.h>                         // for DataReaderException
+#include <inviwo/core/io/memorymappedfile.h>                            // for MemoryMappedFile
 #include <inviwo/core/metadata/metadata.h>                              // for StringMetaData
 #include <inviwo/core/util/fileextension.h>                             // for FileExtension
 #include <inviwo/core/util/formats.h>                                   // for NumericType, Data...
@@ -66,6 +68,7 @@
 #include <warn/pop>
 
 #include <array>          // for array
+#include <cstddef>        // for byte
 #include <cstring>        // for size_t, memcpy
 #include <string>         // for string
 #include <type_traits>    // for remove_extent_t
@@ -83,7 +86,8 @@ namespace inviwo {
 class NiftiVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation> {
 public:
     NiftiVolumeRAMLoader(std::shared_ptr<nifti_image> nim_, std::array<int, 7> start_index_,
-                         std::array<int, 7> region_size_, std::array<bool, 3> flipAxis);
+                         std::array<int, 7> region_size_, std::array<bool, 3> flipAxis,
+                         bool mappable);
     virtual NiftiVolumeRAMLoader* clone() const override;
     virtual ~NiftiVolumeRAMLoader() = default;
 
@@ -93,12 +97,30 @@ public:
                                       const VolumeRepresentation& src) const override;
 
 private:
+    void read(std::byte* dest) const;
+
     std::array<int, 7> start_index;
     std::array<int, 7> region_size;
     std::array<bool, 3> flipAxis;  // Flip x,y,z axis?
+    bool mappable;                 // Read the voxels straight from a memory mapped file?
     std::shared_ptr<nifti_image> nim;
 };
 
+namespace {
+
+/**
+ * Uncompressed files where each voxel is stored contiguously can be read directly from a memory
+ * mapping. Compressed files, and files with the vector components stored in separate blocks, are
+ * read using nifti_read_subregion_image.
+ */
+bool isMappable(const nifti_image& nim, const DataFormatBase& format) {
+    return nim.iname && !nifti_is_gzfile(nim.iname) && nim.dim[5] <= 1 &&
+           static_cast<size_t>(nim.nbyper) == format.getSizeInBytes() &&
+           util::MemoryMappedFile::isMappable(nim.iname);
+}
+
+}  // namespace
+
 NiftiReader::NiftiReader() : DataReaderType<VolumeSequence>() {
     addExtension(FileExtension("nii", "NIfTI-1 file format"));
     addExtension(FileExtension("hdr", "ANALYZE file format"));
@@ -305,6 +327,8 @@ std::shared_ptr<VolumeSequence> NiftiReader::readData(const std::filesystem::pat
                                       1,
                                       1};
 
+    const bool mappable = isMappable(*niftiImage, *format);
+
     auto volumes = std::make_shared<VolumeSequence>();
     // Fixes single-volume where dim[4] has been set to zero
     auto nTimeSteps = niftiImage->dim[4] > 0 ? niftiImage->dim[4] : 1;
@@ -314,7 +338,7 @@ std::shared_ptr<VolumeSequence> NiftiReader::readData(const std::filesystem::pat
         auto diskRepr = std::make_shared<VolumeDisk>(filePath, dim, format);
         start_index[3] = t;
         diskRepr->setLoader(
-            new NiftiVolumeRAMLoader(niftiImage, start_index, region_size, flipAxis));
+            new NiftiVolumeRAMLoader(niftiImage, start_index, region_size, flipAxis, mappable));
         volumes->back()->addRepresentation(diskRepr);
     }
 
@@ -366,8 +390,19 @@ std::shared_ptr<VolumeSequence> NiftiReader::readData(const std::filesystem::pat
         // In other words:
         // The minimum value will correspond to 0 and the maximum will correspond to 1 in the
         // Transfer Function
-        auto volRAM = volumes->front()->getRepresentation<VolumeRAM>();
-        auto minmax = util::volumeMinMax(volRAM);
+        const auto minmax = [&]() {
+            if (mappable) {
+                // Reading from the mapping is cheap, scan a temporary representation and leave
+                // the volume on disk until it is actually used
+                const auto disk = volumes->front()->getRepresentation<VolumeDisk>();
+                const auto volRAM =
+                    std::static_pointer_cast<VolumeRAM>(disk->createRepresentation());
+                return util::volumeMinMax(volRAM.get());
+            } else {
+                // Decompressing is expensive, keep the representation for later use
+                return util::volumeMinMax(volumes->front()->getRepresentation<VolumeRAM>());
+            }
+        }();
         // minmax always have four components, unused components are set to zero.
         // Hence, only consider components used by the data format
         dvec2 dataRange(minmax.first[0], minmax.second[0]);
@@ -403,42 +438,80 @@ std::shared_ptr<VolumeSequence> NiftiReader::readData(const std::filesystem::pat
 NiftiVolumeRAMLoader::NiftiVolumeRAMLoader(std::shared_ptr<nifti_image> nim_,
                                            std::array<int, 7> start_index_,
                                            std::array<int, 7> region_size_,
-                                           std::array<bool, 3> flipAxis_)
+                                           std::array<bool, 3> flipAxis_, bool mappable_)
     : DiskRepresentationLoader()
     , start_index(start_index_)
     , region_size(region_size_)
     , flipAxis(flipAxis_)
+    , mappable(mappable_)
     , nim{nim_} {}
 
 NiftiVolumeRAMLoader* NiftiVolumeRAMLoader::clone() const {
     return new NiftiVolumeRAMLoader(*this);
 }
 
-void flip(char* data, size_t elemSize, size3_t dim, std::array<bool, 3> flipAxis) {
-    // Flip data along axes if necessary
-    if (flipAxis[0] || flipAxis[1] || flipAxis[2]) {
-        const auto size = glm::compMul(dim);
-        auto tmp = std::make_unique<char[]>(elemSize * size);
-        auto copy = tmp.get();
-
-        std::memcpy(copy, data, size * elemSize);
-
-        util::IndexMapper3D mapper(dim);
-        for (size_t z = 0; z < dim[2]; ++z) {
-            const auto idz = flipAxis[2] ? dim[2] - 1 - z : z;
-            for (size_t y = 0; y < dim[1]; ++y) {
-                const auto idy = flipAxis[1] ? dim[1] - 1 - y : y;
+namespace {
+
+// Copy the voxels from src to dst while flipping the axes given by flipAxis
+void copyFlipped(const std::byte* src, std::byte* dst, size_t elemSize, size3_t dim,
+                 std::array<bool, 3> flipAxis) {
+    const util::IndexMapper3D mapper(dim);
+    const auto rowBytes = dim[0] * elemSize;
+    for (size_t z = 0; z < dim[2]; ++z) {
+        const auto idz = flipAxis[2] ? dim[2] - 1 - z : z;
+        for (size_t y = 0; y < dim[1]; ++y) {
+            const auto idy = flipAxis[1] ? dim[1] - 1 - y : y;
+            const auto* srcRow = src + mapper(0, y, z) * elemSize;
+            auto* dstRow = dst + mapper(0, idy, idz) * elemSize;
+            if (!flipAxis[0]) {
+                std::memcpy(dstRow, srcRow, rowBytes);
+            } else {
                 for (size_t x = 0; x < dim[0]; ++x) {
-                    const auto idx = flipAxis[0] ? dim[0] - 1 - x : x;
-                    const auto from = mapper(x, y, z);
-                    const auto to = mapper(idx, idy, idz);
-                    std::memcpy(data + to * elemSize, copy + from * elemSize, elemSize);
+                    std::memcpy(dstRow + (dim[0] - 1 - x) * elemSize, srcRow + x * elemSize,
+                                elemSize);
                 }
             }
         }
     }
 }
 
+// Flip data along axes if necessary
+void flip(std::byte* data, size_t elemSize, size3_t dim, std::array<bool, 3> flipAxis) {
+    if (flipAxis[0] || flipAxis[1] || flipAxis[2]) {
+        const auto bytes = glm::compMul(dim) * elemSize;
+        auto copy = std::make_unique<std::byte[]>(bytes);
+        std::memcpy(copy.get(), data, bytes);
+        copyFlipped(copy.get(), data, elemSize, dim, flipAxis);
+    }
+}
+
+}  // namespace
+
+void NiftiVolumeRAMLoader::read(std::byte* dest) const {
+    const auto voxelSize = static_cast<size_t>(nim->nbyper);
+    const auto dim = size3_t{region_size[0], region_size[1], region_size[2]};
+
+    if (mappable) {
+        const auto bytes = glm::compMul(dim) * voxelSize;
+        const auto offset =
+            static_cast<size_t>(nim->iname_offset) + static_cast<size_t>(start_index[3]) * bytes;
+        const util::MemoryMappedFile file{nim->iname, offset, bytes};
+        copyFlipped(file.data(), dest, voxelSize, dim, flipAxis);
+        if (nim->byteorder != nifti_short_order() && nim->swapsize > 1) {
+            util::reverseByteOrder(dest, bytes, static_cast<size_t>(nim->swapsize));
+        }
+    } else {
+        void* pdata = static_cast<void*>(dest);
+        auto start = start_index;
+        auto region = region_size;
+        if (nifti_read_subregion_image(nim.get(), start.data(), region.data(), &pdata) < 0) {
+            throw DataReaderException(SourceContext{}, "Error: Could not read data from file: {}",
+                                      nim->fname);
+        }
+        flip(dest, voxelSize, dim, flipAxis);
+    }
+}
+
 std::shared_ptr<VolumeRepresentation> NiftiVolumeRAMLoader::createRepresentation(
     const VolumeRepresentation& src) const {
 
@@ -449,19 +522,7 @@ std::shared_ptr<VolumeRepresentation> NiftiVolumeRAMLoader::createRepresentation
                                region_size[4] * region_size[5] * region_size[6];
 
     auto data = std::make_unique<char[]>(voxels * voxelSize);
-
-    void* pdata = static_cast<void*>(data.get());
-    auto start = start_index;
-    auto region = region_size;
-    auto readBytes = nifti_read_subregion_image(nim.get(), start.data(), region.data(), &pdata);
-
-    const auto dim = size3_t{region_size[0], region_size[1], region_size[2]};
-    flip(data.get(), voxelSize, dim, flipAxis);
-
-    if (readBytes < 0) {
-        throw DataReaderException(SourceContext{}, "Error: Could not read data from file: {}",
-                                  nim->fname);
-    }
+    read(reinterpret_cast<std::byte*>(data.get()));
 
     auto volumeRAM =
         createVolumeRAM(src.getDimensions(), src.getDataFormat(), data.get(), src.getSwizzleMask(),
@@ -472,26 +533,13 @@ std::shared_ptr<VolumeRepresentation> NiftiVolumeRAMLoader::createRepresentation
 }
 
 void NiftiVolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
-                                                const VolumeRepresentation& src) const {
+                                                const VolumeRepresentation&) const {
     auto volumeDst = std::static_pointer_cast<VolumeRAM>(dest);
 
     if (size3_t{region_size[0], region_size[1], region_size[2]} != volumeDst->getDimensions()) {
         throw DataReaderException("Mismatching volume dimensions, can't update");
     }
-    auto data = volumeDst->getData();
-
-    auto start = start_index;
-    auto region = region_size;
-    auto readBytes = nifti_read_subregion_image(nim.get(), start.data(), region.data(), &data);
-    if (readBytes < 0) {
-        throw DataReaderException(SourceContext{}, "Error: Could not read data from file: {}",
-                                  nim->fname);
-    }
-
-    const auto voxelSize = src.getDataFormat()->getSizeInBytes();
-    const auto dim = size3_t{region_size[0], region_size[1], region_size[2]};
-
-    flip(static_cast<char*>(data), voxelSize, dim, flipAxis);
+    read(static_cast<std::byte*>(volumeDst->getData()));
 }
 
 }  // namespace inviwo
@@ -47,6 +47,10 @@ struct AbufferParameters {
 };
 uniform AbufferParameters AbufferParams;
 
+#if defined(OIT_WEIGHTED_BLENDED) || defined(OIT_KBUFFER)
+#include "oit/boundedoit.glsl"
+#endif
+
 // Macros (maybe) changed from the C++ side
 
 #define ABUFFER_USE_TEXTURES 1
@@ -177,6 +181,13 @@ int getPixelDataType(vec4 data) {
 
 // The central function for the user-code
 uint abufferMeshRender(ivec2 coords, float depth, vec4 color) {
+#if defined(OIT_WEIGHTED_BLENDED)
+    oitAccumulate(oitPixelIndex(coords), depth, color);
+    return 0u;
+#elif defined(OIT_KBUFFER)
+    kbufferInsert(coords, depth, color);
+    return 0u;
+#else
     // reserve space for pixel
     uint pixelIdx = dataCounterAtomicInc();
     if (pixelIdx >= AbufferParams.storageSize) {
@@ -192,9 +203,14 @@ uint abufferMeshRender(ivec2 coords, float depth, vec4 color) {
     p.color = color;
     writePixelStorage(pixelIdx, compressMeshPixelData(p));
     return pixelIdx;
+#endif
 }
 
 uint abufferVolumeRender(ivec2 coords, float depth, vec3 position, uint volumeId) {
+#if defined(OIT_WEIGHTED_BLENDED) || defined(OIT_KBUFFER)
+    // volume fragments are only supported by the fragment lists
+    return uint(-1);
+#endif
     // reserve space for pixel
     uint pixelIdx = dataCounterAtomicInc();
     if (pixelIdx >= AbufferParams.storageSize) {
@@ -0,0 +1,135 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Bounded memory alternatives to the fragment lists of abufferlinkedlist.glsl
+//
+// OIT_WEIGHTED_BLENDED: Weighted blended OIT [McGuire and Bavoil, JCGT 2013]. All fragments are
+//   accumulated per pixel without sorting, using a depth based weight.
+// OIT_KBUFFER: The KBUFFER_SIZE closest fragments of each pixel are kept sorted by inserting with
+//   64-bit atomic min, which requires GL_NV_shader_atomic_int64. Fragments that do not fit are
+//   accumulated as the tail, which is blended behind the sorted fragments.
+//
+// The accumulation uses fixed point integer atomics since float atomics are not core.
+
+#ifndef BOUNDEDOIT_GLSL
+#define BOUNDEDOIT_GLSL
+
+#ifndef KBUFFER_SIZE
+#define KBUFFER_SIZE 8
+#endif
+
+// Fixed point scales and limits of the accumulation. The limits are checked before adding to
+// avoid overflowing, when they are reached the pixel is saturated anyway.
+#define OIT_COLOR_SCALE 16777216.0  // 2^24, at most 256 fully opaque fragments
+#define OIT_COLOR_LIMIT 240.0
+#define OIT_REVEAL_SCALE 1048576.0  // 2^20
+#define OIT_REVEAL_LIMIT 32.0
+
+layout(std430, binding = 8) buffer oitAccumulationStorage {
+    // 6 values per pixel:
+    // 0-3: sum of weighted premultiplied rgb and alpha
+    // 4: sum of -log(1 - alpha), i.e. the log of the revealage
+    // 5: bitwise inverted depth of the closest accumulated fragment, 0 if there is none
+    uint oitAccumulation[];
+};
+
+uint oitPixelIndex(ivec2 coords) { return uint(coords.y * AbufferParams.screenWidth + coords.x); }
+
+float oitWeight(float depth, float alpha) {
+#if defined(OIT_WEIGHTED_BLENDED)
+    // Eq. 10 of McGuire and Bavoil, divided by 3000 to fit the fixed point range
+    return alpha * max(3e-6, pow(1.0 - depth, 3.0));
+#else
+    // the tail of the k-buffer is a plain alpha weighted average
+    return 1.0;
+#endif
+}
+
+void oitAccumulate(uint pixel, float depth, vec4 color) {
+    const uint base = 6u * pixel;
+    color = clamp(color, 0.0, 1.0);
+
+    if (float(oitAccumulation[base + 3u]) < OIT_COLOR_LIMIT * OIT_COLOR_SCALE) {
+        const float w = oitWeight(depth, color.a);
+        const uvec4 c = uvec4(vec4(color.rgb * color.a, color.a) * w * OIT_COLOR_SCALE + 0.5);
+        atomicAdd(oitAccumulation[base + 0u], c.r);
+        atomicAdd(oitAccumulation[base + 1u], c.g);
+        atomicAdd(oitAccumulation[base + 2u], c.b);
+        atomicAdd(oitAccumulation[base + 3u], c.a);
+    }
+    if (float(oitAccumulation[base + 4u]) < OIT_REVEAL_LIMIT * OIT_REVEAL_SCALE) {
+        const float reveal = -log(1.0 - min(color.a, 0.999));
+        atomicAdd(oitAccumulation[base + 4u], uint(reveal * OIT_REVEAL_SCALE + 0.5));
+    }
+    atomicMax(oitAccumulation[base + 5u], ~floatBitsToUint(depth));
+}
+
+// Resolves the accumulated fragments of a pixel, premultiplied alpha. The depth of the closest
+// accumulated fragment is returned in depth, 1.0 if there are none.
+vec4 oitResolveAccumulation(uint pixel, out float depth) {
+    const uint base = 6u * pixel;
+    const uint invDepth = oitAccumulation[base + 5u];
+    depth = invDepth == 0u ? 1.0 : uintBitsToFloat(~invDepth);
+    if (invDepth == 0u) return vec4(0.0);
+
+    const vec4 accum = vec4(oitAccumulation[base + 0u], oitAccumulation[base + 1u],
+                            oitAccumulation[base + 2u], oitAccumulation[base + 3u]);
+    const float alpha = 1.0 - exp(-float(oitAccumulation[base + 4u]) / OIT_REVEAL_SCALE);
+    return vec4(accum.rgb / max(accum.a, 1.0) * alpha, alpha);
+}
+
+#if defined(OIT_KBUFFER)
+
+layout(std430, binding = 9) buffer kbufferStorage {
+    // KBUFFER_SIZE entries per pixel sorted by depth
+    // upper 32 bits: depth, float
+    // lower 32 bits: color, rgba 8 bits each
+    uint64_t kbuffer[];
+};
+
+const uint64_t kbufferEmpty = 0xffffffffffffffffUL;
+
+void kbufferInsert(ivec2 coords, float depth, vec4 color) {
+    const uint pixel = oitPixelIndex(coords);
+    // positive floats compare like their bit patterns, sorting the entries by depth
+    uint64_t value = packUint2x32(uvec2(packUnorm4x8(clamp(color, 0.0, 1.0)),
+                                        floatBitsToUint(depth)));
+    for (uint i = 0u; i < KBUFFER_SIZE; ++i) {
+        const uint64_t prev = atomicMin(kbuffer[pixel * KBUFFER_SIZE + i], value);
+        if (prev == kbufferEmpty) return;
+        value = max(prev, value);
+    }
+    // the farthest fragment did not fit, add it to the tail
+    const uvec2 evicted = unpackUint2x32(value);
+    oitAccumulate(pixel, uintBitsToFloat(evicted.y), unpackUnorm4x8(evicted.x));
+}
+
+#endif  // OIT_KBUFFER
+
+#endif  // BOUNDEDOIT_GLSL
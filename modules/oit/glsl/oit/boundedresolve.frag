@@ -0,0 +1,95 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Resolves the bounded memory OIT modes of boundedoit.glsl, see FragmentListRenderer::Mode
+// need extensions added from C++
+// GL_NV_gpu_shader5, GL_EXT_shader_image_load_store, GL_NV_shader_buffer_load,
+// GL_EXT_bindable_uniform, GL_NV_shader_atomic_int64 (OIT_KBUFFER)
+
+#include "oit/abufferlinkedlist.glsl"
+#include "utils/structs.glsl"
+
+#ifdef BACKGROUND_AVAILABLE
+uniform ImageParameters bgParameters;
+uniform sampler2D bgColor;
+uniform sampler2D bgDepth;
+uniform vec2 reciprocalDimensions;
+#endif  // BACKGROUND_AVAILABLE
+
+layout(pixel_center_integer) in vec4 gl_FragCoord;
+
+void main() {
+    const ivec2 coords = ivec2(gl_FragCoord.xy);
+
+    if (coords.x < 0 || coords.y < 0 || coords.x >= AbufferParams.screenWidth ||
+        coords.y >= AbufferParams.screenHeight) {
+        discard;
+    }
+
+    float backgroundDepth = 1.0;
+#ifdef BACKGROUND_AVAILABLE
+    vec2 texCoord = (gl_FragCoord.xy + 0.5) * reciprocalDimensions;
+    backgroundDepth = texture(bgDepth, texCoord).x;
+#endif  // BACKGROUND_AVAILABLE
+
+    const uint pixel = oitPixelIndex(coords);
+
+    // front-to-back blending, premultiplied alpha
+    vec4 color = vec4(0.0);
+    float depth = 1.0;
+
+#if defined(OIT_KBUFFER)
+    for (uint i = 0u; i < KBUFFER_SIZE; ++i) {
+        const uint64_t value = kbuffer[pixel * KBUFFER_SIZE + i];
+        if (value == kbufferEmpty) break;
+
+        const uvec2 fragment = unpackUint2x32(value);
+        const float fragmentDepth = uintBitsToFloat(fragment.y);
+        if (fragmentDepth > backgroundDepth) break;
+
+        const vec4 c = unpackUnorm4x8(fragment.x);
+        color += (1.0 - color.a) * vec4(c.rgb * c.a, c.a);
+        depth = min(depth, fragmentDepth);
+    }
+#endif  // OIT_KBUFFER
+
+    // the accumulated fragments, i.e. all fragments for weighted blended and the tail otherwise
+    float accumulatedDepth;
+    const vec4 accumulated = oitResolveAccumulation(pixel, accumulatedDepth);
+    if (accumulatedDepth <= backgroundDepth) {
+        color += (1.0 - color.a) * accumulated;
+        depth = min(depth, accumulatedDepth);
+    }
+
+    if (color.a <= 0.0) discard;
+
+    FragData0 = vec4(color.rgb / color.a, color.a);
+    PickingData = vec4(0.0, 0.0, 0.0, 1.0);
+    gl_FragDepth = min(backgroundDepth, depth);
+}
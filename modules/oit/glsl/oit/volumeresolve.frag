@@ -116,6 +116,19 @@ int getFragmentCount(uint pixelIdx);
 // Returns the closest fragment of the fragment list
 vec4 resolveClosest(uint idx);
 
+#if defined(PRESORTED_FRAGMENTS)
+// The fragment lists were sorted front-to-back by oit/volumesort.comp, follow the links
+vec4 nextSortedFragment(uint headPtr, float lastDepth, inout uint lastPtr) {
+    const uint ptr = lastPtr == 0 ? headPtr : floatBitsToUint(readPixelStorage(lastPtr - 1).x);
+    lastPtr = ptr;
+    return ptr == 0 ? vec4(-1.0) : readPixelStorage(ptr - 1);
+}
+#else
+vec4 nextSortedFragment(uint headPtr, float lastDepth, inout uint lastPtr) {
+    return selectionSortNext(headPtr, lastDepth, lastPtr);
+}
+#endif
+
 // Transform the non-linear \p fragDepth at a given normalized screen position \p screenPos
 // from [0,1] to world coordinates
 // @return corresponding linear depth in world space
@@ -207,7 +220,7 @@ void main() {
 
         vec4 dstColor = vec4(0);
         uint lastPtr = 0;
-        vec4 nextFragment = selectionSortNext(pixelIdx, 0.0, lastPtr);
+        vec4 nextFragment = nextSortedFragment(pixelIdx, 0.0, lastPtr);
         int fragType = getPixelDataType(nextFragment);
         
         // non-linear depth in normalized device coords [0,1]
@@ -236,7 +249,7 @@ void main() {
             }
 
             // determine depth of next fragment to define the current ray segment for raycasting
-            nextFragment = selectionSortNext(pixelIdx, depth, lastPtr);
+            nextFragment = nextSortedFragment(pixelIdx, depth, lastPtr);
             int nextFragType = getPixelDataType(nextFragment);
             float nextFragDepth = depth;
             if (nextFragType == 0) {
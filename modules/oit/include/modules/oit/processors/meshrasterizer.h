@@ -96,9 +96,11 @@ protected:
     /**
      * \brief Update the mesh drawer.
      * This is called when the inport is changed or when a property requires preprocessing steps on
-     * the mesh, e.g. for silhouettes or special alpha features.
+     * the mesh, e.g. for silhouettes or special alpha features. Only meshes of changed outports are
+     * processed again, unless \p settingsChanged is true.
      */
-    void updateMeshes();
+    void updateMeshes(bool settingsChanged = false);
+    std::shared_ptr<const Mesh> enhanceMesh(const std::shared_ptr<const Mesh>& mesh) const;
 
     virtual void setUniforms(Shader& shader) override;
 
@@ -215,7 +217,16 @@ protected:
 
     std::array<FaceSettings, 2> faceSettings_;
 
-    std::vector<std::shared_ptr<const Mesh>> enhancedMeshes_;
+    /**
+     * \brief View independent preprocessing of an input mesh, i.e. adjacency information for
+     * silhouettes and generated normals. Reused for all rasterizations until the input mesh or the
+     * preprocessing settings change.
+     */
+    struct EnhancedMesh {
+        std::shared_ptr<const Mesh> source;
+        std::shared_ptr<const Mesh> mesh;
+    };
+    std::vector<EnhancedMesh> enhancedMeshes_;
     Shader shader_;
 
     /**
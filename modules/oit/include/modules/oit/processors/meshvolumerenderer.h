@@ -34,6 +34,7 @@
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/ports/volumeport.h>
 #include <inviwo/core/ports/imageport.h>
+#include <inviwo/core/properties/boolproperty.h>
 #include <inviwo/core/properties/compositeproperty.h>
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/properties/cameraproperty.h>
@@ -75,6 +76,7 @@ protected:
 
     CompositeProperty raycastingProps_;
     FloatProperty samplingDistance_;
+    BoolProperty tiledSorting_;
     CameraProperty camera_;
     SimpleLightingProperty lighting_;
     CameraTrackball trackball_;
@@ -38,6 +38,7 @@
 #include <inviwo/core/processors/processorinfo.h>          // for ProcessorInfo
 #include <inviwo/core/properties/boolcompositeproperty.h>  // for BoolCompositeProperty
 #include <inviwo/core/properties/cameraproperty.h>         // for CameraProperty
+#include <inviwo/core/properties/optionproperty.h>         // for OptionProperty
 #include <inviwo/core/properties/ordinalproperty.h>        // for FloatProperty, Float...
 #include <inviwo/core/properties/simplelightingproperty.h>
 #include <inviwo/core/util/dispatcher.h>                 // for Dispatcher, Dispatch...
@@ -100,6 +101,9 @@ protected:
     };
     IllustrationSettings illustrationSettings_;
 
+    OptionProperty<FragmentListRenderer::Mode> oitMode_;
+    IntSizeTProperty kBufferLayers_;
+
     std::optional<FragmentListRenderer> flr_;
     DispatcherHandle<void()> flrReload_;
     DispatcherHandle<void(Outport*)> onConnect_;
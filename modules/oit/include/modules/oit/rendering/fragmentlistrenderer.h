@@ -68,12 +68,40 @@ class Image;
  * 4. Call FragmentListRenderer::postPass(...)
  *    If this returns <code>false</code>, not enough space for all pixels
  *    was available. Repeat from step 2.
+ *
+ * The size of the fragment storage is predicted from the number of fragments of the previous
+ * frame, such that the repetition is only needed when the number of fragments suddenly grows.
+ *
+ * Instead of fragment lists, one of the bounded memory modes can be used, see Mode. The shaders
+ * then need to be configured with FragmentListRenderer::configureShader(shader) and postPass
+ * always succeeds.
  */
 class IVW_MODULE_OIT_API FragmentListRenderer {
 public:
+    enum class Mode {
+        FragmentList,     //!< per pixel linked lists, exact but memory grows with the fragments
+        WeightedBlended,  //!< weighted blended OIT, single pass and constant memory, approximate
+        KBuffer  //!< the k closest fragments are sorted per pixel, the rest is blended as a tail
+    };
+
     FragmentListRenderer();
     ~FragmentListRenderer();
 
+    /**
+     * \brief Select the method used to blend the transparent fragments.
+     * Changing the mode requires the shaders of the rendered objects to be reconfigured
+     * \param mode the blending method, has to be supported, see supportsMode
+     * \param kBufferLayers the number of sorted fragments per pixel used by Mode::KBuffer
+     */
+    void setMode(Mode mode, size_t kBufferLayers = 8);
+    Mode getMode() const { return mode_; }
+
+    /**
+     * \brief Adds the defines and extensions of the current mode to the fragment shader of an
+     * object rendered with <code>oit/abufferlinkedlist.glsl</code>.
+     */
+    void configureShader(Shader& shader) const;
+
     /**
      * \brief Starts the rendering of transparent objects using fragment lists.
      * It resets all counters and allocated the index textures of the given screen size.
@@ -128,6 +156,13 @@ public:
      * @return true iff they are supported
      */
     static bool supportsIllustration();
+    /**
+     * @brief Tests if the given mode is supported by the current opengl context.
+     * All modes require fragment list support, Mode::KBuffer in addition
+     * "GL_NV_shader_atomic_int64".
+     * @return true iff it is supported
+     */
+    static bool supportsMode(Mode mode);
 
     DispatcherHandle<void()> onReload(std::function<void()> callback);
 
@@ -138,13 +173,17 @@ private:
     void buildShaders(bool hasBackground = false);
 
     void setUniforms(Shader& shader, const TextureUnit& abuffUnit) const;
+    void setBoundedUniforms(Shader& shader) const;
     void resizeBuffers(const size2_t& screenSize);
+    void resolveBounded(const Image* background);
 
     void fillIllustration(TextureUnit& abuffUnit, TextureUnit& idxUnit, TextureUnit& countUnit,
                           const Image* background);
 
     size2_t screenSize_;
     size_t fragmentSize_;
+    Mode mode_;
+    size_t kBufferLayers_;
 
     // basic fragment lists
     Texture2D abufferIdxTex_;
@@ -159,6 +198,11 @@ private:
     Shader clear_;
     Shader display_;
 
+    // bounded memory modes
+    BufferObject accumulationBuffer_;
+    BufferObject kBuffer_;
+    Shader resolve_;
+
     struct Illustration {
         Illustration(size2_t screenSize, size_t fragmentSize);
         void resizeBuffers(size2_t screenSize, size_t fragmentSize);
@@ -58,6 +58,15 @@ public:
     void beginCount();
     void endCount();
 
+    /**
+     * \brief Sort the fragment lists in a compute pass before the resolve.
+     * The lists are sorted per 8x8 tile using shared memory, and the resolve pass then only has to
+     * follow them. Otherwise the resolve searches for the next fragment for each step along the
+     * ray, which is quadratic in the number of fragments per pixel.
+     */
+    void setTiledSorting(bool enable) { tiledSorting_ = enable; }
+    bool getTiledSorting() const { return tiledSorting_; }
+
     static bool supportsFragmentLists();
 
     DispatcherHandle<void()> onReload(std::function<void()> callback);
@@ -67,6 +76,7 @@ private:
 
     void setUniforms(Shader& shader, const TextureUnit& abuffUnit) const;
     void resizeBuffers(const size2_t& screenSize);
+    void sortFragments();
 
     size2_t screenSize_;
     size_t fragmentSize_;
@@ -76,6 +86,8 @@ private:
     TextureUnitContainer textureUnits_;
     bool builtWithBackground_;
     int numVolumes_;
+    bool tiledSorting_;
+    bool builtWithTiledSorting_;
 
     BufferObject atomicCounter_;
     BufferObject pixelBuffer_;
@@ -84,6 +96,7 @@ private:
 
     Shader clear_;
     Shader display_;
+    Shader sort_;
 
     Dispatcher<void()> onReload_;
 };
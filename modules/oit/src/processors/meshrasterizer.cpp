@@ -78,6 +78,7 @@
 #include <modules/opengl/shader/shaderutils.h>                          // for addShaderDe...
 #include <modules/opengl/texture/textureunit.h>                         // for TextureUnit
 
+#include <algorithm>      // for find, find_if
 #include <cstddef>        // for size_t
 #include <tuple>          // for tuple_eleme...
 #include <type_traits>    // for remove_exte...
@@ -156,7 +157,11 @@ MeshRasterizer::MeshRasterizer()
     // input and output ports
     addPort(inport_).onChange([this]() { updateMeshes(); });
 
-    drawSilhouette_.onChange([this]() { updateMeshes(); });
+    drawSilhouette_.onChange([this]() { updateMeshes(true); });
+    normalSource_.onChange([this]() { updateMeshes(true); });
+    normalComputationMode_.onChange([this]() {
+        if (normalSource_.get() == NormalSource::GenerateVertex) updateMeshes(true);
+    });
 
     addProperties(forceOpaque_, drawSilhouette_, silhouetteColor_, normalSource_,
                   normalComputationMode_, alphaSettings_, edgeSettings_, faceSettings_[0].show_,
@@ -490,7 +495,7 @@ void MeshRasterizer::rasterize(const ivec2& imageSize, const mat4& worldMatrixTr
                                                 forceOpaque_ ? GL_ZERO : GL_ONE_MINUS_SRC_ALPHA);
 
     // Finally, draw it
-    for (const auto& mesh : enhancedMeshes_) {
+    for (const auto& [source, mesh] : enhancedMeshes_) {
         MeshDrawerGL::DrawObject drawer{mesh->getRepresentation<MeshGL>(),
                                         mesh->getDefaultMeshInfo()};
         auto transform = CompositeTransform(mesh->getModelMatrix(),
@@ -502,42 +507,54 @@ void MeshRasterizer::rasterize(const ivec2& imageSize, const mat4& worldMatrixTr
     }
 }
 
-void MeshRasterizer::updateMeshes() {
+void MeshRasterizer::updateMeshes(bool settingsChanged) {
+    const auto& changed = inport_.getChangedOutports();
+    auto previous = std::move(enhancedMeshes_);
     enhancedMeshes_.clear();
-    for (auto mesh : inport_) {
-        std::shared_ptr<Mesh> copy = nullptr;
 
-        if (drawSilhouette_) {
-            copy = std::make_shared<Mesh>(*mesh, noData);
-            for (auto&& [info, buffer] : mesh->getBuffers()) {
-                copy->addBuffer(info, std::shared_ptr<BufferBase>(buffer->clone()));
+    for (auto&& [outport, mesh] : inport_.getSourceVectorData()) {
+        const bool outportChanged =
+            std::find(changed.begin(), changed.end(), outport) != changed.end();
+        if (!settingsChanged && !outportChanged) {
+            auto it = std::find_if(previous.begin(), previous.end(),
+                                   [&](const EnhancedMesh& item) { return item.source == mesh; });
+            if (it != previous.end()) {
+                enhancedMeshes_.push_back(*it);
+                continue;
             }
+        }
+        enhancedMeshes_.push_back({mesh, enhanceMesh(mesh)});
+    }
 
-            // create adjacency information
-            const auto halfEdges = HalfEdges{*mesh};
+    if (!enhancedMeshes_.empty() && meshHasAdjacency_ != drawSilhouette_.get()) {
+        meshHasAdjacency_ = drawSilhouette_.get();
+        initializeResources();
+    }
+}
 
-            // add new index buffer with adjacency information
-            copy->addIndices(
-                {DrawType::Triangles, ConnectivityType::Adjacency},
-                std::make_shared<IndexBuffer>(halfEdges.createIndexBufferWithAdjacency()));
+std::shared_ptr<const Mesh> MeshRasterizer::enhanceMesh(
+    const std::shared_ptr<const Mesh>& mesh) const {
+    std::shared_ptr<Mesh> copy = nullptr;
 
-            if (!meshHasAdjacency_) {
-                meshHasAdjacency_ = true;
-                initializeResources();
-            }
-        } else {
-            if (meshHasAdjacency_) {
-                meshHasAdjacency_ = false;
-                initializeResources();
-            }
+    if (drawSilhouette_) {
+        copy = std::make_shared<Mesh>(*mesh, noData);
+        for (auto&& [info, buffer] : mesh->getBuffers()) {
+            copy->addBuffer(info, std::shared_ptr<BufferBase>(buffer->clone()));
         }
 
-        if (normalSource_.get() == NormalSource::GenerateVertex) {
-            if (!copy) copy = std::shared_ptr<Mesh>(mesh->clone());
-            meshutil::calculateMeshNormals(*copy, normalComputationMode_);
-        }
-        enhancedMeshes_.push_back(copy ? copy : mesh);
+        // create adjacency information
+        const auto halfEdges = HalfEdges{*mesh};
+
+        // add new index buffer with adjacency information
+        copy->addIndices({DrawType::Triangles, ConnectivityType::Adjacency},
+                         std::make_shared<IndexBuffer>(halfEdges.createIndexBufferWithAdjacency()));
+    }
+
+    if (normalSource_.get() == NormalSource::GenerateVertex) {
+        if (!copy) copy = std::shared_ptr<Mesh>(mesh->clone());
+        meshutil::calculateMeshNormals(*copy, normalComputationMode_);
     }
+    return copy ? copy : mesh;
 }
 
 std::optional<mat4> MeshRasterizer::boundingBox() const { return util::boundingBox(inport_)(); }
@@ -72,6 +72,10 @@ MeshVolumeRenderer::MeshVolumeRenderer()
     , samplingDistance_("samplingDistance", "Sampling Distance (world space)",
                         util::ordinalScale(0.01f, 1.0f)
                             .set("Distance between volume samples in world space."_help))
+    , tiledSorting_("tiledSorting", "Tiled Sorting",
+                    "Sort the fragment lists per 8x8 tile in a compute pass before the volume "
+                    "integration, which scales better with the number of fragments per pixel"_help,
+                    true)
     , camera_("camera", "Camera")
     , lighting_{"lighting", "Lighting", &camera_}
     , trackball_(&camera_)
@@ -93,7 +97,7 @@ MeshVolumeRenderer::MeshVolumeRenderer()
     addPort(background_).setOptional(true);
     addPort(outport_);
 
-    raycastingProps_.addProperties(samplingDistance_);
+    raycastingProps_.addProperties(samplingDistance_, tiledSorting_);
     addProperties(camera_, raycastingProps_, lighting_, trackball_);
     camera_.setCollapsed(true);
     trackball_.setCollapsed(true);
@@ -151,6 +155,8 @@ void MeshVolumeRenderer::process() {
         }
     }
 
+    flr_->setTiledSorting(tiledSorting_.get());
+
     // Loop: fragment list may need another try if not enough space for the pixels was available
     for (bool success = false; !success;) {
 
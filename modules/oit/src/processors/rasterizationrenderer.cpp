@@ -43,6 +43,7 @@
 #include <inviwo/core/properties/boolproperty.h>           // for BoolProperty
 #include <inviwo/core/properties/cameraproperty.h>         // for CameraProperty
 #include <inviwo/core/properties/invalidationlevel.h>      // for InvalidationLevel
+#include <inviwo/core/properties/optionproperty.h>         // for OptionProperty
 #include <inviwo/core/properties/ordinalproperty.h>        // for FloatProperty, Float...
 #include <inviwo/core/properties/property.h>               // for Property
 #include <inviwo/core/properties/propertysemantics.h>      // for PropertySemantics
@@ -80,11 +81,24 @@ const ProcessorInfo RasterizationRenderer::processorInfo_{
     Tags::GL | Tag{"Rasterization"},     // Tags
     R"(Renderer bringing together several kinds of rasterizations objects.
        Fragment lists are used to render the transparent pixels with correct alpha blending.
-       Illustration effects can be applied as a post-process.)"_unindentHelp};
+       Alternatively weighted blended OIT or a k-buffer can be used, which need a constant amount
+       of memory but only approximate the blending order.
+       Illustration effects can be applied as a post-process to fragment lists.)"_unindentHelp};
 
 const ProcessorInfo& RasterizationRenderer::getProcessorInfo() const { return processorInfo_; }
 
-void RasterizationRenderer::initializeResources() { initializeShader_.invoke(); }
+void RasterizationRenderer::initializeResources() {
+    if (flr_) {
+        auto mode = oitMode_.get();
+        if (!FragmentListRenderer::supportsMode(mode)) {
+            log::warn("{} is not supported by the hardware, using fragment lists instead",
+                      oitMode_.getSelectedDisplayName());
+            mode = FragmentListRenderer::Mode::FragmentList;
+        }
+        flr_->setMode(mode, kBufferLayers_.get());
+    }
+    initializeShader_.invoke();
+}
 
 RasterizationRenderer::RasterizationRenderer()
     : Processor{}
@@ -98,6 +112,29 @@ RasterizationRenderer::RasterizationRenderer()
     , lighting_{"lighting", "Lighting", &camera_}
     , trackball_{&camera_}
     , illustrationSettings_{}
+    , oitMode_{"oitMode",
+               "Transparency",
+               R"(Method used to blend the transparent fragments.
+               * __Fragment Lists__ exact blending, memory usage grows with the number of
+                 fragments and the frame is rendered again if the storage overflows.
+               * __Weighted Blended__ single pass with constant memory, approximates the order
+                 by weighting the fragments by their depth.
+               * __K-Buffer__ sorts the k closest fragments of each pixel and blends the
+                 remaining ones as an unsorted tail, constant memory.)"_unindentHelp,
+               {{"fragmentLists", "Fragment Lists", FragmentListRenderer::Mode::FragmentList},
+                {"weightedBlended", "Weighted Blended",
+                 FragmentListRenderer::Mode::WeightedBlended},
+                {"kBuffer", "K-Buffer", FragmentListRenderer::Mode::KBuffer}},
+               0,
+               InvalidationLevel::InvalidResources}
+    , kBufferLayers_{"kBufferLayers",
+                     "K-Buffer Layers",
+                     "Number of sorted fragments per pixel of the k-buffer"_help,
+                     8,
+                     {1, ConstraintBehavior::Immutable},
+                     {32, ConstraintBehavior::Immutable},
+                     1,
+                     InvalidationLevel::InvalidResources}
     , flr_{[]() -> std::optional<FragmentListRenderer> {
         if (FragmentListRenderer::supportsFragmentLists())
             return std::optional<FragmentListRenderer>{std::in_place};
@@ -122,11 +159,19 @@ RasterizationRenderer::RasterizationRenderer()
     addPort(background_).setOptional(true);
     addPort(outport_);
 
-    addProperties(illustrationSettings_.enabled_, lighting_, camera_, trackball_);
+    addProperties(oitMode_, kBufferLayers_, illustrationSettings_.enabled_, lighting_, camera_,
+                  trackball_);
     camera_.setCollapsed(true);
     trackball_.setCollapsed(true);
 
-    illustrationSettings_.enabled_.setReadOnly(!FragmentListRenderer::supportsIllustration());
+    oitMode_.setReadOnly(!flr_);
+    kBufferLayers_.visibilityDependsOn(oitMode_, [](const auto& p) {
+        return p.get() == FragmentListRenderer::Mode::KBuffer;
+    });
+    illustrationSettings_.enabled_.readonlyDependsOn(oitMode_, [](const auto& p) {
+        return p.get() != FragmentListRenderer::Mode::FragmentList ||
+               !FragmentListRenderer::supportsIllustration();
+    });
 
     if (flr_) {
         flrReload_ = flr_->onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
@@ -176,6 +221,9 @@ RasterizationRenderer::IllustrationSettings::getSettings() const {
 
 void RasterizationRenderer::configureShader(Shader& shader) const {
     utilgl::addDefines(shader, lighting_);
+    if (flr_) {
+        flr_->configureShader(shader);
+    }
 }
 
 void RasterizationRenderer::setUniforms(Shader& shader, UseFragmentList useFragmentList,
@@ -215,7 +263,8 @@ void RasterizationRenderer::process() {
         }
     }
 
-    // Loop: fragment list may need another try if not enough space for the pixels was available
+    // Loop: fragment list may need another try if not enough space for the pixels was available.
+    // The bounded memory modes always succeed in the first pass.
     for (bool success = false; !success;) {
         // prepare fragment list rendering
         flr_->prePass(outport_.getDimensions());
@@ -230,8 +279,10 @@ void RasterizationRenderer::process() {
 
         utilgl::activateTargetAndCopySource(outport_, intermediateImage_);
         // final processing of fragment list rendering
-        const bool useIllustration = illustrationSettings_.enabled_.isChecked() &&
-                                     FragmentListRenderer::supportsIllustration();
+        const bool useIllustration =
+            illustrationSettings_.enabled_.isChecked() &&
+            flr_->getMode() == FragmentListRenderer::Mode::FragmentList &&
+            FragmentListRenderer::supportsIllustration();
         if (useIllustration) {
             flr_->setIllustrationSettings(illustrationSettings_.getSettings());
         }
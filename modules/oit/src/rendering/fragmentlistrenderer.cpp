@@ -43,12 +43,13 @@
 #include <modules/opengl/texture/textureunit.h>           // for TextureUnit, TextureUnitContainer
 #include <modules/opengl/texture/textureutils.h>          // for singleDrawImagePlaneRect, bindA...
 
-#include <algorithm>    // for min
+#include <algorithm>    // for max, min
 #include <ostream>      // for operator<<, char_traits, basic_...
 #include <string_view>  // for string_view
 #include <vector>       // for vector
 
 #include <fmt/core.h>                // for basic_string_view, format
+#include <fmt/format.h>              // for to_string
 #include <fmt/ostream.h>             // for print
 #include <glm/detail/qualifier.hpp>  // for tvec2, tvec4
 #include <glm/vec2.hpp>              // for vec<>::(anonymous), operator!=
@@ -56,6 +57,35 @@
 namespace inviwo {
 class Image;
 
+namespace {
+
+constexpr size_t minFragmentSize = 1024;
+
+/*
+ * Size of the fragment storage for a frame with numFrags fragments. The headroom lets the next
+ * frame contain somewhat more fragments without overflowing the storage.
+ */
+size_t predictFragmentSize(GLuint numFrags) {
+    return std::max(minFragmentSize, static_cast<size_t>(1.25 * numFrags));
+}
+
+void configureMode(ShaderObject& so, FragmentListRenderer::Mode mode, size_t kBufferLayers) {
+    using Mode = FragmentListRenderer::Mode;
+    so.setShaderDefine("OIT_WEIGHTED_BLENDED", mode == Mode::WeightedBlended);
+    so.setShaderDefine("OIT_KBUFFER", mode == Mode::KBuffer);
+    so.setShaderDefine("KBUFFER_SIZE", mode == Mode::KBuffer, fmt::to_string(kBufferLayers));
+    so.setShaderExtension("GL_NV_shader_atomic_int64", ShaderObject::ExtensionBehavior::Enable,
+                          mode == Mode::KBuffer);
+}
+
+void clearBuffer(const BufferObject& buffer, GLuint value) {
+    buffer.bind();
+    glClearBufferData(buffer.getTarget(), GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &value);
+    buffer.unbind();
+}
+
+}  // namespace
+
 FragmentListRenderer::Illustration::Illustration(size2_t screenSize, size_t fragmentSize)
     : index{screenSize, GL_RED, GL_R32F, GL_FLOAT, GL_NEAREST}
     , count{screenSize, GL_RED, GL_R32F, GL_FLOAT, GL_NEAREST}
@@ -85,7 +115,9 @@ FragmentListRenderer::Illustration::Illustration(size2_t screenSize, size_t frag
 
 FragmentListRenderer::FragmentListRenderer()
     : screenSize_{0, 0}
-    , fragmentSize_{1024}
+    , fragmentSize_{minFragmentSize}
+    , mode_{Mode::FragmentList}
+    , kBufferLayers_{8}
 
     , abufferIdxTex_{screenSize_, GL_RED, GL_R32F, GL_FLOAT, GL_NEAREST}
     , textureUnits_{}
@@ -96,6 +128,11 @@ FragmentListRenderer::FragmentListRenderer()
     , totalFragmentQuery_{0}
     , clear_("oit/simplequad.vert", "oit/clear.frag", Shader::Build::No)
     , display_("oit/simplequad.vert", "oit/display.frag", Shader::Build::No)
+    , accumulationBuffer_{sizeof(GLuint), GLFormats::getGLFormat(GL_UNSIGNED_INT, 1),
+                          GL_DYNAMIC_DRAW, GL_SHADER_STORAGE_BUFFER}
+    , kBuffer_{2 * sizeof(GLuint), GLFormats::getGLFormat(GL_UNSIGNED_INT, 2), GL_DYNAMIC_DRAW,
+               GL_SHADER_STORAGE_BUFFER}
+    , resolve_("oit/simplequad.vert", "oit/boundedresolve.frag", Shader::Build::No)
     , illustration_{screenSize_, fragmentSize_} {
 
     LGL_ERROR_CLASS;
@@ -105,6 +142,7 @@ FragmentListRenderer::FragmentListRenderer()
     illustrationOnReload_ = illustration_.onReload.add([this]() { onReload_.invoke(); });
     clear_.onReload([this]() { onReload_.invoke(); });
     display_.onReload([this]() { onReload_.invoke(); });
+    resolve_.onReload([this]() { onReload_.invoke(); });
 
     abufferIdxTex_.initialize(nullptr);
 
@@ -118,9 +156,41 @@ FragmentListRenderer::~FragmentListRenderer() {
     if (totalFragmentQuery_) glDeleteQueries(1, &totalFragmentQuery_);
 }
 
+void FragmentListRenderer::setMode(Mode mode, size_t kBufferLayers) {
+    if (mode_ == mode && kBufferLayers_ == kBufferLayers) return;
+
+    mode_ = mode;
+    kBufferLayers_ = kBufferLayers;
+
+    // release the storage not used by the new mode
+    constexpr auto fit = BufferObject::SizePolicy::ResizeToFit;
+    if (mode_ != Mode::FragmentList) {
+        fragmentSize_ = minFragmentSize;
+        pixelBuffer_.setSizeInBytes(fragmentSize_ * 4 * sizeof(GLfloat), fit);
+    } else {
+        accumulationBuffer_.setSizeInBytes(sizeof(GLuint), fit);
+    }
+    if (mode_ != Mode::KBuffer) {
+        kBuffer_.setSizeInBytes(2 * sizeof(GLuint), fit);
+    }
+
+    buildShaders(builtWithBackground_);
+}
+
+void FragmentListRenderer::configureShader(Shader& shader) const {
+    configureMode(*shader.getFragmentShaderObject(), mode_, kBufferLayers_);
+}
+
 void FragmentListRenderer::prePass(const size2_t& screenSize) {
     resizeBuffers(screenSize);
 
+    if (mode_ != Mode::FragmentList) {
+        clearBuffer(accumulationBuffer_, 0);
+        if (mode_ == Mode::KBuffer) clearBuffer(kBuffer_, 0xffffffff);
+        LGL_ERROR;
+        return;
+    }
+
     // reset counter
     GLuint v[1] = {0};
     atomicCounter_.upload(v, sizeof(GLuint));
@@ -154,6 +224,11 @@ void FragmentListRenderer::beginCount() {
 void FragmentListRenderer::endCount() { glEndQuery(GL_SAMPLES_PASSED); }
 
 bool FragmentListRenderer::postPass(bool useIllustration, const Image* background) {
+    if (mode_ != Mode::FragmentList) {
+        resolveBounded(background);
+        return true;
+    }
+
     // memory barrier
     glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
 
@@ -165,7 +240,7 @@ bool FragmentListRenderer::postPass(bool useIllustration, const Image* backgroun
     // check if enough space was available
     if (numFrags > fragmentSize_) {
         // we have to resize the fragment storage buffer
-        fragmentSize_ = static_cast<size_t>(1.1f * numFrags);
+        fragmentSize_ = predictFragmentSize(numFrags);
 
         // unbind texture
         textureUnits_.clear();
@@ -213,11 +288,58 @@ bool FragmentListRenderer::postPass(bool useIllustration, const Image* backgroun
         illustration_.render(idxUnit, countUnit);
     }
 
+    // Adapt the storage for the next frame, growing before it overflows to avoid rendering twice
+    // and shrinking when most of it is unused.
+    if (const auto predicted = predictFragmentSize(numFrags);
+        predicted > fragmentSize_ || 2 * predicted < fragmentSize_) {
+        fragmentSize_ = predicted;
+    }
+
     return true;  // success, enough storage available
 }
 
+void FragmentListRenderer::resolveBounded(const Image* background) {
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+    if (static_cast<bool>(background) != builtWithBackground_) {
+        buildShaders(background);
+    }
+
+    resolve_.activate();
+    setBoundedUniforms(resolve_);
+    if (builtWithBackground_) {
+        utilgl::bindAndSetUniforms(resolve_, textureUnits_, *background, "bg",
+                                   ImageType::ColorDepth);
+        resolve_.setUniform("reciprocalDimensions", vec2(1) / vec2(screenSize_));
+    }
+    utilgl::BlendModeState blendModeStateGL(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    utilgl::GlBoolState depthTest(GL_DEPTH_TEST, GL_TRUE);
+    utilgl::DepthMaskState depthMask(GL_TRUE);
+    utilgl::DepthFuncState depthFunc(GL_ALWAYS);
+    utilgl::CullFaceState culling(GL_NONE);
+    utilgl::singleDrawImagePlaneRect();
+    resolve_.deactivate();
+
+    textureUnits_.clear();
+}
+
 void FragmentListRenderer::setShaderUniforms(Shader& shader) const {
-    setUniforms(shader, textureUnits_[0]);
+    if (mode_ == Mode::FragmentList) {
+        setUniforms(shader, textureUnits_[0]);
+    } else {
+        setBoundedUniforms(shader);
+    }
+}
+
+void FragmentListRenderer::setBoundedUniforms(Shader& shader) const {
+    accumulationBuffer_.bindBase(8);
+    if (mode_ == Mode::KBuffer) {
+        kBuffer_.bindBase(9);
+    }
+    LGL_ERROR;
+
+    shader.setUniform("AbufferParams.screenWidth", static_cast<GLint>(screenSize_.x));
+    shader.setUniform("AbufferParams.screenHeight", static_cast<GLint>(screenSize_.y));
 }
 
 void FragmentListRenderer::setUniforms(Shader& shader, const TextureUnit& abuffUnit) const {
@@ -267,6 +389,21 @@ bool FragmentListRenderer::supportsIllustration() {
     return support;
 }
 
+bool FragmentListRenderer::supportsMode(Mode mode) {
+    switch (mode) {
+        case Mode::FragmentList:
+        case Mode::WeightedBlended:
+            return supportsFragmentLists();
+        case Mode::KBuffer: {
+            static const bool support =
+                supportsFragmentLists() &&
+                OpenGLCapabilities::isExtensionSupported("GL_NV_shader_atomic_int64");
+            return support;
+        }
+    }
+    return false;
+}
+
 DispatcherHandle<void()> FragmentListRenderer::onReload(std::function<void()> callback) {
     return onReload_.add(callback);
 }
@@ -293,6 +430,18 @@ void FragmentListRenderer::buildShaders(bool hasBackground) {
         dfs->setShaderDefine("BACKGROUND_AVAILABLE", builtWithBackground_);
         display_.build();
         clear_.build();
+
+        if (mode_ != Mode::FragmentList) {
+            auto* rfs = resolve_.getFragmentShaderObject();
+            rfs->clearShaderExtensions();
+            rfs->addShaderExtension("GL_NV_gpu_shader5", true);
+            rfs->addShaderExtension("GL_EXT_shader_image_load_store", true);
+            rfs->addShaderExtension("GL_NV_shader_buffer_load", true);
+            rfs->addShaderExtension("GL_EXT_bindable_uniform", true);
+            configureMode(*rfs, mode_, kBufferLayers_);
+            rfs->setShaderDefine("BACKGROUND_AVAILABLE", builtWithBackground_);
+            resolve_.build();
+        }
     }
 
     if (supportsIllustration()) {
@@ -315,10 +464,20 @@ void FragmentListRenderer::resizeBuffers(const size2_t& screenSize) {
         abufferIdxTex_.resize(screenSize_);
     }
 
+    if (mode_ != Mode::FragmentList) {
+        const auto pixels = screenSize_.x * screenSize_.y;
+        accumulationBuffer_.setSizeInBytes(static_cast<GLsizeiptr>(pixels * 6 * sizeof(GLuint)));
+        if (mode_ == Mode::KBuffer) {
+            kBuffer_.setSizeInBytes(
+                static_cast<GLsizeiptr>(pixels * kBufferLayers_ * sizeof(GLuint64)));
+        }
+        return;
+    }
+
     const auto bufferSize = static_cast<GLsizeiptr>(fragmentSize_ * 4 * sizeof(GLfloat));
     if (pixelBuffer_.getSizeInBytes() != bufferSize) {
-        // create new SSBO for the pixel storage
-        pixelBuffer_.setSizeInBytes(bufferSize);
+        // create new SSBO for the pixel storage, fit to the size to release memory when shrinking
+        pixelBuffer_.setSizeInBytes(bufferSize, BufferObject::SizePolicy::ResizeToFit);
         pixelBuffer_.unbind();
     }
 }
@@ -37,6 +37,7 @@
 #include <modules/opengl/image/imagegl.h>
 #include <modules/opengl/openglcapabilities.h>
 #include <modules/opengl/shader/shaderutils.h>
+#include <modules/opengl/shader/shadertype.h>
 #include <modules/opengl/volume/volumegl.h>
 
 #include <cstdio>
@@ -45,6 +46,13 @@
 
 namespace inviwo {
 
+namespace {
+
+// has to match the work group size of oit/volumesort.comp
+constexpr GLuint sortTileSize = 8;
+
+}  // namespace
+
 VolumeFragmentListRenderer::VolumeFragmentListRenderer()
     : screenSize_{0, 0}
     , fragmentSize_{1024}
@@ -52,13 +60,16 @@ VolumeFragmentListRenderer::VolumeFragmentListRenderer()
     , textureUnits_{}
     , builtWithBackground_{false}
     , numVolumes_{0}
+    , tiledSorting_{true}
+    , builtWithTiledSorting_{true}
     , atomicCounter_{sizeof(GLuint), GLFormats::getGLFormat(GL_UNSIGNED_INT, 1), GL_DYNAMIC_DRAW,
                      GL_ATOMIC_COUNTER_BUFFER}
     , pixelBuffer_{fragmentSize_ * 4 * sizeof(GLfloat), GLFormats::getGLFormat(GL_FLOAT, 4),
                    GL_DYNAMIC_DRAW, GL_SHADER_STORAGE_BUFFER}
     , totalFragmentQuery_{0}
     , clear_("oit/simplequad.vert", "oit/clear.frag", Shader::Build::No)
-    , display_("oit/simplequad.vert", "oit/volumeresolve.frag", Shader::Build::No) {
+    , display_("oit/simplequad.vert", "oit/volumeresolve.frag", Shader::Build::No)
+    , sort_({{ShaderType::Compute, "oit/volumesort.comp"}}, Shader::Build::No) {
 
     LGL_ERROR_CLASS;
 
@@ -66,6 +77,7 @@ VolumeFragmentListRenderer::VolumeFragmentListRenderer()
 
     clear_.onReload([this]() { onReload_.invoke(); });
     display_.onReload([this]() { onReload_.invoke(); });
+    sort_.onReload([this]() { onReload_.invoke(); });
 
     abufferIdxTex_.initialize(nullptr);
 
@@ -138,10 +150,15 @@ bool VolumeFragmentListRenderer::postPass(
 
     // Build shader depending on inport state.
     if (supportsFragmentLists() &&
-        (static_cast<bool>(background) != builtWithBackground_ || numVolumes != numVolumes_)) {
+        (static_cast<bool>(background) != builtWithBackground_ || numVolumes != numVolumes_ ||
+         tiledSorting_ != builtWithTiledSorting_)) {
         buildShaders(background, numVolumes);
     }
 
+    if (tiledSorting_) {
+        sortFragments();
+    }
+
     if (!useIllustration) {
         // render fragment list
         display_.activate();
@@ -174,6 +191,19 @@ bool VolumeFragmentListRenderer::postPass(
     return true;  // success, enough storage available
 }
 
+void VolumeFragmentListRenderer::sortFragments() {
+    sort_.activate();
+    setUniforms(sort_, textureUnits_[0]);
+
+    const auto groups = (uvec2{screenSize_} + (sortTileSize - 1)) / sortTileSize;
+    glDispatchCompute(groups.x, groups.y, 1);
+    sort_.deactivate();
+
+    // the resolve pass reads the relinked lists and the new list heads
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+    LGL_ERROR;
+}
+
 void VolumeFragmentListRenderer::setShaderUniforms(Shader& shader) const {
     setUniforms(shader, textureUnits_[0]);
 }
@@ -221,6 +251,7 @@ DispatcherHandle<void()> VolumeFragmentListRenderer::onReload(std::function<void
 void VolumeFragmentListRenderer::buildShaders(bool hasBackground, int numVolumes) {
     builtWithBackground_ = hasBackground;
     numVolumes_ = numVolumes;
+    builtWithTiledSorting_ = tiledSorting_;
     auto* dfs = display_.getFragmentShaderObject();
     dfs->clearShaderExtensions();
 
@@ -239,12 +270,23 @@ void VolumeFragmentListRenderer::buildShaders(bool hasBackground, int numVolumes
         cfs->addShaderExtension("GL_EXT_bindable_uniform", true);
 
         dfs->setShaderDefine("BACKGROUND_AVAILABLE", builtWithBackground_);
+        dfs->setShaderDefine("PRESORTED_FRAGMENTS", builtWithTiledSorting_);
 
         StrBuffer buf;
         dfs->addShaderDefine("MAX_SUPPORTED_VOLUMES", buf.replace("{}", numVolumes_));
 
         display_.build();
         clear_.build();
+
+        if (builtWithTiledSorting_) {
+            auto* sso = sort_.getComputeShaderObject();
+            sso->clearShaderExtensions();
+            sso->addShaderExtension("GL_NV_gpu_shader5", true);
+            sso->addShaderExtension("GL_EXT_shader_image_load_store", true);
+            sso->addShaderExtension("GL_NV_shader_buffer_load", true);
+            sso->addShaderExtension("GL_EXT_bindable_uniform", true);
+            sort_.build();
+        }
     }
 }
 
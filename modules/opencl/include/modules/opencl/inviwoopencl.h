@@ -38,6 +38,7 @@
 #include <modules/opencl/openclmoduledefine.h>
 
 #include <filesystem>
+#include <memory>
 #include <string>
 
 #if defined(CL_VERSION_1_2)
@@ -108,12 +109,15 @@ namespace inviwo {
 #endif
 */
 
+class ProgramBinaryCache;
+
 /** \class OpenCL
  * Singleton class that manages OpenCL context and queues.
  */
 class IVW_MODULE_OPENCL_API OpenCL : public Singleton<OpenCL> {
 public:
     OpenCL();
+    ~OpenCL();
     OpenCL(OpenCL const&) = delete;
     void operator=(OpenCL const&) = delete;
 
@@ -148,6 +152,12 @@ public:
      */
     void setDevice(cl::Device device, bool glSharing);
 
+    /**
+     * Build the program in @p fileName for the device of @p queue, or the default queue.
+     * Programs are loaded from the binary cache when possible, and stored in it after being
+     * built from source. Thread safe, independent programs can be built concurrently.
+     * @see getBinaryCache
+     */
     static cl::Program buildProgram(const std::filesystem::path& fileName,
                                     const std::string& header = "",
                                     const std::string& defines = "");
@@ -211,6 +221,19 @@ public:
 
     bool isOpenGLSharingEnabled() const;
 
+    /**
+     * True if the device supports cl_khr_gl_event, i.e. acquiring and releasing shared objects
+     * implicitly synchronizes with the OpenGL context, see SyncCLGL.
+     */
+    bool isGLEventSupported() const { return glEventSupported_; }
+
+    /**
+     * The on-disk cache of program binaries used by buildProgram, nullptr if disabled.
+     * @see OpenCLSettings
+     */
+    ProgramBinaryCache* getBinaryCache() const;
+    void setBinaryCacheEnabled(bool enabled);
+
     /**
      * /brief Get the device that has most compute units.
      * Search priority:
@@ -244,8 +267,12 @@ private:
     cl::Context gpuContext_;
     /// Default device associated with queues and device
     cl::Device gpuDevice_;
+    /// Device supports cl_khr_gl_event and the context shares objects with OpenGL
+    bool glEventSupported_ = false;
     // Include directories define
     std::vector<std::filesystem::path> includeDirectories_;
+    std::unique_ptr<ProgramBinaryCache> binaryCache_;
+    bool binaryCacheEnabled_ = true;
 
     friend Singleton<OpenCL>;
     static OpenCL* instance_;
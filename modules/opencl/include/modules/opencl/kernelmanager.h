@@ -37,6 +37,8 @@
 #include <modules/opencl/kernelowner.h>
 #include <map>
 #include <filesystem>
+#include <string>
+#include <vector>
 
 namespace inviwo {
 
@@ -45,9 +47,9 @@ class IVW_MODULE_OPENCL_API KernelManager : public Singleton<KernelManager>, pub
      *
      * Manages building of OpenCL programs and kernels.
      * Reloads and builds program when file changes. Notifies processor when the program has been
-     * rebuilt.
+     * rebuilt. Independent programs are built concurrently, and built programs are cached on disk,
+     * see OpenCL::buildProgram.
      */
-    // TODO: Parallel building of program.
     // TODO: Make sure that processor is not evaluated while building or build failed.
 public:
     // Multiple programs can be created from the same file but with different defines
@@ -64,6 +66,12 @@ public:
                                                                       ///< enables invalidation of
                                                                       ///< owner when kernel changed
 
+    struct ProgramSource {
+        std::filesystem::path fileName;
+        std::string header;
+        std::string defines;
+    };
+
     KernelManager();
     virtual ~KernelManager();
 
@@ -89,6 +97,16 @@ public:
         return buildProgram(fileName, header, defines, wasBuilt);
     }
 
+    /**
+     * Creates and builds several OpenCL programs at once, see buildProgram. Programs that have
+     * not been built before are built concurrently. Use it to build all the programs of a module
+     * or processor up front instead of one at a time.
+     * @note KernelManager manages pointer memory, do not delete them.
+     * @return Pointers to the programs in the order of @p sources, no matter if they were
+     * successfully built or not. Do not delete them.
+     */
+    std::vector<cl::Program*> buildPrograms(const std::vector<ProgramSource>& sources);
+
     /**
      * Creates a kernel from a previously created cl::Program.
      * Makes sure that it is up to date when program is rebuilt.
@@ -117,6 +135,10 @@ public:
     void clear();
 
 private:
+    static std::filesystem::path findFile(const std::filesystem::path& fileName);
+    cl::Program* findProgram(const std::filesystem::path& absoluteFileName,
+                             const std::string& defines) const;
+
     ProgramMap programs_;
     KernelMap kernels_;
     KernelOwnerMap kernelOwners_;
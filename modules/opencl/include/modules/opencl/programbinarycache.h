@@ -0,0 +1,88 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/opencl/openclmoduledefine.h>
+#include <modules/opencl/cl.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace inviwo {
+
+/**
+ * An on-disk cache of built OpenCL program binaries, see CL_PROGRAM_BINARIES. A program is stored
+ * under a key computed from its source, including all included files, the build options, and the
+ * name, vendor, and driver version of the device. Hence any change to a kernel file, define, or
+ * the driver results in a new key and the old binary is simply never used again. A binary that
+ * fails to build is removed and the program has to be built from source as usual.
+ * Loading and storing different keys is thread safe.
+ * @see OpenCL::buildProgram OpenCL::getBinaryCache
+ */
+class IVW_MODULE_OPENCL_API ProgramBinaryCache {
+public:
+    explicit ProgramBinaryCache(std::filesystem::path directory);
+
+    /**
+     * Compute the key for a program built for @p device from a description of its sources. The
+     * description should contain everything that affects the built program.
+     */
+    std::uint64_t key(const cl::Device& device, std::string_view description) const;
+
+    /**
+     * Try to create and build the program for @p key from the cached binary.
+     * @return the built program, std::nullopt if there is no usable binary.
+     */
+    std::optional<cl::Program> load(const cl::Context& context, const cl::Device& device,
+                                    std::uint64_t key, const std::string& options) const;
+
+    /**
+     * Store the binary of the built single device @p program under @p key. Failures are only
+     * logged.
+     */
+    void store(const cl::Program& program, std::uint64_t key) const;
+
+    /**
+     * Remove all cached binaries
+     */
+    void clear() const;
+
+    const std::filesystem::path& getDirectory() const;
+
+private:
+    std::filesystem::path file(std::uint64_t key) const;
+
+    std::filesystem::path directory_;
+};
+
+}  // namespace inviwo
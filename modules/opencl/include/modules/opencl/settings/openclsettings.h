@@ -51,6 +51,8 @@ protected:
 private:
     OptionPropertyInt openCLDeviceProperty_;  // List of devices
     BoolProperty enableOpenGLSharing_;
+    BoolProperty programBinaryCache_;
+    ButtonProperty clearProgramBinaryCache_;
     ButtonProperty btnOpenCLInfo_;
 };
 
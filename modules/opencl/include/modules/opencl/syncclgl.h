@@ -51,20 +51,32 @@ typedef cl_event (*pfnclCreateEventFromSyncKHR)(cl_context context, cl_GLsync sy
 namespace inviwo {
 /** \class SyncCLGL
  * Helper for synchronizing OpenGL and OpenCL.
- * Calls glFinish(), or glFenceSync if supported, upon construction.
- * Releases all objects and calls clFinish,
- * or glWaitSync if supported, on the supplied queue upon destruction.
+ *
+ * Objects added to the acquire list are acquired together in aquireAllObjects and released
+ * together upon destruction. How OpenGL and OpenCL are synchronized depends on the device:
+ *  1. With cl_khr_gl_event, acquiring and releasing implicitly orders the OpenCL commands with
+ *     the OpenGL commands of the current context, no extra synchronization is needed.
+ *  2. Otherwise, if clCreateEventFromGLsyncKHR and glCreateSyncFromCLeventARB exist, a
+ *     glFenceSync is waited for when acquiring and glWaitSync is called after releasing.
+ *  3. Otherwise glFinish is called before acquiring and clFinish after releasing.
+ * The synchronization is only done if there is anything to acquire.
+ *
+ * SyncCLGL objects can be nested on the same queue. The outermost one then owns all
+ * acquisitions: objects it already holds are not acquired again, new objects acquired by an
+ * inner SyncCLGL are kept acquired until the outermost one is destroyed. Wrap a chain of OpenCL
+ * operations in one SyncCLGL to only synchronize once for the whole chain.
  */
 class IVW_MODULE_OPENCL_API SyncCLGL {
 public:
     /**
      * \brief Start synchronization of shared OpenGL and OpenCL objects
      *
-     * Calls glFinish(), or glFenceSync if supported
-     *
+     * Nothing is synchronized until aquireAllObjects is called.
      */
     SyncCLGL(const cl::Context& context = OpenCL::getPtr()->getContext(),
              const cl::CommandQueue& queue = OpenCL::getPtr()->getQueue());
+    SyncCLGL(const SyncCLGL&) = delete;
+    SyncCLGL& operator=(const SyncCLGL&) = delete;
     ~SyncCLGL();
 
     /**
@@ -99,7 +111,8 @@ public:
 
     /**
      * Call this function after adding objects to synchronize using addToAquireGLObjectList
-     * Calls enqueueAcquireGLObjects on all previously added objects.
+     * Calls enqueueAcquireGLObjects once for all previously added objects that are not already
+     * acquired by this or an enclosing SyncCLGL.
      * Will wait for provided events.
      * @note While you manually need to call aquireAllObjects, you do not need to call
      * releaseAllGLObjects as this will be done upon destruction of this object.
@@ -108,16 +121,29 @@ public:
                           cl::Event* event = nullptr) const;
 
     /**
-     * Release all added objects. Done automatically at destruction.
-     * Will wait for provided events.
+     * Release all acquired objects. Done automatically at destruction.
+     * Will wait for provided events. Does nothing for a SyncCLGL enclosed in another one on the
+     * same queue, the outermost SyncCLGL releases all objects.
      * @note You do not need to call releaseAllGLObjects as this
      * will be done upon destruction of this object.
      */
     void releaseAllGLObjects(const std::vector<cl::Event>* waitForEvents = nullptr,
                              cl::Event* event = nullptr);
 
+    /**
+     * True if the object is currently acquired by this SyncCLGL or an enclosing one.
+     */
+    bool isAcquired(const cl::Memory& object) const;
+
 protected:
-    std::vector<cl::Memory> syncedObjects_;
+    enum class Sync { Implicit, Fence, Finish };
+    Sync getSync() const;
+    const SyncCLGL& outermost() const;
+
+    /// Objects added since the last call to aquireAllObjects
+    mutable std::vector<cl::Memory> pendingObjects_;
+    /// Objects acquired and not yet released, only used by the outermost SyncCLGL
+    mutable std::vector<cl::Memory> syncedObjects_;
 #if defined(CL_VERSION_1_1)
 #include <warn/push>
 #include <warn/ignore/ignored-attributes>
@@ -126,11 +152,18 @@ protected:
     // Store clCreateEventFromGLsync function per context
     // so that we only need to get them once
     static std::map<cl_context, pfnclCreateEventFromSyncKHR> syncFunctionMap_;
-    GLsync glFenceSync_;  // OpenGL sync point - created in constructor
+    /// OpenGL sync points waited for when acquiring, deleted after releasing
+    mutable std::vector<GLsync> fences_;
 #include <warn/pop>
 #endif
     const cl::Context& context_;
     const cl::CommandQueue& queue_;
+    /// Enclosing SyncCLGL on the same queue, if any
+    SyncCLGL* parent_;
+    /// Enclosing SyncCLGL on any queue, restored as current_ upon destruction
+    SyncCLGL* previous_;
+    /// Innermost SyncCLGL of the calling thread
+    static thread_local SyncCLGL* current_;
 };
 
 }  // namespace inviwo
@@ -43,6 +43,7 @@ namespace inviwo {
 class IVW_MODULE_OPENCL_API VolumeCLGL2RAMConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeCLGL, VolumeRAM> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<VolumeRAM> createFrom(
         std::shared_ptr<const VolumeCLGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeCLGL> source,
@@ -52,6 +53,7 @@ public:
 class IVW_MODULE_OPENCL_API VolumeGL2CLGLConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeGL, VolumeCLGL> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<VolumeCLGL> createFrom(
         std::shared_ptr<const VolumeGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeGL> source,
@@ -61,6 +63,7 @@ public:
 class IVW_MODULE_OPENCL_API VolumeCLGL2CLConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeCLGL, VolumeCL> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<VolumeCL> createFrom(
         std::shared_ptr<const VolumeCLGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeCLGL> source,
@@ -70,6 +73,7 @@ public:
 class IVW_MODULE_OPENCL_API VolumeCLGL2GLConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeCLGL, VolumeGL> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<VolumeGL> createFrom(
         std::shared_ptr<const VolumeCLGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeCLGL> source,
@@ -33,6 +33,7 @@
 #include <modules/opencl/openclcapabilities.h>
 #include <modules/opencl/openclexception.h>
 #include <modules/opencl/openclformatexception.h>
+#include <modules/opencl/programbinarycache.h>
 #include <modules/opencl/syncclgl.h>
 #include <inviwo/core/io/textfilereader.h>
 #include <inviwo/core/util/logcentral.h>
@@ -41,6 +42,9 @@
 #include <sstream>
 #include <stdio.h>
 #include <fstream>
+#include <algorithm>
+#include <iterator>
+#include <string_view>
 #if !(WIN32 || __APPLE__)  // LINUX
 #include <GL/glx.h>        // glXCurrentContext()
 #endif
@@ -54,7 +58,19 @@ namespace inviwo {
 
 OpenCL* OpenCL::instance_ = nullptr;
 
-OpenCL::OpenCL() { initialize(true); }
+OpenCL::OpenCL()
+    : binaryCache_{
+          std::make_unique<ProgramBinaryCache>(filesystem::getPath(PathType::Cache) / "opencl")} {
+    initialize(true);
+}
+
+OpenCL::~OpenCL() = default;
+
+ProgramBinaryCache* OpenCL::getBinaryCache() const {
+    return binaryCacheEnabled_ ? binaryCache_.get() : nullptr;
+}
+
+void OpenCL::setBinaryCacheEnabled(bool enabled) { binaryCacheEnabled_ = enabled; }
 
 void OpenCL::initialize(bool glSharing) {
     try {
@@ -264,6 +280,49 @@ std::vector<cl::Device> OpenCL::getAllDevices() {
     return allDevices;
 }
 
+namespace {
+
+/**
+ * Append the path and contents of every file included by @p source, recursively. Includes are
+ * resolved against @p dir first and then the common include directories, just like the compiler.
+ */
+void appendIncludedFiles(std::string& description, std::string_view source,
+                         const std::filesystem::path& dir,
+                         const std::vector<std::filesystem::path>& includeDirs,
+                         std::vector<std::filesystem::path>& visited) {
+    size_t pos = 0;
+    while ((pos = source.find("#include", pos)) != std::string_view::npos) {
+        pos += 8;
+        const auto begin = source.find_first_of("\"<\n", pos);
+        if (begin == std::string_view::npos || source[begin] == '\n') continue;
+        const auto end = source.find_first_of(source[begin] == '<' ? ">\n" : "\"\n", begin + 1);
+        if (end == std::string_view::npos || source[end] == '\n') continue;
+        const std::filesystem::path name{source.substr(begin + 1, end - begin - 1)};
+        pos = end;
+
+        std::filesystem::path file = dir / name;
+        for (auto it = includeDirs.begin(); !std::filesystem::is_regular_file(file); ++it) {
+            if (it == includeDirs.end()) {
+                file.clear();
+                break;
+            }
+            file = *it / name;
+        }
+        if (file.empty()) continue;
+        file = file.lexically_normal();
+        if (std::find(visited.begin(), visited.end(), file) != visited.end()) continue;
+        visited.push_back(file);
+
+        std::ifstream in{file, std::ios::binary};
+        const std::string contents{std::istreambuf_iterator<char>{in},
+                                   std::istreambuf_iterator<char>{}};
+        description.append(file.generic_string()).append("\n").append(contents);
+        appendIncludedFiles(description, contents, file.parent_path(), includeDirs, visited);
+    }
+}
+
+}  // namespace
+
 cl::Program OpenCL::buildProgram(const std::filesystem::path& fileName, const std::string& header,
                                  const std::string& defines, const cl::CommandQueue& queue) {
     cl::Context context = queue.getInfo<CL_QUEUE_CONTEXT>();
@@ -305,6 +364,21 @@ cl::Program OpenCL::buildProgram(const std::filesystem::path& fileName, const st
         prog.insert(offset, header);
     }
     std::string concatenatedDefines = OpenCL::getPtr()->getIncludeDefine() + defines;
+
+    auto* cache = OpenCL::getPtr()->getBinaryCache();
+    std::uint64_t key = 0;
+    if (cache) {
+        // Included files are not part of the source, but affect the binary all the same
+        std::string description = concatenatedDefines + '\n' + prog;
+        std::vector<std::filesystem::path> visited;
+        appendIncludedFiles(description, prog, fileName.parent_path(),
+                            OpenCL::getPtr()->getCommonIncludeDirectories(), visited);
+        key = cache->key(device, description);
+        if (auto cached = cache->load(context, device, key, concatenatedDefines)) {
+            return *std::move(cached);
+        }
+    }
+
     cl::Program::Sources source(1, std::make_pair(prog.c_str(), prog.length() + 1));
     cl::Program program(context, source);
 
@@ -319,6 +393,7 @@ cl::Program OpenCL::buildProgram(const std::filesystem::path& fileName, const st
         OpenCL::printBuildError(std::vector<cl::Device>(1, device), program, fileName);
         throw e;
     }
+    if (cache) cache->store(program, key);
 
     return program;
 }
@@ -419,11 +494,9 @@ void OpenCL::setDevice(cl::Device device, bool glSharing) {
 
         asyncGPUQueue_ = cl::CommandQueue(gpuContext_, gpuDevice_, queueProperties);
         STRING_CLASS deviceExtensions = gpuDevice_.getInfo<CL_DEVICE_EXTENSIONS>();
-        size_t foundAt = deviceExtensions.find_first_of("cl_khr_gl_event");
-
-        if (foundAt != std::string::npos) {
-            // Efficient cl/gl synchronization possible
-        }
+        // Efficient cl/gl synchronization possible
+        glEventSupported_ = isOpenGLSharingEnabled() &&
+                            deviceExtensions.find("cl_khr_gl_event") != std::string::npos;
     } catch (cl::Error& err) {
         LogError("Failed to set OpenCL device. " << err.what() << "(" << err.err() << "), "
                                                  << errorCodeToString(err.err()) << std::endl);
@@ -33,6 +33,11 @@
 #include <inviwo/core/util/filesystem.h>
 #include <modules/opengl/openglmodule.h>
 #include <modules/opencl/kernelowner.h>
+#include <inviwo/core/util/parallel.h>
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
 
 namespace inviwo {
 
@@ -42,60 +47,108 @@ KernelManager::KernelManager() : FileObserver{InviwoApplication::getPtr()} {}
 
 KernelManager::~KernelManager() { clear(); }
 
-cl::Program* KernelManager::buildProgram(const std::filesystem::path& fileName,
-                                         const std::string& header /*= ""*/,
-                                         const std::string& defines /*= ""*/, bool& wasBuilt) {
-    wasBuilt = false;
-    std::filesystem::path absoluteFileName = fileName;
-    if (!std::filesystem::is_regular_file(absoluteFileName)) {
+std::filesystem::path KernelManager::findFile(const std::filesystem::path& fileName) {
+    if (!std::filesystem::is_regular_file(fileName)) {
         // Search in include directories added by modules
         const std::vector<std::filesystem::path> openclSearchPaths =
             OpenCL::getPtr()->getCommonIncludeDirectories();
 
         for (size_t i = 0; i < openclSearchPaths.size(); i++) {
             if (std::filesystem::is_regular_file(openclSearchPaths[i] / fileName)) {
-                absoluteFileName = openclSearchPaths[i] / fileName;
-                break;
+                return openclSearchPaths[i] / fileName;
             }
         }
     }
+    return fileName;
+}
 
-    std::pair<ProgramMap::iterator, ProgramMap::iterator> range =
-        programs_.equal_range(absoluteFileName);
-
-    for (ProgramMap::iterator it = range.first; it != range.second; ++it) {
-        if (it->second.defines == defines) {
-            return it->second.program;
-        }
+cl::Program* KernelManager::findProgram(const std::filesystem::path& absoluteFileName,
+                                        const std::string& defines) const {
+    auto range = programs_.equal_range(absoluteFileName);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.defines == defines) return it->second.program;
     }
+    return nullptr;
+}
 
-    cl::Program* program = new cl::Program();
+cl::Program* KernelManager::buildProgram(const std::filesystem::path& fileName,
+                                         const std::string& header /*= ""*/,
+                                         const std::string& defines /*= ""*/, bool& wasBuilt) {
+    const auto absoluteFileName = findFile(fileName);
+    if (auto* program = findProgram(absoluteFileName, defines)) {
+        wasBuilt = false;
+        return program;
+    }
+    wasBuilt = true;
+    return buildPrograms({ProgramSource{fileName, header, defines}}).front();
+}
 
-    try {
-        *program = cl::Program(OpenCL::buildProgram(absoluteFileName, header, defines));
+std::vector<cl::Program*> KernelManager::buildPrograms(const std::vector<ProgramSource>& sources) {
+    std::vector<cl::Program*> result(sources.size(), nullptr);
+
+    // Find the programs that are not built yet, only build each unique one once
+    struct Build {
+        std::filesystem::path file;
+        const ProgramSource* source;
+        std::optional<cl::Program> program;
+    };
+    std::vector<Build> builds;
+    std::vector<size_t> buildIndex(sources.size(), 0);
+    for (size_t i = 0; i < sources.size(); ++i) {
+        auto file = findFile(sources[i].fileName);
+        if ((result[i] = findProgram(file, sources[i].defines))) continue;
+        auto it = std::find_if(builds.begin(), builds.end(), [&](const Build& b) {
+            return b.file == file && b.source->defines == sources[i].defines;
+        });
+        buildIndex[i] = static_cast<size_t>(std::distance(builds.begin(), it));
+        if (it == builds.end()) builds.push_back({std::move(file), &sources[i], std::nullopt});
+    }
 
-        try {
-            std::vector<cl::Kernel> kernels;
-            program->createKernels(&kernels);
+    // Programs are independent, build them concurrently. Build errors are logged by
+    // OpenCL::buildProgram
+    util::parallelFor(
+        size_t{0}, builds.size(),
+        [&](size_t i) {
+            try {
+                builds[i].program = OpenCL::buildProgram(
+                    builds[i].file, builds[i].source->header, builds[i].source->defines);
+            } catch (cl::Error&) {
+            }
+        },
+        {.grainSize = 1});
+
+    std::vector<cl::Program*> built(builds.size(), nullptr);
+    for (size_t i = 0; i < builds.size(); ++i) {
+        auto& build = builds[i];
+        cl::Program* program = new cl::Program();
+        if (build.program) {
+            *program = *std::move(build.program);
+            try {
+                std::vector<cl::Kernel> kernels;
+                program->createKernels(&kernels);
 
-            for (std::vector<cl::Kernel>::iterator kernelIt = kernels.begin();
-                 kernelIt != kernels.end(); ++kernelIt) {
-                kernels_.insert(
-                    std::pair<cl::Program*, cl::Kernel*>(program, new cl::Kernel(*kernelIt)));
+                for (std::vector<cl::Kernel>::iterator kernelIt = kernels.begin();
+                     kernelIt != kernels.end(); ++kernelIt) {
+                    kernels_.insert(
+                        std::pair<cl::Program*, cl::Kernel*>(program, new cl::Kernel(*kernelIt)));
+                }
+            } catch (cl::Error& err) {
+                LogError(build.file << " Failed to create kernels, Error:" << err.what() << "("
+                                    << err.err() << "), " << errorCodeToString(err.err())
+                                    << std::endl);
             }
-        } catch (cl::Error& err) {
-            LogError(absoluteFileName << " Failed to create kernels, Error:" << err.what() << "("
-                                      << err.err() << "), " << errorCodeToString(err.err())
-                                      << std::endl);
         }
-    } catch (cl::Error&) {
+
+        ProgramIdentifier uniqueProgram{program, build.source->header, build.source->defines};
+        programs_.emplace(build.file, uniqueProgram);
+        startFileObservation(build.file);
+        built[i] = program;
     }
 
-    ProgramIdentifier uniqueProgram{program, header, defines};
-    programs_.emplace(absoluteFileName, uniqueProgram);
-    startFileObservation(absoluteFileName);
-    wasBuilt = true;
-    return program;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        if (!result[i]) result[i] = built[buildIndex[i]];
+    }
+    return result;
 }
 
 cl::Kernel* KernelManager::getKernel(cl::Program* program, const std::string& kernelName,
@@ -122,8 +175,24 @@ void KernelManager::fileChanged(const std::filesystem::path& fileName) {
     std::pair<ProgramMap::iterator, ProgramMap::iterator> programRange =
         programs_.equal_range(fileName);
 
-    for (ProgramMap::iterator programIt = programRange.first; programIt != programRange.second;
-         ++programIt) {
+    // Rebuild all variants of the program concurrently
+    std::vector<ProgramMap::iterator> programIts;
+    for (auto it = programRange.first; it != programRange.second; ++it) programIts.push_back(it);
+    std::vector<std::optional<cl::Program>> rebuilt(programIts.size());
+    LogInfo(fileName.string() << " building " << programIts.size() << " program(s)");
+    util::parallelFor(
+        size_t{0}, programIts.size(),
+        [&](size_t i) {
+            try {
+                rebuilt[i] = OpenCL::buildProgram(fileName, programIts[i]->second.header,
+                                                  programIts[i]->second.defines);
+            } catch (cl::Error&) {
+            }
+        },
+        {.grainSize = 1});
+
+    for (size_t programIndex = 0; programIndex < programIts.size(); ++programIndex) {
+        auto programIt = programIts[programIndex];
         cl::Program* program = programIt->second.program;
         // Get all kernels associated with the program
         std::pair<KernelMap::iterator, KernelMap::iterator> kernelRange =
@@ -142,12 +211,11 @@ void KernelManager::fileChanged(const std::filesystem::path& fileName) {
             kernelNames.push_back(thisKernelName);
         }
 
+        // Build errors have already been logged
+        if (!rebuilt[programIndex]) continue;
+
         try {
-            LogInfo(fileName.string() +
-                    " building program with defines: " + programIt->second.defines);
-            *program =
-                OpenCL::buildProgram(fileName, programIt->second.header, programIt->second.defines);
-            LogInfo(fileName.string() + " finished building program");
+            *program = *std::move(rebuilt[programIndex]);
             std::vector<cl::Kernel> newKernels;
 
             try {
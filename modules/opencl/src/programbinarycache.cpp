@@ -0,0 +1,171 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/opencl/programbinarycache.h>
+
+#include <inviwo/core/util/constexprhash.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <fstream>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::uint32_t magic = 0x42435649;  // "IVCB"
+
+struct Header {
+    std::uint32_t magic;
+    std::uint32_t reserved;
+    std::uint64_t key;
+    std::uint64_t size;
+};
+
+}  // namespace
+
+ProgramBinaryCache::ProgramBinaryCache(std::filesystem::path directory)
+    : directory_{std::move(directory)} {}
+
+std::uint64_t ProgramBinaryCache::key(const cl::Device& device,
+                                      std::string_view description) const {
+    const auto platform = cl::Platform{device.getInfo<CL_DEVICE_PLATFORM>()};
+    auto str = fmt::format("{}\n{}\n{}\n{}\n{}\n", device.getInfo<CL_DEVICE_NAME>(),
+                           device.getInfo<CL_DEVICE_VENDOR>(), device.getInfo<CL_DEVICE_VERSION>(),
+                           device.getInfo<CL_DRIVER_VERSION>(),
+                           platform.getInfo<CL_PLATFORM_VERSION>());
+    return util::constexpr_hash(str.append(description));
+}
+
+std::optional<cl::Program> ProgramBinaryCache::load(const cl::Context& context,
+                                                    const cl::Device& device, std::uint64_t key,
+                                                    const std::string& options) const {
+    const auto path = file(key);
+    std::ifstream in{path, std::ios::binary};
+    if (!in) return std::nullopt;
+
+    Header header{};
+    in.read(reinterpret_cast<char*>(&header), sizeof(Header));
+    std::vector<char> binary;
+    if (in && header.magic == magic && header.key == key) {
+        binary.resize(header.size);
+        in.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+    }
+    in.close();
+
+    if (!binary.empty() && in) {
+        try {
+            const cl::Program::Binaries binaries(1, std::make_pair(binary.data(), binary.size()));
+            cl::Program program(context, std::vector<cl::Device>(1, device), binaries);
+            // Binaries still need to be built, which is mostly a no-op for device binaries
+            program.build(std::vector<cl::Device>(1, device), options.c_str());
+            return program;
+        } catch (cl::Error&) {
+        }
+    }
+
+    // A truncated file, or a binary the driver no longer accepts, e.g. after an update that did
+    // not change the version string
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    return std::nullopt;
+}
+
+void ProgramBinaryCache::store(const cl::Program& program, std::uint64_t key) const {
+    std::vector<::size_t> sizes;
+    std::vector<char*> binaries;
+    try {
+        sizes = program.getInfo<CL_PROGRAM_BINARY_SIZES>();
+        binaries = program.getInfo<CL_PROGRAM_BINARIES>();
+    } catch (cl::Error&) {
+    }
+    const auto release = [&]() {
+        for (auto* binary : binaries) delete[] binary;
+    };
+    if (binaries.size() != 1 || sizes.size() != 1 || sizes[0] == 0 || !binaries[0]) {
+        release();
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    if (ec) {
+        log::warn("Unable to create OpenCL program cache {:?g}: {}", directory_, ec.message());
+        release();
+        return;
+    }
+
+    const Header header{magic, 0, key, static_cast<std::uint64_t>(sizes[0])};
+
+    // Write to a temporary file and rename it so that other running instances, or other threads
+    // building the same program, never read a partially written binary
+    const auto path = file(key);
+    auto tmp = path;
+    tmp += fmt::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+        std::ofstream out{tmp, std::ios::binary | std::ios::trunc};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        out.write(binaries[0], static_cast<std::streamsize>(sizes[0]));
+        if (!out) {
+            log::warn("Unable to write OpenCL program binary {:?g}", tmp);
+            out.close();
+            std::filesystem::remove(tmp, ec);
+            release();
+            return;
+        }
+    }
+    release();
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) std::filesystem::remove(tmp, ec);
+}
+
+void ProgramBinaryCache::clear() const {
+    std::error_code ec;
+    const auto removed = std::filesystem::remove_all(directory_, ec);
+    if (ec) {
+        log::warn("Unable to clear OpenCL program cache {:?g}: {}", directory_, ec.message());
+    } else {
+        log::info("Removed {} cached OpenCL program binaries", removed > 0 ? removed - 1 : 0);
+    }
+}
+
+const std::filesystem::path& ProgramBinaryCache::getDirectory() const { return directory_; }
+
+std::filesystem::path ProgramBinaryCache::file(std::uint64_t key) const {
+    return directory_ / fmt::format("{:016x}.bin", key);
+}
+
+}  // namespace inviwo
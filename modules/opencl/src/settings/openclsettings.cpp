@@ -32,6 +32,8 @@
 #include <modules/opencl/openclcapabilities.h>
 #include <modules/opencl/inviwoopencl.h>
 #include <modules/opencl/kernelmanager.h>
+#include <modules/opencl/programbinarycache.h>
+#include <inviwo/core/algorithm/markdown.h>
 
 namespace inviwo {
 
@@ -39,6 +41,11 @@ OpenCLSettings::OpenCLSettings(OpenCLCapabilities* openclInfo)
     : Settings("OpenCL Settings")
     , openCLDeviceProperty_("openCLDevice", "Default device")
     , enableOpenGLSharing_("glsharing", "Enable OpenGL sharing", true)
+    , programBinaryCache_("programBinaryCache", "Cache Program Binaries",
+                          "Store built OpenCL programs on disk and reuse them when the same "
+                          "kernels are built again with the same device and driver"_help,
+                          true)
+    , clearProgramBinaryCache_("clearProgramBinaryCache", "Clear Program Binary Cache")
     , btnOpenCLInfo_("printOpenCLInfo", "Print OpenCL Info") {
 
     std::vector<cl::Device> devices = OpenCL::getAllDevices();
@@ -60,6 +67,14 @@ OpenCLSettings::OpenCLSettings(OpenCLCapabilities* openclInfo)
     openCLDeviceProperty_.onChange([this]() { changeDevice(); });
     enableOpenGLSharing_.onChange([this]() { changeDevice(); });
 
+    addProperty(programBinaryCache_);
+    addProperty(clearProgramBinaryCache_);
+    programBinaryCache_.onChange(
+        [this]() { OpenCL::getPtr()->setBinaryCacheEnabled(programBinaryCache_.get()); });
+    clearProgramBinaryCache_.onChange([]() {
+        if (auto* cache = OpenCL::getPtr()->getBinaryCache()) cache->clear();
+    });
+
     addProperty(btnOpenCLInfo_);
 
     if (openclInfo) {
@@ -67,6 +82,7 @@ OpenCLSettings::OpenCLSettings(OpenCLCapabilities* openclInfo)
     }
 
     load();
+    OpenCL::getPtr()->setBinaryCacheEnabled(programBinaryCache_.get());
 }
 
 void OpenCLSettings::changeDevice() {
@@ -27,9 +27,12 @@
  *
  *********************************************************************************/
 
+
 #include <modules/opencl/syncclgl.h>
 #include <modules/opencl/openclexception.h>
 
+#include <algorithm>
+
 namespace inviwo {
 
 #if defined(CL_VERSION_1_1)
@@ -39,13 +42,18 @@ std::map<cl_context, pfnclCreateEventFromSyncKHR> SyncCLGL::syncFunctionMap_;
 #include <warn/pop>
 #endif
 
+thread_local SyncCLGL* SyncCLGL::current_ = nullptr;
+
 SyncCLGL::SyncCLGL(const cl::Context& context, const cl::CommandQueue& queue)
-    :
-#if defined(CL_VERSION_1_1)
-    glFenceSync_(nullptr)
-#endif
-    , context_(context)
-    , queue_(queue) {
+    : context_(context), queue_(queue), parent_(nullptr), previous_(current_) {
+    for (auto* sync = previous_; sync; sync = sync->previous_) {
+        if (sync->queue_() == queue_()) {
+            parent_ = sync;
+            break;
+        }
+    }
+    current_ = this;
+
 #if defined(CL_VERSION_1_1)
     // Check if function clCreateEventFromGLsyncKHR has been fetched previously
     // and that glCreateSyncFromCLeventARB exist (non-existing on Mac).
@@ -65,38 +73,23 @@ SyncCLGL::SyncCLGL(const cl::Context& context, const cl::CommandQueue& queue)
             "clCreateEventFromGLsyncKHR");
 #endif
     }
-    pfnclCreateEventFromSyncKHR clCreateEventFromGLsync = syncFunctionMap_[context()];
-    if (clCreateEventFromGLsync) {
-        // Use more efficient synchronization
-        // See section 9.9 in the OpenCL 1.1 spec for more information, also
-        // https://www.cct.lsu.edu/~korobkin/tmp/SC10/tutorials/docs/M13/M13.pdf
-
-        // Get sync point from OpenGL to be used when acquiring objects
-        // Note that glFenceSync is supported since it exit in OpenGl 3.2 and higher
-        glFenceSync_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-    } else {
-        // clCreateEventFromGLsync not supported.
-        // We need to use a slower synchronization
-        glFinish();
-    }
-#else
-    glFinish();
 #endif
 }
 
 SyncCLGL::~SyncCLGL() {
     releaseAllGLObjects();
 #if defined(CL_VERSION_1_1)
-    if (glFenceSync_) glDeleteSync(glFenceSync_);
+    for (auto fence : fences_) glDeleteSync(fence);
 #endif
+    current_ = previous_;
 }
 
 void SyncCLGL::addToAquireGLObjectList(const BufferCLGL* object) {
-    syncedObjects_.push_back(object->get());
+    pendingObjects_.push_back(object->get());
 }
 
 void SyncCLGL::addToAquireGLObjectList(const LayerCLGL* object) {
-    syncedObjects_.push_back(object->get());
+    pendingObjects_.push_back(object->get());
 }
 
 void SyncCLGL::addToAquireGLObjectList(const ImageCLGL* object) {
@@ -104,60 +97,127 @@ void SyncCLGL::addToAquireGLObjectList(const ImageCLGL* object) {
 }
 
 void SyncCLGL::addToAquireGLObjectList(const VolumeCLGL* object) {
-    syncedObjects_.push_back(object->get());
+    pendingObjects_.push_back(object->get());
+}
+
+const SyncCLGL& SyncCLGL::outermost() const {
+    const SyncCLGL* sync = this;
+    while (sync->parent_) sync = sync->parent_;
+    return *sync;
+}
+
+bool SyncCLGL::isAcquired(const cl::Memory& object) const {
+    const auto& objects = outermost().syncedObjects_;
+    return std::any_of(objects.begin(), objects.end(),
+                       [&](const cl::Memory& m) { return m() == object(); });
+}
+
+auto SyncCLGL::getSync() const -> Sync {
+    // cl_khr_gl_event only guarantees implicit synchronization on the default context
+    if (OpenCL::getPtr()->isGLEventSupported() && context_() == OpenCL::getPtr()->getContext()()) {
+        return Sync::Implicit;
+    }
+#if defined(CL_VERSION_1_1)
+    auto it = syncFunctionMap_.find(context_());
+    if (it != syncFunctionMap_.end() && it->second) return Sync::Fence;
+#endif
+    return Sync::Finish;
 }
 
 void SyncCLGL::aquireAllObjects(const std::vector<cl::Event>* waitForEvents /*= nullptr*/,
                                 cl::Event* event /*= nullptr*/) const {
-#if defined(CL_VERSION_1_1)
-    // Use fast synchronization if we can
-    if (glFenceSync_) {
-        pfnclCreateEventFromSyncKHR clCreateEventFromGLsync = syncFunctionMap_[context_()];
-        // Sync with OpenGL
-        cl_int err;
-        std::vector<cl::Event> waitForSyncAndEvents(
-            1, clCreateEventFromGLsync(context_(), glFenceSync_, &err));
-        if (err != CL_SUCCESS) {
-            throw OpenCLException("Failed to create sync event");
-        }
-        if (waitForEvents) {
-            // Add events to wait for
-            waitForSyncAndEvents.reserve(waitForEvents->size() + 1);
-            waitForSyncAndEvents.insert(std::end(waitForSyncAndEvents), std::begin(*waitForEvents),
-                                        std::end(*waitForEvents));
-        }
-        queue_.enqueueAcquireGLObjects(&syncedObjects_, &waitForSyncAndEvents, event);
-    } else {
-        // Fast sync not supported, glFinish has been called in constructor instead
-        queue_.enqueueAcquireGLObjects(&syncedObjects_, waitForEvents, event);
+    // Only acquire what is not already held, by us or an enclosing SyncCLGL
+    std::vector<cl::Memory> objects;
+    objects.reserve(pendingObjects_.size());
+    for (const auto& object : pendingObjects_) {
+        if (isAcquired(object) || std::any_of(objects.begin(), objects.end(),
+                                              [&](const cl::Memory& m) { return m() == object(); }))
+            continue;
+        objects.push_back(object);
     }
+    pendingObjects_.clear();
+
+    if (objects.empty()) {
+        if (waitForEvents || event) {
+            cl::CommandQueue queue = queue_;
+#if defined(CL_VERSION_1_2)
+            queue.enqueueMarkerWithWaitList(waitForEvents, event);
 #else
-    queue_.enqueueAcquireGLObjects(&syncedObjects_, waitForEvents, event);
+            // In-order queue, the marker waits for all previous commands, events included
+            queue.enqueueMarker(event);
+#endif
+        }
+        return;
+    }
+
+    switch (getSync()) {
+        case Sync::Implicit:
+            queue_.enqueueAcquireGLObjects(&objects, waitForEvents, event);
+            break;
+#if defined(CL_VERSION_1_1)
+        case Sync::Fence: {
+            // See section 9.9 in the OpenCL 1.1 spec for more information, also
+            // https://www.cct.lsu.edu/~korobkin/tmp/SC10/tutorials/docs/M13/M13.pdf
+            // The fence covers all OpenGL commands issued up until now.
+            GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            pfnclCreateEventFromSyncKHR clCreateEventFromGLsync = syncFunctionMap_[context_()];
+            cl_int err;
+            std::vector<cl::Event> waitForSyncAndEvents(
+                1, clCreateEventFromGLsync(context_(), fence, &err));
+            // Deleted once the objects are released, the event might still be waiting for it
+            outermost().fences_.push_back(fence);
+            if (err != CL_SUCCESS) {
+                throw OpenCLException("Failed to create sync event");
+            }
+            if (waitForEvents) {
+                // Add events to wait for
+                waitForSyncAndEvents.reserve(waitForEvents->size() + 1);
+                waitForSyncAndEvents.insert(std::end(waitForSyncAndEvents),
+                                            std::begin(*waitForEvents), std::end(*waitForEvents));
+            }
+            queue_.enqueueAcquireGLObjects(&objects, &waitForSyncAndEvents, event);
+            break;
+        }
 #endif
+        default:
+            glFinish();
+            queue_.enqueueAcquireGLObjects(&objects, waitForEvents, event);
+            break;
+    }
+
+    auto& synced = outermost().syncedObjects_;
+    synced.insert(synced.end(), objects.begin(), objects.end());
 }
 
 void SyncCLGL::releaseAllGLObjects(const std::vector<cl::Event>* waitForEvents, cl::Event* event) {
-    if (!syncedObjects_.empty()) {
+    // The outermost SyncCLGL on the queue keeps everything acquired until it is done
+    if (parent_ || syncedObjects_.empty()) return;
+
+    switch (getSync()) {
+        case Sync::Implicit:
+            queue_.enqueueReleaseGLObjects(&syncedObjects_, waitForEvents, event);
+            break;
 #if defined(CL_VERSION_1_1)
-        if (glFenceSync_) {
+        case Sync::Fence: {
             cl::Event releaseEvent;
             // Use supplied event if existing
             cl::Event* releaseEventPtr = event != nullptr ? event : &releaseEvent;
             queue_.enqueueReleaseGLObjects(&syncedObjects_, waitForEvents, releaseEventPtr);
-            // Synchronize OpenCL and OpenGL
+            // Synchronize OpenCL and OpenGL without stalling the CPU-thread
             GLsync clSync = glCreateSyncFromCLeventARB(context_(), (*releaseEventPtr)(), 0);
-            // without stalling CPU-thread:
             glWaitSync(clSync, 0, GL_TIMEOUT_IGNORED);
-        } else {
-            queue_.enqueueReleaseGLObjects(&syncedObjects_, waitForEvents, event);
-            queue_.finish();
+            glDeleteSync(clSync);
+            for (auto fence : fences_) glDeleteSync(fence);
+            fences_.clear();
+            break;
         }
-#else
-        queue_.enqueueReleaseGLObjects(&syncedObjects_, waitForEvents, event);
-        queue_.finish();
 #endif
-        syncedObjects_.clear();
+        default:
+            queue_.enqueueReleaseGLObjects(&syncedObjects_, waitForEvents, event);
+            queue_.finish();
+            break;
     }
+    syncedObjects_.clear();
 }
 
 }  // namespace inviwo
@@ -0,0 +1,76 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Depth-aware compositing of NUMBER_OF_INPUTS images in a single pass. The samplers are declared
+// by INPUT_UNIFORMS as tex<i>Color, tex<i>Depth, tex<i>Picking and read in INPUT_SAMPLES.
+// Blending is the same as in composite.frag, applied back to front.
+
+#include "utils/structs.glsl"
+
+#ifndef NUMBER_OF_INPUTS
+#define NUMBER_OF_INPUTS 2
+#endif
+
+INPUT_UNIFORMS
+
+uniform ImageParameters outportParameters;
+
+void main() {
+    vec2 texCoords = gl_FragCoord.xy * outportParameters.reciprocalDimensions;
+
+    vec4 color[NUMBER_OF_INPUTS];
+    vec4 picking[NUMBER_OF_INPUTS];
+    float depth[NUMBER_OF_INPUTS];
+    INPUT_SAMPLES
+
+    // Insertion sort on depth, farthest first. Inputs with equal depth keep their order
+    // such that later inputs end up on top, as in composite.frag.
+    int order[NUMBER_OF_INPUTS];
+    for (int i = 0; i < NUMBER_OF_INPUTS; ++i) {
+        int j = i;
+        while (j > 0 && depth[order[j - 1]] < depth[i]) {
+            order[j] = order[j - 1];
+            --j;
+        }
+        order[j] = i;
+    }
+
+    vec4 colorOut = color[order[0]];
+    vec4 pickingOut = picking[order[0]];
+    for (int i = 1; i < NUMBER_OF_INPUTS; ++i) {
+        int k = order[i];
+        colorOut.rgb = color[k].rgb * color[k].a + colorOut.rgb * (1.0 - color[k].a);
+        colorOut.a = color[k].a + colorOut.a * (1.0 - color[k].a);
+        pickingOut = (picking[k].a > 0 ? picking[k] : (color[k].a < 0.95 ? pickingOut : vec4(0.0)));
+    }
+
+    FragData0 = colorOut;
+    PickingData = pickingOut;
+    gl_FragDepth = depth[order[NUMBER_OF_INPUTS - 1]];
+}
@@ -0,0 +1,57 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Bilinear upscaling followed by a contrast adaptive sharpening step. The sharpening is limited
+// to the local min/max of the neighborhood to avoid ringing around edges.
+
+uniform sampler2D tex_;
+uniform vec2 reciprocalDimensions;  // 1 / source texture dimensions
+uniform float sharpness = 0.5;
+
+in vec3 texCoord_;
+
+void main() {
+    vec2 uv = texCoord_.xy;
+    vec4 c = texture(tex_, uv);
+    vec4 n = texture(tex_, uv + vec2(0.0, reciprocalDimensions.y));
+    vec4 s = texture(tex_, uv - vec2(0.0, reciprocalDimensions.y));
+    vec4 e = texture(tex_, uv + vec2(reciprocalDimensions.x, 0.0));
+    vec4 w = texture(tex_, uv - vec2(reciprocalDimensions.x, 0.0));
+
+    vec4 minColor = min(c, min(min(n, s), min(e, w)));
+    vec4 maxColor = max(c, max(max(n, s), max(e, w)));
+
+    // Reduce the sharpening where the local contrast is already high
+    vec3 amp = clamp(min(minColor.rgb, 1.0 - maxColor.rgb) / max(maxColor.rgb, 1e-4), 0.0, 1.0);
+    vec3 weight = sqrt(amp) * sharpness;
+
+    vec4 sharpened = c;
+    sharpened.rgb = c.rgb + weight * (4.0 * c.rgb - (n.rgb + s.rgb + e.rgb + w.rgb)) * 0.25;
+    FragData0 = clamp(sharpened, minColor, maxColor);
+}
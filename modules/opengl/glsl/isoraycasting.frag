@@ -63,6 +63,10 @@ uniform RaycastingParameters raycasting;
 
 uniform int channel;
 
+// progressive refinement, see ProgressiveRefinementProperty
+uniform float samplingRateScale = 1.0;
+uniform float rayOffset = 0.5;
+
 uniform vec4 surfaceColor = vec4(1);
 
 #define ERT_THRESHOLD 0.95  // set threshold for early ray termination
@@ -71,12 +75,11 @@ vec4 rayTraversal(vec3 entryPoint, vec3 exitPoint, vec2 texCoords) {
     vec4 result = vec4(0.0);
     vec3 rayDirection = exitPoint - entryPoint;
     float tEnd = length(rayDirection);
-    float tIncr =
-        min(tEnd,
-            tEnd / (raycasting.samplingRate * length(rayDirection * volumeParameters.dimensions)));
+    float tIncr = min(tEnd, tEnd / (raycasting.samplingRate * samplingRateScale *
+                                    length(rayDirection * volumeParameters.dimensions)));
     float samples = ceil(tEnd / tIncr);
     tIncr = tEnd / samples;
-    float t = 0.5f * tIncr;
+    float t = rayOffset * tIncr;
     rayDirection = normalize(rayDirection);
     float tDepth = -1.0;
     vec4 color;
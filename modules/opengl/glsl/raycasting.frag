@@ -40,6 +40,10 @@
 
 #include "utils/isosurface.glsl"
 
+#if defined(EMPTY_SPACE_SKIPPING)
+#include "utils/emptyspaceskipping.glsl"
+#endif
+
 uniform VolumeParameters volumeParameters;
 uniform sampler3D volume;
 
@@ -72,6 +76,15 @@ uniform bool useNormals = false;
 
 uniform int channel;
 
+// progressive refinement, see ProgressiveRefinementProperty
+uniform float samplingRateScale = 1.0;
+uniform float rayOffset = 0.5;
+
+#if defined(EMPTY_SPACE_SKIPPING)
+uniform sampler3D occupancy;
+uniform OccupancyParameters occupancyParameters;
+#endif
+
 #define ERT_THRESHOLD 0.99  // threshold for early ray termination
 
 #if (!defined(INCLUDE_DVR) && !defined(INCLUDE_ISOSURFACES))
@@ -83,11 +96,11 @@ vec4 rayTraversal(vec3 entryPoint, vec3 exitPoint, vec2 texCoords, float backgro
     vec4 result = vec4(0.0);
     vec3 rayDirection = exitPoint - entryPoint;
     float tEnd = length(rayDirection);
-    float tIncr = min(
-        tEnd, tEnd / (raycaster.samplingRate * length(rayDirection * volumeParameters.dimensions)));
+    float tIncr = min(tEnd, tEnd / (raycaster.samplingRate * samplingRateScale *
+                                    length(rayDirection * volumeParameters.dimensions)));
     float samples = ceil(tEnd / tIncr);
     tIncr = tEnd / samples;
-    float t = 0.5f * tIncr;
+    float t = rayOffset * tIncr;
     rayDirection = normalize(rayDirection);
     float tDepth = -1.0;
     vec4 color;
@@ -184,6 +197,23 @@ vec4 rayTraversal(vec3 entryPoint, vec3 exitPoint, vec2 texCoords, float backgro
             // make sure that tIncr has the correct length since drawIsoSurface will modify it
             tIncr = tEnd / samples;
 #endif // ISOSURFACE_ENABLED
+
+#if defined(EMPTY_SPACE_SKIPPING) && !defined(PLANES_ENABLED)
+            // jump to the last sample of an empty macro cell, and resample the voxel there to
+            // keep the isosurface detection between it and the next sample exact
+            float tSkip = skipEmptySpace(occupancy, occupancyParameters, entryPoint, rayDirection,
+                                         t, tIncr);
+#if defined(BACKGROUND_AVAILABLE)
+            // the background is composited at the first sample behind it
+            if (bgTDepth > t) {
+                tSkip = min(tSkip, t + (ceil((bgTDepth - t) / tIncr) - 1.0) * tIncr);
+            }
+#endif // BACKGROUND_AVAILABLE
+            if (tSkip > t) {
+                t = tSkip;
+                voxel = getNormalizedVoxel(volume, volumeParameters, entryPoint + t * rayDirection);
+            }
+#endif // EMPTY_SPACE_SKIPPING
             t += tIncr;
         }
         first = false;
@@ -0,0 +1,74 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifndef IVW_EMPTYSPACESKIPPING_GLSL
+#define IVW_EMPTYSPACESKIPPING_GLSL
+
+// Empty space skipping using an occupancy grid of macro cells, see EmptySpaceSkippingGL in the
+// basegl module. Each component of a texel of the occupancy grid corresponds to one transfer
+// function, and is zero if no sample inside the macro cell can contribute to the rendering with
+// that transfer function, i.e. all values of the cell are transparent. Unused components are zero.
+
+struct OccupancyParameters {
+    vec3 scale;  // Transforms texture coordinates to macro cell coordinates
+};
+
+vec4 getOccupancy(sampler3D occupancy, OccupancyParameters params, vec3 samplePos) {
+    ivec3 cell = clamp(ivec3(floor(samplePos * params.scale)), ivec3(0),
+                       textureSize(occupancy, 0) - 1);
+    return texelFetch(occupancy, cell, 0);
+}
+
+bool isOccupied(sampler3D occupancy, OccupancyParameters params, vec3 samplePos) {
+    return any(greaterThan(getOccupancy(occupancy, params, samplePos), vec4(0.0)));
+}
+
+/**
+ * Returns the ray position of the last sample inside the macro cell of the sample at
+ * @p rayPosition, or @p rayPosition itself if that cell is occupied. The returned position is a
+ * multiple of @p rayStep away from @p rayPosition such that the remaining samples along the ray
+ * end up at the same positions as without skipping.
+ */
+float skipEmptySpace(sampler3D occupancy, OccupancyParameters params, vec3 entryPoint,
+                     vec3 rayDirection, float rayPosition, float rayStep) {
+    vec3 samplePos = entryPoint + rayPosition * rayDirection;
+    if (isOccupied(occupancy, params, samplePos)) return rayPosition;
+
+    vec3 pos = samplePos * params.scale;
+    vec3 dir = rayDirection * params.scale;
+    vec3 cell = floor(pos);
+    // distance to the cell faces in the direction of the ray, the sign always matches dir
+    vec3 dist = mix(cell - pos, cell + 1.0 - pos, greaterThanEqual(dir, vec3(0.0)));
+    vec3 tFaces = abs(dist) / max(abs(dir), vec3(1.0e-6));
+    float tExit = min(tFaces.x, min(tFaces.y, tFaces.z));
+
+    return rayPosition + floor(tExit / rayStep) * rayStep;
+}
+
+#endif  // IVW_EMPTYSPACESKIPPING_GLSL
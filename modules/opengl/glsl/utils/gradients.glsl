@@ -212,6 +212,16 @@ vec3 gradientPrecomputedYZW(sampler3D volume, VolumeParameters volumeParams, vec
     return (volumeParams.textureToWorldNormalMatrix * vec4(gradient, 0.0)).xyz;
 }
 
+#if defined(GRADIENT_VOLUME)
+// Use pre-computed world space gradient directions packed into [0, 1] in a separate volume of the
+// same size as the sampled volume, @see GradientVolumeGL
+uniform sampler3D gradientVolume;
+
+vec3 gradientPrecomputedVolume(vec3 samplePos) {
+    return texture(gradientVolume, samplePos).xyz * 2.0 - 1.0;
+}
+#endif // GRADIENT_VOLUME
+
 // compute the partial differential for a given component using central differences
 float partialDiff(sampler2D tex, ImageParameters texParams, in vec2 texcoord, 
                   in vec2 gradientTextureSpacing, in float gradientWorldSpacing, in int component) {
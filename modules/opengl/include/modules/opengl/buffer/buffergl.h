@@ -83,6 +83,7 @@ public:
     void unbind() const;
 
     void upload(const void* data, GLsizeiptr sizeInBytes);
+    void upload(const void* data, GLintptr offsetInBytes, GLsizeiptr sizeInBytes);
     void download(void* data) const;
 
     void enable() const;
@@ -90,6 +91,8 @@ public:
 
     virtual std::type_index getTypeIndex() const override final;
 
+    virtual void updateResource(const ResourceMeta& meta) const override;
+
 protected:
     std::shared_ptr<BufferObject> buffer_;
     mutable std::unique_ptr<BufferObjectArray> bufferArray_;
@@ -43,6 +43,7 @@ class BufferRepresentation;
 class IVW_MODULE_OPENGL_API BufferRAM2GLConverter
     : public RepresentationConverterType<BufferRepresentation, BufferRAM, BufferGL> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<BufferGL> createFrom(
         std::shared_ptr<const BufferRAM> source) const override;
     virtual void update(std::shared_ptr<const BufferRAM> source,
@@ -52,6 +53,7 @@ public:
 class IVW_MODULE_OPENGL_API BufferGL2RAMConverter
     : public RepresentationConverterType<BufferRepresentation, BufferGL, BufferRAM> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<BufferRAM> createFrom(
         std::shared_ptr<const BufferGL> source) const override;
     virtual void update(std::shared_ptr<const BufferGL> source,
@@ -39,11 +39,23 @@
 #include <modules/opengl/inviwoopengl.h>                       // for GLenum, GLsizeiptr, GLuint
 
 #include <cstddef>      // for size_t
+#include <memory>       // for unique_ptr
 #include <string_view>  // for string_view
 #include <vector>       // for vector
 
 namespace inviwo {
 
+class PersistentRingBuffer;
+
+/**
+ * \brief Wrapper for an OpenGL buffer object.
+ *
+ * Buffers with BufferUsage::Dynamic (GL_DYNAMIC_DRAW or GL_STREAM_DRAW) are assumed to be updated
+ * frequently, for example every frame. Uploads into them go through a persistently mapped staging
+ * ring buffer when supported, see PersistentRingBuffer, to avoid stalling the CPU while the GPU is
+ * still using the buffer. This costs additional host visible memory of a few times the buffer
+ * capacity.
+ */
 class IVW_MODULE_OPENGL_API BufferObject : public Observable<BufferObjectObserver> {
 public:
     /**
@@ -156,7 +168,8 @@ public:
     /**
      * Upload \p data into the buffer. This also binds the buffer. Depending on the grow policy \p
      * policy, the buffer is re-initialized with \p sizeInBytes if it is different from the current
-     * size of the buffer.
+     * size of the buffer. Uploads into dynamic buffers that do not require a re-initialization are
+     * streamed through a staging ring buffer, see PersistentRingBuffer.
      * @param data          data to be uploaded. The underlying data must match the current GL
      *                      format of the buffer.
      * @param sizeInBytes   size of the uploaded data
@@ -172,6 +185,15 @@ public:
      * @param policy        resizing policy when \p sizeInBytes differs from the current size
      * @see upload(const void*, GLsizeiptr, SizePolicy)
      */
+    /**
+     * Upload \p sizeInBytes bytes of \p data into the buffer starting at \p offsetInBytes, without
+     * changing the size of the buffer. This also binds the buffer.
+     * @param data          data to be uploaded, pointing to the start of the updated range.
+     * @param offsetInBytes offset of the range in the buffer
+     * @param sizeInBytes   size of the range, offsetInBytes + sizeInBytes must fit in the buffer
+     */
+    void upload(const void* data, GLintptr offsetInBytes, GLsizeiptr sizeInBytes);
+
     template <typename T>
     void upload(const T& cont, SizePolicy policy = SizePolicy::GrowOnly) {
         using ValueType = typename T::value_type;
@@ -185,6 +207,7 @@ public:
 
 private:
     void initialize(const void* data, GLsizeiptr sizeInBytes);
+    bool useStreaming() const;
 
     GLuint id_;
     GLenum usageGL_;
@@ -192,6 +215,7 @@ private:
     GLFormat glFormat_;
     GLsizeiptr sizeInBytes_;
     GLsizeiptr capacityInBytes_;
+    std::unique_ptr<PersistentRingBuffer> staging_;
 };
 
 inline GLFormat BufferObject::getGLFormat() const { return glFormat_; }
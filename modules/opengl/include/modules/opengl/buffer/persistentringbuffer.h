@@ -0,0 +1,86 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/opengl/openglmoduledefine.h>  // for IVW_MODULE_OPENGL_API
+
+#include <modules/opengl/inviwoopengl.h>  // for GLuint, GLsizeiptr, GLsync, GLintptr
+
+#include <cstddef>  // for size_t, byte
+#include <vector>   // for vector
+
+namespace inviwo {
+
+/**
+ * \brief A persistently mapped staging buffer for streaming uploads to other buffers.
+ *
+ * The buffer is divided into a number of regions which are used in a round robin fashion. An
+ * upload copies the data into the next region on the CPU and then enqueues a GPU side copy into
+ * the destination buffer, guarded by a fence. Since the destination is never written by the CPU,
+ * the upload does not have to wait for the GPU to finish using it, as glBufferSubData might. The
+ * CPU only waits if all regions are still in flight.
+ *
+ * Requires glBufferStorage, i.e. OpenGL 4.4 or GL_ARB_buffer_storage, see isSupported().
+ * @see BufferObject::upload
+ */
+class IVW_MODULE_OPENGL_API PersistentRingBuffer {
+public:
+    static constexpr size_t defaultRegions = 3;
+
+    PersistentRingBuffer(GLsizeiptr regionSizeInBytes, size_t regions = defaultRegions);
+    PersistentRingBuffer(const PersistentRingBuffer&) = delete;
+    PersistentRingBuffer(PersistentRingBuffer&&) = delete;
+    PersistentRingBuffer& operator=(const PersistentRingBuffer&) = delete;
+    PersistentRingBuffer& operator=(PersistentRingBuffer&&) = delete;
+    ~PersistentRingBuffer();
+
+    static bool isSupported();
+
+    GLsizeiptr getRegionSizeInBytes() const;
+    size_t getNumberOfRegions() const;
+
+    /**
+     * Copy @p sizeInBytes bytes from @p data into the next region and enqueue a copy from it into
+     * the buffer @p dst at @p dstOffset. This binds @p dst to GL_COPY_WRITE_BUFFER.
+     * @throw OpenGLException if @p sizeInBytes is larger than the region size
+     */
+    void upload(const void* data, GLsizeiptr sizeInBytes, GLuint dst, GLintptr dstOffset = 0);
+
+private:
+    void waitForRegion(size_t region);
+
+    GLuint id_;
+    GLsizeiptr regionSizeInBytes_;
+    std::byte* mapped_;
+    std::vector<GLsync> fences_;
+    size_t current_;
+};
+
+}  // namespace inviwo
@@ -41,6 +41,7 @@
 
 namespace inviwo {
 
+class FrameMetrics;
 class Image;
 class MeshGL;
 class Shader;
@@ -48,7 +49,7 @@ class Shader;
 class IVW_MODULE_OPENGL_API CanvasGL : public Canvas {
 public:
     CanvasGL();
-    virtual ~CanvasGL() = default;
+    virtual ~CanvasGL();
 
     static void defaultGLState();
 
@@ -72,6 +73,32 @@ public:
     double getDepthValueAtCoord(ivec2 canvasCoordinate) const;
     double getDepthValueAtNormalizedCoord(dvec2 normalizedScreenCoordinate) const;
 
+    /**
+     * \brief Sharpening applied when an image smaller than the canvas is upscaled.
+     *
+     * A value of 0 gives plain bilinear filtering, values up to 1 apply an increasing amount
+     * of contrast adaptive sharpening. Images matching the canvas size are never sharpened.
+     */
+    void setUpscaleSharpness(float sharpness);
+    float getUpscaleSharpness() const;
+
+    /**
+     * \brief Record frame pacing and latency of the frames rendered by this canvas.
+     *
+     * When enabled every buffer swap adds a frame to the FrameMetrics returned by
+     * getFrameMetrics. Disabling it discards the recorded frames.
+     */
+    void setFrameMetricsEnabled(bool enabled);
+    /**
+     * @return the metrics of this canvas or nullptr if not enabled
+     */
+    FrameMetrics* getFrameMetrics();
+    /**
+     * Draw a graph of the recent frame times on top of the image, requires frame metrics to be
+     * enabled.
+     */
+    void setFrameMetricsOverlay(bool overlay);
+
 protected:
     void setupDebug();
 
@@ -81,6 +108,8 @@ protected:
     void drawSquare();
 
     void renderTexture(int);
+    /// Swap buffers and record the frame
+    void present();
 
     std::weak_ptr<const Image> image_;
     std::unique_ptr<Mesh> square_;
@@ -104,6 +133,11 @@ protected:
 
     Shader* textureShader_ = nullptr;  ///< non-owning reference
     Shader* noiseShader_ = nullptr;    ///< non-owning reference
+    Shader* upscaleShader_ = nullptr;  ///< non-owning reference
+    float upscaleSharpness_ = 0.0f;
+
+    std::unique_ptr<FrameMetrics> frameMetrics_;
+    bool frameMetricsOverlay_ = false;
 };
 
 }  // namespace inviwo
@@ -31,23 +31,78 @@
 
 #include <modules/opengl/openglmoduledefine.h>  // for IVW_MODULE_OPENGL_API
 
-#include <inviwo/core/processors/canvasprocessor.h>  // for CanvasProcessor
-#include <inviwo/core/processors/processorinfo.h>    // for ProcessorInfo
+#include <inviwo/core/network/processornetworkevaluationobserver.h>  // for ProcessorNetworkEv...
+#include <inviwo/core/processors/canvasprocessor.h>                  // for CanvasProcessor
+#include <inviwo/core/processors/processorinfo.h>                    // for ProcessorInfo
+#include <inviwo/core/properties/boolcompositeproperty.h>            // for BoolCompositeProperty
+#include <inviwo/core/properties/boolproperty.h>                     // for BoolProperty
+#include <inviwo/core/properties/buttonproperty.h>                   // for ButtonProperty
+#include <inviwo/core/properties/fileproperty.h>                     // for FileProperty
+#include <inviwo/core/properties/ordinalproperty.h>                  // for FloatProperty
+#include <inviwo/core/util/timer.h>                                  // for Delay
+
+#include <chrono>    // for steady_clock
+#include <optional>  // for optional
 
 namespace inviwo {
 
 class InviwoApplication;
+class FrameMetrics;
 
 /**
  * \brief Takes an Image Inport and renders it into a OpenGL window i.e. a canvas.
+ *
+ * With dynamic resolution enabled the processor measures the time it takes for the network to
+ * deliver a new image and lowers the render scale of the canvas when the frame time target is
+ * missed. The smaller image is upscaled with a sharpening filter in the canvas. Once the network
+ * has been idle for a short while the full resolution image is rendered again.
+ *
+ * With frame metrics enabled the canvas records the time between frames, the GPU time of drawing
+ * the canvas, the number of network evaluations per frame, dropped frames, and the time from an
+ * interaction event until the resulting frame is swapped, see FrameMetrics.
  */
-class IVW_MODULE_OPENGL_API CanvasProcessorGL : public CanvasProcessor {
+class IVW_MODULE_OPENGL_API CanvasProcessorGL : public CanvasProcessor,
+                                                public ProcessorNetworkEvaluationObserver {
 public:
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
 
     CanvasProcessorGL(InviwoApplication* app);
     virtual ~CanvasProcessorGL() = default;
+
+    virtual void process() override;
+    virtual void propagateEvent(Event* event, Outport* source) override;
+
+    /**
+     * @return the frame metrics of the canvas, or nullptr if not enabled or there is no canvas
+     */
+    FrameMetrics* getFrameMetrics();
+
+    BoolCompositeProperty dynamicResolution_;
+    FloatProperty targetFrameTime_;
+    FloatProperty minScale_;
+    FloatProperty sharpness_;
+
+    BoolCompositeProperty frameMetrics_;
+    FloatProperty frameInterval_;
+    BoolProperty metricsOverlay_;
+    FileProperty metricsFile_;
+    ButtonProperty exportMetrics_;
+    ButtonProperty resetMetrics_;
+
+private:
+    virtual void onProcessorNetworkEvaluationBegin() override;
+    virtual void onProcessorNetworkEvaluationEnd() override;
+
+    void updateSharpness();
+    void updateFrameMetrics();
+
+    using clock = std::chrono::steady_clock;
+    clock::time_point evaluationStart_{};
+    std::optional<double> frameTime_;  ///< Time in ms from evaluation start until process
+    double smoothedFrameTime_ = 0.0;
+    bool refining_ = false;
+    Delay idle_;
 };
 
 }  // namespace inviwo
@@ -0,0 +1,153 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/opengl/openglmoduledefine.h>  // for IVW_MODULE_OPENGL_API
+
+#include <inviwo/core/util/glmvec.h>  // for size2_t
+#include <modules/opengl/clockgl.h>   // for ClockGL
+
+#include <array>       // for array
+#include <chrono>      // for steady_clock
+#include <cstddef>     // for size_t
+#include <filesystem>  // for path
+#include <iosfwd>      // for ostream
+#include <optional>    // for optional
+#include <vector>      // for vector
+
+namespace inviwo {
+
+/**
+ * \brief Frame pacing and latency measurements of a canvas.
+ *
+ * A frame is recorded each time the canvas swaps its buffers. For each frame the time since the
+ * previous swap, the GPU time of the canvas draw, the number of network evaluations since the
+ * previous swap, the number of missed target intervals, and the time from the first interaction
+ * event after the previous swap until this swap are recorded. The latest frames are kept in a
+ * ring buffer for export and the summary, while the frame time histogram covers all frames since
+ * the last reset. A frame following a period where nothing was rendered, more than ten target
+ * intervals, is marked as after idle and left out of the frame time statistics.
+ *
+ * The GPU time of a frame is read back when the next frame is swapped to not stall the
+ * pipeline, it is thus missing for the latest frame.
+ *
+ * @see CanvasGL::getFrameMetrics
+ */
+class IVW_MODULE_OPENGL_API FrameMetrics {
+public:
+    using clock = std::chrono::steady_clock;
+
+    struct Frame {
+        double frameTime = 0.0;         ///< ms since the previous swap
+        std::optional<double> gpuTime;  ///< ms of GPU time spent drawing the canvas
+        std::optional<double> latency;  ///< ms from the first interaction until the swap
+        size_t evaluations = 0;         ///< network evaluations since the previous swap
+        size_t dropped = 0;             ///< target frame intervals missed
+        bool afterIdle = false;         ///< nothing was rendered for a while before this frame
+    };
+
+    struct Summary {
+        size_t frames = 0;
+        double meanFrameTime = 0.0;
+        double p50FrameTime = 0.0;
+        double p95FrameTime = 0.0;
+        double p99FrameTime = 0.0;
+        double maxFrameTime = 0.0;
+        double meanGpuTime = 0.0;
+        double meanLatency = 0.0;
+        double maxLatency = 0.0;
+        size_t droppedFrames = 0;
+        double evaluationsPerFrame = 0.0;
+    };
+
+    /// The histogram has one bin per ms of frame time, the last bin collects all longer frames
+    static constexpr size_t histogramBins = 101;
+    using Histogram = std::array<size_t, histogramBins>;
+
+    explicit FrameMetrics(size_t capacity = 1024);
+
+    /**
+     * The expected time between two frames in ms, used to count dropped frames and to scale the
+     * overlay. Defaults to 16.7 ms which corresponds to 60 Hz.
+     */
+    void setTargetFrameTime(double ms);
+    double getTargetFrameTime() const;
+
+    /**
+     * Mark that an interaction event has arrived, only the first one since the last swap is used
+     * for the latency of the next frame.
+     */
+    void interaction();
+    /// Mark that a network evaluation has finished
+    void evaluation();
+    /// Call before the canvas starts drawing
+    void beginFrame();
+    /// Call directly after the canvas has swapped its buffers
+    void endFrame();
+
+    /// The recorded frames ordered from oldest to newest
+    std::vector<Frame> getFrames() const;
+    const Histogram& getHistogram() const;
+    Summary getSummary() const;
+
+    void reset();
+
+    /**
+     * Write the recorded frames as comma separated values, one frame per row.
+     */
+    void writeCSV(std::ostream& os) const;
+    void writeCSV(const std::filesystem::path& file) const;
+
+    /**
+     * Draw a graph of the recent frame times into the lower left corner of the currently bound
+     * framebuffer of size @p dims. Each bar is one frame, frames over the target are red, and a
+     * white line marks the target frame time.
+     */
+    void drawOverlay(size2_t dims) const;
+
+private:
+    Frame& frame(size_t index);
+
+    size_t capacity_;
+    std::vector<Frame> frames_;
+    size_t count_ = 0;  ///< Number of frames recorded since the last reset
+    Histogram histogram_{};
+    double targetFrameTime_ = 1000.0 / 60.0;
+
+    std::optional<clock::time_point> lastSwap_;
+    std::optional<clock::time_point> firstInteraction_;
+    size_t evaluations_ = 0;
+
+    std::optional<ClockGL> gpuClock_;
+    std::optional<ClockGL> pendingClock_;  ///< The clock of the previous frame
+    size_t pendingFrame_ = 0;
+};
+
+}  // namespace inviwo
@@ -36,7 +36,12 @@
 #include <inviwo/core/ports/imageport.h>                  // for ImageInport
 #include <modules/opengl/shader/shader.h>                 // for Shader
 
-#include <string>  // for string
+#include <array>          // for array
+#include <cstddef>        // for size_t
+#include <memory>         // for shared_ptr, unique_ptr
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
 
 namespace inviwo {
 
@@ -59,7 +64,33 @@ public:
     void composite(const ImageInport& source0, const ImageInport& source1,
                    ImageOutport& destination, ImageType type);
 
+    /**
+     * Blend all @p sources using depth into the @p destination. Up to getMaxInputsPerPass()
+     * sources are composited in a single pass, larger sets are split into several passes.
+     * Sources with equal depth are blended in order, later sources on top.
+     */
+    void composite(const std::vector<const Image*>& sources, Image& destination, ImageType type);
+
+    /**
+     * Blend all images connected to @p sources using depth into the @p destination
+     */
+    void composite(const ImageMultiInport& sources, ImageOutport& destination, ImageType type);
+
+    /**
+     * The number of images that can be composited in one pass, limited by the number of
+     * texture units available to the fragment shader.
+     */
+    static size_t getMaxInputsPerPass();
+
     Shader shader;
+
+private:
+    Shader& getMultiShader(size_t inputs);
+    void compositePass(const std::vector<const Image*>& sources, Image& destination,
+                       ImageType type);
+
+    std::unordered_map<size_t, std::unique_ptr<Shader>> multiShaders_;
+    std::array<std::shared_ptr<Image>, 2> intermediate_;
 };
 
 }  // namespace inviwo
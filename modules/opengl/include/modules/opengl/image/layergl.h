@@ -47,6 +47,9 @@ class TextureUnit;
 
 /**
  * \ingroup datastructures
+ * Textures created from dimensions and format are taken from the TexturePool of the
+ * SharedOpenGLResources, and unshared textures are returned to it when the layer is resized or
+ * destroyed.
  */
 class IVW_MODULE_OPENGL_API LayerGL : public LayerRepresentation {
 public:
@@ -35,6 +35,7 @@
 #include <inviwo/core/datastructures/representationconverter.h>  // for RepresentationConverterT...
 #include <modules/opengl/image/layergl.h>                        // for LayerGL
 
+#include <atomic>  // for atomic
 #include <memory>  // for shared_ptr
 
 namespace inviwo {
@@ -43,15 +44,27 @@ class LayerRepresentation;
 class IVW_MODULE_OPENGL_API LayerRAM2GLConverter
     : public RepresentationConverterType<LayerRepresentation, LayerRAM, LayerGL> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<LayerGL> createFrom(
         std::shared_ptr<const LayerRAM> source) const override;
     virtual void update(std::shared_ptr<const LayerRAM> source,
                         std::shared_ptr<LayerGL> destination) const override;
+
+    /**
+     * Use block compressed textures for new 8-bit color layers when the format is supported,
+     * see utilgl::selectCompression. Disabled by default.
+     */
+    void setCompression(bool enabled) { compress_ = enabled; }
+    bool getCompression() const { return compress_; }
+
+private:
+    std::atomic<bool> compress_ = false;
 };
 
 class IVW_MODULE_OPENGL_API LayerGL2RAMConverter
     : public RepresentationConverterType<LayerRepresentation, LayerGL, LayerRAM> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<LayerRAM> createFrom(
         std::shared_ptr<const LayerGL> source) const override;
     virtual void update(std::shared_ptr<const LayerGL> source,
@@ -0,0 +1,113 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/opengl/openglmoduledefine.h>  // for IVW_MODULE_OPENGL_API
+
+#include <modules/opengl/inviwoopengl.h>  // for GLuint, GLsizeiptr, GLsync
+
+#include <cstddef>  // for size_t
+#include <future>   // for future, promise
+#include <memory>   // for shared_ptr
+#include <vector>   // for vector
+
+namespace inviwo {
+
+class LayerGL;
+class LayerRAM;
+
+/**
+ * \brief Asynchronous readback of LayerGL data into LayerRAM.
+ *
+ * Each read() enqueues a copy of the texture into one of a ring of pixel pack buffers followed by
+ * a fence, without waiting for the GPU. The returned future becomes ready once the fence has been
+ * signaled and the data has been copied into a new LayerRAM, which happens in poll(), finish(), or
+ * a later read(). When all buffers of the ring are in flight, read() waits for the oldest one.
+ * Hence, up to `depth` frames can be rendered while their readbacks are still pending, for
+ * example when exporting a sequence of frames.
+ *
+ * All functions have to be called from a thread with the OpenGL context. Since the futures are
+ * completed by this class, do not block on a future without calling poll() or finish().
+ * @see LayerGL2RAMConverter for a synchronous download
+ */
+class IVW_MODULE_OPENGL_API LayerGLReadback {
+public:
+    static constexpr size_t defaultDepth = 3;
+
+    explicit LayerGLReadback(size_t depth = defaultDepth);
+    LayerGLReadback(const LayerGLReadback&) = delete;
+    LayerGLReadback(LayerGLReadback&&) = delete;
+    LayerGLReadback& operator=(const LayerGLReadback&) = delete;
+    LayerGLReadback& operator=(LayerGLReadback&&) = delete;
+    /**
+     * Completes all pending readbacks, see finish()
+     */
+    ~LayerGLReadback();
+
+    /**
+     * Enqueue a readback of @p layer.
+     * @return a future holding a LayerRAM with the data and the properties of @p layer
+     * @throw Exception if the format of @p layer can not be represented as a LayerRAM
+     */
+    std::future<std::shared_ptr<LayerRAM>> read(const LayerGL& layer);
+
+    /**
+     * Complete the readbacks that have been finished by the GPU, without waiting.
+     * @return the number of readbacks still pending
+     */
+    size_t poll();
+
+    /**
+     * Wait for and complete all pending readbacks.
+     */
+    void finish();
+
+    size_t getDepth() const;
+
+private:
+    struct Slot {
+        GLuint pbo = 0;
+        GLsizeiptr capacity = 0;
+        GLsizeiptr size = 0;
+        GLsync fence = nullptr;
+        std::shared_ptr<LayerRAM> dst;
+        std::promise<std::shared_ptr<LayerRAM>> promise;
+    };
+    /**
+     * Wait at most @p timeout nanoseconds for the readback of @p slot and complete it.
+     * @return false if the readback was still pending after the timeout
+     */
+    static bool complete(Slot& slot, GLuint64 timeout);
+
+    std::vector<Slot> slots_;
+    size_t next_;
+};
+
+}  // namespace inviwo
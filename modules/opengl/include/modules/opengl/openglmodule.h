@@ -46,6 +46,7 @@ public:
 
     OpenGLModule(const OpenGLModule&) = delete;
     OpenGLModule& operator=(const OpenGLModule&) = delete;
+    virtual ~OpenGLModule();
 
     OpenGLCapabilities& getOpenGLCapabilities();
 
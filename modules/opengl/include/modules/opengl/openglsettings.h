@@ -34,9 +34,11 @@
 #include <inviwo/core/properties/optionproperty.h>
 #include <inviwo/core/properties/boolproperty.h>
 #include <inviwo/core/properties/buttonproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
 #include <modules/opengl/openglcapabilities.h>
 #include <modules/opengl/debugmessages.h>
 #include <modules/opengl/shader/shader.h>
+#include <modules/opengl/volume/volumegl.h>
 
 namespace inviwo {
 
@@ -49,6 +51,12 @@ public:
     ButtonProperty btnOpenGLInfo_;
     OptionProperty<Shader::UniformWarning> uniformWarnings_;
     OptionProperty<Shader::OnError> shaderObjectErrors_;
+    BoolProperty shaderBinaryCache_;
+    ButtonProperty clearShaderBinaryCache_;
+    IntProperty texturePoolSize_;
+    BoolProperty compressTextures_;
+    OptionProperty<FloatVolumePrecision> floatVolumePrecision_;
+    BoolProperty sparseVolumes_;
 
     OptionProperty<utilgl::debug::Mode> debugMessages_;
     OptionProperty<utilgl::debug::Severity> debugSeverity_;
@@ -0,0 +1,118 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/opengl/openglmoduledefine.h>  // for IVW_MODULE_OPENGL_API
+
+#include <inviwo/core/util/glmmat.h>      // for mat4
+#include <modules/opengl/inviwoopengl.h>  // for GLuint
+
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <memory>      // for shared_ptr, unique_ptr
+#include <vector>      // for vector
+
+namespace inviwo {
+
+class Mesh;
+
+/**
+ * \brief Draws many meshes with a few glMultiDrawElementsIndirect calls.
+ *
+ * Meshes with the same vertex layout, i.e. the same attribute locations and data formats, are
+ * merged into one batch. The vertex and index buffers of the meshes in a batch are copied into
+ * shared pools on the GPU and each index buffer becomes one indirect draw command, one
+ * glMultiDrawElementsIndirect call is issued per batch and draw mode. The per mesh transforms are
+ * stored in a shader storage buffer at binding drawParametersBinding, indexed by the draw id
+ * attribute at location drawIdLocation:
+ *
+ *     layout(location = 15) in uint in_DrawId;
+ *     struct DrawParameters {
+ *         mat4 dataToWorld;
+ *         mat4 dataToWorldNormalMatrix;
+ *     };
+ *     layout(std430, binding = 0) readonly buffer DrawParametersBuffer {
+ *         DrawParameters drawParameters[];
+ *     };
+ *
+ * Meshes without index buffers or with attribute buffers of different sizes are not batched, they
+ * have to be drawn separately, see getUnbatched().
+ *
+ * Requires OpenGL 4.3, see isSupported().
+ */
+class IVW_MODULE_OPENGL_API MeshBatchGL {
+public:
+    static constexpr GLuint drawIdLocation = 15;
+    static constexpr GLuint drawParametersBinding = 0;
+
+    /**
+     * Per mesh data in the shader storage buffer, matches the std430 layout of the GLSL struct
+     */
+    struct DrawParameters {
+        mat4 dataToWorld;
+        mat4 dataToWorldNormalMatrix;  //!< the upper left 3x3 part is used
+    };
+
+    MeshBatchGL();
+    MeshBatchGL(const MeshBatchGL&) = delete;
+    MeshBatchGL(MeshBatchGL&&);
+    MeshBatchGL& operator=(const MeshBatchGL&) = delete;
+    MeshBatchGL& operator=(MeshBatchGL&&);
+    ~MeshBatchGL();
+
+    static bool isSupported();
+
+    /**
+     * Rebuild the batches from @p meshes. Needs to be called whenever any of the meshes changes.
+     */
+    void build(const std::vector<std::shared_ptr<const Mesh>>& meshes);
+
+    /**
+     * Draw all batched meshes. @p setup is called before each batch is drawn with the first mesh
+     * of the batch, for example to set uniforms depending on the available buffers.
+     */
+    void draw(const std::function<void(const Mesh&)>& setup = {}) const;
+
+    /**
+     * The meshes passed to build() that could not be batched.
+     */
+    const std::vector<std::shared_ptr<const Mesh>>& getUnbatched() const;
+
+    size_t getNumberOfBatches() const;
+
+private:
+    struct Batch;
+    static std::unique_ptr<Batch> createBatch(std::vector<std::shared_ptr<const Mesh>> meshes);
+
+    std::vector<std::unique_ptr<Batch>> batches_;
+    std::vector<std::shared_ptr<const Mesh>> unbatched_;
+};
+
+}  // namespace inviwo
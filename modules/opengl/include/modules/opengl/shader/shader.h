@@ -35,12 +35,13 @@
 #include <inviwo/core/util/glmmat.h>             // for mat2, mat3, mat4
 #include <inviwo/core/util/glmvec.h>             // for bvec2, bvec3, bvec4, ivec2, ivec3, ivec4
 #include <inviwo/core/util/iterrange.h>          // for iter_range
+#include <inviwo/core/util/transparentmaps.h>    // for UnorderedStringMap
 #include <modules/opengl/inviwoopengl.h>         // for GLint, GLuint
 #include <modules/opengl/shader/shaderobject.h>  // for ShaderObject, ShaderObject::Callback
 
 #include <cstddef>      // for nullptr_t
-#include <functional>   // for function, less
-#include <map>          // for map
+#include <cstdint>      // for uint64_t
+#include <functional>   // for function
 #include <memory>       // for shared_ptr, unique_ptr
 #include <string>       // for string
 #include <string_view>  // for string_view
@@ -52,6 +53,7 @@
 namespace inviwo {
 
 class OpenGLException;
+class ShaderBinaryCache;
 class ShaderResource;
 class ShaderType;
 class TextureUnit;
@@ -127,6 +129,14 @@ public:
 
     void link();
     void build();
+    /**
+     * Build several shaders at once. The shader objects of all shaders are submitted for
+     * compilation before waiting for any of them, so drivers that compile in parallel, see
+     * GL_KHR_parallel_shader_compile, can overlap the work. Programs found in the shader binary
+     * cache are loaded without compiling at all.
+     * @see ShaderManager::getBinaryCache
+     */
+    static void build(std::span<Shader* const> shaders);
     bool isReady() const;  // returns whether the shader has been built and linked successfully
     void invalidate();
 
@@ -238,10 +248,20 @@ private:
     void linkShader(bool notifyRebuild = false);
     bool checkLinkStatus() const;
 
+    bool loadBinary();
+    void submitShaderObjects();
+    std::uint64_t binaryKey(const ShaderBinaryCache& cache) const;
+
     void attach();
     void detach();
 
+    struct Uniform {
+        GLint location;
+        GLint textureUnit;  // The last texture unit set, to skip redundant glUniform calls
+    };
+
     std::string shaderNames() const;
+    Uniform& findUniform(std::string_view name) const;
     GLint findUniformLocation(std::string_view name) const;
 
     Program program_;
@@ -252,10 +272,14 @@ private:
     std::vector<std::shared_ptr<ShaderObject::Callback>> callbacks_;
 
     bool ready_ = false;
+    // The program was loaded from the binary cache and the shader objects are not compiled
+    bool fromBinary_ = false;
+    // Part of the binary cache key, since the varyings are not in the shader source
+    std::string feedbackVaryings_;
 
     UniformWarning warningLevel_;
     // Uniform location cache. Clear after linking.
-    mutable std::map<std::string, GLint, std::less<>> uniformLookup_;
+    mutable UnorderedStringMap<Uniform> uniformLookup_;
 
     // Callback on reload.
     CallBackList onReloadCallback_;
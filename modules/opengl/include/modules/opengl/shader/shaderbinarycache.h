@@ -0,0 +1,95 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/opengl/openglmoduledefine.h>  // for IVW_MODULE_OPENGL_API
+
+#include <modules/opengl/inviwoopengl.h>  // for GLuint
+
+#include <cstdint>      // for uint64_t
+#include <filesystem>   // for path
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+namespace inviwo {
+
+/**
+ * \ingroup gl
+ * An on-disk cache of linked shader program binaries, see glGetProgramBinary. A program is stored
+ * under a key computed from the fully preprocessed source of all its shader objects, and the
+ * vendor, renderer, and version strings of the current driver. Hence any change to a shader
+ * resource, define, or the driver results in a new key and the old binary is simply never used
+ * again. A binary that the driver rejects is removed and the program has to be compiled from
+ * source as usual.
+ * @see Shader ShaderManager::getBinaryCache
+ */
+class IVW_MODULE_OPENGL_API ShaderBinaryCache {
+public:
+    explicit ShaderBinaryCache(std::filesystem::path directory);
+
+    /**
+     * Program binaries need OpenGL 4.1 or GL_ARB_get_program_binary, and at least one binary
+     * format supported by the driver.
+     */
+    static bool isSupported();
+
+    /**
+     * Compute the key for a program from a description of its sources. The description should
+     * contain everything that affects the linked program.
+     */
+    std::uint64_t key(std::string_view description) const;
+
+    /**
+     * Try to load the binary for @p key into @p program.
+     * @return true if the program was successfully linked from the cached binary.
+     */
+    bool load(GLuint program, std::uint64_t key) const;
+
+    /**
+     * Store the binary of the linked @p program under @p key. The program should have been linked
+     * with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set. Failures are only logged.
+     */
+    void store(GLuint program, std::uint64_t key) const;
+
+    /**
+     * Remove all cached binaries
+     */
+    void clear() const;
+
+    const std::filesystem::path& getDirectory() const;
+
+private:
+    std::filesystem::path file(std::uint64_t key) const;
+
+    std::filesystem::path directory_;
+    std::string driver_;
+};
+
+}  // namespace inviwo
@@ -39,6 +39,7 @@
 #include <functional>   // for less, function
 #include <map>          // for map
 #include <memory>       // for shared_ptr, weak_ptr, unique_ptr
+#include <optional>     // for optional
 #include <string>       // for string, operator<
 #include <string_view>  // for string_view
 #include <utility>      // for forward
@@ -47,7 +48,9 @@
 
 namespace inviwo {
 
+class BoolProperty;
 class OpenGLSettings;
+class ShaderBinaryCache;
 class ShaderResource;
 template <typename T>
 class OptionProperty;
@@ -59,7 +62,7 @@ public:
     ShaderManager(const ShaderManager&) = delete;
     ShaderManager& operator=(const ShaderManager&) = delete;
 
-    virtual ~ShaderManager() = default;
+    virtual ~ShaderManager();
 
     void registerShader(Shader* shader);
     void unregisterShader(Shader* shader);
@@ -79,6 +82,13 @@ public:
     void setOpenGLSettings(OpenGLSettings* settings);
     Shader::OnError getOnShaderError() const;
 
+    /**
+     * The cache of linked program binaries, located in the "shaders" folder of the Inviwo cache
+     * directory. Returns nullptr if the cache is disabled in the OpenGL settings or if the driver
+     * does not support program binaries.
+     */
+    ShaderBinaryCache* getBinaryCache();
+
     using Callback = std::function<void(GLuint)>;
     template <typename T>
     std::shared_ptr<Callback> onDidAddShader(T&& callback);
@@ -95,6 +105,9 @@ private:
 
     OptionProperty<Shader::UniformWarning>* uniformWarnings_;  // non-owning reference
     OptionProperty<Shader::OnError>* shaderObjectErrors_;      // non-owning reference
+    BoolProperty* shaderBinaryCache_;                          // non-owning reference
+
+    std::optional<std::unique_ptr<ShaderBinaryCache>> binaryCache_;  // nullptr if unsupported
 
     Dispatcher<void(GLuint)> shaderAddCallbacks_;
     Dispatcher<void(GLuint)> shaderRemoveCallbacks_;
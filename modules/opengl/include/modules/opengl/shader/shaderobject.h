@@ -131,6 +131,23 @@ public:
     void build();
     bool isReady() const;
 
+    /**
+     * Upload the preprocessed source and start compiling it without waiting for the result.
+     * Call checkCompileStatus() afterwards. With GL_KHR_parallel_shader_compile the driver compiles
+     * in the background, so submitting several objects before checking any of them lets those
+     * compile concurrently.
+     */
+    void submit();
+    /**
+     * Wait for the compilation started by submit() and throw an OpenGLException on failure.
+     */
+    void checkCompileStatus();
+
+    /**
+     * The source as it was processed by the last call to preprocess()
+     */
+    const std::string& getProcessedSource() const;
+
     /**
      * Add a define to the shader as
      *     \#define name value
@@ -34,6 +34,7 @@
 #include <inviwo/core/datastructures/geometry/mesh.h>  // for Mesh
 #include <inviwo/core/util/singleton.h>                // for Singleton
 #include <modules/opengl/shader/shader.h>              // for Shader
+#include <modules/opengl/texture/texturepool.h>        // for TexturePool
 
 #include <cstddef>        // for size_t
 #include <memory>         // for unique_ptr
@@ -55,8 +56,18 @@ public:
 
     Shader* getTextureShader();
     Shader* getNoiseShader();
+    Shader* getUpscaleShader();
     Shader* getImageCopyShader(size_t colorLayers);
 
+    /**
+     * Pool of unused textures shared by all LayerGL representations
+     */
+    TexturePool& getTexturePool() { return texturePool_; }
+
+    /**
+     * Release all resources, called before the OpenGL context is destroyed. The texture pool is
+     * also disabled, textures released after this are deleted directly.
+     */
     void reset();
 
 private:
@@ -65,7 +76,9 @@ private:
 
     std::unique_ptr<Shader> textureShader_;
     std::unique_ptr<Shader> noiseShader_;
+    std::unique_ptr<Shader> upscaleShader_;
     std::unordered_map<std::size_t, std::unique_ptr<Shader>> imgCopyShaders_;
+    TexturePool texturePool_;
 
     friend Singleton<SharedOpenGLResources>;
     static SharedOpenGLResources* instance_;
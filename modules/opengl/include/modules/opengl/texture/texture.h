@@ -88,6 +88,12 @@ public:
 
     GLenum getFormat() const;
     GLenum getInternalFormat() const;
+    /**
+     * Whether the internal format is one of the block compressed formats, see
+     * utilgl::compressedFormat. A compressed texture can not be updated using upload, but still be
+     * downloaded, the data is then decompressed by the driver.
+     */
+    bool isCompressed() const;
     GLenum getDataType() const;
     const DataFormatBase* getDataFormat() const;
     GLenum getFiltering() const;
@@ -106,6 +112,11 @@ public:
     void getWrapping(std::span<GLenum> wrapping) const;
 
     void download(void* data) const;
+    /**
+     * Enqueue a copy of the texture contents into the pixel pack buffer @p buffer, which has to
+     * hold at least getNumberOfValues() * getSizeInBytes() bytes. Does not wait for the transfer.
+     */
+    void downloadToBuffer(GLuint buffer) const;
     void downloadToPBO() const;
     void loadFromPBO(const Texture*);
 
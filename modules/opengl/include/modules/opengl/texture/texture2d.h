@@ -37,7 +37,8 @@
 #include <modules/opengl/texture/texture.h>               // for Texture
 
 #include <array>    // for array
-#include <cstddef>  // for size_t
+#include <cstddef>  // for size_t, byte
+#include <span>     // for span
 
 #include <glm/vec2.hpp>  // for vec<>::(anonymous)
 
@@ -65,6 +66,22 @@ public:
 
     void initialize(const void* data);
     void upload(const void* data);
+    /**
+     * Upload the rectangle at @p offset of size @p extent from @p data, which holds the whole
+     * texture.
+     */
+    void upload(const void* data, const size2_t& offset, const size2_t& extent);
+
+    /**
+     * Allocate the texture using the block compressed @p internalFormat and fill it with
+     * @p blocks, as given by utilgl::compressTexture. The texture keeps the compressed format
+     * when it is resized.
+     */
+    void initializeCompressed(GLenum internalFormat, std::span<const std::byte> blocks);
+    /**
+     * Replace the content of a compressed texture with @p blocks.
+     */
+    void uploadCompressed(std::span<const std::byte> blocks);
 
     size_t getNumberOfValues() const;
 
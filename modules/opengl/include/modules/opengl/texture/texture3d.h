@@ -37,7 +37,9 @@
 #include <modules/opengl/texture/texture.h>               // for Texture
 
 #include <array>    // for array
-#include <cstddef>  // for size_t
+#include <cstddef>  // for size_t, byte
+#include <span>     // for span
+#include <vector>   // for vector
 
 namespace inviwo {
 struct GLFormat;
@@ -63,13 +65,63 @@ public:
     Texture3D* clone() const;
 
     void initialize(const void* data);
+    /**
+     * Allocate the texture using @p internalFormat and fill it with @p data of type @p dataType.
+     * The format and data type of the texture, used for downloads, are left unchanged. The
+     * texture keeps @p internalFormat when it is resized.
+     */
+    void initialize(const void* data, GLenum internalFormat, GLenum dataType);
 
     size_t getNumberOfValues() const;
 
     void upload(const void* data);
+    /**
+     * Upload the whole texture from @p data of type @p dataType instead of the data type of the
+     * texture.
+     */
+    void upload(const void* data, GLenum dataType);
+    /**
+     * Upload the box at @p offset of size @p extent from @p data, which holds the whole texture.
+     */
+    void upload(const void* data, const size3_t& offset, const size3_t& extent);
+
+    /**
+     * Allocate the texture using the block compressed @p internalFormat and fill it with
+     * @p blocks, as given by utilgl::compressTexture. The texture keeps the compressed format
+     * when it is resized.
+     */
+    void initializeCompressed(GLenum internalFormat, std::span<const std::byte> blocks);
+    /**
+     * Replace the content of a compressed texture with @p blocks.
+     */
+    void uploadCompressed(std::span<const std::byte> blocks);
 
     void uploadAndResize(const void* data, const size3_t& dim);
 
+    /**
+     * Allocate the texture as a sparse texture using ARB_sparse_texture and fill it with
+     * @p data. Memory is only committed for the pages of @p data that are not entirely zero,
+     * sampling the uncommitted pages returns zero (ARB_sparse_texture2). The storage of a sparse
+     * texture is immutable, it can not be resized or initialized again.
+     * @return false if sparse textures are not supported by the context, or the dimensions are
+     *     not a multiple of the page size of the format. The texture is then left unallocated.
+     */
+    bool initializeSparse(const void* data);
+    /**
+     * Update a sparse texture with @p data, committing the pages that became non-empty and
+     * releasing the ones that became empty.
+     */
+    void uploadSparse(const void* data);
+    bool isSparse() const { return !committedPages_.empty(); }
+    /**
+     * The size of the pages of a sparse texture in voxels, zero if the texture is not sparse.
+     */
+    const size3_t& getPageSize() const { return pageSize_; }
+    /**
+     * The number of committed pages of a sparse texture, zero if the texture is not sparse.
+     */
+    size_t getNumberOfCommittedPages() const;
+
     const size3_t& getDimensions() const { return dimensions_; }
 
     void setWrapping(const std::array<GLenum, 3>& wrapping);
@@ -77,6 +129,8 @@ public:
 
 private:
     size3_t dimensions_;
+    size3_t pageSize_{0};
+    std::vector<bool> committedPages_;
 };
 
 }  // namespace inviwo
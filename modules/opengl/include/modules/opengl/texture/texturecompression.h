@@ -0,0 +1,113 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/opengl/openglmoduledefine.h>  // for IVW_MODULE_OPENGL_API
+
+#include <inviwo/core/util/glmvec.h>      // for size3_t
+#include <modules/opengl/inviwoopengl.h>  // for GLenum, GLint
+
+#include <cstddef>      // for size_t, byte
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace inviwo {
+
+enum class TextureCompression { None, BC4, BC5, BC7 };
+
+/**
+ * @brief Description of a block compressed texture format.
+ *
+ * All the supported formats store blocks of 4x4 texels of unsigned normalized 8-bit data. BC4
+ * holds one channel and BC5 two channels, both with 8 bytes per block and channel. BC7 holds
+ * RGBA in 16 bytes per block. Every slice of a 3D texture is compressed separately.
+ */
+struct IVW_MODULE_OPENGL_API CompressedFormat {
+    static constexpr size_t blockSize = 4;
+
+    TextureCompression compression;
+    GLenum internalFormat;
+    size_t channels;    //< number of channels stored in the blocks
+    size_t blockBytes;  //< size of one compressed block in bytes
+    bool volumes;       //< whether the format can be used for 3D textures
+    std::string_view name;
+
+    /**
+     * The number of bytes needed to store a texture of size @p dims in this format.
+     */
+    constexpr size_t compressedSize(size3_t dims) const {
+        return (dims.x + blockSize - 1) / blockSize * ((dims.y + blockSize - 1) / blockSize) *
+               dims.z * blockBytes;
+    }
+};
+
+namespace utilgl {
+
+/**
+ * The format description of @p compression, nullptr for TextureCompression::None.
+ */
+IVW_MODULE_OPENGL_API const CompressedFormat* compressedFormat(TextureCompression compression);
+
+/**
+ * The format description matching the compressed @p internalFormat, nullptr if @p internalFormat
+ * is not one of the supported compressed formats.
+ */
+IVW_MODULE_OPENGL_API const CompressedFormat* compressedFormat(GLenum internalFormat);
+
+/**
+ * Check if the current OpenGL context can create textures of type @p target with
+ * @p compression.
+ */
+IVW_MODULE_OPENGL_API bool isCompressionSupported(TextureCompression compression, GLenum target);
+
+/**
+ * Select a compression for a texture of type @p target with the uncompressed @p internalFormat.
+ * GL_R8 maps to BC4, GL_RG8 to BC5, and GL_RGB8 and GL_RGBA8 to BC7. BC4 and BC5 are only used
+ * for 2D textures, since they can not hold 3D textures and BC7 would not make single and dual
+ * channel data any smaller. Returns TextureCompression::None for other formats or if the
+ * compression is not supported by the current context.
+ */
+IVW_MODULE_OPENGL_API TextureCompression selectCompression(GLint internalFormat, GLenum target);
+
+/**
+ * Encode @p data, 8-bit unsigned texels with @p channels interleaved channels and size @p dims,
+ * into the blocks of @p compression. The blocks are encoded in parallel using the Inviwo thread
+ * pool. Blocks on the right and bottom edges are padded by repeating the last row and column.
+ * Three channel data is compressed with an opaque alpha channel.
+ * @return the compressed blocks, CompressedFormat::compressedSize bytes.
+ * @throws Exception if @p channels does not match @p compression.
+ */
+IVW_MODULE_OPENGL_API std::vector<std::byte> compressTexture(const void* data, size3_t dims,
+                                                             size_t channels,
+                                                             TextureCompression compression);
+
+}  // namespace utilgl
+
+}  // namespace inviwo
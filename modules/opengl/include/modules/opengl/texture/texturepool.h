@@ -0,0 +1,116 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/opengl/openglmoduledefine.h>  // for IVW_MODULE_OPENGL_API
+
+#include <inviwo/core/datastructures/image/imagetypes.h>  // for SwizzleMask
+#include <inviwo/core/util/glmvec.h>                      // for size2_t
+#include <modules/opengl/inviwoopengl.h>                  // for GLenum, GLint
+
+#include <array>    // for array
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr
+#include <mutex>    // for mutex
+#include <vector>   // for vector
+
+namespace inviwo {
+
+class Texture2D;
+
+/**
+ * @brief A pool of unused 2D textures that can be reused for new layers of the same size and
+ * format.
+ *
+ * Render targets are reallocated whenever a canvas is resized, and every ImageOutport in the chain
+ * above it reallocates its layers. The LayerGL hands its texture back to the pool when it is
+ * resized or destroyed, and takes one from the pool when it needs a new one. Resizing a canvas
+ * back and forth, or recreating images of the same size, then reuses the existing textures instead
+ * of allocating new ones.
+ *
+ * The textures are matched by dimensions, internal format, format, and data type. Sampling
+ * parameters are reset when a texture is acquired. The pool keeps at most getCapacity() bytes and
+ * evicts the least recently released textures first. Nothing is kept while the GL memory budget
+ * is exceeded.
+ */
+class IVW_MODULE_OPENGL_API TexturePool {
+public:
+    static constexpr size_t defaultCapacity = size_t{256} * 1024 * 1024;
+
+    explicit TexturePool(size_t capacity = defaultCapacity);
+    TexturePool(const TexturePool&) = delete;
+    TexturePool& operator=(const TexturePool&) = delete;
+    ~TexturePool();
+
+    /**
+     * Get an allocated texture with the given storage. A matching texture from the pool is used if
+     * there is one, otherwise a new texture is created and initialized. The content of the texture
+     * is undefined.
+     */
+    std::shared_ptr<Texture2D> acquire(size2_t dimensions, GLint format, GLint internalFormat,
+                                       GLenum dataType, GLenum filtering,
+                                       const SwizzleMask& swizzleMask,
+                                       const std::array<GLenum, 2>& wrapping);
+
+    /**
+     * Return @p texture to the pool. Textures that are still referenced elsewhere are left alone.
+     */
+    void release(std::shared_ptr<Texture2D>&& texture);
+
+    /**
+     * Delete all the textures in the pool.
+     */
+    void clear();
+
+    /**
+     * Set the maximum number of bytes kept in the pool. A capacity of 0 disables the pool.
+     */
+    void setCapacity(size_t bytes);
+    size_t getCapacity() const;
+
+    /**
+     * @return the number of bytes currently kept in the pool
+     */
+    size_t getSize() const;
+
+private:
+    struct Entry {
+        std::shared_ptr<Texture2D> texture;
+        size_t bytes;
+    };
+    void evict(size_t capacity);
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> textures_;  //< ordered from least to most recently released
+    size_t size_ = 0;
+    size_t capacity_;
+};
+
+}  // namespace inviwo
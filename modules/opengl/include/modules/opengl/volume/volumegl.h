@@ -34,10 +34,11 @@
 #include <inviwo/core/datastructures/image/imagetypes.h>             // for InterpolationType
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>  // for VolumeRepresentation
 #include <inviwo/core/util/formats.h>                                // for DataFormatBase
-#include <inviwo/core/util/glmvec.h>                                 // for size3_t
+#include <inviwo/core/util/glmvec.h>                                 // for size3_t, dvec2
 #include <modules/opengl/inviwoopengl.h>                             // for GLenum
 
 #include <memory>     // for shared_ptr
+#include <optional>   // for optional
 #include <typeindex>  // for type_index
 
 namespace inviwo {
@@ -51,6 +52,14 @@ namespace kind {
 struct GL {};
 }  // namespace kind
 
+/**
+ * The storage used on the GPU for volumes with 32-bit floating point data. Float16 keeps the
+ * values with less precision. UNorm16 and UNorm8 store the values normalized over the data range
+ * of the volume, values outside of the data range are clamped.
+ * @see VolumeRAM2GLConverter::setFloatPrecision
+ */
+enum class FloatVolumePrecision { Float32, Float16, UNorm16, UNorm8 };
+
 /**
  * \ingroup datastructures
  */
@@ -99,8 +108,26 @@ public:
 
     virtual void updateResource(const ResourceMeta& meta) const override;
 
+    /**
+     * Record how the floating point data is stored in the texture. The data format of the volume
+     * is unchanged, only the internal format of the texture differs. For the normalized
+     * precisions @p range is the value range that is mapped to [0, 1] in the texture.
+     * Set by the VolumeRAM2GLConverter when the texture is uploaded.
+     */
+    void setFloatPrecision(FloatVolumePrecision precision, dvec2 range = dvec2{0.0, 1.0});
+    FloatVolumePrecision getFloatPrecision() const { return precision_; }
+
+    /**
+     * The value range mapped to [0, 1] in the texture for the normalized precisions, and
+     * std::nullopt if the texture holds the values themselves. Needs to be accounted for when
+     * sampling the texture, see utilgl::setShaderUniforms.
+     */
+    std::optional<dvec2> getNormalizedRange() const;
+
 private:
     std::shared_ptr<Texture3D> texture_;
+    FloatVolumePrecision precision_ = FloatVolumePrecision::Float32;
+    dvec2 normalizedRange_{0.0, 1.0};
 };
 
 template <>
@@ -35,23 +35,70 @@
 #include <inviwo/core/datastructures/volume/volumeram.h>         // for VolumeRAM
 #include <modules/opengl/volume/volumegl.h>                      // for VolumeGL
 
+#include <atomic>  // for atomic
 #include <memory>  // for shared_ptr
 
 namespace inviwo {
+class Volume;
 class VolumeRepresentation;
 
 class IVW_MODULE_OPENGL_API VolumeRAM2GLConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeRAM, VolumeGL> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<VolumeGL> createFrom(
         std::shared_ptr<const VolumeRAM> source) const override;
     virtual void update(std::shared_ptr<const VolumeRAM> source,
                         std::shared_ptr<VolumeGL> destination) const override;
+    /**
+     * Uses the data range of @p volume for the normalized FloatVolumePrecisions, without a volume
+     * [0, 1] is used.
+     */
+    virtual std::shared_ptr<VolumeGL> createFrom(std::shared_ptr<const VolumeRAM> source,
+                                                 const Volume& volume) const override;
+    virtual void update(std::shared_ptr<const VolumeRAM> source,
+                        std::shared_ptr<VolumeGL> destination,
+                        const Volume& volume) const override;
+
+    /**
+     * Use block compressed textures for new 8-bit volumes when the format is supported,
+     * see utilgl::selectCompression. Disabled by default.
+     */
+    void setCompression(bool enabled) { compress_ = enabled; }
+    bool getCompression() const { return compress_; }
+
+    /**
+     * Store new volumes with 32-bit floating point data using @p precision on the GPU. The
+     * data is converted in parallel before the upload. For the normalized precisions the values
+     * are normalized over the data range of the volume, and the shader uniforms are adjusted to
+     * give the same values when sampled, see VolumeGL::getNormalizedRange. Defaults to
+     * FloatVolumePrecision::Float32, i.e. no conversion.
+     */
+    void setFloatPrecision(FloatVolumePrecision precision) { floatPrecision_ = precision; }
+    FloatVolumePrecision getFloatPrecision() const { return floatPrecision_; }
+
+    /**
+     * Use sparse textures for new volumes, committing GPU memory only for the pages that are not
+     * all zero, see Texture3D::initializeSparse. Volumes fall back to regular textures when
+     * sparse textures are not supported. Disabled by default.
+     */
+    void setSparse(bool enabled) { sparse_ = enabled; }
+    bool getSparse() const { return sparse_; }
+
+private:
+    std::shared_ptr<VolumeGL> create(const std::shared_ptr<const VolumeRAM>& source,
+                                     const Volume* volume) const;
+    void upload(const VolumeRAM& source, VolumeGL& destination, const Volume* volume) const;
+
+    std::atomic<bool> compress_ = false;
+    std::atomic<bool> sparse_ = false;
+    std::atomic<FloatVolumePrecision> floatPrecision_ = FloatVolumePrecision::Float32;
 };
 
 class IVW_MODULE_OPENGL_API VolumeGL2RAMConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeGL, VolumeRAM> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<VolumeRAM> createFrom(
         std::shared_ptr<const VolumeGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeGL> source,
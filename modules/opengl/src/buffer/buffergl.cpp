@@ -31,6 +31,7 @@
 
 #include <inviwo/core/datastructures/buffer/bufferrepresentation.h>  // for BufferRepresentation
 #include <inviwo/core/datastructures/geometry/geometrytype.h>        // for BufferTarget, Buffer...
+#include <inviwo/core/resourcemanager/resource.h>                    // for GL, ResourceMeta, meta
 #include <inviwo/core/util/formats.h>                                // for DataFormatBase
 #include <modules/opengl/buffer/bufferobject.h>                      // for BufferObject
 #include <modules/opengl/buffer/bufferobjectarray.h>                 // for BufferObjectArray
@@ -84,6 +85,10 @@ void BufferGL::upload(const void* data, GLsizeiptr sizeInBytes) {
     buffer_->upload(data, sizeInBytes);
 }
 
+void BufferGL::upload(const void* data, GLintptr offsetInBytes, GLsizeiptr sizeInBytes) {
+    buffer_->upload(data, offsetInBytes, sizeInBytes);
+}
+
 void BufferGL::download(void* data) const { buffer_->download(data); }
 
 void BufferGL::enable() const {
@@ -104,4 +109,10 @@ void BufferGL::disable() const {
 
 std::type_index BufferGL::getTypeIndex() const { return std::type_index(typeid(BufferGL)); }
 
+void BufferGL::updateResource(const ResourceMeta& meta) const {
+    if (buffer_) {
+        resource::meta(resource::GL{buffer_->getId(), resource::GL::Kind::Buffer}, meta);
+    }
+}
+
 }  // namespace inviwo
@@ -35,6 +35,8 @@
 #include <inviwo/core/util/sourcecontext.h>
 #include <modules/opengl/buffer/buffergl.h>  // for BufferGL
 
+#include <cstddef>      // for byte
+#include <optional>     // for optional
 #include <string>       // for operator+, string
 #include <type_traits>  // for remove_extent_t
 
@@ -56,8 +58,19 @@ std::shared_ptr<BufferGL> BufferRAM2GLConverter::createFrom(
 
 void BufferRAM2GLConverter::update(std::shared_ptr<const BufferRAM> src,
                                    std::shared_ptr<BufferGL> dst) const {
+    const auto region = dst->getSize() == src->getSize()
+                            ? src->getModifiedRegion(dst->getGeneration())
+                            : std::nullopt;
+
     dst->setSize(src->getSize());
-    dst->upload(src->getData(), src->getSize() * src->getSizeOfElement());
+    if (region) {
+        const auto elementSize = src->getSizeOfElement();
+        dst->upload(static_cast<const std::byte*>(src->getData()) + region->offset * elementSize,
+                    static_cast<GLintptr>(region->offset * elementSize),
+                    static_cast<GLsizeiptr>(region->extent * elementSize));
+    } else {
+        dst->upload(src->getData(), src->getSize() * src->getSizeOfElement());
+    }
 }
 
 std::shared_ptr<BufferRAM> BufferGL2RAMConverter::createFrom(
@@ -34,6 +34,7 @@
 #include <inviwo/core/util/logcentral.h>                       // for LogCentral
 #include <inviwo/core/util/observer.h>                         // for Observable
 #include <modules/opengl/buffer/bufferobjectobserver.h>        // for BufferObjectObserver
+#include <modules/opengl/buffer/persistentringbuffer.h>        // for PersistentRingBuffer
 #include <modules/opengl/glformats.h>                          // for GLFormat, operator!=, GLFo...
 #include <modules/opengl/inviwoopengl.h>                       // for GLenum, GLsizeiptr, glVert...
 #include <modules/opengl/openglexception.h>                    // for OpenGLException
@@ -48,7 +49,9 @@ namespace inviwo {
 
 BufferObject::BufferObject(size_t sizeInBytes, const DataFormatBase* format, BufferUsage usage,
                            BufferTarget target)
-    : Observable<BufferObjectObserver>(), glFormat_(GLFormats::get(format->getId())) {
+    : Observable<BufferObjectObserver>()
+    , glFormat_(GLFormats::get(format->getId()))
+    , staging_{} {
     switch (usage) {
         case BufferUsage::Dynamic:
             usageGL_ = GL_DYNAMIC_DRAW;
@@ -80,7 +83,8 @@ BufferObject::BufferObject(size_t sizeInBytes, GLFormat format, GLenum usage, GL
     , target_(target)
     , glFormat_(format)
     , sizeInBytes_(0)
-    , capacityInBytes_(0) {
+    , capacityInBytes_(0)
+    , staging_{} {
 
     glGenBuffers(1, &id_);
 
@@ -93,7 +97,8 @@ BufferObject::BufferObject(const BufferObject& rhs)
     , target_(rhs.target_)
     , glFormat_(rhs.glFormat_)
     , sizeInBytes_(0)
-    , capacityInBytes_(0) {
+    , capacityInBytes_(0)
+    , staging_{} {
     glGenBuffers(1, &id_);
     *this = rhs;
 }
@@ -105,7 +110,8 @@ BufferObject::BufferObject(BufferObject&& rhs)
     , target_(rhs.target_)
     , glFormat_(rhs.glFormat_)
     , sizeInBytes_(rhs.sizeInBytes_)
-    , capacityInBytes_(rhs.capacityInBytes_) {
+    , capacityInBytes_(rhs.capacityInBytes_)
+    , staging_(std::move(rhs.staging_)) {
     // Free resources from other
     rhs.id_ = 0;
 }
@@ -150,6 +156,7 @@ BufferObject& BufferObject::operator=(BufferObject&& rhs) {
         glFormat_ = rhs.glFormat_;
         sizeInBytes_ = rhs.sizeInBytes_;
         capacityInBytes_ = rhs.capacityInBytes_;
+        staging_ = std::move(rhs.staging_);
 
         // Release resources from source object
         rhs.id_ = 0;
@@ -160,7 +167,7 @@ BufferObject& BufferObject::operator=(BufferObject&& rhs) {
 }
 
 BufferObject::~BufferObject() {
-    resource::remove(resource::GL{id_});
+    resource::remove(resource::GL{id_, resource::GL::Kind::Buffer});
     glDeleteBuffers(1, &id_);
 }
 
@@ -266,25 +273,46 @@ void BufferObject::initialize(const void* data, GLsizeiptr sizeInBytes) {
 
     forEachObserver([](BufferObjectObserver* o) { o->onAfterBufferInitialization(); });
 
-    resource::add(
-        resource::GL{id_},
-        Resource{
-            .dims = glm::size4_t{capacityInBytes_ / getDataFormat()->getSizeInBytes(), 0, 0, 0},
-            .format = getDataFormat()->getId(),
-            .desc = "BufferObject"});
+    const resource::GL key{id_, resource::GL::Kind::Buffer};
+    const auto elements = capacityInBytes_ / getDataFormat()->getSizeInBytes();
+    auto old = resource::remove(key);
+    resource::add(key, Resource{.dims = glm::size4_t{elements, 0, 0, 0},
+                                .format = getDataFormat()->getId(),
+                                .desc = "BufferObject",
+                                .meta = resource::getMeta(old)});
 }
 
 void BufferObject::upload(const void* data, GLsizeiptr sizeInBytes, SizePolicy policy) {
     if ((sizeInBytes == getCapacityInBytes() && policy == SizePolicy::ResizeToFit) ||
         (sizeInBytes <= getCapacityInBytes() && policy == SizePolicy::GrowOnly)) {
-        bind();
-        glBufferSubData(target_, 0, sizeInBytes, data);
+        if (useStreaming()) {
+            // The staging buffer can hold the whole capacity to avoid recreating it when the
+            // size of the uploads varies
+            if (!staging_ || staging_->getRegionSizeInBytes() < sizeInBytes) {
+                staging_ = std::make_unique<PersistentRingBuffer>(getCapacityInBytes());
+            }
+            staging_->upload(data, sizeInBytes, id_);
+            bind();
+        } else {
+            bind();
+            glBufferSubData(target_, 0, sizeInBytes, data);
+        }
         sizeInBytes_ = sizeInBytes;
     } else {
         initialize(data, sizeInBytes);
     }
 }
 
+void BufferObject::upload(const void* data, GLintptr offsetInBytes, GLsizeiptr sizeInBytes) {
+    bind();
+    glBufferSubData(target_, offsetInBytes, sizeInBytes, data);
+}
+
+bool BufferObject::useStreaming() const {
+    return (usageGL_ == GL_DYNAMIC_DRAW || usageGL_ == GL_STREAM_DRAW) &&
+           PersistentRingBuffer::isSupported();
+}
+
 void BufferObject::download(void* data) const {
     bind();
     // Map data
@@ -0,0 +1,137 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/opengl/buffer/persistentringbuffer.h>
+
+#include <inviwo/core/util/sourcecontext.h>     // for SourceContext
+#include <modules/opengl/inviwoopengl.h>        // for glBufferStorage, glMapBufferRange, glF...
+#include <modules/opengl/openglcapabilities.h>  // for OpenGLCapabilities
+#include <modules/opengl/openglexception.h>     // for OpenGLException
+
+#include <algorithm>  // for max
+#include <cstring>    // for memcpy
+
+namespace inviwo {
+
+namespace {
+
+constexpr GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+}  // namespace
+
+PersistentRingBuffer::PersistentRingBuffer(GLsizeiptr regionSizeInBytes, size_t regions)
+    : id_{0}
+    , regionSizeInBytes_{std::max(regionSizeInBytes, GLsizeiptr{1})}
+    , mapped_{nullptr}
+    , fences_(std::max(regions, size_t{1}), nullptr)
+    , current_{0} {
+    LGL_ERROR_CLASS;
+    const auto size = regionSizeInBytes_ * static_cast<GLsizeiptr>(fences_.size());
+
+    glGenBuffers(1, &id_);
+    glBindBuffer(GL_COPY_READ_BUFFER, id_);
+    glBufferStorage(GL_COPY_READ_BUFFER, size, nullptr, mapFlags);
+    mapped_ = static_cast<std::byte*>(glMapBufferRange(GL_COPY_READ_BUFFER, 0, size, mapFlags));
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+    if (!mapped_) {
+        const auto err = glGetError();
+        glDeleteBuffers(1, &id_);
+        throw OpenGLException(SourceContext{},
+                              "Unable to create persistently mapped buffer of size {}. Error: {}",
+                              size, getGLErrorString(err));
+    }
+}
+
+PersistentRingBuffer::~PersistentRingBuffer() {
+    for (auto fence : fences_) {
+        if (fence) glDeleteSync(fence);
+    }
+    glBindBuffer(GL_COPY_READ_BUFFER, id_);
+    glUnmapBuffer(GL_COPY_READ_BUFFER);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glDeleteBuffers(1, &id_);
+}
+
+bool PersistentRingBuffer::isSupported() {
+    static const bool supported =
+        OpenGLCapabilities::getOpenGLVersion() >= 440 ||
+        OpenGLCapabilities::isExtensionSupported("GL_ARB_buffer_storage");
+    return supported;
+}
+
+GLsizeiptr PersistentRingBuffer::getRegionSizeInBytes() const { return regionSizeInBytes_; }
+
+size_t PersistentRingBuffer::getNumberOfRegions() const { return fences_.size(); }
+
+void PersistentRingBuffer::upload(const void* data, GLsizeiptr sizeInBytes, GLuint dst,
+                                  GLintptr dstOffset) {
+    if (sizeInBytes > regionSizeInBytes_) {
+        throw OpenGLException(SourceContext{},
+                              "Upload of {} bytes does not fit in a region of {} bytes",
+                              sizeInBytes, regionSizeInBytes_);
+    }
+    if (sizeInBytes <= 0) return;
+
+    waitForRegion(current_);
+
+    const auto offset = static_cast<GLintptr>(current_) * regionSizeInBytes_;
+    std::memcpy(mapped_ + offset, data, static_cast<size_t>(sizeInBytes));
+
+    glBindBuffer(GL_COPY_READ_BUFFER, id_);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, dst);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, dstOffset, sizeInBytes);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+    fences_[current_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    current_ = (current_ + 1) % fences_.size();
+}
+
+void PersistentRingBuffer::waitForRegion(size_t region) {
+    auto& fence = fences_[region];
+    if (!fence) return;
+
+    // Flush on the first wait so that the fence is guaranteed to be signaled eventually
+    GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+    constexpr GLuint64 timeout = 1'000'000;  // 1 ms in nanoseconds
+    while (true) {
+        const auto res = glClientWaitSync(fence, flags, timeout);
+        if (res == GL_ALREADY_SIGNALED || res == GL_CONDITION_SATISFIED) break;
+        if (res == GL_WAIT_FAILED) {
+            glDeleteSync(fence);
+            fence = nullptr;
+            throw OpenGLException(SourceContext{}, "Waiting for a buffer upload fence failed");
+        }
+        flags = 0;
+    }
+    glDeleteSync(fence);
+    fence = nullptr;
+}
+
+}  // namespace inviwo
@@ -39,6 +39,7 @@
 #include <inviwo/core/util/canvas.h>                                    // for Canvas
 #include <inviwo/core/util/glmvec.h>                                    // for size2_t, dvec2
 #include <modules/opengl/debugmessages.h>                               // for handleOpenGLDebug...
+#include <modules/opengl/framemetrics.h>                                // for FrameMetrics
 #include <modules/opengl/geometry/meshgl.h>                             // for MeshGL
 #include <modules/opengl/image/layergl.h>                               // for LayerGL
 #include <modules/opengl/inviwoopengl.h>                                // for glEnable, glClear
@@ -51,14 +52,17 @@
 #include <type_traits>    // for remove_extent_t
 #include <unordered_set>  // for unordered_set
 
-#include <glm/common.hpp>  // for clamp
-#include <glm/vec2.hpp>    // for operator-, vec<>:...
-#include <glm/vec4.hpp>    // for vec<>::(anonymous)
+#include <glm/common.hpp>             // for clamp
+#include <glm/vec2.hpp>               // for operator-, vec<>:...
+#include <glm/vec4.hpp>               // for vec<>::(anonymous)
+#include <glm/vector_relational.hpp>  // for any, lessThan
 
 namespace inviwo {
 
 CanvasGL::CanvasGL() : Canvas() {}
 
+CanvasGL::~CanvasGL() = default;
+
 void CanvasGL::defaultGLState() {
     if (!OpenGLCapabilities::hasSupportedOpenGLVersion()) return;
 
@@ -119,6 +123,7 @@ bool CanvasGL::ready() {
         squareGL_ = square_->getRepresentation<MeshGL>();
         textureShader_ = SharedOpenGLResources::getPtr()->getTextureShader();
         noiseShader_ = SharedOpenGLResources::getPtr()->getNoiseShader();
+        upscaleShader_ = SharedOpenGLResources::getPtr()->getUpscaleShader();
         return true;
     } else {
         return false;
@@ -127,6 +132,7 @@ bool CanvasGL::ready() {
 
 void CanvasGL::renderNoise() {
     if (!ready()) return;
+    if (frameMetrics_) frameMetrics_->beginFrame();
 
     glViewport(0, 0, static_cast<GLsizei>(getCanvasDimensions().x),
                static_cast<GLsizei>(getCanvasDimensions().y));
@@ -134,21 +140,59 @@ void CanvasGL::renderNoise() {
     noiseShader_->activate();
     drawSquare();
     noiseShader_->deactivate();
-    glSwapBuffers();
+    present();
 }
 
 void CanvasGL::renderTexture(int unitNumber) {
     if (!ready()) return;
+    if (frameMetrics_) frameMetrics_->beginFrame();
 
     glViewport(0, 0, static_cast<GLsizei>(getCanvasDimensions().x),
                static_cast<GLsizei>(getCanvasDimensions().y));
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
-    textureShader_->activate();
-    textureShader_->setUniform("tex_", unitNumber);
+
+    const auto imageDims = getImageDimensions();
+    const auto canvasDims = getCanvasDimensions();
+    const bool upscale = upscaleSharpness_ > 0.0f && imageDims.x > 0 && imageDims.y > 0 &&
+                         glm::any(glm::lessThan(imageDims, canvasDims));
+
+    Shader* shader = upscale ? upscaleShader_ : textureShader_;
+    shader->activate();
+    shader->setUniform("tex_", unitNumber);
+    if (upscale) {
+        shader->setUniform("reciprocalDimensions", vec2{1.0f} / vec2{imageDims});
+        shader->setUniform("sharpness", upscaleSharpness_);
+    }
     drawSquare();
-    textureShader_->deactivate();
+    shader->deactivate();
+    present();
+}
+
+void CanvasGL::present() {
+    if (frameMetrics_ && frameMetricsOverlay_) {
+        frameMetrics_->drawOverlay(getCanvasDimensions());
+    }
     glSwapBuffers();
+    if (frameMetrics_) frameMetrics_->endFrame();
+}
+
+void CanvasGL::setUpscaleSharpness(float sharpness) {
+    upscaleSharpness_ = glm::clamp(sharpness, 0.0f, 1.0f);
 }
+float CanvasGL::getUpscaleSharpness() const { return upscaleSharpness_; }
+
+void CanvasGL::setFrameMetricsEnabled(bool enabled) {
+    if (enabled && !frameMetrics_) {
+        frameMetrics_ = std::make_unique<FrameMetrics>();
+    } else if (!enabled && frameMetrics_) {
+        // The metrics hold GL queries of this canvas' context
+        activate();
+        frameMetrics_.reset();
+    }
+}
+FrameMetrics* CanvasGL::getFrameMetrics() { return frameMetrics_.get(); }
+
+void CanvasGL::setFrameMetricsOverlay(bool overlay) { frameMetricsOverlay_ = overlay; }
 
 void CanvasGL::drawSquare() {
     squareGL_->enable();
@@ -29,11 +29,21 @@
 
 #include <modules/opengl/canvasprocessorgl.h>
 
-#include <inviwo/core/algorithm/markdown.h>         // for operator""_unindentHelp
-#include <inviwo/core/processors/processorinfo.h>   // for ProcessorInfo
-#include <inviwo/core/processors/processorstate.h>  // for CodeState, CodeState::Stable
-#include <inviwo/core/processors/processortags.h>   // for Tags, Tags::GL
+#include <inviwo/core/algorithm/markdown.h>                 // for operator""_unindentHelp
+#include <inviwo/core/common/inviwoapplication.h>           // for InviwoApplication
+#include <inviwo/core/interaction/events/event.h>           // for Event
+#include <inviwo/core/interaction/events/resizeevent.h>     // for ResizeEvent
+#include <inviwo/core/network/processornetworkevaluator.h>  // for ProcessorNetworkEvaluator
+#include <inviwo/core/processors/processorinfo.h>           // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>          // for CodeState, CodeState::Stable
+#include <inviwo/core/processors/processortags.h>           // for Tags, Tags::GL
+#include <inviwo/core/util/exception.h>                     // for Exception
+#include <inviwo/core/util/logcentral.h>                    // for log
+#include <modules/opengl/canvasgl.h>                        // for CanvasGL
+#include <modules/opengl/framemetrics.h>                    // for FrameMetrics
 
+#include <algorithm>    // for clamp
+#include <cmath>        // for sqrt
 #include <memory>       // for shared_ptr, shared_ptr<>::element_type
 #include <string>       // for string
 #include <type_traits>  // for remove_extent_t
@@ -53,6 +63,183 @@ const ProcessorInfo CanvasProcessorGL::processorInfo_{
 };
 const ProcessorInfo& CanvasProcessorGL::getProcessorInfo() const { return processorInfo_; }
 
-CanvasProcessorGL::CanvasProcessorGL(InviwoApplication* app) : CanvasProcessor(app) {}
+namespace {
+
+/// Render scale is lowered when the frame time exceeds the target by this factor
+constexpr double overBudget = 1.1;
+/// and raised again when the frame time is below the target by this factor
+constexpr double underBudget = 0.7;
+constexpr double scaleUpStep = 1.1;
+/// Weight of a new frame time sample in the exponential moving average
+constexpr double smoothing = 0.3;
+
+}  // namespace
+
+CanvasProcessorGL::CanvasProcessorGL(InviwoApplication* app)
+    : CanvasProcessor(app)
+    , dynamicResolution_{"dynamicResolution", "Dynamic Resolution",
+                         "Lower the resolution of the rendered image when the network can not "
+                         "keep up with the frame time target during interaction. The image is "
+                         "upscaled to the canvas size and the full resolution is restored when "
+                         "the network becomes idle."_help,
+                         false, InvalidationLevel::InvalidOutput}
+    , targetFrameTime_{"targetFrameTime", "Target Frame Time (ms)",
+                       util::ordinalLength(16.7f, 100.0f)
+                           .setMin(1.0f)
+                           .set("The time one network evaluation should take, 16.7 ms "
+                                "corresponds to 60 Hz"_help)}
+    , minScale_{"minScale", "Minimum Scale",
+                util::ordinalScale(0.5f, 1.0f)
+                    .setMin(0.1f)
+                    .setMax(ConstraintBehavior::Immutable)
+                    .set("The smallest fraction of the canvas dimensions to render at"_help)}
+    , sharpness_{"sharpness", "Upscale Sharpness",
+                 util::ordinalScale(0.5f, 1.0f)
+                     .setMax(ConstraintBehavior::Immutable)
+                     .set("Amount of sharpening applied when upscaling, 0 gives plain "
+                          "bilinear filtering"_help)}
+    , frameMetrics_{"frameMetrics", "Frame Metrics",
+                    "Record frame times, GPU time, evaluations per frame, dropped frames and "
+                    "the latency from interaction to the frame being shown"_help,
+                    false, InvalidationLevel::Valid}
+    , frameInterval_{"frameInterval", "Target Frame Time (ms)",
+                     util::ordinalLength(16.7f, 100.0f)
+                         .setMin(1.0f)
+                         .set("The expected time between frames, frames taking longer count as "
+                              "dropped. 16.7 ms corresponds to 60 Hz"_help)
+                         .set(InvalidationLevel::Valid)}
+    , metricsOverlay_{"metricsOverlay", "Show Overlay",
+                      "Draw a graph of the recent frame times in the lower left corner of the "
+                      "canvas"_help,
+                      false, InvalidationLevel::Valid}
+    , metricsFile_{"metricsFile", "Export File",
+                   "Comma separated file to write the recorded frames to"_help, {},
+                   AcceptMode::Save, FileMode::AnyFile}
+    , exportMetrics_{"exportMetrics", "Export",
+                     "Write the recorded frames to the export file"_help,
+                     [this]() {
+                         auto* metrics = getFrameMetrics();
+                         if (!metrics) return;
+                         try {
+                             metrics->writeCSV(metricsFile_.get());
+                         } catch (const Exception& e) {
+                             log::exception(e);
+                         }
+                     },
+                     InvalidationLevel::Valid}
+    , resetMetrics_{"resetMetrics", "Reset", "Discard all recorded frames"_help,
+                    [this]() {
+                        if (auto* metrics = getFrameMetrics()) metrics->reset();
+                    },
+                    InvalidationLevel::Valid}
+    , idle_{std::chrono::milliseconds{500}, [this]() {
+                refining_ = true;
+                setRenderScale(1.0);
+            }} {
+
+    dynamicResolution_.addProperties(targetFrameTime_, minScale_, sharpness_);
+    addProperty(dynamicResolution_);
+
+    frameMetrics_.addProperties(frameInterval_, metricsOverlay_, metricsFile_, exportMetrics_,
+                                resetMetrics_);
+    addProperty(frameMetrics_);
+    frameMetrics_.onChange([this]() { updateFrameMetrics(); });
+    frameInterval_.onChange([this]() { updateFrameMetrics(); });
+    metricsOverlay_.onChange([this]() { updateFrameMetrics(); });
+
+    dynamicResolution_.getBoolProperty()->onChange([this]() {
+        if (!dynamicResolution_.isChecked()) {
+            idle_.cancel();
+            frameTime_.reset();
+            smoothedFrameTime_ = 0.0;
+            setRenderScale(1.0);
+        }
+    });
+    minScale_.onChange([this]() {
+        if (getRenderScale() < minScale_.get()) setRenderScale(minScale_.get());
+    });
+
+    app->getProcessorNetworkEvaluator()->addObserver(this);
+}
+
+void CanvasProcessorGL::process() {
+    if (dynamicResolution_.isChecked()) {
+        frameTime_ =
+            std::chrono::duration<double, std::milli>(clock::now() - evaluationStart_).count();
+    }
+    updateSharpness();
+    updateFrameMetrics();
+    CanvasProcessor::process();
+}
+
+void CanvasProcessorGL::propagateEvent(Event* event, Outport* source) {
+    if (auto* metrics = getFrameMetrics(); metrics && !event->getAs<ResizeEvent>()) {
+        metrics->interaction();
+    }
+    CanvasProcessor::propagateEvent(event, source);
+}
+
+FrameMetrics* CanvasProcessorGL::getFrameMetrics() {
+    if (auto* canvas = dynamic_cast<CanvasGL*>(getCanvas())) {
+        return canvas->getFrameMetrics();
+    }
+    return nullptr;
+}
+
+void CanvasProcessorGL::updateFrameMetrics() {
+    if (auto* canvas = dynamic_cast<CanvasGL*>(getCanvas())) {
+        canvas->setFrameMetricsEnabled(frameMetrics_.isChecked());
+        canvas->setFrameMetricsOverlay(metricsOverlay_.get());
+        if (auto* metrics = canvas->getFrameMetrics()) {
+            metrics->setTargetFrameTime(frameInterval_.get());
+        }
+    }
+}
+
+void CanvasProcessorGL::updateSharpness() {
+    if (auto* canvas = dynamic_cast<CanvasGL*>(getCanvas())) {
+        canvas->setUpscaleSharpness(dynamicResolution_.isChecked() ? sharpness_.get() : 0.0f);
+    }
+}
+
+void CanvasProcessorGL::onProcessorNetworkEvaluationBegin() {
+    evaluationStart_ = clock::now();
+    frameTime_.reset();
+}
+
+void CanvasProcessorGL::onProcessorNetworkEvaluationEnd() {
+    if (auto* metrics = getFrameMetrics()) metrics->evaluation();
+
+    // Only evaluations that reached this canvas say something about its frame time
+    if (!dynamicResolution_.isChecked() || !frameTime_) return;
+
+    // The full resolution frame rendered when idle is expected to miss the target,
+    // do not let it affect the interactive scale.
+    if (refining_) {
+        refining_ = false;
+        return;
+    }
+
+    smoothedFrameTime_ = smoothedFrameTime_ == 0.0
+                             ? *frameTime_
+                             : smoothing * *frameTime_ + (1.0 - smoothing) * smoothedFrameTime_;
+
+    const double target = targetFrameTime_.get();
+    double scale = getRenderScale();
+    if (smoothedFrameTime_ > overBudget * target) {
+        // The cost is roughly proportional to the number of pixels
+        scale *= std::sqrt(target / smoothedFrameTime_);
+    } else if (smoothedFrameTime_ < underBudget * target) {
+        scale *= scaleUpStep;
+    }
+    scale = std::clamp(scale, static_cast<double>(minScale_.get()), 1.0);
+
+    if (scale != getRenderScale()) {
+        // A new scale changes the cost of a frame, start over with the averaging
+        smoothedFrameTime_ = 0.0;
+        setRenderScale(scale);
+    }
+    if (scale < 1.0) idle_.start();
+}
 
 }  // namespace inviwo
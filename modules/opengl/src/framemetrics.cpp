@@ -0,0 +1,252 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/opengl/framemetrics.h>
+
+#include <inviwo/core/util/exception.h>   // for Exception
+#include <modules/opengl/inviwoopengl.h>  // for glScissor, glClear, glEnable
+
+#include <algorithm>  // for min, max, sort
+#include <cmath>      // for round
+#include <fstream>    // for ofstream
+#include <numeric>    // for accumulate
+#include <ostream>    // for ostream
+#include <string>     // for string
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <fmt/std.h>
+
+namespace inviwo {
+
+namespace {
+
+double toMs(FrameMetrics::clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+/// A frame taking longer than this many target intervals follows an idle canvas, it is not
+/// counted as dropped frames or in the frame time statistics.
+constexpr double idleIntervals = 10.0;
+
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    const auto index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+}  // namespace
+
+FrameMetrics::FrameMetrics(size_t capacity)
+    : capacity_{std::max(capacity, size_t{1})}, frames_(capacity_) {}
+
+void FrameMetrics::setTargetFrameTime(double ms) { targetFrameTime_ = std::max(ms, 0.1); }
+double FrameMetrics::getTargetFrameTime() const { return targetFrameTime_; }
+
+void FrameMetrics::interaction() {
+    if (!firstInteraction_) firstInteraction_ = clock::now();
+}
+
+void FrameMetrics::evaluation() { ++evaluations_; }
+
+void FrameMetrics::beginFrame() {
+    if (gpuClock_) {
+        gpuClock_->reset();
+        gpuClock_->start();
+    } else {
+        gpuClock_.emplace();
+    }
+}
+
+void FrameMetrics::endFrame() {
+    const auto now = clock::now();
+
+    // The previous frame has most likely finished on the GPU by now
+    if (pendingClock_ && count_ - pendingFrame_ <= capacity_) {
+        frame(pendingFrame_).gpuTime = pendingClock_->getElapsedMilliseconds();
+    }
+    const bool measured = gpuClock_ && gpuClock_->isRunning();
+    if (measured) gpuClock_->stop();
+    // Reuse the clock of the previous frame for the next one
+    std::swap(gpuClock_, pendingClock_);
+    if (!measured) pendingClock_.reset();
+    pendingFrame_ = count_;
+
+    Frame& f = frame(count_);
+    f = Frame{};
+    f.frameTime = lastSwap_ ? toMs(now - *lastSwap_) : 0.0;
+    f.afterIdle = !lastSwap_ || f.frameTime > idleIntervals * targetFrameTime_;
+    if (firstInteraction_) f.latency = toMs(now - *firstInteraction_);
+    f.evaluations = evaluations_;
+    if (!f.afterIdle) {
+        f.dropped =
+            static_cast<size_t>(std::max(0.0, std::round(f.frameTime / targetFrameTime_) - 1.0));
+        ++histogram_[std::min(static_cast<size_t>(f.frameTime), histogramBins - 1)];
+    }
+
+    ++count_;
+    lastSwap_ = now;
+    firstInteraction_.reset();
+    evaluations_ = 0;
+}
+
+auto FrameMetrics::frame(size_t index) -> Frame& { return frames_[index % capacity_]; }
+
+auto FrameMetrics::getFrames() const -> std::vector<Frame> {
+    std::vector<Frame> frames;
+    const auto size = std::min(count_, capacity_);
+    frames.reserve(size);
+    for (size_t i = count_ - size; i < count_; ++i) frames.push_back(frames_[i % capacity_]);
+    return frames;
+}
+
+auto FrameMetrics::getHistogram() const -> const Histogram& { return histogram_; }
+
+auto FrameMetrics::getSummary() const -> Summary {
+    const auto frames = getFrames();
+
+    Summary summary{};
+    summary.frames = frames.size();
+
+    std::vector<double> frameTimes;
+    size_t gpuFrames = 0;
+    size_t latencyFrames = 0;
+    size_t evaluations = 0;
+    for (const auto& f : frames) {
+        if (!f.afterIdle) {
+            frameTimes.push_back(f.frameTime);
+            summary.droppedFrames += f.dropped;
+        }
+        if (f.gpuTime) {
+            summary.meanGpuTime += *f.gpuTime;
+            ++gpuFrames;
+        }
+        if (f.latency) {
+            summary.meanLatency += *f.latency;
+            summary.maxLatency = std::max(summary.maxLatency, *f.latency);
+            ++latencyFrames;
+        }
+        evaluations += f.evaluations;
+    }
+    std::ranges::sort(frameTimes);
+
+    if (!frameTimes.empty()) {
+        summary.meanFrameTime = std::accumulate(frameTimes.begin(), frameTimes.end(), 0.0) /
+                                static_cast<double>(frameTimes.size());
+        summary.maxFrameTime = frameTimes.back();
+    }
+    summary.p50FrameTime = percentile(frameTimes, 0.50);
+    summary.p95FrameTime = percentile(frameTimes, 0.95);
+    summary.p99FrameTime = percentile(frameTimes, 0.99);
+    if (gpuFrames > 0) summary.meanGpuTime /= static_cast<double>(gpuFrames);
+    if (latencyFrames > 0) summary.meanLatency /= static_cast<double>(latencyFrames);
+    if (!frames.empty()) {
+        summary.evaluationsPerFrame =
+            static_cast<double>(evaluations) / static_cast<double>(frames.size());
+    }
+    return summary;
+}
+
+void FrameMetrics::reset() {
+    count_ = 0;
+    histogram_.fill(0);
+    lastSwap_.reset();
+    firstInteraction_.reset();
+    evaluations_ = 0;
+    pendingClock_.reset();
+}
+
+void FrameMetrics::writeCSV(std::ostream& os) const {
+    const auto optional = [](const std::optional<double>& value) {
+        return value ? fmt::format("{:.3f}", *value) : std::string{};
+    };
+
+    os << "frame,frameTime,gpuTime,latency,evaluations,dropped,afterIdle\n";
+    const auto frames = getFrames();
+    const auto first = count_ - frames.size();
+    for (size_t i = 0; i < frames.size(); ++i) {
+        const auto& f = frames[i];
+        fmt::print(os, "{},{:.3f},{},{},{},{},{}\n", first + i, f.frameTime, optional(f.gpuTime),
+                   optional(f.latency), f.evaluations, f.dropped, f.afterIdle ? 1 : 0);
+    }
+}
+
+void FrameMetrics::writeCSV(const std::filesystem::path& file) const {
+    auto os = std::ofstream(file);
+    if (!os) {
+        throw Exception(SourceContext{}, "Could not open file {} for writing", file);
+    }
+    writeCSV(os);
+}
+
+void FrameMetrics::drawOverlay(size2_t dims) const {
+    constexpr GLint barWidth = 2;
+    constexpr GLint margin = 4;
+    const auto width = static_cast<GLint>(std::min<size_t>(dims.x, 2 * 128 + 2 * margin));
+    const auto height = static_cast<GLint>(std::min<size_t>(dims.y, 96));
+    if (width <= 2 * margin || height <= 2 * margin) return;
+
+    // The graph covers twice the target frame time
+    const double scale = static_cast<double>(height - 2 * margin) / (2.0 * targetFrameTime_);
+
+    GLfloat clearColor[4];
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+    glEnable(GL_SCISSOR_TEST);
+
+    glScissor(0, 0, width, height);
+    glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    const auto bars = static_cast<size_t>((width - 2 * margin) / barWidth);
+    const auto size = std::min({count_, capacity_, bars});
+    GLint x = margin + static_cast<GLint>(bars - size) * barWidth;
+    for (size_t i = count_ - size; i < count_; ++i, x += barWidth) {
+        const auto& f = frames_[i % capacity_];
+        if (f.afterIdle) continue;
+        const auto barHeight = std::clamp(static_cast<GLint>(f.frameTime * scale), GLint{1},
+                                          height - 2 * margin);
+        glScissor(x, margin, barWidth, barHeight);
+        if (f.dropped > 0) {
+            glClearColor(0.9f, 0.2f, 0.2f, 1.0f);
+        } else {
+            glClearColor(0.3f, 0.8f, 0.3f, 1.0f);
+        }
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+
+    glScissor(margin, margin + static_cast<GLint>(targetFrameTime_ * scale), width - 2 * margin,
+              1);
+    glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glDisable(GL_SCISSOR_TEST);
+    glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+}
+
+}  // namespace inviwo
@@ -36,11 +36,16 @@
 #include <modules/opengl/inviwoopengl.h>                  // for GL_DEPTH_TEST
 #include <modules/opengl/openglutils.h>                   // for GlBoolState
 #include <modules/opengl/shader/shader.h>                 // for Shader
+#include <modules/opengl/shader/shaderobject.h>           // for ShaderObject
 #include <modules/opengl/shader/shaderutils.h>            // for ImageInport
 #include <modules/opengl/texture/textureunit.h>           // for TextureUnitContainer
 #include <modules/opengl/texture/textureutils.h>          // for bindAndSetUniforms, activateTarget
 
-#include <memory>  // for make_shared, shared_ptr
+#include <algorithm>  // for clamp, find
+#include <memory>     // for make_shared, shared_ptr
+#include <sstream>    // for stringstream
+
+#include <fmt/format.h>  // for format
 
 namespace inviwo {
 
@@ -78,4 +83,121 @@ void ImageCompositor::composite(const ImageInport& source0, const ImageInport& s
     }
 }
 
+void ImageCompositor::composite(const std::vector<const Image*>& sources, Image& destination,
+                                ImageType type) {
+    IVW_ASSERT(std::find(sources.begin(), sources.end(), &destination) == sources.end(),
+               "sources can not contain the destination");
+    if (sources.empty()) return;
+
+    const auto maxInputs = getMaxInputsPerPass();
+    if (sources.size() <= maxInputs) {
+        compositePass(sources, destination, type);
+        return;
+    }
+
+    // Composite in batches, each pass continues from the result of the previous one which keeps
+    // the order of the inputs for fragments with equal depth.
+    std::vector<const Image*> batch;
+    const Image* previous = nullptr;
+    size_t next = 0;
+    size_t pass = 0;
+    while (next < sources.size()) {
+        batch.clear();
+        if (previous) batch.push_back(previous);
+        while (batch.size() < maxInputs && next < sources.size()) {
+            batch.push_back(sources[next++]);
+        }
+        if (next == sources.size()) {
+            compositePass(batch, destination, type);
+            break;
+        }
+
+        auto& tmp = intermediate_[pass++ % intermediate_.size()];
+        if (!tmp || tmp->getDimensions() != destination.getDimensions() ||
+            tmp->getDataFormat() != destination.getDataFormat()) {
+            tmp = std::make_shared<Image>(destination.getDimensions(),
+                                          destination.getDataFormat());
+        }
+        compositePass(batch, *tmp, ImageType::ColorDepthPicking);
+        previous = tmp.get();
+    }
+}
+
+void ImageCompositor::composite(const ImageMultiInport& sources, ImageOutport& destination,
+                                ImageType type) {
+    if (!sources.isReady()) return;
+
+    if (!destination.hasEditableData()) {
+        destination.setData(
+            std::make_shared<Image>(destination.getDimensions(), destination.getDataFormat()));
+    }
+    const auto data = sources.getVectorData();
+    std::vector<const Image*> images;
+    images.reserve(data.size());
+    for (const auto& image : data) {
+        images.push_back(image.get());
+    }
+    composite(images, *destination.getEditableData(), type);
+}
+
+size_t ImageCompositor::getMaxInputsPerPass() {
+    // Each input uses three texture units, leave one unit for unit zero
+    static const size_t maxInputs = []() {
+        GLint units = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &units);
+        return std::clamp<size_t>(static_cast<size_t>(std::max(units - 1, 0)) / 3, 2, 16);
+    }();
+    return maxInputs;
+}
+
+Shader& ImageCompositor::getMultiShader(size_t inputs) {
+    auto& elem = multiShaders_[inputs];
+    if (!elem) {
+        auto multi = std::make_unique<Shader>("composite_multi.frag", Shader::Build::No);
+        auto* fso = multi->getFragmentShaderObject();
+
+        std::stringstream ssUniform;
+        for (size_t i = 0; i < inputs; ++i) {
+            ssUniform << "uniform sampler2D tex" << i << "Color;";
+            ssUniform << "uniform sampler2D tex" << i << "Depth;";
+            ssUniform << "uniform sampler2D tex" << i << "Picking;";
+        }
+        fso->addShaderDefine("INPUT_UNIFORMS", ssUniform.str());
+
+        std::stringstream ssSample;
+        for (size_t i = 0; i < inputs; ++i) {
+            ssSample << "color[" << i << "] = texture(tex" << i << "Color, texCoords);";
+            ssSample << "depth[" << i << "] = texture(tex" << i << "Depth, texCoords).r;";
+            ssSample << "picking[" << i << "] = texture(tex" << i << "Picking, texCoords);";
+        }
+        fso->addShaderDefine("INPUT_SAMPLES", ssSample.str());
+        fso->addShaderDefine("NUMBER_OF_INPUTS", fmt::format("{}", inputs));
+
+        multi->build();
+        elem = std::move(multi);
+    }
+    return *elem;
+}
+
+void ImageCompositor::compositePass(const std::vector<const Image*>& sources, Image& destination,
+                                    ImageType type) {
+    auto& multi = getMultiShader(sources.size());
+
+    utilgl::GlBoolState depthTest(GL_DEPTH_TEST, true);
+    utilgl::activateTarget(destination, type);
+    multi.activate();
+
+    TextureUnitContainer units;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        utilgl::bindAndSetUniforms(multi, units, *sources[i], fmt::format("tex{}", i),
+                                   ImageType::ColorDepthPicking);
+    }
+
+    utilgl::setShaderUniforms(multi, destination, "outportParameters");
+    utilgl::singleDrawImagePlaneRect();
+
+    multi.deactivate();
+    utilgl::deactivateCurrentTarget();
+}
+
 }  // namespace inviwo
@@ -433,15 +433,26 @@ dvec4 ImageGL::readPixel(size2_t pos, LayerType layer, size_t index) const {
             break;
     }
 
-    // Make a buffer that can hold the largest possible pixel type
-    vec4 res{0.0f};
-    GLvoid* ptr = static_cast<GLvoid*>(glm::value_ptr(res));
     const auto x = static_cast<GLint>(pos.x);
     const auto y = static_cast<GLint>(pos.y);
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
     const auto layerGL = getLayerGL(layer, index);
     const auto formatGL = layerGL->getTexture()->getFormat();
+
+    // Picking happens on every mouse move, read the 8-bit picking layer in its native type. That
+    // avoids a format conversion in the driver and the values are already in the [0, 255] range.
+    if (layer == LayerType::Picking && layerGL->getDataFormat() == DataVec4UInt8::get()) {
+        glm::u8vec4 res{0};
+        glReadPixels(x, y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, glm::value_ptr(res));
+        glReadBuffer(GL_COLOR_ATTACHMENT0);
+        frameBufferObject_.setReadBlit(false);
+        return dvec4{res};
+    }
+
+    // Make a buffer that can hold the largest possible pixel type
+    vec4 res{0.0f};
+    GLvoid* ptr = static_cast<GLvoid*>(glm::value_ptr(res));
     glReadPixels(x, y, 1, 1, formatGL, GL_FLOAT, ptr);
 
     // restore
@@ -35,15 +35,45 @@
 #include <inviwo/core/util/glmvec.h>                               // for size2_t
 #include <modules/opengl/glformats.h>                              // for GLFormat, GLFormats
 #include <modules/opengl/openglutils.h>                            // for convertWrappingToGL
+#include <modules/opengl/sharedopenglresources.h>                  // for SharedOpenGLResources
 #include <modules/opengl/texture/texture2d.h>                      // for Texture2D
+#include <modules/opengl/texture/texturepool.h>                    // for TexturePool
 #include <modules/opengl/texture/textureunit.h>                    // for TextureUnit
 #include <modules/opengl/texture/textureutils.h>                   // for bindTexture
 
+#include <array>        // for array
+#include <memory>       // for shared_ptr, make_shared
 #include <type_traits>  // for remove_extent_t
+#include <utility>      // for move
 
 namespace inviwo {
 class DataFormatBase;
 
+namespace {
+
+TexturePool* texturePool() {
+    if (SharedOpenGLResources::isInitialized()) {
+        return &SharedOpenGLResources::getPtr()->getTexturePool();
+    }
+    return nullptr;
+}
+
+std::shared_ptr<Texture2D> createTexture(size2_t dimensions, GLint format, GLint internalFormat,
+                                         GLenum dataType, GLenum filtering,
+                                         const SwizzleMask& swizzleMask,
+                                         const std::array<GLenum, 2>& wrapping) {
+    if (auto* pool = texturePool()) {
+        return pool->acquire(dimensions, format, internalFormat, dataType, filtering, swizzleMask,
+                             wrapping);
+    }
+    auto texture = std::make_shared<Texture2D>(dimensions, format, internalFormat, dataType,
+                                               filtering, swizzleMask, wrapping);
+    texture->initialize(nullptr);
+    return texture;
+}
+
+}  // namespace
+
 LayerGL::LayerGL(std::shared_ptr<Texture2D> tex, LayerType type)
     : LayerRepresentation{type}, texture_{tex} {
     IVW_ASSERT(texture_, "Texture should never be nullptr");
@@ -56,14 +86,13 @@ LayerGL::LayerGL(size2_t dimensions, LayerType type, const DataFormatBase* forma
 
     const auto& glFormat = GLFormats::get(format->getId());
     if (getLayerType() == LayerType::Depth) {
-        texture_ = std::make_shared<Texture2D>(dimensions, GL_DEPTH_COMPONENT,
-                                               GL_DEPTH_COMPONENT32F, glFormat.type, GL_NEAREST,
-                                               swizzleMask, utilgl::convertWrappingToGL(wrap));
+        texture_ = createTexture(dimensions, GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT32F,
+                                 glFormat.type, GL_NEAREST, swizzleMask,
+                                 utilgl::convertWrappingToGL(wrap));
     } else {
-        utilgl::convertInterpolationToGL(interpolation);
-        texture_ = std::make_shared<Texture2D>(dimensions, glFormat,
-                                               utilgl::convertInterpolationToGL(interpolation),
-                                               swizzleMask, utilgl::convertWrappingToGL(wrap));
+        texture_ = createTexture(dimensions, glFormat.format, glFormat.internalFormat,
+                                 glFormat.type, utilgl::convertInterpolationToGL(interpolation),
+                                 swizzleMask, utilgl::convertWrappingToGL(wrap));
     }
 }
 
@@ -85,7 +114,11 @@ LayerGL& LayerGL::operator=(const LayerGL& rhs) {
     return *this;
 }
 
-LayerGL::~LayerGL() = default;
+LayerGL::~LayerGL() {
+    if (auto* pool = texturePool()) {
+        pool->release(std::move(texture_));
+    }
+}
 
 LayerGL* LayerGL::clone() const { return new LayerGL(*this); }
 
@@ -125,6 +158,21 @@ bool LayerGL::copyRepresentationsTo(LayerRepresentation* /*targetLayerGL*/) cons
 std::type_index LayerGL::getTypeIndex() const { return std::type_index(typeid(LayerGL)); }
 
 void LayerGL::setDimensions(size2_t dimensions) {
+    if (dimensions == texture_->getDimensions()) return;
+
+    // Swap in a texture of the new size from the pool, unless the texture is shared. The ImageGL
+    // reattaches the new texture to its framebuffer on its next update.
+    auto* pool = texturePool();
+    if (pool && texture_.use_count() == 1) {
+        auto texture = pool->acquire(dimensions, texture_->getFormat(),
+                                     texture_->getInternalFormat(), texture_->getDataType(),
+                                     utilgl::convertInterpolationToGL(texture_->getInterpolation()),
+                                     texture_->getSwizzleMask(), texture_->getWrapping());
+        pool->release(std::move(texture_));
+        texture_ = std::move(texture);
+        return;
+    }
+
     texture_->unbind();
     texture_->resize(dimensions);
     texture_->bind();
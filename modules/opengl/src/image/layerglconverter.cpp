@@ -34,7 +34,9 @@
 #include <inviwo/core/util/logcentral.h>                // for LogCentral
 #include <modules/opengl/image/layergl.h>               // for LayerGL
 #include <modules/opengl/texture/texture2d.h>           // IWYU pragma: keep
+#include <modules/opengl/texture/texturecompression.h>  // for compressTexture, selectCompres...
 
+#include <optional>     // for optional
 #include <ostream>      // for operator<<, char_traits
 #include <type_traits>  // for remove_extent_t
 
@@ -51,18 +53,46 @@ std::shared_ptr<LayerGL> LayerRAM2GLConverter::createFrom(
                                  *src->getDataFormat());
     }
 
-    dst->getTexture()->initialize(src->getData());
+    auto* texture = dst->getTexture().get();
+    if (compress_ && src->getLayerType() == LayerType::Color) {
+        const auto compression =
+            utilgl::selectCompression(texture->getInternalFormat(), GL_TEXTURE_2D);
+        if (const auto* format = utilgl::compressedFormat(compression)) {
+            const auto dims = size3_t{src->getDimensions(), 1};
+            const auto blocks = utilgl::compressTexture(
+                src->getData(), dims, src->getDataFormat()->getComponents(), compression);
+            texture->initializeCompressed(format->internalFormat, blocks);
+            return dst;
+        }
+    }
+
+    // The texture of a new LayerGL is already allocated
+    texture->upload(src->getData());
     return dst;
 }
 
 void LayerRAM2GLConverter::update(std::shared_ptr<const LayerRAM> src,
                                   std::shared_ptr<LayerGL> dst) const {
+    const auto region = dst->getDimensions() == src->getDimensions()
+                            ? src->getModifiedRegion(dst->getGeneration())
+                            : std::nullopt;
+
     dst->setDimensions(src->getDimensions());
     dst->setSwizzleMask(src->getSwizzleMask());
     dst->setInterpolation(src->getInterpolation());
     dst->setWrapping(src->getWrapping());
 
-    dst->getTexture()->upload(src->getData());
+    auto* texture = dst->getTexture().get();
+    if (const auto* format = utilgl::compressedFormat(texture->getInternalFormat())) {
+        // Compressed textures are always replaced as a whole
+        const auto dims = size3_t{src->getDimensions(), 1};
+        texture->uploadCompressed(utilgl::compressTexture(
+            src->getData(), dims, src->getDataFormat()->getComponents(), format->compression));
+    } else if (region) {
+        dst->getTexture()->upload(src->getData(), region->offset, region->extent);
+    } else {
+        dst->getTexture()->upload(src->getData());
+    }
 }
 
 std::shared_ptr<LayerRAM> LayerGL2RAMConverter::createFrom(
@@ -0,0 +1,133 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/opengl/image/layerglreadback.h>
+
+#include <inviwo/core/datastructures/image/layerram.h>  // for LayerRAM, createLayerRAM
+#include <inviwo/core/util/exception.h>                 // for Exception
+#include <inviwo/core/util/formats.h>                   // for DataFormatBase
+#include <inviwo/core/util/sourcecontext.h>             // for SourceContext
+#include <modules/opengl/image/layergl.h>               // for LayerGL
+#include <modules/opengl/inviwoopengl.h>                // for glBindBuffer, glClientWaitSync
+#include <modules/opengl/texture/texture2d.h>           // for Texture2D
+
+#include <algorithm>  // for max
+#include <cstring>    // for memcpy
+
+namespace inviwo {
+
+LayerGLReadback::LayerGLReadback(size_t depth) : slots_(std::max(depth, size_t{1})), next_{0} {
+    for (auto& slot : slots_) {
+        glGenBuffers(1, &slot.pbo);
+    }
+}
+
+LayerGLReadback::~LayerGLReadback() {
+    finish();
+    for (auto& slot : slots_) {
+        glDeleteBuffers(1, &slot.pbo);
+    }
+}
+
+std::future<std::shared_ptr<LayerRAM>> LayerGLReadback::read(const LayerGL& layer) {
+    auto& slot = slots_[next_];
+    if (slot.fence) complete(slot, GL_TIMEOUT_IGNORED);
+
+    auto dst =
+        createLayerRAM(layer.getDimensions(), layer.getLayerType(), layer.getDataFormat(),
+                       layer.getSwizzleMask(), layer.getInterpolation(), layer.getWrapping());
+    if (!dst) {
+        throw Exception(SourceContext{}, "Cannot read back format '{}' from GL to RAM",
+                        *layer.getDataFormat());
+    }
+
+    const auto& texture = *layer.getTexture();
+    slot.size = static_cast<GLsizeiptr>(texture.getNumberOfValues() * texture.getSizeInBytes());
+    if (slot.capacity < slot.size) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, slot.size, nullptr, GL_STREAM_READ);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot.capacity = slot.size;
+    }
+    texture.downloadToBuffer(slot.pbo);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.dst = std::move(dst);
+    slot.promise = {};
+    auto future = slot.promise.get_future();
+
+    next_ = (next_ + 1) % slots_.size();
+    poll();
+    return future;
+}
+
+size_t LayerGLReadback::poll() {
+    size_t pending = 0;
+    for (auto& slot : slots_) {
+        if (slot.fence && !complete(slot, 0)) ++pending;
+    }
+    return pending;
+}
+
+void LayerGLReadback::finish() {
+    for (auto& slot : slots_) {
+        if (slot.fence) complete(slot, GL_TIMEOUT_IGNORED);
+    }
+}
+
+size_t LayerGLReadback::getDepth() const { return slots_.size(); }
+
+bool LayerGLReadback::complete(Slot& slot, GLuint64 timeout) {
+    const auto res = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+    if (res == GL_TIMEOUT_EXPIRED) return false;
+
+    glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+    auto dst = std::move(slot.dst);
+
+    if (res == GL_WAIT_FAILED) {
+        slot.promise.set_exception(std::make_exception_ptr(
+            Exception(SourceContext{}, "Waiting for the layer readback failed")));
+        return true;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+    if (const auto* mem = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, slot.size, GL_MAP_READ_BIT)) {
+        std::memcpy(dst->getData(), mem, static_cast<size_t>(slot.size));
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        slot.promise.set_value(std::move(dst));
+    } else {
+        slot.promise.set_exception(std::make_exception_ptr(
+            Exception(SourceContext{}, "Unable to map the layer readback buffer")));
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    return true;
+}
+
+}  // namespace inviwo
@@ -204,6 +204,11 @@ void OpenGLCapabilities::initializeGLEW() {
         // Ensure that all extensions with valid entry points will be exposed
         glewExperimental = GL_TRUE;
         GLenum glewError = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+        // A GLX build of GLEW loads the OpenGL entry points before it fails to find an X display,
+        // which is expected for a context without a window system, e.g. from EGL.
+        if (glewError == GLEW_ERROR_NO_GLX_DISPLAY) glewError = GLEW_OK;
+#endif
         if (GLEW_OK == glewError) {
             const GLubyte* glversion = glGetString(GL_VERSION);
             if (glversion == 0) {
@@ -27,6 +27,7 @@
  *
  *********************************************************************************/
 
+#include <inviwo/core/common/inviwoapplication.h>                    // for InviwoApplication
 #include <inviwo/core/common/inviwomodule.h>                         // for InviwoModule
 #include <inviwo/core/common/modulepath.h>                           // for ModulePath, ModulePa...
 #include <inviwo/core/datastructures/buffer/bufferrepresentation.h>  // for BufferRepresentation
@@ -37,12 +38,16 @@
 #include <inviwo/core/datastructures/volume/volume.h>                // IWYU pragma: keep
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>  // for VolumeRepresentation
 #include <inviwo/core/rendering/meshdrawer.h>                        // for MeshDrawer
+#include <inviwo/core/network/evaluationprofiler.h>                  // for EvaluationProfiler
+#include <inviwo/core/resourcemanager/memorybudget.h>                // for MemoryBudget
 #include <inviwo/core/util/capabilities.h>                           // for Capabilities
+#include <inviwo/core/util/rendercontext.h>                          // for RenderContext
 #include <inviwo/core/util/exception.h>                              // for Exception
 #include <inviwo/core/util/settings/settings.h>                      // for Settings
 #include <modules/opengl/buffer/buffergl.h>                          // for BufferGL
 #include <modules/opengl/buffer/bufferglconverter.h>                 // for BufferGL2RAMConverter
 #include <modules/opengl/canvasprocessorgl.h>                        // for CanvasProcessorGL
+#include <modules/opengl/clockgl.h>                                  // for ClockGL
 #include <modules/opengl/image/layergl.h>                            // for LayerGL
 #include <modules/opengl/image/layerglconverter.h>                   // for LayerGL2RAMConverter
 #include <modules/opengl/openglcapabilities.h>                       // for OpenGLCapabilities
@@ -90,7 +95,6 @@ public:
         auto layerGL = std::make_unique<LayerGL>(layer->getDimensions(), layer->getLayerType(),
                                                  layer->getDataFormat(), layer->getSwizzleMask(),
                                                  layer->getInterpolation(), layer->getWrapping());
-        layerGL->getTexture()->initialize(nullptr);
         return layerGL;
     }
 };
@@ -110,6 +114,29 @@ public:
 
 }  // namespace
 
+namespace {
+
+class GPUTimerGL : public EvaluationProfiler::GPUTimer {
+public:
+    virtual void start() override {
+        RenderContext::getPtr()->activateDefaultRenderContext();
+        clock_.start();
+    }
+    virtual void stop() override {
+        RenderContext::getPtr()->activateDefaultRenderContext();
+        clock_.stop();
+    }
+    virtual Clock::duration getElapsedTime() override {
+        RenderContext::getPtr()->activateDefaultRenderContext();
+        return std::chrono::duration_cast<Clock::duration>(clock_.getElapsedTime());
+    }
+
+private:
+    ClockGL clock_;
+};
+
+}  // namespace
+
 OpenGLModule::OpenGLModule(InviwoApplication* app)
     : InviwoModule(app, "OpenGL")
     , shaderManager_{std::make_unique<ShaderManager>()}
@@ -120,6 +147,13 @@ OpenGLModule::OpenGLModule(InviwoApplication* app)
     ShaderManager::init(shaderManager_.get());
     SharedOpenGLResources::init(sharedResources_.get());
 
+    settings->texturePoolSize_.onChange([pool = &sharedResources_->getTexturePool(),
+                                         size = &settings->texturePoolSize_]() {
+        pool->setCapacity(static_cast<size_t>(size->get()) * 1024 * 1024);
+    });
+    sharedResources_->getTexturePool().setCapacity(
+        static_cast<size_t>(settings->texturePoolSize_.get()) * 1024 * 1024);
+
     opengl::addShaderResources(shaderManager_.get(), {getPath(ModulePath::GLSL)});
 
     // Register GL Representations
@@ -131,11 +165,30 @@ OpenGLModule::OpenGLModule(InviwoApplication* app)
         std::make_unique<VolumeGLFactoryObject>());
 
     registerDrawer(std::make_unique<MeshDrawerGL>());
-    registerRepresentationConverter<LayerRepresentation>(std::make_unique<LayerRAM2GLConverter>());
+    auto layerRAM2GL = std::make_unique<LayerRAM2GLConverter>();
+    auto volumeRAM2GL = std::make_unique<VolumeRAM2GLConverter>();
+    settings->compressTextures_.onChange([layer = layerRAM2GL.get(), volume = volumeRAM2GL.get(),
+                                          compress = &settings->compressTextures_]() {
+        layer->setCompression(compress->get());
+        volume->setCompression(compress->get());
+    });
+    layerRAM2GL->setCompression(settings->compressTextures_.get());
+    volumeRAM2GL->setCompression(settings->compressTextures_.get());
+    settings->floatVolumePrecision_.onChange(
+        [volume = volumeRAM2GL.get(), precision = &settings->floatVolumePrecision_]() {
+            volume->setFloatPrecision(precision->getSelectedValue());
+        });
+    volumeRAM2GL->setFloatPrecision(settings->floatVolumePrecision_.getSelectedValue());
+    settings->sparseVolumes_.onChange(
+        [volume = volumeRAM2GL.get(), sparse = &settings->sparseVolumes_]() {
+            volume->setSparse(sparse->get());
+        });
+    volumeRAM2GL->setSparse(settings->sparseVolumes_.get());
+
+    registerRepresentationConverter<LayerRepresentation>(std::move(layerRAM2GL));
     registerRepresentationConverter<LayerRepresentation>(std::make_unique<LayerGL2RAMConverter>());
 
-    registerRepresentationConverter<VolumeRepresentation>(
-        std::make_unique<VolumeRAM2GLConverter>());
+    registerRepresentationConverter<VolumeRepresentation>(std::move(volumeRAM2GL));
     registerRepresentationConverter<VolumeRepresentation>(
         std::make_unique<VolumeGL2RAMConverter>());
 
@@ -151,6 +204,25 @@ OpenGLModule::OpenGLModule(InviwoApplication* app)
 
     registerSettings(std::move(settings));
     registerCapabilities(std::move(openGLCap));
+
+    auto* budget = app->getMemoryBudget();
+    budget->registerRepresentation<VolumeGL>(MemoryBudget::Pool::GL);
+    budget->registerRepresentation<LayerGL>(MemoryBudget::Pool::GL);
+    budget->registerRepresentation<BufferGL>(MemoryBudget::Pool::GL);
+
+    app->getEvaluationProfiler()->setGPUTimerFactory(
+        []() -> std::unique_ptr<EvaluationProfiler::GPUTimer> {
+            return std::make_unique<GPUTimerGL>();
+        });
+}
+
+OpenGLModule::~OpenGLModule() {
+    app_->getEvaluationProfiler()->setGPUTimerFactory(nullptr);
+
+    auto* budget = app_->getMemoryBudget();
+    budget->unregisterRepresentation(typeid(VolumeGL));
+    budget->unregisterRepresentation(typeid(LayerGL));
+    budget->unregisterRepresentation(typeid(BufferGL));
 }
 
 OpenGLCapabilities& OpenGLModule::getOpenGLCapabilities() {
@@ -27,14 +27,17 @@
  *
  *********************************************************************************/
 
-#include <inviwo/core/properties/boolproperty.h>    // for BoolProperty
-#include <inviwo/core/properties/buttonproperty.h>  // for ButtonProperty
-#include <inviwo/core/properties/optionproperty.h>  // for OptionPropertyOption, OptionProperty
-#include <inviwo/core/util/settings/settings.h>     // for Settings
-#include <inviwo/core/util/staticstring.h>          // for operator+
-#include <modules/opengl/debugmessages.h>           // for BreakLevel, Severity, Mode, operator<<
-#include <modules/opengl/openglsettings.h>          // for OpenGLSettings
-#include <modules/opengl/shader/shader.h>           // for Shader::UniformWarning, Shader::OnError
+#include <inviwo/core/algorithm/markdown.h>          // for operator""_help
+#include <inviwo/core/properties/boolproperty.h>     // for BoolProperty
+#include <inviwo/core/properties/buttonproperty.h>   // for ButtonProperty
+#include <inviwo/core/properties/optionproperty.h>   // for OptionPropertyOption, OptionProperty
+#include <inviwo/core/properties/ordinalproperty.h>  // for IntProperty
+#include <inviwo/core/util/settings/settings.h>      // for Settings
+#include <inviwo/core/util/staticstring.h>           // for operator+
+#include <modules/opengl/debugmessages.h>            // for BreakLevel, Severity, Mode, operator<<
+#include <modules/opengl/openglsettings.h>           // for OpenGLSettings
+#include <modules/opengl/shader/shader.h>            // for Shader::UniformWarning, Shader::OnError
+#include <modules/opengl/volume/volumegl.h>          // for FloatVolumePrecision
 
 #include <functional>   // for __base
 #include <string>       // for operator==, string
@@ -56,6 +59,40 @@ OpenGLSettings::OpenGLSettings()
                           {{"warn", "Print warning", Shader::OnError::Warn},
                            {"throw", "Throw error", Shader::OnError::Throw}},
                           0)
+    , shaderBinaryCache_("shaderBinaryCache", "Cache Shader Binaries",
+                         "Store linked shader programs on disk and reuse them when the same "
+                         "shaders are built again with the same driver"_help,
+                         true)
+    , clearShaderBinaryCache_("clearShaderBinaryCache", "Clear Shader Binary Cache")
+    , texturePoolSize_("texturePoolSize", "Texture Pool Size (MB)",
+                       util::ordinalCount(256, 4096)
+                           .set("Memory kept for reusing the textures of resized or deleted "
+                                "images, 0 disables the reuse"_help))
+    , compressTextures_("compressTextures", "Compress 8-bit Textures",
+                        "Upload 8-bit color layers and RGB(A) volumes as block compressed "
+                        "textures (BC4, BC5, or BC7) when supported. Uses 2-4 times less GPU "
+                        "memory at the cost of slower uploads and some loss of precision. Only "
+                        "affects data converted after the setting is changed"_help,
+                        false)
+    , floatVolumePrecision_(
+          "floatVolumePrecision", "Float Volume Precision",
+          "Storage on the GPU for volumes with 32-bit floating point data. 16-bit floats halve "
+          "the memory use. The normalized 16- and 8-bit formats use a half or a quarter of the "
+          "memory by mapping the data range of the volume to [0, 1]. Values outside of the data "
+          "range are clamped to it by the normalized formats, so make sure the data range covers "
+          "all values. Only affects volumes uploaded after the setting is changed"_help,
+          {{"float32", "32-bit Float", FloatVolumePrecision::Float32},
+           {"float16", "16-bit Float", FloatVolumePrecision::Float16},
+           {"unorm16", "Normalized 16-bit", FloatVolumePrecision::UNorm16},
+           {"unorm8", "Normalized 8-bit", FloatVolumePrecision::UNorm8}},
+          0)
+    , sparseVolumes_("sparseVolumes", "Sparse Volume Textures",
+                     "Upload volumes as sparse textures (ARB_sparse_texture) that only use GPU "
+                     "memory for the parts of the volume that are not zero. Useful for large, "
+                     "mostly empty, label and simulation volumes. Requires volume dimensions "
+                     "that are a multiple of the page size of the driver, other volumes use "
+                     "regular textures"_help,
+                     false)
     , debugMessages_("debugMessages", "Debug",
                      {utilgl::debug::Mode::Off, utilgl::debug::Mode::Debug,
                       utilgl::debug::Mode::DebugSynchronous},
@@ -74,6 +111,12 @@ OpenGLSettings::OpenGLSettings()
     addProperty(btnOpenGLInfo_);
     addProperty(uniformWarnings_);
     addProperty(shaderObjectErrors_);
+    addProperty(shaderBinaryCache_);
+    addProperty(clearShaderBinaryCache_);
+    addProperty(texturePoolSize_);
+    addProperty(compressTextures_);
+    addProperty(floatVolumePrecision_);
+    addProperty(sparseVolumes_);
     addProperty(debugMessages_);
     addProperty(debugSeverity_);
     addProperty(breakOnMessage_);
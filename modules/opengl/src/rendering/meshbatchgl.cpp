@@ -0,0 +1,262 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/opengl/rendering/meshbatchgl.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>          // for BufferBase
+#include <inviwo/core/datastructures/coordinatetransformer.h>  // for SpatialCoordinateTransf...
+#include <inviwo/core/datastructures/geometry/geometrytype.h>  // for BufferUsage, BufferTarget
+#include <inviwo/core/datastructures/geometry/mesh.h>          // for Mesh
+#include <inviwo/core/util/formats.h>                          // for DataFormat, DataFormatId
+#include <inviwo/core/util/zip.h>                              // for zip
+#include <modules/opengl/buffer/buffergl.h>                    // for BufferGL
+#include <modules/opengl/buffer/bufferobject.h>                // for BufferObject
+#include <modules/opengl/buffer/bufferobjectarray.h>           // for BufferObjectArray
+#include <modules/opengl/glformats.h>                          // for GLFormats
+#include <modules/opengl/openglcapabilities.h>                 // for OpenGLCapabilities
+#include <modules/opengl/rendering/meshdrawergl.h>             // for MeshDrawerGL
+
+#include <algorithm>  // for ranges::stable_sort, all_of, find_if
+#include <cstdint>    // for uint32_t
+#include <map>        // for map
+#include <numeric>    // for iota
+#include <utility>    // for pair
+
+#include <glm/gtc/matrix_inverse.hpp>  // for inverseTranspose
+
+namespace inviwo {
+
+namespace {
+
+// Matches the layout of DrawElementsIndirectCommand in the OpenGL specification
+struct DrawCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance;
+};
+
+using Layout = std::vector<std::pair<int, DataFormatId>>;
+
+Layout getLayout(const Mesh& mesh) {
+    Layout layout;
+    for (const auto& [info, buffer] : mesh.getBuffers()) {
+        layout.emplace_back(info.location, buffer->getDataFormat()->getId());
+    }
+    std::ranges::sort(layout);
+    return layout;
+}
+
+bool isBatchable(const Mesh& mesh) {
+    const auto& buffers = mesh.getBuffers();
+    if (buffers.empty() || mesh.getIndexBuffers().empty()) return false;
+
+    const auto size = buffers.front().second->getSize();
+    return std::ranges::all_of(buffers, [&](const auto& item) {
+        return item.second->getSize() == size;
+    });
+}
+
+void copyBuffer(const BufferObject& src, const BufferObject& dst, GLintptr dstOffset,
+                GLsizeiptr size) {
+    if (size <= 0) return;
+    glBindBuffer(GL_COPY_READ_BUFFER, src.getId());
+    glBindBuffer(GL_COPY_WRITE_BUFFER, dst.getId());
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, dstOffset, size);
+}
+
+}  // namespace
+
+struct MeshBatchGL::Batch {
+    struct Range {
+        GLenum mode;
+        size_t first;
+        size_t count;
+    };
+
+    std::vector<std::shared_ptr<const Mesh>> meshes;
+    std::vector<std::unique_ptr<BufferObject>> attributes;
+    std::unique_ptr<BufferObject> indices;
+    std::unique_ptr<BufferObject> drawIds;
+    std::unique_ptr<BufferObject> commands;
+    std::unique_ptr<BufferObject> parameters;
+    std::vector<Range> ranges;
+    BufferObjectArray vao;
+};
+
+MeshBatchGL::MeshBatchGL() = default;
+MeshBatchGL::MeshBatchGL(MeshBatchGL&&) = default;
+MeshBatchGL& MeshBatchGL::operator=(MeshBatchGL&&) = default;
+MeshBatchGL::~MeshBatchGL() = default;
+
+bool MeshBatchGL::isSupported() { return OpenGLCapabilities::getOpenGLVersion() >= 430; }
+
+void MeshBatchGL::build(const std::vector<std::shared_ptr<const Mesh>>& meshes) {
+    batches_.clear();
+    unbatched_.clear();
+
+    std::map<Layout, std::vector<std::shared_ptr<const Mesh>>> groups;
+    for (const auto& mesh : meshes) {
+        if (isBatchable(*mesh)) {
+            groups[getLayout(*mesh)].push_back(mesh);
+        } else {
+            unbatched_.push_back(mesh);
+        }
+    }
+    for (auto& item : groups) {
+        batches_.push_back(createBatch(std::move(item.second)));
+    }
+}
+
+auto MeshBatchGL::createBatch(std::vector<std::shared_ptr<const Mesh>> meshes)
+    -> std::unique_ptr<Batch> {
+    auto batch = std::make_unique<Batch>();
+    batch->meshes = std::move(meshes);
+    const auto& first = *batch->meshes.front();
+
+    // Gather the draw commands and the sizes of the pools
+    std::vector<std::pair<GLenum, DrawCommand>> commands;
+    std::vector<DrawParameters> parameters;
+    size_t numVertices = 0;
+    size_t numIndices = 0;
+    for (const auto& mesh : batch->meshes) {
+        for (const auto& [info, indexBuffer] : mesh->getIndexBuffers()) {
+            if (indexBuffer->getSize() == 0) continue;
+            commands.emplace_back(MeshDrawerGL::getGLDrawMode(info),
+                                  DrawCommand{static_cast<GLuint>(indexBuffer->getSize()), 1,
+                                              static_cast<GLuint>(numIndices),
+                                              static_cast<GLint>(numVertices),
+                                              static_cast<GLuint>(parameters.size())});
+            numIndices += indexBuffer->getSize();
+        }
+        const auto dataToWorld = mesh->getCoordinateTransformer().getDataToWorldMatrix();
+        parameters.push_back({dataToWorld, mat4{glm::inverseTranspose(mat3{dataToWorld})}});
+        numVertices += mesh->getBuffers().front().second->getSize();
+    }
+
+    // Copy the vertex and index data into the pools on the GPU
+    for (const auto& [info, buffer] : first.getBuffers()) {
+        const auto* format = buffer->getDataFormat();
+        auto& pool = batch->attributes.emplace_back(std::make_unique<BufferObject>(
+            numVertices * format->getSizeInBytes(), format, BufferUsage::Static));
+        GLintptr offset = 0;
+        for (const auto& mesh : batch->meshes) {
+            const auto it = std::ranges::find_if(mesh->getBuffers(), [&](const auto& item) {
+                return item.first.location == info.location;
+            });
+            const auto* src = it->second.get();
+            const auto bytes = static_cast<GLsizeiptr>(src->getSize() * format->getSizeInBytes());
+            copyBuffer(*src->getRepresentation<BufferGL>()->getBufferObject(), *pool, offset,
+                       bytes);
+            offset += bytes;
+        }
+    }
+
+    batch->indices = std::make_unique<BufferObject>(numIndices * sizeof(std::uint32_t),
+                                                    DataFormat<std::uint32_t>::get(),
+                                                    BufferUsage::Static, BufferTarget::Index);
+    GLintptr indexOffset = 0;
+    for (const auto& mesh : batch->meshes) {
+        for (const auto& [info, indexBuffer] : mesh->getIndexBuffers()) {
+            const auto bytes =
+                static_cast<GLsizeiptr>(indexBuffer->getSize() * sizeof(std::uint32_t));
+            copyBuffer(*indexBuffer->getRepresentation<BufferGL>()->getBufferObject(),
+                       *batch->indices, indexOffset, bytes);
+            indexOffset += bytes;
+        }
+    }
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    // The draw id is an instanced attribute that is offset by the base instance of each command
+    std::vector<std::uint32_t> drawIds(batch->meshes.size());
+    std::iota(drawIds.begin(), drawIds.end(), std::uint32_t{0});
+    batch->drawIds = std::make_unique<BufferObject>(
+        drawIds.size() * sizeof(std::uint32_t), DataFormat<std::uint32_t>::get(),
+        BufferUsage::Static);
+    batch->drawIds->upload(drawIds);
+
+    // Group the commands by draw mode, one glMultiDrawElementsIndirect call is needed per mode
+    std::ranges::stable_sort(commands, {}, [](const auto& item) { return item.first; });
+    std::vector<DrawCommand> sorted;
+    for (const auto& [mode, command] : commands) {
+        if (batch->ranges.empty() || batch->ranges.back().mode != mode) {
+            batch->ranges.push_back({mode, sorted.size(), 0});
+        }
+        ++batch->ranges.back().count;
+        sorted.push_back(command);
+    }
+    batch->commands = std::make_unique<BufferObject>(
+        sorted.size() * sizeof(DrawCommand), GLFormats::get(DataFormatId::UInt32), GL_STATIC_DRAW,
+        GL_DRAW_INDIRECT_BUFFER);
+    batch->commands->upload(sorted);
+
+    batch->parameters = std::make_unique<BufferObject>(
+        parameters.size() * sizeof(DrawParameters), GLFormats::get(DataFormatId::Float32),
+        GL_STATIC_DRAW, GL_SHADER_STORAGE_BUFFER);
+    batch->parameters->upload(parameters);
+
+    batch->vao.bind();
+    for (auto&& [item, pool] : util::zip(first.getBuffers(), batch->attributes)) {
+        batch->vao.attachBufferObject(pool.get(), static_cast<GLuint>(item.first.location));
+    }
+    batch->vao.attachBufferObject(batch->drawIds.get(), drawIdLocation);
+    glVertexAttribDivisor(drawIdLocation, 1);
+    batch->indices->bind();
+    batch->vao.unbind();
+
+    return batch;
+}
+
+void MeshBatchGL::draw(const std::function<void(const Mesh&)>& setup) const {
+    for (const auto& batch : batches_) {
+        if (setup) setup(*batch->meshes.front());
+
+        batch->vao.bind();
+        batch->commands->bind();
+        batch->parameters->bindBase(drawParametersBinding);
+        for (const auto& range : batch->ranges) {
+            glMultiDrawElementsIndirect(
+                range.mode, GL_UNSIGNED_INT,
+                reinterpret_cast<const void*>(range.first * sizeof(DrawCommand)),
+                static_cast<GLsizei>(range.count), 0);
+        }
+        batch->commands->unbind();
+        batch->vao.unbind();
+    }
+}
+
+auto MeshBatchGL::getUnbatched() const -> const std::vector<std::shared_ptr<const Mesh>>& {
+    return unbatched_;
+}
+
+size_t MeshBatchGL::getNumberOfBatches() const { return batches_.size(); }
+
+}  // namespace inviwo
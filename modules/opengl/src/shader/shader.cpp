@@ -42,7 +42,9 @@
 #include <inviwo/core/util/stringconversion.h>         // for toString, toLower
 #include <inviwo/core/util/transformiterator.h>        // for TransformIterator, makeTransformIt...
 #include <modules/opengl/inviwoopengl.h>               // for LGL_ERROR, LGL_ERROR_CLASS
+#include <modules/opengl/openglcapabilities.h>         // for OpenGLCapabilities
 #include <modules/opengl/openglexception.h>            // for OpenGLException
+#include <modules/opengl/shader/shaderbinarycache.h>   // for ShaderBinaryCache
 #include <modules/opengl/shader/shadermanager.h>       // for ShaderManager
 #include <modules/opengl/shader/shaderobject.h>        // for ShaderObject, ShaderObject::InDecl...
 #include <modules/opengl/shader/shadertype.h>          // for ShaderType, ShaderType::Fragment
@@ -53,7 +55,11 @@
 #include <algorithm>  // for find_if
 #include <cstddef>    // for size_t
 #include <istream>    // for operator<<, basic_ostream, ostring...
+#include <iterator>   // for back_inserter
 #include <span>       // for span
+#include <string>     // for string
+#include <utility>    // for exchange
+#include <vector>     // for vector
 
 #include <fmt/core.h>            // for format, basic_string_view
 #include <fmt/format.h>          // for join
@@ -65,6 +71,25 @@ class ShaderResource;
 const detail::Build detail::Build::Yes{};
 const detail::Build detail::Build::No{nullptr};
 
+namespace {
+
+// Let the driver use as many compiler threads as it wants. Compilation then happens in the
+// background and is only waited for when the compile status is queried.
+void enableParallelCompile() {
+    [[maybe_unused]] static const bool enabled = []() {
+        if (OpenGLCapabilities::isExtensionSupported("GL_KHR_parallel_shader_compile")) {
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+            return true;
+        } else if (OpenGLCapabilities::isExtensionSupported("GL_ARB_parallel_shader_compile")) {
+            glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+            return true;
+        }
+        return false;
+    }();
+}
+
+}  // namespace
+
 // glCreateProgram This function returns 0 if an error occurs creating the program object.
 Shader::Program::Program() : id{glCreateProgram()} {}
 Shader::Program::Program(const Program&) : Program() {}
@@ -147,6 +172,8 @@ Shader::Shader(Shader&& rhs)
     , shaderObjects_{std::move(rhs.shaderObjects_)}
     , attached_{std::move(rhs.attached_)}
     , ready_(rhs.ready_)
+    , fromBinary_{rhs.fromBinary_}
+    , feedbackVaryings_{std::move(rhs.feedbackVaryings_)}
     , warningLevel_{rhs.warningLevel_} {
 
     rhs.callbacks_.clear();
@@ -172,6 +199,8 @@ Shader& Shader::operator=(Shader&& that) {
 
         program_ = std::move(that.program_);
         ready_ = that.ready_;
+        fromBinary_ = that.fromBinary_;
+        feedbackVaryings_ = std::move(that.feedbackVaryings_);
         warningLevel_ = that.warningLevel_;
         shaderObjects_ = std::move(that.shaderObjects_);
         attached_ = std::move(that.attached_);
@@ -212,13 +241,64 @@ void Shader::detach() {
 }
 
 void Shader::build() {
-    try {
-        ready_ = false;
-        for (auto& elem : shaderObjects_) elem.build();
-        linkShader();
-    } catch (OpenGLException& e) {
-        handleError(e);
+    Shader* const self = this;
+    build(std::span{&self, 1});
+}
+
+void Shader::build(std::span<Shader* const> shaders) {
+    std::vector<Shader*> submitted;
+    for (auto* shader : shaders) {
+        try {
+            shader->ready_ = false;
+            if (shader->loadBinary()) continue;
+            shader->submitShaderObjects();
+            submitted.push_back(shader);
+        } catch (OpenGLException& e) {
+            shader->handleError(e);
+        }
+    }
+    for (auto* shader : submitted) {
+        try {
+            for (auto& elem : shader->shaderObjects_) elem.checkCompileStatus();
+            shader->linkShader();
+        } catch (OpenGLException& e) {
+            shader->handleError(e);
+        }
+    }
+}
+
+bool Shader::loadBinary() {
+    fromBinary_ = false;
+    for (auto& elem : shaderObjects_) elem.preprocess();
+
+    auto* cache = ShaderManager::getPtr()->getBinaryCache();
+    if (!cache || !cache->load(program_.id, binaryKey(*cache))) return false;
+
+    uniformLookup_.clear();
+    fromBinary_ = true;
+    ready_ = true;
+    return true;
+}
+
+void Shader::submitShaderObjects() {
+    enableParallelCompile();
+    for (auto& elem : shaderObjects_) elem.submit();
+}
+
+std::uint64_t Shader::binaryKey(const ShaderBinaryCache& cache) const {
+    std::string description = feedbackVaryings_;
+    auto out = std::back_inserter(description);
+    for (const auto& obj : shaderObjects_) {
+        fmt::format_to(out, "{}\n", obj.getShaderType().name());
+        for (const auto& item : obj.getInDeclarations()) {
+            fmt::format_to(out, "in {} {}\n", item.name, item.location);
+        }
+        for (const auto& item : obj.getOutDeclarations()) {
+            fmt::format_to(out, "out {} {}\n", item.name, item.location);
+        }
+        description.append(obj.getProcessedSource());
     }
+    return cache.key(description);
 }
 
 void Shader::link() {
@@ -231,6 +311,10 @@ void Shader::link() {
 }
 
 void Shader::linkShader(bool notifyRebuild) {
+    // A program from the binary cache has no compiled objects to relink with
+    if (std::exchange(fromBinary_, false)) {
+        for (auto& elem : shaderObjects_) elem.build();
+    }
     attach();
 
     uniformLookup_.clear();  // clear uniform location cache.
@@ -241,6 +325,9 @@ void Shader::linkShader(bool notifyRebuild) {
         return;
     }
 
+    auto* cache = ShaderManager::getPtr()->getBinaryCache();
+    if (cache) glProgramParameteri(program_.id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
     glLinkProgram(program_.id);
 
     if (!checkLinkStatus()) {
@@ -255,6 +342,7 @@ void Shader::linkShader(bool notifyRebuild) {
 
     LGL_ERROR_CLASS;
     ready_ = true;
+    if (cache) cache->store(program_.id, binaryKey(*cache));
     if (notifyRebuild) onReloadCallback_.invokeAll();
 }
 
@@ -282,7 +370,7 @@ void Shader::bindAttributes() {
 void Shader::rebuildShader(ShaderObject* obj) {
     try {
         ready_ = false;
-        obj->build();
+        if (!fromBinary_) obj->build();
         linkShader();
 
         onReloadCallback_.invokeAll();
@@ -385,24 +473,28 @@ std::string Shader::shaderNames() const {
                                  util::makeTransformIterator(name, shaderObjects_.end()), ", "));
 }
 
-GLint Shader::findUniformLocation(std::string_view name) const {
-    auto it = uniformLookup_.find(name);
-    if (it != uniformLookup_.end()) {
+auto Shader::findUniform(std::string_view name) const -> Uniform& {
+    if (auto it = uniformLookup_.find(name); it != uniformLookup_.end()) {
         return it->second;
-    } else {
-        GLint location = glGetUniformLocation(program_.id, SafeCStr{name});
-        uniformLookup_.try_emplace(std::string{name}, location);
-
-        if (warningLevel_ == UniformWarning::Throw && location == -1) {
-            throw OpenGLException(SourceContext{}, "Unable to set uniform {} in shader id: {}, {}",
-                                  name, program_.id, shaderNames());
-        } else if (warningLevel_ == UniformWarning::Warn && location == -1) {
-            log::warn("Unable to set uniform {} in shader id {}, {}: ", name, program_.id,
-                      shaderNames());
-        }
+    }
+
+    const GLint location = glGetUniformLocation(program_.id, SafeCStr{name});
+    auto& uniform =
+        uniformLookup_.try_emplace(std::string{name}, Uniform{location, -1}).first->second;
 
-        return location;
+    if (warningLevel_ == UniformWarning::Throw && location == -1) {
+        throw OpenGLException(SourceContext{}, "Unable to set uniform {} in shader id: {}, {}",
+                              name, program_.id, shaderNames());
+    } else if (warningLevel_ == UniformWarning::Warn && location == -1) {
+        log::warn("Unable to set uniform {} in shader id {}, {}: ", name, program_.id,
+                  shaderNames());
     }
+
+    return uniform;
+}
+
+GLint Shader::findUniformLocation(std::string_view name) const {
+    return findUniform(name).location;
 }
 
 const ShaderObject* Shader::operator[](ShaderType type) const { return getShaderObject(type); }
@@ -503,13 +595,17 @@ void Shader::setUniform(std::string_view name, std::span<const bool> values) con
     }
 }
 void Shader::setUniform(std::string_view name, int value) const {
-    GLint location = findUniformLocation(name);
-    if (location != -1) glUniform1i(location, value);
+    auto& uniform = findUniform(name);
+    uniform.textureUnit = -1;
+    if (uniform.location != -1) glUniform1i(uniform.location, value);
 }
 void Shader::setUniform(std::string_view name, std::span<const int> values) const {
     if (values.empty()) return;
-    GLint location = findUniformLocation(name);
-    if (location != -1) glUniform1iv(location, static_cast<GLsizei>(values.size()), values.data());
+    auto& uniform = findUniform(name);
+    uniform.textureUnit = -1;
+    if (uniform.location != -1) {
+        glUniform1iv(uniform.location, static_cast<GLsizei>(values.size()), values.data());
+    }
 }
 void Shader::setUniform(std::string_view name, unsigned int value) const {
     GLint location = findUniformLocation(name);
@@ -707,13 +803,19 @@ void Shader::setUniform(std::string_view name, std::span<const mat4> values) con
 }
 
 void Shader::setUniform(std::string_view name, const TextureUnit& texUnit) const {
-    GLint location = findUniformLocation(name);
-    if (location != -1) glUniform1i(location, texUnit.getUnitNumber());
+    // Samplers usually end up in the same texture unit every frame, and the value is part of the
+    // program state, so only update it when it changes
+    auto& uniform = findUniform(name);
+    if (uniform.location != -1 && uniform.textureUnit != texUnit.getUnitNumber()) {
+        glUniform1i(uniform.location, texUnit.getUnitNumber());
+        uniform.textureUnit = texUnit.getUnitNumber();
+    }
 }
 
 void Shader::setTransformFeedbackVaryings(std::span<const GLchar*> varyings, GLenum bufferMode) {
     glTransformFeedbackVaryings(program_.id, static_cast<GLsizei>(varyings.size()), varyings.data(),
                                 bufferMode);
+    feedbackVaryings_ = fmt::format("varyings {} {}\n", bufferMode, fmt::join(varyings, " "));
     ready_ = false;
 }
 
@@ -0,0 +1,168 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/opengl/shader/shaderbinarycache.h>
+
+#include <inviwo/core/util/constexprhash.h>     // for constexpr_hash
+#include <inviwo/core/util/logcentral.h>        // for log
+#include <modules/opengl/inviwoopengl.h>        // for GLint, GLenum, glGetProgramBinary
+#include <modules/opengl/openglcapabilities.h>  // for OpenGLCapabilities
+
+#include <fstream>       // for ifstream, ofstream
+#include <system_error>  // for error_code
+#include <utility>       // for move
+#include <vector>        // for vector
+
+#include <fmt/format.h>  // for format
+#include <fmt/std.h>     // for formatter<path>
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::uint32_t magic = 0x42575649;  // "IVWB"
+
+struct Header {
+    std::uint32_t magic;
+    GLenum format;
+    std::uint64_t key;
+    std::uint64_t size;
+};
+
+std::string glString(GLenum name) {
+    const auto* str = reinterpret_cast<const char*>(glGetString(name));
+    return str ? std::string{str} : std::string{};
+}
+
+}  // namespace
+
+ShaderBinaryCache::ShaderBinaryCache(std::filesystem::path directory)
+    : directory_{std::move(directory)}
+    , driver_{fmt::format("{}\n{}\n{}\n", glString(GL_VENDOR), glString(GL_RENDERER),
+                          glString(GL_VERSION))} {}
+
+bool ShaderBinaryCache::isSupported() {
+    if (OpenGLCapabilities::getOpenGLVersion() < 410 &&
+        !OpenGLCapabilities::isExtensionSupported("GL_ARB_get_program_binary")) {
+        return false;
+    }
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    return formats > 0;
+}
+
+std::uint64_t ShaderBinaryCache::key(std::string_view description) const {
+    return util::constexpr_hash(std::string{driver_}.append(description));
+}
+
+bool ShaderBinaryCache::load(GLuint program, std::uint64_t key) const {
+    const auto path = file(key);
+    std::ifstream in{path, std::ios::binary};
+    if (!in) return false;
+
+    Header header{};
+    in.read(reinterpret_cast<char*>(&header), sizeof(Header));
+    std::vector<char> binary;
+    if (in && header.magic == magic && header.key == key) {
+        binary.resize(header.size);
+        in.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+    }
+    in.close();
+
+    if (!binary.empty() && in) {
+        glProgramBinary(program, header.format, binary.data(),
+                        static_cast<GLsizei>(binary.size()));
+        GLint status = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &status);
+        if (status == GL_TRUE) return true;
+    }
+
+    // A truncated file, or a binary the driver no longer accepts, e.g. after an update that did
+    // not change the version string
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    return false;
+}
+
+void ShaderBinaryCache::store(GLuint program, std::uint64_t key) const {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    std::vector<char> binary(static_cast<size_t>(length));
+    Header header{magic, 0, key, 0};
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &header.format, binary.data());
+    if (written <= 0) return;
+    header.size = static_cast<std::uint64_t>(written);
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    if (ec) {
+        log::warn("Unable to create shader binary cache {:?g}: {}", directory_, ec.message());
+        return;
+    }
+
+    // Write to a temporary file and rename it so that other running instances never read a
+    // partially written binary
+    const auto path = file(key);
+    auto tmp = path;
+    tmp += ".tmp";
+    {
+        std::ofstream out{tmp, std::ios::binary | std::ios::trunc};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        out.write(binary.data(), written);
+        if (!out) {
+            log::warn("Unable to write shader binary {:?g}", tmp);
+            out.close();
+            std::filesystem::remove(tmp, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) std::filesystem::remove(tmp, ec);
+}
+
+void ShaderBinaryCache::clear() const {
+    std::error_code ec;
+    const auto removed = std::filesystem::remove_all(directory_, ec);
+    if (ec) {
+        log::warn("Unable to clear shader binary cache {:?g}: {}", directory_, ec.message());
+    } else {
+        log::info("Removed {} cached shader binaries", removed > 0 ? removed - 1 : 0);
+    }
+}
+
+const std::filesystem::path& ShaderBinaryCache::getDirectory() const { return directory_; }
+
+std::filesystem::path ShaderBinaryCache::file(std::uint64_t key) const {
+    return directory_ / fmt::format("{:016x}.bin", key);
+}
+
+}  // namespace inviwo
@@ -29,17 +29,18 @@
 
 #include <modules/opengl/shader/shadermanager.h>
 
-#include <inviwo/core/common/inviwoapplication.h>   // for InviwoApplication
-#include <inviwo/core/properties/optionproperty.h>  // for OptionProperty
-#include <inviwo/core/util/dispatcher.h>            // for Dispatcher
-#include <inviwo/core/util/filesystem.h>            // for fileExists, directoryExists
-#include <inviwo/core/util/logcentral.h>            // for LogCentral
-#include <inviwo/core/util/stdextensions.h>         // for erase_remove, find_if
-#include <inviwo/core/util/stringconversion.h>      // for replaceInString
-#include <modules/opengl/openglmodule.h>            // for OpenGLModule
-#include <modules/opengl/openglsettings.h>          // for OpenGLSettings
-#include <modules/opengl/shader/shader.h>           // for Shader, Shader::OnError
-#include <modules/opengl/shader/shaderresource.h>   // for FileShaderResource, StringShaderResource
+#include <inviwo/core/common/inviwoapplication.h>     // for InviwoApplication
+#include <inviwo/core/properties/optionproperty.h>    // for OptionProperty
+#include <inviwo/core/util/dispatcher.h>              // for Dispatcher
+#include <inviwo/core/util/filesystem.h>              // for fileExists, directoryExists
+#include <inviwo/core/util/logcentral.h>              // for LogCentral
+#include <inviwo/core/util/stdextensions.h>           // for erase_remove, find_if
+#include <inviwo/core/util/stringconversion.h>        // for replaceInString
+#include <modules/opengl/openglmodule.h>              // for OpenGLModule
+#include <modules/opengl/openglsettings.h>            // for OpenGLSettings
+#include <modules/opengl/shader/shader.h>             // for Shader, Shader::OnError
+#include <modules/opengl/shader/shaderbinarycache.h>  // for ShaderBinaryCache
+#include <modules/opengl/shader/shaderresource.h>     // for FileShaderResource, StringShaderReso...
 #include <modules/opengl/shader/fileshaderresource.h>
 #include <modules/opengl/shader/stringshaderresource.h>
 
@@ -56,7 +57,9 @@ namespace inviwo {
 ShaderManager* ShaderManager::instance_ = nullptr;
 
 ShaderManager::ShaderManager()
-    : uniformWarnings_(nullptr), shaderObjectErrors_{nullptr} {}
+    : uniformWarnings_(nullptr), shaderObjectErrors_{nullptr}, shaderBinaryCache_{nullptr} {}
+
+ShaderManager::~ShaderManager() = default;
 
 void ShaderManager::setOpenGLSettings(OpenGLSettings* settings) {
     uniformWarnings_ = &(settings->uniformWarnings_);
@@ -71,6 +74,22 @@ void ShaderManager::setOpenGLSettings(OpenGLSettings* settings) {
     });
 
     shaderObjectErrors_ = &(settings->shaderObjectErrors_);
+
+    shaderBinaryCache_ = &(settings->shaderBinaryCache_);
+    settings->clearShaderBinaryCache_.onChange([this]() {
+        if (auto* cache = getBinaryCache()) cache->clear();
+    });
+}
+
+ShaderBinaryCache* ShaderManager::getBinaryCache() {
+    if (!shaderBinaryCache_ || !shaderBinaryCache_->get()) return nullptr;
+    if (!binaryCache_) {
+        binaryCache_ = ShaderBinaryCache::isSupported()
+                           ? std::make_unique<ShaderBinaryCache>(
+                                 filesystem::getPath(PathType::Cache) / "shaders")
+                           : nullptr;
+    }
+    return binaryCache_->get();
 }
 
 Shader::OnError ShaderManager::getOnShaderError() const { return shaderObjectErrors_->get(); }
@@ -161,9 +180,9 @@ std::shared_ptr<ShaderResource> ShaderManager::getShaderResource(std::string_vie
 void ShaderManager::rebuildAllShaders() {
     if (shaders_.empty()) return;
 
-    for (auto& shader : shaders_) {
-        shader->build();
-    }
+    // Take a copy, building may register and unregister shaders through the reload callbacks
+    const auto shaders = shaders_;
+    Shader::build(shaders);
     log::info("Rebuild of all shaders completed");
 }
 
@@ -596,6 +596,8 @@ std::string ShaderObject::resolveLog(std::string_view compileLog) const {
     return result;
 }
 
+const std::string& ShaderObject::getProcessedSource() const { return sourceProcessed_; }
+
 void ShaderObject::upload() {
     LGL_ERROR_CLASS;
     create();
@@ -618,6 +620,15 @@ void ShaderObject::compile() {
     LGL_ERROR_CLASS;
     create();
     glCompileShader(id_);
+    checkCompileStatus();
+}
+
+void ShaderObject::submit() {
+    upload();
+    glCompileShader(id_);
+}
+
+void ShaderObject::checkCompileStatus() {
     if (!isReady()) {
         throw OpenGLException(SourceContext{}, "{} {}", resource_->key(),
                               resolveLog(utilgl::getShaderInfoLog(id_)));
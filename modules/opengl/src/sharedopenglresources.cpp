@@ -66,6 +66,13 @@ Shader* SharedOpenGLResources::getNoiseShader() {
     return noiseShader_.get();
 }
 
+Shader* SharedOpenGLResources::getUpscaleShader() {
+    if (!upscaleShader_) {
+        upscaleShader_ = std::make_unique<Shader>("img_texturequad.vert", "img_upscale.frag");
+    }
+    return upscaleShader_.get();
+}
+
 Shader* SharedOpenGLResources::getImageCopyShader(size_t colorLayers) {
     auto& elem = imgCopyShaders_[colorLayers];
     if (!elem) {
@@ -105,7 +112,9 @@ void SharedOpenGLResources::reset() {
     planeRectMesh_ = nullptr;
     textureShader_ = nullptr;
     noiseShader_ = nullptr;
+    upscaleShader_ = nullptr;
     imgCopyShaders_.clear();
+    texturePool_.setCapacity(0);
 }
 
 }  // namespace inviwo
@@ -38,6 +38,7 @@
 #include <modules/opengl/inviwoopengl.h>                  // for GLenum, glBindTexture, glTexPar...
 #include <modules/opengl/openglexception.h>               // for OpenGLException
 #include <modules/opengl/openglutils.h>                   // for convertSwizzleMaskToGL, convert...
+#include <modules/opengl/texture/texturecompression.h>    // for compressedFormat
 #include <modules/opengl/texture/textureobserver.h>       // for TextureObserver
 
 #include <algorithm>    // for find_if
@@ -261,6 +262,8 @@ GLenum Texture::getFormat() const { return format_; }
 
 GLenum Texture::getInternalFormat() const { return internalformat_; }
 
+bool Texture::isCompressed() const { return utilgl::compressedFormat(internalformat_) != nullptr; }
+
 GLenum Texture::getDataType() const { return dataType_; }
 
 const DataFormatBase* Texture::getDataFormat() const {
@@ -386,6 +389,23 @@ void Texture::download(void* data) const {
     LGL_ERROR;
 }
 
+void Texture::downloadToBuffer(GLuint buffer) const {
+    {
+        std::scoped_lock lock{syncMutex};
+        if (syncObj != 0) {
+            glWaitSync(syncObj, 0, GL_TIMEOUT_IGNORED);
+        }
+    }
+
+    bind();
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glGetTexImage(target_, 0, format_, dataType_, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    unbind();
+    LGL_ERROR_CLASS;
+}
+
 void Texture::downloadToPBO() const {
     if (!pboBackIsSetup_) {
         setupAsyncReadBackPBO();
@@ -138,6 +138,47 @@ void Texture2D::upload(const void* data) {
     LGL_ERROR_CLASS;
 }
 
+void Texture2D::upload(const void* data, const size2_t& offset, const size2_t& extent) {
+    bind();
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(dimensions_.x));
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, static_cast<GLint>(offset.x));
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, static_cast<GLint>(offset.y));
+    glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(offset.x), static_cast<GLint>(offset.y),
+                    static_cast<GLsizei>(extent.x), static_cast<GLsizei>(extent.y), format_,
+                    dataType_, data);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+    LGL_ERROR_CLASS;
+}
+
+void Texture2D::initializeCompressed(GLenum internalFormat, std::span<const std::byte> blocks) {
+    forEachObserver([](TextureObserver* o) { o->notifyBeforeTextureInitialization(); });
+
+    internalformat_ = internalFormat;
+    bind();
+    glCompressedTexImage2D(GL_TEXTURE_2D, level_, internalformat_,
+                           static_cast<GLsizei>(dimensions_.x), static_cast<GLsizei>(dimensions_.y),
+                           0, static_cast<GLsizei>(blocks.size()), blocks.data());
+    LGL_ERROR_CLASS;
+    forEachObserver([](TextureObserver* o) { o->notifyAfterTextureInitialization(); });
+
+    auto old = resource::remove(resource::GL{id_});
+    resource::add(resource::GL{id_}, Resource{.dims = glm::size4_t{dimensions_, 0, 0},
+                                              .format = getDataFormat()->getId(),
+                                              .desc = "Texture2D",
+                                              .meta = resource::getMeta(old)});
+}
+
+void Texture2D::uploadCompressed(std::span<const std::byte> blocks) {
+    bind();
+    glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(dimensions_.x),
+                              static_cast<GLsizei>(dimensions_.y), internalformat_,
+                              static_cast<GLsizei>(blocks.size()), blocks.data());
+    LGL_ERROR_CLASS;
+}
+
 void Texture2D::setWrapping(const std::array<GLenum, 2>& wrapping) {
     Texture::setWrapping(std::span(wrapping));
 }
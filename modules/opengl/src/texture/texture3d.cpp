@@ -31,6 +31,7 @@
 
 #include <inviwo/core/datastructures/image/imagetypes.h>  // for SwizzleMask
 #include <inviwo/core/util/glmvec.h>                      // for size3_t
+#include <inviwo/core/util/parallel.h>                    // for parallelFor
 #include <modules/opengl/glformats.h>                     // for GLFormat
 #include <modules/opengl/inviwoopengl.h>                  // for GLenum, GLsizei, glPixelStorei
 #include <modules/opengl/openglcapabilities.h>            // for OpenGLCapabilities
@@ -38,11 +39,15 @@
 #include <modules/opengl/texture/textureobserver.h>       // for TextureObserver
 #include <inviwo/core/resourcemanager/resource.h>
 
-#include <mutex>   // for scoped_lock
-#include <vector>  // for vector
+#include <algorithm>  // for any_of, count
+#include <cstddef>    // for byte
+#include <mutex>      // for scoped_lock
+#include <vector>     // for vector
 #include <span>    // for span
 
-#include <glm/vec3.hpp>  // for vec<>::(anonymous), operator!=
+#include <glm/gtx/component_wise.hpp>  // for compMul
+#include <glm/vector_relational.hpp>   // for any, lessThanEqual, notEqual
+#include <glm/vec3.hpp>                // for vec<>::(anonymous), operator!=
 
 namespace inviwo {
 
@@ -113,17 +118,20 @@ Texture3D::~Texture3D() { resource::remove(resource::GL{id_}); }
 
 Texture3D* Texture3D::clone() const { return new Texture3D(*this); }
 
-void Texture3D::initialize(const void* data) {
+void Texture3D::initialize(const void* data) { initialize(data, internalformat_, dataType_); }
+
+void Texture3D::initialize(const void* data, GLenum internalFormat, GLenum dataType) {
     // Notify observers
     forEachObserver([](TextureObserver* o) { o->notifyBeforeTextureInitialization(); });
 
     // Allocate data
+    internalformat_ = internalFormat;
     bind();
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
     glTexImage3D(GL_TEXTURE_3D, level_, internalformat_, static_cast<GLsizei>(dimensions_.x),
                  static_cast<GLsizei>(dimensions_.y), static_cast<GLsizei>(dimensions_.z), 0,
-                 format_, dataType_, data);
+                 format_, dataType, data);
     LGL_ERROR;
     forEachObserver([](TextureObserver* o) { o->notifyAfterTextureInitialization(); });
 
@@ -136,12 +144,60 @@ size_t Texture3D::getNumberOfValues() const {
     return dimensions_.x * dimensions_.y * dimensions_.z;
 }
 
-void Texture3D::upload(const void* data) {
+void Texture3D::upload(const void* data) { upload(data, dataType_); }
+
+void Texture3D::upload(const void* data, GLenum dataType) {
     bind();
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
     glTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, static_cast<GLsizei>(dimensions_.x),
                     static_cast<GLsizei>(dimensions_.y), static_cast<GLsizei>(dimensions_.z),
-                    format_, dataType_, data);
+                    format_, dataType, data);
+    LGL_ERROR;
+}
+
+void Texture3D::upload(const void* data, const size3_t& offset, const size3_t& extent) {
+    bind();
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(dimensions_.x));
+    glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, static_cast<GLint>(dimensions_.y));
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, static_cast<GLint>(offset.x));
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, static_cast<GLint>(offset.y));
+    glPixelStorei(GL_UNPACK_SKIP_IMAGES, static_cast<GLint>(offset.z));
+    glTexSubImage3D(GL_TEXTURE_3D, 0, static_cast<GLint>(offset.x), static_cast<GLint>(offset.y),
+                    static_cast<GLint>(offset.z), static_cast<GLsizei>(extent.x),
+                    static_cast<GLsizei>(extent.y), static_cast<GLsizei>(extent.z), format_,
+                    dataType_, data);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, 0);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_IMAGES, 0);
+    LGL_ERROR;
+}
+
+void Texture3D::initializeCompressed(GLenum internalFormat, std::span<const std::byte> blocks) {
+    forEachObserver([](TextureObserver* o) { o->notifyBeforeTextureInitialization(); });
+
+    internalformat_ = internalFormat;
+    bind();
+    glCompressedTexImage3D(GL_TEXTURE_3D, level_, internalformat_,
+                           static_cast<GLsizei>(dimensions_.x), static_cast<GLsizei>(dimensions_.y),
+                           static_cast<GLsizei>(dimensions_.z), 0,
+                           static_cast<GLsizei>(blocks.size()), blocks.data());
+    LGL_ERROR;
+    forEachObserver([](TextureObserver* o) { o->notifyAfterTextureInitialization(); });
+
+    resource::add(resource::GL{id_}, Resource{.dims = glm::size4_t{dimensions_, 0},
+                                              .format = getDataFormat()->getId(),
+                                              .desc = "Texture3D"});
+}
+
+void Texture3D::uploadCompressed(std::span<const std::byte> blocks) {
+    bind();
+    glCompressedTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, static_cast<GLsizei>(dimensions_.x),
+                              static_cast<GLsizei>(dimensions_.y),
+                              static_cast<GLsizei>(dimensions_.z), internalformat_,
+                              static_cast<GLsizei>(blocks.size()), blocks.data());
     LGL_ERROR;
 }
 
@@ -157,6 +213,114 @@ void Texture3D::setWrapping(const std::array<GLenum, 3>& wrapping) {
     Texture::setWrapping(std::span(wrapping));
 }
 
+bool Texture3D::initializeSparse(const void* data) {
+    if (!OpenGLCapabilities::isExtensionSupported("GL_ARB_sparse_texture") ||
+        !OpenGLCapabilities::isExtensionSupported("GL_ARB_sparse_texture2")) {
+        return false;
+    }
+
+    GLint pageSizes = 0;
+    glGetInternalformativ(GL_TEXTURE_3D, internalformat_, GL_NUM_VIRTUAL_PAGE_SIZES_ARB, 1,
+                          &pageSizes);
+    if (pageSizes <= 0) return false;
+
+    // Use the first, preferred, page size
+    glm::ivec3 pageSize{0};
+    glGetInternalformativ(GL_TEXTURE_3D, internalformat_, GL_VIRTUAL_PAGE_SIZE_X_ARB, 1,
+                          &pageSize.x);
+    glGetInternalformativ(GL_TEXTURE_3D, internalformat_, GL_VIRTUAL_PAGE_SIZE_Y_ARB, 1,
+                          &pageSize.y);
+    glGetInternalformativ(GL_TEXTURE_3D, internalformat_, GL_VIRTUAL_PAGE_SIZE_Z_ARB, 1,
+                          &pageSize.z);
+    if (glm::any(glm::lessThanEqual(pageSize, glm::ivec3{0}))) return false;
+    const auto page = static_cast<size3_t>(pageSize);
+    if (glm::any(glm::notEqual(dimensions_ % page, size3_t{0}))) return false;
+
+    forEachObserver([](TextureObserver* o) { o->notifyBeforeTextureInitialization(); });
+
+    bind();
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_SPARSE_ARB, GL_TRUE);
+    glTexParameteri(GL_TEXTURE_3D, GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, 0);
+    glTexStorage3D(GL_TEXTURE_3D, 1, internalformat_, static_cast<GLsizei>(dimensions_.x),
+                   static_cast<GLsizei>(dimensions_.y), static_cast<GLsizei>(dimensions_.z));
+    LGL_ERROR;
+
+    pageSize_ = page;
+    committedPages_.assign(glm::compMul(dimensions_ / page), false);
+
+    forEachObserver([](TextureObserver* o) { o->notifyAfterTextureInitialization(); });
+
+    resource::add(resource::GL{id_}, Resource{.dims = glm::size4_t{dimensions_, 0},
+                                              .format = getDataFormat()->getId(),
+                                              .desc = "Texture3D (sparse)"});
+
+    uploadSparse(data);
+    return true;
+}
+
+void Texture3D::uploadSparse(const void* data) {
+    const size3_t pages = dimensions_ / pageSize_;
+    const size_t voxelBytes = getSizeInBytes();
+    const size_t rowBytes = pageSize_.x * voxelBytes;
+    const auto* bytes = static_cast<const std::byte*>(data);
+
+    // A page is empty when all of its voxels are zero
+    std::vector<char> used(committedPages_.size(), 0);
+    if (bytes) {
+        util::parallelFor(0, used.size(), [&](size_t index) {
+            const size3_t p{index % pages.x, (index / pages.x) % pages.y,
+                            index / (pages.x * pages.y)};
+            const size3_t first = p * pageSize_;
+            for (size_t z = first.z; z < first.z + pageSize_.z; ++z) {
+                for (size_t y = first.y; y < first.y + pageSize_.y; ++y) {
+                    const auto* row =
+                        bytes + ((z * dimensions_.y + y) * dimensions_.x + first.x) * voxelBytes;
+                    if (std::any_of(row, row + rowBytes,
+                                    [](std::byte b) { return b != std::byte{0}; })) {
+                        used[index] = 1;
+                        return;
+                    }
+                }
+            }
+        });
+    }
+
+    // Commit and upload runs of used pages along x, release pages that are no longer used
+    bind();
+    const auto commit = [&](size3_t first, size_t count, bool enable) {
+        const size3_t offset = first * pageSize_;
+        const size3_t extent{count * pageSize_.x, pageSize_.y, pageSize_.z};
+        glTexPageCommitmentARB(GL_TEXTURE_3D, 0, static_cast<GLint>(offset.x),
+                               static_cast<GLint>(offset.y), static_cast<GLint>(offset.z),
+                               static_cast<GLsizei>(extent.x), static_cast<GLsizei>(extent.y),
+                               static_cast<GLsizei>(extent.z), enable ? GL_TRUE : GL_FALSE);
+        if (enable) upload(data, offset, extent);
+    };
+    for (size_t z = 0; z < pages.z; ++z) {
+        for (size_t y = 0; y < pages.y; ++y) {
+            const size_t row = (z * pages.y + y) * pages.x;
+            size_t x = 0;
+            while (x < pages.x) {
+                const bool state = used[row + x] != 0;
+                size_t end = x;
+                bool changed = false;
+                while (end < pages.x && (used[row + end] != 0) == state) {
+                    changed |= committedPages_[row + end] != state;
+                    committedPages_[row + end] = state;
+                    ++end;
+                }
+                if (state || changed) commit(size3_t{x, y, z}, end - x, state);
+                x = end;
+            }
+        }
+    }
+    LGL_ERROR;
+}
+
+size_t Texture3D::getNumberOfCommittedPages() const {
+    return static_cast<size_t>(std::count(committedPages_.begin(), committedPages_.end(), true));
+}
+
 std::array<GLenum, 3> Texture3D::getWrapping() const {
     std::array<GLenum, 3> wrapping{};
     Texture::getWrapping(std::span(wrapping));
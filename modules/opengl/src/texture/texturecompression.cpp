@@ -0,0 +1,321 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/opengl/texture/texturecompression.h>
+
+#include <inviwo/core/util/exception.h>         // for Exception
+#include <inviwo/core/util/glmvec.h>            // for size3_t
+#include <inviwo/core/util/parallel.h>          // for parallelFor
+#include <inviwo/core/util/sourcecontext.h>     // for SourceContext
+#include <modules/opengl/inviwoopengl.h>        // for GL_COMPRESSED_RED_RGTC1, ...
+#include <modules/opengl/openglcapabilities.h>  // for OpenGLCapabilities
+
+#include <algorithm>  // for min, max, clamp, copy, fill, find_if
+#include <array>      // for array
+#include <cstdint>    // for uint8_t, uint32_t, uint64_t
+#include <limits>     // for numeric_limits
+#include <utility>    // for swap
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::array<CompressedFormat, 3> formats{{
+    {TextureCompression::BC4, GL_COMPRESSED_RED_RGTC1, 1, 8, false, "BC4"},
+    {TextureCompression::BC5, GL_COMPRESSED_RG_RGTC2, 2, 16, false, "BC5"},
+    {TextureCompression::BC7, GL_COMPRESSED_RGBA_BPTC_UNORM, 4, 16, true, "BC7"},
+}};
+
+constexpr size_t texels = CompressedFormat::blockSize * CompressedFormat::blockSize;
+
+using Block = std::array<std::array<std::uint8_t, 4>, texels>;
+
+/**
+ * Copy the 4x4 block at @p bx, @p by of slice @p z into @p block, clamping at the edges.
+ */
+void fetchBlock(const std::uint8_t* data, size3_t dims, size_t channels, size_t bx, size_t by,
+                size_t z, Block& block) {
+    for (size_t y = 0; y < CompressedFormat::blockSize; ++y) {
+        const size_t sy = std::min(by * CompressedFormat::blockSize + y, dims.y - 1);
+        for (size_t x = 0; x < CompressedFormat::blockSize; ++x) {
+            const size_t sx = std::min(bx * CompressedFormat::blockSize + x, dims.x - 1);
+            const auto* texel = data + ((z * dims.y + sy) * dims.x + sx) * channels;
+            auto& dst = block[y * CompressedFormat::blockSize + x];
+            dst = {0, 0, 0, 255};
+            std::copy(texel, texel + channels, dst.begin());
+        }
+    }
+}
+
+/**
+ * Encode a single channel of @p block as a BC4 block using the eight value mode, where the
+ * endpoints are the minimum and maximum of the block.
+ */
+void encodeBC4(const Block& block, size_t channel, std::byte* dst) {
+    std::uint8_t lo = 255;
+    std::uint8_t hi = 0;
+    for (const auto& texel : block) {
+        lo = std::min(lo, texel[channel]);
+        hi = std::max(hi, texel[channel]);
+    }
+
+    std::uint64_t bits = std::uint64_t{hi} | (std::uint64_t{lo} << 8);
+    if (hi != lo) {
+        const std::uint32_t range = hi - lo;
+        for (size_t i = 0; i < texels; ++i) {
+            // Position along lo -> hi in sevenths. Index 0 is hi, 1 is lo and 2-7 are the
+            // interpolated values going from hi towards lo.
+            const std::uint32_t pos = ((block[i][channel] - lo) * 14u + range) / (2u * range);
+            const std::uint64_t index = pos == 7 ? 0 : (pos == 0 ? 1 : 8 - pos);
+            bits |= index << (16 + 3 * i);
+        }
+    }
+    for (size_t i = 0; i < 8; ++i) {
+        dst[i] = static_cast<std::byte>((bits >> (8 * i)) & 0xFF);
+    }
+}
+
+class BitWriter {
+public:
+    explicit BitWriter(std::byte* dst) : dst_{dst} { std::fill(dst_, dst_ + 16, std::byte{0}); }
+    void put(std::uint32_t value, size_t bits) {
+        for (size_t i = 0; i < bits; ++i, ++pos_) {
+            if ((value >> i) & 1u) dst_[pos_ / 8] |= static_cast<std::byte>(1u << (pos_ % 8));
+        }
+    }
+
+private:
+    std::byte* dst_;
+    size_t pos_ = 0;
+};
+
+constexpr std::array<std::uint32_t, 16> bc7Weights{0,  4,  9,  13, 17, 21, 26, 30,
+                                                    34, 38, 43, 47, 51, 55, 60, 64};
+
+struct BC7Endpoint {
+    std::array<std::uint32_t, 4> color;  //< 7-bit values
+    std::uint32_t pbit;
+
+    std::uint32_t operator[](size_t c) const { return (color[c] << 1) | pbit; }
+};
+
+BC7Endpoint quantizeBC7(const std::array<int, 4>& value) {
+    BC7Endpoint best{};
+    int bestError = std::numeric_limits<int>::max();
+    for (std::uint32_t p = 0; p < 2; ++p) {
+        BC7Endpoint candidate{{}, p};
+        int error = 0;
+        for (size_t c = 0; c < 4; ++c) {
+            const int q = std::clamp((value[c] - static_cast<int>(p) + 1) / 2, 0, 127);
+            candidate.color[c] = static_cast<std::uint32_t>(q);
+            const int diff = static_cast<int>(candidate[c]) - value[c];
+            error += diff * diff;
+        }
+        if (error < bestError) {
+            bestError = error;
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+/**
+ * Encode @p block as a BC7 mode 6 block, a single RGBA subset with 7-bit endpoints, a p-bit per
+ * endpoint and 4-bit indices. The endpoints span the bounding box of the block, with the
+ * diagonal flipped for channels that are anti-correlated with the channel of largest range.
+ */
+void encodeBC7(const Block& block, std::byte* dst) {
+    std::array<int, 4> lo{255, 255, 255, 255};
+    std::array<int, 4> hi{0, 0, 0, 0};
+    std::array<int, 4> mean{0, 0, 0, 0};
+    for (const auto& texel : block) {
+        for (size_t c = 0; c < 4; ++c) {
+            lo[c] = std::min(lo[c], static_cast<int>(texel[c]));
+            hi[c] = std::max(hi[c], static_cast<int>(texel[c]));
+            mean[c] += texel[c];
+        }
+    }
+    size_t major = 0;
+    for (size_t c = 1; c < 4; ++c) {
+        if (hi[c] - lo[c] > hi[major] - lo[major]) major = c;
+    }
+    for (size_t c = 0; c < 4; ++c) {
+        if (c == major) continue;
+        int covariance = 0;
+        for (const auto& texel : block) {
+            covariance += (texel[c] * 16 - mean[c]) * (texel[major] * 16 - mean[major]);
+        }
+        if (covariance < 0) std::swap(lo[c], hi[c]);
+    }
+
+    auto e0 = quantizeBC7(lo);
+    auto e1 = quantizeBC7(hi);
+
+    std::array<std::array<std::uint32_t, 4>, 16> palette{};
+    for (size_t i = 0; i < 16; ++i) {
+        for (size_t c = 0; c < 4; ++c) {
+            palette[i][c] = ((64 - bc7Weights[i]) * e0[c] + bc7Weights[i] * e1[c] + 32) >> 6;
+        }
+    }
+
+    std::array<std::uint32_t, texels> indices{};
+    for (size_t i = 0; i < texels; ++i) {
+        std::uint32_t bestError = std::numeric_limits<std::uint32_t>::max();
+        for (std::uint32_t j = 0; j < 16; ++j) {
+            std::uint32_t error = 0;
+            for (size_t c = 0; c < 4; ++c) {
+                const int diff = static_cast<int>(palette[j][c]) - block[i][c];
+                error += static_cast<std::uint32_t>(diff * diff);
+            }
+            if (error < bestError) {
+                bestError = error;
+                indices[i] = j;
+            }
+        }
+    }
+
+    // The most significant bit of the first index is implicitly zero
+    if (indices[0] >= 8) {
+        std::swap(e0, e1);
+        for (auto& index : indices) index = 15 - index;
+    }
+
+    BitWriter writer{dst};
+    writer.put(1u << 6, 7);
+    for (size_t c = 0; c < 4; ++c) {
+        writer.put(e0.color[c], 7);
+        writer.put(e1.color[c], 7);
+    }
+    writer.put(e0.pbit, 1);
+    writer.put(e1.pbit, 1);
+    writer.put(indices[0], 3);
+    for (size_t i = 1; i < texels; ++i) writer.put(indices[i], 4);
+}
+
+}  // namespace
+
+const CompressedFormat* utilgl::compressedFormat(TextureCompression compression) {
+    const auto it = std::find_if(formats.begin(), formats.end(), [&](const CompressedFormat& f) {
+        return f.compression == compression;
+    });
+    return it != formats.end() ? &*it : nullptr;
+}
+
+const CompressedFormat* utilgl::compressedFormat(GLenum internalFormat) {
+    const auto it = std::find_if(formats.begin(), formats.end(), [&](const CompressedFormat& f) {
+        return f.internalFormat == internalFormat;
+    });
+    return it != formats.end() ? &*it : nullptr;
+}
+
+bool utilgl::isCompressionSupported(TextureCompression compression, GLenum target) {
+    const auto* format = compressedFormat(compression);
+    if (!format) return false;
+    if (target == GL_TEXTURE_3D && !format->volumes) return false;
+
+    const auto version = OpenGLCapabilities::getOpenGLVersion();
+    if (version >= 430) {
+        GLint supported = GL_FALSE;
+        glGetInternalformativ(target, format->internalFormat, GL_INTERNALFORMAT_SUPPORTED, 1,
+                              &supported);
+        return supported == GL_TRUE;
+    }
+    if (compression == TextureCompression::BC7) {
+        return version >= 420 ||
+               OpenGLCapabilities::isExtensionSupported("GL_ARB_texture_compression_bptc");
+    }
+    return version >= 300;
+}
+
+TextureCompression utilgl::selectCompression(GLint internalFormat, GLenum target) {
+    const auto compression = [&]() {
+        switch (internalFormat) {
+            case GL_R8:
+                return TextureCompression::BC4;
+            case GL_RG8:
+                return TextureCompression::BC5;
+            case GL_RGB8:
+            case GL_RGBA8:
+                return TextureCompression::BC7;
+            default:
+                return TextureCompression::None;
+        }
+    }();
+    return isCompressionSupported(compression, target) ? compression : TextureCompression::None;
+}
+
+std::vector<std::byte> utilgl::compressTexture(const void* data, size3_t dims, size_t channels,
+                                               TextureCompression compression) {
+    const auto* format = compressedFormat(compression);
+    if (!format) {
+        throw Exception(SourceContext{}, "No texture compression given");
+    }
+    const bool validChannels = compression == TextureCompression::BC7
+                                   ? (channels == 3 || channels == 4)
+                                   : channels == format->channels;
+    if (!validChannels) {
+        throw Exception(SourceContext{}, "{} compression can not encode {} channels",
+                        format->name, channels);
+    }
+
+    std::vector<std::byte> blocks(format->compressedSize(dims));
+    if (blocks.empty()) return blocks;
+
+    const size_t blocksX = (dims.x + CompressedFormat::blockSize - 1) / CompressedFormat::blockSize;
+    const size_t blocksY = (dims.y + CompressedFormat::blockSize - 1) / CompressedFormat::blockSize;
+    const auto* src = static_cast<const std::uint8_t*>(data);
+
+    util::parallelFor(0, blocksY * dims.z, [&](size_t row) {
+        const size_t z = row / blocksY;
+        const size_t by = row % blocksY;
+        Block block{};
+        for (size_t bx = 0; bx < blocksX; ++bx) {
+            fetchBlock(src, dims, channels, bx, by, z, block);
+            auto* dst = blocks.data() + (row * blocksX + bx) * format->blockBytes;
+            switch (compression) {
+                case TextureCompression::BC4:
+                    encodeBC4(block, 0, dst);
+                    break;
+                case TextureCompression::BC5:
+                    encodeBC4(block, 0, dst);
+                    encodeBC4(block, 1, dst + 8);
+                    break;
+                case TextureCompression::BC7:
+                    encodeBC7(block, dst);
+                    break;
+                case TextureCompression::None:
+                    break;
+            }
+        }
+    });
+
+    return blocks;
+}
+
+}  // namespace inviwo
@@ -0,0 +1,129 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/opengl/texture/texturepool.h>
+
+#include <inviwo/core/resourcemanager/memorybudget.h>  // for MemoryBudget, MemoryBudget::Pool
+#include <modules/opengl/openglutils.h>                 // for convertInterpolationFromGL
+#include <modules/opengl/texture/texture2d.h>           // for Texture2D
+
+#include <algorithm>  // for find_if
+#include <iterator>   // for next
+#include <utility>    // for move
+
+namespace inviwo {
+
+TexturePool::TexturePool(size_t capacity) : capacity_{capacity} {}
+
+TexturePool::~TexturePool() = default;
+
+std::shared_ptr<Texture2D> TexturePool::acquire(size2_t dimensions, GLint format,
+                                                GLint internalFormat, GLenum dataType,
+                                                GLenum filtering, const SwizzleMask& swizzleMask,
+                                                const std::array<GLenum, 2>& wrapping) {
+    std::shared_ptr<Texture2D> texture;
+    {
+        const std::scoped_lock lock{mutex_};
+        // Search from the most recently released texture
+        const auto it = std::find_if(textures_.rbegin(), textures_.rend(), [&](const Entry& e) {
+            const auto& t = *e.texture;
+            return t.getDimensions() == dimensions &&
+                   t.getInternalFormat() == static_cast<GLenum>(internalFormat) &&
+                   t.getFormat() == static_cast<GLenum>(format) && t.getDataType() == dataType;
+        });
+        if (it != textures_.rend()) {
+            texture = std::move(it->texture);
+            size_ -= it->bytes;
+            textures_.erase(std::next(it).base());
+        }
+    }
+
+    if (texture) {
+        texture->setInterpolation(utilgl::convertInterpolationFromGL(filtering));
+        texture->setSwizzleMask(swizzleMask);
+        texture->setWrapping(wrapping);
+    } else {
+        texture = std::make_shared<Texture2D>(dimensions, format, internalFormat, dataType,
+                                              filtering, swizzleMask, wrapping);
+        texture->initialize(nullptr);
+    }
+    return texture;
+}
+
+void TexturePool::release(std::shared_ptr<Texture2D>&& texture) {
+    auto tex = std::move(texture);
+    if (!tex || tex.use_count() != 1) return;
+
+    if (auto* budget = MemoryBudget::getEnabled();
+        budget && budget->getPressure(MemoryBudget::Pool::GL) >= 1.0) {
+        return;
+    }
+
+    const size_t bytes = tex->getNumberOfValues() * tex->getSizeInBytes();
+
+    const std::scoped_lock lock{mutex_};
+    if (bytes > capacity_) return;
+
+    evict(capacity_ - bytes);
+    textures_.push_back(Entry{std::move(tex), bytes});
+    size_ += bytes;
+}
+
+void TexturePool::clear() {
+    const std::scoped_lock lock{mutex_};
+    textures_.clear();
+    size_ = 0;
+}
+
+void TexturePool::setCapacity(size_t bytes) {
+    const std::scoped_lock lock{mutex_};
+    capacity_ = bytes;
+    evict(capacity_);
+}
+
+size_t TexturePool::getCapacity() const {
+    const std::scoped_lock lock{mutex_};
+    return capacity_;
+}
+
+size_t TexturePool::getSize() const {
+    const std::scoped_lock lock{mutex_};
+    return size_;
+}
+
+void TexturePool::evict(size_t capacity) {
+    auto it = textures_.begin();
+    while (size_ > capacity && it != textures_.end()) {
+        size_ -= it->bytes;
+        ++it;
+    }
+    textures_.erase(textures_.begin(), it);
+}
+
+}  // namespace inviwo
@@ -33,12 +33,13 @@
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>  // for VolumeRepresentation
 #include <inviwo/core/util/assertion.h>                              // for IVW_ASSERT
 #include <inviwo/core/util/formats.h>                                // for DataFormatBase
-#include <inviwo/core/util/glmvec.h>                                 // for size3_t
+#include <inviwo/core/util/glmvec.h>                                 // for size3_t, dvec2
 #include <modules/opengl/glformats.h>                                // for GLFormats
 #include <modules/opengl/openglutils.h>                              // for convertWrappingToGL
 #include <modules/opengl/texture/texture3d.h>                        // for Texture3D
 #include <inviwo/core/resourcemanager/resource.h>
 
+#include <optional>     // for optional
 #include <type_traits>  // for remove_extent_t
 
 namespace inviwo {
@@ -68,12 +69,17 @@ VolumeGL::VolumeGL(std::shared_ptr<Texture3D> tex) : VolumeRepresentation{}, tex
 }
 
 VolumeGL::VolumeGL(const VolumeGL& rhs)
-    : VolumeRepresentation(rhs), texture_(rhs.texture_->clone()) {}
+    : VolumeRepresentation(rhs)
+    , texture_(rhs.texture_->clone())
+    , precision_{rhs.precision_}
+    , normalizedRange_{rhs.normalizedRange_} {}
 
 VolumeGL& VolumeGL::operator=(const VolumeGL& rhs) {
     if (this != &rhs) {
         VolumeRepresentation::operator=(rhs);
         texture_ = std::shared_ptr<Texture3D>(rhs.texture_->clone());
+        precision_ = rhs.precision_;
+        normalizedRange_ = rhs.normalizedRange_;
     }
     return *this;
 }
@@ -92,7 +98,18 @@ void VolumeGL::bindTexture(GLenum texUnit) const {
 
 void VolumeGL::unbindTexture() const { texture_->unbind(); }
 
-void VolumeGL::setDimensions(size3_t dimensions) { texture_->uploadAndResize(nullptr, dimensions); }
+void VolumeGL::setDimensions(size3_t dimensions) {
+    if (texture_->isSparse() && dimensions != texture_->getDimensions()) {
+        // The storage of a sparse texture can not be changed, replace it with a regular one
+        texture_ = std::make_shared<Texture3D>(
+            dimensions, texture_->getFormat(), texture_->getInternalFormat(),
+            texture_->getDataType(), texture_->getFiltering(), texture_->getSwizzleMask(),
+            texture_->getWrapping());
+        texture_->initialize(nullptr);
+        return;
+    }
+    texture_->uploadAndResize(nullptr, dimensions);
+}
 
 const size3_t& VolumeGL::getDimensions() const { return texture_->getDimensions(); }
 
@@ -116,6 +133,18 @@ Wrapping3D VolumeGL::getWrapping() const {
     return utilgl::convertWrappingFromGL(texture_->getWrapping());
 }
 
+void VolumeGL::setFloatPrecision(FloatVolumePrecision precision, dvec2 range) {
+    precision_ = precision;
+    normalizedRange_ = range;
+}
+
+std::optional<dvec2> VolumeGL::getNormalizedRange() const {
+    if (precision_ == FloatVolumePrecision::UNorm16 || precision_ == FloatVolumePrecision::UNorm8) {
+        return normalizedRange_;
+    }
+    return std::nullopt;
+}
+
 void VolumeGL::updateResource(const ResourceMeta& meta) const {
     if (texture_) {
         resource::meta(resource::GL{texture_->getID()}, meta);
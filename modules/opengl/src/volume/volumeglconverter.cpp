@@ -29,19 +29,165 @@
 
 #include <modules/opengl/volume/volumeglconverter.h>
 
+#include <inviwo/core/datastructures/volume/volume.h>     // for Volume
 #include <inviwo/core/datastructures/volume/volumeram.h>  // for VolumeRAM (ptr only), createVol...
+#include <inviwo/core/util/exception.h>                   // for Exception
 #include <inviwo/core/util/formats.h>                     // for DataFormatBase
 #include <inviwo/core/util/logcentral.h>                  // for LogCentral
+#include <inviwo/core/util/parallel.h>                    // for parallelFor
 #include <modules/opengl/volume/volumegl.h>               // for VolumeGL
 #include <modules/opengl/texture/texture3d.h>             // IWYU pragma: keep
+#include <modules/opengl/texture/texturecompression.h>    // for compressTexture, selectCompr...
 
+#include <algorithm>    // for clamp
+#include <array>        // for array
+#include <cstddef>      // for byte
+#include <cstdint>      // for uint8_t, uint16_t
+#include <limits>       // for numeric_limits
+#include <optional>     // for optional
 #include <ostream>      // for operator<<, char_traits
+#include <span>         // for span
 #include <type_traits>  // for remove_extent_t
+#include <vector>       // for vector
+
+#include <glm/gtc/packing.hpp>         // for packHalf1x16
+#include <glm/gtx/component_wise.hpp>  // for compMul
 
 namespace inviwo {
 
+namespace {
+
+constexpr size_t conversionGrainSize = size_t{1} << 16;
+
+bool isFloat32(const DataFormatBase* format) {
+    return format->getNumericType() == NumericType::Float &&
+           format->getSize() == 4 * format->getComponents();
+}
+
+GLenum internalFormat(FloatVolumePrecision precision, size_t channels) {
+    static constexpr std::array<std::array<GLenum, 4>, 3> formats{{
+        {GL_R16F, GL_RG16F, GL_RGB16F, GL_RGBA16F},
+        {GL_R16, GL_RG16, GL_RGB16, GL_RGBA16},
+        {GL_R8, GL_RG8, GL_RGB8, GL_RGBA8},
+    }};
+    return formats[static_cast<size_t>(precision) - 1][channels - 1];
+}
+
+/**
+ * The range to normalize over, the data range of the volume being converted if there is one.
+ * Never taken from the owner of the representation, which is not set for shared ones.
+ */
+dvec2 normalizationRange(const Volume* volume) {
+    return volume ? volume->dataMap.dataRange : dvec2{0.0, 1.0};
+}
+
+template <typename T>
+void normalize(std::span<const float> src, std::span<T> dst, dvec2 range) {
+    const float offset = static_cast<float>(range.x);
+    const float extent = static_cast<float>(range.y - range.x);
+    const float max = static_cast<float>(std::numeric_limits<T>::max());
+    const float scale = extent != 0.0f ? max / extent : 0.0f;
+    util::parallelFor(
+        0, src.size(),
+        [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                dst[i] = static_cast<T>(std::clamp((src[i] - offset) * scale, 0.0f, max) + 0.5f);
+            }
+        },
+        {.grainSize = conversionGrainSize});
+}
+
+/**
+ * Map the normalized values downloaded from a texture with a normalized FloatVolumePrecision
+ * back to the original value range.
+ */
+void denormalize(const VolumeGL& src, VolumeRAM& dst) {
+    const auto range = src.getNormalizedRange();
+    if (!range) return;
+
+    const size_t count = glm::compMul(dst.getDimensions()) * dst.getDataFormat()->getComponents();
+    const std::span<float> values{static_cast<float*>(dst.getData()), count};
+    const auto offset = static_cast<float>(range->x);
+    const auto scale = static_cast<float>(range->y - range->x);
+    util::parallelFor(
+        0, count,
+        [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) values[i] = values[i] * scale + offset;
+        },
+        {.grainSize = conversionGrainSize});
+}
+
+struct ConvertedData {
+    std::vector<std::byte> data;
+    GLenum dataType;
+};
+
+/**
+ * Convert the 32-bit floats of @p src to the storage of @p precision, in parallel over the
+ * Inviwo thread pool.
+ */
+ConvertedData convertFloats(const VolumeRAM& src, FloatVolumePrecision precision, dvec2 range) {
+    const auto* format = src.getDataFormat();
+    const size_t count = glm::compMul(src.getDimensions()) * format->getComponents();
+    const std::span<const float> values{static_cast<const float*>(src.getData()), count};
+
+    switch (precision) {
+        case FloatVolumePrecision::Float16: {
+            ConvertedData converted{std::vector<std::byte>(count * 2), GL_HALF_FLOAT};
+            std::span<std::uint16_t> dst{reinterpret_cast<std::uint16_t*>(converted.data.data()),
+                                         count};
+            util::parallelFor(
+                0, count,
+                [&](size_t first, size_t last) {
+                    for (size_t i = first; i < last; ++i) dst[i] = glm::packHalf1x16(values[i]);
+                },
+                {.grainSize = conversionGrainSize});
+            return converted;
+        }
+        case FloatVolumePrecision::UNorm16: {
+            ConvertedData converted{std::vector<std::byte>(count * 2), GL_UNSIGNED_SHORT};
+            normalize(values,
+                      std::span{reinterpret_cast<std::uint16_t*>(converted.data.data()), count},
+                      range);
+            return converted;
+        }
+        case FloatVolumePrecision::UNorm8: {
+            ConvertedData converted{std::vector<std::byte>(count), GL_UNSIGNED_BYTE};
+            normalize(values,
+                      std::span{reinterpret_cast<std::uint8_t*>(converted.data.data()), count},
+                      range);
+            return converted;
+        }
+        case FloatVolumePrecision::Float32:
+        default:
+            throw Exception(SourceContext{}, "No conversion needed for 32-bit float volumes");
+    }
+}
+
+}  // namespace
+
 std::shared_ptr<VolumeGL> VolumeRAM2GLConverter::createFrom(
     std::shared_ptr<const VolumeRAM> src) const {
+    return create(src, nullptr);
+}
+
+std::shared_ptr<VolumeGL> VolumeRAM2GLConverter::createFrom(std::shared_ptr<const VolumeRAM> src,
+                                                            const Volume& volume) const {
+    return create(src, &volume);
+}
+
+void VolumeRAM2GLConverter::update(std::shared_ptr<const VolumeRAM> src,
+                                   std::shared_ptr<VolumeGL> dst) const {
+    upload(*src, *dst, nullptr);
+}
+
+void VolumeRAM2GLConverter::update(std::shared_ptr<const VolumeRAM> src,
+                                   std::shared_ptr<VolumeGL> dst, const Volume& volume) const {
+    upload(*src, *dst, &volume);
+}
+
+std::shared_ptr<VolumeGL> VolumeRAM2GLConverter::create(const std::shared_ptr<const VolumeRAM>& src,
+                                                        const Volume* volume) const {
     auto dst = std::make_shared<VolumeGL>(src->getDimensions(), src->getDataFormat(),
                                           src->getSwizzleMask(), src->getInterpolation(),
                                           src->getWrapping(), false);
@@ -51,18 +197,69 @@ std::shared_ptr<VolumeGL> VolumeRAM2GLConverter::createFrom(
                                  *src->getDataFormat());
     }
 
-    dst->getTexture()->initialize(src->getData());
+    auto* texture = dst->getTexture().get();
+    if (const auto precision = floatPrecision_.load();
+        precision != FloatVolumePrecision::Float32 && isFloat32(src->getDataFormat())) {
+        const auto range = normalizationRange(volume);
+        dst->setFloatPrecision(precision, range);
+        const auto converted = convertFloats(*src, precision, range);
+        texture->initialize(converted.data.data(),
+                            internalFormat(precision, src->getDataFormat()->getComponents()),
+                            converted.dataType);
+        return dst;
+    }
+
+    if (sparse_ && texture->initializeSparse(src->getData())) {
+        return dst;
+    }
+
+    if (compress_) {
+        const auto compression =
+            utilgl::selectCompression(texture->getInternalFormat(), GL_TEXTURE_3D);
+        if (const auto* format = utilgl::compressedFormat(compression)) {
+            const auto blocks = utilgl::compressTexture(src->getData(), src->getDimensions(),
+                                                        src->getDataFormat()->getComponents(),
+                                                        compression);
+            texture->initializeCompressed(format->internalFormat, blocks);
+            return dst;
+        }
+    }
+
+    texture->initialize(src->getData());
     return dst;
 }
 
-void VolumeRAM2GLConverter::update(std::shared_ptr<const VolumeRAM> src,
-                                   std::shared_ptr<VolumeGL> dst) const {
-    dst->setDimensions(src->getDimensions());
-    dst->setSwizzleMask(src->getSwizzleMask());
-    dst->setInterpolation(src->getInterpolation());
-    dst->setWrapping(src->getWrapping());
+void VolumeRAM2GLConverter::upload(const VolumeRAM& src, VolumeGL& dst,
+                                   const Volume* volume) const {
+    const auto region = dst.getDimensions() == src.getDimensions()
+                            ? src.getModifiedRegion(dst.getGeneration())
+                            : std::nullopt;
 
-    dst->getTexture()->upload(src->getData());
+    dst.setDimensions(src.getDimensions());
+    dst.setSwizzleMask(src.getSwizzleMask());
+    dst.setInterpolation(src.getInterpolation());
+    dst.setWrapping(src.getWrapping());
+
+    auto* texture = dst.getTexture().get();
+    if (const auto precision = dst.getFloatPrecision();
+        precision != FloatVolumePrecision::Float32) {
+        // Converted textures are always replaced as a whole, with the current data range
+        const auto range = normalizationRange(volume);
+        dst.setFloatPrecision(precision, range);
+        const auto converted = convertFloats(src, precision, range);
+        texture->upload(converted.data.data(), converted.dataType);
+    } else if (texture->isSparse()) {
+        texture->uploadSparse(src.getData());
+    } else if (const auto* format = utilgl::compressedFormat(texture->getInternalFormat())) {
+        // Compressed textures are always replaced as a whole
+        texture->uploadCompressed(utilgl::compressTexture(src.getData(), src.getDimensions(),
+                                                          src.getDataFormat()->getComponents(),
+                                                          format->compression));
+    } else if (region) {
+        dst.getTexture()->upload(src.getData(), region->offset, region->extent);
+    } else {
+        dst.getTexture()->upload(src.getData());
+    }
 }
 
 std::shared_ptr<VolumeRAM> VolumeGL2RAMConverter::createFrom(
@@ -76,6 +273,7 @@ std::shared_ptr<VolumeRAM> VolumeGL2RAMConverter::createFrom(
     }
 
     src->getTexture()->download(dst->getData());
+    denormalize(*src, *dst);
     return dst;
 }
 
@@ -87,6 +285,7 @@ void VolumeGL2RAMConverter::update(std::shared_ptr<const VolumeGL> src,
     dst->setWrapping(src->getWrapping());
 
     src->getTexture()->download(dst->getData());
+    denormalize(*src, *dst);
 }
 
 }  // namespace inviwo
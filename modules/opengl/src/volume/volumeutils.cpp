@@ -42,6 +42,7 @@
 #include <modules/opengl/shader/shaderutils.h>
 #include <modules/opengl/texture/textureunit.h>   // for TextureUnit, TextureUnitCo...
 #include <modules/opengl/texture/textureutils.h>  // for VolumeInport, bindTexture
+#include <modules/opengl/volume/volumegl.h>       // for VolumeGL
 
 #include <memory>   // for shared_ptr
 #include <string>   // for string
@@ -100,6 +101,16 @@ void setShaderUniforms(Shader& shader, const Volume& volume, std::string_view sa
 
     shader.setUniform(buff.replace("{}.worldSpaceGradientSpacing", samplerID), gradientSpacing);
 
+    // Floating point data stored normalized in the texture is sampled in [0, 1]. Express the
+    // data range in the normalized values instead, which gives the same result in the shader.
+    if (volume.hasRepresentation<VolumeGL>()) {
+        if (const auto range = volume.getRepresentation<VolumeGL>()->getNormalizedRange()) {
+            DataMapper dataMap{volume.dataMap};
+            dataMap.dataRange = (dataMap.dataRange - range->x) / (range->y - range->x);
+            setShaderUniforms(shader, dataMap, DataFloat32::get(), samplerID);
+            return;
+        }
+    }
     setShaderUniforms(shader, volume.dataMap, volume.getDataFormat(), samplerID);
 }
 
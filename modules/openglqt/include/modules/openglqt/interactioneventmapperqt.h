@@ -32,10 +32,14 @@
 
 #include <inviwo/core/interaction/events/touchevent.h>  // for TouchPoint
 #include <inviwo/core/interaction/events/interactionevent.h>
+#include <inviwo/core/interaction/events/keyboardkeys.h>  // for KeyModifiers
+#include <inviwo/core/interaction/events/mousebuttons.h>  // for MouseButtons
 #include <inviwo/core/interaction/contextmenuaction.h>
 #include <inviwo/core/util/glmvec.h>  // for size2_t, dvec2, vec2
 
+#include <chrono>      // for steady_clock
 #include <functional>  // for function
+#include <optional>    // for optional
 #include <string>      // for string
 #include <vector>      // for vector
 
@@ -49,6 +53,7 @@ class QKeyEvent;
 class QMouseEvent;
 class QPanGesture;
 class QPinchGesture;
+class QTimer;
 class QTouchEvent;
 class QWheelEvent;
 
@@ -74,7 +79,31 @@ public:
     void handleTouch(bool on);
     void handleGestures(bool on);
 
+    /**
+     * Merge consecutive mouse move events, and accumulate consecutive wheel events, and propagate
+     * them at most once per display refresh. High frequency mice otherwise trigger several
+     * network evaluations per displayed frame. Any other event propagates the pending event
+     * first, to keep the order of events. Enabled by default.
+     */
+    void coalesceEvents(bool on);
+
 private:
+    struct PendingMove {
+        dvec2 pos;
+        MouseButtons buttons;
+        KeyModifiers modifiers;
+    };
+    struct PendingWheel {
+        dvec2 delta;
+        dvec2 pos;
+        MouseButtons buttons;
+        KeyModifiers modifiers;
+    };
+    void propagateMove(const PendingMove& move);
+    void propagateWheel(const PendingWheel& wheel);
+    void propagatePending();
+    void schedulePending();
+
     bool mapMousePressEvent(QMouseEvent* e);
     bool mapMouseDoubleClickEvent(QMouseEvent* e);
     bool mapMouseReleaseEvent(QMouseEvent* e);
@@ -111,6 +140,12 @@ private:
 
     bool handleTouch_{true};
     bool handleGestures_{true};
+
+    bool coalesce_{true};
+    std::optional<PendingMove> pendingMove_;
+    std::optional<PendingWheel> pendingWheel_;
+    QTimer* timer_;
+    std::chrono::steady_clock::time_point lastPropagation_{};
 };
 
 }  // namespace inviwo
@@ -46,6 +46,7 @@
 #include <QVariant>     // for QVariant
 #include <QMainWindow>  // for QWidget
 
+class QEvent;
 class QHideEvent;
 class QMenu;
 class QMoveEvent;
@@ -97,6 +98,7 @@ protected:
     virtual void showEvent(QShowEvent*) override;
     virtual void hideEvent(QHideEvent*) override;
     virtual void moveEvent(QMoveEvent*) override;
+    virtual void changeEvent(QEvent*) override;
 
 private:
     using Super = QMainWindow;
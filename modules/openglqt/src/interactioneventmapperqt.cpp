@@ -48,13 +48,14 @@
 #include <modules/qtwidgets/inviwoqtutils.h>                       // for fromQString, toGLM
 #include <modules/qtwidgets/mousecursorutils.h>                    // for toCursorShape
 
-#include <algorithm>  // for sort
+#include <algorithm>  // for sort, max
 #include <map>        // for map, __map_iterator
-#include <utility>    // for pair
+#include <utility>    // for pair, exchange
 
 #include <QEvent>           // for QEvent, QEvent::Gesture
 #include <QEventPoint>      // for QEventPoint, QEventPoi...
 #include <QGestureEvent>    // for QGestureEvent
+#include <QGuiApplication>  // for QGuiApplication
 #include <QHelpEvent>       // for QHelpEvent
 #include <QInputDevice>     // for QInputDevice, QInputDe...
 #include <QKeyEvent>        // for QKeyEvent
@@ -65,9 +66,12 @@
 #include <QPoint>           // for QPoint, operator/
 #include <QPointF>          // for QPointF
 #include <QPointingDevice>  // for QPointingDevice
+#include <QScreen>          // for QScreen
+#include <QTimer>           // for QTimer
 #include <QToolTip>         // for QToolTip
 #include <QTouchEvent>      // for QTouchEvent
 #include <QWheelEvent>      // for QWheelEvent
+#include <QWidget>          // for QWidget
 #include <QtGlobal>         // for QT_VERSION, QT_VERSION...
 #include <flags/flags.h>    // for flags
 #include <glm/common.hpp>   // for abs
@@ -127,6 +131,26 @@ const TouchDevice* mapTouchDevice(QTouchEvent* touch) {
     }
 }
 
+/**
+ * Events that have to be propagated after any pending coalesced mouse move or wheel event
+ */
+bool flushesPending(QEvent::Type type) {
+    switch (type) {
+        case QEvent::KeyPress:
+        case QEvent::KeyRelease:
+        case QEvent::MouseButtonPress:
+        case QEvent::MouseButtonDblClick:
+        case QEvent::MouseButtonRelease:
+        case QEvent::TouchBegin:
+        case QEvent::TouchEnd:
+        case QEvent::TouchUpdate:
+        case QEvent::Gesture:
+            return true;
+        default:
+            return false;
+    }
+}
+
 }  // namespace
 
 InteractionEventMapperQt::InteractionEventMapperQt(
@@ -139,9 +163,17 @@ InteractionEventMapperQt::InteractionEventMapperQt(
     , imageDimensions_{imageDimensions}
     , depth_{std::move(depth)}
     , contextMenu_{std::move(contextMenu)}
-    , cursorChange_{std::move(cursorChange)} {}
+    , cursorChange_{std::move(cursorChange)}
+    , timer_{new QTimer(this)} {
+
+    timer_->setSingleShot(true);
+    timer_->setTimerType(Qt::PreciseTimer);
+    connect(timer_, &QTimer::timeout, this, [this]() { propagatePending(); });
+}
 
 bool InteractionEventMapperQt::eventFilter(QObject*, QEvent* e) {
+    if (flushesPending(e->type())) propagatePending();
+
     switch (e->type()) {
         case QEvent::KeyPress:
             return mapKeyPressEvent(static_cast<QKeyEvent*>(e));
@@ -229,22 +261,37 @@ bool InteractionEventMapperQt::mapMouseReleaseEvent(QMouseEvent* e) {
 
 bool InteractionEventMapperQt::mapMouseMoveEvent(QMouseEvent* e) {
     if (e->source() != Qt::MouseEventNotSynthesized) return true;
-    RenderContext::getPtr()->activateDefaultRenderContext();
-    const auto pos = normalizePosition(e, canvasDimensions_());
-
-    MouseEvent mouseEvent(MouseButton::None, MouseState::Move, utilqt::getMouseButtons(e),
-                          utilqt::getModifiers(e), pos, imageDimensions_(), depth_(pos));
-    addCallbacksTo(&mouseEvent);
     e->accept();
-    propagator_->propagateEvent(&mouseEvent, nullptr);
     if (e->button() == Qt::RightButton) blockContextMenu_ = true;
 
+    const PendingMove move{.pos = normalizePosition(e, canvasDimensions_()),
+                           .buttons = utilqt::getMouseButtons(e),
+                           .modifiers = utilqt::getModifiers(e)};
+    if (!coalesce_) {
+        propagateMove(move);
+        return true;
+    }
+
+    if (pendingWheel_ ||
+        (pendingMove_ &&
+         (pendingMove_->buttons != move.buttons || pendingMove_->modifiers != move.modifiers))) {
+        propagatePending();
+    }
+    pendingMove_ = move;
+    schedulePending();
     return true;
 }
 
+void InteractionEventMapperQt::propagateMove(const PendingMove& move) {
+    RenderContext::getPtr()->activateDefaultRenderContext();
+    MouseEvent mouseEvent(MouseButton::None, MouseState::Move, move.buttons, move.modifiers,
+                          move.pos, imageDimensions_(), depth_(move.pos));
+    addCallbacksTo(&mouseEvent);
+    propagator_->propagateEvent(&mouseEvent, nullptr);
+}
+
 bool InteractionEventMapperQt::mapWheelEvent(QWheelEvent* e) {
     if (e->source() != Qt::MouseEventNotSynthesized) return true;
-    RenderContext::getPtr()->activateDefaultRenderContext();
     QPoint numPixels = e->pixelDelta();
     QPoint numDegrees = e->angleDelta() / 8 / 15;
 
@@ -255,15 +302,64 @@ bool InteractionEventMapperQt::mapWheelEvent(QWheelEvent* e) {
         numSteps = utilqt::toGLM(numDegrees);
     }
 
-    const auto pos = normalizePosition(e->position(), canvasDimensions_());
+    const PendingWheel wheel{.delta = numSteps,
+                             .pos = normalizePosition(e->position(), canvasDimensions_()),
+                             .buttons = utilqt::getMouseWheelButtons(e),
+                             .modifiers = utilqt::getModifiers(e)};
+    e->accept();
+    if (!coalesce_) {
+        propagateWheel(wheel);
+        return true;
+    }
 
-    WheelEvent wheelEvent(utilqt::getMouseWheelButtons(e), utilqt::getModifiers(e), numSteps, pos,
-                          imageDimensions_(), depth_(pos));
+    if (pendingMove_ || (pendingWheel_ && (pendingWheel_->buttons != wheel.buttons ||
+                                           pendingWheel_->modifiers != wheel.modifiers))) {
+        propagatePending();
+    }
+    if (pendingWheel_) {
+        pendingWheel_->delta += wheel.delta;
+        pendingWheel_->pos = wheel.pos;
+    } else {
+        pendingWheel_ = wheel;
+    }
+    schedulePending();
+    return true;
+}
+
+void InteractionEventMapperQt::propagateWheel(const PendingWheel& wheel) {
+    RenderContext::getPtr()->activateDefaultRenderContext();
+    WheelEvent wheelEvent(wheel.buttons, wheel.modifiers, wheel.delta, wheel.pos,
+                          imageDimensions_(), depth_(wheel.pos));
     addCallbacksTo(&wheelEvent);
-    e->accept();
     propagator_->propagateEvent(&wheelEvent, nullptr);
+}
 
-    return true;
+void InteractionEventMapperQt::propagatePending() {
+    timer_->stop();
+    if (!pendingMove_ && !pendingWheel_) return;
+
+    lastPropagation_ = std::chrono::steady_clock::now();
+    if (auto move = std::exchange(pendingMove_, std::nullopt)) {
+        propagateMove(*move);
+    }
+    if (auto wheel = std::exchange(pendingWheel_, std::nullopt)) {
+        propagateWheel(*wheel);
+    }
+}
+
+void InteractionEventMapperQt::schedulePending() {
+    if (timer_->isActive()) return;
+
+    // Propagate at most once per display refresh, any events arriving in between are merged.
+    auto* widget = qobject_cast<QWidget*>(parent());
+    auto* screen = widget && widget->screen() ? widget->screen() : QGuiApplication::primaryScreen();
+    const auto refreshRate = screen && screen->refreshRate() > 0.0 ? screen->refreshRate() : 60.0;
+    const auto interval = std::chrono::duration<double>{1.0 / refreshRate};
+
+    const auto elapsed = std::chrono::steady_clock::now() - lastPropagation_;
+    const auto remaining =
+        std::chrono::duration_cast<std::chrono::milliseconds>(interval - elapsed);
+    timer_->start(std::max(remaining, std::chrono::milliseconds{0}));
 }
 
 bool InteractionEventMapperQt::mapKeyPressEvent(QKeyEvent* keyEvent) {
@@ -444,5 +540,9 @@ bool InteractionEventMapperQt::showToolTip(QHelpEvent* e) {
 
 void InteractionEventMapperQt::handleTouch(bool on) { handleTouch_ = on; }
 void InteractionEventMapperQt::handleGestures(bool on) { handleGestures_ = on; }
+void InteractionEventMapperQt::coalesceEvents(bool on) {
+    coalesce_ = on;
+    if (!coalesce_) propagatePending();
+}
 
 }  // namespace inviwo
@@ -46,21 +46,22 @@
 #include <string_view>  // for string_view
 
 #include <QAction>                            // for QAction
+#include <QEvent>                             // for QEvent, QEvent::WindowStateChange
 #include <QGridLayout>                        // for QGridLayout
+#include <QHideEvent>                         // for QHideEvent
 #include <QIcon>                              // for QIcon
 #include <QMainWindow>                        // for QMainWindow
 #include <QMenu>                              // for QMenu
 #include <QMoveEvent>                         // for QMoveEvent
+#include <QShowEvent>                         // for QShowEvent
 #include <QPoint>                             // for QPoint
 #include <Qt>                                 // for NoFocus, Tool, WA_MacAlwaysSho...
 #include <glm/fwd.hpp>                        // for vec2
 #include <glm/gtx/scalar_multiplication.hpp>  // for operator/, operator*
 #include <glm/vec2.hpp>                       // for operator!=, vec<>::(anonymous)
 
-class QHideEvent;
 class QMoveEvent;
 class QResizeEvent;
-class QShowEvent;
 
 namespace inviwo {
 
@@ -220,16 +221,30 @@ bool CanvasProcessorWidgetQt::contextMenu(QMenu& menu, ContextMenuCategories act
 
 void CanvasProcessorWidgetQt::showEvent(QShowEvent* event) {
     if (ignoreEvents_) return;
-    CanvasProcessorWidget::setVisible(true);
+    CanvasProcessorWidget::setExposed(true);
+    // Spontaneous events come from the window system, i.e. when restored after being minimized
+    if (!event->spontaneous()) CanvasProcessorWidget::setVisible(true);
     Super::showEvent(event);
 }
 
 void CanvasProcessorWidgetQt::hideEvent(QHideEvent* event) {
     if (ignoreEvents_) return;
-    CanvasProcessorWidget::setVisible(false);
+    // A spontaneous hide, i.e. minimizing the window, should not change the saved visibility
+    if (event->spontaneous()) {
+        CanvasProcessorWidget::setExposed(false);
+    } else {
+        CanvasProcessorWidget::setVisible(false);
+    }
     Super::hideEvent(event);
 }
 
+void CanvasProcessorWidgetQt::changeEvent(QEvent* event) {
+    if (event->type() == QEvent::WindowStateChange) {
+        CanvasProcessorWidget::setExposed(!isMinimized());
+    }
+    Super::changeEvent(event);
+}
+
 void CanvasProcessorWidgetQt::moveEvent(QMoveEvent* event) {
     if (ignoreEvents_) return;
     CanvasProcessorWidget::setPosition(utilqt::toGLM(event->pos()));
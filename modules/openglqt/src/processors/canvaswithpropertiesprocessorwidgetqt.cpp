@@ -50,11 +50,13 @@
 #include <QAction>                            // for QAction
 #include <QEvent>                             // for QEvent, QEvent::WindowStateChange
 #include <QFrame>                             // for QFrame, QFrame::NoFrame
+#include <QHideEvent>                         // for QHideEvent
 #include <QIcon>                              // for QIcon
 #include <QMenu>                              // for QMenu
 #include <QMoveEvent>                         // for QMoveEvent
 #include <QPoint>                             // for QPoint
 #include <QScrollArea>                        // for QScrollArea
+#include <QShowEvent>                         // for QShowEvent
 #include <QSizePolicy>                        // for QSizePolicy, QSizePolicy::Mini...
 #include <QSplitter>                          // for QSplitter
 #include <QWidget>                            // for QWidget
@@ -201,11 +203,18 @@ void CanvasWithPropertiesProcessorWidgetQt::resizeEvent(QResizeEvent* event) {
 }
 
 void CanvasWithPropertiesProcessorWidgetQt::showEvent(QShowEvent* event) {
-    CanvasProcessorWidget::setVisible(true);
+    CanvasProcessorWidget::setExposed(true);
+    // Spontaneous events come from the window system, i.e. when restored after being minimized
+    if (!event->spontaneous()) CanvasProcessorWidget::setVisible(true);
     Super::showEvent(event);
 }
 void CanvasWithPropertiesProcessorWidgetQt::hideEvent(QHideEvent* event) {
-    CanvasProcessorWidget::setVisible(false);
+    // A spontaneous hide, i.e. minimizing the window, should not change the saved visibility
+    if (event->spontaneous()) {
+        CanvasProcessorWidget::setExposed(false);
+    } else {
+        CanvasProcessorWidget::setVisible(false);
+    }
     Super::hideEvent(event);
 }
 
@@ -217,6 +226,7 @@ void CanvasWithPropertiesProcessorWidgetQt::moveEvent(QMoveEvent* event) {
 void CanvasWithPropertiesProcessorWidgetQt::changeEvent(QEvent* event) {
     if (event->type() == QEvent::WindowStateChange) {
         CanvasProcessorWidget::setFullScreen(windowState().testFlag(Qt::WindowFullScreen));
+        CanvasProcessorWidget::setExposed(!isMinimized());
     }
     Super::changeEvent(event);
 }
@@ -0,0 +1,113 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/plotting/plottingmoduledefine.h>  // for IVW_MODULE_PLOTTING_API
+
+#include <inviwo/core/util/glmvec.h>  // for dvec2, size2_t
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <vector>   // for vector
+
+namespace inviwo {
+class BufferBase;
+
+namespace plot {
+
+/**
+ * \brief Uniform grid over 2D points for fast rectangle queries.
+ *
+ * The points are bucketed into a grid with roughly \p pointsPerCell points per cell and stored
+ * in cell order. A rectangle query only visits the cells overlapping the rectangle, points in
+ * cells completely within the rectangle are reported without testing them. Points with a
+ * non-finite coordinate are never reported.
+ */
+class IVW_MODULE_PLOTTING_API PointIndex2D {
+public:
+    PointIndex2D() = default;
+    /**
+     * Build the index in parallel from the scalar buffers \p x and \p y of equal size
+     * @throw Exception if the buffers have different sizes or non-scalar formats
+     */
+    PointIndex2D(const BufferBase& x, const BufferBase& y, size_t pointsPerCell = 16);
+
+    /**
+     * Calls \p callback(index) for all points with \p min <= p <= \p max in undefined order.
+     */
+    template <typename Callback>
+    void query(dvec2 min, dvec2 max, Callback&& callback) const;
+
+    /**
+     * Returns a mask with one element per point, true for all points with \p min <= p <= \p max
+     */
+    std::vector<bool> contained(dvec2 min, dvec2 max) const;
+
+    //! Number of points, including the ones with non-finite coordinates
+    size_t size() const { return size_; }
+    size2_t getGridDimensions() const { return dims_; }
+
+private:
+    size2_t cell(dvec2 p) const;
+
+    size_t size_ = 0;
+    dvec2 origin_{0.0};
+    dvec2 invCellSize_{0.0};
+    size2_t dims_{0};
+    std::vector<std::uint32_t> cellStart_;  ///< cell i holds [cellStart_[i], cellStart_[i + 1])
+    std::vector<std::uint32_t> indices_;    ///< point indices in cell order
+    std::vector<dvec2> points_;             ///< point coordinates in cell order
+};
+
+template <typename Callback>
+void PointIndex2D::query(dvec2 min, dvec2 max, Callback&& callback) const {
+    if (indices_.empty() || !(min.x <= max.x && min.y <= max.y)) return;
+
+    const auto first = cell(min);
+    const auto last = cell(max);
+    for (size_t j = first.y; j <= last.y; ++j) {
+        for (size_t i = first.x; i <= last.x; ++i) {
+            const auto c = j * dims_.x + i;
+            // Only cells on the border of the query can contain points outside of it
+            const bool border = i == first.x || i == last.x || j == first.y || j == last.y;
+            for (auto k = cellStart_[c]; k < cellStart_[c + 1]; ++k) {
+                if (border) {
+                    const auto& p = points_[k];
+                    if (p.x < min.x || p.x > max.x || p.y < min.y || p.y > max.y) continue;
+                }
+                callback(indices_[k]);
+            }
+        }
+    }
+}
+
+}  // namespace plot
+
+}  // namespace inviwo
@@ -30,9 +30,10 @@
 
 #include <modules/plotting/plottingmoduledefine.h>  // for IVW_MODULE_PLOTTING_API
 
-#include <inviwo/core/interaction/interactionhandler.h>  // for InteractionHandler
-#include <inviwo/core/util/dispatcher.h>                 // for Dispatcher
-#include <inviwo/core/util/glmvec.h>                     // for dvec2, size2_t
+#include <inviwo/core/interaction/interactionhandler.h>    // for InteractionHandler
+#include <inviwo/core/util/dispatcher.h>                   // for Dispatcher
+#include <inviwo/core/util/glmvec.h>                       // for dvec2, size2_t
+#include <modules/plotting/datastructures/pointindex2d.h>  // for PointIndex2D
 
 #include <array>       // for array
 #include <functional>  // for function
@@ -51,6 +52,8 @@ class BoxSelectionProperty;
 /**
  * \brief Handles interaction for 2D rectangle selection/filtering
  * Selection/Filtering callbacks are called when filtering changes.
+ * The rectangle is resolved using a PointIndex2D, which is built once the first rectangle is
+ * started and kept until the axis data changes.
  *
  * The current drag rectangle is given by getDragRectangle.
  * @see DragRectangleRenderer
@@ -107,16 +110,19 @@ protected:
      * \brief React to rectangle drag changes. Input is in data-space of each axis.
      */
     void dragRectChanged(const dvec2& start, const dvec2& end, bool append);
-    std::vector<bool> boxSelect(const dvec2& start, const dvec2& end, const BufferBase* xAxis_,
-                                const BufferBase* yAxis_);
-    std::vector<bool> boxFilter(const dvec2& start, const dvec2& end, const BufferBase* xAxis_,
-                                const BufferBase* yAxis_);
+    std::vector<bool> boxSelect(const dvec2& start, const dvec2& end);
+    std::vector<bool> boxFilter(const dvec2& start, const dvec2& end);
+    /**
+     * \brief Returns the spatial index of the current axis data, null if there is no data
+     */
+    const PointIndex2D* getPointIndex();
 
     Dispatcher<SelectionFunc> selectionChangedCallback_;
     Dispatcher<SelectionFunc> filteringChangedCallback_;
     const BoxSelectionProperty& dragRectSettings_;  ///! Selection/filtering
     std::shared_ptr<const BufferBase> xAxis_;
     std::shared_ptr<const BufferBase> yAxis_;
+    std::optional<PointIndex2D> pointIndex_;
 
     std::function<dvec2(dvec2 p, const size2_t& dims)> screenToData_;
     std::optional<std::array<dvec2, 2>> dragRect_;
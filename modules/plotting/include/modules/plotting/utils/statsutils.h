@@ -41,6 +41,7 @@
 #include <cstddef>      // for size_t
 #include <iosfwd>       // for ostream
 #include <iterator>     // for distance
+#include <limits>       // for numeric_limits
 #include <stdexcept>    // for invalid_argument
 #include <string>       // for string
 #include <string_view>  // for string_view
@@ -64,6 +65,103 @@ IVW_MODULE_PLOTTING_API RegresionResult linearRegresion(const BufferBase& X, con
 
 IVW_MODULE_PLOTTING_API std::ostream& operator<<(std::ostream& os, RegresionResult res);
 
+/**
+ * \brief Single pass accumulator for count, mean, variance, min, and max.
+ *
+ * Uses Welford's algorithm which, unlike summing values and squares, does not loose precision
+ * when the variance is small compared to the mean. Two accumulators can be merged, which is used
+ * to evaluate chunks of a buffer in parallel. NaNs are ignored.
+ */
+struct IVW_MODULE_PLOTTING_API SummaryStats {
+    void add(double x);
+    void merge(const SummaryStats& other);
+
+    //! population variance, i.e. m2 / count
+    double variance() const;
+    //! unbiased sample variance, i.e. m2 / (count - 1)
+    double sampleVariance() const;
+    double standardDeviation() const;
+
+    size_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;  ///< sum of squared differences from the mean
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+};
+
+/**
+ * \brief Single pass accumulator for the means, variances, and covariance of pairs of values.
+ *
+ * The bivariate version of SummaryStats. Pairs where any value is NaN are ignored.
+ */
+struct IVW_MODULE_PLOTTING_API BivariateStats {
+    void add(double x, double y);
+    void merge(const BivariateStats& other);
+
+    double covariance() const;
+    //! Pearson correlation coefficient
+    double correlation() const;
+    //! least squares fit of y = kx + m
+    RegresionResult regression() const;
+
+    size_t count = 0;
+    double meanX = 0.0;
+    double meanY = 0.0;
+    double m2X = 0.0;  ///< sum of squared differences from meanX
+    double m2Y = 0.0;  ///< sum of squared differences from meanY
+    double cXY = 0.0;  ///< sum of products of the differences from the means
+};
+
+/**
+ * \brief Statistics of the elements [\p begin, \p end) of a scalar buffer of any type.
+ * The buffer is evaluated in parallel without converting it, and with a fixed chunk size so the
+ * result does not depend on the number of threads.
+ * @throw Exception if the buffer is not scalar
+ */
+IVW_MODULE_PLOTTING_API SummaryStats summaryStats(
+    const BufferBase& buffer, size_t begin = 0,
+    size_t end = std::numeric_limits<size_t>::max());
+
+/**
+ * \brief Statistics of the pairs [\p begin, \p end) of two scalar buffers of any types.
+ * @throw Exception if the buffers are not scalar or of different sizes
+ * @see summaryStats
+ */
+IVW_MODULE_PLOTTING_API BivariateStats bivariateStats(
+    const BufferBase& X, const BufferBase& Y, size_t begin = 0,
+    size_t end = std::numeric_limits<size_t>::max());
+
+/**
+ * \brief Keeps SummaryStats of a growing buffer up to date.
+ * Each call to update only processes the elements added since the previous call. If the
+ * buffer got smaller the statistics are recomputed.
+ */
+class IVW_MODULE_PLOTTING_API StreamingSummaryStats {
+public:
+    const SummaryStats& update(const BufferBase& buffer);
+    const SummaryStats& get() const { return stats_; }
+    void reset();
+
+private:
+    SummaryStats stats_;
+    size_t processed_ = 0;
+};
+
+/**
+ * \brief Keeps BivariateStats, and hence a linear regression, of two growing buffers up to date.
+ * @see StreamingSummaryStats
+ */
+class IVW_MODULE_PLOTTING_API StreamingBivariateStats {
+public:
+    const BivariateStats& update(const BufferBase& X, const BufferBase& Y);
+    const BivariateStats& get() const { return stats_; }
+    void reset();
+
+private:
+    BivariateStats stats_;
+    size_t processed_ = 0;
+};
+
 /**
  * \brief Compute value below a percentage of observations in the data.
  * Uses the nearest rank method, i.e. ceil(percentile * N), where N = number of elements in data.
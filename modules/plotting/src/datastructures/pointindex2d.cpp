@@ -0,0 +1,162 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/plotting/datastructures/pointindex2d.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>     // for BufferBase
+#include <inviwo/core/datastructures/buffer/bufferram.h>  // for BufferRAM
+#include <inviwo/core/util/exception.h>                   // for Exception
+#include <inviwo/core/util/formatdispatching.h>           // for Scalars
+#include <inviwo/core/util/glmvec.h>                      // for dvec2, size2_t
+#include <inviwo/core/util/parallel.h>                    // for parallelFor, parallelReduce
+#include <inviwo/core/util/sourcecontext.h>               // for SourceContext
+
+#include <algorithm>  // for clamp, max, min
+#include <atomic>     // for atomic
+#include <cmath>      // for ceil, floor, isfinite, sqrt
+#include <limits>     // for numeric_limits
+#include <utility>    // for pair
+
+#include <glm/common.hpp>              // for min, max
+#include <glm/gtx/component_wise.hpp>  // for compMul
+
+namespace inviwo {
+
+namespace plot {
+
+namespace {
+
+std::vector<double> toDouble(const BufferBase& buffer) {
+    return buffer.getRepresentation<BufferRAM>()
+        ->dispatch<std::vector<double>, dispatching::filter::Scalars>([](auto typedBuf) {
+            const auto& data = typedBuf->getDataContainer();
+            std::vector<double> result(data.size());
+            util::parallelFor(0, data.size(),
+                              [&](size_t i) { result[i] = static_cast<double>(data[i]); });
+            return result;
+        });
+}
+
+constexpr std::uint32_t invalidCell = std::numeric_limits<std::uint32_t>::max();
+constexpr size_t maxCellsPerDim = 2048;
+
+}  // namespace
+
+PointIndex2D::PointIndex2D(const BufferBase& x, const BufferBase& y, size_t pointsPerCell)
+    : size_{x.getSize()} {
+    if (x.getSize() != y.getSize()) {
+        throw Exception(SourceContext{}, "Buffer sizes do not match ({} != {})", x.getSize(),
+                        y.getSize());
+    }
+    if (size_ == 0) return;
+
+    const auto xs = toDouble(x);
+    const auto ys = toDouble(y);
+
+    using Bounds = std::pair<dvec2, dvec2>;
+    const Bounds init{dvec2{std::numeric_limits<double>::max()},
+                      dvec2{std::numeric_limits<double>::lowest()}};
+    const auto [lower, upper] = util::parallelReduce(
+        0, size_, init,
+        [&](size_t first, size_t last) {
+            auto bounds = init;
+            for (size_t i = first; i < last; ++i) {
+                if (!std::isfinite(xs[i]) || !std::isfinite(ys[i])) continue;
+                const dvec2 p{xs[i], ys[i]};
+                bounds.first = glm::min(bounds.first, p);
+                bounds.second = glm::max(bounds.second, p);
+            }
+            return bounds;
+        },
+        [](const Bounds& a, const Bounds& b) {
+            return Bounds{glm::min(a.first, b.first), glm::max(a.second, b.second)};
+        });
+    if (lower.x > upper.x) return;  // no finite points
+
+    // Square grid in the normalized domain with about pointsPerCell points per cell
+    const auto cellsPerDim = static_cast<size_t>(
+        std::ceil(std::sqrt(static_cast<double>(size_) / std::max<size_t>(pointsPerCell, 1))));
+    dims_ = size2_t{std::clamp<size_t>(cellsPerDim, 1, maxCellsPerDim)};
+    origin_ = lower;
+    const dvec2 extent = glm::max(upper - lower, dvec2{std::numeric_limits<double>::min()});
+    invCellSize_ = dvec2{dims_} / extent;
+
+    const auto nCells = glm::compMul(dims_);
+    std::vector<std::uint32_t> cells(size_);
+    std::vector<std::atomic<std::uint32_t>> counts(nCells);
+    util::parallelFor(0, size_, [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            if (!std::isfinite(xs[i]) || !std::isfinite(ys[i])) {
+                cells[i] = invalidCell;
+                continue;
+            }
+            const auto c = cell(dvec2{xs[i], ys[i]});
+            cells[i] = static_cast<std::uint32_t>(c.y * dims_.x + c.x);
+            counts[cells[i]].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    cellStart_.resize(nCells + 1);
+    cellStart_[0] = 0;
+    for (size_t c = 0; c < nCells; ++c) {
+        cellStart_[c + 1] = cellStart_[c] + counts[c].load(std::memory_order_relaxed);
+    }
+
+    // Reuse the counts as insertion offsets, the order within a cell is arbitrary
+    for (size_t c = 0; c < nCells; ++c) {
+        counts[c].store(cellStart_[c], std::memory_order_relaxed);
+    }
+    const auto nPoints = cellStart_.back();
+    indices_.resize(nPoints);
+    points_.resize(nPoints);
+    util::parallelFor(0, size_, [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            if (cells[i] == invalidCell) continue;
+            const auto k = counts[cells[i]].fetch_add(1, std::memory_order_relaxed);
+            indices_[k] = static_cast<std::uint32_t>(i);
+            points_[k] = dvec2{xs[i], ys[i]};
+        }
+    });
+}
+
+std::vector<bool> PointIndex2D::contained(dvec2 min, dvec2 max) const {
+    std::vector<bool> result(size_, false);
+    query(min, max, [&](std::uint32_t i) { result[i] = true; });
+    return result;
+}
+
+size2_t PointIndex2D::cell(dvec2 p) const {
+    const dvec2 c = glm::clamp(glm::floor((p - origin_) * invCellSize_), dvec2{0.0},
+                               dvec2{dims_ - size2_t{1}});
+    return size2_t{c};
+}
+
+}  // namespace plot
+
+}  // namespace inviwo
@@ -39,14 +39,11 @@
 #include <inviwo/core/interaction/events/mouseevent.h>                  // for MouseEvent
 #include <inviwo/core/interaction/interactionhandler.h>                 // for InteractionHandler
 #include <inviwo/core/util/dispatcher.h>                                // for Dispatcher
-#include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
 #include <inviwo/core/util/glmvec.h>                                    // for dvec2, size2_t
-#include <inviwo/core/util/zip.h>                                       // for zipper, enumerate
 #include <modules/plotting/datastructures/boxselectionsettings.h>       // for BoxSelectionSetti...
+#include <modules/plotting/datastructures/pointindex2d.h>               // for PointIndex2D
 #include <modules/plotting/properties/boxselectionproperty.h>           // for BoxSelectionProperty
 
-#include <cmath>          // for ceil, floor
-#include <limits>         // for numeric_limits
 #include <tuple>          // for tuple_element<>::...
 #include <type_traits>    // for remove_extent_t
 #include <unordered_set>  // for unordered_set
@@ -76,6 +73,10 @@ void BoxSelectionInteractionHandler::invokeEvent(Event* event) {
         auto append = me->modifiers().contains(KeyModifier::Control);
         if ((me->button() == MouseButton::Left) && (me->state() == MouseState::Press)) {
             dragRect_ = {dvec2{me->pos().x, me->pos().y}, dvec2{me->pos().x, me->pos().y}};
+            if (dragRectSettings_.getMode() != BoxSelectionSettingsInterface::Mode::None) {
+                // Build the index up front rather than on the first drag event
+                getPointIndex();
+            }
             me->setUsed(true);
         } else if ((me->button() == MouseButton::Left) && (me->state() == MouseState::Release)) {
             if (dragRect_ && glm::compMax(glm::abs(me->pos() - (*dragRect_)[0])) <= 1) {
@@ -125,10 +126,12 @@ auto BoxSelectionInteractionHandler::addFilteringChangedCallback(
 }
 
 void BoxSelectionInteractionHandler::setXAxisData(std::shared_ptr<const BufferBase> buffer) {
+    if (buffer != xAxis_) pointIndex_.reset();
     xAxis_ = buffer;
 }
 
 void BoxSelectionInteractionHandler::setYAxisData(std::shared_ptr<const BufferBase> buffer) {
+    if (buffer != yAxis_) pointIndex_.reset();
     yAxis_ = buffer;
 }
 
@@ -139,130 +142,38 @@ void BoxSelectionInteractionHandler::dragRectChanged(const dvec2& start, const d
     switch (dragRectSettings_.getMode()) {
         case BoxSelectionSettingsInterface::Mode::Selection:
             // selection changed
-            selectionChangedCallback_.invoke(boxSelect(start, end, xAxis_.get(), yAxis_.get()),
-                                             append);
+            selectionChangedCallback_.invoke(boxSelect(start, end), append);
             break;
         case BoxSelectionSettingsInterface::Mode::Filtering:
-            filteringChangedCallback_.invoke(boxFilter(start, end, xAxis_.get(), yAxis_.get()),
-                                             append);
+            filteringChangedCallback_.invoke(boxFilter(start, end), append);
             break;
         case BoxSelectionSettingsInterface::Mode::None:
             break;
     }
 }
 
-std::vector<bool> BoxSelectionInteractionHandler::boxSelect(const dvec2& start, const dvec2& end,
-                                                            const BufferBase* xAxis,
-                                                            const BufferBase* yAxis) {
-
-    if (xAxis == nullptr || yAxis == nullptr) {
-        return std::vector<bool>();
+std::vector<bool> BoxSelectionInteractionHandler::boxSelect(const dvec2& start, const dvec2& end) {
+    if (auto index = getPointIndex()) {
+        return index->contained(start, end);
     }
-
-    // For efficiency:
-    // 1. Determine selection along x-axis
-    // 2. Determine selection along y-axis using the subset from 1
-
-    auto xbuf = xAxis->getRepresentation<BufferRAM>();
-#include <warn/push>
-#include <warn/ignore/conversion>  // Ignore double->float warnings
-    auto selectedIndicesX = xbuf->dispatch<std::vector<bool>, dispatching::filter::Scalars>(
-        [min = start[0], max = end[0]](auto brprecision) {
-            using ValueType = util::PrecisionValueType<decltype(brprecision)>;
-            std::vector<bool> selected(brprecision->getSize(), false);
-            // Avoid conversions in the loop
-
-            const auto tmin = std::numeric_limits<ValueType>::is_integer
-                                  ? static_cast<ValueType>(std::ceil(min))
-                                  : static_cast<ValueType>(min);
-            const auto tmax = std::numeric_limits<ValueType>::is_integer
-                                  ? static_cast<ValueType>(std::floor(max))
-                                  : static_cast<ValueType>(max);
-            for (auto&& [ind, elem] : util::enumerate(brprecision->getDataContainer())) {
-                if (elem < tmin || elem > tmax) {
-                    continue;
-                } else {
-                    selected[ind] = true;
-                }
-            }
-            return selected;
-        });
-    // Use indices filted by x-axis as input
-    auto ybuf = yAxis->getRepresentation<BufferRAM>();
-    auto selectedIndices = ybuf->dispatch<std::vector<bool>, dispatching::filter::Scalars>(
-        [selectedIndicesX, min = start[1], max = end[1]](auto brprecision) {
-            using ValueType = util::PrecisionValueType<decltype(brprecision)>;
-            auto data = brprecision->getDataContainer();
-            std::vector<bool> selected(brprecision->getSize(), false);
-            // Avoid conversions in the loop
-            const auto tmin = std::numeric_limits<ValueType>::is_integer
-                                  ? static_cast<ValueType>(std::ceil(min))
-                                  : static_cast<ValueType>(min);
-            const auto tmax = std::numeric_limits<ValueType>::is_integer
-                                  ? static_cast<ValueType>(std::floor(max))
-                                  : static_cast<ValueType>(max);
-
-            for (auto&& [ind, elem] : util::enumerate(selectedIndicesX)) {
-                if (elem) {
-                    if (data[ind] < tmin || data[ind] > tmax) {
-                        continue;
-                    } else {
-                        selected[ind] = true;
-                    }
-                }
-            }
-            return selected;
-        });
-#include <warn/pop>
-    return selectedIndices;
+    return std::vector<bool>();
 }
 
-std::vector<bool> BoxSelectionInteractionHandler::boxFilter(const dvec2& start, const dvec2& end,
-                                                            const BufferBase* xAxis,
-                                                            const BufferBase* yAxis) {
-    if (xAxis == nullptr || yAxis == nullptr) {
-        return std::vector<bool>();
+std::vector<bool> BoxSelectionInteractionHandler::boxFilter(const dvec2& start, const dvec2& end) {
+    if (auto index = getPointIndex()) {
+        std::vector<bool> filtered(index->size(), true);
+        index->query(start, end, [&](std::uint32_t i) { filtered[i] = false; });
+        return filtered;
     }
-    auto xbuf = xAxis->getRepresentation<BufferRAM>();
-#include <warn/push>
-#include <warn/ignore/conversion>  // Ignore double->float warnings
-    auto filteredIndices = xbuf->dispatch<std::vector<bool>, dispatching::filter::Scalars>(
-        [start, end, ybuf = yAxis->getRepresentation<BufferRAM>()](auto brprecision) {
-            using ValueTypeX = util::PrecisionValueType<decltype(brprecision)>;
-            // Avoid conversions in the loop
-            const auto tminX = std::numeric_limits<ValueTypeX>::is_integer
-                                   ? static_cast<ValueTypeX>(std::ceil(start[0]))
-                                   : static_cast<ValueTypeX>(start[0]);
-            const auto tmaxX = std::numeric_limits<ValueTypeX>::is_integer
-                                   ? static_cast<ValueTypeX>(std::floor(end[0]))
-                                   : static_cast<ValueTypeX>(end[0]);
-            auto xData = brprecision->getDataContainer();
-            return ybuf->dispatch<std::vector<bool>, dispatching::filter::Scalars>(
-                [tminX, tmaxX, start, end, xData](auto brprecision) {
-                    using ValueTypeY = util::PrecisionValueType<decltype(brprecision)>;
-                    std::vector<bool> filtered(brprecision->getSize(), false);
-                    const auto tminY = std::numeric_limits<ValueTypeY>::is_integer
-                                           ? static_cast<ValueTypeY>(std::ceil(start[1]))
-                                           : static_cast<ValueTypeY>(start[1]);
-                    const auto tmaxY = std::numeric_limits<ValueTypeY>::is_integer
-                                           ? static_cast<ValueTypeY>(std::floor(end[1]))
-                                           : static_cast<ValueTypeY>(end[1]);
-
-                    for (auto&& [ind, xVal, yVal] :
-                         util::enumerate(xData, brprecision->getDataContainer())) {
-                        if ((xVal < tminX) || (xVal > tmaxX) || (yVal < tminY) || (yVal > tmaxY)) {
-                            filtered[ind] = true;
-                        } else {
-                            continue;
-                        }
-                    }
-                    return filtered;
-                });
-        });
-
-#include <warn/pop>
+    return std::vector<bool>();
+}
 
-    return filteredIndices;
+const PointIndex2D* BoxSelectionInteractionHandler::getPointIndex() {
+    if (!xAxis_ || !yAxis_) return nullptr;
+    if (!pointIndex_) {
+        pointIndex_.emplace(*xAxis_, *yAxis_);
+    }
+    return &*pointIndex_;
 }
 
 }  // namespace plot
@@ -35,106 +35,184 @@
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/util/exception.h>                                 // for Exception
 #include <inviwo/core/util/formatdispatching.h>                         // for Scalars
-#include <inviwo/core/util/glmmat.h>                                    // for dmat2
-#include <inviwo/core/util/glmvec.h>                                    // for dvec2
+#include <inviwo/core/util/parallel.h>                                  // for parallelReduce
 #include <inviwo/core/util/sourcecontext.h>                             // for SourceContext
-#include <inviwo/core/util/zip.h>                                       // for zipper, get, zip
 
-#include <stdlib.h>       // for abs
+#include <algorithm>      // for min, max
+#include <cmath>          // for isnan, sqrt
 #include <memory>         // for unique_ptr
 #include <ostream>        // for operator<<, basic...
 #include <unordered_set>  // for unordered_set
 
-#include <glm/mat2x2.hpp>  // for mat<>::col_type
-#include <glm/matrix.hpp>  // for inverse
-#include <glm/vec2.hpp>    // for vec<>::(anonymous)
-
 namespace inviwo {
 namespace statsutil {
-namespace detail {
-template <typename Tx, typename Ty>
-RegresionResult linearRegresion(const Tx& X, const Ty& Y) {
-    RegresionResult res;
-    if (X.getSize() != Y.getSize()) {
-        throw Exception("Buffers are not of equal length");
-    }
-    auto& xvec = X.getDataContainer();
-    auto& yvec = Y.getDataContainer();
-
-    // Ax = b;
-    // Minimize the sum of squares of individual errors
-    // http://users.metu.edu.tr/csert/me310/me310_5_regression.pdf
-    dmat2 A = dmat2(xvec.size(), 0, 0, 0);
-    dvec2 b(0);
-    double sumX = 0;
-    double sumY = 0;
-
-    // Iterate over containers in sync
-    for (auto&& i : util::zip(xvec, yvec)) {
-        auto x = get<0>(i);
-        auto y = get<1>(i);
-        if (std::isnan(static_cast<double>(x)) || std::isnan(static_cast<double>(y))) {
-            --A[0][0];
-            continue;
-        }
-        sumX += x;
-        sumY += y;
-        A[1][1] += x * x;
-        b.y += y * x;
-    }
 
-    b.x = sumY;
-    A[1][0] = A[0][1] = sumX;
-    dvec2 km = glm::inverse(A) * b;
-    res.k = km.y;
-    res.m = km.x;
-    res.r2 = 0;
-    double meanX = sumX / A[0][0];
-    double meanY = sumY / A[0][0];
-    double stdX = 0;
-    double stdY = 0;
-
-    for (auto&& i : util::zip(xvec, yvec)) {
-        if (std::isnan(static_cast<double>(get<0>(i))) ||
-            std::isnan(static_cast<double>(get<1>(i)))) {
-            continue;
-        }
-        auto x = get<0>(i) - meanX;
-        auto y = get<1>(i) - meanY;
-
-        stdX += x * x;
-        stdY += y * y;
-
-        res.r2 += x * y;
+namespace {
+
+// Fixed chunk size for reproducible results independent of the number of threads
+constexpr size_t grainSize = 1 << 16;
+
+template <typename Stats, typename Func>
+Stats accumulate(size_t begin, size_t end, Func&& func) {
+    if (begin >= end) return Stats{};
+    return util::parallelReduce(
+        begin, end, Stats{},
+        [&](size_t first, size_t last) {
+            Stats stats;
+            for (size_t i = first; i < last; ++i) func(stats, i);
+            return stats;
+        },
+        [](Stats a, const Stats& b) {
+            a.merge(b);
+            return a;
+        },
+        {.grainSize = grainSize});
+}
+
+}  // namespace
+
+void SummaryStats::add(double x) {
+    if (std::isnan(x)) return;
+    ++count;
+    const double delta = x - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (x - mean);
+    min = std::min(min, x);
+    max = std::max(max, x);
+}
+
+void SummaryStats::merge(const SummaryStats& other) {
+    if (other.count == 0) return;
+    if (count == 0) {
+        *this = other;
+        return;
     }
+    const auto n = static_cast<double>(count + other.count);
+    const double delta = other.mean - mean;
+    mean += delta * static_cast<double>(other.count) / n;
+    const double f = static_cast<double>(count) * static_cast<double>(other.count) / n;
+    m2 += other.m2 + delta * delta * f;
+    count += other.count;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+}
 
-    stdX /= A[0][0];
-    stdY /= A[0][0];
+double SummaryStats::variance() const {
+    return count > 0 ? m2 / static_cast<double>(count) : 0.0;
+}
+
+double SummaryStats::sampleVariance() const {
+    return count > 1 ? m2 / static_cast<double>(count - 1) : 0.0;
+}
 
-    stdX = std::sqrt(stdX);
-    stdY = std::sqrt(stdY);
+double SummaryStats::standardDeviation() const { return std::sqrt(variance()); }
+
+void BivariateStats::add(double x, double y) {
+    if (std::isnan(x) || std::isnan(y)) return;
+    ++count;
+    const auto n = static_cast<double>(count);
+    const double dx = x - meanX;
+    meanX += dx / n;
+    const double dy = y - meanY;
+    meanY += dy / n;
+    m2X += dx * (x - meanX);
+    m2Y += dy * (y - meanY);
+    cXY += dx * (y - meanY);
+}
+
+void BivariateStats::merge(const BivariateStats& other) {
+    if (other.count == 0) return;
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+    const auto n = static_cast<double>(count + other.count);
+    const double f = static_cast<double>(count) * static_cast<double>(other.count) / n;
+    const double dx = other.meanX - meanX;
+    const double dy = other.meanY - meanY;
+    meanX += dx * static_cast<double>(other.count) / n;
+    meanY += dy * static_cast<double>(other.count) / n;
+    m2X += other.m2X + dx * dx * f;
+    m2Y += other.m2Y + dy * dy * f;
+    cXY += other.cXY + dx * dy * f;
+    count += other.count;
+}
 
-    res.r2 /= A[0][0];
-    res.r2 /= stdX * stdY;
+double BivariateStats::covariance() const {
+    return count > 0 ? cXY / static_cast<double>(count) : 0.0;
+}
 
-    res.corr = std::abs(res.r2);
-    if (res.k < 0) res.corr = -res.corr;
-    res.r2 *= res.r2;
+double BivariateStats::correlation() const { return cXY / std::sqrt(m2X * m2Y); }
 
+RegresionResult BivariateStats::regression() const {
+    RegresionResult res;
+    res.k = cXY / m2X;
+    res.m = meanY - res.k * meanX;
+    res.corr = correlation();
+    res.r2 = res.corr * res.corr;
     return res;
 }
 
-}  // namespace detail
+SummaryStats summaryStats(const BufferBase& buffer, size_t begin, size_t end) {
+    return buffer.getRepresentation<BufferRAM>()
+        ->dispatch<SummaryStats, dispatching::filter::Scalars>([&](auto buf) {
+            const auto& data = buf->getDataContainer();
+            return accumulate<SummaryStats>(
+                begin, std::min(end, data.size()),
+                [&](SummaryStats& stats, size_t i) { stats.add(static_cast<double>(data[i])); });
+        });
+}
 
-RegresionResult linearRegresion(const BufferBase& X, const BufferBase& Y) {
+BivariateStats bivariateStats(const BufferBase& X, const BufferBase& Y, size_t begin,
+                              size_t end) {
+    if (X.getSize() != Y.getSize()) {
+        throw Exception(SourceContext{}, "Buffers are not of equal length ({} != {})",
+                        X.getSize(), Y.getSize());
+    }
     return X.getRepresentation<BufferRAM>()
-        ->dispatch<RegresionResult, dispatching::filter::Scalars>([&](auto Xbuf) {
+        ->dispatch<BivariateStats, dispatching::filter::Scalars>([&](auto xbuf) {
             return Y.getRepresentation<BufferRAM>()
-                ->dispatch<RegresionResult, dispatching::filter::Scalars>(
-                    [&](auto Ybuf) { return detail::linearRegresion(*Xbuf, *Ybuf); });
+                ->dispatch<BivariateStats, dispatching::filter::Scalars>([&](auto ybuf) {
+                    const auto& xs = xbuf->getDataContainer();
+                    const auto& ys = ybuf->getDataContainer();
+                    return accumulate<BivariateStats>(
+                        begin, std::min(end, xs.size()), [&](BivariateStats& stats, size_t i) {
+                            stats.add(static_cast<double>(xs[i]), static_cast<double>(ys[i]));
+                        });
+                });
         });
 }
 
+RegresionResult linearRegresion(const BufferBase& X, const BufferBase& Y) {
+    return bivariateStats(X, Y).regression();
+}
+
+const SummaryStats& StreamingSummaryStats::update(const BufferBase& buffer) {
+    const auto size = buffer.getSize();
+    if (size < processed_) reset();
+    stats_.merge(summaryStats(buffer, processed_, size));
+    processed_ = size;
+    return stats_;
+}
+
+void StreamingSummaryStats::reset() {
+    stats_ = SummaryStats{};
+    processed_ = 0;
+}
+
+const BivariateStats& StreamingBivariateStats::update(const BufferBase& X, const BufferBase& Y) {
+    const auto size = X.getSize();
+    if (size < processed_) reset();
+    stats_.merge(bivariateStats(X, Y, processed_, size));
+    processed_ = size;
+    return stats_;
+}
+
+void StreamingBivariateStats::reset() {
+    stats_ = BivariateStats{};
+    processed_ = 0;
+}
+
 std::ostream& operator<<(std::ostream& os, RegresionResult res) {
     os << "y = " << res.k << "x + " << res.m << "(r2: " << res.r2 << ", corr: " << res.corr;
 
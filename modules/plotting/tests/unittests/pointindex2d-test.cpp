@@ -0,0 +1,88 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <modules/plotting/datastructures/pointindex2d.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+namespace inviwo {
+
+TEST(PointIndex2DTest, MatchesLinearSearch) {
+    std::mt19937 gen(42);
+    std::normal_distribution<float> dist(0.0f, 10.0f);
+    std::uniform_int_distribution<int> intDist(-50, 50);
+
+    Buffer<float> x;
+    Buffer<int> y;
+    auto& vecX = x.getEditableRAMRepresentation()->getDataContainer();
+    auto& vecY = y.getEditableRAMRepresentation()->getDataContainer();
+    for (int i = 0; i < 20000; ++i) {
+        vecX.push_back(dist(gen));
+        vecY.push_back(intDist(gen));
+    }
+    vecX[7] = std::numeric_limits<float>::quiet_NaN();
+
+    const plot::PointIndex2D index(x, y, 8);
+    ASSERT_EQ(vecX.size(), index.size());
+
+    const std::vector<std::pair<dvec2, dvec2>> boxes = {{{-5.0, -10.5}, {3.0, 20.0}},
+                                                        {{-100.0, -100.0}, {100.0, 100.0}},
+                                                        {{0.0, 0.0}, {0.0, 0.0}},
+                                                        {{25.0, 0.0}, {60.0, 49.0}},
+                                                        {{200.0, 200.0}, {300.0, 300.0}}};
+    for (const auto& [min, max] : boxes) {
+        const auto mask = index.contained(min, max);
+        ASSERT_EQ(vecX.size(), mask.size());
+        for (size_t i = 0; i < vecX.size(); ++i) {
+            const bool expected = vecX[i] >= min.x && vecX[i] <= max.x && vecY[i] >= min.y &&
+                                  vecY[i] <= max.y;
+            EXPECT_EQ(expected, mask[i]) << "point " << i;
+        }
+    }
+    EXPECT_FALSE(index.contained({-100.0, -100.0}, {100.0, 100.0})[7]);
+}
+
+TEST(PointIndex2DTest, Empty) {
+    Buffer<double> x;
+    Buffer<double> y;
+    const plot::PointIndex2D index(x, y);
+    EXPECT_EQ(size_t{0}, index.size());
+    EXPECT_TRUE(index.contained({0.0, 0.0}, {1.0, 1.0}).empty());
+}
+
+}  // namespace inviwo
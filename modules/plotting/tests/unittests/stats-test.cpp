@@ -30,6 +30,8 @@
 #include <inviwo/core/datastructures/buffer/buffer.h>
 #include <modules/plotting/utils/statsutils.h>
 
+#include <limits>
+
 #include <warn/push>
 #include <warn/ignore/all>
 #include <gtest/gtest.h>
@@ -69,4 +71,46 @@ TEST(StatsUtilsTest, init) {
     EXPECT_DOUBLE_EQ(50., percentiles[4]) << " 100 percentile";
 }
 
+TEST(StatsUtilsTest, SummaryStats) {
+    // Large offset relative to the spread, which a naive sum of squares handles poorly
+    Buffer<double> buffer;
+    auto& vec = buffer.getEditableRAMRepresentation()->getDataContainer();
+    for (auto v : {4.0, 7.0, 13.0, 16.0}) vec.push_back(1e9 + v);
+    vec.push_back(std::numeric_limits<double>::quiet_NaN());
+
+    const auto stats = statsutil::summaryStats(buffer);
+    EXPECT_EQ(size_t{4}, stats.count);
+    EXPECT_DOUBLE_EQ(1e9 + 10.0, stats.mean);
+    EXPECT_DOUBLE_EQ(22.5, stats.variance());
+    EXPECT_DOUBLE_EQ(30.0, stats.sampleVariance());
+    EXPECT_DOUBLE_EQ(1e9 + 4.0, stats.min);
+    EXPECT_DOUBLE_EQ(1e9 + 16.0, stats.max);
+}
+
+TEST(StatsUtilsTest, Streaming) {
+    Buffer<int> X;
+    Buffer<float> Y;
+    auto& vecX = X.getEditableRAMRepresentation()->getDataContainer();
+    auto& vecY = Y.getEditableRAMRepresentation()->getDataContainer();
+
+    statsutil::StreamingBivariateStats streaming;
+    for (int i = 0; i < 1000; ++i) {
+        vecX.push_back(i % 37);
+        vecY.push_back(static_cast<float>((i * 7) % 101));
+        if (i % 100 == 0) streaming.update(X, Y);
+    }
+    const auto& res = streaming.update(X, Y);
+    const auto batch = statsutil::bivariateStats(X, Y);
+
+    EXPECT_EQ(batch.count, res.count);
+    EXPECT_NEAR(batch.meanX, res.meanX, 1e-9);
+    EXPECT_NEAR(batch.meanY, res.meanY, 1e-9);
+    EXPECT_NEAR(batch.covariance(), res.covariance(), 1e-9);
+    EXPECT_NEAR(batch.correlation(), res.correlation(), 1e-12);
+
+    vecX.resize(10);
+    vecY.resize(10);
+    EXPECT_EQ(size_t{10}, streaming.update(X, Y).count);
+}
+
 }  // namespace inviwo
@@ -0,0 +1,51 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include "pcp_common.glsl"
+
+// Brushing state of each line, bit 0: filtered, bit 1: selected, bit 2: highlighted
+layout(std430, binding = 0) readonly buffer LineMasks {
+    uint lineMasks[];
+};
+
+flat out uint vMask;
+
+uniform float axisPositions[NUMBER_OF_AXIS];
+uniform bool axisFlipped[NUMBER_OF_AXIS];
+
+void main() {
+    // the vertices of a line are stored consecutively, one per axis
+    vMask = lineMasks[gl_VertexID / NUMBER_OF_AXIS];
+
+    int axisIndex = gl_VertexID % NUMBER_OF_AXIS;
+
+    float xPos = axisPositions[axisIndex];
+    float yPos = mix(in_Vertex, 1.0 - in_Vertex, axisFlipped[axisIndex]);
+    gl_Position = vec4(getPosWithSpacing(vec2(xPos, yPos)), 0.0, 1.0);
+}
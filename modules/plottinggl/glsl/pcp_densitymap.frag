@@ -0,0 +1,59 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Number of (lines, selected or highlighted lines, filtered lines) per pixel
+uniform sampler2D density;
+// The largest number of lines of any pixel
+uniform sampler2D maxDensity;
+uniform sampler2D densityTransferFunction;
+
+uniform vec4 selectColor;
+uniform vec4 filterColor;
+
+in vec3 texCoord_;
+
+void main() {
+    vec4 count = texture(density, texCoord_.xy);
+    vec4 res;
+    if (count.r > 0.0) {
+        float maxCount = max(texelFetch(maxDensity, ivec2(0), 0).r, 1.0);
+        // logarithmic mapping since the counts often span several orders of magnitude
+        float t = log(1.0 + count.r) / log(1.0 + maxCount);
+        res = texture(densityTransferFunction, vec2(t, 0.5));
+        res = mix(res, selectColor, count.g / count.r);
+    } else if (count.b > 0.0) {
+        res = filterColor;
+    } else {
+        discard;
+    }
+
+    res.rgb *= res.a;
+    PickingData = vec4(0.0);
+    FragData0 = res;
+}
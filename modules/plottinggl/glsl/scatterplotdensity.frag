@@ -0,0 +1,61 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include "utils/structs.glsl"
+#include "utils/selectioncolor.glsl"
+
+// Number of (points, selected points, highlighted points) in each bin
+uniform sampler2D density;
+uniform sampler2D densityTransferFunction;
+uniform float maxCount = 1.0;
+
+uniform SelectionColor selected = SelectionColor(vec4(0.0), 0.0, 0.0, true);
+uniform SelectionColor highlighted = SelectionColor(vec4(0.0), 0.0, 0.0, true);
+
+in vec3 texCoord_;
+
+void main(void) {
+    vec4 bin = texture(density, texCoord_.xy);
+    if (bin.r <= 0.0) {
+        discard;
+    }
+    // logarithmic mapping since the counts often span several orders of magnitude
+    float t = log(1.0 + bin.r) / log(1.0 + maxCount);
+    vec4 color = texture(densityTransferFunction, vec2(t, 0.5));
+    if (selected.visible) {
+        color = mix(color, applySelectionColor(color, selected), bin.g / bin.r);
+    }
+    if (highlighted.visible) {
+        color = mix(color, applySelectionColor(color, highlighted), bin.b / bin.r);
+    }
+
+    color.rgb *= color.a;
+    FragData0 = color;
+    PickingData = vec4(0.0);
+}
@@ -40,6 +40,7 @@
 #include <inviwo/core/properties/boolproperty.h>                          // for BoolProperty
 #include <inviwo/core/properties/compositeproperty.h>                     // for CompositeProperty
 #include <inviwo/core/properties/invalidationlevel.h>                     // for InvalidationLevel
+#include <inviwo/core/properties/optionproperty.h>                        // for OptionProperty
 #include <inviwo/core/properties/ordinalproperty.h>                       // for FloatProperty
 #include <inviwo/core/properties/propertysemantics.h>                     // for PropertySemantics
 #include <inviwo/core/properties/selectioncolorproperty.h>                // for SelectionColorP...
@@ -48,7 +49,9 @@
 #include <inviwo/core/util/dispatcher.h>                                  // for Dispatcher
 #include <inviwo/core/util/glmvec.h>                                      // for vec2, size2_t
 #include <modules/opengl/buffer/bufferobjectarray.h>                      // for BufferObjectArray
+#include <modules/opengl/buffer/framebufferobject.h>                      // for FrameBufferObject
 #include <modules/opengl/shader/shader.h>                                 // for Shader
+#include <modules/opengl/texture/texture2d.h>                             // for Texture2D
 #include <modules/opengl/texture/textureutils.h>                          // for ImageInport
 #include <modules/plotting/interaction/boxselectioninteractionhandler.h>  // for BoxSelectionInt...
 #include <modules/plotting/properties/axisproperty.h>                     // for AxisProperty
@@ -91,6 +94,12 @@ public:
     using SelectionCallbackHandle = std::shared_ptr<std::function<SelectionFunc>>;
 
     enum class SortingOrder { Ascending, Descending };
+    /**
+     * Points draws a glyph per data point. Density bins the points into a 2D histogram that is
+     * drawn with a color map, which scales to many million points. Automatic uses the density
+     * when more points than a threshold are inside of the current axis ranges.
+     */
+    enum class RenderMode { Points, Density, Automatic };
 
     class Properties : public CompositeProperty {
     public:
@@ -124,6 +133,11 @@ public:
         FloatProperty borderWidth_;
         FloatVec4Property borderColor_;
 
+        OptionProperty<RenderMode> renderMode_;
+        IntSizeTProperty densityThreshold_;  ///! Max number of visible points drawn as glyphs
+        IntProperty binSize_;                ///! Size of a density bin in pixels
+        TransferFunctionProperty densityTf_;
+
         AxisStyleProperty axisStyle_;
         AxisProperty xAxis_;
         AxisProperty yAxis_;
@@ -135,12 +149,14 @@ public:
         auto props() {
             return std::tie(radiusRange_, useCircle_, minRadius_, tf_, color_, showHighlighted_,
                             showSelected_, showFiltered_, tooltip_, boxSelectionSettings_, margins_,
-                            axisMargin_, borderWidth_, borderColor_, axisStyle_, xAxis_, yAxis_);
+                            axisMargin_, borderWidth_, borderColor_, renderMode_,
+                            densityThreshold_, binSize_, densityTf_, axisStyle_, xAxis_, yAxis_);
         }
         auto props() const {
             return std::tie(radiusRange_, useCircle_, minRadius_, tf_, color_, showHighlighted_,
                             showSelected_, showFiltered_, tooltip_, boxSelectionSettings_, margins_,
-                            axisMargin_, borderWidth_, borderColor_, axisStyle_, xAxis_, yAxis_);
+                            axisMargin_, borderWidth_, borderColor_, renderMode_,
+                            densityThreshold_, binSize_, densityTf_, axisStyle_, xAxis_, yAxis_);
         }
     };
 
@@ -205,6 +221,8 @@ public:
 
     Properties properties_;
     Shader shader_;
+    Shader binShader_;
+    Shader densityShader_;
 
 protected:
     void plot(const size2_t& dims, bool useAxisRanges);
@@ -212,6 +230,12 @@ protected:
     void setShaderUniforms(TextureUnitContainer& cont, const size2_t& dims, bool useAxisRanges);
     void renderAxis(const size2_t& dims);
 
+    /**
+     * Bin all visible points into densityTexture_ and return the number of binned points
+     */
+    size_t binPoints(const size2_t& dims, bool useAxisRanges);
+    void renderDensity(const size2_t& dims);
+
     void objectPicked(PickingEvent* p);
     uint32_t getGlobalPickId(uint32_t localIndex) const;
 
@@ -219,7 +243,7 @@ protected:
 
     struct Points {
         BufferObjectArray boa;
-        IndexBuffer indices;
+        IndexBuffer indices{BufferUsage::Dynamic};  // repartitioned on every brushing change
 
         // startFilter, startRegular, startSelected, startHighlighted, end
         std::array<std::uint32_t, 5> offsets;
@@ -233,6 +257,10 @@ protected:
     };
     Points points_;
 
+    FrameBufferObject densityFbo_;
+    std::unique_ptr<Texture2D> densityTexture_;
+    float maxDensity_ = 1.0f;
+
     std::shared_ptr<const TemplateColumn<uint32_t>> indexColumn_;
 
     SortingOrder sortOrder_ = SortingOrder::Ascending;
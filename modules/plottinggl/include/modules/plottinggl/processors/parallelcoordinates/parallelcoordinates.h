@@ -47,14 +47,18 @@
 #include <inviwo/core/properties/optionproperty.h>                            // for OptionProperty
 #include <inviwo/core/properties/ordinalproperty.h>                           // for FloatProperty
 #include <inviwo/core/properties/stringproperty.h>                            // for StringProperty
+#include <inviwo/core/properties/transferfunctionproperty.h>                  // for TransferFun...
 #include <inviwo/core/properties/marginproperty.h>                            // for MarginProperty
 #include <inviwo/core/util/glmvec.h>                                          // for vec2, size2_t
 #include <inviwo/core/util/staticstring.h>                                    // for operator+
 #include <inviwo/dataframe/properties/dataframecolormapproperty.h>            // for DataFrameCo...
 #include <modules/brushingandlinking/ports/brushingandlinkingports.h>         // for BrushingAnd...
 #include <modules/fontrendering/properties/fontproperty.h>                    // for FontProperty
+#include <modules/opengl/buffer/bufferobjectarray.h>                          // for BufferObjec...
+#include <modules/opengl/buffer/framebufferobject.h>                          // for FrameBuffer...
 #include <modules/opengl/inviwoopengl.h>                                      // for GLsizei
 #include <modules/opengl/shader/shader.h>                                     // for Shader
+#include <modules/opengl/texture/texture2d.h>                                 // for Texture2D
 #include <modules/plottinggl/utils/axisrenderer.h>                            // for AxisRenderer
 #include <modules/userinterfacegl/glui/renderer.h>                            // for Renderer
 #include <modules/userinterfacegl/glui/widgets/doubleminmaxpropertywidget.h>  // for DoubleMinMa...
@@ -87,6 +91,11 @@ public:
     enum class BlendMode { None = 0, Additive = 1, Subtractive = 2, Regular = 3 };
     enum class LabelPosition { None, Above, Below };
     enum class AxisSelection { Single, Multiple, None };
+    /**
+     * Lines draws a polyline per row. Density accumulates the number of lines through each pixel
+     * and draws that with a transfer function, which scales to millions of rows.
+     */
+    enum class RenderMode { Lines, Density };
 
 public:
     ParallelCoordinates();
@@ -114,6 +123,8 @@ public:
     OptionProperty<AxisSelection> axisSelection_;
 
     CompositeProperty lineSettings_;
+    OptionProperty<RenderMode> renderMode_;
+    TransferFunctionProperty densityTf_;
     OptionProperty<BlendMode> blendMode_;
     FloatProperty falloffPower_;
     FloatProperty lineWidth_;
@@ -174,9 +185,11 @@ private:
     void buildLineIndices();
     void buildAxisPositions();
     void partitionLines();
+    void updateLineMasks();
     void drawAxis(size2_t size);
     void drawHandles(size2_t size);
     void drawLines(size2_t size);
+    void drawDensity(size2_t size);
 
     void updateBrushing();
 
@@ -202,6 +215,9 @@ private:
     bool isDragging_ = false;
 
     Shader lineShader_;
+    Shader densityShader_;
+    Shader densityMaxShader_;
+    Shader densityMapShader_;
 
     struct Lines {
         TypedMesh<buffertraits::PositionsBuffer1D, buffertraits::PickingBuffer,
@@ -229,12 +245,26 @@ private:
     };
     Lines lines_;
 
+    struct Density {
+        // Brushing state of each line, bit 0: filtered, bit 1: selected, bit 2: highlighted.
+        // Only this buffer is updated on brushing changes in density mode.
+        Buffer<std::uint32_t> lineMasks;
+        FrameBufferObject fbo;
+        std::unique_ptr<Texture2D> counts;
+        FrameBufferObject maxFbo;
+        std::unique_ptr<Texture2D> maxCount;
+        BufferObjectArray vao;  // empty, for drawing one point per texel of the counts
+    };
+    Density density_;
+
     std::pair<vec2, vec2> marginsInternal_;  // Margins with/without considering labels
     BitSet highlightedLines_;
     int hoveredAxis_ = -1;
 
     bool brushingDirty_;
     bool rangesDirty_;
+    bool partitionDirty_ = true;
+    bool masksDirty_ = true;
     bool updating_ = false;
 };
 
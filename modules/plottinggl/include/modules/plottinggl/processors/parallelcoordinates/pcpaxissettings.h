@@ -30,6 +30,7 @@
 
 #include <modules/plottinggl/plottingglmoduledefine.h>  // for IVW_MODULE_PLOTTINGGL_API
 
+#include <inviwo/core/datastructures/buffer/buffer.h>           // for Buffer
 #include <inviwo/core/properties/boolcompositeproperty.h>       // for BoolCompositeProperty
 #include <inviwo/core/properties/boolproperty.h>                // for BoolProperty
 #include <inviwo/core/properties/minmaxproperty.h>              // for DoubleMinMaxProperty
@@ -161,6 +162,13 @@ public:
      */
     double getNormalizedAt(size_t idx) const;
 
+    /**
+     * The normalized values of all rows of the column, equal to getNormalizedAt() for each row.
+     * The buffer is cached in the column and shared with other users of it.
+     * @see Column::getNormalizedBuffer
+     */
+    std::shared_ptr<const Buffer<float>> getNormalizedData() const;
+
     /**
      * Get data-range value from a normalized value. This the inverse function of getNormalized, ie
      * `x = getValue(getNormalized(x))`.
@@ -29,6 +29,7 @@
 
 #include <modules/plottinggl/plotters/scatterplotgl.h>
 
+#include <inviwo/core/algorithm/markdown.h>                               // for operator""_help
 #include <inviwo/core/datastructures/bitset.h>                            // for BitSet
 #include <inviwo/core/datastructures/buffer/buffer.h>                     // for BufferBase, Ind...
 #include <inviwo/core/datastructures/buffer/bufferram.h>                  // for BufferRAM
@@ -64,10 +65,12 @@
 #include <modules/opengl/buffer/buffergl.h>                               // for BufferGL
 #include <modules/opengl/buffer/bufferobject.h>                           // for BufferObject
 #include <modules/opengl/buffer/bufferobjectarray.h>                      // for BufferObjectArray
+#include <modules/opengl/buffer/framebufferobject.h>                      // for ActivateFBO
 #include <modules/opengl/inviwoopengl.h>                                  // for glDrawElements
 #include <modules/opengl/openglutils.h>                                   // for BlendModeState
 #include <modules/opengl/shader/shader.h>                                 // for Shader
 #include <modules/opengl/shader/shaderutils.h>                            // for ImageInport
+#include <modules/opengl/texture/texture2d.h>                             // for Texture2D
 #include <modules/opengl/texture/textureunit.h>                           // for TextureUnitCont...
 #include <modules/opengl/texture/textureutils.h>                          // for deactivateCurre...
 #include <modules/plotting/datastructures/axissettings.h>                 // for AxisSettings::O...
@@ -119,6 +122,20 @@ ScatterPlotGL::Properties::Properties(std::string_view identifier, std::string_v
     , borderWidth_("borderWidth", "Border Width", 2, 0, 20)
     , borderColor_("borderColor", "Border Color", util::ordinalColor(0.0f, 0.0f, 0.0f, 1.0f))
 
+    , renderMode_("renderMode", "Render Mode",
+                  {{"points", "Points", RenderMode::Points},
+                   {"density", "Density", RenderMode::Density},
+                   {"automatic", "Automatic", RenderMode::Automatic}},
+                  2)
+    , densityThreshold_("densityThreshold", "Density Threshold",
+                        util::ordinalCount<size_t>(1'000'000, 100'000'000)
+                            .set("Draw the points as a density when more than this number of "
+                                 "points are inside of the axis ranges"_help))
+    , binSize_("binSize", "Bin Size", 2, 1, 32)
+    , densityTf_("densityTransferFunction", "Density Transfer Function",
+                 TransferFunction({{0.0, vec4(0.8f, 0.9f, 1.0f, 1.0f)},
+                                   {1.0, vec4(0.0f, 0.1f, 0.5f, 1.0f)}}))
+
     , axisStyle_("axisStyle", "Global Axis Style")
     , xAxis_("xAxis", "X Axis")
     , yAxis_("yAxis", "Y Axis", AxisProperty::Orientation::Vertical) {
@@ -132,6 +149,16 @@ ScatterPlotGL::Properties::Properties(std::string_view identifier, std::string_v
     minRadius_.setVisible(false);
 
     tf_.setCurrentStateAsDefault();
+    densityTf_.setCurrentStateAsDefault();
+
+    densityThreshold_.visibilityDependsOn(
+        renderMode_, [](const auto& p) { return p.getSelectedValue() == RenderMode::Automatic; });
+    binSize_.visibilityDependsOn(renderMode_, [](const auto& p) {
+        return p.getSelectedValue() != RenderMode::Points;
+    });
+    densityTf_.visibilityDependsOn(renderMode_, [](const auto& p) {
+        return p.getSelectedValue() != RenderMode::Points;
+    });
 }
 
 ScatterPlotGL::Properties::Properties(const ScatterPlotGL::Properties& rhs)
@@ -150,6 +177,10 @@ ScatterPlotGL::Properties::Properties(const ScatterPlotGL::Properties& rhs)
     , axisMargin_(rhs.axisMargin_)
     , borderWidth_(rhs.borderWidth_)
     , borderColor_(rhs.borderColor_)
+    , renderMode_(rhs.renderMode_)
+    , densityThreshold_(rhs.densityThreshold_)
+    , binSize_(rhs.binSize_)
+    , densityTf_(rhs.densityTf_)
     , axisStyle_(rhs.axisStyle_)
     , xAxis_(rhs.xAxis_)
     , yAxis_(rhs.yAxis_) {
@@ -166,6 +197,8 @@ ScatterPlotGL::Properties* ScatterPlotGL::Properties::clone() const {
 ScatterPlotGL::ScatterPlotGL(Processor* processor)
     : properties_("scatterplot", "Scatterplot")
     , shader_("scatterplot.vert", "scatterplot.geom", "scatterplot.frag")
+    , binShader_("scatterplotbin.vert", "scatterplotbin.frag")
+    , densityShader_("img_texturequad.vert", "scatterplotdensity.frag")
     , axisRenderers_({{properties_.xAxis_, properties_.yAxis_}})
     , picking_(processor, 1, [this](PickingEvent* p) { objectPicked(p); })
     , partitionDirty_(true)
@@ -199,7 +232,10 @@ ScatterPlotGL::ScatterPlotGL(Processor* processor)
     , selectionRectRenderer_(properties_.boxSelectionSettings_) {
 
     if (processor_) {
-        shader_.onReload([this]() { processor_->invalidate(InvalidationLevel::InvalidOutput); });
+        for (auto* shader : {&shader_, &binShader_, &densityShader_}) {
+            shader->onReload(
+                [this]() { processor_->invalidate(InvalidationLevel::InvalidOutput); });
+        }
     }
     properties_.showHighlighted_.onChange([this]() {
         if (!properties_.showHighlighted_) {
@@ -405,7 +441,16 @@ void ScatterPlotGL::plot(const size2_t& dims, bool useAxisRanges) {
         partitionData();
     }
 
-    if (!points_.indices.empty()) {
+    const auto mode = properties_.renderMode_.getSelectedValue();
+    bool density = false;
+    if (mode != RenderMode::Points && !points_.indices.empty()) {
+        const auto visible = binPoints(dims, useAxisRanges);
+        density = mode == RenderMode::Density || visible > properties_.densityThreshold_;
+    }
+
+    if (density) {
+        renderDensity(dims);
+    } else if (!points_.indices.empty()) {
         utilgl::BlendModeState blending(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
         utilgl::DepthFuncState depthFunc(GL_LEQUAL);
 
@@ -454,6 +499,110 @@ void ScatterPlotGL::plot(const size2_t& dims, bool useAxisRanges) {
     renderAxis(dims);
 }
 
+size_t ScatterPlotGL::binPoints(const size2_t& dims, bool useAxisRanges) {
+    const vec4 margins = properties_.margins_.getAsVec4() + properties_.axisMargin_.get();
+    const vec2 plotSize = glm::max(vec2(dims) - vec2(margins.w + margins.y, margins.x + margins.z),
+                                   vec2(1.0f));
+    const size2_t bins{glm::ceil(plotSize / static_cast<float>(properties_.binSize_.get()))};
+
+    if (!densityTexture_) {
+        densityTexture_ =
+            std::make_unique<Texture2D>(bins, GL_RGBA, GL_RGBA32F, GL_FLOAT, GL_NEAREST);
+        densityTexture_->initialize(nullptr);
+        utilgl::ActivateFBO fbo{densityFbo_};
+        densityFbo_.attachColorTexture(densityTexture_.get());
+    } else if (densityTexture_->getDimensions() != bins) {
+        densityTexture_->resize(bins);
+    }
+
+    {
+        utilgl::ActivateFBO fbo{densityFbo_};
+        utilgl::ViewportState viewport(0, 0, static_cast<GLsizei>(bins.x),
+                                       static_cast<GLsizei>(bins.y));
+        utilgl::ClearColor clearColor(vec4(0.0f));
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        utilgl::GlBoolState depthTest(GL_DEPTH_TEST, false);
+        utilgl::BlendModeState blending(GL_ONE, GL_ONE);
+
+        binShader_.activate();
+        binShader_.setUniform("minmaxX",
+                              useAxisRanges ? vec2(properties_.xAxis_.range_.get()) : minmaxX_);
+        binShader_.setUniform("minmaxY",
+                              useAxisRanges ? vec2(properties_.yAxis_.range_.get()) : minmaxY_);
+
+        points_.boa.bind();
+        attachVertexAttributes();
+        auto indicesGL = points_.indices.getRepresentation<BufferGL>();
+        indicesGL->bind();
+
+        // Filtered points are not binned. Each bin counts its points, selected, and highlighted
+        // points separately so that brushing can be shown on the bins.
+        const std::array<vec4, 4> weights = {vec4(0.0f), vec4(1.0f, 0.0f, 0.0f, 0.0f),
+                                             vec4(1.0f, 1.0f, 0.0f, 0.0f),
+                                             vec4(1.0f, 0.0f, 1.0f, 0.0f)};
+        for (size_t i = 1; i < points_.offsets.size() - 1; ++i) {
+            const auto begin = points_.offsets[i];
+            const auto end = points_.offsets[i + 1];
+            if (end == begin) continue;
+
+            binShader_.setUniform("weight", weights[i]);
+            glDrawElements(GL_POINTS, static_cast<uint32_t>(end - begin),
+                           indicesGL->getFormatType(),
+                           reinterpret_cast<const GLvoid*>(begin * sizeof(std::uint32_t)));
+        }
+
+        indicesGL->unbind();
+        points_.boa.unbind();
+        binShader_.deactivate();
+    }
+
+    // The histogram is small compared to the data, read it back for the color map range and
+    // the number of visible points.
+    std::vector<vec4> counts(bins.x * bins.y);
+    densityTexture_->download(counts.data());
+    size_t visible = 0;
+    float maxCount = 0.0f;
+    for (const auto& bin : counts) {
+        visible += static_cast<size_t>(bin.r);
+        maxCount = std::max(maxCount, bin.r);
+    }
+    maxDensity_ = std::max(maxCount, 1.0f);
+    return visible;
+}
+
+void ScatterPlotGL::renderDensity(const size2_t& dims) {
+    const vec4 margins = properties_.margins_.getAsVec4() + properties_.axisMargin_.get();
+
+    utilgl::Viewport current;
+    current.get();
+    utilgl::ViewportState viewport(
+        current.x() + static_cast<GLint>(margins.w), current.y() + static_cast<GLint>(margins.z),
+        std::max(1, static_cast<GLsizei>(static_cast<float>(dims.x) - margins.w - margins.y)),
+        std::max(1, static_cast<GLsizei>(static_cast<float>(dims.y) - margins.x - margins.z)));
+    utilgl::BlendModeState blending(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    utilgl::GlBoolState depthTest(GL_DEPTH_TEST, false);
+
+    TextureUnitContainer cont;
+    densityShader_.activate();
+    utilgl::bindAndSetUniforms(densityShader_, cont, *densityTexture_, "density");
+    utilgl::bindAndSetUniforms(densityShader_, cont, properties_.densityTf_);
+    densityShader_.setUniform("maxCount", maxDensity_);
+
+    const auto setSelectionColor = [&](std::string_view name, const SelectionColorProperty& p) {
+        densityShader_.setUniform(fmt::format("{}.color", name), p.getColor());
+        densityShader_.setUniform(fmt::format("{}.colorMixIn", name), p.getMixIntensity());
+        densityShader_.setUniform(fmt::format("{}.alphaMixIn", name), 1.0f);
+        densityShader_.setUniform(fmt::format("{}.visible", name), p.isChecked());
+    };
+    setSelectionColor("selected", properties_.showSelected_);
+    setSelectionColor("highlighted", properties_.showHighlighted_);
+
+    utilgl::singleDrawImagePlaneRect();
+    densityShader_.deactivate();
+    TextureUnit::setZeroUnit();
+}
+
 void ScatterPlotGL::attachVertexAttributes() {
     auto attachAttrib = [&](auto buffer, GLuint loc,
                             BufferObject::BindingType bindingType =
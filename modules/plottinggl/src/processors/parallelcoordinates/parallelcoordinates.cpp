@@ -60,8 +60,10 @@
 #include <inviwo/core/properties/ordinalproperty.h>                             // for FloatProp...
 #include <inviwo/core/properties/property.h>                                    // for Property
 #include <inviwo/core/properties/propertysemantics.h>                           // for PropertyS...
+#include <inviwo/core/properties/transferfunctionproperty.h>                    // for TransferF...
 #include <inviwo/core/properties/marginproperty.h>                              // for MarginPro...
 #include <inviwo/core/util/glmvec.h>                                            // for vec4, vec2
+#include <inviwo/core/util/parallel.h>                                          // for parallelFor
 #include <inviwo/core/util/staticstring.h>                                      // for operator+
 #include <inviwo/core/util/stdextensions.h>                                     // for contains
 #include <inviwo/core/util/stringconversion.h>                                  // for toString
@@ -76,10 +78,12 @@
 #include <modules/fontrendering/properties/fontproperty.h>                      // for FontProperty
 #include <modules/fontrendering/util/fontutils.h>                               // for getFont
 #include <modules/opengl/buffer/buffergl.h>                                     // for BufferGL
+#include <modules/opengl/buffer/framebufferobject.h>                            // for ActivateFBO
 #include <modules/opengl/geometry/meshgl.h>                                     // for MeshGL
 #include <modules/opengl/openglutils.h>                                         // for GlBoolState
 #include <modules/opengl/shader/shader.h>                                       // for Shader
 #include <modules/opengl/shader/shaderobject.h>                                 // for ShaderObject
+#include <modules/opengl/texture/texture2d.h>                                   // for Texture2D
 #include <modules/opengl/texture/textureunit.h>                                 // for TextureUn...
 #include <modules/opengl/texture/textureutils.h>                                // for activateA...
 #include <modules/opengl/openglcapabilities.h>                                  // for OpenGLCap...
@@ -135,6 +139,13 @@ ParallelCoordinates::ParallelCoordinates()
                       {"none", "None", AxisSelection::None}},
                      1)
     , lineSettings_{"lines", "Line Settings"}
+    , renderMode_("renderMode", "Render Mode",
+                  {{"lines", "Lines", RenderMode::Lines},
+                   {"density", "Density", RenderMode::Density}},
+                  0)
+    , densityTf_("densityTransferFunction", "Density Transfer Function",
+                 TransferFunction({{0.0, vec4(0.6f, 0.75f, 1.0f, 0.4f)},
+                                   {1.0, vec4(0.0f, 0.1f, 0.5f, 1.0f)}}))
     , blendMode_("blendMode", "Blend Mode",
                  {{"additive", "Additive", BlendMode::Additive},
                   {"subtractive", "Subtractive", BlendMode::Subtractive},
@@ -201,6 +212,9 @@ ParallelCoordinates::ParallelCoordinates()
                        axisPicked(p, static_cast<std::uint32_t>(p->getPickedId()), PickType::Axis);
                    })
     , lineShader_("pcp_lines.vert", "pcp_lines.geom", "pcp_lines.frag", Shader::Build::No)
+    , densityShader_("pcp_density.vert", "pcp_density.frag", Shader::Build::No)
+    , densityMaxShader_("pcp_densitymax.vert", "pcp_densitymax.frag")
+    , densityMapShader_("img_texturequad.vert", "pcp_densitymap.frag")
     , lines_{}
     , marginsInternal_(0.0f, 0.0f)
     , brushingDirty_{true}  // needs to be true after deserialization
@@ -220,10 +234,21 @@ ParallelCoordinates::ParallelCoordinates()
     selectedLine_.setCollapsed(true);
 
     addProperty(lineSettings_);
-    lineSettings_.addProperties(blendMode_, falloffPower_, lineWidth_, selectedLine_, showFiltered_,
-                                filterColor_, filterAlpha_, filterIntensity_);
+    lineSettings_.addProperties(renderMode_, densityTf_, blendMode_, falloffPower_, lineWidth_,
+                                selectedLine_, showFiltered_, filterColor_, filterAlpha_,
+                                filterIntensity_);
     lineSettings_.setCollapsed(true);
 
+    const auto isDensity = [](const auto& p) {
+        return p.getSelectedValue() == RenderMode::Density;
+    };
+    const auto isLines = [](const auto& p) { return p.getSelectedValue() == RenderMode::Lines; };
+    densityTf_.visibilityDependsOn(renderMode_, isDensity);
+    blendMode_.visibilityDependsOn(renderMode_, isLines);
+    falloffPower_.visibilityDependsOn(renderMode_, isLines);
+    lineWidth_.visibilityDependsOn(renderMode_, isLines);
+    filterIntensity_.visibilityDependsOn(renderMode_, isLines);
+
     addProperty(captionSettings_);
     captionSettings_.insertProperty(0, captionPosition_);
     captionSettings_.addProperties(captionOffset_, captionColor_);
@@ -275,6 +300,16 @@ ParallelCoordinates::ParallelCoordinates()
         lineShader_.onReload([&]() { this->invalidate(InvalidationLevel::InvalidOutput); });
         lineShader_.build();
     }
+    {
+        auto vs = densityShader_.getVertexShaderObject();
+        vs->clearInDeclarations();
+        vs->addInDeclaration("in_Vertex", buffertraits::PositionsBuffer1D::bi().location, "float");
+        vs->addShaderDefine("NUMBER_OF_AXIS", toString(1));
+        densityShader_.build();
+    }
+    for (auto* shader : {&densityShader_, &densityMaxShader_, &densityMapShader_}) {
+        shader->onReload([&]() { this->invalidate(InvalidationLevel::InvalidOutput); });
+    }
 
     dataFrame_.onChange([&]() { createOrUpdateProperties(); });
 
@@ -355,6 +390,14 @@ void ParallelCoordinates::process() {
     } else if (enabledAxesModified_) {
         buildLineIndices();
     } else if (brushingAndLinking_.isChanged() || axisProperties_.isModified()) {
+        partitionDirty_ = true;
+        masksDirty_ = true;
+    }
+    // In density mode a brushing change only updates the line masks and their GPU buffer
+    const bool density = renderMode_.getSelectedValue() == RenderMode::Density;
+    if (density && masksDirty_) {
+        updateLineMasks();
+    } else if (!density && partitionDirty_) {
         partitionLines();
     }
     if ((!isDragging_ || enabledAxesModified_) &&
@@ -366,7 +409,11 @@ void ParallelCoordinates::process() {
 
     utilgl::GlBoolState depthTest(GL_DEPTH_TEST, false);
 
-    drawLines(dims);
+    if (density) {
+        drawDensity(dims);
+    } else {
+        drawLines(dims);
+    }
     drawAxis(dims);
     drawHandles(dims);
 
@@ -459,29 +506,41 @@ void ParallelCoordinates::buildLineMesh() {
     rangesDirty_ = false;
     auto& mesh = lines_.mesh;
 
-    for (auto& item : mesh.getBuffers()) {
-        item.second->getEditableRepresentation<BufferRAM>()->clear();
-    }
-
     const auto numberOfAxis = axes_.size();
     const auto numberOfLines = dataFrame_.getData()->getNumberOfRows();
 
-    mesh.reserveSizeInVertexBuffer(numberOfAxis * numberOfLines);
     linePicking_.resize(numberOfLines);
 
     const auto metaAxisId = colormap_.selectedColorAxis.get();
     const auto metaAxes = axes_[glm::clamp(metaAxisId, 0, static_cast<int>(axes_.size()) - 1)].pcp;
 
-    for (size_t i = 0; i < numberOfLines; i++) {
-        const auto meta = static_cast<float>(metaAxes->getNormalizedAt(i));
-        const auto picking = static_cast<uint32_t>(linePicking_.getPickingId(i));
-        for (auto& axis : axes_) {
-            mesh.addVertex(static_cast<float>(axis.pcp->getNormalizedAt(i)), picking, meta);
+    // The normalized columns are cached in the dataframe and shared with other processors
+    const auto normalized = util::transform(axes_, [](const auto& axis) {
+        return axis.pcp->getNormalizedData()->getRAMRepresentation();
+    });
+    const auto& meta = metaAxes->getNormalizedData()->getRAMRepresentation()->getDataContainer();
+
+    auto& positions = mesh.getTypedDataContainer<buffertraits::PositionsBuffer1D>();
+    auto& picking = mesh.getTypedDataContainer<buffertraits::PickingBuffer>();
+    auto& metas = mesh.getTypedDataContainer<buffertraits::ScalarMetaBuffer>();
+    positions.resize(numberOfAxis * numberOfLines);
+    picking.resize(numberOfAxis * numberOfLines);
+    metas.resize(numberOfAxis * numberOfLines);
+
+    util::parallelFor(0, numberOfLines, [&](size_t i) {
+        const auto pickingId = static_cast<uint32_t>(linePicking_.getPickingId(i));
+        for (size_t axis = 0; axis < numberOfAxis; ++axis) {
+            const auto vertex = i * numberOfAxis + axis;
+            positions[vertex] = normalized[axis]->getDataContainer()[i];
+            picking[vertex] = pickingId;
+            metas[vertex] = meta[i];
         }
-    }
+    });
 
-    lineShader_.getVertexShaderObject()->addShaderDefine("NUMBER_OF_AXIS", toString(numberOfAxis));
-    lineShader_.build();
+    for (auto* shader : {&lineShader_, &densityShader_}) {
+        shader->getVertexShaderObject()->addShaderDefine("NUMBER_OF_AXIS", toString(numberOfAxis));
+        shader->build();
+    }
 
     buildLineIndices();
 }
@@ -516,7 +575,8 @@ void ParallelCoordinates::buildLineIndices() {
     }
 
     buildAxisPositions();
-    partitionLines();
+    partitionDirty_ = true;
+    masksDirty_ = true;
 }
 
 void ParallelCoordinates::buildAxisPositions() {
@@ -554,6 +614,21 @@ void ParallelCoordinates::partitionLines() {
     lines_.offsets[2] = std::distance(lines_.starts.begin(), lastRegularIt);
     lines_.offsets[3] = std::distance(lines_.starts.begin(), lastSelectedIt);
     lines_.offsets[4] = lines_.starts.size();
+    partitionDirty_ = false;
+}
+
+void ParallelCoordinates::updateLineMasks() {
+    const auto iCol = dataFrame_.getData()->getIndexColumn();
+    const auto& indexCol = iCol->getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+
+    auto& masks = density_.lineMasks.getEditableRAMRepresentation()->getDataContainer();
+    masks.resize(indexCol.size());
+    for (auto&& [mask, idx] : util::zip(masks, indexCol)) {
+        mask = (brushingAndLinking_.isFiltered(idx) ? 1u : 0u) |
+               (brushingAndLinking_.isSelected(idx) ? 2u : 0u) |
+               (brushingAndLinking_.isHighlighted(idx) ? 4u : 0u);
+    }
+    masksDirty_ = false;
 }
 
 void ParallelCoordinates::drawAxis(size2_t size) {
@@ -697,6 +772,80 @@ void ParallelCoordinates::drawLines(size2_t size) {
     lineShader_.deactivate();
 }
 
+void ParallelCoordinates::drawDensity(size2_t size) {
+    if (!density_.counts) {
+        density_.counts =
+            std::make_unique<Texture2D>(size, GL_RGBA, GL_RGBA32F, GL_FLOAT, GL_NEAREST);
+        density_.counts->initialize(nullptr);
+        utilgl::ActivateFBO fbo{density_.fbo};
+        density_.fbo.attachColorTexture(density_.counts.get());
+
+        density_.maxCount =
+            std::make_unique<Texture2D>(size2_t{1}, GL_RED, GL_R32F, GL_FLOAT, GL_NEAREST);
+        density_.maxCount->initialize(nullptr);
+        utilgl::ActivateFBO maxFbo{density_.maxFbo};
+        density_.maxFbo.attachColorTexture(density_.maxCount.get());
+    } else if (density_.counts->getDimensions() != size) {
+        density_.counts->resize(size);
+    }
+
+    // Count the lines through each pixel
+    {
+        utilgl::ActivateFBO fbo{density_.fbo};
+        glClear(GL_COLOR_BUFFER_BIT);
+        utilgl::BlendModeEquationState blending(GL_ONE, GL_ONE, GL_FUNC_ADD);
+
+        densityShader_.activate();
+        // pcp_common.glsl
+        densityShader_.setUniform("spacing",
+                                  vec4(marginsInternal_.second.y, marginsInternal_.second.x,
+                                       marginsInternal_.first.y, marginsInternal_.first.x));
+        densityShader_.setUniform("dims", ivec2(size));
+        densityShader_.setUniform("axisPositions", lines_.axisPositions);
+        densityShader_.setUniform("axisFlipped", lines_.axisFlipped);
+        densityShader_.setUniform("showFiltered", showFiltered_.get());
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0,
+                         density_.lineMasks.getRepresentation<BufferGL>()->getId());
+
+        auto meshGL = lines_.mesh.getRepresentation<MeshGL>();
+        utilgl::Enable<MeshGL> enable{meshGL};
+        lines_.indices.getRepresentation<BufferGL>()->bind();
+        // The draw order does not matter when counting, draw all lines at once
+        glMultiDrawElements(GL_LINE_STRIP, lines_.sizes.data(), GL_UNSIGNED_INT,
+                            reinterpret_cast<const GLvoid* const*>(lines_.starts.data()),
+                            static_cast<GLsizei>(lines_.starts.size()));
+        densityShader_.deactivate();
+    }
+
+    TextureUnitContainer units;
+
+    // Reduce the counts to the largest count with max blending, avoiding a read back
+    {
+        utilgl::ActivateFBO fbo{density_.maxFbo};
+        utilgl::ViewportState viewport(0, 0, 1, 1);
+        glClear(GL_COLOR_BUFFER_BIT);
+        utilgl::BlendModeEquationState blending(GL_ONE, GL_ONE, GL_MAX);
+
+        densityMaxShader_.activate();
+        utilgl::bindAndSetUniforms(densityMaxShader_, units, *density_.counts, "density");
+        density_.vao.bind();
+        glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(size.x * size.y));
+        density_.vao.unbind();
+        densityMaxShader_.deactivate();
+    }
+
+    utilgl::BlendModeState blending(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    densityMapShader_.activate();
+    utilgl::bindAndSetUniforms(densityMapShader_, units, *density_.counts, "density");
+    utilgl::bindAndSetUniforms(densityMapShader_, units, *density_.maxCount, "maxDensity");
+    utilgl::bindAndSetUniforms(densityMapShader_, units, densityTf_);
+    densityMapShader_.setUniform("selectColor", selectedLineColor_.get());
+    densityMapShader_.setUniform("filterColor", vec4{filterColor_.get(), filterAlpha_.get()});
+    utilgl::singleDrawImagePlaneRect();
+    densityMapShader_.deactivate();
+    TextureUnit::setZeroUnit();
+}
+
 void ParallelCoordinates::linePicked(PickingEvent* p) {
     if (auto df = dataFrame_.getData()) {
         // Show tooltip about current line
@@ -203,6 +203,10 @@ double PCPAxisSettings::getNormalized(double v) const {
 
 double PCPAxisSettings::getNormalizedAt(size_t idx) const { return getNormalized(at(idx)); }
 
+std::shared_ptr<const Buffer<float>> PCPAxisSettings::getNormalizedData() const {
+    return col_ ? col_->getNormalizedBuffer() : nullptr;
+}
+
 double PCPAxisSettings::getValue(double v) const {
     if (invertRange) {
         v = 1.0 - v;
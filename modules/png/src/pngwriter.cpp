@@ -131,6 +131,12 @@ void write(const LayerRAMPrecision<T>* ram, png_voidp ioPtr, png_rw_ptr writeFun
 
     png_set_write_fn(png_ptr, ioPtr, writeFunc, flushFunc);
 
+    // Encoding time is dominated by zlib and by libpng trying all five filters on every row.
+    // Restricting the filters and using a lower compression level makes encoding several times
+    // faster while rendered images only grow slightly.
+    png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB | PNG_FILTER_UP);
+    png_set_compression_level(png_ptr, 3);
+
     const auto df = ram->getDataFormat();
     const auto color_type = [&]() {
         switch (df->getComponents()) {
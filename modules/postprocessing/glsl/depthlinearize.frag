@@ -54,6 +54,7 @@
 
 uniform vec4 clipInfo; // z_n * z_f,  z_n - z_f,  z_f, perspective = 1 : 0
 uniform sampler2D inputTexture;
+uniform int downsample = 1;
 
 uniform float minD = 0;
 uniform float maxD = 1;
@@ -68,7 +69,7 @@ float reconstructCSZ(float d, vec4 clipInfo) {
 }
 
 void main() {
-  float depth = texelFetch(inputTexture, ivec2(gl_FragCoord.xy), 0).x;
+  float depth = texelFetch(inputTexture, ivec2(gl_FragCoord.xy) * downsample, 0).x;
 
   float linDepth = reconstructCSZ(depth, clipInfo);
 
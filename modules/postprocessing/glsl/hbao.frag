@@ -94,6 +94,7 @@ layout(std140) uniform controlBuffer {
 
 uniform sampler2D texLinearDepth;
 uniform sampler2D texRandom;
+uniform vec2 jitterOffset = vec2(0);  // rotates the jitter pattern between frames
 
 void outputColor(vec4 color) {
   FragData0 = color;
@@ -163,7 +164,7 @@ vec2 RotateDirection(vec2 Dir, vec2 CosSin)
 vec4 GetJitter()
 {
   // (cos(Alpha),sin(Alpha),rand1,rand2)
-  return textureLod( texRandom, (gl_FragCoord.xy / AO_RANDOMTEX_SIZE), 0);
+  return textureLod( texRandom, ((gl_FragCoord.xy + jitterOffset) / AO_RANDOMTEX_SIZE), 0);
 }
 
 //----------------------------------------------------------------------------------
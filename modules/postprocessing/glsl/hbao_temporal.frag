@@ -0,0 +1,71 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Blends the current ambient occlusion with the result of previous frames. The history is
+// reprojected into the current view, and a history sample is rejected if it falls outside the
+// previous view or if its depth does not match the reprojected depth (disocclusion).
+
+uniform sampler2D texCurrent;  // (ao, linear depth) of the current frame
+uniform sampler2D texHistory;  // (ao, linear depth) accumulated over previous frames
+
+uniform vec4 projInfo;
+uniform int projOrtho;
+uniform mat4 currentToPreviousView;
+uniform mat4 previousProjection;
+
+uniform float historyWeight = 0.9;
+uniform float depthTolerance = 0.05;
+uniform int historyValid = 0;
+
+in vec2 texCoord;
+
+vec3 UVToView(vec2 uv, float eye_z) {
+    return vec3((uv * projInfo.xy + projInfo.zw) * (projOrtho != 0 ? 1. : eye_z), eye_z);
+}
+
+void main() {
+    vec2 current = texture(texCurrent, texCoord).xy;
+
+    vec3 viewPos = UVToView(texCoord, current.y);
+    vec4 previousView = currentToPreviousView * vec4(viewPos.xy, -viewPos.z, 1.0);
+    vec4 previousClip = previousProjection * previousView;
+    vec2 previousUV = previousClip.xy / previousClip.w * 0.5 + 0.5;
+    float expectedDepth = -previousView.z;
+
+    float ao = current.x;
+    if (historyValid != 0 && all(greaterThanEqual(previousUV, vec2(0.0))) &&
+        all(lessThanEqual(previousUV, vec2(1.0)))) {
+        vec2 history = texture(texHistory, previousUV).xy;
+        if (abs(history.y - expectedDepth) <= depthTolerance * expectedDepth) {
+            ao = mix(current.x, history.x, historyWeight);
+        }
+    }
+
+    FragData0 = vec4(ao, current.y, 0, 1);
+}
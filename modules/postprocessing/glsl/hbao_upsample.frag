@@ -0,0 +1,83 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Upsamples ambient occlusion computed at a reduced resolution to the full resolution. Each of
+// the four nearest low resolution samples is weighted by its bilinear weight and by how close its
+// depth is to the full resolution depth, to avoid bleeding across depth edges.
+
+uniform sampler2D texAO;     // (ao, linear depth) at the reduced resolution
+uniform sampler2D texDepth;  // full resolution depth
+
+uniform vec4 clipInfo;  // z_n * z_f,  z_n - z_f,  z_f, perspective = 1 : 0
+uniform float sharpness;
+
+in vec2 texCoord;
+
+float reconstructCSZ(float d, vec4 clipInfo) {
+    if (clipInfo[3] != 0) {
+        return (clipInfo[0] / (clipInfo[1] * d + clipInfo[2]));
+    } else {
+        return (clipInfo[1] + clipInfo[2] - d * clipInfo[1]);
+    }
+}
+
+void main() {
+    float depth = reconstructCSZ(texelFetch(texDepth, ivec2(gl_FragCoord.xy), 0).x, clipInfo);
+
+    ivec2 aoSize = textureSize(texAO, 0);
+    vec2 aoPos = texCoord * vec2(aoSize) - 0.5;
+    ivec2 base = ivec2(floor(aoPos));
+    vec2 f = fract(aoPos);
+
+    float aoSum = 0.0;
+    float weightSum = 0.0;
+    float nearestDiff = 1.0e30;
+    float nearestAO = 1.0;
+    for (int j = 0; j < 2; ++j) {
+        for (int i = 0; i < 2; ++i) {
+            ivec2 texel = clamp(base + ivec2(i, j), ivec2(0), aoSize - 1);
+            vec2 aoz = texelFetch(texAO, texel, 0).xy;
+
+            float bilinear = (i == 0 ? 1.0 - f.x : f.x) * (j == 0 ? 1.0 - f.y : f.y);
+            float ddiff = (aoz.y - depth) * sharpness;
+            float w = bilinear * exp2(-ddiff * ddiff);
+            aoSum += aoz.x * w;
+            weightSum += w;
+
+            if (abs(aoz.y - depth) < nearestDiff) {
+                nearestDiff = abs(aoz.y - depth);
+                nearestAO = aoz.x;
+            }
+        }
+    }
+
+    // fall back to the sample with the closest depth when all samples are across an edge
+    float ao = weightSum > 1.0e-4 ? aoSum / weightSum : nearestAO;
+    FragData0 = vec4(vec3(ao), 1);
+}
@@ -0,0 +1,78 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Applies a chain of per-pixel post-processing stages in a single full-screen pass. Each stage is
+// enabled by a define, so disabled stages do not cost anything. The stages are applied in the
+// order tonemapping, brightness/contrast, hue/saturation/luminance, and opacity.
+
+#include "utils/structs.glsl"
+#include "utils/colorconversion.glsl"
+#include "tonemapping.glsl"
+
+uniform sampler2D inport;
+uniform ImageParameters outportParameters;
+
+uniform float exposure = 1.0;
+uniform float gamma = 2.2;
+
+uniform float brightness = 0.0;
+uniform float contrast = 1.0;
+
+uniform float hue = 0.0;
+uniform float sat = 0.0;
+uniform float lum = 0.0;
+
+uniform float alpha = 1.0;
+
+void main() {
+    vec2 texCoords = gl_FragCoord.xy * outportParameters.reciprocalDimensions;
+    vec4 color = texture(inport, texCoords);
+
+#if defined(TONEMAPPING_METHOD)
+    color = tonemap(color, TONEMAPPING_METHOD, exposure, gamma);
+#endif
+
+#if defined(BRIGHTNESS_CONTRAST)
+    color.rgb = (color.rgb - 0.5) * contrast + 0.5 + brightness;
+#endif
+
+#if defined(HUE_SATURATION_LUMINANCE)
+    vec3 hslColor = rgb2hsl(color.rgb);
+    hslColor.r = mod(hslColor.r + hue, 1.0);
+    hslColor.g = clamp(hslColor.g + sat, 0.0, 1.0);
+    hslColor.b = clamp(hslColor.b + lum, 0.0, 1.0);
+    color.rgb = hsl2rgb(hslColor);
+#endif
+
+#if defined(OPACITY)
+    color.a = alpha;
+#endif
+
+    FragData0 = color;
+}
@@ -32,6 +32,7 @@
 #endif
 
 #include "utils/structs.glsl"
+#include "tonemapping.glsl"
 
 uniform sampler2D inport;
 uniform ImageParameters outportParameters;
@@ -42,65 +43,13 @@ uniform float gamma = 2.2;
 in vec2 texCoord;
 out vec4 outColor;
 
-// Many from here http://filmicworlds.com/blog/filmic-tonemapping-operators/
-
-vec3 Uncharted2Tonemap(vec3 x) {
-    const float A = 0.15;
-    const float B = 0.50;
-    const float C = 0.10;
-    const float D = 0.20;
-    const float E = 0.02;
-    const float F = 0.30;
-    return ((x * (A * x + C * B) + D * E) / (x * (A * x + B) + D * F)) - E / F;
-}
-
-vec4 Uncharted2(vec2 tc) {
-    const float W = 11.2;
-    vec4 texColor = texture(inport, tc);
-    texColor.rgb *= exposure;  // Exposure Adjustment
-
-    float ExposureBias = 2.0;
-    vec3 curr = Uncharted2Tonemap(ExposureBias * texColor.rgb);
-
-    vec3 whiteScale = 1.0 / Uncharted2Tonemap(vec3(W));
-    vec3 color = curr * whiteScale;
-
-    vec3 retColor = pow(color, vec3(1.0 / gamma));
-    return clamp(vec4(retColor, texColor.a), 0, 1);
-}
-
-vec4 Reinhard(vec2 tc) {
-    vec4 texColor = texture(inport, tc);
-    texColor.rgb *= exposure;  // Exposure Adjustment
-    texColor.rgb = texColor.rgb / (1 + texColor.rgb);
-    vec3 retColor = pow(texColor.rgb, vec3(1.0 / gamma));
-    return clamp(vec4(retColor, texColor.a), 0, 1);
-}
-
-vec4 Gamma(vec2 tc) {
-    vec4 texColor = texture(inport, tc);
-    texColor.rgb *= exposure;  // Exposure Adjustment
-    vec3 retColor = pow(texColor.rgb, vec3(1.0 / gamma));
-    return clamp(vec4(retColor, texColor.a), 0, 1);
-}
-
 //----------------------------------------------------------------------------------
 void main() {
     vec2 texCoords = gl_FragCoord.xy * outportParameters.reciprocalDimensions;
-#ifdef METHOD
-
-#if METHOD == 0
     vec4 color = texture(inport, texCoords);
-    outColor = clamp(vec4(color.rgb * exposure, color.a), 0, 1);
-#elif METHOD == 1
-    outColor = Gamma(texCoords);
-#elif METHOD == 2
-    outColor = Reinhard(texCoords);
-#elif METHOD == 3
-    outColor = Uncharted2(texCoords);
-#endif
-
+#ifdef METHOD
+    outColor = tonemap(color, METHOD, exposure, gamma);
 #else
-    outColor = texture(inport, texCoords);
+    outColor = color;
 #endif
 }
@@ -0,0 +1,87 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifndef IVW_TONEMAPPING_GLSL
+#define IVW_TONEMAPPING_GLSL
+
+// Many from here http://filmicworlds.com/blog/filmic-tonemapping-operators/
+
+vec3 Uncharted2Tonemap(vec3 x) {
+    const float A = 0.15;
+    const float B = 0.50;
+    const float C = 0.10;
+    const float D = 0.20;
+    const float E = 0.02;
+    const float F = 0.30;
+    return ((x * (A * x + C * B) + D * E) / (x * (A * x + B) + D * F)) - E / F;
+}
+
+vec4 tonemapNone(vec4 color, float exposure) {
+    return clamp(vec4(color.rgb * exposure, color.a), 0, 1);
+}
+
+vec4 tonemapGamma(vec4 color, float exposure, float gamma) {
+    color.rgb *= exposure;  // Exposure Adjustment
+    vec3 retColor = pow(color.rgb, vec3(1.0 / gamma));
+    return clamp(vec4(retColor, color.a), 0, 1);
+}
+
+vec4 tonemapReinhard(vec4 color, float exposure, float gamma) {
+    color.rgb *= exposure;  // Exposure Adjustment
+    color.rgb = color.rgb / (1 + color.rgb);
+    vec3 retColor = pow(color.rgb, vec3(1.0 / gamma));
+    return clamp(vec4(retColor, color.a), 0, 1);
+}
+
+vec4 tonemapUncharted2(vec4 color, float exposure, float gamma) {
+    const float W = 11.2;
+    color.rgb *= exposure;  // Exposure Adjustment
+
+    float ExposureBias = 2.0;
+    vec3 curr = Uncharted2Tonemap(ExposureBias * color.rgb);
+
+    vec3 whiteScale = 1.0 / Uncharted2Tonemap(vec3(W));
+    vec3 retColor = pow(curr * whiteScale, vec3(1.0 / gamma));
+    return clamp(vec4(retColor, color.a), 0, 1);
+}
+
+// method: 0 None, 1 Gamma, 2 Reinhard, 3 Uncharted 2
+vec4 tonemap(vec4 color, int method, float exposure, float gamma) {
+    if (method == 1) {
+        return tonemapGamma(color, exposure, gamma);
+    } else if (method == 2) {
+        return tonemapReinhard(color, exposure, gamma);
+    } else if (method == 3) {
+        return tonemapUncharted2(color, exposure, gamma);
+    } else {
+        return tonemapNone(color, exposure);
+    }
+}
+
+#endif  // IVW_TONEMAPPING_GLSL
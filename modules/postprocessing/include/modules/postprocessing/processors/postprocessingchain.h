@@ -0,0 +1,83 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/postprocessing/postprocessingmoduledefine.h>  // for IVW_MODULE_POSTP...
+
+#include <inviwo/core/processors/processorinfo.h>                        // for ProcessorInfo
+#include <inviwo/core/properties/boolcompositeproperty.h>                // for BoolCompositePro...
+#include <inviwo/core/properties/optionproperty.h>                       // for OptionPropertyInt
+#include <inviwo/core/properties/ordinalproperty.h>                      // for FloatProperty
+#include <modules/basegl/processors/imageprocessing/imageglprocessor.h>  // for ImageGLProcessor
+
+namespace inviwo {
+class TextureUnitContainer;
+
+/**
+ * @brief Applies several per-pixel post-processing stages in a single full-screen pass.
+ *
+ * Combines the operations of Tonemapping, ImageBrightnessContrast, ImageHueSaturationLuminance,
+ * and ImageOpacity. Only the enabled stages are compiled into the shader, and the whole chain
+ * reads and writes the framebuffer once instead of once per stage. Stages that need a pixel
+ * neighborhood, like SSAO, HdrBloom, and FXAA, still run as separate processors.
+ */
+class IVW_MODULE_POSTPROCESSING_API PostProcessingChain : public ImageGLProcessor {
+public:
+    PostProcessingChain();
+    virtual ~PostProcessingChain() = default;
+
+    virtual const ProcessorInfo& getProcessorInfo() const override;
+    static const ProcessorInfo processorInfo_;
+
+    virtual void initializeResources() override;
+
+protected:
+    virtual void preProcess(TextureUnitContainer& cont) override;
+
+private:
+    BoolCompositeProperty tonemapping_;
+    OptionPropertyInt method_;
+    FloatProperty exposure_;
+    FloatProperty gamma_;
+
+    BoolCompositeProperty brightnessContrast_;
+    FloatProperty brightness_;
+    FloatProperty contrast_;
+
+    BoolCompositeProperty hueSaturationLuminance_;
+    FloatProperty hue_;
+    FloatProperty saturation_;
+    FloatProperty luminance_;
+
+    BoolCompositeProperty opacity_;
+    FloatProperty alpha_;
+};
+
+}  // namespace inviwo
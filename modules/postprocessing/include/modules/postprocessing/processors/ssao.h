@@ -31,17 +31,18 @@
 
 #include <modules/postprocessing/postprocessingmoduledefine.h>  // for IVW_MODULE_POSTPROCESSING...
 
-#include <inviwo/core/ports/imageport.h>             // for ImageInport, ImageOutport
-#include <inviwo/core/processors/processor.h>        // for Processor
-#include <inviwo/core/processors/processorinfo.h>    // for ProcessorInfo
-#include <inviwo/core/properties/boolproperty.h>     // for BoolProperty
-#include <inviwo/core/properties/cameraproperty.h>   // for CameraProperty
-#include <inviwo/core/properties/optionproperty.h>   // for OptionPropertyInt
-#include <inviwo/core/properties/ordinalproperty.h>  // for FloatProperty, IntProperty
-#include <inviwo/core/util/glmmat.h>                 // for mat4
-#include <inviwo/core/util/glmvec.h>                 // for vec2, vec4
-#include <modules/opengl/inviwoopengl.h>             // for GLuint, GLint
-#include <modules/opengl/shader/shader.h>            // for Shader
+#include <inviwo/core/ports/imageport.h>                   // for ImageInport, ImageOutport
+#include <inviwo/core/processors/processor.h>              // for Processor
+#include <inviwo/core/processors/processorinfo.h>          // for ProcessorInfo
+#include <inviwo/core/properties/boolcompositeproperty.h>  // for BoolCompositeProperty
+#include <inviwo/core/properties/boolproperty.h>           // for BoolProperty
+#include <inviwo/core/properties/cameraproperty.h>         // for CameraProperty
+#include <inviwo/core/properties/optionproperty.h>         // for OptionPropertyInt
+#include <inviwo/core/properties/ordinalproperty.h>        // for FloatProperty, IntProperty
+#include <inviwo/core/util/glmmat.h>                       // for mat4
+#include <inviwo/core/util/glmvec.h>                       // for vec2, vec4
+#include <modules/opengl/inviwoopengl.h>                   // for GLuint, GLint
+#include <modules/opengl/shader/shader.h>                  // for Shader
 
 namespace inviwo {
 
@@ -99,10 +100,18 @@ private:
     void initHbao();
     void initFramebuffers(int width, int height);
     void prepareHbaoData(const ProjectionParam& proj, int width, int height);
-    void drawLinearDepth(GLuint texDepth, const ProjectionParam& proj);
+    void drawLinearDepth(GLuint texDepth, const ProjectionParam& proj, int downsample = 1);
+    void drawHbaoCalc(Shader& shader);
     void drawHbaoClassic(GLuint fboOut, GLuint texDepth, const ProjectionParam& proj, int width,
                          int height);
     void drawHbaoBlur(GLuint fboOut, const ProjectionParam& proj, int width, int height);
+    /**
+     * Computes the ambient occlusion at a reduced resolution and/or accumulates it over frames,
+     * and then applies it to the full resolution output using a depth-aware upsampling.
+     */
+    void drawHbaoUpsampled(GLuint fboOut, GLuint texDepth, const ProjectionParam& proj,
+                           int width, int height);
+    void drawHbaoTemporal(const ProjectionParam& proj);
 
     ImageInport inport_;
     ImageOutport outport_;
@@ -117,6 +126,10 @@ private:
     BoolProperty useNormal_;
     BoolProperty enableBlur_;
     FloatProperty blurSharpness_;
+    OptionPropertyInt resolution_;
+    BoolCompositeProperty temporal_;
+    FloatProperty historyWeight_;
+    FloatProperty depthTolerance_;
     CameraProperty camera_;
 
     Shader depthLinearize_;
@@ -124,6 +137,8 @@ private:
     Shader hbaoCalcBlur_;
     Shader hbaoBlurHoriz_;
     Shader hbaoBlurVert_;
+    Shader hbaoTemporal_;
+    Shader hbaoUpsample_;
 
     /*
     // For future things
@@ -140,8 +155,11 @@ private:
     struct {
         GLuint depthLinear = 0;
         GLuint hbaoCalc = 0;
+        GLuint temporal = 0;
         // GLuint viewNormal = 0;
 
+        // size of the ambient occlusion buffers, i.e. the output size divided by the resolution
+        // factor
         int width = 0;
         int height = 0;
     } framebuffers_;
@@ -151,6 +169,7 @@ private:
         GLuint hbaoResult = 0;
         GLuint hbaoBlur = 0;
         GLuint hbaoRandom = 0;
+        GLuint history[2] = {0, 0};
 
         /*
         // For future things
@@ -163,10 +182,12 @@ private:
     struct {
         GLint depthLinearClipInfo = -1;
         GLint depthLinearInputTexture = -1;
+        GLint depthLinearDownsample = -1;
 
         GLint hbaoControlBuffer = -1;
         GLint hbaoTexLinearDepth = -1;
         GLint hbaoTexRandom = -1;
+        GLint hbaoJitterOffset = -1;
 
         GLint hbaoBlurSharpness = -1;
         GLint hbaoBlurInvResolutionDirection = -1;
@@ -183,6 +204,14 @@ private:
 
     ProjectionParam projParam_;
     HBAOData hbaoUboData_;
+
+    struct {
+        mat4 view{1.0f};
+        mat4 projection{1.0f};
+        int index = 0;
+        bool valid = false;
+        int frame = 0;
+    } history_;
 };
 
 }  // namespace inviwo
@@ -41,6 +41,7 @@
 #include <modules/postprocessing/processors/imagefilter.h>                  // for ImageFilter
 #include <modules/postprocessing/processors/imagehuesaturationluminance.h>  // for ImageHueSatur...
 #include <modules/postprocessing/processors/imageopacity.h>                 // for ImageOpacity
+#include <modules/postprocessing/processors/postprocessingchain.h>          // for PostProcessin...
 #include <modules/postprocessing/processors/ssao.h>                         // for SSAO
 #include <modules/postprocessing/processors/tonemapping.h>                  // for Tonemapping
 
@@ -70,6 +71,7 @@ PostProcessingModule::PostProcessingModule(InviwoApplication* app)
     registerProcessor<ImageHueSaturationLuminance>();
     registerProcessor<ImageFilter>();
     registerProcessor<ImageOpacity>();
+    registerProcessor<PostProcessingChain>();
 }
 
 int PostProcessingModule::getVersion() const { return 1; }
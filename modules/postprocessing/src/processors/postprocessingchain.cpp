@@ -0,0 +1,117 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/postprocessing/processors/postprocessingchain.h>
+
+#include <inviwo/core/processors/processorinfo.h>                        // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>                       // for CodeState, CodeS...
+#include <inviwo/core/processors/processortags.h>                        // for Tags, Tags::GL
+#include <inviwo/core/properties/boolcompositeproperty.h>                // for BoolCompositePro...
+#include <inviwo/core/properties/invalidationlevel.h>                    // for InvalidationLevel
+#include <inviwo/core/properties/optionproperty.h>                       // for OptionPropertyOp...
+#include <inviwo/core/properties/ordinalproperty.h>                      // for FloatProperty
+#include <modules/basegl/processors/imageprocessing/imageglprocessor.h>  // for ImageGLProcessor
+#include <modules/opengl/shader/shader.h>                                // for Shader
+#include <modules/opengl/shader/shaderobject.h>                          // for ShaderObject
+#include <modules/opengl/shader/shaderutils.h>                           // for setUniforms
+
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+
+namespace inviwo {
+class TextureUnitContainer;
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo PostProcessingChain::processorInfo_{
+    "org.inviwo.PostProcessingChain",  // Class identifier
+    "Post Processing Chain",           // Display name
+    "Image Operation",                 // Category
+    CodeState::Experimental,           // Code state
+    Tags::GL,                          // Tags
+    R"(Applies tonemapping, brightness/contrast, hue/saturation/luminance, and opacity
+    adjustments to an image in a single pass. The enabled stages are applied in that order.
+    This gives the same result as chaining the corresponding processors, but only writes one
+    intermediate image instead of one per stage. Operations that need neighboring pixels,
+    like SSAO, bloom, and FXAA, are not part of the chain and should be applied with their
+    own processors.
+    )"_unindentHelp,
+};
+const ProcessorInfo& PostProcessingChain::getProcessorInfo() const { return processorInfo_; }
+
+PostProcessingChain::PostProcessingChain()
+    : ImageGLProcessor("postprocesschain.frag")
+    , tonemapping_("tonemapping", "Tonemapping", "Applies HDR tonemapping"_help, false)
+    , method_("method", "Method",
+              {{"none", "None", 0},
+               {"gamma", "Gamma", 1},
+               {"reinhard", "Reinhard", 2},
+               {"uncharted2", "Uncharted 2", 3}},
+              0, InvalidationLevel::InvalidResources)
+    , exposure_("exposure", "Exposure",
+                util::ordinalScale(1.f, 64.f).set("Controls exposure if the image."_help))
+    , gamma_("gamma", "Gamma",
+             util::ordinalScale(2.2f, 8.0f)
+                 .set("Controls the gamma (1.0 / gamma) (default is 2.2)."_help))
+    , brightnessContrast_("brightnessContrast", "Brightness Contrast",
+                          "out.rgb = (in.rgb - 0.5) * contrast + 0.5 + brightness"_help, false)
+    , brightness_("brightness", "Brightness", 0.f, -1.f, 1.f, 0.01f)
+    , contrast_("contrast", "Contrast", 1.f, 0.f, 2.f, 0.01f)
+    , hueSaturationLuminance_("hueSaturationLuminance", "Hue Saturation Luminance",
+                              "Offsets the color in HSL space"_help, false)
+    , hue_("hue", "Hue", 0.f, 0.f, 1.f, .01f)
+    , saturation_("sat", "Saturation", 0.f, -1.f, 1.f, .01f)
+    , luminance_("lum", "Luminance", 0.f, -1.f, 1.f, .01f)
+    , opacity_("opacity", "Opacity", "Replaces the alpha channel of the image"_help, false)
+    , alpha_("alpha", "Alpha", 1.0f, 0.0f, 1.f, 0.01f) {
+
+    tonemapping_.addProperties(method_, exposure_, gamma_);
+    brightnessContrast_.addProperties(brightness_, contrast_);
+    hueSaturationLuminance_.addProperties(hue_, saturation_, luminance_);
+    opacity_.addProperty(alpha_);
+    addProperties(tonemapping_, brightnessContrast_, hueSaturationLuminance_, opacity_);
+
+    gamma_.visibilityDependsOn(method_, [](const auto& p) { return p.get() != 0; });
+}
+
+void PostProcessingChain::initializeResources() {
+    auto* fso = shader_.getFragmentShaderObject();
+    fso->setShaderDefine("TONEMAPPING_METHOD", tonemapping_.isChecked(),
+                         std::to_string(method_.get()));
+    fso->setShaderDefine("BRIGHTNESS_CONTRAST", brightnessContrast_.isChecked());
+    fso->setShaderDefine("HUE_SATURATION_LUMINANCE", hueSaturationLuminance_.isChecked());
+    fso->setShaderDefine("OPACITY", opacity_.isChecked());
+    ImageGLProcessor::initializeResources();
+}
+
+void PostProcessingChain::preProcess(TextureUnitContainer&) {
+    utilgl::setUniforms(shader_, exposure_, gamma_, brightness_, contrast_, hue_, saturation_,
+                        luminance_, alpha_);
+}
+
+}  // namespace inviwo
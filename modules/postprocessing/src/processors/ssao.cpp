@@ -63,6 +63,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <inviwo/core/processors/processorinfo.h>                 // for ProcessorInfo
 #include <inviwo/core/processors/processorstate.h>                // for CodeState, CodeState::S...
 #include <inviwo/core/processors/processortags.h>                 // for Tags
+#include <inviwo/core/properties/boolcompositeproperty.h>         // for BoolCompositeProperty
 #include <inviwo/core/properties/boolproperty.h>                  // for BoolProperty
 #include <inviwo/core/properties/cameraproperty.h>                // for CameraProperty
 #include <inviwo/core/properties/invalidationlevel.h>             // for InvalidationLevel, Inva...
@@ -95,6 +96,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <glm/common.hpp>                // for clamp
 #include <glm/ext/scalar_constants.hpp>  // for pi
 #include <glm/mat4x4.hpp>                // for mat<>::col_type
+#include <glm/matrix.hpp>                // for inverse
 #include <glm/trigonometric.hpp>         // for radians, cos, sin
 #include <glm/vec2.hpp>                  // for vec<>::(anonymous)
 #include <glm/vec4.hpp>                  // for vec<>::(anonymous)
@@ -167,18 +169,39 @@ SSAO::SSAO()
           "blurSharpness", "Blur Sharpness",
           util::ordinalLength(40.f, 200.f)
               .set("Controls the sharpness of the blur, small number -> large filter"_help))
+    , resolution_("resolution", "Resolution",
+                  "Resolution of the ambient occlusion relative to the output. Reduced "
+                  "resolutions are upsampled with a depth-aware bilateral filter."_help,
+                  {{"full", "Full", 1}, {"half", "Half", 2}, {"quarter", "Quarter", 4}}, 0)
+    , temporal_("temporal", "Temporal Accumulation",
+                "Accumulates the ambient occlusion over several frames. Previous results are "
+                "reprojected into the current view, and rejected where the depth does not "
+                "match. The sample pattern is rotated between frames."_help,
+                false, InvalidationLevel::InvalidOutput)
+    , historyWeight_("historyWeight", "History Weight",
+                     util::ordinalScale(0.9f, 0.99f)
+                         .setMax(ConstraintBehavior::Immutable)
+                         .set("Weight of the accumulated result, higher values give smoother "
+                              "but slower adapting ambient occlusion"_help))
+    , depthTolerance_("depthTolerance", "Depth Tolerance",
+                      util::ordinalScale(0.05f, 1.0f)
+                          .set("Largest relative depth difference for which a reprojected "
+                               "result is reused"_help))
     , camera_("camera", "Camera")
     , depthLinearize_("fullscreenquad.vert", "depthlinearize.frag", Shader::Build::No)
     , hbaoCalc_("fullscreenquad.vert", "hbao.frag", Shader::Build::No)
     , hbaoCalcBlur_("fullscreenquad.vert", "hbao.frag", Shader::Build::No)
     , hbaoBlurHoriz_("fullscreenquad.vert", "hbao_blur.frag", Shader::Build::No)
     , hbaoBlurVert_("fullscreenquad.vert", "hbao_blur.frag", Shader::Build::No)
+    , hbaoTemporal_("fullscreenquad.vert", "hbao_temporal.frag", Shader::Build::No)
+    , hbaoUpsample_("fullscreenquad.vert", "hbao_upsample.frag", Shader::Build::No)
     , hbaoUbo_(0) {
 
     addPort(inport_);
     addPort(outport_);
+    temporal_.addProperties(historyWeight_, depthTolerance_);
     addProperties(enable_, technique_, radius_, intensity_, bias_, directions_, steps_, useNormal_,
-                  blurSharpness_, enableBlur_, camera_);
+                  blurSharpness_, enableBlur_, resolution_, temporal_, camera_);
 
     initHbao();
 
@@ -191,6 +214,8 @@ SSAO::SSAO()
     hbaoCalcBlur_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
     hbaoBlurHoriz_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
     hbaoBlurVert_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
+    hbaoTemporal_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
+    hbaoUpsample_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
     inport_.onChange([this]() {
         const DataFormatBase* format = inport_.getData()->getDataFormat();
         const auto swizzleMask = inport_.getData()->getColorLayer()->getSwizzleMask();
@@ -211,10 +236,13 @@ SSAO::SSAO()
 SSAO::~SSAO() {
     delFramebuffer(framebuffers_.depthLinear);
     delFramebuffer(framebuffers_.hbaoCalc);
+    delFramebuffer(framebuffers_.temporal);
 
     delTexture(textures_.depthLinear);
     delTexture(textures_.hbaoResult);
     delTexture(textures_.hbaoBlur);
+    delTexture(textures_.history[0]);
+    delTexture(textures_.history[1]);
     delTexture(textures_.hbaoRandom);
 
     delBuffer(hbaoUbo_);
@@ -244,13 +272,17 @@ void SSAO::initializeResources() {
     hbaoBlurHoriz_.build();
     hbaoBlurVert_[ShaderType::Fragment]->addShaderDefine("AO_BLUR_PRESENT", "1");
     hbaoBlurVert_.build();
+    hbaoTemporal_.build();
+    hbaoUpsample_.build();
 
     locations_.depthLinearClipInfo = glGetUniformLocation(depthLinearize_.getID(), "clipInfo");
     locations_.depthLinearInputTexture =
         glGetUniformLocation(depthLinearize_.getID(), "inputTexture");
+    locations_.depthLinearDownsample = glGetUniformLocation(depthLinearize_.getID(), "downsample");
     locations_.hbaoControlBuffer = glGetUniformBlockIndex(hbaoCalc_.getID(), "controlBuffer");
     locations_.hbaoTexLinearDepth = glGetUniformLocation(hbaoCalc_.getID(), "texLinearDepth");
     locations_.hbaoTexRandom = glGetUniformLocation(hbaoCalc_.getID(), "texRandom");
+    locations_.hbaoJitterOffset = glGetUniformLocation(hbaoCalc_.getID(), "jitterOffset");
     locations_.hbaoBlurSharpness = glGetUniformLocation(hbaoBlurHoriz_.getID(), "g_Sharpness");
     locations_.hbaoBlurInvResolutionDirection =
         glGetUniformLocation(hbaoBlurHoriz_.getID(), "g_InvResolutionDirection");
@@ -266,8 +298,11 @@ void SSAO::process() {
     int width = static_cast<int>(outport_.getDimensions().x);
     int height = static_cast<int>(outport_.getDimensions().y);
 
-    if (framebuffers_.width != width || framebuffers_.height != height) {
-        initFramebuffers(width, height);
+    const int factor = resolution_.get();
+    const int aoWidth = (width + factor - 1) / factor;
+    const int aoHeight = (height + factor - 1) / factor;
+    if (framebuffers_.width != aoWidth || framebuffers_.height != aoHeight) {
+        initFramebuffers(aoWidth, aoHeight);
     }
 
     projParam_.nearplane = camera_.getNearPlaneDist();
@@ -297,7 +332,12 @@ void SSAO::process() {
         // drawcalls
         auto rect = SharedOpenGLResources::getPtr()->imagePlaneRect();
         utilgl::Enable<MeshGL> enable(rect);
-        drawHbaoClassic(outFbo, depthTex, projParam_, width, height);
+        if (factor == 1 && !temporal_.isChecked()) {
+            history_.valid = false;
+            drawHbaoClassic(outFbo, depthTex, projParam_, width, height);
+        } else {
+            drawHbaoUpsampled(outFbo, depthTex, projParam_, width, height);
+        }
     }
 }
 
@@ -390,6 +430,26 @@ void SSAO::initFramebuffers(int width, int height) {
     glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, textures_.hbaoResult, 0);
     glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, textures_.hbaoBlur, 0);
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // ambient occlusion and depth accumulated over frames, used as ping-pong buffers
+    for (auto& history : textures_.history) {
+        newTexture(history);
+        glBindTexture(GL_TEXTURE_2D, history);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RG16F, width, height);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    newFramebuffer(framebuffers_.temporal);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffers_.temporal);
+    glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, textures_.history[0], 0);
+    glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, textures_.history[1], 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    history_.valid = false;
 }
 
 void SSAO::prepareHbaoData(const ProjectionParam& proj, int width, int height) {
@@ -447,7 +507,7 @@ void SSAO::prepareHbaoData(const ProjectionParam& proj, int width, int height) {
     }
 }
 
-void SSAO::drawLinearDepth(GLuint depthTex, const ProjectionParam& proj) {
+void SSAO::drawLinearDepth(GLuint depthTex, const ProjectionParam& proj, int downsample) {
     glBindFramebuffer(GL_FRAMEBUFFER, framebuffers_.depthLinear);
     glDrawBuffer(GL_COLOR_ATTACHMENT0);
 
@@ -455,6 +515,7 @@ void SSAO::drawLinearDepth(GLuint depthTex, const ProjectionParam& proj) {
     glUniform4f(locations_.depthLinearClipInfo, proj.nearplane * proj.farplane,
                 proj.nearplane - proj.farplane, proj.farplane, proj.ortho ? 0.0f : 1.0f);
     glUniform1i(locations_.depthLinearInputTexture, 0);
+    glUniform1i(locations_.depthLinearDownsample, downsample);
 
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, depthTex);
@@ -462,6 +523,32 @@ void SSAO::drawLinearDepth(GLuint depthTex, const ProjectionParam& proj) {
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
+void SSAO::drawHbaoCalc(Shader& shader) {
+    shader.activate();
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, hbaoUbo_);
+    glBindBuffer(GL_UNIFORM_BUFFER, hbaoUbo_);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(HBAOData), &hbaoUboData_);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    // Uniform Bindings
+    glUniformBlockBinding(shader.getID(), locations_.hbaoControlBuffer, 0);
+    glUniform1i(locations_.hbaoTexLinearDepth, 0);
+    glUniform1i(locations_.hbaoTexRandom, 1);
+
+    // Rotate the jitter pattern every frame when accumulating, such that each pixel sees all the
+    // sample directions over HBAO_RANDOM_ELEMENTS frames
+    const int offset = temporal_.isChecked() ? history_.frame % HBAO_RANDOM_ELEMENTS : 0;
+    glUniform2f(locations_.hbaoJitterOffset, static_cast<float>(offset % HBAO_RANDOM_SIZE),
+                static_cast<float>(offset / HBAO_RANDOM_SIZE));
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, textures_.depthLinear);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, textures_.hbaoRandom);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
 void SSAO::drawHbaoClassic(GLuint fboOut, GLuint depthTex, const ProjectionParam& proj, int width,
                            int height) {
     prepareHbaoData(proj, width, height);
@@ -485,31 +572,7 @@ void SSAO::drawHbaoClassic(GLuint fboOut, GLuint depthTex, const ProjectionParam
         glBlendFunc(GL_ZERO, GL_SRC_COLOR);
     }
 
-    GLuint program = 0;
-
-    if (blur) {
-        hbaoCalcBlur_.activate();
-        program = hbaoCalcBlur_.getID();
-    } else {
-        hbaoCalc_.activate();
-        program = hbaoCalc_.getID();
-    }
-
-    glBindBufferBase(GL_UNIFORM_BUFFER, 0, hbaoUbo_);
-    glBindBuffer(GL_UNIFORM_BUFFER, hbaoUbo_);
-    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(HBAOData), &hbaoUboData_);
-    glBindBuffer(GL_UNIFORM_BUFFER, 0);
-
-    // Uniform Bindings
-    glUniformBlockBinding(program, locations_.hbaoControlBuffer, 0);
-    glUniform1i(locations_.hbaoTexLinearDepth, 0);
-    glUniform1i(locations_.hbaoTexRandom, 1);
-
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, textures_.depthLinear);
-    glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_2D, textures_.hbaoRandom);
-    glDrawArrays(GL_TRIANGLES, 0, 3);
+    drawHbaoCalc(blur ? hbaoCalcBlur_ : hbaoCalc_);
 
     if (blur) drawHbaoBlur(fboOut, proj, width, height);
 
@@ -563,4 +626,113 @@ void SSAO::drawHbaoBlur(GLuint fboOut, const ProjectionParam& /*proj*/, int widt
     glDrawArrays(GL_TRIANGLES, 0, 3);
 }
 
+void SSAO::drawHbaoUpsampled(GLuint fboOut, GLuint depthTex, const ProjectionParam& proj,
+                             int width, int height) {
+    const int aoWidth = framebuffers_.width;
+    const int aoHeight = framebuffers_.height;
+
+    prepareHbaoData(proj, aoWidth, aoHeight);
+    glViewport(0, 0, aoWidth, aoHeight);
+    drawLinearDepth(depthTex, proj, resolution_.get());
+
+    glColorMask(1, 1, 1, 0);
+
+    // Ambient occlusion together with the linear depth, needed for the bilateral filters
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffers_.hbaoCalc);
+    glDrawBuffer(GL_COLOR_ATTACHMENT0);
+    drawHbaoCalc(hbaoCalcBlur_);
+
+    if (enableBlur_.get()) {
+        const auto sharpness = blurSharpness_.get();
+
+        // Horizontal pass into hbaoBlur, vertical pass back into hbaoResult. Both passes keep
+        // the depth in the second channel.
+        hbaoBlurHoriz_.activate();
+        glUniform1f(locations_.hbaoBlurSharpness, sharpness);
+        glUniform1i(locations_.hbaoBlurTexSource, 0);
+        glActiveTexture(GL_TEXTURE0);
+
+        glDrawBuffer(GL_COLOR_ATTACHMENT1);
+        glBindTexture(GL_TEXTURE_2D, textures_.hbaoResult);
+        glUniform2f(locations_.hbaoBlurInvResolutionDirection, 1.0f / float(aoWidth), 0);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        glDrawBuffer(GL_COLOR_ATTACHMENT0);
+        glBindTexture(GL_TEXTURE_2D, textures_.hbaoBlur);
+        glUniform2f(locations_.hbaoBlurInvResolutionDirection, 0, 1.0f / float(aoHeight));
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    GLuint aoTex = textures_.hbaoResult;
+    if (temporal_.isChecked()) {
+        drawHbaoTemporal(proj);
+        aoTex = textures_.history[history_.index];
+    } else {
+        history_.valid = false;
+    }
+
+    // Depth-aware upsampling to the output, multiplied onto the input color
+    glViewport(0, 0, width, height);
+    glBindFramebuffer(GL_FRAMEBUFFER, fboOut);
+    glDrawBuffer(GL_COLOR_ATTACHMENT0);
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ZERO, GL_SRC_COLOR);
+
+    hbaoUpsample_.activate();
+    hbaoUpsample_.setUniform("texAO", 0);
+    hbaoUpsample_.setUniform("texDepth", 1);
+    hbaoUpsample_.setUniform("clipInfo", vec4{proj.nearplane * proj.farplane,
+                                              proj.nearplane - proj.farplane, proj.farplane,
+                                              proj.ortho ? 0.0f : 1.0f});
+    hbaoUpsample_.setUniform("sharpness", blurSharpness_.get());
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, aoTex);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, depthTex);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    glEnable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glColorMask(1, 1, 1, 1);
+
+    glUseProgram(0);
+}
+
+void SSAO::drawHbaoTemporal(const ProjectionParam& proj) {
+    const mat4& view = camera_.viewMatrix();
+    const int previous = history_.index;
+    const int current = 1 - previous;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffers_.temporal);
+    glDrawBuffer(GL_COLOR_ATTACHMENT0 + current);
+
+    hbaoTemporal_.activate();
+    hbaoTemporal_.setUniform("texCurrent", 0);
+    hbaoTemporal_.setUniform("texHistory", 1);
+    hbaoTemporal_.setUniform("projInfo", hbaoUboData_.projInfo);
+    hbaoTemporal_.setUniform("projOrtho", hbaoUboData_.projOrtho);
+    hbaoTemporal_.setUniform("currentToPreviousView", history_.view * glm::inverse(view));
+    hbaoTemporal_.setUniform("previousProjection", history_.projection);
+    hbaoTemporal_.setUniform("historyWeight", historyWeight_.get());
+    hbaoTemporal_.setUniform("depthTolerance", depthTolerance_.get());
+    hbaoTemporal_.setUniform("historyValid", history_.valid ? 1 : 0);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, textures_.hbaoResult);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, textures_.history[previous]);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    history_.view = view;
+    history_.projection = proj.matrix;
+    history_.index = current;
+    history_.valid = true;
+    ++history_.frame;
+}
+
 }  // namespace inviwo
@@ -34,8 +34,20 @@
 #include <pybind11/pybind11.h>
 #include <warn/pop>
 
+#include <inviwo/core/util/glmmat.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <tuple>
+
 namespace inviwo {
 
+/**
+ * The value types of the OrdinalProperty classes exposed to python
+ */
+using OrdinalPropertyTypes =
+    std::tuple<float, int, size_t, glm::i64, double, vec2, vec3, vec4, dvec2, dvec3, dvec4, ivec2,
+               ivec3, ivec4, size2_t, size3_t, size4_t, mat2, mat3, mat4, dmat2, dmat3, dmat4>;
+
 void exposeOrdinalProperties(pybind11::module& m);
 
 }  // namespace inviwo
@@ -109,10 +109,7 @@ struct OrdinalPropertyHelper {
 };
 
 void exposeOrdinalProperties(py::module& m) {
-    using OrdinalPropetyTypes = std::tuple<float, int, size_t, glm::i64, double, vec2, vec3, vec4,
-                                           dvec2, dvec3, dvec4, ivec2, ivec3, ivec4, size2_t,
-                                           size3_t, size4_t, mat2, mat3, mat4, dmat2, dmat3, dmat4>;
-    util::for_each_type<OrdinalPropetyTypes>{}(OrdinalPropertyHelper{}, m);
+    util::for_each_type<OrdinalPropertyTypes>{}(OrdinalPropertyHelper{}, m);
 }
 
 }  // namespace inviwo
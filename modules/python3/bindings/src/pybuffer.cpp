@@ -142,8 +142,11 @@ void exposeBuffer(pybind11::module& m) {
                     strides.push_back(df->getSizeInBytes() / df->getComponents());
                 }
 
-                auto data = buffer->getEditableRepresentation<BufferRAM>()->getData();
-                return py::array(pyutil::toNumPyFormat(df), shape, strides, data, py::cast<>(1));
+                // A view of the RAM representation that keeps it alive
+                buffer->getEditableRepresentation<BufferRAM>();
+                auto ram = buffer->getRepresentationShared<BufferRAM>();
+                return py::array(pyutil::toNumPyFormat(df), shape, strides, ram->getData(),
+                                 pyutil::keepAlive(ram));
             },
             [](BufferBase* buffer, py::array data) {
                 auto rep = buffer->getEditableRepresentation<BufferRAM>();
@@ -194,8 +194,11 @@ void exposeImage(py::module& m) {
                     strides.push_back(df->getSizeInBytes() / df->getComponents());
                 }
 
-                auto data = layer->getEditableRepresentation<LayerRAM>()->getData();
-                return py::array(pyutil::toNumPyFormat(df), shape, strides, data, py::cast<>(1));
+                // A view of the RAM representation that keeps it alive
+                layer->getEditableRepresentation<LayerRAM>();
+                auto ram = layer->getRepresentationShared<LayerRAM>();
+                return py::array(pyutil::toNumPyFormat(df), shape, strides, ram->getData(),
+                                 pyutil::keepAlive(ram));
             },
             [](Layer* layer, py::array data) {
                 auto rep = layer->getEditableRepresentation<LayerRAM>();
@@ -45,11 +45,15 @@
 #include <inviwo/core/util/settings/settings.h>
 #include <inviwo/core/properties/propertyfactory.h>
 #include <inviwo/core/processors/processorfactory.h>
+#include <inviwo/core/resourcemanager/resourcemanager.h>
 
 #include <modules/python3/polymorphictypehooks.h>
 
 #include <inviwo/core/util/filesystem.h>
 
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
 namespace inviwo {
 
 class ModuleIdentifierWrapper {
@@ -156,6 +160,47 @@ void exposeInviwoApplication(pybind11::module& m) {
 
     exposeModuleIdentifierWrapper(m, "ModuleIdentifierWrapper");
 
+    const auto groupIndex = [](std::string_view group) -> size_t {
+        const auto it = std::ranges::find(ResourceManager::names, group);
+        if (it == ResourceManager::names.end()) {
+            throw py::key_error(fmt::format("Unknown resource group '{}', expected one of {}",
+                                            group, ResourceManager::names));
+        }
+        return static_cast<size_t>(std::distance(ResourceManager::names.begin(), it));
+    };
+
+    py::classh<ResourceManager>(m, "ResourceManager")
+        .def_property_readonly_static(
+            "groups",
+            [](py::object) {
+                return std::vector<std::string>(ResourceManager::names.begin(),
+                                                ResourceManager::names.end());
+            })
+        .def("size",
+             [groupIndex](const ResourceManager& rm, std::string_view group) {
+                 return rm.size(groupIndex(group));
+             })
+        .def("totalByteSize",
+             [groupIndex](const ResourceManager& rm, std::string_view group) {
+                 return rm.totalByteSize(groupIndex(group));
+             })
+        .def(
+            "bytesPerProcessor",
+            [groupIndex](const ResourceManager& rm, std::string_view group) {
+                return rm.bytesPerProcessor(groupIndex(group));
+            },
+            "List of (processor identifier, bytes) of the resources in group, largest first")
+        .def(
+            "setWarningThreshold",
+            [groupIndex](ResourceManager& rm, std::string_view group, size_t bytes) {
+                rm.setWarningThreshold(groupIndex(group), bytes);
+            },
+            py::arg("group"), py::arg("bytes"))
+        .def("getWarningThreshold",
+             [groupIndex](const ResourceManager& rm, std::string_view group) {
+                 return rm.getWarningThreshold(groupIndex(group));
+             });
+
     py::classh<InviwoApplication>(m, "InviwoApplication", py::multiple_inheritance{})
         .def(py::init<>())
         .def(py::init<std::string>())
@@ -207,6 +252,10 @@ void exposeInviwoApplication(pybind11::module& m) {
         .def_property_readonly("dataWriterFactory", &InviwoApplication::getDataReaderFactory,
                                py::return_value_policy::reference)
 
+        .def_property_readonly("resourceManager", &InviwoApplication::getResourceManager,
+                               "The resources tracked when the resource tracking system setting "
+                               "is enabled",
+                               py::return_value_policy::reference)
         .def_property_readonly("processorFactory", &InviwoApplication::getProcessorFactory,
                                py::return_value_policy::reference)
         .def_property_readonly("propertyFactory", &InviwoApplication::getPropertyFactory,
@@ -30,6 +30,7 @@
 #include <inviwopy/pynetwork.h>
 #include <inviwopy/pyglmtypes.h>
 #include <inviwopy/vectoridentifierwrapper.h>
+#include <inviwopy/properties/pyordinalproperties.h>
 
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
@@ -38,6 +39,7 @@
 
 #include <inviwo/core/network/portconnection.h>
 #include <inviwo/core/network/networkutils.h>
+#include <inviwo/core/network/networklock.h>
 #include <inviwo/core/links/propertylink.h>
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/network/workspacemanager.h>
@@ -46,13 +48,64 @@
 #include <inviwo/core/ports/outport.h>
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/processors/canvasprocessor.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/util/foreacharg.h>
+#include <inviwo/core/util/glmutils.h>
 
 #include <modules/python3/polymorphictypehooks.h>
 
+#include <glm/gtc/type_ptr.hpp>
+
+#include <optional>
+#include <utility>
+#include <vector>
+
 namespace py = pybind11;
 
 namespace inviwo {
 
+namespace {
+
+Property* findProperty(ProcessorNetwork& network, std::string_view path) {
+    if (auto* property = network.getProperty(path)) return property;
+    throw py::key_error{fmt::format("ProcessorNetwork does not have a property at: '{}'", path)};
+}
+
+struct OrdinalToArray {
+    template <typename T>
+    void operator()(const Property* property, std::optional<py::array>& result) {
+        if (result) return;
+        if (const auto* ordinal = dynamic_cast<const OrdinalProperty<T>*>(property)) {
+            using V = util::value_type_t<T>;
+            const T& value = ordinal->get();
+            if constexpr (util::rank_v<T> == 0) {
+                result = py::array_t<V>(std::vector<size_t>{}, &value);
+            } else if constexpr (util::rank_v<T> == 1) {
+                result = py::array_t<V>(util::extent_v<T>, glm::value_ptr(value));
+            } else {
+                result = py::array_t<V>(
+                    std::vector<size_t>{util::extent_v<T, 1>, util::extent_v<T, 0>},
+                    glm::value_ptr(value));
+            }
+        }
+    }
+};
+
+py::object propertyValue(Property* property) {
+    std::optional<py::array> array;
+    util::for_each_type<OrdinalPropertyTypes>{}(OrdinalToArray{}, property, array);
+    if (array) return std::move(*array);
+
+    auto pyProperty = py::cast(property, py::return_value_policy::reference);
+    if (!py::hasattr(pyProperty, "value")) {
+        throw py::type_error{fmt::format("Property '{}' does not have a value",
+                                         property->getPath())};
+    }
+    return pyProperty.attr("value");
+}
+
+}  // namespace
+
 void exposeNetwork(py::module& m) {
     py::classh<PortConnection>(m, "PortConnection")
         .def(py::init<Outport*, Inport*>())
@@ -68,6 +121,24 @@ void exposeNetwork(py::module& m) {
         .def_property_readonly("destination", &PropertyLink::getDestination,
                                py::return_value_policy::reference);
 
+    // Context manager for ProcessorNetwork::beginBatch / endBatch
+    // with network.batch():
+    //     for p in props: p.value = 1
+    struct NetworkBatchContext {
+        ProcessorNetwork* network;
+    };
+    py::classh<NetworkBatchContext>(m, "NetworkBatch")
+        .def(py::init([](ProcessorNetwork* network) { return NetworkBatchContext{network}; }))
+        .def("__enter__",
+             [](NetworkBatchContext& batch) -> NetworkBatchContext& {
+                 batch.network->beginBatch();
+                 return batch;
+             },
+             py::return_value_policy::reference_internal)
+        .def("__exit__", [](NetworkBatchContext& batch, py::object, py::object, py::object) {
+            batch.network->endBatch();
+        });
+
     using ProcessorIt = decltype(std::declval<ProcessorNetwork>().processorRange().begin());
     using ProcessorVecWrapper = VectorIdentifierWrapper<ProcessorIt, false>;
     exposeVectorIdentifierWrapper<ProcessorIt, false>(m, "ProcessorVecWrapper");
@@ -159,7 +230,55 @@ void exposeNetwork(py::module& m) {
         .def("unlock", &ProcessorNetwork::unlock)
         .def("isLocked", &ProcessorNetwork::islocked)
         .def_property_readonly("locked", &ProcessorNetwork::islocked)
+        .def("beginBatch", &ProcessorNetwork::beginBatch)
+        .def("endBatch", &ProcessorNetwork::endBatch)
+        .def_property_readonly("batching", &ProcessorNetwork::isBatching)
+        .def("batch", [](ProcessorNetwork* pn) { return NetworkBatchContext{pn}; },
+             "Context manager that batches property changes and evaluates the network once")
         .def_property_readonly("deserializing", &ProcessorNetwork::isDeserializing)
+        .def(
+            "setProperties",
+            [](ProcessorNetwork* network, const py::dict& values, bool wait) {
+                // Resolve all paths before modifying anything
+                std::vector<std::pair<Property*, py::handle>> properties;
+                properties.reserve(values.size());
+                for (auto&& [path, value] : values) {
+                    properties.emplace_back(findProperty(*network, path.cast<std::string>()),
+                                            value);
+                }
+                {
+                    const NetworkBatch batch{network};
+                    for (auto&& [property, value] : properties) {
+                        py::cast(property, py::return_value_policy::reference).attr("value") =
+                            value;
+                    }
+                }
+                if (wait && network->runningBackgroundJobs() > 0) {
+                    const py::gil_scoped_release release{};
+                    network->getApplication()->waitForPool();
+                }
+            },
+            py::arg("values"), py::arg("wait") = true,
+            R"(Set the values of many properties given as {path: value} with a single network
+             evaluation. All paths are resolved before any value is changed. When wait is True,
+             the call returns once the evaluation, including any background jobs, has finished.)")
+        .def(
+            "getProperties",
+            [](ProcessorNetwork* network, const std::vector<std::string>& paths) {
+                std::vector<Property*> properties;
+                properties.reserve(paths.size());
+                for (const auto& path : paths) {
+                    properties.push_back(findProperty(*network, path));
+                }
+                py::dict result;
+                for (size_t i = 0; i < paths.size(); ++i) {
+                    result[py::str(paths[i])] = propertyValue(properties[i]);
+                }
+                return result;
+            },
+            py::arg("paths"),
+            R"(Get the values of many properties as {path: value}. The values of ordinal
+             properties are returned as numpy arrays, with zero dimensions for scalars.)")
 
         .def("clear",
              [&](ProcessorNetwork* pn) { pn->getApplication()->getWorkspaceManager()->clear(); })
@@ -45,6 +45,7 @@
 #include <inviwo/core/processors/processorinfo.h>      // for ProcessorInfo
 #include <inviwo/core/properties/invalidationlevel.h>  // for InvalidationLevel
 #include <inviwo/core/processors/canvasprocessor.h>
+#include <inviwo/core/processors/poolprocessor.h>
 #include <inviwo/core/processors/processorfactory.h>
 #include <inviwo/core/processors/processorfactoryobject.h>
 #include <inviwo/core/processors/processorwidget.h>
@@ -60,6 +61,9 @@
 #include <inviwo/core/util/filesystem.h>
 #include <inviwo/core/util/rendercontext.h>
 #include <modules/python3/processortrampoline.h>
+#include <modules/python3/poolprocessortrampoline.h>
+#include <modules/python3/pybindflags.h>
+#include <modules/python3/pybindutils.h>
 #include <modules/python3/opaquetypes.h>
 #include <modules/python3/polymorphictypehooks.h>
 
@@ -305,6 +309,62 @@ void exposeProcessors(pybind11::module& m) {
         .def("serialize", &Processor::serialize)
         .def("deserialize", &Processor::deserialize);
 
+    py::enum_<pool::Option> poolOption(m, "PoolOption");
+    poolOption.value("KeepOldResults", pool::Option::KeepOldResults)
+        .value("QueuedDispatch", pool::Option::QueuedDispatch)
+        .value("DelayDispatch", pool::Option::DelayDispatch)
+        .value("DelayInvalidation", pool::Option::DelayInvalidation)
+        .value("Interactive", pool::Option::Interactive)
+        .value("Background", pool::Option::Background);
+    exposeFlags<pool::Option>(m, poolOption, "PoolOptions");
+
+    py::classh<pool::Stop>(m, "PoolStop").def("__bool__", [](const pool::Stop& stop) {
+        return static_cast<bool>(stop);
+    });
+    py::classh<pool::Progress>(m, "PoolProgress")
+        .def("__call__", [](const pool::Progress& progress, double p) { progress(p); })
+        .def("__call__",
+             [](const pool::Progress& progress, size_t i, size_t max) { progress(i, max); });
+
+    py::classh<PoolProcessor, Processor, PoolProcessorTrampoline>(
+        m, "PoolProcessor", py::multiple_inheritance{}, py::dynamic_attr{})
+        .def(py::init<pool::Options, const std::string&, const std::string&>(),
+             py::arg("options") = pool::Options{flags::empty}, py::arg("identifier") = "",
+             py::arg("displayName") = "")
+        .def("stopJobs", &PoolProcessor::stopJobs)
+        .def("hasJobs", &PoolProcessor::hasJobs)
+        .def(
+            "dispatchOne",
+            [](PoolProcessor& p, py::function job, py::function done) {
+                // The job runs in the thread pool and only holds the GIL while executing python
+                // code, done is called with the result on the main thread. All python objects are
+                // wrapped to make sure the GIL is held whenever they are released.
+                auto calc = [job = pyutil::makeGILSafe(std::move(job))](
+                                pool::Stop stop,
+                                pool::Progress progress) -> std::shared_ptr<py::object> {
+                    const py::gil_scoped_acquire gil;
+                    return pyutil::makeGILSafe((*job)(stop, progress));
+                };
+                p.dispatchOne(calc, [done = pyutil::makeGILSafe(std::move(done))](
+                                        std::shared_ptr<py::object> result) {
+                    const py::gil_scoped_acquire gil;
+                    (*done)(*result);
+                });
+            },
+            py::arg("job"), py::arg("done"),
+            R"doc(
+Run job(stop, progress) in a background thread and call done(result) with the returned value on
+the main thread. Only the latest dispatched job will call done unless the KeepOldResults option
+is used. stop evaluates to True if the job has been canceled, and progress can be called with a
+value in [0, 1] to update the progress bar. The GIL is only held while executing python code, use
+numpy or other libraries that release the GIL for the heavy lifting to not block the main thread.
+)doc")
+        .def("newResults", py::overload_cast<>(&PoolProcessor::newResults))
+        .def("newResults",
+             py::overload_cast<const std::vector<Outport*>&>(&PoolProcessor::newResults))
+        .def_property_readonly("error", &PoolProcessor::error)
+        .def_property_readonly("options", &PoolProcessor::getOptions);
+
     py::classh<CanvasProcessor, Processor>(m, "CanvasProcessor")
         .def_property("size", &CanvasProcessor::getCanvasSize, &CanvasProcessor::setCanvasSize)
         .def("getUseCustomDimensions", &CanvasProcessor::getUseCustomDimensions)
@@ -58,6 +58,26 @@ namespace inviwo {
 void exposeVolume(pybind11::module& m) {
     namespace py = pybind11;
 
+    // A view of the RAM representation that keeps it alive, no copy involved
+    const auto view = [](const Volume& volume, std::shared_ptr<const VolumeRAM> ram,
+                         bool writeable) {
+        const auto* df = volume.getDataFormat();
+        const auto dims = volume.getDimensions();
+        const auto bytes = df->getSizeInBytes();
+
+        std::vector<size_t> shape = {dims.z, dims.y, dims.x};
+        std::vector<size_t> strides = {bytes * dims.x * dims.y, bytes * dims.x, bytes};
+        if (df->getComponents() > 1) {
+            shape.push_back(df->getComponents());
+            strides.push_back(bytes / df->getComponents());
+        }
+
+        py::array array(pyutil::toNumPyFormat(df), shape, strides, ram->getData(),
+                        pyutil::keepAlive(std::move(ram)));
+        if (!writeable) array.attr("setflags")(py::arg("write") = false);
+        return array;
+    };
+
     py::classh<Volume>(m, "Volume")
         .def(py::init<std::shared_ptr<VolumeRepresentation>>())
         .def(py::init<size3_t, const DataFormatBase*, const SwizzleMask&, InterpolationType,
@@ -66,7 +86,15 @@ void exposeVolume(pybind11::module& m) {
              py::arg("interpolation") = InterpolationType::Linear,
              py::arg("wrapping") = wrapping3d::clampAll)
         .def(py::init([](py::array data) { return pyutil::createVolume(data).release(); }))
-        .def("clone", [](Volume& self) { return self.clone(); })
+        .def("clone",
+             [](Volume& self) {
+                 // Numpy views of the data are writable, so python gets a deep copy rather than
+                 // one sharing the representations copy-on-write
+                 auto* copy = new Volume(self, noData);
+                 copy->addRepresentation(
+                     std::shared_ptr<VolumeRAM>(self.getRepresentation<VolumeRAM>()->clone()));
+                 return copy;
+             })
         .def_property("modelMatrix", &Volume::getModelMatrix, &Volume::setModelMatrix)
         .def_property("worldMatrix", &Volume::getWorldMatrix, &Volume::setWorldMatrix)
         .def_property("basis", &Volume::getBasis, &Volume::setBasis)
@@ -95,9 +123,9 @@ void exposeVolume(pybind11::module& m) {
             pybind11::return_value_policy::reference_internal)
         .def_property(
             "data",
-            [&](Volume* volume) -> py::array {
-                auto rep = volume->getRepresentation<VolumePy>();
-                return rep->data();
+            [view](const Volume* volume) {
+                // Read only, to not invalidate the other representations of an input volume
+                return view(*volume, volume->getRepresentationShared<VolumeRAM>(), false);
             },
             [](Volume* volume, py::array data) {
                 if (volume->hasRepresentation<VolumePy>()) {
@@ -109,6 +137,15 @@ void exposeVolume(pybind11::module& m) {
                 volume->addRepresentation(rep);
                 volume->invalidateAllOther(rep.get());
             })
+        .def(
+            "getEditableData",
+            [view](Volume* volume) {
+                // Invalidates all the other representations, and detaches a shared one
+                volume->getEditableRepresentation<VolumeRAM>();
+                return view(*volume, volume->getRepresentationShared<VolumeRAM>(), true);
+            },
+            "A writable view of the data, unlike the data property. Changes all other "
+            "representations of the volume to invalid.")
         .def("__repr__", [](const Volume& volume) {
             return fmt::format(
                 "<Volume: {} {} dataRange: {} valueRange: {} value: {}{: [}\n"
@@ -101,12 +101,15 @@ private:
 
     pybind11::array data_;
     size2_t dims_;
+    // Cached to not have to acquire the GIL every time the format is queried
+    const DataFormatBase* format_;
 };
 #include <warn/pop>
 
 class IVW_MODULE_PYTHON3_API LayerRAM2PyConverter
     : public RepresentationConverterType<LayerRepresentation, LayerRAM, LayerPy> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<LayerPy> createFrom(
         std::shared_ptr<const LayerRAM> source) const override;
     virtual void update(std::shared_ptr<const LayerRAM> source,
@@ -116,6 +119,7 @@ public:
 class IVW_MODULE_PYTHON3_API LayerPy2RAMConverter
     : public RepresentationConverterType<LayerRepresentation, LayerPy, LayerRAM> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<LayerRAM> createFrom(
         std::shared_ptr<const LayerPy> source) const override;
     virtual void update(std::shared_ptr<const LayerPy> source,
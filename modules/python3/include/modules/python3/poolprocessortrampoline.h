@@ -0,0 +1,82 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/python3/python3moduledefine.h>  // for IVW_MODULE_PYTHON3_API
+
+#include <pybind11/trampoline_self_life_support.h>  // for trampoline_self_life_support
+
+#include <inviwo/core/processors/poolprocessor.h>      // for PoolProcessor
+#include <inviwo/core/processors/processorinfo.h>      // for ProcessorInfo
+#include <inviwo/core/properties/invalidationlevel.h>  // for InvalidationLevel
+
+#include <optional>
+
+namespace inviwo {
+
+class Event;
+class Outport;
+class Property;
+
+/*
+ * Trampoline for python processors deriving from PoolProcessor. Such processors can use
+ * dispatchOne to run work in the thread pool, and will only hold the GIL while running python
+ * code in the background thread. See ProcessorTrampoline for why the class is exported.
+ */
+#include <warn/push>
+#include <warn/ignore/dll-interface-base>
+#include <warn/ignore/attributes>
+class IVW_MODULE_PYTHON3_API PoolProcessorTrampoline
+    : public PoolProcessor,
+      public pybind11::trampoline_self_life_support {
+public:
+    // Inherit the constructors
+    using PoolProcessor::PoolProcessor;
+
+    // Trampoline (need one for each virtual function)
+    virtual void initializeResources() override;
+    virtual void process() override;
+    virtual void doIfNotReady() override;
+    virtual void setValid() override;
+    virtual void invalidate(InvalidationLevel invalidationLevel,
+                            Property* modifiedProperty = nullptr) override;
+    virtual const ProcessorInfo& getProcessorInfo() const override;
+    virtual void invokeEvent(Event* event) override;
+    virtual void propagateEvent(Event* event, Outport* source) override;
+
+    virtual void serialize(Serializer& s) const override;
+    virtual void deserialize(Deserializer& d) override;
+
+private:
+    mutable std::optional<ProcessorInfo> info_;
+};
+#include <warn/pop>
+
+}  // namespace inviwo
@@ -40,7 +40,7 @@
 #include <inviwo/core/util/stringconversion.h>  // for toString
 
 #include <cstddef>  // for size_t
-#include <memory>   // for allocator, unique_ptr
+#include <memory>   // for allocator, unique_ptr, shared_ptr
 #include <string>   // for string, operator+, char_traits
 #include <vector>   // for vector
 
@@ -59,6 +59,13 @@ IVW_MODULE_PYTHON3_API std::unique_ptr<BufferBase> createBuffer(pybind11::array&
 IVW_MODULE_PYTHON3_API std::unique_ptr<Layer> createLayer(pybind11::array& arr);
 IVW_MODULE_PYTHON3_API std::unique_ptr<Volume> createVolume(pybind11::array& arr);
 
+/**
+ * Wrap @p object in a shared_ptr that acquires the GIL when the object is released. The pointer
+ * can then be copied and destroyed on any thread, which makes it safe to capture python objects
+ * in functors that are run in the thread pool.
+ */
+IVW_MODULE_PYTHON3_API std::shared_ptr<pybind11::object> makeGILSafe(pybind11::object object);
+
 template <int Dim>
 void checkDataFormat(const DataFormatBase* format, const Vector<Dim, size_t>& dim,
                      const pybind11::array& data) {
@@ -92,6 +99,16 @@ void checkDataFormat(const DataFormatBase* format, const Vector<Dim, size_t>& di
     }
 }
 
+/**
+ * A capsule holding a reference to @p object. Use it as the base of a numpy array that views
+ * memory owned by @p object, to keep that memory alive for as long as the array lives.
+ */
+template <typename T>
+pybind11::capsule keepAlive(std::shared_ptr<T> object) {
+    return pybind11::capsule(new std::shared_ptr<T>(std::move(object)),
+                             [](void* ptr) { delete static_cast<std::shared_ptr<T>*>(ptr); });
+}
+
 template <typename T>
 pybind11::dtype toNumPyFormat() {
     return toNumPyFormat(DataFormat<T>::get());
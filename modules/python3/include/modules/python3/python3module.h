@@ -33,6 +33,7 @@
 #include <inviwo/core/common/inviwomodule.h>
 #include <inviwo/core/util/commandlineparser.h>
 #include <modules/python3/pythonlogger.h>
+#include <modules/python3/pythonprocessorcache.h>
 #include <modules/python3/pythonprocessorfolderobserver.h>
 #include <modules/python3/pyutils.h>
 
@@ -60,6 +61,7 @@ private:
     PythonLogger pythonLogger_;
 
     pyutil::ModulePath scripts_;
+    PythonProcessorCache processorCache_;
     PythonProcessorFolderObserver pythonFolderObserver_;
     PythonProcessorFolderObserver settingsFolderObserver_;
 
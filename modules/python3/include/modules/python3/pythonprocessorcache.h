@@ -0,0 +1,101 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/python3/python3moduledefine.h>  // for IVW_MODULE_PYTHON3_API
+
+#include <modules/python3/pythonprocessorfactoryobject.h>  // for PythonProcessorFactoryObjectData
+
+#include <cstdint>      // for uint64_t
+#include <filesystem>   // for path
+#include <map>          // for map
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+namespace inviwo {
+
+class Serializer;
+class Deserializer;
+
+/**
+ * A cache of the ProcessorInfo of python processors keyed on the file and a hash of its content.
+ * It lets python processors be registered at startup without importing their scripts, the
+ * import is instead done when the first processor is created. Only files that changed since the
+ * last run have to be imported to extract their ProcessorInfo. The cache is stored in the
+ * settings folder when destroyed, entries of files that were not seen during the run are
+ * dropped.
+ */
+class IVW_MODULE_PYTHON3_API PythonProcessorCache {
+public:
+    PythonProcessorCache();
+    PythonProcessorCache(const PythonProcessorCache&) = delete;
+    PythonProcessorCache(PythonProcessorCache&&) = delete;
+    PythonProcessorCache& operator=(const PythonProcessorCache&) = delete;
+    PythonProcessorCache& operator=(PythonProcessorCache&&) = delete;
+    ~PythonProcessorCache();
+
+    /**
+     * Get the cached data of @p file if there is one and the content of the file has not changed
+     */
+    std::optional<PythonProcessorFactoryObjectData> get(const std::filesystem::path& file);
+
+    /**
+     * Store @p data for the file given by data.file with the content hash @p hash
+     */
+    void set(std::uint64_t hash, const PythonProcessorFactoryObjectData& data);
+
+    static std::uint64_t hash(std::string_view script);
+
+private:
+    struct Entry {
+        std::uint64_t hash = 0;
+        std::string name;
+        std::string classIdentifier;
+        std::string displayName;
+        std::string category;
+        CodeState codeState = CodeState::Experimental;
+        std::string tags;
+        Document help;
+        bool visible = true;
+        bool used = false;  // Not serialized
+
+        void serialize(Serializer& s) const;
+        void deserialize(Deserializer& d);
+    };
+
+    void save() const;
+
+    std::filesystem::path cacheFile_;
+    std::map<std::string, Entry> entries_;
+    bool modified_ = false;
+};
+
+}  // namespace inviwo
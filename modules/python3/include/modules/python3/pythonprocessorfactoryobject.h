@@ -35,8 +35,9 @@
 #include <inviwo/core/util/document.h>                      // for Document
 #include <inviwo/core/util/fileobserver.h>                  // for FileObserver
 
-#include <memory>  // for unique_ptr
-#include <string>  // for string
+#include <memory>    // for unique_ptr
+#include <string>    // for string
+#include <optional>  // for optional
 #include <filesystem>
 #include <fmt/std.h>
 
@@ -44,6 +45,7 @@ namespace inviwo {
 
 class InviwoApplication;
 class Processor;
+class PythonProcessorCache;
 
 struct IVW_MODULE_PYTHON3_API PythonProcessorFactoryObjectData {
     ProcessorInfo info;
@@ -64,7 +66,12 @@ protected:
 class IVW_MODULE_PYTHON3_API PythonProcessorFactoryObject : public PythonProcessorFactoryObjectBase,
                                                             public FileObserver {
 public:
-    PythonProcessorFactoryObject(InviwoApplication* app, const std::filesystem::path& file);
+    /**
+     * Register the python processor in @p file. If a @p cache is given and it has an up to date
+     * entry for the file, the script will not be imported until the first processor is created.
+     */
+    PythonProcessorFactoryObject(InviwoApplication* app, const std::filesystem::path& file,
+                                 PythonProcessorCache* cache = nullptr);
     virtual ~PythonProcessorFactoryObject() = default;
 
     virtual std::shared_ptr<Processor> create(InviwoApplication* app) const override;
@@ -77,12 +84,19 @@ public:
     }
 
 private:
+    PythonProcessorFactoryObject(InviwoApplication* app, const std::filesystem::path& file,
+                                 PythonProcessorCache* cache,
+                                 std::optional<PythonProcessorFactoryObjectData> cached);
+
     InviwoApplication* app_;
+    PythonProcessorCache* cache_;
+    mutable bool imported_;
     virtual void fileChanged(const std::filesystem::path& filename) override;
 
     void reloadProcessors();
 
-    static PythonProcessorFactoryObjectData load(const std::filesystem::path& file);
+    static PythonProcessorFactoryObjectData load(const std::filesystem::path& file,
+                                                 PythonProcessorCache* cache);
 };
 
 }  // namespace inviwo
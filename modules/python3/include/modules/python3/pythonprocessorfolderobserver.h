@@ -38,11 +38,12 @@
 namespace inviwo {
 class InviwoApplication;
 class InviwoModule;
+class PythonProcessorCache;
 
 class IVW_MODULE_PYTHON3_API PythonProcessorFolderObserver : public FileObserver {
 public:
     PythonProcessorFolderObserver(InviwoApplication* app, const std::filesystem::path& directory,
-                                  InviwoModule& module);
+                                  InviwoModule& module, PythonProcessorCache* cache = nullptr);
     virtual ~PythonProcessorFolderObserver() = default;
 
 private:
@@ -53,6 +54,7 @@ private:
     std::filesystem::path directory_;
     std::vector<std::filesystem::path> registeredFiles_;
     InviwoModule& module_;
+    PythonProcessorCache* cache_;
 };
 
 }  // namespace inviwo
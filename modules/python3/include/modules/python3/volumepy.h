@@ -37,6 +37,7 @@
 #include <inviwo/core/datastructures/representationconverter.h>      // for RepresentationConver...
 #include <inviwo/core/datastructures/volume/volumeram.h>             // for VolumeRAM
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>  // for VolumeRepresentation
+#include <inviwo/core/resourcemanager/resource.h>                    // for PY
 #include <inviwo/core/util/glmvec.h>                                 // for size3_t
 
 #include <memory>     // for shared_ptr
@@ -102,12 +103,16 @@ private:
 
     pybind11::array data_;
     size3_t dims_;
+    // Cached to not have to acquire the GIL every time the format or resource key is queried
+    const DataFormatBase* format_;
+    resource::PY key_;
 };
 #include <warn/pop>
 
 class IVW_MODULE_PYTHON3_API VolumeRAM2PyConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeRAM, VolumePy> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<VolumePy> createFrom(
         std::shared_ptr<const VolumeRAM> volumeSrc) const override;
     virtual void update(std::shared_ptr<const VolumeRAM> volumeSrc,
@@ -117,6 +122,7 @@ public:
 class IVW_MODULE_PYTHON3_API VolumePy2RAMConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumePy, VolumeRAM> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<VolumeRAM> createFrom(
         std::shared_ptr<const VolumePy> volumeSrc) const override;
     virtual void update(std::shared_ptr<const VolumePy> volumeSrc,
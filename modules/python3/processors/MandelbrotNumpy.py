@@ -36,9 +36,9 @@ import numpy as np
 import math
 
 
-class MandelbrotNumpy(ivw.Processor):
+class MandelbrotNumpy(ivw.PoolProcessor):
     def __init__(self, id, name):
-        ivw.Processor.__init__(self, id, name)
+        ivw.PoolProcessor.__init__(self, identifier=id, displayName=name)
 
         self.outport = ivw.data.LayerOutport("outport")
         self.addOutport(self.outport)
@@ -74,7 +74,8 @@ class MandelbrotNumpy(ivw.Processor):
             tags=ivw.Tags("PY, Example"),
             help=ivw.md2doc(r'''
 Example processor computing the Mandelbrot set with numpy and storing it in a
-`LayerPy` representation of an `Image`.
+`LayerPy` representation of an `Image`. The computation is dispatched to the thread pool
+using `PoolProcessor.dispatchOne` so it does not block the user interface.
 
 See [python3/mandelbrot.inv](file:~modulePath~/data/workspaces/mandelbrot.inv) workspace.
 ''')
@@ -87,30 +88,42 @@ See [python3/mandelbrot.inv](file:~modulePath~/data/workspaces/mandelbrot.inv) w
         pass
 
     def process(self):
+        # Read all the property values here, the job will run in a background thread
         dims = self.imgdims.value
 
         realAxis = np.linspace(self.boundsReal.value.x, self.boundsReal.value.y, dims.x)
         imagineryAxis = np.linspace(self.boundsImaginary.value.x,
                                     self.boundsImaginary.value.y, dims.y)
 
-        npData = np.zeros((dims.y, dims.x), dtype=np.float32)
-
         power = self.power.value
         iterations = self.iterations.value
 
-        for index, _ in np.ndenumerate(npData):
-            C = Z = complex(realAxis[index[1]], imagineryAxis[index[0]])
-            for i in range(0, iterations):
-                if np.abs(Z) > 2:
-                    npData[index] = math.log(1 + i)
-                    break
-                Z = np.power(Z, power) + C
+        def job(stop, progress):
+            npData = np.zeros((dims.y, dims.x), dtype=np.float32)
+
+            for index, _ in np.ndenumerate(npData):
+                if index[1] == 0:
+                    if stop:
+                        return None
+                    progress(index[0], dims.y)
+
+                C = Z = complex(realAxis[index[1]], imagineryAxis[index[0]])
+                for i in range(0, iterations):
+                    if np.abs(Z) > 2:
+                        npData[index] = math.log(1 + i)
+                        break
+                    Z = np.power(Z, power) + C
+
+            layerpy = ivw.data.LayerPy(npData)
+            layerpy.interpolation = ivw.data.InterpolationType.Nearest
 
-        layerpy = ivw.data.LayerPy(npData)
-        layerpy.interpolation = ivw.data.InterpolationType.Nearest
+            layer = ivw.data.Layer(layerpy)
+            layer.dataMap.dataRange = ivw.glm.dvec2(npData.min(), npData.max())
+            layer.dataMap.valueRange = layer.dataMap.dataRange
+            return layer
 
-        layer = ivw.data.Layer(layerpy)
-        layer.dataMap.dataRange = ivw.glm.dvec2(npData.min(), npData.max())
-        layer.dataMap.valueRange = layer.dataMap.dataRange
+        def done(layer):
+            self.outport.setData(layer)
+            self.newResults()
 
-        self.outport.setData(layer)
+        self.dispatchOne(job, done)
@@ -68,7 +68,8 @@ LayerPy::LayerPy(pybind11::array data, LayerType type, const SwizzleMask& swizzl
     , interpolation_{interpolation}
     , wrapping_{wrapping}
     , data_{data}
-    , dims_{data_.shape(1), data_.shape(0)} {
+    , dims_{data_.shape(1), data_.shape(0)}
+    , format_{format(data_)} {
 
     gil_.reset();
 }
@@ -84,7 +85,8 @@ LayerPy::LayerPy(size2_t dimensions, LayerType type, const DataFormatBase* forma
     , data_{pybind11::array(
           pyutil::toNumPyFormat(format),
           pybind11::array::ShapeContainer{dimensions.y, dimensions.x, format->getComponents()})}
-    , dims_{dimensions} {
+    , dims_{dimensions}
+    , format_{format} {
 
     gil_.reset();
 }
@@ -104,7 +106,8 @@ LayerPy::LayerPy(const LayerPy& rhs)
     , interpolation_{rhs.interpolation_}
     , wrapping_{rhs.wrapping_}
     , data_{rhs.data_.request()}
-    , dims_{rhs.dims_} {
+    , dims_{rhs.dims_}
+    , format_{rhs.format_} {
 
     gil_.reset();
 }
@@ -128,15 +131,12 @@ void LayerPy::setDimensions(size2_t dimensions) {
         const pybind11::gil_scoped_acquire guard{};
         data_ = pybind11::array(data_.dtype(),
                                 pybind11::array::ShapeContainer{dimensions.y, dimensions.x,
-                                                                getDataFormat()->getComponents()});
+                                                                format_->getComponents()});
         dims_ = dimensions;
     }
 }
 
-const DataFormatBase* LayerPy::getDataFormat() const {
-    const pybind11::gil_scoped_acquire guard{};
-    return format(data_);
-}
+const DataFormatBase* LayerPy::getDataFormat() const { return format_; }
 
 const size2_t& LayerPy::getDimensions() const { return dims_; }
 
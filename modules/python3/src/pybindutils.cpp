@@ -164,6 +164,14 @@ std::unique_ptr<Volume> createVolume(pybind11::array& arr) {
     }
 }
 
+std::shared_ptr<pybind11::object> makeGILSafe(pybind11::object object) {
+    return std::shared_ptr<pybind11::object>(new pybind11::object(std::move(object)),
+                                             [](pybind11::object* ptr) {
+                                                 const pybind11::gil_scoped_acquire gil;
+                                                 delete ptr;
+                                             });
+}
+
 }  // namespace pyutil
 
 }  // namespace inviwo
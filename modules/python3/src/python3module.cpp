@@ -140,10 +140,11 @@ Python3Module::Python3Module(InviwoApplication* app)
                                 }}
     , pythonLogger_{}
     , scripts_{getPath() / "scripts"}
-    , pythonFolderObserver_{app, getPath() / "processors", *this}
+    , processorCache_{}
+    , pythonFolderObserver_{app, getPath() / "processors", *this, &processorCache_}
     , settingsFolderObserver_{app,
                               filesystem::getPath(PathType::Settings, "/python_processors", true),
-                              *this}
+                              *this, &processorCache_}
     , workspaceScripts_{*app->getWorkspaceManager()} {
 
     pythonInterpreter_->addObserver(&pythonLogger_);
@@ -0,0 +1,150 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/python3/pythonprocessorcache.h>
+
+#include <inviwo/core/io/serialization/deserializer.h>  // for Deserializer
+#include <inviwo/core/io/serialization/serializer.h>    // for Serializer
+#include <inviwo/core/util/constexprhash.h>             // for constexpr_hash
+#include <inviwo/core/util/filesystem.h>                // for getPath, PathType
+#include <inviwo/core/util/logcentral.h>                // for log
+
+#include <algorithm>  // for any_of
+#include <exception>  // for exception
+#include <fstream>    // for ifstream
+#include <sstream>    // for stringstream
+
+namespace inviwo {
+
+namespace {
+
+std::string readFile(const std::filesystem::path& file) {
+    auto ifs = std::ifstream(file);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    return std::move(ss).str();
+}
+
+}  // namespace
+
+PythonProcessorCache::PythonProcessorCache()
+    : cacheFile_{filesystem::getPath(PathType::Settings, "/PythonProcessorCache.ivs", true)} {
+
+    if (std::filesystem::is_regular_file(cacheFile_)) {
+        // An error is not critical, the processors will just be imported again.
+        try {
+            Deserializer d(cacheFile_);
+            d.deserialize("Processors", entries_, "Processor");
+        } catch (const std::exception& e) {
+            log::warn("Could not read the python processor cache: {}", e.what());
+            entries_.clear();
+        }
+    }
+}
+
+PythonProcessorCache::~PythonProcessorCache() {
+    const auto unused = std::ranges::any_of(entries_, [](auto& item) { return !item.second.used; });
+    if (modified_ || unused) {
+        save();
+    }
+}
+
+std::optional<PythonProcessorFactoryObjectData> PythonProcessorCache::get(
+    const std::filesystem::path& file) {
+    auto it = entries_.find(file.generic_string());
+    if (it == entries_.end()) return std::nullopt;
+
+    auto& entry = it->second;
+    if (entry.hash != hash(readFile(file))) return std::nullopt;
+
+    entry.used = true;
+    return PythonProcessorFactoryObjectData{
+        .info = ProcessorInfo{entry.classIdentifier, entry.displayName, entry.category,
+                              entry.codeState, Tags{entry.tags}, entry.help, entry.visible},
+        .name = entry.name,
+        .file = file};
+}
+
+void PythonProcessorCache::set(std::uint64_t hash, const PythonProcessorFactoryObjectData& data) {
+    entries_[data.file.generic_string()] = Entry{.hash = hash,
+                                                 .name = data.name,
+                                                 .classIdentifier = data.info.classIdentifier,
+                                                 .displayName = data.info.displayName,
+                                                 .category = data.info.category,
+                                                 .codeState = data.info.codeState,
+                                                 .tags = data.info.tags.getString(),
+                                                 .help = data.info.help,
+                                                 .visible = data.info.visible,
+                                                 .used = true};
+    modified_ = true;
+}
+
+std::uint64_t PythonProcessorCache::hash(std::string_view script) {
+    return util::constexpr_hash(script);
+}
+
+void PythonProcessorCache::save() const {
+    std::map<std::string, Entry> used;
+    for (const auto& [file, entry] : entries_) {
+        if (entry.used) used.emplace(file, entry);
+    }
+    try {
+        Serializer s(cacheFile_);
+        s.serialize("Processors", used, "Processor");
+        s.writeFile();
+    } catch (const std::exception& e) {
+        log::warn("Could not write the python processor cache: {}", e.what());
+    }
+}
+
+void PythonProcessorCache::Entry::serialize(Serializer& s) const {
+    s.serialize("hash", hash);
+    s.serialize("name", name);
+    s.serialize("classIdentifier", classIdentifier);
+    s.serialize("displayName", displayName);
+    s.serialize("category", category);
+    s.serialize("codeState", codeState);
+    s.serialize("tags", tags);
+    s.serialize("help", help);
+    s.serialize("visible", visible);
+}
+
+void PythonProcessorCache::Entry::deserialize(Deserializer& d) {
+    d.deserialize("hash", hash);
+    d.deserialize("name", name);
+    d.deserialize("classIdentifier", classIdentifier);
+    d.deserialize("displayName", displayName);
+    d.deserialize("category", category);
+    d.deserialize("codeState", codeState);
+    d.deserialize("tags", tags);
+    d.deserialize("help", help);
+    d.deserialize("visible", visible);
+}
+
+}  // namespace inviwo
@@ -51,6 +51,7 @@
 #include <inviwo/core/util/sourcecontext.h>                 // for SourceContext
 #include <inviwo/core/util/stringconversion.h>              // for trim
 #include <inviwo/core/util/utilities.h>                     // for stripIdentifier
+#include <modules/python3/pythonprocessorcache.h>           // for PythonProcessorCache
 
 #include <array>        // for array
 #include <exception>    // for exception
@@ -64,8 +65,18 @@
 namespace inviwo {
 
 PythonProcessorFactoryObject::PythonProcessorFactoryObject(InviwoApplication* app,
-                                                           const std::filesystem::path& file)
-    : PythonProcessorFactoryObjectBase(load(file)), FileObserver(app), app_{app} {
+                                                           const std::filesystem::path& file,
+                                                           PythonProcessorCache* cache)
+    : PythonProcessorFactoryObject(app, file, cache, cache ? cache->get(file) : std::nullopt) {}
+
+PythonProcessorFactoryObject::PythonProcessorFactoryObject(
+    InviwoApplication* app, const std::filesystem::path& file, PythonProcessorCache* cache,
+    std::optional<PythonProcessorFactoryObjectData> cached)
+    : PythonProcessorFactoryObjectBase(cached ? std::move(*cached) : load(file, cache))
+    , FileObserver(app)
+    , app_{app}
+    , cache_{cache}
+    , imported_{!cached} {
     startFileObservation(file);
 }
 
@@ -73,6 +84,12 @@ std::shared_ptr<Processor> PythonProcessorFactoryObject::create(InviwoApplicatio
     namespace py = pybind11;
     const auto& pi = getProcessorInfo();
 
+    if (!imported_) {
+        // The ProcessorInfo came from the cache, import the script to define the processor class
+        load(file_, cache_);
+        imported_ = true;
+    }
+
     try {
         const pybind11::gil_scoped_acquire gil;
         auto main = py::module::import("__main__");
@@ -88,7 +105,8 @@ std::shared_ptr<Processor> PythonProcessorFactoryObject::create(InviwoApplicatio
 
 void PythonProcessorFactoryObject::fileChanged(const std::filesystem::path&) {
     try {
-        auto data = load(file_);
+        auto data = load(file_, cache_);
+        imported_ = true;
         name_ = data.name;
         log::info("Reloaded python processor: '{}' file: {}", name_, file_);
         if (getProcessorInfo() != data.info) {
@@ -141,7 +159,7 @@ pybind11::object compileAndRun(const std::string& expr, const std::string& name,
 }  // namespace
 
 PythonProcessorFactoryObjectData PythonProcessorFactoryObject::load(
-    const std::filesystem::path& file) {
+    const std::filesystem::path& file, PythonProcessorCache* cache) {
     namespace py = pybind11;
     const pybind11::gil_scoped_acquire gil;
 
@@ -214,7 +232,11 @@ PythonProcessorFactoryObjectData PythonProcessorFactoryObject::load(
     try {
         py::object proc = py::eval<py::eval_expr>(name + ".processorInfo()");
         auto p = proc.cast<ProcessorInfo>();
-        return {p, name, file};
+        PythonProcessorFactoryObjectData data{p, name, file};
+        if (cache) {
+            cache->set(PythonProcessorCache::hash(script), data);
+        }
+        return data;
     } catch (const std::exception& e) {
         throw Exception(SourceContext{},
                         "Failed to get ProcessorInfo for python processor: '{}'. File: {}\n{}",
@@ -48,8 +48,9 @@ class InviwoApplication;
 
 PythonProcessorFolderObserver::PythonProcessorFolderObserver(InviwoApplication* app,
                                                              const std::filesystem::path& directory,
-                                                             InviwoModule& module)
-    : FileObserver(app), app_(app), directory_{directory}, module_{module} {
+                                                             InviwoModule& module,
+                                                             PythonProcessorCache* cache)
+    : FileObserver(app), app_(app), directory_{directory}, module_{module}, cache_{cache} {
 
     if (std::filesystem::is_directory(directory)) {
         for (auto&& item : std::filesystem::recursive_directory_iterator{directory}) {
@@ -76,7 +77,7 @@ bool PythonProcessorFolderObserver::registerFile(const std::filesystem::path& fi
         if (isEmpty(filename)) return false;
 
         try {
-            auto pfo = std::make_unique<PythonProcessorFactoryObject>(app_, filename);
+            auto pfo = std::make_unique<PythonProcessorFactoryObject>(app_, filename, cache_);
             module_.registerProcessor(std::move(pfo));
             registeredFiles_.push_back(filename);
             return true;
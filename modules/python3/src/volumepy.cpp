@@ -81,11 +81,13 @@ VolumePy::VolumePy(pybind11::array data, const SwizzleMask& swizzleMask,
     , interpolation_{interpolation}
     , wrapping_{wrapping}
     , data_{std::move(data)}
-    , dims_{data_.shape(2), data_.shape(1), data_.shape(0)} {
+    , dims_{data_.shape(2), data_.shape(1), data_.shape(0)}
+    , format_{format(data_)}
+    , key_{resource::toPY(data_)} {
 
-    resource::add(resource::toPY(data_), Resource{.dims = glm::size4_t{dims_, 0},
-                                                  .format = format(data_)->getId(),
-                                                  .desc = "VolumePY"});
+    resource::add(key_, Resource{.dims = glm::size4_t{dims_, 0},
+                                 .format = format_->getId(),
+                                 .desc = "VolumePY"});
 
     gil_.reset();
 }
@@ -100,11 +102,13 @@ VolumePy::VolumePy(size3_t dimensions, const DataFormatBase* format, const Swizz
     , data_{pybind11::array(pyutil::toNumPyFormat(format),
                             pybind11::array::ShapeContainer{dimensions.z, dimensions.y,
                                                             dimensions.x, format->getComponents()})}
-    , dims_{dimensions} {
+    , dims_{dimensions}
+    , format_{format}
+    , key_{resource::toPY(data_)} {
 
-    resource::add(
-        resource::toPY(data_),
-        Resource{.dims = glm::size4_t{dims_, 0}, .format = format->getId(), .desc = "VolumePY"});
+    resource::add(key_, Resource{.dims = glm::size4_t{dims_, 0},
+                                 .format = format->getId(),
+                                 .desc = "VolumePY"});
 
     gil_.reset();
 }
@@ -123,11 +127,13 @@ VolumePy::VolumePy(const VolumePy& rhs)
     , interpolation_{rhs.interpolation_}
     , wrapping_{rhs.wrapping_}
     , data_{rhs.data_.request()}
-    , dims_{rhs.dims_} {
+    , dims_{rhs.dims_}
+    , format_{rhs.format_}
+    , key_{resource::toPY(data_)} {
 
-    resource::add(resource::toPY(data_), Resource{.dims = glm::size4_t{dims_, 0},
-                                                  .format = format(data_)->getId(),
-                                                  .desc = "VolumePY"});
+    resource::add(key_, Resource{.dims = glm::size4_t{dims_, 0},
+                                 .format = format_->getId(),
+                                 .desc = "VolumePY"});
 
     gil_.reset();
 }
@@ -140,32 +146,30 @@ VolumePy::~VolumePy() {
     } catch (...) {
         log::exception("Unable to acquire the Python GIL");
     }
-    resource::remove(resource::toPY(data_));
+    resource::remove(key_);
 }
 
 VolumePy* VolumePy::clone() const { return new VolumePy(*this); }
 
 std::type_index VolumePy::getTypeIndex() const { return std::type_index(typeid(VolumePy)); }
 
-const DataFormatBase* VolumePy::getDataFormat() const {
-    const pybind11::gil_scoped_acquire guard{};
-    return format(data_);
-}
+const DataFormatBase* VolumePy::getDataFormat() const { return format_; }
 
 void VolumePy::setDimensions(size3_t dimensions) {
     if (dimensions != dims_) {
         const pybind11::gil_scoped_acquire guard{};
 
-        const auto old = resource::remove(resource::toPY(data_));
+        const auto old = resource::remove(key_);
         data_ = pybind11::array(
             data_.dtype(), pybind11::array::ShapeContainer{dimensions.z, dimensions.y, dimensions.x,
-                                                           getDataFormat()->getComponents()});
+                                                           format_->getComponents()});
         dims_ = dimensions;
+        key_ = resource::toPY(data_);
 
-        resource::add(resource::toPY(data_), Resource{.dims = glm::size4_t{dims_, 0},
-                                                      .format = format(data_)->getId(),
-                                                      .desc = "VolumePY",
-                                                      .meta = resource::getMeta(old)});
+        resource::add(key_, Resource{.dims = glm::size4_t{dims_, 0},
+                                     .format = format_->getId(),
+                                     .desc = "VolumePY",
+                                     .meta = resource::getMeta(old)});
     }
 }
 
@@ -180,10 +184,7 @@ InterpolationType VolumePy::getInterpolation() const { return interpolation_; }
 void VolumePy::setWrapping(const Wrapping3D& wrapping) { wrapping_ = wrapping; }
 Wrapping3D VolumePy::getWrapping() const { return wrapping_; }
 
-void VolumePy::updateResource(const ResourceMeta& meta) const {
-    const pybind11::gil_scoped_acquire guard{};
-    resource::meta(resource::toPY(data_), meta);
-}
+void VolumePy::updateResource(const ResourceMeta& meta) const { resource::meta(key_, meta); }
 
 std::shared_ptr<VolumePy> VolumeRAM2PyConverter::createFrom(
     std::shared_ptr<const VolumeRAM> volumeSrc) const {
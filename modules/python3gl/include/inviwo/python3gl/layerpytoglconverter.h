@@ -41,6 +41,7 @@ namespace inviwo {
 class IVW_MODULE_PYTHON3GL_API LayerPy2GLConverter
     : public RepresentationConverterType<LayerRepresentation, LayerPy, LayerGL> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<LayerGL> createFrom(
         std::shared_ptr<const LayerPy> source) const override;
     virtual void update(std::shared_ptr<const LayerPy> source,
@@ -50,6 +51,7 @@ public:
 class IVW_MODULE_PYTHON3GL_API LayerGL2PyConverter
     : public RepresentationConverterType<LayerRepresentation, LayerGL, LayerPy> {
 public:
+    virtual bool requiresMainThread() const override { return true; }
     virtual std::shared_ptr<LayerPy> createFrom(
         std::shared_ptr<const LayerGL> source) const override;
     virtual void update(std::shared_ptr<const LayerGL> source,
@@ -32,6 +32,7 @@
 #include <inviwo/core/datastructures/datamapper.h>          // for DataMapper
 #include <inviwo/core/datastructures/tfprimitive.h>         // for TFPrimitive, operator==, TFPr...
 #include <inviwo/core/datastructures/tfprimitiveset.h>      // for TFPrimitiveSet, alignAlphaToB...
+#include <inviwo/core/interaction/interactionstate.h>       // for touchInteractionState
 #include <inviwo/core/network/networklock.h>                // for NetworkLock
 #include <inviwo/core/ports/volumeport.h>                   // for VolumeInport
 #include <inviwo/core/properties/property.h>                // for Property
@@ -226,6 +227,7 @@ void TFEditor::mouseMoveEvent(QGraphicsSceneMouseEvent* e) {
     if (mouse_.dragItem && e->buttons() == Qt::LeftButton) {
         e->accept();
         emit updateBegin();
+        util::touchInteractionState();
         // Prevent network evaluations while moving control point
         const NetworkLock lock{concept_->getProperty()};
 
@@ -69,17 +69,41 @@ struct Update {
 struct Stats {
     bool show = false;
 };
+/**
+ * An Update encoded against the previous Update that was sent. The full update is the first
+ * `prefix` characters of the previous one, followed by `data`, followed by the last `suffix`
+ * characters of the previous one.
+ */
+struct UpdateDelta {
+    size_t prefix = 0;
+    size_t suffix = 0;
+    std::string data{};
+};
+/**
+ * A part of a file read by the master and distributed to the nodes, so they do not all have to
+ * read it from a shared file system. `offset` is the position of `data` in the file and `size`
+ * is the total file size.
+ */
+struct FileChunk {
+    std::string path{};
+    size_t offset = 0;
+    size_t size = 0;
+    std::string data{};
+};
 }  // namespace command
 
 using SgctCommand =
     std::variant<command::Nop, command::AddProcessor, command::RemoveProcessor,
                  command::AddConnection, command::RemoveConnection, command::AddLink,
-                 command::RemoveLink, command::Update, command::Stats>;
+                 command::RemoveLink, command::Update, command::Stats, command::UpdateDelta,
+                 command::FileChunk>;
 
 namespace util {
 
-inline auto encode(const std::vector<SgctCommand>& commands) -> std::vector<std::byte> {
-    std::vector<std::byte> bytes;
+/**
+ * Serialize the commands by appending them to `bytes`.
+ */
+inline void encode(const std::vector<SgctCommand>& commands, std::vector<std::byte>& bytes) {
     for (const auto& command : commands) {
         sgct::serializeObject(bytes, command.index());
         std::visit(
@@ -102,15 +126,33 @@ inline auto encode(const std::vector<SgctCommand>& commands) -> std::vector<std:
                     sgct::serializeObject(bytes, update.data);
                 },
                 [&](const command::Update& update) { sgct::serializeObject(bytes, update.data); },
-                [&](const command::Stats& stats) { sgct::serializeObject(bytes, stats.show); }},
+                [&](const command::Stats& stats) { sgct::serializeObject(bytes, stats.show); },
+                [&](const command::UpdateDelta& delta) {
+                    sgct::serializeObject(bytes, delta.prefix);
+                    sgct::serializeObject(bytes, delta.suffix);
+                    sgct::serializeObject(bytes, delta.data);
+                },
+                [&](const command::FileChunk& chunk) {
+                    sgct::serializeObject(bytes, chunk.path);
+                    sgct::serializeObject(bytes, chunk.offset);
+                    sgct::serializeObject(bytes, chunk.size);
+                    sgct::serializeObject(bytes, chunk.data);
+                }},
             command);
     }
+}
+
+inline auto encode(const std::vector<SgctCommand>& commands) -> std::vector<std::byte> {
+    std::vector<std::byte> bytes;
+    encode(commands, bytes);
     return bytes;
 };
 
-inline void decode(const std::vector<std::byte>& bytes, std::vector<SgctCommand>& commands) {
-    unsigned int pos = 0;
-
+/**
+ * Deserialize the commands in `bytes` starting at `pos` and append them to `commands`.
+ */
+inline void decode(const std::vector<std::byte>& bytes, unsigned int pos,
+                   std::vector<SgctCommand>& commands) {
     while (pos < bytes.size()) {
         size_t index = 0;
         sgct::deserializeObject(bytes, pos, index);
@@ -166,6 +208,23 @@ inline void decode(const std::vector<std::byte>& bytes, std::vector<SgctCommand>
                 commands.emplace_back(command::Stats{show});
                 break;
             }
+            case 9: {  // UpdateDelta
+                command::UpdateDelta delta;
+                sgct::deserializeObject(bytes, pos, delta.prefix);
+                sgct::deserializeObject(bytes, pos, delta.suffix);
+                sgct::deserializeObject(bytes, pos, delta.data);
+                commands.emplace_back(std::move(delta));
+                break;
+            }
+            case 10: {  // FileChunk
+                command::FileChunk chunk;
+                sgct::deserializeObject(bytes, pos, chunk.path);
+                sgct::deserializeObject(bytes, pos, chunk.offset);
+                sgct::deserializeObject(bytes, pos, chunk.size);
+                sgct::deserializeObject(bytes, pos, chunk.data);
+                commands.emplace_back(std::move(chunk));
+                break;
+            }
             default: {
                 throw Exception(IVW_CONTEXT_CUSTOM("decode"), "Decode error");
             }
@@ -173,6 +232,21 @@ inline void decode(const std::vector<std::byte>& bytes, std::vector<SgctCommand>
     }
 };
 
+/**
+ * Prepare encoded commands for sending. A small header is written to `packed` followed by the
+ * commands, deflated with zlib if `compress` is true and that makes the message smaller.
+ * `packed` is cleared first but its capacity is reused.
+ * @see decode(const std::vector<std::byte>&, std::vector<SgctCommand>&)
+ */
+IVW_MODULE_SGCT_API void pack(const std::vector<std::byte>& encoded,
+                              std::vector<std::byte>& packed, bool compress);
+
+/**
+ * Decode a message created by pack and append the commands to `commands`.
+ */
+IVW_MODULE_SGCT_API void decode(const std::vector<std::byte>& bytes,
+                                std::vector<SgctCommand>& commands);
+
 }  // namespace util
 
 }  // namespace inviwo
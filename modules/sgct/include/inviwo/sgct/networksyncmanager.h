@@ -41,11 +41,17 @@
 #include <functional>
 #include <string_view>
 #include <mutex>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <unordered_map>
 
 namespace inviwo {
 
 class ProcessorNetwork;
 class WorkspaceManager;
+class FileProperty;
 
 class IVW_MODULE_SGCT_API NetworkSyncServer : public ProcessorNetworkObserver,
                                               public ProcessorObserver {
@@ -77,6 +83,10 @@ private:
     virtual void onAboutPropertyChange(Property*) override;
 
     void collectPropertyChanges();
+    void addUpdate(std::string data);
+    void addCommand(SgctCommand command);
+    void queueFiles(const std::vector<FileProperty*>& properties);
+    void transferFiles();
 
     std::mutex modifiedMutex_;
     std::vector<Property*> modified_;
@@ -85,6 +95,23 @@ private:
     std::vector<SgctCommand> commands_;
     ProcessorNetwork& net_;
     const SGCTSettings* settings_;
+
+    // The last Update added to commands_, used as the base for the next UpdateDelta
+    std::string lastUpdate_;
+    // Reused between frames to avoid reallocating
+    std::vector<std::byte> encoded_;
+    std::vector<std::byte> packed_;
+
+    // A file being sent to the nodes and the commands that have to wait until it has arrived
+    struct FileTransfer {
+        std::filesystem::path path;
+        std::ifstream stream;
+        size_t size = 0;
+        size_t offset = 0;
+        std::vector<SgctCommand> commands;
+    };
+    std::deque<FileTransfer> transfers_;
+    std::set<std::filesystem::path> distributed_;
 };
 
 class IVW_MODULE_SGCT_API NetworkSyncClient {
@@ -101,8 +128,15 @@ public:
     std::function<void(bool)> onStats;
 
 private:
+    void applyUpdate(const std::string& data);
+    void receiveFile(const command::FileChunk& chunk);
+    void useReceivedFiles(const std::vector<FileProperty*>& properties) const;
+
     ProcessorNetwork& net_;
     WorkspaceManager& wm_;
+    std::string lastUpdate_;
+    // Files received from the master, maps the path on the master to the local copy
+    std::unordered_map<std::string, std::filesystem::path> files_;
 };
 
 }  // namespace inviwo
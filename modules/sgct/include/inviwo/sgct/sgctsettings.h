@@ -32,6 +32,7 @@
 
 #include <inviwo/core/util/settings/settings.h>
 #include <inviwo/core/properties/boolproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
 
 namespace inviwo {
 
@@ -46,6 +47,14 @@ public:
 
     BoolProperty showSGCTStatisticsOverlay;
     BoolProperty logModifiedProperties;
+    BoolProperty deltaEncodeUpdates;
+    BoolProperty compressCommands;
+    BoolProperty distributeFiles;
+    IntSizeTProperty fileChunkSize;
+    BoolProperty foveatedRendering;
+    FloatVec3Property foveationDirection;
+    FloatProperty foveationAngle;
+    FloatProperty peripheralScale;
 };
 
 }  // namespace inviwo
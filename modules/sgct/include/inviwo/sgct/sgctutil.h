@@ -31,6 +31,8 @@
 #include <inviwo/sgct/sgctmoduledefine.h>
 
 #include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/glmmat.h>
+#include <inviwo/core/util/glmvec.h>
 
 #include <sgct/sgct.h>
 
@@ -50,4 +52,13 @@ inline auto sgctToInviwo(sgct::Log::Level level) -> inviwo::LogLevel {
     return inviwo::LogLevel::Info;
 }
 
+/**
+ * The resolution scale to use for a viewport rendered with the given view matrix. Viewports
+ * looking at most angle degrees away from the direction are rendered at full resolution, i.e.
+ * scale 1, and the others at peripheralScale. Using only two scales keeps the number of
+ * different canvas sizes per frame low.
+ */
+IVW_MODULE_SGCT_API float foveationScale(const mat4& viewMatrix, vec3 direction, float angle,
+                                         float peripheralScale);
+
 }  // namespace inviwo::util
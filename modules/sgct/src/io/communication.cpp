@@ -29,4 +29,63 @@
 
 #include <inviwo/sgct/io/communication.h>
 
-namespace inviwo {}  // namespace inviwo
+#include <zlib.h>
+
+namespace inviwo {
+
+namespace {
+// Messages smaller than this are sent uncompressed, the saving is not worth the time.
+constexpr size_t minCompressSize = 1024;
+}  // namespace
+
+void util::pack(const std::vector<std::byte>& encoded, std::vector<std::byte>& packed,
+                bool compress) {
+    packed.clear();
+    if (encoded.empty()) return;
+
+    if (compress && encoded.size() >= minCompressSize) {
+        sgct::serializeObject(packed, true);
+        sgct::serializeObject(packed, encoded.size());
+        const auto header = packed.size();
+
+        auto size = compressBound(static_cast<uLong>(encoded.size()));
+        packed.resize(header + size);
+        const auto res = compress2(reinterpret_cast<Bytef*>(packed.data() + header), &size,
+                                   reinterpret_cast<const Bytef*>(encoded.data()),
+                                   static_cast<uLong>(encoded.size()), Z_BEST_SPEED);
+        if (res == Z_OK && size < encoded.size()) {
+            packed.resize(header + size);
+            return;
+        }
+        packed.clear();
+    }
+
+    sgct::serializeObject(packed, false);
+    packed.insert(packed.end(), encoded.begin(), encoded.end());
+}
+
+void util::decode(const std::vector<std::byte>& bytes, std::vector<SgctCommand>& commands) {
+    if (bytes.empty()) return;
+
+    unsigned int pos = 0;
+    bool compressed = false;
+    sgct::deserializeObject(bytes, pos, compressed);
+    if (!compressed) {
+        decode(bytes, pos, commands);
+        return;
+    }
+
+    size_t size = 0;
+    sgct::deserializeObject(bytes, pos, size);
+    std::vector<std::byte> encoded(size);
+    auto destSize = static_cast<uLongf>(size);
+    const auto res = uncompress(reinterpret_cast<Bytef*>(encoded.data()), &destSize,
+                                reinterpret_cast<const Bytef*>(bytes.data() + pos),
+                                static_cast<uLong>(bytes.size() - pos));
+    if (res != Z_OK || destSize != size) {
+        throw Exception(SourceContext{}, "Decompression error: {}", res);
+    }
+    decode(encoded, 0, commands);
+}
+
+}  // namespace inviwo
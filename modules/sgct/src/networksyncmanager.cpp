@@ -36,9 +36,32 @@
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/network/workspacemanager.h>
 #include <inviwo/core/util/rendercontext.h>
+#include <inviwo/core/properties/fileproperty.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <fmt/format.h>
 
 namespace inviwo {
 
+namespace {
+
+std::vector<FileProperty*> getFileProperties(const std::vector<Property*>& properties) {
+    std::vector<FileProperty*> files;
+    for (auto* property : properties) {
+        if (auto* file = dynamic_cast<FileProperty*>(property)) {
+            files.push_back(file);
+        } else if (auto* owner = dynamic_cast<PropertyOwner*>(property)) {
+            auto sub = owner->getPropertiesByType<FileProperty>(true);
+            files.insert(files.end(), sub.begin(), sub.end());
+        }
+    }
+    return files;
+}
+
+}  // namespace
+
 NetworkSyncServer::NetworkSyncServer(ProcessorNetwork& net, const SGCTSettings* settings)
     : net_{net}, settings_{settings} {
     if (!net_.isEmpty()) {
@@ -57,14 +80,20 @@ const std::vector<SgctCommand>& NetworkSyncServer::getCommands() {
 void NetworkSyncServer::clearCommands() {
     const std::scoped_lock lock{commandsMutex_};
     commands_.clear();
+    transfers_.clear();
+    // The clients will not see the cleared updates, so the next one can not be a delta.
+    lastUpdate_.clear();
 }
 
 std::vector<std::byte> NetworkSyncServer::getEncodedCommandsAndClear() {
     const std::scoped_lock lock{commandsMutex_};
     collectPropertyChanges();
-    auto bytes = inviwo::util::encode(commands_);
+    transferFiles();
+    encoded_.clear();
+    inviwo::util::encode(commands_, encoded_);
     commands_.clear();
-    return bytes;
+    inviwo::util::pack(encoded_, packed_, !settings_ || settings_->compressCommands.get());
+    return packed_;
 }
 
 template <typename Command, typename Item>
@@ -85,39 +114,40 @@ void NetworkSyncServer::onProcessorNetworkDidAddProcessor(Processor* processor)
     s.writeFile(ss, false);
 
     const std::scoped_lock lock{commandsMutex_};
-    commands_.emplace_back(command::AddProcessor{std::move(ss).str()});
+    queueFiles(processor->getPropertiesByType<FileProperty>(true));
+    addCommand(command::AddProcessor{std::move(ss).str()});
 }
 void NetworkSyncServer::onProcessorNetworkDidRemoveProcessor(Processor* processor) {
     processor->ProcessorObservable::removeObserver(this);
     collectPropertyChanges();
 
     const std::scoped_lock lock{commandsMutex_};
-    commands_.emplace_back(command::RemoveProcessor{processor->getIdentifier()});
+    addCommand(command::RemoveProcessor{processor->getIdentifier()});
 }
 void NetworkSyncServer::onProcessorNetworkDidAddConnection(const PortConnection& connection) {
     collectPropertyChanges();
     const std::scoped_lock lock{commandsMutex_};
-    commands_.emplace_back(create<command::AddConnection>(connection));
+    addCommand(create<command::AddConnection>(connection));
 }
 void NetworkSyncServer::onProcessorNetworkDidRemoveConnection(const PortConnection& connection) {
     collectPropertyChanges();
     const std::scoped_lock lock{commandsMutex_};
-    commands_.emplace_back(create<command::RemoveConnection>(connection));
+    addCommand(create<command::RemoveConnection>(connection));
 }
 void NetworkSyncServer::onProcessorNetworkDidAddLink(const PropertyLink& link) {
     collectPropertyChanges();
     const std::scoped_lock lock{commandsMutex_};
-    commands_.emplace_back(create<command::AddLink>(link));
+    addCommand(create<command::AddLink>(link));
 }
 void NetworkSyncServer::onProcessorNetworkDidRemoveLink(const PropertyLink& link) {
     collectPropertyChanges();
     const std::scoped_lock lock{commandsMutex_};
-    commands_.emplace_back(create<command::RemoveLink>(link));
+    addCommand(create<command::RemoveLink>(link));
 }
 
 void NetworkSyncServer::showStats(bool show) {
     const std::scoped_lock lock{commandsMutex_};
-    commands_.emplace_back(command::Stats{show});
+    addCommand(command::Stats{show});
 }
 
 void NetworkSyncServer::onAboutPropertyChange(Property* property) {
@@ -217,7 +247,107 @@ void NetworkSyncServer::collectPropertyChanges() {
     s.serialize("modified", uniqueAfterLinks);
     std::stringstream ss;
     s.writeFile(ss, false);
-    commands_.emplace_back(command::Update{std::move(ss).str()});
+    queueFiles(getFileProperties(uniqueAfterLinks));
+    addUpdate(std::move(ss).str());
+}
+
+void NetworkSyncServer::addUpdate(std::string data) {
+    const bool delta = !settings_ || settings_->deltaEncodeUpdates.get();
+    if (!delta) {
+        lastUpdate_.clear();
+        addCommand(command::Update{std::move(data)});
+        return;
+    }
+
+    // Interactively changing a property will usually produce a sequence of updates that only
+    // differ in a small part, for example a single transfer function point. Then we only send
+    // the changed middle part and let the clients reconstruct the rest from the previous update.
+    if (!lastUpdate_.empty()) {
+        const auto size = std::min(data.size(), lastUpdate_.size());
+        const auto prefix = static_cast<size_t>(
+            std::mismatch(data.begin(), data.begin() + size, lastUpdate_.begin()).first -
+            data.begin());
+        const auto suffix = static_cast<size_t>(
+            std::mismatch(data.rbegin(), data.rbegin() + (size - prefix), lastUpdate_.rbegin())
+                .first -
+            data.rbegin());
+
+        if (prefix + suffix > data.size() / 2) {
+            addCommand(command::UpdateDelta{
+                prefix, suffix, data.substr(prefix, data.size() - prefix - suffix)});
+            lastUpdate_ = std::move(data);
+            return;
+        }
+    }
+    addCommand(command::Update{data});
+    lastUpdate_ = std::move(data);
+}
+
+void NetworkSyncServer::addCommand(SgctCommand command) {
+    if (transfers_.empty()) {
+        commands_.push_back(std::move(command));
+    } else {
+        transfers_.back().commands.push_back(std::move(command));
+    }
+}
+
+void NetworkSyncServer::queueFiles(const std::vector<FileProperty*>& properties) {
+    if (!settings_ || !settings_->distributeFiles.get()) return;
+
+    for (auto* property : properties) {
+        if (property->getAcceptMode() != AcceptMode::Open) continue;
+
+        const auto& file = property->get();
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(file, ec)) continue;
+
+        // Also send the files next to it with the same stem, like the raw file of a .dat volume
+        for (const auto& entry : std::filesystem::directory_iterator(file.parent_path(), ec)) {
+            if (!entry.is_regular_file(ec) || entry.path().stem() != file.stem()) continue;
+            if (!distributed_.insert(entry.path()).second) continue;
+
+            transfers_.push_back(FileTransfer{.path = entry.path(),
+                                              .stream = {},
+                                              .size = static_cast<size_t>(entry.file_size(ec)),
+                                              .offset = 0,
+                                              .commands = {}});
+        }
+    }
+}
+
+void NetworkSyncServer::transferFiles() {
+    const auto chunkSize = settings_ ? settings_->fileChunkSize.get() : size_t{16};
+    auto budget = chunkSize * 1024 * 1024;
+
+    while (!transfers_.empty() && budget > 0) {
+        auto& transfer = transfers_.front();
+        if (!transfer.stream.is_open()) {
+            transfer.stream.open(transfer.path, std::ios::binary);
+        }
+
+        const auto count = std::min(budget, transfer.size - transfer.offset);
+        command::FileChunk chunk{.path = transfer.path.string(),
+                                 .offset = transfer.offset,
+                                 .size = transfer.size,
+                                 .data = std::string(count, '\0')};
+        transfer.stream.read(chunk.data.data(), static_cast<std::streamsize>(count));
+        if (const auto read = static_cast<size_t>(transfer.stream.gcount()); read != count) {
+            log::error("Could only read {} of {} bytes from '{}'", transfer.offset + read,
+                       transfer.size, transfer.path.string());
+            chunk.data.resize(read);
+            chunk.size = transfer.offset + read;
+            transfer.size = chunk.size;
+        }
+        transfer.offset += chunk.data.size();
+        budget -= chunk.data.size();
+        commands_.push_back(std::move(chunk));
+
+        if (transfer.offset == transfer.size) {
+            std::move(transfer.commands.begin(), transfer.commands.end(),
+                      std::back_inserter(commands_));
+            transfers_.pop_front();
+        }
+    }
 }
 
 NetworkSyncClient::NetworkSyncClient(ProcessorNetwork& net)
@@ -234,6 +364,9 @@ void NetworkSyncClient::applyCommands(const std::vector<SgctCommand>& commands)
                                             auto d = wm_.createWorkspaceDeserializer(is, "");
                                             std::shared_ptr<Processor> processor;
                                             d.deserialize("processor", processor);
+                                            useReceivedFiles(
+                                                processor->getPropertiesByType<FileProperty>(
+                                                    true));
                                             net_.addProcessor(std::move(processor));
                                         },
                                         [&](const command::RemoveProcessor& update) {
@@ -269,20 +402,30 @@ void NetworkSyncClient::applyCommands(const std::vector<SgctCommand>& commands)
                                         },
 
                                         [&](const command::Update& update) {
-                                            std::stringstream is{update.data};
-                                            auto d = wm_.createWorkspaceDeserializer(is, "");
-                                            std::vector<std::string> paths;
-                                            d.deserialize("paths", paths);
-
-                                            std::vector<Property*> modifiedProps;
-                                            modifiedProps.reserve(paths.size());
-
-                                            for (auto& path : paths) {
-                                                modifiedProps.push_back(net_.getProperty(path));
+                                            lastUpdate_ = update.data;
+                                            applyUpdate(lastUpdate_);
+                                        },
+                                        [&](const command::UpdateDelta& delta) {
+                                            if (delta.prefix + delta.suffix >
+                                                lastUpdate_.size()) {
+                                                throw Exception(SourceContext{},
+                                                                "Invalid update delta");
                                             }
-                                            d.deserialize("modified", modifiedProps);
+                                            std::string data;
+                                            data.reserve(delta.prefix + delta.data.size() +
+                                                         delta.suffix);
+                                            data.append(lastUpdate_, 0, delta.prefix)
+                                                .append(delta.data)
+                                                .append(lastUpdate_,
+                                                        lastUpdate_.size() - delta.suffix,
+                                                        delta.suffix);
+                                            lastUpdate_ = std::move(data);
+                                            applyUpdate(lastUpdate_);
                                         },
-                                        [&](const command::Stats& stats) { onStats(stats.show); }},
+                                        [&](const command::Stats& stats) { onStats(stats.show); },
+                                        [&](const command::FileChunk& chunk) {
+                                            receiveFile(chunk);
+                                        }},
 
                        command);
         } catch (const Exception& e) {
@@ -291,4 +434,51 @@ void NetworkSyncClient::applyCommands(const std::vector<SgctCommand>& commands)
     }
 }
 
+void NetworkSyncClient::applyUpdate(const std::string& data) {
+    std::stringstream is{data};
+    auto d = wm_.createWorkspaceDeserializer(is, "");
+    std::vector<std::string> paths;
+    d.deserialize("paths", paths);
+
+    std::vector<Property*> modifiedProps;
+    modifiedProps.reserve(paths.size());
+
+    for (auto& path : paths) {
+        modifiedProps.push_back(net_.getProperty(path));
+    }
+    d.deserialize("modified", modifiedProps);
+    useReceivedFiles(getFileProperties(modifiedProps));
+}
+
+void NetworkSyncClient::receiveFile(const command::FileChunk& chunk) {
+    // Keep files from different directories apart while keeping the file names, since a file can
+    // refer to other files next to it by name.
+    const std::filesystem::path source{chunk.path};
+    const auto key = std::hash<std::string>{}(source.parent_path().string());
+    const auto dir =
+        std::filesystem::temp_directory_path() / "inviwo-sgct" / fmt::format("{:016x}", key);
+    const auto file = dir / source.filename();
+
+    if (chunk.offset == 0) {
+        std::filesystem::create_directories(dir);
+    }
+    const auto mode = std::ios::binary | (chunk.offset == 0 ? std::ios::trunc : std::ios::app);
+    std::ofstream out{file, mode};
+    out.write(chunk.data.data(), static_cast<std::streamsize>(chunk.data.size()));
+    if (!out) {
+        throw Exception(SourceContext{}, "Could not write distributed file '{}'", file.string());
+    }
+    if (chunk.offset + chunk.data.size() == chunk.size) {
+        files_[chunk.path] = file;
+    }
+}
+
+void NetworkSyncClient::useReceivedFiles(const std::vector<FileProperty*>& properties) const {
+    for (auto* property : properties) {
+        if (auto it = files_.find(property->get().string()); it != files_.end()) {
+            property->set(it->second);
+        }
+    }
+}
+
 }  // namespace inviwo
@@ -29,14 +29,68 @@
 
 #include <inviwo/sgct/sgctsettings.h>
 
+#include <inviwo/core/algorithm/markdown.h>
+
 namespace inviwo {
 
 SGCTSettings::SGCTSettings()
     : Settings("SGCT Settings")
     , showSGCTStatisticsOverlay{"showSGCTStatisticsOverlay", "Show SGCT Statistics Overlay", false}
-    , logModifiedProperties{"logModifiedProperties", "Log Modified Properties", false} {
+    , logModifiedProperties{"logModifiedProperties", "Log Modified Properties", false}
+    , deltaEncodeUpdates{"deltaEncodeUpdates", "Delta Encode Updates",
+                         "Only send the part of a property update that differs from the previous "
+                         "update"_help,
+                         true}
+    , compressCommands{"compressCommands", "Compress Commands",
+                       "Compress the commands sent to the cluster nodes using zlib"_help, true}
+    , distributeFiles{"distributeFiles", "Distribute Files",
+                      "Let the master read the files used by the network and send them to the "
+                      "nodes, instead of every node reading them from a shared file system. The "
+                      "nodes store the files in a local temporary directory"_help,
+                      false}
+    , fileChunkSize{"fileChunkSize",
+                    "File Chunk Size (MB)",
+                    "Amount of file data sent to the nodes per frame when distributing files. "
+                    "The nodes will not apply any later network changes until a file has been "
+                    "fully received"_help,
+                    16,
+                    {1, ConstraintBehavior::Immutable},
+                    {1024, ConstraintBehavior::Ignore}}
+    , foveatedRendering{"foveatedRendering", "Foveated Rendering",
+                        "Render the sub viewports that look away from the foveation direction, "
+                        "like the peripheral cube map faces of a fisheye projection, at a lower "
+                        "resolution. The canvas is resized between the viewports, hence all image "
+                        "buffers of the network will be reallocated as well"_help,
+                        false}
+    , foveationDirection{"foveationDirection",
+                         "Foveation Direction",
+                         "The direction in the SGCT user space that is rendered at full "
+                         "resolution, forward is the center of an untilted fisheye"_help,
+                         vec3{0.0f, 0.0f, -1.0f},
+                         {vec3{-1.0f}, ConstraintBehavior::Immutable},
+                         {vec3{1.0f}, ConstraintBehavior::Immutable}}
+    , foveationAngle{"foveationAngle",
+                     "Foveation Angle",
+                     "Viewports looking within this angle (degrees) of the foveation direction "
+                     "are rendered at full resolution"_help,
+                     60.0f,
+                     {0.0f, ConstraintBehavior::Immutable},
+                     {180.0f, ConstraintBehavior::Immutable}}
+    , peripheralScale{"peripheralScale",
+                      "Peripheral Scale",
+                      "The resolution scale of the viewports outside of the foveation angle"_help,
+                      0.5f,
+                      {0.1f, ConstraintBehavior::Immutable},
+                      {1.0f, ConstraintBehavior::Immutable}} {
+
+    addProperties(showSGCTStatisticsOverlay, logModifiedProperties, deltaEncodeUpdates,
+                  compressCommands, distributeFiles, fileChunkSize, foveatedRendering,
+                  foveationDirection, foveationAngle, peripheralScale);
 
-    addProperties(showSGCTStatisticsOverlay, logModifiedProperties);
+    const auto foveated = [](const BoolProperty& p) { return p.get(); };
+    foveationDirection.visibilityDependsOn(foveatedRendering, foveated);
+    foveationAngle.visibilityDependsOn(foveatedRendering, foveated);
+    peripheralScale.visibilityDependsOn(foveatedRendering, foveated);
 
     load();
 }
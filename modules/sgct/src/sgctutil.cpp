@@ -29,4 +29,18 @@
 
 #include <inviwo/sgct/sgctutil.h>
 
-namespace inviwo {}  // namespace inviwo
+#include <glm/geometric.hpp>
+#include <glm/trigonometric.hpp>
+
+namespace inviwo {
+
+float util::foveationScale(const mat4& viewMatrix, vec3 direction, float angle,
+                           float peripheralScale) {
+    if (glm::length(direction) == 0.0f) return 1.0f;
+    // The viewing direction is the negative z axis of the camera, in world space
+    const vec3 forward = -glm::transpose(mat3(viewMatrix))[2];
+    const float cosAngle = glm::dot(glm::normalize(forward), glm::normalize(direction));
+    return cosAngle >= glm::cos(glm::radians(angle)) ? 1.0f : peripheralScale;
+}
+
+}  // namespace inviwo
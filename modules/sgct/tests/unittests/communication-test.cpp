@@ -0,0 +1,100 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/sgct/io/communication.h>
+
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+std::vector<SgctCommand> roundTrip(const std::vector<SgctCommand>& commands, bool compress) {
+    std::vector<std::byte> encoded;
+    util::encode(commands, encoded);
+    std::vector<std::byte> packed;
+    util::pack(encoded, packed, compress);
+
+    std::vector<SgctCommand> decoded;
+    util::decode(packed, decoded);
+    return decoded;
+}
+
+}  // namespace
+
+TEST(SGCTCommunication, RoundTrip) {
+    const std::string large(10000, 'x');
+    const std::vector<SgctCommand> commands{
+        command::AddProcessor{"<processor/>"}, command::Update{large}, command::Stats{true},
+        command::UpdateDelta{3, 5, "delta"}, command::RemoveProcessor{"id"},
+        command::FileChunk{"/data/volume.raw", 16, 32, "chunk"}};
+
+    for (const bool compress : {false, true}) {
+        const auto decoded = roundTrip(commands, compress);
+        ASSERT_EQ(commands.size(), decoded.size());
+
+        EXPECT_EQ("<processor/>", std::get<command::AddProcessor>(decoded[0]).data);
+        EXPECT_EQ(large, std::get<command::Update>(decoded[1]).data);
+        EXPECT_TRUE(std::get<command::Stats>(decoded[2]).show);
+        const auto& delta = std::get<command::UpdateDelta>(decoded[3]);
+        EXPECT_EQ(size_t{3}, delta.prefix);
+        EXPECT_EQ(size_t{5}, delta.suffix);
+        EXPECT_EQ("delta", delta.data);
+        EXPECT_EQ("id", std::get<command::RemoveProcessor>(decoded[4]).data);
+        const auto& chunk = std::get<command::FileChunk>(decoded[5]);
+        EXPECT_EQ("/data/volume.raw", chunk.path);
+        EXPECT_EQ(size_t{16}, chunk.offset);
+        EXPECT_EQ(size_t{32}, chunk.size);
+        EXPECT_EQ("chunk", chunk.data);
+    }
+}
+
+TEST(SGCTCommunication, Compress) {
+    const std::vector<SgctCommand> commands{command::Update{std::string(10000, 'x')}};
+    std::vector<std::byte> encoded;
+    util::encode(commands, encoded);
+
+    std::vector<std::byte> packed;
+    util::pack(encoded, packed, true);
+    EXPECT_LT(packed.size(), encoded.size());
+
+    util::pack(encoded, packed, false);
+    EXPECT_GT(packed.size(), encoded.size());
+
+    util::pack({}, packed, true);
+    EXPECT_TRUE(packed.empty());
+}
+
+}  // namespace inviwo
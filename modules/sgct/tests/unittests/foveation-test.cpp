@@ -0,0 +1,60 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/sgct/sgctutil.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace inviwo {
+
+TEST(SGCTFoveation, Scale) {
+    const vec3 forward{0.0f, 0.0f, -1.0f};
+    EXPECT_EQ(util::foveationScale(mat4{1.0f}, forward, 60.0f, 0.5f), 1.0f);
+
+    // Looking to the side and backwards
+    const mat4 side = glm::rotate(mat4{1.0f}, glm::radians(90.0f), vec3{0.0f, 1.0f, 0.0f});
+    EXPECT_EQ(util::foveationScale(side, forward, 60.0f, 0.5f), 0.5f);
+    EXPECT_EQ(util::foveationScale(side, forward, 100.0f, 0.5f), 1.0f);
+    const mat4 back = glm::rotate(mat4{1.0f}, glm::radians(180.0f), vec3{0.0f, 1.0f, 0.0f});
+    EXPECT_EQ(util::foveationScale(back, forward, 120.0f, 0.25f), 0.25f);
+
+    // The translation of the view should not matter
+    const mat4 moved = glm::translate(mat4{1.0f}, vec3{5.0f, 0.0f, 0.0f});
+    EXPECT_EQ(util::foveationScale(moved, forward, 10.0f, 0.5f), 1.0f);
+
+    // No direction disables the foveation
+    EXPECT_EQ(util::foveationScale(side, vec3{0.0f}, 60.0f, 0.5f), 1.0f);
+}
+
+}  // namespace inviwo
@@ -294,7 +294,6 @@ void main() {
 
     int tetraId = tetraFaceId / 4;
     int localFaceId = tetraFaceId % 4;
-    ivec4 vertices = vertexIds[tetraId];
 
     // determine scalar value at entry position
     Tetra tetra = getTetra(tetraId);
@@ -316,7 +315,6 @@ void main() {
         // find next tetra
         tetraId = tetraFaceId / 4;
         localFaceId = tetraFaceId % 4;
-        vertices = vertexIds[tetraId];
 
         // query data of current tetrahedron
         tetra = getTetra(tetraId);
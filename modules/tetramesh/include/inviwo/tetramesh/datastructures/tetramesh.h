@@ -37,6 +37,10 @@
 
 #include <fmt/format.h>
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace inviwo {
 
 /**
@@ -56,6 +60,15 @@ namespace inviwo {
  */
 class IVW_MODULE_TETRAMESH_API TetraMesh : public SpatialEntity {
 public:
+    /**
+     * Face adjacency of the tetrahedra, only depends on the node IDs.
+     * \see utiltetra::getOpposingFaces, utiltetra::getBoundaryFaces
+     */
+    struct Adjacency {
+        std::vector<ivec4> opposingFaces;
+        std::vector<int> boundaryFaces;
+    };
+
     TetraMesh() = default;
     virtual TetraMesh* clone() const = 0;
     virtual ~TetraMesh() = default;
@@ -86,6 +99,27 @@ public:
      * @return scalar value range
      */
     virtual dvec2 getDataRange() const = 0;
+
+    /**
+     * Return the face adjacency of the tetrahedra. It is computed on first use and then cached,
+     * clones of the mesh share the cached adjacency as long as their node IDs are not changed.
+     */
+    std::shared_ptr<const Adjacency> getAdjacency() const;
+
+protected:
+    TetraMesh(const TetraMesh& rhs);
+    TetraMesh& operator=(const TetraMesh& that);
+
+    /**
+     * Has to be called by derived classes whenever the node IDs change
+     */
+    void invalidateAdjacency();
+
+private:
+    std::shared_ptr<const Adjacency> cachedAdjacency() const;
+
+    mutable std::mutex adjacencyMutex_;
+    mutable std::shared_ptr<const Adjacency> adjacency_;
 };
 
 template <>
@@ -0,0 +1,79 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/tetramesh/tetrameshmoduledefine.h>
+#include <inviwo/tetramesh/ports/tetrameshport.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/ports/volumeport.h>
+
+#include <modules/opengl/shader/shader.h>
+#include <modules/opengl/buffer/bufferobject.h>
+#include <modules/opengl/buffer/bufferobjectarray.h>
+#include <modules/opengl/buffer/framebufferobject.h>
+
+#include <vector>
+
+namespace inviwo {
+
+class IVW_MODULE_TETRAMESH_API TetraMeshToVolume : public Processor {
+public:
+    TetraMeshToVolume();
+
+    virtual void initializeResources() override;
+    virtual void process() override;
+
+    virtual const ProcessorInfo& getProcessorInfo() const override;
+    static const ProcessorInfo processorInfo_;
+
+private:
+    void upload(const TetraMesh& mesh);
+
+    TetraMeshInport inport_;
+    VolumeOutport outport_;
+
+    IntSize3Property dimensions_;
+    FloatProperty outsideValue_;
+
+    Shader shader_;
+    BufferObject nodesBuffer_;
+    BufferObject nodeIdsBuffer_;
+    BufferObjectArray vao_;
+    FrameBufferObject fbo_;
+
+    // the tetrahedra are uploaded sorted by their lowest z coordinate in texture space so that
+    // only a contiguous range of them has to be drawn for each slice
+    std::vector<float> minDepths_;
+    float maxTetraDepth_ = 0.0f;
+    mat4 dataToTexture_{1.0f};
+};
+
+}  // namespace inviwo
@@ -31,7 +31,9 @@
 
 #include <inviwo/tetramesh/tetrameshmoduledefine.h>
 #include <inviwo/tetramesh/ports/tetrameshport.h>
+#include <inviwo/tetramesh/datastructures/tetramesh.h>
 #include <inviwo/tetramesh/datastructures/tetrameshbuffers.h>
+#include <inviwo/tetramesh/util/tetrameshutils.h>
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/properties/cameraproperty.h>
 #include <inviwo/core/properties/ordinalproperty.h>
@@ -75,6 +77,10 @@ private:
 
     std::vector<vec4> tetraNodes_;
     std::vector<ivec4> tetraNodeIds_;
+
+    // spatial order of the uploaded nodes and tetrahedra, reused while the adjacency is the same
+    std::shared_ptr<const TetraMesh::Adjacency> adjacency_;
+    utiltetra::SpatialOrder order_;
 };
 
 }  // namespace inviwo
@@ -48,6 +48,10 @@ namespace utiltetra {
  * The four face IDs of a single tetrahedron are stored in an ivec4. The order matches the vertex
  * IDs in \p nodeIds so that the corresponding node is the apex of the face.
  *
+ * The faces are matched in parallel by counting sort of all faces into buckets of their smallest
+ * node ID. If more than two faces share the same nodes, they are paired in order of their face ID.
+ * Use TetraMesh::getAdjacency to reuse the result for the same mesh.
+ *
  * @param nodeIds        contains four node IDs for each tetrahedron
  * @return opposing faces where a negative index indicates a boundary face, that is no neighboring
  *         tetrahedron
@@ -62,6 +66,44 @@ IVW_MODULE_TETRAMESH_API std::vector<ivec4> getOpposingFaces(const std::vector<i
  */
 IVW_MODULE_TETRAMESH_API std::vector<int> getBoundaryFaces(const std::vector<ivec4>& opposingFaces);
 
+/**
+ * A renumbering of the nodes and tetrahedra of a tetrahedral mesh, holding the original IDs in
+ * their new order.
+ */
+struct SpatialOrder {
+    std::vector<int> nodes;
+    std::vector<int> tetras;
+};
+
+/**
+ * Determine an order of the nodes and tetrahedra along a Z-order (Morton) curve through their
+ * positions and centroids, respectively. Tetrahedra close to each other in space will then also be
+ * close in memory, which improves the cache hit rate when walking from one tetrahedron to its
+ * neighbors during rendering. The order only depends on the node positions and IDs and can be
+ * reused as long as these do not change.
+ *
+ * @param nodes     vertex positions of the tetrahedra
+ * @param nodeIds   contains four node IDs for each tetrahedron
+ * @return new order of nodes and tetrahedra
+ * \see reorder
+ */
+IVW_MODULE_TETRAMESH_API SpatialOrder getSpatialOrder(const std::vector<vec4>& nodes,
+                                                      const std::vector<ivec4>& nodeIds);
+
+/**
+ * Renumber the nodes and tetrahedra in-place according to \p order and update the node IDs and
+ * opposing faces accordingly. The node order within each tetrahedron is kept, hence the face
+ * orientation and the local face IDs do not change.
+ *
+ * @param order          new order of nodes and tetrahedra, see getSpatialOrder
+ * @param nodes          vertex positions of the tetrahedra
+ * @param nodeIds        contains four node IDs for each tetrahedron
+ * @param opposingFaces  opposing face IDs of each tetrahedron, see getOpposingFaces
+ */
+IVW_MODULE_TETRAMESH_API void reorder(const SpatialOrder& order, std::vector<vec4>& nodes,
+                                      std::vector<ivec4>& nodeIds,
+                                      std::vector<ivec4>& opposingFaces);
+
 /**
  * Create a triangular mesh from a tetrahedral mesh that consists only of the boundary faces and no
  * interior triangles. Note that holes in the tetra mesh also feature boundary faces.
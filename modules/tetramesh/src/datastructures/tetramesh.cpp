@@ -28,5 +28,46 @@
  *********************************************************************************/
 
 #include <inviwo/tetramesh/datastructures/tetramesh.h>
+#include <inviwo/tetramesh/util/tetrameshutils.h>
 
-namespace inviwo {}  // namespace inviwo
+namespace inviwo {
+
+TetraMesh::TetraMesh(const TetraMesh& rhs)
+    : SpatialEntity(rhs), adjacency_{rhs.cachedAdjacency()} {}
+
+TetraMesh& TetraMesh::operator=(const TetraMesh& that) {
+    if (this != &that) {
+        SpatialEntity::operator=(that);
+        auto adjacency = that.cachedAdjacency();
+        const std::scoped_lock lock{adjacencyMutex_};
+        adjacency_ = std::move(adjacency);
+    }
+    return *this;
+}
+
+std::shared_ptr<const TetraMesh::Adjacency> TetraMesh::getAdjacency() const {
+    const std::scoped_lock lock{adjacencyMutex_};
+    if (!adjacency_) {
+        std::vector<vec4> nodes;
+        std::vector<ivec4> nodeIds;
+        get(nodes, nodeIds);
+
+        auto opposingFaces = utiltetra::getOpposingFaces(nodeIds);
+        auto boundaryFaces = utiltetra::getBoundaryFaces(opposingFaces);
+        adjacency_ =
+            std::make_shared<const Adjacency>(std::move(opposingFaces), std::move(boundaryFaces));
+    }
+    return adjacency_;
+}
+
+std::shared_ptr<const TetraMesh::Adjacency> TetraMesh::cachedAdjacency() const {
+    const std::scoped_lock lock{adjacencyMutex_};
+    return adjacency_;
+}
+
+void TetraMesh::invalidateAdjacency() {
+    const std::scoped_lock lock{adjacencyMutex_};
+    adjacency_.reset();
+}
+
+}  // namespace inviwo
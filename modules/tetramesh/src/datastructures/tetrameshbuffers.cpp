@@ -29,7 +29,6 @@
 
 #include <inviwo/tetramesh/datastructures/tetrameshbuffers.h>
 #include <inviwo/tetramesh/datastructures/tetramesh.h>
-#include <inviwo/tetramesh/util/tetrameshutils.h>
 
 namespace inviwo {
 
@@ -51,7 +50,7 @@ void TetraMeshBuffers::upload(const TetraMesh& mesh) {
     std::vector<vec4> nodes;
     std::vector<ivec4> nodeIds;
     mesh.get(nodes, nodeIds);
-    upload(nodes, nodeIds, utiltetra::getOpposingFaces(nodeIds));
+    upload(nodes, nodeIds, mesh.getAdjacency()->opposingFaces);
 }
 
 void TetraMeshBuffers::upload(const std::vector<vec4>& nodes, const std::vector<ivec4>& nodeIds,
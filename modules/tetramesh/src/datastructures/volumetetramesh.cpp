@@ -81,6 +81,7 @@ void VolumeTetraMesh::setData(const std::shared_ptr<const Volume>& volume, int c
 
     volume_ = volume;
     channel_ = channel;
+    invalidateAdjacency();
     setModelMatrix(detail::tetraBoundingBox(*volume_));
     setWorldMatrix(mat4(1.0f));
 }
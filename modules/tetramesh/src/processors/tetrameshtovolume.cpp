@@ -0,0 +1,205 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tetramesh/processors/tetrameshtovolume.h>
+#include <inviwo/tetramesh/datastructures/tetramesh.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/util/formats.h>
+#include <modules/opengl/glformats.h>
+#include <modules/opengl/openglcapabilities.h>
+#include <modules/opengl/openglutils.h>
+#include <modules/opengl/shader/shadertype.h>
+#include <modules/opengl/texture/texture3d.h>
+#include <modules/opengl/volume/volumegl.h>
+
+#include <glm/gtx/component_wise.hpp>
+#include <glm/gtx/transform.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo TetraMeshToVolume::processorInfo_{
+    "org.inviwo.TetraMeshToVolume",                  // Class identifier
+    "TetraMesh To Volume",                           // Display name
+    "Unstructured Grids",                            // Category
+    CodeState::Experimental,                         // Code state
+    Tags::GL | Tag{"Volume"} | Tag{"Unstructured"},  // Tags
+    R"(
+Resample a tetrahedral mesh onto a regular grid covering the bounding box of its nodes. The
+tetrahedra are rasterized slice by slice on the GPU and the scalar values are interpolated using
+barycentric interpolation. Voxels outside of the mesh are set to the outside value. This processor
+requires OpenGL 4.3 since it relies on Shader Storage Buffer Objects.)"_unindentHelp};
+
+const ProcessorInfo& TetraMeshToVolume::getProcessorInfo() const { return processorInfo_; }
+
+TetraMeshToVolume::TetraMeshToVolume()
+    : Processor{}
+    , inport_{"tetramesh", "Tetrahedral mesh to be resampled"_help}
+    , outport_{"volume", "Resampled scalar values of the tetrahedral mesh (Float32)"_help}
+    , dimensions_{"dimensions", "Dimensions",
+                  util::ordinalCount(size3_t{128}, size3_t{1024})
+                      .setMin(size3_t{1})
+                      .set("Dimensions of the resulting volume"_help)}
+    , outsideValue_{"outsideValue", "Outside Value",
+                    util::ordinalSymmetricVector(0.0f, 1.0f)
+                        .set(PropertySemantics::Text)
+                        .set("Value of voxels not covered by any tetrahedron"_help)}
+    , shader_{{{ShaderType::Vertex, "tetramesh_resample.vert"},
+               {ShaderType::Geometry, "tetramesh_resample.geom"},
+               {ShaderType::Fragment, "tetramesh_resample.frag"}},
+              Shader::Build::No}
+    , nodesBuffer_{0, GLFormats::getGLFormat(GL_FLOAT, 4), GL_STATIC_DRAW,
+                   GL_SHADER_STORAGE_BUFFER}
+    , nodeIdsBuffer_{0, GLFormats::getGLFormat(GL_INT, 4), GL_STATIC_DRAW,
+                     GL_SHADER_STORAGE_BUFFER} {
+
+    addPorts(inport_, outport_);
+    addProperties(dimensions_, outsideValue_);
+
+    shader_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
+
+    if (OpenGLCapabilities::getOpenGLVersion() < 430 &&
+        !OpenGLCapabilities::isExtensionSupported("ARB_shader_storage_buffer_object")) {
+        isReady_.setUpdate([]() -> ProcessorStatus {
+            return {ProcessorStatus::Error,
+                    "OpenGL v4.3 or Shader Storage Buffer Objects "
+                    "(ARB_shader_storage_buffer_object) is required."};
+        });
+    }
+}
+
+void TetraMeshToVolume::initializeResources() { shader_.build(); }
+
+void TetraMeshToVolume::upload(const TetraMesh& mesh) {
+    std::vector<vec4> nodes;
+    std::vector<ivec4> nodeIds;
+    mesh.get(nodes, nodeIds);
+
+    vec3 lower{std::numeric_limits<float>::max()};
+    vec3 upper{std::numeric_limits<float>::lowest()};
+    for (const auto& node : nodes) {
+        lower = glm::min(lower, vec3{node});
+        upper = glm::max(upper, vec3{node});
+    }
+    const vec3 extent = nodes.empty() ? vec3{1.0f} : glm::max(upper - lower, vec3{1.0e-6f});
+    if (nodes.empty()) lower = vec3{0.0f};
+    dataToTexture_ = glm::scale(1.0f / extent) * glm::translate(-lower);
+
+    // sort the tetrahedra by their lowest z coordinate
+    std::vector<std::pair<float, int>> depths(nodeIds.size());
+    maxTetraDepth_ = 0.0f;
+    for (size_t i = 0; i < nodeIds.size(); ++i) {
+        const auto& ids = nodeIds[i];
+        const vec4 z{nodes[ids[0]].z, nodes[ids[1]].z, nodes[ids[2]].z, nodes[ids[3]].z};
+        const float minZ = (glm::compMin(z) - lower.z) / extent.z;
+        const float maxZ = (glm::compMax(z) - lower.z) / extent.z;
+        depths[i] = {minZ, static_cast<int>(i)};
+        maxTetraDepth_ = std::max(maxTetraDepth_, maxZ - minZ);
+    }
+    std::sort(depths.begin(), depths.end());
+
+    std::vector<ivec4> sortedIds(nodeIds.size());
+    minDepths_.resize(nodeIds.size());
+    for (size_t i = 0; i < depths.size(); ++i) {
+        minDepths_[i] = depths[i].first;
+        sortedIds[i] = nodeIds[depths[i].second];
+    }
+
+    nodesBuffer_.upload(nodes, BufferObject::SizePolicy::ResizeToFit);
+    nodeIdsBuffer_.upload(sortedIds, BufferObject::SizePolicy::ResizeToFit);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void TetraMeshToVolume::process() {
+    const auto& tetraMesh = *inport_.getData();
+    if (inport_.isChanged()) {
+        upload(tetraMesh);
+    }
+
+    const size3_t dims{dimensions_.get()};
+    const dvec2 dataRange{tetraMesh.getDataRange()};
+    const dvec2 range{std::min(dataRange.x, static_cast<double>(outsideValue_.get())),
+                      std::max(dataRange.y, static_cast<double>(outsideValue_.get()))};
+    auto volume = std::make_shared<Volume>(
+        VolumeConfig{.dimensions = dims,
+                     .format = DataFloat32::get(),
+                     .swizzleMask = swizzlemasks::defaultData(1),
+                     .dataRange = range,
+                     .valueRange = range,
+                     .model = tetraMesh.getModelMatrix() * glm::inverse(dataToTexture_),
+                     .world = tetraMesh.getWorldMatrix()});
+
+    auto* volumeGL = volume->getEditableRepresentation<VolumeGL>();
+    auto* texture = volumeGL->getTexture().get();
+
+    utilgl::GlBoolState depthTest(GL_DEPTH_TEST, false);
+    utilgl::GlBoolState blend(GL_BLEND, false);
+    utilgl::GlBoolState cullFace(GL_CULL_FACE, false);
+    utilgl::ViewportState viewport(0, 0, static_cast<GLsizei>(dims.x),
+                                   static_cast<GLsizei>(dims.y));
+    utilgl::ClearColor clearColor(vec4{outsideValue_.get()});
+
+    utilgl::ActivateFBO fbo{fbo_};
+    shader_.activate();
+    shader_.setUniform("dataToTexture", dataToTexture_);
+    nodesBuffer_.bindBase(0);
+    nodeIdsBuffer_.bindBase(1);
+    vao_.bind();
+
+    for (size_t z = 0; z < dims.z; ++z) {
+        fbo_.attachColorTextureLayer(texture, 0, static_cast<int>(z));
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        // only the tetrahedra starting at most one tetrahedron depth below the slice can
+        // intersect it
+        const float slice = (static_cast<float>(z) + 0.5f) / static_cast<float>(dims.z);
+        const auto first =
+            std::lower_bound(minDepths_.begin(), minDepths_.end(), slice - maxTetraDepth_);
+        const auto last = std::upper_bound(first, minDepths_.end(), slice);
+        if (first == last) continue;
+
+        shader_.setUniform("slice", slice);
+        glDrawArrays(GL_POINTS, static_cast<GLint>(first - minDepths_.begin()),
+                     static_cast<GLsizei>(last - first));
+    }
+
+    vao_.unbind();
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    shader_.deactivate();
+    fbo_.detachTexture(GL_COLOR_ATTACHMENT0);
+
+    outport_.setData(volume);
+}
+
+}  // namespace inviwo
@@ -131,7 +131,15 @@ void TetraMeshVolumeRaycaster::process() {
         const auto& tetraMesh = *inport_.getData();
 
         tetraMesh.get(tetraNodes_, tetraNodeIds_);
-        auto opposingFaces = utiltetra::getOpposingFaces(tetraNodeIds_);
+        if (auto adjacency = tetraMesh.getAdjacency(); adjacency != adjacency_) {
+            order_ = utiltetra::getSpatialOrder(tetraNodes_, tetraNodeIds_);
+            adjacency_ = std::move(adjacency);
+        }
+
+        // upload nodes and tetrahedra in Morton order, neighboring tetrahedra are then likely to
+        // be close in memory when traversing the mesh in the shader
+        auto opposingFaces = adjacency_->opposingFaces;
+        utiltetra::reorder(order_, tetraNodes_, tetraNodeIds_, opposingFaces);
 
         buffers_->upload(tetraNodes_, tetraNodeIds_, opposingFaces);
         mesh_ = utiltetra::createBoundaryMesh(tetraMesh, tetraNodes_, tetraNodeIds_,
@@ -31,6 +31,7 @@
 
 #include <inviwo/tetramesh/datastructures/tetramesh.h>
 #include <inviwo/tetramesh/processors/tetrameshboundingbox.h>
+#include <inviwo/tetramesh/processors/tetrameshtovolume.h>
 #include <inviwo/tetramesh/processors/tetrameshvolumeraycaster.h>
 #include <inviwo/tetramesh/processors/tetrameshboundaryextractor.h>
 #include <inviwo/tetramesh/processors/transformtetramesh.h>
@@ -48,6 +49,7 @@ TetraMeshModule::TetraMeshModule(InviwoApplication* app) : InviwoModule(app, "Te
 
     registerProcessor<TetraMeshBoundaryExtractor>();
     registerProcessor<TetraMeshBoundingBox>();
+    registerProcessor<TetraMeshToVolume>();
     registerProcessor<TetraMeshVolumeRaycaster>();
     registerProcessor<TransformTetraMesh>();
     registerProcessor<VolumeToTetraMesh>();
@@ -32,13 +32,21 @@
 
 #include <inviwo/core/datastructures/geometry/mesh.h>
 #include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/util/parallel.h>
 #include <inviwo/core/util/zip.h>
 
 #include <glm/gtx/transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <glm/gtx/component_wise.hpp>
 
 #include <algorithm>
-#include <unordered_map>
+#include <atomic>
+#include <compare>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <utility>
 
 namespace inviwo {
 
@@ -46,75 +54,208 @@ namespace utiltetra {
 
 namespace detail {
 
-struct TriangleKey {
-    TriangleKey(const ivec3& indices) : tri{indices} {
-        std::sort(glm::value_ptr(tri), glm::value_ptr(tri) + 3);
-    }
-    TriangleKey(int a, int b, int c) : tri{a, b, c} {
-        std::sort(glm::value_ptr(tri), glm::value_ptr(tri) + 3);
-    }
-
-    bool operator==(const TriangleKey& rhs) const { return tri == rhs.tri; }
+/**
+ * A face of a tetrahedron, stored in the bucket of its smallest node ID. Sorting the faces of a
+ * bucket places faces with the same nodes next to each other, ordered by face ID.
+ */
+struct BucketFace {
+    int mid;
+    int max;
+    int faceId;
 
-    ivec3 tri;
+    auto operator<=>(const BucketFace&) const = default;
 };
 
-struct TriangleHash {
-    size_t operator()(const TriangleKey& key) const {
-        size_t seed = 0;
-        inviwo::util::hash_combine(seed, key.tri[0]);
-        inviwo::util::hash_combine(seed, key.tri[1]);
-        inviwo::util::hash_combine(seed, key.tri[2]);
-        return seed;
-    }
-};
+// the sorted node IDs of the face opposite of node \p face
+ivec3 sortedFace(const ivec4& ids, int face) {
+    ivec3 tri{ids[(face + 1) % 4], ids[(face + 2) % 4], ids[(face + 3) % 4]};
+    std::sort(glm::value_ptr(tri), glm::value_ptr(tri) + 3);
+    return tri;
+}
 
 int globalFaceId(int tetra, int face) { return tetra * 4 + face; }
 
+// Spread the lowest 21 bits of x such that there are two zero bits between each of them
+std::uint64_t spreadBits(std::uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+std::uint64_t mortonCode(const vec3& p, const vec3& lower, const vec3& scale) {
+    const auto cell = glm::clamp(uvec3((p - lower) * scale), uvec3{0}, uvec3{0x1fffff});
+    return spreadBits(cell.x) | (spreadBits(cell.y) << 1) | (spreadBits(cell.z) << 2);
+}
+
+// The IDs of all elements sorted by their Morton code
+std::vector<int> mortonOrder(size_t size, auto position, const vec3& lower, const vec3& scale) {
+    std::vector<std::pair<std::uint64_t, int>> keyed(size);
+    util::parallelFor(0, size, [&](size_t i) {
+        keyed[i] = {mortonCode(position(i), lower, scale), static_cast<int>(i)};
+    });
+    std::sort(keyed.begin(), keyed.end());
+
+    std::vector<int> order(size);
+    std::ranges::transform(keyed, order.begin(), [](const auto& item) { return item.second; });
+    return order;
+}
+
 }  // namespace detail
 
 std::vector<ivec4> getOpposingFaces(const std::vector<ivec4>& nodeIds) {
-    using TetraId = int;
-    using FaceId = int;
-
-    std::unordered_map<detail::TriangleKey, std::pair<TetraId, FaceId>, detail::TriangleHash>
-        adjacency;
     std::vector<ivec4> opposingFaces(nodeIds.size(), ivec4(-1));
+    if (nodeIds.empty()) return opposingFaces;
+
+    const auto numNodes = static_cast<size_t>(util::parallelReduce(
+        size_t{0}, nodeIds.size(), -1,
+        [&](size_t first, size_t last) {
+            int maxId = -1;
+            for (size_t i = first; i < last; ++i) maxId = std::max(maxId, glm::compMax(nodeIds[i]));
+            return maxId;
+        },
+        [](int a, int b) { return std::max(a, b); }) + 1);
 
-    for (int tetra = 0; tetra < std::ssize(nodeIds); ++tetra) {
+    // Counting sort of all faces into buckets of their smallest node ID. Matching faces end up
+    // in the same bucket, and since the buckets are small they can be matched independently.
+    std::vector<int> offsets(numNodes + 1, 0);
+    util::parallelFor(0, nodeIds.size(), [&](size_t tetra) {
         for (int face = 0; face < 4; ++face) {
-            // determine indices of half face opposing the current one
-            int nextHf = (face + 1) % 4;
-            int midHf = (face + 2) % 4;
-            int prevHf = (face + 3) % 4;
-
-            detail::TriangleKey tri{nodeIds[tetra][nextHf], nodeIds[tetra][midHf],
-                                    nodeIds[tetra][prevHf]};
-
-            if (auto adjIt = adjacency.find(tri); adjIt != adjacency.end()) {
-                auto&& [opposingTetra, opposingFace] = adjIt->second;
-                opposingFaces[tetra][face] = detail::globalFaceId(opposingTetra, opposingFace);
-                opposingFaces[opposingTetra][opposingFace] = detail::globalFaceId(tetra, face);
-                adjacency.erase(adjIt);
-            } else {
-                adjacency.insert({tri, {tetra, face}});
+            const auto node = detail::sortedFace(nodeIds[tetra], face).x;
+            std::atomic_ref<int>{offsets[node + 1]}.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<detail::BucketFace> faces(4 * nodeIds.size());
+    std::vector<int> cursors(offsets.begin(), offsets.end() - 1);
+    util::parallelFor(0, nodeIds.size(), [&](size_t tetra) {
+        for (int face = 0; face < 4; ++face) {
+            const auto tri = detail::sortedFace(nodeIds[tetra], face);
+            const auto pos =
+                std::atomic_ref<int>{cursors[tri.x]}.fetch_add(1, std::memory_order_relaxed);
+            faces[pos] = {tri.y, tri.z, detail::globalFaceId(static_cast<int>(tetra), face)};
+        }
+    });
+
+    // Pair up consecutive faces with the same nodes. Each face is only part of a single bucket,
+    // so every entry of the opposing faces is written by at most one thread.
+    util::parallelFor(0, numNodes, [&](size_t first, size_t last) {
+        for (size_t node = first; node < last; ++node) {
+            const auto begin = faces.begin() + offsets[node];
+            const auto end = faces.begin() + offsets[node + 1];
+            std::sort(begin, end);
+            for (auto it = begin; it != end && std::next(it) != end;) {
+                const auto next = std::next(it);
+                if (it->mid == next->mid && it->max == next->max) {
+                    opposingFaces[it->faceId / 4][it->faceId % 4] = next->faceId;
+                    opposingFaces[next->faceId / 4][next->faceId % 4] = it->faceId;
+                    it = std::next(next);
+                } else {
+                    it = next;
+                }
             }
         }
-    }
+    });
+
     return opposingFaces;
 }
 
 std::vector<int> getBoundaryFaces(const std::vector<ivec4>& opposingFaces) {
-    std::vector<int> boundaryFaces;
-    for (int tetra = 0; tetra < std::ssize(opposingFaces); ++tetra) {
-        for (int face = 0; face < 4; ++face) {
-            if (opposingFaces[tetra][face] < 0) {
-                const int faceId = detail::globalFaceId(tetra, face);
-                boundaryFaces.push_back(faceId);
+    return util::parallelReduce(
+        size_t{0}, opposingFaces.size(), std::vector<int>{},
+        [&](size_t first, size_t last) {
+            std::vector<int> boundaryFaces;
+            for (size_t tetra = first; tetra < last; ++tetra) {
+                for (int face = 0; face < 4; ++face) {
+                    if (opposingFaces[tetra][face] < 0) {
+                        boundaryFaces.push_back(
+                            detail::globalFaceId(static_cast<int>(tetra), face));
+                    }
+                }
+            }
+            return boundaryFaces;
+        },
+        [](std::vector<int> a, const std::vector<int>& b) {
+            a.insert(a.end(), b.begin(), b.end());
+            return a;
+        });
+}
+
+SpatialOrder getSpatialOrder(const std::vector<vec4>& nodes, const std::vector<ivec4>& nodeIds) {
+    if (nodes.empty()) return {};
+
+    using Bounds = std::pair<vec3, vec3>;
+    const auto [lower, upper] = util::parallelReduce(
+        size_t{0}, nodes.size(),
+        Bounds{vec3{std::numeric_limits<float>::max()}, vec3{std::numeric_limits<float>::lowest()}},
+        [&](size_t first, size_t last) {
+            Bounds bounds{vec3{std::numeric_limits<float>::max()},
+                          vec3{std::numeric_limits<float>::lowest()}};
+            for (size_t i = first; i < last; ++i) {
+                bounds.first = glm::min(bounds.first, vec3{nodes[i]});
+                bounds.second = glm::max(bounds.second, vec3{nodes[i]});
+            }
+            return bounds;
+        },
+        [](const Bounds& a, const Bounds& b) {
+            return Bounds{glm::min(a.first, b.first), glm::max(a.second, b.second)};
+        });
+
+    // map the bounding box onto 21 bits per dimension
+    const vec3 extent = upper - lower;
+    const vec3 scale = glm::mix(vec3{static_cast<float>(0x1fffff)} / extent, vec3{0.0f},
+                                glm::lessThanEqual(extent, vec3{0.0f}));
+
+    return {detail::mortonOrder(
+                nodes.size(), [&](size_t i) { return vec3{nodes[i]}; }, lower, scale),
+            detail::mortonOrder(
+                nodeIds.size(),
+                [&](size_t i) {
+                    const auto& ids = nodeIds[i];
+                    return (vec3{nodes[ids[0]]} + vec3{nodes[ids[1]]} + vec3{nodes[ids[2]]} +
+                            vec3{nodes[ids[3]]}) *
+                           0.25f;
+                },
+                lower, scale)};
+}
+
+void reorder(const SpatialOrder& order, std::vector<vec4>& nodes, std::vector<ivec4>& nodeIds,
+             std::vector<ivec4>& opposingFaces) {
+    const auto inverse = [](const std::vector<int>& ids) {
+        std::vector<int> result(ids.size());
+        util::parallelFor(0, ids.size(), [&](size_t i) { result[ids[i]] = static_cast<int>(i); });
+        return result;
+    };
+    const auto newNodeIds = inverse(order.nodes);
+    const auto newTetraIds = inverse(order.tetras);
+
+    std::vector<vec4> orderedNodes(nodes.size());
+    util::parallelFor(0, nodes.size(), [&](size_t i) { orderedNodes[i] = nodes[order.nodes[i]]; });
+
+    const bool hasFaces = !opposingFaces.empty();
+    std::vector<ivec4> orderedNodeIds(nodeIds.size());
+    std::vector<ivec4> orderedFaces(opposingFaces.size());
+    util::parallelFor(0, nodeIds.size(), [&](size_t i) {
+        const auto tetra = order.tetras[i];
+        for (int j = 0; j < 4; ++j) {
+            orderedNodeIds[i][j] = newNodeIds[nodeIds[tetra][j]];
+        }
+        if (hasFaces) {
+            for (int face = 0; face < 4; ++face) {
+                const auto faceId = opposingFaces[tetra][face];
+                orderedFaces[i][face] =
+                    faceId < 0 ? faceId : detail::globalFaceId(newTetraIds[faceId / 4], faceId % 4);
             }
         }
-    }
-    return boundaryFaces;
+    });
+
+    nodes = std::move(orderedNodes);
+    nodeIds = std::move(orderedNodeIds);
+    opposingFaces = std::move(orderedFaces);
 }
 
 std::shared_ptr<Mesh> createBoundaryMesh(const TetraMesh& tetraMesh, const std::vector<vec4>& nodes,
@@ -153,7 +294,7 @@ std::shared_ptr<Mesh> createBoundaryMesh(const TetraMesh& mesh) {
     std::vector<vec4> nodes;
     std::vector<ivec4> nodeIds;
     mesh.get(nodes, nodeIds);
-    return createBoundaryMesh(mesh, nodes, nodeIds, getBoundaryFaces(getOpposingFaces(nodeIds)));
+    return createBoundaryMesh(mesh, nodes, nodeIds, mesh.getAdjacency()->boundaryFaces);
 }
 
 void fixFaceOrientation(const std::vector<vec4>& nodes, std::vector<ivec4>& nodeIds) {
@@ -0,0 +1,76 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+// Draws the widgets and labels collected by glui::Renderer, see renderui.frag and labelui.frag
+// for the corresponding shaders of a single widget or label.
+
+// widget textures for all UI states, halos, and borders
+uniform sampler2DArray uiAtlas;
+uniform sampler2D labelAtlas;
+
+in vec4 color;
+in vec4 borderColor;
+in vec4 haloColor;
+in vec3 pickingColor;
+in vec2 texCoord;
+flat in ivec4 layers;
+flat in vec2 texCoordMax;
+
+void main() {
+    if (layers.w == 1) {
+        // only use the alpha of the label texture
+        float alpha = texture(labelAtlas, texCoord).a;
+        FragData0 = color * alpha;
+        PickingData = vec4(0.0);
+        return;
+    }
+
+    // avoid sampling the unused part of the atlas layer next to smaller widget textures
+    vec2 halfTexel = 0.5 / vec2(textureSize(uiAtlas, 0).xy);
+    vec2 uv = clamp(texCoord, halfTexel, texCoordMax - halfTexel);
+
+    // the halo color is transparent unless the widget is hovered
+    vec4 halo = texture(uiAtlas, vec3(uv, layers.y));
+    vec4 dstColor = vec4(haloColor.rgb, haloColor.a * halo.a);
+
+    // border dominates if non-zero
+    vec4 fill = color * texture(uiAtlas, vec3(uv, layers.x));
+    vec4 border = borderColor * texture(uiAtlas, vec3(uv, layers.z));
+    vec4 widget = fill * (1.0 - border.a) + border * border.a;
+
+    // mix color with optional halo
+    dstColor = mix(dstColor, widget, widget.a);
+
+    // output premultiplied alpha, the whole batch is blended with GL_ONE, GL_ONE_MINUS_SRC_ALPHA
+    FragData0 = vec4(dstColor.rgb * dstColor.a, dstColor.a);
+
+    // prevent picking for transparent regions by setting the alpha to 0
+    float picking = step(0.0, widget.a - 0.001);
+    PickingData = vec4(pickingColor * picking, picking);
+}
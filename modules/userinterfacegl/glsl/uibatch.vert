@@ -0,0 +1,64 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include "utils/structs.glsl"
+
+// in_Vertex holds screen coords (pixel), in_Color the fill color of widgets or the label color,
+// and in_TexCoord the texture coordinates in either the UI atlas or the label atlas
+layout(location = 8) in vec4 in_BorderColor;
+layout(location = 9) in vec4 in_HaloColor;
+layout(location = 10) in vec3 in_PickingColor;
+// texture layers for fill, halo, and border, w is 1 for labels
+layout(location = 11) in ivec4 in_Layers;
+// largest texture coordinate of the widget texture within the UI atlas
+layout(location = 12) in vec2 in_TexCoordMax;
+
+uniform ImageParameters outportParameters;
+
+out vec4 color;
+out vec4 borderColor;
+out vec4 haloColor;
+out vec3 pickingColor;
+out vec2 texCoord;
+flat out ivec4 layers;
+flat out vec2 texCoordMax;
+
+void main() {
+    color = in_Color;
+    borderColor = in_BorderColor;
+    haloColor = in_HaloColor;
+    pickingColor = in_PickingColor;
+    texCoord = in_TexCoord.xy;
+    layers = in_Layers;
+    texCoordMax = in_TexCoordMax;
+
+    // transform incoming vertex coords from screen coords to normalized dev coords
+    vec2 pos = in_Vertex.xy * outportParameters.reciprocalDimensions * 2.0 - 1.0;
+    gl_Position = vec4(pos, -1.0, 1.0);
+}
@@ -44,7 +44,6 @@ namespace inviwo {
 class PickingEvent;
 class Processor;
 class TextRenderer;
-class Texture2D;
 
 namespace glui {
 class Renderer;
@@ -223,6 +222,7 @@ protected:
      * @return reference to the set-up text renderer
      */
     TextRenderer& getCurrentTextRenderer() const;
+    int getCurrentFontSize() const;
 
     std::function<void()>
         action_;  //<! is called by triggerAction() after the internal state has been updated
@@ -256,8 +256,6 @@ protected:
     std::string labelStr_;
     bool labelDirty_;
 
-    std::shared_ptr<Texture2D> labelTexture_;
-
     Processor* processor_;
     Renderer* uiRenderer_;
 
@@ -31,21 +31,31 @@
 
 #include <modules/userinterfacegl/userinterfaceglmoduledefine.h>  // for IVW_MODULE_USERINTERFAC...
 
+#include <inviwo/core/datastructures/buffer/buffer.h>      // for Buffer
 #include <inviwo/core/util/glmvec.h>                       // for vec4
 #include <modules/fontrendering/textrenderer.h>            // for TextRenderer
 #include <modules/opengl/rendering/texturequadrenderer.h>  // for TextureQuadRenderer
 #include <modules/opengl/shader/shader.h>                  // for Shader
 
-#include <map>     // for map
-#include <memory>  // for shared_ptr
-#include <string>  // for string, operator<
-#include <vector>  // for vector
+#include <array>          // for array
+#include <cstddef>        // for size_t
+#include <functional>     // for function
+#include <map>            // for map
+#include <memory>         // for shared_ptr
+#include <string>         // for string, operator<
+#include <string_view>    // for string_view
+#include <tuple>          // for tuple
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for pair
+#include <vector>         // for vector
 #include <filesystem>
 
 namespace inviwo {
 
+class Layer;
 class Mesh;
 class MeshDrawerGL;
+class Texture2D;
 class Texture2DArray;
 
 namespace glui {
@@ -57,10 +67,26 @@ namespace glui {
  * array consisting of six textures (widget state normal, pressed, checked plus corresponding
  * halos).
  *
+ * Widgets and labels are drawn in batches. Between beginBatch() and endBatch() all widget quads
+ * and labels are collected into a single vertex buffer, which is drawn with one draw call when
+ * the outermost batch ends. All widget textures are merged into one texture array atlas, and the
+ * labels are rendered once into a shared label atlas that is only updated when a new label shows
+ * up.
+ *
  * \see glui::Element
  */
 class IVW_MODULE_USERINTERFACEGL_API Renderer {
 public:
+    /**
+     * \brief colors and orientation of the widgets added with addWidget
+     */
+    struct WidgetStyle {
+        vec4 uiColor{0.0f, 0.0f, 0.0f, 1.0f};
+        vec4 borderColor{0.0f, 0.0f, 0.0f, 1.0f};
+        vec4 haloColor{1.0f, 1.0f, 1.0f, 1.0f};
+        bool vertical = false;  //!< rotate the widget textures by 90 degrees
+    };
+
     Renderer();
     virtual ~Renderer() = default;
 
@@ -113,12 +139,89 @@ public:
     void setDisabledColor(const vec4& color);
     const vec4& getDisabledColor() const;
 
+    /**
+     * \brief start collecting widgets and labels. Batches can be nested, everything is drawn
+     * when the outermost batch ends.
+     *
+     * @param canvasDim   dimensions of the current render target, only used by the outermost
+     *                    batch
+     */
+    void beginBatch(const size2_t& canvasDim);
+
+    /**
+     * \brief end the current batch. Ending the outermost batch draws all widgets and labels added
+     * since the matching beginBatch() with a single draw call, which is only split by custom draws.
+     */
+    void endBatch();
+
+    bool isBatching() const;
+
+    void setWidgetStyle(const WidgetStyle& style);
+    const WidgetStyle& getWidgetStyle() const;
+
+    /**
+     * \brief add a widget quad using the current widget style to the batch
+     *
+     * @param textures    texture set created by createUITextures
+     * @param textureMap  texture indices for normal, pressed, checked, halo normal, halo pressed,
+     *                    halo checked, border normal, border pressed, and border checked
+     * @param origin      lower left corner in screen coordinates
+     * @param extent      width and height in screen coordinates
+     * @param marginScale size of the fixed corners relative to the extent
+     * @param state       index of the UI state, i.e. normal, pressed, or checked
+     * @param hovered     draw the halo of the widget
+     * @param pickingColor picking color of the widget, vec3(0) for no picking
+     * @throws Exception if the textures were not created by this renderer
+     */
+    void addWidget(const Texture2DArray& textures, const std::array<int, 9>& textureMap,
+                   const vec2& origin, const vec2& extent, const vec2& marginScale, int state,
+                   bool hovered, const vec3& pickingColor);
+
+    /**
+     * \brief add a label in the current text color to the batch. The label is rendered into the
+     * label atlas once and reused as long as the atlas has space left.
+     *
+     * @param label     text of the label
+     * @param bold      use the bold text renderer
+     * @param fontSize  font size in pixels
+     * @param origin    lower left corner in screen coordinates
+     * @param extent    size of the label as given by TextRenderer::computeTextSize
+     */
+    void addLabel(std::string_view label, bool bold, int fontSize, const ivec2& origin,
+                  const ivec2& extent);
+
+    /**
+     * \brief add custom GL rendering to the batch. The batch is split at this point and @p draw
+     * is called between the widgets added before and after it.
+     */
+    void addCustomDraw(std::function<void()> draw);
+
 protected:
     void setupRectangleMesh();
 
     std::shared_ptr<Texture2DArray> createUITextureObject(
         const std::vector<std::filesystem::path>& textureFiles,
         const std::filesystem::path& sourcePath) const;
+    std::vector<std::shared_ptr<Layer>> readUITextures(
+        const std::vector<std::filesystem::path>& textureFiles,
+        const std::filesystem::path& sourcePath) const;
+    std::shared_ptr<Texture2DArray> createUITextureObject(
+        const std::vector<std::shared_ptr<Layer>>& textureLayers) const;
+
+    using LabelKey = std::tuple<std::string, bool, int>;
+    struct PendingLabel {
+        LabelKey key;
+        ivec2 extent;
+        size_t firstVertex;
+    };
+
+    void updateUIAtlas();
+    void resetLabelAtlas(const size2_t& dims);
+    bool renderLabel(const PendingLabel& label);
+    void resolveLabels();
+    void drawBatch();
+    void drawBatchRange(size_t first, size_t last);
+    void clearBatch();
 
     const int defaultFontSize_ = 13;
 
@@ -131,6 +234,34 @@ protected:
     std::shared_ptr<Mesh> rectangleMesh_;
 
     std::map<std::string, std::shared_ptr<Texture2DArray>> uiTextureMap_;
+    std::map<std::string, std::vector<std::shared_ptr<Layer>>> uiTextureLayers_;
+
+    // all UI textures merged into one texture array, first layer and uv scale of each texture set
+    std::shared_ptr<Texture2DArray> uiAtlas_;
+    std::unordered_map<const Texture2DArray*, std::pair<int, vec2>> uiAtlasEntries_;
+    bool uiAtlasDirty_ = true;
+
+    // labels are packed in rows, regions are x, y, width, and height in pixels
+    std::shared_ptr<Texture2D> labelAtlas_;
+    std::map<LabelKey, ivec4> labelRegions_;
+    ivec2 labelCursor_{0};
+    int labelRowHeight_ = 0;
+
+    Shader batchShader_;
+    std::shared_ptr<Buffer<vec2>> batchPositions_;
+    std::shared_ptr<Buffer<vec2>> batchTexCoords_;
+    std::shared_ptr<Buffer<vec4>> batchColors_;
+    std::shared_ptr<Buffer<vec4>> batchBorderColors_;
+    std::shared_ptr<Buffer<vec4>> batchHaloColors_;
+    std::shared_ptr<Buffer<vec3>> batchPickingColors_;
+    std::shared_ptr<Buffer<ivec4>> batchLayers_;
+    std::shared_ptr<Buffer<vec2>> batchTexCoordMax_;
+    std::shared_ptr<Mesh> batch_;
+    std::vector<PendingLabel> pendingLabels_;
+    std::vector<std::pair<size_t, std::function<void()>>> customDraws_;
+    int batchDepth_ = 0;
+    size2_t batchCanvasDim_{0};
+    WidgetStyle widgetStyle_;
 
     vec4 colorUI_;
     vec4 colorSecondaryUI_;
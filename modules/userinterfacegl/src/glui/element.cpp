@@ -29,20 +29,14 @@
 
 #include <modules/userinterfacegl/glui/element.h>
 
-#include <inviwo/core/interaction/events/pickingevent.h>   // for PickingEvent
-#include <inviwo/core/interaction/pickingstate.h>          // for PickingPressItem, PickingPress...
-#include <inviwo/core/processors/processor.h>              // for Processor
-#include <inviwo/core/properties/invalidationlevel.h>      // for InvalidationLevel, Invalidatio...
-#include <inviwo/core/util/colorconversion.h>              // for hsv2rgb, rgb2hsv
-#include <inviwo/core/util/glmmat.h>                       // for mat3
-#include <inviwo/core/util/glmvec.h>                       // for ivec2, dvec2, vec2, vec4, size2_t
-#include <modules/fontrendering/textrenderer.h>            // for TextRenderer
-#include <modules/opengl/inviwoopengl.h>                   // for GL_ALWAYS, GL_ONE_MINUS_SRC_ALPHA
-#include <modules/opengl/openglutils.h>                    // for BlendModeState, DepthFuncState
-#include <modules/opengl/rendering/texturequadrenderer.h>  // for TextureQuadRenderer
-#include <modules/opengl/shader/shader.h>                  // for Shader
-#include <modules/opengl/texture/texture2d.h>              // for Texture2D
-#include <modules/userinterfacegl/glui/renderer.h>         // for Renderer
+#include <inviwo/core/interaction/events/pickingevent.h>  // for PickingEvent
+#include <inviwo/core/interaction/pickingstate.h>         // for PickingPressItem, PickingPress...
+#include <inviwo/core/processors/processor.h>             // for Processor
+#include <inviwo/core/properties/invalidationlevel.h>     // for InvalidationLevel, Invalidatio...
+#include <inviwo/core/util/colorconversion.h>             // for hsv2rgb, rgb2hsv
+#include <inviwo/core/util/glmvec.h>                      // for ivec2, dvec2, vec2, vec4, size2_t
+#include <modules/fontrendering/textrenderer.h>           // for TextRenderer
+#include <modules/userinterfacegl/glui/renderer.h>        // for Renderer
 
 #include <algorithm>    // for max
 #include <cmath>        // for abs
@@ -215,40 +209,30 @@ ivec2 Element::getWidgetExtentScaled() const {
 }
 
 void Element::render(const ivec2& origin, const size2_t& canvasDim) {
-    utilgl::DepthFuncState depthFunc(GL_ALWAYS);
-    utilgl::BlendModeState blendMode(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    auto& uiShader = uiRenderer_->getShader();
-    uiShader.activate();
-
-    uiShader.setUniform("outportParameters.dimensions", vec2(canvasDim));
-    uiShader.setUniform("outportParameters.reciprocalDimensions", vec2(1.0f) / vec2(canvasDim));
+    // the element is drawn once the outermost batch ends, i.e. right away unless the caller
+    // batches several elements
+    uiRenderer_->beginBatch(canvasDim);
 
     // set widget colors
+    Renderer::WidgetStyle style;
     if (enabled_) {
-        uiShader.setUniform("uiColor", uiRenderer_->getUIColor());
-        uiShader.setUniform("haloColor", uiRenderer_->getHoverColor());
-        uiShader.setUniform("uiBorderColor", uiRenderer_->getBorderColor());
+        style.uiColor = uiRenderer_->getUIColor();
+        style.haloColor = uiRenderer_->getHoverColor();
+        style.borderColor = uiRenderer_->getBorderColor();
     } else {
-        uiShader.setUniform("uiColor", uiRenderer_->getDisabledColor());
+        style.uiColor = uiRenderer_->getDisabledColor();
         // make halo invisible
-        uiShader.setUniform("haloColor", vec4(0.0f));
-        uiShader.setUniform("uiBorderColor", adjustColor(uiRenderer_->getBorderColor()));
-    }
-
-    if (orientation_ == UIOrientation::Vertical) {
-        // perform a rotation by 90deg counter-clock wise
-        uiShader.setUniform("uiTextureMatrix",
-                            mat3(0.0f, -1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f));
-    } else {
-        uiShader.setUniform("uiTextureMatrix", mat3(1.0f));
+        style.haloColor = vec4(0.0f);
+        style.borderColor = adjustColor(uiRenderer_->getBorderColor());
     }
+    // rotate the widget textures by 90deg counter-clock wise
+    style.vertical = orientation_ == UIOrientation::Vertical;
+    uiRenderer_->setWidgetStyle(style);
 
     renderWidget(origin, canvasDim);
-
-    uiShader.deactivate();
-
     renderLabel(origin, canvasDim);
+
+    uiRenderer_->endBatch();
 }
 
 void Element::setHoverState(bool enable) {
@@ -329,23 +313,8 @@ void Element::updateLabelPos() {
 }
 
 void Element::updateLabel() {
-    const vec4 black(0.0f, 0.0f, 0.0f, 1.0f);
-
+    // the label itself is rendered into the label atlas of the renderer when it is first drawn
     updateLabelPos();
-
-    if (!labelStr_.empty()) {
-        size2_t labelSize(labelExtent_);
-        if (!labelTexture_ || (labelTexture_->getDimensions() != labelSize)) {
-            auto texture = std::make_shared<Texture2D>(labelSize, GL_RGBA, GL_RGBA,
-                                                       GL_UNSIGNED_BYTE, GL_LINEAR);
-            texture->initialize(nullptr);
-            labelTexture_ = texture;
-        }
-        getCurrentTextRenderer().renderToTexture(labelTexture_, labelStr_, black);
-    } else {
-        labelTexture_ = nullptr;
-    }
-
     labelDirty_ = false;
 }
 
@@ -401,23 +370,23 @@ vec4 Element::adjustColor(const vec4& color) {
 TextRenderer& Element::getCurrentTextRenderer() const {
     // set font size first
     auto& textRenderer = uiRenderer_->getTextRenderer(boldLabel_);
-    textRenderer.setFontSize(std::max(1, static_cast<int>(scalingFactor_ * labelFontSize_)));
+    textRenderer.setFontSize(getCurrentFontSize());
     return textRenderer;
 }
 
-void Element::renderLabel(const ivec2& origin, const size2_t& canvasDim) {
+int Element::getCurrentFontSize() const {
+    return std::max(1, static_cast<int>(scalingFactor_ * labelFontSize_));
+}
+
+void Element::renderLabel(const ivec2& origin, const size2_t&) {
     if (!labelVisible_) {
         return;
     }
     if (labelDirty_) {
         updateLabel();
     }
-    if (labelTexture_) {
-        utilgl::DepthFuncState depthFunc(GL_ALWAYS);
-        utilgl::BlendModeState blending(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
-        uiRenderer_->getTextureQuadRenderer().renderToRect(labelTexture_, origin + labelPos_,
-                                                           labelExtent_, canvasDim);
-    }
+    uiRenderer_->addLabel(labelStr_, boldLabel_, getCurrentFontSize(), origin + labelPos_,
+                          labelExtent_);
 }
 
 }  // namespace glui
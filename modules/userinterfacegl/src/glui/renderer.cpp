@@ -48,15 +48,19 @@
 #include <inviwo/core/util/zip.h>                                       // for enumerate, zipIte...
 #include <modules/fontrendering/textrenderer.h>                         // for TextRenderer
 #include <modules/fontrendering/util/fontutils.h>                       // for getFont, FontType
+#include <modules/opengl/geometry/meshgl.h>                             // for MeshGL
 #include <modules/opengl/glformats.h>                                   // for GLFormat, GLFormats
 #include <modules/opengl/inviwoopengl.h>                                // for GLsizei, GL_LINEAR
+#include <modules/opengl/openglutils.h>                                 // for Enable, BlendMode...
 #include <modules/opengl/rendering/meshdrawergl.h>                      // for MeshDrawerGL
 #include <modules/opengl/rendering/texturequadrenderer.h>               // for TextureQuadRenderer
 #include <modules/opengl/shader/shader.h>                               // for Shader
+#include <modules/opengl/texture/texture2d.h>                           // for Texture2D
 #include <modules/opengl/texture/texture2darray.h>                      // for Texture2DArray
 #include <modules/opengl/texture/textureunit.h>                         // for TextureUnit
+#include <modules/opengl/texture/textureutils.h>                        // for bindTexture
 
-#include <algorithm>      // for all_of
+#include <algorithm>      // for all_of, max
 #include <sstream>        // for basic_stringbuf<>...
 #include <string_view>    // for string_view
 #include <type_traits>    // for remove_extent_t
@@ -73,6 +77,26 @@ namespace inviwo {
 
 namespace glui {
 
+namespace {
+
+void uploadLayers(Texture2DArray& texture, const std::vector<std::shared_ptr<Layer>>& layers,
+                  size_t firstLayer) {
+    TextureUnit texUnit;
+    texUnit.activate();
+    texture.bind();
+    for (auto [zIndex, texLayer] : util::enumerate(layers)) {
+        const auto* layerRAM = texLayer->getRepresentation<LayerRAM>();
+        const auto glformat = GLFormats::get(layerRAM->getDataFormat()->getId());
+        const auto dims = layerRAM->getDimensions();
+        // upload data into array texture
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, static_cast<GLsizei>(firstLayer + zIndex),
+                        static_cast<GLsizei>(dims.x), static_cast<GLsizei>(dims.y), 1,
+                        glformat.format, glformat.type, layerRAM->getData());
+    }
+}
+
+}  // namespace
+
 Renderer::Renderer()
     : uiShader_("renderui.vert", "renderui.frag")
     , textRenderer_(font::getFont(font::FontType::Default, font::FullPath::Yes))
@@ -83,11 +107,31 @@ Renderer::Renderer()
     , colorBorder_(0.0f, 0.0f, 0.0f, 1.0f)
     , colorText_(0.0f, 0.0f, 0.0f, 1.0f)
     , colorHover_(0.0f, 0.0f, 0.0f, 1.0f)
-    , colorDisabled_(0.4f, 0.4f, 0.4f, 1.0f) {
+    , colorDisabled_(0.4f, 0.4f, 0.4f, 1.0f)
+    , batchShader_("uibatch.vert", "uibatch.frag")
+    , batchPositions_{std::make_shared<Buffer<vec2>>()}
+    , batchTexCoords_{std::make_shared<Buffer<vec2>>()}
+    , batchColors_{std::make_shared<Buffer<vec4>>()}
+    , batchBorderColors_{std::make_shared<Buffer<vec4>>()}
+    , batchHaloColors_{std::make_shared<Buffer<vec4>>()}
+    , batchPickingColors_{std::make_shared<Buffer<vec3>>()}
+    , batchLayers_{std::make_shared<Buffer<ivec4>>()}
+    , batchTexCoordMax_{std::make_shared<Buffer<vec2>>()}
+    , batch_{std::make_shared<Mesh>()} {
     textRenderer_.setFontSize(defaultFontSize_);
     textRendererBold_.setFontSize(defaultFontSize_);
 
     setupRectangleMesh();
+
+    // locations have to match the declarations in uibatch.vert
+    batch_->addBuffer(BufferType::PositionAttrib, batchPositions_);
+    batch_->addBuffer(BufferType::ColorAttrib, batchColors_);
+    batch_->addBuffer(BufferType::TexCoordAttrib, batchTexCoords_);
+    batch_->addBuffer(Mesh::BufferInfo(BufferType::ColorAttrib, 8), batchBorderColors_);
+    batch_->addBuffer(Mesh::BufferInfo(BufferType::ColorAttrib, 9), batchHaloColors_);
+    batch_->addBuffer(Mesh::BufferInfo(BufferType::PickingAttrib, 10), batchPickingColors_);
+    batch_->addBuffer(Mesh::BufferInfo(BufferType::IntMetaAttrib, 11), batchLayers_);
+    batch_->addBuffer(Mesh::BufferInfo(BufferType::TexCoordAttrib, 12), batchTexCoordMax_);
 }
 
 Texture2DArray* Renderer::createUITextures(const std::string& name,
@@ -96,8 +140,11 @@ Texture2DArray* Renderer::createUITextures(const std::string& name,
     if (auto textures = getUITextures(name)) {
         return textures;
     }
-    auto textures = createUITextureObject(files, sourcePath);
+    auto layers = readUITextures(files, sourcePath);
+    auto textures = createUITextureObject(layers);
     uiTextureMap_.insert({name, textures});
+    uiTextureLayers_.insert({name, std::move(layers)});
+    uiAtlasDirty_ = true;
     return textures.get();
 }
 
@@ -225,6 +272,12 @@ void Renderer::setupRectangleMesh() {
 }
 
 std::shared_ptr<Texture2DArray> Renderer::createUITextureObject(
+    const std::vector<std::filesystem::path>& textureFiles,
+    const std::filesystem::path& sourcePath) const {
+    return createUITextureObject(readUITextures(textureFiles, sourcePath));
+}
+
+std::vector<std::shared_ptr<Layer>> Renderer::readUITextures(
     const std::vector<std::filesystem::path>& textureFiles,
     const std::filesystem::path& sourcePath) const {
     // read in textures
@@ -252,24 +305,279 @@ std::shared_ptr<Texture2DArray> Renderer::createUITextureObject(
         throw Exception(SourceContext{}, "Textures have inconsistent formats: {} at {}",
                         joinString(textureFiles, ", "), sourcePath);
     }
+    return textureLayers;
+}
+
+std::shared_ptr<Texture2DArray> Renderer::createUITextureObject(
+    const std::vector<std::shared_ptr<Layer>>& textureLayers) const {
+    const size2_t texDim = textureLayers.front()->getDimensions();
 
     // upload the individual textures, rescale where necessary
     auto texture = std::make_shared<Texture2DArray>(size3_t(texDim, textureLayers.size()), GL_RGBA,
                                                     GL_RGBA8, GL_UNSIGNED_BYTE, GL_LINEAR);
     texture->initialize(nullptr);
+    uploadLayers(*texture, textureLayers, 0);
+    return texture;
+}
 
-    TextureUnit texUnit;
-    texUnit.activate();
-    texture->bind();
-    for (auto [zIndex, texLayer] : util::enumerate(textureLayers)) {
-        auto layerRAM = texLayer->getRepresentation<LayerRAM>();
-        auto glformat = GLFormats::get(layerRAM->getDataFormat()->getId());
-        // upload data into array texture
-        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, static_cast<GLsizei>(zIndex),
-                        static_cast<GLsizei>(texDim.x), static_cast<GLsizei>(texDim.y), 1,
-                        glformat.format, glformat.type, layerRAM->getData());
+void Renderer::beginBatch(const size2_t& canvasDim) {
+    if (batchDepth_++ == 0) {
+        clearBatch();
+        batchCanvasDim_ = canvasDim;
     }
-    return texture;
+}
+
+void Renderer::endBatch() {
+    if (batchDepth_ == 0 || --batchDepth_ > 0) return;
+
+    resolveLabels();
+    drawBatch();
+    clearBatch();
+}
+
+bool Renderer::isBatching() const { return batchDepth_ > 0; }
+
+void Renderer::setWidgetStyle(const WidgetStyle& style) { widgetStyle_ = style; }
+
+const Renderer::WidgetStyle& Renderer::getWidgetStyle() const { return widgetStyle_; }
+
+void Renderer::addWidget(const Texture2DArray& textures, const std::array<int, 9>& textureMap,
+                         const vec2& origin, const vec2& extent, const vec2& marginScale,
+                         int state, bool hovered, const vec3& pickingColor) {
+    if (uiAtlasDirty_) updateUIAtlas();
+
+    const auto it = uiAtlasEntries_.find(&textures);
+    if (it == uiAtlasEntries_.end()) {
+        throw Exception(SourceContext{}, "UI textures were not created by this renderer");
+    }
+    const auto [firstLayer, uvScale] = it->second;
+
+    // the quad is subdivided at .45 and .55 into 3x3 cells, where the corners keep a fixed size
+    // determined by marginScale, see setupRectangleMesh
+    constexpr std::array<float, 4> grid{0.0f, 0.45f, 0.55f, 1.0f};
+    const auto vertex = [&](float x, float y) {
+        const vec2 p{x, y};
+        const vec2 left = p * marginScale;
+        const vec2 right = 1.0f - (1.0f - p) * marginScale;
+        const vec2 pos{p.x < 0.5f ? left.x : right.x, p.y < 0.5f ? left.y : right.y};
+        // rotate the texture by 90 degrees counter-clockwise for vertical widgets
+        const vec2 texCoord = widgetStyle_.vertical ? vec2{p.y, 1.0f - p.x} : p;
+        return std::pair{pos * extent + origin, texCoord * uvScale};
+    };
+
+    auto& positions = batchPositions_->getEditableRAMRepresentation()->getDataContainer();
+    auto& texCoords = batchTexCoords_->getEditableRAMRepresentation()->getDataContainer();
+    for (size_t j = 0; j < 3; ++j) {
+        for (size_t i = 0; i < 3; ++i) {
+            const auto p00 = vertex(grid[i], grid[j]);
+            const auto p10 = vertex(grid[i + 1], grid[j]);
+            const auto p01 = vertex(grid[i], grid[j + 1]);
+            const auto p11 = vertex(grid[i + 1], grid[j + 1]);
+            for (const auto& [pos, texCoord] : {p00, p10, p01, p10, p11, p01}) {
+                positions.push_back(pos);
+                texCoords.push_back(texCoord);
+            }
+        }
+    }
+
+    constexpr size_t count = 9 * 6;
+    const ivec4 layers{firstLayer + textureMap[state], firstLayer + textureMap[state + 3],
+                       firstLayer + textureMap[state + 6], 0};
+    auto append = [](auto& buffer, const auto& value, size_t n) {
+        auto& data = buffer->getEditableRAMRepresentation()->getDataContainer();
+        data.insert(data.end(), n, value);
+    };
+    append(batchColors_, widgetStyle_.uiColor, count);
+    append(batchBorderColors_, widgetStyle_.borderColor, count);
+    append(batchHaloColors_, hovered ? widgetStyle_.haloColor : vec4(0.0f), count);
+    append(batchPickingColors_, pickingColor, count);
+    append(batchLayers_, layers, count);
+    append(batchTexCoordMax_, uvScale, count);
+}
+
+void Renderer::addLabel(std::string_view label, bool bold, int fontSize, const ivec2& origin,
+                        const ivec2& extent) {
+    if (label.empty() || glm::any(glm::lessThanEqual(extent, ivec2(0)))) return;
+
+    auto& positions = batchPositions_->getEditableRAMRepresentation()->getDataContainer();
+    auto& texCoords = batchTexCoords_->getEditableRAMRepresentation()->getDataContainer();
+
+    pendingLabels_.push_back({{std::string{label}, bold, fontSize}, extent, positions.size()});
+
+    // texture coordinates are set in resolveLabels once the label is placed in the atlas
+    const vec2 p0{origin};
+    const vec2 p1{origin + extent};
+    positions.insert(positions.end(),
+                     {p0, {p1.x, p0.y}, {p0.x, p1.y}, {p1.x, p0.y}, p1, {p0.x, p1.y}});
+    texCoords.insert(texCoords.end(), 6, vec2{0.0f});
+
+    auto append = [](auto& buffer, const auto& value) {
+        auto& data = buffer->getEditableRAMRepresentation()->getDataContainer();
+        data.insert(data.end(), 6, value);
+    };
+    append(batchColors_, colorText_);
+    append(batchBorderColors_, vec4(0.0f));
+    append(batchHaloColors_, vec4(0.0f));
+    append(batchPickingColors_, vec3(0.0f));
+    append(batchLayers_, ivec4(0, 0, 0, 1));
+    append(batchTexCoordMax_, vec2(1.0f));
+}
+
+void Renderer::addCustomDraw(std::function<void()> draw) {
+    customDraws_.emplace_back(batchPositions_->getSize(), std::move(draw));
+}
+
+void Renderer::updateUIAtlas() {
+    size2_t dims{0};
+    size_t layers = 0;
+    for (const auto& [name, textureLayers] : uiTextureLayers_) {
+        dims = glm::max(dims, textureLayers.front()->getDimensions());
+        layers += textureLayers.size();
+    }
+    uiAtlasEntries_.clear();
+    uiAtlasDirty_ = false;
+    if (layers == 0) {
+        uiAtlas_.reset();
+        return;
+    }
+
+    // each texture set is placed in the lower left corner of its layers
+    uiAtlas_ = std::make_shared<Texture2DArray>(size3_t(dims, layers), GL_RGBA, GL_RGBA8,
+                                                GL_UNSIGNED_BYTE, GL_LINEAR);
+    uiAtlas_->initialize(nullptr);
+
+    size_t firstLayer = 0;
+    for (const auto& [name, textureLayers] : uiTextureLayers_) {
+        uploadLayers(*uiAtlas_, textureLayers, firstLayer);
+        const vec2 uvScale{vec2(textureLayers.front()->getDimensions()) / vec2(dims)};
+        uiAtlasEntries_[uiTextureMap_.at(name).get()] = {static_cast<int>(firstLayer), uvScale};
+        firstLayer += textureLayers.size();
+    }
+}
+
+void Renderer::resetLabelAtlas(const size2_t& dims) {
+    if (!labelAtlas_ || labelAtlas_->getDimensions() != dims) {
+        labelAtlas_ =
+            std::make_shared<Texture2D>(dims, GL_RGBA, GL_RGBA8, GL_UNSIGNED_BYTE, GL_LINEAR);
+        labelAtlas_->initialize(nullptr);
+    }
+    textRenderer_.clear(labelAtlas_, vec4(0.0f));
+    labelRegions_.clear();
+    labelCursor_ = ivec2(0);
+    labelRowHeight_ = 0;
+}
+
+bool Renderer::renderLabel(const PendingLabel& label) {
+    if (labelRegions_.contains(label.key)) return true;
+
+    // keep a one pixel gap between labels to avoid bleeding due to linear interpolation
+    const ivec2 dims(labelAtlas_->getDimensions());
+    const ivec2 size = label.extent + 1;
+    if (labelCursor_.x + size.x > dims.x) {
+        labelCursor_ = ivec2(0, labelCursor_.y + labelRowHeight_);
+        labelRowHeight_ = 0;
+    }
+    if (size.x > dims.x || labelCursor_.y + size.y > dims.y) return false;
+
+    const auto& [text, bold, fontSize] = label.key;
+    auto& textRenderer = getTextRenderer(bold);
+    textRenderer.setFontSize(fontSize);
+    textRenderer.renderToTexture(labelAtlas_, size2_t(labelCursor_), size2_t(label.extent), text,
+                                 vec4(0.0f, 0.0f, 0.0f, 1.0f), false);
+
+    labelRegions_[label.key] = ivec4(labelCursor_, label.extent);
+    labelCursor_.x += size.x;
+    labelRowHeight_ = std::max(labelRowHeight_, size.y);
+    return true;
+}
+
+void Renderer::resolveLabels() {
+    if (pendingLabels_.empty()) return;
+
+    constexpr size_t initialLabelAtlasSize = 512;
+    constexpr size_t maxLabelAtlasSize = 8192;
+    if (!labelAtlas_) resetLabelAtlas(size2_t(initialLabelAtlasSize));
+
+    const auto renderAll = [&]() {
+        return std::all_of(pendingLabels_.begin(), pendingLabels_.end(),
+                           [&](const PendingLabel& label) { return renderLabel(label); });
+    };
+    if (!renderAll()) {
+        // the atlas is full of old labels, start over with the labels of this batch only and grow
+        // the atlas if they still do not fit
+        size2_t dims = labelAtlas_->getDimensions();
+        resetLabelAtlas(dims);
+        while (!renderAll()) {
+            dims *= size_t{2};
+            if (glm::any(glm::greaterThan(dims, size2_t(maxLabelAtlasSize)))) {
+                throw Exception(SourceContext{}, "Labels do not fit into a {}x{} label atlas",
+                                maxLabelAtlasSize, maxLabelAtlasSize);
+            }
+            resetLabelAtlas(dims);
+        }
+    }
+
+    auto& texCoords = batchTexCoords_->getEditableRAMRepresentation()->getDataContainer();
+    const vec2 atlasDims(labelAtlas_->getDimensions());
+    for (const auto& label : pendingLabels_) {
+        const vec4 region(labelRegions_.at(label.key));
+        const vec2 t0 = vec2(region.x, region.y) / atlasDims;
+        const vec2 t1 = vec2(region.x + region.z, region.y + region.w) / atlasDims;
+        const std::array<vec2, 6> quad{t0, vec2{t1.x, t0.y}, vec2{t0.x, t1.y},
+                                       vec2{t1.x, t0.y}, t1,  vec2{t0.x, t1.y}};
+        std::copy(quad.begin(), quad.end(), texCoords.begin() + label.firstVertex);
+    }
+}
+
+void Renderer::drawBatch() {
+    size_t first = 0;
+    for (auto& [vertex, draw] : customDraws_) {
+        drawBatchRange(first, vertex);
+        draw();
+        first = vertex;
+    }
+    drawBatchRange(first, batchPositions_->getSize());
+}
+
+void Renderer::drawBatchRange(size_t first, size_t last) {
+    if (first >= last) return;
+
+    // widgets are blended with premultiplied alpha as the labels
+    utilgl::DepthFuncState depthFunc(GL_ALWAYS);
+    utilgl::BlendModeState blending(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+    batchShader_.activate();
+    batchShader_.setUniform("outportParameters.reciprocalDimensions",
+                            vec2(1.0f) / vec2(batchCanvasDim_));
+
+    TextureUnit uiUnit;
+    TextureUnit labelUnit;
+    if (uiAtlas_) {
+        utilgl::bindTexture(*uiAtlas_, uiUnit);
+        batchShader_.setUniform("uiAtlas", uiUnit);
+    }
+    if (labelAtlas_) {
+        utilgl::bindTexture(*labelAtlas_, labelUnit);
+        batchShader_.setUniform("labelAtlas", labelUnit);
+    }
+
+    const utilgl::Enable<MeshGL> enable(batch_->getRepresentation<MeshGL>());
+    glDrawArrays(GL_TRIANGLES, static_cast<GLint>(first), static_cast<GLsizei>(last - first));
+
+    batchShader_.deactivate();
+}
+
+void Renderer::clearBatch() {
+    batchPositions_->getEditableRAMRepresentation()->clear();
+    batchTexCoords_->getEditableRAMRepresentation()->clear();
+    batchColors_->getEditableRAMRepresentation()->clear();
+    batchBorderColors_->getEditableRAMRepresentation()->clear();
+    batchHaloColors_->getEditableRAMRepresentation()->clear();
+    batchPickingColors_->getEditableRAMRepresentation()->clear();
+    batchLayers_->getEditableRAMRepresentation()->clear();
+    batchTexCoordMax_->getEditableRAMRepresentation()->clear();
+    pendingLabels_.clear();
+    customDraws_.clear();
 }
 
 }  // namespace glui
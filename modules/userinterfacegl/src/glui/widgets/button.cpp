@@ -31,10 +31,7 @@
 
 #include <inviwo/core/interaction/pickingmapper.h>                // for PickingMapper
 #include <inviwo/core/util/glmvec.h>                              // for ivec2, vec2, size2_t
-#include <modules/opengl/rendering/meshdrawergl.h>                // for MeshDrawerGL
-#include <modules/opengl/shader/shader.h>                         // for Shader
 #include <modules/opengl/texture/texture2darray.h>                // for Texture2DArray
-#include <modules/opengl/texture/textureunit.h>                   // for TextureUnit
 #include <modules/userinterfacegl/glui/renderer.h>                // for Renderer
 #include <modules/userinterfacegl/glui/widgets/abstractbutton.h>  // for AbstractButton
 
@@ -54,25 +51,9 @@ Button::Button(const std::string& label, Processor& processor, Renderer& uiRende
     : AbstractButton(label, processor, uiRenderer, extent) {}
 
 void Button::renderWidget(const ivec2& origin, const size2_t&) {
-    TextureUnit texUnit;
-    texUnit.activate();
-    uiTextures_->bind();
-
-    // bind textures
-    auto& uiShader = uiRenderer_->getShader();
-    uiShader.setUniform("arrayTexSampler", texUnit.getUnitNumber());
-    uiShader.setUniform("arrayTexMap", uiTextureMap_);
-
-    uiShader.setUniform("origin", vec2(origin + widgetPos_));
-    uiShader.setUniform("extent", vec2(getWidgetExtentScaled()));
-
-    // set up picking color
-    uiShader.setUniform("pickingColor", pickingMapper_.getColor(0));
-    uiShader.setUniform("uiState", ivec2(uiState(), (hovered_ ? 1 : 0)));
-    uiShader.setUniform("marginScale", marginScale());
-
-    // render quad
-    uiRenderer_->getMeshDrawer()->draw();
+    uiRenderer_->addWidget(*uiTextures_, uiTextureMap_, vec2(origin + widgetPos_),
+                           vec2(getWidgetExtentScaled()), marginScale(), uiState(), hovered_,
+                           pickingMapper_.getColor(0));
 }
 
 }  // namespace glui
@@ -34,10 +34,7 @@
 #include <inviwo/core/util/glmvec.h>                // for ivec2, vec2, size2_t
 #include <inviwo/core/util/logcentral.h>            // for LogCentral
 #include <inviwo/core/util/moduleutils.h>           // for getModulePath
-#include <modules/opengl/rendering/meshdrawergl.h>  // for MeshDrawerGL
-#include <modules/opengl/shader/shader.h>           // for Shader
 #include <modules/opengl/texture/texture2darray.h>  // for Texture2DArray
-#include <modules/opengl/texture/textureunit.h>     // for TextureUnit
 #include <modules/userinterfacegl/glui/element.h>   // for Element::UIState, Element::UIState::C...
 #include <modules/userinterfacegl/glui/renderer.h>  // for Renderer
 
@@ -73,25 +70,9 @@ CheckBox::CheckBox(const std::string& label, Processor& processor, Renderer& uiR
 }
 
 void CheckBox::renderWidget(const ivec2& origin, const size2_t&) {
-    TextureUnit texUnit;
-    texUnit.activate();
-    uiTextures_->bind();
-
-    // bind textures
-    auto& uiShader = uiRenderer_->getShader();
-    uiShader.setUniform("arrayTexSampler", texUnit.getUnitNumber());
-    uiShader.setUniform("arrayTexMap", uiTextureMap_);
-
-    uiShader.setUniform("origin", vec2(origin + widgetPos_));
-    uiShader.setUniform("extent", vec2(getWidgetExtentScaled()));
-
-    // set up picking color
-    uiShader.setUniform("pickingColor", pickingMapper_.getColor(0));
-    uiShader.setUniform("uiState", ivec2(uiState(), (hovered_ ? 1 : 0)));
-    uiShader.setUniform("marginScale", marginScale());
-
-    // render quad
-    uiRenderer_->getMeshDrawer()->draw();
+    uiRenderer_->addWidget(*uiTextures_, uiTextureMap_, vec2(origin + widgetPos_),
+                           vec2(getWidgetExtentScaled()), marginScale(), uiState(), hovered_,
+                           pickingMapper_.getColor(0));
 }
 
 void CheckBox::setValue(bool value) { checked_ = value; }
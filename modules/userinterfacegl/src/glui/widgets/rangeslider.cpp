@@ -33,10 +33,7 @@
 #include <inviwo/core/interaction/pickingmapper.h>  // for PickingMapper
 #include <inviwo/core/util/glmvec.h>                // for ivec2, vec2, dvec2, size3_t, size2_t
 #include <inviwo/core/util/moduleutils.h>           // for getModulePath
-#include <modules/opengl/rendering/meshdrawergl.h>  // for MeshDrawerGL
-#include <modules/opengl/shader/shader.h>           // for Shader
 #include <modules/opengl/texture/texture2darray.h>  // for Texture2DArray
-#include <modules/opengl/texture/textureunit.h>     // for TextureUnit
 #include <modules/userinterfacegl/glui/element.h>   // for UIOrientation, Element::UIState, UIOr...
 #include <modules/userinterfacegl/glui/renderer.h>  // for Renderer
 
@@ -183,40 +180,19 @@ void RangeSlider::setEnd(int stop) {
 }
 
 void RangeSlider::renderWidget(const ivec2& origin, const size2_t&) {
-    TextureUnit texUnit;
-    texUnit.activate();
-
-    // bind textures
-    auto& uiShader = uiRenderer_->getShader();
-    uiShader.setUniform("arrayTexSampler", texUnit.getUnitNumber());
-    uiShader.setUniform("arrayTexMap", uiTextureMap_);
-
     const ivec2 extent(getWidgetExtentScaled());
 
     // render groove first
     if (showGroove_) {
-        grooveTextures_->bind();
-        uiShader.setUniform("origin", vec2(origin + widgetPos_));
-        uiShader.setUniform("extent", vec2(extent));
-
-        uiShader.setUniform("pickingColor", vec3(0.0f));
-        uiShader.setUniform("uiState", ivec2(0, (hovered_ ? 1 : 0)));
-        uiShader.setUniform("marginScale",
-                            vec2(grooveTextures_->getDimensions()) / vec2(widgetExtent_));
-
-        uiRenderer_->getMeshDrawer()->draw();
+        uiRenderer_->addWidget(*grooveTextures_, uiTextureMap_, vec2(origin + widgetPos_),
+                               vec2(extent),
+                               vec2(grooveTextures_->getDimensions()) / vec2(widgetExtent_), 0,
+                               hovered_, vec3(0.0f));
     }
 
     const auto sliderPos = getSliderPos();
     // render center part next
     {
-        centerTextures_->bind();
-
-        uiShader.setUniform("pickingColor", pickingMapper_.getColor(2));
-        // ensure the center is only hovered if picking ID matches as well
-        uiShader.setUniform("uiState", ivec2((pushed_ && (currentPickingID_ == 2) ? 1 : 0),
-                                             (hovered_ && (currentPickingID_ == 2) ? 1 : 0)));
-
         vec2 centerPos;
         vec2 centerExtent;
         vec2 margin(1.0f);
@@ -236,40 +212,37 @@ void RangeSlider::renderWidget(const ivec2& origin, const size2_t&) {
             margin.x = centerTextures_->getDimensions().y / static_cast<float>(widgetExtent_.x);
             margin.y = uiTextures_->getDimensions().x / static_cast<float>(widgetExtent_.y);
         }
-        uiShader.setUniform("marginScale", margin);
-        uiShader.setUniform("origin", vec2(origin + widgetPos_) + centerPos);
-        uiShader.setUniform("extent", centerExtent);
 
-        uiRenderer_->getMeshDrawer()->draw();
+        // ensure the center is only hovered if picking ID matches as well
+        uiRenderer_->addWidget(*centerTextures_, uiTextureMap_,
+                               vec2(origin + widgetPos_) + centerPos, centerExtent, margin,
+                               (pushed_ && (currentPickingID_ == 2) ? 1 : 0),
+                               hovered_ && (currentPickingID_ == 2), pickingMapper_.getColor(2));
     }
 
     // render both slider handles, adjust margin scale
     {
-        uiTextures_->bind();
-
         vec2 dims(uiTextures_->getDimensions());
         const float aspectRatio = dims.x / dims.y;
         const float roundness = 0.8f;  // make them appear slightly square
 
         vec2 positionMask;
+        vec2 handleExtent;
         if (orientation_ == UIOrientation::Horizontal) {
             positionMask = vec2(1, 0);
-            uiShader.setUniform("extent", vec2(extent.y * aspectRatio, extent.y));
-            uiShader.setUniform("marginScale", vec2(roundness));
+            handleExtent = vec2(extent.y * aspectRatio, extent.y);
         } else {
             positionMask = vec2(0, 1);
-            uiShader.setUniform("extent", vec2(extent.x, extent.x * aspectRatio));
-            uiShader.setUniform("marginScale", vec2(roundness));
+            handleExtent = vec2(extent.x, extent.x * aspectRatio);
         }
 
-        auto drawHandle = [&uiShader, origin, positionMask, this](float pos, size_t id) {
-            uiShader.setUniform("origin", vec2(origin + widgetPos_) + vec2(pos) * positionMask);
-            // set up picking color
-            uiShader.setUniform("pickingColor", pickingMapper_.getColor(id));
-            uiShader.setUniform("uiState", ivec2((pushed_ && (currentPickingID_ == id) ? 1 : 0),
-                                                 (hovered_ && (currentPickingID_ == id) ? 1 : 0)));
-            // render quad
-            uiRenderer_->getMeshDrawer()->draw();
+        auto drawHandle = [&](float pos, size_t id) {
+            uiRenderer_->addWidget(*uiTextures_, uiTextureMap_,
+                                   vec2(origin + widgetPos_) + vec2(pos) * positionMask,
+                                   handleExtent, vec2(roundness),
+                                   (pushed_ && (currentPickingID_ == id) ? 1 : 0),
+                                   hovered_ && (currentPickingID_ == id),
+                                   pickingMapper_.getColor(id));
         };
 
         // first handle
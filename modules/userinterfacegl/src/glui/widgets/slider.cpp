@@ -33,10 +33,7 @@
 #include <inviwo/core/interaction/pickingmapper.h>  // for PickingMapper
 #include <inviwo/core/util/glmvec.h>                // for vec2, ivec2, dvec2, size3_t, size2_t
 #include <inviwo/core/util/moduleutils.h>           // for getModulePath
-#include <modules/opengl/rendering/meshdrawergl.h>  // for MeshDrawerGL
-#include <modules/opengl/shader/shader.h>           // for Shader
 #include <modules/opengl/texture/texture2darray.h>  // for Texture2DArray
-#include <modules/opengl/texture/textureunit.h>     // for TextureUnit
 #include <modules/userinterfacegl/glui/element.h>   // for UIOrientation, Element::UIState, Element
 #include <modules/userinterfacegl/glui/renderer.h>  // for Renderer
 
@@ -112,51 +109,25 @@ int Slider::getMinValue() const { return min_; }
 int Slider::getMaxValue() const { return max_; }
 
 void Slider::renderWidget(const ivec2& origin, const size2_t&) {
-    TextureUnit texUnit;
-    texUnit.activate();
-
-    // bind textures
-    auto& uiShader = uiRenderer_->getShader();
-    uiShader.setUniform("arrayTexSampler", texUnit.getUnitNumber());
-    uiShader.setUniform("arrayTexMap", uiTextureMap_);
-
     const vec2 extent(getWidgetExtentScaled());
 
     // render groove first
-    {
-        grooveTextures_->bind();
-        uiShader.setUniform("origin", vec2(origin + widgetPos_));
-        uiShader.setUniform("extent", vec2(extent));
-
-        uiShader.setUniform("pickingColor", vec3(0.0f));
-        uiShader.setUniform("uiState", ivec2(0, (hovered_ ? 1 : 0)));
-        uiShader.setUniform("marginScale",
-                            vec2(grooveTextures_->getDimensions()) / vec2(widgetExtent_));
-
-        uiRenderer_->getMeshDrawer()->draw();
-    }
+    uiRenderer_->addWidget(*grooveTextures_, uiTextureMap_, vec2(origin + widgetPos_), extent,
+                           vec2(grooveTextures_->getDimensions()) / vec2(widgetExtent_), 0,
+                           hovered_, vec3(0.0f));
 
     // render slider, adjust margin scale
-    {
-        uiTextures_->bind();
-
-        const auto sliderPos = getSliderPos();
-        if (orientation_ == UIOrientation::Horizontal) {
-            uiShader.setUniform("origin", vec2(origin + widgetPos_) + vec2(sliderPos, 0));
-            uiShader.setUniform("extent", vec2(extent.y));
-            uiShader.setUniform("marginScale", vec2(marginScale().y));
-        } else {
-            uiShader.setUniform("origin", vec2(origin + widgetPos_) + vec2(0, sliderPos));
-            uiShader.setUniform("extent", vec2(extent.x));
-            uiShader.setUniform("marginScale", vec2(marginScale().x));
-        }
-
-        // set up picking color
-        uiShader.setUniform("pickingColor", pickingMapper_.getColor(0));
-        uiShader.setUniform("uiState", ivec2(uiState(), (hovered_ ? 1 : 0)));
-
-        // render quad
-        uiRenderer_->getMeshDrawer()->draw();
+    const auto sliderPos = getSliderPos();
+    if (orientation_ == UIOrientation::Horizontal) {
+        uiRenderer_->addWidget(*uiTextures_, uiTextureMap_,
+                               vec2(origin + widgetPos_) + vec2(sliderPos, 0), vec2(extent.y),
+                               vec2(marginScale().y), uiState(), hovered_,
+                               pickingMapper_.getColor(0));
+    } else {
+        uiRenderer_->addWidget(*uiTextures_, uiTextureMap_,
+                               vec2(origin + widgetPos_) + vec2(0, sliderPos), vec2(extent.x),
+                               vec2(marginScale().x), uiState(), hovered_,
+                               pickingMapper_.getColor(0));
     }
 }
 
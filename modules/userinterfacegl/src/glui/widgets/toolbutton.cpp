@@ -42,11 +42,9 @@
 #include <modules/opengl/image/layergl.h>                               // for LayerGL
 #include <modules/opengl/inviwoopengl.h>                                // for GL_ONE, GL_ONE_MI...
 #include <modules/opengl/openglutils.h>                                 // for BlendModeState
-#include <modules/opengl/rendering/meshdrawergl.h>                      // for MeshDrawerGL
 #include <modules/opengl/rendering/texturequadrenderer.h>               // for TextureQuadRenderer
 #include <modules/opengl/shader/shader.h>                               // for Shader
 #include <modules/opengl/texture/texture2darray.h>                      // for Texture2DArray
-#include <modules/opengl/texture/textureunit.h>                         // for TextureUnit
 #include <modules/userinterfacegl/glui/renderer.h>                      // for Renderer
 #include <modules/userinterfacegl/glui/widgets/abstractbutton.h>        // for AbstractButton
 
@@ -98,40 +96,28 @@ void ToolButton::setMargins(int top, int left, int bottom, int right) {
 const ivec4& ToolButton::getMargins() const { return margins_; }
 
 void ToolButton::renderWidget(const ivec2& origin, const size2_t& canvasDim) {
-    TextureUnit texUnit;
-    texUnit.activate();
-    uiTextures_->bind();
+    uiRenderer_->addWidget(*uiTextures_, uiTextureMap_, vec2(origin + widgetPos_),
+                           vec2(getWidgetExtentScaled()), marginScale(), uiState(), hovered_,
+                           pickingMapper_.getColor(0));
 
-    // bind textures
-    auto& uiShader = uiRenderer_->getShader();
-    uiShader.setUniform("arrayTexSampler", texUnit.getUnitNumber());
-
-    uiShader.setUniform("origin", vec2(origin + widgetPos_));
-    uiShader.setUniform("extent", vec2(getWidgetExtentScaled()));
-
-    // set up picking color
-    uiShader.setUniform("pickingColor", pickingMapper_.getColor(0));
-    uiShader.setUniform("uiState", ivec2(uiState(), (hovered_ ? 1 : 0)));
-    uiShader.setUniform("marginScale", marginScale());
-
-    // render quad
-    uiRenderer_->getMeshDrawer()->draw();
-
-    // render button image
+    // render button image on top of the batched button
     if (labelImage_) {
-        utilgl::BlendModeState blending(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
         const ivec2 imagePos(origin + ivec2(margins_.y, margins_.z));
         const ivec2 imageExtent =
             getWidgetExtentScaled() - ivec2(margins_.y + margins_.w, margins_.x + margins_.z);
-
-        auto& shader = quadRenderer_.getShader();
-        shader.activate();
         vec4 color(uiRenderer_->getSecondaryUIColor());
         if (!isEnabled()) {
             color = adjustColor(color);
         }
-        shader.setUniform("uiColor", color);
-        quadRenderer_.renderToRect(labelImage_, imagePos, imageExtent, canvasDim);
+
+        uiRenderer_->addCustomDraw([this, image = labelImage_, imagePos, imageExtent, color,
+                                    canvasDim]() {
+            utilgl::BlendModeState blending(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            auto& shader = quadRenderer_.getShader();
+            shader.activate();
+            shader.setUniform("uiColor", color);
+            quadRenderer_.renderToRect(image, imagePos, imageExtent, canvasDim);
+        });
     }
 }
 
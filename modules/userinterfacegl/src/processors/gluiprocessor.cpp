@@ -212,7 +212,10 @@ void GLUIProcessor::process() {
         ivec2 origin(position_.get() * vec2(outport_.getDimensions()));
         origin += offset_.get() - ivec2(shift) + ivec2(0, extent.y);
 
+        // collect all widgets of the layout and draw them at once
+        uiRenderer_.beginBatch(outport_.getDimensions());
         layout_.render(origin, outport_.getDimensions());
+        uiRenderer_.endBatch();
     }
 
     utilgl::deactivateCurrentTarget();
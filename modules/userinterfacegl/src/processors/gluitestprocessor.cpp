@@ -309,6 +309,8 @@ void GLUITestProcessor::process() {
     if (uiVisible_.get()) {
         // coordinate system defined in screen coords with origin in the top-left corner
 
+        // collect the widgets of both layouts and draw them at once
+        uiRenderer_.beginBatch(outport_.getDimensions());
         {
             // put UI elements in lower left corner of the canvas
             const ivec2 extent(layout_.getExtent());
@@ -325,6 +327,7 @@ void GLUITestProcessor::process() {
 
             propertyLayout_.render(origin, outport_.getDimensions());
         }
+        uiRenderer_.endBatch();
     }
 
     utilgl::deactivateCurrentTarget();
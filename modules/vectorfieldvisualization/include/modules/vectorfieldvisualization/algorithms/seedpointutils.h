@@ -0,0 +1,96 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/vectorfieldvisualization/vectorfieldvisualizationmoduledefine.h>  // for IVW_M...
+
+#include <inviwo/core/datastructures/volume/volumeram.h>            // for VolumeRAMPrecision
+#include <inviwo/core/util/glmvec.h>                                // for size3_t
+#include <inviwo/core/util/parallel.h>                              // for parallelFor
+#include <modules/vectorfieldvisualization/ports/seedpointsport.h>  // for SeedPoint3DVector
+
+#include <algorithm>  // for count_if
+#include <cstddef>    // for size_t
+#include <numeric>    // for inclusive_scan
+#include <vector>     // for vector
+
+namespace inviwo {
+
+namespace util {
+
+/**
+ * Sort seed points along a Morton (Z-order) curve through their bounding box. Seeds next to
+ * each other in the output are then close in space, so consecutive traces sample nearby parts of
+ * the field. Points with equal codes keep their relative order.
+ */
+IVW_MODULE_VECTORFIELDVISUALIZATION_API void sortSpatially(SeedPoint2DVector& points);
+IVW_MODULE_VECTORFIELDVISUALIZATION_API void sortSpatially(SeedPoint3DVector& points);
+IVW_MODULE_VECTORFIELDVISUALIZATION_API void sortSpatially(SeedPoint4DVector& points);
+
+/**
+ * Find the positions of all voxels of @p volume whose value satisfies @p predicate, in raster
+ * order. The z-slices are first counted in parallel. An exclusive prefix sum of the counts then
+ * gives each slice its output offset, and the slices are filled in parallel.
+ */
+template <typename T, typename Predicate>
+std::vector<size3_t> findVoxels(const VolumeRAMPrecision<T>& volume, Predicate predicate) {
+    const auto dims = volume.getDimensions();
+    const auto data = volume.getView();
+    const size_t sliceSize = dims.x * dims.y;
+
+    std::vector<size_t> offsets(dims.z + 1, 0);
+    util::parallelFor(
+        0, dims.z,
+        [&](size_t z) {
+            const auto slice = data.subspan(z * sliceSize, sliceSize);
+            offsets[z + 1] = static_cast<size_t>(std::ranges::count_if(slice, predicate));
+        },
+        {.grainSize = 1});
+    std::inclusive_scan(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<size3_t> voxels(offsets.back());
+    util::parallelFor(
+        0, dims.z,
+        [&](size_t z) {
+            auto out = voxels.begin() + offsets[z];
+            size_t i = z * sliceSize;
+            for (size_t y = 0; y < dims.y; ++y) {
+                for (size_t x = 0; x < dims.x; ++x, ++i) {
+                    if (predicate(data[i])) *out++ = size3_t{x, y, z};
+                }
+            }
+        },
+        {.grainSize = 1});
+    return voxels;
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -56,7 +56,14 @@ namespace inviwo {
 
 class IVW_MODULE_VECTORFIELDVISUALIZATION_API IntegralLine {
 public:
-    enum class TerminationReason { StartPoint, Steps, OutOfBounds, ZeroVelocity, Unknown };
+    enum class TerminationReason {
+        StartPoint,
+        Steps,
+        OutOfBounds,
+        ZeroVelocity,
+        Length,
+        Unknown
+    };
 
     IntegralLine() = default;
     IntegralLine(const IntegralLine& rhs) = default;
@@ -32,15 +32,23 @@
 #include <inviwo/core/util/glmconvert.h>        // for glm_convert
 #include <inviwo/core/util/glmutils.h>          // for Matrix
 #include <inviwo/core/util/glmvec.h>            // for dvec3
+#include <inviwo/core/util/parallel.h>          // for parallelReduce
 #include <inviwo/core/util/spatialsampler.h>    // IWUY pragma: keep
 #include <inviwo/core/util/spatial4dsampler.h>  // IWUY pragma: keep
 #include <inviwo/core/util/typetraits.h>
 #include <modules/vectorfieldvisualization/datastructures/integralline.h>        // for Integral...
+#include <modules/vectorfieldvisualization/datastructures/integrallineset.h>     // for Integral...
 #include <modules/vectorfieldvisualization/properties/integrallineproperties.h>  // for Integral...
 
+#include <algorithm>      // for clamp, max
+#include <array>          // for array
+#include <cmath>          // for abs, pow
 #include <cstddef>        // for size_t
+#include <iterator>       // for make_mov...
 #include <limits>         // for numeric_...
 #include <memory>         // for shared_ptr
+#include <optional>       // for optional
+#include <ranges>         // for size
 #include <string>         // for string
 #include <unordered_map>  // for unordere...
 #include <utility>        // for pair
@@ -79,6 +87,18 @@ public:
 
     Result traceFrom(const SpatialVector& pIn) const;
 
+    /**
+     * Trace a line from each of the @p seeds, in parallel over chunks of seeds. Lines with less
+     * than two points are skipped. The remaining lines are appended to @p lines in seed order,
+     * with the index of the line set to @p startIndex plus the index of its seed. The result is
+     * thus independent of the number of threads used.
+     *
+     * If the sampler is streaming, see Spatial4DSampler::isStreaming, all lines are instead
+     * advanced in lock-step through one time window of the sampler at a time.
+     */
+    template <typename Seeds>
+    void traceFrom(const Seeds& seeds, IntegralLineSet& lines, size_t startIndex = 0) const;
+
     void addMetaDataSampler(const std::string& name, std::shared_ptr<const Sampler> sampler);
 
     const DataHomogeneousSpatialMatrix& getSeedTransformationMatrix() const;
@@ -92,19 +112,60 @@ private:
 
     inline SpatialVector seedTransform(const SpatialVector& seed) const;
 
+    // The containers of the line being traced, looked up once per line instead of once per point
+    struct LineData {
+        std::vector<dvec3>* positions;
+        std::vector<dvec3>* velocities;
+        std::vector<double>* timestamps;
+        std::vector<std::pair<const Sampler*, std::vector<SampleType>*>> metaData;
+    };
+
+    // The state of integrating one direction of a line, kept to be able to pause and resume
+    struct Front {
+        SpatialVector pos;
+        double stepSize;
+        size_t steps;
+        double length;
+        double maxLength;
+    };
+
+    // The number of steps to take backward and forward, also sets the termination reason of a
+    // direction that is not traced
+    std::pair<size_t, size_t> stepsPerDirection(IntegralLine& line) const;
+    LineData prepareLine(IntegralLine& line) const;
+
+    template <typename Seeds>
+    void traceInTimeWindows(const Seeds& seeds, IntegralLineSet& lines, size_t startIndex) const;
+
     StepResult step(const SpatialVector& oldPos, double stepSize) const;
 
-    bool addPoint(IntegralLine& line, const SpatialVector& pos) const;
-    bool addPoint(IntegralLine& line, const SpatialVector& pos,
-                  const DataVector& worldVelocity) const;
+    /**
+     * Take one step with the embedded Dormand-Prince 5(4) scheme. The step is retried with a
+     * smaller size until the position error estimate is within the tolerance. On return
+     * @p stepSize holds the step size to try next.
+     */
+    StepResult adaptiveStep(const SpatialVector& oldPos, double& stepSize) const;
+
+    SpatialVector displace(const SpatialVector& pos, const DataVector& v, double stepSize) const;
+
+    bool addPoint(LineData& data, const SpatialVector& pos) const;
+    bool addPoint(LineData& data, const SpatialVector& pos, const DataVector& worldVelocity) const;
 
-    IntegralLine::TerminationReason integrate(size_t steps, SpatialVector pos, IntegralLine& line,
-                                              bool fwd) const;
+    IntegralLine::TerminationReason integrate(size_t steps, SpatialVector pos, LineData& data,
+                                              bool fwd, double maxLength) const;
+    /**
+     * Integrate from @p front until the line terminates, or returns std::nullopt when the next step
+     * would go beyond @p timeLimit in the direction of integration.
+     */
+    std::optional<IntegralLine::TerminationReason> integrate(Front& front, LineData& data,
+                                                             double timeLimit) const;
 
     IntegralLineProperties::IntegrationScheme integrationScheme_;
 
     int steps_;
     double stepSize_;
+    double tolerance_;
+    double maxLength_;
     IntegralLineProperties::Direction dir_;
     bool normalizeSamples_;
 
@@ -121,6 +182,8 @@ IntegralLineTracer<SpatialSampler, TimeDependent>::IntegralLineTracer(
     : integrationScheme_(properties.getIntegrationScheme())
     , steps_(properties.getNumberOfSteps())
     , stepSize_(properties.getStepSize())
+    , tolerance_(properties.getTolerance())
+    , maxLength_(properties.getMaxLength())
     , dir_(properties.getStepDirection())
     , normalizeSamples_(properties.getNormalizeSamples())
     , sampler_(sampler)
@@ -135,46 +198,228 @@ IntegralLineTracer<SpatialSampler, TimeDependent>::traceFrom(const SpatialVector
     Result res;
     IntegralLine& line = res.line;
 
-    const auto [stepsBWD, stepsFWD] = [dir = dir_, steps = steps_,
-                                       &line]() -> std::pair<size_t, size_t> {
-        switch (dir) {
-            case inviwo::IntegralLineProperties::Direction::Forward:
-                line.setBackwardTerminationReason(IntegralLine::TerminationReason::StartPoint);
-                return {1, steps + 1};
-            case inviwo::IntegralLineProperties::Direction::Backward:
-                line.setForwardTerminationReason(IntegralLine::TerminationReason::StartPoint);
-                return {steps + 1, 1};
-            default:
-            case inviwo::IntegralLineProperties::Direction::Bidirectional: {
-                return {steps / 2 + 1, steps - (steps / 2) + 1};
-            }
+    const auto [stepsBWD, stepsFWD] = stepsPerDirection(line);
+    LineData data = prepareLine(line);
+
+    if (!addPoint(data, p)) {
+        return res;  // Zero velocity at seed point
+    }
+
+    // Like the steps, the length is split between the directions
+    const double maxLength =
+        dir_ == IntegralLineProperties::Direction::Bidirectional ? maxLength_ / 2.0 : maxLength_;
+
+    line.setBackwardTerminationReason(integrate(stepsBWD, p, data, false, maxLength));
+
+    if (line.getPositions().size() > 1) {
+        line.reverse();
+        res.seedIndex = line.getPositions().size() - 1;
+    }
+
+    line.setForwardTerminationReason(integrate(stepsFWD, p, data, true, maxLength));
+    return res;
+}
+
+template <typename SpatialSampler, bool TimeDependent>
+std::pair<size_t, size_t> IntegralLineTracer<SpatialSampler, TimeDependent>::stepsPerDirection(
+    IntegralLine& line) const {
+    const size_t steps = static_cast<size_t>(steps_);
+    switch (dir_) {
+        case inviwo::IntegralLineProperties::Direction::Forward:
+            line.setBackwardTerminationReason(IntegralLine::TerminationReason::StartPoint);
+            return {1, steps + 1};
+        case inviwo::IntegralLineProperties::Direction::Backward:
+            line.setForwardTerminationReason(IntegralLine::TerminationReason::StartPoint);
+            return {steps + 1, 1};
+        default:
+        case inviwo::IntegralLineProperties::Direction::Bidirectional: {
+            return {steps / 2 + 1, steps - (steps / 2) + 1};
         }
-    }();
+    }
+}
 
-    line.getPositions().reserve(steps_ + 2);
-    line.getMetaData<dvec3>("velocity", true).reserve(steps_ + 2);
+template <typename SpatialSampler, bool TimeDependent>
+auto IntegralLineTracer<SpatialSampler, TimeDependent>::prepareLine(IntegralLine& line) const
+    -> LineData {
+    LineData data{.positions = &line.getPositions(),
+                  .velocities = &line.getMetaData<dvec3>("velocity", true),
+                  .timestamps = nullptr,
+                  .metaData = {}};
+    data.positions->reserve(steps_ + 2);
+    data.velocities->reserve(steps_ + 2);
 
     if constexpr (TimeDependent) {
-        line.getMetaData<double>("timestamp", true).reserve(steps_ + 2);
+        data.timestamps = &line.getMetaData<double>("timestamp", true);
+        data.timestamps->reserve(steps_ + 2);
     }
 
+    data.metaData.reserve(metaSamplers_.size());
     for (auto& m : metaSamplers_) {
-        line.getMetaData<typename Sampler::type>(m.first, true).reserve(steps_ + 2);
+        auto& container = line.getMetaData<SampleType>(m.first, true);
+        container.reserve(steps_ + 2);
+        data.metaData.emplace_back(m.second.get(), &container);
     }
+    return data;
+}
 
-    if (!addPoint(line, p)) {
-        return res;  // Zero velocity at seed point
+template <typename SpatialSampler, bool TimeDependent>
+template <typename Seeds>
+void IntegralLineTracer<SpatialSampler, TimeDependent>::traceFrom(const Seeds& seeds,
+                                                                  IntegralLineSet& lines,
+                                                                  size_t startIndex) const {
+    if constexpr (TimeDependent) {
+        if (sampler_->isStreaming()) {
+            traceInTimeWindows(seeds, lines, startIndex);
+            return;
+        }
     }
 
-    line.setBackwardTerminationReason(integrate(stepsBWD, p, line, false));
+    using Lines = std::vector<IntegralLine>;
+
+    auto traced = util::parallelReduce(
+        size_t{0}, std::ranges::size(seeds), Lines{},
+        [&](size_t first, size_t last) {
+            Lines chunk;
+            chunk.reserve(last - first);
+            for (size_t i = first; i < last; ++i) {
+                auto res = traceFrom(SpatialVector(seeds[i]));
+                if (res.line.getPositions().size() > 1) {
+                    res.line.setIndex(static_cast<uint32_t>(startIndex + i));
+                    chunk.push_back(std::move(res.line));
+                }
+            }
+            return chunk;
+        },
+        [](Lines a, Lines b) {
+            if (a.empty()) return b;
+            a.insert(a.end(), std::make_move_iterator(b.begin()), std::make_move_iterator(b.end()));
+            return a;
+        });
+
+    auto& dst = lines.getVector();
+    dst.reserve(dst.size() + traced.size());
+    dst.insert(dst.end(), std::make_move_iterator(traced.begin()),
+               std::make_move_iterator(traced.end()));
+}
 
-    if (line.getPositions().size() > 1) {
-        line.reverse();
-        res.seedIndex = line.getPositions().size() - 1;
-    }
+template <typename SpatialSampler, bool TimeDependent>
+template <typename Seeds>
+void IntegralLineTracer<SpatialSampler, TimeDependent>::traceInTimeWindows(
+    const Seeds& seeds, IntegralLineSet& lines, size_t startIndex) const {
+    constexpr auto timeDim = Sampler::SpatialDimensions - 1;
+
+    // The line data points into the lines, they must not move before tracing is done
+    struct Trace {
+        IntegralLine line{};
+        LineData data{};
+        SpatialVector seed{};
+        std::pair<size_t, size_t> steps{};
+        Front front{};
+        bool started = false;
+        bool failed = false;
+    };
+    std::vector<Trace> traces(std::ranges::size(seeds));
+    util::parallelFor(0, traces.size(), [&](size_t i) {
+        auto& trace = traces[i];
+        trace.seed = seedTransform(SpatialVector(seeds[i]));
+        trace.steps = stepsPerDirection(trace.line);
+        trace.data = prepareLine(trace.line);
+    });
+
+    const double maxLength =
+        dir_ == IntegralLineProperties::Direction::Bidirectional ? maxLength_ / 2.0 : maxLength_;
+
+    // Advance all lines in one direction, the line furthest behind in time decides where the next
+    // window of the sampler starts. The seed point is added once the window has reached it.
+    const auto advance = [&](bool fwd) {
+        const double stepSize = stepSize_ * (fwd ? 1.0 : -1.0);
+        const auto setReason = [fwd](IntegralLine& line, IntegralLine::TerminationReason reason) {
+            if (fwd) {
+                line.setForwardTerminationReason(reason);
+            } else {
+                line.setBackwardTerminationReason(reason);
+            }
+        };
+        std::vector<size_t> active;
+        for (size_t i = 0; i < traces.size(); ++i) {
+            auto& trace = traces[i];
+            if (trace.failed) continue;
+            trace.front = Front{.pos = trace.seed,
+                                .stepSize = stepSize,
+                                .steps = fwd ? trace.steps.second : trace.steps.first,
+                                .length = 0.0,
+                                .maxLength = maxLength};
+            active.push_back(i);
+        }
 
-    line.setForwardTerminationReason(integrate(stepsFWD, p, line, true));
-    return res;
+        std::optional<double> reached;
+        while (!active.empty()) {
+            double time = traces[active.front()].front.pos[timeDim];
+            for (const auto i : active) {
+                const auto t = traces[i].front.pos[timeDim];
+                time = fwd ? std::min(time, t) : std::max(time, t);
+            }
+            const dvec2 window = sampler_->requestTimeWindow(dvec2{time, time + stepSize});
+            const double limit = fwd ? window.y : window.x;
+
+            if (reached && *reached == limit) {
+                // The window can not move any further, there is no more data
+                for (const auto i : active) {
+                    setReason(traces[i].line, IntegralLine::TerminationReason::OutOfBounds);
+                }
+                break;
+            }
+            reached = limit;
+
+            std::vector<unsigned char> done(active.size(), 0);
+            util::parallelFor(0, active.size(), [&](size_t k) {
+                auto& trace = traces[active[k]];
+                if (!trace.started) {
+                    const auto t = trace.seed[timeDim];
+                    if (fwd ? t < window.x : t > window.y) {  // Outside of the data
+                        trace.failed = true;
+                        done[k] = 1;
+                        return;
+                    } else if (fwd ? t > window.y : t < window.x) {  // Not yet reached
+                        return;
+                    }
+                    trace.started = true;
+                    if (!addPoint(trace.data, trace.seed)) {  // Zero velocity at seed point
+                        trace.failed = true;
+                        done[k] = 1;
+                        return;
+                    }
+                }
+                if (const auto reason = integrate(trace.front, trace.data, limit)) {
+                    setReason(trace.line, *reason);
+                    done[k] = 1;
+                }
+            });
+
+            std::vector<size_t> remaining;
+            for (size_t k = 0; k < active.size(); ++k) {
+                if (!done[k]) remaining.push_back(active[k]);
+            }
+            active = std::move(remaining);
+        }
+    };
+
+    advance(false);
+    for (auto& trace : traces) {
+        if (trace.line.getPositions().size() > 1) {
+            trace.line.reverse();
+        }
+    }
+    advance(true);
+
+    auto& dst = lines.getVector();
+    for (size_t i = 0; i < traces.size(); ++i) {
+        auto& line = traces[i].line;
+        if (line.getPositions().size() > 1) {
+            line.setIndex(static_cast<uint32_t>(startIndex + i));
+            dst.push_back(std::move(line));
+        }
+    }
 }
 
 template <typename SpatialSampler, bool TimeDependent>
@@ -214,17 +459,7 @@ auto IntegralLineTracer<SpatialSampler, TimeDependent>::step(const SpatialVector
         if (normalizeSamples_) {
             v = normalize(v);
         }
-        DataVector offset = (invBasis_ * (v * stepsize));
-        if constexpr (TimeDependent) {
-            return pos + SpatialVector(offset, stepsize);
-        } else if constexpr (SampleDim == 3) {
-            return pos + offset;
-        } else if constexpr (SampleDim == 2) {
-            return SpatialVector{DataVector{pos} + offset, 0.0};
-        } else {
-            static_assert(util::alwaysFalse<SpatialSampler>(),
-                          "Unsupported number of DataDimensions");
-        }
+        return displace(pos, v, stepsize);
     };
 
     auto k1 = sampler_->sample(oldPos);
@@ -235,23 +470,23 @@ auto IntegralLineTracer<SpatialSampler, TimeDependent>::step(const SpatialVector
         default:
             [[fallthrough]];
         case inviwo::IntegralLineProperties::IntegrationScheme::RK4: {
-            SpatialVector pos = move(oldPos, k1, stepSize / 2);
-            if (!sampler_->withinBounds(pos)) {
+            const auto s2 = sampler_->sampleIfWithinBounds(move(oldPos, k1, stepSize / 2));
+            if (!s2) {
                 return {oldPos, k1, true};
             }
-            const DataVector k2 = sampler_->sample(pos);
+            const DataVector k2 = *s2;
 
-            pos = move(oldPos, k2, stepSize / 2);
-            if (!sampler_->withinBounds(pos)) {
+            const auto s3 = sampler_->sampleIfWithinBounds(move(oldPos, k2, stepSize / 2));
+            if (!s3) {
                 return {oldPos, k1, true};
             }
-            const DataVector k3 = sampler_->sample(pos);
+            const DataVector k3 = *s3;
 
-            pos = move(oldPos, k3, stepSize);
-            if (!sampler_->withinBounds(pos)) {
+            const auto s4 = sampler_->sampleIfWithinBounds(move(oldPos, k3, stepSize));
+            if (!s4) {
                 return {oldPos, k1, true};
             }
-            const DataVector k4 = sampler_->sample(pos);
+            const DataVector k4 = *s4;
 
             const auto&& K = [n = normalizeSamples_, normalize, &k1, &k2, &k3, &k4]() {
                 if (n) {
@@ -266,48 +501,165 @@ auto IntegralLineTracer<SpatialSampler, TimeDependent>::step(const SpatialVector
 }
 
 template <typename SpatialSampler, bool TimeDependent>
-bool IntegralLineTracer<SpatialSampler, TimeDependent>::addPoint(IntegralLine& line,
+auto IntegralLineTracer<SpatialSampler, TimeDependent>::adaptiveStep(const SpatialVector& oldPos,
+                                                                     double& stepSize) const
+    -> StepResult {
+    // Dormand-Prince coefficients, the last row of a is the 5th order solution
+    static constexpr std::array<std::array<double, 6>, 6> a{
+        {{1.0 / 5.0},
+         {3.0 / 40.0, 9.0 / 40.0},
+         {44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0},
+         {19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0},
+         {9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0},
+         {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0}}};
+    static constexpr std::array<double, 6> c{1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0};
+    // Difference between the 5th and the 4th order solutions
+    static constexpr std::array<double, 7> e{
+        71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0, -17253.0 / 339200.0, 22.0 / 525.0,
+        -1.0 / 40.0};
+
+    const auto velocity = [&](const DataVector& v) -> DataVector {
+        if (!normalizeSamples_) return v;
+        const auto l = glm::length(v);
+        return l == 0 ? v : v / l;
+    };
+
+    const double sign = stepSize < 0.0 ? -1.0 : 1.0;
+    const double maxStep = std::abs(stepSize_);
+    const double minStep = maxStep * 1.0e-4;
+
+    const DataVector sample = sampler_->sample(oldPos);
+    std::array<DataVector, 7> k;
+    k[0] = velocity(sample);
+
+    double h = std::abs(stepSize);
+    while (true) {
+        SpatialVector pos{};
+        size_t stage = 1;
+        for (; stage < 7; ++stage) {
+            DataVector sum{0.0};
+            for (size_t j = 0; j < stage; ++j) {
+                sum += a[stage - 1][j] * k[j];
+            }
+            // Scale by c such that a time dependent position also moves c * h in time
+            const auto s = c[stage - 1];
+            pos = displace(oldPos, sum / s, sign * s * h);
+            const auto v = sampler_->sampleIfWithinBounds(pos);
+            if (!v) break;
+            k[stage] = velocity(*v);
+        }
+
+        if (stage < 7) {  // Left the volume, retry with a shorter step
+            if (h <= minStep) return {oldPos, sample, true};
+            h = std::max(minStep, h * 0.5);
+            continue;
+        }
+
+        DataVector diff{0.0};
+        for (size_t j = 0; j < 7; ++j) {
+            diff += e[j] * k[j];
+        }
+        const double error = glm::length(invBasis_ * (diff * h));
+        const double scale =
+            error > 0.0 ? std::clamp(0.9 * std::pow(tolerance_ / error, 0.2), 0.2, 5.0) : 5.0;
+
+        if (error <= tolerance_ || h <= minStep) {
+            stepSize = sign * std::clamp(h * scale, minStep, maxStep);
+            return {pos, sample, false};
+        }
+        h = std::max(minStep, h * scale);
+    }
+}
+
+template <typename SpatialSampler, bool TimeDependent>
+auto IntegralLineTracer<SpatialSampler, TimeDependent>::displace(const SpatialVector& pos,
+                                                                 const DataVector& v,
+                                                                 double stepSize) const
+    -> SpatialVector {
+    const DataVector offset = invBasis_ * (v * stepSize);
+    if constexpr (TimeDependent) {
+        return pos + SpatialVector(offset, stepSize);
+    } else if constexpr (SampleDim == 3) {
+        return pos + offset;
+    } else if constexpr (SampleDim == 2) {
+        return SpatialVector{DataVector{pos} + offset, 0.0};
+    } else {
+        static_assert(util::alwaysFalse<SpatialSampler>(), "Unsupported number of DataDimensions");
+    }
+}
+
+template <typename SpatialSampler, bool TimeDependent>
+bool IntegralLineTracer<SpatialSampler, TimeDependent>::addPoint(LineData& data,
                                                                  const SpatialVector& pos) const {
-    return addPoint(line, pos, sampler_->sample(pos));
+    return addPoint(data, pos, sampler_->sample(pos));
 }
 
 template <typename SpatialSampler, bool TimeDependent>
 bool IntegralLineTracer<SpatialSampler, TimeDependent>::addPoint(
-    IntegralLine& line, const SpatialVector& pos, const DataVector& worldVelocity) const {
+    LineData& data, const SpatialVector& pos, const DataVector& worldVelocity) const {
 
     if (glm::length(worldVelocity) < std::numeric_limits<double>::epsilon()) {
         return false;
     }
 
-    line.getPositions().emplace_back(util::glm_convert<dvec3>(pos));
-    line.getMetaData<dvec3>("velocity").emplace_back(util::glm_convert<dvec3>(worldVelocity));
+    data.positions->emplace_back(util::glm_convert<dvec3>(pos));
+    data.velocities->emplace_back(util::glm_convert<dvec3>(worldVelocity));
 
     if constexpr (TimeDependent) {
-        line.getMetaData<double>("timestamp").emplace_back(pos[Sampler::SpatialDimensions - 1]);
+        data.timestamps->emplace_back(pos[Sampler::SpatialDimensions - 1]);
     }
 
-    for (auto& m : metaSamplers_) {
-        line.getMetaData<typename Sampler::type>(m.first).emplace_back(
-            util::glm_convert<dvec3>(m.second->sample(pos)));
+    for (auto& [sampler, container] : data.metaData) {
+        container->emplace_back(util::glm_convert<dvec3>(sampler->sample(pos)));
     }
     return true;
 }
 
 template <typename SpatialSampler, bool TimeDependent>
 IntegralLine::TerminationReason IntegralLineTracer<SpatialSampler, TimeDependent>::integrate(
-    size_t steps, SpatialVector pos, IntegralLine& line, bool fwd) const {
+    size_t steps, SpatialVector pos, LineData& data, bool fwd, double maxLength) const {
     if (steps == 0) return IntegralLine::TerminationReason::StartPoint;
-    for (size_t i = 0; i < steps; i++) {
-        if (!sampler_->withinBounds(pos)) {
+    Front front{.pos = pos,
+                .stepSize = stepSize_ * (fwd ? 1.0 : -1.0),
+                .steps = steps,
+                .length = 0.0,
+                .maxLength = maxLength};
+    const double noLimit = (fwd ? 1.0 : -1.0) * std::numeric_limits<double>::infinity();
+    return *integrate(front, data, noLimit);
+}
+
+template <typename SpatialSampler, bool TimeDependent>
+auto IntegralLineTracer<SpatialSampler, TimeDependent>::integrate(Front& front, LineData& data,
+                                                                  double timeLimit) const
+    -> std::optional<IntegralLine::TerminationReason> {
+    while (front.steps > 0) {
+        if (!sampler_->withinBounds(front.pos)) {
             return IntegralLine::TerminationReason::OutOfBounds;
         }
-        StepResult result = step(pos, stepSize_ * (fwd ? 1.0 : -1.0));
+        if constexpr (TimeDependent) {
+            const double t = front.pos[Sampler::SpatialDimensions - 1] + front.stepSize;
+            if (front.stepSize > 0.0 ? t > timeLimit : t < timeLimit) {
+                return std::nullopt;
+            }
+        }
+        StepResult result =
+            integrationScheme_ == IntegralLineProperties::IntegrationScheme::RK45
+                ? adaptiveStep(front.pos, front.stepSize)
+                : step(front.pos, front.stepSize);
         if (result.outOfBounds) {
             return IntegralLine::TerminationReason::OutOfBounds;
         }
-        pos = result.position;
+        if (front.maxLength > 0.0) {
+            front.length += glm::distance(util::glm_convert<dvec3>(front.pos),
+                                          util::glm_convert<dvec3>(result.position));
+            if (front.length > front.maxLength) {
+                return IntegralLine::TerminationReason::Length;
+            }
+        }
+        front.pos = result.position;
+        --front.steps;
 
-        if (!addPoint(line, result.position, result.data)) {
+        if (!addPoint(data, result.position, result.data)) {
             return IntegralLine::TerminationReason::ZeroVelocity;
         }
     }
@@ -40,6 +40,7 @@
 #include <inviwo/core/properties/ordinalproperty.h>                 // for Float...
 #include <modules/vectorfieldvisualization/ports/seedpointsport.h>  // for SeedP...
 
+#include <memory>  // for shared_ptr
 #include <random>  // for mt19937
 
 namespace inviwo {
@@ -81,6 +82,9 @@ private:
     BoolProperty useSameSeed_;
     IntProperty seed_;
 
+    BoolProperty sortSeeds_;
+
+    void setPoints(std::shared_ptr<SeedPoint3DVector> points);
     void randomPoints();
     void planePoints();
     void linePoints();
@@ -73,6 +73,7 @@ protected:
     BoolProperty useSameSeed_;
     IntProperty seed_;
     BoolProperty transformToWorld_;
+    BoolProperty sortSeeds_;
 
 private:
     std::mt19937 mt_;
@@ -34,6 +34,7 @@
 #include <inviwo/core/ports/volumeport.h>                           // for Volum...
 #include <inviwo/core/processors/processor.h>                       // for Proce...
 #include <inviwo/core/processors/processorinfo.h>                   // for Proce...
+#include <inviwo/core/properties/boolproperty.h>                    // for BoolP...
 #include <inviwo/core/properties/ordinalproperty.h>                 // for Float...
 #include <modules/vectorfieldvisualization/ports/seedpointsport.h>  // for SeedP...
 
@@ -54,6 +55,7 @@ private:
     SeedPoints4DOutport seeds_;
 
     FloatProperty randomSampling_;
+    BoolProperty sortSeeds_;
 };
 
 }  // namespace inviwo
@@ -48,7 +48,7 @@ namespace inviwo {
 
 class IVW_MODULE_VECTORFIELDVISUALIZATION_API IntegralLineProperties : public CompositeProperty {
 public:
-    enum class IntegrationScheme { Euler, RK4 };
+    enum class IntegrationScheme { Euler, RK4, RK45 };
 
     enum class Direction { Forward = 1, Backward = 2, Bidirectional = 3 };
 
@@ -63,6 +63,10 @@ public:
 
     int getNumberOfSteps() const;
     float getStepSize() const;
+    /// Position error tolerance per step, in data space, for the adaptive RK45 scheme
+    float getTolerance() const;
+    /// Maximum arc length of a line in data space, zero means no limit
+    float getMaxLength() const;
 
     IntegralLineProperties::Direction getStepDirection() const;
     IntegralLineProperties::IntegrationScheme getIntegrationScheme() const;
@@ -75,6 +79,8 @@ private:
 public:
     IntProperty numberOfSteps_;
     FloatProperty stepSize_;
+    FloatProperty tolerance_;
+    FloatProperty maxLength_;
     BoolProperty normalizeSamples_;
 
     OptionProperty<IntegralLineProperties::Direction> stepDirection_;
@@ -0,0 +1,102 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/vectorfieldvisualization/algorithms/seedpointutils.h>
+
+#include <inviwo/core/util/glmvec.h>                                // for Vector
+#include <inviwo/core/util/parallel.h>                              // for parallelFor
+#include <modules/vectorfieldvisualization/ports/seedpointsport.h>  // for SeedPoint3DVector
+
+#include <algorithm>  // for stable_sort
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
+#include <limits>     // for numeric_limits
+#include <utility>    // for pair
+#include <vector>     // for vector
+
+#include <glm/common.hpp>  // for min, max
+
+namespace inviwo {
+
+namespace {
+
+// Spread the lowest 64 / N bits of x such that there are N - 1 zero bits between each of them
+template <size_t N>
+std::uint64_t spreadBits(std::uint64_t x) {
+    std::uint64_t res = 0;
+    for (size_t i = 0; i < 64 / N; ++i) {
+        res |= ((x >> i) & std::uint64_t{1}) << (i * N);
+    }
+    return res;
+}
+
+template <size_t N>
+void mortonSort(std::vector<Vector<N, float>>& points) {
+    using Point = Vector<N, float>;
+    if (points.size() < 2) return;
+
+    Point lower{std::numeric_limits<float>::max()};
+    Point upper{std::numeric_limits<float>::lowest()};
+    for (const auto& p : points) {
+        lower = glm::min(lower, p);
+        upper = glm::max(upper, p);
+    }
+    const auto extent = Vector<N, double>{upper - lower};
+    constexpr auto maxCell = static_cast<double>((std::uint64_t{1} << (64 / N)) - 1);
+
+    std::vector<std::pair<std::uint64_t, Point>> keyed(points.size());
+    util::parallelFor(0, points.size(), [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            const auto& p = points[i];
+            std::uint64_t code = 0;
+            for (size_t d = 0; d < N; ++d) {
+                const auto cell =
+                    extent[d] > 0.0 ? (static_cast<double>(p[d] - lower[d]) / extent[d]) * maxCell
+                                    : 0.0;
+                code |= spreadBits<N>(static_cast<std::uint64_t>(cell)) << d;
+            }
+            keyed[i] = {code, p};
+        }
+    });
+
+    std::ranges::stable_sort(keyed, {}, &std::pair<std::uint64_t, Point>::first);
+    std::ranges::transform(keyed, points.begin(), [](const auto& item) { return item.second; });
+}
+
+}  // namespace
+
+namespace util {
+
+void sortSpatially(SeedPoint2DVector& points) { mortonSort(points); }
+void sortSpatially(SeedPoint3DVector& points) { mortonSort(points); }
+void sortSpatially(SeedPoint4DVector& points) { mortonSort(points); }
+
+}  // namespace util
+
+}  // namespace inviwo
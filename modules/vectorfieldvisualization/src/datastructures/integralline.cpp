@@ -183,6 +183,9 @@ std::ostream& operator<<(std::ostream& os, IntegralLine::TerminationReason reaso
         case IntegralLine::TerminationReason::Steps:
             os << "Steps";
             break;
+        case IntegralLine::TerminationReason::Length:
+            os << "Length";
+            break;
         default:
         case IntegralLine::TerminationReason::Unknown:
             os << "Unknown";
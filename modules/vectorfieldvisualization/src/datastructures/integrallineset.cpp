@@ -81,12 +81,12 @@ void IntegralLineSet::push_back(IntegralLine&& line, SetIndex updateIndex) {
     if (updateIndex == SetIndex::Yes) {
         line.setIndex(static_cast<uint32_t>(lines_.size()));
     }
-    lines_.push_back(line);
+    lines_.push_back(std::move(line));
 }
 
 void IntegralLineSet::push_back(IntegralLine&& line, size_t idx) {
     line.setIndex(static_cast<uint32_t>(idx));
-    lines_.push_back(line);
+    lines_.push_back(std::move(line));
 }
 
 }  // namespace inviwo
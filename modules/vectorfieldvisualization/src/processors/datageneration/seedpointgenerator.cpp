@@ -29,19 +29,21 @@
 
 #include <modules/vectorfieldvisualization/processors/datageneration/seedpointgenerator.h>
 
-#include <inviwo/core/processors/processor.h>                       // for Processor
-#include <inviwo/core/processors/processorinfo.h>                   // for ProcessorInfo
-#include <inviwo/core/processors/processorstate.h>                  // for CodeState, CodeState:...
-#include <inviwo/core/processors/processortags.h>                   // for Tags
-#include <inviwo/core/properties/boolproperty.h>                    // for BoolProperty
-#include <inviwo/core/properties/compositeproperty.h>               // for CompositeProperty
-#include <inviwo/core/properties/minmaxproperty.h>                  // for FloatMinMaxProperty
-#include <inviwo/core/properties/optionproperty.h>                  // for OptionPropertyInt
-#include <inviwo/core/properties/ordinalproperty.h>                 // for FloatVec3Property
-#include <inviwo/core/util/glmvec.h>                                // for vec3, vec2
-#include <inviwo/core/util/logcentral.h>                            // for LogCentral
-#include <modules/base/algorithm/randomutils.h>                     // for randomNumber
-#include <modules/vectorfieldvisualization/ports/seedpointsport.h>  // for SeedPoints3DOutport
+#include <inviwo/core/algorithm/markdown.h>                              // for operator""_help
+#include <inviwo/core/processors/processor.h>                            // for Processor
+#include <inviwo/core/processors/processorinfo.h>                        // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>                       // for CodeState, CodeSt...
+#include <inviwo/core/processors/processortags.h>                        // for Tags
+#include <inviwo/core/properties/boolproperty.h>                         // for BoolProperty
+#include <inviwo/core/properties/compositeproperty.h>                    // for CompositeProperty
+#include <inviwo/core/properties/minmaxproperty.h>                       // for FloatMinMaxProperty
+#include <inviwo/core/properties/optionproperty.h>                       // for OptionPropertyInt
+#include <inviwo/core/properties/ordinalproperty.h>                      // for FloatVec3Property
+#include <inviwo/core/util/glmvec.h>                                     // for vec3, vec2
+#include <inviwo/core/util/logcentral.h>                                 // for LogCentral
+#include <modules/base/algorithm/randomutils.h>                          // for randomNumber
+#include <modules/vectorfieldvisualization/algorithms/seedpointutils.h>  // for sortSpatially
+#include <modules/vectorfieldvisualization/ports/seedpointsport.h>       // for SeedPoints3DOutport
 
 #include <cmath>        // for cos, sin, acos, pow
 #include <functional>   // for __base
@@ -92,6 +94,10 @@ SeedPointGenerator::SeedPointGenerator()
     , randomness_("randomness", "Randomness")
     , useSameSeed_("useSameSeed", "Use same seed", true)
     , seed_("seed", "Seed", 1, 0, 1000)
+    , sortSeeds_("sortSeeds", "Sort Spatially",
+                 "Reorder the seed points along a Morton curve so that consecutive seeds are "
+                 "close in space, which improves cache locality when tracing"_help,
+                 false)
     , rd_()
     , mt_(rd_()) {
     addPort(seedPoints_);
@@ -127,6 +133,8 @@ SeedPointGenerator::SeedPointGenerator()
     randomness_.addProperty(seed_);
     useSameSeed_.onChange([&]() { seed_.setVisible(useSameSeed_.get()); });
 
+    addProperty(sortSeeds_);
+
     onGeneratorChange();
 }
 
@@ -174,6 +182,11 @@ void SeedPointGenerator::onGeneratorChange() {
     lineEnd_.setVisible(line);
 }
 
+void SeedPointGenerator::setPoints(std::shared_ptr<SeedPoint3DVector> points) {
+    if (sortSeeds_) util::sortSpatially(*points);
+    seedPoints_.setData(points);
+}
+
 void SeedPointGenerator::spherePoints() {
     auto T = [](auto&& r) { return util::randomNumber<float>(r, 0, glm::two_pi<float>()); };
     auto cos_phi = [](auto&& r) { return util::randomNumber<float>(r, -1, 1); };
@@ -200,7 +213,7 @@ void SeedPointGenerator::spherePoints() {
         points->push_back(p);
     }
 
-    seedPoints_.setData(points);
+    setPoints(points);
 }
 
 void SeedPointGenerator::linePoints() {
@@ -210,7 +223,7 @@ void SeedPointGenerator::linePoints() {
         auto p = lineStart_.get() + (lineEnd_.get() - lineStart_.get()) * (i * dt);
         points->push_back(p);
     }
-    seedPoints_.setData(points);
+    setPoints(points);
 }
 
 void SeedPointGenerator::planePoints() {
@@ -229,7 +242,7 @@ void SeedPointGenerator::planePoints() {
             points->push_back(p);
         }
     }
-    seedPoints_.setData(points);
+    setPoints(points);
 }
 
 void SeedPointGenerator::randomPoints() {
@@ -240,7 +253,7 @@ void SeedPointGenerator::randomPoints() {
         const float z = util::randomNumber<float>(mt_);
         points->emplace_back(x, y, z);
     }
-    seedPoints_.setData(points);
+    setPoints(points);
 }
 
 }  // namespace inviwo
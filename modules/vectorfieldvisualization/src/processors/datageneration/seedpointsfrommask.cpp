@@ -29,28 +29,28 @@
 
 #include <modules/vectorfieldvisualization/processors/datageneration/seedpointsfrommask.h>
 
-#include <inviwo/core/datastructures/coordinatetransformer.h>           // for StructuredCoordin...
-#include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
-#include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
-#include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
-#include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
-#include <inviwo/core/datastructures/volume/volumeramprecision.h>       // IWYU pragma: keep
-#include <inviwo/core/ports/datainport.h>                               // for DataInport
-#include <inviwo/core/ports/inportiterable.h>                           // for InportIterable<>:...
-#include <inviwo/core/ports/outportiterable.h>                          // for OutportIterable
-#include <inviwo/core/processors/processor.h>                           // for Processor
-#include <inviwo/core/processors/processorinfo.h>                       // for ProcessorInfo
-#include <inviwo/core/processors/processorstate.h>                      // for CodeState, CodeSt...
-#include <inviwo/core/processors/processortags.h>                       // for Tags, Tags::CPU
-#include <inviwo/core/properties/boolproperty.h>                        // for BoolProperty
-#include <inviwo/core/properties/compositeproperty.h>                   // for CompositeProperty
-#include <inviwo/core/properties/ordinalproperty.h>                     // for IntProperty, Doub...
-#include <inviwo/core/util/glmconvert.h>                                // for glm_convert_norma...
-#include <inviwo/core/util/glmutils.h>                                  // for Matrix
-#include <inviwo/core/util/glmvec.h>                                    // for vec3, vec4, uvec3
-#include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxel
-#include <modules/vectorfieldvisualization/ports/seedpointsport.h>      // for SeedPoints3DOutport
+#include <inviwo/core/algorithm/markdown.h>                              // for operator""_help
+#include <inviwo/core/datastructures/coordinatetransformer.h>            // for StructuredCoordin...
+#include <inviwo/core/datastructures/representationconverter.h>          // for RepresentationCon...
+#include <inviwo/core/datastructures/representationconverterfactory.h>   // for RepresentationCon...
+#include <inviwo/core/datastructures/volume/volume.h>                    // for Volume
+#include <inviwo/core/datastructures/volume/volumeram.h>                 // for VolumeRAM
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>        // IWYU pragma: keep
+#include <inviwo/core/ports/datainport.h>                                // for DataInport
+#include <inviwo/core/ports/inportiterable.h>                            // for InportIterable<>:...
+#include <inviwo/core/ports/outportiterable.h>                           // for OutportIterable
+#include <inviwo/core/processors/processor.h>                            // for Processor
+#include <inviwo/core/processors/processorinfo.h>                        // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>                       // for CodeState, CodeSt...
+#include <inviwo/core/processors/processortags.h>                        // for Tags, Tags::CPU
+#include <inviwo/core/properties/boolproperty.h>                         // for BoolProperty
+#include <inviwo/core/properties/compositeproperty.h>                    // for CompositeProperty
+#include <inviwo/core/properties/ordinalproperty.h>                      // for IntProperty, Doub...
+#include <inviwo/core/util/glmconvert.h>                                 // for glm_convert_norma...
+#include <inviwo/core/util/glmutils.h>                                   // for Matrix
+#include <inviwo/core/util/glmvec.h>                                     // for vec3, vec4, uvec3
+#include <modules/vectorfieldvisualization/algorithms/seedpointutils.h>  // for findVoxels
+#include <modules/vectorfieldvisualization/ports/seedpointsport.h>       // for SeedPoints3DOutport
 
 #include <functional>     // for __base
 #include <memory>         // for shared_ptr, make_...
@@ -87,6 +87,10 @@ SeedPointsFromMask::SeedPointsFromMask()
     , useSameSeed_("useSameSeed", "Use same seed", true)
     , seed_("seed", "Seed", 1, 0, 1000)
     , transformToWorld_("transformToWorld", "Transform To World Space", false)
+    , sortSeeds_("sortSeeds", "Sort Spatially",
+                 "Reorder the seed points along a Morton curve so that consecutive seeds are "
+                 "close in space, which improves cache locality when tracing"_help,
+                 false)
     , mt_()
     , dis_(.0f, 1.f) {
     addPort(volumes_);
@@ -94,6 +98,7 @@ SeedPointsFromMask::SeedPointsFromMask()
 
     addProperty(threshold_);
     addProperty(transformToWorld_);
+    addProperty(sortSeeds_);
 
     addProperty(enableSuperSample_);
     addProperty(superSample_);
@@ -120,10 +125,9 @@ void SeedPointsFromMask::process() {
 
     for (const auto& v : volumes_) {
         v->getRepresentation<VolumeRAM>()->dispatch<void>([&](auto volPrecision) {
-            auto dim = volPrecision->getDimensions();
-            auto data = volPrecision->getDataTyped();
-            util::IndexMapper3D index(dim);
-            vec3 invDim = vec3(1.0f) / vec3(dim);
+            const auto dim = volPrecision->getDimensions();
+            const vec3 invDim = vec3(1.0f) / vec3(dim);
+            const auto threshold = threshold_.get();
 
             auto transform = [transformToWorld = transformToWorld_.get(),
                               m = v->getCoordinateTransformer().getDataToWorldMatrix()](auto p) {
@@ -135,22 +139,30 @@ void SeedPointsFromMask::process() {
                 }
             };
 
-            util::forEachVoxel(*volPrecision, [&](const size3_t& pos) {
-                if (util::glm_convert_normalized<double>(data[index(pos)]) > threshold_.get()) {
-                    if (enableSuperSample_.get()) {
-                        for (int j = 0; j < superSample_.get(); j++) {
-                            const auto x = dis_(mt_);
-                            const auto y = dis_(mt_);
-                            const auto z = dis_(mt_);
-                            points->push_back(transform((vec3(pos) + vec3{x, y, z}) * invDim));
-                        }
-                    } else {
-                        points->push_back(transform((vec3(pos) + 0.5f) * invDim));
+            const auto voxels = util::findVoxels(*volPrecision, [threshold](const auto& value) {
+                return util::glm_convert_normalized<double>(value) > threshold;
+            });
+
+            if (enableSuperSample_.get()) {
+                const auto perVoxel = static_cast<size_t>(superSample_.get());
+                points->reserve(points->size() + voxels.size() * perVoxel);
+                for (const auto& pos : voxels) {
+                    for (int j = 0; j < superSample_.get(); j++) {
+                        const auto x = dis_(mt_);
+                        const auto y = dis_(mt_);
+                        const auto z = dis_(mt_);
+                        points->push_back(transform((vec3(pos) + vec3{x, y, z}) * invDim));
                     }
                 }
-            });
+            } else {
+                points->reserve(points->size() + voxels.size());
+                for (const auto& pos : voxels) {
+                    points->push_back(transform((vec3(pos) + 0.5f) * invDim));
+                }
+            }
         });
     }
+    if (sortSeeds_) util::sortSpatially(*points);
     seedPoints_.setData(points);
 }
 
@@ -29,22 +29,23 @@
 
 #include <modules/vectorfieldvisualization/processors/seedsfrommasksequence.h>
 
-#include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
-#include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
-#include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
-#include <inviwo/core/datastructures/volume/volumeramprecision.h>       // IWYU pragma: keep
-#include <inviwo/core/ports/volumeport.h>                               // for VolumeSequenceInport
-#include <inviwo/core/processors/processor.h>                           // for Processor
-#include <inviwo/core/processors/processorinfo.h>                       // for ProcessorInfo
-#include <inviwo/core/processors/processorstate.h>                      // for CodeState, CodeSt...
-#include <inviwo/core/processors/processortags.h>                       // for Tags, Tags::CPU
-#include <inviwo/core/properties/ordinalproperty.h>                     // for FloatProperty
-#include <inviwo/core/util/glmconvert.h>                                // for glm_convert
-#include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t
-#include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxel
-#include <inviwo/core/util/volumesequenceutils.h>                       // for getTimestamp, has...
-#include <modules/vectorfieldvisualization/ports/seedpointsport.h>      // for SeedPoint4DVector
+#include <inviwo/core/algorithm/markdown.h>                              // for operator""_help
+#include <inviwo/core/datastructures/representationconverter.h>          // for RepresentationCon...
+#include <inviwo/core/datastructures/representationconverterfactory.h>   // for RepresentationCon...
+#include <inviwo/core/datastructures/volume/volumeram.h>                 // for VolumeRAM
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>        // IWYU pragma: keep
+#include <inviwo/core/ports/volumeport.h>                                // for VolumeSequenceInport
+#include <inviwo/core/processors/processor.h>                            // for Processor
+#include <inviwo/core/processors/processorinfo.h>                        // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>                       // for CodeState, CodeSt...
+#include <inviwo/core/processors/processortags.h>                        // for Tags, Tags::CPU
+#include <inviwo/core/properties/boolproperty.h>                         // for BoolProperty
+#include <inviwo/core/properties/ordinalproperty.h>                      // for FloatProperty
+#include <inviwo/core/util/glmconvert.h>                                 // for glm_convert
+#include <inviwo/core/util/glmvec.h>                                     // for vec3, size3_t
+#include <inviwo/core/util/volumesequenceutils.h>                        // for getTimestamp, has...
+#include <modules/vectorfieldvisualization/algorithms/seedpointutils.h>  // for findVoxels
+#include <modules/vectorfieldvisualization/ports/seedpointsport.h>       // for SeedPoint4DVector
 
 #include <cstddef>        // for size_t
 #include <memory>         // for shared_ptr, make_...
@@ -73,11 +74,16 @@ SeedsFromMaskSequence::SeedsFromMaskSequence()
     : Processor()
     , sequence_("sequence")
     , seeds_("seeds_")
-    , randomSampling_("randomSampling", "Random sampling (keep percentage)", 1.f, 0.f, 1.f, 0.01f) {
+    , randomSampling_("randomSampling", "Random sampling (keep percentage)", 1.f, 0.f, 1.f, 0.01f)
+    , sortSeeds_("sortSeeds", "Sort Spatially",
+                 "Reorder the seed points along a Morton curve in space and time so that "
+                 "consecutive seeds are close, which improves cache locality when tracing"_help,
+                 false) {
 
     addPort(sequence_);
     addPort(seeds_);
     addProperty(randomSampling_);
+    addProperty(sortSeeds_);
 }
 
 void SeedsFromMaskSequence::process() {
@@ -99,21 +105,19 @@ void SeedsFromMaskSequence::process() {
             } else {
                 t = static_cast<float>(volID) / static_cast<float>(volumes.size() - 1);
             }
-            auto data = typedVol->getDataTyped();
-            auto dim = typedVol->getDimensions();
-            vec3 invDim = vec3(1.0f) / vec3(dim);
-            util::IndexMapper3D index(dim);
-            util::forEachVoxel(*typedVol, [&](const size3_t& pos) {
-                if (dis(gen) > randomSampling_.get()) return;
-                auto v = util::glm_convert<float>(data[index(pos)]);
-                if (v > 0) {
-                    points.emplace_back((vec3(pos) + 0.5f) * invDim, t);
-                }
-            });
+            const auto dim = typedVol->getDimensions();
+            const vec3 invDim = vec3(1.0f) / vec3(dim);
+            const auto voxels = util::findVoxels(
+                *typedVol, [](const auto& value) { return util::glm_convert<float>(value) > 0; });
+            for (const auto& pos : voxels) {
+                if (dis(gen) > randomSampling_.get()) continue;
+                points.emplace_back((vec3(pos) + 0.5f) * invDim, t);
+            }
             volID++;
         });
     }
 
+    if (sortSeeds_) util::sortSpatially(points);
     seeds_.setData(outvec);
 }
 
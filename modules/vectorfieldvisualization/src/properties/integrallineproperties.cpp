@@ -29,11 +29,13 @@
 
 #include <modules/vectorfieldvisualization/properties/integrallineproperties.h>
 
+#include <inviwo/core/algorithm/markdown.h>                    // for operator""_help
 #include <inviwo/core/datastructures/coordinatetransformer.h>  // for CoordinateSpace, Coordinat...
 #include <inviwo/core/properties/boolproperty.h>               // for BoolProperty
 #include <inviwo/core/properties/compositeproperty.h>          // for CompositeProperty
 #include <inviwo/core/properties/optionproperty.h>             // for OptionProperty
 #include <inviwo/core/properties/ordinalproperty.h>            // for FloatProperty, IntProperty
+#include <inviwo/core/properties/propertysemantics.h>          // for PropertySemantics
 #include <inviwo/core/util/staticstring.h>                     // for operator+
 
 namespace inviwo {
@@ -43,6 +45,15 @@ IntegralLineProperties::IntegralLineProperties(std::string_view identifier,
     : CompositeProperty(identifier, displayName)
     , numberOfSteps_("steps", "Number of Steps", util::ordinalCount(100, 1000))
     , stepSize_("stepSize", "Step size", util::ordinalScale(0.001f, 1.0f))
+    , tolerance_("tolerance", "Error Tolerance",
+                 util::ordinalScale(1.0e-5f, 1.0e-2f)
+                     .set("Largest position error accepted in a step of the adaptive scheme. "
+                          "The step size is used as the largest step taken."_help)
+                     .set(PropertySemantics::Text))
+    , maxLength_("maxLength", "Max Length",
+                 util::ordinalLength(0.0f, 10.0f)
+                     .set("Terminate lines at this arc length in data space, "
+                          "zero means no limit"_help))
     , normalizeSamples_("normalizeSamples", "Normalize Samples", true)
     , stepDirection_("stepDirection", "Step Direction")
     , integrationScheme_("integrationScheme", "Integration Scheme")
@@ -54,6 +65,8 @@ IntegralLineProperties::IntegralLineProperties(const IntegralLineProperties& rhs
     : CompositeProperty(rhs)
     , numberOfSteps_(rhs.numberOfSteps_)
     , stepSize_(rhs.stepSize_)
+    , tolerance_(rhs.tolerance_)
+    , maxLength_(rhs.maxLength_)
     , normalizeSamples_(rhs.normalizeSamples_)
     , stepDirection_(rhs.stepDirection_)
     , integrationScheme_(rhs.integrationScheme_)
@@ -71,6 +84,10 @@ int IntegralLineProperties::getNumberOfSteps() const { return numberOfSteps_.get
 
 float IntegralLineProperties::getStepSize() const { return stepSize_.get(); }
 
+float IntegralLineProperties::getTolerance() const { return tolerance_.get(); }
+
+float IntegralLineProperties::getMaxLength() const { return maxLength_.get(); }
+
 IntegralLineProperties::Direction IntegralLineProperties::getStepDirection() const {
     return stepDirection_.get();
 }
@@ -95,6 +112,8 @@ void IntegralLineProperties::setUpProperties() {
                                  IntegralLineProperties::IntegrationScheme::Euler);
     integrationScheme_.addOption("rk4", "Runge-Kutta (RK4)",
                                  IntegralLineProperties::IntegrationScheme::RK4);
+    integrationScheme_.addOption("rk45", "Adaptive Dormand-Prince (RK45)",
+                                 IntegralLineProperties::IntegrationScheme::RK45);
     integrationScheme_.setSelectedValue(IntegralLineProperties::IntegrationScheme::RK4);
 
     seedPointsSpace_.addOption("data", "Data", CoordinateSpace::Data);
@@ -105,9 +124,15 @@ void IntegralLineProperties::setUpProperties() {
     addProperty(stepSize_);
     addProperty(stepDirection_);
     addProperty(integrationScheme_);
+    addProperty(tolerance_);
+    addProperty(maxLength_);
     addProperty(seedPointsSpace_);
     addProperty(normalizeSamples_);
 
+    tolerance_.visibilityDependsOn(integrationScheme_, [](const auto& p) {
+        return p.get() == IntegralLineProperties::IntegrationScheme::RK45;
+    });
+
     setAllPropertiesCurrentStateAsDefault();
 }
 
@@ -0,0 +1,133 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/coremodulesharedlibrary.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/common/inviwomodulefactoryobject.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/volumesampler.h>
+#include <modules/base/algorithm/volume/volumegeneration.h>
+#include <modules/vectorfieldvisualization/datastructures/integrallineset.h>
+#include <modules/vectorfieldvisualization/integrallinetracer.h>
+#include <modules/vectorfieldvisualization/properties/integrallineproperties.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace inviwo;
+
+namespace {
+
+using Scheme = IntegralLineProperties::IntegrationScheme;
+
+// A helix around the z-axis, so that lines stay inside the volume for most of their steps
+std::shared_ptr<const VolumeDoubleSampler<3>> makeSampler() {
+    const size3_t dims{64};
+    const dvec3 center = dvec3{dims} / 2.0;
+    std::shared_ptr<const Volume> volume =
+        util::generateVolume(dims, mat3(1.0), [&](const size3_t& ind) {
+            const auto p = (dvec3{ind} - center) / center;
+            return vec3{-p.y, p.x, 0.1};
+        });
+    return std::make_shared<VolumeDoubleSampler<3>>(volume);
+}
+
+std::vector<dvec3> makeSeeds(size_t count) {
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<double> dist{0.2, 0.8};
+    std::vector<dvec3> seeds(count);
+    for (auto& seed : seeds) seed = dvec3{dist(gen), dist(gen), dist(gen)};
+    return seeds;
+}
+
+// The first argument is the number of seeds, the second the number of threads in the pool where
+// zero runs everything serially.
+template <Scheme scheme>
+void TraceStreamLines(benchmark::State& state) {
+    static const auto sampler = makeSampler();
+    const auto seeds = makeSeeds(static_cast<size_t>(state.range(0)));
+
+    IntegralLineProperties properties{"lines", "Lines"};
+    properties.integrationScheme_.set(scheme);
+    properties.numberOfSteps_.set(200);
+    properties.stepSize_.set(0.005f);
+    properties.stepDirection_.set(IntegralLineProperties::Direction::Bidirectional);
+
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(1)));
+    state.counters["Threads"] = static_cast<double>(state.range(1));
+
+    const StreamLine3DTracer tracer{sampler, properties};
+    size_t points = 0;
+    for (auto _ : state) {
+        IntegralLineSet lines{sampler->getModelMatrix()};
+        tracer.traceFrom(seeds, lines);
+        for (const auto& line : lines) points += line.getPositions().size();
+        benchmark::DoNotOptimize(lines);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["Points"] =
+        benchmark::Counter(static_cast<double>(points), benchmark::Counter::kIsRate);
+}
+
+}  // namespace
+
+BENCHMARK(TraceStreamLines<Scheme::Euler>)
+    ->ArgsProduct({benchmark::CreateRange(64, 4096, 8), {0, 4, 8}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(TraceStreamLines<Scheme::RK4>)
+    ->ArgsProduct({benchmark::CreateRange(64, 4096, 8), {0, 4, 8}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(TraceStreamLines<Scheme::RK45>)
+    ->ArgsProduct({benchmark::CreateRange(64, 4096, 8), {0, 4, 8}})
+    ->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    LogCentral::init();
+    LogCentral::getPtr()->setVerbosity(LogVerbosity::Error);
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-IntegralLineTracer");
+    {
+        std::vector<std::unique_ptr<InviwoModuleFactoryObject>> modules;
+        modules.emplace_back(createInviwoCore());
+        app.registerModules(std::move(modules));
+    }
+    app.processFront();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
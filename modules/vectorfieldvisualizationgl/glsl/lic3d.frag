@@ -29,29 +29,24 @@
 
 #include "utils/structs.glsl"
 #include "utils/sampler3d.glsl"
-#include "utils/classification.glsl"
 
-uniform sampler3D volume;  // noise
-uniform VolumeParameters volumeParameters;
+// Convolves the noise along the vector field, the result is mapped to colors in lic3dcolor.frag.
+// Runs on the grid of the output volume described by volumeParameters, which can be coarser
+// than the noise.
+
+uniform sampler3D noise;
+uniform VolumeParameters noiseParameters;
 
 uniform sampler3D vectorField;
 uniform VolumeParameters vectorFieldParameters;
 
-uniform sampler2D tf;
-uniform float velocityScale;
-uniform float alphaScale;
-
 uniform int samples;
 uniform float stepLength;
 uniform mat3 invBasis;
 uniform bool normalizeVectors;
-uniform bool intensityMapping;
 
 in vec4 texCoord_;
 
-#define noise volume
-#define noiseParameters volumeParameters
-
 uniform float noiseRepeat = 5.f;
 
 void main(void) {
@@ -59,7 +54,8 @@ void main(void) {
     float voxelVelo = length(vec3(getVoxel(vectorField, vectorFieldParameters, texCoord_.xyz)));
 
     if (voxelVelo < 0.000001) {
-        discard;
+        FragData0 = vec4(0);
+        return;
     }
 
     int c = 1;
@@ -96,14 +92,5 @@ void main(void) {
         c += 1;
     }
 
-    v /= c;
-
-    if (intensityMapping) {
-        v = pow(v, (4.0 / pow((v + 1.0), 4)));
-    }
-
-    vec4 color = applyTF(tf, voxelVelo / velocityScale);
-    color.a *= v * alphaScale;
-
-    FragData0 = color;
+    FragData0 = vec4(v / c);
 }
@@ -0,0 +1,67 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include "utils/structs.glsl"
+#include "utils/sampler3d.glsl"
+#include "utils/classification.glsl"
+
+// Maps the convolved noise from lic3d.frag to colors, the convolution is linearly interpolated
+// when it was computed on a coarser grid
+
+uniform sampler3D convolution;
+
+uniform sampler3D vectorField;
+uniform VolumeParameters vectorFieldParameters;
+
+uniform sampler2D tf;
+uniform float velocityScale;
+uniform float alphaScale;
+uniform bool intensityMapping;
+
+in vec4 texCoord_;
+
+void main(void) {
+    float voxelVelo = length(vec3(getVoxel(vectorField, vectorFieldParameters, texCoord_.xyz)));
+
+    if (voxelVelo < 0.000001) {
+        FragData0 = vec4(0);
+        return;
+    }
+
+    float v = texture(convolution, texCoord_.xyz).r;
+
+    if (intensityMapping) {
+        v = pow(v, (4.0 / pow((v + 1.0), 4)));
+    }
+
+    vec4 color = applyTF(tf, voxelVelo / velocityScale);
+    color.a *= v * alphaScale;
+
+    FragData0 = color;
+}
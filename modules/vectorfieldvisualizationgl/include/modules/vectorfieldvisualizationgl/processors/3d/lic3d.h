@@ -37,13 +37,25 @@
 #include <inviwo/core/properties/boolproperty.h>
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/properties/transferfunctionproperty.h>
+#include <inviwo/core/util/timer.h>
 #include <modules/basegl/processors/volumeprocessing/volumeglprocessor.h>
+#include <modules/opengl/buffer/framebufferobject.h>
+#include <modules/opengl/shader/shader.h>
 
 #include <memory>
 
 namespace inviwo {
 class TextureUnitContainer;
 
+/**
+ * Computes a line integral convolution of the noise in the inport along the vector field.
+ *
+ * The convolution is cached and only a cheap color mapping pass is redone when only the transfer
+ * function, velocity scale, alpha scale, or intensity mapping change. With progressive
+ * refinement enabled, a change of the convolution first computes it on a grid downsampled by
+ * the interaction downsampling factor. After the refinement delay without further changes, the
+ * grid is refined by a factor of two at a time until it reaches the resolution of the noise.
+ */
 class IVW_MODULE_VECTORFIELDVISUALIZATIONGL_API LIC3D : public VolumeGLProcessor {
 public:
     LIC3D();
@@ -52,8 +64,10 @@ public:
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
 
-    virtual void preProcess(TextureUnitContainer& cont) override;
+    virtual void process() override;
+
     virtual void postProcess() override;
+    virtual void afterInportChanged() override;
 
 protected:
     VolumeInport vectorField_;
@@ -69,7 +83,23 @@ protected:
 
     FloatProperty alphaScale_;
 
+    BoolProperty progressive_;
+    IntProperty downsampling_;
+    IntProperty refinementDelay_;
+
     std::unique_ptr<Volume> noiseVolume_;
+
+private:
+    void invalidateConvolution();
+    void convolve(const Volume& noise);
+
+    Shader colorShader_;
+    FrameBufferObject convolutionFbo_;
+    std::shared_ptr<Volume> convolution_;
+    bool convolutionInvalid_;
+    // The current downsampling factor of the convolution grid
+    int level_;
+    Delay refine_;
 };
 
 }  // namespace inviwo
@@ -47,6 +47,9 @@
 #include <modules/opengl/shader/shader.h>
 #include <modules/vectorfieldvisualization/ports/seedpointsport.h>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -70,8 +73,8 @@ public:
 
 private:
     void update();
-    void initBuffers();
-    void reseed();
+    void initParticles(size_t capacity);
+    void uploadSeeds();
     void advect();
 
     enum class SeedingSpace { Data, World };
@@ -90,6 +93,8 @@ private:
     TransferFunctionProperty tf_;
 
     FloatProperty reseedInterval_;
+    IntSizeTProperty capacity_;
+    IntSizeTProperty respawnLimit_;
 
     Shader shader_;
     Timer timer_;
@@ -98,12 +103,22 @@ private:
     Clock clock_;
     bool ready_;
     bool buffersDirty_;
-
-    std::shared_ptr<Mesh> mesh_;
-    std::shared_ptr<Buffer<vec4>> bufPos_;
-    std::shared_ptr<Buffer<float>> bufLife_;
+    bool seedsDirty_;
+    bool initialize_;
+    std::uint32_t frame_;
+
+    /**
+     * The particle state is double buffered, each frame reads from one and writes to the other.
+     * There is one mesh for each state, the one last written to is the output.
+     */
+    size_t current_;
+    std::array<std::shared_ptr<Buffer<vec4>>, 2> bufPos_;
+    std::array<std::shared_ptr<Buffer<float>>, 2> bufLife_;
+    std::array<std::shared_ptr<Mesh>, 2> meshes_;
     std::shared_ptr<Buffer<float>> bufRad_;
     std::shared_ptr<Buffer<vec4>> bufCol_;
+    std::shared_ptr<Buffer<vec4>> bufSeeds_;
+    Buffer<std::uint32_t> bufCounter_;
 };
 
 }  // namespace inviwo
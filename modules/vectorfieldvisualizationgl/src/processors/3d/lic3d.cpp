@@ -29,8 +29,11 @@
 
 #include <modules/vectorfieldvisualizationgl/processors/3d/lic3d.h>
 
+#include <inviwo/core/algorithm/markdown.h>                                // for operator""_help
 #include <inviwo/core/datastructures/datamapper.h>                         // for DataMapper
 #include <inviwo/core/datastructures/transferfunction.h>                   // for TransferFunction
+#include <inviwo/core/datastructures/volume/volume.h>                      // for Volume
+#include <inviwo/core/network/networklock.h>                               // for NetworkLock
 #include <inviwo/core/ports/volumeport.h>                                  // for VolumeInport
 #include <inviwo/core/processors/processorinfo.h>                          // for ProcessorInfo
 #include <inviwo/core/processors/processorstate.h>                         // for CodeState, Cod...
@@ -41,15 +44,22 @@
 #include <inviwo/core/util/formats.h>                                      // for DataFormat
 #include <inviwo/core/util/glmvec.h>                                       // for dvec2, vec4
 #include <modules/basegl/processors/volumeprocessing/volumeglprocessor.h>  // for VolumeGLProcessor
+#include <modules/opengl/inviwoopengl.h>                                   // for glViewport
 #include <modules/opengl/shader/shader.h>                                  // for Shader
+#include <modules/opengl/shader/shadertype.h>                              // for ShaderType
 #include <modules/opengl/shader/shaderutils.h>                             // for setUniforms
+#include <modules/opengl/texture/textureunit.h>                            // for TextureUnitCon...
 #include <modules/opengl/texture/textureutils.h>                           // for bindAndSetUnif...
+#include <modules/opengl/volume/volumegl.h>                                // for VolumeGL
 #include <modules/opengl/volume/volumeutils.h>                             // for bindAndSetUnif...
 
+#include <algorithm>    // for max
+#include <chrono>       // for milliseconds
 #include <string>       // for string
 #include <string_view>  // for string_view
 #include <type_traits>  // for remove_extent_t
 
+#include <glm/common.hpp>  // for max
 #include <glm/mat3x3.hpp>  // for mat
 #include <glm/matrix.hpp>  // for inverse
 
@@ -77,11 +87,50 @@ LIC3D::LIC3D()
     , tf_("tf", "Velocity Transfer function")
     , velocityScale_("velocityScale", "Velocity Scale (inverse)", 1, 0, 10)
     , alphaScale_("alphaScale", "Alpha Scale", 500, 0.01f, 100000, 0.01f)
-    , noiseVolume_(nullptr) {
+    , progressive_("progressive", "Progressive Refinement",
+                   "Compute the convolution on a coarser grid after each change and refine it "
+                   "when there have been no changes for a while"_help,
+                   false)
+    , downsampling_("downsampling", "Interaction Downsampling",
+                    "Factor to downsample the convolution grid by right after a change"_help, 4,
+                    {2, ConstraintBehavior::Immutable}, {16, ConstraintBehavior::Ignore})
+    , refinementDelay_("refinementDelay", "Refinement Delay (ms)",
+                       "Time without changes before the next refinement"_help, 200,
+                       {0, ConstraintBehavior::Immutable}, {2000, ConstraintBehavior::Ignore})
+    , noiseVolume_(nullptr)
+    , colorShader_({{ShaderType::Vertex, utilgl::findShaderResource("volume_gpu.vert")},
+                    {ShaderType::Geometry, utilgl::findShaderResource("volume_gpu.geom")},
+                    {ShaderType::Fragment, utilgl::findShaderResource("lic3dcolor.frag")}})
+    , convolutionFbo_()
+    , convolution_()
+    , convolutionInvalid_(true)
+    , level_(1)
+    , refine_(std::chrono::milliseconds{200}, [this]() {
+        if (level_ <= 1) return;
+        NetworkLock lock(this);
+        level_ = std::max(1, level_ / 2);
+        invalidateConvolution();
+    }) {
 
     addPort(vectorField_);
     addProperties(samples_, stepLength_, normalizeVectors_, intensityMapping_, noiseRepeat_, tf_,
-                  velocityScale_, alphaScale_);
+                  velocityScale_, alphaScale_, progressive_, downsampling_, refinementDelay_);
+
+    downsampling_.visibilityDependsOn(progressive_, [](const auto& p) { return p.get(); });
+    refinementDelay_.visibilityDependsOn(progressive_, [](const auto& p) { return p.get(); });
+
+    // Changes of these require a new convolution, the others only a new color mapping
+    const auto restart = [this]() {
+        level_ = progressive_ ? downsampling_.get() : 1;
+        invalidateConvolution();
+    };
+    for (Property* p : std::initializer_list<Property*>{&samples_, &stepLength_,
+                                                         &normalizeVectors_, &noiseRepeat_,
+                                                         &progressive_}) {
+        p->onChange(restart);
+    }
+    vectorField_.onChange(restart);
+    colorShader_.onReload([this]() { invalidate(InvalidationLevel::InvalidResources); });
 
     tf_.get().clear();
     tf_.get().add(0.0, vec4(0, 0, 1, 1));
@@ -93,14 +142,86 @@ LIC3D::LIC3D()
     dataFormat_ = DataVec4UInt8::get();
 }
 
-void LIC3D::preProcess(TextureUnitContainer& cont) {
-    utilgl::bindAndSetUniforms(shader_, cont, *vectorField_.getData().get(), "vectorField");
-    utilgl::setUniforms(shader_, samples_, stepLength_, normalizeVectors_, intensityMapping_,
-                        noiseRepeat_, alphaScale_, velocityScale_);
+void LIC3D::afterInportChanged() {
+    level_ = progressive_ ? downsampling_.get() : 1;
+    invalidateConvolution();
+}
 
-    utilgl::bindAndSetUniforms(shader_, cont, tf_);
+void LIC3D::invalidateConvolution() {
+    convolutionInvalid_ = true;
+    invalidate(InvalidationLevel::InvalidOutput);
+}
 
+void LIC3D::convolve(const Volume& noise) {
+    const size3_t dims = glm::max(noise.getDimensions() / size3_t(level_), size3_t{1});
+    bool reattach = false;
+    if (!convolution_ || convolution_->getDimensions() != dims) {
+        convolution_ = std::make_shared<Volume>(
+            VolumeConfig{.dimensions = dims, .format = DataFloat32::get()});
+        reattach = true;
+    }
+
+    shader_.activate();
+    TextureUnitContainer cont;
+    utilgl::bindAndSetUniforms(shader_, cont, noise, "noise");
+    // The geometry shader sets up the slices of the convolution grid
+    utilgl::setShaderUniforms(shader_, *convolution_, "volumeParameters");
+    utilgl::bindAndSetUniforms(shader_, cont, *vectorField_.getData(), "vectorField");
+    utilgl::setUniforms(shader_, samples_, stepLength_, normalizeVectors_, noiseRepeat_);
     shader_.setUniform("invBasis", glm::inverse(vectorField_.getData()->getBasis()));
+
+    convolutionFbo_.activate();
+    glViewport(0, 0, static_cast<GLsizei>(dims.x), static_cast<GLsizei>(dims.y));
+    VolumeGL* volumeGL = convolution_->getEditableRepresentation<VolumeGL>();
+    if (reattach) {
+        convolutionFbo_.attachColorTexture(volumeGL->getTexture().get(), 0);
+    }
+    utilgl::multiDrawImagePlaneRect(static_cast<int>(dims.z));
+    shader_.deactivate();
+    convolutionFbo_.deactivate();
+}
+
+void LIC3D::process() {
+    const auto noise = inport_.getData();
+
+    if (convolutionInvalid_ || !convolution_) {
+        convolve(*noise);
+        convolutionInvalid_ = false;
+        if (level_ > 1) {
+            refine_.start(std::chrono::milliseconds{refinementDelay_.get()});
+        } else {
+            refine_.cancel();
+        }
+    }
+
+    bool reattach = false;
+    if (internalInvalid_) {
+        reattach = true;
+        internalInvalid_ = false;
+        volume_ = std::make_shared<Volume>(noise->config().updateFrom({.format = dataFormat_}));
+        outport_.setData(volume_);
+    }
+
+    colorShader_.activate();
+    TextureUnitContainer cont;
+    utilgl::bindAndSetUniforms(colorShader_, cont, *convolution_, "convolution");
+    utilgl::setShaderUniforms(colorShader_, *volume_, "volumeParameters");
+    utilgl::bindAndSetUniforms(colorShader_, cont, *vectorField_.getData(), "vectorField");
+    utilgl::bindAndSetUniforms(colorShader_, cont, tf_);
+    utilgl::setUniforms(colorShader_, intensityMapping_, alphaScale_, velocityScale_);
+
+    const size3_t dims{noise->getDimensions()};
+    fbo_.activate();
+    glViewport(0, 0, static_cast<GLsizei>(dims.x), static_cast<GLsizei>(dims.y));
+    VolumeGL* outVolumeGL = volume_->getEditableRepresentation<VolumeGL>();
+    if (reattach) {
+        fbo_.attachColorTexture(outVolumeGL->getTexture().get(), 0);
+    }
+    utilgl::multiDrawImagePlaneRect(static_cast<int>(dims.z));
+    colorShader_.deactivate();
+    fbo_.deactivate();
+
+    postProcess();
 }
 
 void LIC3D::postProcess() {
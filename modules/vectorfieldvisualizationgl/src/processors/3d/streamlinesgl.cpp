@@ -0,0 +1,265 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/vectorfieldvisualizationgl/processors/3d/streamlinesgl.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>               // for Buffer, IndexBuffer
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>   // for BufferRAMPrecision
+#include <inviwo/core/datastructures/coordinatetransformer.h>       // for StructuredCoordin...
+#include <inviwo/core/datastructures/geometry/geometrytype.h>       // for BufferType, DrawType
+#include <inviwo/core/datastructures/geometry/mesh.h>               // for Mesh
+#include <inviwo/core/datastructures/transferfunction.h>            // for TransferFunction
+#include <inviwo/core/processors/processorstate.h>                  // for CodeState, CodeSt...
+#include <inviwo/core/processors/processortags.h>                   // for Tags, Tags::GL
+#include <inviwo/core/properties/propertysemantics.h>               // for PropertySemantics
+#include <inviwo/core/util/exception.h>                             // for Exception
+#include <inviwo/core/util/filesystem.h>                            // for filesystem::getPath
+#include <inviwo/core/util/glmvec.h>                                // for vec3, uvec2
+#include <inviwo/core/util/pathtype.h>                              // for PathType, PathTyp...
+#include <modules/opengl/buffer/buffergl.h>                         // for BufferGL
+#include <modules/opengl/inviwoopengl.h>                            // for GL_SHADER_STORAGE...
+#include <modules/opengl/openglcapabilities.h>                      // for OpenGLCapabilities
+#include <modules/opengl/shader/shaderobject.h>                     // for ShaderObject
+#include <modules/opengl/shader/shadertype.h>                       // for ShaderType
+#include <modules/opengl/texture/textureunit.h>                     // for TextureUnitContainer
+#include <modules/opengl/texture/textureutils.h>                    // for bindAndSetUniforms
+#include <modules/opengl/volume/volumeutils.h>                      // for bindAndSetUniforms
+#include <modules/vectorfieldvisualization/ports/seedpointsport.h>  // for SeedPoints3DInport
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <limits>       // for numeric_limits
+#include <string_view>  // for string_view
+#include <utility>      // for pair
+#include <vector>       // for vector
+
+#include <glm/matrix.hpp>  // for inverse
+
+namespace inviwo {
+
+const ProcessorInfo StreamLinesGL::processorInfo_{
+    "org.inviwo.StreamLinesGL",  // Class identifier
+    "Stream Lines GL",           // Display name
+    "Integral Line Tracer",      // Category
+    CodeState::Experimental,     // Code state
+    Tags::GL,                    // Tags
+    R"(Traces stream lines from the __seeds__ through the velocity field on the __volume__ inport
+    using a GLSL compute shader. The lines are written directly into the GL buffers of the output
+    mesh, with positions in the data space of the volume, colors given by mapping the velocity
+    magnitude through the transfer function, and the velocity magnitude as scalar meta data.
+    Requires OpenGL 4.3)"_unindentHelp};
+
+const ProcessorInfo& StreamLinesGL::getProcessorInfo() const { return processorInfo_; }
+
+StreamLinesGL::StreamLinesGL()
+    : Processor()
+    , volume_{"volume", "Velocity field"_help}
+    , seeds_{"seeds", "Seed points for the stream lines"_help}
+    , mesh_{"lines", "Line mesh with position, color and scalar meta data buffers"_help}
+    , properties_{"properties", "Properties"}
+    , minV_{"minV", "Min velocity",
+            util::ordinalLength(0.0f)
+                .set("Used together with __Max velocity__ to map velocity magnitude "
+                     "from [Min velocity, Max velocity] -> [0 1] for the color"_help)
+                .set(PropertySemantics::Text)}
+    , maxV_{"maxV", "Max velocity",
+            util::ordinalLength(1.0f)
+                .set("Used together with __Min velocity__ to map velocity magnitude "
+                     "from [Min velocity, Max velocity] -> [0 1] for the color"_help)
+                .set(PropertySemantics::Text)}
+    , tf_{"tf", "Velocity mapping", "Transferfunction to map a velocity to color"_help,
+          TransferFunction::load(
+              filesystem::getPath(PathType::TransferFunctions, "/matplotlib/plasma.itf"))}
+    , countShader_{{{ShaderType::Compute, std::string{"streamlinestracer.comp"}}},
+                   Shader::Build::No}
+    , traceShader_{{{ShaderType::Compute, std::string{"streamlinestracer.comp"}}},
+                   Shader::Build::No} {
+
+    addPorts(volume_, seeds_, mesh_);
+    addProperties(properties_, minV_, maxV_, tf_);
+
+    countShader_.onReload([this]() { invalidate(InvalidationLevel::InvalidOutput); });
+    traceShader_.onReload([this]() { invalidate(InvalidationLevel::InvalidOutput); });
+}
+
+void StreamLinesGL::initializeResources() {
+    if (OpenGLCapabilities::getOpenGLVersion() < 430) {
+        isReady_.setUpdate([]() -> ProcessorStatus {
+            static constexpr std::string_view error{
+                "The StreamLinesGL processor requires OpenGL 4.3"};
+            return {ProcessorStatus::Error, error};
+        });
+        throw Exception(SourceContext{}, "The StreamLinesGL processor requires OpenGL 4.3");
+    }
+
+    countShader_.getShaderObject(ShaderType::Compute)->addShaderDefine("WRITE_OUTPUT", "0");
+    countShader_.build();
+    traceShader_.getShaderObject(ShaderType::Compute)->addShaderDefine("WRITE_OUTPUT", "1");
+    traceShader_.build();
+}
+
+namespace {
+
+constexpr GLuint groupSize = 64;
+
+void bindStorage(GLuint binding, const BufferBase& buffer) {
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding,
+                     buffer.getRepresentation<BufferGL>()->getId());
+}
+
+}  // namespace
+
+void StreamLinesGL::process() {
+    const auto volume = volume_.getData();
+
+    std::vector<vec3> seedPoints;
+    for (const auto& seeds : seeds_) {
+        seedPoints.insert(seedPoints.end(), seeds->begin(), seeds->end());
+    }
+    if (seedPoints.size() > std::numeric_limits<std::uint32_t>::max() / groupSize) {
+        throw Exception(SourceContext{}, "Too many seed points: {}", seedPoints.size());
+    }
+    const auto numSeeds = static_cast<std::uint32_t>(seedPoints.size());
+
+    auto mesh = std::make_shared<Mesh>();
+    mesh->setModelMatrix(volume->getModelMatrix());
+    mesh->setWorldMatrix(volume->getWorldMatrix());
+    if (numSeeds == 0) {
+        mesh_.setData(mesh);
+        return;
+    }
+
+    const auto steps = properties_.getNumberOfSteps();
+    const auto [stepsBackward, stepsForward] = [&]() -> std::pair<int, int> {
+        switch (properties_.getStepDirection()) {
+            case IntegralLineProperties::Direction::Forward:
+                return {0, steps};
+            case IntegralLineProperties::Direction::Backward:
+                return {steps, 0};
+            default:
+            case IntegralLineProperties::Direction::Bidirectional:
+                return {steps / 2, steps - steps / 2};
+        }
+    }();
+
+    const Buffer<vec3> seeds{std::make_shared<BufferRAMPrecision<vec3>>(std::move(seedPoints))};
+    Buffer<uvec2> lines(numSeeds);
+
+    const auto& ct = volume->getCoordinateTransformer();
+    const auto setUniforms = [&](Shader& shader, TextureUnitContainer& cont) {
+        shader.activate();
+        utilgl::bindAndSetUniforms(shader, cont, *volume, "velocityField");
+        shader.setUniform("seedToData", properties_.getSeedPointTransformationMatrix(ct));
+        shader.setUniform("dataToTexture", ct.getDataToTextureMatrix());
+        shader.setUniform("invBasis", glm::inverse(mat3{volume->getModelMatrix()}));
+        shader.setUniform("numSeeds", numSeeds);
+        shader.setUniform("stepsBackward", stepsBackward);
+        shader.setUniform("stepsForward", stepsForward);
+        shader.setUniform("stepSize", properties_.getStepSize());
+        shader.setUniform("normalizeSamples", properties_.getNormalizeSamples());
+        // The adaptive scheme is not available on the GPU, it falls back to RK4
+        shader.setUniform("useRK4", properties_.getIntegrationScheme() !=
+                                        IntegralLineProperties::IntegrationScheme::Euler);
+    };
+    const auto numGroups = (numSeeds + groupSize - 1) / groupSize;
+
+    // Count the steps of each line
+    {
+        TextureUnitContainer cont;
+        setUniforms(countShader_, cont);
+        bindStorage(0, seeds);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1,
+                         lines.getEditableRepresentation<BufferGL>()->getId());
+        glDispatchCompute(numGroups, 1, 1);
+        glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+        countShader_.deactivate();
+    }
+
+    // Turn the counts into the first vertex and first index of each line
+    const auto& counts = lines.getRAMRepresentation()->getDataContainer();
+    std::vector<uvec2> offsetData(numSeeds);
+    std::size_t numVertices = 0;
+    std::size_t numIndices = 0;
+    for (std::size_t i = 0; i < numSeeds; ++i) {
+        offsetData[i] = uvec2{static_cast<std::uint32_t>(numVertices),
+                              static_cast<std::uint32_t>(numIndices)};
+        const std::size_t segments = counts[i].x + counts[i].y;
+        if (segments > 0) {
+            numVertices += segments + 1;
+            numIndices += 2 * segments;
+        }
+    }
+    if (numIndices > std::numeric_limits<std::uint32_t>::max()) {
+        throw Exception(SourceContext{}, "Too many line segments: {}", numIndices / 2);
+    }
+
+    auto positions = std::make_shared<Buffer<vec3>>(numVertices);
+    auto colors = std::make_shared<Buffer<vec4>>(numVertices);
+    auto speeds = std::make_shared<Buffer<float>>(numVertices);
+    auto indices = std::make_shared<IndexBuffer>(numIndices);
+
+    if (numVertices > 0) {
+        const Buffer<uvec2> offsets{
+            std::make_shared<BufferRAMPrecision<uvec2>>(std::move(offsetData))};
+
+        TextureUnitContainer cont;
+        setUniforms(traceShader_, cont);
+        utilgl::bindAndSetUniforms(traceShader_, cont, tf_);
+        traceShader_.setUniform("minV", minV_.get());
+        traceShader_.setUniform("maxV", maxV_.get());
+
+        bindStorage(0, seeds);
+        bindStorage(1, lines);
+        bindStorage(2, offsets);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3,
+                         positions->getEditableRepresentation<BufferGL>()->getId());
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4,
+                         colors->getEditableRepresentation<BufferGL>()->getId());
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5,
+                         speeds->getEditableRepresentation<BufferGL>()->getId());
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 6,
+                         indices->getEditableRepresentation<BufferGL>()->getId());
+        glDispatchCompute(numGroups, 1, 1);
+        glMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT |
+                        GL_BUFFER_UPDATE_BARRIER_BIT);
+        traceShader_.deactivate();
+    }
+
+    for (GLuint binding = 0; binding < 7; ++binding) {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+    }
+
+    mesh->addBuffer(BufferType::PositionAttrib, positions);
+    mesh->addBuffer(BufferType::ColorAttrib, colors);
+    mesh->addBuffer(BufferType::ScalarMetaAttrib, speeds);
+    mesh->addIndices(Mesh::MeshInfo{DrawType::Lines, ConnectivityType::None}, indices);
+    mesh_.setData(mesh);
+}
+
+}  // namespace inviwo
@@ -60,7 +60,6 @@
 #include <inviwo/core/util/staticstring.h>                              // for operator+
 #include <inviwo/core/util/stringconversion.h>                          // for toString
 #include <inviwo/core/util/timer.h>                                     // for Timer, Timer::Mil...
-#include <inviwo/core/util/zip.h>                                       // for get, zip, zipIter...
 #include <inviwo/core/util/filesystem.h>                                // for filesystem::getPath
 #include <modules/opengl/buffer/buffergl.h>                             // for BufferGL
 #include <modules/opengl/inviwoopengl.h>                                // for GL_SHADER_STORAGE...
@@ -77,11 +76,11 @@
 #include <algorithm>      // for transform, fill, min
 #include <cstddef>        // for size_t
 #include <limits>         // for numeric_limits
-#include <random>         // for mt19937, uniform_...
 #include <type_traits>    // for remove_extent_t
 #include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
 #include <utility>        // for pair
+#include <vector>         // for vector
 
 #include <glm/detail/qualifier.hpp>  // for tvec2
 #include <glm/mat4x4.hpp>            // for operator*, mat
@@ -101,8 +100,10 @@ const ProcessorInfo StreamParticles::processorInfo_{
     based on the __seeds__ inport and are advected through the field using the Velocity Volume on
     the __volume__ inport. If particles velocity has been zero for 0.5 seconds their position will
     be reset to a random element in the seedpoint input vector. Reseeding is done on a less frequent
-    intervall than the advection based on the __Reseed interval__ property. Using GLSL Compute
-    Shaders, requires OpenGL 4.3)"_unindentHelp};
+    intervall than the advection based on the __Reseed interval__ property. The particle state
+    lives on the GPU in double buffers sized by the __Particle Capacity__, advection and reseeding
+    are done in the same compute shader without any transfers to or from the CPU. Using GLSL
+    Compute Shaders, requires OpenGL 4.3)"_unindentHelp};
 
 const ProcessorInfo& StreamParticles::getProcessorInfo() const { return processorInfo_; }
 
@@ -156,28 +157,44 @@ StreamParticles::StreamParticles()
                           .set("Seconds between reseeding. When reseeding particles whose "
                                "life is zero will get new position by selecting (randomly) "
                                "from the input seed vector"_help)}
+    , capacity_{"capacity", "Particle Capacity",
+                util::ordinalCount<size_t>(0, 1'000'000)
+                    .set("Number of particles to simulate, 0 means one particle per seed "
+                         "point. The particle buffers only need to be reallocated when the "
+                         "capacity changes"_help)}
+    , respawnLimit_{"respawnLimit", "Respawn Limit",
+                    util::ordinalCount<size_t>(0, 1'000'000)
+                        .set("Max number of dead particles that get respawned at each "
+                             "reseed, 0 means no limit"_help)
+                        .set(InvalidationLevel::Valid)}
     , shader_{{{ShaderType::Compute, std::string{"streamparticles.comp"}}}, Shader::Build::No}
     , timer_{Timer::Milliseconds(17), [&]() { update(); }}
     , reseedtime_{0.0}
     , prevT_{0}
     , clock_{}
     , ready_{false}
-    , buffersDirty_{true} {
+    , buffersDirty_{true}
+    , seedsDirty_{true}
+    , initialize_{true}
+    , frame_{0}
+    , current_{0}
+    , bufCounter_{1, BufferUsage::Dynamic} {
 
     addPort(volume_);
     addPort(seeds_);
     addPort(meshPort_);
 
     addProperties(seedingSpace_, advectionSpeed_, internalSteps_, particleSize_, minV_, maxV_, tf_,
-                  reseedInterval_);
+                  reseedInterval_, capacity_, respawnLimit_);
 
     shader_.onReload([this]() {
         invalidate(InvalidationLevel::InvalidOutput);
         buffersDirty_ = true;
     });
 
-    seedingSpace_.onChange([this]() { buffersDirty_ = true; });
-    seeds_.onChange([this]() { buffersDirty_ = true; });
+    // New seeds only need a new seed buffer, the particles are respawned at them on the GPU
+    seedingSpace_.onChange([this]() { seedsDirty_ = true; });
+    seeds_.onChange([this]() { seedsDirty_ = true; });
 
     timer_.start();
 }
@@ -198,10 +215,17 @@ void StreamParticles::initializeResources() {
 }
 
 void StreamParticles::process() {
-    if (buffersDirty_) initBuffers();
-    reseed();
+    if (seedsDirty_) uploadSeeds();
+    if (bufSeeds_->getSize() == 0) {
+        meshPort_.setData(std::make_shared<Mesh>());
+        return;
+    }
+
+    const auto capacity = capacity_.get() > 0 ? capacity_.get() : bufSeeds_->getSize();
+    if (buffersDirty_ || !bufRad_ || bufRad_->getSize() != capacity) initParticles(capacity);
+
     advect();
-    meshPort_.setData(mesh_);
+    meshPort_.setData(meshes_[current_]);
     ready_ = true;
 }
 
@@ -217,21 +241,54 @@ void StreamParticles::update() {
     }
 }
 
-void StreamParticles::initBuffers() {
-    auto seeds = seeds_.getData();
-    auto numPoints = seeds->size();
+namespace {
+
+constexpr GLuint groupSize = 64;
+
+void bindStorage(GLuint binding, BufferBase& buffer) {
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding,
+                     buffer.getEditableRepresentation<BufferGL>()->getId());
+}
 
-    bufPos_ = std::make_shared<Buffer<vec4>>(numPoints, BufferUsage::Dynamic);
-    bufLife_ = std::make_shared<Buffer<float>>(numPoints, BufferUsage::Dynamic);
-    bufRad_ = std::make_shared<Buffer<float>>(numPoints, BufferUsage::Dynamic);
-    bufCol_ = std::make_shared<Buffer<vec4>>(numPoints, BufferUsage::Dynamic);
+}  // namespace
 
-    std::mt19937 rand;
-    std::uniform_real_distribution<float> dist(0, 1);
+void StreamParticles::initParticles(size_t capacity) {
+    if (capacity > std::numeric_limits<std::uint32_t>::max() - groupSize) {
+        throw Exception(SourceContext{}, "Too many particles: {}", capacity);
+    }
 
-    auto& positions = bufPos_->getEditableRAMRepresentation()->getDataContainer();
-    auto& lifes = bufLife_->getEditableRAMRepresentation()->getDataContainer();
+    // No data is uploaded, the first dispatch spawns all particles on the GPU
+    for (size_t i = 0; i < 2; ++i) {
+        bufPos_[i] = std::make_shared<Buffer<vec4>>(capacity, BufferUsage::Dynamic);
+        bufLife_[i] = std::make_shared<Buffer<float>>(capacity, BufferUsage::Dynamic);
+        bufPos_[i]->getEditableRepresentation<BufferGL>();
+        bufLife_[i]->getEditableRepresentation<BufferGL>();
+    }
+    bufRad_ = std::make_shared<Buffer<float>>(capacity, BufferUsage::Dynamic);
+    bufCol_ = std::make_shared<Buffer<vec4>>(capacity, BufferUsage::Dynamic);
+    bufRad_->getEditableRepresentation<BufferGL>();
+    bufCol_->getEditableRepresentation<BufferGL>();
 
+    for (size_t i = 0; i < 2; ++i) {
+        meshes_[i] = std::make_shared<Mesh>();
+        meshes_[i]->addBuffer(BufferType::PositionAttrib, bufPos_[i]);
+        meshes_[i]->addBuffer(BufferType::RadiiAttrib, bufRad_);
+        meshes_[i]->addBuffer(BufferType::ColorAttrib, bufCol_);
+    }
+
+    current_ = 0;
+    initialize_ = true;
+    prevT_ = reseedtime_ = clock_.getElapsedSeconds();
+    buffersDirty_ = false;
+}
+
+void StreamParticles::uploadSeeds() {
+    const auto seeds = seeds_.getData();
+    if (seeds->size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw Exception(SourceContext{}, "Too many seed points: {}", seeds->size());
+    }
+
+    std::vector<vec4> positions(seeds->size());
     if (seedingSpace_.get() == SeedingSpace::World) {
         std::transform(seeds->begin(), seeds->end(), positions.begin(),
                        [](vec3 seed) { return vec4(seed, 1.0f); });
@@ -245,54 +302,12 @@ void StreamParticles::initBuffers() {
             });
     }
 
-    std::fill(lifes.begin(), lifes.end(), 1.0f);
-
-    bufPos_->getEditableRepresentation<BufferGL>();
-    bufLife_->getEditableRepresentation<BufferGL>();
-    bufRad_->getEditableRepresentation<BufferGL>();
-    bufCol_->getEditableRepresentation<BufferGL>();
-
-    mesh_ = std::make_shared<Mesh>();
-    mesh_->addBuffer(BufferType::PositionAttrib, bufPos_);
-    mesh_->addBuffer(BufferType::RadiiAttrib, bufRad_);
-    mesh_->addBuffer(BufferType::ColorAttrib, bufCol_);
-
-    prevT_ = reseedtime_ = clock_.getElapsedSeconds();
-    buffersDirty_ = false;
-}
-
-void StreamParticles::reseed() {
-    auto curT = clock_.getElapsedSeconds();
-    if (curT >= reseedtime_ + reseedInterval_.get()) {
-        auto seeds = seeds_.getData();
-
-        auto& positions = bufPos_->getEditableRAMRepresentation()->getDataContainer();
-        auto& lifes = bufLife_->getEditableRAMRepresentation()->getDataContainer();
-
-        std::mt19937 rand;
-        std::uniform_int_distribution<size_t> dist(0, seeds->size());
-
-        auto seedTransform =
-            [space = seedingSpace_.get(),
-             toWorld = volume_.getData()->getCoordinateTransformer().getDataToWorldMatrix()](
-                vec3 seed) -> vec4 {
-            if (space == SeedingSpace::World) {
-                return vec4(seed, 1.0f);
-            } else {
-                vec4 p = toWorld * vec4(seed, 1.0f);
-                return p / p.w;
-            }
-        };
-
-        for (auto z : util::zip(positions, lifes)) {
-            if (get<1>(z) <= 0) {
-                get<0>(z) = seedTransform((*seeds)[dist(rand)]);
-                get<1>(z) = 1.0f;
-            }
-        }
-
-        reseedtime_ = curT;
-    }
+    bufSeeds_ = std::make_shared<Buffer<vec4>>(
+        std::make_shared<BufferRAMPrecision<vec4>>(std::move(positions)));
+    bufSeeds_->getRepresentation<BufferGL>();
+    seedsDirty_ = false;
+    // Respawn all particles at the new seeds, the particle buffers are kept if the size matches
+    initialize_ = true;
 }
 
 void StreamParticles::advect() {
@@ -302,12 +317,12 @@ void StreamParticles::advect() {
     const auto dt = t - prevT_;
     prevT_ = t;
 
-    auto volume = volume_.getData();
+    const bool respawn = t >= reseedtime_ + reseedInterval_.get();
+    if (respawn) reseedtime_ = t;
 
-    auto bufPosGL = bufPos_->getEditableRepresentation<BufferGL>();
-    auto bufLifeGL = bufLife_->getEditableRepresentation<BufferGL>();
-    auto bufRadGL = bufRad_->getEditableRepresentation<BufferGL>();
-    auto bufColGL = bufCol_->getEditableRepresentation<BufferGL>();
+    auto volume = volume_.getData();
+    const auto numParticles = static_cast<std::uint32_t>(bufRad_->getSize());
+    const auto next = 1 - current_;
 
     shader_.activate();
 
@@ -321,23 +336,45 @@ void StreamParticles::advect() {
     shader_.setUniform("toTextureMatrix",
                        volume->getCoordinateTransformer().getWorldToTextureMatrix());
 
+    shader_.setUniform("numParticles", numParticles);
+    shader_.setUniform("numSeeds", static_cast<std::uint32_t>(bufSeeds_->getSize()));
+    shader_.setUniform("frame", frame_++);
+    shader_.setUniform("initialize", initialize_);
+    shader_.setUniform("respawn", respawn);
+    shader_.setUniform("respawnLimit", static_cast<std::uint32_t>(respawnLimit_.get()));
+
     utilgl::bindAndSetUniforms(shader_, cont, *volume, "velocityField");
 
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, bufPosGL->getId());
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, bufLifeGL->getId());
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, bufRadGL->getId());
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, bufColGL->getId());
+    if (respawn && respawnLimit_.get() > 0) {
+        const GLuint zero = 0;
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER,
+                     bufCounter_.getEditableRepresentation<BufferGL>()->getId());
+        glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT,
+                          &zero);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    }
+
+    bindStorage(0, *bufPos_[current_]);
+    bindStorage(1, *bufLife_[current_]);
+    bindStorage(2, *bufPos_[next]);
+    bindStorage(3, *bufLife_[next]);
+    bindStorage(4, *bufRad_);
+    bindStorage(5, *bufCol_);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 6,
+                     bufSeeds_->getRepresentation<BufferGL>()->getId());
+    bindStorage(7, bufCounter_);
 
-    glDispatchCompute(static_cast<GLuint>(seeds_.getData()->size()), 1, 1);
-    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
-    glMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+    glDispatchCompute((numParticles + groupSize - 1) / groupSize, 1, 1);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
 
     shader_.deactivate();
 
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, 0);
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, 0);
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, 0);
+    for (GLuint binding = 0; binding < 8; ++binding) {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+    }
+
+    current_ = next;
+    initialize_ = false;
 }
 
 }  // namespace inviwo
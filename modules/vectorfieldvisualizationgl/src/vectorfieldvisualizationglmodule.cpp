@@ -40,6 +40,7 @@
 #include <modules/vectorfieldvisualizationgl/processors/2d/vector2ddivergence.h>
 #include <modules/vectorfieldvisualizationgl/processors/2d/vector2dmagnitude.h>
 #include <modules/vectorfieldvisualizationgl/processors/3d/lic3d.h>
+#include <modules/vectorfieldvisualizationgl/processors/3d/streamlinesgl.h>
 #include <modules/vectorfieldvisualizationgl/processors/3d/streamparticles.h>
 #include <modules/vectorfieldvisualizationgl/processors/3d/vector3dcurl.h>
 #include <modules/vectorfieldvisualizationgl/processors/3d/vector3ddivergence.h>
@@ -78,6 +79,7 @@ VectorFieldVisualizationGLModule::VectorFieldVisualizationGLModule(InviwoApplica
     registerProcessor<TMIP>();
     registerProcessor<VectorFieldGenerator4D>();
 
+    registerProcessor<StreamLinesGL>();
     registerProcessor<StreamParticles>();
 }
 
@@ -0,0 +1,76 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/volume/volumemoduledefine.h>  // for IVW_MODULE_VOLUME_API
+
+#include <inviwo/core/util/glmvec.h>  // for dvec2, size3_t
+
+#include <cstdint>  // for uint8_t
+#include <memory>   // for shared_ptr
+
+namespace inviwo {
+
+class Volume;
+
+namespace util {
+
+/**
+ * The neighborhood of a voxel used for connected component labeling
+ */
+enum class Connectivity : std::uint8_t {
+    Face,    ///< 6 neighbors sharing a face
+    Edge,    ///< 18 neighbors sharing a face or an edge
+    Corner,  ///< 26 neighbors sharing a face, an edge, or a corner
+};
+
+/**
+ * Label the connected components of the voxels of @p volume for which the first channel is in the
+ * closed interval @p range. The volume is split into bricks that are labeled in parallel on the
+ * thread pool using a union-find in the label volume itself, after which the bricks are merged
+ * across their faces with a lock-free union-find (AtomicDisjointSets).
+ *
+ * The result is an unsigned 32-bit volume where background voxels are 0 and the components are
+ * labeled 1 to N without gaps in the order of their first voxel. The data range is set to [0, N],
+ * which makes it usable as atlas in VolumeRegionStatistics and VolumeRegionNeighbor.
+ *
+ * @param volume       the volume to label
+ * @param range        voxels with a value in [range.x, range.y] are foreground
+ * @param connectivity which neighbors that are considered connected
+ * @param brickSize    size of the bricks processed in parallel
+ * @throw Exception if the volume has 2^31 voxels or more
+ */
+IVW_MODULE_VOLUME_API std::shared_ptr<Volume> connectedComponents(
+    const Volume& volume, dvec2 range, Connectivity connectivity = Connectivity::Face,
+    size3_t brickSize = size3_t{64});
+
+}  // namespace util
+
+}  // namespace inviwo
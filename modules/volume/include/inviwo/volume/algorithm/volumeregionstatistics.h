@@ -0,0 +1,65 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/volume/volumemoduledefine.h>  // for IVW_MODULE_VOLUME_API
+
+#include <inviwo/core/datastructures/coordinatetransformer.h>  // for CoordinateSpace
+
+#include <memory>  // for shared_ptr
+
+namespace inviwo {
+
+class Volume;
+class DataFrame;
+
+namespace util {
+
+/**
+ * Calculate statistics for each region of @p atlas, see VolumeRegionStatistics for the list of
+ * columns. The voxels are split in slabs along z that are processed in parallel on the thread
+ * pool, each with its own dense per region accumulators that are merged at the end.
+ * @param volume  values to calculate the statistics of
+ * @param atlas   unsigned integer volume assigning a region to each voxel of @p volume. The region
+ *                indices are assumed to be in [0, dataMap.dataRange.y] and without gaps.
+ * @param space   coordinate space of the positional statistics
+ * @param moments also calculate the bounding box and the covariance of the voxel positions of
+ *                each region
+ * @throw Exception if the dimensions of @p volume and @p atlas differ, if @p atlas is not of
+ *                  an unsigned integer type, or if a region is empty or out of range
+ */
+IVW_MODULE_VOLUME_API std::shared_ptr<DataFrame> volumeRegionStatistics(const Volume& volume,
+                                                                        const Volume& atlas,
+                                                                        CoordinateSpace space,
+                                                                        bool moments = false);
+
+}  // namespace util
+
+}  // namespace inviwo
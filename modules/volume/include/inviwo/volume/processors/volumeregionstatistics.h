@@ -35,6 +35,7 @@
 #include <inviwo/core/ports/volumeport.h>                      // for VolumeInport
 #include <inviwo/core/processors/poolprocessor.h>              // for PoolProcessor
 #include <inviwo/core/processors/processorinfo.h>              // for ProcessorInfo
+#include <inviwo/core/properties/boolproperty.h>               // for BoolProperty
 #include <inviwo/core/properties/optionproperty.h>             // for OptionProperty
 #include <inviwo/core/util/staticstring.h>                     // for operator+
 #include <inviwo/dataframe/datastructures/dataframe.h>         // for DataFrameOutport
@@ -62,6 +63,7 @@ private:
     DataFrameOutport dataFrame_;
 
     OptionProperty<CoordinateSpace> space_;
+    BoolProperty moments_;
 };
 
 }  // namespace inviwo
@@ -0,0 +1,238 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/volume/algorithm/connectedcomponents.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/glm.h>
+#include <inviwo/core/util/glmcomp.h>
+#include <inviwo/core/util/parallel.h>
+#include <modules/base/datastructures/atomicdisjointsets.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+using Label = std::uint32_t;
+constexpr Label background = std::numeric_limits<Label>::max();
+constexpr Label finalBit = Label{1} << 31;
+
+/**
+ * The offsets to the neighbors that precede a voxel in memory order, every pair of neighbors is
+ * hence visited exactly once.
+ */
+std::vector<glm::i64vec3> precedingNeighbors(util::Connectivity connectivity) {
+    const int maxNonZero = connectivity == util::Connectivity::Face   ? 1
+                           : connectivity == util::Connectivity::Edge ? 2
+                                                                      : 3;
+    std::vector<glm::i64vec3> offsets;
+    for (std::int64_t z = -1; z <= 0; ++z) {
+        for (std::int64_t y = -1; y <= 1; ++y) {
+            for (std::int64_t x = -1; x <= 1; ++x) {
+                const glm::i64vec3 offset{x, y, z};
+                const bool preceding = z < 0 || (z == 0 && (y < 0 || (y == 0 && x < 0)));
+                const auto nonZero =
+                    static_cast<int>(x != 0) + static_cast<int>(y != 0) + static_cast<int>(z != 0);
+                if (preceding && nonZero <= maxNonZero) offsets.push_back(offset);
+            }
+        }
+    }
+    return offsets;
+}
+
+struct Brick {
+    glm::i64vec3 begin;
+    glm::i64vec3 end;
+
+    bool contains(const glm::i64vec3& pos) const {
+        return glm::all(glm::greaterThanEqual(pos, begin)) && glm::all(glm::lessThan(pos, end));
+    }
+};
+
+}  // namespace
+
+std::shared_ptr<Volume> util::connectedComponents(const Volume& volume, dvec2 range,
+                                                  Connectivity connectivity, size3_t brickSize) {
+    const glm::i64vec3 dims{volume.getDimensions()};
+    const auto size = static_cast<size_t>(dims.x * dims.y * dims.z);
+    if (size >= finalBit) {
+        throw Exception(SourceContext{}, "Volume too large for labeling, got {} voxels max {}",
+                        size, finalBit - 1);
+    }
+
+    auto labelsRam = std::make_shared<VolumeRAMPrecision<Label>>(volume.getDimensions());
+    const std::span<Label> labels = labelsRam->getView();
+    AtomicDisjointSets<Label> sets{labels};
+
+    // Labels of other bricks are read while they are being updated, hence the atomic accesses.
+    const auto load = [&](size_t i) {
+        return std::atomic_ref<Label>{labels[i]}.load(std::memory_order_relaxed);
+    };
+    const auto store = [&](size_t i, Label label) {
+        std::atomic_ref<Label>{labels[i]}.store(label, std::memory_order_relaxed);
+    };
+
+    const auto offsets = precedingNeighbors(connectivity);
+    const auto index = [&](const glm::i64vec3& pos) {
+        return static_cast<Label>(pos.x + dims.x * (pos.y + dims.y * pos.z));
+    };
+    const auto inside = [&](const glm::i64vec3& pos) {
+        return glm::all(glm::greaterThanEqual(pos, glm::i64vec3{0})) &&
+               glm::all(glm::lessThan(pos, dims));
+    };
+
+    const glm::i64vec3 brickDims{glm::max(brickSize, size3_t{1})};
+    const auto bricksPerDim = (dims + brickDims - glm::i64vec3{1}) / brickDims;
+    const auto brickCount = static_cast<size_t>(bricksPerDim.x * bricksPerDim.y * bricksPerDim.z);
+    const auto brick = [&](size_t i) {
+        const auto b = static_cast<std::int64_t>(i);
+        const glm::i64vec3 pos{b % bricksPerDim.x, (b / bricksPerDim.x) % bricksPerDim.y,
+                               b / (bricksPerDim.x * bricksPerDim.y)};
+        return Brick{pos * brickDims, glm::min((pos + glm::i64vec3{1}) * brickDims, dims)};
+    };
+
+    // Threshold and label each brick independently. Neighbors preceding a voxel within the same
+    // brick have already been visited, and no other brick touches these labels.
+    volume.getRepresentation<VolumeRAM>()->dispatch<void>([&](const auto* ram) {
+        const auto data = ram->getView();
+        util::parallelFor(0, brickCount, [&](size_t i) {
+            const auto b = brick(i);
+            glm::i64vec3 pos;
+            for (pos.z = b.begin.z; pos.z < b.end.z; ++pos.z) {
+                for (pos.y = b.begin.y; pos.y < b.end.y; ++pos.y) {
+                    for (pos.x = b.begin.x; pos.x < b.end.x; ++pos.x) {
+                        const auto v = index(pos);
+                        const auto value = static_cast<double>(util::glmcomp(data[v], 0));
+                        if (value < range.x || value > range.y) {
+                            labels[v] = background;
+                            continue;
+                        }
+                        sets.makeSet(v);
+                        for (const auto& offset : offsets) {
+                            const auto n = pos + offset;
+                            if (b.contains(n) && labels[index(n)] != background) {
+                                sets.join(v, index(n));
+                            }
+                        }
+                    }
+                }
+            }
+        }, {.grainSize = 1});
+    });
+
+    // Merge the bricks along their faces, only voxels on the brick boundary can have neighbors
+    // in other bricks.
+    util::parallelFor(0, brickCount, [&](size_t i) {
+        const auto b = brick(i);
+        const auto last = b.end - glm::i64vec3{1};
+        glm::i64vec3 pos;
+        for (pos.z = b.begin.z; pos.z < b.end.z; ++pos.z) {
+            for (pos.y = b.begin.y; pos.y < b.end.y; ++pos.y) {
+                const bool interiorRow =
+                    pos.z != b.begin.z && pos.z != last.z && pos.y != b.begin.y && pos.y != last.y;
+                const auto step = interiorRow ? std::max<std::int64_t>(last.x - b.begin.x, 1) : 1;
+                for (pos.x = b.begin.x; pos.x < b.end.x; pos.x += step) {
+                    const auto v = index(pos);
+                    if (labels[v] == background) continue;
+                    for (const auto& offset : offsets) {
+                        const auto n = pos + offset;
+                        if (!b.contains(n) && inside(n) && load(index(n)) != background) {
+                            sets.join(v, index(n));
+                        }
+                    }
+                }
+            }
+        }
+    }, {.grainSize = 1});
+
+    // Assign consecutive labels to the roots, in memory order. Since a root is the smallest
+    // index of its set, the labels are ordered by the first voxel of each component.
+    const size_t chunkSize = std::max<size_t>(dims.x * dims.y, 1 << 16);
+    const size_t chunks = (size + chunkSize - 1) / chunkSize;
+    std::vector<Label> roots(chunks, 0);
+    util::parallelFor(0, chunks, [&](size_t chunk) {
+        const auto end = std::min(size, (chunk + 1) * chunkSize);
+        for (size_t v = chunk * chunkSize; v < end; ++v) {
+            if (labels[v] != background && sets.isRoot(static_cast<Label>(v))) ++roots[chunk];
+        }
+    });
+    std::vector<Label> firstLabel(chunks, 0);
+    std::exclusive_scan(roots.begin(), roots.end(), firstLabel.begin(), Label{1});
+    const auto components = std::accumulate(roots.begin(), roots.end(), Label{0});
+
+    util::parallelFor(0, chunks, [&](size_t chunk) {
+        const auto end = std::min(size, (chunk + 1) * chunkSize);
+        auto label = firstLabel[chunk];
+        for (size_t v = chunk * chunkSize; v < end; ++v) {
+            if (labels[v] != background && sets.isRoot(static_cast<Label>(v))) {
+                labels[v] = finalBit | label++;
+            }
+        }
+    });
+    // All roots now hold their final label, every other voxel points directly or indirectly to
+    // a root with a smaller index. Parents from earlier chunks might be resolved concurrently,
+    // they will then already hold the final label which is just as good.
+    util::parallelFor(0, chunks, [&](size_t chunk) {
+        const auto end = std::min(size, (chunk + 1) * chunkSize);
+        for (size_t v = chunk * chunkSize; v < end; ++v) {
+            auto p = labels[v];
+            if (p & finalBit) continue;
+            while (!(load(p) & finalBit)) p = load(p);
+            store(v, load(p));
+        }
+    });
+    util::parallelFor(0, size, [&](size_t first, size_t last) {
+        for (size_t v = first; v < last; ++v) {
+            labels[v] = labels[v] == background ? 0 : labels[v] & ~finalBit;
+        }
+    });
+
+    auto result = std::make_shared<Volume>(
+        volume, noData,
+        VolumeConfig{.format = DataUInt32::get(),
+                     .interpolation = InterpolationType::Nearest,
+                     .valueAxis = Axis{"Component", Unit{}},
+                     .dataRange = dvec2{0.0, static_cast<double>(components)},
+                     .valueRange = dvec2{0.0, static_cast<double>(components)}});
+    result->addRepresentation(labelsRam);
+    return result;
+}
+
+}  // namespace inviwo
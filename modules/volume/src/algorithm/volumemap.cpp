@@ -31,14 +31,94 @@
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/parallel.h>
 #include <inviwo/core/util/zip.h>
 
 #include <algorithm>
-#include <unordered_map>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
 #include <unordered_set>
+#include <utility>
+
+#include <glm/gtx/component_wise.hpp>
 
 namespace inviwo::util {
 
+namespace {
+
+// A dense table is used when the source labels cover at least 1 / maxDenseSparsity of their
+// range, or when the range is smaller than minDenseSize, otherwise we search a sorted table
+constexpr size_t maxDenseSparsity = 8;
+constexpr size_t minDenseSize = size_t{1} << 16;
+constexpr size_t remapGrainSize = size_t{1} << 16;
+
+#include <warn/push>
+#include <warn/ignore/conversion>
+
+// Map the voxels through a table covering the values [lo, hi], src values outside of the table are
+// ignored since they can not be found in the volume
+template <typename T>
+void remapDense(std::span<T> data, const std::vector<int>& src, const std::vector<int>& dst,
+                std::int64_t lo, std::int64_t hi, int missingValue, bool useMissingValue) {
+    std::vector<T> table(static_cast<size_t>(hi - lo + 1));
+    for (size_t i = 0; i < table.size(); ++i) {
+        const auto value = lo + static_cast<std::int64_t>(i);
+        table[i] = static_cast<T>(useMissingValue ? missingValue : value);
+    }
+    for (auto&& [s, d] : util::zip(src, dst)) {
+        if (s >= lo && s <= hi) table[static_cast<size_t>(s - lo)] = static_cast<T>(d);
+    }
+
+    const auto* lut = table.data();
+    const auto size = static_cast<std::uint64_t>(table.size());
+    const auto missing = static_cast<T>(missingValue);
+    util::parallelFor(
+        0, data.size(),
+        [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                const T v = data[i];
+                const auto index =
+                    static_cast<std::uint64_t>(static_cast<std::int64_t>(static_cast<int>(v)) - lo);
+                const bool inside = index < size;
+                const T mapped = lut[inside ? index : 0];
+                data[i] = inside ? mapped : (useMissingValue ? missing : v);
+            }
+        },
+        {.grainSize = remapGrainSize});
+}
+
+// Binary search for each voxel in a table sorted by the source value
+template <typename T>
+void remapSparse(std::span<T> data, const std::vector<int>& src, const std::vector<int>& dst,
+                 int missingValue, bool useMissingValue) {
+    std::vector<std::pair<int, int>> table;
+    table.reserve(src.size());
+    for (auto&& [s, d] : util::zip(src, dst)) table.emplace_back(s, d);
+    std::ranges::sort(table, std::less<>{}, &std::pair<int, int>::first);
+
+    util::parallelFor(
+        0, data.size(),
+        [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                const auto v = static_cast<int>(data[i]);
+                const auto it = std::ranges::lower_bound(table, v, std::less<>{},
+                                                         &std::pair<int, int>::first);
+                if (it != table.end() && it->first == v) {
+                    data[i] = static_cast<T>(it->second);
+                } else if (useMissingValue) {
+                    data[i] = static_cast<T>(missingValue);
+                }
+            }
+        },
+        {.grainSize = remapGrainSize});
+}
+
+#include <warn/pop>
+
+}  // namespace
+
 void remap(Volume& volume, const std::vector<int>& src, const std::vector<int>& dst,
            int missingValue, bool useMissingValue) {
 
@@ -55,63 +135,28 @@ void remap(Volume& volume, const std::vector<int>& src, const std::vector<int>&
                         src.size() - set.size());
     }
 
+    const auto [srcMin, srcMax] = std::minmax_element(src.begin(), src.end());
+    const auto srcRange = static_cast<size_t>(static_cast<std::int64_t>(*srcMax) - *srcMin + 1);
+
     auto volRep = volume.getEditableRepresentation<VolumeRAM>();
+    volRep->dispatch<void, dispatching::filter::Scalars>([&]<typename T>(
+                                                             VolumeRAMPrecision<T>* ram) {
+        const std::span<T> data{ram->getDataTyped(), glm::compMul(ram->getDimensions())};
 
-#include <warn/push>
-#include <warn/ignore/conversion>
-    volRep->dispatch<void, dispatching::filter::Scalars>([&](auto volram) {
-        using ValueType = util::PrecisionValueType<decltype(volram)>;
-        ValueType* dataPtr = volram->getDataTyped();
-        const auto& dim = volram->getDimensions();
-
-        // Check state of dataframe
-        bool sorted = std::is_sorted(src.begin(), src.end());
-
-        if (sorted && (src.back() - src.front()) ==
-                          static_cast<int>(src.size()) - 1) {  // Sorted + continuous
-            const int first = src.front();
-            const int last = src.back();
-            std::transform(dataPtr, dataPtr + glm::compMul(dim), dataPtr, [&](const ValueType& v) {
-                // Voxel value is inside src range
-                if (static_cast<int>(v) >= first && static_cast<int>(v) <= last) {
-                    const int index = static_cast<int>(v) - first;
-                    return static_cast<ValueType>(dst[index]);
-                } else if (useMissingValue) {
-                    return static_cast<ValueType>(missingValue);
-                } else {
-                    return v;
-                }
-            });
-        } else if (sorted) {  // Sorted + non continuous
-            std::transform(dataPtr, dataPtr + glm::compMul(dim), dataPtr, [&](const ValueType& v) {
-                if (auto it = std::lower_bound(src.begin(), src.end(), static_cast<int>(v));
-                    it != src.end()) {
-                    const auto index = std::distance(src.begin(), it);
-                    return static_cast<ValueType>(dst[index]);
-                } else if (useMissingValue) {
-                    return static_cast<ValueType>(missingValue);
-                } else {
-                    return v;
-                }
-            });
-        } else {
-            std::unordered_map<int, int> unorderedIndexMap;
-            for (auto&& [srcIdx, dstIdx] : util::zip(src, dst)) {
-                unorderedIndexMap[srcIdx] = dstIdx;
+        if constexpr (std::is_integral_v<T> && sizeof(T) <= 2) {
+            // The table covers all values of the type
+            remapDense(data, src, dst, std::numeric_limits<T>::min(),
+                       std::numeric_limits<T>::max(), missingValue, useMissingValue);
+        } else if constexpr (std::is_integral_v<T> && sizeof(T) <= 4) {
+            if (srcRange <= std::max(minDenseSize, maxDenseSparsity * src.size())) {
+                remapDense(data, src, dst, *srcMin, *srcMax, missingValue, useMissingValue);
+            } else {
+                remapSparse(data, src, dst, missingValue, useMissingValue);
             }
-            std::transform(dataPtr, dataPtr + glm::compMul(dim), dataPtr, [&](const ValueType& v) {
-                if (auto it = unorderedIndexMap.find(static_cast<int>(v));
-                    it != unorderedIndexMap.end()) {
-                    return static_cast<ValueType>(it->second);
-                } else if (useMissingValue) {
-                    return static_cast<ValueType>(missingValue);
-                } else {
-                    return v;
-                }
-            });
+        } else {
+            remapSparse(data, src, dst, missingValue, useMissingValue);
         }
     });
-#include <warn/pop>
 }
 
 }  // namespace inviwo::util
@@ -0,0 +1,547 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/volume/algorithm/volumeregionstatistics.h>
+
+#include <inviwo/core/datastructures/unitsystem.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/assertion.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/glm.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/parallel.h>
+#include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/zip.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+
+#include <algorithm>
+#include <numbers>
+#include <numeric>
+#include <span>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include <glm/matrix.hpp>
+
+namespace inviwo {
+
+namespace {
+
+auto addColumns(DataFrame& df, std::string_view name, size_t size, Unit unit,
+                std::optional<dvec2> range) {
+    auto* data = &df.addColumn<double>(name, size, unit, range)
+                      ->getTypedBuffer()
+                      ->getEditableRAMRepresentation()
+                      ->getDataContainer();
+    return data;
+}
+
+auto addColumns(DataFrame& df, size_t extent, std::string_view name, size_t size,
+                std::span<const Unit> units, std::span<const std::optional<dvec2>> ranges,
+                std::span<const std::string_view> labels) {
+    IVW_ASSERT(units.size() >= extent, "Size missmatch");
+    IVW_ASSERT(ranges.size() >= extent, "Size missmatch");
+    IVW_ASSERT(labels.size() >= extent, "Size missmatch");
+
+    return util::table(
+        [&](auto index) {
+            const auto fullName = fmt::format("{} {}", name, labels[index]);
+            auto* data = &df.addColumn<double>(fullName, size, units[index], ranges[index])
+                              ->getTypedBuffer()
+                              ->getEditableRAMRepresentation()
+                              ->getDataContainer();
+            return data;
+        },
+        0, static_cast<int>(extent));
+}
+
+auto addColumns(DataFrame& df, size_t extent, size_t comps, std::string_view name, size_t size,
+                std::span<const Unit> units, std::span<const std::optional<dvec2>> ranges,
+                std::span<const std::string_view> majorLabels,
+                std::span<const std::string_view> minorLabels) {
+
+    IVW_ASSERT(units.size() >= comps, "Size missmatch");
+    IVW_ASSERT(ranges.size() >= comps, "Size missmatch");
+    IVW_ASSERT(majorLabels.size() >= extent, "Size missmatch");
+    IVW_ASSERT(minorLabels.size() >= comps, "Size missmatch");
+
+    return util::table(
+        [&](auto index) {
+            return util::table(
+                [&](auto comp) {
+                    const auto fullName =
+                        fmt::format("{} {} {}", name, majorLabels[index], minorLabels[comp]);
+                    auto* data = &df.addColumn<double>(fullName, size, units[comp], ranges[comp])
+                                      ->getTypedBuffer()
+                                      ->getEditableRAMRepresentation()
+                                      ->getDataContainer();
+                    return data;
+                },
+                0, static_cast<int>(comps));
+        },
+        0, static_cast<int>(extent));
+}
+
+/**
+ * Accumulators to calculate "center of mass" for periodic and non periodic systems
+ * See https://en.wikipedia.org/wiki/Center_of_mass (Systems with periodic boundary conditions)
+ */
+template <Wrapping wrapX, Wrapping wrapY, Wrapping wrapZ>
+class Accumulator {
+public:
+    Accumulator(dvec3 dim) : dim{dim} {}
+
+    void add(const dvec3& pos, double weight) {
+        addComp<0, wrapX>(pos[0], weight);
+        addComp<1, wrapY>(pos[1], weight);
+        addComp<2, wrapZ>(pos[2], weight);
+    }
+    dvec3 get(double totalWeight) const {
+        return dvec3(getComp<0, wrapX>(totalWeight), getComp<1, wrapY>(totalWeight),
+                     getComp<2, wrapZ>(totalWeight));
+    }
+    void merge(const Accumulator& other) {
+        mergeComp<0, wrapX>(other);
+        mergeComp<1, wrapY>(other);
+        mergeComp<2, wrapZ>(other);
+    }
+
+private:
+    template <size_t N, Wrapping wrap>
+    void addComp(double pos, double weight) {
+        auto& acc = std::get<N>(vec);
+        if constexpr (wrap == Wrapping::Repeat) {
+            const auto theta = pos / dim[N] * 2.0 * std::numbers::pi;
+            acc.first += weight * std::cos(theta);
+            acc.second += weight * std::sin(theta);
+        } else {
+            acc += weight * pos;
+        }
+    }
+
+    template <size_t N, Wrapping wrap>
+    void mergeComp(const Accumulator& other) {
+        auto& acc = std::get<N>(vec);
+        const auto& rhs = std::get<N>(other.vec);
+        if constexpr (wrap == Wrapping::Repeat) {
+            acc.first += rhs.first;
+            acc.second += rhs.second;
+        } else {
+            acc += rhs;
+        }
+    }
+
+    template <size_t N, Wrapping wrap>
+    double getComp(double totalWeight) const {
+        auto& acc = std::get<N>(vec);
+        if constexpr (wrap == Wrapping::Repeat) {
+            const auto theta = std::atan2(-acc.second, -acc.first) + std::numbers::pi;
+            return dim[N] * theta / (2.0 * std::numbers::pi);
+        } else {
+            return acc / totalWeight;
+        }
+    }
+    template <Wrapping wrapping>
+    using Acc = std::conditional_t<wrapping == Wrapping::Repeat, std::pair<double, double>, double>;
+    std::tuple<Acc<wrapX>, Acc<wrapY>, Acc<wrapZ>> vec{};
+
+    dvec3 dim{1.0};
+};
+
+template <typename T, Wrapping wrapX, Wrapping wrapY, Wrapping wrapZ>
+class Stats {
+public:
+    Stats(dvec3 dim) : center{dim}, centerOfMass{dim} {}
+    void add(const dvec3& r, T val) {
+        ++volume;
+        center.add(r, 1.0);
+        centerOfMass.add(r, val);
+        mass += val;
+        min = glm::min(min, val);
+        max = glm::max(max, val);
+    }
+    void merge(const Stats& other) {
+        volume += other.volume;
+        center.merge(other.center);
+        centerOfMass.merge(other.centerOfMass);
+        mass += other.mass;
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+
+    double getVolume() const { return volume; }
+    double getMass() const { return mass; }
+    double getMean() const { return mass / volume; }
+    T getMin() const { return min; }
+    T getMax() const { return max; }
+    dvec3 getCenter() const { return center.get(volume); }
+    dvec3 getCenterOfMass() const { return centerOfMass.get(mass); }
+
+private:
+    double volume{};
+    double mass{};
+    T min{std::numeric_limits<T>::max()};
+    T max{std::numeric_limits<T>::lowest()};
+    Accumulator<wrapX, wrapY, wrapZ> center;
+    Accumulator<wrapX, wrapY, wrapZ> centerOfMass;
+};
+
+/**
+ * Bounding box and covariance of the voxel positions of a region, in index coordinates
+ */
+class Moments {
+public:
+    void add(const dvec3& pos) {
+        ++count;
+        sum += pos;
+        sum2 += glm::outerProduct(pos, pos);
+        lower = glm::min(lower, pos);
+        upper = glm::max(upper, pos);
+    }
+    void merge(const Moments& other) {
+        count += other.count;
+        sum += other.sum;
+        sum2 += other.sum2;
+        lower = glm::min(lower, other.lower);
+        upper = glm::max(upper, other.upper);
+    }
+
+    dvec3 getLower() const { return lower; }
+    dvec3 getUpper() const { return upper; }
+    dmat3 getCovariance() const {
+        const auto mean = sum / count;
+        return sum2 / count - glm::outerProduct(mean, mean);
+    }
+
+private:
+    double count{};
+    dvec3 sum{0.0};
+    dmat3 sum2{0.0};
+    dvec3 lower{std::numeric_limits<double>::max()};
+    dvec3 upper{std::numeric_limits<double>::lowest()};
+};
+
+template <typename Index, typename Functor, Index... Is>
+constexpr auto build_array_impl(Functor&& func, std::integer_sequence<Index, Is...>) noexcept {
+    return std::array{func(std::integral_constant<Index, Is>{})...};
+}
+
+template <std::size_t N, typename Index = std::size_t, typename Functor>
+constexpr auto build_array(Functor&& func) noexcept {
+    return build_array_impl<Index>(std::forward<Functor>(func),
+                                   std::make_integer_sequence<Index, N>());
+}
+
+template <typename Ret = void, typename Functor, typename... Args>
+constexpr auto wrappingDispatch(Functor&& func, const Wrapping3D& wrapping, Args&&... args) {
+    using DispatchFunctor = Ret (*)(Functor&& func, Args&&...);
+
+    constexpr auto table = build_array<3>([](auto x) constexpr {
+        using XT = decltype(x);
+        return build_array<3>([](auto y) constexpr {
+            using YT = decltype(y);
+            return build_array<3>([](auto z) constexpr -> DispatchFunctor {
+                using ZT = decltype(z);
+                return [](Functor&& func, Args&&... args) {
+                    constexpr auto X = static_cast<Wrapping>(XT::value);
+                    constexpr auto Y = static_cast<Wrapping>(YT::value);
+                    constexpr auto Z = static_cast<Wrapping>(ZT::value);
+                    return std::forward<Functor>(func).template operator()<X, Y, Z>(
+                        std::forward<Args>(args)...);
+                };
+            });
+        });
+    });
+
+    return table[static_cast<std::size_t>(wrapping[0])][static_cast<std::size_t>(wrapping[1])]
+                [static_cast<std::size_t>(wrapping[2])](std::forward<Functor>(func),
+                                                        std::forward<Args>(args)...);
+}
+
+double voxelVolume(const dmat4& transform) {
+    const auto a = dvec3{transform * dvec4{dvec3(1.0, 0.0, 0.0), 0.0}};
+    const auto b = dvec3{transform * dvec4{dvec3(0.0, 1.0, 0.0), 0.0}};
+    const auto c = dvec3{transform * dvec4{dvec3(0.0, 0.0, 1.0), 0.0}};
+    return glm::abs(glm::dot(a, glm::cross(b, c)));
+}
+
+struct StatsFunctor {
+    const size_t nRegions;
+    const size_t minRegionId;
+    const size_t channels;
+    const bool moments;
+    std::shared_ptr<DataFrame> df;
+
+    const VolumeRAM* volumeRep;
+    const VolumeRAM* atlasRep;
+    const DataMapper map;
+
+    const dvec3 dim;
+    const mat4 data2dest;
+    const mat4 index2dest;
+    const mat4 index2data;
+    const double volumeScale;
+
+    std::vector<double>* regionVolumes;
+    std::vector<std::vector<double>*> regionSums;
+    std::vector<std::vector<double>*> regionMean;
+    std::vector<std::vector<double>*> regionMin;
+    std::vector<std::vector<double>*> regionMax;
+    std::vector<std::vector<double>*> regionCenter;
+    std::vector<std::vector<std::vector<double>*>> regionCoM;
+    std::vector<std::vector<double>*> regionLower;
+    std::vector<std::vector<double>*> regionUpper;
+    std::vector<std::vector<std::vector<double>*>> regionCovariance;
+
+    StatsFunctor(const Volume& volume, const Volume& atlas, CoordinateSpace destSpace,
+                 bool moments)
+        : nRegions{static_cast<size_t>(atlas.dataMap.dataRange.y - atlas.dataMap.dataRange.x + 1)}
+        , minRegionId{static_cast<size_t>(atlas.dataMap.dataRange.x)}
+        , channels{volume.getDataFormat()->getComponents()}
+        , moments{moments}
+        , df{std::make_shared<DataFrame>(static_cast<uint32_t>(nRegions))}
+        , volumeRep{volume.getRepresentation<VolumeRAM>()}
+        , atlasRep{atlas.getRepresentation<VolumeRAM>()}
+        , map{volume.dataMap}
+        , dim{static_cast<dvec3>(volume.getDimensions())}
+        , data2dest{volume.getCoordinateTransformer().getMatrix(CoordinateSpace::Data, destSpace)}
+        , index2dest{volume.getCoordinateTransformer().getMatrix(CoordinateSpace::Index, destSpace)}
+        , index2data{volume.getCoordinateTransformer().getMatrix(CoordinateSpace::Index,
+                                                                 CoordinateSpace::Data)}
+        , volumeScale{voxelVolume(index2dest)} {
+
+        const auto& axes = volume.axes;
+        const std::array<std::string_view, 3> axesNames = {axes[0].name, axes[1].name,
+                                                           axes[2].name};
+        const std::array<Unit, 3> axesUnits = {axes[0].unit, axes[1].unit, axes[2].unit};
+        static constexpr std::array<const std::string_view, 4> indexLabels = {"0", "1", "2", "3"};
+        const auto channelLabels = std::span<const std::string_view>(indexLabels.data(), channels);
+
+        const auto valueUnits = util::make_array<4>([&](auto) { return map.valueAxis.unit; });
+
+        const auto defaultRanges =
+            util::make_array<4>([&](auto) -> std::optional<dvec2> { return {}; });
+
+        const auto volumeUnit = axes[0].unit * axes[1].unit * axes[2].unit;
+        const auto sumUnits =
+            util::make_array<4>([&](auto) { return volumeUnit * map.valueAxis.unit; });
+
+        const auto posMin = dvec3{data2dest * dvec4{0.0, 0.0, 0.0, 1.0}};
+        const auto posMax = dvec3{data2dest * dvec4{1.0, 1.0, 1.0, 1.0}};
+        std::array<std::optional<dvec2>, 3> sizeRange = {{dvec2{posMin[0], posMax[0]},
+                                                          dvec2{posMin[1], posMax[1]},
+                                                          dvec2{posMin[2], posMax[2]}}};
+
+        regionVolumes = addColumns(*df, "Volume", nRegions, volumeUnit, {});
+        regionSums =
+            addColumns(*df, channels, "Sum", nRegions, sumUnits, defaultRanges, channelLabels);
+        regionMean =
+            addColumns(*df, channels, "Mean", nRegions, valueUnits, defaultRanges, channelLabels);
+        regionMin =
+            addColumns(*df, channels, "Min", nRegions, valueUnits, defaultRanges, channelLabels);
+        regionMax =
+            addColumns(*df, channels, "Max", nRegions, valueUnits, defaultRanges, channelLabels);
+        regionCenter = addColumns(*df, 3, "Center", nRegions, axesUnits, sizeRange, axesNames);
+        regionCoM = addColumns(*df, channels, 3, "CoM", nRegions, axesUnits, sizeRange,
+                               channelLabels, std::span(axesNames));
+
+        if (moments) {
+            const auto areaUnits = util::make_array<3>([&](auto i) {
+                return util::make_array<3>([&](auto j) { return axesUnits[i] * axesUnits[j]; });
+            });
+            regionLower = addColumns(*df, 3, "Lower", nRegions, axesUnits, sizeRange, axesNames);
+            regionUpper = addColumns(*df, 3, "Upper", nRegions, axesUnits, sizeRange, axesNames);
+            regionCovariance = util::table(
+                [&](auto i) {
+                    return addColumns(*df, 3, fmt::format("Covariance {}", axesNames[i]),
+                                      nRegions, areaUnits[i], defaultRanges, axesNames);
+                },
+                0, 3);
+        }
+    }
+
+    // Region indices of the voxels of the row starting at offset, relative to minRegionId
+    void getRegions(size_t offset, std::span<size_t> dst) const {
+        atlasRep->dispatch<void, dispatching::filter::UnsignedIntegerScalars>([&](auto rep) {
+            const auto* src = rep->getDataTyped() + offset;
+            for (size_t x = 0; x < dst.size(); ++x) {
+                dst[x] = static_cast<size_t>(src[x]) - minRegionId;
+                if (dst[x] >= nRegions) {
+                    throw Exception(SourceContext{},
+                                    "Unexpected region index found '{}' expected value in "
+                                    "range [{},{}]",
+                                    src[x], minRegionId, minRegionId + nRegions - 1);
+                }
+            }
+        });
+    }
+    // Values for all channels of the voxels of the row starting at offset, channels interleaved
+    void getValues(size_t offset, std::span<double> dst) const {
+        volumeRep->dispatch<void, dispatching::filter::All>([&](auto rep) {
+            const auto* src = rep->getDataTyped() + offset;
+            for (size_t x = 0; x < dst.size() / channels; ++x) {
+                for (size_t c = 0; c < channels; ++c) {
+                    dst[x * channels + c] = static_cast<double>(util::glmcomp(src[x], c));
+                }
+            }
+        });
+    }
+
+    template <Wrapping wrapX, Wrapping wrapY, Wrapping wrapZ>
+    std::shared_ptr<DataFrame> operator()() const {
+        using TStats = Stats<double, wrapX, wrapY, wrapZ>;
+        struct Partial {
+            std::vector<TStats> stats;
+            std::vector<Moments> moments;
+        };
+
+        const util::IndexMapper2D regionMapper(size2_t{nRegions, channels});
+        const auto dims = volumeRep->getDimensions();
+
+        // Every task has its own dense accumulators for all regions, hence we only use as many
+        // tasks as there are threads to keep the memory use bounded for atlases with many regions
+        const auto tasks = std::max<size_t>(1, util::getPoolSize());
+        const auto grainSize = std::max<size_t>(1, (dims.z + tasks - 1) / tasks);
+
+        const auto accumulate = [&](size_t first, size_t last) {
+            Partial partial{std::vector<TStats>(nRegions * channels, TStats{dvec3{1.0}}),
+                            std::vector<Moments>(moments ? nRegions : 0)};
+            std::vector<size_t> rowRegions(dims.x);
+            std::vector<double> rowValues(dims.x * channels);
+
+            const util::IndexMapper3D indexMapper(dims);
+            for (size_t z = first; z < last; ++z) {
+                for (size_t y = 0; y < dims.y; ++y) {
+                    const auto offset = indexMapper(0, y, z);
+                    getRegions(offset, rowRegions);
+                    getValues(offset, rowValues);
+
+                    for (size_t x = 0; x < dims.x; ++x) {
+                        const auto region = rowRegions[x];
+                        const auto pos = dvec3{x, y, z};
+                        const auto dpos = dvec3{index2data * dvec4{pos, 1.0}};
+                        for (size_t c = 0; c < channels; ++c) {
+                            partial.stats[regionMapper(region, c)].add(
+                                dpos, rowValues[x * channels + c]);
+                        }
+                        if (moments) partial.moments[region].add(pos);
+                    }
+                }
+            }
+            return partial;
+        };
+
+        const auto merge = [](Partial a, Partial b) {
+            if (a.stats.empty()) return b;
+            for (auto&& [lhs, rhs] : util::zip(a.stats, b.stats)) lhs.merge(rhs);
+            for (auto&& [lhs, rhs] : util::zip(a.moments, b.moments)) lhs.merge(rhs);
+            return a;
+        };
+
+        const auto result = util::parallelReduce(0, dims.z, Partial{}, accumulate, merge,
+                                                 {.grainSize = grainSize});
+
+        for (auto&& [i, stat] : util::enumerate(result.stats)) {
+            const auto [region, c] = regionMapper(i);
+
+            if (stat.getVolume() == 0.0) {
+                throw Exception("Empty volume!");
+            }
+            (*regionVolumes)[region] = volumeScale * stat.getVolume();
+            (*regionSums[c])[region] = map.mapFromDataToValue(volumeScale * stat.getMass());
+            (*regionMean[c])[region] = map.mapFromDataToValue(stat.getMean());
+            (*regionMin[c])[region] = map.mapFromDataToValue(stat.getMin());
+            (*regionMax[c])[region] = map.mapFromDataToValue(stat.getMax());
+
+            const auto center = dvec3{data2dest * dvec4{stat.getCenter(), 1.0}};
+            const auto com = dvec3{data2dest * dvec4{stat.getCenterOfMass(), 1.0}};
+            for (int k = 0; k < 3; ++k) {
+                (*regionCenter[k])[region] = center[k];
+                (*regionCoM[c][k])[region] = com[k];
+            }
+        }
+
+        const dmat4 toDest{index2dest};
+        const dmat3 linear{toDest};
+        for (auto&& [region, moment] : util::enumerate(result.moments)) {
+            // The box is transformed to the destination space by its corners
+            auto lower = dvec3{std::numeric_limits<double>::max()};
+            auto upper = dvec3{std::numeric_limits<double>::lowest()};
+            for (int corner = 0; corner < 8; ++corner) {
+                const auto pos = glm::mix(moment.getLower(), moment.getUpper(),
+                                          dvec3(corner & 1, (corner >> 1) & 1, (corner >> 2) & 1));
+                const auto dest = dvec3{toDest * dvec4{pos, 1.0}};
+                lower = glm::min(lower, dest);
+                upper = glm::max(upper, dest);
+            }
+            const auto covariance = linear * moment.getCovariance() * glm::transpose(linear);
+            for (int k = 0; k < 3; ++k) {
+                (*regionLower[k])[region] = lower[k];
+                (*regionUpper[k])[region] = upper[k];
+                for (int l = 0; l < 3; ++l) {
+                    (*regionCovariance[k][l])[region] = covariance[k][l];
+                }
+            }
+        }
+
+        df->getIndexColumn()->setHeader("Region Index");
+        auto& index = df->getIndexColumn()
+                          ->getTypedBuffer()
+                          ->getEditableRAMRepresentation()
+                          ->getDataContainer();
+        std::transform(index.begin(), index.end(), index.begin(),
+                       [&](auto index) { return index + static_cast<std::uint32_t>(minRegionId); });
+
+        return df;
+    }
+};
+
+}  // namespace
+
+std::shared_ptr<DataFrame> util::volumeRegionStatistics(const Volume& volume, const Volume& atlas,
+                                                        CoordinateSpace space, bool moments) {
+    if (volume.getDimensions() != atlas.getDimensions()) {
+        throw Exception(SourceContext{}, "Unexpected dimension missmatch. Volume: {}, Atlas: {}",
+                        volume.getDimensions(), atlas.getDimensions());
+    }
+    if (atlas.getDataFormat()->getComponents() != 1 ||
+        atlas.getDataFormat()->getNumericType() != NumericType::UnsignedInteger) {
+        throw Exception(SourceContext{},
+                        "Unexpected atlas format found, expected an unsigned integer type. Got: {}",
+                        atlas.getDataFormat()->getString());
+    }
+
+    StatsFunctor sf{volume, atlas, space, moments};
+    return wrappingDispatch<std::shared_ptr<DataFrame>>(sf, volume.getWrapping());
+}
+
+}  // namespace inviwo
@@ -0,0 +1,92 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/volume/processors/volumeconnectedcomponents.h>
+
+#include <inviwo/core/algorithm/markdown.h>            // for operator""_help, operator""_unind...
+#include <inviwo/core/datastructures/volume/volume.h>  // for Volume
+#include <inviwo/core/processors/processorstate.h>     // for CodeState
+#include <inviwo/core/processors/processortags.h>      // for Tags
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo VolumeConnectedComponents::processorInfo_{
+    "org.inviwo.VolumeConnectedComponents",    // Class identifier
+    "Volume Connected Components",             // Display name
+    "Volume Operation",                        // Category
+    CodeState::Experimental,                   // Code state
+    Tags::CPU | Tag{"Volume"} | Tag{"Atlas"},  // Tags
+    R"(Thresholds a volume and labels the connected components of the foreground voxels.
+    The volume is split into bricks which are labeled in parallel and then merged across the
+    brick faces. The resulting label volume assigns 0 to the background and 1 to N to the
+    components, ordered by their first voxel, and can be used as atlas for
+    VolumeRegionStatistics and VolumeRegionNeighbor.
+    )"_unindentHelp,
+};
+const ProcessorInfo& VolumeConnectedComponents::getProcessorInfo() const { return processorInfo_; }
+
+VolumeConnectedComponents::VolumeConnectedComponents()
+    : PoolProcessor()
+    , volume_("volume", "Volume to threshold and label, only the first channel is used"_help)
+    , labels_("labels", "Unsigned 32-bit label volume, 0 for background"_help)
+    , threshold_("threshold", "Threshold",
+                 "Voxels with a value in the range are foreground, given in data range"_help, 0.5,
+                 1.0, 0.0, 1.0, 0.001)
+    , connectivity_("connectivity", "Connectivity",
+                    "Which neighbors of a voxel that are considered connected"_help,
+                    {{"face", "Face (6)", util::Connectivity::Face},
+                     {"edge", "Edge (18)", util::Connectivity::Edge},
+                     {"corner", "Corner (26)", util::Connectivity::Corner}},
+                    0) {
+
+    addPorts(volume_, labels_);
+    addProperties(threshold_, connectivity_);
+
+    volume_.onChange([this]() {
+        if (const auto volume = volume_.getData()) {
+            threshold_.setRange(volume->dataMap.dataRange);
+        }
+    });
+}
+
+void VolumeConnectedComponents::process() {
+    auto calc = [volume = volume_.getData(), range = threshold_.get(),
+                 connectivity = connectivity_.getSelectedValue()]() {
+        return util::connectedComponents(*volume, range, connectivity);
+    };
+
+    labels_.setData(nullptr);
+    dispatchOne(calc, [this](std::shared_ptr<Volume> result) {
+        labels_.setData(result);
+        newResults();
+    });
+}
+
+}  // namespace inviwo
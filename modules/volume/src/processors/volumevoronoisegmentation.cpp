@@ -49,7 +49,7 @@ const ProcessorInfo VolumeVoronoiSegmentation::processorInfo_{
 const ProcessorInfo& VolumeVoronoiSegmentation::getProcessorInfo() const { return processorInfo_; }
 
 VolumeVoronoiSegmentation::VolumeVoronoiSegmentation()
-    : PoolProcessor(pool::Option::DelayDispatch)
+    : PoolProcessor(pool::Option::DelayDispatch | pool::Option::Background)
     , volume_("inputVolume", "The input volume"_help)
     , dataFrame_("seedPoints", R"(
         Seed points together with indices and optional weights. The seed points are
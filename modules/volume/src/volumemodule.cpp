@@ -29,6 +29,7 @@
 
 #include <inviwo/volume/processors/histogramtodataframe.h>
 #include <inviwo/volume/processors/neighborlistfiltering.h>
+#include <inviwo/volume/processors/volumeconnectedcomponents.h>
 #include <inviwo/volume/processors/volumeregionneighbor.h>
 #include <inviwo/volume/processors/volumeregionstatistics.h>
 #include <inviwo/volume/processors/volumeregionmapper.h>
@@ -47,6 +48,7 @@ VolumeModule::VolumeModule(InviwoApplication* app) : InviwoModule(app, "Volume")
     registerProcessor<HistogramToDataFrame<Layer>>();
     registerProcessor<HistogramToDataFrame<Volume>>();
     registerProcessor<NeighborListFiltering>();
+    registerProcessor<VolumeConnectedComponents>();
     registerProcessor<VolumeRegionMapper>();
     registerProcessor<VolumeRegionNeighbor>();
     registerProcessor<VolumeRegionStatistics>();
@@ -0,0 +1,120 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/volume/algorithm/volumeregionstatistics.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include <glm/gtx/component_wise.hpp>
+
+using namespace inviwo;
+
+namespace {
+
+constexpr size3_t dims{128, 128, 128};
+
+// A value volume and an atlas with the given number of randomly placed regions. Every region is
+// assigned to at least one voxel.
+std::pair<std::shared_ptr<Volume>, std::shared_ptr<Volume>> createVolumes(size_t regions) {
+    const auto size = glm::compMul(dims);
+    std::mt19937 gen(4711);
+    std::uniform_real_distribution<float> valueDist{0.0f, 1.0f};
+    std::uniform_int_distribution<uint32_t> regionDist{0, static_cast<uint32_t>(regions - 1)};
+
+    auto values = std::make_shared<VolumeRAMPrecision<float>>(dims);
+    auto atlasRep = std::make_shared<VolumeRAMPrecision<uint32_t>>(dims);
+    auto* v = values->getDataTyped();
+    auto* a = atlasRep->getDataTyped();
+    for (size_t i = 0; i < size; ++i) {
+        v[i] = valueDist(gen);
+        a[i] = i < regions ? static_cast<uint32_t>(i) : regionDist(gen);
+    }
+
+    auto volume = std::make_shared<Volume>(values);
+    auto atlas = std::make_shared<Volume>(atlasRep);
+    atlas->dataMap.dataRange = dvec2{0.0, static_cast<double>(regions - 1)};
+    return {volume, atlas};
+}
+
+// The first argument is the number of regions, the second the number of threads in the pool,
+// zero runs everything serially
+void RegionStatistics(benchmark::State& state) {
+    const auto [volume, atlas] = createVolumes(static_cast<size_t>(state.range(0)));
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(1)));
+    state.counters["Threads"] = static_cast<double>(state.range(1));
+    state.counters["Voxels"] = benchmark::Counter(static_cast<double>(glm::compMul(dims)),
+                                                  benchmark::Counter::kIsIterationInvariantRate);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            util::volumeRegionStatistics(*volume, *atlas, CoordinateSpace::World));
+    }
+}
+
+void RegionStatisticsMoments(benchmark::State& state) {
+    const auto [volume, atlas] = createVolumes(static_cast<size_t>(state.range(0)));
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(1)));
+    state.counters["Threads"] = static_cast<double>(state.range(1));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            util::volumeRegionStatistics(*volume, *atlas, CoordinateSpace::World, true));
+    }
+}
+
+}  // namespace
+
+BENCHMARK(RegionStatistics)
+    ->ArgsProduct({{16, 1024, 100'000}, {0, 4, 8}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(RegionStatisticsMoments)
+    ->ArgsProduct({{16, 100'000}, {0, 8}})
+    ->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    LogCentral::init();
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-RegionStatistics");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
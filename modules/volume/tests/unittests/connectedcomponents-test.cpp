@@ -0,0 +1,117 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/volume/algorithm/connectedcomponents.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size3_t dims{8, 8, 8};
+
+// A line along x at y = 7, z = 0, a cube [1,3]^3, and two voxels only touching at a corner.
+std::shared_ptr<Volume> createMask() {
+    auto mask = std::make_shared<VolumeRAMPrecision<unsigned char>>(dims);
+    auto* data = mask->getDataTyped();
+    std::fill(data, data + dims.x * dims.y * dims.z, 0);
+    const util::IndexMapper3D im{dims};
+    for (size_t x = 0; x < dims.x; ++x) data[im(x, 7, 0)] = 1;
+    for (size_t z = 1; z <= 3; ++z) {
+        for (size_t y = 1; y <= 3; ++y) {
+            for (size_t x = 1; x <= 3; ++x) data[im(x, y, z)] = 1;
+        }
+    }
+    data[im(5, 5, 5)] = 1;
+    data[im(6, 6, 6)] = 1;
+    return std::make_shared<Volume>(mask);
+}
+
+std::uint32_t label(const Volume& labels, size3_t pos) {
+    const auto* ram = static_cast<const VolumeRAMPrecision<std::uint32_t>*>(
+        labels.getRepresentation<VolumeRAM>());
+    return ram->getDataTyped()[util::IndexMapper3D{dims}(pos)];
+}
+
+}  // namespace
+
+TEST(ConnectedComponents, face) {
+    const auto mask = createMask();
+    const auto labels =
+        util::connectedComponents(*mask, dvec2{0.5, 1.0}, util::Connectivity::Face, size3_t{2});
+
+    EXPECT_EQ(labels->dataMap.dataRange, dvec2(0.0, 4.0));
+    EXPECT_EQ(label(*labels, {0, 0, 0}), 0u);
+    // labels are ordered by the first voxel of each component
+    EXPECT_EQ(label(*labels, {0, 7, 0}), 1u);
+    EXPECT_EQ(label(*labels, {7, 7, 0}), 1u);
+    EXPECT_EQ(label(*labels, {1, 1, 1}), 2u);
+    EXPECT_EQ(label(*labels, {3, 3, 3}), 2u);
+    EXPECT_EQ(label(*labels, {5, 5, 5}), 3u);
+    EXPECT_EQ(label(*labels, {6, 6, 6}), 4u);
+}
+
+TEST(ConnectedComponents, corner) {
+    const auto mask = createMask();
+    const auto labels =
+        util::connectedComponents(*mask, dvec2{0.5, 1.0}, util::Connectivity::Corner, size3_t{3});
+
+    EXPECT_EQ(labels->dataMap.dataRange, dvec2(0.0, 3.0));
+    EXPECT_EQ(label(*labels, {5, 5, 5}), 3u);
+    EXPECT_EQ(label(*labels, {6, 6, 6}), 3u);
+}
+
+TEST(ConnectedComponents, independentOfBrickSize) {
+    const auto mask = createMask();
+    for (auto connectivity :
+         {util::Connectivity::Face, util::Connectivity::Edge, util::Connectivity::Corner}) {
+        const auto reference =
+            util::connectedComponents(*mask, dvec2{0.5, 1.0}, connectivity, size3_t{64});
+        for (auto brickSize : {size3_t{1}, size3_t{2}, size3_t{3, 5, 2}}) {
+            const auto labels =
+                util::connectedComponents(*mask, dvec2{0.5, 1.0}, connectivity, brickSize);
+            for (size_t i = 0; i < dims.x * dims.y * dims.z; ++i) {
+                const util::IndexMapper3D im{dims};
+                const auto pos = im(i);
+                ASSERT_EQ(label(*reference, pos), label(*labels, pos));
+            }
+        }
+    }
+}
+
+}  // namespace inviwo
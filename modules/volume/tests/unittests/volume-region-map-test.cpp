@@ -35,6 +35,9 @@
 #include <inviwo/core/util/templatesampler.h>
 #include <inviwo/volume/algorithm/volumemap.h>
 
+#include <algorithm>
+#include <array>
+
 namespace inviwo {
 
 namespace {
@@ -168,5 +171,33 @@ TEST(Volume, volume_region_map_test_binary_search) {
     EXPECT_EQ(2, sampler.sample(vec3(0.f, 1.0f, 1.0f)));
     EXPECT_EQ(2, sampler.sample(vec3(1.0f, 1.0f, 1.0f)));
 }
+
+TEST(Volume, volume_region_map_test_sparse_missing_values) {
+    auto volume = createVolume2x2x2();
+    std::vector<int> src = {1, 4, 1000000};
+    std::vector<int> dst = {7, 8, 9};
+    util::remap(*volume, src, dst, -1, true);
+
+    const auto* data = static_cast<const VolumeRAMPrecision<int>*>(
+                           volume->getRepresentation<VolumeRAM>())
+                           ->getDataTyped();
+    const std::array<int, 8> expected = {{7, 7, -1, -1, 8, 8, -1, -1}};
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), data));
+}
+
+TEST(Volume, volume_region_map_test_dense_keeps_unmapped_values) {
+    auto volume = createVolume3x3x3();
+    std::vector<int> src = {2, 4, 6};
+    std::vector<int> dst = {20, 40, 60};
+    util::remap(*volume, src, dst, 0, false);
+
+    const auto* data = static_cast<const VolumeRAMPrecision<int>*>(
+                           volume->getRepresentation<VolumeRAM>())
+                           ->getDataTyped();
+    for (size_t i = 0; i < sampledata.size(); ++i) {
+        const auto v = sampledata[i];
+        EXPECT_EQ(data[i], (v == 2 || v == 4 || v == 6) ? 10 * v : v);
+    }
+}
 }  // namespace
 }  // namespace inviwo
@@ -0,0 +1,100 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/volume/algorithm/volumeregionstatistics.h>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size3_t dims{8, 4, 6};
+
+// Three regions split along x: [0,3), [3,6), and [6,8). The values are the x index.
+std::pair<std::shared_ptr<Volume>, std::shared_ptr<Volume>> createVolumes() {
+    auto values = std::make_shared<VolumeRAMPrecision<float>>(dims);
+    auto regions = std::make_shared<VolumeRAMPrecision<unsigned char>>(dims);
+    const util::IndexMapper3D im{dims};
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                values->getDataTyped()[im(x, y, z)] = static_cast<float>(x);
+                regions->getDataTyped()[im(x, y, z)] = static_cast<unsigned char>(x / 3);
+            }
+        }
+    }
+    auto volume = std::make_shared<Volume>(values);
+    volume->dataMap.dataRange = dvec2{0.0, 1.0};
+    volume->dataMap.valueRange = dvec2{0.0, 1.0};
+    auto atlas = std::make_shared<Volume>(regions);
+    atlas->dataMap.dataRange = dvec2{0.0, 2.0};
+    return {volume, atlas};
+}
+
+double value(const DataFrame& df, std::string_view column, size_t row) {
+    return df.getColumn(column)->getAsDouble(row);
+}
+
+}  // namespace
+
+TEST(VolumeRegionStatistics, basic) {
+    const auto [volume, atlas] = createVolumes();
+    const auto df = util::volumeRegionStatistics(*volume, *atlas, CoordinateSpace::Index);
+
+    ASSERT_EQ(df->getNumberOfRows(), 3);
+    EXPECT_DOUBLE_EQ(value(*df, "Volume", 0), 3.0 * 4.0 * 6.0);
+    EXPECT_DOUBLE_EQ(value(*df, "Volume", 2), 2.0 * 4.0 * 6.0);
+    EXPECT_DOUBLE_EQ(value(*df, "Mean 0", 1), 4.0);
+    EXPECT_DOUBLE_EQ(value(*df, "Min 0", 2), 6.0);
+    EXPECT_DOUBLE_EQ(value(*df, "Max 0", 2), 7.0);
+    EXPECT_NEAR(value(*df, "Center x", 0), 1.0, 1e-9);
+    EXPECT_EQ(df->getColumn("Lower x"), nullptr);
+}
+
+TEST(VolumeRegionStatistics, moments) {
+    const auto [volume, atlas] = createVolumes();
+    const auto df = util::volumeRegionStatistics(*volume, *atlas, CoordinateSpace::Index, true);
+
+    EXPECT_NEAR(value(*df, "Lower x", 1), 3.0, 1e-9);
+    EXPECT_NEAR(value(*df, "Upper x", 1), 5.0, 1e-9);
+    EXPECT_NEAR(value(*df, "Upper z", 1), 5.0, 1e-9);
+    // Variance of {3, 4, 5} and of {0, 1, 2, 3}, no correlation between the axes
+    EXPECT_NEAR(value(*df, "Covariance x x", 1), 2.0 / 3.0, 1e-9);
+    EXPECT_NEAR(value(*df, "Covariance y y", 1), 1.25, 1e-9);
+    EXPECT_NEAR(value(*df, "Covariance x y", 1), 0.0, 1e-9);
+}
+
+}  // namespace inviwo
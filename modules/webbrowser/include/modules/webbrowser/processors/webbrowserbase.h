@@ -145,6 +145,7 @@ private:
 
     std::function<void(bool)> onLoadingChanged_;
     Dispatcher<void()> loadingDone_;
+    std::shared_ptr<std::function<void()>> refreshRateChanged_;
 
     IMPLEMENT_REFCOUNTING(WebBrowserBase);
 };
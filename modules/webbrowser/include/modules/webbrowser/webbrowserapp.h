@@ -31,6 +31,9 @@
 
 #include <modules/webbrowser/webbrowsermoduledefine.h>  // for IVW_MODULE_WEBBROWSER_API
 
+#include <cstdint>     // for int64_t
+#include <functional>  // for function
+
 #include <warn/push>
 #include <warn/ignore/all>
 #include <include/cef_app.h>                      // for CefApp
@@ -51,7 +54,12 @@ namespace inviwo {
 #include <warn/ignore/extra-semi>  // Due to IMPLEMENT_REFCOUNTING, remove when upgrading CEF
 class IVW_MODULE_WEBBROWSER_API WebBrowserApp : public CefApp, public CefBrowserProcessHandler {
 public:
-    WebBrowserApp();
+    /**
+     * @param scheduleMessagePumpWork called, possibly from any thread, when CEF wants
+     * CefDoMessageLoopWork() to be called on the main thread after the given delay in ms.
+     * @see CefBrowserProcessHandler::OnScheduleMessagePumpWork
+     */
+    explicit WebBrowserApp(std::function<void(int64_t)> scheduleMessagePumpWork = nullptr);
     // Provides an opportunity to view and/or modify command-line arguments before
     // processing by CEF and Chromium. The |process_type| value will be empty for
     // the browser process. Do not keep a reference to the CefCommandLine object
@@ -73,7 +81,12 @@ public:
     // CefBrowserProcessHandler methods:
     CefRefPtr<CefBrowserProcessHandler> GetBrowserProcessHandler() override { return this; }
 
+    // Called when CEF has work to do when using an external message pump. A |delay_ms| less
+    // than or equal to 0 means that the work should be done as soon as possible.
+    virtual void OnScheduleMessagePumpWork(int64_t delay_ms) override;
+
 private:
+    std::function<void(int64_t)> scheduleMessagePumpWork_;
     IMPLEMENT_REFCOUNTING(WebBrowserApp);
 };
 #include <warn/pop>
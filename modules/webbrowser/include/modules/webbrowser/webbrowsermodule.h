@@ -31,10 +31,10 @@
 
 #include <modules/webbrowser/webbrowsermoduledefine.h>  // for IVW_MODULE_WEBBROWSE...
 #include <inviwo/core/common/inviwomodule.h>            // for InviwoModule
-#include <inviwo/core/util/timer.h>                     // for Timer
+#include <inviwo/core/util/timer.h>                     // for Timer, Delay
 #include <modules/webbrowser/webbrowserclient.h>        // for WebBrowserClient
 
-#include <memory>   // for unique_ptr, make_unique
+#include <memory>   // for unique_ptr, make_unique, shared_ptr
 #include <string>   // for string
 #include <utility>  // for move
 #include <vector>   // for vector
@@ -63,8 +63,10 @@ public:
 protected:
     CefRefPtr<WebBrowserClient> browserClient_;
 
-    Timer doChromiumWork_;  /// Calls CefDoMessageLoopWork()
-#ifdef __APPLE__            // Load library dynamically for Mac
+    Timer doChromiumWork_;  /// Calls CefDoMessageLoopWork() as a fallback at a low rate
+    /// Calls CefDoMessageLoopWork() when requested by CEF, see OnScheduleMessagePumpWork
+    std::shared_ptr<Delay> scheduledChromiumWork_;
+#ifdef __APPLE__  // Load library dynamically for Mac
     CefScopedLibraryLoader cefLib_;
 #endif
 };
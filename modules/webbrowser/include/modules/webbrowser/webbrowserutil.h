@@ -49,8 +49,12 @@ namespace inviwo::cefutil {
  * browserSettings.file_access_from_file_urls = STATE_ENABLED;
  *
  * window_info.SetAsWindowless(nullptr);  // nullptr means no transparency (site background colour)
+ *
+ * @param frameRate   maximum rate (Hz) at which the off-screen browser produces new frames.
+ *                    CEF only paints when the page has changed, so a static page costs nothing.
  */
-IVW_MODULE_WEBBROWSER_API std::tuple<CefWindowInfo, CefBrowserSettings> getDefaultBrowserSettings();
+IVW_MODULE_WEBBROWSER_API std::tuple<CefWindowInfo, CefBrowserSettings> getDefaultBrowserSettings(
+    int frameRate = 30);
 
 // CEF uses a zoom level which increases/decreases by 20% per level
 //
@@ -35,6 +35,7 @@
 #include <inviwo/core/processors/processor.h>
 #include <modules/webbrowser/webbrowserclient.h>
 #include <modules/webbrowser/webbrowsermodule.h>
+#include <modules/webbrowser/webbrowsersettings.h>
 #include <modules/webbrowser/webbrowserutil.h>
 
 #include <fmt/core.h>
@@ -62,7 +63,9 @@ WebBrowserBase::WebBrowserBase(InviwoApplication* app, Processor& processor, Ima
     , onLoadingChanged_{onLoadingChanged} {
 
     // Setup CEF browser
-    auto [windowInfo, browserSettings] = cefutil::getDefaultBrowserSettings();
+    auto* settings = app->getSettingsByType<WebBrowserSettings>();
+    auto [windowInfo, browserSettings] =
+        cefutil::getDefaultBrowserSettings(settings ? settings->refreshRate_.get() : 30);
     auto browserClient = util::getModuleByTypeOrThrow<WebBrowserModule>(app).getBrowserClient();
     // Note that browserClient_ outlives this class so make sure to remove
     // this CefLoadHandler in destructor
@@ -84,6 +87,12 @@ WebBrowserBase::WebBrowserBase(InviwoApplication* app, Processor& processor, Ima
     // Inject events into CEF browser
     cefInteractionHandler_.setHost(browser_->GetHost());
     cefInteractionHandler_.setRenderHandler(renderHandler_.get());
+
+    if (settings) {
+        refreshRateChanged_ = settings->refreshRate_.onChangeScoped([this, settings]() {
+            browser_->GetHost()->SetWindowlessFrameRate(settings->refreshRate_.get());
+        });
+    }
 }
 
 WebBrowserBase::~WebBrowserBase() {
@@ -34,7 +34,9 @@
 #include <inviwo/core/util/logcentral.h>
 #include <modules/opengl/texture/texture2d.h>  // for Texture2D
 
-#include <vector>  // for vector<>::value_type
+#include <algorithm>  // for min, max
+#include <utility>    // for pair
+#include <vector>     // for vector<>::value_type
 
 #include <glm/common.hpp>                    // for max
 #include <include/base/cef_scoped_refptr.h>  // for scoped_refptr
@@ -130,7 +132,23 @@ void RenderHandlerGL::OnPaint(CefRefPtr<CefBrowser> browser, PaintElementType ty
         if (texture2D.getDimensions() != bufferDims) {
             texture2D.resize(bufferDims);
         }
-        if ((dirtyRects.size() == 1 && dirtyRects[0] == CefRect(0, 0, width, height))) {
+        // Many small rects are more expensive to upload one by one than their bounding box,
+        // merge them if it does not add too many clean pixels.
+        const auto [bounds, dirtyArea] = [&]() {
+            if (dirtyRects.empty()) return std::pair{CefRect{}, 0};
+            int x0 = width, y0 = height, x1 = 0, y1 = 0, area = 0;
+            for (const auto& rect : dirtyRects) {
+                x0 = std::min(x0, rect.x);
+                y0 = std::min(y0, rect.y);
+                x1 = std::max(x1, rect.x + rect.width);
+                y1 = std::max(y1, rect.y + rect.height);
+                area += rect.width * rect.height;
+            }
+            return std::pair{CefRect{x0, y0, x1 - x0, y1 - y0}, area};
+        }();
+        const bool merge = dirtyRects.size() > 1 && bounds.width * bounds.height <= 2 * dirtyArea;
+
+        if (bounds == CefRect(0, 0, width, height) && (merge || dirtyRects.size() == 1)) {
             // Upload all data
             texture2D.upload(buffer);
         } else {
@@ -138,7 +156,8 @@ void RenderHandlerGL::OnPaint(CefRefPtr<CefBrowser> browser, PaintElementType ty
             texture2D.bind();
             glPixelStorei(GL_UNPACK_ALIGNMENT, 4);  // RGBA 8-bit are always aligned
             glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
-            for (const auto& rect : dirtyRects) {
+            const RectList merged = merge ? RectList{bounds} : RectList{};
+            for (const auto& rect : merge ? merged : dirtyRects) {
                 glPixelStorei(GL_UNPACK_SKIP_PIXELS, rect.x);
                 glPixelStorei(GL_UNPACK_SKIP_ROWS, rect.y);
                 glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x, rect.y, rect.width, rect.height,
@@ -201,12 +220,19 @@ void RenderHandlerGL::OnAcceleratedPaint(CefRefPtr<CefBrowser> browser, PaintEle
     if (dirtyRects.empty()) {
         return;
     }
+    auto& browserData = browserData_[browser->GetIdentifier()];
+
+    // The shared texture always contains the whole view, the dirty rects only tell which part of
+    // it changed and can not be used for the size.
+    const int newWidth = static_cast<int>(browserData.viewRect.x);
+    const int newHeight = static_cast<int>(browserData.viewRect.y);
+
     // When the window is minimized the texture is 1x1.
     // This prevents a hard crash when minimizing the window or when you resize the window
     // so that only the top bar is visible.
     // @TODO (ylvse 2024-08-20): minimizing window should be handled with the appropriate
     // function in the CefBrowser called WasHidden
-    if (dirtyRects[0].height <= 1 || dirtyRects[0].width <= 1) {
+    if (newHeight <= 1 || newWidth <= 1) {
         return;
     }
 
@@ -214,9 +240,6 @@ void RenderHandlerGL::OnAcceleratedPaint(CefRefPtr<CefBrowser> browser, PaintEle
 
     // Create new texture that we can copy the shared texture into. Unfortunately
     // textures are immutable so we have to create a new one
-
-    const int newWidth = dirtyRects[0].width;
-    const int newHeight = dirtyRects[0].height;
     const size2_t dims{newWidth, newHeight};
 
     Texture2D newTexture(dims, GL_RGBA, GL_RGBA8, GL_UNSIGNED_BYTE, GL_NEAREST);
@@ -241,7 +264,6 @@ void RenderHandlerGL::OnAcceleratedPaint(CefRefPtr<CefBrowser> browser, PaintEle
     glDeleteMemoryObjectsEXT(1, &memObj);
 
     // Set the updated texture
-    auto& browserData = browserData_[browser->GetIdentifier()];
     browserData.texture2D = std::move(newTexture);
 
     // Notify that we are done copying
@@ -35,6 +35,8 @@
 #include <include/cef_base.h>                // for CefRefPtr, CefString
 #include <include/cef_command_line.h>        // for CefCommandLine
 
+#include <utility>  // for move
+
 #include <include/cef_browser.h>
 #include <include/cef_callback.h>
 #include <include/cef_frame.h>
@@ -46,7 +48,12 @@
 
 namespace inviwo {
 
-WebBrowserApp::WebBrowserApp() = default;
+WebBrowserApp::WebBrowserApp(std::function<void(int64_t)> scheduleMessagePumpWork)
+    : scheduleMessagePumpWork_{std::move(scheduleMessagePumpWork)} {}
+
+void WebBrowserApp::OnScheduleMessagePumpWork(int64_t delay_ms) {
+    if (scheduleMessagePumpWork_) scheduleMessagePumpWork_(delay_ms);
+}
 
 void WebBrowserApp::OnBeforeCommandLineProcessing(const CefString&,
                                                   CefRefPtr<CefCommandLine> command_line) {
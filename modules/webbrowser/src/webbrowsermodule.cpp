@@ -39,6 +39,7 @@
 #include <inviwo/core/util/settings/systemsettings.h>  // for SystemSettings
 #include <inviwo/core/util/staticstring.h>             // for operator+
 #include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/util/threadutil.h>          // for dispatchFrontAndForget
 #include <inviwo/core/util/timer.h>               // for Timer, Timer::...
 #include <modules/opengl/shader/shadermanager.h>  // for ShaderManager
 #include <modules/webbrowser/processors/basicwebbrowser.h>
@@ -49,7 +50,9 @@
 #include <modules/webbrowser/webbrowserclient.h>                // for WebBrowserClient
 #include <modules/webbrowser/webbrowsersettings.h>              // for WebBrowserSett...
 
+#include <algorithm>    // for max
 #include <cstddef>      // for size_t, NULL
+#include <cstdint>      // for int64_t
 #include <functional>   // for __base, function
 #include <locale>       // for locale
 #include <string_view>  // for string_view
@@ -65,16 +68,28 @@
 
 namespace inviwo {
 
+namespace {
+
+// CEF schedules the message loop work it needs through OnScheduleMessagePumpWork, the timer is
+// only a fallback to make sure the pump never stalls. Same as the max delay used by cefclient.
+Timer::Milliseconds fallbackInterval(int refreshRate) {
+    return Timer::Milliseconds(std::max(1000 / std::max(refreshRate, 1), 1000 / 30));
+}
+
+}  // namespace
+
 WebBrowserModule::WebBrowserModule(InviwoApplication* app)
     : InviwoModule(app, "WebBrowser")
-    , doChromiumWork_(Timer::Milliseconds(16), []() { CefDoMessageLoopWork(); }) {
+    , doChromiumWork_(Timer::Milliseconds(1000 / 30), []() { CefDoMessageLoopWork(); })
+    , scheduledChromiumWork_{
+          std::make_shared<Delay>(Delay::Milliseconds(0), []() { CefDoMessageLoopWork(); })} {
 
     auto moduleSettings = std::make_unique<WebBrowserSettings>();
 
     moduleSettings->refreshRate_.onChange([this, ptr = moduleSettings.get()]() {
-        doChromiumWork_.setInterval(Timer::Milliseconds(1000 / ptr->refreshRate_));
+        doChromiumWork_.setInterval(fallbackInterval(ptr->refreshRate_));
     });
-    doChromiumWork_.setInterval(Timer::Milliseconds(1000 / moduleSettings->refreshRate_));
+    doChromiumWork_.setInterval(fallbackInterval(moduleSettings->refreshRate_));
 
     registerSettings(std::move(moduleSettings));
 
@@ -215,7 +230,21 @@ WebBrowserModule::WebBrowserModule(InviwoApplication* app)
     CefString(&settings.locale).FromString(locale);
 
     // Optional implementation of the CefApp interface.
-    CefRefPtr<WebBrowserApp> browserApp(new WebBrowserApp);
+    // Only pump the CEF message loop when CEF asks for it, this way an idle page does not cost
+    // anything. OnScheduleMessagePumpWork can be called from any thread, hence the dispatch.
+    CefRefPtr<WebBrowserApp> browserApp(new WebBrowserApp(
+        [work = std::weak_ptr<Delay>{scheduledChromiumWork_}](int64_t delayMs) {
+            util::dispatchFrontAndForget([work, delayMs]() {
+                if (auto delay = work.lock()) {
+                    if (delayMs <= 0) {
+                        delay->cancel();
+                        CefDoMessageLoopWork();
+                    } else {
+                        delay->start(Delay::Milliseconds(delayMs));
+                    }
+                }
+            });
+        }));
 
     CefMainArgs args;
     if (!CefInitialize(args, settings, browserApp, sandbox_info)) {
@@ -240,6 +269,7 @@ WebBrowserModule::WebBrowserModule(InviwoApplication* app)
 WebBrowserModule::~WebBrowserModule() {
     // Stop message pumping and make sure that app has finished processing before CefShutdown
     doChromiumWork_.stop();
+    scheduledChromiumWork_.reset();
     app_->waitForPool();
     CefShutdown();
 }
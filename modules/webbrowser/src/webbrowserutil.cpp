@@ -38,7 +38,7 @@
 
 namespace inviwo::cefutil {
 
-std::tuple<CefWindowInfo, CefBrowserSettings> getDefaultBrowserSettings() {
+std::tuple<CefWindowInfo, CefBrowserSettings> getDefaultBrowserSettings(int frameRate) {
     CefWindowInfo windowInfo;
 
 #if defined(WIN32) || defined(__APPLE__)
@@ -55,6 +55,7 @@ std::tuple<CefWindowInfo, CefBrowserSettings> getDefaultBrowserSettings() {
 #endif
 
     CefBrowserSettings browserSettings;
+    browserSettings.windowless_frame_rate = frameRate;
 
     return std::tuple<CefWindowInfo, CefBrowserSettings>{windowInfo, browserSettings};
 }
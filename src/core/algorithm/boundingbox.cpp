@@ -88,31 +88,9 @@ mat4 boundingBox(const std::vector<std::shared_ptr<Layer>>& layers) {
 }
 
 mat4 boundingBox(const Mesh& mesh) {
-    const auto& buffers = mesh.getBuffers();
-    auto it = std::find_if(buffers.begin(), buffers.end(), [](const auto& buff) {
-        return buff.first.type == BufferType::PositionAttrib;
-    });
-    if (it != buffers.end() && it->second->getSize() > 0) {
-        const auto minmax =
-            it->second->getRepresentation<BufferRAM>()->dispatch<std::pair<dvec4, dvec4>>(
-                [](auto br) {
-                    using ValueType = util::PrecisionValueType<decltype(br)>;
-                    const auto& data = br->getDataContainer();
-
-                    using Res = std::pair<ValueType, ValueType>;
-                    Res minmax{DataFormat<ValueType>::max(), DataFormat<ValueType>::lowest()};
-                    minmax =
-                        std::accumulate(data.begin(), data.end(), minmax,
-                                        [](const Res& mm, const ValueType& v) -> Res {
-                                            return {glm::min(mm.first, v), glm::max(mm.second, v)};
-                                        });
-
-                    return std::pair<dvec4, dvec4>{util::glm_convert<dvec4>(minmax.first),
-                                                   util::glm_convert<dvec4>(minmax.second)};
-                });
-
-        const vec3 dataMin = vec3(minmax.first);
-        const vec3 dataMax = vec3(minmax.second);
+    if (const auto range = mesh.getPositionRange()) {
+        const vec3 dataMin = vec3(range->first);
+        const vec3 dataMax = vec3(range->second);
         auto m = glm::scale(dataMax - dataMin);
         m[3] = vec4(dataMin, 1.0f);
         return mesh.getCoordinateTransformer().getDataToWorldMatrix() * m;
@@ -33,13 +33,17 @@
 #include <inviwo/core/common/inviwocommondefines.h>
 #include <inviwo/core/common/modulemanager.h>
 #include <inviwo/core/datastructures/camera/camerafactory.h>
+#include <inviwo/core/interaction/interactionstate.h>
 #include <inviwo/core/interaction/pickingmanager.h>
 #include <inviwo/core/io/datareaderfactory.h>
 #include <inviwo/core/io/datawriterfactory.h>
+#include <inviwo/core/io/sessioncache.h>
 #include <inviwo/core/metadata/metadatafactory.h>
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/network/networklock.h>
 #include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/network/evaluationprofiler.h>
+#include <inviwo/core/resourcemanager/memorybudget.h>
 #include <inviwo/core/network/workspacemanager.h>
 #include <inviwo/core/ports/portfactory.h>
 #include <inviwo/core/ports/portinspectorfactory.h>
@@ -157,6 +161,11 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string_view dis
     , processorNetwork_{std::make_unique<ProcessorNetwork>(this)}
     , processorNetworkEvaluator_{std::make_unique<ProcessorNetworkEvaluator>(
           processorNetwork_.get())}
+    , evaluationProfiler_{std::make_unique<EvaluationProfiler>(processorNetwork_.get(),
+                                                               processorNetworkEvaluator_.get())}
+    , memoryBudget_{std::make_unique<MemoryBudget>(processorNetworkEvaluator_.get())}
+    , sessionCache_{
+          std::make_unique<SessionCache>(filesystem::getPath(PathType::Cache) / "session")}
     , workspaceManager_{std::make_unique<WorkspaceManager>(this)}
     , propertyPresetManager_{std::make_unique<PropertyPresetManager>(this)}
     , portInspectorManager_{std::make_unique<PortInspectorManager>(this)}
@@ -168,6 +177,48 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string_view dis
     resizePool(systemSettings_->poolSize_);
     systemSettings_->poolSize_.onChange([this]() { resizePool(systemSettings_->poolSize_); });
 
+    const auto updateEvaluationMode = [this]() {
+        processorNetworkEvaluator_->setEvaluationMode(
+            systemSettings_->parallelEvaluation_
+                ? ProcessorNetworkEvaluator::EvaluationMode::Parallel
+                : ProcessorNetworkEvaluator::EvaluationMode::Serial);
+    };
+    updateEvaluationMode();
+    systemSettings_->parallelEvaluation_.onChange(updateEvaluationMode);
+
+    const auto updateMemoryBudget = [this]() {
+        constexpr size_t mb = 1024 * 1024;
+        memoryBudget_->setBudget(MemoryBudget::Pool::RAM, systemSettings_->ramBudget_ * mb);
+        memoryBudget_->setBudget(MemoryBudget::Pool::GL, systemSettings_->glBudget_ * mb);
+    };
+    updateMemoryBudget();
+    systemSettings_->ramBudget_.onChange(updateMemoryBudget);
+    systemSettings_->glBudget_.onChange(updateMemoryBudget);
+
+    const auto updateResultCache = [this]() {
+        constexpr size_t mb = 1024 * 1024;
+        auto& cache = processorNetworkEvaluator_->getResultCache();
+        cache.setCapacity(systemSettings_->resultCache_ * mb);
+    };
+    updateResultCache();
+    systemSettings_->resultCache_.onChange(updateResultCache);
+
+    const auto updateSessionCache = [this]() {
+        constexpr size_t mb = 1024 * 1024;
+        sessionCache_->setCapacity(systemSettings_->sessionCache_ * mb);
+    };
+    updateSessionCache();
+    systemSettings_->sessionCache_.onChange(updateSessionCache);
+    systemSettings_->clearSessionCache_.onChange([this]() { sessionCache_->clear(); });
+
+    const auto updateMemoryWarning = [this]() {
+        constexpr size_t mb = 1024 * 1024;
+        resourceManager_->setWarningThreshold(ResourceManager::groupIndex<resource::GL>(),
+                                              systemSettings_->glMemoryWarning_ * mb);
+    };
+    updateMemoryWarning();
+    systemSettings_->glMemoryWarning_.onChange(updateMemoryWarning);
+
     // initialize singletons
     init(this);
     RenderContext::init();
@@ -243,6 +294,14 @@ ProcessorNetworkEvaluator* InviwoApplication::getProcessorNetworkEvaluator() {
     return processorNetworkEvaluator_.get();
 }
 
+EvaluationProfiler* InviwoApplication::getEvaluationProfiler() {
+    return evaluationProfiler_.get();
+}
+
+MemoryBudget* InviwoApplication::getMemoryBudget() { return memoryBudget_.get(); }
+
+SessionCache& InviwoApplication::getSessionCache() { return *sessionCache_; }
+
 WorkspaceManager* InviwoApplication::getWorkspaceManager() { return workspaceManager_.get(); }
 
 PropertyPresetManager* InviwoApplication::getPropertyPresetManager() {
@@ -444,6 +503,13 @@ TimerThread& InviwoApplication::getTimerThread() {
     return *timerThread_;
 }
 
+InteractionState& InviwoApplication::getInteractionState() {
+    if (!interactionState_) {
+        interactionState_ = std::make_unique<InteractionState>(getTimerThread());
+    }
+    return *interactionState_;
+}
+
 void InviwoApplication::setFileSystemObserver(std::unique_ptr<FileSystemObserver> observer) {
     fileSystemObserver_ = std::move(observer);
 }
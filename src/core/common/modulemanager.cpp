@@ -40,10 +40,13 @@
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/common/inviwocommondefines.h>
 #include <inviwo/core/network/workspacemanager.h>
+#include <inviwo/core/util/clock.h>
+#include <inviwo/core/util/chronoutils.h>
 
 #include <string>
 #include <functional>
 #include <ranges>
+#include <future>
 
 #include <fmt/std.h>
 
@@ -113,6 +116,7 @@ void ModuleManager::registerModules(std::vector<std::unique_ptr<InviwoModuleFact
 }
 
 void ModuleManager::registerModules(std::vector<ModuleContainer> inviwoModules) {
+    Clock total;
     // Topological sort to make sure that we load modules in correct order
     topologicalSort(inviwoModules);
 
@@ -122,7 +126,9 @@ void ModuleManager::registerModules(std::vector<ModuleContainer> inviwoModules)
         if (!checkDependencies(cont.factoryObject())) continue;
 
         try {
+            Clock clock;
             cont.createModule(app_);
+            timing(cont.identifier()).create = clock.getElapsedTime();
             cont.setReloadCallback(app_, [this](ModuleContainer&) { reloadModules(); });
             inviwoModules_.push_back(std::move(cont));
 
@@ -143,6 +149,7 @@ void ModuleManager::registerModules(std::vector<ModuleContainer> inviwoModules)
     }
 
     ModuleContainer::updateGraph(inviwoModules_);
+    const auto modulesTime = total.getElapsedTime();
 
     app_->postProgress("Loading Capabilities");
     for (auto& cont : inviwoModules_) {
@@ -153,8 +160,43 @@ void ModuleManager::registerModules(std::vector<ModuleContainer> inviwoModules)
             }
         }
     }
+    const auto capabilitiesTime = total.getElapsedTime() - modulesTime;
 
     onModulesDidRegister_.invoke();
+    const auto callbacksTime = total.getElapsedTime() - modulesTime - capabilitiesTime;
+
+    logTimingReport(modulesTime, capabilitiesTime, callbacksTime);
+}
+
+ModuleManager::ModuleTiming& ModuleManager::timing(std::string_view identifier) {
+    if (auto it = std::ranges::find(timings_, identifier, &ModuleTiming::identifier);
+        it != timings_.end()) {
+        return *it;
+    }
+    return timings_.emplace_back(std::string{identifier});
+}
+
+void ModuleManager::logTimingReport(Clock::duration modules, Clock::duration capabilities,
+                                    Clock::duration callbacks) const {
+    constexpr size_t nSlowest = 5;
+
+    auto sorted = timings_;
+    std::ranges::sort(sorted, std::greater<>{},
+                      [](const ModuleTiming& t) { return t.load + t.create; });
+
+    std::string slowest;
+    for (const auto& t : sorted | std::views::take(nSlowest)) {
+        fmt::format_to(std::back_inserter(slowest), "\n    {:20} load: {:>8} create: {:>8}",
+                       t.identifier, util::durationToString(t.load, false),
+                       util::durationToString(t.create, false));
+    }
+
+    log::info(
+        "Module registration: libraries {}, modules {}, capabilities {}, callbacks {}\n"
+        "  Slowest modules:{}",
+        util::durationToString(librariesTime_, false), util::durationToString(modules, false),
+        util::durationToString(capabilities, false), util::durationToString(callbacks, false),
+        slowest);
 }
 
 std::function<bool(std::string_view)> ModuleManager::getEnabledFilter() {
@@ -300,8 +342,8 @@ std::vector<ModuleContainer> ModuleManager::findRuntimeModules(
                 name.find("inviwo-core") != std::string::npos);
     };
 
-    std::vector<ModuleContainer> modules;
-
+    Clock total;
+    std::vector<std::filesystem::path> files;
     for (auto path : searchPaths) {
         // Make sure that we have an absolute path to avoid duplicates
         path = std::filesystem::weakly_canonical(path);
@@ -314,14 +356,42 @@ std::vector<ModuleContainer> ModuleManager::findRuntimeModules(
 
             if (!isEnabled(util::stripModuleFileNameDecoration(file))) continue;
 
-            try {
-                modules.emplace_back(file, runtimeReloading);
-            } catch (const Exception& e) {
-                log::warn("Could not load library: {}", file.path());
-                log::exception(e);
-            }
+            files.push_back(file.path());
+        }
+    }
+
+    // Loading a library only maps it and runs its static initializers, it does not touch any
+    // application state, hence the libraries can be loaded concurrently on the thread pool.
+    // The modules are then created in dependency order in registerModules.
+    using Loaded = std::pair<ModuleContainer, Clock::duration>;
+    const auto load = [runtimeReloading](const std::filesystem::path& file) {
+        Clock clock;
+        ModuleContainer cont{file, runtimeReloading};
+        return Loaded{std::move(cont), clock.getElapsedTime()};
+    };
+
+    std::vector<std::future<Loaded>> futures;
+    futures.reserve(files.size());
+    for (const auto& file : files) {
+        if (app_->getPoolSize() > 0) {
+            futures.push_back(app_->dispatchPool(load, file));
+        } else {
+            futures.push_back(std::async(std::launch::deferred, load, file));
+        }
+    }
+
+    std::vector<ModuleContainer> modules;
+    for (size_t i = 0; i < files.size(); ++i) {
+        try {
+            auto [cont, loadTime] = futures[i].get();
+            timing(cont.identifier()).load = loadTime;
+            modules.push_back(std::move(cont));
+        } catch (const Exception& e) {
+            log::warn("Could not load library: {}", files[i]);
+            log::exception(e);
         }
     }
+    librariesTime_ += total.getElapsedTime();
 
     return modules;
 }
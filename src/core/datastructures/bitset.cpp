@@ -31,14 +31,22 @@
 #include <inviwo/core/io/serialization/serializer.h>
 #include <inviwo/core/io/serialization/deserializer.h>
 #include <inviwo/core/algorithm/base64.h>
+#include <inviwo/core/util/parallel.h>
 
 #include <warn/push>
 #include <warn/ignore/all>
 #include <roaring/roaring.hh>
 #include <warn/pop>
 
+#include <algorithm>
+
 namespace inviwo {
 
+namespace {
+// Below this number of values adding them serially is faster than splitting the work
+constexpr size_t parallelAddThreshold = 1 << 20;
+}  // namespace
+
 BitSet::BitSetIterator::BitSetIterator() = default;
 
 BitSet::BitSetIterator::BitSetIterator(const BitSetIterator& rhs)
@@ -145,6 +153,12 @@ bool BitSet::set(const BitSet& b) {
     return true;
 }
 
+bool BitSet::set(BitSet&& b) {
+    if (operator==(b)) return false;
+    *this = std::move(b);
+    return true;
+}
+
 void BitSet::add(std::span<const uint32_t> span) { addMany(span.size(), span.data()); }
 
 void BitSet::add(const std::vector<bool>& v) {
@@ -290,7 +304,7 @@ void BitSet::readData(std::istream& is) {
         is >> numBytes;
         std::vector<char> buf(numBytes);
         is.read(buf.data(), numBytes);
-        *roaring_ = roaring::Roaring::read(buf.data(), true);
+        *roaring_ = roaring::Roaring::readSafe(buf.data(), static_cast<size_t>(is.gcount()));
     } catch (std::runtime_error&) {
         throw Exception("Error reading BitSet");
     }
@@ -314,11 +328,35 @@ void BitSet::deserialize(Deserializer& d) {
     d.deserialize("bitset", str);
 
     str = util::base64_decode(str);
-    *roaring_ = roaring::Roaring::read(str.data(), true);
+    try {
+        *roaring_ = roaring::Roaring::readSafe(str.data(), str.size());
+    } catch (std::runtime_error&) {
+        throw Exception("Error deserializing BitSet");
+    }
 }
 
 void BitSet::addSingle(uint32_t v) { roaring_->add(v); }
 
-void BitSet::addMany(size_t size, const uint32_t* data) { roaring_->addMany(size, data); }
+void BitSet::addMany(size_t size, const uint32_t* data) {
+    if (size < parallelAddThreshold || util::getPoolSize() == 0) {
+        roaring_->addMany(size, data);
+        return;
+    }
+
+    // Build one bitset per chunk of values in parallel, and merge them with a single union
+    const size_t chunks = (size + parallelAddThreshold - 1) / parallelAddThreshold;
+    std::vector<roaring::Roaring> parts(chunks);
+    util::parallelFor(0, chunks, [&](size_t chunk) {
+        const size_t first = chunk * parallelAddThreshold;
+        const size_t count = std::min(parallelAddThreshold, size - first);
+        parts[chunk].addMany(count, data + first);
+    });
+
+    std::vector<const roaring::Roaring*> inputs{roaring_.get()};
+    for (const auto& part : parts) {
+        inputs.push_back(&part);
+    }
+    *roaring_ = roaring::Roaring::fastunion(inputs.size(), inputs.data());
+}
 
 }  // namespace inviwo
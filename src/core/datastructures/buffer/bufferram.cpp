@@ -41,6 +41,14 @@ BufferRAM::BufferRAM(BufferUsage usage, BufferTarget target)
 
 std::type_index BufferRAM::getTypeIndex() const { return std::type_index(typeid(BufferRAM)); }
 
+void BufferRAM::addModifiedRegion(size_t offset, size_t extent) {
+    modified_.add(getGeneration(), {offset, extent});
+}
+
+std::optional<DirtyRegions<1>::Region> BufferRAM::getModifiedRegion(size_t generation) const {
+    return modified_.since(generation, getGeneration());
+}
+
 std::shared_ptr<BufferRAM> createBufferRAM(size_t size, const DataFormatBase* format,
                                            BufferUsage usage, BufferTarget target) {
 
@@ -28,9 +28,13 @@
  *********************************************************************************/
 
 #include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
 #include <inviwo/core/util/document.h>
 #include <inviwo/core/util/docutils.h>
 #include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/glmconvert.h>
+#include <inviwo/core/util/parallel.h>
 
 #include <fmt/format.h>
 #include <ostream>
@@ -226,6 +230,11 @@ void Mesh::reserveSizeInVertexBuffer(size_t size) {
 
 void Mesh::reserveIndexBuffers(size_t size) { indices_.reserve(size); }
 
+void Mesh::updateResource(const ResourceMeta& meta) const {
+    for (const auto& buffer : buffers_) buffer.second->updateResource(meta);
+    for (const auto& indices : indices_) indices.second->updateResource(meta);
+}
+
 const BufferBase* Mesh::getBuffer(size_t idx) const {
     if (idx >= buffers_.size()) {
         throw RangeException("Index out of range");
@@ -310,6 +319,53 @@ const IndexBuffer* Mesh::getIndices(size_t idx) const {
     return indices_[idx].second.get();
 }
 
+std::optional<std::pair<dvec3, dvec3>> Mesh::getPositionRange() const {
+    const auto it = std::find_if(buffers_.begin(), buffers_.end(), [](const auto& item) {
+        return item.first.type == BufferType::PositionAttrib;
+    });
+    if (it == buffers_.end() || it->second->getSize() == 0) return std::nullopt;
+
+    const std::shared_ptr<const BufferBase> buffer = it->second;
+    const auto generation = buffer->getGeneration();
+    {
+        const std::scoped_lock lock{positionRangeMutex_};
+        if (positionRange_ && positionRange_->generation == generation &&
+            positionRange_->buffer.lock() == buffer) {
+            return positionRange_->range;
+        }
+    }
+
+    const auto range =
+        buffer->getRepresentation<BufferRAM>()->dispatch<std::pair<dvec3, dvec3>>([](auto br) {
+            using ValueType = util::PrecisionValueType<decltype(br)>;
+            using Res = std::pair<ValueType, ValueType>;
+            const auto& data = br->getDataContainer();
+            const Res init{DataFormat<ValueType>::max(), DataFormat<ValueType>::lowest()};
+
+            const auto minmax = util::parallelReduce(
+                0, data.size(), init,
+                [&](size_t first, size_t last) {
+                    auto res = init;
+                    for (size_t i = first; i < last; ++i) {
+                        res.first = glm::min(res.first, data[i]);
+                        res.second = glm::max(res.second, data[i]);
+                    }
+                    return res;
+                },
+                [](const Res& a, const Res& b) -> Res {
+                    return {glm::min(a.first, b.first), glm::max(a.second, b.second)};
+                },
+                {.grainSize = size_t{1} << 16});
+
+            return std::pair<dvec3, dvec3>{util::glm_convert<dvec3>(minmax.first),
+                                           util::glm_convert<dvec3>(minmax.second)};
+        });
+
+    const std::scoped_lock lock{positionRangeMutex_};
+    positionRange_ = PositionRange{buffer, generation, range};
+    return range;
+}
+
 BufferBase* Mesh::getBuffer(size_t idx) {
     if (idx >= buffers_.size()) {
         throw RangeException("Index out of range");
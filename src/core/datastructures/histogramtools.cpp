@@ -31,6 +31,9 @@
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/util/zip.h>
 
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
 #include <utility>
 
 namespace inviwo {
@@ -63,6 +66,13 @@ HistogramCache& HistogramCache::operator=(HistogramCache&& that) noexcept {
 auto HistogramCache::calculateHistograms(
     const std::function<std::vector<Histogram1D>()>& calculate,
     const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const -> Result {
+    return calculateHistograms(calculate, nullptr, whenDone);
+}
+
+auto HistogramCache::calculateHistograms(
+    const std::function<std::vector<Histogram1D>()>& calculate,
+    const std::function<std::vector<Histogram1D>()>& approximate,
+    const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const -> Result {
     const std::scoped_lock lock{state_->mutex};
 
     Result result;
@@ -73,13 +83,31 @@ auto HistogramCache::calculateHistograms(
     } else if (state_->status != Status::Valid && whenDone) {
         result.handle = state_->callbacks.add(whenDone);
         result.progress = Progress::Calculating;
+        if (state_->status == Status::Approximate) {
+            whenDone(state_->histograms);
+            result.progress = Progress::Approximate;
+        }
     }
 
     if (state_->status == Status::NotSet) {
         result.progress = Progress::Calculating;
         state_->status = Status::Calculating;
-        dispatchPool([calculate, weakState = std::weak_ptr<State>(state_)]() {
+        dispatchPool([calculate, approximate, weakState = std::weak_ptr<State>(state_)]() {
             if (auto state = weakState.lock()) {
+                if (auto approximation = approximate ? approximate() : std::vector<Histogram1D>{};
+                    !approximation.empty()) {
+                    dispatchFrontAndForget([weakState = std::weak_ptr<State>(state),
+                                            approximation = std::move(approximation)]() mutable {
+                        if (auto state = weakState.lock()) {
+                            const std::scoped_lock lock{state->mutex};
+                            if (state->status != Status::Calculating) return;
+                            state->histograms = std::move(approximation);
+                            state->status = Status::Approximate;
+                            state->callbacks.invoke(state->histograms);
+                        }
+                    });
+                }
+
                 auto newHistograms = calculate();
                 dispatchFrontAndForget([weakState = std::weak_ptr<State>(state),
                                         newHistograms = std::move(newHistograms)]() mutable {
@@ -106,6 +134,11 @@ void HistogramCache::forEach(
 }
 
 void HistogramCache::discard(const std::function<std::vector<Histogram1D>()>& calculate) {
+    discard(calculate, nullptr);
+}
+
+void HistogramCache::discard(const std::function<std::vector<Histogram1D>()>& calculate,
+                             const std::function<std::vector<Histogram1D>()>& approximate) {
     bool reCalculate = false;
     std::shared_ptr<State> newState;
     {
@@ -116,7 +149,8 @@ void HistogramCache::discard(const std::function<std::vector<Histogram1D>()>& ca
         } else if (state_->status == Status::Valid) {
             state_->status = Status::NotSet;
             reCalculate = true;
-        } else if (state_->status == Status::Calculating) {
+        } else if (state_->status == Status::Calculating ||
+                   state_->status == Status::Approximate) {
             newState = std::make_shared<State>();
             newState->callbacks = std::move(state_->callbacks);
             reCalculate = true;
@@ -126,8 +160,111 @@ void HistogramCache::discard(const std::function<std::vector<Histogram1D>()>& ca
         state_ = std::move(newState);
     }
     if (reCalculate) {
-        calculateHistograms(calculate, nullptr);
+        calculateHistograms(calculate, approximate, nullptr);
+    }
+}
+
+namespace {
+
+constexpr std::uint32_t histogramsVersion = 1;
+
+class ByteWriter {
+public:
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(const T& value) {
+        const auto* begin = reinterpret_cast<const std::byte*>(&value);
+        data.insert(data.end(), begin, begin + sizeof(T));
+    }
+    template <typename T>
+    void write(const std::vector<T>& values) {
+        write(static_cast<std::uint64_t>(values.size()));
+        const auto* begin = reinterpret_cast<const std::byte*>(values.data());
+        data.insert(data.end(), begin, begin + values.size() * sizeof(T));
+    }
+    void write(const Statistics& stats) {
+        write(stats.min);
+        write(stats.max);
+        write(stats.mean);
+        write(stats.standardDeviation);
+        write(stats.percentiles);
+    }
+
+    std::vector<std::byte> data;
+};
+
+class ByteReader {
+public:
+    explicit ByteReader(std::span<const std::byte> data) : data_{data} {}
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    bool read(T& value) {
+        if (data_.size() < sizeof(T)) return false;
+        std::memcpy(&value, data_.data(), sizeof(T));
+        data_ = data_.subspan(sizeof(T));
+        return true;
+    }
+    template <typename T>
+    bool read(std::vector<T>& values) {
+        std::uint64_t size = 0;
+        if (!read(size) || size > data_.size() / sizeof(T)) return false;
+        values.resize(static_cast<size_t>(size));
+        std::memcpy(values.data(), data_.data(), values.size() * sizeof(T));
+        data_ = data_.subspan(values.size() * sizeof(T));
+        return true;
+    }
+    bool read(Statistics& stats) {
+        return read(stats.min) && read(stats.max) && read(stats.mean) &&
+               read(stats.standardDeviation) && read(stats.percentiles);
+    }
+
+    bool empty() const { return data_.empty(); }
+
+private:
+    std::span<const std::byte> data_;
+};
+
+}  // namespace
+
+std::vector<std::byte> util::serializeHistograms(const std::vector<Histogram1D>& histograms) {
+    ByteWriter writer;
+    writer.write(histogramsVersion);
+    writer.write(static_cast<std::uint64_t>(histograms.size()));
+    for (const auto& histogram : histograms) {
+        writer.write(histogram.counts);
+        writer.write(histogram.totalCounts);
+        writer.write(histogram.maxCount);
+        writer.write(histogram.underflow);
+        writer.write(histogram.overflow);
+        writer.write(histogram.dataStats);
+        writer.write(histogram.histStats);
+    }
+    return std::move(writer.data);
+}
+
+std::optional<std::vector<Histogram1D>> util::deserializeHistograms(
+    std::span<const std::byte> data, const DataMapper& dataMap) {
+    ByteReader reader{data};
+    std::uint32_t version = 0;
+    std::uint64_t size = 0;
+    if (!reader.read(version) || version != histogramsVersion || !reader.read(size)) {
+        return std::nullopt;
+    }
+
+    std::vector<Histogram1D> histograms;
+    for (std::uint64_t i = 0; i < size; ++i) {
+        auto& histogram = histograms.emplace_back();
+        histogram.dataMap = dataMap;
+        if (!(reader.read(histogram.counts) && reader.read(histogram.totalCounts) &&
+              reader.read(histogram.maxCount) && reader.read(histogram.underflow) &&
+              reader.read(histogram.overflow) && reader.read(histogram.dataStats) &&
+              reader.read(histogram.histStats))) {
+            return std::nullopt;
+        }
     }
+    if (!reader.empty()) return std::nullopt;
+    return histograms;
 }
 
 }  // namespace inviwo
@@ -248,13 +248,22 @@ auto histCalc(const Layer& v) {
     };
 }
 
+auto histApprox(const Layer& v) {
+    return [dataMap = v.dataMap, repr = v.getRepresentationShared<LayerRAM>()]() {
+        return repr->dispatch<std::vector<Histogram1D>>(
+            [&]<typename T>(const LayerRAMPrecision<T>* rp) {
+                return util::calculateApproximateHistograms(rp->getView(), dataMap, 2048);
+            });
+    };
+}
+
 }  // namespace
 
-void Layer::discardHistograms() { histograms_.discard(histCalc(*this)); }
+void Layer::discardHistograms() { histograms_.discard(histCalc(*this), histApprox(*this)); }
 
 HistogramCache::Result Layer::calculateHistograms(
     const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const {
-    return histograms_.calculateHistograms(histCalc(*this), whenDone);
+    return histograms_.calculateHistograms(histCalc(*this), histApprox(*this), whenDone);
 }
 
 Document util::layerInfo(const Layer& layer) {
@@ -47,6 +47,14 @@ bool LayerRAM::copyRepresentationsTo(LayerRepresentation* targetLayerRam) const
 
 std::type_index LayerRAM::getTypeIndex() const { return std::type_index(typeid(LayerRAM)); }
 
+void LayerRAM::addModifiedRegion(const size2_t& offset, const size2_t& extent) {
+    modified_.add(getGeneration(), {offset, extent});
+}
+
+std::optional<DirtyRegions<2>::Region> LayerRAM::getModifiedRegion(size_t generation) const {
+    return modified_.since(generation, getGeneration());
+}
+
 std::shared_ptr<LayerRAM> createLayerRAM(const size2_t& dimensions, LayerType type,
                                          const DataFormatBase* format,
                                          const SwizzleMask& swizzleMask,
@@ -29,25 +29,166 @@
 
 #include <inviwo/core/datastructures/tflookuptable.h>
 
+#include <inviwo/core/util/hashcombine.h>
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace inviwo {
 
-TFLookupTable::TFLookupTable(size_t size) : size_{size}, repr_{nullptr}, data_{nullptr} {}
+namespace {
+
+/**
+ * All baked tables, keyed by their content. Only weak references are kept such that a table is
+ * released as soon as the last lookup table using it is gone.
+ */
+struct Registry {
+    std::mutex mutex;
+    std::unordered_map<size_t, std::weak_ptr<Layer>> tables;
+};
+
+Registry& registry() {
+    static Registry registry;
+    return registry;
+}
+
+size_t contentKey(const TransferFunction& tf, size_t size, TFLookupTable::Type type) {
+    size_t seed = 0;
+    util::hash_combine(seed, size);
+    util::hash_combine(seed, type);
+    util::hash_combine(seed, tf.getType());
+    util::hash_combine(seed, tf.getMaskMin());
+    util::hash_combine(seed, tf.getMaskMax());
+    for (size_t i = 0; i < tf.size(); ++i) {
+        util::hash_combine(seed, tf[i].getPosition());
+        const auto& color = tf[i].getColor();
+        for (glm::length_t c = 0; c < 4; ++c) {
+            util::hash_combine(seed, color[c]);
+        }
+    }
+    return seed;
+}
+
+size2_t tableDims(size_t size, TFLookupTable::Type type) {
+    return type == TFLookupTable::Type::PreIntegrated ? size2_t{size, size} : size2_t{size, 1};
+}
+
+/**
+ * Pre-integrate the transfer function over all pairs of front and back scalar values. The opacity
+ * of the TF is interpreted as the opacity of one reference sampling step, the corresponding
+ * extinction is integrated along the segment using the trapezoidal rule and the color is the
+ * extinction weighted average of the colors along the segment.
+ */
+void preIntegrate(const TransferFunction& tf, size_t size, std::span<vec4> out) {
+    std::vector<vec4> colors(size);
+    tf.interpolateAndStoreColors(colors);
+
+    const auto extinction = [&](size_t i) {
+        return -std::log(std::max(1.0 - static_cast<double>(colors[i].a), 1.0e-6));
+    };
+
+    // Prefix integrals of the extinction and the extinction weighted color
+    std::vector<double> tau(size, 0.0);
+    std::vector<dvec3> color(size, dvec3{0.0});
+    for (size_t i = 1; i < size; ++i) {
+        const auto t0 = extinction(i - 1);
+        const auto t1 = extinction(i);
+        tau[i] = tau[i - 1] + 0.5 * (t0 + t1);
+        color[i] = color[i - 1] + 0.5 * (t0 * dvec3{colors[i - 1]} + t1 * dvec3{colors[i]});
+    }
+
+    for (size_t back = 0; back < size; ++back) {
+        for (size_t front = 0; front < size; ++front) {
+            auto& texel = out[back * size + front];
+            if (front == back) {
+                texel = colors[front];
+                continue;
+            }
+            const auto [lo, hi] = std::minmax(front, back);
+            const auto integral = tau[hi] - tau[lo];
+            const auto meanTau = integral / static_cast<double>(hi - lo);
+            const auto rgb = integral > 0.0 ? (color[hi] - color[lo]) / integral
+                                            : 0.5 * (dvec3{colors[lo]} + dvec3{colors[hi]});
+            texel = vec4{vec3{rgb}, static_cast<float>(1.0 - std::exp(-meanTau))};
+        }
+    }
+}
+
+void bake(const TransferFunction& tf, size_t size, TFLookupTable::Type type, std::span<vec4> out) {
+    if (type == TFLookupTable::Type::PreIntegrated) {
+        preIntegrate(tf, size, out);
+    } else {
+        tf.interpolateAndStoreColors(out);
+    }
+}
+
+}  // namespace
+
+TFLookupTable::TFLookupTable(size_t size, Type type)
+    : size_{size}, type_{type}, key_{0}, data_{nullptr} {}
 
 void TFLookupTable::setSize(size_t size) { size_ = size; }
 size_t TFLookupTable::getSize() const { return size_; }
+auto TFLookupTable::getType() const -> Type { return type_; }
+
+std::shared_ptr<const Layer> TFLookupTable::getLayer() const { return data_; }
 
 void TFLookupTable::calculate(const TransferFunction& tf) {
-    if (!repr_) {
-        repr_ = std::make_shared<LayerRAMPrecision<vec4>>(size2_t{size_, 1});
-    }
-    if (repr_->getDimensions().x != size_) {
-        repr_->setDimensions(size2_t{size_, 1});
+    const auto key = contentKey(tf, size_, type_);
+    if (data_ && key == key_) return;
+
+    auto& [mutex, tables] = registry();
+    const std::scoped_lock lock{mutex};
+
+    if (auto it = tables.find(key); it != tables.end()) {
+        if (auto shared = it->second.lock()) {
+            data_ = std::move(shared);
+            key_ = key;
+            return;
+        }
     }
-    if (!data_) {
-        data_ = std::make_unique<Layer>(repr_);
+
+    const auto dims = tableDims(size_, type_);
+    std::vector<vec4> baked(dims.x * dims.y);
+    bake(tf, size_, type_, baked);
+
+    if (data_ && data_.use_count() == 1 && data_->getDimensions() == dims) {
+        // Nobody else is using our table, update the texels that changed in place.
+        tables.erase(key_);
+
+        const auto* texels =
+            static_cast<const vec4*>(data_->getRepresentation<LayerRAM>()->getData());
+        size2_t lo{dims};
+        size2_t hi{0};
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                if (texels[y * dims.x + x] != baked[y * dims.x + x]) {
+                    lo = glm::min(lo, size2_t{x, y});
+                    hi = glm::max(hi, size2_t{x + 1, y + 1});
+                }
+            }
+        }
+        if (lo.x < hi.x) {
+            auto* ram = data_->getEditableRepresentation<LayerRAM>();
+            auto* dst = static_cast<vec4*>(ram->getData());
+            for (size_t y = lo.y; y < hi.y; ++y) {
+                std::copy(baked.begin() + (y * dims.x + lo.x), baked.begin() + (y * dims.x + hi.x),
+                          dst + (y * dims.x + lo.x));
+            }
+            ram->addModifiedRegion(lo, hi - lo);
+        }
+    } else {
+        auto repr = std::make_shared<LayerRAMPrecision<vec4>>(dims);
+        std::ranges::copy(baked, repr->getView().begin());
+        data_ = std::make_shared<Layer>(repr);
     }
-    tf.interpolateAndStoreColors(repr_->getView());
-    data_->invalidateAllOther(repr_.get());
+
+    std::erase_if(tables, [](const auto& item) { return item.second.expired(); });
+    tables[key] = data_;
+    key_ = key;
 }
 
 }  // namespace inviwo
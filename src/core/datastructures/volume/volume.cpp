@@ -29,9 +29,14 @@
 
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
 #include <inviwo/core/algorithm/histogram1d.h>
+#include <inviwo/core/io/sessioncache.h>
 #include <inviwo/core/util/document.h>
 
+#include <optional>
+#include <utility>
+
 #include <fmt/format.h>
 
 namespace inviwo {
@@ -239,22 +244,90 @@ VolumeConfig Volume::config() const {
 
 namespace {
 
-auto histCalc(const Volume& v) {
-    return [dataMap = v.dataMap, repr = v.getRepresentationShared<VolumeRAM>()]() {
+using HistogramFunctor = std::function<std::vector<Histogram1D>()>;
+
+// Histograms of volumes read from disk are kept in the session cache when it is enabled
+std::optional<std::uint64_t> histKey(const Volume& v) {
+    if (!util::getSessionCache()) return std::nullopt;
+    const auto& dm = v.dataMap;
+    return util::sessionCacheKey(
+        v, fmt::format("histograms 2048 {} {} {} {}", dm.dataRange.x, dm.dataRange.y,
+                       dm.valueRange.x, dm.valueRange.y));
+}
+
+std::optional<std::vector<Histogram1D>> loadHistograms(std::optional<std::uint64_t> key,
+                                                       const DataMapper& dataMap) {
+    if (!key) return std::nullopt;
+    auto* cache = util::getSessionCache();
+    if (!cache) return std::nullopt;
+    if (auto mapped = cache->load(*key)) {
+        return util::deserializeHistograms(mapped->view(), dataMap);
+    }
+    return std::nullopt;
+}
+
+void storeHistograms(std::optional<std::uint64_t> key, const std::vector<Histogram1D>& hists) {
+    if (!key) return;
+    if (auto* cache = util::getSessionCache()) {
+        cache->store(*key, util::serializeHistograms(hists));
+    }
+}
+
+std::vector<Histogram1D> calcHistograms(const VolumeRAM& repr, const DataMapper& dataMap) {
+    return repr.dispatch<std::vector<Histogram1D>>(
+        [&dataMap]<typename T>(const VolumeRAMPrecision<T>* rp) {
+            return util::calculateHistograms(rp->getView(), dataMap, 2048);
+        });
+}
+
+std::pair<HistogramFunctor, HistogramFunctor> histFunctors(const Volume& v) {
+    const auto key = histKey(v);
+
+    if (key && !v.hasValidRepresentation<VolumeRAM>()) {
+        // Only read the data if the histograms are not in the session cache. The data is read
+        // from disk without adding it to the volume, it is loaded again once used.
+        auto calc = [key, dataMap = v.dataMap, disk = v.getRepresentationShared<VolumeDisk>()]() {
+            if (auto cached = loadHistograms(key, dataMap)) return std::move(*cached);
+            const auto ram =
+                std::dynamic_pointer_cast<const VolumeRAM>(disk->createRepresentation());
+            if (!ram) return std::vector<Histogram1D>{};
+            auto hists = calcHistograms(*ram, dataMap);
+            storeHistograms(key, hists);
+            return hists;
+        };
+        return {calc, nullptr};
+    }
+
+    auto calc = [key, dataMap = v.dataMap, repr = v.getRepresentationShared<VolumeRAM>()]() {
+        if (auto cached = loadHistograms(key, dataMap)) return std::move(*cached);
+        auto hists = calcHistograms(*repr, dataMap);
+        storeHistograms(key, hists);
+        return hists;
+    };
+    auto approx = [key, dataMap = v.dataMap, repr = v.getRepresentationShared<VolumeRAM>()]() {
+        // Cached histograms are exact and cheap to load, skip the approximation
+        if (key && util::getSessionCache() && util::getSessionCache()->load(*key)) {
+            return std::vector<Histogram1D>{};
+        }
         return repr->dispatch<std::vector<Histogram1D>>(
-            [dataMap]<typename T>(const VolumeRAMPrecision<T>* rp) {
-                return util::calculateHistograms(rp->getView(), dataMap, 2048);
+            [&dataMap]<typename T>(const VolumeRAMPrecision<T>* rp) {
+                return util::calculateApproximateHistograms(rp->getView(), dataMap, 2048);
             });
     };
+    return {calc, approx};
 }
 
 }  // namespace
 
-void Volume::discardHistograms() { histograms_.discard(histCalc(*this)); }
+void Volume::discardHistograms() {
+    auto [calc, approx] = histFunctors(*this);
+    histograms_.discard(calc, approx);
+}
 
 HistogramCache::Result Volume::calculateHistograms(
     const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const {
-    return histograms_.calculateHistograms(histCalc(*this), whenDone);
+    auto [calc, approx] = histFunctors(*this);
+    return histograms_.calculateHistograms(calc, approx, whenDone);
 }
 
 template class IVW_CORE_TMPL_INST DataReaderType<Volume>;
@@ -0,0 +1,235 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/util/brickiterator.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/glmconvert.h>
+#include <inviwo/core/util/glmutils.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <cstdio>
+
+namespace inviwo {
+
+class VolumeBricked::Storage {
+public:
+    Storage(util::TempFileHandle&& file, size_t size)
+        : file_{std::move(file)}, mapping_{file_.getFileName(), 0, size} {}
+
+    std::span<const std::byte> view() const { return mapping_.view(); }
+
+private:
+    util::TempFileHandle file_;  // Has to outlive the mapping
+    util::MemoryMappedFile mapping_;
+};
+
+namespace {
+
+std::vector<VolumeBricked::Level> createLevels(size3_t dims, size_t brickSize) {
+    std::vector<VolumeBricked::Level> levels;
+    size_t firstBrick = 0;
+    while (true) {
+        const auto bricks = (dims + size3_t{brickSize - 1}) / size3_t{brickSize};
+        levels.push_back({dims, bricks, firstBrick});
+        firstBrick += glm::compMul(bricks);
+        if (bricks == size3_t{1}) break;
+        dims = glm::max((dims + size3_t{1}) / size3_t{2}, size3_t{1});
+    }
+    return levels;
+}
+
+// Box filter the level above, voxels outside of the source are clamped to the border
+template <typename T>
+std::vector<T> downsample(std::span<const T> src, size3_t srcDims, size3_t dstDims) {
+    using P = util::same_extent_t<T, double>;
+
+    std::vector<T> dst(glm::compMul(dstDims));
+    const util::IndexMapper3D srcIm{srcDims};
+    const util::IndexMapper3D dstIm{dstDims};
+    for (size_t z = 0; z < dstDims.z; ++z) {
+        for (size_t y = 0; y < dstDims.y; ++y) {
+            for (size_t x = 0; x < dstDims.x; ++x) {
+                const size3_t pos{x, y, z};
+                P sum{0};
+                for (size_t i = 0; i < 8; ++i) {
+                    const size3_t offset{i & 1u, (i >> 1) & 1u, (i >> 2) & 1u};
+                    const size3_t p = size_t{2} * pos + offset;
+                    sum += util::glm_convert<P>(src[srcIm(glm::min(p, srcDims - size3_t{1}))]);
+                }
+                dst[dstIm(pos)] = util::glm_convert<T>(sum / 8.0);
+            }
+        }
+    }
+    return dst;
+}
+
+// Extract a brick including the apron, voxels outside of the level are clamped to the border
+template <typename T>
+void extractBrick(std::span<const T> level, size3_t levelDims, size3_t brick, size_t brickSize,
+                  std::span<T> dst) {
+    const auto storedDims = size3_t{brickSize + 2 * VolumeBricked::apron};
+    const auto origin = glm::i64vec3{brick * brickSize} - glm::i64vec3{VolumeBricked::apron};
+    const auto lower = size3_t{glm::max(origin, glm::i64vec3{0})};
+    const auto upper = glm::min(size3_t{origin + glm::i64vec3{storedDims}}, levelDims);
+
+    const util::IndexMapper3D storedIm{storedDims};
+    const auto local = [&](size3_t pos) {
+        return size3_t{glm::i64vec3{pos} - origin};
+    };
+
+    util::BrickIterator it{level.begin(), levelDims, lower, upper - lower};
+    for (const auto end = it.end(); it != end; ++it) {
+        dst[storedIm(local(it.globalPos()))] = *it;
+    }
+
+    // Replicate the border voxels into the parts of the brick that are outside of the level
+    if (glm::any(glm::lessThan(upper - lower, storedDims))) {
+        for (size_t z = 0; z < storedDims.z; ++z) {
+            for (size_t y = 0; y < storedDims.y; ++y) {
+                for (size_t x = 0; x < storedDims.x; ++x) {
+                    const auto pos = origin + glm::i64vec3{x, y, z};
+                    const auto clamped =
+                        glm::clamp(pos, glm::i64vec3{lower}, glm::i64vec3{upper - size3_t{1}});
+                    if (pos != clamped) {
+                        dst[storedIm(x, y, z)] = dst[storedIm(local(size3_t{clamped}))];
+                    }
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+VolumeBricked::VolumeBricked(const VolumeRAM& volume, size_t brickSize)
+    : VolumeRepresentation{}
+    , dataFormatBase_{volume.getDataFormat()}
+    , dimensions_{volume.getDimensions()}
+    , swizzleMask_{volume.getSwizzleMask()}
+    , interpolation_{volume.getInterpolation()}
+    , wrapping_{volume.getWrapping()}
+    , brickSize_{brickSize}
+    , levels_{createLevels(dimensions_, brickSize)}
+    , storage_{} {
+
+    util::TempFileHandle file{"bricks", ".raw"};
+
+    volume.dispatch<void>([&]<typename T>(const VolumeRAMPrecision<T>* ram) {
+        std::vector<T> brick(glm::compMul(getStoredBrickDimensions()));
+
+        std::vector<T> current;
+        std::span<const T> level = ram->getView();
+        for (size_t l = 0; l < levels_.size(); ++l) {
+            if (l > 0) {
+                current = downsample(level, levels_[l - 1].dimensions, levels_[l].dimensions);
+                level = current;
+            }
+
+            const auto& bricks = levels_[l].bricks;
+            for (size_t z = 0; z < bricks.z; ++z) {
+                for (size_t y = 0; y < bricks.y; ++y) {
+                    for (size_t x = 0; x < bricks.x; ++x) {
+                        extractBrick<T>(level, levels_[l].dimensions, size3_t{x, y, z},
+                                        brickSize_, brick);
+                        if (std::fwrite(brick.data(), sizeof(T), brick.size(), file) !=
+                            brick.size()) {
+                            throw Exception(SourceContext{}, "Unable to write brick file {:?g}",
+                                            file.getFileName());
+                        }
+                    }
+                }
+            }
+        }
+    });
+    std::fflush(file);
+
+    storage_ = std::make_shared<const Storage>(std::move(file),
+                                               getNumberOfBricks() * getStoredBrickSizeInBytes());
+}
+
+VolumeBricked* VolumeBricked::clone() const { return new VolumeBricked(*this); }
+
+std::type_index VolumeBricked::getTypeIndex() const {
+    return std::type_index(typeid(VolumeBricked));
+}
+
+const DataFormatBase* VolumeBricked::getDataFormat() const { return dataFormatBase_; }
+
+void VolumeBricked::setDimensions(size3_t) {
+    throw Exception("Can not set dimension of a bricked volume");
+}
+
+const size3_t& VolumeBricked::getDimensions() const { return dimensions_; }
+
+void VolumeBricked::setSwizzleMask(const SwizzleMask& mask) { swizzleMask_ = mask; }
+
+SwizzleMask VolumeBricked::getSwizzleMask() const { return swizzleMask_; }
+
+void VolumeBricked::setInterpolation(InterpolationType interpolation) {
+    interpolation_ = interpolation;
+}
+
+InterpolationType VolumeBricked::getInterpolation() const { return interpolation_; }
+
+void VolumeBricked::setWrapping(const Wrapping3D& wrapping) { wrapping_ = wrapping; }
+
+Wrapping3D VolumeBricked::getWrapping() const { return wrapping_; }
+
+size_t VolumeBricked::getBrickSize() const { return brickSize_; }
+
+size3_t VolumeBricked::getStoredBrickDimensions() const { return size3_t{brickSize_ + 2 * apron}; }
+
+size_t VolumeBricked::getStoredBrickSizeInBytes() const {
+    return glm::compMul(getStoredBrickDimensions()) * dataFormatBase_->getSizeInBytes();
+}
+
+auto VolumeBricked::getLevels() const -> const std::vector<Level>& { return levels_; }
+
+size_t VolumeBricked::getNumberOfBricks() const {
+    return levels_.back().firstBrick + glm::compMul(levels_.back().bricks);
+}
+
+size_t VolumeBricked::getBrickIndex(size_t level, size3_t brick) const {
+    const auto& l = levels_[level];
+    return l.firstBrick + util::IndexMapper3D{l.bricks}(brick);
+}
+
+std::span<const std::byte> VolumeBricked::getBrick(size_t index) const {
+    return storage_->view().subspan(index * getStoredBrickSizeInBytes(),
+                                    getStoredBrickSizeInBytes());
+}
+
+}  // namespace inviwo
@@ -34,6 +34,14 @@ namespace inviwo {
 
 std::type_index VolumeRAM::getTypeIndex() const { return std::type_index(typeid(VolumeRAM)); }
 
+void VolumeRAM::addModifiedRegion(const size3_t& offset, const size3_t& extent) {
+    modified_.add(getGeneration(), {offset, extent});
+}
+
+std::optional<DirtyRegions<3>::Region> VolumeRAM::getModifiedRegion(size_t generation) const {
+    return modified_.since(generation, getGeneration());
+}
+
 std::shared_ptr<VolumeRAM> createVolumeRAM(const size3_t& dimensions, const DataFormatBase* format,
                                            void* dataPtr, const SwizzleMask& swizzleMask,
                                            InterpolationType interpolation,
@@ -0,0 +1,68 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/interaction/interactionstate.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+
+namespace inviwo {
+
+InteractionState::InteractionState(TimerThread& thread, Milliseconds idleDelay)
+    : interacting_{false}, idle_{idleDelay, [this]() { setInteracting(false); }, thread} {}
+
+InteractionState::~InteractionState() = default;
+
+void InteractionState::touch() {
+    idle_.start();
+    setInteracting(true);
+}
+
+bool InteractionState::isInteracting() const { return interacting_; }
+
+void InteractionState::setIdleDelay(Milliseconds delay) { idle_.setDefaultDelay(delay); }
+
+auto InteractionState::getIdleDelay() const -> Milliseconds { return idle_.getDefaultDelay(); }
+
+DispatcherHandle<void(bool)> InteractionState::onChange(std::function<void(bool)> callback) {
+    return onChange_.add(std::move(callback));
+}
+
+void InteractionState::setInteracting(bool interacting) {
+    if (interacting_ == interacting) return;
+    interacting_ = interacting;
+    onChange_.invoke(interacting_);
+}
+
+void util::touchInteractionState() {
+    if (auto* app = InviwoApplication::getPtr()) {
+        app->getInteractionState().touch();
+    }
+}
+
+}  // namespace inviwo
@@ -46,11 +46,8 @@ PickingAction* PickingManager::registerPickingAction(Processor* processor,
     PickingAction* pickObj = nullptr;
 
     // Find the smallest object with capacity >= size
-    auto it = std::lower_bound(unusedObjects_.begin(), unusedObjects_.end(), size,
-                               [](PickingAction* p, size_t s) { return p->getCapacity() < s; });
-
-    if (it != unusedObjects_.end()) {
-        pickObj = *it;
+    if (auto it = unusedObjects_.lower_bound({size, nullptr}); it != unusedObjects_.end()) {
+        pickObj = const_cast<PickingAction*>(it->second);
         unusedObjects_.erase(it);
         pickObj->setSize(size);
     }
@@ -65,52 +62,41 @@ PickingAction* PickingManager::registerPickingAction(Processor* processor,
                       (1 << 24));
         }
         pickObj = pickingActions_.back().get();
+        registered_.insert(pickObj);
     }
     pickObj->setAction(std::move(action));
     pickObj->setProcessor(processor);
     return pickObj;
 }
 
+void PickingManager::popPickingAction() {
+    lastIndex_ -= pickingActions_.back()->getCapacity();
+    registered_.erase(pickingActions_.back().get());
+    pickingActions_.pop_back();
+}
+
 bool PickingManager::unregisterPickingAction(const PickingAction* p) {
-    auto it1 = std::find(unusedObjects_.begin(), unusedObjects_.end(), p);
-    if (it1 == unusedObjects_.end()) {
-
-        auto it2 = util::find_if(
-            pickingActions_, [p](const std::unique_ptr<PickingAction>& o) { return p == o.get(); });
-
-        if (!pickingActions_.empty() && it2 == pickingActions_.end() - 1) {
-            // unregistering the last picking action, don't put it into unused and perform clean-up
-            lastIndex_ -= (*it2)->getCapacity();
-            pickingActions_.pop_back();
-
-            // clean-up unused queue
-            while (!pickingActions_.empty()) {
-                auto it = std::find(unusedObjects_.begin(), unusedObjects_.end(),
-                                    pickingActions_.back().get());
-                if (it == unusedObjects_.end()) {
-                    break;
-                }
-                unusedObjects_.erase(it);
-                lastIndex_ -= pickingActions_.back()->getCapacity();
-                pickingActions_.pop_back();
-            }
-            return true;
-        } else if (it2 != pickingActions_.end()) {
-            (*it2)->setAction(nullptr);
-            (*it2)->setProcessor(nullptr);
-
-            auto insit = std::upper_bound(unusedObjects_.begin(), unusedObjects_.end(),
-                                          (*it2)->getCapacity(),
-                                          [](const size_t& capacity, PickingAction* po) {
-                                              return capacity < po->getCapacity();
-                                          });
-
-            unusedObjects_.insert(insit, (*it2).get());
-            return true;
+    if (!registered_.contains(p)) return false;
+    if (unusedObjects_.contains({p->getCapacity(), p})) return false;
+
+    if (p == pickingActions_.back().get()) {
+        // unregistering the last picking action, don't put it into unused and perform clean-up
+        popPickingAction();
+
+        // clean-up unused queue
+        while (!pickingActions_.empty() &&
+               unusedObjects_.erase(
+                   {pickingActions_.back()->getCapacity(), pickingActions_.back().get()}) > 0) {
+            popPickingAction();
         }
+    } else {
+        // All actions are owned by the manager, so it is fine to modify it here
+        auto* action = const_cast<PickingAction*>(p);
+        action->setAction(nullptr);
+        action->setProcessor(nullptr);
+        unusedObjects_.emplace(p->getCapacity(), p);
     }
-
-    return false;
+    return true;
 }
 
 const PickingAction* PickingManager::getPickingActionFromIndex(size_t index) const {
@@ -149,8 +135,7 @@ bool PickingManager::pickingEnabled() {
 }
 
 bool PickingManager::isPickingActionRegistered(const PickingAction* action) const {
-    return std::any_of(pickingActions_.begin(), pickingActions_.end(),
-                       [&](auto& item) { return item.get() == action; });
+    return registered_.contains(action);
 }
 
 // First the left four bits are swapped with the right four bits.
@@ -35,6 +35,7 @@
 #include <inviwo/core/interaction/events/resizeevent.h>
 #include <inviwo/core/interaction/events/touchevent.h>
 #include <inviwo/core/interaction/trackballobject.h>
+#include <inviwo/core/interaction/interactionstate.h>
 #include <inviwo/core/util/intersection/raysphereintersection.h>
 #include <inviwo/core/util/foreacharg.h>
 #include <inviwo/core/common/inviwoapplication.h>
@@ -247,7 +248,9 @@ void Trackball::setTrackballObject(TrackballObject* obj) { object_ = obj; }
 
 void Trackball::invokeEvent(Event* event) {
     if (!handleInteractionEvents_) return;
+    const bool used = event->hasBeenUsed();
     CompositeProperty::invokeEvent(event);
+    if (!used && event->hasBeenUsed()) util::touchInteractionState();
 }
 
 const vec3 Trackball::getLookTo() const { return object_->getLookTo(); }
@@ -1027,6 +1030,7 @@ void Trackball::animate() {
     if (this->evaluated_) {
         this->evaluated_ = false;
         dispatchFront([this]() {
+            util::touchInteractionState();
             const glm::quat identity(1.0f, 0.0f, 0.0f, 0.0f);
             const float t = 0.1f;
             const float dot = glm::dot(lastRot_, identity);
@@ -33,12 +33,15 @@
 #include <inviwo/core/util/filesystem.h>
 #include <inviwo/core/io/curlutils.h>
 #include <inviwo/core/io/inviwofileformattypes.h>
+#include <inviwo/core/util/glmfmt.h>
 
 #include <bxzstr/bxzstr.hpp>
 
 #include <fmt/format.h>
 #include <fmt/std.h>
+#include <glm/gtx/component_wise.hpp>
 
+#include <fstream>
 #include <memory>
 
 namespace inviwo {
@@ -95,4 +98,41 @@ void util::readCompressedBytesIntoBuffer(const std::filesystem::path& path, size
     }
 }
 
+void util::readRegionIntoBuffer(const std::filesystem::path& path, size_t offset, size3_t dims,
+                                size3_t regionOffset, size3_t regionDims, ByteOrder byteOrder,
+                                size_t elementSize, void* dest) {
+    if (glm::any(glm::greaterThan(regionOffset + regionDims, dims))) {
+        throw DataReaderException(SourceContext{}, "Region {} + {} is outside of the volume {}",
+                                  regionOffset, regionDims, dims);
+    }
+    const auto filePath = net::downloadAndCacheIfUrl(path);
+
+    std::ifstream file{filePath, std::ios::in | std::ios::binary};
+    if (!file) {
+        throw DataReaderException(SourceContext{}, "Could not open file: {:?g}", path);
+    }
+
+    const bool fullRows = regionOffset.x == 0 && regionDims.x == dims.x;
+    const size_t rows = fullRows ? 1 : regionDims.y;
+    const size_t readBytes = regionDims.x * (fullRows ? regionDims.y : 1) * elementSize;
+
+    auto* dst = static_cast<char*>(dest);
+    for (size_t z = 0; z < regionDims.z; ++z) {
+        for (size_t y = 0; y < rows; ++y) {
+            const size_t index =
+                regionOffset.x + dims.x * (regionOffset.y + y + dims.y * (regionOffset.z + z));
+            file.seekg(static_cast<std::streamoff>(offset + index * elementSize));
+            file.read(dst, static_cast<std::streamsize>(readBytes));
+            if (!file) {
+                throw DataReaderException(SourceContext{}, "Could not read from file: {:?g}",
+                                          path);
+            }
+            dst += readBytes;
+        }
+    }
+    if (byteOrder == ByteOrder::BigEndian && elementSize > 1) {
+        util::reverseByteOrder(dest, glm::compMul(regionDims) * elementSize, elementSize);
+    }
+}
+
 }  // namespace inviwo
@@ -0,0 +1,348 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/chunkedvolumefile.h>
+
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/bytereaderutil.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/glmfmt.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/parallel.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+#include <fmt/std.h>
+#include <glm/gtx/component_wise.hpp>
+#include <zlib.h>
+
+namespace inviwo::util {
+
+namespace {
+
+constexpr std::array<char, 4> magic{'I', 'V', 'C', 'V'};
+constexpr std::uint32_t version = 1;
+
+struct Header {
+    std::array<char, 4> magic;
+    std::uint32_t version;
+    std::array<std::uint64_t, 3> dimensions;
+    std::array<std::uint64_t, 3> chunkDimensions;
+    std::uint32_t elementSize;
+    ChunkCodec codec;
+    std::uint8_t shuffle;
+    ByteOrder byteOrder;
+    std::uint8_t reserved;
+    std::uint64_t chunks;
+};
+static_assert(sizeof(Header) == 72);
+
+constexpr ByteOrder nativeByteOrder =
+    std::endian::native == std::endian::little ? ByteOrder::LittleEndian : ByteOrder::BigEndian;
+
+struct Region {
+    size3_t offset;
+    size3_t dimensions;
+};
+
+Region chunkRegion(size_t index, size3_t dimensions, size3_t chunkDimensions) {
+    const auto grid = (dimensions + chunkDimensions - size3_t{1}) / chunkDimensions;
+    const auto offset = util::IndexMapper3D{grid}(index) * chunkDimensions;
+    return {offset, glm::min(chunkDimensions, dimensions - offset)};
+}
+
+// Copy the box [srcOffset, srcOffset + extent) of src to dstOffset in dst
+void copyRegion(std::span<const std::byte> src, size3_t srcDims, size3_t srcOffset,
+                std::span<std::byte> dst, size3_t dstDims, size3_t dstOffset, size3_t extent,
+                size_t elementSize) {
+    const util::IndexMapper3D srcIm{srcDims};
+    const util::IndexMapper3D dstIm{dstDims};
+    const auto rowBytes = extent.x * elementSize;
+    for (size_t z = 0; z < extent.z; ++z) {
+        for (size_t y = 0; y < extent.y; ++y) {
+            const auto s = srcIm(srcOffset + size3_t{0, y, z}) * elementSize;
+            const auto d = dstIm(dstOffset + size3_t{0, y, z}) * elementSize;
+            std::memcpy(dst.data() + d, src.data() + s, rowBytes);
+        }
+    }
+}
+
+// Store byte b of element i at b * count + i
+void shuffleBytes(std::span<const std::byte> src, std::span<std::byte> dst, size_t elementSize) {
+    const size_t count = src.size() / elementSize;
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t b = 0; b < elementSize; ++b) {
+            dst[b * count + i] = src[i * elementSize + b];
+        }
+    }
+}
+
+void unshuffleBytes(std::span<const std::byte> src, std::span<std::byte> dst,
+                    size_t elementSize) {
+    const size_t count = src.size() / elementSize;
+    for (size_t b = 0; b < elementSize; ++b) {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i * elementSize + b] = src[b * count + i];
+        }
+    }
+}
+
+std::vector<std::byte> encode(std::span<const std::byte> chunk, size_t elementSize,
+                              const ChunkedVolumeSettings& settings,
+                              std::vector<std::byte>& buffer) {
+    if (settings.shuffle && elementSize > 1) {
+        buffer.resize(chunk.size());
+        shuffleBytes(chunk, buffer, elementSize);
+        chunk = buffer;
+    }
+
+    switch (settings.codec) {
+        case ChunkCodec::None:
+            return {chunk.begin(), chunk.end()};
+        case ChunkCodec::Deflate: {
+            auto size = compressBound(static_cast<uLong>(chunk.size()));
+            std::vector<std::byte> compressed(size);
+            if (compress2(reinterpret_cast<Bytef*>(compressed.data()), &size,
+                          reinterpret_cast<const Bytef*>(chunk.data()),
+                          static_cast<uLong>(chunk.size()), settings.level) != Z_OK) {
+                throw DataWriterException(SourceContext{}, "Unable to compress volume chunk");
+            }
+            compressed.resize(size);
+            return compressed;
+        }
+    }
+    throw DataWriterException(SourceContext{}, "Invalid chunk codec {}",
+                              static_cast<int>(settings.codec));
+}
+
+}  // namespace
+
+std::string_view enumToStr(ChunkCodec codec) {
+    switch (codec) {
+        case ChunkCodec::None:
+            return "None";
+        case ChunkCodec::Deflate:
+            return "Deflate";
+    }
+    throw Exception{SourceContext{}, "Found invalid ChunkCodec enum value '{}'",
+                    static_cast<int>(codec)};
+}
+
+void writeChunkedVolume(const std::filesystem::path& path, const VolumeRAM& volume,
+                        const ChunkedVolumeSettings& settings) {
+    const auto dims = volume.getDimensions();
+    const auto elementSize = volume.getDataFormat()->getSizeInBytes();
+    const auto chunkDims = glm::max(glm::min(settings.chunkDimensions, dims), size3_t{1});
+    const auto grid = (dims + chunkDims - size3_t{1}) / chunkDims;
+    const size_t count = glm::compMul(grid);
+
+    const std::span<const std::byte> data{static_cast<const std::byte*>(volume.getData()),
+                                          glm::compMul(dims) * elementSize};
+
+    std::vector<std::vector<std::byte>> chunks(count);
+    util::parallelFor(0, count, [&](size_t first, size_t last) {
+        std::vector<std::byte> dense;
+        std::vector<std::byte> buffer;
+        for (size_t i = first; i < last; ++i) {
+            const auto region = chunkRegion(i, dims, chunkDims);
+            dense.resize(glm::compMul(region.dimensions) * elementSize);
+            copyRegion(data, dims, region.offset, dense, region.dimensions, size3_t{0},
+                       region.dimensions, elementSize);
+            chunks[i] = encode(dense, elementSize, settings, buffer);
+        }
+    });
+
+    const Header header{.magic = magic,
+                        .version = version,
+                        .dimensions = {dims.x, dims.y, dims.z},
+                        .chunkDimensions = {chunkDims.x, chunkDims.y, chunkDims.z},
+                        .elementSize = static_cast<std::uint32_t>(elementSize),
+                        .codec = settings.codec,
+                        .shuffle = static_cast<std::uint8_t>(settings.shuffle && elementSize > 1),
+                        .byteOrder = nativeByteOrder,
+                        .reserved = 0,
+                        .chunks = count};
+
+    std::vector<std::uint64_t> offsets(count + 1);
+    offsets[0] = sizeof(Header) + offsets.size() * sizeof(std::uint64_t);
+    for (size_t i = 0; i < count; ++i) offsets[i + 1] = offsets[i] + chunks[i].size();
+
+    std::ofstream out{path, std::ios::binary | std::ios::trunc};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    out.write(reinterpret_cast<const char*>(offsets.data()),
+              static_cast<std::streamsize>(offsets.size() * sizeof(std::uint64_t)));
+    for (const auto& chunk : chunks) {
+        out.write(reinterpret_cast<const char*>(chunk.data()),
+                  static_cast<std::streamsize>(chunk.size()));
+    }
+    if (!out) {
+        throw DataWriterException(SourceContext{}, "Unable to write chunked volume {:?g}", path);
+    }
+}
+
+ChunkedVolumeFile::ChunkedVolumeFile(const std::filesystem::path& path) : path_{path} {
+    std::ifstream in{path_, std::ios::binary};
+    if (!in) {
+        throw DataReaderException(SourceContext{}, "Unable to open chunked volume {:?g}", path_);
+    }
+
+    Header header{};
+    in.read(reinterpret_cast<char*>(&header), sizeof(Header));
+    if (!in || header.magic != magic) {
+        throw DataReaderException(SourceContext{}, "{:?g} is not a chunked volume", path_);
+    }
+    if (header.version != version) {
+        throw DataReaderException(SourceContext{}, "Unsupported chunked volume version {} in {:?g}",
+                                  header.version, path_);
+    }
+
+    dimensions_ = size3_t{header.dimensions[0], header.dimensions[1], header.dimensions[2]};
+    chunkDimensions_ = size3_t{header.chunkDimensions[0], header.chunkDimensions[1],
+                               header.chunkDimensions[2]};
+    elementSize_ = header.elementSize;
+    codec_ = header.codec;
+    shuffle_ = header.shuffle != 0;
+    byteOrder_ = header.byteOrder;
+
+    if (glm::any(glm::equal(chunkDimensions_, size3_t{0})) ||
+        header.chunks != glm::compMul(getChunkGrid())) {
+        throw DataReaderException(SourceContext{}, "Invalid chunk layout in {:?g}", path_);
+    }
+
+    offsets_.resize(header.chunks + 1);
+    in.read(reinterpret_cast<char*>(offsets_.data()),
+            static_cast<std::streamsize>(offsets_.size() * sizeof(std::uint64_t)));
+    if (!in) {
+        throw DataReaderException(SourceContext{}, "Unable to read the chunk table of {:?g}",
+                                  path_);
+    }
+}
+
+const std::filesystem::path& ChunkedVolumeFile::getPath() const { return path_; }
+
+size3_t ChunkedVolumeFile::getDimensions() const { return dimensions_; }
+
+size3_t ChunkedVolumeFile::getChunkDimensions() const { return chunkDimensions_; }
+
+size3_t ChunkedVolumeFile::getChunkGrid() const {
+    return (dimensions_ + chunkDimensions_ - size3_t{1}) / chunkDimensions_;
+}
+
+size_t ChunkedVolumeFile::getNumberOfChunks() const { return offsets_.size() - 1; }
+
+size_t ChunkedVolumeFile::getElementSize() const { return elementSize_; }
+
+ChunkCodec ChunkedVolumeFile::getCodec() const { return codec_; }
+
+void ChunkedVolumeFile::read(size3_t offset, size3_t dimensions,
+                             std::span<std::byte> dest) const {
+    if (glm::any(glm::greaterThan(offset + dimensions, dimensions_))) {
+        throw DataReaderException(SourceContext{},
+                                  "Region {} + {} is outside of the volume {} in {:?g}", offset,
+                                  dimensions, dimensions_, path_);
+    }
+    if (dest.size() < glm::compMul(dimensions) * elementSize_) {
+        throw DataReaderException(SourceContext{}, "Destination too small for region {}",
+                                  dimensions);
+    }
+    if (glm::compMul(dimensions) == 0) return;
+
+    const auto first = offset / chunkDimensions_;
+    const auto last = (offset + dimensions - size3_t{1}) / chunkDimensions_;
+    const auto overlap = last - first + size3_t{1};
+    const util::IndexMapper3D overlapIm{overlap};
+    const util::IndexMapper3D gridIm{getChunkGrid()};
+
+    const auto decode = [&](std::ifstream& in, size_t index, std::vector<std::byte>& encoded,
+                            std::vector<std::byte>& decoded, std::vector<std::byte>& chunk) {
+        encoded.resize(offsets_[index + 1] - offsets_[index]);
+        in.seekg(static_cast<std::streamoff>(offsets_[index]));
+        in.read(reinterpret_cast<char*>(encoded.data()),
+                static_cast<std::streamsize>(encoded.size()));
+        if (!in) {
+            throw DataReaderException(SourceContext{}, "Unable to read chunk {} of {:?g}", index,
+                                      path_);
+        }
+
+        auto& target = shuffle_ ? decoded : chunk;
+        target.resize(chunk.size());
+        bool valid = false;
+        switch (codec_) {
+            case ChunkCodec::None:
+                valid = encoded.size() == target.size();
+                if (valid) std::ranges::copy(encoded, target.begin());
+                break;
+            case ChunkCodec::Deflate: {
+                auto size = static_cast<uLongf>(target.size());
+                valid = uncompress(reinterpret_cast<Bytef*>(target.data()), &size,
+                                   reinterpret_cast<const Bytef*>(encoded.data()),
+                                   static_cast<uLong>(encoded.size())) == Z_OK &&
+                        size == target.size();
+                break;
+            }
+        }
+        if (!valid) {
+            throw DataReaderException(SourceContext{}, "Corrupt chunk {} in {:?g}", index, path_);
+        }
+        if (shuffle_) unshuffleBytes(decoded, chunk, elementSize_);
+        if (byteOrder_ != nativeByteOrder && elementSize_ > 1) {
+            util::reverseByteOrder(chunk.data(), chunk.size(), elementSize_);
+        }
+    };
+
+    util::parallelFor(0, glm::compMul(overlap), [&](size_t begin, size_t end) {
+        std::ifstream in{path_, std::ios::binary};
+        if (!in) {
+            throw DataReaderException(SourceContext{}, "Unable to open chunked volume {:?g}",
+                                      path_);
+        }
+        std::vector<std::byte> encoded;
+        std::vector<std::byte> decoded;
+        std::vector<std::byte> chunk;
+        for (size_t i = begin; i < end; ++i) {
+            const auto index = gridIm(first + overlapIm(i));
+            const auto region = chunkRegion(index, dimensions_, chunkDimensions_);
+            chunk.resize(glm::compMul(region.dimensions) * elementSize_);
+            decode(in, index, encoded, decoded, chunk);
+
+            const auto lower = glm::max(region.offset, offset);
+            const auto upper = glm::min(region.offset + region.dimensions, offset + dimensions);
+            copyRegion(chunk, region.dimensions, lower - region.offset, dest, dimensions,
+                       lower - offset, upper - lower, elementSize_);
+        }
+    });
+}
+
+}  // namespace inviwo::util
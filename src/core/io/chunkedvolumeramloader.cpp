@@ -0,0 +1,102 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/chunkedvolumeramloader.h>
+
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/chunkedvolumefile.h>
+#include <inviwo/core/io/curlutils.h>
+#include <inviwo/core/io/datareaderexception.h>
+
+#include <cstddef>
+#include <span>
+
+#include <fmt/std.h>
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+namespace {
+
+util::ChunkedVolumeFile open(const std::filesystem::path& path, const VolumeRepresentation& src) {
+    util::ChunkedVolumeFile file{net::downloadAndCacheIfUrl(path)};
+    if (file.getDimensions() != src.getDimensions() ||
+        file.getElementSize() != src.getDataFormat()->getSizeInBytes()) {
+        throw DataReaderException(SourceContext{},
+                                  "The chunked volume {:?g} does not match the expected volume",
+                                  path);
+    }
+    return file;
+}
+
+}  // namespace
+
+ChunkedVolumeRAMLoader::ChunkedVolumeRAMLoader(const std::filesystem::path& chunkedFile)
+    : chunkedFile_{chunkedFile} {}
+
+ChunkedVolumeRAMLoader* ChunkedVolumeRAMLoader::clone() const {
+    return new ChunkedVolumeRAMLoader(*this);
+}
+
+std::shared_ptr<VolumeRepresentation> ChunkedVolumeRAMLoader::createRepresentation(
+    const VolumeRepresentation& src) const {
+    return createSubsetRepresentation(src, size3_t{0}, src.getDimensions());
+}
+
+void ChunkedVolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                                  const VolumeRepresentation& src) const {
+    auto volumeDst = std::static_pointer_cast<VolumeRAM>(dest);
+
+    if (src.getDimensions() != volumeDst->getDimensions()) {
+        volumeDst->setDimensions(src.getDimensions());
+    }
+
+    const auto file = open(chunkedFile_, src);
+    const auto bytes = glm::compMul(src.getDimensions()) * src.getDataFormat()->getSizeInBytes();
+    file.read(size3_t{0}, src.getDimensions(),
+              std::span{static_cast<std::byte*>(volumeDst->getData()), bytes});
+
+    volumeDst->setSwizzleMask(src.getSwizzleMask());
+    volumeDst->setInterpolation(src.getInterpolation());
+    volumeDst->setWrapping(src.getWrapping());
+}
+
+std::shared_ptr<VolumeRAM> ChunkedVolumeRAMLoader::createSubsetRepresentation(
+    const VolumeRepresentation& src, size3_t offset, size3_t dimensions) const {
+
+    const auto file = open(chunkedFile_, src);
+    auto volumeRAM = createVolumeRAM(dimensions, src.getDataFormat(), nullptr,
+                                     src.getSwizzleMask(), src.getInterpolation(),
+                                     src.getWrapping());
+    const auto bytes = glm::compMul(dimensions) * src.getDataFormat()->getSizeInBytes();
+    file.read(offset, dimensions, std::span{static_cast<std::byte*>(volumeRAM->getData()), bytes});
+    return volumeRAM;
+}
+
+}  // namespace inviwo
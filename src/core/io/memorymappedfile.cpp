@@ -0,0 +1,155 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/raiiutils.h>
+
+#ifdef WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <fmt/std.h>
+
+#include <system_error>
+#include <utility>
+
+namespace inviwo {
+
+namespace util {
+
+namespace {
+
+size_t allocationGranularity() {
+#ifdef WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwAllocationGranularity);
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+}  // namespace
+
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& path, size_t offset, size_t size)
+    : size_{size} {
+    const auto granularity = allocationGranularity();
+    const auto alignedOffset = offset - offset % granularity;
+    shift_ = offset - alignedOffset;
+    mappedSize_ = size + shift_;
+
+    std::error_code ec;
+    const auto fileSize = std::filesystem::file_size(path, ec);
+    if (ec || fileSize < offset + size) {
+        throw FileException(SourceContext{}, "Could not map {} bytes at offset {} of file: {:?g}",
+                            size, offset, path);
+    }
+    if (size == 0) return;
+
+#ifdef WIN32
+    auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw FileException(SourceContext{}, "Could not open file: {:?g}", path);
+    }
+    const util::OnScopeExit closeFile{[file]() { CloseHandle(file); }};
+
+    auto mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (!mapping) {
+        throw FileException(SourceContext{}, "Could not map file: {:?g}", path);
+    }
+    const util::OnScopeExit closeMapping{[mapping]() { CloseHandle(mapping); }};
+
+    const auto high = static_cast<DWORD>(static_cast<std::uint64_t>(alignedOffset) >> 32);
+    const auto low = static_cast<DWORD>(static_cast<std::uint64_t>(alignedOffset) & 0xFFFFFFFF);
+    base_ = MapViewOfFile(mapping, FILE_MAP_COPY, high, low, mappedSize_);
+    if (!base_) {
+        throw FileException(SourceContext{}, "Could not map file: {:?g}", path);
+    }
+#else
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw FileException(SourceContext{}, "Could not open file: {:?g}", path);
+    }
+    const util::OnScopeExit closeFile{[fd]() { ::close(fd); }};
+
+    auto* base = ::mmap(nullptr, mappedSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd,
+                        static_cast<off_t>(alignedOffset));
+    if (base == MAP_FAILED) {
+        throw FileException(SourceContext{}, "Could not map file: {:?g}", path);
+    }
+    base_ = base;
+#endif
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& rhs) noexcept
+    : base_{std::exchange(rhs.base_, nullptr)}
+    , shift_{std::exchange(rhs.shift_, 0)}
+    , size_{std::exchange(rhs.size_, 0)}
+    , mappedSize_{std::exchange(rhs.mappedSize_, 0)} {}
+
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& rhs) noexcept {
+    if (this != &rhs) {
+        unmap();
+        base_ = std::exchange(rhs.base_, nullptr);
+        shift_ = std::exchange(rhs.shift_, 0);
+        size_ = std::exchange(rhs.size_, 0);
+        mappedSize_ = std::exchange(rhs.mappedSize_, 0);
+    }
+    return *this;
+}
+
+MemoryMappedFile::~MemoryMappedFile() { unmap(); }
+
+void MemoryMappedFile::unmap() {
+    if (!base_) return;
+#ifdef WIN32
+    UnmapViewOfFile(base_);
+#else
+    ::munmap(base_, mappedSize_);
+#endif
+    base_ = nullptr;
+}
+
+bool MemoryMappedFile::isMappable(const std::filesystem::path& path) {
+    std::error_code ec;
+    return std::filesystem::is_regular_file(path, ec);
+}
+
+}  // namespace util
+
+}  // namespace inviwo
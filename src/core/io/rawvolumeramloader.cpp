@@ -30,11 +30,57 @@
 #include <inviwo/core/io/rawvolumeramloader.h>
 
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/curlutils.h>
+#include <inviwo/core/io/memorymappedfile.h>
 
+#include <fmt/format.h>
 #include <glm/gtx/component_wise.hpp>
 
+#include <bit>
+#include <cstdint>
+
 namespace inviwo {
 
+namespace {
+
+/**
+ * A VolumeRAMPrecision viewing a memory mapped file instead of owning its data. Pages are loaded
+ * on first access and modifications only affect a private copy, clones are regular deep copies.
+ */
+template <typename T>
+class VolumeRAMMapped : public VolumeRAMPrecision<T> {
+public:
+    VolumeRAMMapped(util::MemoryMappedFile file, const VolumeRepresentation& src)
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        : VolumeRAMPrecision<T>{reinterpret_cast<T*>(file.data()), src.getDimensions(),
+                                src.getSwizzleMask(), src.getInterpolation(), src.getWrapping()}
+        , file_{std::move(file)} {
+        this->removeDataOwnership();
+    }
+    VolumeRAMMapped(const VolumeRAMMapped&) = delete;
+    VolumeRAMMapped& operator=(const VolumeRAMMapped&) = delete;
+    virtual ~VolumeRAMMapped() = default;
+
+private:
+    util::MemoryMappedFile file_;
+};
+
+std::shared_ptr<VolumeRAM> mapVolumeRAM(const std::filesystem::path& path, size_t offset,
+                                        const VolumeRepresentation& src) {
+    const auto size = glm::compMul(src.getDimensions()) * src.getDataFormat()->getSizeInBytes();
+    if (!util::MemoryMappedFile::isMappable(path)) return nullptr;
+
+    return dispatching::singleDispatch<std::shared_ptr<VolumeRAM>, dispatching::filter::All>(
+        src.getDataFormat()->getId(), [&]<typename T>() -> std::shared_ptr<VolumeRAM> {
+            util::MemoryMappedFile file{path, offset, size};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            if (reinterpret_cast<std::uintptr_t>(file.data()) % alignof(T) != 0) return nullptr;
+            return std::make_shared<VolumeRAMMapped<T>>(std::move(file), src);
+        });
+}
+
+}  // namespace
+
 RawVolumeRAMLoader::RawVolumeRAMLoader(const std::filesystem::path& rawFile, size_t offset,
                                        ByteOrder byteOrder, Compression compression)
     : rawFile_{rawFile}, offset_{offset}, byteOrder_{byteOrder}, compression_{compression} {}
@@ -44,7 +90,17 @@ RawVolumeRAMLoader* RawVolumeRAMLoader::clone() const { return new RawVolumeRAML
 std::shared_ptr<VolumeRepresentation> RawVolumeRAMLoader::createRepresentation(
     const VolumeRepresentation& src) const {
 
-    const auto size = glm::compMul(src.getDimensions()) * src.getDataFormat()->getSizeInBytes();
+    const auto elementSize = src.getDataFormat()->getSizeInBytes();
+    const auto nativeOrder = std::endian::native == std::endian::little ? ByteOrder::LittleEndian
+                                                                        : ByteOrder::BigEndian;
+    if (compression_ == Compression::Disabled && (byteOrder_ == nativeOrder || elementSize == 1)) {
+        // The file layout matches the memory layout, map it instead of reading it
+        if (auto volumeRAM = mapVolumeRAM(net::downloadAndCacheIfUrl(rawFile_), offset_, src)) {
+            return volumeRAM;
+        }
+    }
+
+    const auto size = glm::compMul(src.getDimensions()) * elementSize;
     auto data = std::make_unique<char[]>(size);
     if (compression_ == Compression::Enabled) {
         util::readCompressedBytesIntoBuffer(rawFile_, offset_, size, byteOrder_,
@@ -85,4 +141,23 @@ void RawVolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentati
     volumeDst->setInterpolation(src.getInterpolation());
     volumeDst->setWrapping(src.getWrapping());
 }
+
+std::shared_ptr<VolumeRAM> RawVolumeRAMLoader::createSubsetRepresentation(
+    const VolumeRepresentation& src, size3_t offset, size3_t dimensions) const {
+    if (compression_ == Compression::Enabled) return nullptr;
+
+    auto volumeRAM = createVolumeRAM(dimensions, src.getDataFormat(), nullptr,
+                                     src.getSwizzleMask(), src.getInterpolation(),
+                                     src.getWrapping());
+    util::readRegionIntoBuffer(rawFile_, offset_, src.getDimensions(), offset, dimensions,
+                               byteOrder_, src.getDataFormat()->getSizeInBytes(),
+                               volumeRAM->getData());
+    return volumeRAM;
+}
+
+std::optional<DiskSource> RawVolumeRAMLoader::getSource() const {
+    return DiskSource{rawFile_, fmt::format("raw {} {} {}", offset_, enumToStr(byteOrder_),
+                                            enumToStr(compression_))};
+}
+
 }  // namespace inviwo
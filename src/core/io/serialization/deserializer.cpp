@@ -84,11 +84,12 @@ Deserializer::Deserializer(std::istream& stream, const std::filesystem::path& re
                            std::string_view rootElement, allocator_type alloc)
     : SerializeBase(refPath, alloc), registeredFactories_{alloc} {
     try {
-        std::pmr::string data{alloc};
         stream.seekg(0, std::ios::end);
-        data.reserve(stream.tellg());
+        const auto size = static_cast<std::streamsize>(stream.tellg());
         stream.seekg(0, std::ios::beg);
-        data.assign(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{});
+        std::pmr::string data(static_cast<size_t>(size), '\0', alloc);
+        stream.read(data.data(), size);
+        data.resize(static_cast<size_t>(stream.gcount()));
 
         doc_->Parse(data.c_str(), nullptr, alloc);
         rootElement_ = getRootElement(*doc_, rootElement);
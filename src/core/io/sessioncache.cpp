@@ -0,0 +1,240 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/sessioncache.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/util/constexprhash.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::uint32_t magic = 0x53575649;  // "IVWS"
+constexpr std::uint32_t version = 1;
+
+struct Header {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t key;
+    std::uint64_t size;
+};
+
+}  // namespace
+
+SessionCache::SessionCache(std::filesystem::path directory) : directory_{std::move(directory)} {}
+
+void SessionCache::setCapacity(size_t bytes) {
+    {
+        const std::scoped_lock lock{mutex_};
+        capacity_ = bytes;
+    }
+    if (bytes > 0) evict();
+}
+
+size_t SessionCache::getCapacity() const {
+    const std::scoped_lock lock{mutex_};
+    return capacity_;
+}
+
+bool SessionCache::isEnabled() const { return getCapacity() > 0; }
+
+std::optional<std::uint64_t> SessionCache::key(const std::filesystem::path& file,
+                                               std::string_view description) {
+    std::error_code ec;
+    const auto path = std::filesystem::weakly_canonical(file, ec);
+    if (ec || !std::filesystem::is_regular_file(path, ec)) return std::nullopt;
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec) return std::nullopt;
+    const auto modified = std::filesystem::last_write_time(path, ec);
+    if (ec) return std::nullopt;
+
+    return util::constexpr_hash(fmt::format("{}\n{}\n{}\n{}", path.generic_string(), size,
+                                            modified.time_since_epoch().count(), description));
+}
+
+std::optional<util::MemoryMappedFile> SessionCache::load(std::uint64_t key) const {
+    if (!isEnabled()) return std::nullopt;
+
+    const auto path = file(key);
+    Header header{};
+    {
+        std::ifstream in{path, std::ios::binary};
+        if (!in) return std::nullopt;
+        in.read(reinterpret_cast<char*>(&header), sizeof(Header));
+        if (!in || header.magic != magic || header.version != version || header.key != key ||
+            header.size == 0) {
+            return std::nullopt;
+        }
+    }
+
+    std::error_code ec;
+    if (std::filesystem::file_size(path, ec) != sizeof(Header) + header.size || ec) {
+        // A truncated file
+        std::filesystem::remove(path, ec);
+        return std::nullopt;
+    }
+
+    try {
+        util::MemoryMappedFile mapped{path, sizeof(Header), static_cast<size_t>(header.size)};
+        // The modification time of the value is used to find the least recently used ones
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+        return mapped;
+    } catch (const Exception& e) {
+        log::warn("Unable to map cached value {:?g}: {}", path, e.getMessage());
+        return std::nullopt;
+    }
+}
+
+void SessionCache::store(std::uint64_t key, std::span<const std::byte> value) const {
+    if (!isEnabled() || value.empty()) return;
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    if (ec) {
+        log::warn("Unable to create session cache {:?g}: {}", directory_, ec.message());
+        return;
+    }
+
+    // Write to a temporary file and rename it so that other running instances never read a
+    // partially written value
+    const Header header{magic, version, key, static_cast<std::uint64_t>(value.size())};
+    const auto path = file(key);
+    auto tmp = path;
+    tmp += fmt::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+        std::ofstream out{tmp, std::ios::binary | std::ios::trunc};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        out.write(reinterpret_cast<const char*>(value.data()),
+                  static_cast<std::streamsize>(value.size()));
+        if (!out) {
+            log::warn("Unable to write cached value {:?g}", tmp);
+            out.close();
+            std::filesystem::remove(tmp, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp, ec);
+        return;
+    }
+    evict();
+}
+
+void SessionCache::clear() const {
+    const std::scoped_lock lock{mutex_};
+    std::error_code ec;
+    const auto removed = std::filesystem::remove_all(directory_, ec);
+    if (ec) {
+        log::warn("Unable to clear session cache {:?g}: {}", directory_, ec.message());
+    } else {
+        log::info("Removed {} cached values", removed > 0 ? removed - 1 : 0);
+    }
+}
+
+const std::filesystem::path& SessionCache::getDirectory() const { return directory_; }
+
+std::filesystem::path SessionCache::file(std::uint64_t key) const {
+    return directory_ / fmt::format("{:016x}.bin", key);
+}
+
+void SessionCache::evict() const {
+    const std::scoped_lock lock{mutex_};
+
+    struct Item {
+        std::filesystem::path path;
+        std::uintmax_t size;
+        std::filesystem::file_time_type used;
+    };
+    std::vector<Item> items;
+    std::uintmax_t usage = 0;
+
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator{directory_, ec}) {
+        if (!entry.is_regular_file(ec) || entry.path().extension() != ".bin") continue;
+        const auto size = entry.file_size(ec);
+        if (ec) continue;
+        const auto used = entry.last_write_time(ec);
+        if (ec) continue;
+        items.push_back({entry.path(), size, used});
+        usage += size;
+    }
+    if (usage <= capacity_) return;
+
+    std::ranges::sort(items, std::ranges::less{}, &Item::used);
+    for (const auto& item : items) {
+        if (usage <= capacity_) break;
+        if (std::filesystem::remove(item.path, ec)) {
+            usage -= item.size;
+        }
+    }
+}
+
+namespace util {
+
+SessionCache* getSessionCache() {
+    if (!InviwoApplication::isInitialized()) return nullptr;
+    auto& cache = InviwoApplication::getPtr()->getSessionCache();
+    return cache.isEnabled() ? &cache : nullptr;
+}
+
+std::optional<std::uint64_t> sessionCacheKey(const Volume& volume, std::string_view description) {
+    if (!volume.hasValidRepresentation<VolumeDisk>()) return std::nullopt;
+    const auto* loader = volume.getRepresentation<VolumeDisk>()->getLoader();
+    if (!loader) return std::nullopt;
+    const auto source = loader->getSource();
+    if (!source) return std::nullopt;
+
+    const auto dims = volume.getDimensions();
+    return SessionCache::key(source->file,
+                             fmt::format("{}\n{} {} {}\n{}\n{}", source->description, dims.x,
+                                         dims.y, dims.z, volume.getDataFormat()->getString(),
+                                         description));
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -43,29 +43,25 @@ namespace inviwo {
 
 namespace {
 
+/**
+ * Marks properties as visited for the duration of a link evaluation. Nested evaluations push
+ * and pop their properties in stack order.
+ */
 struct VisitedHelper {
-    VisitedHelper(std::vector<Property*>& visited, std::vector<ConvertibleLink>& toVisit)
-        : visited_(visited), toVisit_(toVisit) {
-        for (auto& link : toVisit_) {
-            util::push_back_unique(visited_, link.src);
-            util::push_back_unique(visited_, link.dst);
-        }
+    VisitedHelper(std::vector<Property*>& visited, const std::vector<Property*>& properties)
+        : visited_(visited), size_(visited.size()) {
+        visited_.insert(visited_.end(), properties.begin(), properties.end());
     }
     VisitedHelper(const VisitedHelper&) = delete;
     VisitedHelper(VisitedHelper&&) = delete;
     VisitedHelper& operator=(const VisitedHelper&) = delete;
     VisitedHelper& operator=(VisitedHelper&&) = delete;
 
-    ~VisitedHelper() {
-        for (auto& link : toVisit_) {
-            std::erase(visited_, link.src);
-            std::erase(visited_, link.dst);
-        }
-    }
+    ~VisitedHelper() { visited_.resize(size_); }
 
 private:
     std::vector<Property*>& visited_;
-    std::vector<ConvertibleLink>& toVisit_;
+    size_t size_;
 };
 
 }  // namespace
@@ -137,31 +133,33 @@ std::vector<PropertyLink> LinkEvaluator::getLinksBetweenProcessors(Processor* p1
     }
 }
 
-std::vector<ConvertibleLink>& LinkEvaluator::getTriggeredLinksForProperty(Property* property) {
-    if (transientLinkCache_.find(property) != transientLinkCache_.end()) {
-        return transientLinkCache_[property];
+LinkEvaluator::Propagation& LinkEvaluator::getTriggeredLinksForProperty(Property* property) {
+    // check if link connectivity has been computed and cached already
+    if (const auto it = transientLinkCache_.find(property); it != transientLinkCache_.end()) {
+        return it->second;
     } else {
         return addToTransientCache(property);
     }
 }
 
 std::vector<Property*> LinkEvaluator::getPropertiesLinkedTo(Property* property) {
-    // check if link connectivity has been computed and cached already
-    auto& list = (transientLinkCache_.find(property) != transientLinkCache_.end())
-                     ? transientLinkCache_[property]
-                     : addToTransientCache(property);
-
-    return util::transform(list, [](const ConvertibleLink& link) { return link.dst; });
+    return util::transform(getTriggeredLinksForProperty(property).links,
+                           [](const ConvertibleLink& link) { return link.dst; });
 }
 
-std::vector<ConvertibleLink>& LinkEvaluator::addToTransientCache(Property* src) {
+LinkEvaluator::Propagation& LinkEvaluator::addToTransientCache(Property* src) {
+    auto& propagation = transientLinkCache_[src];
     if (const auto it = directLinkCache_.find(src); it != directLinkCache_.end()) {
+        const auto* manager = network_->getApplication()->getPropertyConverterManager();
         for (auto& dst : it->second) {
-            transientCacheHelper(transientLinkCache_[src], src, dst,
-                                 network_->getApplication()->getPropertyConverterManager());
+            transientCacheHelper(propagation.links, src, dst, manager);
         }
     }
-    return transientLinkCache_[src];
+    for (auto& link : propagation.links) {
+        util::push_back_unique(propagation.properties, link.src);
+        util::push_back_unique(propagation.properties, link.dst);
+    }
+    return propagation;
 }
 
 void LinkEvaluator::transientCacheHelper(std::vector<ConvertibleLink>& links, Property* src,
@@ -210,12 +208,14 @@ bool LinkEvaluator::isLinking() const { return !visited_.empty(); }
 void LinkEvaluator::evaluateLinksFromProperty(Property* modifiedProperty) {
     if (util::contains(visited_, modifiedProperty)) return;
 
-    const NetworkLock lock(network_);
+    const auto& propagation = getTriggeredLinksForProperty(modifiedProperty);
+    // Most properties are not linked, avoid locking the network for those
+    if (propagation.links.empty()) return;
 
-    auto& links = getTriggeredLinksForProperty(modifiedProperty);
-    const VisitedHelper helper(visited_, links);
+    const NetworkLock lock(network_);
+    const VisitedHelper helper(visited_, propagation.properties);
 
-    for (auto& link : links) {
+    for (const auto& link : propagation.links) {
         link.converter->convert(link.src, link.dst);
     }
 }
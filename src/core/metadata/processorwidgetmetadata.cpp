@@ -38,7 +38,8 @@ ProcessorWidgetMetaData::ProcessorWidgetMetaData()
     , dimensions_(256, 256)
     , visible_(true)
     , fullScreen_(false)
-    , onTop_(true) {}
+    , onTop_(true)
+    , exposed_(true) {}
 
 ProcessorWidgetMetaData* ProcessorWidgetMetaData::clone() const {
     return new ProcessorWidgetMetaData(*this);
@@ -80,6 +81,18 @@ void ProcessorWidgetMetaData::setVisible(bool visible,
 
 bool ProcessorWidgetMetaData::isVisible() const { return visible_; }
 
+void ProcessorWidgetMetaData::setExposed(bool exposed,
+                                         const ProcessorWidgetMetaDataObserver* source) {
+    if (exposed != exposed_) {
+        exposed_ = exposed;
+        forEachObserver([&](ProcessorWidgetMetaDataObserver* o) {
+            if (o != source) o->onProcessorWidgetExposureChange(this);
+        });
+    }
+}
+
+bool ProcessorWidgetMetaData::isExposed() const { return exposed_; }
+
 void ProcessorWidgetMetaData::setFullScreen(bool fullScreen,
                                             const ProcessorWidgetMetaDataObserver* source) {
     if (fullScreen != fullScreen_) {
@@ -0,0 +1,317 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/network/evaluationprofiler.h>
+
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/exception.h>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <fmt/std.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <ostream>
+
+namespace inviwo {
+
+namespace {
+
+std::atomic<EvaluationProfiler*> enabledProfiler{nullptr};
+
+void writeJsonString(std::ostream& os, std::string_view str) {
+    os << '"';
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            case '\t':
+                os << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    fmt::print(os, "\\u{:04x}", static_cast<int>(c));
+                } else {
+                    os << c;
+                }
+        }
+    }
+    os << '"';
+}
+
+double toMicroseconds(Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+}  // namespace
+
+EvaluationProfiler::EvaluationProfiler(ProcessorNetwork* network,
+                                       ProcessorNetworkEvaluator* evaluator)
+    : network_{network}
+    , enabled_{false}
+    , gpuTimerFactory_{}
+    , origin_{Clock::clock::now()}
+    , evaluationStart_{origin_}
+    , running_{}
+    , pendingGPU_{}
+    , mutex_{}
+    , maxEvents_{1'000'000}
+    , events_{}
+    , stats_{} {
+
+    network_->addObserver(this);
+    evaluator->addObserver(this);
+    network_->forEachProcessor([this](Processor* p) { p->ProcessorObservable::addObserver(this); });
+}
+
+EvaluationProfiler::~EvaluationProfiler() {
+    auto* self = this;
+    enabledProfiler.compare_exchange_strong(self, nullptr);
+}
+
+void EvaluationProfiler::setEnabled(bool enabled) {
+    if (enabled_ == enabled) return;
+    enabled_ = enabled;
+    running_.clear();
+    pendingGPU_.clear();
+    if (enabled_) {
+        enabledProfiler = this;
+    } else {
+        auto* self = this;
+        enabledProfiler.compare_exchange_strong(self, nullptr);
+    }
+}
+
+bool EvaluationProfiler::isEnabled() const { return enabled_; }
+
+void EvaluationProfiler::clear() {
+    std::scoped_lock lock{mutex_};
+    origin_ = Clock::clock::now();
+    events_.clear();
+    stats_.clear();
+}
+
+void EvaluationProfiler::setGPUTimerFactory(GPUTimerFactory factory) {
+    running_.clear();
+    pendingGPU_.clear();
+    gpuTimerFactory_ = std::move(factory);
+}
+
+void EvaluationProfiler::setMaxEvents(size_t maxEvents) {
+    std::scoped_lock lock{mutex_};
+    maxEvents_ = maxEvents;
+    while (events_.size() > maxEvents_) events_.pop_front();
+}
+
+EvaluationProfiler* EvaluationProfiler::getEnabled() { return enabledProfiler.load(); }
+
+void EvaluationProfiler::addEvent(Event event) {
+    std::scoped_lock lock{mutex_};
+    addEventInternal(std::move(event));
+}
+
+void EvaluationProfiler::addEventInternal(Event event) {
+    if (maxEvents_ == 0) return;
+    if (events_.size() >= maxEvents_) events_.pop_front();
+    events_.push_back(std::move(event));
+}
+
+void EvaluationProfiler::addConversion(std::string_view source, std::string_view destination,
+                                       Clock::time_point start) {
+    const auto now = Clock::clock::now();
+    addEvent({fmt::format("{} -> {}", source, destination), conversionCategory, start, now - start,
+              std::this_thread::get_id()});
+}
+
+std::vector<EvaluationProfiler::Event> EvaluationProfiler::getEvents() const {
+    std::scoped_lock lock{mutex_};
+    return {events_.begin(), events_.end()};
+}
+
+std::vector<EvaluationProfiler::ProcessorStats> EvaluationProfiler::getProcessorStats() const {
+    std::vector<ProcessorStats> stats;
+    {
+        std::scoped_lock lock{mutex_};
+        stats.reserve(stats_.size());
+        for (const auto& item : stats_) stats.push_back(item.second);
+    }
+    std::ranges::sort(stats, [](const ProcessorStats& a, const ProcessorStats& b) {
+        return a.total > b.total;
+    });
+    return stats;
+}
+
+void EvaluationProfiler::writeChromeTrace(std::ostream& os) const {
+    const auto events = getEvents();
+    Clock::time_point origin;
+    {
+        std::scoped_lock lock{mutex_};
+        origin = origin_;
+    }
+
+    // Use small consecutive numbers for the threads, and a separate track for the GPU events.
+    std::unordered_map<std::thread::id, size_t> threads;
+    const size_t gpuTrack = 0;
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    fmt::print(os,
+               "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+               "\"args\":{{\"name\":\"GPU\"}}}}",
+               gpuTrack);
+    for (const auto& event : events) {
+        size_t tid = gpuTrack;
+        if (event.category != gpuCategory) {
+            auto [it, inserted] = threads.try_emplace(event.thread, threads.size() + 1);
+            if (inserted) {
+                fmt::print(os,
+                           ",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+                           "\"args\":{{\"name\":\"Thread {}\"}}}}",
+                           it->second, it->second);
+            }
+            tid = it->second;
+        }
+
+        os << ",\n{\"name\":";
+        writeJsonString(os, event.name);
+        os << ",\"cat\":";
+        writeJsonString(os, event.category);
+        if (event.duration == Clock::duration{0}) {
+            fmt::print(os, ",\"ph\":\"i\",\"s\":\"t\",\"ts\":{:.3f},\"pid\":1,\"tid\":{}}}",
+                       toMicroseconds(event.start - origin), tid);
+        } else {
+            fmt::print(os, ",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{}}}",
+                       toMicroseconds(event.start - origin), toMicroseconds(event.duration), tid);
+        }
+    }
+    os << "\n]}\n";
+}
+
+void EvaluationProfiler::writeChromeTrace(const std::filesystem::path& file) const {
+    auto os = std::ofstream(file);
+    if (!os) {
+        throw Exception(SourceContext{}, "Could not open file {} for writing", file);
+    }
+    writeChromeTrace(os);
+}
+
+void EvaluationProfiler::onProcessorNetworkDidAddProcessor(Processor* processor) {
+    processor->ProcessorObservable::addObserver(this);
+}
+
+void EvaluationProfiler::onProcessorNetworkWillRemoveProcessor(Processor* processor) {
+    processor->ProcessorObservable::removeObserver(this);
+    running_.erase(processor);
+}
+
+void EvaluationProfiler::onProcessorNetworkEvaluationBegin() {
+    if (!enabled_) return;
+    evaluationStart_ = Clock::clock::now();
+}
+
+void EvaluationProfiler::onProcessorNetworkEvaluationEnd() {
+    if (!enabled_) return;
+    const auto now = Clock::clock::now();
+
+    std::scoped_lock lock{mutex_};
+    addEventInternal({"Evaluate Network", evaluationCategory, evaluationStart_,
+                      now - evaluationStart_, std::this_thread::get_id()});
+
+    // Collect the GPU timings once per evaluation, to not stall the pipeline for each processor.
+    for (auto& pending : pendingGPU_) {
+        const auto elapsed = pending.gpuTimer->getElapsedTime();
+        stats_[pending.identifier].gpuTotal += elapsed;
+        addEventInternal({pending.identifier, gpuCategory, pending.start, elapsed,
+                          std::this_thread::get_id()});
+    }
+    pendingGPU_.clear();
+}
+
+void EvaluationProfiler::onProcessorInvalidationBegin(Processor* processor) {
+    if (!enabled_) return;
+    std::scoped_lock lock{mutex_};
+    auto& stats = stats_[processor->getIdentifier()];
+    stats.identifier = processor->getIdentifier();
+    ++stats.invalidations;
+    addEventInternal({processor->getIdentifier(), invalidationCategory, Clock::clock::now(),
+                      Clock::duration{0}, std::this_thread::get_id()});
+}
+
+void EvaluationProfiler::onProcessorAboutToProcess(Processor* processor) {
+    if (!enabled_) return;
+
+    auto& running = running_[processor];
+    running.gpuTimer.reset();
+    if (gpuTimerFactory_ &&
+        util::contains(processor->getProcessorInfo().tags.tags_, Tags::GL)) {
+        running.gpuTimer = gpuTimerFactory_();
+        if (running.gpuTimer) running.gpuTimer->start();
+    }
+    running.start = Clock::clock::now();
+}
+
+void EvaluationProfiler::onProcessorFinishedProcess(Processor* processor) {
+    if (!enabled_) return;
+    const auto now = Clock::clock::now();
+
+    auto it = running_.find(processor);
+    if (it == running_.end()) return;
+    auto running = std::move(it->second);
+    running_.erase(it);
+
+    if (running.gpuTimer) {
+        running.gpuTimer->stop();
+        pendingGPU_.push_back({processor->getIdentifier(), running.start,
+                               std::move(running.gpuTimer)});
+    }
+
+    const auto duration = now - running.start;
+    std::scoped_lock lock{mutex_};
+    auto& stats = stats_[processor->getIdentifier()];
+    stats.identifier = processor->getIdentifier();
+    ++stats.count;
+    stats.total += duration;
+    stats.max = std::max(stats.max, duration);
+    addEventInternal(
+        {processor->getIdentifier(), processCategory, running.start, duration,
+         std::this_thread::get_id()});
+}
+
+}  // namespace inviwo
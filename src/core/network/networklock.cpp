@@ -63,4 +63,33 @@ NetworkLock::~NetworkLock() {
     if (network_) network_->unlock();
 }
 
+NetworkBatch::NetworkBatch(NetworkBatch&& rhs) noexcept : network_(rhs.network_) {
+    rhs.network_ = nullptr;
+}
+NetworkBatch& NetworkBatch::operator=(NetworkBatch&& that) {
+    NetworkBatch batch(std::move(that));
+    std::swap(network_, batch.network_);
+    return *this;
+}
+
+NetworkBatch::NetworkBatch() : network_(InviwoApplication::getPtr()->getProcessorNetwork()) {
+    if (network_) network_->beginBatch();
+}
+
+NetworkBatch::NetworkBatch(ProcessorNetwork* network) : network_(network) {
+    if (network_) network_->beginBatch();
+}
+
+NetworkBatch::NetworkBatch(Processor* processor)
+    : NetworkBatch(processor ? processor->getNetwork() : nullptr) {}
+
+NetworkBatch::NetworkBatch(Property* property)
+    : NetworkBatch(property
+                       ? (property->getOwner() ? property->getOwner()->getProcessor() : nullptr)
+                       : nullptr) {}
+
+NetworkBatch::~NetworkBatch() {
+    if (network_) network_->endBatch();
+}
+
 }  // namespace inviwo
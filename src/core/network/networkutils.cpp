@@ -40,8 +40,10 @@
 #include <inviwo/core/network/workspacemanager.h>
 #include <inviwo/core/network/autolinker.h>
 #include <inviwo/core/network/networkedge.h>
+#include <inviwo/core/util/pmrutils.h>
 
 #include <iterator>
+#include <memory_resource>
 #include <unordered_set>
 #include <vector>
 #include <fstream>
@@ -94,11 +96,12 @@ std::unordered_set<Processor*> getSuccessors(Processor* processor) {
 std::vector<Processor*> topologicalSort(ProcessorNetwork* network) {
     // perform topological sorting and store processor order in sorted
 
-    std::vector<Processor*> sinkProcessors;
+    auto* arena = util::arenaResource();
+    std::pmr::vector<Processor*> sinkProcessors{arena};
     util::copy_if(network->getProcessors(), std::back_inserter(sinkProcessors),
                   [](Processor* p) { return p->isSink(); });
 
-    std::unordered_set<Processor*> state;
+    std::pmr::unordered_set<Processor*> state{arena};
     std::vector<Processor*> sorted;
     for (auto processor : sinkProcessors) {
         traverseNetwork<TraversalDirection::Up, VisitPattern::Post>(
@@ -110,11 +113,12 @@ std::vector<Processor*> topologicalSort(ProcessorNetwork* network) {
 std::vector<Processor*> topologicalSortFiltered(ProcessorNetwork* network) {
     // perform topological sorting and store processor order in sorted
 
-    std::vector<Processor*> sinkProcessors;
+    auto* arena = util::arenaResource();
+    std::pmr::vector<Processor*> sinkProcessors{arena};
     util::copy_if(network->getProcessors(), std::back_inserter(sinkProcessors),
                   [](Processor* p) { return p->isSink(); });
 
-    std::unordered_set<Processor*> state;
+    std::pmr::unordered_set<Processor*> state{arena};
     std::vector<Processor*> sorted;
     for (auto processor : sinkProcessors) {
         traverseNetwork<TraversalDirection::Up, VisitPattern::Post>(
@@ -47,6 +47,7 @@
 #include <fmt/std.h>
 
 #include <algorithm>
+#include <utility>
 
 namespace inviwo {
 
@@ -96,6 +97,10 @@ Processor* ProcessorNetwork::addProcessor(std::shared_ptr<Processor> processor)
 }
 
 void ProcessorNetwork::removeProcessorHelper(Processor* processor) {
+    if (deferredInvalidationsSet_.erase(processor) > 0) {
+        std::erase(deferredInvalidations_, processor);
+    }
+
     // Remove all connections for this processor
     for (auto* outport : processor->getOutports()) {
         const std::vector<Inport*> inports = outport->getConnectedInports();
@@ -377,7 +382,41 @@ void ProcessorNetwork::onProcessorFinishBackgroundWork(Processor* p, size_t jobs
 
 void ProcessorNetwork::onAboutPropertyChange(Property* modifiedProperty) {
     if (modifiedProperty) linkEvaluator_.evaluateLinksFromProperty(modifiedProperty);
-    notifyObserversProcessorNetworkChanged();
+    if (isBatching()) {
+        deferredNetworkChanged_ = true;
+    } else {
+        notifyObserversProcessorNetworkChanged();
+    }
+}
+
+void ProcessorNetwork::beginBatch() {
+    lock();
+    ++batching_;
+}
+
+void ProcessorNetwork::endBatch() {
+    if (batching_ == 0) return;
+    if (--batching_ == 0) {
+        // Propagating may invalidate further processors, those are handled directly since we are
+        // no longer batching.
+        const auto deferred = std::exchange(deferredInvalidations_, {});
+        deferredInvalidationsSet_.clear();
+        for (auto* processor : deferred) {
+            processor->propagateInvalidation();
+        }
+        if (std::exchange(deferredNetworkChanged_, false)) {
+            notifyObserversProcessorNetworkChanged();
+        }
+    }
+    unlock();
+}
+
+bool ProcessorNetwork::deferInvalidation(Processor* processor) {
+    if (!isBatching()) return false;
+    if (deferredInvalidationsSet_.insert(processor).second) {
+        deferredInvalidations_.push_back(processor);
+    }
+    return true;
 }
 
 void ProcessorNetwork::onProcessorMetaDataPositionChange() {
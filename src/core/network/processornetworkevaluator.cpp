@@ -30,21 +30,46 @@
 #include <inviwo/core/network/processornetworkevaluator.h>
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/processors/processor.h>
+#include <inviwo/core/ports/inport.h>
+#include <inviwo/core/ports/outport.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/network/networkutils.h>
 #include <inviwo/core/network/networklock.h>
+#include <inviwo/core/links/propertylink.h>
+#include <inviwo/core/properties/property.h>
+#include <inviwo/core/properties/propertyowner.h>
 #include <inviwo/core/util/clock.h>
+#include <inviwo/core/util/threadpool.h>
+#include <inviwo/core/util/pmrutils.h>
+#include <inviwo/core/common/inviwoapplication.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <iterator>
+#include <memory_resource>
+#include <mutex>
+#include <ranges>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace inviwo {
 
 ProcessorNetworkEvaluator::ProcessorNetworkEvaluator(ProcessorNetwork* processorNetwork)
     : processorNetwork_(processorNetwork)
-    , processorsSorted_(util::topologicalSortFiltered(processorNetwork_))
+    , processorOrder_{}
+    , processorsSorted_{}
     , needsSorting_(true)
     , evaluationQueued_(false)
+    , evaluationMode_(EvaluationMode::Serial)
     , exceptionHandler_(StandardEvaluationErrorHandler()) {
 
+    processorNetwork_->forEachProcessor([this](Processor* p) { processorOrder_.addNode(p); });
+    for (const auto& connection : processorNetwork_->getConnections()) {
+        processorOrder_.addEdge(connection.getOutport()->getProcessor(),
+                                connection.getInport()->getProcessor());
+    }
     processorNetwork_->addObserver(this);
 }
 
@@ -52,6 +77,18 @@ void ProcessorNetworkEvaluator::setExceptionHandler(EvaluationErrorHandler handl
     exceptionHandler_ = handler;
 }
 
+void ProcessorNetworkEvaluator::setEvaluationMode(EvaluationMode mode) { evaluationMode_ = mode; }
+
+auto ProcessorNetworkEvaluator::getEvaluationMode() const -> EvaluationMode {
+    return evaluationMode_;
+}
+
+ProcessorResultCache& ProcessorNetworkEvaluator::getResultCache() { return resultCache_; }
+
+const ProcessorResultCache& ProcessorNetworkEvaluator::getResultCache() const {
+    return resultCache_;
+}
+
 void ProcessorNetworkEvaluator::onProcessorNetworkEvaluateRequest() {
     // Direct request, thus we don't want to queue the evaluation anymore
     evaluationQueued_ = false;
@@ -97,68 +134,257 @@ void ProcessorNetworkEvaluator::requestEvaluate() {
 void ProcessorNetworkEvaluator::evaluate() {
     // lock processor network to avoid concurrent evaluation
     NetworkLock lock(processorNetwork_);
+    // temporaries of the evaluation and of processors processed on the main thread
+    const util::ArenaScope arena;
 
     notifyObserversProcessorNetworkEvaluationBegin();
 
     if (needsSorting_) {
-        processorsSorted_ = util::topologicalSortFiltered(processorNetwork_);
+        sortProcessors();
         needsSorting_ = false;
     }
 
     IVW_CPU_PROFILING_IF(500, "Evaluated Processor Network");
 
-    for (auto processor : processorsSorted_) {
-        if (!processor->isValid()) {
-            if (processor->isReady()) {
-                try {
-                    // re-initialize resources (e.g., shaders) if necessary
-                    if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
-                        processor->initializeResources();
-                    }
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::InitResource, SourceContext{});
-                    continue;
-                }
+    auto* app = processorNetwork_->getApplication();
+    if (evaluationMode_ == EvaluationMode::Parallel && app && app->getThreadPool().getSize() > 0) {
+        evaluateParallel();
+    } else {
+        evaluateSerial();
+    }
 
-                try {
-                    // call onChange for all invalid inports
-                    for (auto inport : processor->getInports()) {
-                        inport->callOnChangeIfChanged();
-                    }
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::PortOnChange, SourceContext{});
-                    continue;
-                }
+    notifyObserversProcessorNetworkEvaluationEnd();
+}
+
+void ProcessorNetworkEvaluator::sortProcessors() {
+    const auto& order = processorOrder_.update();
+
+    // Walk the order backwards, a processor is needed if it is a sink or if any needed successor
+    // has an active connection to it. Equivalent to util::topologicalSortFiltered but linear
+    // without recursion.
+    std::pmr::unordered_set<Processor*> needed{util::arenaResource()};
+    const auto neededBy = [&](Outport* outport) {
+        return std::ranges::any_of(outport->getConnectedInports(), [&](Inport* inport) {
+            auto* successor = inport->getProcessor();
+            return needed.contains(successor) && successor->isConnectionActive(inport, outport);
+        });
+    };
+    for (auto* processor : std::views::reverse(order)) {
+        if (processor->isSink() || std::ranges::any_of(processor->getOutports(), neededBy)) {
+            needed.insert(processor);
+        }
+    }
 
-                processor->notifyObserversAboutToProcess(processor);
+    processorsSorted_.clear();
+    std::ranges::copy_if(order, std::back_inserter(processorsSorted_),
+                         [&](Processor* p) { return needed.contains(p); });
+}
 
-                try {
-                    IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
-                    // do the actual processing
-                    processor->process();
+bool ProcessorNetworkEvaluator::prepareProcessor(Processor* processor) {
+    if (!processor->isReady()) {
+        try {
+            processor->doIfNotReady();
+        } catch (...) {
+            exceptionHandler_(processor, EvaluationType::NotReady, SourceContext{});
+        }
+        return false;
+    }
+
+    try {
+        // re-initialize resources (e.g., shaders) if necessary
+        if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
+            processor->initializeResources();
+        }
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::InitResource, SourceContext{});
+        return false;
+    }
 
-                    // Set processor as valid only if we still are ready.
-                    // Callbacks might have made our inports invalid, if so abort
-                    // the evaluation by not setting the processor valid.
-                    if (processor->isReady()) processor->setValid();
+    try {
+        // call onChange for all invalid inports
+        for (auto inport : processor->getInports()) {
+            inport->callOnChangeIfChanged();
+        }
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::PortOnChange, SourceContext{});
+        return false;
+    }
 
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::Process, SourceContext{});
+    processor->notifyObserversAboutToProcess(processor);
+    return true;
+}
+
+void ProcessorNetworkEvaluator::finishProcessor(Processor* processor, std::exception_ptr error) {
+    if (error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (...) {
+            exceptionHandler_(processor, EvaluationType::Process, SourceContext{});
+        }
+    } else if (processor->isReady()) {
+        // Set processor as valid only if we still are ready.
+        // Callbacks might have made our inports invalid, if so abort
+        // the evaluation by not setting the processor valid.
+        processor->setValid();
+    }
+
+    processor->notifyObserversFinishedProcess(processor);
+}
+
+void ProcessorNetworkEvaluator::evaluateSerial() {
+    for (auto processor : processorsSorted_) {
+        if (processor->isValid() || !prepareProcessor(processor)) continue;
+
+        std::exception_ptr error;
+        try {
+            IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
+            // do the actual processing
+            resultCache_.process(*processor);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        finishProcessor(processor, error);
+    }
+}
+
+void ProcessorNetworkEvaluator::evaluateParallel() {
+    const auto count = processorsSorted_.size();
+
+    auto* arena = util::arenaResource();
+
+    // Build the dependency graph from the active connections between the sorted processors
+    std::pmr::unordered_map<Processor*, size_t> index{arena};
+    for (size_t i = 0; i < count; ++i) {
+        index[processorsSorted_[i]] = i;
+    }
+    std::pmr::vector<size_t> dependencies(count, 0, arena);
+    std::pmr::vector<std::pmr::vector<size_t>> successors(count, arena);
+    for (size_t i = 0; i < count; ++i) {
+        auto* processor = processorsSorted_[i];
+        for (auto* inport : processor->getInports()) {
+            for (auto* outport : inport->getConnectedOutports()) {
+                if (!processor->isConnectionActive(inport, outport)) continue;
+                if (auto it = index.find(outport->getProcessor()); it != index.end()) {
+                    successors[it->second].push_back(i);
+                    ++dependencies[i];
                 }
+            }
+        }
+    }
+
+    // Processors connected through property links, directly or through other processors, form a
+    // group. Anything run on the main thread for a processor, like process, initializeResources or
+    // port callbacks, can set properties in its group through the links. So a processor is only
+    // started while no other processor of its group is in flight on a worker, or a property could
+    // be written while the worker reads it.
+    std::pmr::unordered_map<Processor*, Processor*> parent{arena};
+    const auto find = [&](Processor* processor) {
+        auto* root = processor;
+        for (auto it = parent.find(root); it != parent.end() && it->second != root;
+             it = parent.find(root)) {
+            root = it->second;
+        }
+        parent[processor] = root;
+        return root;
+    };
+    processorNetwork_->forEachLink([&](const PropertyLink& link) {
+        auto* src = link.getSource()->getOwner();
+        auto* dst = link.getDestination()->getOwner();
+        auto* srcProcessor = src ? src->getProcessor() : nullptr;
+        auto* dstProcessor = dst ? dst->getProcessor() : nullptr;
+        if (srcProcessor && dstProcessor) parent[find(srcProcessor)] = find(dstProcessor);
+    });
+    std::pmr::vector<Processor*> group(count, nullptr, arena);
+    for (size_t i = 0; i < count; ++i) {
+        group[i] = find(processorsSorted_[i]);
+    }
+    std::pmr::unordered_map<Processor*, size_t> inFlight{arena};
 
-                processor->notifyObserversFinishedProcess(processor);
+    // Ready processors are handled in topological order to keep the evaluation deterministic
+    std::pmr::set<size_t> ready{arena};
+    for (size_t i = 0; i < count; ++i) {
+        if (dependencies[i] == 0) ready.insert(i);
+    }
 
+    struct Finished {
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::vector<std::pair<size_t, std::exception_ptr>> processed;
+    } finished;
+
+    size_t done = 0;
+    size_t running = 0;
+    const auto complete = [&](size_t i) {
+        ++done;
+        for (auto successor : successors[i]) {
+            if (--dependencies[successor] == 0) ready.insert(successor);
+        }
+    };
+
+    auto& pool = processorNetwork_->getApplication()->getThreadPool();
+    while (done < count) {
+        for (auto it = ready.begin(); it != ready.end();) {
+            const auto i = *it;
+            if (inFlight[group[i]] > 0) {
+                // Wait for the processors of the group that are in flight
+                ++it;
+                continue;
+            }
+            ready.erase(it);
+            auto* processor = processorsSorted_[i];
+
+            if (processor->isValid() || !prepareProcessor(processor)) {
+                complete(i);
+            } else if (processor->isThreadSafe()) {
+                ++running;
+                ++inFlight[group[i]];
+                pool.enqueueRaw([this, processor, i, &finished]() {
+                    const util::ArenaScope arena;
+                    std::exception_ptr error;
+                    try {
+                        IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
+                        resultCache_.process(*processor);
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                    {
+                        std::scoped_lock lock{finished.mutex};
+                        finished.processed.emplace_back(i, error);
+                    }
+                    finished.condition.notify_one();
+                });
             } else {
+                std::exception_ptr error;
                 try {
-                    processor->doIfNotReady();
+                    IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
+                    resultCache_.process(*processor);
                 } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::NotReady, SourceContext{});
+                    error = std::current_exception();
                 }
+                finishProcessor(processor, error);
+                complete(i);
             }
+            // Successors of a completed processor come later in the order, continue after i to
+            // visit them too. The skipped processors before i stay blocked until a job finishes.
+            it = ready.upper_bound(i);
         }
-    }
 
-    notifyObserversProcessorNetworkEvaluationEnd();
+        // Nothing left to wait for, can only happen if the graph was not a DAG
+        if (running == 0) break;
+
+        std::vector<std::pair<size_t, std::exception_ptr>> processed;
+        {
+            std::unique_lock lock{finished.mutex};
+            finished.condition.wait(lock, [&]() { return !finished.processed.empty(); });
+            std::swap(processed, finished.processed);
+        }
+        for (auto& [i, error] : processed) {
+            --running;
+            --inFlight[group[i]];
+            finishProcessor(processorsSorted_[i], error);
+            complete(i);
+        }
+    }
 }
 
 void ProcessorNetworkEvaluator::onProcessorSinkChanged(Processor*) { needsSorting_ = true; }
@@ -169,19 +395,29 @@ void ProcessorNetworkEvaluator::onProcessorActiveConnectionsChanged(Processor*)
 
 void ProcessorNetworkEvaluator::onProcessorNetworkDidAddProcessor(Processor* p) {
     p->ProcessorObservable::addObserver(this);
+    processorOrder_.addNode(p);
     needsSorting_ = true;
 }
 
 void ProcessorNetworkEvaluator::onProcessorNetworkDidRemoveProcessor(Processor* p) {
     p->ProcessorObservable::removeObserver(this);
+    processorOrder_.removeNode(p);
+    std::erase(processorsSorted_, p);
+    resultCache_.forget(p);
     needsSorting_ = true;
 }
 
-void ProcessorNetworkEvaluator::onProcessorNetworkDidAddConnection(const PortConnection&) {
+void ProcessorNetworkEvaluator::onProcessorNetworkDidAddConnection(
+    const PortConnection& connection) {
+    processorOrder_.addEdge(connection.getOutport()->getProcessor(),
+                            connection.getInport()->getProcessor());
     needsSorting_ = true;
 }
 
-void ProcessorNetworkEvaluator::onProcessorNetworkDidRemoveConnection(const PortConnection&) {
+void ProcessorNetworkEvaluator::onProcessorNetworkDidRemoveConnection(
+    const PortConnection& connection) {
+    processorOrder_.removeEdge(connection.getOutport()->getProcessor(),
+                               connection.getInport()->getProcessor());
     needsSorting_ = true;
 }
 
@@ -0,0 +1,205 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/network/processorresultcache.h>
+
+#include <inviwo/core/io/serialization/serializer.h>
+#include <inviwo/core/ports/inport.h>
+#include <inviwo/core/ports/outport.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/processorinfo.h>
+#include <inviwo/core/processors/processortags.h>
+#include <inviwo/core/util/stdextensions.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <memory_resource>
+#include <ranges>
+#include <string_view>
+
+namespace inviwo {
+
+namespace {
+
+size_t combine(size_t seed, size_t value) {
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+}  // namespace
+
+void ProcessorResultCache::setCapacity(size_t bytes) {
+    const std::scoped_lock lock{mutex_};
+    capacity_ = bytes;
+    evict(capacity_);
+}
+
+size_t ProcessorResultCache::getCapacity() const {
+    const std::scoped_lock lock{mutex_};
+    return capacity_;
+}
+
+size_t ProcessorResultCache::getUsage() const {
+    const std::scoped_lock lock{mutex_};
+    return usage_;
+}
+
+bool ProcessorResultCache::process(Processor& processor) {
+    Key key{};
+    if (getCapacity() == 0 ||
+        !util::contains(processor.getProcessorInfo().tags.tags_, Tags::Deterministic) ||
+        !makeKey(processor, key)) {
+        processor.process();
+        return false;
+    }
+
+    std::vector<std::shared_ptr<const void>> outputs;
+    bool found = false;
+    {
+        const std::scoped_lock lock{mutex_};
+        const auto [begin, end] = entries_.equal_range(key.hash);
+        for (auto it = begin; it != end; ++it) {
+            if (matches(it->second, processor, key)) {
+                it->second.tick = ++tick_;
+                outputs = it->second.outputs;
+                found = true;
+                break;
+            }
+        }
+    }
+
+    if (found) {
+        for (auto&& [outport, data] : std::views::zip(processor.getOutports(), outputs)) {
+            outport->setCacheableData(std::move(data));
+        }
+        return true;
+    }
+
+    processor.process();
+    add(processor, std::move(key));
+    return false;
+}
+
+void ProcessorResultCache::forget(const Processor* processor) {
+    const std::scoped_lock lock{mutex_};
+    std::erase_if(entries_, [&](const auto& item) {
+        if (item.second.processor != processor) return false;
+        usage_ -= item.second.bytes;
+        return true;
+    });
+}
+
+void ProcessorResultCache::clear() {
+    const std::scoped_lock lock{mutex_};
+    entries_.clear();
+    usage_ = 0;
+}
+
+bool ProcessorResultCache::makeKey(const Processor& processor, Key& key) {
+    key.hash = std::hash<const void*>{}(&processor);
+    for (auto* inport : processor.getInports()) {
+        for (auto* outport : inport->getConnectedOutports()) {
+            if (!processor.isConnectionActive(inport, outport)) continue;
+            auto data = outport->getCacheableData().first;
+            if (!data && outport->hasData()) return false;
+            key.hash = combine(key.hash, std::hash<const void*>{}(data.get()));
+            key.inputs.push_back(std::move(data));
+        }
+    }
+
+    // Only the property state is of interest, skip the processor meta data like its position
+    std::pmr::monotonic_buffer_resource mbr{1024 * 16};
+    Serializer s{std::filesystem::path{}, SerializeConstants::InviwoWorkspace, &mbr};
+    s.setWorkspaceSaveMode(WorkspaceSaveMode::Undo);
+    processor.PropertyOwner::serialize(s);
+    std::pmr::string xml{&mbr};
+    s.write(xml);
+
+    key.state.assign(xml.begin(), xml.end());
+    key.hash = combine(key.hash, std::hash<std::string_view>{}(key.state));
+    return true;
+}
+
+bool ProcessorResultCache::matches(const Entry& entry, const Processor& processor,
+                                   const Key& key) {
+    return entry.processor == &processor &&
+           entry.outputs.size() == processor.getOutports().size() && entry.state == key.state &&
+           std::ranges::equal(entry.inputs, key.inputs, std::ranges::equal_to{},
+                              [](const std::weak_ptr<const void>& input) { return input.lock(); });
+}
+
+void ProcessorResultCache::add(Processor& processor, Key key) {
+    Entry entry{.processor = &processor,
+                .state = std::move(key.state),
+                .inputs = {key.inputs.begin(), key.inputs.end()},
+                .outputs = {},
+                .bytes = 0,
+                .tick = 0};
+    for (auto* outport : processor.getOutports()) {
+        auto [data, bytes] = outport->getCacheableData();
+        if (!data && outport->hasData()) return;
+        entry.outputs.push_back(std::move(data));
+        entry.bytes += bytes;
+    }
+
+    const std::scoped_lock lock{mutex_};
+    if (capacity_ == 0 || entry.bytes > capacity_) return;
+
+    const auto isOwn = [&](const auto& item) { return item.second.processor == &processor; };
+    const auto maxResults = static_cast<std::ptrdiff_t>(maxResultsPerProcessor);
+    if (std::ranges::count_if(entries_, isOwn) >= maxResults) {
+        const auto oldest = std::ranges::min_element(
+            entries_ | std::views::filter(isOwn), std::ranges::less{},
+            [](const auto& item) { return item.second.tick; });
+        usage_ -= oldest->second.bytes;
+        entries_.erase(oldest.base());
+    }
+
+    entry.tick = ++tick_;
+    usage_ += entry.bytes;
+    entries_.emplace(key.hash, std::move(entry));
+    evict(capacity_);
+}
+
+void ProcessorResultCache::evict(size_t capacity) {
+    if (capacity == 0) {
+        entries_.clear();
+        usage_ = 0;
+        return;
+    }
+    while (usage_ > capacity && !entries_.empty()) {
+        const auto oldest = std::ranges::min_element(
+            entries_, std::ranges::less{}, [](const auto& item) { return item.second.tick; });
+        usage_ -= oldest->second.bytes;
+        entries_.erase(oldest);
+    }
+}
+
+}  // namespace inviwo
@@ -87,6 +87,7 @@ size_t updateWorkspaces(InviwoApplication* app, const std::filesystem::path& pat
                     }
                 });
 
+                LogCentral::getPtr()->flush();
                 if (errorCounter->getErrorCount() > 0) {
                     throw Exception("Error messages found!");
                 }
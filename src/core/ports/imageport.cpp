@@ -285,6 +285,10 @@ Document ImageOutport::getInfo() const {
     return doc;
 }
 
+std::pair<std::shared_ptr<const void>, size_t> ImageOutport::getCacheableData() const {
+    return {nullptr, 0};
+}
+
 template class IVW_CORE_TMPL_INST BaseImageInport<0>;
 template class IVW_CORE_TMPL_INST BaseImageInport<1>;
 
@@ -72,10 +72,19 @@ InvalidationLevel Outport::getInvalidationLevel() const { return invalidationLev
 
 void Outport::setValid() {
     invalidationLevel_ = InvalidationLevel::Valid;
+    ++generation_;
     for (auto inport : connectedInports_) inport->setValid(this);
     isReady_.update();
 }
 
+size_t Outport::getGeneration() const { return generation_; }
+
+std::pair<std::shared_ptr<const void>, size_t> Outport::getCacheableData() const {
+    return {nullptr, 0};
+}
+
+void Outport::setCacheableData(std::shared_ptr<const void>) {}
+
 void Outport::propagateEvent(Event* event, Inport*) { processor_->propagateEvent(event, this); }
 
 const BaseCallBack* Outport::onConnect(std::function<void()> lambda) {
@@ -45,6 +45,7 @@
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/util/rendercontext.h>
 
+#include <algorithm>
 #include <string_view>
 
 namespace inviwo {
@@ -225,7 +226,27 @@ void PortInspectorManager::removePortInspector(PortInspectorMap::iterator it) {
     unusedInspectors_.push_back(std::move(portInspector));
 }
 
+std::shared_ptr<const Image> PortInspectorManager::getCachedPortInspectorImage(
+    const Outport* outport) {
+    if (!outport || !outport->hasData()) return nullptr;
+
+    const auto path = outport->getPath();
+    auto it = std::ranges::find(thumbnails_, path, &Thumbnail::path);
+    if (it == thumbnails_.end()) return nullptr;
+
+    if (it->generation != outport->getGeneration() ||
+        it->size != app_->getSystemSettings().portInspectorSize_.get()) {
+        thumbnails_.erase(it);
+        return nullptr;
+    }
+
+    thumbnails_.splice(thumbnails_.begin(), thumbnails_, it);
+    return thumbnails_.front().image;
+}
+
 std::shared_ptr<const Image> PortInspectorManager::renderPortInspectorImage(Outport* outport) {
+    if (auto cached = getCachedPortInspectorImage(outport)) return cached;
+
     std::shared_ptr<const Image> image;
 
     try {
@@ -265,6 +286,17 @@ std::shared_ptr<const Image> PortInspectorManager::renderPortInspectorImage(Outp
     } catch (...) {
         log::exception("Problem using port inspector");
     }
+
+    if (image) {
+        const auto path = outport->getPath();
+        std::erase_if(thumbnails_, [&](const Thumbnail& t) { return t.path == path; });
+        thumbnails_.push_front(Thumbnail{.path = path,
+                                         .generation = outport->getGeneration(),
+                                         .size = app_->getSystemSettings().portInspectorSize_.get(),
+                                         .image = image});
+        if (thumbnails_.size() > maxThumbnails) thumbnails_.pop_back();
+    }
+
     return image;
 }
 
@@ -285,10 +317,15 @@ void PortInspectorManager::clear() {
     portInspectors_.clear();
     unusedInspectors_.clear();
     embeddedProcessors_.clear();
+    thumbnails_.clear();
 }
 
 void PortInspectorManager::onProcessorNetworkWillRemoveProcessor(Processor* processor) {
-    for (auto& outport : processor->getOutports()) removePortInspector(outport);
+    for (auto& outport : processor->getOutports()) {
+        removePortInspector(outport);
+        const auto path = outport->getPath();
+        std::erase_if(thumbnails_, [&](const Thumbnail& t) { return t.path == path; });
+    }
 }
 
 void PortInspectorManager::serialize(Serializer& s) const {
@@ -0,0 +1,81 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/processors/asyncprocessor.h>
+
+namespace inviwo {
+
+AsyncProcessor::AsyncProcessor(pool::Options options, const std::string& identifier,
+                               const std::string& displayName)
+    : PoolProcessor(options, identifier, displayName), context_{}, running_{0} {}
+
+AsyncProcessor::~AsyncProcessor() {
+    cancel();
+    // The coroutines can't reach us anymore when they are destroyed
+    if (running_ > 0) notifyObserversFinishBackgroundWork(this, running_);
+}
+
+void AsyncProcessor::process() {
+    cancel();
+    context_ = std::make_shared<async::detail::Context>(getInviwoApplication());
+
+    auto task = processAsync();
+    ++running_;
+    notifyObserversStartBackgroundWork(this, 1);
+
+    const std::weak_ptr<AsyncProcessor> self =
+        std::dynamic_pointer_cast<AsyncProcessor>(shared_from_this());
+    task.start(
+        context_,
+        [self]() {
+            if (auto p = self.lock()) p->reportError();
+        },
+        [self]() {
+            if (auto p = self.lock()) {
+                --p->running_;
+                p->notifyObserversFinishBackgroundWork(p.get(), 1);
+            }
+        });
+}
+
+void AsyncProcessor::invalidate(InvalidationLevel invalidationLevel, Property* source) {
+    if (invalidationLevel >= InvalidationLevel::InvalidOutput && !keepOldJobs()) cancel();
+    PoolProcessor::invalidate(invalidationLevel, source);
+}
+
+void AsyncProcessor::cancel() {
+    if (context_) {
+        context_->stop = true;
+        context_.reset();
+    }
+}
+
+bool AsyncProcessor::isRunning() const { return running_ > 0; }
+
+}  // namespace inviwo
@@ -44,6 +44,10 @@
 #include <inviwo/core/network/networklock.h>
 #include <inviwo/core/util/rendercontext.h>
 
+#include <algorithm>
+
+#include <glm/common.hpp>
+
 namespace inviwo {
 
 CanvasProcessor::CanvasProcessor(InviwoApplication* app)
@@ -169,6 +173,7 @@ CanvasProcessor::CanvasProcessor(InviwoApplication* app)
                           "not show the canvas for example"_help,
                           false}
     , previousImageSize_(customInputDimensions_)
+    , renderScale_{1.0}
     , widgetMetaData_{
           createMetaData<ProcessorWidgetMetaData>(ProcessorWidgetMetaData::classIdentifier)} {
     addPort(inport_);
@@ -267,6 +272,12 @@ void CanvasProcessor::onProcessorWidgetVisibilityChange(ProcessorWidgetMetaData*
     invalidate(InvalidationLevel::InvalidOutput);
 }
 
+void CanvasProcessor::onProcessorWidgetExposureChange(ProcessorWidgetMetaData*) {
+    isSink_.update();
+    isReady_.update();
+    if (widgetMetaData_->isExposed()) invalidate(InvalidationLevel::InvalidOutput);
+}
+
 void CanvasProcessor::setCanvasSize(size2_t dim) {
     const NetworkLock lock(this);
     dimensions_.set(dim);
@@ -278,6 +289,14 @@ size2_t CanvasProcessor::getCanvasSize() const { return dimensions_; }
 bool CanvasProcessor::getUseCustomDimensions() const { return enableCustomInputDimensions_; }
 size2_t CanvasProcessor::getCustomDimensions() const { return customInputDimensions_; }
 
+void CanvasProcessor::setRenderScale(double scale) {
+    scale = std::clamp(scale, 0.01, 1.0);
+    if (scale == renderScale_) return;
+    renderScale_ = scale;
+    sizeChanged();
+}
+double CanvasProcessor::getRenderScale() const { return renderScale_; }
+
 void CanvasProcessor::sizeChanged() {
     const NetworkLock lock(this);
     RenderContext::getPtr()->activateDefaultRenderContext();
@@ -292,8 +311,9 @@ void CanvasProcessor::sizeChanged() {
         customInputDimensions_.set(calcScaledSize(dimensions_, aspectRatioScaling_));
     }
 
-    ResizeEvent resizeEvent{enableCustomInputDimensions_ ? customInputDimensions_ : dimensions_,
-                            previousImageSize_};
+    const size2_t size = enableCustomInputDimensions_ ? customInputDimensions_ : dimensions_;
+    const auto scaled = glm::max(size2_t{glm::round(dvec2{size} * renderScale_)}, size2_t{1});
+    ResizeEvent resizeEvent{renderScale_ == 1.0 ? size : scaled, previousImageSize_};
     previousImageSize_ = resizeEvent.size();
 
     inputSize_.invalidate(InvalidationLevel::Valid, &customInputDimensions_);
@@ -384,7 +404,7 @@ void CanvasProcessor::propagateEvent(Event* event, Outport* source) {
         // Avoid continues evaluation when port dimensions changes
         const NetworkLock lock(this);
         dimensions_.set(resizeEvent->size());
-        if (enableCustomInputDimensions_) {
+        if (enableCustomInputDimensions_ || renderScale_ != 1.0) {
             sizeChanged();
         } else {
             inport_.propagateEvent(resizeEvent, nullptr);
@@ -411,10 +431,10 @@ void CanvasProcessor::setEvaluateWhenHidden(bool value) {
         isSink_.setUpdate([]() { return true; });
         isReady_.setUpdate(getDefaultIsReadyUpdater(this));
     } else {
-        isSink_.setUpdate([this]() { return processorWidget_ && processorWidget_->isVisible(); });
+        isSink_.setUpdate([this]() { return processorWidget_ && processorWidget_->isExposed(); });
         isReady_.setUpdate(
             [this, defaultCheck = getDefaultIsReadyUpdater(this)]() -> ProcessorStatus {
-                if (!processorWidget_ || !processorWidget_->isVisible()) {
+                if (!processorWidget_ || !processorWidget_->isExposed()) {
                     static constexpr std::string_view reason{"Canvas is not visible"};
                     return {ProcessorStatus::NotReady, reason};
                 } else {
@@ -29,9 +29,11 @@
 
 #include <inviwo/core/processors/poolprocessor.h>
 #include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/networkutils.h>
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/util/stringconversion.h>
 #include <inviwo/core/util/stdfuture.h>
+#include <inviwo/core/resourcemanager/memorybudget.h>
 
 #include <fmt/format.h>
 
@@ -101,12 +103,20 @@ void PoolProcessor::stopJobs() {
 
 bool PoolProcessor::hasJobs() { return !states_.empty(); }
 
+ThreadPool::Priority PoolProcessor::priority() const {
+    if (options_.contains(pool::Option::Interactive)) return ThreadPool::Priority::Interactive;
+    if (options_.contains(pool::Option::Background)) return ThreadPool::Priority::Background;
+    return ThreadPool::Priority::Normal;
+}
+
 void PoolProcessor::submit(Submission& job) {
     job.setupProgress();
     states_.push_back(job.state);
     notifyObserversStartBackgroundWork(this, job.tasks.size());
+    auto& pool = util::getThreadPool(getInviwoApplication());
+    const auto prio = priority();
     for (auto& task : job.tasks) {
-        util::getThreadPool(getInviwoApplication()).enqueueRaw(std::move(task));
+        pool.enqueueRaw(std::move(task), prio);
     }
 }
 
@@ -114,10 +124,23 @@ void PoolProcessor::invalidate(InvalidationLevel invalidationLevel, Property* so
     error_.reset();
     isReady_.update();
 
+    // Any running job will be working on outdated inputs, unless old results are wanted.
+    if (invalidationLevel >= InvalidationLevel::InvalidOutput && !keepOldJobs()) stopJobs();
+
     if (delayInvalidation()) {
         notifyObserversInvalidationBegin(this);
         PropertyOwner::invalidate(invalidationLevel, source);
         notifyObserversInvalidationEnd(this);
+
+        // The invalidation will not reach the dependent processors until we have new results,
+        // but their jobs will be outdated by then anyway, so cancel them now.
+        if (invalidationLevel >= InvalidationLevel::InvalidOutput) {
+            for (auto* successor : util::getSuccessors(this)) {
+                if (auto* pp = dynamic_cast<PoolProcessor*>(successor); pp && !pp->keepOldJobs()) {
+                    pp->stopJobs();
+                }
+            }
+        }
     } else {
         Processor::invalidate(invalidationLevel, source);
     }
@@ -150,6 +173,11 @@ std::string PoolProcessor::handleError() {
 
 const std::optional<std::string>& PoolProcessor::error() const { return error_; }
 
+void PoolProcessor::reportError() {
+    error_ = handleError();
+    isReady_.update();
+}
+
 void PoolProcessor::newResults() { newResults(getOutports()); }
 
 void PoolProcessor::newResults(const std::vector<Outport*>& outports) {
@@ -178,6 +206,11 @@ bool PoolProcessor::removeState(const std::shared_ptr<pool::detail::State>& stat
     return isLast;
 }
 
+std::shared_ptr<void> PoolProcessor::holdMemory() {
+    if (auto* budget = MemoryBudget::getEnabled()) return budget->hold();
+    return nullptr;
+}
+
 Delay& PoolProcessor::getDelay() {
     if (!delay_) {
         delay_.emplace(std::chrono::milliseconds(500),
@@ -310,12 +310,22 @@ void Processor::invalidate(InvalidationLevel invalidationLevel, Property* modifi
     if (!isValid()) {
         // We need to always propagate the invalidation here even if we have aleady done so before
         // since processors with optional inports can have become valid while this is still
-        // invalid. Hence we need to make sure we invalidate them again
-        for (auto& port : outports_) port->invalidate(InvalidationLevel::InvalidOutput);
+        // invalid. Hence we need to make sure we invalidate them again.
+        // While the network is batching changes this is done once when the batch ends.
+        if (!network_ || !network_->deferInvalidation(this)) {
+            for (auto& port : outports_) port->invalidate(InvalidationLevel::InvalidOutput);
+        }
     }
     notifyObserversInvalidationEnd(this);
 }
 
+void Processor::propagateInvalidation() {
+    if (isValid()) return;
+    notifyObserversInvalidationBegin(this);
+    for (auto& port : outports_) port->invalidate(InvalidationLevel::InvalidOutput);
+    notifyObserversInvalidationEnd(this);
+}
+
 bool Processor::isSource() const { return isSource_; }
 
 bool Processor::isSink() const { return isSink_; }
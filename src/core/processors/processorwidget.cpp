@@ -43,6 +43,9 @@ ProcessorWidget::ProcessorWidget(Processor* p)
 void ProcessorWidget::setVisible(bool visible) { metaData_->setVisible(visible, this); }
 bool ProcessorWidget::isVisible() const { return metaData_->isVisible(); }
 
+bool ProcessorWidget::isExposed() const { return isVisible() && metaData_->isExposed(); }
+void ProcessorWidget::setExposed(bool exposed) { metaData_->setExposed(exposed, this); }
+
 Processor* ProcessorWidget::getProcessor() const { return processor_; }
 
 glm::ivec2 ProcessorWidget::getDimensions() const { return metaData_->getDimensions(); }
@@ -53,7 +53,7 @@ PropertyPresetManager::PropertyPresetManager(InviwoApplication* app) : app_{app}
 bool PropertyPresetManager::loadPreset(const std::string& name, Property* property,
                                        PropertyPresetType type) const {
     auto apply = [this](Property* p, const std::string& data) {
-        NetworkLock lock(p);
+        NetworkBatch batch(p);
         std::stringstream ss;
         ss << data;
         auto d = app_->getWorkspaceManager()->createWorkspaceDeserializer(ss, "");
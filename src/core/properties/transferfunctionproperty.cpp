@@ -72,8 +72,10 @@ TransferFunctionProperty::TransferFunctionProperty(std::string_view identifier,
     , histogramMode_("showHistogram_", port ? HistogramMode::All : HistogramMode::Off)
     , histogramSelection_("histogramSelection", histogramSelectionAll)
     , lookup_{}
+    , preIntegrated_{256, TFLookupTable::Type::PreIntegrated}
     , data_{std::move(port)}
-    , invalidLookup_{true} {
+    , invalidLookup_{true}
+    , invalidPreIntegrated_{true} {
 
     tf_.value.addObserver(this);
 }
@@ -103,8 +105,10 @@ TransferFunctionProperty::TransferFunctionProperty(const TransferFunctionPropert
     , histogramMode_(rhs.histogramMode_)
     , histogramSelection_(rhs.histogramSelection_)
     , lookup_{}
+    , preIntegrated_{rhs.preIntegrated_.getSize(), TFLookupTable::Type::PreIntegrated}
     , data_{rhs.data_}
-    , invalidLookup_{true} {
+    , invalidLookup_{true}
+    , invalidPreIntegrated_{true} {
 
     tf_.value.addObserver(this);
 }
@@ -264,22 +268,27 @@ void TransferFunctionProperty::set(const IsoTFProperty* p) { set(p->tf_.get());
 
 void TransferFunctionProperty::onTFPrimitiveAdded(const TFPrimitiveSet&, TFPrimitive&) {
     invalidLookup_ = true;
+    invalidPreIntegrated_ = true;
     propertyModified();
 }
 void TransferFunctionProperty::onTFPrimitiveRemoved(const TFPrimitiveSet&, TFPrimitive&) {
     invalidLookup_ = true;
+    invalidPreIntegrated_ = true;
     propertyModified();
 }
 void TransferFunctionProperty::onTFPrimitiveChanged(const TFPrimitiveSet&, const TFPrimitive&) {
     invalidLookup_ = true;
+    invalidPreIntegrated_ = true;
     propertyModified();
 }
 void TransferFunctionProperty::onTFTypeChanged(const TFPrimitiveSet&, TFPrimitiveSetType) {
     invalidLookup_ = true;
+    invalidPreIntegrated_ = true;
     propertyModified();
 }
 void TransferFunctionProperty::onTFMaskChanged(const TFPrimitiveSet&, dvec2) {
     invalidLookup_ = true;
+    invalidPreIntegrated_ = true;
     propertyModified();
 }
 
@@ -0,0 +1,225 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/resourcemanager/memorybudget.h>
+
+#include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/rendercontext.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+std::atomic<MemoryBudget*> enabledBudget{nullptr};
+
+constexpr size_t index(MemoryBudget::Pool pool) { return static_cast<size_t>(pool); }
+
+}  // namespace
+
+MemoryBudget::MemoryBudget(ProcessorNetworkEvaluator* evaluator)
+    : holds_{std::make_shared<Holds>()} {
+    registerRepresentation<VolumeRAM>(Pool::RAM);
+    registerRepresentation<LayerRAM>(Pool::RAM);
+    registerRepresentation<BufferRAM>(Pool::RAM);
+
+    evaluator->addObserver(this);
+}
+
+MemoryBudget::~MemoryBudget() {
+    auto* self = this;
+    enabledBudget.compare_exchange_strong(self, nullptr);
+}
+
+void MemoryBudget::setBudget(Pool pool, size_t bytes) {
+    {
+        const std::scoped_lock lock{mutex_};
+        budget_[index(pool)] = bytes;
+    }
+    updateEnabled();
+    enforce();
+}
+
+size_t MemoryBudget::getBudget(Pool pool) const {
+    const std::scoped_lock lock{mutex_};
+    return budget_[index(pool)];
+}
+
+size_t MemoryBudget::getUsage(Pool pool) const {
+    const std::scoped_lock lock{mutex_};
+    return usage_[index(pool)];
+}
+
+double MemoryBudget::getPressure(Pool pool) const {
+    const std::scoped_lock lock{mutex_};
+    const auto budget = budget_[index(pool)];
+    if (budget == 0) return 0.0;
+    return static_cast<double>(usage_[index(pool)]) / static_cast<double>(budget);
+}
+
+void MemoryBudget::registerRepresentation(std::type_index type, Pool pool) {
+    const std::scoped_lock lock{mutex_};
+    types_.insert_or_assign(type, pool);
+}
+
+void MemoryBudget::unregisterRepresentation(std::type_index type) {
+    const std::scoped_lock lock{mutex_};
+    types_.erase(type);
+    std::erase_if(entries_, [&](const auto& item) {
+        if (item.first.second != type) return false;
+        usage_[index(item.second.pool)] -= item.second.bytes;
+        return true;
+    });
+}
+
+void MemoryBudget::touch(const void* owner, std::type_index type, size_t bytes, Evict evict) {
+    const std::scoped_lock lock{mutex_};
+    const auto it = types_.find(type);
+    if (it == types_.end()) return;
+
+    const auto pool = it->second;
+    auto [entry, inserted] =
+        entries_.try_emplace(std::pair{owner, type}, Entry{pool, 0, 0, evict});
+    usage_[index(pool)] += bytes;
+    usage_[index(entry->second.pool)] -= entry->second.bytes;
+    entry->second.pool = pool;
+    entry->second.bytes = bytes;
+    entry->second.tick = ++tick_;
+}
+
+void MemoryBudget::forget(const void* owner) {
+    const std::scoped_lock lock{mutex_};
+    std::erase_if(entries_, [&](const auto& item) {
+        if (item.first.first != owner) return false;
+        usage_[index(item.second.pool)] -= item.second.bytes;
+        return true;
+    });
+}
+
+size_t MemoryBudget::enforce() {
+    size_t evicted = 0;
+    {
+        const std::scoped_lock lock{mutex_};
+        rendercontext::activateDefault();
+        evicted += evict(Pool::RAM);
+        evicted += evict(Pool::GL);
+    }
+    onChange_.invoke();
+    return evicted;
+}
+
+std::shared_ptr<void> MemoryBudget::hold() {
+    const auto tick = [&]() {
+        const std::scoped_lock lock{mutex_};
+        return evaluationStart_;
+    }();
+    const std::scoped_lock lock{holds_->mutex};
+    const auto it = holds_->ticks.insert(tick);
+    auto release = [holds = std::weak_ptr<Holds>{holds_}, it](void*) {
+        if (auto h = holds.lock()) {
+            const std::scoped_lock holdsLock{h->mutex};
+            h->ticks.erase(it);
+        }
+    };
+    return std::shared_ptr<void>{nullptr, std::move(release)};
+}
+
+size_t MemoryBudget::evict(Pool pool) {
+    const auto budget = budget_[index(pool)];
+    auto& usage = usage_[index(pool)];
+    if (budget == 0 || usage <= budget) return 0;
+
+    const auto keepAfter = [&]() {
+        const std::scoped_lock lock{holds_->mutex};
+        return holds_->ticks.empty() ? evaluationStart_
+                                     : std::min(evaluationStart_, *holds_->ticks.begin());
+    }();
+
+    std::vector<decltype(entries_)::iterator> candidates;
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->second.pool == pool && it->second.tick <= keepAfter) {
+            candidates.push_back(it);
+        }
+    }
+    std::ranges::sort(candidates, std::less<>{}, [](auto it) { return it->second.tick; });
+
+    size_t evicted = 0;
+    for (auto it : candidates) {
+        if (usage <= budget) break;
+        // Evict only needs the Data lock, which it only tries to take, so this can't deadlock
+        // with a Data that is waiting for our lock in touch.
+        if (it->second.evict(it->first.first, it->first.second)) {
+            usage -= it->second.bytes;
+            evicted += it->second.bytes;
+            entries_.erase(it);
+        }
+    }
+    return evicted;
+}
+
+MemoryBudget* MemoryBudget::getEnabled() { return enabledBudget.load(std::memory_order_relaxed); }
+
+std::shared_ptr<std::function<void()>> MemoryBudget::onChange(std::function<void()> callback) {
+    return onChange_.add(std::move(callback));
+}
+
+void MemoryBudget::onProcessorNetworkEvaluationBegin() {
+    const std::scoped_lock lock{mutex_};
+    evaluationStart_ = tick_;
+}
+
+void MemoryBudget::onProcessorNetworkEvaluationEnd() {
+    if (getEnabled() != this) return;
+    enforce();
+}
+
+void MemoryBudget::updateEnabled() {
+    const bool enabled = [&]() {
+        const std::scoped_lock lock{mutex_};
+        return std::ranges::any_of(budget_, [](size_t b) { return b > 0; });
+    }();
+    if (enabled) {
+        enabledBudget = this;
+    } else {
+        auto* self = this;
+        if (enabledBudget.compare_exchange_strong(self, nullptr)) {
+            const std::scoped_lock lock{mutex_};
+            entries_.clear();
+            usage_.fill(0);
+        }
+    }
+}
+
+}  // namespace inviwo
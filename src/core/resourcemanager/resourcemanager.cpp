@@ -29,4 +29,75 @@
 
 #include <inviwo/core/resourcemanager/resourcemanager.h>
 
-namespace inviwo {}  // namespace inviwo
+#include <inviwo/core/util/formatconversion.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace inviwo {
+
+std::vector<std::pair<std::string, size_t>> ResourceManager::bytesPerProcessor(
+    size_t groupIndex) const {
+    std::unordered_map<std::string_view, size_t> bytes;
+    std::visit(util::overloaded{[](std::monostate) {},
+                                [&](const auto* list) {
+                                    for (const auto& [key, resource] : *list) {
+                                        // The source is the path of the outport, "processor.port"
+                                        std::string_view id{};
+                                        if (resource.meta) {
+                                            id = resource.meta->source;
+                                            id = id.substr(0, id.find('.'));
+                                        }
+                                        bytes[id] += resource.sizeInBytes();
+                                    }
+                                }},
+               getGroup(groupIndex));
+
+    std::vector<std::pair<std::string, size_t>> result;
+    result.reserve(bytes.size());
+    for (const auto& [id, size] : bytes) result.emplace_back(id, size);
+    std::ranges::sort(result, std::greater<>{}, &std::pair<std::string, size_t>::second);
+    return result;
+}
+
+void ResourceManager::setWarningThreshold(size_t groupIndex, size_t bytes) {
+    if (groupIndex >= warningThreshold_.size()) return;
+    warningThreshold_[groupIndex] = bytes;
+    warned_[groupIndex] = false;
+    checkWarningThreshold(groupIndex);
+}
+
+size_t ResourceManager::getWarningThreshold(size_t groupIndex) const {
+    return groupIndex < warningThreshold_.size() ? warningThreshold_[groupIndex] : 0;
+}
+
+void ResourceManager::checkWarningThreshold(size_t groupIndex) {
+    const auto threshold = warningThreshold_[groupIndex];
+    if (threshold == 0) return;
+
+    if (bytes_[groupIndex] <= threshold) {
+        warned_[groupIndex] = false;
+        return;
+    }
+    if (warned_[groupIndex]) return;
+    warned_[groupIndex] = true;
+
+    constexpr size_t maxUsers = 5;
+    const auto users = bytesPerProcessor(groupIndex);
+    fmt::memory_buffer buff;
+    for (const auto& [id, size] : users | std::views::take(maxUsers)) {
+        fmt::format_to(std::back_inserter(buff), "\n  {}: {}", id.empty() ? "<no source>" : id,
+                       util::formatBytesToString(size));
+    }
+    log::warn("{} resources use {}, more than the warning threshold of {}. Largest users:{}",
+              names[groupIndex], util::formatBytesToString(bytes_[groupIndex]),
+              util::formatBytesToString(threshold), std::string_view{buff.data(), buff.size()});
+}
+
+}  // namespace inviwo
@@ -0,0 +1,135 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/bitset.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace inviwo;
+
+// A set with state.range(0) random values out of 0..4 * state.range(0), i.e. 25% density
+BitSet makeRandom(benchmark::State& state, std::uint32_t seed) {
+    const auto count = static_cast<std::uint32_t>(state.range(0));
+    std::mt19937 gen{seed};
+    std::uniform_int_distribution<std::uint32_t> dist{0, 4 * count};
+    std::vector<std::uint32_t> values(count);
+    for (auto& v : values) v = dist(gen);
+    return BitSet(values.begin(), values.end());
+}
+
+void Add(benchmark::State& state) {
+    const auto count = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state) {
+        BitSet b;
+        for (std::uint32_t i = 0; i < count; i += 3) b.add(i);
+        benchmark::DoNotOptimize(b);
+    }
+    state.SetItemsProcessed(state.iterations() * ((state.range(0) + 2) / 3));
+}
+
+void AddRange(benchmark::State& state) {
+    const auto count = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state) {
+        BitSet b;
+        b.addRange(0, count);
+        benchmark::DoNotOptimize(b);
+    }
+}
+
+void Contains(benchmark::State& state) {
+    const auto b = makeRandom(state, 1);
+    const auto count = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state) {
+        std::uint32_t hits = 0;
+        for (std::uint32_t i = 0; i < count; ++i) hits += b.contains(i) ? 1 : 0;
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void Iterate(benchmark::State& state) {
+    const auto b = makeRandom(state, 1);
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (auto v : b) sum += v;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * b.cardinality());
+}
+
+void Union(benchmark::State& state) {
+    const auto a = makeRandom(state, 1);
+    const auto b = makeRandom(state, 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a | b);
+    }
+}
+
+void Intersection(benchmark::State& state) {
+    const auto a = makeRandom(state, 1);
+    const auto b = makeRandom(state, 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a & b);
+    }
+}
+
+void SymmetricDifference(benchmark::State& state) {
+    const auto a = makeRandom(state, 1);
+    const auto b = makeRandom(state, 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a ^ b);
+    }
+}
+
+void ToVector(benchmark::State& state) {
+    const auto b = makeRandom(state, 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(b.toVector());
+    }
+    state.SetItemsProcessed(state.iterations() * b.cardinality());
+}
+
+}  // namespace
+
+BENCHMARK(Add)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(AddRange)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(Contains)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(Iterate)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(Union)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(Intersection)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(SymmetricDifference)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(ToVector)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+BENCHMARK_MAIN();
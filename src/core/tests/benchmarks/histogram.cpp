@@ -0,0 +1,102 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/algorithm/histogram1d.h>
+#include <inviwo/core/datastructures/datamapper.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <span>
+#include <vector>
+
+namespace {
+
+using namespace inviwo;
+
+template <typename T>
+std::vector<T> makeData(benchmark::State& state) {
+    std::mt19937 gen{42};
+    std::normal_distribution<double> dist{128.0, 32.0};
+    std::vector<T> data(static_cast<size_t>(state.range(0)));
+    for (auto& v : data) {
+        if constexpr (util::rank<T>::value > 0) {
+            for (glm::length_t i = 0; i < util::extent<T>::value; ++i) {
+                v[i] = static_cast<typename T::value_type>(dist(gen));
+            }
+        } else {
+            v = static_cast<T>(dist(gen));
+        }
+    }
+    return data;
+}
+
+template <typename T>
+void Histogram(benchmark::State& state) {
+    const auto data = makeData<T>(state);
+    const DataMapper dataMap{dvec2{0.0, 255.0}};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            util::calculateHistograms<T>(std::span<const T>{data}, dataMap, 2048));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void ApproximateHistogram(benchmark::State& state) {
+    const auto data = makeData<T>(state);
+    const DataMapper dataMap{dvec2{0.0, 255.0}};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            util::calculateApproximateHistograms<T>(std::span<const T>{data}, dataMap, 2048));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(Histogram<unsigned char>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 12, 1 << 24)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(Histogram<float>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 12, 1 << 24)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(Histogram<vec4>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 12, 1 << 24)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(ApproximateHistogram<float>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 21, 1 << 24)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,159 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/coremodulesharedlibrary.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/common/inviwomodulefactoryobject.h>
+#include <inviwo/core/network/networklock.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/ports/datainport.h>
+#include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace inviwo;
+
+namespace {
+
+struct ChainProcessor : Processor {
+    explicit ChainProcessor(const std::string& id)
+        : Processor(id, id), inport{"in"}, outport{"out"}, value{"value", "Value", 0, 0, 1000000} {
+        inport.setOptional(true);
+        addPorts(inport, outport);
+        addProperty(value);
+    }
+
+    virtual const ProcessorInfo& getProcessorInfo() const override { return processorInfo_; }
+    virtual void process() override { outport.setData(std::make_shared<int>(value.get())); }
+
+    static const ProcessorInfo processorInfo_;
+
+    DataInport<int> inport;
+    DataOutport<int> outport;
+    IntProperty value;
+};
+
+const ProcessorInfo ChainProcessor::processorInfo_{
+    "org.inviwo.ChainProcessor",  // Class identifier
+    "Chain Processor",            // Display name
+    "Benchmark",                  // Category
+    CodeState::Stable,            // Code state
+    Tags::CPU,                    // Tags
+};
+
+/**
+ * Add state.range(0) processors, each connected to the previous one, optionally with the value
+ * properties linked along the chain.
+ */
+std::vector<ChainProcessor*> buildChain(ProcessorNetwork& network, benchmark::State& state,
+                                        bool link) {
+    const NetworkLock lock{&network};
+    std::vector<ChainProcessor*> chain;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        auto* p = network.addProcessor(
+            std::make_shared<ChainProcessor>("chain" + std::to_string(i)));
+        if (!chain.empty()) {
+            network.addConnection(&chain.back()->outport, &p->inport);
+            if (link) network.addLink(&chain.back()->value, &p->value);
+        }
+        chain.push_back(p);
+    }
+    return chain;
+}
+
+void BuildNetwork(benchmark::State& state) {
+    for (auto _ : state) {
+        ProcessorNetwork network{InviwoApplication::getPtr()};
+        benchmark::DoNotOptimize(buildChain(network, state, true));
+        state.PauseTiming();
+        network.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Setting the first property propagates the value the whole chain of links. There is no
+// evaluator on the network, so only the link evaluation and invalidation is measured.
+void PropagateLinks(benchmark::State& state) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    const auto chain = buildChain(network, state, true);
+    int value = 0;
+    for (auto _ : state) {
+        chain.front()->value.set(++value % 1000000);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    network.clear();
+}
+
+void EvaluateNetwork(benchmark::State& state) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    const ProcessorNetworkEvaluator evaluator{&network};
+    const auto chain = buildChain(network, state, false);
+    for (auto _ : state) {
+        chain.front()->invalidate(InvalidationLevel::InvalidOutput);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    network.clear();
+}
+
+}  // namespace
+
+BENCHMARK(BuildNetwork)->RangeMultiplier(4)->Range(1 << 4, 1 << 10);
+BENCHMARK(PropagateLinks)->RangeMultiplier(4)->Range(1 << 4, 1 << 10);
+BENCHMARK(EvaluateNetwork)->RangeMultiplier(4)->Range(1 << 4, 1 << 10);
+
+int main(int argc, char** argv) {
+    LogCentral::init();
+    LogCentral::getPtr()->setVerbosity(LogVerbosity::Error);
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-Network");
+    {
+        std::vector<std::unique_ptr<InviwoModuleFactoryObject>> modules;
+        modules.emplace_back(createInviwoCore());
+        app.registerModules(std::move(modules));
+    }
+    app.processFront();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
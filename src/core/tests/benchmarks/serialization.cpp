@@ -0,0 +1,128 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/serialization/serialization.h>
+#include <inviwo/core/properties/compositeproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace inviwo;
+
+const std::filesystem::path refPath{"benchmark.inv"};
+
+std::vector<vec3> makePoints(benchmark::State& state) {
+    std::vector<vec3> points(static_cast<size_t>(state.range(0)));
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto f = static_cast<float>(i);
+        points[i] = vec3{f, 0.5f * f, 0.25f * f};
+    }
+    return points;
+}
+
+std::unique_ptr<CompositeProperty> makeComposite(benchmark::State& state) {
+    auto composite = std::make_unique<CompositeProperty>("composite", "Composite");
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        const auto id = "property" + std::to_string(i);
+        composite->addProperty(std::make_unique<FloatVec3Property>(id, id));
+    }
+    return composite;
+}
+
+std::pmr::string serializePoints(const std::vector<vec3>& points) {
+    std::pmr::string xml;
+    Serializer serializer{refPath};
+    serializer.serialize("points", points, "point");
+    serializer.write(xml);
+    return xml;
+}
+
+void SerializeContainer(benchmark::State& state) {
+    const auto points = makePoints(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(serializePoints(points));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void DeserializeContainer(benchmark::State& state) {
+    const auto xml = serializePoints(makePoints(state));
+    for (auto _ : state) {
+        Deserializer deserializer{xml, refPath};
+        std::vector<vec3> points;
+        deserializer.deserialize("points", points, "point");
+        benchmark::DoNotOptimize(points);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void SerializeProperties(benchmark::State& state) {
+    const auto composite = makeComposite(state);
+    for (auto _ : state) {
+        std::pmr::string xml;
+        Serializer serializer{refPath};
+        serializer.serialize("composite", *composite);
+        serializer.write(xml);
+        benchmark::DoNotOptimize(xml);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Deserializes into existing properties, like when loading a workspace state into a network
+void DeserializeProperties(benchmark::State& state) {
+    auto composite = makeComposite(state);
+    std::pmr::string xml;
+    {
+        Serializer serializer{refPath};
+        serializer.serialize("composite", *composite);
+        serializer.write(xml);
+    }
+    for (auto _ : state) {
+        Deserializer deserializer{xml, refPath};
+        deserializer.deserialize("composite", *composite);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(SerializeContainer)->RangeMultiplier(16)->Range(1 << 4, 1 << 16);
+BENCHMARK(DeserializeContainer)->RangeMultiplier(16)->Range(1 << 4, 1 << 16);
+BENCHMARK(SerializeProperties)->RangeMultiplier(4)->Range(1 << 2, 1 << 10);
+BENCHMARK(DeserializeProperties)->RangeMultiplier(4)->Range(1 << 2, 1 << 10);
+
+BENCHMARK_MAIN();
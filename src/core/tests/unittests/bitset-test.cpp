@@ -208,6 +208,20 @@ TEST(bitset, binarySerialization) {
     EXPECT_EQ(b, result);
 }
 
+TEST(bitset, addManyLarge) {
+    // Large enough to be split into several chunks that are merged
+    std::vector<std::uint32_t> indices(3'000'000);
+    std::mt19937 gen;
+    std::uniform_int_distribution<std::uint32_t> distrib(0, 50'000'000);
+    std::generate(indices.begin(), indices.end(), [&]() { return distrib(gen); });
+
+    const BitSet b{std::span<const std::uint32_t>{indices}};
+
+    const std::unordered_set<std::uint32_t> unique(indices.begin(), indices.end());
+    EXPECT_EQ(unique.size(), b.size());
+    EXPECT_TRUE(std::ranges::all_of(indices, [&](auto i) { return b.contains(i); }));
+}
+
 TEST(bitset, iterators) {
     std::vector<std::uint32_t> indices = getIndices(5);
     auto b = BitSet(indices.begin(), indices.end());
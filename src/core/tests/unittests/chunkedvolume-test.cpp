@@ -0,0 +1,103 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/chunkedvolumefile.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <numeric>
+#include <vector>
+
+namespace inviwo {
+
+class ChunkedVolumeTest : public ::testing::TestWithParam<util::ChunkedVolumeSettings> {
+protected:
+    ChunkedVolumeTest() : volume_{size3_t{13, 7, 5}}, file_{"chunked", ".ivc"} {
+        std::iota(volume_.getView().begin(), volume_.getView().end(), 0);
+        util::writeChunkedVolume(file_.getFileName(), volume_, GetParam());
+    }
+
+    VolumeRAMPrecision<int> volume_;
+    util::TempFileHandle file_;
+};
+
+TEST_P(ChunkedVolumeTest, Layout) {
+    const util::ChunkedVolumeFile file{file_.getFileName()};
+    EXPECT_EQ(volume_.getDimensions(), file.getDimensions());
+    EXPECT_EQ(glm::min(GetParam().chunkDimensions, volume_.getDimensions()),
+              file.getChunkDimensions());
+    EXPECT_EQ(sizeof(int), file.getElementSize());
+    EXPECT_EQ(GetParam().codec, file.getCodec());
+}
+
+TEST_P(ChunkedVolumeTest, ReadAll) {
+    const util::ChunkedVolumeFile file{file_.getFileName()};
+    std::vector<int> data(volume_.getView().size());
+    file.read(size3_t{0}, file.getDimensions(), std::as_writable_bytes(std::span{data}));
+
+    const auto view = volume_.getView();
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), data.begin()));
+}
+
+TEST_P(ChunkedVolumeTest, ReadRegion) {
+    const util::ChunkedVolumeFile file{file_.getFileName()};
+    const size3_t offset{3, 2, 1};
+    const size3_t dims{7, 4, 3};
+    std::vector<int> data(glm::compMul(dims));
+    file.read(offset, dims, std::as_writable_bytes(std::span{data}));
+
+    const util::IndexMapper3D volIm{volume_.getDimensions()};
+    const util::IndexMapper3D regionIm{dims};
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(static_cast<int>(volIm(offset + regionIm(i))), data[i]);
+    }
+}
+
+TEST_P(ChunkedVolumeTest, ReadOutside) {
+    const util::ChunkedVolumeFile file{file_.getFileName()};
+    std::vector<int> data(8);
+    EXPECT_ANY_THROW(
+        file.read(size3_t{12, 6, 4}, size3_t{2}, std::as_writable_bytes(std::span{data})));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ChunkedVolumeTests, ChunkedVolumeTest,
+    ::testing::Values(util::ChunkedVolumeSettings{size3_t{4}, util::ChunkCodec::Deflate, 1, true},
+                      util::ChunkedVolumeSettings{size3_t{5, 3, 2}, util::ChunkCodec::None, 1,
+                                                  false},
+                      util::ChunkedVolumeSettings{size3_t{64}, util::ChunkCodec::Deflate, 9,
+                                                  false}));
+
+}  // namespace inviwo
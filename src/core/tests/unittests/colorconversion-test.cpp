@@ -35,6 +35,8 @@
 #include <inviwo/core/util/colorconversion.h>
 #include <inviwo/core/util/exception.h>
 
+#include <vector>
+
 namespace inviwo {
 
 using namespace color;
@@ -89,4 +91,70 @@ TEST(colorconversion, rgb2hexIdentity) {
     EXPECT_EQ("#100000", rgb2hex(hex2rgba("#100000")));
 }
 
+namespace {
+
+std::vector<vec3> colorGrid() {
+    // 17^3 colors, which does not fill up the last block
+    std::vector<vec3> colors;
+    for (int r = 0; r <= 16; ++r) {
+        for (int g = 0; g <= 16; ++g) {
+            for (int b = 0; b <= 16; ++b) {
+                colors.emplace_back(r / 16.0f, g / 16.0f, b / 16.0f);
+            }
+        }
+    }
+    return colors;
+}
+
+void expectSameAsScalar(Conversion conversion, vec3 (*scalar)(const vec3&),
+                        const std::vector<vec3>& src, float tolerance) {
+    std::vector<vec3> dst(src.size());
+    convert(conversion, src, dst);
+    for (size_t i = 0; i < src.size(); ++i) {
+        const auto expected = scalar(src[i]);
+        for (int c = 0; c < 3; ++c) {
+            ASSERT_NEAR(expected[c], dst[i][c], tolerance) << "color " << i << " channel " << c;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(colorconversion, bulkConversions) {
+    const auto rgb = colorGrid();
+    const auto to = [&](vec3 (*scalar)(const vec3&)) {
+        std::vector<vec3> res;
+        for (const auto& c : rgb) res.push_back(scalar(c));
+        return res;
+    };
+    const auto rgb2labDefault = [](const vec3& c) { return rgb2lab(c); };
+    const auto lab2rgbDefault = [](const vec3& c) { return lab2rgb(c); };
+
+    expectSameAsScalar(Conversion::RgbToHsv, rgb2hsv, rgb, 1.0e-5f);
+    expectSameAsScalar(Conversion::HsvToRgb, hsv2rgb, to(rgb2hsv), 1.0e-5f);
+    expectSameAsScalar(Conversion::RgbToHsl, rgb2hsl, rgb, 1.0e-5f);
+    expectSameAsScalar(Conversion::HslToRgb, hsl2rgb, to(rgb2hsl), 1.0e-5f);
+    expectSameAsScalar(Conversion::RgbToXYZ, rgb2XYZ, rgb, 1.0e-5f);
+    expectSameAsScalar(Conversion::XYZToRgb, XYZ2rgb, to(rgb2XYZ), 1.0e-5f);
+    expectSameAsScalar(Conversion::RgbToLab, rgb2labDefault, rgb, 1.0e-3f);
+    expectSameAsScalar(Conversion::LabToRgb, lab2rgbDefault, to(rgb2labDefault), 1.0e-5f);
+    expectSameAsScalar(Conversion::RgbToYCbCr, rgb2ycbcr, rgb, 1.0e-5f);
+    expectSameAsScalar(Conversion::YCbCrToRgb, ycbcr2rgb, to(rgb2ycbcr), 1.0e-5f);
+}
+
+TEST(colorconversion, bulkInPlace) {
+    auto colors = colorGrid();
+    convert(Conversion::RgbToHsv, colors);
+    convert(Conversion::HsvToRgb, colors);
+    const auto rgb = colorGrid();
+    for (size_t i = 0; i < rgb.size(); ++i) {
+        EXPECT_NEAR(rgb[i].x, colors[i].x, 1.0e-5f);
+        EXPECT_NEAR(rgb[i].y, colors[i].y, 1.0e-5f);
+        EXPECT_NEAR(rgb[i].z, colors[i].z, 1.0e-5f);
+    }
+
+    std::vector<vec3> dst(colors.size() - 1);
+    EXPECT_THROW(convert(Conversion::RgbToHsv, colors, dst), Exception);
+}
+
 }  // namespace inviwo
@@ -0,0 +1,132 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/dataprefetch.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/io/tempfilehandle.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <numeric>
+#include <stop_token>
+#include <vector>
+
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+namespace {
+
+class DataPrefetchTest : public ::testing::Test {
+protected:
+    DataPrefetchTest() : data_(glm::compMul(dims_)), file_{"dataprefetch", ".raw"} {
+        std::iota(data_.begin(), data_.end(), 0);
+        std::fwrite(data_.data(), sizeof(int), data_.size(), file_.getHandle());
+        std::fflush(file_.getHandle());
+    }
+
+    std::shared_ptr<const Volume> createVolume() const {
+        const auto order = std::endian::native == std::endian::little ? ByteOrder::LittleEndian
+                                                                      : ByteOrder::BigEndian;
+        auto disk = std::make_shared<VolumeDisk>(file_.getFileName(), dims_, DataInt32::get());
+        disk->setLoader(
+            new RawVolumeRAMLoader(file_.getFileName(), 0, order, Compression::Disabled));
+        return std::make_shared<Volume>(disk);
+    }
+
+    static void wait(const std::shared_future<void>& future) {
+        ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(10)));
+        future.get();
+    }
+
+    size3_t dims_{9, 5, 3};
+    std::vector<int> data_;
+    util::TempFileHandle file_;
+};
+
+}  // namespace
+
+TEST_F(DataPrefetchTest, Completes) {
+    const auto volume = createVolume();
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+
+    wait(util::prefetch<VolumeRAM>(volume));
+    ASSERT_TRUE(volume->hasValidRepresentation<VolumeRAM>());
+
+    const auto* ram = volume->getRepresentation<VolumeRAM>();
+    const auto* values = static_cast<const int*>(ram->getData());
+    EXPECT_TRUE(std::equal(data_.begin(), data_.end(), values));
+}
+
+TEST_F(DataPrefetchTest, Canceled) {
+    const auto volume = createVolume();
+
+    std::stop_source stop;
+    stop.request_stop();
+    wait(util::prefetch<VolumeRAM>(volume, stop.get_token()));
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+}
+
+TEST_F(DataPrefetchTest, RequestAgain) {
+    const auto volume = createVolume();
+
+    // Two concurrent requests for the same representation both finish with one representation
+    const auto first = util::prefetch<VolumeRAM>(volume);
+    const auto second = util::prefetch<VolumeRAM>(volume);
+    wait(first);
+    wait(second);
+    ASSERT_TRUE(volume->hasValidRepresentation<VolumeRAM>());
+    const auto ram = volume->getRepresentationShared<VolumeRAM>();
+
+    // Requesting an existing valid representation does not replace it
+    wait(util::prefetch<VolumeRAM>(volume));
+    EXPECT_EQ(ram, volume->getRepresentationShared<VolumeRAM>());
+}
+
+TEST_F(DataPrefetchTest, MissingConverter) {
+    const std::shared_ptr<const Volume> volume =
+        std::make_shared<Volume>(std::make_shared<VolumeRAMPrecision<int>>(dims_));
+
+    const auto future = util::prefetch<VolumeDisk>(volume);
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(10)));
+    EXPECT_THROW(future.get(), ConverterException);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,139 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/dynamictopologicalorder.h>
+
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+using Edges = std::vector<std::pair<int, int>>;
+
+void expectTopological(const std::vector<int>& order, const Edges& edges) {
+    std::unordered_map<int, size_t> pos;
+    for (size_t i = 0; i < order.size(); ++i) pos[order[i]] = i;
+    for (const auto& [from, to] : edges) {
+        ASSERT_TRUE(pos.contains(from));
+        ASSERT_TRUE(pos.contains(to));
+        EXPECT_LT(pos[from], pos[to]) << from << " -> " << to;
+    }
+}
+
+}  // namespace
+
+TEST(DynamicTopologicalOrder, Incremental) {
+    util::DynamicTopologicalOrder<int> order;
+    for (int i = 0; i < 100; ++i) order.addNode(i);
+    EXPECT_EQ(order.update().size(), 100);
+
+    // Insert edges going backwards one at a time, forcing reordering each time
+    Edges edges;
+    for (int i = 99; i > 0; --i) {
+        order.addEdge(i, i - 1);
+        edges.emplace_back(i, i - 1);
+        expectTopological(order.update(), edges);
+    }
+    EXPECT_EQ(order.update().front(), 99);
+    EXPECT_EQ(order.update().back(), 0);
+}
+
+TEST(DynamicTopologicalOrder, Batched) {
+    std::mt19937 rand(0);
+    std::uniform_int_distribution<int> dist(0, 199);
+
+    util::DynamicTopologicalOrder<int> order;
+    // Shuffled node order with edges always from low to high, so the graph is acyclic
+    std::vector<int> nodes(200);
+    for (int i = 0; i < 200; ++i) nodes[i] = i;
+    std::ranges::shuffle(nodes, rand);
+    for (auto n : nodes) order.addNode(n);
+
+    Edges edges;
+    for (int i = 0; i < 400; ++i) {
+        const auto a = dist(rand);
+        const auto b = dist(rand);
+        if (a == b) continue;
+        edges.emplace_back(std::min(a, b), std::max(a, b));
+        order.addEdge(edges.back().first, edges.back().second);
+        // Mix of small batches (incremental) and large ones (rebuild)
+        if (i % 7 == 0 || i > 300) expectTopological(order.update(), edges);
+    }
+    expectTopological(order.update(), edges);
+}
+
+TEST(DynamicTopologicalOrder, Remove) {
+    util::DynamicTopologicalOrder<int> order;
+    order.addEdge(2, 1);
+    order.addEdge(1, 0);
+    order.addEdge(1, 0);
+    expectTopological(order.update(), {{2, 1}, {1, 0}});
+
+    order.removeEdge(1, 0);
+    int count = 0;
+    order.forEachSuccessor(1, [&](int) { ++count; });
+    EXPECT_EQ(count, 1);
+    order.removeEdge(1, 0);
+    count = 0;
+    order.forEachSuccessor(1, [&](int) { ++count; });
+    EXPECT_EQ(count, 0);
+
+    order.removeNode(1);
+    EXPECT_FALSE(order.contains(1));
+    EXPECT_EQ(order.update().size(), 2);
+
+    order.addEdge(0, 2);
+    expectTopological(order.update(), {{0, 2}});
+
+    order.addEdge(3, 4);
+    order.removeNode(4);
+    EXPECT_EQ(order.update(), (std::vector<int>{0, 2, 3}));
+}
+
+TEST(DynamicTopologicalOrder, Cycle) {
+    util::DynamicTopologicalOrder<int> order;
+    order.addEdge(0, 1);
+    order.addEdge(1, 2);
+    order.update();
+    order.addEdge(2, 0);
+    EXPECT_EQ(order.update().size(), 3);
+    order.removeEdge(2, 0);
+    expectTopological(order.update(), {{0, 1}, {1, 2}});
+}
+
+}  // namespace inviwo
@@ -198,4 +198,46 @@ TEST_F(Histogram1DTest, floatFractionalRangeUpper) {
     EXPECT_EQ(20, histograms[0].totalCounts) << "different total counts";
 }
 
+TEST_F(Histogram1DTest, severalChunks) {
+    // Large enough to be split into several chunks that are merged
+    std::vector<int> data(256 * 1024 + 10);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<int>(i % 256);
+    }
+    std::fill(data.end() - 10, data.end() - 6, -3);
+    std::fill(data.end() - 6, data.end(), 300);
+
+    const DataMapper dataMap{dvec2{0.0, 255.0}};
+    auto histograms = util::calculateHistograms<int>(data, dataMap, 256);
+    ASSERT_EQ(256, histograms[0].counts.size()) << "number of bins differs";
+    EXPECT_EQ(data.size(), histograms[0].totalCounts) << "different total counts";
+    EXPECT_EQ(4, histograms[0].underflow);
+    EXPECT_EQ(6, histograms[0].overflow);
+    EXPECT_TRUE(std::ranges::all_of(histograms[0].counts, [](size_t v) { return v == 1024; }))
+        << "different counts per bin";
+    EXPECT_DOUBLE_EQ(-3.0, histograms[0].dataStats.min);
+    EXPECT_DOUBLE_EQ(300.0, histograms[0].dataStats.max);
+}
+
+TEST_F(Histogram1DTest, approximate) {
+    std::vector<int> data(256 * 1024);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<int>(i % 256);
+    }
+    const DataMapper dataMap{dvec2{0.0, 255.0}};
+
+    EXPECT_TRUE(util::calculateApproximateHistograms<int>(data, dataMap, 256, data.size()).empty())
+        << "no approximation needed when all values are sampled";
+
+    const size_t maxSamples = 1024 * 16;
+    auto histograms = util::calculateApproximateHistograms<int>(data, dataMap, 256, maxSamples);
+    ASSERT_EQ(1, histograms.size());
+    ASSERT_EQ(256, histograms[0].counts.size()) << "number of bins differs";
+    EXPECT_LE(histograms[0].totalCounts, maxSamples);
+    EXPECT_GE(histograms[0].totalCounts, maxSamples / 2);
+    // The odd stride should hit every bin even though the data is periodic
+    EXPECT_TRUE(std::ranges::none_of(histograms[0].counts, [](size_t v) { return v == 0; }))
+        << "empty bins in the approximation";
+}
+
 }  // namespace inviwo
@@ -0,0 +1,110 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/util/layerramresampling.h>
+
+#include <array>
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::array filters{util::ResamplingFilter::Nearest, util::ResamplingFilter::Box,
+                             util::ResamplingFilter::Linear, util::ResamplingFilter::Lanczos};
+
+}  // namespace
+
+TEST(LayerRAMResampling, constantStaysConstant) {
+    LayerRAMPrecision<glm::u8vec4> src{size2_t{13, 7}};
+    std::ranges::fill(src.getView(), glm::u8vec4{10, 100, 200, 255});
+
+    for (auto filter : filters) {
+        for (const auto dims : {size2_t{4, 3}, size2_t{13, 7}, size2_t{40, 15}}) {
+            LayerRAMPrecision<glm::u8vec4> dst{dims};
+            ASSERT_TRUE(util::resample(src, dst, filter));
+            for (const auto& v : dst.getView()) {
+                EXPECT_EQ(glm::u8vec4(10, 100, 200, 255), v);
+            }
+        }
+    }
+}
+
+TEST(LayerRAMResampling, boxAveragesBlocks) {
+    LayerRAMPrecision<float> src{size2_t{4, 2}};
+    auto* data = src.getDataTyped();
+    for (size_t i = 0; i < 8; ++i) data[i] = static_cast<float>(i);
+
+    LayerRAMPrecision<float> dst{size2_t{2, 1}};
+    ASSERT_TRUE(util::resample(src, dst, util::ResamplingFilter::Box));
+    EXPECT_FLOAT_EQ((0.0f + 1.0f + 4.0f + 5.0f) / 4.0f, dst.getDataTyped()[0]);
+    EXPECT_FLOAT_EQ((2.0f + 3.0f + 6.0f + 7.0f) / 4.0f, dst.getDataTyped()[1]);
+}
+
+TEST(LayerRAMResampling, linearInterpolatesRamp) {
+    LayerRAMPrecision<float> src{size2_t{4, 1}};
+    for (size_t i = 0; i < 4; ++i) src.getDataTyped()[i] = static_cast<float>(i);
+
+    LayerRAMPrecision<float> dst{size2_t{8, 1}};
+    ASSERT_TRUE(util::resample(src, dst, util::ResamplingFilter::Linear));
+    // Destination centers map to (i + 0.5) / 2 - 0.5 in source samples, clamped at the edges
+    for (size_t i = 1; i < 7; ++i) {
+        EXPECT_FLOAT_EQ((static_cast<float>(i) + 0.5f) / 2.0f - 0.5f, dst.getDataTyped()[i]);
+    }
+    EXPECT_FLOAT_EQ(0.0f, dst.getDataTyped()[0]);
+    EXPECT_FLOAT_EQ(3.0f, dst.getDataTyped()[7]);
+}
+
+TEST(LayerRAMResampling, keepAspectRatio) {
+    LayerRAMPrecision<float> src{size2_t{4, 2}};
+    std::ranges::fill(src.getView(), 1.0f);
+
+    LayerRAMPrecision<float> dst{size2_t{4, 4}};
+    ASSERT_TRUE(util::resample(src, dst, util::ResamplingFilter::Linear,
+                               util::ConsiderAspectRatio::Yes));
+    for (size_t y = 0; y < 4; ++y) {
+        for (size_t x = 0; x < 4; ++x) {
+            EXPECT_FLOAT_EQ(y == 1 || y == 2 ? 1.0f : 0.0f, dst.getDataTyped()[y * 4 + x]);
+        }
+    }
+}
+
+TEST(LayerRAMResampling, formatMismatch) {
+    LayerRAMPrecision<float> src{size2_t{4, 4}};
+    LayerRAMPrecision<double> dst{size2_t{2, 2}};
+    EXPECT_FALSE(util::resample(src, dst, util::ResamplingFilter::Linear));
+}
+
+}  // namespace inviwo
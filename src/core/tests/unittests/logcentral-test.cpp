@@ -0,0 +1,83 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/logerrorcounter.h>
+
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+TEST(LogCentral, Asynchronous) {
+    LogCentral central;
+    auto counter = std::make_shared<LogErrorCounter>();
+    central.registerLogger(counter);
+    central.setAsynchronous(true);
+    EXPECT_TRUE(central.isAsynchronous());
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&central]() {
+            for (size_t i = 0; i < 2000; ++i) {
+                log::message(central, LogLevel::Info, "message {}", i);
+            }
+            log::report(central, LogLevel::Warn, "done");
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    central.flush();
+    EXPECT_EQ(counter->getInfoCount(), size_t{8000});
+    EXPECT_EQ(counter->getWarnCount(), size_t{4});
+
+    central.setAsynchronous(false);
+    EXPECT_FALSE(central.isAsynchronous());
+}
+
+TEST(LogCentral, RateLimit) {
+    LogCentral central;
+    auto counter = std::make_shared<LogErrorCounter>();
+    central.registerLogger(counter);
+    central.setRateLimit(10);
+
+    for (size_t i = 0; i < 100; ++i) {
+        log::message(central, LogLevel::Info, "message {}", i);
+        log::message(central, LogLevel::Error, "error {}", i);
+    }
+    EXPECT_EQ(counter->getInfoCount(), size_t{10});
+    EXPECT_EQ(counter->getErrorCount(), size_t{100});
+}
+
+}  // namespace inviwo
@@ -0,0 +1,154 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/resourcemanager/memorybudget.h>
+#include <inviwo/core/util/volumesampler.h>
+
+#include <bit>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+namespace {
+
+class MemoryBudgetTest : public ::testing::Test {
+protected:
+    MemoryBudgetTest()
+        : network_{InviwoApplication::getPtr()}
+        , evaluator_{&network_}
+        , budget_{&evaluator_}
+        , data_(glm::compMul(dims_))
+        , file_{"memorybudget", ".raw"} {
+        std::iota(data_.begin(), data_.end(), 0.0f);
+        std::fwrite(data_.data(), sizeof(float), data_.size(), file_.getHandle());
+        std::fflush(file_.getHandle());
+        // Anything in RAM is over budget
+        budget_.setBudget(MemoryBudget::Pool::RAM, 1);
+    }
+    virtual ~MemoryBudgetTest() { budget_.setBudget(MemoryBudget::Pool::RAM, 0); }
+
+    std::shared_ptr<Volume> createVolume() const {
+        const auto order = std::endian::native == std::endian::little ? ByteOrder::LittleEndian
+                                                                      : ByteOrder::BigEndian;
+        auto disk = std::make_shared<VolumeDisk>(file_.getFileName(), dims_, DataFloat32::get());
+        disk->setLoader(
+            new RawVolumeRAMLoader(file_.getFileName(), 0, order, Compression::Disabled));
+        return std::make_shared<Volume>(disk);
+    }
+
+    // The budget is enforced at the end of each evaluation, for representations used before it
+    void evaluate() { network_.notifyObserversProcessorNetworkEvaluateRequest(); }
+
+    ProcessorNetwork network_;
+    ProcessorNetworkEvaluator evaluator_;
+    MemoryBudget budget_;
+    size3_t dims_{8, 6, 4};
+    std::vector<float> data_;
+    util::TempFileHandle file_;
+};
+
+}  // namespace
+
+TEST_F(MemoryBudgetTest, EvictsUnused) {
+    auto volume = createVolume();
+    { auto ram = volume->getRepresentationShared<VolumeRAM>(); }
+    EXPECT_TRUE(volume->hasRepresentation<VolumeRAM>());
+
+    evaluate();
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+    EXPECT_EQ(size_t{0}, budget_.getUsage(MemoryBudget::Pool::RAM));
+}
+
+TEST_F(MemoryBudgetTest, KeepsShared) {
+    auto volume = createVolume();
+    auto ram = volume->getRepresentationShared<VolumeRAM>();
+
+    evaluate();
+    EXPECT_TRUE(volume->hasRepresentation<VolumeRAM>());
+}
+
+TEST_F(MemoryBudgetTest, KeepsSamplerAlive) {
+    auto volume = createVolume();
+    const VolumeSampler<dvec4> sampler{*volume};
+
+    evaluate();
+    budget_.enforce();
+    ASSERT_TRUE(volume->hasRepresentation<VolumeRAM>());
+
+    const auto* ram = volume->getRepresentation<VolumeRAM>();
+    EXPECT_DOUBLE_EQ(data_.back(), ram->getAsDouble(dims_ - size3_t{1}));
+    EXPECT_DOUBLE_EQ(data_.front(), sampler.sample(dvec3{0.0}).x);
+}
+
+TEST_F(MemoryBudgetTest, EvictsRawInLaterEvaluation) {
+    auto volume = createVolume();
+    const auto* ram = volume->getRepresentation<VolumeRAM>();
+    EXPECT_DOUBLE_EQ(data_.back(), ram->getAsDouble(dims_ - size3_t{1}));
+
+    // It was used before the evaluation started, so the raw pointer is not protected any more
+    evaluate();
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+
+    // and is recreated from the disk representation when asked for again
+    ram = volume->getRepresentation<VolumeRAM>();
+    EXPECT_DOUBLE_EQ(data_.back(), ram->getAsDouble(dims_ - size3_t{1}));
+}
+
+TEST_F(MemoryBudgetTest, KeepsHeld) {
+    auto volume = createVolume();
+    auto hold = budget_.hold();
+    volume->getRepresentation<VolumeRAM>();
+
+    evaluate();
+    evaluate();
+    EXPECT_TRUE(volume->hasRepresentation<VolumeRAM>());
+
+    hold.reset();
+    evaluate();
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+}
+
+}  // namespace inviwo
@@ -38,11 +38,18 @@
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/network/processornetworkevaluator.h>
 #include <inviwo/core/network/networklock.h>
+#include <inviwo/core/network/evaluationprofiler.h>
 
 #include <inviwo/core/ports/datainport.h>
 #include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/properties/ordinalproperty.h>
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 namespace inviwo {
 
@@ -64,6 +71,9 @@ struct TestProcessor : Processor {
     virtual void doIfNotReady() override {
         if (onDoIfNotReady) onDoIfNotReady(*this);
     }
+    virtual bool isThreadSafe() const override { return threadSafe; }
+
+    bool threadSafe = false;
 
     std::function<void(TestProcessor&)> onInitializeResources;
     std::function<void(TestProcessor&)> onProcess;
@@ -195,6 +205,54 @@ TEST(NetworkEvaluator, Eval) {
     }
 }
 
+TEST(NetworkEvaluator, Batch) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    auto at = createA();
+    auto a = at.get();
+    Instrument ai(*a);
+    a->onProcess = [func = a->onProcess](TestProcessor& p) {
+        func(p);
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(0));
+    };
+    network.addProcessor(std::move(at));
+
+    auto bt = createB();
+    auto b = bt.get();
+    Instrument bi(*b);
+    network.addProcessor(std::move(bt));
+    network.addConnection(a->getOutports()[0], b->getInports()[0]);
+    ai.reset();
+    bi.reset();
+
+    {
+        SCOPED_TRACE("Batched invalidations");
+        NetworkBatch batch(&network);
+        {
+            NetworkBatch nested(&network);
+            a->invalidate(InvalidationLevel::InvalidOutput);
+            a->invalidate(InvalidationLevel::InvalidOutput);
+        }
+        EXPECT_TRUE(network.isBatching());
+        a->invalidate(InvalidationLevel::InvalidResources);
+
+        EXPECT_FALSE(a->isValid());
+        // The propagation to b is deferred to the end of the batch
+        EXPECT_TRUE(b->isValid());
+        ai.checkAndReset(0, 0, 0);
+        bi.checkAndReset(0, 0, 0);
+    }
+    {
+        SCOPED_TRACE("Batch ended");
+        EXPECT_FALSE(network.isBatching());
+        ai.checkAndReset(1, 1, 0);
+        bi.checkAndReset(0, 1, 0);
+        EXPECT_TRUE(a->isValid());
+        EXPECT_TRUE(b->isValid());
+    }
+}
+
 TEST(NetworkEvaluator, Error) {
     ProcessorNetwork network{InviwoApplication::getPtr()};
     ProcessorNetworkEvaluator evaluator{&network};
@@ -256,4 +314,253 @@ TEST(NetworkEvaluator, Error) {
     }
 }
 
+TEST(NetworkEvaluator, Parallel) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+    evaluator.setEvaluationMode(ProcessorNetworkEvaluator::EvaluationMode::Parallel);
+
+    unsigned int throwCount = 0;
+    evaluator.setExceptionHandler(
+        [&throwCount](Processor*, EvaluationType, SourceContext) { ++throwCount; });
+
+    std::atomic<bool> shouldThrow = false;
+    const auto setData = [&shouldThrow](TestProcessor& p) {
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(0));
+        if (shouldThrow) {
+            throw Exception(SourceContext{}, "Error");
+        }
+    };
+
+    // Two independent branches a1 -> b1 and a2 -> b2
+    auto a1t = createA();
+    auto a1 = a1t.get();
+    auto a2t = createA();
+    auto a2 = a2t.get();
+    a2->setIdentifier("a2");
+    a1->threadSafe = true;
+    a2->threadSafe = true;
+    std::atomic<int> a1Process = 0;
+    std::atomic<int> a2Process = 0;
+    a1->onProcess = [&](TestProcessor& p) {
+        ++a1Process;
+        setData(p);
+    };
+    a2->onProcess = [&](TestProcessor& p) {
+        ++a2Process;
+        setData(p);
+    };
+
+    auto b1t = createB();
+    auto b1 = b1t.get();
+    auto b2t = createB();
+    auto b2 = b2t.get();
+    b2->setIdentifier("b2");
+    Instrument b1i(*b1);
+    Instrument b2i(*b2);
+
+    {
+        NetworkLock lock(&network);
+        network.addProcessor(std::move(a1t));
+        network.addProcessor(std::move(a2t));
+        network.addProcessor(std::move(b1t));
+        network.addProcessor(std::move(b2t));
+        network.addConnection(a1->getOutports()[0], b1->getInports()[0]);
+        network.addConnection(a2->getOutports()[0], b2->getInports()[0]);
+    }
+
+    {
+        SCOPED_TRACE("Add connections");
+        EXPECT_EQ(a1Process.exchange(0), 1);
+        EXPECT_EQ(a2Process.exchange(0), 1);
+        b1i.checkAndReset(1, 1, 0);
+        b2i.checkAndReset(1, 1, 0);
+        EXPECT_TRUE(b1->isValid());
+        EXPECT_TRUE(b2->isValid());
+    }
+
+    {
+        SCOPED_TRACE("Invalid output with throw");
+        shouldThrow = true;
+        {
+            NetworkLock lock(&network);
+            a1->invalidate(InvalidationLevel::InvalidOutput);
+            a2->invalidate(InvalidationLevel::InvalidOutput);
+        }
+        EXPECT_EQ(throwCount, 2);
+        EXPECT_EQ(a1Process.exchange(0), 1);
+        EXPECT_EQ(a2Process.exchange(0), 1);
+        b1i.checkAndReset(0, 0, 1);
+        b2i.checkAndReset(0, 0, 1);
+    }
+}
+
+TEST(NetworkEvaluator, ParallelPropertyChange) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+    evaluator.setEvaluationMode(ProcessorNetworkEvaluator::EvaluationMode::Parallel);
+
+    const auto mainThread = std::this_thread::get_id();
+
+    // A thread safe branch a1 -> b1 next to a2 -> b2 where a2 sets a property while processing
+    auto a1t = createA();
+    auto a1 = a1t.get();
+    a1->threadSafe = true;
+    std::atomic<int> a1Process = 0;
+    a1->onProcess = [&](TestProcessor& p) {
+        ++a1Process;
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(0));
+    };
+
+    auto a2t = createA();
+    auto a2 = a2t.get();
+    a2->setIdentifier("a2");
+    auto counterProperty = std::make_unique<IntProperty>("counter", "Counter", 0, 0, 100, 1,
+                                                         InvalidationLevel::Valid);
+    auto& counter = *counterProperty;
+    a2->addProperty(std::move(counterProperty));
+    std::vector<std::thread::id> changes;
+    counter.onChange([&]() { changes.push_back(std::this_thread::get_id()); });
+    a2->onProcess = [&](TestProcessor& p) {
+        counter.set(counter.get() + 1);
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(0));
+    };
+
+    auto b1t = createB();
+    auto b1 = b1t.get();
+    auto b2t = createB();
+    auto b2 = b2t.get();
+    b2->setIdentifier("b2");
+
+    {
+        NetworkLock lock(&network);
+        network.addProcessor(std::move(a1t));
+        network.addProcessor(std::move(a2t));
+        network.addProcessor(std::move(b1t));
+        network.addProcessor(std::move(b2t));
+        network.addConnection(a1->getOutports()[0], b1->getInports()[0]);
+        network.addConnection(a2->getOutports()[0], b2->getInports()[0]);
+    }
+    {
+        NetworkLock lock(&network);
+        a1->invalidate(InvalidationLevel::InvalidOutput);
+        a2->invalidate(InvalidationLevel::InvalidOutput);
+    }
+
+    EXPECT_EQ(a1Process.load(), 2);
+    EXPECT_EQ(counter.get(), 2);
+    ASSERT_EQ(changes.size(), size_t{2});
+    for (const auto& id : changes) {
+        EXPECT_EQ(id, mainThread);
+    }
+    EXPECT_TRUE(a2->isValid());
+    EXPECT_TRUE(b2->isValid());
+}
+
+TEST(NetworkEvaluator, ParallelLinkedProcessors) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+    evaluator.setEvaluationMode(ProcessorNetworkEvaluator::EvaluationMode::Parallel);
+
+    // A thread safe a1 linked to a2 that sets the linked property while processing
+    auto a1t = createA();
+    auto a1 = a1t.get();
+    a1->threadSafe = true;
+    auto value1Property =
+        std::make_unique<IntProperty>("value", "Value", 0, 0, 100, 1, InvalidationLevel::Valid);
+    auto& value1 = *value1Property;
+    a1->addProperty(std::move(value1Property));
+    std::atomic<bool> a1InFlight = false;
+    a1->onProcess = [&](TestProcessor& p) {
+        a1InFlight = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        a1InFlight = false;
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(0));
+    };
+
+    auto a2t = createA();
+    auto a2 = a2t.get();
+    a2->setIdentifier("a2");
+    auto value2Property =
+        std::make_unique<IntProperty>("value", "Value", 0, 0, 100, 1, InvalidationLevel::Valid);
+    auto& value2 = *value2Property;
+    a2->addProperty(std::move(value2Property));
+    std::vector<bool> a1InFlightDuringA2;
+    a2->onProcess = [&](TestProcessor& p) {
+        a1InFlightDuringA2.push_back(a1InFlight.load());
+        value2.set(value2.get() + 1);
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(0));
+    };
+
+    auto b1t = createB();
+    auto b1 = b1t.get();
+    auto b2t = createB();
+    auto b2 = b2t.get();
+    b2->setIdentifier("b2");
+
+    {
+        NetworkLock lock(&network);
+        network.addProcessor(std::move(a1t));
+        network.addProcessor(std::move(a2t));
+        network.addProcessor(std::move(b1t));
+        network.addProcessor(std::move(b2t));
+        network.addConnection(a1->getOutports()[0], b1->getInports()[0]);
+        network.addConnection(a2->getOutports()[0], b2->getInports()[0]);
+        network.addLink(&value2, &value1);
+    }
+    {
+        NetworkLock lock(&network);
+        a1->invalidate(InvalidationLevel::InvalidOutput);
+        a2->invalidate(InvalidationLevel::InvalidOutput);
+    }
+
+    ASSERT_EQ(a1InFlightDuringA2.size(), size_t{2});
+    for (const auto inFlight : a1InFlightDuringA2) {
+        EXPECT_FALSE(inFlight);
+    }
+    EXPECT_EQ(value1.get(), 2);
+    EXPECT_TRUE(a1->isValid());
+    EXPECT_TRUE(b2->isValid());
+}
+
+TEST(NetworkEvaluator, Profiler) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+    EvaluationProfiler profiler{&network, &evaluator};
+    profiler.setEnabled(true);
+
+    auto at = createA();
+    auto a = at.get();
+    a->onProcess = [](TestProcessor& p) {
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(0));
+    };
+    auto bt = createB();
+    auto b = bt.get();
+
+    {
+        NetworkLock lock(&network);
+        network.addProcessor(std::move(at));
+        network.addProcessor(std::move(bt));
+        network.addConnection(a->getOutports()[0], b->getInports()[0]);
+    }
+    a->invalidate(InvalidationLevel::InvalidOutput);
+
+    const auto stats = profiler.getProcessorStats();
+    ASSERT_EQ(stats.size(), 2);
+    for (const auto& item : stats) {
+        SCOPED_TRACE(item.identifier);
+        EXPECT_EQ(item.count, 2);
+        EXPECT_GE(item.invalidations, 1);
+        EXPECT_GE(item.max, Clock::duration{0});
+    }
+
+    std::stringstream ss;
+    profiler.writeChromeTrace(ss);
+    EXPECT_NE(ss.str().find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(ss.str().find("\"name\":\"a\""), std::string::npos);
+
+    profiler.clear();
+    EXPECT_TRUE(profiler.getProcessorStats().empty());
+    EXPECT_TRUE(profiler.getEvents().empty());
+}
+
 }  // namespace inviwo
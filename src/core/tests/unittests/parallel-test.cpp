@@ -0,0 +1,166 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/parallel.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/ramdata.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <numeric>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+TEST(Parallel, For) {
+    std::vector<size_t> data(10000, 0);
+    util::parallelFor(0, data.size(), [&](size_t i) { data[i] = i; }, {.grainSize = 100});
+
+    std::vector<size_t> expected(data.size());
+    std::iota(expected.begin(), expected.end(), size_t{0});
+    EXPECT_EQ(data, expected);
+}
+
+TEST(Parallel, ForRange) {
+    std::atomic<size_t> count = 0;
+    std::atomic<size_t> chunks = 0;
+    util::parallelFor(
+        10, 1010,
+        [&](size_t first, size_t last) {
+            EXPECT_LE(last - first, 64);
+            count += last - first;
+            ++chunks;
+        },
+        {.grainSize = 64});
+    EXPECT_EQ(count, 1000);
+    EXPECT_EQ(chunks, (1000 + 63) / 64);
+}
+
+TEST(Parallel, Reduce) {
+    std::vector<double> data(10000);
+    std::iota(data.begin(), data.end(), 0.0);
+
+    const auto sum = [&](size_t grainSize) {
+        return util::parallelReduce(
+            0, data.size(), 0.0,
+            [&](size_t first, size_t last) {
+                return std::accumulate(data.begin() + first, data.begin() + last, 0.0);
+            },
+            std::plus<>{}, {.grainSize = grainSize});
+    };
+
+    EXPECT_DOUBLE_EQ(sum(128), 9999.0 * 10000.0 / 2.0);
+    EXPECT_EQ(sum(128), sum(128));
+    EXPECT_DOUBLE_EQ(sum(0), 9999.0 * 10000.0 / 2.0);
+}
+
+TEST(Parallel, ReduceOrder) {
+    const auto concat = util::parallelReduce(
+        0, 10, std::string{},
+        [](size_t first, size_t last) {
+            std::string res;
+            for (size_t i = first; i < last; ++i) res += std::to_string(i);
+            return res;
+        },
+        [](std::string a, const std::string& b) { return a + b; }, {.grainSize = 3});
+    EXPECT_EQ(concat, "0123456789");
+}
+
+TEST(Parallel, Exceptions) {
+    EXPECT_THROW(util::parallelFor(
+                     0, 100,
+                     [](size_t i) {
+                         if (i == 50) throw Exception(SourceContext{}, "Error");
+                     },
+                     {.grainSize = 10}),
+                 Exception);
+}
+
+TEST(Parallel, OnlyOwnChunks) {
+    if (util::getPoolSize() == 0) GTEST_SKIP();
+
+    // Unrelated queued tasks must never be run by the waiting caller
+    const auto caller = std::this_thread::get_id();
+    std::atomic<size_t> inline_ = 0;
+    std::vector<std::future<void>> unrelated;
+    for (size_t i = 0; i < 4 * util::getPoolSize(); ++i) {
+        unrelated.push_back(util::getThreadPool().enqueue([&]() {
+            if (std::this_thread::get_id() == caller) ++inline_;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }));
+    }
+
+    std::atomic<size_t> count = 0;
+    util::parallelFor(0, 1000, [&](size_t) { ++count; }, {.grainSize = 10});
+    EXPECT_EQ(count, 1000);
+
+    for (auto& future : unrelated) future.get();
+    EXPECT_EQ(inline_, 0);
+}
+
+TEST(Parallel, Nested) {
+    std::atomic<size_t> count = 0;
+    util::parallelFor(
+        0, 16,
+        [&](size_t) { util::parallelFor(0, 100, [&](size_t) { ++count; }, {.grainSize = 10}); },
+        {.grainSize = 1});
+    EXPECT_EQ(count, 1600);
+}
+
+TEST(Parallel, Empty) {
+    util::parallelFor(5, 5, [](size_t) { FAIL(); });
+    EXPECT_EQ(util::parallelReduce(
+                  5, 5, 7, [](size_t, size_t) { return 1; }, std::plus<>{}),
+              7);
+}
+
+TEST(Parallel, RAMData) {
+    // Large enough to be initialized and copied in parallel
+    const size_t size = 2 * util::detail::largeRAMDataSize / sizeof(float) + 3;
+
+    const auto zeros = util::makeRAMData<float>(size);
+    EXPECT_TRUE(std::all_of(zeros.get(), zeros.get() + size, [](float v) { return v == 0.0f; }));
+
+    std::vector<float> source(size);
+    std::iota(source.begin(), source.end(), 0.0f);
+    const auto copy = util::makeRAMData(std::span<const float>{source});
+    EXPECT_TRUE(std::equal(source.begin(), source.end(), copy.get()));
+}
+
+}  // namespace inviwo
@@ -151,4 +151,36 @@ TEST(PickingMapperTests, Resize) {
     }
 }
 
+TEST(PickingTests, ReuseUnregistered) {
+    PickingManager manager;
+    const auto noop = [](PickingEvent*) {};
+
+    auto a = manager.registerPickingAction(nullptr, noop, 10);
+    auto b = manager.registerPickingAction(nullptr, noop, 5);
+    auto c = manager.registerPickingAction(nullptr, noop, 20);
+    EXPECT_EQ(b->getPickingId(0), 11);
+    EXPECT_EQ(c->getPickingId(0), 16);
+
+    EXPECT_TRUE(manager.unregisterPickingAction(b));
+    EXPECT_FALSE(manager.unregisterPickingAction(b));
+    EXPECT_TRUE(manager.isPickingActionRegistered(b));
+
+    // The smallest unused action that fits is reused
+    auto d = manager.registerPickingAction(nullptr, noop, 3);
+    EXPECT_EQ(d, b);
+    EXPECT_EQ(d->getPickingId(0), 11);
+    EXPECT_EQ(d->getSize(), 3);
+
+    // Unregistering the last actions releases their ids
+    EXPECT_TRUE(manager.unregisterPickingAction(c));
+    EXPECT_FALSE(manager.isPickingActionRegistered(c));
+    EXPECT_TRUE(manager.unregisterPickingAction(d));
+
+    auto e = manager.registerPickingAction(nullptr, noop, 1);
+    EXPECT_EQ(e->getPickingId(0), 11);
+    EXPECT_EQ(manager.getPickingActionFromIndex(11), e);
+    EXPECT_EQ(manager.getPickingActionFromIndex(10), a);
+    EXPECT_EQ(manager.getPickingActionFromIndex(12), nullptr);
+}
+
 }  // namespace inviwo
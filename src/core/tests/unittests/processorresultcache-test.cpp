@@ -0,0 +1,111 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/network/processorresultcache.h>
+#include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+
+#include <memory>
+
+namespace inviwo {
+
+namespace {
+
+struct CachedProcessor : Processor {
+    CachedProcessor(Tags tags) : Processor("cached", "cached"), tags_{tags} {
+        addPort(outport);
+        addProperty(value);
+    }
+
+    virtual const ProcessorInfo& getProcessorInfo() const override { return info_; }
+
+    virtual void process() override {
+        ++processed;
+        outport.setData(std::make_shared<int>(value.get()));
+    }
+
+    Tags tags_;
+    ProcessorInfo info_{"org.inviwo.CachedProcessor", "CachedProcessor", "Testing",
+                        CodeState::Stable, tags_};
+    DataOutport<int> outport{"outport"};
+    IntProperty value{"value", "Value", 0, 0, 10};
+    int processed = 0;
+};
+
+}  // namespace
+
+TEST(ProcessorResultCache, RestoresEarlierResults) {
+    ProcessorResultCache cache;
+    cache.setCapacity(1024);
+    CachedProcessor processor{Tags::CPU | Tags::Deterministic};
+
+    processor.value.set(1);
+    EXPECT_FALSE(cache.process(processor));
+    const auto first = processor.outport.getData();
+
+    processor.value.set(2);
+    EXPECT_FALSE(cache.process(processor));
+    EXPECT_EQ(2, *processor.outport.getData());
+
+    processor.value.set(1);
+    EXPECT_TRUE(cache.process(processor));
+    EXPECT_EQ(first, processor.outport.getData());
+    EXPECT_EQ(2, processor.processed);
+
+    cache.forget(&processor);
+    EXPECT_FALSE(cache.process(processor));
+    EXPECT_EQ(3, processor.processed);
+}
+
+TEST(ProcessorResultCache, OnlyCachesTaggedProcessors) {
+    ProcessorResultCache cache;
+    cache.setCapacity(1024);
+    CachedProcessor processor{Tags::CPU};
+
+    EXPECT_FALSE(cache.process(processor));
+    EXPECT_FALSE(cache.process(processor));
+    EXPECT_EQ(2, processor.processed);
+}
+
+TEST(ProcessorResultCache, Disabled) {
+    ProcessorResultCache cache;
+    CachedProcessor processor{Tags::CPU | Tags::Deterministic};
+
+    EXPECT_FALSE(cache.process(processor));
+    EXPECT_FALSE(cache.process(processor));
+    EXPECT_EQ(2, processor.processed);
+}
+
+}  // namespace inviwo
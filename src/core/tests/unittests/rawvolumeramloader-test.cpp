@@ -0,0 +1,115 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <bit>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+class RawVolumeRAMLoaderTest : public ::testing::Test {
+protected:
+    static constexpr size_t headerSize = 16;
+
+    RawVolumeRAMLoaderTest()
+        : data_(glm::compMul(dims_)), file_{"rawvolume", ".raw"}, disk_{dims_, DataInt32::get()} {
+        std::iota(data_.begin(), data_.end(), 0);
+        const std::vector<char> header(headerSize, 0);
+        std::fwrite(header.data(), 1, header.size(), file_.getHandle());
+        std::fwrite(data_.data(), sizeof(int), data_.size(), file_.getHandle());
+        std::fflush(file_.getHandle());
+    }
+
+    void expectRegion(const VolumeRAM& region, size3_t offset, size3_t dims) const {
+        ASSERT_EQ(dims, region.getDimensions());
+        const auto* result = static_cast<const int*>(region.getData());
+        const util::IndexMapper3D volIm{dims_};
+        const util::IndexMapper3D regionIm{dims};
+        for (size_t i = 0; i < glm::compMul(dims); ++i) {
+            EXPECT_EQ(data_[volIm(offset + regionIm(i))], result[i]);
+        }
+    }
+
+    size3_t dims_{13, 7, 5};
+    std::vector<int> data_;
+    util::TempFileHandle file_;
+    VolumeDisk disk_;
+};
+
+TEST_F(RawVolumeRAMLoaderTest, Slices) {
+    const auto order = std::endian::native == std::endian::little ? ByteOrder::LittleEndian
+                                                                  : ByteOrder::BigEndian;
+    const RawVolumeRAMLoader loader{file_.getFileName(), headerSize, order, Compression::Disabled};
+
+    for (size_t axis = 0; axis < 3; ++axis) {
+        size3_t offset{0};
+        size3_t dims = dims_;
+        offset[axis] = dims_[axis] / 2;
+        dims[axis] = 1;
+        auto slice = loader.createSubsetRepresentation(disk_, offset, dims);
+        ASSERT_TRUE(slice);
+        expectRegion(*slice, offset, dims);
+    }
+}
+
+TEST_F(RawVolumeRAMLoaderTest, Region) {
+    const auto order = std::endian::native == std::endian::little ? ByteOrder::LittleEndian
+                                                                  : ByteOrder::BigEndian;
+    const RawVolumeRAMLoader loader{file_.getFileName(), headerSize, order, Compression::Disabled};
+
+    const size3_t offset{3, 2, 1};
+    const size3_t dims{7, 4, 3};
+    auto region = loader.createSubsetRepresentation(disk_, offset, dims);
+    ASSERT_TRUE(region);
+    expectRegion(*region, offset, dims);
+
+    EXPECT_ANY_THROW(loader.createSubsetRepresentation(disk_, size3_t{12, 6, 4}, size3_t{2}));
+}
+
+TEST_F(RawVolumeRAMLoaderTest, Compressed) {
+    const RawVolumeRAMLoader loader{file_.getFileName(), headerSize, ByteOrder::LittleEndian,
+                                    Compression::Enabled};
+    EXPECT_FALSE(loader.createSubsetRepresentation(disk_, size3_t{0}, size3_t{1}));
+}
+
+}  // namespace inviwo
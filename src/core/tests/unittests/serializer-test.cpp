@@ -37,6 +37,8 @@
 #include <inviwo/core/util/glmvec.h>
 #include <inviwo/core/util/glmmat.h>
 
+#include <sstream>
+
 namespace inviwo {
 
 TEST(SerializationTest, initTest) {
@@ -378,4 +380,19 @@ TEST(SerializationTest, mat4Tests) {
     for (int i = 0; i < s; i++)
         for (int j = 0; j < s; j++) EXPECT_EQ(inMat[i][j], outMat[i][j]);
 }
+
+TEST(SerializationTest, streamTest) {
+    const std::string inValue = "a & b < c > d \"e\" 'f'\r\n\tg";
+    auto refpath = filesystem::findBasePath();
+    std::stringstream stream;
+    Serializer serializer(refpath);
+    serializer.serialize("serializedValue", inValue);
+    serializer.writeFile(stream, true);
+
+    Deserializer deserializer(stream, refpath);
+    std::string outValue;
+    deserializer.deserialize("serializedValue", outValue);
+    EXPECT_EQ(inValue, outValue);
+}
+
 }  // namespace inviwo
@@ -0,0 +1,150 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/histogramtools.h>
+#include <inviwo/core/io/sessioncache.h>
+#include <inviwo/core/io/tempfilehandle.h>
+
+#include <array>
+#include <cstdio>
+#include <filesystem>
+#include <span>
+#include <system_error>
+
+namespace inviwo {
+
+class SessionCacheTest : public ::testing::Test {
+protected:
+    SessionCacheTest() : file_{"sessioncache", ".raw"}, directory_{cacheDirectory(file_)} {
+        write(16);
+    }
+    ~SessionCacheTest() override {
+        std::error_code ec;
+        std::filesystem::remove_all(directory_, ec);
+    }
+
+    static std::filesystem::path cacheDirectory(const util::TempFileHandle& file) {
+        auto dir = file.getFileName();
+        dir += ".cache";
+        return dir;
+    }
+
+    void write(size_t bytes) {
+        const std::array<char, 64> data{};
+        std::fwrite(data.data(), 1, bytes, file_.getHandle());
+        std::fflush(file_.getHandle());
+    }
+
+    util::TempFileHandle file_;
+    std::filesystem::path directory_;
+};
+
+TEST_F(SessionCacheTest, StoreAndLoad) {
+    SessionCache cache{directory_};
+    const auto key = SessionCache::key(file_.getFileName(), "test");
+    ASSERT_TRUE(key);
+
+    const std::array<double, 3> value{1.0, 2.0, 3.0};
+
+    // Disabled by default
+    cache.store(*key, std::as_bytes(std::span{value}));
+    EXPECT_FALSE(cache.load(*key));
+
+    cache.setCapacity(1024 * 1024);
+    EXPECT_FALSE(cache.load(*key));
+    cache.store(*key, std::as_bytes(std::span{value}));
+
+    const auto mapped = cache.load(*key);
+    ASSERT_TRUE(mapped);
+    ASSERT_EQ(sizeof(value), mapped->size());
+    const auto* loaded = reinterpret_cast<const double*>(mapped->data());
+    EXPECT_EQ(value[0], loaded[0]);
+    EXPECT_EQ(value[2], loaded[2]);
+
+    cache.clear();
+    EXPECT_FALSE(cache.load(*key));
+}
+
+TEST_F(SessionCacheTest, KeyDependsOnFile) {
+    const auto key = SessionCache::key(file_.getFileName(), "test");
+    ASSERT_TRUE(key);
+    EXPECT_EQ(key, SessionCache::key(file_.getFileName(), "test"));
+    EXPECT_NE(key, SessionCache::key(file_.getFileName(), "other"));
+
+    write(8);
+    EXPECT_NE(key, SessionCache::key(file_.getFileName(), "test"));
+
+    EXPECT_FALSE(SessionCache::key(directory_ / "missing.raw", "test"));
+}
+
+TEST_F(SessionCacheTest, Eviction) {
+    SessionCache cache{directory_};
+    cache.setCapacity(600);
+
+    const std::array<std::byte, 256> value{};
+    for (const auto* description : {"a", "b", "c"}) {
+        cache.store(*SessionCache::key(file_.getFileName(), description), value);
+    }
+
+    // Two values, including their headers, fit within the capacity
+    EXPECT_FALSE(cache.load(*SessionCache::key(file_.getFileName(), "a")));
+    EXPECT_TRUE(cache.load(*SessionCache::key(file_.getFileName(), "b")));
+    EXPECT_TRUE(cache.load(*SessionCache::key(file_.getFileName(), "c")));
+}
+
+TEST(SessionCacheHistogramTest, SerializeHistograms) {
+    Histogram1D histogram;
+    histogram.counts = {1, 5, 2, 0};
+    histogram.totalCounts = 8;
+    histogram.maxCount = 5;
+    histogram.overflow = 3;
+    histogram.dataStats.mean = 0.5;
+    histogram.dataStats.percentiles = {0.1, 0.9};
+
+    const DataMapper dataMap{dvec2{0.0, 3.0}};
+    const auto data = util::serializeHistograms({histogram, histogram});
+    const auto result = util::deserializeHistograms(data, dataMap);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(size_t{2}, result->size());
+    EXPECT_EQ(histogram.counts, result->back().counts);
+    EXPECT_EQ(histogram.maxCount, result->back().maxCount);
+    EXPECT_EQ(histogram.overflow, result->back().overflow);
+    EXPECT_EQ(histogram.dataStats.mean, result->back().dataStats.mean);
+    EXPECT_EQ(histogram.dataStats.percentiles, result->back().dataStats.percentiles);
+    EXPECT_EQ(dataMap.dataRange, result->back().dataMap.dataRange);
+
+    EXPECT_FALSE(util::deserializeHistograms(std::span{data}.first(data.size() - 1), dataMap));
+}
+
+}  // namespace inviwo
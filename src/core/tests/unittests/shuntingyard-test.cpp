@@ -0,0 +1,107 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/shuntingyard.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+TEST(ShuntingYard, compileMatchesCalculate) {
+    const std::vector<std::string> expressions{"a + b * c", "(a + b) * c", "a ^ 2 - b / c",
+                                               "-a + 2 * (b - c)", "a"};
+
+    for (const auto& expression : expressions) {
+        std::map<std::string, double> vars{{"a", 1.5}, {"b", -2.0}, {"c", 4.0}};
+        const auto expected = shuntingyard::Calculator::calculate(expression, vars);
+
+        const auto program = shuntingyard::Calculator::compile(expression, {}, {"a", "b", "c"});
+        std::vector<double> inputs;
+        for (const auto& name : program.getInputs()) inputs.push_back(vars[name]);
+        EXPECT_DOUBLE_EQ(expected, program(inputs)) << expression;
+    }
+}
+
+TEST(ShuntingYard, constantFolding) {
+    const auto program = shuntingyard::Calculator::compile("x * (2 ^ 3 + k)", {{"k", 1.0}}, {"x"});
+    EXPECT_EQ(size_t{1}, program.getInputs().size());
+    EXPECT_EQ(size_t{1}, program.getInstructions().size());
+    const std::vector<double> inputs{2.0};
+    EXPECT_DOUBLE_EQ(18.0, program(inputs));
+
+    const auto constant = shuntingyard::Calculator::compile("2 * 3", {}, {"x"});
+    EXPECT_TRUE(constant.getInputs().empty());
+    EXPECT_DOUBLE_EQ(6.0, constant({}));
+}
+
+TEST(ShuntingYard, unusedInputs) {
+    const auto program = shuntingyard::Calculator::compile("z - x", {}, {"x", "y", "z"});
+    EXPECT_EQ((std::vector<std::string>{"z", "x"}), program.getInputs());
+}
+
+TEST(ShuntingYard, invalid) {
+    EXPECT_THROW(shuntingyard::Calculator::compile("x + w", {}, {"x"}), Exception);
+    EXPECT_THROW(shuntingyard::Calculator::compile("x +", {}, {"x"}), Exception);
+}
+
+TEST(ShuntingYard, evaluateBlocks) {
+    const auto program = shuntingyard::Calculator::compile("x * x + y", {}, {"x", "y"});
+
+    const size_t count = 3 * shuntingyard::Program::blockSize + 17;
+    std::vector<double> result(count, 0.0);
+    program.evaluate(
+        count,
+        [](size_t input, size_t offset, std::span<double> dst) {
+            for (size_t i = 0; i < dst.size(); ++i) {
+                const auto index = static_cast<double>(offset + i);
+                dst[i] = input == 0 ? index : -1.0;
+            }
+        },
+        [&](size_t offset, std::span<const double> src) {
+            std::copy(src.begin(), src.end(), result.begin() + offset);
+        });
+
+    for (size_t i = 0; i < count; ++i) {
+        const auto x = static_cast<double>(i);
+        EXPECT_DOUBLE_EQ(x * x - 1.0, result[i]);
+    }
+}
+
+}  // namespace inviwo
@@ -0,0 +1,117 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/tflookuptable.h>
+#include <inviwo/core/datastructures/transferfunction.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+
+#include <algorithm>
+
+namespace inviwo {
+
+namespace {
+
+const vec4* texels(const TFLookupTable& table) {
+    return static_cast<const vec4*>(table.getRepresentation<LayerRAM>()->getData());
+}
+
+}  // namespace
+
+TEST(TFLookupTable, sharedBetweenEqualTFs) {
+    const TransferFunction tf{{{0.0, vec4{0.0f}}, {1.0, vec4{1.0f}}}};
+
+    TFLookupTable table1{256};
+    TFLookupTable table2{256};
+    table1.calculate(tf);
+    table2.calculate(tf);
+    EXPECT_EQ(table1.getLayer(), table2.getLayer());
+
+    TFLookupTable table3{128};
+    table3.calculate(tf);
+    EXPECT_NE(table1.getLayer(), table3.getLayer());
+}
+
+TEST(TFLookupTable, incrementalUpdate) {
+    TransferFunction tf{{{0.0, vec4{0.0f}}, {1.0, vec4{1.0f}}}};
+
+    TFLookupTable table{256};
+    table.calculate(tf);
+    const auto* layer = table.getLayer().get();
+
+    tf[1].setColor(vec4{1.0f, 0.0f, 0.0f, 1.0f});
+    table.calculate(tf);
+    EXPECT_EQ(layer, table.getLayer().get());
+    EXPECT_EQ(vec4(1.0f, 0.0f, 0.0f, 1.0f), texels(table)[255]);
+
+    TFLookupTable other{256};
+    other.calculate(tf);
+    EXPECT_EQ(table.getLayer(), other.getLayer());
+
+    // The table is now shared, an edit must not change the other table.
+    tf[1].setColor(vec4{0.0f, 1.0f, 0.0f, 1.0f});
+    table.calculate(tf);
+    EXPECT_NE(table.getLayer(), other.getLayer());
+    EXPECT_EQ(vec4(1.0f, 0.0f, 0.0f, 1.0f), texels(other)[255]);
+    EXPECT_EQ(vec4(0.0f, 1.0f, 0.0f, 1.0f), texels(table)[255]);
+}
+
+TEST(TFLookupTable, preIntegrated) {
+    const TransferFunction tf{{{0.0, vec4{1.0f, 0.0f, 0.0f, 0.0f}}, {1.0, vec4{1.0f}}}};
+
+    constexpr size_t size = 64;
+    TFLookupTable regular{size};
+    TFLookupTable preIntegrated{size, TFLookupTable::Type::PreIntegrated};
+    regular.calculate(tf);
+    preIntegrated.calculate(tf);
+
+    EXPECT_EQ(size2_t(size, size), preIntegrated.getLayer()->getDimensions());
+
+    const auto* lut = texels(regular);
+    const auto* table = texels(preIntegrated);
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(lut[i], table[i * size + i]);
+    }
+
+    // Segments are symmetric and bounded by their end points
+    for (size_t front = 0; front < size; front += 7) {
+        for (size_t back = 0; back < size; back += 5) {
+            const auto& segment = table[back * size + front];
+            EXPECT_FLOAT_EQ(segment.a, table[front * size + back].a);
+            EXPECT_GE(segment.a, std::min(lut[front].a, lut[back].a) - 1.0e-5f);
+            EXPECT_LE(segment.a, std::max(lut[front].a, lut[back].a) + 1.0e-5f);
+        }
+    }
+}
+
+}  // namespace inviwo
@@ -0,0 +1,181 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/threadpool.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+TEST(ThreadPool, Enqueue) {
+    ThreadPool pool(4);
+
+    std::vector<std::future<size_t>> futures;
+    for (size_t i = 0; i < 1000; ++i) {
+        futures.push_back(pool.enqueue([i]() { return i; }));
+    }
+    size_t sum = 0;
+    for (auto& future : futures) sum += future.get();
+    EXPECT_EQ(sum, 999 * 1000 / 2);
+}
+
+TEST(ThreadPool, NestedTasks) {
+    ThreadPool pool(4);
+
+    std::atomic<size_t> count = 0;
+    std::vector<std::future<void>> futures;
+    for (size_t i = 0; i < 100; ++i) {
+        futures.push_back(pool.enqueue([&]() {
+            std::vector<std::future<void>> nested;
+            for (size_t j = 0; j < 10; ++j) {
+                nested.push_back(pool.enqueue([&]() { ++count; }));
+            }
+            for (auto& future : nested) {
+                while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                    pool.tryRunTask();
+                }
+            }
+        }));
+    }
+    for (auto& future : futures) future.get();
+    EXPECT_EQ(count, 1000);
+}
+
+TEST(ThreadPool, Exceptions) {
+    ThreadPool pool(2);
+    auto future = pool.enqueue([]() -> int { throw std::runtime_error("error"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(ThreadPool, Resize) {
+    ThreadPool pool(4);
+    std::atomic<size_t> count = 0;
+    for (size_t i = 0; i < 1000; ++i) {
+        pool.enqueueRaw([&]() { ++count; });
+    }
+    while (pool.trySetSize(0) != 0) {
+    }
+    EXPECT_EQ(count, 1000);
+
+    // Without workers the tasks are run directly
+    auto future = pool.enqueue([]() { return 1; });
+    EXPECT_EQ(future.get(), 1);
+
+    EXPECT_EQ(pool.trySetSize(2), 2);
+    auto future2 = pool.enqueue([]() { return 2; });
+    EXPECT_EQ(future2.get(), 2);
+}
+
+TEST(ThreadPool, Priorities) {
+    ThreadPool pool(2);
+    EXPECT_EQ(pool.getBackgroundLimit(), 1);
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<size_t> background = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        pool.enqueueRaw(
+            [&, released]() {
+                released.wait();
+                ++background;
+            },
+            ThreadPool::Priority::Background);
+    }
+
+    // The reserved worker picks up interactive work even though the background jobs are blocked
+    auto interactive = pool.enqueue([]() { return 1; });
+    ASSERT_EQ(interactive.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    EXPECT_EQ(interactive.get(), 1);
+    EXPECT_EQ(background, 0);
+
+    std::promise<void> done;
+    auto doneFuture = done.get_future();
+    pool.enqueueRaw([&]() { done.set_value(); }, ThreadPool::Priority::Interactive);
+    ASSERT_EQ(doneFuture.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    EXPECT_EQ(background, 0);
+
+    release.set_value();
+    while (background != 4) std::this_thread::yield();
+}
+
+TEST(ThreadPool, ResizeWithPriorities) {
+    ThreadPool pool(2);
+    EXPECT_EQ(pool.getBackgroundLimit(), 1);
+
+    std::promise<void> releaseWorkers;
+    std::shared_future<void> workersReleased = releaseWorkers.get_future().share();
+    std::atomic<size_t> started = 0;
+    for (size_t i = 0; i < 2; ++i) {
+        pool.enqueueRaw([&, workersReleased]() {
+            ++started;
+            workersReleased.wait();
+        });
+    }
+    while (started != 2) std::this_thread::yield();
+
+    // Run a Background task outside of the pool, holding back all other Background tasks
+    std::promise<void> releaseBackground;
+    std::shared_future<void> backgroundReleased = releaseBackground.get_future().share();
+    std::atomic<size_t> count = 0;
+    pool.enqueueRaw(
+        [&, backgroundReleased]() {
+            ++started;
+            backgroundReleased.wait();
+            ++count;
+        },
+        ThreadPool::Priority::Background);
+    std::thread outside{[&]() { pool.tryRunTask(); }};
+    while (started != 3) std::this_thread::yield();
+
+    for (size_t i = 0; i < 10; ++i) {
+        pool.enqueueRaw([&]() { ++count; }, ThreadPool::Priority::Background);
+        pool.enqueueRaw([&]() { ++count; }, ThreadPool::Priority::Interactive);
+    }
+    releaseWorkers.set_value();
+    while (count != 10) std::this_thread::yield();
+
+    // The workers are idle and are asked to stop while the Background tasks are still queued
+    pool.trySetSize(0);
+    releaseBackground.set_value();
+    outside.join();
+    while (pool.trySetSize(0) != 0) std::this_thread::yield();
+    EXPECT_EQ(count, 21);
+}
+
+}  // namespace inviwo
@@ -367,4 +367,33 @@ TEST(vertexop, setVertexPos) {
     EXPECT_EQ(colors[0], colorbuf[0]) << "color mismatch";
 }
 
+TEST(Mesh, positionRange) {
+    using MyMesh = TypedMesh<buffertraits::PositionsBuffer>;
+
+    MyMesh mesh;
+    EXPECT_FALSE(mesh.getPositionRange());
+
+    mesh.addVertex(vec3{0.0f, 1.0f, 2.0f});
+    mesh.addVertex(vec3{1.0f, -1.0f, 3.0f});
+    auto range = mesh.getPositionRange();
+    ASSERT_TRUE(range);
+    EXPECT_EQ(dvec3(0.0, -1.0, 2.0), range->first);
+    EXPECT_EQ(dvec3(1.0, 1.0, 3.0), range->second);
+
+    // Editing the buffer has to invalidate the cached range
+    mesh.setVertex<buffertraits::PositionsBuffer>(0, vec3{-2.0f, 0.0f, 5.0f});
+    range = mesh.getPositionRange();
+    ASSERT_TRUE(range);
+    EXPECT_EQ(dvec3(-2.0, -1.0, 3.0), range->first);
+    EXPECT_EQ(dvec3(1.0, 0.0, 5.0), range->second);
+
+    // As does replacing it
+    mesh.replaceBuffer(0, Mesh::BufferInfo{BufferType::PositionAttrib},
+                       util::makeBuffer<vec3>({vec3{4.0f}, vec3{6.0f}}));
+    range = mesh.getPositionRange();
+    ASSERT_TRUE(range);
+    EXPECT_EQ(dvec3(4.0), range->first);
+    EXPECT_EQ(dvec3(6.0), range->second);
+}
+
 }  // namespace inviwo
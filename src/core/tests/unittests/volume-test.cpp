@@ -0,0 +1,138 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/volumeramutils.h>
+
+#include <atomic>
+#include <memory>
+#include <numeric>
+
+namespace inviwo {
+
+namespace {
+
+std::shared_ptr<Volume> makeVolume() {
+    auto ram = std::make_shared<VolumeRAMPrecision<int>>(size3_t{4, 3, 2});
+    std::iota(ram->getView().begin(), ram->getView().end(), 0);
+    return std::make_shared<Volume>(ram);
+}
+
+}  // namespace
+
+TEST(VolumeTest, CopySharesRepresentations) {
+    const auto volume = makeVolume();
+    const std::unique_ptr<Volume> copy{volume->clone()};
+
+    EXPECT_EQ(volume->getRepresentation<VolumeRAM>(), copy->getRepresentation<VolumeRAM>());
+}
+
+TEST(VolumeTest, SharedHasNoOwner) {
+    const auto volume = makeVolume();
+    std::unique_ptr<Volume> copy{volume->clone()};
+
+    EXPECT_EQ(nullptr, volume->getRepresentation<VolumeRAM>()->getOwner());
+    EXPECT_EQ(nullptr, copy->getRepresentation<VolumeRAM>()->getOwner());
+
+    // The source takes over the ownership once it is the only holder again
+    copy.reset();
+    EXPECT_EQ(volume.get(), volume->getRepresentation<VolumeRAM>()->getOwner());
+}
+
+TEST(VolumeTest, EditingCopyDetaches) {
+    const auto volume = makeVolume();
+    const auto* ram = volume->getRepresentation<VolumeRAM>();
+    const std::unique_ptr<Volume> copy{volume->clone()};
+
+    auto* editable = copy->getEditableRepresentation<VolumeRAM>();
+    ASSERT_NE(ram, editable);
+    static_cast<int*>(editable->getData())[0] = 42;
+
+    EXPECT_EQ(ram, volume->getRepresentation<VolumeRAM>());
+    EXPECT_EQ(0, static_cast<const int*>(ram->getData())[0]);
+    EXPECT_EQ(42, static_cast<const int*>(copy->getRepresentation<VolumeRAM>()->getData())[0]);
+    EXPECT_EQ(copy.get(), copy->getRepresentation<VolumeRAM>()->getOwner());
+
+    // The source is the only holder again and can be edited in place
+    EXPECT_EQ(ram, volume->getEditableRepresentation<VolumeRAM>());
+}
+
+TEST(VolumeTest, SettersOnCopyDetach) {
+    const auto volume = makeVolume();
+    const std::unique_ptr<Volume> copy{volume->clone()};
+
+    copy->setSwizzleMask({ImageChannel::Zero, ImageChannel::Zero, ImageChannel::Zero,
+                          ImageChannel::One});
+
+    EXPECT_NE(volume->getSwizzleMask(), copy->getSwizzleMask());
+    EXPECT_NE(volume->getRepresentation<VolumeRAM>(), copy->getRepresentation<VolumeRAM>());
+}
+
+TEST(VolumeTest, ModifiedRegions) {
+    const auto volume = makeVolume();
+    const auto synced = volume->getRepresentation<VolumeRAM>()->getGeneration();
+
+    auto* ram = volume->getEditableRepresentation<VolumeRAM>();
+    ram->addModifiedRegion(size3_t{1, 0, 0}, size3_t{1, 1, 1});
+    ram->addModifiedRegion(size3_t{0, 2, 1}, size3_t{1, 1, 1});
+
+    const auto region = ram->getModifiedRegion(synced);
+    ASSERT_TRUE(region);
+    EXPECT_EQ(size3_t(0, 0, 0), region->offset);
+    EXPECT_EQ(size3_t(2, 3, 2), region->extent);
+
+    // An edit without a recorded region means that everything has to be updated
+    volume->getEditableRepresentation<VolumeRAM>();
+    EXPECT_FALSE(ram->getModifiedRegion(synced));
+}
+
+TEST(VolumeTest, ForEachVoxelValue) {
+    VolumeRAMPrecision<int> ram{size3_t{4, 3, 2}};
+    const auto view = util::gridView(ram);
+
+    util::forEachVoxelValue(static_cast<VolumeRAM&>(ram), [](auto& value, const size3_t& pos) {
+        value = static_cast<int>(pos.x + 10 * pos.y + 100 * pos.z);
+    });
+    EXPECT_EQ(123, view(3, 2, 1));
+    EXPECT_EQ(ram.getDataTyped()[ram.getView().size() - 1], view[size3_t{3, 2, 1}]);
+
+    std::atomic<long> sum{0};
+    util::forEachVoxelValueParallel(static_cast<const VolumeRAM&>(ram),
+                                    [&](const auto& value, const size3_t&) { sum += value; });
+    EXPECT_EQ(std::accumulate(view.begin(), view.end(), 0L), sum.load());
+}
+
+}  // namespace inviwo
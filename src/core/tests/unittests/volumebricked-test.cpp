@@ -0,0 +1,107 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <numeric>
+
+namespace inviwo {
+
+namespace {
+
+int storedVoxel(const VolumeBricked& bricked, size_t brick, size3_t pos) {
+    const auto data = bricked.getBrick(brick);
+    const util::IndexMapper3D im{bricked.getStoredBrickDimensions()};
+    return reinterpret_cast<const int*>(data.data())[im(pos)];
+}
+
+}  // namespace
+
+TEST(VolumeBrickedTest, Levels) {
+    VolumeRAMPrecision<int> volume{size3_t{5, 3, 2}};
+    std::iota(volume.getView().begin(), volume.getView().end(), 0);
+
+    const VolumeBricked bricked{volume, 2};
+
+    const auto& levels = bricked.getLevels();
+    ASSERT_EQ(3, levels.size());
+    EXPECT_EQ(size3_t(5, 3, 2), levels[0].dimensions);
+    EXPECT_EQ(size3_t(3, 2, 1), levels[0].bricks);
+    EXPECT_EQ(size3_t(3, 2, 1), levels[1].dimensions);
+    EXPECT_EQ(size3_t(2, 1, 1), levels[1].bricks);
+    EXPECT_EQ(size3_t(2, 1, 1), levels[2].dimensions);
+    EXPECT_EQ(size3_t(1, 1, 1), levels[2].bricks);
+    EXPECT_EQ(6, levels[1].firstBrick);
+    EXPECT_EQ(8, levels[2].firstBrick);
+    EXPECT_EQ(9, bricked.getNumberOfBricks());
+    EXPECT_EQ(size3_t(4), bricked.getStoredBrickDimensions());
+    EXPECT_EQ(7, bricked.getBrickIndex(1, size3_t{1, 0, 0}));
+}
+
+TEST(VolumeBrickedTest, Apron) {
+    VolumeRAMPrecision<int> volume{size3_t{5, 3, 2}};
+    std::iota(volume.getView().begin(), volume.getView().end(), 0);
+    const util::IndexMapper3D im{volume.getDimensions()};
+
+    const VolumeBricked bricked{volume, 2};
+
+    // Interior voxels
+    EXPECT_EQ(im(0, 0, 0), storedVoxel(bricked, 0, size3_t{1, 1, 1}));
+    EXPECT_EQ(im(1, 1, 1), storedVoxel(bricked, 0, size3_t{2, 2, 2}));
+    // Apron from the neighboring brick
+    EXPECT_EQ(im(2, 0, 0), storedVoxel(bricked, 0, size3_t{3, 1, 1}));
+    // Apron outside of the volume is clamped
+    EXPECT_EQ(im(0, 0, 0), storedVoxel(bricked, 0, size3_t{0, 0, 0}));
+    EXPECT_EQ(im(1, 1, 1), storedVoxel(bricked, 0, size3_t{2, 2, 3}));
+
+    // The last brick along x only has a single voxel inside the volume
+    const auto last = bricked.getBrickIndex(0, size3_t{2, 1, 0});
+    EXPECT_EQ(im(4, 2, 0), storedVoxel(bricked, last, size3_t{1, 1, 1}));
+    EXPECT_EQ(im(4, 2, 0), storedVoxel(bricked, last, size3_t{2, 2, 1}));
+    EXPECT_EQ(im(3, 1, 1), storedVoxel(bricked, last, size3_t{0, 0, 3}));
+}
+
+TEST(VolumeBrickedTest, Downsample) {
+    VolumeRAMPrecision<int> volume{size3_t{5, 3, 2}};
+    std::iota(volume.getView().begin(), volume.getView().end(), 0);
+
+    const VolumeBricked bricked{volume, 2};
+
+    // Average of the voxels 0, 1, 5, 6, 15, 16, 20, 21
+    EXPECT_EQ(10, storedVoxel(bricked, bricked.getBrickIndex(1, size3_t{0}), size3_t{1, 1, 1}));
+}
+
+}  // namespace inviwo
@@ -0,0 +1,98 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/volumesampler.h>
+
+#include <cstdint>
+
+namespace inviwo {
+
+namespace {
+
+// A linear field, which trilinear interpolation should reproduce exactly
+template <typename T>
+std::shared_ptr<Volume> createLinearVolume(size3_t dims) {
+    auto ram = std::make_shared<VolumeRAMPrecision<T>>(dims);
+    const util::IndexMapper3D im{dims};
+    auto data = ram->getView();
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                data[im(x, y, z)] = util::glm_convert<T>(dvec3{x, 2 * y, 3 * z});
+            }
+        }
+    }
+    return std::make_shared<Volume>(ram);
+}
+
+}  // namespace
+
+TEST(VolumeSamplerTest, TrilinearVec3) {
+    const size3_t dims{4, 3, 2};
+    const VolumeSampler<dvec3> sampler{createLinearVolume<vec3>(dims)};
+
+    for (const dvec3 pos : {dvec3{0.0}, dvec3{1.0}, dvec3{0.25, 0.5, 0.75}, dvec3{0.9, 0.1, 0.3}}) {
+        const dvec3 index = pos * dvec3{dims - size3_t{1}};
+        const dvec3 expected{index.x, 2.0 * index.y, 3.0 * index.z};
+        const auto value = sampler.sample(pos);
+        EXPECT_NEAR(expected.x, value.x, 1e-6);
+        EXPECT_NEAR(expected.y, value.y, 1e-6);
+        EXPECT_NEAR(expected.z, value.z, 1e-6);
+    }
+}
+
+TEST(VolumeSamplerTest, ScalarFromUInt8) {
+    const VolumeDoubleSampler<1> sampler{createLinearVolume<std::uint8_t>(size3_t{5, 2, 2})};
+    EXPECT_DOUBLE_EQ(0.0, sampler.sample(dvec3{0.0}));
+    EXPECT_DOUBLE_EQ(2.0, sampler.sample(dvec3{0.5, 0.0, 0.0}));
+    EXPECT_DOUBLE_EQ(3.0, sampler.sample(dvec3{0.75, 1.0, 1.0}));
+}
+
+TEST(VolumeSamplerTest, SampleIfWithinBounds) {
+    const VolumeSampler<dvec3> sampler{createLinearVolume<vec3>(size3_t{4, 3, 2})};
+
+    const dvec3 inside{0.5, 0.5, 0.5};
+    const auto value = sampler.sampleIfWithinBounds(inside);
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(sampler.sample(inside), *value);
+
+    EXPECT_FALSE(sampler.sampleIfWithinBounds(dvec3{1.5, 0.5, 0.5}).has_value());
+    EXPECT_FALSE(sampler.sampleIfWithinBounds(dvec3{0.5, -0.1, 0.5}).has_value());
+    EXPECT_EQ(dvec3{0.0}, sampler.sample(dvec3{1.5, 0.5, 0.5}));
+}
+
+}  // namespace inviwo
@@ -0,0 +1,87 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/volumesequencesampler.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+// A sequence of constant volumes, where time step i has the value i at timestamp i
+std::shared_ptr<VolumeSequence> createSequence(size_t timesteps) {
+    auto seq = std::make_shared<VolumeSequence>();
+    for (size_t i = 0; i < timesteps; ++i) {
+        auto ram = std::make_shared<VolumeRAMPrecision<vec3>>(size3_t{2, 2, 2});
+        std::ranges::fill(ram->getView(), vec3(static_cast<float>(i)));
+        auto volume = std::make_shared<Volume>(ram);
+        volume->setMetaData<DoubleMetaData>("timestamp", static_cast<double>(i));
+        seq->push_back(volume);
+    }
+    return seq;
+}
+
+}  // namespace
+
+TEST(VolumeSequenceSamplerTest, InterpolatesInAnyOrder) {
+    const VolumeSequenceSampler sampler{createSequence(5), false};
+
+    for (const double t : {0.5, 3.25, 3.75, 1.0, 0.0, 2.5, 3.5, 0.25}) {
+        const auto value = sampler.sample(dvec4{0.5, 0.5, 0.5, t});
+        EXPECT_NEAR(t, value.x, 1e-6);
+        EXPECT_NEAR(t, value.z, 1e-6);
+    }
+    EXPECT_EQ(dvec3{0.0}, sampler.sample(dvec4{0.5, 0.5, 0.5, -1.0}));
+}
+
+TEST(VolumeSequenceSamplerTest, SampleMultiple) {
+    const VolumeSequenceSampler sampler{createSequence(4), false};
+
+    std::vector<dvec4> positions;
+    for (const double t : {0.0, 0.1, 0.7, 1.2, 2.9, 2.95, 0.4, -0.5}) {
+        positions.emplace_back(0.25, 0.5, 0.75, t);
+    }
+    std::vector<dvec3> results(positions.size());
+    sampler.sampleMultiple(positions, results);
+
+    for (size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_EQ(sampler.sample(positions[i]), results[i]) << "t = " << positions[i].w;
+    }
+}
+
+}  // namespace inviwo
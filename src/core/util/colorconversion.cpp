@@ -31,8 +31,10 @@
 #include <inviwo/core/util/exception.h>
 #include <inviwo/core/util/stringconversion.h>
 #include <inviwo/core/util/glm.h>
+#include <inviwo/core/util/parallel.h>
 
 #include <algorithm>
+#include <array>
 #include <fmt/format.h>
 #include <charconv>
 
@@ -397,4 +399,262 @@ vec3 LuvChromaticity2XYZ(const vec3& LuvChroma, const vec3& whitePointXYZ) {
     return Luv2XYZ(vec3(L, u, v));
 }
 
+namespace {
+
+// Number of colors transposed into separate channel arrays at a time, small enough to stay in L1
+constexpr size_t blockSize = 256;
+
+struct Block {
+    alignas(64) std::array<float, blockSize> x;
+    alignas(64) std::array<float, blockSize> y;
+    alignas(64) std::array<float, blockSize> z;
+};
+
+// The kernels below work on whole blocks without branches in the loops, so that they get
+// vectorized. Unused values at the end of the last block are converted as well and then ignored.
+
+void rgb2hueBlock(const Block& in, std::array<float, blockSize>& hue,
+                  std::array<float, blockSize>& max, std::array<float, blockSize>& min) {
+    for (size_t i = 0; i < blockSize; ++i) {
+        const float r = in.x[i];
+        const float g = in.y[i];
+        const float b = in.z[i];
+        const float hi = std::max(std::max(r, g), b);
+        const float lo = std::min(std::min(r, g), b);
+        const float range = hi - lo;
+        const bool notGray = range > 1.0e-8f;
+        const float scale = notGray ? 1.0f / (6.0f * range) : 0.0f;
+
+        float h = (g - b) * scale;
+        h = g == hi ? 1.0f / 3.0f + (b - r) * scale : h;
+        h = b == hi ? 2.0f / 3.0f + (r - g) * scale : h;
+        h = h < 0.0f ? h + 1.0f : h;
+        hue[i] = notGray ? h : 0.0f;
+        max[i] = hi;
+        min[i] = lo;
+    }
+}
+
+void rgb2hsvBlock(Block& block) {
+    Block tmp;
+    rgb2hueBlock(block, tmp.x, tmp.y, tmp.z);
+    for (size_t i = 0; i < blockSize; ++i) {
+        const float hi = tmp.y[i];
+        const float lo = tmp.z[i];
+        block.x[i] = tmp.x[i];
+        block.y[i] = hi - lo > 1.0e-8f ? 1.0f - lo / hi : 0.0f;
+        block.z[i] = hi;
+    }
+}
+
+void rgb2hslBlock(Block& block) {
+    Block tmp;
+    rgb2hueBlock(block, tmp.x, tmp.y, tmp.z);
+    for (size_t i = 0; i < blockSize; ++i) {
+        const float hi = tmp.y[i];
+        const float lo = tmp.z[i];
+        const float lum = (hi + lo) * 0.5f;
+        const bool valid = lum > util::epsilon<float>() && lum < 1.0f - util::epsilon<float>();
+        block.x[i] = tmp.x[i];
+        block.y[i] = valid ? (hi - lo) / (1.0f - std::abs(2.0f * lum - 1.0f)) : 0.0f;
+        block.z[i] = lum;
+    }
+}
+
+void hsv2rgbBlock(Block& block) {
+    // f(n) = v - v * s * max(0, min(k, 4 - k, 1)), with k = (n + 6 h) mod 6
+    for (size_t i = 0; i < blockSize; ++i) {
+        const float h6 = block.x[i] * 6.0f;
+        const float vs = block.z[i] * block.y[i];
+        const float v = block.z[i];
+        const auto f = [&](float n) {
+            const float t = n + h6;
+            const float k = t - 6.0f * std::floor(t * (1.0f / 6.0f));
+            return v - vs * std::max(0.0f, std::min(std::min(k, 4.0f - k), 1.0f));
+        };
+        block.x[i] = f(5.0f);
+        block.y[i] = f(3.0f);
+        block.z[i] = f(1.0f);
+    }
+}
+
+void hsl2rgbBlock(Block& block) {
+    // f(n) = l - a * max(-1, min(k - 3, 9 - k, 1)), with k = (n + 12 h) mod 12
+    for (size_t i = 0; i < blockSize; ++i) {
+        const float h12 = block.x[i] * 12.0f;
+        const float l = block.z[i];
+        const float a = block.y[i] * std::min(l, 1.0f - l);
+        const auto f = [&](float n) {
+            const float t = n + h12;
+            const float k = t - 12.0f * std::floor(t * (1.0f / 12.0f));
+            return l - a * std::max(-1.0f, std::min(std::min(k - 3.0f, 9.0f - k), 1.0f));
+        };
+        block.x[i] = f(0.0f);
+        block.y[i] = f(8.0f);
+        block.z[i] = f(4.0f);
+    }
+}
+
+void linearizeBlock(std::array<float, blockSize>& c) {
+    for (auto& v : c) {
+        v = v > 0.04045f ? std::pow((v + 0.055f) * (1.0f / 1.055f), 2.4f) : v * (1.0f / 12.92f);
+    }
+}
+
+void compandBlock(std::array<float, blockSize>& c) {
+    for (auto& v : c) {
+        v = v > 0.0031308f ? std::pow(v, 1.0f / 2.4f) * 1.055f - 0.055f : v * 12.92f;
+    }
+}
+
+void multiplyBlock(Block& block, const mat3& m) {
+    for (size_t i = 0; i < blockSize; ++i) {
+        const float x = block.x[i];
+        const float y = block.y[i];
+        const float z = block.z[i];
+        block.x[i] = m[0][0] * x + m[1][0] * y + m[2][0] * z;
+        block.y[i] = m[0][1] * x + m[1][1] * y + m[2][1] * z;
+        block.z[i] = m[0][2] * x + m[1][2] * y + m[2][2] * z;
+    }
+}
+
+// Same matrices as in rgb2XYZ and XYZ2rgb
+const mat3 rgb2XYZD65Mat(0.4124564f, 0.2126729f, 0.0193339f, 0.3575761f, 0.7151522f, 0.1191920f,
+                         0.1804375f, 0.0721750f, 0.9503041f);
+const mat3 XYZ2rgbD65Mat(3.2404542f, -0.9692660f, 0.0556434f, -1.5371385f, 1.8760108f,
+                         -0.2040259f, -0.4985314f, 0.0415560f, 1.0572252f);
+
+void rgb2XYZBlock(Block& block) {
+    linearizeBlock(block.x);
+    linearizeBlock(block.y);
+    linearizeBlock(block.z);
+    multiplyBlock(block, rgb2XYZD65Mat);
+}
+
+void XYZ2rgbBlock(Block& block) {
+    multiplyBlock(block, XYZ2rgbD65Mat);
+    compandBlock(block.x);
+    compandBlock(block.y);
+    compandBlock(block.z);
+}
+
+void XYZ2labBlock(Block& block) {
+    constexpr float epsilon = 0.008856f;
+    constexpr float kappa = 903.3f;
+    const auto f = [&](std::array<float, blockSize>& c, float white) {
+        for (auto& v : c) {
+            const float t = v / white;
+            v = t > epsilon ? std::cbrt(t) : (kappa * t + 16.f) / 116.f;
+        }
+    };
+    f(block.x, D65WhitePoint.x);
+    f(block.y, D65WhitePoint.y);
+    f(block.z, D65WhitePoint.z);
+    for (size_t i = 0; i < blockSize; ++i) {
+        const float fx = block.x[i];
+        const float fy = block.y[i];
+        const float fz = block.z[i];
+        block.x[i] = 116.f * fy - 16.f;
+        block.y[i] = 500.f * (fx - fy);
+        block.z[i] = 200.f * (fy - fz);
+    }
+}
+
+void lab2XYZBlock(Block& block) {
+    constexpr float sixDivTwentyNine = 6.f / 29.f;
+    const auto f = [](float t) {
+        return t > sixDivTwentyNine ? t * t * t
+                                    : 3.f * sixDivTwentyNine * sixDivTwentyNine * (t - 4.f / 29.f);
+    };
+    for (size_t i = 0; i < blockSize; ++i) {
+        const float fy = (1.f / 116.f) * (block.x[i] + 16.f);
+        const float fx = fy + (1.f / 500.f) * block.y[i];
+        const float fz = fy - (1.f / 200.f) * block.z[i];
+        block.x[i] = D65WhitePoint.x * f(fx);
+        block.y[i] = D65WhitePoint.y * f(fy);
+        block.z[i] = D65WhitePoint.z * f(fz);
+    }
+}
+
+void rgb2ycbcrBlock(Block& block) {
+    for (size_t i = 0; i < blockSize; ++i) {
+        const float r = block.x[i];
+        const float b = block.z[i];
+        const float y = 0.299f * r + 0.587f * block.y[i] + 0.114f * b;
+        block.x[i] = y;
+        block.y[i] = (b - y) * 0.565f;
+        block.z[i] = (r - y) * 0.713f;
+    }
+}
+
+void ycbcr2rgbBlock(Block& block) {
+    for (size_t i = 0; i < blockSize; ++i) {
+        const float y = block.x[i];
+        const float cb = block.y[i];
+        const float cr = block.z[i];
+        block.x[i] = std::clamp(y + 1.402f * cr, 0.0f, 1.0f);
+        block.y[i] = std::clamp(y - 0.344136f * cb - 0.714136f * cr, 0.0f, 1.0f);
+        block.z[i] = std::clamp(y + 1.772f * cb, 0.0f, 1.0f);
+    }
+}
+
+void convertBlock(Conversion conversion, Block& block) {
+    switch (conversion) {
+        case Conversion::RgbToHsv:
+            return rgb2hsvBlock(block);
+        case Conversion::HsvToRgb:
+            return hsv2rgbBlock(block);
+        case Conversion::RgbToHsl:
+            return rgb2hslBlock(block);
+        case Conversion::HslToRgb:
+            return hsl2rgbBlock(block);
+        case Conversion::RgbToXYZ:
+            return rgb2XYZBlock(block);
+        case Conversion::XYZToRgb:
+            return XYZ2rgbBlock(block);
+        case Conversion::RgbToLab:
+            rgb2XYZBlock(block);
+            return XYZ2labBlock(block);
+        case Conversion::LabToRgb:
+            lab2XYZBlock(block);
+            return XYZ2rgbBlock(block);
+        case Conversion::RgbToYCbCr:
+            return rgb2ycbcrBlock(block);
+        case Conversion::YCbCrToRgb:
+            return ycbcr2rgbBlock(block);
+    }
+}
+
+}  // namespace
+
+void convert(Conversion conversion, std::span<const vec3> src, std::span<vec3> dst) {
+    if (src.size() != dst.size()) {
+        throw Exception(SourceContext{}, "Size mismatch in color conversion: {} and {} colors",
+                        src.size(), dst.size());
+    }
+
+    util::parallelFor(
+        0, src.size(),
+        [&](size_t first, size_t last) {
+            Block block{};
+            for (size_t begin = first; begin < last; begin += blockSize) {
+                const size_t count = std::min(blockSize, last - begin);
+                for (size_t i = 0; i < count; ++i) {
+                    block.x[i] = src[begin + i].x;
+                    block.y[i] = src[begin + i].y;
+                    block.z[i] = src[begin + i].z;
+                }
+                convertBlock(conversion, block);
+                for (size_t i = 0; i < count; ++i) {
+                    dst[begin + i] = vec3{block.x[i], block.y[i], block.z[i]};
+                }
+            }
+        },
+        {.grainSize = 64 * blockSize});
+}
+
+void convert(Conversion conversion, std::span<vec3> colors) {
+    convert(conversion, std::span<const vec3>{colors}, colors);
+}
+
 }  // namespace inviwo::color
@@ -32,6 +32,7 @@
 #include <inviwo/core/util/stdextensions.h>
 
 #include <glm/gtx/component_wise.hpp>
+#include <glm/vector_relational.hpp>
 
 namespace inviwo {
 
@@ -41,9 +42,41 @@ void ImageCache::setMaster(std::shared_ptr<const Image> master) {
     // Clear cache if format changes.
     if (master_ && master && master_->getDataFormat() != master->getDataFormat()) {
         cache_.clear();
+        levels_.clear();
+    }
+    if (master_ && master && master_->getDimensions() != master->getDimensions()) {
+        levels_.clear();
     }
     master_ = master;
     valid_ = false;
+    validLevels_ = 0;
+}
+
+const Image& ImageCache::source(size2_t dimensions) const {
+    if (glm::compMul(dimensions) == 0) return *master_;
+
+    const dvec2 masterDims{master_->getDimensions()};
+    // The size of the master when fitted into dimensions, keeping the aspect ratio
+    const dvec2 fitted = masterDims * glm::compMin(dvec2{dimensions} / masterDims);
+
+    const Image* image = master_.get();
+    for (size_t level = 0;; ++level) {
+        const size2_t current = image->getDimensions();
+        const size2_t next = glm::max(current / size_t{2}, size2_t{1});
+        if (next == current || glm::any(glm::lessThan(dvec2{next}, fitted))) break;
+
+        if (level == levels_.size()) {
+            auto mip = std::shared_ptr<Image>(master_->clone());
+            mip->setDimensions(next);
+            levels_.push_back(mip);
+        }
+        if (level >= validLevels_) {
+            image->copyRepresentationsTo(levels_[level].get());
+            validLevels_ = level + 1;
+        }
+        image = levels_[level].get();
+    }
+    return *image;
 }
 
 std::shared_ptr<const Image> ImageCache::getImage(const size2_t dimensions) const {
@@ -54,7 +87,7 @@ std::shared_ptr<const Image> ImageCache::getImage(const size2_t dimensions) cons
     if (!valid_) {
         // Resize all map data once
         for (auto& elem : cache_) {
-            master_->copyRepresentationsTo(elem.second.get());
+            source(elem.first).copyRepresentationsTo(elem.second.get());
         }
         valid_ = true;
     }
@@ -66,7 +99,7 @@ std::shared_ptr<const Image> ImageCache::getImage(const size2_t dimensions) cons
     } else {
         auto newImage = std::shared_ptr<Image>(master_->clone());
         newImage->setDimensions(dimensions);
-        master_->copyRepresentationsTo(newImage.get());
+        source(dimensions).copyRepresentationsTo(newImage.get());
         cache_[newImage->getDimensions()] = newImage;
         return newImage;
     }
@@ -115,7 +148,10 @@ void ImageCache::update(std::vector<size2_t> dimensions) {
     }
 }
 
-void ImageCache::setInvalid() const { valid_ = false; }
+void ImageCache::setInvalid() const {
+    valid_ = false;
+    validLevels_ = 0;
+}
 
 bool ImageCache::hasImage(const size2_t dimensions) {
     return cache_.find(dimensions) != cache_.end();
@@ -35,13 +35,68 @@
 #include <inviwo/core/datastructures/image/image.h>
 #include <inviwo/core/datastructures/image/layerram.h>
 #include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/glmconvert.h>
+#include <inviwo/core/util/parallel.h>
 
 #include <algorithm>
+#include <array>
+#include <span>
 
 namespace inviwo {
 
 namespace util {
 
+void convertColors(LayerRAM& layer, color::Conversion conversion) {
+    if (layer.getDataFormat()->getComponents() < 3) {
+        throw Exception(SourceContext{}, "Color conversion needs at least three channels, got {}",
+                        layer.getDataFormat()->getString());
+    }
+
+    layer.dispatch<void, dispatching::filter::Vecs>([&](auto* ramprecision) {
+        using ValueType = util::PrecisionValueType<decltype(ramprecision)>;
+        using T = util::value_type_t<ValueType>;
+        if constexpr (util::extent_v<ValueType> >= 3) {
+            auto* data = ramprecision->getDataTyped();
+            const size_t size = glm::compMul(ramprecision->getDimensions());
+
+            if constexpr (std::is_same_v<ValueType, vec3>) {
+                color::convert(conversion, std::span<vec3>{data, size});
+            } else {
+                // Convert through a small vec3 buffer, each task converts its own range of pixels
+                constexpr size_t bufferSize = 1024;
+                util::parallelFor(
+                    0, size,
+                    [&](size_t first, size_t last) {
+                        std::array<vec3, bufferSize> buffer;
+                        for (size_t begin = first; begin < last; begin += bufferSize) {
+                            const size_t count = std::min(bufferSize, last - begin);
+                            for (size_t i = 0; i < count; ++i) {
+                                const auto& v = data[begin + i];
+                                buffer[i] = vec3{util::glm_convert_normalized<float>(v.x),
+                                                 util::glm_convert_normalized<float>(v.y),
+                                                 util::glm_convert_normalized<float>(v.z)};
+                            }
+                            color::convert(conversion, std::span{buffer.data(), count});
+                            for (size_t i = 0; i < count; ++i) {
+                                auto& v = data[begin + i];
+                                for (int c = 0; c < 3; ++c) {
+                                    if constexpr (util::is_floating_point_v<T>) {
+                                        v[c] = static_cast<T>(buffer[i][c]);
+                                    } else {
+                                        v[c] = util::glm_convert_normalized<T>(
+                                            std::clamp(buffer[i][c], 0.0f, 1.0f));
+                                    }
+                                }
+                            }
+                        }
+                    },
+                    {.grainSize = 16 * bufferSize});
+            }
+        }
+    });
+}
+
 void flipLayerVertical(Layer& layer) {
     layer.getEditableRepresentation<LayerRAM>()->dispatch<void>([](auto layerpr) {
         using ValueType = util::PrecisionValueType<decltype(layerpr)>;
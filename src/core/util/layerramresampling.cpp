@@ -0,0 +1,229 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/util/layerramresampling.h>
+
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/glmutils.h>
+#include <inviwo/core/util/parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace inviwo::util {
+
+namespace {
+
+double boxWeight(double x) { return (x >= -0.5 && x < 0.5) ? 1.0 : 0.0; }
+
+double linearWeight(double x) {
+    x = std::abs(x);
+    return x < 1.0 ? 1.0 - x : 0.0;
+}
+
+double sinc(double x) {
+    if (x == 0.0) return 1.0;
+    const double px = std::numbers::pi * x;
+    return std::sin(px) / px;
+}
+
+double lanczosWeight(double x) {
+    x = std::abs(x);
+    return x < 3.0 ? sinc(x) * sinc(x / 3.0) : 0.0;
+}
+
+/**
+ * The source samples and their weights for each destination sample along one axis. Destination
+ * sample i is the sum over k < width of weights[i * width + k] * source[first[i] + k].
+ */
+struct Contributions {
+    size_t width = 1;
+    std::vector<size_t> first;
+    std::vector<float> weights;
+};
+
+Contributions contributions(size_t srcSize, size_t dstSize, ResamplingFilter filter) {
+    Contributions res;
+    res.first.resize(dstSize);
+    const double scale = static_cast<double>(srcSize) / static_cast<double>(dstSize);
+
+    if (filter == ResamplingFilter::Nearest) {
+        res.weights.assign(dstSize, 1.0f);
+        for (size_t i = 0; i < dstSize; ++i) {
+            res.first[i] = std::min(srcSize - 1, static_cast<size_t>((i + 0.5) * scale));
+        }
+        return res;
+    }
+
+    const auto [support, weight] = [&]() -> std::pair<double, double (*)(double)> {
+        switch (filter) {
+            case ResamplingFilter::Box:
+                return {0.5, boxWeight};
+            case ResamplingFilter::Lanczos:
+                return {3.0, lanczosWeight};
+            case ResamplingFilter::Linear:
+            default:
+                return {1.0, linearWeight};
+        }
+    }();
+
+    // Widen the filter when down sampling to cover all the source samples
+    const double stretch = std::max(1.0, scale);
+    const double radius = support * stretch;
+    res.width = std::min(srcSize, static_cast<size_t>(std::ceil(2.0 * radius)) + 1);
+    res.weights.assign(dstSize * res.width, 0.0f);
+
+    const auto last = static_cast<std::ptrdiff_t>(srcSize) - 1;
+    for (size_t i = 0; i < dstSize; ++i) {
+        // Sample centers are at j + 0.5 in both the source and destination
+        const double center = (static_cast<double>(i) + 0.5) * scale;
+        const auto lo = static_cast<std::ptrdiff_t>(std::ceil(center - radius - 0.5));
+        const auto hi = static_cast<std::ptrdiff_t>(std::floor(center + radius - 0.5));
+        const auto start =
+            std::clamp<std::ptrdiff_t>(lo, 0, static_cast<std::ptrdiff_t>(srcSize - res.width));
+        res.first[i] = static_cast<size_t>(start);
+
+        float* w = res.weights.data() + i * res.width;
+        double sum = 0.0;
+        for (auto j = lo; j <= hi; ++j) {
+            const double v = weight((static_cast<double>(j) + 0.5 - center) / stretch);
+            const auto k = std::clamp<std::ptrdiff_t>(j, 0, last) - start;
+            if (v == 0.0 || k < 0 || k >= static_cast<std::ptrdiff_t>(res.width)) continue;
+            w[k] += static_cast<float>(v);
+            sum += v;
+        }
+        if (sum != 0.0) {
+            std::transform(w, w + res.width, w,
+                           [&](float x) { return static_cast<float>(x / sum); });
+        }
+    }
+    return res;
+}
+
+template <typename T>
+void resampleTyped(const LayerRAMPrecision<T>& src, LayerRAMPrecision<T>& dst, size2_t offset,
+                   size2_t size, ResamplingFilter filter) {
+    using P = util::value_type_t<T>;
+    // Accumulate in double where float can not represent all values of the type
+    using A = std::conditional_t<(sizeof(P) >= 4 && !std::is_same_v<P, float>), double, float>;
+    using Acc = util::same_extent_t<T, A>;
+
+    const size2_t srcDims = src.getDimensions();
+    const size2_t dstDims = dst.getDimensions();
+    const T* srcData = src.getDataTyped();
+    T* dstData = dst.getDataTyped();
+
+    const auto cx = contributions(srcDims.x, size.x, filter);
+    const auto cy = contributions(srcDims.y, size.y, filter);
+
+    const auto toValue = [](const Acc& v) {
+        if constexpr (std::is_floating_point_v<P>) {
+            return static_cast<T>(v);
+        } else {
+            constexpr auto lowest = static_cast<A>(std::numeric_limits<P>::lowest());
+            constexpr auto max = static_cast<A>(std::numeric_limits<P>::max());
+            return static_cast<T>(glm::clamp(glm::round(v), Acc(lowest), Acc(max)));
+        }
+    };
+
+    // Resample along x, into size.x * srcDims.y values
+    std::vector<Acc> tmp(size.x * srcDims.y);
+    util::parallelFor(0, srcDims.y, [&](size_t y) {
+        const T* row = srcData + y * srcDims.x;
+        Acc* out = tmp.data() + y * size.x;
+        for (size_t x = 0; x < size.x; ++x) {
+            const T* s = row + cx.first[x];
+            const float* w = cx.weights.data() + x * cx.width;
+            Acc sum{0};
+            for (size_t k = 0; k < cx.width; ++k) {
+                sum += static_cast<Acc>(s[k]) * static_cast<A>(w[k]);
+            }
+            out[x] = sum;
+        }
+    });
+
+    // Resample along y, by accumulating whole rows which keeps the memory access contiguous
+    util::parallelFor(0, size.y, [&](size_t first, size_t last) {
+        std::vector<Acc> row(size.x);
+        for (size_t y = first; y < last; ++y) {
+            std::fill(row.begin(), row.end(), Acc{0});
+            const float* w = cy.weights.data() + y * cy.width;
+            for (size_t k = 0; k < cy.width; ++k) {
+                const Acc* in = tmp.data() + (cy.first[y] + k) * size.x;
+                const auto wk = static_cast<A>(w[k]);
+                for (size_t x = 0; x < size.x; ++x) row[x] += in[x] * wk;
+            }
+            T* out = dstData + (offset.y + y) * dstDims.x + offset.x;
+            std::transform(row.begin(), row.end(), out, toValue);
+        }
+    });
+}
+
+}  // namespace
+
+bool resample(const LayerRAM& src, LayerRAM& dst, ResamplingFilter filter,
+              ConsiderAspectRatio aspectRatio) {
+    if (!src.getData() || !dst.getData()) return false;
+    if (src.getDataFormatId() != dst.getDataFormatId()) return false;
+
+    const size2_t srcDims = src.getDimensions();
+    const size2_t dstDims = dst.getDimensions();
+    if (glm::compMul(srcDims) == 0 || glm::compMul(dstDims) == 0) return false;
+
+    const auto size = [&]() -> size2_t {
+        if (aspectRatio == ConsiderAspectRatio::No) return dstDims;
+        const double srcAspect = static_cast<double>(srcDims.x) / static_cast<double>(srcDims.y);
+        const double dstAspect = static_cast<double>(dstDims.x) / static_cast<double>(dstDims.y);
+        if (srcAspect > dstAspect) {
+            return {dstDims.x, std::max<size_t>(1, static_cast<size_t>(dstDims.x / srcAspect))};
+        } else {
+            return {std::max<size_t>(1, static_cast<size_t>(dstDims.y * srcAspect)), dstDims.y};
+        }
+    }();
+    const size2_t offset = (dstDims - size) / size_t{2};
+
+    return src.dispatch<bool, dispatching::filter::All>(
+        [&]<typename T>(const LayerRAMPrecision<T>* srcRep) {
+            auto& dstRep = static_cast<LayerRAMPrecision<T>&>(dst);
+            if (size != dstDims) {
+                std::fill_n(dstRep.getDataTyped(), glm::compMul(dstDims), T{0});
+            }
+            resampleTyped(*srcRep, dstRep, offset, size, filter);
+            return true;
+        });
+}
+
+}  // namespace inviwo::util
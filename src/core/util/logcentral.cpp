@@ -35,14 +35,163 @@
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/network/processornetwork.h>
 
+#include <atomic>
+#include <bit>
 #include <chrono>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
+#include <fmt/format.h>
 #include <fmt/std.h>
 #include <fmt/chrono.h>
 
 namespace inviwo {
 
+namespace {
+
+struct Message {
+    std::string source;
+    std::string file;
+    std::string function;
+    std::string msg;
+    LogLevel level = LogLevel::Info;
+    LogAudience audience = LogAudience::User;
+    int line = 0;
+};
+
+/**
+ * Bounded lock-free multiple producer single consumer queue, based on the bounded MPMC queue by
+ * Dmitry Vyukov. A producer claims a cell by advancing the enqueue position and publishes it by
+ * updating the sequence number of the cell.
+ */
+class MPSCQueue {
+public:
+    explicit MPSCQueue(size_t capacity)
+        : mask_{capacity - 1}, cells_{std::make_unique<Cell[]>(capacity)} {
+        IVW_ASSERT(std::has_single_bit(capacity), "Capacity must be a power of two");
+        for (size_t i = 0; i < capacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Moves from \p item only if there was room in the queue.
+     */
+    bool tryPush(Message& item) {
+        auto pos = enqueuePos_.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = cells_[pos & mask_];
+            const auto seq = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.data = std::move(item);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // full
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Must only be called from the consumer thread
+     */
+    bool tryPop(Message& item) {
+        auto& cell = cells_[dequeuePos_ & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeuePos_ + 1) return false;
+        item = std::move(cell.data);
+        cell.sequence.store(dequeuePos_ + mask_ + 1, std::memory_order_release);
+        ++dequeuePos_;
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Message data;
+    };
+    size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    std::atomic<size_t> enqueuePos_{0};
+    size_t dequeuePos_{0};
+};
+
+}  // namespace
+
+struct LogCentral::State {
+    struct RateLimit {
+        std::chrono::steady_clock::time_point start;
+        size_t count = 0;
+        size_t dropped = 0;
+    };
+
+    struct Async {
+        static constexpr size_t capacity = 4096;
+
+        explicit Async(LogCentral& logCentral)
+            : queue{capacity}, thread{[this, &logCentral]() { run(logCentral); }} {}
+        Async(const Async&) = delete;
+        Async& operator=(const Async&) = delete;
+        ~Async() {
+            stop.store(true, std::memory_order_release);
+            signal.fetch_add(1, std::memory_order_release);
+            signal.notify_one();
+            thread.join();
+        }
+
+        bool isDispatchThread() const { return std::this_thread::get_id() == thread.get_id(); }
+
+        void push(Message&& message) {
+            while (!queue.tryPush(message)) std::this_thread::yield();
+            pushed.fetch_add(1, std::memory_order_release);
+            signal.fetch_add(1, std::memory_order_release);
+            signal.notify_one();
+        }
+
+        void flush() {
+            const auto target = pushed.load(std::memory_order_acquire);
+            auto current = dispatched.load(std::memory_order_acquire);
+            while (current < target) {
+                dispatched.wait(current, std::memory_order_acquire);
+                current = dispatched.load(std::memory_order_acquire);
+            }
+        }
+
+        void run(LogCentral& logCentral) {
+            Message m;
+            while (true) {
+                const auto current = signal.load(std::memory_order_acquire);
+                while (queue.tryPop(m)) {
+                    logCentral.dispatch(m.source, m.level, m.audience, m.file, m.function, m.line,
+                                        m.msg);
+                    dispatched.fetch_add(1, std::memory_order_release);
+                    dispatched.notify_all();
+                }
+                if (stop.load(std::memory_order_acquire)) break;
+                signal.wait(current, std::memory_order_acquire);
+            }
+        }
+
+        MPSCQueue queue;
+        std::atomic<size_t> signal{0};
+        std::atomic<size_t> pushed{0};
+        std::atomic<size_t> dispatched{0};
+        std::atomic<bool> stop{false};
+        std::thread thread;
+    };
+
+    std::recursive_mutex mutex;
+    std::unordered_map<std::string, RateLimit> rateLimits;
+    std::unique_ptr<Async> async;
+};
+
 bool operator==(const LogLevel& lhs, const LogVerbosity& rhs) {
     return static_cast<LogVerbosity>(lhs) == rhs;
 }
@@ -75,42 +224,52 @@ bool operator<=(const LogVerbosity& lhs, const LogLevel& rhs) { return !(rhs < l
 
 bool operator>=(const LogVerbosity& lhs, const LogLevel& rhs) { return !(lhs < rhs); }
 
-LogCentral::LogCentral() : logVerbosity_(LogVerbosity::Info), logStacktrace_(false) {}
+LogCentral::LogCentral()
+    : logVerbosity_(LogVerbosity::Info), state_{std::make_unique<State>()}, logStacktrace_(false) {}
+
+LogCentral::~LogCentral() { state_->async.reset(); }
 
 void LogCentral::setVerbosity(LogVerbosity verbosity) { logVerbosity_ = verbosity; }
 
 LogVerbosity LogCentral::getVerbosity() { return logVerbosity_; }
 
-void LogCentral::registerLogger(std::weak_ptr<Logger> logger) { loggers_.push_back(logger); }
+void LogCentral::registerLogger(std::weak_ptr<Logger> logger) {
+    const std::scoped_lock lock{state_->mutex};
+    loggers_.push_back(logger);
+}
 
 void LogCentral::log(std::string_view source, LogLevel level, LogAudience audience,
                      std::string_view file, std::string_view function, int line,
                      std::string_view msg) {
+    std::string withStacktrace;
     if (logStacktrace_ && level == LogLevel::Error && audience == LogAudience::Developer) {
-        std::stringstream ss;
-        ss << msg;
+        fmt::memory_buffer buff;
+        buff.append(msg);
 
         const auto stacktrace = getStackTrace();
         // start at i == 3 to remove log and getStacktrace from stack trace
         for (size_t i = 3; i < stacktrace.size(); ++i) {
-            ss << '\n' << stacktrace[i];
+            fmt::format_to(fmt::appender(buff), "\n{}", stacktrace[i]);
         }
         // append an extra line break to easier separate several stack traces in a row
-        ss << '\n';
+        buff.push_back('\n');
 
-        msg = ss.str();
+        withStacktrace = fmt::to_string(buff);
+        msg = withStacktrace;
     }
 
     if (level >= logVerbosity_) {
-        // use remove if here to remove expired weak pointers while calling the loggers.
-        std::erase_if(loggers_, [&](const std::weak_ptr<Logger>& logger) {
-            if (auto l = logger.lock()) {
-                l->log(source, level, audience, file, function, line, msg);
-                return false;
-            } else {
-                return true;
-            }
-        });
+        if (state_->async && !state_->async->isDispatchThread()) {
+            state_->async->push(Message{.source = std::string{source},
+                                        .file = std::string{file},
+                                        .function = std::string{function},
+                                        .msg = std::string{msg},
+                                        .level = level,
+                                        .audience = audience,
+                                        .line = line});
+        } else {
+            dispatch(source, level, audience, file, function, line, msg);
+        }
     }
 
     switch (breakLevel_) {
@@ -130,6 +289,68 @@ void LogCentral::log(std::string_view source, LogLevel level, LogAudience audien
     }
 }
 
+void LogCentral::dispatch(std::string_view source, LogLevel level, LogAudience audience,
+                          std::string_view file, std::string_view function, int line,
+                          std::string_view msg) {
+    const std::scoped_lock lock{state_->mutex};
+
+    const auto send = [&](LogLevel sendLevel, std::string_view sendMsg) {
+        // use remove if here to remove expired weak pointers while calling the loggers.
+        std::erase_if(loggers_, [&](const std::weak_ptr<Logger>& logger) {
+            if (auto l = logger.lock()) {
+                l->log(source, sendLevel, audience, file, function, line, sendMsg);
+                return false;
+            } else {
+                return true;
+            }
+        });
+    };
+
+    if (rateLimit_ > 0 && level != LogLevel::Error) {
+        auto& limit = state_->rateLimits[fmt::format("{}:{}", file, line)];
+        const auto now = std::chrono::steady_clock::now();
+        if (now - limit.start >= std::chrono::seconds{1}) {
+            limit.start = now;
+            limit.count = 0;
+            if (const auto dropped = std::exchange(limit.dropped, 0); dropped > 0) {
+                send(LogLevel::Warn,
+                     fmt::format("Dropped {} messages from {}:{} due to the log rate limit",
+                                 dropped, file, line));
+            }
+        }
+        if (++limit.count > rateLimit_) {
+            ++limit.dropped;
+            return;
+        }
+    }
+
+    send(level, msg);
+}
+
+void LogCentral::setAsynchronous(bool asynchronous) {
+    if (asynchronous && !state_->async) {
+        state_->async = std::make_unique<State::Async>(*this);
+    } else if (!asynchronous && state_->async) {
+        state_->async.reset();
+    }
+}
+
+bool LogCentral::isAsynchronous() const { return state_->async != nullptr; }
+
+void LogCentral::flush() {
+    if (state_->async && !state_->async->isDispatchThread()) {
+        state_->async->flush();
+    }
+}
+
+void LogCentral::setRateLimit(size_t messagesPerSecond) {
+    const std::scoped_lock lock{state_->mutex};
+    rateLimit_ = messagesPerSecond;
+    state_->rateLimits.clear();
+}
+
+size_t LogCentral::getRateLimit() const { return rateLimit_; }
+
 void LogCentral::setLogStacktrace(const bool& logStacktrace) { logStacktrace_ = logStacktrace; }
 
 bool LogCentral::getLogStacktrace() const { return logStacktrace_; }
@@ -193,6 +414,20 @@ std::ostream& operator<<(std::ostream& ss, LogLevel ll) { return ss << enumToStr
 std::ostream& operator<<(std::ostream& ss, LogAudience la) { return ss << enumToStr(la); }
 std::ostream& operator<<(std::ostream& ss, MessageBreakLevel ll) { return ss << enumToStr(ll); }
 
+void log::detail::report(LogLevel level, SourceContext context, fmt::string_view format,
+                         fmt::format_args&& args) {
+    fmt::memory_buffer buff;
+    fmt::vformat_to(fmt::appender(buff), format, args);
+    ::inviwo::log::report(level, context, std::string_view{buff.data(), buff.size()});
+}
+
+void log::detail::report(Logger& logger, LogLevel level, SourceContext context,
+                         fmt::string_view format, fmt::format_args&& args) {
+    fmt::memory_buffer buff;
+    fmt::vformat_to(fmt::appender(buff), format, args);
+    ::inviwo::log::report(logger, level, context, std::string_view{buff.data(), buff.size()});
+}
+
 void log::detail::logDirectly(LogLevel level, SourceContext context, std::string_view message) {
     auto& os = level == LogLevel::Error ? std::cerr : std::cout;
     const auto time = std::chrono::system_clock::now();
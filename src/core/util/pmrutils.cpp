@@ -29,4 +29,48 @@
 
 #include <inviwo/core/util/pmrutils.h>
 
-namespace inviwo {}  // namespace inviwo
+namespace inviwo::util {
+
+namespace {
+
+struct Arena {
+    static constexpr size_t initialSize = 64 * 1024;
+
+    // Allocate the initial buffer lazily, only threads that use the arena pay for it.
+    std::pmr::monotonic_buffer_resource& get() {
+        if (!resource) {
+            buffer = std::make_unique<std::byte[]>(initialSize);
+            resource = std::make_unique<std::pmr::monotonic_buffer_resource>(
+                buffer.get(), initialSize, std::pmr::new_delete_resource());
+        }
+        return *resource;
+    }
+
+    std::unique_ptr<std::byte[]> buffer;
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> resource;
+    size_t depth = 0;
+};
+
+Arena& threadArena() {
+    thread_local Arena arena;
+    return arena;
+}
+
+}  // namespace
+
+ArenaScope::ArenaScope() { ++threadArena().depth; }
+
+ArenaScope::~ArenaScope() {
+    auto& arena = threadArena();
+    if (--arena.depth == 0 && arena.resource) {
+        // Keeps the initial buffer, returns any additional chunks to the upstream resource
+        arena.resource->release();
+    }
+}
+
+std::pmr::memory_resource* arenaResource() {
+    auto& arena = threadArena();
+    return arena.depth > 0 ? &arena.get() : std::pmr::get_default_resource();
+}
+
+}  // namespace inviwo::util
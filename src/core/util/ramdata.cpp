@@ -0,0 +1,89 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/util/ramdata.h>
+
+#include <inviwo/core/util/parallel.h>
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace inviwo::util::detail {
+
+namespace {
+
+// Matches the size of a transparent huge page, so each page is first touched by a single thread
+constexpr size_t pageGrainSize = size_t{2} << 20;
+
+void adviseHugePages([[maybe_unused]] void* data, [[maybe_unused]] size_t bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // madvise needs a page aligned range, only the whole pages inside the array are advised
+    const auto page = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<std::uintptr_t>(data) + page - 1) & ~(page - 1);
+    const auto end = (reinterpret_cast<std::uintptr_t>(data) + bytes) & ~(page - 1);
+    if (end > begin) {
+        // This is only a hint, the allocation works the same without huge pages
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+    }
+#endif
+}
+
+size_t grainSize(size_t bytes) {
+    const auto chunk = bytes / std::max<size_t>(1, 4 * util::getPoolSize());
+    return std::max<size_t>(1, (chunk + pageGrainSize - 1) / pageGrainSize) * pageGrainSize;
+}
+
+}  // namespace
+
+void zeroRAMData(void* data, size_t bytes) {
+    adviseHugePages(data, bytes);
+    auto* dst = static_cast<std::byte*>(data);
+    util::parallelFor(
+        0, bytes, [dst](size_t first, size_t last) { std::memset(dst + first, 0, last - first); },
+        {.grainSize = grainSize(bytes)});
+}
+
+void copyRAMData(void* dst, const void* src, size_t bytes) {
+    adviseHugePages(dst, bytes);
+    auto* out = static_cast<std::byte*>(dst);
+    const auto* in = static_cast<const std::byte*>(src);
+    util::parallelFor(
+        0, bytes,
+        [out, in](size_t first, size_t last) {
+            std::memcpy(out + first, in + first, last - first);
+        },
+        {.grainSize = grainSize(bytes)});
+}
+
+}  // namespace inviwo::util::detail
@@ -40,6 +40,12 @@ namespace inviwo {
 SystemSettings::SystemSettings(InviwoApplication* app)
     : Settings("System Settings", app)
     , poolSize_("poolSize", "Pool Size", defaultPoolSize(), 0, 32)
+    , parallelEvaluation_{"parallelEvaluation", "Parallel Network Evaluation",
+                          "Process independent processors that are marked as thread safe "
+                          "concurrently on the thread pool. All other processors are still "
+                          "processed on the main thread. Requires a pool size larger than "
+                          "zero"_help,
+                          false}
     , enablePortInspectors_("enablePortInspectors", "Enable port inspectors", true)
     , portInspectorSize_("portInspectorSize", "Port inspector size", 128, 1, 1024)
 #if __APPLE__
@@ -51,6 +57,18 @@ SystemSettings::SystemSettings(InviwoApplication* app)
     , enablePickingProperty_("enablePicking", "Enable picking", true)
     , enableSoundProperty_("enableSound", "Enable sound", true)
     , logStackTraceProperty_("logStackTraceProperty", "Error stack trace log", false)
+    , asynchronousLogging_{"asynchronousLogging", "Asynchronous Logging",
+                           "Forward log messages to the loggers from a background thread. Avoids "
+                           "blocking threads that log heavily, but messages may show up in the "
+                           "log slightly delayed"_help,
+                           false}
+    , logRateLimit_{"logRateLimit",
+                    "Log Rate Limit (messages/s)",
+                    "Maximum number of info and warning messages per second from each location "
+                    "in the code, additional messages are dropped. 0 means unlimited"_help,
+                    0,
+                    {0, ConstraintBehavior::Immutable},
+                    {1000, ConstraintBehavior::Ignore}}
     , moduleSearchPaths_(
           "moduleSearchPaths", "Module Search Paths",
           "The system will look for Inviwo module libs in these paths to load at start up. "
@@ -70,6 +88,48 @@ SystemSettings::SystemSettings(InviwoApplication* app)
                               "Useful for gettting a overview of memory usage, "
                               "but comes with a small runtime overhead"_help,
                               false}
+    , ramBudget_{"ramBudget",
+                 "RAM Budget (MB)",
+                 "Evict least recently used RAM representations, that can be recreated from an "
+                 "other representation, when more than this is used. 0 means unlimited"_help,
+                 0,
+                 {0, ConstraintBehavior::Immutable},
+                 {1'048'576, ConstraintBehavior::Ignore}}
+    , glBudget_{"glBudget",
+                "GPU Budget (MB)",
+                "Evict least recently used OpenGL representations, that can be recreated from "
+                "an other representation, when more than this is used. 0 means unlimited"_help,
+                0,
+                {0, ConstraintBehavior::Immutable},
+                {65'536, ConstraintBehavior::Ignore}}
+    , glMemoryWarning_{"glMemoryWarning",
+                       "GPU Memory Warning (MB)",
+                       "Log a warning, listing the processors using the most GPU memory, when the "
+                       "tracked OpenGL resources use more than this. Requires resource tracking to "
+                       "be enabled. 0 means no warning"_help,
+                       0,
+                       {0, ConstraintBehavior::Immutable},
+                       {65'536, ConstraintBehavior::Ignore}}
+    , resultCache_{"resultCache",
+                   "Result Cache (MB)",
+                   "Keep the results of processors tagged as deterministic in memory, and restore "
+                   "them instead of processing when the inputs and properties match an earlier "
+                   "evaluation. Least recently used results are dropped when more than this is "
+                   "used. 0 disables the cache"_help,
+                   0,
+                   {0, ConstraintBehavior::Immutable},
+                   {1'048'576, ConstraintBehavior::Ignore}}
+    , sessionCache_{"sessionCache",
+                    "Session Cache (MB)",
+                    "Keep values computed from data files, like histograms and data ranges, on "
+                    "disk and reuse them when the same unmodified files are opened in a later "
+                    "session. Least recently used values are removed when more than this is "
+                    "used. 0 disables the cache"_help,
+                    0,
+                    {0, ConstraintBehavior::Immutable},
+                    {1'048'576, ConstraintBehavior::Ignore}}
+    , clearSessionCache_{"clearSessionCache", "Clear Session Cache",
+                         "Remove all values stored in the session cache"_help}
     , redirectCout_{"redirectCout", "Redirect cout to LogCentral",
                     "Enabling this means that any std::cout messages will no longer end up in the "
                     "console, which can be confusing. "
@@ -83,14 +143,19 @@ SystemSettings::SystemSettings(InviwoApplication* app)
           "This does not work when console logging is enabled with --logconsole or -c"_help,
           false} {
 
-    addProperties(poolSize_, enablePortInspectors_, portInspectorSize_, enableTouchProperty_,
-                  enableGesturesProperty_, enablePickingProperty_, enableSoundProperty_,
-                  logStackTraceProperty_, moduleSearchPaths_, runtimeModuleReloading_,
-                  breakOnMessage_, breakOnException_, stackTraceInException_,
-                  enableResourceTracking_, redirectCout_, redirectCerr_);
+    addProperties(poolSize_, parallelEvaluation_, enablePortInspectors_, portInspectorSize_,
+                  enableTouchProperty_, enableGesturesProperty_, enablePickingProperty_,
+                  enableSoundProperty_, logStackTraceProperty_, asynchronousLogging_,
+                  logRateLimit_, moduleSearchPaths_, runtimeModuleReloading_, breakOnMessage_,
+                  breakOnException_, stackTraceInException_, enableResourceTracking_, ramBudget_,
+                  glBudget_, glMemoryWarning_, resultCache_, sessionCache_, clearSessionCache_,
+                  redirectCout_, redirectCerr_);
 
     logStackTraceProperty_.onChange(
         [this]() { LogCentral::getPtr()->setLogStacktrace(logStackTraceProperty_.get()); });
+    asynchronousLogging_.onChange(
+        [this]() { LogCentral::getPtr()->setAsynchronous(asynchronousLogging_.get()); });
+    logRateLimit_.onChange([this]() { LogCentral::getPtr()->setRateLimit(logRateLimit_.get()); });
 
     runtimeModuleReloading_.onChange([this]() {
         if (isDeserializing_) return;
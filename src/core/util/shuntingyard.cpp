@@ -63,6 +63,8 @@ THE SOFTWARE.
 
 #include <cstdlib>
 #include <stdexcept>
+#include <optional>
+#include <variant>
 #include <math.h>
 
 namespace inviwo {
@@ -269,6 +271,182 @@ std::string Calculator::shaderCode(std::string expression, std::map<std::string,
     return evaluation.top();
 }
 
+namespace {
+
+double apply(Program::Op op, double left, double right) {
+    switch (op) {
+        case Program::Op::Add:
+            return left + right;
+        case Program::Op::Sub:
+            return left - right;
+        case Program::Op::Mul:
+            return left * right;
+        case Program::Op::Div:
+            return left / right;
+        case Program::Op::Pow:
+            return pow(left, right);
+    }
+    return 0.0;
+}
+
+std::optional<Program::Op> toOp(std::string_view str) {
+    if (str == "+") return Program::Op::Add;
+    if (str == "-") return Program::Op::Sub;
+    if (str == "*") return Program::Op::Mul;
+    if (str == "/") return Program::Op::Div;
+    if (str == "^") return Program::Op::Pow;
+    return std::nullopt;
+}
+
+}  // namespace
+
+Program Calculator::compile(std::string expression, const std::map<std::string, double>& vars,
+                            const std::vector<std::string>& inputs) {
+    TokenQueue rpn = toRPN(expression, getOpeatorPrecedence());
+
+    Program program;
+    // During compilation an operand is either a constant or refers to a register or an input
+    using Value = std::variant<double, Program::Operand>;
+    std::stack<Value> evaluation;
+    std::vector<std::uint32_t> freeRegisters;
+    std::vector<double> constants;
+
+    const auto allocate = [&]() -> std::uint32_t {
+        if (freeRegisters.empty()) return program.numRegisters_++;
+        const auto reg = freeRegisters.back();
+        freeRegisters.pop_back();
+        return reg;
+    };
+    const auto release = [&](const Value& value) {
+        if (const auto* operand = std::get_if<Program::Operand>(&value);
+            operand && operand->kind == Program::Operand::Kind::Register) {
+            freeRegisters.push_back(operand->index);
+        }
+    };
+    const auto toOperand = [&](const Value& value) -> Program::Operand {
+        if (const auto* constant = std::get_if<double>(&value)) {
+            constants.push_back(*constant);
+            return {Program::Operand::Kind::Constant,
+                    static_cast<std::uint32_t>(constants.size() - 1)};
+        }
+        return std::get<Program::Operand>(value);
+    };
+    const auto input = [&](const std::string& name) -> Program::Operand {
+        auto it = std::find(program.inputs_.begin(), program.inputs_.end(), name);
+        if (it == program.inputs_.end()) {
+            it = program.inputs_.insert(program.inputs_.end(), name);
+        }
+        return {Program::Operand::Kind::Input,
+                static_cast<std::uint32_t>(std::distance(program.inputs_.begin(), it))};
+    };
+
+    while (!rpn.empty()) {
+        std::unique_ptr<TokenBase> base{std::move(rpn.front())};
+        rpn.pop();
+
+        if (auto* doubleTok = dynamic_cast<Token<double>*>(base.get())) {
+            evaluation.push(doubleTok->val);
+        } else if (auto* strTok = dynamic_cast<Token<std::string>*>(base.get())) {
+            const auto& str = strTok->val;
+            if (auto it = vars.find(str); it != vars.end()) {
+                evaluation.push(it->second);
+            } else if (util::contains(inputs, str)) {
+                evaluation.push(input(str));
+            } else if (auto op = toOp(str)) {
+                if (evaluation.size() < 2) {
+                    throw Exception(SourceContext{}, "Invalid equation: '{}'", expression);
+                }
+                const auto right = evaluation.top();
+                evaluation.pop();
+                const auto left = evaluation.top();
+                evaluation.pop();
+
+                if (std::holds_alternative<double>(left) && std::holds_alternative<double>(right)) {
+                    evaluation.push(apply(*op, std::get<double>(left), std::get<double>(right)));
+                } else {
+                    release(left);
+                    release(right);
+                    const auto dst = allocate();
+                    program.instructions_.push_back(
+                        {*op, toOperand(left), toOperand(right), dst});
+                    evaluation.push(Program::Operand{Program::Operand::Kind::Register, dst});
+                }
+            } else if (isvariablechar(str.front())) {
+                throw Exception(SourceContext{}, "Unknown variable: '{}'", str);
+            } else {
+                throw Exception(SourceContext{}, "Unknown operator: '{}'", str);
+            }
+        } else {
+            throw Exception(SourceContext{}, "Invalid token");
+        }
+    }
+
+    if (evaluation.size() != 1) {
+        throw Exception(SourceContext{}, "Invalid equation: '{}'", expression);
+    }
+
+    program.result_ = toOperand(evaluation.top());
+    program.constants_ = std::move(constants);
+
+    return program;
+}
+
+std::vector<double> Program::createRegisters() const {
+    std::vector<double> registers((numRegisters_ + constants_.size()) * blockSize);
+    for (size_t i = 0; i < constants_.size(); ++i) {
+        std::fill_n(registers.begin() + (numRegisters_ + i) * blockSize, blockSize, constants_[i]);
+    }
+    return registers;
+}
+
+void Program::evaluate(std::span<const double* const> inputs, size_t count, double* result,
+                       std::span<double> registers) const {
+    const auto get = [&](const Operand& operand) -> const double* {
+        switch (operand.kind) {
+            case Operand::Kind::Input:
+                return inputs[operand.index];
+            case Operand::Kind::Constant:
+                return registers.data() + (numRegisters_ + operand.index) * blockSize;
+            case Operand::Kind::Register:
+            default:
+                return registers.data() + operand.index * blockSize;
+        }
+    };
+
+    for (const auto& instruction : instructions_) {
+        const double* lhs = get(instruction.lhs);
+        const double* rhs = get(instruction.rhs);
+        double* dst = registers.data() + instruction.dst * blockSize;
+        switch (instruction.op) {
+            case Op::Add:
+                for (size_t i = 0; i < count; ++i) dst[i] = lhs[i] + rhs[i];
+                break;
+            case Op::Sub:
+                for (size_t i = 0; i < count; ++i) dst[i] = lhs[i] - rhs[i];
+                break;
+            case Op::Mul:
+                for (size_t i = 0; i < count; ++i) dst[i] = lhs[i] * rhs[i];
+                break;
+            case Op::Div:
+                for (size_t i = 0; i < count; ++i) dst[i] = lhs[i] / rhs[i];
+                break;
+            case Op::Pow:
+                for (size_t i = 0; i < count; ++i) dst[i] = pow(lhs[i], rhs[i]);
+                break;
+        }
+    }
+    std::copy_n(get(result_), count, result);
+}
+
+double Program::operator()(std::span<const double> inputs) const {
+    auto registers = createRegisters();
+    std::vector<const double*> pointers(inputs.size());
+    std::ranges::transform(inputs, pointers.begin(), [](const double& v) { return &v; });
+    double result = 0.0;
+    evaluate(pointers, 1, &result, registers);
+    return result;
+}
+
 }  // namespace shuntingyard
 
 }  // namespace inviwo
@@ -34,17 +34,40 @@
 
 namespace inviwo {
 
+namespace {
+
+// The worker, if any, that is running on the current thread
+thread_local void* currentWorker = nullptr;
+
+}  // namespace
+
 // the constructor just launches some amount of workers
 ThreadPool::ThreadPool(size_t threads, std::function<void()> onThreadStart,
                        std::function<void()> onThreadStop)
-    : onThreadStart_{std::move(onThreadStart)}, onThreadStop_{std::move(onThreadStop)} {
+    : queued{0}
+    , interactiveQueued{0}
+    , backgroundQueued{0}
+    , backgroundRunning{0}
+    , backgroundLimit{1}
+    , reservedWorkers{1}
+    , pending{0}
+    , sleeping{0}
+    , live{0}
+    , next{0}
+    , onThreadStart_{std::move(onThreadStart)}
+    , onThreadStop_{std::move(onThreadStop)} {
+    std::unique_lock<std::shared_mutex> lock(workers_mutex);
     while (workers.size() < threads) {
+        ++live;
         workers.push_back(std::make_unique<Worker>(*this));
     }
+    updateBackgroundLimit();
 }
 
 size_t ThreadPool::trySetSize(size_t size) {
+    std::unique_lock<std::shared_mutex> lock(workers_mutex);
     while (workers.size() < size) {
+        ++live;
         workers.push_back(std::make_unique<Worker>(*this));
     }
 
@@ -60,65 +83,271 @@ size_t ThreadPool::trySetSize(size_t size) {
             if (active <= size) break;
         }
 
+        { std::unique_lock<std::mutex> queueLock(queue_mutex); }
         condition.notify_all();
 
         std::erase_if(workers, [](const std::unique_ptr<Worker>& worker) {
             return worker->state == State::Done;
         });
     }
+    updateBackgroundLimit();
+    return workers.size();
+}
+
+size_t ThreadPool::getSize() const {
+    std::shared_lock<std::shared_mutex> lock(workers_mutex);
     return workers.size();
 }
 
-size_t ThreadPool::getSize() const { return workers.size(); }
+size_t ThreadPool::getQueueSize() { return pending; }
 
-size_t ThreadPool::getQueueSize() {
-    std::unique_lock<std::mutex> lock(queue_mutex);
-    return tasks.size();
+void ThreadPool::setReservedWorkers(size_t reserved) {
+    {
+        std::unique_lock<std::shared_mutex> lock(workers_mutex);
+        reservedWorkers = reserved;
+        updateBackgroundLimit();
+    }
+    { std::unique_lock<std::mutex> queueLock(queue_mutex); }
+    condition.notify_all();
+}
+
+size_t ThreadPool::getReservedWorkers() const { return reservedWorkers; }
+
+size_t ThreadPool::getBackgroundLimit() const { return backgroundLimit; }
+
+// Needs to be called while holding the workers_mutex
+void ThreadPool::updateBackgroundLimit() {
+    const size_t size = workers.size();
+    backgroundLimit = size > reservedWorkers ? size - reservedWorkers : size_t{1};
+}
+
+bool ThreadPool::hasRunnableTasks() const {
+    // Background tasks that are held back by the limit should not wake up any workers
+    return pending > backgroundQueued ||
+           (backgroundQueued > 0 && backgroundRunning < backgroundLimit);
 }
 
 ThreadPool::~ThreadPool() {
-    for (auto& worker : workers) worker->state = State::Abort;
+    // Move the workers out of the vector so we don't hold the lock while joining, the workers might
+    // need to take it before they notice that they should abort.
+    std::vector<std::unique_ptr<Worker>> aborted;
+    {
+        std::unique_lock<std::shared_mutex> lock(workers_mutex);
+        for (auto& worker : workers) worker->state = State::Abort;
+        std::swap(aborted, workers);
+    }
+    { std::unique_lock<std::mutex> queueLock(queue_mutex); }
     condition.notify_all();
-    workers.clear();  // this will join all threads.
+    aborted.clear();  // this will join all threads.
 }
 
 ThreadPool::Worker::~Worker() { thread.join(); }
 
 ThreadPool::Worker::Worker(ThreadPool& pool)
-    : state{State::Free}, thread{[this, &pool]() {
+    : state{State::Free}, pool{&pool}, accepting{true}, thread{[this, &pool]() {
         util::setThreadDescription("Inviwo Worker Thread");
+        currentWorker = this;
         pool.onThreadStart_();
         util::OnScopeExit cleanup{[&pool]() { pool.onThreadStop_(); }};
 
         for (;;) {
+            if (state == State::Abort) break;
+
             std::function<void()> task;
-            state = State::Free;
-            {
-                std::unique_lock<std::mutex> lock(pool.queue_mutex);
-                pool.condition.wait(lock, [this, &pool] {
-                    return state == State::Abort || state == State::Stop || !pool.tasks.empty();
-                });
-                if (state == State::Abort || (state == State::Stop && pool.tasks.empty())) break;
-                task = std::move(pool.tasks.front());
-                pool.tasks.pop();
+            if (pool.pop(this, task)) {
+                auto expected = State::Free;
+                state.compare_exchange_strong(expected, State::Working);
+                try {
+                    task();
+                } catch (...) {  // Make sure we don't leak any exceptions.
+                }
+                expected = State::Working;
+                state.compare_exchange_strong(expected, State::Free);
+                continue;
+            }
+
+            const bool stopping = state == State::Stop;
+            if (stopping) {
+                // Once our own queue is empty no more tasks will be added to it
+                std::unique_lock<std::mutex> lock(mutex);
+                if (!tasks.empty()) continue;
+                accepting = false;
             }
-            state = State::Working;
-            try {
-                task();
-            } catch (...) {  // Make sure we don't leak any exceptions.
+
+            std::unique_lock<std::mutex> lock(pool.queue_mutex);
+            if (stopping) {
+                // Only stop once there is nothing left to run in the pool, the tasks in the
+                // shared queues might otherwise never be run. The last worker also has to wait
+                // for the Background tasks that are held back by the limit.
+                if (pool.hasRunnableTasks()) continue;
+                if (pool.live > 1 || pool.pending == 0) {
+                    --pool.live;
+                    break;
+                }
             }
+            ++pool.sleeping;
+            pool.condition.wait(lock, [this, &pool, stopping] {
+                return state == State::Abort || pool.hasRunnableTasks() ||
+                       (state == State::Stop && (!stopping || pool.pending == 0));
+            });
+            --pool.sleeping;
         }
         state = State::Done;
     }} {}
 
-void ThreadPool::enqueueRaw(std::function<void()> task) {
-    if (workers.empty()) {
-        task();  // No worker threads, just run the task.
-    } else {
+auto ThreadPool::getCurrentWorker() const -> Worker* {
+    auto* worker = static_cast<Worker*>(currentWorker);
+    return worker && worker->pool == this ? worker : nullptr;
+}
+
+bool ThreadPool::popInteractive(std::function<void()>& task) {
+    if (interactiveQueued == 0) return false;
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    if (interactive.empty()) return false;
+    task = std::move(interactive.front());
+    interactive.pop();
+    --interactiveQueued;
+    --pending;
+    return true;
+}
+
+bool ThreadPool::popBackground(std::function<void()>& task) {
+    if (backgroundQueued == 0 || backgroundRunning >= backgroundLimit) return false;
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    if (background.empty() || backgroundRunning >= backgroundLimit) return false;
+    ++backgroundRunning;
+    task = [this, job = std::move(background.front())]() {
+        util::OnScopeExit done{[this]() {
+            --backgroundRunning;
+            if (backgroundQueued > 0) notify();
+        }};
+        job();
+    };
+    background.pop();
+    --backgroundQueued;
+    --pending;
+    return true;
+}
+
+bool ThreadPool::pop(Worker* self, std::function<void()>& task) {
+    if (pending == 0) return false;
+
+    if (popInteractive(task)) return true;
+
+    // Our own tasks, newest first
+    if (self) {
+        std::unique_lock<std::mutex> lock(self->mutex);
+        if (!self->tasks.empty()) {
+            task = std::move(self->tasks.back());
+            self->tasks.pop_back();
+            --pending;
+            return true;
+        }
+    }
+
+    if (queued > 0) {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        if (!tasks.empty()) {
+            task = std::move(tasks.front());
+            tasks.pop();
+            --queued;
+            --pending;
+            return true;
+        }
+    }
+
+    // Steal the oldest task from some other worker
+    std::shared_lock<std::shared_mutex> workersLock(workers_mutex);
+    const auto size = workers.size();
+    const auto offset = next++;
+    for (size_t i = 0; i < size; ++i) {
+        auto* worker = workers[(offset + i) % size].get();
+        if (worker == self) continue;
+        std::unique_lock<std::mutex> lock(worker->mutex);
+        if (!worker->tasks.empty()) {
+            task = std::move(worker->tasks.front());
+            worker->tasks.pop_front();
+            --pending;
+            return true;
+        }
+    }
+    workersLock.unlock();
+
+    return popBackground(task);
+}
+
+void ThreadPool::notify() {
+    // Make sure that we don't notify a worker in between its predicate check and its wait.
+    if (sleeping > 0) {
         std::unique_lock<std::mutex> lock(queue_mutex);
-        tasks.emplace(std::move(task));
     }
     condition.notify_one();
 }
 
+void ThreadPool::enqueueRaw(std::function<void()> task, Priority priority) {
+    if (push(task, priority)) {
+        notify();
+    } else {
+        task();  // No worker threads that would run it, just run the task.
+    }
+}
+
+bool ThreadPool::push(std::function<void()>& task, Priority priority) {
+    std::shared_lock<std::shared_mutex> workersLock(workers_mutex);
+    if (workers.empty()) return false;
+
+    // The shared queues are checked for live workers under the queue_mutex, since stopping
+    // workers only exit after checking that there is nothing left in them.
+    if (priority == Priority::Interactive) {
+        std::unique_lock<std::mutex> queueLock(queue_mutex);
+        if (live == 0) return false;
+        interactive.emplace(std::move(task));
+        ++interactiveQueued;
+        ++pending;
+    } else if (priority == Priority::Background) {
+        std::unique_lock<std::mutex> queueLock(queue_mutex);
+        if (live == 0) return false;
+        background.emplace(std::move(task));
+        ++backgroundQueued;
+        ++pending;
+    } else {
+        auto* worker = getCurrentWorker();
+        if (!worker) worker = workers[next++ % workers.size()].get();
+
+        std::unique_lock<std::mutex> lock(worker->mutex);
+        if (worker->accepting) {
+            worker->tasks.push_back(std::move(task));
+            ++pending;
+        } else {
+            lock.unlock();
+            std::unique_lock<std::mutex> queueLock(queue_mutex);
+            if (live == 0) return false;
+            tasks.emplace(std::move(task));
+            ++queued;
+            ++pending;
+        }
+    }
+    return true;
+}
+
+bool ThreadPool::tryRunTask() {
+    std::function<void()> task;
+    if (!pop(getCurrentWorker(), task)) return false;
+    try {
+        task();
+    } catch (...) {  // Make sure we don't leak any exceptions.
+    }
+    return true;
+}
+
+bool ThreadPool::tryRunInteractiveTask() {
+    std::function<void()> task;
+    if (!popInteractive(task)) return false;
+    try {
+        task();
+    } catch (...) {  // Make sure we don't leak any exceptions.
+    }
+    return true;
+}
+
 }  // namespace inviwo
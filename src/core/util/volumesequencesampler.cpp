@@ -27,21 +27,55 @@
  *
  *********************************************************************************/
 
+#include <inviwo/core/datastructures/volume/volumedisk.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/util/volumesequencesampler.h>
 
+#include <algorithm>
+
 namespace inviwo {
 
+namespace {
+
+// Load the RAM of a streamed time step. If the volume can recreate it from disk it is loaded
+// separately, and not added to the volume, so that it is freed once the sampler lets go of it.
+std::shared_ptr<const VolumeRAM> loadRAM(const Volume& volume) {
+    if (!volume.hasValidRepresentation<VolumeRAM>() &&
+        volume.hasValidRepresentation<VolumeDisk>()) {
+        auto repr = volume.getRepresentation<VolumeDisk>()->createRepresentation();
+        if (auto ram = std::dynamic_pointer_cast<const VolumeRAM>(repr)) {
+            return ram;
+        }
+    }
+    return volume.getRepresentationShared<VolumeRAM>();
+}
+
+// The time step that was last sampled on this thread. Consecutive samples are usually close in
+// time, e.g. along a path line, so this is where the next lookup starts. Samplers are used from
+// several threads at once, hence one cursor per thread rather than a member.
+struct TimestepCursor {
+    const void* sampler = nullptr;
+    size_t index = 0;
+};
+thread_local TimestepCursor cursor{};
+
+}  // namespace
+
 VolumeSequenceSampler::VolumeSequenceSampler(std::shared_ptr<const VolumeSequence> volumeSequence,
-                                             bool allowLooping)
+                                             bool allowLooping, size_t streamingWindow)
     : Spatial4DSampler<dvec3>(volumeSequence->front())
     , wrappers_()
-    , allowLooping_(allowLooping)
+    , timestamps_()
+    , allowLooping_(allowLooping && streamingWindow == 0)
     , timeRange_(0, 0)
-    , totDuration_(0) {
+    , totDuration_(0)
+    , windowSize_(streamingWindow == 0 ? 0 : std::max(streamingWindow, size_t{2}))
+    , window_(std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity())
+    , pending_() {
 
     for (const auto& vol : *volumeSequence) {
-        wrappers_.emplace_back(std::make_shared<Wrapper>(vol));
+        wrappers_.emplace_back(std::make_shared<Wrapper>(vol, windowSize_ == 0));
     }
 
     auto lastWrapper = wrappers_.back();
@@ -72,8 +106,9 @@ VolumeSequenceSampler::VolumeSequenceSampler(std::shared_ptr<const VolumeSequenc
         return;
     }
 
-    bool firstAndLastAreSame = true;
-    if (volumeSequence->size() >= 2) {
+    // Comparing the first and last time step would load them, skip it when streaming
+    bool firstAndLastAreSame = windowSize_ == 0;
+    if (firstAndLastAreSame && volumeSequence->size() >= 2) {
         auto firstVol = volumeSequence->front();
         auto lastVol = volumeSequence->back();
         auto firstVolRam = firstVol->getRepresentation<VolumeRAM>();
@@ -129,17 +164,50 @@ VolumeSequenceSampler::VolumeSequenceSampler(std::shared_ptr<const VolumeSequenc
 
     timeRange_.x = wrappers_.front()->timestamp_;
     timeRange_.y = wrappers_.back()->timestamp_ + wrappers_.back()->duration_;
+
+    timestamps_.reserve(wrappers_.size());
+    for (auto& w : wrappers_) {
+        timestamps_.push_back(w->timestamp_);
+    }
 }
 
 VolumeSequenceSampler::~VolumeSequenceSampler() {}
 
 dvec3 VolumeSequenceSampler::sampleDataSpace(const dvec4& pos) const {
-    auto spatialPos = dvec3(pos);
-    double t = pos.w;
+    const auto t = wrapTime(pos.w);
+    if (!t || timestamps_.empty()) {
+        return dvec3(0);
+    }
+
+    const auto index = findTimestep(*t, cursor.sampler == this ? cursor.index : 0);
+    cursor = {this, index};
+    return sampleTimestep(index, dvec3(pos), *t);
+}
+
+void VolumeSequenceSampler::sampleMultipleDataSpace(std::span<const dvec4> positions,
+                                                    std::span<dvec3> results) const {
+    if (timestamps_.empty()) {
+        std::ranges::fill(results, dvec3(0));
+        return;
+    }
 
+    size_t index = cursor.sampler == this ? cursor.index : 0;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        const auto t = wrapTime(positions[i].w);
+        if (!t) {
+            results[i] = dvec3(0);
+            continue;
+        }
+        index = findTimestep(*t, index);
+        results[i] = sampleTimestep(index, dvec3(positions[i]), *t);
+    }
+    cursor = {this, index};
+}
+
+std::optional<double> VolumeSequenceSampler::wrapTime(double t) const {
     if (t < timeRange_.x || t > timeRange_.y) {
         if (!allowLooping_) {
-            return dvec3(0);
+            return std::nullopt;
         }
         while (t < timeRange_.x) {
             t += totDuration_;
@@ -148,25 +216,43 @@ dvec3 VolumeSequenceSampler::sampleDataSpace(const dvec4& pos) const {
             t -= totDuration_;
         }
     }
+    return t;
+}
 
-    auto it = std::upper_bound(
-        wrappers_.begin(), wrappers_.end(), t,
-        [](double t2, const std::shared_ptr<Wrapper> a) { return t2 < a->timestamp_; });
-    --it;
-    auto wrapper = *it;
+size_t VolumeSequenceSampler::findTimestep(double t, size_t hint) const {
+    const auto size = timestamps_.size();
+    const auto contains = [&](size_t i) {
+        return i < size && timestamps_[i] <= t && (i + 1 == size || t < timestamps_[i + 1]);
+    };
+    if (contains(hint)) return hint;
+    if (contains(hint + 1)) return hint + 1;
+    if (hint > 0 && contains(hint - 1)) return hint - 1;
 
-    auto val0 = dvec3(wrapper->sampler_.sample(spatialPos));
-    if (wrapper->next_.expired()) {
+    const auto it = std::ranges::upper_bound(timestamps_, t);
+    return it == timestamps_.begin() ? 0 : static_cast<size_t>(it - timestamps_.begin()) - 1;
+}
+
+dvec3 VolumeSequenceSampler::sampleTimestep(size_t index, const dvec3& pos, double t) const {
+    const auto& wrapper = *wrappers_[index];
+    if (!wrapper.sampler_) {
+        return dvec3(0);
+    }
+
+    const auto val0 = dvec3(wrapper.sampler_->sample(pos));
+    if (index + 1 >= wrappers_.size() || !wrappers_[index + 1]->sampler_) {
         return val0;
     }
-    auto val1 = dvec3(wrapper->next_.lock()->sampler_.sample(spatialPos));
+    const auto val1 = dvec3(wrappers_[index + 1]->sampler_->sample(pos));
 
-    double x = (t - wrapper->timestamp_) / wrapper->duration_;
+    const double x = (t - wrapper.timestamp_) / wrapper.duration_;
     return Interpolation<dvec3>::linear(val0, val1, x);
 }
 
 bool VolumeSequenceSampler::withinBoundsDataSpace(const dvec4& pos) const {
-    // TODO check also time
+    // TODO check also time when not streaming
+    if (windowSize_ > 0 && (pos.w < window_.x || pos.w > window_.y)) {
+        return false;
+    }
     if (glm::any(glm::lessThan(dvec3(pos), dvec3(0.0)))) {
         return false;
     }
@@ -176,4 +262,60 @@ bool VolumeSequenceSampler::withinBoundsDataSpace(const dvec4& pos) const {
     return true;
 }
 
+dvec2 VolumeSequenceSampler::requestTimeWindow(const dvec2& range) const {
+    if (windowSize_ == 0 || wrappers_.empty()) {
+        return Spatial4DSampler<dvec3>::requestTimeWindow(range);
+    }
+
+    const auto size = wrappers_.size();
+    const bool forward = range.y >= range.x;
+    const auto index = [&](double t) -> size_t { return findTimestep(t, 0); };
+
+    // Interpolating at the end of the range needs the following time step as well
+    size_t first = index(std::min(range.x, range.y));
+    size_t last = std::min(index(std::max(range.x, range.y)) + 1, size - 1);
+    if (last - first + 1 < windowSize_) {
+        if (forward) {
+            last = std::min(first + windowSize_ - 1, size - 1);
+        } else {
+            first = last + 1 >= windowSize_ ? last + 1 - windowSize_ : 0;
+        }
+    }
+
+    // Release the time steps that left the window before loading new ones
+    for (size_t i = 0; i < size; ++i) {
+        if (i < first || i > last) {
+            wrappers_[i]->sampler_.reset();
+        }
+    }
+    for (size_t i = first; i <= last; ++i) {
+        auto& wrapper = *wrappers_[i];
+        if (wrapper.sampler_) continue;
+        auto it = std::ranges::find(pending_, i, &decltype(pending_)::value_type::first);
+        auto ram = it != pending_.end() ? it->second.get() : loadRAM(*wrapper.volume_);
+        wrapper.sampler_.emplace(std::move(ram), wrapper.volume_);
+    }
+
+    // Load the next window in the background, in the direction of travel
+    const size_t nextBegin =
+        forward ? last + 1 : (first >= windowSize_ ? first - windowSize_ : size_t{0});
+    const size_t nextEnd = forward ? std::min(last + 1 + windowSize_, size) : first;
+    std::erase_if(pending_,
+                  [&](const auto& item) { return item.first < nextBegin || item.first >= nextEnd; });
+    for (size_t i = nextBegin; i < nextEnd; ++i) {
+        if (std::ranges::find(pending_, i, &decltype(pending_)::value_type::first) !=
+            pending_.end()) {
+            continue;
+        }
+        pending_.emplace_back(
+            i, util::dispatchPool([volume = wrappers_[i]->volume_]() { return loadRAM(*volume); })
+                   .share());
+    }
+
+    const auto& back = *wrappers_[last];
+    window_.x = wrappers_[first]->timestamp_;
+    window_.y = last + 1 == size ? back.timestamp_ + back.duration_ : back.timestamp_;
+    return window_;
+}
+
 }  // namespace inviwo
@@ -46,6 +46,7 @@
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <filesystem>
@@ -227,11 +228,39 @@ void UndoManager::pushStateIfDirty() {
 }
 void UndoManager::markDirty() { dirty_ = true; }
 
+auto UndoManager::makeDelta(std::string_view before, std::string_view after)
+    -> std::optional<Delta> {
+    const auto prefix =
+        static_cast<size_t>(std::ranges::mismatch(before, after).in1 - before.begin());
+    if (prefix == before.size() && prefix == after.size()) return std::nullopt;
+
+    const auto maxSuffix = std::min(before.size(), after.size()) - prefix;
+    const auto suffix = static_cast<size_t>(
+        std::mismatch(before.rbegin(), before.rbegin() + maxSuffix, after.rbegin()).first -
+        before.rbegin());
+
+    return Delta{.prefix = prefix,
+                 .suffix = suffix,
+                 .before = std::pmr::string{before.substr(prefix, before.size() - prefix - suffix)},
+                 .after = std::pmr::string{after.substr(prefix, after.size() - prefix - suffix)}};
+}
+
+std::shared_ptr<const std::pmr::string> UndoManager::applyDelta(std::string_view state,
+                                                                const Delta& delta,
+                                                                std::string_view middle) {
+    auto str = std::make_shared<std::pmr::string>();
+    str->reserve(delta.prefix + middle.size() + delta.suffix);
+    str->append(state.substr(0, delta.prefix));
+    str->append(middle);
+    str->append(state.substr(state.size() - delta.suffix));
+    return str;
+}
+
 void UndoManager::pushState() {
     if (isRestoring) return;
 
     auto str = std::make_shared<std::pmr::string>();
-    str->reserve(8 * 1024);
+    str->reserve(current_ ? current_->size() : 8 * 1024);
 
     try {
         manager_->save(
@@ -241,12 +270,17 @@ void UndoManager::pushState() {
     }
 
     dirty_ = false;
-    if (head_ >= 0 && *str == *undoBuffer_[head_]) return;  // No Change
-
+    if (current_) {
+        // Only keep the part that changed, consecutive states usually only differ in a few
+        // property values
+        auto delta = makeDelta(*current_, *str);
+        if (!delta) return;  // No Change
+
+        deltas_.erase(deltas_.begin() + head_, deltas_.end());
+        deltas_.push_back(std::move(*delta));
+    }
     ++head_;
-    auto offset = std::min(std::distance(undoBuffer_.begin(), undoBuffer_.end()), head_);
-    undoBuffer_.erase(undoBuffer_.begin() + offset, undoBuffer_.end());
-    undoBuffer_.push_back(str);
+    current_ = str;
 
     if (!network_->empty()) {
         autoSaver_->save(str);
@@ -258,22 +292,24 @@ void UndoManager::undoState() {
     if (head_ > 0) {
         util::KeepTrueWhileInScope restore(&isRestoring);
         --head_;
+        const auto& delta = deltas_[static_cast<size_t>(head_)];
+        current_ = applyDelta(*current_, delta, delta.before);
 
-        manager_->load(*undoBuffer_[head_], refPath_, StandardExceptionHandler{},
-                       WorkspaceSaveMode::Undo);
+        manager_->load(*current_, refPath_, StandardExceptionHandler{}, WorkspaceSaveMode::Undo);
 
         dirty_ = false;
         updateActions();
     }
 }
 void UndoManager::redoState() {
-    if (head_ >= -1 && head_ < static_cast<DiffType>(undoBuffer_.size()) - 1) {
+    if (head_ >= 0 && head_ < static_cast<DiffType>(deltas_.size())) {
 
         util::KeepTrueWhileInScope restore(&isRestoring);
+        const auto& delta = deltas_[static_cast<size_t>(head_)];
+        current_ = applyDelta(*current_, delta, delta.after);
         ++head_;
 
-        manager_->load(*undoBuffer_[head_], refPath_, StandardExceptionHandler{},
-                       WorkspaceSaveMode::Undo);
+        manager_->load(*current_, refPath_, StandardExceptionHandler{}, WorkspaceSaveMode::Undo);
 
         dirty_ = false;
         updateActions();
@@ -282,7 +318,8 @@ void UndoManager::redoState() {
 
 void UndoManager::clear() {
     head_ = -1;
-    undoBuffer_.clear();
+    current_.reset();
+    deltas_.clear();
 }
 
 QAction* UndoManager::getUndoAction() const { return undoAction_; }
@@ -306,7 +343,7 @@ void UndoManager::restore() {
 
 void UndoManager::updateActions() {
     undoAction_->setEnabled(head_ > 0);
-    redoAction_->setEnabled(head_ >= -1 && head_ < static_cast<DiffType>(undoBuffer_.size()) - 1);
+    redoAction_->setEnabled(head_ >= 0 && head_ < static_cast<DiffType>(deltas_.size()));
 }
 
 #include <warn/push>
@@ -94,6 +94,12 @@ QPainterPath CurveGraphicsItem::obtainCurvePath(QPointF startPoint, QPointF endP
 
 void CurveGraphicsItem::paint(QPainter* p, const QStyleOptionGraphicsItem*, QWidget*) {
     const auto color = getColor();
+    if (lod::isSimplified(*p)) {
+        // Stroking the outline is expensive, just draw the curve without a border
+        p->strokePath(path_, QPen(isSelected() ? selectedBorderColor_ : color, 3.0));
+        return;
+    }
+
     auto stroker = QPainterPathStroker{};
     stroker.setCapStyle(Qt::RoundCap);
     if (isSelected()) {
@@ -128,10 +134,11 @@ void CurveGraphicsItem::setHoverInfo(const QString& info) {
 void CurveGraphicsItem::resetHoverInfo() { infoLabel_->setVisible(false); }
 
 void CurveGraphicsItem::updateShape() {
+    // Has to be called before the bounding rect changes to keep the scene index consistent
+    prepareGeometryChange();
     path_ = obtainCurvePath();
     const auto p = path_.boundingRect();
     rect_ = QRectF(p.topLeft() - QPointF(5, 5), p.size() + QSizeF(10, 10));
-    prepareGeometryChange();
 }
 
 QRectF CurveGraphicsItem::boundingRect() const { return rect_; }
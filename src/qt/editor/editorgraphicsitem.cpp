@@ -32,7 +32,9 @@
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/datastructures/image/image.h>
 #include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/ports/imageport.h>
+#include <inviwo/core/ports/portinspectormanager.h>
 #include <inviwo/core/ports/port.h>
 #include <inviwo/core/util/document.h>
 #include <inviwo/core/util/settings/systemsettings.h>
@@ -43,6 +45,9 @@
 #include <warn/ignore/all>
 #include <QGraphicsScene>
 #include <QGraphicsView>
+#include <QPainter>
+#include <QPointer>
+#include <QStyleOptionGraphicsItem>
 #include <QToolTip>
 #include <QBuffer>
 #include <QApplication>
@@ -50,6 +55,10 @@
 
 namespace inviwo {
 
+bool lod::isSimplified(const QPainter& p) {
+    return QStyleOptionGraphicsItem::levelOfDetailFromTransform(p.worldTransform()) < simplified;
+}
+
 EditorGraphicsItem::EditorGraphicsItem() : QGraphicsRectItem() {}
 
 EditorGraphicsItem::EditorGraphicsItem(QGraphicsItem* parent) : QGraphicsRectItem(parent) {}
@@ -152,19 +161,8 @@ void addLayersTable(Document::DocumentHandle& body,
     }
 }
 
-}  // namespace
-
-void EditorGraphicsItem::showPortInfo(QGraphicsSceneHelpEvent* e, Port* port) const {
-    if (!scene() || scene()->views().empty()) return;
-    QGraphicsView* view = scene()->views().first();
-    const QRectF rect = this->mapRectToScene(this->rect());
-    const QRect viewRect = view->mapFromScene(rect).boundingRect();
-    e->accept();
-
-    auto* settings = InviwoApplication::getPtr()->getSettingsByType<SystemSettings>();
-    const bool inspector = settings->enablePortInspectors_.get();
-    const auto portInspectorSize = static_cast<size_t>(settings->portInspectorSize_.get());
-
+Document portInfo(const Port* port, Outport* outport, const std::shared_ptr<const Image>& image,
+                  size_t portInspectorSize) {
     Document desc{};
     auto html = desc.append("html");
     html.append("head").append("style", R"(
@@ -187,34 +185,87 @@ void EditorGraphicsItem::showPortInfo(QGraphicsSceneHelpEvent* e, Port* port) co
     auto body = html.append("body");
     body.append(port->getInfo());
 
+    if (image && outport) {
+        std::vector<std::pair<std::string, const Layer*>> layers;
+        if (auto* imageOutport = dynamic_cast<ImageOutport*>(outport)) {
+            if (auto imageData = imageOutport->getData()) {
+                // register all color layers
+                layers = getLayersForImagePort(image, imageData);
+            }
+        } else {
+            // outport is not an ImageOutport, show only first color layer
+            layers.emplace_back("", image->getColorLayer(0));
+        }
+        addLayersTable(body, layers, portInspectorSize);
+    }
+    return desc;
+}
+
+}  // namespace
+
+void EditorGraphicsItem::showPortInfo(QGraphicsSceneHelpEvent* e, Port* port) const {
+    if (!scene() || scene()->views().empty()) return;
+    QGraphicsView* view = scene()->views().first();
+    const QRectF rect = this->mapRectToScene(this->rect());
+    const QRect viewRect = view->mapFromScene(rect).boundingRect();
+    e->accept();
+
+    auto* app = InviwoApplication::getPtr();
+    auto* settings = app->getSettingsByType<SystemSettings>();
+    const bool inspector = settings->enablePortInspectors_.get();
+    const auto portInspectorSize = static_cast<size_t>(settings->portInspectorSize_.get());
+
     auto inport = dynamic_cast<const Inport*>(port);
     auto outport = dynamic_cast<Outport*>(port);
     if (!outport && inport) {
         outport = inport->getConnectedOutport();
     }
 
+    // Only use an already rendered port inspector image here. Evaluating the inspector network
+    // can be slow for large data, so a missing image is rendered later and the tooltip updated.
+    std::shared_ptr<const Image> image;
+    bool deferred = false;
     if (inspector && outport) {
-        if (auto image = getNetworkEditor()->renderPortInspectorImage(outport)) {
-            std::vector<std::pair<std::string, const Layer*>> layers;
-            if (auto* imageOutport = dynamic_cast<ImageOutport*>(outport)) {
-                if (auto imageData = imageOutport->getData()) {
-                    // register all color layers
-                    layers = getLayersForImagePort(image, imageData);
-                }
-            } else {
-                // outport is not an ImageOutport, show only first color layer
-                layers.emplace_back("", image->getColorLayer(0));
-            }
-            addLayersTable(body, layers, portInspectorSize);
-        }
+        image = app->getPortInspectorManager()->getCachedPortInspectorImage(outport);
+        deferred = !image && outport->hasData() &&
+                   app->getPortInspectorManager()->isPortInspectorSupported(outport);
     }
 
+    const auto text = utilqt::toLocalQString(portInfo(port, outport, image, portInspectorSize));
+
     // Need to make sure that we have not pending qt stuff before showing tooltip
     // otherwise we might loose focus and the tooltip will go away...
     qApp->processEvents();
 
     // don't use showToolTipHelper here, since this might have been deleted in processEvents.
-    QToolTip::showText(e->screenPos(), utilqt::toLocalQString(desc), view, viewRect);
+    QToolTip::showText(e->screenPos(), text, view, viewRect);
+
+    if (!deferred) return;
+
+    // The port and this item might be gone by the time the render runs, look them up by path.
+    app->dispatchFrontAndForget([app, view = QPointer<QGraphicsView>{view}, text,
+                                 isInport = inport != nullptr, path = port->getPath(),
+                                 pos = e->screenPos(), viewRect, portInspectorSize]() {
+        const auto stillShown = [&]() {
+            return view && QToolTip::isVisible() && QToolTip::text() == text;
+        };
+        if (!stillShown()) return;
+
+        auto* network = app->getProcessorNetwork();
+        Port* port = isInport ? static_cast<Port*>(network->getInport(path))
+                              : static_cast<Port*>(network->getOutport(path));
+        if (!port) return;
+        auto* outport = isInport ? static_cast<Inport*>(port)->getConnectedOutport()
+                                 : static_cast<Outport*>(port);
+        if (!outport) return;
+
+        auto image = app->getPortInspectorManager()->renderPortInspectorImage(outport);
+        if (!image || !stillShown()) return;
+
+        QToolTip::showText(
+            pos, utilqt::toLocalQString(portInfo(port, outport, image, portInspectorSize)), view,
+            viewRect);
+    });
 }
 
 }  // namespace inviwo
@@ -0,0 +1,189 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2025 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/qt/editor/evaluationprofilerdockwidget.h>
+
+#include <inviwo/core/network/evaluationprofiler.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/filedialogstate.h>
+#include <modules/qtwidgets/inviwoqtutils.h>
+#include <modules/qtwidgets/inviwofiledialog.h>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <QCheckBox>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QTableWidgetItem>
+#include <QTimer>
+#include <QVBoxLayout>
+#include <warn/pop>
+
+#include <array>
+#include <chrono>
+#include <string_view>
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::array colNames{std::string_view{"Processor"},   std::string_view{"Count"},
+                              std::string_view{"Total (ms)"},  std::string_view{"Mean (ms)"},
+                              std::string_view{"Max (ms)"},    std::string_view{"GPU (ms)"},
+                              std::string_view{"Invalidations"}};
+
+double toMilliseconds(Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+/**
+ * Table item that sorts on the numerical value rather than on the displayed text
+ */
+class NumericItem : public QTableWidgetItem {
+public:
+    NumericItem(double value, int precision)
+        : QTableWidgetItem(QString::number(value, 'f', precision)), value_{value} {
+        setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+    }
+    virtual bool operator<(const QTableWidgetItem& other) const override {
+        if (const auto* item = dynamic_cast<const NumericItem*>(&other)) {
+            return value_ < item->value_;
+        }
+        return QTableWidgetItem::operator<(other);
+    }
+
+private:
+    double value_;
+};
+
+}  // namespace
+
+EvaluationProfilerDockWidget::EvaluationProfilerDockWidget(QWidget* parent,
+                                                           EvaluationProfiler& profiler)
+    : InviwoDockWidget("Evaluation Profiler", parent, "EvaluationProfiler")
+    , profiler_(profiler)
+    , table_{new QTableWidget(0, static_cast<int>(colNames.size()))}
+    , timer_{new QTimer(this)} {
+    setAllowedAreas(Qt::LeftDockWidgetArea | Qt::RightDockWidgetArea | Qt::BottomDockWidgetArea);
+    resize(utilqt::emToPx(this, QSizeF(50, 40)));  // default size
+
+    QStringList headers;
+    for (auto name : colNames) headers.append(utilqt::toQString(name));
+    table_->setHorizontalHeaderLabels(headers);
+    table_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table_->setSortingEnabled(true);
+    table_->verticalHeader()->setVisible(false);
+    table_->horizontalHeader()->setDefaultAlignment(Qt::AlignLeft);
+    table_->horizontalHeader()->setStretchLastSection(true);
+    table_->horizontalHeader()->setDefaultSectionSize(utilqt::emToPx(this, 8.0));
+    table_->setColumnWidth(0, utilqt::emToPx(this, 16.0));
+
+    auto* enable = new QCheckBox("Enable");
+    enable->setChecked(profiler_.isEnabled());
+    connect(enable, &QCheckBox::toggled, this, [this](bool checked) {
+        profiler_.setEnabled(checked);
+        if (checked) {
+            timer_->start();
+        } else {
+            timer_->stop();
+            updateTable();
+        }
+    });
+
+    auto* clear = new QPushButton("Clear");
+    connect(clear, &QPushButton::clicked, this, [this]() {
+        profiler_.clear();
+        updateTable();
+    });
+
+    auto* exportTrace = new QPushButton("Export Trace...");
+    exportTrace->setToolTip(
+        "Save the recorded events as a Chrome trace JSON file, which can be opened in "
+        "https://ui.perfetto.dev or chrome://tracing");
+    connect(exportTrace, &QPushButton::clicked, this, [this]() {
+        InviwoFileDialog saveFileDialog(this, "Export Trace ...", "evaluationprofiler");
+        saveFileDialog.setFileMode(FileMode::AnyFile);
+        saveFileDialog.setAcceptMode(AcceptMode::Save);
+        saveFileDialog.setOption(QFileDialog::Option::DontConfirmOverwrite, false);
+        saveFileDialog.addExtension("json", "Chrome Trace JSON");
+
+        if (saveFileDialog.exec()) {
+            const auto path = utilqt::toPath(saveFileDialog.selectedFiles().at(0));
+            try {
+                profiler_.writeChromeTrace(path);
+                log::info("Exported evaluation trace to '{}'", path);
+            } catch (const Exception& e) {
+                log::exception(e);
+            }
+        }
+    });
+
+    auto* bottom = new QHBoxLayout();
+    bottom->addWidget(enable);
+    bottom->addStretch();
+    bottom->addWidget(clear);
+    bottom->addWidget(exportTrace);
+
+    auto* layout = new QVBoxLayout();
+    layout->setSpacing(utilqt::emToPx(this, utilqt::refSpaceEm()));
+    layout->addWidget(table_);
+    layout->addLayout(bottom);
+    setContents(layout);
+    widget()->setContentsMargins(0, 0, 0, 0);
+
+    timer_->setInterval(1000);
+    connect(timer_, &QTimer::timeout, this, [this]() {
+        if (isVisible()) updateTable();
+    });
+    if (profiler_.isEnabled()) timer_->start();
+}
+
+void EvaluationProfilerDockWidget::updateTable() {
+    const auto stats = profiler_.getProcessorStats();
+
+    table_->setSortingEnabled(false);
+    table_->setRowCount(static_cast<int>(stats.size()));
+    for (int row = 0; const auto& item : stats) {
+        const auto mean = item.count > 0 ? toMilliseconds(item.total) / item.count : 0.0;
+        table_->setItem(row, 0, new QTableWidgetItem(utilqt::toQString(item.identifier)));
+        table_->setItem(row, 1, new NumericItem(static_cast<double>(item.count), 0));
+        table_->setItem(row, 2, new NumericItem(toMilliseconds(item.total), 2));
+        table_->setItem(row, 3, new NumericItem(mean, 2));
+        table_->setItem(row, 4, new NumericItem(toMilliseconds(item.max), 2));
+        table_->setItem(row, 5, new NumericItem(toMilliseconds(item.gpuTotal), 2));
+        table_->setItem(row, 6, new NumericItem(static_cast<double>(item.invalidations), 0));
+        ++row;
+    }
+    table_->setSortingEnabled(true);
+}
+
+}  // namespace inviwo
@@ -80,6 +80,8 @@
 #include <inviwo/qt/editor/inviwoeditmenu.h>
 #include <inviwo/qt/editor/welcomewidget.h>
 #include <inviwo/qt/editor/resourcemanager/resourcemanagerdockwidget.h>
+#include <inviwo/qt/editor/evaluationprofilerdockwidget.h>
+#include <inviwo/core/network/evaluationprofiler.h>
 #include <inviwo/qt/applicationbase/qtapptools.h>
 #include <inviwo/qt/editor/workspaceannotationsqt.h>
 #include <inviwo/qt/editor/fileassociations.h>
@@ -400,6 +402,12 @@ InviwoMainWindow::InviwoMainWindow(InviwoApplication* app)
     resourceManagerDockWidget_->setVisible(false);
     resourceManagerDockWidget_->loadState();
 
+    evaluationProfilerDockWidget_ =
+        new EvaluationProfilerDockWidget(this, *app->getEvaluationProfiler());
+    tabifyDockWidget(propertyListWidget_, evaluationProfilerDockWidget_);
+    evaluationProfilerDockWidget_->setVisible(false);
+    evaluationProfilerDockWidget_->loadState();
+
     addDockWidget(Qt::BottomDockWidgetArea, consoleWidget_.get());
     consoleWidget_->setVisible(true);
     consoleWidget_->loadState();
@@ -922,6 +930,8 @@ void InviwoMainWindow::addActions() {  // NOLINT
         viewMenuItem->addAction(annotationsWidget_->toggleViewAction());
         resourceManagerDockWidget_->toggleViewAction()->setText(tr("&Resource Manager"));
         viewMenuItem->addAction(resourceManagerDockWidget_->toggleViewAction());
+        evaluationProfilerDockWidget_->toggleViewAction()->setText(tr("&Evaluation Profiler"));
+        viewMenuItem->addAction(evaluationProfilerDockWidget_->toggleViewAction());
         consoleWidget_->toggleViewAction()->setText(tr("&Output Console"));
         viewMenuItem->addAction(consoleWidget_->toggleViewAction());
         helpWidget_->toggleViewAction()->setText(tr("&Help"));
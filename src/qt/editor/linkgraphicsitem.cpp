@@ -63,10 +63,12 @@ LinkGraphicsItem::LinkGraphicsItem(ivec3 color) : color_(color.r, color.g, color
 LinkGraphicsItem::~LinkGraphicsItem() = default;
 
 void LinkGraphicsItem::paint(QPainter* p, const QStyleOptionGraphicsItem*, QWidget*) {
+    // The dot pattern is expensive and not visible when zoomed out
+    const auto style = lod::isSimplified(*p) ? Qt::SolidLine : Qt::DotLine;
     if (isSelected()) {
-        p->setPen(QPen(Qt::darkRed, 2.0, Qt::DotLine, Qt::RoundCap));
+        p->setPen(QPen(Qt::darkRed, 2.0, style, Qt::RoundCap));
     } else {
-        p->setPen(QPen(color_, 2.0, Qt::DotLine, Qt::RoundCap));
+        p->setPen(QPen(color_, 2.0, style, Qt::RoundCap));
     }
     p->drawPath(path_);
 }
@@ -96,6 +98,9 @@ QPainterPath LinkGraphicsItem::shape() const {
 QRectF LinkGraphicsItem::boundingRect() const { return rect_; }
 
 void LinkGraphicsItem::updateShape() {
+    // Has to be called before the bounding rect changes to keep the scene index consistent
+    prepareGeometryChange();
+
     const auto start = utilqt::toGLM(getStartPoint());
     const auto end = utilqt::toGLM(getEndPoint());
 
@@ -103,8 +108,6 @@ void LinkGraphicsItem::updateShape() {
                 .marginsAdded(QMarginsF{40.0, 10.0, 40.0, 10.0});
 
     path_ = obtainCurvePath();
-
-    prepareGeometryChange();
 }
 
 LinkConnectionDragGraphicsItem::LinkConnectionDragGraphicsItem(ProcessorLinkGraphicsItem* outLink,
@@ -96,6 +96,8 @@
 #include <QGraphicsSimpleTextItem>
 #include <QInputDialog>
 
+#include <algorithm>
+
 #include <fmt/std.h>
 
 namespace inviwo {
@@ -122,6 +124,10 @@ NetworkEditor::NetworkEditor(InviwoMainWindow* mainWindow)
 
     setObjectName(name);
 
+    repaintTimer_.setSingleShot(true);
+    connect(&repaintTimer_, &QTimer::timeout, this, [this]() { repaintPending(); });
+    lastRepaint_.start();
+
     mainWindow->getInviwoApplication()->getProcessorNetworkEvaluator()->setExceptionHandler(
         [this](Processor* processor, EvaluationType type, SourceContext) {
             const auto& id = processor->getIdentifier();
@@ -341,6 +347,32 @@ void NetworkEditor::showLinkDialog(Processor* processor1, Processor* processor2)
     dialog->show();
 }
 
+void NetworkEditor::scheduleRepaint(ProcessorGraphicsItem* item) {
+    pendingRepaints_.emplace_back(item);
+    if (!repaintTimer_.isActive()) {
+        const auto wait = std::max(qint64{0}, repaintInterval - lastRepaint_.elapsed());
+        repaintTimer_.start(static_cast<int>(wait));
+    }
+}
+
+void NetworkEditor::repaintPending() {
+    lastRepaint_.restart();
+
+    std::vector<QRectF> visible;
+    for (auto* view : views()) {
+        visible.push_back(view->mapToScene(view->viewport()->rect()).boundingRect());
+    }
+
+    for (const auto& item : pendingRepaints_) {
+        if (!item || !item->isVisible()) continue;
+        const auto rect = item->sceneBoundingRect();
+        if (std::ranges::any_of(visible, [&](const QRectF& r) { return r.intersects(rect); })) {
+            item->update();
+        }
+    }
+    pendingRepaints_.clear();
+}
+
 std::shared_ptr<const Image> NetworkEditor::renderPortInspectorImage(Outport* outport) {
     auto pim = mainWindow_->getInviwoApplication()->getPortInspectorManager();
     return pim->renderPortInspectorImage(outport);
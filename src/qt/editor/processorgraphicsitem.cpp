@@ -234,54 +234,23 @@ ProcessorGraphicsItem::ProcessorGraphicsItem(Processor* processor)
     , progress_{std::nullopt}
     , currentProgress_{std::nullopt}
     , dirty_{false}
+    , labelsDirty_{true}
     , limitedUpdate_{} {
 
     setZValue(depth::processor);
     setFlags(ItemIsMovable | ItemIsSelectable | ItemIsFocusable | ItemSendsGeometryChanges);
     setRect(itemRect);
 
-    const auto setLabels = [&]() {
-        nameText_.setTextFormat(Qt::PlainText);
-        identifierText_.setTextFormat(Qt::PlainText);
-        tagText_.setTextFormat(Qt::PlainText);
-
-        const auto tags =
-            utilqt::toQString(util::getPlatformTags(processor_->getTags()).getString());
-        tagSize_ = [&]() {
-            const QFontMetricsF fm{getFont(FontType::Tag)};
-            return fm.tightBoundingRect(tags).width();
-        }();
-
-        nameText_.setText(elide(processor_->getDisplayName(), size.width() - (2.0 * labelMargin),
-                                FontType::Name));
-
-        identifierText_.setText(elide(processor_->getIdentifier(),
-                                      size.width() - (2.0 * labelMargin) - tagSize_ - tagMargin,
-                                      FontType::Identifier));
-        identifierSize_ = [&]() {
-            const QFontMetricsF fm{getFont(FontType::Identifier)};
-            return fm.tightBoundingRect(identifierText_.text()).width();
-        }();
-
-        tagText_.setText(tags);
-
-        QTextOption opts{Qt::AlignLeft | Qt::AlignBaseline};
-        opts.setWrapMode(QTextOption::NoWrap);
-        nameText_.setTextOption(opts);
-        identifierText_.setTextOption(opts);
-        tagText_.setTextOption(opts);
-    };
-    setLabels();
-    nameChange_ =
-        processor->onDisplayNameChange([this, setLabels](std::string_view, std::string_view) {
-            setLabels();
-            update();
-        });
-    idChange_ =
-        processor_->onIdentifierChange([this, setLabels](std::string_view, std::string_view) {
-            setLabels();
-            update();
-        });
+    // The labels are laid out on the first detailed paint, items that are off screen or drawn
+    // simplified never need them.
+    nameChange_ = processor->onDisplayNameChange([this](std::string_view, std::string_view) {
+        labelsDirty_ = true;
+        update();
+    });
+    idChange_ = processor_->onIdentifierChange([this](std::string_view, std::string_view) {
+        labelsDirty_ = true;
+        update();
+    });
 
     processor_->ProcessorObservable::addObserver(this);
     processorMeta_->addObserver(this);
@@ -313,6 +282,39 @@ ProcessorGraphicsItem::ProcessorGraphicsItem(Processor* processor)
     updateStatus();
 }
 
+void ProcessorGraphicsItem::updateLabels() {
+    nameText_.setTextFormat(Qt::PlainText);
+    identifierText_.setTextFormat(Qt::PlainText);
+    tagText_.setTextFormat(Qt::PlainText);
+
+    const auto tags = utilqt::toQString(util::getPlatformTags(processor_->getTags()).getString());
+    tagSize_ = [&]() {
+        const QFontMetricsF fm{getFont(FontType::Tag)};
+        return fm.tightBoundingRect(tags).width();
+    }();
+
+    nameText_.setText(
+        elide(processor_->getDisplayName(), size.width() - (2.0 * labelMargin), FontType::Name));
+
+    identifierText_.setText(elide(processor_->getIdentifier(),
+                                  size.width() - (2.0 * labelMargin) - tagSize_ - tagMargin,
+                                  FontType::Identifier));
+    identifierSize_ = [&]() {
+        const QFontMetricsF fm{getFont(FontType::Identifier)};
+        return fm.tightBoundingRect(identifierText_.text()).width();
+    }();
+
+    tagText_.setText(tags);
+
+    QTextOption opts{Qt::AlignLeft | Qt::AlignBaseline};
+    opts.setWrapMode(QTextOption::NoWrap);
+    nameText_.setTextOption(opts);
+    identifierText_.setTextOption(opts);
+    tagText_.setTextOption(opts);
+
+    labelsDirty_ = false;
+}
+
 QPointF ProcessorGraphicsItem::portOffset(PortType type, size_t index) {
     const QPointF offset = {12.5f, (type == PortType::In ? 1.0f : -1.0f) * 4.5f};
     static constexpr QPointF delta{12.5f, 0.0f};
@@ -431,6 +433,21 @@ void ProcessorGraphicsItem::paint(QPainter* p,
 
     p->drawRoundedRect(rect(), roundedCorners, roundedCorners);
 
+    if (lod::isSimplified(*p)) {
+        // Zoomed out, only the box and the status are legible
+        drawStatus(state_, statusPosition, *p);
+        currentState_ = state_;
+        currentProgress_ = progress_;
+#if IVW_PROFILING
+        currentProcessCount_ = processCount_;
+#endif
+        dirty_ = false;
+        p->restore();
+        return;
+    }
+
+    if (labelsDirty_) updateLabels();
+
     p->setFont(getFont(FontType::Name));
     p->setPen(Qt::white);
     p->drawStaticText(QPointF{rect().left() + labelMargin, -14.0}, nameText_);
@@ -732,7 +749,14 @@ bool ProcessorGraphicsItem::event(QEvent* e) {
             || (showCount_ && currentProcessCount_ != processCount_)
 #endif
         ) {
-            limitedUpdate_(this, this);
+            // Batch with the other processors in the editor, the preview scene has no editor
+            if (auto* editor = getNetworkEditor()) {
+                editor->scheduleRepaint(this);
+            } else {
+                limitedUpdate_(this, this);
+            }
+        } else {
+            dirty_ = false;
         }
         return true;  // event handled
     }
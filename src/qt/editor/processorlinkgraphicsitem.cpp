@@ -107,6 +107,8 @@ void ProcessorLinkGraphicsItem::LinkItem::mousePressEvent(QGraphicsSceneMouseEve
 
 void ProcessorLinkGraphicsItem::LinkItem::paint(QPainter* p, const QStyleOptionGraphicsItem*,
                                                 QWidget*) {
+    if (lod::isSimplified(*p)) return;
+
     p->save();
     p->setBrush(Qt::NoBrush);
     p->setBrush(QColor(164, 164, 164));
@@ -121,6 +121,13 @@ void ProcessorInportGraphicsItem::showToolTip(QGraphicsSceneHelpEvent* e) {
 }
 
 void ProcessorInportGraphicsItem::paint(QPainter* p, const QStyleOptionGraphicsItem*, QWidget*) {
+    if (lod::isSimplified(*p)) {
+        const uvec3 color = inport_->getColorCode();
+        p->fillRect(QRectF(QPointF(-size_, size_) / 2.0f, QPointF(size_, -size_) / 2.0f),
+                    QColor(color.r, color.g, color.b));
+        return;
+    }
+
     p->save();
     p->setRenderHint(QPainter::Antialiasing, true);
     p->setRenderHint(QPainter::SmoothPixmapTransform, true);
@@ -182,6 +189,13 @@ void ProcessorOutportGraphicsItem::showToolTip(QGraphicsSceneHelpEvent* e) {
 }
 
 void ProcessorOutportGraphicsItem::paint(QPainter* p, const QStyleOptionGraphicsItem*, QWidget*) {
+    if (lod::isSimplified(*p)) {
+        const uvec3 color = outport_->getColorCode();
+        p->fillRect(QRectF(QPointF(-size_, size_) / 2.0f, QPointF(size_, -size_) / 2.0f),
+                    QColor(color.r, color.g, color.b));
+        return;
+    }
+
     p->save();
     p->setRenderHint(QPainter::Antialiasing, true);
     p->setRenderHint(QPainter::SmoothPixmapTransform, true);
@@ -206,6 +220,8 @@ ProcessorPortConnectionIndicator::ProcessorPortConnectionIndicator(
 
 void ProcessorPortConnectionIndicator::paint(QPainter* p, const QStyleOptionGraphicsItem*,
                                              QWidget*) {
+    if (lod::isSimplified(*p)) return;
+
     p->save();
     p->setRenderHint(QPainter::Antialiasing, true);
 
@@ -36,10 +36,21 @@
 #include <inviwo/core/util/glm.h>
 #include <inviwo/core/util/formatconversion.h>
 #include <inviwo/core/resourcemanager/resourcemanagerobserver.h>
+#include <inviwo/core/resourcemanager/memorybudget.h>
 
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/util/settings/systemsettings.h>
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <warn/push>
 #include <warn/ignore/all>
 #include <QWidget>
@@ -47,6 +58,9 @@
 #include <QLabel>
 #include <QListView>
 #include <QTreeView>
+#include <QTreeWidget>
+#include <QTabWidget>
+#include <QTimer>
 #include <QHeaderView>
 #include <QStandardItemModel>
 #include <QStyledItemDelegate>
@@ -57,6 +71,7 @@
 #include <QIcon>
 #include <QCheckBox>
 #include <QSortFilterProxyModel>
+#include <QStringList>
 #include <warn/pop>
 
 namespace inviwo {
@@ -234,11 +249,26 @@ private:
     ResourceManager* manager_;  // should not be null
 };
 
+class ResourceChangeObserver : public ResourceManagerObserver {
+public:
+    explicit ResourceChangeObserver(std::function<void()> callback)
+        : callback_{std::move(callback)} {}
+
+    virtual void onDidAddResource(size_t, size_t, const Resource&) override { callback_(); }
+    virtual void onDidUpdateResource(size_t, size_t, const Resource&) override { callback_(); }
+    virtual void onDidRemoveResource(size_t, size_t, const Resource&) override { callback_(); }
+
+private:
+    std::function<void()> callback_;
+};
+
 ResourceManagerDockWidget::ResourceManagerDockWidget(QWidget* parent, ResourceManager& manager)
     : InviwoDockWidget("Resource Manager", parent, "ResourceManager")
     , manager_(manager)
     , model_{new ResourceManagerItemModel(&manager_, this)}
-    , view_{new QTreeView()} {
+    , view_{new QTreeView()}
+    , processors_{new QTreeWidget()}
+    , processorsTimer_{new QTimer(this)} {
     setAllowedAreas(Qt::LeftDockWidgetArea | Qt::RightDockWidgetArea);
     resize(utilqt::emToPx(this, QSizeF(40, 70)));  // default size
 
@@ -254,17 +284,59 @@ ResourceManagerDockWidget::ResourceManagerDockWidget(QWidget* parent, ResourceMa
     view_->expandRecursively({});
     view_->setUniformRowHeights(true);  // This make layout of the tree faster.
 
+    QStringList headers{"Processor"};
+    for (auto name : ResourceManager::names) headers.append(utilqt::toQString(name));
+    processors_->setHeaderLabels(headers);
+    processors_->setRootIsDecorated(false);
+    processors_->setUniformRowHeights(true);
+    processors_->header()->setDefaultAlignment(Qt::AlignLeft);
+    processors_->header()->setDefaultSectionSize(utilqt::emToPx(this, 10.0));
+
+    // Resources are often added and removed in bursts during evaluation, collect them into one
+    // update of the processor list
+    processorsTimer_->setSingleShot(true);
+    processorsTimer_->setInterval(250);
+    connect(processorsTimer_, &QTimer::timeout, this, [this]() { updateProcessors(); });
+    processorsObserver_ = std::make_unique<ResourceChangeObserver>([this]() {
+        if (!processorsTimer_->isActive()) processorsTimer_->start();
+    });
+    manager_.addObserver(processorsObserver_.get());
+
+    auto* tabs = new QTabWidget();
+    tabs->addTab(view_, "Resources");
+    tabs->addTab(processors_, "Processors");
+    connect(tabs, &QTabWidget::currentChanged, this, [this]() { updateProcessors(); });
+
     auto& settings = InviwoApplication::getPtr()->getSystemSettings();
     auto* enable = new QCheckBox("Enable");
     enable->setChecked(settings.enableResourceTracking_.get());
 
+    auto* pressure = new QLabel();
+    auto* budget = InviwoApplication::getPtr()->getMemoryBudget();
+    const auto updatePressure = [budget, pressure]() {
+        QStringList items;
+        for (auto pool : {MemoryBudget::Pool::RAM, MemoryBudget::Pool::GL}) {
+            if (const auto limit = budget->getBudget(pool); limit > 0) {
+                items.append(utilqt::toQString(fmt::format(
+                    "{}: {} / {} ({:.0f}%)", MemoryBudget::names[static_cast<size_t>(pool)],
+                    util::formatBytesToString(budget->getUsage(pool)),
+                    util::formatBytesToString(limit), 100.0 * budget->getPressure(pool))));
+            }
+        }
+        pressure->setText(items.join(", "));
+        pressure->setVisible(!items.empty());
+    };
+    updatePressure();
+    budgetCallback_ = budget->onChange(updatePressure);
+
     auto* bottom = new QHBoxLayout();
     bottom->addWidget(enable);
     bottom->addStretch();
+    bottom->addWidget(pressure);
 
     auto* layout = new QVBoxLayout();
     layout->setSpacing(utilqt::emToPx(this, utilqt::refSpaceEm()));
-    layout->addWidget(view_);
+    layout->addWidget(tabs);
     layout->addLayout(bottom);
     setContents(layout);
     widget()->setContentsMargins(0, 0, 0, 0);
@@ -287,4 +359,34 @@ ResourceManagerDockWidget::ResourceManagerDockWidget(QWidget* parent, ResourceMa
 #endif
 }
 
+ResourceManagerDockWidget::~ResourceManagerDockWidget() = default;
+
+void ResourceManagerDockWidget::updateProcessors() {
+    if (!processors_->isVisible()) return;
+
+    static constexpr auto groups = std::tuple_size_v<ResourceManager::Keys>;
+    using Usage = std::pair<std::string, std::array<size_t, groups>>;
+    std::unordered_map<std::string, std::array<size_t, groups>> usage;
+    for (size_t group = 0; group < groups; ++group) {
+        for (auto&& [id, bytes] : manager_.bytesPerProcessor(group)) {
+            usage[std::move(id)][group] = bytes;
+        }
+    }
+    std::vector<Usage> sorted(usage.begin(), usage.end());
+    std::ranges::sort(sorted, std::greater<>{}, [](const Usage& item) {
+        return std::accumulate(item.second.begin(), item.second.end(), size_t{0});
+    });
+
+    processors_->clear();
+    for (const auto& [id, bytes] : sorted) {
+        auto* item = new QTreeWidgetItem(processors_);
+        item->setText(0, id.empty() ? QString{"<no source>"} : utilqt::toQString(id));
+        for (size_t group = 0; group < groups; ++group) {
+            if (bytes[group] == 0) continue;
+            item->setText(static_cast<int>(group) + 1,
+                          utilqt::toQString(util::formatBytesToString(bytes[group])));
+        }
+    }
+}
+
 }  // namespace inviwo
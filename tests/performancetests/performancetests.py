@@ -0,0 +1,193 @@
+#!/usr/bin/env python
+
+# ********************************************************************************
+#
+# Inviwo - Interactive Visualization Workshop
+#
+# Copyright (c) 2025 Inviwo Foundation
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+# ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+# ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# ********************************************************************************
+
+"""
+Run the inviwo_benchmark application on a set of reference workspaces and compare the load time,
+first frame time, steady state frame time, and peak memory against stored baselines.
+See README.md for the configuration and report formats.
+"""
+import argparse
+import datetime
+import json
+import logging
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+
+logging.basicConfig(format='[%(levelname)s] %(message)s', level=logging.INFO)
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.abspath(os.path.join(HERE, '..', '..'))
+
+METRICS = {
+    'loadTime': lambda report: report['loadTime'],
+    'firstFrameTime': lambda report: report['firstFrameTime'],
+    # The median frame latency after the warmup frames
+    'frameTime': lambda report: report['frames']['p50'] if report['frames'] else None,
+    'peakResident': lambda report: report['memory']['peakResident'],
+}
+
+
+def parse_args():
+    """Parse commandline arguments"""
+    parser = argparse.ArgumentParser(
+        description='Run the Inviwo performance regression tests',
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    parser.add_argument('-b', '--benchmark', required=True,
+                        help='path to the inviwo_benchmark executable')
+    parser.add_argument('-c', '--config', default=os.path.join(HERE, 'performancetests.json'),
+                        help='the tests to run and their tolerances')
+    parser.add_argument('--baselines', default=os.path.join(HERE, 'baselines.json'),
+                        help='the stored baselines to compare against')
+    parser.add_argument('-r', '--report', default=None,
+                        help='where to write the json report, defaults to stdout')
+    parser.add_argument('-n', '--repeat', type=int, default=None,
+                        help='number of runs per test, overrides the config')
+    parser.add_argument('-t', '--tests', nargs='*', default=None,
+                        help='only run the tests with these names')
+    parser.add_argument('-u', '--update', action='store_true',
+                        help='store the measured values as the new baselines')
+    return parser.parse_args()
+
+
+def load_json(path, default=None):
+    """Load a json file, or return default if it does not exist"""
+    if default is not None and not os.path.exists(path):
+        return default
+    with open(path, encoding='utf-8') as file:
+        return json.load(file)
+
+
+def run_benchmark(benchmark, test):
+    """Run the benchmark once for test and return its report"""
+    workspace = os.path.join(ROOT, test['workspace'])
+    with tempfile.TemporaryDirectory() as tmp:
+        report = os.path.join(tmp, 'report.json')
+        cmd = [benchmark, '--workspace', workspace, '--report', report]
+        if 'benchmark' in test:
+            cmd += ['--benchmark', os.path.join(HERE, test['benchmark'])]
+        result = subprocess.run(cmd, cwd=tmp, capture_output=True, text=True, check=False)
+        if result.returncode != 0 or not os.path.exists(report):
+            raise RuntimeError('benchmark failed with exit code {}:\n{}{}'.format(
+                result.returncode, result.stdout, result.stderr))
+        return load_json(report)
+
+
+def measure(benchmark, test, repeat):
+    """The median of each metric over repeat runs"""
+    values = {metric: [] for metric in METRICS}
+    for _ in range(repeat):
+        report = run_benchmark(benchmark, test)
+        for metric, get in METRICS.items():
+            value = get(report)
+            if value is not None:
+                values[metric].append(value)
+    return {metric: statistics.median(v) for metric, v in values.items() if v}
+
+
+def compare(value, baseline, tolerance):
+    """Compare a measured value against its baseline, larger values are worse"""
+    if baseline is None:
+        return {'value': value, 'baseline': None, 'limit': None, 'status': 'nobaseline'}
+    limit = baseline * (1.0 + tolerance.get('relative', 0.0)) + tolerance.get('absolute', 0.0)
+    return {'value': value, 'baseline': baseline, 'limit': limit,
+            'status': 'regression' if value > limit else 'pass'}
+
+
+def main():
+    """Run the tests, write the report, and return the exit code"""
+    args = parse_args()
+    config = load_json(args.config)
+    baselines = load_json(args.baselines, default={})
+    repeat = args.repeat if args.repeat is not None else config.get('repeat', 1)
+    tolerances = config.get('tolerances', {})
+
+    results = []
+    for test in config['tests']:
+        name = test['name']
+        if args.tests is not None and name not in args.tests:
+            continue
+        logging.info('Running %s', name)
+        result = {'name': name, 'workspace': test['workspace'], 'runs': repeat}
+        try:
+            measured = measure(args.benchmark, test, repeat)
+        except (RuntimeError, OSError, json.JSONDecodeError, KeyError) as error:
+            logging.error('%s failed: %s', name, error)
+            result.update({'status': 'failed', 'error': str(error), 'metrics': {}})
+            results.append(result)
+            continue
+
+        baseline = baselines.get(name, {})
+        metrics = {metric: compare(value, baseline.get(metric), tolerances.get(metric, {}))
+                   for metric, value in measured.items()}
+        regressions = [m for m, r in metrics.items() if r['status'] == 'regression']
+        for metric in regressions:
+            logging.error('%s: %s regressed, %.1f is above the limit %.1f (baseline %.1f)',
+                          name, metric, metrics[metric]['value'], metrics[metric]['limit'],
+                          metrics[metric]['baseline'])
+        result.update({'status': 'regression' if regressions else 'pass', 'metrics': metrics})
+        results.append(result)
+
+        if args.update:
+            baselines[name] = measured
+
+    statuses = {result['status'] for result in results}
+    status = 'failed' if 'failed' in statuses else (
+        'regression' if 'regression' in statuses else 'pass')
+    report = {
+        'date': datetime.datetime.now(datetime.timezone.utc).isoformat(),
+        'benchmark': os.path.abspath(args.benchmark),
+        'status': status,
+        'tests': results,
+    }
+
+    text = json.dumps(report, indent=4)
+    if args.report:
+        with open(args.report, 'w', encoding='utf-8') as file:
+            file.write(text + '\n')
+    else:
+        print(text)
+
+    if args.update:
+        with open(args.baselines, 'w', encoding='utf-8') as file:
+            json.dump(baselines, file, indent=4, sort_keys=True)
+            file.write('\n')
+        logging.info('Updated baselines in %s', args.baselines)
+        return 0 if status != 'failed' else 1
+
+    logging.info('Performance tests: %s', status)
+    return 0 if status == 'pass' else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,104 @@
+# ********************************************************************************
+#
+# Inviwo - Interactive Visualization Workshop
+#
+# Copyright (c) 2025 Inviwo Foundation
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+# ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+# ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# ********************************************************************************
+
+import argparse
+import pathlib
+import subprocess
+import sys
+import tempfile
+
+description = """
+Render the main animation of a workspace in parallel by splitting the frames over several
+headless Inviwo processes, for example inviwo_glfwminimum. Each process renders its part using
+the recorders enabled in the workspace animation render options. Image sequences are numbered by
+the global frame index so the parts form one sequence. Movies are written as one file per part,
+which can be joined with the --concat option, this requires ffmpeg on the path.
+"""
+
+
+def makeCmdParser():
+    parser = argparse.ArgumentParser(
+        description=description,
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter
+    )
+    parser.add_argument('-i', '--inviwo', type=str, required=True, dest="inviwo",
+                        help='Path to the inviwo executable to use')
+    parser.add_argument('-w', '--workspace', type=str, required=True, dest="workspace",
+                        help='The workspace to render')
+    parser.add_argument('-n', '--processes', type=int, default=4, dest="processes",
+                        help='Number of processes to split the render over')
+    parser.add_argument('--concat', type=str, nargs='+', metavar=('OUTPUT', 'PART'),
+                        dest="concat", default=None,
+                        help='Join the movie parts, given in order, into the output movie')
+    parser.add_argument('args', nargs=argparse.REMAINDER,
+                        help='Extra arguments passed to each inviwo process')
+    return parser.parse_args()
+
+
+def render(inviwo, workspace, processes, extra):
+    jobs = []
+    for part in range(processes):
+        cmd = [inviwo, "--workspace", workspace, "--renderAnimation", f"{part}/{processes}",
+               "--logconsole", "--quit"] + extra
+        print(f"Starting part {part} of {processes}: {' '.join(cmd)}")
+        jobs.append(subprocess.Popen(cmd))
+
+    failed = [part for part, job in enumerate(jobs) if job.wait() != 0]
+    for part in failed:
+        print(f"Part {part} failed")
+    return not failed
+
+
+def concat(output, parts):
+    with tempfile.NamedTemporaryFile("w", suffix=".txt", delete=False) as listFile:
+        for part in parts:
+            path = pathlib.Path(part).resolve().as_posix()
+            listFile.write(f"file '{path}'\n")
+
+    cmd = ["ffmpeg", "-y", "-f", "concat", "-safe", "0", "-i", listFile.name, "-c", "copy",
+           output]
+    print(f"Joining {len(parts)} parts: {' '.join(cmd)}")
+    try:
+        return subprocess.run(cmd).returncode == 0
+    finally:
+        pathlib.Path(listFile.name).unlink()
+
+
+if __name__ == '__main__':
+    args = makeCmdParser()
+
+    if not render(args.inviwo, args.workspace, args.processes, args.args):
+        sys.exit(1)
+
+    if args.concat:
+        if len(args.concat) < 2:
+            print("--concat needs an output file and at least one part")
+            sys.exit(1)
+        if not concat(args.concat[0], args.concat[1:]):
+            sys.exit(1)